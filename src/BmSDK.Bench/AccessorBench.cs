@@ -0,0 +1,170 @@
+namespace BmSDK.Bench;
+
+/// <summary>
+/// Property accessors as the printer used to emit them (through MarshalUtil) and as it emits
+/// them now for kinds with a direct layout (a typed pointer at the property's offset).
+/// </summary>
+internal static unsafe class AccessorBench
+{
+    private const int IntOffset = 660;
+    private const int FloatOffset = 664;
+    private const int BoolOffset = 668;
+    private const int NameOffset = 672;
+
+    private static IntPtr Ptr;
+
+    public static void Run()
+    {
+        Ptr = FakeEngine.NewObjectPtr();
+
+        Bench.Measure(
+            "int get+set, MarshalUtil",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    IntMarshalled = i;
+                    sum += IntMarshalled;
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "int get+set, direct",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    IntDirect = i;
+                    sum += IntDirect;
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "float get, MarshalUtil",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    sum += (long)FloatMarshalled;
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "float get, direct",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    sum += (long)FloatDirect;
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "bool get+set, MarshalUtil",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    BoolMarshalled = (i & 1) != 0;
+                    sum += BoolMarshalled ? 1 : 0;
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "bool get+set, direct",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    BoolDirect = (i & 1) != 0;
+                    sum += BoolDirect ? 1 : 0;
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "FName get, MarshalUtil",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    sum += NameMarshalled.Index;
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "FName get, direct",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    sum += NameDirect.Index;
+                }
+                return sum;
+            }
+        );
+    }
+
+    private static int IntMarshalled
+    {
+        get { return MarshalUtil.ToManaged<int>(Ptr + IntOffset); }
+        set { MarshalUtil.ToUnmanaged(value, Ptr + IntOffset); }
+    }
+
+    private static int IntDirect
+    {
+        get { return *(int*)(Ptr + IntOffset); }
+        set { *(int*)(Ptr + IntOffset) = value; }
+    }
+
+    private static float FloatMarshalled => MarshalUtil.ToManaged<float>(Ptr + FloatOffset);
+
+    private static float FloatDirect => *(float*)(Ptr + FloatOffset);
+
+    private static bool BoolMarshalled
+    {
+        get { return (MarshalUtil.ToManaged<int>(Ptr + BoolOffset) & 1) != 0; }
+        set
+        {
+            var bitfield = MarshalUtil.ToManaged<int>(Ptr + BoolOffset);
+            MarshalUtil.ToUnmanaged(value ? bitfield | 1 : bitfield & ~1, Ptr + BoolOffset);
+        }
+    }
+
+    private static bool BoolDirect
+    {
+        get { return (*(int*)(Ptr + BoolOffset) & 1) != 0; }
+        set
+        {
+            if (value)
+                *(int*)(Ptr + BoolOffset) |= 1;
+            else
+                *(int*)(Ptr + BoolOffset) &= ~1;
+        }
+    }
+
+    private static FName NameMarshalled => MarshalUtil.ToManaged<FName>(Ptr + NameOffset);
+
+    private static FName NameDirect => *(FName*)(Ptr + NameOffset);
+}
@@ -0,0 +1,35 @@
+using System.Diagnostics;
+
+namespace BmSDK.Bench;
+
+/// <summary>
+/// Times a loop of <see cref="Iterations"/> operations and prints the best of several runs.
+/// </summary>
+internal static class Bench
+{
+    public const int Iterations = 20_000_000;
+    private const int Runs = 5;
+
+    /// <summary>
+    /// Runs the body once to warm up, then <see cref="Runs"/> times, and reports ns and bytes
+    /// allocated per operation. The body returns a checksum so its work can't be optimized out.
+    /// </summary>
+    public static void Measure(string name, Func<long> body)
+    {
+        var checksum = body();
+        var bestNs = double.MaxValue;
+        var allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+        for (var run = 0; run < Runs; run++)
+        {
+            var stopwatch = Stopwatch.StartNew();
+            checksum += body();
+            bestNs = Math.Min(bestNs, stopwatch.Elapsed.TotalNanoseconds / Iterations);
+        }
+
+        var bytesPerOp =
+            (GC.GetAllocatedBytesForCurrentThread() - allocatedBefore) / ((double)Runs * Iterations);
+        Console.WriteLine(
+            $"  {name, -36} {bestNs, 7:F2} ns/op {bytesPerOp, 7:F1} B/op  (checksum {checksum & 0xFF})"
+        );
+    }
+}
@@ -0,0 +1,91 @@
+namespace BmSDK.Bench;
+
+/// <summary>
+/// Generated function calls with the function looked up by path on every call, and with the
+/// handle cached in a static field as the printer emits now.
+/// </summary>
+internal static unsafe class CallBench
+{
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Func_Params
+    {
+        [FieldOffset(0)]
+        public int A;
+
+        [FieldOffset(4)]
+        public nint B;
+
+        [FieldOffset(8)]
+        public float C;
+
+        [FieldOffset(12)]
+        public int ReturnValue;
+    }
+
+    private static Class? s_FuncFunc = null;
+
+    public static void Run()
+    {
+        var self = FakeEngine.NewObject();
+        var other = FakeEngine.NewObject();
+
+        Bench.Measure(
+            "Lookup per call",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    sum += CallWithLookup(self, i, other, out _);
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "Cached handle",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    sum += CallWithCachedHandle(self, i, other, out _);
+                }
+                return sum;
+            }
+        );
+    }
+
+    // Fake objects are wrapped as Class (see FakeEngine), hence the lookup type
+    private static int CallWithLookup(GameObject self, int A, GameObject B, out float C)
+    {
+        var funcManaged = GameObject.StaticFindObjectChecked<Class>(
+            null,
+            null,
+            "Engine.Actor.Func",
+            true
+        );
+        var parms = new Func_Params();
+        parms.A = A;
+        parms.B = B?.Ptr ?? 0;
+        GameFunctions.ProcessEvent(self.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        C = parms.C;
+        return parms.ReturnValue;
+    }
+
+    private static int CallWithCachedHandle(GameObject self, int A, GameObject B, out float C)
+    {
+        var funcManaged = s_FuncFunc ??= GameObject.StaticFindObjectChecked<Class>(
+            null,
+            null,
+            "Engine.Actor.Func",
+            true
+        );
+        var parms = new Func_Params();
+        parms.A = A;
+        parms.B = B?.Ptr ?? 0;
+        GameFunctions.ProcessEvent(self.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        C = parms.C;
+        return parms.ReturnValue;
+    }
+}
@@ -0,0 +1,80 @@
+namespace BmSDK.Bench;
+
+/// <summary>
+/// Subclass checks over the generated Actor subtree: reflection, StaticInit.IsSubclassOf, and
+/// intervals looked up once and compared, as global redirects do.
+/// </summary>
+internal static class ClassTreeBench
+{
+    public static void Run()
+    {
+        StaticInit.StaticInitClasses();
+
+        var actorType = typeof(Engine.Actor);
+        var subtree = actorType
+            .Assembly.GetTypes()
+            .Where(type =>
+                type.IsAssignableTo(actorType) && StaticInit.TryGetClassTreeInterval(type, out _)
+            )
+            .ToArray();
+
+        // The root, a mid-level class, and the super of the deepest class
+        var deepest = subtree.MaxBy(type => StaticInit.EnumerateSelfAndSupers(type).Count)!;
+        Type[] targets = [actorType, typeof(Engine.Pawn), deepest.BaseType!];
+        Console.WriteLine(
+            $"  {subtree.Length} types under Actor, deepest {deepest.Name} at depth {StaticInit.EnumerateSelfAndSupers(deepest).Count}"
+        );
+
+        var pairs = subtree.SelectMany(type => targets.Select(target => (type, target))).ToArray();
+        var intervalPairs = pairs
+            .Select(pair =>
+            {
+                StaticInit.TryGetClassTreeInterval(pair.type, out var interval);
+                StaticInit.TryGetClassTreeInterval(pair.target, out var targetInterval);
+                return (interval, targetInterval);
+            })
+            .ToArray();
+
+        Bench.Measure(
+            "Type.IsAssignableTo",
+            () =>
+            {
+                long matches = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    var (type, target) = pairs[i % pairs.Length];
+                    matches += type.IsAssignableTo(target) ? 1 : 0;
+                }
+                return matches;
+            }
+        );
+
+        Bench.Measure(
+            "StaticInit.IsSubclassOf",
+            () =>
+            {
+                long matches = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    var (type, target) = pairs[i % pairs.Length];
+                    matches += StaticInit.IsSubclassOf(type, target) ? 1 : 0;
+                }
+                return matches;
+            }
+        );
+
+        Bench.Measure(
+            "Cached intervals",
+            () =>
+            {
+                long matches = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    var (interval, targetInterval) = intervalPairs[i % intervalPairs.Length];
+                    matches += targetInterval.Contains(interval) ? 1 : 0;
+                }
+                return matches;
+            }
+        );
+    }
+}
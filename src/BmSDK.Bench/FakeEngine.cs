@@ -0,0 +1,58 @@
+namespace BmSDK.Bench;
+
+/// <summary>
+/// Just enough of the engine for generated code to run: a <see cref="NativeApi"/> table whose
+/// functions do nothing, and zeroed objects. Every fake object's class has an
+/// ObjectInternalInteger of 0, so <see cref="MarshalUtil"/> wraps them as <see cref="Class"/>
+/// without reading names from GNames.
+/// </summary>
+internal static unsafe class FakeEngine
+{
+    private const int ObjectSize = 1024;
+
+    private static IntPtr s_class;
+
+    /// <summary>
+    /// The object every StaticFindObject call returns.
+    /// </summary>
+    public static IntPtr FoundObject { get; private set; }
+
+    public static void Init()
+    {
+        var api = (NativeApi*)NativeMemory.AllocZeroed(NativeApi.SizeInBytes);
+        api->Version = NativeApi.CurrentVersion;
+        api->Size = NativeApi.SizeInBytes;
+        api->StaticFindObject = &StaticFindObject;
+        api->ProcessEvent = &ProcessEvent;
+        NativeApi.Init(api);
+
+        s_class = (IntPtr)NativeMemory.AllocZeroed(ObjectSize);
+        FoundObject = NewObjectPtr();
+    }
+
+    /// <summary>
+    /// Allocates a zeroed object of the fake class. Never freed.
+    /// </summary>
+    public static IntPtr NewObjectPtr()
+    {
+        var obj = (IntPtr)NativeMemory.AllocZeroed(ObjectSize);
+        *(IntPtr*)(obj + GameInfo.MemberOffsets.Object__Class) = s_class;
+        return obj;
+    }
+
+    /// <summary>
+    /// Allocates a zeroed object and returns its managed wrapper.
+    /// </summary>
+    public static GameObject NewObject()
+    {
+        var obj = NewObjectPtr();
+        return MarshalUtil.ToManaged<GameObject>(&obj);
+    }
+
+    [UnmanagedCallersOnly(CallConvs = [typeof(System.Runtime.CompilerServices.CallConvCdecl)])]
+    private static IntPtr StaticFindObject(IntPtr Class, IntPtr InOuter, IntPtr Name, int Exact) =>
+        FoundObject;
+
+    [UnmanagedCallersOnly(CallConvs = [typeof(System.Runtime.CompilerServices.CallConvThiscall)])]
+    private static void ProcessEvent(IntPtr self, IntPtr Function, IntPtr Parms, IntPtr Result) { }
+}
@@ -0,0 +1,89 @@
+namespace BmSDK.Bench;
+
+/// <summary>
+/// Generated function bodies that build the params frame with stackalloc and MarshalUtil, and
+/// with an explicit-layout params struct as the printer emits now. Both use a resolved handle.
+/// </summary>
+internal static unsafe class ParamsBench
+{
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Func_Params
+    {
+        [FieldOffset(0)]
+        public int A;
+
+        [FieldOffset(4)]
+        public nint B;
+
+        [FieldOffset(8)]
+        public float C;
+
+        [FieldOffset(12)]
+        public int ReturnValue;
+    }
+
+    public static void Run()
+    {
+        var self = FakeEngine.NewObject();
+        var other = FakeEngine.NewObject();
+        var func = FakeEngine.NewObject();
+
+        Bench.Measure(
+            "stackalloc + MarshalUtil",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    sum += CallWithMarshalUtil(self, func, i, other, out _);
+                }
+                return sum;
+            }
+        );
+
+        Bench.Measure(
+            "Params struct",
+            () =>
+            {
+                long sum = 0;
+                for (var i = 0; i < Bench.Iterations; i++)
+                {
+                    sum += CallWithParamsStruct(self, func, i, other, out _);
+                }
+                return sum;
+            }
+        );
+    }
+
+    private static int CallWithMarshalUtil(
+        GameObject self,
+        GameObject funcManaged,
+        int A,
+        GameObject B,
+        out float C
+    )
+    {
+        byte* paramsPtr = stackalloc byte[16];
+        MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
+        MarshalUtil.ToUnmanaged(B, paramsPtr + 4);
+        GameFunctions.ProcessEvent(self.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        C = MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        return MarshalUtil.ToManaged<int>(paramsPtr + 12);
+    }
+
+    private static int CallWithParamsStruct(
+        GameObject self,
+        GameObject funcManaged,
+        int A,
+        GameObject B,
+        out float C
+    )
+    {
+        var parms = new Func_Params();
+        parms.A = A;
+        parms.B = B?.Ptr ?? 0;
+        GameFunctions.ProcessEvent(self.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        C = parms.C;
+        return parms.ReturnValue;
+    }
+}
@@ -0,0 +1,22 @@
+using BmSDK.Bench;
+
+// Optionally run only the benchmarks whose names contain the given filter
+var filter = args.Length > 0 ? args[0] : "";
+
+(string Name, Action Run)[] benches =
+[
+    ("Calls", CallBench.Run),
+    ("Params", ParamsBench.Run),
+    ("Accessors", AccessorBench.Run),
+    ("ClassTree", ClassTreeBench.Run),
+];
+
+FakeEngine.Init();
+foreach (var (name, run) in benches)
+{
+    if (name.Contains(filter, StringComparison.OrdinalIgnoreCase))
+    {
+        Console.WriteLine($"[BENCH] {name}");
+        run();
+    }
+}
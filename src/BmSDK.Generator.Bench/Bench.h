@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+// Self-registering benchmarks, run from main() like the TEST_CASE()s in the tests project.
+namespace Bench
+{
+    struct Case
+    {
+        const char* Name;
+        function<void()> Body;
+    };
+
+    vector<Case>& GetCases();
+
+    struct Registrar
+    {
+        Registrar(const char* name, function<void()> body) { GetCases().push_back({ name, std::move(body) }); }
+    };
+
+    // Fastest and slowest of several runs, in milliseconds
+    struct Timing
+    {
+        double Min = 0.0;
+        double Max = 0.0;
+    };
+
+    inline Timing Time(int numRuns, const function<void()>& body)
+    {
+        Timing timing = { numeric_limits<double>::max(), 0.0 };
+        for (int run = 0; run < numRuns; run++)
+        {
+            auto start = chrono::steady_clock::now();
+            body();
+            auto ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            timing.Min = min(timing.Min, ms);
+            timing.Max = max(timing.Max, ms);
+        }
+
+        return timing;
+    }
+}
+
+#define BENCH_CASE(NAME)                                                                           \
+    static void NAME();                                                                            \
+    static Bench::Registrar NAME##_Registrar(#NAME, &NAME);                                        \
+    static void NAME()
@@ -0,0 +1,29 @@
+#include "pch.h"
+#include "Bench.h"
+
+vector<Bench::Case>& Bench::GetCases()
+{
+    static vector<Case> cases;
+    return cases;
+}
+
+int main(int argc, char** argv)
+{
+    // Optionally run only the benchmarks whose names contain the given filter
+    string_view filter = argc > 1 ? argv[1] : "";
+
+    int numRun = 0;
+    for (auto& benchCase : Bench::GetCases())
+    {
+        if (string_view(benchCase.Name).find(filter) == string_view::npos)
+        {
+            continue;
+        }
+
+        cout << "[BENCH] " << benchCase.Name << endl;
+        benchCase.Body();
+        numRun++;
+    }
+
+    return numRun > 0 ? 0 : 1;
+}
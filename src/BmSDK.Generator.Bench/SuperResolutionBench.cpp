@@ -0,0 +1,65 @@
+#include "pch.h"
+#include "Bench.h"
+#include "SyntheticSnapshot.h"
+#include "Framework/Arena.h"
+#include "Framework/ClassIndex.h"
+#include "Framework/ClassInfo.h"
+#include "Framework/Snapshot.h"
+
+static constexpr int NumRuns = 3;
+
+// Resolves every class's super through ClassIndex, and through the linear scan over all
+// classes that ResolveSuper used to do. The scan is O(N^2), so it only runs once per size;
+// at 100k classes it takes several seconds.
+BENCH_CASE(Supers_IndexVsLinearScan)
+{
+    for (uint32_t numClasses : { 4000u, 10000u, 100000u })
+    {
+        auto data = BuildSyntheticSnapshot(numClasses);
+        Snapshot snapshot;
+        bool bOpened = snapshot.Open(data);
+        ASSERT(bOpened);
+
+        Arena arena;
+        vector<ClassInfo> classes;
+        classes.reserve(snapshot.GetClasses().size());
+        for (auto& classObj : snapshot.GetClasses())
+        {
+            classes.emplace_back(snapshot, classObj, arena);
+        }
+
+        size_t numIndexed = 0, numScanned = 0;
+        auto indexed = Bench::Time(NumRuns, [&]
+            {
+                ClassIndex index;
+                index.Build(classes);
+                numIndexed = 0;
+                for (auto& classObj : classes)
+                {
+                    classObj.ResolveSuper(index);
+                    numIndexed += classObj.Super != nullptr;
+                }
+            });
+
+        auto scanned = Bench::Time(1, [&]
+            {
+                for (auto& classObj : classes)
+                {
+                    classObj.Super = nullptr;
+                    for (auto& other : classes)
+                    {
+                        if (other.Class == classObj.SuperClass)
+                        {
+                            classObj.Super = &other;
+                            numScanned++;
+                            break;
+                        }
+                    }
+                }
+            });
+
+        ASSERT(numIndexed == numScanned);
+        cout << format("  {} classes: index {:.2f}-{:.2f} ms (build included), linear scan {:.1f} ms",
+            numClasses, indexed.Min, indexed.Max, scanned.Min) << endl;
+    }
+}
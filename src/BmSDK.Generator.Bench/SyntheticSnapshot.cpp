@@ -0,0 +1,186 @@
+#include "pch.h"
+#include "SyntheticSnapshot.h"
+#include "Framework/Snapshot.h"
+
+#include <random>
+
+static constexpr uint32_t NumPackages = 20;
+
+namespace
+{
+    class SyntheticBuilder
+    {
+    public:
+        uint32_t Object(string_view name, string_view className, uint32_t outer, ESnapshotKind kind)
+        {
+            auto i = Builder.AddObject();
+            auto& obj = Builder.GetObject(i);
+            obj.Name = Builder.AddName(name);
+            obj.ClassName = Builder.AddName(className);
+            obj.Outer = outer;
+            obj.Kind = kind;
+            obj.ArrayDim = 1;
+            return i;
+        }
+
+        uint32_t Property(string_view name, string_view className, uint32_t outer, EPropertyKind kind, int32_t size,
+            int32_t offset, uint32_t ref = SNAPSHOT_NONE)
+        {
+            auto i = Object(name, className, outer, ESnapshotKind::Property);
+            auto& obj = Builder.GetObject(i);
+            obj.PropertyKind = kind;
+            obj.Size = size;
+            obj.Offset = offset;
+            obj.Ref = ref;
+            return i;
+        }
+
+        // Links the fields into their outer's child chain, in order
+        void Chain(uint32_t outer, span<const uint32_t> fields)
+        {
+            for (size_t i = 0; i + 1 < fields.size(); i++)
+            {
+                Builder.GetObject(fields[i]).Next = fields[i + 1];
+            }
+
+            Builder.GetObject(outer).Children = fields.empty() ? SNAPSHOT_NONE : fields[0];
+        }
+
+        SnapshotBuilder Builder;
+    };
+}
+
+vector<char> BuildSyntheticSnapshot(uint32_t numClasses)
+{
+    using K = EPropertyKind;
+    constexpr uint64_t CPF_Parm = (uint64_t)EPropertyFlags::CPF_Parm;
+    constexpr uint64_t CPF_Out = CPF_Parm | (uint64_t)EPropertyFlags::CPF_OutParm;
+    constexpr uint64_t CPF_Return = CPF_Parm | (uint64_t)EPropertyFlags::CPF_ReturnParm;
+
+    mt19937 rng(42);
+    SyntheticBuilder b;
+
+    // Class records come first, so reserve them before anything else
+    vector<uint32_t> classes(numClasses);
+    for (auto& _class : classes)
+    {
+        _class = b.Builder.AddObject();
+    }
+
+    vector<uint32_t> packages;
+    for (uint32_t i = 0; i < NumPackages; i++)
+    {
+        packages.push_back(b.Object(i == 0 ? "Core" : format("Pkg{}", i), "Package", SNAPSHOT_NONE, ESnapshotKind::Package));
+    }
+
+    vector<uint32_t> structs, enums;
+    vector<int32_t> classSizes(numClasses);
+    for (uint32_t i = 0; i < numClasses; i++)
+    {
+        auto superIndex = i == 0 ? SNAPSHOT_NONE : (uint32_t)(rng() % i);
+        auto& classObj = b.Builder.GetObject(classes[i]);
+        classObj.Name = b.Builder.AddName(i == 0 ? "Object" : format("Class{}", i));
+        classObj.ClassName = b.Builder.AddName("Class");
+        classObj.Outer = packages[i % NumPackages];
+        classObj.Kind = ESnapshotKind::Class;
+        classObj.Super = superIndex == SNAPSHOT_NONE ? SNAPSHOT_NONE : classes[superIndex];
+        classObj.ArrayDim = 1;
+
+        vector<uint32_t> fields;
+        if (i % 3 == 0)
+        {
+            auto _struct = b.Object(format("Struct{}", i), "ScriptStruct", classes[i], ESnapshotKind::ScriptStruct);
+            uint32_t members[] = {
+                b.Property("A", "IntProperty", _struct, K::Int, 4, 0),
+                b.Property("B", "FloatProperty", _struct, K::Float, 4, 4),
+                b.Property("C", "NameProperty", _struct, K::Name, 8, 8),
+                b.Property("bD", "BoolProperty", _struct, K::Bool, 4, 16),
+            };
+            b.Builder.GetObject(members[3]).BitMask = 1;
+            b.Builder.GetObject(_struct).Size = 20;
+            b.Chain(_struct, members);
+
+            structs.push_back(_struct);
+            fields.push_back(_struct);
+        }
+
+        if (i % 5 == 0)
+        {
+            auto _enum = b.Object(format("EEnum{}", i), "Enum", classes[i], ESnapshotKind::Enum);
+            vector<uint32_t> names;
+            for (int value = 0; value < 6; value++)
+            {
+                names.push_back(b.Builder.AddName(format("EN{}_Value{}", i, value)));
+            }
+
+            b.Builder.SetList(_enum, names);
+            enums.push_back(_enum);
+            fields.push_back(_enum);
+        }
+
+        // Properties start where the super class ends
+        auto offset = superIndex == SNAPSHOT_NONE ? 60 : classSizes[superIndex];
+        auto add = [&](uint32_t prop, int32_t size)
+            {
+                fields.push_back(prop);
+                offset += size;
+                return prop;
+            };
+
+        auto prefix = format("Prop{}_", i);
+        add(b.Property(prefix + "Int", "IntProperty", classes[i], K::Int, 4, offset), 4);
+        add(b.Property(prefix + "Float", "FloatProperty", classes[i], K::Float, 4, offset), 4);
+        b.Builder.GetObject(add(b.Property("b" + prefix + "A", "BoolProperty", classes[i], K::Bool, 4, offset), 0)).BitMask = 1;
+        b.Builder.GetObject(add(b.Property("b" + prefix + "B", "BoolProperty", classes[i], K::Bool, 4, offset), 4)).BitMask = 2;
+        add(b.Property(prefix + "Name", "NameProperty", classes[i], K::Name, 8, offset), 8);
+        add(b.Property(prefix + "Str", "StrProperty", classes[i], K::Str, 12, offset), 12);
+        add(b.Property(prefix + "Object", "ObjectProperty", classes[i], K::Object, 4, offset, classes[rng() % numClasses]), 4);
+        if (structs.empty())
+        {
+            add(b.Property(prefix + "Struct", "IntProperty", classes[i], K::Int, 4, offset), 4);
+        }
+        else
+        {
+            add(b.Property(prefix + "Struct", "StructProperty", classes[i], K::Struct, 20, offset, structs[rng() % structs.size()]), 20);
+        }
+
+        add(b.Property(prefix + "Byte", "ByteProperty", classes[i], K::Byte, 1, offset,
+            enums.empty() ? SNAPSHOT_NONE : enums[rng() % enums.size()]), 4);
+
+        auto inner = b.Property(prefix + "Array", "IntProperty", SNAPSHOT_NONE, K::Int, 4, 0);
+        auto array = add(b.Property(prefix + "Array", "ArrayProperty", classes[i], K::Array, 12, offset, inner), 12);
+        b.Builder.GetObject(inner).Outer = array;
+
+        b.Builder.GetObject(add(b.Property(prefix + "Ints", "IntProperty", classes[i], K::Int, 4, offset), 16)).ArrayDim = 4;
+        b.Builder.GetObject(add(b.Property(prefix + "Floats", "FloatProperty", classes[i], K::Float, 4, offset), 12)).ArrayDim = 3;
+
+        // Native, event and script functions with int(int, Object, out float)
+        for (int funcIndex = 0; funcIndex < 6; funcIndex++)
+        {
+            auto func = b.Object(format("Func{}_{}", i, funcIndex), "Function", classes[i], ESnapshotKind::Function);
+            uint32_t params[] = {
+                b.Property("A", "IntProperty", func, K::Int, 4, 0),
+                b.Property("B", "ObjectProperty", func, K::Object, 4, 4, classes[rng() % numClasses]),
+                b.Property("C", "FloatProperty", func, K::Float, 4, 8),
+                b.Property("ReturnValue", "IntProperty", func, K::Int, 4, 12),
+            };
+            b.Builder.GetObject(params[0]).Flags = CPF_Parm;
+            b.Builder.GetObject(params[1]).Flags = CPF_Parm;
+            b.Builder.GetObject(params[2]).Flags = CPF_Out;
+            b.Builder.GetObject(params[3]).Flags = CPF_Return;
+            b.Chain(func, params);
+
+            auto& funcObj = b.Builder.GetObject(func);
+            funcObj.Flags = funcIndex % 3 == 0 ? (uint64_t)EFunctionFlags::FUNC_Native
+                : funcIndex % 3 == 1 ? (uint64_t)EFunctionFlags::FUNC_Event : 0;
+            funcObj.Size = 16;
+            fields.push_back(func);
+        }
+
+        b.Chain(classes[i], fields);
+        b.Builder.GetObject(classes[i]).Size = offset;
+        classSizes[i] = offset;
+    }
+
+    return b.Builder.Build(numClasses);
+}
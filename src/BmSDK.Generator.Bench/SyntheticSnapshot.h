@@ -0,0 +1,6 @@
+#pragma once
+
+// Builds a reflection snapshot of numClasses classes in 20 packages, shaped roughly like the
+// game's: a random class tree, 12 properties of the common kinds and 6 functions per class,
+// and a struct and an enum every few classes. Seeded, so every run sees the same snapshot.
+vector<char> BuildSyntheticSnapshot(uint32_t numClasses);
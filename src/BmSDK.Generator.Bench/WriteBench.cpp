@@ -0,0 +1,102 @@
+#include "pch.h"
+#include "Bench.h"
+#include "SyntheticSnapshot.h"
+#include "Framework/Arena.h"
+#include "Framework/ClassIndex.h"
+#include "Framework/ClassInfo.h"
+#include "Framework/Snapshot.h"
+#include "Printer/Printer.h"
+
+#include <algorithm>
+#include <fstream>
+
+static constexpr uint32_t NumClasses = 4000;
+static constexpr int NumRuns = 3;
+
+// Writes every line through a buffered ofstream followed by endl, as the printer used to
+static void WritePerLine(const fs::path& path, string_view text)
+{
+    ofstream file(path, ios::trunc | ios::binary);
+    while (!text.empty())
+    {
+        auto end = text.find('\n');
+        auto line = text.substr(0, end);
+        file << line << endl;
+        text.remove_prefix(end == string_view::npos ? text.size() : end + 1);
+    }
+}
+
+// Writes the same rendered files once through CodeWriter (one write per file) and once a
+// line at a time with endl. Printing is left out of the timings since it's the same for both,
+// and everything runs on one thread so the two only differ in how they reach the disk.
+BENCH_CASE(Write_BufferedVsPerLineFlush)
+{
+    auto data = BuildSyntheticSnapshot(NumClasses);
+    Snapshot snapshot;
+    bool bOpened = snapshot.Open(data);
+    ASSERT(bOpened);
+
+    Arena arena;
+    vector<ClassInfo> classes;
+    classes.reserve(snapshot.GetClasses().size());
+    for (auto& classObj : snapshot.GetClasses())
+    {
+        classes.emplace_back(snapshot, classObj, arena);
+    }
+
+    ClassIndex index;
+    index.Build(classes);
+    for (auto& classObj : classes)
+    {
+        classObj.ResolveSuper(index);
+    }
+
+    ClassIndex::NumberTree(classes);
+    for (auto& classObj : classes)
+    {
+        classObj.ResolveHierarchyFlags(index);
+    }
+
+    vector<string> files;
+    size_t numBytes = 0, numLines = 0;
+    for (auto& classObj : classes)
+    {
+        CodeWriter writer;
+        Printer(writer).PrintFile(classObj);
+        files.emplace_back(writer.View());
+        numBytes += writer.Size();
+        numLines += ranges::count(writer.View(), '\n');
+    }
+
+    cout << format("  {} files, {:.1f} MB, {} lines", files.size(), numBytes / 1e6, numLines) << endl;
+
+    auto outDir = fs::temp_directory_path() / "BmSDK.Generator.Bench.Write";
+    fs::remove_all(outDir);
+    fs::create_directories(outDir);
+
+    auto report = [&](string_view label, Bench::Timing timing)
+        {
+            cout << format("  {}: {:.0f}-{:.0f} ms, {:.0f}-{:.0f} MB/s", label, timing.Min, timing.Max,
+                numBytes / 1e3 / timing.Max, numBytes / 1e3 / timing.Min) << endl;
+        };
+
+    report("CodeWriter, one write per file", Bench::Time(NumRuns, [&]
+        {
+            for (size_t i = 0; i < files.size(); i++)
+            {
+                CodeWriter writer;
+                writer << files[i];
+                writer.WriteToFile(outDir / format("{}.g.cs", i));
+            }
+        }));
+
+    report("ofstream, endl per line", Bench::Time(NumRuns, [&]
+        {
+            for (size_t i = 0; i < files.size(); i++)
+            {
+                WritePerLine(outDir / format("{}.g.cs", i), files[i]);
+            }
+        }));
+
+    fs::remove_all(outDir);
+}
@@ -0,0 +1,33 @@
+# Trims the SDK from a real snapshot and builds BmSDK against it, from a copy of its sources so the
+# checked-in Generated/ is left alone. Run by the BmSDK.TrimmedBuild test:
+#
+#   cmake -DGENERATOR=... -DSNAPSHOT=... -DROOTS=... -DSDK_DIR=... -DWORK_DIR=... -DDOTNET=...
+#       -P CheckTrimmedBuild.cmake
+foreach(var GENERATOR SNAPSHOT ROOTS SDK_DIR WORK_DIR DOTNET)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} isn't set")
+    endif()
+endforeach()
+
+file(REMOVE_RECURSE "${WORK_DIR}")
+file(COPY "${SDK_DIR}/" DESTINATION "${WORK_DIR}/BmSDK"
+    PATTERN "Generated" EXCLUDE
+    PATTERN "bin" EXCLUDE
+    PATTERN "obj" EXCLUDE
+)
+
+execute_process(
+    COMMAND "${GENERATOR}" "${SNAPSHOT}" "${WORK_DIR}/BmSDK/Generated" "${ROOTS}"
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Generating the trimmed SDK failed (${result})")
+endif()
+
+execute_process(
+    COMMAND "${DOTNET}" build "${WORK_DIR}/BmSDK/BmSDK.csproj" -o "${WORK_DIR}/out"
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "BmSDK doesn't build against the trimmed SDK (${result})")
+endif()
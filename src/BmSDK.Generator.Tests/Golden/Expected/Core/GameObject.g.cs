@@ -0,0 +1,208 @@
+#pragma warning disable CS0108
+#pragma warning disable CS1591
+
+namespace BmSDK;
+
+/// <summary>
+/// ABSTRACT Class: GameObject<br/>
+/// (size = 60)
+/// (flags = 1)
+/// </summary>
+public partial class GameObject : BmSDK.IGameObject
+{
+    static BmSDK.Class s_staticClass = null;
+    public static BmSDK.Class StaticClass()
+    {
+        if (s_staticClass is null)
+        {
+            s_staticClass = StaticFindObjectChecked<Class>(null, null, "Core.Object", false);
+            s_staticClass.AddToRoot();
+        }
+        return s_staticClass;
+    }
+
+    /// <summary>
+    /// Gets the class default object as GameObject.
+    /// </summary>
+    public static GameObject DefaultObject => (GameObject)StaticClass().DefaultObject;
+
+    internal GameObject() { }
+
+    /// <summary>
+    /// Constructs a new wrapper instance from the given object pointer.
+    /// </summary>
+    protected GameObject(nint ptr) { Ptr = ptr; }
+
+    /// <inheritdoc cref="GameObject.AttachScriptComponent(Framework.IScriptComponent)"/>
+    public void AttachScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<GameObject>
+        => ((GameObject)this).AttachScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.AttachScriptComponent(Type)"/>
+    public TComponent AttachScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<GameObject>, new()
+        => (TComponent)((GameObject)this).AttachScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.HasScriptComponent(Framework.IScriptComponent)"/>
+    public bool HasScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<GameObject>
+        => ((GameObject)this).HasScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.HasScriptComponent(Type)"/>
+    public bool HasScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<GameObject>
+        => ((GameObject)this).HasScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.GetScriptComponent(Type)"/>
+    public TComponent GetScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<GameObject>
+        => (TComponent)((GameObject)this).GetScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.GetScriptComponents(Type)"/>
+    public System.Collections.Generic.IReadOnlyList<TComponent> GetScriptComponents<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<GameObject>
+        => ((GameObject)this).GetScriptComponents(typeof(TComponent)).Cast<TComponent>().ToList();
+
+    /// <inheritdoc cref="GameObject.DetachScriptComponent(Framework.IScriptComponent)"/>
+    public void DetachScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<GameObject>
+        => ((GameObject)this).DetachScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.DetachScriptComponents(Type)"/>
+    public void DetachScriptComponents<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<GameObject>
+        => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
+
+    /// <summary>
+    /// Struct: FVector
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    public partial record struct FVector
+    {
+        /// <summary>
+        /// FloatProperty: X
+        /// </summary>
+        [FieldOffset(0)] public float X;
+
+        /// <summary>
+        /// FloatProperty: Y
+        /// </summary>
+        [FieldOffset(4)] public float Y;
+
+        /// <summary>
+        /// FloatProperty: Z
+        /// </summary>
+        [FieldOffset(8)] public float Z;
+    }
+
+    /// <summary>
+    /// Struct: FRotator
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    public partial record struct FRotator
+    {
+        /// <summary>
+        /// IntProperty: Pitch
+        /// </summary>
+        [FieldOffset(0)] public int Pitch;
+
+        /// <summary>
+        /// IntProperty: Yaw
+        /// </summary>
+        [FieldOffset(4)] public int Yaw;
+
+        /// <summary>
+        /// IntProperty: Roll
+        /// </summary>
+        [FieldOffset(8)] public int Roll;
+    }
+
+    /// <summary>
+    /// Struct: FQWord
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    public partial record struct FQWord
+    {
+        /// <summary>
+        /// IntProperty: A
+        /// </summary>
+        [FieldOffset(0)] public int A;
+
+        /// <summary>
+        /// IntProperty: B
+        /// </summary>
+        [FieldOffset(4)] public int B;
+    }
+
+    /// <summary>
+    /// Enum: EAxis
+    /// </summary>
+    public enum EAxis : byte
+    {
+        AXIS_NONE = 0,
+        AXIS_X = 1,
+        AXIS_Y = 2,
+        AXIS_NONE_2 = 3,
+        AXIS_MAX = 4,
+    }
+
+    /// <summary>
+    /// StructProperty: ObjectFlags
+    /// </summary>
+    public unsafe BmSDK.GameObject.EObjectFlags ObjectFlags
+    {
+        get { return *(BmSDK.GameObject.EObjectFlags*)(Ptr + 8); }
+        set { *(BmSDK.GameObject.EObjectFlags*)(Ptr + 8) = value; }
+    }
+
+    /// <summary>
+    /// ObjectProperty: Outer
+    /// </summary>
+    public unsafe BmSDK.GameObject Outer
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject>(Ptr + 40); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }
+    }
+
+    /// <summary>
+    /// NameProperty: Name
+    /// </summary>
+    public unsafe BmSDK.FName Name
+    {
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
+    }
+
+    /// <summary>
+    /// ClassProperty: Class
+    /// </summary>
+    public unsafe BmSDK.GameObject Class
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject>(Ptr + 52); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+    }
+
+    static BmSDK.Function s_ClampFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Clamp_Params
+    {
+        [FieldOffset(0)] public int V;
+        [FieldOffset(4)] public int A;
+        [FieldOffset(8)] public int B;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
+    /// <summary>
+    /// Function: Clamp
+    /// </summary>
+    public unsafe static int Clamp(int V, int A, int B)
+    {
+        var funcManaged = s_ClampFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Core.Object.Clamp", true);
+        var parms = new Clamp_Params();
+        parms.V = V;
+        parms.A = A;
+        parms.B = B;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+}
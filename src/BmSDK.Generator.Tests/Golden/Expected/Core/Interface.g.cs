@@ -0,0 +1,13 @@
+#pragma warning disable CS0108
+#pragma warning disable CS1591
+
+namespace BmSDK;
+
+/// <summary>
+/// Interface: Interface<br/>
+/// (size = 60)
+/// (flags = 16385)
+/// </summary>
+public partial interface Interface
+{
+}
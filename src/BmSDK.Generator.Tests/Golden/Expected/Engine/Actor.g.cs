@@ -0,0 +1,441 @@
+#pragma warning disable CS0108
+#pragma warning disable CS1591
+
+namespace BmSDK.Engine;
+
+/// <summary>
+/// Class: Actor<br/>
+/// (size = 228)
+/// (flags = 0)
+/// </summary>
+public partial class Actor : BmSDK.GameObject, BmSDK.IGameObject
+{
+    static BmSDK.Class s_staticClass = null;
+    public static BmSDK.Class StaticClass()
+    {
+        if (s_staticClass is null)
+        {
+            s_staticClass = StaticFindObjectChecked<Class>(null, null, "Engine.Actor", false);
+            s_staticClass.AddToRoot();
+        }
+        return s_staticClass;
+    }
+
+    /// <summary>
+    /// Gets the class default object as Actor.
+    /// </summary>
+    public static Actor DefaultObject => (Actor)StaticClass().DefaultObject;
+
+    internal Actor() { }
+
+    /// <summary>
+    /// Constructs a new Actor
+    /// </summary>
+    public Actor(BmSDK.GameObject Outer, string Name = null, BmSDK.GameObject.EObjectFlags SetFlags = 0, Actor Template = null) : base(ConstructObjectInternal(StaticClass(), Outer, Name, SetFlags, Template)) { }
+
+    /// <summary>
+    /// Constructs a new wrapper instance from the given object pointer.
+    /// </summary>
+    protected Actor(nint ptr) : base(ptr) { }
+
+    /// <inheritdoc cref="GameObject.AttachScriptComponent(Framework.IScriptComponent)"/>
+    public void AttachScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<Actor>
+        => ((GameObject)this).AttachScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.AttachScriptComponent(Type)"/>
+    public TComponent AttachScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<Actor>, new()
+        => (TComponent)((GameObject)this).AttachScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.HasScriptComponent(Framework.IScriptComponent)"/>
+    public bool HasScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<Actor>
+        => ((GameObject)this).HasScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.HasScriptComponent(Type)"/>
+    public bool HasScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<Actor>
+        => ((GameObject)this).HasScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.GetScriptComponent(Type)"/>
+    public TComponent GetScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<Actor>
+        => (TComponent)((GameObject)this).GetScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.GetScriptComponents(Type)"/>
+    public System.Collections.Generic.IReadOnlyList<TComponent> GetScriptComponents<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<Actor>
+        => ((GameObject)this).GetScriptComponents(typeof(TComponent)).Cast<TComponent>().ToList();
+
+    /// <inheritdoc cref="GameObject.DetachScriptComponent(Framework.IScriptComponent)"/>
+    public void DetachScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<Actor>
+        => ((GameObject)this).DetachScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.DetachScriptComponents(Type)"/>
+    public void DetachScriptComponents<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<Actor>
+        => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
+
+    /// <summary>
+    /// Enum: ENetRole
+    /// </summary>
+    public enum ENetRole : byte
+    {
+        ROLE_None = 0,
+        ROLE_SimulatedProxy = 1,
+        ROLE_Authority = 2,
+    }
+
+    /// <summary>
+    /// Struct: FTimerData
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    public partial record struct FTimerData
+    {
+        [FieldOffset(0)] private int _bitfield0;
+
+        /// <summary>
+        /// BoolProperty: bLoop
+        /// </summary>
+        public bool bLoop
+        {
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
+        }
+
+        /// <summary>
+        /// BoolProperty: bPaused
+        /// </summary>
+        public bool bPaused
+        {
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
+        }
+
+        /// <summary>
+        /// FloatProperty: Rate
+        /// </summary>
+        [FieldOffset(4)] public float Rate;
+
+        /// <summary>
+        /// NameProperty: FuncName
+        /// </summary>
+        [FieldOffset(8)] public BmSDK.FName FuncName;
+
+        /// <summary>
+        /// StructProperty: Location
+        /// </summary>
+        [FieldOffset(16)] public System.Numerics.Vector3 Location;
+
+        /// <summary>
+        /// IntProperty: Counts
+        /// </summary>
+        public unsafe int Counts_0
+        {
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 28) = value; }; }
+        }
+        /// <summary>
+        /// IntProperty: Counts
+        /// </summary>
+        public unsafe int Counts_1
+        {
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 32); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 32) = value; }; }
+        }
+
+        /// <summary>
+        /// ObjectProperty: Target
+        /// </summary>
+        public unsafe BmSDK.Engine.Actor Target
+        {
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(Ptr + 36); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
+        }
+
+        /// <summary>
+        /// StructProperty: PaddedLocation
+        /// </summary>
+        public unsafe System.Numerics.Vector3 PaddedLocation
+        {
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+        }
+    }
+
+    /// <summary>
+    /// StructProperty: Location
+    /// </summary>
+    public unsafe ref System.Numerics.Vector3 Location
+        => ref BmSDK.Framework.MarshalUtil.AsRef<System.Numerics.Vector3>(Ptr + 60);
+
+    /// <summary>
+    /// StructProperty: Rotation
+    /// </summary>
+    public unsafe ref BmSDK.Rotator Rotation
+        => ref BmSDK.Framework.MarshalUtil.AsRef<BmSDK.Rotator>(Ptr + 72);
+
+    /// <summary>
+    /// BoolProperty: bHidden
+    /// </summary>
+    public unsafe bool bHidden
+    {
+        get { return (*(int*)(Ptr + 84) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1; else *(int*)(Ptr + 84) &= ~1; }
+    }
+
+    /// <summary>
+    /// BoolProperty: bStatic
+    /// </summary>
+    public unsafe bool bStatic
+    {
+        get { return (*(int*)(Ptr + 84) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2; else *(int*)(Ptr + 84) &= ~2; }
+    }
+
+    /// <summary>
+    /// ByteProperty: Role
+    /// </summary>
+    public unsafe BmSDK.Engine.Actor.ENetRole Role
+    {
+        get { return *(BmSDK.Engine.Actor.ENetRole*)(Ptr + 88); }
+        set { *(BmSDK.Engine.Actor.ENetRole*)(Ptr + 88) = value; }
+    }
+
+    /// <summary>
+    /// InlineArray{IntProperty}: Timers
+    /// </summary>
+    public InlineArray<int> Timers => new(3, Ptr + 92, 4, this);
+
+    /// <summary>
+    /// IntProperty: Timers
+    /// </summary>
+    public unsafe int Timers_0
+    {
+        get { return *(int*)(Ptr + 92); }
+        set { *(int*)(Ptr + 92) = value; }
+    }
+    /// <summary>
+    /// IntProperty: Timers
+    /// </summary>
+    public unsafe int Timers_1
+    {
+        get { return *(int*)(Ptr + 96); }
+        set { *(int*)(Ptr + 96) = value; }
+    }
+    /// <summary>
+    /// IntProperty: Timers
+    /// </summary>
+    public unsafe int Timers_2
+    {
+        get { return *(int*)(Ptr + 100); }
+        set { *(int*)(Ptr + 100) = value; }
+    }
+
+    /// <summary>
+    /// InlineArray{ObjectProperty}: Owners
+    /// </summary>
+    public InlineArray<BmSDK.Engine.Actor> Owners => new(2, Ptr + 104, 4, this);
+
+    /// <summary>
+    /// ObjectProperty: Owners
+    /// </summary>
+    public unsafe BmSDK.Engine.Actor Owners_0
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(Ptr + 104); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+    }
+    /// <summary>
+    /// ObjectProperty: Owners
+    /// </summary>
+    public unsafe BmSDK.Engine.Actor Owners_1
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(Ptr + 108); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+    }
+
+    /// <summary>
+    /// StructProperty: Timer
+    /// </summary>
+    public unsafe ref BmSDK.Engine.Actor.FTimerData Timer
+        => ref BmSDK.Framework.MarshalUtil.AsRef<BmSDK.Engine.Actor.FTimerData>(Ptr + 112);
+
+    /// <summary>
+    /// ArrayProperty: Touching
+    /// </summary>
+    public unsafe BmSDK.TArray<BmSDK.Engine.Actor> Touching
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor>>(Ptr + 168); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }
+    }
+
+    /// <summary>
+    /// StrProperty: Description
+    /// </summary>
+    public unsafe BmSDK.FString Description
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(Ptr + 180); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+    }
+
+    /// <summary>
+    /// DelegateProperty: OnDestroyed
+    /// </summary>
+    public unsafe System.IntPtr OnDestroyed
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 192); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+    }
+
+    /// <summary>
+    /// MapProperty: Tags
+    /// </summary>
+    public unsafe BmSDK.TMap<object, object> /* TODO */ Tags
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TMap<object, object> /* TODO */>(Ptr + 204); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+    }
+
+    /// <summary>
+    /// ComponentProperty: Mesh
+    /// </summary>
+    public unsafe BmSDK.GameObject Mesh
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject>(Ptr + 224); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+    }
+
+    static BmSDK.Function s_TouchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Touch_Params
+    {
+        [FieldOffset(0)] public nint Other;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitLocation;
+    }
+
+    /// <summary>
+    /// Function: Touch
+    /// </summary>
+    public unsafe virtual void Touch(BmSDK.Engine.Actor Other, System.Numerics.Vector3 HitLocation)
+    {
+        var funcManaged = s_TouchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Actor.Touch", true);
+        var parms = new Touch_Params();
+        parms.Other = Other?.Ptr ?? 0;
+        parms.HitLocation = HitLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return;
+    }
+
+    static BmSDK.Function s_SetLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 NewLocation;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
+    /// <summary>
+    /// Function: SetLocation
+    /// </summary>
+    public unsafe virtual bool SetLocation(System.Numerics.Vector3 NewLocation)
+    {
+        var funcManaged = s_SetLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Actor.SetLocation", true);
+        var parms = new SetLocation_Params();
+        parms.NewLocation = NewLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetTimerCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetTimerCount_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName FuncName;
+        [FieldOffset(8)] public int Count;
+    }
+
+    /// <summary>
+    /// Function: GetTimerCount
+    /// </summary>
+    public unsafe virtual void GetTimerCount(BmSDK.FName FuncName, out int Count)
+    {
+        var funcManaged = s_GetTimerCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Actor.GetTimerCount", true);
+        var parms = new GetTimerCount_Params();
+        parms.FuncName = FuncName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Count = parms.Count;
+        return;
+    }
+
+    static BmSDK.Function s_TakeDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 108)]
+    private struct TakeDamage_Params
+    {
+        [FieldOffset(0)] public int Damage;
+        [FieldOffset(4)] public nint Instigator;
+        [FieldOffset(8)] public BmSDK.Engine.Actor.FTimerData Data;
+        [FieldOffset(76)] public BmSDK.FString Reason;
+        [FieldOffset(88)] public BmSDK.FString Reason_1;
+        [FieldOffset(100)] public BmSDK.Engine.Actor.ENetRole Role;
+        [FieldOffset(104)] public nint ReturnValue;
+    }
+
+    /// <summary>
+    /// Function: TakeDamage
+    /// </summary>
+    public unsafe virtual BmSDK.Engine.Actor TakeDamage(int Damage, BmSDK.Engine.Pawn Instigator, BmSDK.Engine.Actor.FTimerData Data, BmSDK.TArray<int> Values, BmSDK.FString Reason, out BmSDK.FString Reason_1, BmSDK.Engine.Actor.ENetRole Role)
+    {
+        var funcManaged = s_TakeDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Actor.TakeDamage", true);
+        var parms = new TakeDamage_Params();
+        parms.Damage = Damage;
+        parms.Instigator = Instigator?.Ptr ?? 0;
+        parms.Data = Data;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Values, (byte*)&parms + 64);
+        parms.Reason = Reason;
+        parms.Role = Role;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Reason_1 = parms.Reason_1;
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Actor)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_MoveToFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct MoveTo_Params
+    {
+        [FieldOffset(16)] public float Speed;
+    }
+
+    /// <summary>
+    /// Function: MoveTo
+    /// </summary>
+    public unsafe virtual void MoveTo(System.Numerics.Vector3 Dest, float Speed)
+    {
+        var funcManaged = s_MoveToFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Actor.MoveTo", true);
+        var parms = new MoveTo_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Dest, (byte*)&parms + 0);
+        parms.Speed = Speed;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return;
+    }
+
+    static BmSDK.Function s_LogInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct LogInternal_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString S;
+    }
+
+    /// <summary>
+    /// Function: LogInternal
+    /// </summary>
+    public unsafe void LogInternal(BmSDK.FString S)
+    {
+        var funcManaged = s_LogInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Actor.LogInternal", true);
+        var parms = new LogInternal_Params();
+        parms.S = S;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return;
+    }
+}
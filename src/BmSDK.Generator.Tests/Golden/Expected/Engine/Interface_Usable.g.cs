@@ -0,0 +1,17 @@
+#pragma warning disable CS0108
+#pragma warning disable CS1591
+
+namespace BmSDK.Engine;
+
+/// <summary>
+/// Interface: Interface_Usable<br/>
+/// (size = 60)
+/// (flags = 16385)
+/// </summary>
+public partial interface Interface_Usable : BmSDK.Interface
+{
+    /// <summary>
+    /// Function: Use
+    /// </summary>
+    public unsafe bool Use(BmSDK.Engine.Pawn User);
+}
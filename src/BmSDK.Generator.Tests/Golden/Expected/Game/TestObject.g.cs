@@ -0,0 +1,198 @@
+#pragma warning disable CS0108
+#pragma warning disable CS1591
+
+namespace BmSDK.Game;
+
+/// <summary>
+/// ABSTRACT Class: TestObject<br/>
+/// (size = 96)
+/// (flags = 1)
+/// </summary>
+public partial class TestObject : BmSDK.GameObject, BmSDK.Engine.Interface_Usable, BmSDK.IGameObject
+{
+    static BmSDK.Class s_staticClass = null;
+    public static BmSDK.Class StaticClass()
+    {
+        if (s_staticClass is null)
+        {
+            s_staticClass = StaticFindObjectChecked<Class>(null, null, "Game.TestObject", false);
+            s_staticClass.AddToRoot();
+        }
+        return s_staticClass;
+    }
+
+    /// <summary>
+    /// Gets the class default object as TestObject.
+    /// </summary>
+    public static TestObject DefaultObject => (TestObject)StaticClass().DefaultObject;
+
+    internal TestObject() { }
+
+    /// <summary>
+    /// Constructs a new wrapper instance from the given object pointer.
+    /// </summary>
+    protected TestObject(nint ptr) : base(ptr) { }
+
+    /// <inheritdoc cref="GameObject.AttachScriptComponent(Framework.IScriptComponent)"/>
+    public void AttachScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<TestObject>
+        => ((GameObject)this).AttachScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.AttachScriptComponent(Type)"/>
+    public TComponent AttachScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<TestObject>, new()
+        => (TComponent)((GameObject)this).AttachScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.HasScriptComponent(Framework.IScriptComponent)"/>
+    public bool HasScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<TestObject>
+        => ((GameObject)this).HasScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.HasScriptComponent(Type)"/>
+    public bool HasScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<TestObject>
+        => ((GameObject)this).HasScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.GetScriptComponent(Type)"/>
+    public TComponent GetScriptComponent<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<TestObject>
+        => (TComponent)((GameObject)this).GetScriptComponent(typeof(TComponent));
+
+    /// <inheritdoc cref="GameObject.GetScriptComponents(Type)"/>
+    public System.Collections.Generic.IReadOnlyList<TComponent> GetScriptComponents<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<TestObject>
+        => ((GameObject)this).GetScriptComponents(typeof(TComponent)).Cast<TComponent>().ToList();
+
+    /// <inheritdoc cref="GameObject.DetachScriptComponent(Framework.IScriptComponent)"/>
+    public void DetachScriptComponent<TComponent>(TComponent component)
+        where TComponent : class, Framework.IScriptComponent<TestObject>
+        => ((GameObject)this).DetachScriptComponent((Framework.IScriptComponent)component);
+
+    /// <inheritdoc cref="GameObject.DetachScriptComponents(Type)"/>
+    public void DetachScriptComponents<TComponent>()
+        where TComponent : class, Framework.IScriptComponent<TestObject>
+        => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
+
+    /// <summary>
+    /// IntProperty: TestObject
+    /// </summary>
+    public unsafe int _TestObject
+    {
+        get { return *(int*)(Ptr + 60); }
+        set { *(int*)(Ptr + 60) = value; }
+    }
+
+    /// <summary>
+    /// InterfaceProperty: Usable
+    /// </summary>
+    public unsafe BmSDK.Engine.Interface_Usable Usable
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Interface_Usable>(Ptr + 64); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+    }
+
+    /// <summary>
+    /// ClassProperty: ActorClass
+    /// </summary>
+    public unsafe BmSDK.Engine.Actor ActorClass
+    {
+        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(Ptr + 72); }
+        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+    }
+
+    /// <summary>
+    /// InlineArray{FloatProperty}: Scales
+    /// </summary>
+    public InlineArray<float> Scales => new(4, Ptr + 76, 4, this);
+
+    /// <summary>
+    /// FloatProperty: Scales
+    /// </summary>
+    public unsafe float Scales_0
+    {
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
+    }
+    /// <summary>
+    /// FloatProperty: Scales
+    /// </summary>
+    public unsafe float Scales_1
+    {
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
+    }
+    /// <summary>
+    /// FloatProperty: Scales
+    /// </summary>
+    public unsafe float Scales_2
+    {
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
+    }
+    /// <summary>
+    /// FloatProperty: Scales
+    /// </summary>
+    public unsafe float Scales_3
+    {
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
+    }
+
+    /// <summary>
+    /// InlineArray{ByteProperty}: Weights
+    /// </summary>
+    public InlineArray<byte> Weights => new(4, Ptr + 92, 1, this);
+
+    /// <summary>
+    /// ByteProperty: Weights
+    /// </summary>
+    public unsafe byte Weights_0
+    {
+        get { return *(byte*)(Ptr + 92); }
+        set { *(byte*)(Ptr + 92) = value; }
+    }
+    /// <summary>
+    /// ByteProperty: Weights
+    /// </summary>
+    public unsafe byte Weights_1
+    {
+        get { return *(byte*)(Ptr + 93); }
+        set { *(byte*)(Ptr + 93) = value; }
+    }
+    /// <summary>
+    /// ByteProperty: Weights
+    /// </summary>
+    public unsafe byte Weights_2
+    {
+        get { return *(byte*)(Ptr + 94); }
+        set { *(byte*)(Ptr + 94) = value; }
+    }
+    /// <summary>
+    /// ByteProperty: Weights
+    /// </summary>
+    public unsafe byte Weights_3
+    {
+        get { return *(byte*)(Ptr + 95); }
+        set { *(byte*)(Ptr + 95) = value; }
+    }
+
+    static BmSDK.Function s_UseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Use_Params
+    {
+        [FieldOffset(0)] public nint User;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
+    /// <summary>
+    /// Function: Use
+    /// </summary>
+    public unsafe override bool Use(BmSDK.Engine.Pawn User)
+    {
+        var funcManaged = s_UseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Game.TestObject.Use", true);
+        var parms = new Use_Params();
+        parms.User = User?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+}
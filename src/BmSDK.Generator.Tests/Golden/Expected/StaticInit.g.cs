@@ -0,0 +1,31 @@
+namespace BmSDK.Framework;
+
+internal static partial class StaticInit
+{
+    private static readonly string[] s_classPaths =
+    [
+        "Core.Interface",
+        "Core.Object",
+        "Engine.Actor",
+        "Engine.Console",
+        "Engine.Interface_Usable",
+        "Engine.Pawn",
+        "Game.TestObject",
+    ];
+
+    private static readonly Type[] s_managedTypes =
+    [
+        typeof(BmSDK.Interface),
+        typeof(BmSDK.GameObject),
+        typeof(BmSDK.Engine.Actor),
+        typeof(BmSDK.Engine._Console),
+        typeof(BmSDK.Engine.Interface_Usable),
+        typeof(BmSDK.Engine.Pawn),
+        typeof(BmSDK.Game.TestObject),
+    ];
+
+    private static readonly int[] s_classTreeIntervals =
+    [
+        2, 3, 1, 7, 4, 5, 6, 6, 3, 3, 5, 5, 7, 7,
+    ];
+}
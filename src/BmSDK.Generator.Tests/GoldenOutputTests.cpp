@@ -0,0 +1,464 @@
+#include "pch.h"
+#include "Test.h"
+#include "Generator.h"
+#include "Framework/MappedFile.h"
+#include "Framework/Snapshot.h"
+
+#include <fstream>
+#include <map>
+#include <sstream>
+
+// Runs the whole generator (ClassInfo, Printer, manifest) on Golden/Small.snapshot and compares
+// the output with Golden/Expected. After an intended printer change, regenerate both with
+//
+//   BMSDK_UPDATE_GOLDEN=1 build/tests/BmSDK.Generator.Tests Golden_
+//
+// and review the diff of Golden/Expected like any other change.
+
+static const fs::path GoldenDir = BMSDK_GOLDEN_DIR;
+
+static bool IsUpdatingGolden()
+{
+    auto value = getenv("BMSDK_UPDATE_GOLDEN");
+    return value && string_view(value) == "1";
+}
+
+// SnapshotBuilder plus the bookkeeping of a real capture: names, outers and child chains.
+// Classes have to be added before anything else, like GObjects order in a real snapshot.
+class GoldenSnapshotBuilder
+{
+public:
+    uint32_t Package(string_view name)
+    {
+        return Add(name, "Package", SNAPSHOT_NONE, ESnapshotKind::Package);
+    }
+
+    uint32_t Class(string_view name, uint32_t package, uint32_t super, uint32_t flags, int32_t size)
+    {
+        ASSERT(NumObjects() == NumClasses);
+        NumClasses++;
+
+        auto i = Add(name, "Class", package, ESnapshotKind::Class);
+        auto& obj = Builder.GetObject(i);
+        obj.Super = super;
+        obj.Flags = flags;
+        obj.Size = size;
+        return i;
+    }
+
+    uint32_t Struct(string_view name, uint32_t outer, int32_t size)
+    {
+        auto i = AddField(name, "ScriptStruct", outer, ESnapshotKind::ScriptStruct);
+        Builder.GetObject(i).Size = size;
+        return i;
+    }
+
+    uint32_t Enum(string_view name, uint32_t outer, initializer_list<string_view> names)
+    {
+        auto i = AddField(name, "Enum", outer, ESnapshotKind::Enum);
+        vector<uint32_t> nameIndices;
+        for (auto enumName : names)
+        {
+            nameIndices.push_back(Builder.AddName(enumName));
+        }
+
+        Builder.SetList(i, nameIndices);
+        return i;
+    }
+
+    uint32_t Function(string_view name, uint32_t outer, uint32_t flags, int32_t size, uint32_t super = SNAPSHOT_NONE)
+    {
+        auto i = AddField(name, "Function", outer, ESnapshotKind::Function);
+        auto& obj = Builder.GetObject(i);
+        obj.Flags = flags;
+        obj.Size = size;
+        obj.Super = super;
+        return i;
+    }
+
+    uint32_t Property(string_view name, uint32_t outer, EPropertyKind kind, int32_t size, int32_t offset,
+        uint32_t ref = SNAPSHOT_NONE, uint32_t flags = 0, int32_t arrayDim = 1)
+    {
+        auto i = AddField(name, GetPropertyClassName(kind), outer, ESnapshotKind::Property);
+        auto& obj = Builder.GetObject(i);
+        obj.PropertyKind = kind;
+        obj.Size = size;
+        obj.Offset = offset;
+        obj.Ref = ref;
+        obj.Flags = flags;
+        obj.ArrayDim = arrayDim;
+        return i;
+    }
+
+    uint32_t Bool(string_view name, uint32_t outer, int32_t offset, int32_t bitMask, uint32_t flags = 0)
+    {
+        auto i = Property(name, outer, EPropertyKind::Bool, 4, offset, SNAPSHOT_NONE, flags);
+        Builder.GetObject(i).BitMask = bitMask;
+        return i;
+    }
+
+    // Inner property of an array, which isn't part of any child chain
+    uint32_t Inner(uint32_t outer, EPropertyKind kind, int32_t size, uint32_t ref = SNAPSHOT_NONE)
+    {
+        auto i = Add(Builder.GetObject(outer).Name, GetPropertyClassName(kind), outer, ESnapshotKind::Property);
+        auto& obj = Builder.GetObject(i);
+        obj.PropertyKind = kind;
+        obj.Size = size;
+        obj.Ref = ref;
+        obj.ArrayDim = 1;
+        return i;
+    }
+
+    void SetRef(uint32_t prop, uint32_t ref) { Builder.GetObject(prop).Ref = ref; }
+
+    void SetInterfaces(uint32_t _class, initializer_list<uint32_t> interfaces)
+    {
+        Builder.SetList(_class, vector<uint32_t>(interfaces));
+    }
+
+    vector<char> Build() const { return Builder.Build(NumClasses); }
+
+private:
+    uint32_t NumObjects() const { return NextIndex; }
+
+    uint32_t Add(string_view name, string_view className, uint32_t outer, ESnapshotKind kind)
+    {
+        return Add(Builder.AddName(name), className, outer, kind);
+    }
+
+    uint32_t Add(uint32_t nameIndex, string_view className, uint32_t outer, ESnapshotKind kind)
+    {
+        auto i = Builder.AddObject();
+        NextIndex++;
+
+        auto& obj = Builder.GetObject(i);
+        obj.Name = nameIndex;
+        obj.ClassName = Builder.AddName(className);
+        obj.Outer = outer;
+        obj.Kind = kind;
+        obj.ArrayDim = 1;
+        return i;
+    }
+
+    // Appends the field to its outer's child chain, in declaration order
+    uint32_t AddField(string_view name, string_view className, uint32_t outer, ESnapshotKind kind)
+    {
+        auto i = Add(name, className, outer, kind);
+        if (auto last = LastChild.find(outer); last != LastChild.end())
+        {
+            Builder.GetObject(last->second).Next = i;
+        }
+        else
+        {
+            Builder.GetObject(outer).Children = i;
+        }
+
+        LastChild[outer] = i;
+        return i;
+    }
+
+    static string_view GetPropertyClassName(EPropertyKind kind)
+    {
+        switch (kind)
+        {
+            case EPropertyKind::Int: return "IntProperty";
+            case EPropertyKind::Byte: return "ByteProperty";
+            case EPropertyKind::Float: return "FloatProperty";
+            case EPropertyKind::Bool: return "BoolProperty";
+            case EPropertyKind::Str: return "StrProperty";
+            case EPropertyKind::Name: return "NameProperty";
+            case EPropertyKind::Struct: return "StructProperty";
+            case EPropertyKind::Object: return "ObjectProperty";
+            case EPropertyKind::Component: return "ComponentProperty";
+            case EPropertyKind::Class: return "ClassProperty";
+            case EPropertyKind::Interface: return "InterfaceProperty";
+            case EPropertyKind::Array: return "ArrayProperty";
+            case EPropertyKind::Map: return "MapProperty";
+            case EPropertyKind::Delegate: return "DelegateProperty";
+            default: return "Property";
+        }
+    }
+
+    SnapshotBuilder Builder;
+    map<uint32_t, uint32_t> LastChild;
+    uint32_t NextIndex = 0;
+    uint32_t NumClasses = 0;
+};
+
+// A handful of classes covering every path through the printer: overridden and generated
+// structs, bitfields, static arrays, enums, interfaces, native/static/private/overriding
+// functions, out and optional params, and members the printer has to skip.
+static vector<char> BuildGoldenSnapshot()
+{
+    constexpr uint32_t CLASS_Abstract = (uint32_t)EClassFlags::CLASS_Abstract;
+    constexpr uint32_t CLASS_Interface = (uint32_t)EClassFlags::CLASS_Interface;
+    constexpr uint32_t CLASS_Intrinsic = (uint32_t)EClassFlags::CLASS_Intrinsic;
+    constexpr uint32_t FUNC_Native = (uint32_t)EFunctionFlags::FUNC_Native;
+    constexpr uint32_t FUNC_Event = (uint32_t)EFunctionFlags::FUNC_Event;
+    constexpr uint32_t FUNC_Operator = (uint32_t)EFunctionFlags::FUNC_Operator;
+    constexpr uint32_t FUNC_Static = (uint32_t)EFunctionFlags::FUNC_Static;
+    constexpr uint32_t FUNC_Private = (uint32_t)EFunctionFlags::FUNC_Private;
+    constexpr uint32_t CPF_Parm = (uint32_t)EPropertyFlags::CPF_Parm;
+    constexpr uint32_t CPF_Optional = CPF_Parm | (uint32_t)EPropertyFlags::CPF_OptionalParm;
+    constexpr uint32_t CPF_Out = CPF_Parm | (uint32_t)EPropertyFlags::CPF_OutParm;
+    constexpr uint32_t CPF_Return = CPF_Parm | (uint32_t)EPropertyFlags::CPF_ReturnParm;
+
+    using K = EPropertyKind;
+    GoldenSnapshotBuilder b;
+
+    // Classes come first. Their packages are filled in below.
+    constexpr uint32_t core = 7, engine = 8, game = 9;
+    auto object = b.Class("Object", core, SNAPSHOT_NONE, CLASS_Abstract, 60);
+    auto _interface = b.Class("Interface", core, object, CLASS_Abstract | CLASS_Interface, 60);
+    auto actor = b.Class("Actor", engine, object, 0, 228);
+    auto pawn = b.Class("Pawn", engine, actor, 0, 256);
+    auto usable = b.Class("Interface_Usable", engine, _interface, CLASS_Abstract | CLASS_Interface, 60);
+    auto console = b.Class("Console", engine, object, CLASS_Intrinsic, 64);
+    auto testObject = b.Class("TestObject", game, object, CLASS_Abstract, 96);
+    uint32_t packages[] = { b.Package("Core"), b.Package("Engine"), b.Package("Game") };
+    ASSERT(packages[0] == core && packages[1] == engine && packages[2] == game);
+
+    // Core.Object: engine structs that map to built-in managed types, and ObjectFlags
+    auto vector = b.Struct("Vector", object, 12);
+    b.Property("X", vector, K::Float, 4, 0);
+    b.Property("Y", vector, K::Float, 4, 4);
+    b.Property("Z", vector, K::Float, 4, 8);
+    auto rotator = b.Struct("Rotator", object, 12);
+    b.Property("Pitch", rotator, K::Int, 4, 0);
+    b.Property("Yaw", rotator, K::Int, 4, 4);
+    b.Property("Roll", rotator, K::Int, 4, 8);
+    auto qword = b.Struct("QWord", object, 8);
+    b.Property("A", qword, K::Int, 4, 0);
+    b.Property("B", qword, K::Int, 4, 4);
+    b.Enum("EAxis", object, { "AXIS_NONE", "AXIS_X", "AXIS_Y", "AXIS_NONE", "AXIS_MAX" });
+    b.Property("ObjectFlags", object, K::Struct, 8, 8, qword);
+    b.Property("Outer", object, K::Object, 4, 40, object);
+    b.Property("Name", object, K::Name, 8, 44);
+    b.Property("Class", object, K::Class, 4, 52, object);
+
+    auto clamp = b.Function("Clamp", object, FUNC_Native | FUNC_Static, 16);
+    b.Property("V", clamp, K::Int, 4, 0, SNAPSHOT_NONE, CPF_Parm);
+    b.Property("A", clamp, K::Int, 4, 4, SNAPSHOT_NONE, CPF_Parm);
+    b.Property("B", clamp, K::Int, 4, 8, SNAPSHOT_NONE, CPF_Parm);
+    b.Property("ReturnValue", clamp, K::Int, 4, 12, SNAPSHOT_NONE, CPF_Return);
+    auto addOperator = b.Function("Add_IntInt", object, FUNC_Native | FUNC_Operator | FUNC_Static, 12);
+    b.Property("A", addOperator, K::Int, 4, 0, SNAPSHOT_NONE, CPF_Parm);
+
+    // Engine.Actor: the common property kinds, bitfields and static arrays
+    auto netRole = b.Enum("ENetRole", actor, { "ROLE_None", "ROLE_SimulatedProxy", "ROLE_Authority" });
+    auto timerData = b.Struct("TimerData", actor, 56);
+    b.Bool("bLoop", timerData, 0, 1);
+    b.Bool("bPaused", timerData, 0, 2);
+    b.Property("Rate", timerData, K::Float, 4, 4);
+    b.Property("FuncName", timerData, K::Name, 8, 8);
+    b.Property("Location", timerData, K::Struct, 12, 16, vector);
+    b.Property("Counts", timerData, K::Int, 4, 28, SNAPSHOT_NONE, 0, 2);
+    b.Property("Target", timerData, K::Object, 4, 36, actor);
+    // Engine element size bigger than the managed Vector3, so it can't be a plain field
+    b.Property("PaddedLocation", timerData, K::Struct, 16, 40, vector);
+
+    b.Property("Location", actor, K::Struct, 12, 60, vector);
+    b.Property("Rotation", actor, K::Struct, 12, 72, rotator);
+    b.Bool("bHidden", actor, 84, 1);
+    b.Bool("bStatic", actor, 84, 2);
+    b.Property("Role", actor, K::Byte, 1, 88, netRole);
+    b.Property("Timers", actor, K::Int, 4, 92, SNAPSHOT_NONE, 0, 3);
+    b.Property("Owners", actor, K::Object, 4, 104, actor, 0, 2);
+    b.Property("Timer", actor, K::Struct, 56, 112, timerData);
+    auto touching = b.Property("Touching", actor, K::Array, 12, 168, SNAPSHOT_NONE);
+    b.Property("Description", actor, K::Str, 12, 180);
+    b.Property("OnDestroyed", actor, K::Delegate, 12, 192);
+    b.Property("Tags", actor, K::Map, 20, 204);
+    b.Property("Mesh", actor, K::Component, 4, 224, object);
+
+    auto touch = b.Function("Touch", actor, FUNC_Event, 16);
+    b.Property("Other", touch, K::Object, 4, 0, actor, CPF_Parm);
+    b.Property("HitLocation", touch, K::Struct, 12, 4, vector, CPF_Parm);
+    auto setLocation = b.Function("SetLocation", actor, FUNC_Native, 16);
+    b.Property("NewLocation", setLocation, K::Struct, 12, 0, vector, CPF_Parm);
+    b.Property("ReturnValue", setLocation, K::Bool, 4, 12, SNAPSHOT_NONE, CPF_Return);
+    auto getTimerCount = b.Function("GetTimerCount", actor, FUNC_Native, 12);
+    b.Property("FuncName", getTimerCount, K::Name, 8, 0, SNAPSHOT_NONE, CPF_Optional);
+    b.Property("Count", getTimerCount, K::Int, 4, 8, SNAPSHOT_NONE, CPF_Optional | CPF_Out);
+    auto takeDamage = b.Function("TakeDamage", actor, 0, 108);
+    b.Property("Damage", takeDamage, K::Int, 4, 0, SNAPSHOT_NONE, CPF_Parm);
+    b.Property("Instigator", takeDamage, K::Object, 4, 4, pawn, CPF_Parm);
+    b.Property("Data", takeDamage, K::Struct, 56, 8, timerData, CPF_Parm);
+    auto values = b.Property("Values", takeDamage, K::Array, 12, 64, SNAPSHOT_NONE, CPF_Parm);
+    b.Property("Reason", takeDamage, K::Str, 12, 76, SNAPSHOT_NONE, CPF_Parm);
+    b.Property("Reason", takeDamage, K::Str, 12, 88, SNAPSHOT_NONE, CPF_Out);
+    b.Property("Role", takeDamage, K::Byte, 1, 100, netRole, CPF_Parm);
+    b.Property("ReturnValue", takeDamage, K::Object, 4, 104, actor, CPF_Return);
+    // Engine size doesn't match the managed Vector3, so it can't be a params struct field
+    auto moveTo = b.Function("MoveTo", actor, 0, 20);
+    b.Property("Dest", moveTo, K::Struct, 16, 0, vector, CPF_Parm);
+    b.Property("Speed", moveTo, K::Float, 4, 16, SNAPSHOT_NONE, CPF_Parm);
+    auto logInternal = b.Function("LogInternal", actor, FUNC_Private | FUNC_Native, 12);
+    b.Property("S", logInternal, K::Str, 12, 0, SNAPSHOT_NONE, CPF_Parm);
+
+    // Engine.Pawn: an override and a struct-typed static array
+    b.Property("Health", pawn, K::Int, 4, 228);
+    b.Property("Feet", pawn, K::Struct, 12, 232, vector, 0, 2);
+    auto pawnTouch = b.Function("Touch", pawn, FUNC_Event, 16, touch);
+    b.Property("Other", pawnTouch, K::Object, 4, 0, actor, CPF_Parm);
+    b.Property("HitLocation", pawnTouch, K::Struct, 12, 4, vector, CPF_Parm);
+
+    // Engine.Interface_Usable
+    auto use = b.Function("Use", usable, FUNC_Event, 8);
+    b.Property("User", use, K::Object, 4, 0, pawn, CPF_Parm);
+    b.Property("ReturnValue", use, K::Bool, 4, 4, SNAPSHOT_NONE, CPF_Return);
+
+    // Engine.Console: renamed, and intrinsic, so its members aren't printed
+    b.Property("HistoryTop", console, K::Int, 4, 60);
+
+    // Game.TestObject: interface implementation, and names that clash with their outer
+    b.SetInterfaces(testObject, { usable });
+    b.Property("TestObject", testObject, K::Int, 4, 60);
+    b.Property("Usable", testObject, K::Interface, 8, 64, usable);
+    b.Property("ActorClass", testObject, K::Class, 4, 72, actor);
+    b.Property("Scales", testObject, K::Float, 4, 76, SNAPSHOT_NONE, 0, 4);
+    b.Property("Weights", testObject, K::Byte, 1, 92, SNAPSHOT_NONE, 0, 4);
+    auto testUse = b.Function("Use", testObject, FUNC_Event, 8, use);
+    b.Property("User", testUse, K::Object, 4, 0, pawn, CPF_Parm);
+    b.Property("ReturnValue", testUse, K::Bool, 4, 4, SNAPSHOT_NONE, CPF_Return);
+
+    // Array inner properties, outside of any child chain
+    b.SetRef(touching, b.Inner(touching, K::Object, 4, actor));
+    b.SetRef(values, b.Inner(values, K::Int, 4));
+
+    return b.Build();
+}
+
+static string ReadText(const fs::path& path)
+{
+    ifstream file(path, ios::binary);
+    stringstream text;
+    text << file.rdbuf();
+
+    // Checkouts may have converted line endings
+    auto str = text.str();
+    erase(str, '\r');
+    return str;
+}
+
+static bool WriteBinary(const fs::path& path, span<const char> data)
+{
+    ofstream file(path, ios::binary | ios::trunc);
+    file.write(data.data(), data.size());
+    return file.good();
+}
+
+// Relative path -> contents of every generated file. The manifest lists absolute paths,
+// so it's left out.
+static map<string, string> ReadTree(const fs::path& dir)
+{
+    map<string, string> files;
+    if (!fs::exists(dir))
+    {
+        return files;
+    }
+
+    for (auto& entry : fs::recursive_directory_iterator(dir))
+    {
+        if (entry.is_regular_file() && entry.path().filename() != ".manifest")
+        {
+            files[fs::relative(entry.path(), dir).generic_string()] = ReadText(entry.path());
+        }
+    }
+
+    return files;
+}
+
+static void ReportFirstDifference(const string& file, const string& expected, const string& actual)
+{
+    istringstream expectedLines(expected), actualLines(actual);
+    string expectedLine, actualLine;
+    for (int line = 1;; line++)
+    {
+        bool hasExpected = (bool)getline(expectedLines, expectedLine);
+        bool hasActual = (bool)getline(actualLines, actualLine);
+        if (!hasExpected && !hasActual)
+        {
+            return;
+        }
+
+        if (hasExpected != hasActual || expectedLine != actualLine)
+        {
+            cerr << "  " << file << " differs at line " << line << endl;
+            cerr << "    expected: " << (hasExpected ? expectedLine : "<end of file>") << endl;
+            cerr << "    actual:   " << (hasActual ? actualLine : "<end of file>") << endl;
+            return;
+        }
+    }
+}
+
+TEST_CASE(Golden_SnapshotMatchesBuilder)
+{
+    auto data = BuildGoldenSnapshot();
+    if (IsUpdatingGolden())
+    {
+        EXPECT(WriteBinary(GoldenDir / "Small.snapshot", data));
+        return;
+    }
+
+    // The checked-in snapshot is what the other cases read; keep it in sync with the builder
+    MappedFile file;
+    EXPECT(file.Open(GoldenDir / "Small.snapshot"));
+    auto checkedIn = file.GetData();
+    EXPECT(checkedIn.size() == data.size() && equal(checkedIn.begin(), checkedIn.end(), data.begin()));
+}
+
+TEST_CASE(Golden_GeneratesExpectedSdk)
+{
+    MappedFile file;
+    EXPECT(file.Open(GoldenDir / "Small.snapshot"));
+
+    Snapshot snapshot;
+    EXPECT(snapshot.Open(file.GetData()));
+
+    auto outDir = fs::temp_directory_path() / "BmSDK.Generator.Tests.Golden";
+    fs::remove_all(outDir);
+    EXPECT(Generator::Run(snapshot, outDir));
+
+    auto expectedDir = GoldenDir / "Expected";
+    if (IsUpdatingGolden())
+    {
+        fs::remove_all(expectedDir);
+        fs::create_directories(expectedDir);
+        for (auto& [path, text] : ReadTree(outDir))
+        {
+            fs::create_directories((expectedDir / path).parent_path());
+            EXPECT(WriteBinary(expectedDir / path, text));
+        }
+    }
+
+    auto expected = ReadTree(expectedDir);
+    auto actual = ReadTree(outDir);
+    EXPECT(!expected.empty());
+
+    for (auto& [path, text] : expected)
+    {
+        auto it = actual.find(path);
+        if (it == actual.end())
+        {
+            cerr << "  Missing " << path << endl;
+            EXPECT(actual.contains(path));
+        }
+        else if (it->second != text)
+        {
+            ReportFirstDifference(path, text, it->second);
+            EXPECT(it->second == text);
+        }
+    }
+
+    for (auto& [path, text] : actual)
+    {
+        if (!expected.contains(path))
+        {
+            cerr << "  Unexpected " << path << endl;
+            EXPECT(expected.contains(path));
+        }
+    }
+
+    fs::remove_all(outDir);
+}
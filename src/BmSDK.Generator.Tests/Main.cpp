@@ -0,0 +1,42 @@
+#include "pch.h"
+#include "Test.h"
+
+static int NumFailures = 0;
+
+vector<Test::Case>& Test::GetCases()
+{
+    static vector<Case> cases;
+    return cases;
+}
+
+void Test::ReportFailure(const char* expr, const char* file, int line)
+{
+    cerr << "  Expectation failed: " << expr << " in " << file << " at line " << line << endl;
+    NumFailures++;
+}
+
+int main(int argc, char** argv)
+{
+    // Optionally run only the cases whose names contain the given filter
+    string_view filter = argc > 1 ? argv[1] : "";
+
+    int numRun = 0, numFailed = 0;
+    for (auto& testCase : Test::GetCases())
+    {
+        if (string_view(testCase.Name).find(filter) == string_view::npos)
+        {
+            continue;
+        }
+
+        auto numFailuresBefore = NumFailures;
+        testCase.Body();
+        numRun++;
+
+        bool bPassed = NumFailures == numFailuresBefore;
+        numFailed += bPassed ? 0 : 1;
+        cout << (bPassed ? "[PASS] " : "[FAIL] ") << testCase.Name << endl;
+    }
+
+    cout << numRun - numFailed << "/" << numRun << " test cases passed" << endl;
+    return numFailed == 0 && numRun > 0 ? 0 : 1;
+}
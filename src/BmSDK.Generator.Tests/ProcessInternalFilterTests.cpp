@@ -0,0 +1,111 @@
+#include "pch.h"
+#include "Test.h"
+#include "process_internal_filter.h"
+#include "offsets.h"
+
+#include <cstring>
+#include <random>
+#include <set>
+
+// Just enough of a UFunction and FFrame for ShouldHandle() to read, at the real offsets
+struct FakeFunction
+{
+    alignas(8) uint8_t Bytes[64] = {};
+
+    explicit FakeFunction(uint32_t index) { memcpy(Bytes + offsets::UObject_Index, &index, sizeof(index)); }
+
+    uint32_t GetIndex() const
+    {
+        uint32_t index;
+        memcpy(&index, Bytes + offsets::UObject_Index, sizeof(index));
+        return index;
+    }
+};
+
+struct FakeFrame
+{
+    alignas(8) uint8_t Bytes[64] = {};
+
+    explicit FakeFrame(const FakeFunction& node)
+    {
+        auto nodePtr = &node.Bytes[0];
+        memcpy(Bytes + offsets::FFrame_Node, &nodePtr, sizeof(nodePtr));
+    }
+};
+
+TEST_CASE(ProcessInternalFilter_MatchesReferenceSet)
+{
+    // Sparse, GObjects-sized indices, including both ends of 64-bit words
+    vector<FakeFunction> functions;
+    for (uint32_t index : { 0u, 1u, 63u, 64u, 65u, 127u, 128u, 4095u, 70000u, 199999u })
+    {
+        functions.emplace_back(index);
+    }
+
+    mt19937 rng(1234);
+    for (int i = 0; i < 200; i++)
+    {
+        functions.emplace_back(rng() % 200000);
+    }
+
+    ProcessInternalFilter filter;
+    set<uint32_t> reference;
+    for (int step = 0; step < 5000; step++)
+    {
+        // Half the time an index with a function, so removals actually hit
+        auto index = rng() % 2 ? (uint32_t)(rng() % 200000) : functions[rng() % functions.size()].GetIndex();
+        if (rng() % 3)
+        {
+            filter.Add(index);
+            reference.insert(index);
+        }
+        else
+        {
+            filter.Remove(index);
+            reference.erase(index);
+        }
+    }
+
+    int numMismatches = 0;
+    for (auto& func : functions)
+    {
+        auto index = func.GetIndex();
+        FakeFrame frame(func);
+        bool bExpected = reference.contains(index);
+        numMismatches += filter.Contains(index) != bExpected || filter.ShouldHandle(frame.Bytes) != bExpected;
+    }
+
+    // Every index, not just the ones with fake functions
+    for (uint32_t index = 0; index < 200064; index++)
+    {
+        numMismatches += filter.Contains(index) != reference.contains(index);
+    }
+
+    EXPECT(numMismatches == 0);
+
+    // Removing something never added, past the end of the bitset, is a no-op
+    filter.Remove(1u << 30);
+    EXPECT(!filter.Contains(1u << 30));
+}
+
+TEST_CASE(ProcessInternalFilter_PassAllAndClear)
+{
+    FakeFunction hooked(100), other(101);
+    FakeFrame hookedFrame(hooked), otherFrame(other);
+
+    ProcessInternalFilter filter;
+    EXPECT(!filter.ShouldHandle(hookedFrame.Bytes));
+
+    filter.Add(100);
+    EXPECT(filter.ShouldHandle(hookedFrame.Bytes));
+    EXPECT(!filter.ShouldHandle(otherFrame.Bytes));
+
+    filter.SetPassAll(true);
+    EXPECT(filter.ShouldHandle(otherFrame.Bytes));
+    filter.SetPassAll(false);
+    EXPECT(!filter.ShouldHandle(otherFrame.Bytes));
+
+    filter.Clear();
+    EXPECT(!filter.ShouldHandle(hookedFrame.Bytes));
+    EXPECT(!filter.Contains(100));
+}
@@ -0,0 +1,133 @@
+#include "pch.h"
+#include "Test.h"
+#include "runtime_config.h"
+
+// Value of the named property, or "<unset>"
+static string GetProperty(const vector<RuntimeProperty>& properties, string_view name)
+{
+    for (auto& prop : properties)
+    {
+        if (prop.Name == name)
+        {
+            return prop.Value;
+        }
+    }
+
+    return "<unset>";
+}
+
+// Parses a single "GCHeapHardLimit = <value>" line, returning the normalized value or "<invalid>"
+static string ParseHeapLimit(string_view value)
+{
+    vector<string> errors;
+    auto properties = parse_runtime_config("GCHeapHardLimit = " + string(value), errors);
+    return errors.empty() ? GetProperty(properties, "System.GC.HeapHardLimit") : "<invalid>";
+}
+
+TEST_CASE(RuntimeConfig_ParsesBools)
+{
+    vector<string> errors;
+    auto properties = parse_runtime_config(
+        "ConcurrentGC = true\n"
+        "ServerGC = FALSE\n"
+        "TieredCompilation=1\n"
+        "  TC_QuickJitForLoops   =   0   # trailing comment\n"
+        "tieredpgo = True\r\n",
+        errors);
+
+    EXPECT(errors.empty());
+    EXPECT(properties.size() == 5);
+    EXPECT(GetProperty(properties, "System.GC.Concurrent") == "true");
+    EXPECT(GetProperty(properties, "System.GC.Server") == "false");
+    EXPECT(GetProperty(properties, "System.Runtime.TieredCompilation") == "true");
+    EXPECT(GetProperty(properties, "System.Runtime.TieredCompilation.QuickJitForLoops") == "false");
+    EXPECT(GetProperty(properties, "System.Runtime.TieredPGO") == "true");
+
+    for (auto value : { "yes", "2", "", "truee", "on" })
+    {
+        errors.clear();
+        properties = parse_runtime_config("ServerGC = " + string(value), errors);
+        EXPECT(properties.empty() && errors.size() == 1);
+    }
+}
+
+TEST_CASE(RuntimeConfig_ParsesByteSizes)
+{
+    EXPECT(ParseHeapLimit("0") == "0");
+    EXPECT(ParseHeapLimit("123456") == "123456");
+    EXPECT(ParseHeapLimit("512K") == "524288");
+    EXPECT(ParseHeapLimit("512k") == "524288");
+    EXPECT(ParseHeapLimit("200M") == "209715200");
+    EXPECT(ParseHeapLimit("2G") == "2147483648");
+    EXPECT(ParseHeapLimit("2 G") == "2147483648");
+    EXPECT(ParseHeapLimit("0x10000000") == "268435456");
+    EXPECT(ParseHeapLimit("0XfF") == "255");
+    EXPECT(ParseHeapLimit("0x10M") == "16777216");
+
+    for (auto value : { "", "K", "0x", "0xG", "12.5M", "-1", "1T", "ff", "1 000" })
+    {
+        EXPECT(ParseHeapLimit(value) == "<invalid>");
+    }
+}
+
+TEST_CASE(RuntimeConfig_RejectsOverflow)
+{
+    EXPECT(ParseHeapLimit("18446744073709551615") == "18446744073709551615");
+    EXPECT(ParseHeapLimit("0xFFFFFFFFFFFFFFFF") == "18446744073709551615");
+    EXPECT(ParseHeapLimit("18446744073709551616") == "<invalid>");
+    EXPECT(ParseHeapLimit("0x10000000000000000") == "<invalid>");
+
+    // In range before the suffix, not after it
+    EXPECT(ParseHeapLimit("17179869183G") == "18446744072635809792");
+    EXPECT(ParseHeapLimit("17179869184G") == "<invalid>");
+    EXPECT(ParseHeapLimit("0x40000000000000K") == "<invalid>");
+}
+
+TEST_CASE(RuntimeConfig_ReportsBadLinesByNumber)
+{
+    vector<string> errors;
+    auto properties = parse_runtime_config(
+        "# GC settings\n"
+        "\n"
+        "ConcurrentGC = false\n"
+        "HeapLimit = 200M\n"
+        "ServerGC\n"
+        "ServerGC = maybe\n"
+        "GCHeapHardLimit = lots\n"
+        "TieredPGO = false",
+        errors);
+
+    // Everything valid still applies
+    EXPECT(properties.size() == 2);
+    EXPECT(GetProperty(properties, "System.GC.Concurrent") == "false");
+    EXPECT(GetProperty(properties, "System.Runtime.TieredPGO") == "false");
+
+    EXPECT(errors.size() == 4);
+    if (errors.size() == 4)
+    {
+        EXPECT(errors[0] == "line 4: unknown key 'HeapLimit'");
+        EXPECT(errors[1] == "line 5: expected Key = Value");
+        EXPECT(errors[2] == "line 6: invalid value 'maybe' for ServerGC");
+        EXPECT(errors[3] == "line 7: invalid value 'lots' for GCHeapHardLimit");
+    }
+}
+
+TEST_CASE(RuntimeConfig_LastValueWins)
+{
+    vector<string> errors;
+    auto properties = parse_runtime_config(
+        "ServerGC = true\n"
+        "GCHeapHardLimit = 1G\n"
+        "ConcurrentGC = false\n"
+        "servergc = false\n"
+        "GCHeapHardLimit = 256M\n"
+        "GCHeapHardLimit = nonsense\n",
+        errors);
+
+    // An invalid later line doesn't undo the last valid one, and each property is set once
+    EXPECT(errors.size() == 1);
+    EXPECT(properties.size() == 3);
+    EXPECT(GetProperty(properties, "System.GC.Server") == "false");
+    EXPECT(GetProperty(properties, "System.GC.HeapHardLimit") == "268435456");
+    EXPECT(GetProperty(properties, "System.GC.Concurrent") == "false");
+}
@@ -0,0 +1,237 @@
+#include "pch.h"
+#include "Test.h"
+#include "Framework/SignatureScanner.h"
+
+#include <cstring>
+#include <random>
+
+// Reference implementation: every offset, every byte
+static size_t FindBruteForce(span<const uint8_t> data, const Signature& sig)
+{
+    for (size_t i = 0; i + sig.Bytes.size() <= data.size(); i++)
+    {
+        bool bMatches = true;
+        for (size_t j = 0; j < sig.Bytes.size() && bMatches; j++)
+        {
+            bMatches = ((data[i + j] ^ sig.Bytes[j]) & sig.Mask[j]) == 0;
+        }
+
+        if (bMatches)
+        {
+            return i;
+        }
+    }
+
+    return SIZE_MAX;
+}
+
+template <typename T> static void Put(vector<uint8_t>& data, size_t offset, T value)
+{
+    memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+// A PE file with one 3 MB code section at RVA 0x1000 (file offset 0x400), filled with noise
+struct SyntheticImage
+{
+    static constexpr uint32_t ImageBase = 0x400000;
+    static constexpr uint32_t SectionRva = 0x1000;
+    static constexpr uint32_t SectionFileOffset = 0x400;
+    static constexpr uint32_t SectionSize = 3 << 20;
+
+    vector<uint8_t> File;
+
+    SyntheticImage(mt19937& rng) : File(SectionFileOffset + SectionSize)
+    {
+        for (auto& b : File)
+        {
+            b = (uint8_t)rng();
+        }
+
+        // DOS header, then PE signature, file header and 32-bit optional header
+        Put<uint16_t>(File, 0, 0x5A4D);
+        Put<uint32_t>(File, 0x3C, 0x80);
+        Put<uint32_t>(File, 0x80, 0x4550);
+        Put<uint16_t>(File, 0x86, 1);
+        Put<uint32_t>(File, 0x88, 0x12345678);
+        Put<uint16_t>(File, 0x94, 224);
+        Put<uint16_t>(File, 0x98, 0x10B);
+        Put<uint32_t>(File, 0x98 + 28, ImageBase);
+        Put<uint32_t>(File, 0x98 + 56, SectionRva + SectionSize);
+        Put<uint32_t>(File, 0x98 + 64, 0xABCDEF);
+
+        // Section header: virtual size, RVA, raw size, raw offset, characteristics
+        size_t section = 0x98 + 224;
+        Put<uint32_t>(File, section + 8, SectionSize);
+        Put<uint32_t>(File, section + 12, SectionRva);
+        Put<uint32_t>(File, section + 16, SectionSize);
+        Put<uint32_t>(File, section + 20, SectionFileOffset);
+        Put<uint32_t>(File, section + 36, 0x60000020);
+    }
+
+    void Plant(uint32_t rva, span<const uint8_t> bytes)
+    {
+        memcpy(File.data() + RvaToFileOffset(rva), bytes.data(), bytes.size());
+    }
+
+    static size_t RvaToFileOffset(uint32_t rva) { return rva - SectionRva + SectionFileOffset; }
+};
+
+TEST_CASE(SignatureScanner_FindMatchesBruteForce)
+{
+    // A four-letter alphabet makes partial matches and overlaps common
+    mt19937 rng(1);
+    int numCompared = 0, numMismatches = 0;
+    for (int i = 0; i < 20000; i++)
+    {
+        vector<uint8_t> data(rng() % 300);
+        for (auto& b : data)
+        {
+            b = (uint8_t)(rng() % 4);
+        }
+
+        string text;
+        for (size_t j = 0, len = 1 + rng() % 8; j < len; j++)
+        {
+            text += rng() % 4 == 0 ? "?? " : std::format("{:02X} ", rng() % 4);
+        }
+
+        Signature sig;
+        if (!Signature::Parse(text, sig))
+        {
+            continue;
+        }
+
+        numCompared++;
+        numMismatches += SignatureScanner::Find(data, sig) != FindBruteForce(data, sig);
+    }
+
+    EXPECT(numCompared > 10000);
+    EXPECT(numMismatches == 0);
+}
+
+TEST_CASE(SignatureScanner_ParsesPatternsAndDefs)
+{
+    Signature sig;
+    EXPECT(Signature::Parse("8B 0D ?? ? 85", sig));
+    EXPECT(sig.Bytes.size() == 5 && sig.Mask[2] == 0 && sig.Mask[3] == 0 && sig.Mask[4] == 0xFF);
+    EXPECT(!Signature::Parse("ZZ", sig));
+    EXPECT(!Signature::Parse("?? ??", sig));
+
+    vector<string> errors;
+    auto defs = SignatureScanner::ParseDefs(
+        "# comment\n"
+        "Abs = A1 ?? ?? ?? ??, abs 1\n"
+        "Rel = E8 ?? ?? ?? ??, rel +1  # trailing comment\n"
+        "Add = C0 FF EE, add -2\n"
+        "Plain = 90 90\n"
+        "BadPattern = ZZ\n"
+        "BadTarget = 11, foo 3\n"
+        "NoEquals\n",
+        errors);
+
+    EXPECT(defs.size() == 4);
+    EXPECT(errors.size() == 3);
+    if (defs.size() == 4)
+    {
+        EXPECT(defs[0].Name == "Abs" && defs[0].Target == ESignatureTarget::Absolute && defs[0].Offset == 1);
+        EXPECT(defs[1].Target == ESignatureTarget::Relative && defs[1].Offset == 1);
+        EXPECT(defs[2].Target == ESignatureTarget::Match && defs[2].Offset == -2);
+        EXPECT(defs[3].Target == ESignatureTarget::Match && defs[3].Offset == 0);
+    }
+}
+
+TEST_CASE(SignatureScanner_ResolvesTargetsInImage)
+{
+    mt19937 rng(2);
+    SyntheticImage image(rng);
+
+    // "mov eax, [GObjects]" straddling the first chunk boundary
+    constexpr uint32_t absRva = SyntheticImage::SectionRva + (1 << 20) - 3;
+    constexpr uint32_t gobjectsRva = 0x22E900;
+    const uint8_t absCode[] = { 0xA1, 0, 0, 0, 0, 0x8B, 0x0C, 0xB0, 0xDE, 0xAD, 0xBE, 0xEF };
+    image.Plant(absRva, absCode);
+    Put<uint32_t>(image.File, SyntheticImage::RvaToFileOffset(absRva) + 1, SyntheticImage::ImageBase + gobjectsRva);
+
+    // "call <rel32>" 0x1000 bytes backwards, followed by bytes an "add" def anchors on
+    constexpr uint32_t relRva = SyntheticImage::SectionRva + 0x250000;
+    const uint8_t relCode[] = { 0x13, 0x37, 0xE8, 0, 0, 0, 0, 0xC0, 0xFF, 0xEE, 0x42 };
+    image.Plant(relRva, relCode);
+    Put<int32_t>(image.File, SyntheticImage::RvaToFileOffset(relRva) + 3, -0x1000);
+
+    vector<string> errors;
+    auto defs = SignatureScanner::ParseDefs(
+        "GObjects = A1 ?? ?? ?? ?? 8B 0C B0 DE AD BE EF, abs 1\n"
+        "Func = 13 37 E8 ? ? ? ? C0 FF EE 42, rel 3\n"
+        "Match = C0 FF EE 42, add -2\n"
+        "Missing = 11 22 33 44 55 66 77 88 99 AA BB CC DD\n",
+        errors);
+    EXPECT(errors.empty() && defs.size() == 4);
+
+    ImageInfo info;
+    EXPECT(ImageInfo::ReadFile(image.File, info));
+    EXPECT(info.TimeDateStamp == 0x12345678 && info.CheckSum == 0xABCDEF);
+    EXPECT(info.AddressBase == SyntheticImage::ImageBase && info.CodeSections.size() == 1);
+
+    const vector<uint32_t> expected = { gobjectsRva, relRva + 7 - 0x1000, relRva + 7 - 2, 0 };
+    for (size_t numThreads : { 1, 4 })
+    {
+        EXPECT(SignatureScanner::Scan(info, defs, numThreads) == expected);
+    }
+
+    // The same image as the loader would map it
+    vector<uint8_t> mapped(info.SizeOfImage);
+    memcpy(mapped.data(), image.File.data(), SyntheticImage::SectionFileOffset);
+    memcpy(mapped.data() + SyntheticImage::SectionRva, image.File.data() + SyntheticImage::SectionFileOffset,
+        SyntheticImage::SectionSize);
+
+    ImageInfo mappedInfo;
+    EXPECT(ImageInfo::ReadMapped(mapped.data(), mappedInfo));
+    auto mappedRvas = SignatureScanner::Scan(mappedInfo, defs, 2);
+    EXPECT(mappedRvas.size() == 4 && mappedRvas[1] == expected[1] && mappedRvas[2] == expected[2]);
+}
+
+TEST_CASE(SignatureScanner_CachesResultsPerBuild)
+{
+    mt19937 rng(3);
+    SyntheticImage image(rng);
+    const uint8_t code[] = { 0xDE, 0xC0, 0xDE, 0x5A, 0x11, 0xAD };
+    image.Plant(SyntheticImage::SectionRva + 0x1234, code);
+
+    vector<string> errors;
+    auto defs = SignatureScanner::ParseDefs("Found = DE C0 DE 5A 11 AD\nMissing = 01 23 45 67 89 AB CD EF\n", errors);
+    ImageInfo info;
+    EXPECT(ImageInfo::ReadFile(image.File, info));
+
+    auto cachePath = fs::temp_directory_path() / "BmSDK.Generator.Tests.signatures";
+    fs::remove(cachePath);
+
+    size_t numScanned = 0;
+    SignatureCache cache;
+    cache.Load(cachePath, info);
+    auto rvas = SignatureScanner::Resolve(info, defs, cache, 1, numScanned);
+    EXPECT(numScanned == 2 && cache.IsDirty());
+    EXPECT(rvas == vector<uint32_t>({ SyntheticImage::SectionRva + 0x1234, 0 }));
+    EXPECT(cache.Save(cachePath));
+
+    // Same build: misses are cached too, so nothing is scanned
+    SignatureCache reloaded;
+    reloaded.Load(cachePath, info);
+    EXPECT(SignatureScanner::Resolve(info, defs, reloaded, 1, numScanned) == rvas);
+    EXPECT(numScanned == 0 && !reloaded.IsDirty());
+
+    // A changed pattern invalidates only its own entry
+    auto changedDefs = defs;
+    Signature::Parse("01 23 45 67 89 AB CD EE", changedDefs[1].Pattern);
+    changedDefs[1].Text = "01 23 45 67 89 AB CD EE";
+    SignatureScanner::Resolve(info, changedDefs, reloaded, 1, numScanned);
+    EXPECT(numScanned == 1);
+
+    // Another build of the executable ignores the whole file
+    info.TimeDateStamp++;
+    SignatureCache otherBuild;
+    otherBuild.Load(cachePath, info);
+    SignatureScanner::Resolve(info, defs, otherBuild, 1, numScanned);
+    EXPECT(numScanned == 2);
+
+    fs::remove(cachePath);
+}
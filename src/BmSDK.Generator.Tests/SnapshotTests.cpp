@@ -0,0 +1,116 @@
+#include "pch.h"
+#include "Test.h"
+#include "Framework/Snapshot.h"
+
+// Two classes, a property and an enum: enough to cover every table in the file
+static vector<char> BuildSmallSnapshot()
+{
+    SnapshotBuilder builder;
+    auto objectClass = builder.AddObject();
+    auto actorClass = builder.AddObject();
+    auto package = builder.AddObject();
+    auto prop = builder.AddObject();
+    auto _enum = builder.AddObject();
+
+    auto& pkg = builder.GetObject(package);
+    pkg.Name = builder.AddName("Core");
+    pkg.Kind = ESnapshotKind::Package;
+
+    auto& obj = builder.GetObject(objectClass);
+    obj.Name = builder.AddName("Object");
+    obj.ClassName = builder.AddName("Class");
+    obj.Outer = package;
+    obj.Kind = ESnapshotKind::Class;
+    obj.Size = 60;
+
+    auto& actor = builder.GetObject(actorClass);
+    actor.Name = builder.AddName("Actor");
+    actor.ClassName = builder.AddName("Class");
+    actor.Outer = package;
+    actor.Kind = ESnapshotKind::Class;
+    actor.Super = objectClass;
+    actor.Children = prop;
+    actor.Flags = 0x123456789ull;
+    actor.Size = 64;
+
+    auto& health = builder.GetObject(prop);
+    health.Name = builder.AddName("Health");
+    health.ClassName = builder.AddName("IntProperty");
+    health.Outer = actorClass;
+    health.Kind = ESnapshotKind::Property;
+    health.PropertyKind = EPropertyKind::Int;
+    health.Size = 4;
+    health.Offset = 60;
+    health.ArrayDim = 1;
+
+    auto& e = builder.GetObject(_enum);
+    e.Name = builder.AddName("ENetRole");
+    e.Outer = actorClass;
+    e.Kind = ESnapshotKind::Enum;
+    uint32_t enumNames[] = { builder.AddName("ROLE_None"), builder.AddName("ROLE_Authority") };
+    builder.SetList(_enum, enumNames);
+
+    return builder.Build(2);
+}
+
+TEST_CASE(Snapshot_RoundTripsBuilderOutput)
+{
+    auto data = BuildSmallSnapshot();
+    Snapshot snapshot;
+    EXPECT(snapshot.Open(data));
+
+    EXPECT(snapshot.GetClasses().size() == 2);
+    EXPECT(snapshot.GetObjects().size() == 5);
+
+    auto& actor = snapshot.GetClasses()[1];
+    EXPECT(snapshot.GetName(actor.Name) == "Actor");
+    EXPECT(snapshot.GetName(actor.ClassName) == "Class");
+    EXPECT(actor.Kind == ESnapshotKind::Class);
+    EXPECT(actor.Super == 0);
+    EXPECT(actor.Flags == 0x123456789ull);
+    EXPECT(actor.Size == 64);
+
+    // Names added twice are stored once
+    EXPECT(actor.ClassName == snapshot.GetClasses()[0].ClassName);
+
+    auto health = snapshot.GetObject(actor.Children);
+    EXPECT(health && snapshot.GetName(health->Name) == "Health");
+    EXPECT(health && health->PropertyKind == EPropertyKind::Int && health->Offset == 60);
+    EXPECT(health && snapshot.GetObject(health->Next) == nullptr);
+
+    auto _enum = snapshot.GetObject(4);
+    EXPECT(_enum && _enum->Kind == ESnapshotKind::Enum);
+    if (_enum)
+    {
+        auto names = snapshot.GetList(*_enum);
+        EXPECT(names.size() == 2);
+        EXPECT(names.size() == 2 && snapshot.GetName(names[1]) == "ROLE_Authority");
+    }
+
+    // Out of range lookups are rejected rather than read
+    EXPECT(snapshot.GetObject(5) == nullptr);
+    EXPECT(snapshot.GetObject(SNAPSHOT_NONE) == nullptr);
+    EXPECT(snapshot.GetName(1000).empty());
+}
+
+TEST_CASE(Snapshot_RejectsDamagedData)
+{
+    auto data = BuildSmallSnapshot();
+    Snapshot snapshot;
+
+    // Truncated anywhere past the header, a table ends up out of bounds
+    EXPECT(!snapshot.Open(span(data).first(sizeof(SnapshotHeader) - 1)));
+    EXPECT(!snapshot.Open(span(data).first(data.size() - 8)));
+
+    auto badMagic = data;
+    ((SnapshotHeader*)badMagic.data())->Magic = 0;
+    EXPECT(!snapshot.Open(badMagic));
+
+    auto badVersion = data;
+    ((SnapshotHeader*)badVersion.data())->Version = SNAPSHOT_VERSION + 1;
+    EXPECT(!snapshot.Open(badVersion));
+
+    auto tooManyClasses = data;
+    ((SnapshotHeader*)tooManyClasses.data())->NumClasses = 6;
+    EXPECT(!snapshot.Open(tooManyClasses));
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <functional>
+
+// Minimal self-registering test cases. Each TEST_CASE() body runs once from main();
+// a failed EXPECT() is reported and fails the run, but the case keeps going.
+namespace Test
+{
+    struct Case
+    {
+        const char* Name;
+        function<void()> Body;
+    };
+
+    vector<Case>& GetCases();
+    void ReportFailure(const char* expr, const char* file, int line);
+
+    struct Registrar
+    {
+        Registrar(const char* name, function<void()> body) { GetCases().push_back({ name, std::move(body) }); }
+    };
+}
+
+#define TEST_CASE(NAME)                                                                            \
+    static void NAME();                                                                            \
+    static Test::Registrar NAME##_Registrar(#NAME, &NAME);                                         \
+    static void NAME()
+
+#define EXPECT(x)                                                                                  \
+    if (!(x))                                                                                      \
+    {                                                                                              \
+        Test::ReportFailure(#x, __FILE__, __LINE__);                                               \
+    }
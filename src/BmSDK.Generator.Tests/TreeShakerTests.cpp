@@ -0,0 +1,194 @@
+#include "pch.h"
+#include "Test.h"
+#include "Generator.h"
+#include "Framework/MappedFile.h"
+#include "Framework/Snapshot.h"
+#include "Framework/TreeShaker.h"
+
+#include <algorithm>
+#include <fstream>
+#include <regex>
+#include <set>
+#include <sstream>
+
+static const fs::path GoldenDir = BMSDK_GOLDEN_DIR;
+static const fs::path SdkDir = BMSDK_SDK_DIR;
+
+static string ReadText(const fs::path& path)
+{
+    ifstream file(path, ios::binary);
+    stringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+
+// C# source with comments, string and char literals, and using directives blanked out, so only
+// code that actually names a type is left
+static string StripNonCode(const string& source)
+{
+    string code;
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        if (source.compare(i, 2, "//") == 0)
+        {
+            i = source.find('\n', i);
+            if (i == string::npos)
+            {
+                break;
+            }
+        }
+        else if (source.compare(i, 2, "/*") == 0)
+        {
+            i = source.find("*/", i + 2);
+            if (i == string::npos)
+            {
+                break;
+            }
+
+            i++;
+            continue;
+        }
+        else if (source[i] == '"' || source[i] == '\'')
+        {
+            auto quote = source[i];
+            for (i++; i < source.size() && source[i] != quote; i++)
+            {
+                i += source[i] == '\\' ? 1 : 0;
+            }
+
+            code += ' ';
+            continue;
+        }
+
+        code += source[i];
+    }
+
+    static const regex usingDirective(R"(^\s*(global\s+)?using\s+[\w.:]+\s*;)", regex::multiline);
+    return regex_replace(code, usingDirective, "");
+}
+
+// Package-qualified path of every generated class outside Core (which is always kept), by
+// managed name. Renamed classes (_Console, _Engine) drop their leading underscore again.
+static map<string, string> GetGeneratedClassPaths(const fs::path& generatedDir)
+{
+    map<string, string> paths;
+    for (auto& packageDir : fs::directory_iterator(generatedDir))
+    {
+        if (!packageDir.is_directory() || packageDir.path().filename() == "Core")
+        {
+            continue;
+        }
+
+        for (auto& file : fs::directory_iterator(packageDir))
+        {
+            auto managedName = file.path().stem().stem().string();
+            auto name = managedName.starts_with('_') ? managedName.substr(1) : managedName;
+            paths[managedName] = packageDir.path().filename().string() + "." + name;
+        }
+    }
+
+    return paths;
+}
+
+TEST_CASE(TreeShaker_FrameworkRootsCoverSources)
+{
+    auto classPaths = GetGeneratedClassPaths(SdkDir / "Generated");
+    EXPECT(!classPaths.empty());
+
+    auto roots = TreeShaker::GetFrameworkRoots();
+    set<string> usedPaths;
+    for (auto& entry : fs::recursive_directory_iterator(SdkDir))
+    {
+        auto relativePath = fs::relative(entry.path(), SdkDir).generic_string();
+        if (!entry.is_regular_file() || entry.path().extension() != ".cs" ||
+            relativePath.starts_with("Generated/") || relativePath.starts_with("obj/") ||
+            relativePath.starts_with("bin/"))
+        {
+            continue;
+        }
+
+        static const regex identifier(R"([A-Za-z_]\w*)");
+        auto code = StripNonCode(ReadText(entry.path()));
+        for (sregex_iterator it(code.begin(), code.end(), identifier), end; it != end; ++it)
+        {
+            auto classPath = classPaths.find(it->str());
+            if (classPath != classPaths.end() && usedPaths.insert(classPath->second).second &&
+                ranges::find(roots, classPath->second) == roots.end())
+            {
+                cerr << "  " << relativePath << " uses " << classPath->second << ", which isn't a framework root"
+                    << endl;
+                EXPECT(ranges::find(roots, classPath->second) != roots.end());
+            }
+        }
+    }
+
+    // And nothing is kept that the framework no longer uses
+    for (auto root : roots)
+    {
+        if (!usedPaths.contains(string(root)))
+        {
+            cerr << "  Framework root " << root << " isn't used by the framework sources" << endl;
+            EXPECT(usedPaths.contains(string(root)));
+        }
+    }
+}
+
+// Relative path of every generated class file
+static set<string> ListClassFiles(const fs::path& dir)
+{
+    set<string> files;
+    for (auto& entry : fs::recursive_directory_iterator(dir))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == ".cs")
+        {
+            files.insert(fs::relative(entry.path(), dir).generic_string());
+        }
+    }
+
+    return files;
+}
+
+// Trimming only drops whole classes, so the trimmed SDK compiles as long as every generated class
+// it names (bases, member types, typeof() in StaticInit) was kept as well. BmSDK.TrimmedBuild
+// compiles one for real when a game snapshot is available.
+TEST_CASE(TreeShaker_TrimmedSdkIsClosed)
+{
+    MappedFile file;
+    EXPECT(file.Open(GoldenDir / "Small.snapshot"));
+
+    Snapshot snapshot;
+    EXPECT(snapshot.Open(file.GetData()));
+
+    auto tempDir = fs::temp_directory_path() / "BmSDK.Generator.Tests.TreeShaker";
+    fs::remove_all(tempDir);
+    EXPECT(Generator::Run(snapshot, tempDir / "Full"));
+    EXPECT(Generator::Run(snapshot, tempDir / "Trimmed", GoldenDir / "SdkRoots.txt"));
+
+    auto fullFiles = ListClassFiles(tempDir / "Full");
+    auto trimmedFiles = ListClassFiles(tempDir / "Trimmed");
+    EXPECT(trimmedFiles.size() < fullFiles.size());
+    EXPECT(trimmedFiles.contains("Engine/Pawn.g.cs") && trimmedFiles.contains("Engine/Actor.g.cs"));
+    EXPECT(!trimmedFiles.contains("Game/TestObject.g.cs"));
+
+    // "BmSDK.Engine.Actor.FTimerData" names Engine/Actor.g.cs, "BmSDK.GameObject" Core/GameObject.g.cs
+    static const regex typeName(R"(BmSDK\.(\w+)(?:\.(\w+))?)");
+    for (auto& path : trimmedFiles)
+    {
+        auto code = ReadText(tempDir / "Trimmed" / path);
+        for (sregex_iterator it(code.begin(), code.end(), typeName), end; it != end; ++it)
+        {
+            auto coreFile = "Core/" + (*it)[1].str() + ".g.cs";
+            auto packageFile = (*it)[1].str() + "/" + (*it)[2].str() + ".g.cs";
+            for (auto& candidate : { coreFile, packageFile })
+            {
+                if (fullFiles.contains(candidate) && !trimmedFiles.contains(candidate))
+                {
+                    cerr << "  " << path << " uses " << it->str() << ", which was trimmed" << endl;
+                    EXPECT(trimmedFiles.contains(candidate));
+                }
+            }
+        }
+    }
+
+    fs::remove_all(tempDir);
+}
@@ -0,0 +1,289 @@
+#include "pch.h"
+#include "Test.h"
+#include "Framework/UpkIndex.h"
+#include "Framework/UpkReader.h"
+
+#include <cstring>
+#include <fstream>
+
+// Lays out a synthetic uncompressed package header the way UE3 serializes it for the given
+// file version, so every version-dependent field of the reader gets exercised.
+class UpkWriter
+{
+public:
+    struct Export
+    {
+        int32_t ClassIndex = 0;
+        int32_t OuterIndex = 0;
+        int32_t ObjectName = 0;
+    };
+
+    uint16_t FileVersion = 576;
+    uint32_t PackageFlags = 0;
+    uint32_t CompressionFlags = 0;
+    int32_t NumGenerations = 1;
+    int32_t ImportCount = 0;
+    vector<string> Names;
+    // Stored as UTF-16 instead of ANSI
+    vector<bool> IsWideName;
+    vector<Export> Exports;
+
+    vector<char> Build() const
+    {
+        vector<char> out;
+        auto nameCountPos = WriteSummary(out);
+
+        auto nameOffset = (int32_t)out.size();
+        for (size_t i = 0; i < Names.size(); i++)
+        {
+            WriteString(out, Names[i], i < IsWideName.size() && IsWideName[i]);
+            Write<uint64_t>(out, 0x0007001000000000ull);
+        }
+
+        auto exportOffset = (int32_t)out.size();
+        for (auto& e : Exports)
+        {
+            WriteExport(out, e);
+        }
+
+        Patch(out, nameCountPos, (int32_t)Names.size());
+        Patch(out, nameCountPos + 4, nameOffset);
+        Patch(out, nameCountPos + 8, (int32_t)Exports.size());
+        Patch(out, nameCountPos + 12, exportOffset);
+        return out;
+    }
+
+private:
+    template <typename T> static void Write(vector<char>& out, T value)
+    {
+        out.insert(out.end(), (const char*)&value, (const char*)&value + sizeof(T));
+    }
+
+    template <typename T> static void Patch(vector<char>& out, size_t pos, T value)
+    {
+        memcpy(out.data() + pos, &value, sizeof(T));
+    }
+
+    static void WriteString(vector<char>& out, string_view str, bool bWide)
+    {
+        auto length = (int32_t)str.size() + 1;
+        Write(out, bWide ? -length : length);
+        for (auto c : str)
+        {
+            bWide ? Write<uint16_t>(out, (uint8_t)c) : Write<char>(out, c);
+        }
+
+        bWide ? Write<uint16_t>(out, 0) : Write<char>(out, 0);
+    }
+
+    // Returns where the name count is, so the table offsets can be filled in later
+    size_t WriteSummary(vector<char>& out) const
+    {
+        Write(out, UPK_TAG);
+        Write<uint32_t>(out, FileVersion | (0x0015u << 16));
+        if (FileVersion >= 249)
+        {
+            Write<int32_t>(out, 0);
+        }
+
+        WriteString(out, "None", false);
+        Write(out, PackageFlags);
+
+        auto nameCountPos = out.size();
+        Write<int32_t>(out, 0);
+        Write<int32_t>(out, 0);
+        Write<int32_t>(out, 0);
+        Write<int32_t>(out, 0);
+        Write(out, ImportCount);
+        Write<int32_t>(out, 0);
+
+        if (FileVersion >= 415)
+        {
+            Write<int32_t>(out, 0);
+        }
+
+        if (FileVersion >= 623)
+        {
+            out.insert(out.end(), 12, 0);
+        }
+
+        if (FileVersion >= 584)
+        {
+            Write<int32_t>(out, 0);
+        }
+
+        // Package guid, generations, engine and cooker version
+        out.insert(out.end(), 16, 0);
+        Write(out, NumGenerations);
+        out.insert(out.end(), NumGenerations * (FileVersion >= 322 ? 12 : 8), 0);
+        Write<int32_t>(out, 5000);
+        Write<int32_t>(out, 100);
+
+        Write(out, CompressionFlags);
+        Write<int32_t>(out, 0);
+        return nameCountPos;
+    }
+
+    void WriteExport(vector<char>& out, const Export& e) const
+    {
+        Write(out, e.ClassIndex);
+        Write<int32_t>(out, 0);
+        Write(out, e.OuterIndex);
+        Write(out, e.ObjectName);
+        Write<int32_t>(out, 0);
+        Write<int32_t>(out, 0);
+        Write<uint64_t>(out, 0x000F000400000000ull);
+        Write<int32_t>(out, 0);
+        Write<int32_t>(out, 0);
+
+        if (FileVersion < 543)
+        {
+            // One component map entry
+            Write<int32_t>(out, 1);
+            out.insert(out.end(), 12, 0);
+        }
+
+        // Export flags, one net object count, package guid and flags
+        Write<int32_t>(out, 0);
+        Write<int32_t>(out, 1);
+        Write<int32_t>(out, 0);
+        out.insert(out.end(), 16, 0);
+        if (FileVersion >= 475)
+        {
+            Write<int32_t>(out, 0);
+        }
+    }
+};
+
+static UpkWriter MakeClassPackage(uint16_t fileVersion)
+{
+    UpkWriter writer;
+    writer.FileVersion = fileVersion;
+    writer.ImportCount = 2;
+    writer.Names = { "None", "Core", "Class", "BatmanPawn", "Default__BatmanPawn" };
+    writer.IsWideName = { false, false, false, true, false };
+    writer.Exports = {
+        // A UClass has no class reference
+        { 0, 0, 3 },
+        { -1, 0, 4 },
+    };
+    return writer;
+}
+
+TEST_CASE(UpkReader_ReadsHeaderAcrossFileVersions)
+{
+    // Before/after the component map removal, thumbnail table and import/export guids
+    for (uint16_t fileVersion : { 512, 576, 805 })
+    {
+        auto data = MakeClassPackage(fileVersion).Build();
+        UpkReader reader(data);
+
+        UpkSummary summary;
+        EXPECT(reader.ReadSummary(summary));
+        EXPECT(summary.FileVersion == fileVersion);
+        EXPECT(summary.LicenseeVersion == 0x15);
+        EXPECT(!summary.IsCompressed());
+        EXPECT(summary.NameCount == 5 && summary.ExportCount == 2 && summary.ImportCount == 2);
+
+        vector<string> names;
+        EXPECT(reader.ReadNames(summary, names));
+        EXPECT(names.size() == 5);
+        EXPECT(names.size() == 5 && names[3] == "BatmanPawn" && names[4] == "Default__BatmanPawn");
+
+        vector<UpkExport> exports;
+        EXPECT(reader.ReadExports(summary, exports));
+        EXPECT(exports.size() == 2);
+        EXPECT(exports.size() == 2 && exports[0].ClassIndex == 0 && exports[0].ObjectName == 3);
+        EXPECT(exports.size() == 2 && exports[1].ClassIndex == -1 && exports[1].ObjectFlags == 0x000F000400000000ull);
+    }
+}
+
+TEST_CASE(UpkReader_RejectsUnreadablePackages)
+{
+    auto data = MakeClassPackage(576).Build();
+    UpkSummary summary;
+
+    // Not a package
+    auto badTag = data;
+    badTag[0] = 0;
+    EXPECT(!UpkReader(badTag).ReadSummary(summary));
+
+    // Cut off inside the summary, and inside the export table
+    EXPECT(!UpkReader(span(data).first(40)).ReadSummary(summary));
+    {
+        auto truncated = span(data).first(data.size() - 4);
+        UpkReader reader(truncated);
+        vector<UpkExport> exports;
+        EXPECT(reader.ReadSummary(summary) && !reader.ReadExports(summary, exports));
+    }
+
+    // Compressed packages only have their summary readable
+    {
+        auto writer = MakeClassPackage(576);
+        writer.CompressionFlags = 0x2;
+        auto compressed = writer.Build();
+        UpkReader reader(compressed);
+        vector<string> names;
+        EXPECT(reader.ReadSummary(summary) && summary.IsCompressed());
+        EXPECT(!reader.ReadNames(summary, names));
+    }
+
+    // A class reference past the import table means the layout was guessed wrong
+    {
+        auto writer = MakeClassPackage(576);
+        writer.Exports[1].ClassIndex = -3;
+        auto garbage = writer.Build();
+        UpkReader reader(garbage);
+        vector<UpkExport> exports;
+        EXPECT(reader.ReadSummary(summary) && !reader.ReadExports(summary, exports));
+    }
+
+    // Unknown compression bits, e.g. a licensee field shifting the layout
+    {
+        auto writer = MakeClassPackage(576);
+        writer.CompressionFlags = 0x100;
+        auto unknown = writer.Build();
+        EXPECT(!UpkReader(unknown).ReadSummary(summary));
+    }
+}
+
+TEST_CASE(UpkIndex_ClassifiesPackagesByExports)
+{
+    auto dir = fs::temp_directory_path() / "BmSDK.Generator.Tests.UpkIndex";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    auto writeFile = [&](const char* name, const vector<char>& data)
+        {
+            ofstream(dir / name, ios::binary).write(data.data(), data.size());
+        };
+
+    auto noClasses = MakeClassPackage(576);
+    noClasses.Exports = { { -1, 0, 4 } };
+    auto compressed = MakeClassPackage(576);
+    compressed.CompressionFlags = 0x2;
+
+    writeFile("Classes.upk", MakeClassPackage(576).Build());
+    writeFile("Content.upk", noClasses.Build());
+    writeFile("Compressed.upk", compressed.Build());
+    writeFile("Readme.txt", { 'h', 'i' });
+
+    UpkIndex index;
+    index.Update(dir);
+    auto& entries = index.GetEntries();
+    EXPECT(entries.size() == 3 && index.GetNumScanned() == 3);
+    EXPECT(entries.contains("Classes") && entries.at("Classes").Kind == EPackageKind::HasClasses);
+    EXPECT(entries.contains("Content") && entries.at("Content").Kind == EPackageKind::NoClasses);
+    EXPECT(entries.contains("Compressed") && entries.at("Compressed").Kind == EPackageKind::Unknown);
+
+    // Saved and reloaded, unchanged packages aren't scanned again
+    auto indexPath = dir / ".upkindex";
+    EXPECT(index.Save(indexPath));
+    auto reloaded = UpkIndex::Load(indexPath);
+    reloaded.Update(dir);
+    EXPECT(reloaded.GetNumScanned() == 0);
+    EXPECT(reloaded.GetEntries().contains("Classes") &&
+        reloaded.GetEntries().at("Classes").Kind == EPackageKind::HasClasses);
+
+    fs::remove_all(dir);
+}
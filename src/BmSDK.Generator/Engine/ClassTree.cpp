@@ -0,0 +1,60 @@
+#include "pch.h"
+#include "ClassTree.h"
+#include "UClass.h"
+
+vector<TreeInterval> ClassTree::Intervals = {};
+
+void ClassTree::Build()
+{
+    auto numObjects = Runtime::GObjects->Num > 0 ? (size_t)Runtime::GObjects->Num : 0;
+
+    // Number only the classes, then spread the result back out by object index
+    vector<const UClass*> classes;
+    vector<uint32_t> classIndices(numObjects, TREE_NO_PARENT);
+    for (size_t i = 0; i < numObjects; i++)
+    {
+        auto obj = Runtime::GObjects->ElementAt((INT)i);
+        if (obj && obj->Class == UClass::StaticClass() && Runtime::GObjects->ElementAt(obj->Index) == obj)
+        {
+            classIndices[i] = (uint32_t)classes.size();
+            classes.push_back((const UClass*)obj);
+        }
+    }
+
+    vector<uint32_t> parents(classes.size(), TREE_NO_PARENT);
+    for (size_t i = 0; i < classes.size(); i++)
+    {
+        // Same checks as above: the super has to be a class that was numbered in its own slot,
+        // otherwise this class is treated as a root
+        auto super = classes[i]->SuperStruct;
+        if (super && super->Index >= 0 && (size_t)super->Index < numObjects)
+        {
+            auto superIndex = classIndices[super->Index];
+            if (superIndex != TREE_NO_PARENT && classes[superIndex] == super)
+            {
+                parents[i] = superIndex;
+            }
+        }
+    }
+
+    auto classIntervals = NumberTree(parents);
+
+    Intervals.assign(numObjects, {});
+    for (size_t i = 0; i < classes.size(); i++)
+    {
+        Intervals[classes[i]->Index] = classIntervals[i];
+    }
+
+    TRACE("Numbered class tree of {} classes", classes.size());
+}
+
+const TreeInterval* ClassTree::Find(const UObject* classObj)
+{
+    if (!classObj || classObj->Index < 0 || (size_t)classObj->Index >= Intervals.size())
+    {
+        return nullptr;
+    }
+
+    auto& interval = Intervals[classObj->Index];
+    return interval.IsValid() ? &interval : nullptr;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Framework/TreeInterval.h"
+
+class UObject;
+
+// Depth-first numbering of every loaded class, indexed by object index, so checking
+// whether one class derives from another is two compares instead of a super chain walk.
+// Build it once the set of loaded classes stops changing.
+class ClassTree
+{
+private:
+    ClassTree() = delete;
+
+public:
+    static void Build();
+
+    // Returns nullptr if classObj isn't a class or wasn't loaded when the tree was built.
+    static const TreeInterval* Find(const UObject* classObj);
+
+private:
+    static vector<TreeInterval> Intervals;
+};
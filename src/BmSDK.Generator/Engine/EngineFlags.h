@@ -0,0 +1,54 @@
+#pragma once
+
+// Engine flags and kinds shared by the live object mirrors and the reflection snapshot.
+// Keep this header free of anything that needs the running game.
+
+enum class EObjectFlags : QWORD
+{
+    RF_ClassDefaultObject = 0x80
+};
+
+enum class EClassFlags : DWORD
+{
+    CLASS_Abstract = 0x1,
+    CLASS_Interface = 0x4000,
+    CLASS_Intrinsic = 0x10000000,
+};
+
+enum class EFunctionFlags : DWORD
+{
+    FUNC_Iterator = 0x4,
+    FUNC_Native = 0x400,
+    FUNC_Event = 0x800,
+    FUNC_Operator = 0x1000,
+    FUNC_Static = 0x2000,
+    FUNC_Private = 0x40000,
+};
+
+enum class EPropertyFlags : DWORD
+{
+    CPF_Parm = 0x8,
+    CPF_OptionalParm = 0x10,
+    CPF_OutParm = 0x20,
+    CPF_ReturnParm = 0x80
+};
+
+// Property classes the generator knows how to map, resolved once per class object.
+enum class EPropertyKind : BYTE
+{
+    Unknown,
+    Int,
+    Byte,
+    Float,
+    Bool,
+    Str,
+    Name,
+    Struct,
+    Object,
+    Component,
+    Class,
+    Interface,
+    Array,
+    Map,
+    Delegate,
+};
@@ -0,0 +1,39 @@
+#include "pch.h"
+#include "FName.h"
+
+#include <deque>
+
+static vector<string_view> EntryNames = {};
+static deque<string> EntryNameStorage = {};
+static size_t EntryNameHits = 0;
+static size_t EntryNameMisses = 0;
+// Characters and heap allocations the hits would have cost to convert again
+static size_t EntryNameBytesReused = 0;
+static size_t EntryNameAllocsAvoided = 0;
+
+string_view FName::GetEntryName() const
+{
+    if (Index < (INT)EntryNames.size() && EntryNames[Index].data())
+    {
+        auto name = EntryNames[Index];
+        EntryNameHits++;
+        EntryNameBytesReused += name.size();
+        EntryNameAllocsAvoided += name.size() > string().capacity() ? 1 : 0;
+        return name;
+    }
+
+    EntryNameMisses++;
+    if (Index >= (INT)EntryNames.size())
+    {
+        EntryNames.resize(max(Index + 1, Runtime::GNames->Num));
+    }
+
+    auto& name = EntryNameStorage.emplace_back(GetNameEntry()->ToString());
+    return EntryNames[Index] = name;
+}
+
+void FName::LogCacheStats()
+{
+    TRACE("Names: {} hits, {} misses, {:.1f} KB of strings and {} allocations not converted again", EntryNameHits,
+        EntryNameMisses, EntryNameBytesReused / 1e3, EntryNameAllocsAvoided);
+}
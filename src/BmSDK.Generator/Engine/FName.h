@@ -45,10 +45,15 @@ class FName
 public:
     string ToString() const
     {
-        auto str = GetNameEntry()->ToString();
-        return Number == 0 ? str : std::format("{}_{}", str, Number - 1);
+        auto str = GetEntryName();
+        return Number == 0 ? string(str) : std::format("{}_{}", str, Number - 1);
     }
 
+    // Returns the GNames entry as a view that stays valid for the whole run.
+    // Each entry is only converted once.
+    string_view GetEntryName() const;
+    static void LogCacheStats();
+
     const FNameEntry* GetNameEntry() const { return Runtime::GNames->ElementAt(Index); }
 };
 
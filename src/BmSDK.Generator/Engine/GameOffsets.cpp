@@ -0,0 +1,87 @@
+#include "pch.h"
+#include "GameOffsets.h"
+#include "Framework/SignatureScanner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+void GameOffsets::Resolve(uintptr_t baseAddress, const fs::path& signaturesPath, const fs::path& cachePath)
+{
+    struct Target
+    {
+        string_view Name;
+        uintptr_t* Offset;
+    };
+
+    const Target targets[] = {
+        { "GObjects", &GObjects },
+        { "GNames", &GNames },
+        { "StaticFindObject", &StaticFindObject },
+        { "LoadPackage", &LoadPackage },
+        { "CollectGarbage", &CollectGarbage },
+    };
+
+    ifstream file(signaturesPath);
+    if (!file.is_open())
+    {
+        TRACE("No signatures file, using built-in offsets");
+        return;
+    }
+
+    stringstream text;
+    text << file.rdbuf();
+    vector<string> errors;
+    auto allDefs = SignatureScanner::ParseDefs(text.str(), errors);
+    for (const auto& error : errors)
+    {
+        TRACE("{}: {}", signaturesPath.filename().string(), error);
+    }
+
+    // The file may have signatures for more than the generator needs
+    vector<SignatureDef> defs;
+    vector<uintptr_t*> offsets;
+    for (const auto& target : targets)
+    {
+        auto def = ranges::find(allDefs, target.Name, &SignatureDef::Name);
+        if (def != allDefs.end())
+        {
+            defs.push_back(*def);
+            offsets.push_back(target.Offset);
+        }
+    }
+
+    ImageInfo image;
+    if (defs.empty() || !ImageInfo::ReadMapped((const uint8_t*)baseAddress, image))
+    {
+        return;
+    }
+
+    auto resolveStart = chrono::steady_clock::now();
+
+    SignatureCache cache;
+    cache.Load(cachePath, image);
+    size_t numScanned = 0;
+    auto rvas = SignatureScanner::Resolve(image, defs, cache, 0, numScanned);
+    for (size_t i = 0; i < defs.size(); i++)
+    {
+        if (rvas[i] == 0)
+        {
+            TRACE("Signature {} has no match, using built-in offset {:#x}", defs[i].Name, *offsets[i]);
+            continue;
+        }
+
+        *offsets[i] = rvas[i];
+    }
+
+    error_code ec;
+    fs::create_directories(cachePath.parent_path(), ec);
+    if (cache.IsDirty() && !cache.Save(cachePath))
+    {
+        TRACE("Couldn't write signature cache");
+    }
+
+    auto resolveTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - resolveStart);
+    TRACE("Resolved {} signatures ({} scanned) in {} ms", defs.size(), numScanned, resolveTime.count());
+}
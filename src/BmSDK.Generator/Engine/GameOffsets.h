@@ -6,10 +6,15 @@ private:
     GameOffsets() = delete;
 
 public:
-    // Globals
-    static const uintptr_t GObjects = 0x122E900;
-    static const uintptr_t GNames = 0x11EC5E8;
-    static const uintptr_t StaticFindObject = 0x8ED20;
-    static const uintptr_t LoadPackage = 0x9FCA0;
-    static const uintptr_t CollectGarbage = 0xAF0C0;
+    // Resolves the offsets below from the signatures in signaturesPath, if there's one. Results
+    // are cached in cachePath for as long as the executable doesn't change, so later runs
+    // don't scan at all. Anything that can't be resolved keeps its built-in value.
+    static void Resolve(uintptr_t baseAddress, const fs::path& signaturesPath, const fs::path& cachePath);
+
+    // Globals. The built-in values are for the executable BmSDK was written against.
+    static inline uintptr_t GObjects = 0x122E900;
+    static inline uintptr_t GNames = 0x11EC5E8;
+    static inline uintptr_t StaticFindObject = 0x8ED20;
+    static inline uintptr_t LoadPackage = 0x9FCA0;
+    static inline uintptr_t CollectGarbage = 0xAF0C0;
 };
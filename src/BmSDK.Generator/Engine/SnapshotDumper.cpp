@@ -0,0 +1,185 @@
+#include "pch.h"
+#include "SnapshotDumper.h"
+#include "ClassTree.h"
+#include "UClass.h"
+#include "UEnum.h"
+#include "UFunction.h"
+#include "UProperty.h"
+
+vector<char> SnapshotDumper::Capture()
+{
+    // Every kind check below is an IsA, so number the class tree first
+    ClassTree::Build();
+
+    // Classes go first so they keep their GObjects order
+    uint32_t numClasses = 0;
+    for (INT i = 0; i < Runtime::GObjects->Num; i++)
+    {
+        auto obj = Runtime::GObjects->ElementAt(i);
+
+        bool isValid = obj != nullptr && (Runtime::GObjects->ElementAt(obj->Index) == obj);
+        if (!isValid)
+        {
+            continue;
+        }
+
+        if (obj->Class == UClass::StaticClass() &&
+            !(obj->ObjectFlags & (QWORD)EObjectFlags::RF_ClassDefaultObject))
+        {
+            Add(obj);
+            numClasses++;
+        }
+    }
+
+    // Filling a record can add more objects (outers, fields, referenced types),
+    // so keep going until everything reachable is filled
+    for (size_t i = 0; i < Objects.size(); i++)
+    {
+        Fill(Objects[i], (uint32_t)i);
+    }
+
+    return Builder.Build(numClasses);
+}
+
+uint32_t SnapshotDumper::Add(const UObject* obj)
+{
+    if (!obj)
+    {
+        return SNAPSHOT_NONE;
+    }
+
+    if (auto res = ObjectIndices.Find(obj))
+    {
+        return *res;
+    }
+
+    auto objectIndex = Builder.AddObject();
+    ObjectIndices.Set(obj, objectIndex);
+    Objects.push_back(obj);
+    return objectIndex;
+}
+
+uint32_t SnapshotDumper::AddName(const FName& name)
+{
+    auto key = ((uint64_t)(uint32_t)name.Index << 32) | (uint32_t)name.Number;
+    if (auto res = NameIndices.Find(key))
+    {
+        return *res;
+    }
+
+    auto nameIndex = Builder.AddName(name.ToString());
+    NameIndices.Set(key, nameIndex);
+    return nameIndex;
+}
+
+void SnapshotDumper::Fill(const UObject* obj, uint32_t objectIndex)
+{
+    // Work on a copy, since adding objects may move the builder's records
+    auto record = Builder.GetObject(objectIndex);
+    record.Name = AddName(obj->Name);
+    record.ClassName = AddName(obj->Class->Name);
+    record.Outer = Add(obj->Outer);
+
+    vector<uint32_t> list;
+    if (obj->IsA(UClass::StaticClass()))
+    {
+        auto _class = (UClass*)obj;
+        record.Kind = ESnapshotKind::Class;
+        record.Flags = (uint64_t)_class->ClassFlags;
+
+        for (INT i = 0; i < _class->Interfaces.Num; i++)
+        {
+            list.push_back(Add(_class->Interfaces.ElementAt(i).Class));
+        }
+    }
+    else if (obj->IsA(UFunction::StaticClass()))
+    {
+        record.Kind = ESnapshotKind::Function;
+        record.Flags = (uint64_t)((UFunction*)obj)->FunctionFlags;
+    }
+    else if (obj->IsA(UScriptStruct::StaticClass()))
+    {
+        record.Kind = ESnapshotKind::ScriptStruct;
+    }
+    else if (obj->IsA(UStruct::StaticClass()))
+    {
+        record.Kind = ESnapshotKind::Struct;
+    }
+    else if (obj->IsA(UEnum::StaticClass()))
+    {
+        auto _enum = (UEnum*)obj;
+        record.Kind = ESnapshotKind::Enum;
+
+        for (INT i = 0; i < _enum->Names.Num; i++)
+        {
+            list.push_back(AddName(_enum->Names.ElementAt(i)));
+        }
+    }
+    else if (obj->IsA(UProperty::StaticClass()))
+    {
+        auto prop = (UProperty*)obj;
+        record.Kind = ESnapshotKind::Property;
+        record.PropertyKind = prop->GetKind();
+        record.Flags = (uint64_t)prop->PropertyFlags;
+        record.Size = prop->ElementSize;
+        record.Offset = prop->Offset;
+        record.ArrayDim = prop->ArrayDim;
+
+        switch (record.PropertyKind)
+        {
+            case EPropertyKind::Byte:
+                record.Ref = Add(((UByteProperty*)prop)->Enum);
+                break;
+            case EPropertyKind::Bool:
+                record.BitMask = ((UBoolProperty*)prop)->BitMask;
+                break;
+            case EPropertyKind::Struct:
+                record.Ref = Add(((UStructProperty*)prop)->Struct);
+                break;
+            case EPropertyKind::Object:
+            case EPropertyKind::Component:
+            case EPropertyKind::Class:
+            case EPropertyKind::Interface:
+                record.Ref = Add(((UObjectProperty*)prop)->PropertyClass);
+                break;
+            case EPropertyKind::Array:
+                record.Ref = Add(((UArrayProperty*)prop)->Inner);
+                break;
+            default:
+                break;
+        }
+    }
+    else if (obj->IsA(UField::StaticClass()))
+    {
+        record.Kind = ESnapshotKind::Field;
+    }
+    else if (obj->Class->GetPathName() == "Core.Package")
+    {
+        record.Kind = ESnapshotKind::Package;
+    }
+    else
+    {
+        record.Kind = ESnapshotKind::Object;
+    }
+
+    // States aren't printed, so there's no need to capture what's in them
+    if (IsStructKind(record.Kind) && record.Kind != ESnapshotKind::Struct)
+    {
+        auto _struct = (UStruct*)obj;
+        record.Super = Add(_struct->SuperStruct);
+        record.Children = Add(_struct->Children);
+        record.Size = _struct->PropertiesSize;
+    }
+
+    // Sibling links are only walked inside structs, so classes don't need theirs
+    if (IsFieldKind(record.Kind) && record.Kind != ESnapshotKind::Class)
+    {
+        record.Next = Add(((UField*)obj)->Next);
+    }
+
+    Builder.GetObject(objectIndex) = record;
+    if (!list.empty())
+    {
+        Builder.SetList(objectIndex, list);
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Framework/FlatMap.h"
+#include "Framework/Snapshot.h"
+
+class UObject;
+
+// Copies the reflection data of every loaded class out of the live game, through
+// the Engine mirrors, into a snapshot the generator can work from.
+class SnapshotDumper
+{
+public:
+    // Captures all class objects (but not CDOs) in GObjects, along with everything
+    // they reference, and returns the laid out snapshot.
+    vector<char> Capture();
+
+private:
+    uint32_t Add(const UObject* obj);
+    void Fill(const UObject* obj, uint32_t objectIndex);
+    uint32_t AddName(const class FName& name);
+
+    SnapshotBuilder Builder;
+    FlatMap<const UObject*, uint32_t> ObjectIndices;
+    FlatMap<uint64_t, uint32_t> NameIndices;
+
+    // Objects in record order; records are filled in after they're added
+    vector<const UObject*> Objects;
+};
@@ -3,13 +3,6 @@
 #include "UState.h"
 #include "UProperty.h"
 
-enum class EClassFlags : DWORD
-{
-    CLASS_Abstract = 0x1,
-    CLASS_Interface = 0x4000,
-    CLASS_Intrinsic = 0x10000000,
-};
-
 struct FImplementedInterface
 {
     UClass* Class;
@@ -2,46 +2,30 @@
 #include "UObject.h"
 #include "GameFunctions.h"
 #include "UClass.h"
+#include "ClassTree.h"
+#include "Framework/NameCache.h"
 
-string UObject::GetPathName() const
+const string& UObject::GetPathName() const
 {
-    string res = this->GetName();
-    for (auto outer = this->Outer; outer; outer = outer->Outer)
-    {
-        res = (outer->GetName() + "." + res);
-    }
-
-    return res;
-}
-
-string UObject::GetPackageName() const
-{
-    for (auto outer = this->Outer; outer; outer = outer->Outer)
-    {
-        if (outer->Class->GetPathName() == "Core.Package")
+    return NameCache::PathNames.Get(this, [this]
         {
-            return outer->GetName();
-        }
-    }
-
-    return "";
-}
-
-string UObject::GetPackageNameManaged() const
-{
-    string packageName = this->GetPackageName();
-    if (packageName == "Core")
-    {
-        return "BmSDK";
-    }
-
-    return "BmSDK." + packageName;
+            // Outer paths are cached as well, so every level is only built once
+            return this->Outer ? this->Outer->GetPathName() + "." + this->GetName() : this->GetName();
+        });
 }
 
 bool UObject::IsA(class UClass* classObj) const
 {
     if (classObj)
     {
+        // Two compares once the class tree is numbered, otherwise walk the super chain
+        auto classInterval = ClassTree::Find(this->Class);
+        auto otherInterval = ClassTree::Find((UObject*)classObj);
+        if (classInterval && otherInterval)
+        {
+            return classInterval->IsWithin(*otherInterval);
+        }
+
         for (UClass* superClass = (UClass*)(this->Class); superClass;
             superClass = (UClass*)(superClass->SuperStruct))
         {
@@ -1,16 +1,12 @@
 #pragma once
 
+#include "EngineFlags.h"
 #include "FName.h"
 
 // NOTE: May need to change for 64-bit.
 #define PROPERTY_ALIGNMENT 4
 #pragma pack(push, PROPERTY_ALIGNMENT)
 
-enum class EObjectFlags : QWORD
-{
-    RF_ClassDefaultObject = 0x80
-};
-
 CLASS(UObject, 44)
 class UObject
 {
@@ -34,9 +30,7 @@ public:
     {
         return this->Class->GetName() + " " + this->GetPathName();
     };
-    string GetPathName() const;
-    string GetPackageName() const;
-    string GetPackageNameManaged() const;
+    const string& GetPathName() const;
 
     bool IsA(class UClass* classObj) const;
 
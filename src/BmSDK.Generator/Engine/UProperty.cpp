@@ -1,122 +1,41 @@
 #include "pch.h"
 #include "UProperty.h"
 #include "UClass.h"
-#include "UEnum.h"
-#include "Framework/ClassInfo.h"
+#include "Framework/FlatMap.h"
 
-string UProperty::GetInnerTypeNameManaged() const
+EPropertyKind UProperty::GetKind() const
 {
-    if (GetPathName() == "Core.Object.ObjectFlags")
-    {
-        return "BmSDK.GameObject.EObjectFlags";
-    }
-    else if (Class->GetPathName() == "Core.IntProperty")
-    {
-        return "int";
-    }
-    else if (Class->GetPathName() == "Core.ByteProperty")
-    {
-        // Try to use proper type for enums
-        auto byteProp = (UByteProperty*)this;
-        if (byteProp->Enum)
-        {
-            return GetFieldPathNameManaged(byteProp->Enum);
-        }
-
-        return "byte";
-    }
-    else if (Class->GetPathName() == "Core.FloatProperty")
-    {
-        return "float";
-    }
-    else if (Class->GetPathName() == "Core.BoolProperty")
-    {
-        return "bool";
-    }
-    else if (Class->GetPathName() == "Core.StrProperty" ||
-        Class->GetPathName() == "Core.StringProperty")
-    {
-        return "BmSDK.FString";
-    }
-    else if (Class->GetPathName() == "Core.NameProperty")
-    {
-        return "BmSDK.FName";
-    }
-    else if (Class->GetPathName() == "Core.StructProperty")
-    {
-        auto structProp = (UStructProperty*)this;
-        auto _struct = structProp->Struct;
-
-        // Manually swap out some structs
-        if (_struct->GetName() == "Pointer")
-        {
-            return "System.IntPtr";
-        }
-        else if (_struct->GetName() == "Double")
-        {
-            return "double";
-        }
-        else if (_struct->GetName() == "QWord")
-        {
-            return "ulong";
-        }
-        else if (_struct->GetName() == "Vector")
-        {
-            return "System.Numerics.Vector3";
-        }
-        else if (_struct->GetName() == "Vector4")
-        {
-            return "System.Numerics.Vector4";
-        }
-        else if (_struct->GetName() == "Vector2D")
-        {
-            return "System.Numerics.Vector2";
-        }
-        else if (_struct->GetName() == "Rotator")
-        {
-            return "BmSDK.Rotator";
-        }
-
-        return GetFieldPathNameManaged(_struct);
-    }
-    else if (Class->GetPathName() == "Core.ObjectProperty" ||
-        Class->GetPathName() == "Core.ComponentProperty" ||
-        Class->GetPathName() == "Core.ClassProperty" ||
-        Class->GetPathName() == "Core.InterfaceProperty")
-    {
-        auto objectProp = (UObjectProperty*)this;
-        return GetFieldPathNameManaged(objectProp->PropertyClass);
-    }
-    else if (Class->GetPathName() == "Core.ArrayProperty")
-    {
-        auto arrayProp = (UArrayProperty*)this;
-        auto innerName = arrayProp->Inner->GetInnerTypeNameManaged();
-
-        return "BmSDK.TArray<" + innerName + ">";
-    }
-    else if (Class->GetPathName() == "Core.MapProperty")
-    {
-        return "BmSDK.TMap<object, object> /* TODO */";
-    }
-    else if (Class->GetPathName() == "Core.DelegateProperty")
-    {
-        return "System.IntPtr";
-    }
-
-    return "UNKNOWN";
-}
-
-bool UProperty::ShouldReturnByRef() const
-{
-    if (!IsA(UStructProperty::StaticClass()))
-    {
-        return false;
-    }
-
-    auto managedTypeName = GetInnerTypeNameManaged();
-
-    // Omit UE3 structs that are actually generated
-    // as non-struct C# types (see GetInnerTypeNameManaged above).
-    return managedTypeName != "System.IntPtr" && managedTypeName != "double"
-        && managedTypeName != "ulong";
+    static FlatMap<const UObject*, EPropertyKind> kindsByClass;
+    if (kindsByClass.Num() == 0)
+    {
+        // Property classes are only looked up once; everything after is a pointer compare
+        pair<UClass*, EPropertyKind> kinds[] = {
+            { UIntProperty::StaticClass(), EPropertyKind::Int },
+            { UByteProperty::StaticClass(), EPropertyKind::Byte },
+            { UFloatProperty::StaticClass(), EPropertyKind::Float },
+            { UBoolProperty::StaticClass(), EPropertyKind::Bool },
+            { UStrProperty::StaticClass(), EPropertyKind::Str },
+            { UObject::FindClass("Core.StringProperty"), EPropertyKind::Str },
+            { UNameProperty::StaticClass(), EPropertyKind::Name },
+            { UStructProperty::StaticClass(), EPropertyKind::Struct },
+            { UObjectProperty::StaticClass(), EPropertyKind::Object },
+            { UComponentProperty::StaticClass(), EPropertyKind::Component },
+            { UClassProperty::StaticClass(), EPropertyKind::Class },
+            { UInterfaceProperty::StaticClass(), EPropertyKind::Interface },
+            { UArrayProperty::StaticClass(), EPropertyKind::Array },
+            { UMapProperty::StaticClass(), EPropertyKind::Map },
+            { UDelegateProperty::StaticClass(), EPropertyKind::Delegate },
+        };
+
+        for (auto& [propClass, kind] : kinds)
+        {
+            if (propClass)
+            {
+                kindsByClass.Set(propClass, kind);
+            }
+        }
+    }
+
+    auto res = kindsByClass.Find(Class);
+    return res ? *res : EPropertyKind::Unknown;
 }
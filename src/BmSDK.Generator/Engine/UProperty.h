@@ -2,14 +2,6 @@
 
 #include "UField.h"
 
-enum class EPropertyFlags : DWORD
-{
-    CPF_Parm = 0x8,
-    CPF_OptionalParm = 0x10,
-    CPF_OutParm = 0x20,
-    CPF_ReturnParm = 0x80
-};
-
 CLASS(UProperty, 88)
 class UProperty : public UField
 {
@@ -21,11 +13,46 @@ class UProperty : public UField
     BYTE UNK2[24];
 
 public:
-    string GetInnerTypeNameManaged() const;
-    bool ShouldReturnByRef() const;
+    EPropertyKind GetKind() const;
     STATIC_CLASS("Core.Property")
 };
 
+class UIntProperty : public UProperty
+{
+public:
+    STATIC_CLASS("Core.IntProperty")
+};
+
+class UFloatProperty : public UProperty
+{
+public:
+    STATIC_CLASS("Core.FloatProperty")
+};
+
+class UStrProperty : public UProperty
+{
+public:
+    STATIC_CLASS("Core.StrProperty")
+};
+
+class UNameProperty : public UProperty
+{
+public:
+    STATIC_CLASS("Core.NameProperty")
+};
+
+class UMapProperty : public UProperty
+{
+public:
+    STATIC_CLASS("Core.MapProperty")
+};
+
+class UDelegateProperty : public UProperty
+{
+public:
+    STATIC_CLASS("Core.DelegateProperty")
+};
+
 CLASS(UStructProperty, 92)
 class UStructProperty : public UProperty
 {
@@ -44,6 +71,24 @@ public:
     STATIC_CLASS("Core.ObjectProperty")
 };
 
+class UComponentProperty : public UObjectProperty
+{
+public:
+    STATIC_CLASS("Core.ComponentProperty")
+};
+
+class UClassProperty : public UObjectProperty
+{
+public:
+    STATIC_CLASS("Core.ClassProperty")
+};
+
+class UInterfaceProperty : public UObjectProperty
+{
+public:
+    STATIC_CLASS("Core.InterfaceProperty")
+};
+
 CLASS(UByteProperty, 92)
 class UByteProperty : public UProperty
 {
@@ -0,0 +1,47 @@
+#include "pch.h"
+#include "Arena.h"
+
+#include <cstring>
+
+void* Arena::Allocate(size_t size, size_t alignment)
+{
+    auto aligned = (char*)(((uintptr_t)Cursor + alignment - 1) & ~(uintptr_t)(alignment - 1));
+    if (!Cursor || aligned + size > End)
+    {
+        // Oversized requests get a block of their own
+        auto blockSize = size + alignment > BlockSize ? size + alignment : BlockSize;
+        Blocks.push_back(std::make_unique_for_overwrite<char[]>(blockSize));
+        NumBytesReserved += blockSize;
+
+        Cursor = Blocks.back().get();
+        End = Cursor + blockSize;
+        aligned = (char*)(((uintptr_t)Cursor + alignment - 1) & ~(uintptr_t)(alignment - 1));
+    }
+
+    Cursor = aligned + size;
+    NumBytesUsed += size;
+    return aligned;
+}
+
+string_view Arena::Intern(string_view str)
+{
+    if (auto res = Interned.Find(str))
+    {
+        return *res;
+    }
+
+    auto data = (char*)Allocate(str.size(), 1);
+    memcpy(data, str.data(), str.size());
+
+    auto res = string_view(data, str.size());
+    Interned.Set(res, res);
+    return res;
+}
+
+void Arena::Reset()
+{
+    Blocks.clear();
+    Interned.Clear();
+    Cursor = End = nullptr;
+    NumBytesUsed = NumBytesReserved = 0;
+}
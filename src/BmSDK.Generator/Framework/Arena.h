@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <type_traits>
+#include "FlatMap.h"
+
+// Bump allocator for data that lives for a whole generation run. Everything is
+// released at once by Reset(), so only trivially destructible types may go in here.
+class Arena
+{
+public:
+	Arena(size_t blockSize = 1 << 20) : BlockSize(blockSize) {}
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+
+	void* Allocate(size_t size, size_t alignment);
+
+	template <typename T, typename... TArgs> T* New(TArgs&&... args)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "Arena types are never destroyed");
+		return new (Allocate(sizeof(T), alignof(T))) T(std::forward<TArgs>(args)...);
+	}
+
+	// Copies the given items into a single arena allocation.
+	template <typename T> std::span<const T> CopyArray(std::span<const T> items)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "Arena types are never destroyed");
+		if (items.empty())
+		{
+			return {};
+		}
+
+		auto res = (T*)Allocate(items.size_bytes(), alignof(T));
+		std::uninitialized_copy(items.begin(), items.end(), res);
+		return { res, items.size() };
+	}
+
+	// Returns an arena-owned copy of str, shared with every earlier identical string.
+	string_view Intern(string_view str);
+
+	// Frees every block at once. Pointers and views handed out before are invalidated.
+	void Reset();
+
+	size_t BytesUsed() const { return NumBytesUsed; }
+	size_t BytesReserved() const { return NumBytesReserved; }
+
+private:
+	size_t BlockSize;
+	vector<std::unique_ptr<char[]>> Blocks;
+	char* Cursor = nullptr;
+	char* End = nullptr;
+	size_t NumBytesUsed = 0;
+	size_t NumBytesReserved = 0;
+	FlatMap<string_view, string_view> Interned;
+};
@@ -0,0 +1,47 @@
+#include "pch.h"
+#include "ClassIndex.h"
+#include "ClassInfo.h"
+
+void ClassIndex::Build(vector<ClassInfo>& classes)
+{
+    ByClass.Clear();
+    ByPath.Clear();
+    ByClass.Reserve(classes.size());
+    ByPath.Reserve(classes.size());
+
+    for (auto& _class : classes)
+    {
+        ByClass.Set(_class.Class, &_class);
+        ByPath.Set(_class.PathName, &_class);
+    }
+}
+
+ClassInfo* ClassIndex::Find(const SnapshotObject* classObj) const
+{
+    auto res = ByClass.Find(classObj);
+    return res ? *res : nullptr;
+}
+
+ClassInfo* ClassIndex::Find(string_view pathName) const
+{
+    auto res = ByPath.Find(pathName);
+    return res ? *res : nullptr;
+}
+
+void ClassIndex::NumberTree(vector<ClassInfo>& classes)
+{
+    vector<uint32_t> parents(classes.size(), TREE_NO_PARENT);
+    for (size_t i = 0; i < classes.size(); i++)
+    {
+        if (auto super = classes[i].Super)
+        {
+            parents[i] = (uint32_t)(super - classes.data());
+        }
+    }
+
+    auto intervals = ::NumberTree(parents);
+    for (size_t i = 0; i < classes.size(); i++)
+    {
+        classes[i].Tree = intervals[i];
+    }
+}
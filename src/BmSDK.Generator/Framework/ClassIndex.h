@@ -0,0 +1,24 @@
+#pragma once
+
+#include "FlatMap.h"
+
+struct ClassInfo;
+
+// Lookup tables over all collected classes, built once after the GObjects scan.
+// Keys point into the ClassInfo array, which must not be resized afterwards.
+class ClassIndex
+{
+public:
+	void Build(vector<ClassInfo>& classes);
+
+	// Numbers the class tree depth-first, so ClassInfo::IsA is two compares.
+	// Supers must be resolved first.
+	static void NumberTree(vector<ClassInfo>& classes);
+
+	ClassInfo* Find(const struct SnapshotObject* classObj) const;
+	ClassInfo* Find(string_view pathName) const;
+
+private:
+	FlatMap<const struct SnapshotObject*, ClassInfo*> ByClass;
+	FlatMap<string_view, ClassInfo*> ByPath;
+};
@@ -1,176 +1,379 @@
 #include "pch.h"
 #include "ClassInfo.h"
-#include "Engine/UClass.h"
-#include "Engine/UEnum.h"
-#include "Engine/UFunction.h"
-#include "Engine/UProperty.h"
+#include "Arena.h"
+#include "ClassIndex.h"
+#include "NameCache.h"
 
 #include <map>
 
-string GetFieldNameManaged(UField* field)
+struct FStructOverride
 {
+    string_view StructName;
+    string_view ManagedTypeName;
+
+    // Whether the managed type is still a struct (and can be returned by ref)
+    bool IsStruct;
+
+    // Size of the managed type in bytes (x86)
+    int32_t ManagedSize;
+};
+
+// UE3 structs that are swapped out for built-in managed types
+static constexpr FStructOverride StructOverrides[] = {
+    { "Pointer", "System.IntPtr", false, 4 },
+    { "Double", "double", false, 8 },
+    { "QWord", "ulong", false, 8 },
+    { "Vector", "System.Numerics.Vector3", true, 12 },
+    { "Vector4", "System.Numerics.Vector4", true, 16 },
+    { "Vector2D", "System.Numerics.Vector2", true, 8 },
+    { "Rotator", "BmSDK.Rotator", true, 12 },
+};
+
+static const FStructOverride* FindStructOverride(const Snapshot& snapshot, const SnapshotObject* _struct)
+{
+    auto name = _struct ? snapshot.GetName(_struct->Name) : string_view();
+    for (auto& structOverride : StructOverrides)
+    {
+        if (structOverride.StructName == name)
+        {
+            return &structOverride;
+        }
+    }
+
+    return nullptr;
+}
+
+static const SnapshotObject& GetObjectChecked(const Snapshot& snapshot, uint32_t objectIndex)
+{
+    auto obj = snapshot.GetObject(objectIndex);
+    ASSERT(obj);
+    return *obj;
+}
+
+static const string& GetPathName(const Snapshot& snapshot, const SnapshotObject& obj)
+{
+    return NameCache::PathNames.Get(&obj, [&]
+        {
+            // Outer paths are cached as well, so every level is only built once
+            auto outer = snapshot.GetObject(obj.Outer);
+            auto name = string(snapshot.GetName(obj.Name));
+            return outer ? GetPathName(snapshot, *outer) + "." + name : name;
+        });
+}
+
+static string_view GetPackageName(const Snapshot& snapshot, const SnapshotObject& obj)
+{
+    for (auto outer = snapshot.GetObject(obj.Outer); outer; outer = snapshot.GetObject(outer->Outer))
+    {
+        if (outer->Kind == ESnapshotKind::Package)
+        {
+            return snapshot.GetName(outer->Name);
+        }
+    }
+
+    return "";
+}
+
+static string GetPackageNameManaged(const Snapshot& snapshot, const SnapshotObject& obj)
+{
+    auto packageName = GetPackageName(snapshot, obj);
+    if (packageName == "Core")
+    {
+        return "BmSDK";
+    }
+
+    return "BmSDK." + string(packageName);
+}
+
+static string ComputeFieldNameManaged(const Snapshot& snapshot, const SnapshotObject& field)
+{
+    auto name = string(snapshot.GetName(field.Name));
+    auto outer = snapshot.GetObject(field.Outer);
+
     // Manually rename some classes to avoid conflicts with the System namespace
-    if (field->GetPathName() == "Core.Object")
+    auto& pathName = GetPathName(snapshot, field);
+    if (pathName == "Core.Object")
     {
         return "GameObject";
     }
-    else if (field->GetPathName() == "Core.System")
+    else if (pathName == "Core.System")
     {
         return "_System";
     }
-    else if (field->GetPathName() == "Engine.Console")
+    else if (pathName == "Engine.Console")
     {
         return "_Console";
     }
 
-    if (field->IsA(UScriptStruct::StaticClass()))
+    if (field.Kind == ESnapshotKind::ScriptStruct)
     {
-        return "F" + field->GetName();
+        return "F" + name;
     }
 
     // Workaround fields with same name as their outer
-    if (field->Outer && field->GetName() == field->Outer->GetName())
+    if (outer && name == snapshot.GetName(outer->Name))
     {
-        return "_" + field->GetName();
+        return "_" + name;
     }
 
     // Ensure that every function override will have the same name
-    if (field->IsA(UFunction::StaticClass()))
+    if (field.Kind == ESnapshotKind::Function)
     {
-        auto func = (UFunction*)field;
-        if (func->SuperStruct)
+        if (auto super = snapshot.GetObject(field.Super))
         {
-            return GetFieldNameManaged((UField*)func->SuperStruct);
+            return GetFieldNameManaged(snapshot, *super);
         }
     }
 
     // De-duplicate prop names for structs and functions
-    if (field->Outer && field->IsA(UProperty::StaticClass()) &&
-        (field->Outer->IsA(UFunction::StaticClass()) ||
-            field->Outer->IsA(UScriptStruct::StaticClass())))
+    if (outer && field.Kind == ESnapshotKind::Property &&
+        (outer->Kind == ESnapshotKind::Function || outer->Kind == ESnapshotKind::ScriptStruct))
     {
         int numDuplicates = 0;
-        auto propLink = ((UStruct*)field->Outer)->Children;
-        while (propLink && propLink != field)
+        auto propLink = snapshot.GetObject(outer->Children);
+        while (propLink && propLink != &field)
         {
-            if (propLink->GetName() == field->GetName())
+            if (propLink->Name == field.Name)
             {
                 numDuplicates++;
             }
 
-            propLink = propLink->Next;
+            propLink = snapshot.GetObject(propLink->Next);
         }
 
         if (numDuplicates > 0)
         {
-            return field->GetName() + "_" + to_string(numDuplicates);
+            return name + "_" + to_string(numDuplicates);
         }
     }
 
-    return field->GetName();
+    return name;
 }
 
-string GetFieldPathNameManaged(UField* field)
+static string ComputeFieldPathNameManaged(const Snapshot& snapshot, const SnapshotObject& field)
 {
-    auto managedName = GetFieldNameManaged(field);
+    auto& managedName = GetFieldNameManaged(snapshot, field);
 
-    if (field->IsA(UClass::StaticClass()))
+    if (field.Kind == ESnapshotKind::Class)
     {
-        return field->GetPackageNameManaged() + "." + managedName;
+        return GetPackageNameManaged(snapshot, field) + "." + managedName;
     }
 
-    if (field->Outer && field->Outer->IsA(UField::StaticClass()))
+    auto outer = snapshot.GetObject(field.Outer);
+    if (outer && IsFieldKind(outer->Kind))
     {
-        return GetFieldPathNameManaged((UField*)field->Outer) + "." + managedName;
+        return GetFieldPathNameManaged(snapshot, *outer) + "." + managedName;
     }
 
     return managedName;
 }
 
-PropertyInfo::PropertyInfo(UProperty* prop, bool isInStruct)
+const string& GetFieldNameManaged(const Snapshot& snapshot, const SnapshotObject& field)
+{
+    return NameCache::FieldNamesManaged.Get(&field, [&] { return ComputeFieldNameManaged(snapshot, field); });
+}
+
+const string& GetFieldPathNameManaged(const Snapshot& snapshot, const SnapshotObject& field)
+{
+    return NameCache::FieldPathNamesManaged.Get(&field, [&] { return ComputeFieldPathNameManaged(snapshot, field); });
+}
+
+static const string& GetPropertyTypeNameManaged(const Snapshot& snapshot, const SnapshotObject& prop)
+{
+    return NameCache::PropertyTypeNames.Get(&prop, [&]() -> string
+        {
+            if (GetPathName(snapshot, prop) == "Core.Object.ObjectFlags")
+            {
+                return "BmSDK.GameObject.EObjectFlags";
+            }
+
+            auto ref = snapshot.GetObject(prop.Ref);
+            switch (prop.PropertyKind)
+            {
+                case EPropertyKind::Int:
+                    return "int";
+                case EPropertyKind::Byte:
+                    // Try to use proper type for enums
+                    return ref ? GetFieldPathNameManaged(snapshot, *ref) : "byte";
+                case EPropertyKind::Float:
+                    return "float";
+                case EPropertyKind::Bool:
+                    return "bool";
+                case EPropertyKind::Str:
+                    return "BmSDK.FString";
+                case EPropertyKind::Name:
+                    return "BmSDK.FName";
+                case EPropertyKind::Struct:
+                    if (auto structOverride = FindStructOverride(snapshot, ref))
+                    {
+                        return string(structOverride->ManagedTypeName);
+                    }
+
+                    return ref ? GetFieldPathNameManaged(snapshot, *ref) : "UNKNOWN";
+                case EPropertyKind::Object:
+                case EPropertyKind::Component:
+                case EPropertyKind::Class:
+                case EPropertyKind::Interface:
+                    return ref ? GetFieldPathNameManaged(snapshot, *ref) : "UNKNOWN";
+                case EPropertyKind::Array:
+                    return "BmSDK.TArray<" + (ref ? GetPropertyTypeNameManaged(snapshot, *ref) : "UNKNOWN") + ">";
+                case EPropertyKind::Map:
+                    return "BmSDK.TMap<object, object> /* TODO */";
+                case EPropertyKind::Delegate:
+                    return "System.IntPtr";
+                default:
+                    return "UNKNOWN";
+            }
+        });
+}
+
+static bool ShouldPropertyReturnByRef(const Snapshot& snapshot, const SnapshotObject& prop)
+{
+    if (prop.PropertyKind != EPropertyKind::Struct)
+    {
+        return false;
+    }
+
+    // Omit UE3 structs that are actually generated as non-struct C# types
+    auto structOverride = FindStructOverride(snapshot, snapshot.GetObject(prop.Ref));
+    return !structOverride || structOverride->IsStruct;
+}
+
+// Size in bytes of the managed type printed for a property, or 0 if it isn't known
+// statically (marshalled types, or types the generator doesn't print itself)
+static int32_t GetManagedSize(const Snapshot& snapshot, const SnapshotObject& prop)
+{
+    if (GetPathName(snapshot, prop) == "Core.Object.ObjectFlags")
+    {
+        // BmSDK.GameObject.EObjectFlags : ulong
+        return 8;
+    }
+
+    switch (prop.PropertyKind)
+    {
+        case EPropertyKind::Int:
+        case EPropertyKind::Float:
+            return 4;
+        case EPropertyKind::Byte:
+            // Plain byte, or an enum printed with a byte underlying type
+            return 1;
+        case EPropertyKind::Name:
+            // BmSDK.FName is Index + Number
+            return 8;
+        case EPropertyKind::Str:
+            // BmSDK.FString is Data + Num + Max
+            return 12;
+        case EPropertyKind::Struct:
+        {
+            auto ref = snapshot.GetObject(prop.Ref);
+            if (auto structOverride = FindStructOverride(snapshot, ref))
+            {
+                return structOverride->ManagedSize;
+            }
+
+            // Printed with [StructLayout(Size = ...)] from the struct's own size
+            return ref ? ref->Size : 0;
+        }
+        default:
+            return 0;
+    }
+}
+
+PropertyInfo::PropertyInfo(const Snapshot& snapshot, const SnapshotObject& prop, bool isInStruct)
 {
-    Name = prop->GetName();
-    ManagedName = GetFieldNameManaged(prop);
-    TypeName = prop->GetInnerTypeNameManaged();
-    ClassName = prop->Class->GetName();
-    ArrayDim = prop->ArrayDim;
-    Offset = prop->Offset;
-    ElementSize = prop->ElementSize;
-    Flags = (uint64_t)prop->PropertyFlags;
+    Name = snapshot.GetName(prop.Name);
+    ManagedName = GetFieldNameManaged(snapshot, prop);
+    TypeName = GetPropertyTypeNameManaged(snapshot, prop);
+    ClassName = snapshot.GetName(prop.ClassName);
+    ArrayDim = prop.ArrayDim;
+    Offset = prop.Offset;
+    ElementSize = prop.Size;
+    ManagedSize = GetManagedSize(snapshot, prop);
+    Flags = prop.Flags;
     IsInStruct = isInStruct;
-    IsBool = prop->IsA(UBoolProperty::StaticClass());
+    Kind = prop.PropertyKind;
+    IsBool = Kind == EPropertyKind::Bool;
     IsParam = Flags & (uint64_t)EPropertyFlags::CPF_Parm;
     IsOptionalParam = Flags & (uint64_t)EPropertyFlags::CPF_OptionalParm;
     IsOutParam = Flags & (uint64_t)EPropertyFlags::CPF_OutParm;
     IsReturnParam = Flags & (uint64_t)EPropertyFlags::CPF_ReturnParm;
-    ShouldReturnByRef = prop->ShouldReturnByRef() && !IsInStruct;
+    ShouldReturnByRef = ShouldPropertyReturnByRef(snapshot, prop) && !IsInStruct;
 
     if (IsBool)
     {
-        BitMask = ((UBoolProperty*)prop)->BitMask;
+        BitMask = prop.BitMask;
     }
 }
 
-StructInfo::StructInfo(UStruct* _struct)
+StructInfo::StructInfo(const Snapshot& snapshot, const SnapshotObject& _struct)
 {
-    ManagedName = GetFieldNameManaged(_struct);
-    PropertiesSize = _struct->PropertiesSize;
+    ManagedName = GetFieldNameManaged(snapshot, _struct);
+    PropertiesSize = _struct.Size;
 }
 
-StructInfo::StructInfo(UScriptStruct* _struct) : StructInfo((UStruct*)_struct)
+StructInfo::StructInfo(const Snapshot& snapshot, const SnapshotObject& _struct, Arena& arena)
+    : StructInfo(snapshot, _struct)
 {
-    for (auto field = _struct->Children; field; field = field->Next)
+    vector<MemberRef> members;
+    for (auto field = snapshot.GetObject(_struct.Children); field; field = snapshot.GetObject(field->Next))
     {
-        if (field->IsA(UProperty::StaticClass()))
+        if (field->Kind == ESnapshotKind::Property)
         {
-            Members.push_back(new PropertyInfo((UProperty*)field, true));
+            members.push_back(arena.New<PropertyInfo>(snapshot, *field, true));
         }
     }
+
+    Members = arena.CopyArray<MemberRef>(members);
 }
 
-EnumInfo::EnumInfo(UEnum* _enum)
+EnumInfo::EnumInfo(const Snapshot& snapshot, const SnapshotObject& _enum, Arena& arena)
 {
-    Name = _enum->GetName();
-    ManagedName = GetFieldNameManaged(_enum);
+    Name = snapshot.GetName(_enum.Name);
+    ManagedName = GetFieldNameManaged(snapshot, _enum);
 
-    map<string, int> enumNameFreqs;
-    for (auto i = 0; i < _enum->Names.Num; i++)
+    map<string_view, int> enumNameFreqs;
+    vector<string_view> names;
+    for (auto nameIndex : snapshot.GetList(_enum))
     {
-        auto name = _enum->Names.ElementAt(i).ToString();
+        auto name = snapshot.GetName(nameIndex);
         enumNameFreqs[name]++;
 
         if (enumNameFreqs[name] > 1)
         {
-            Names.push_back(name + "_" + to_string(enumNameFreqs[name]));
+            names.push_back(arena.Intern(string(name) + "_" + to_string(enumNameFreqs[name])));
         }
         else
         {
-            Names.push_back(name);
+            names.push_back(name);
         }
     }
+
+    Names = arena.CopyArray<string_view>(names);
 }
 
-FunctionInfo::FunctionInfo(UFunction* func)
+FunctionInfo::FunctionInfo(const Snapshot& snapshot, const SnapshotObject& func, Arena& arena)
 {
-    Name = func->GetName();
-    ManagedName = GetFieldNameManaged(func);
-    PathName = func->GetPathName();
-    PropertiesSize = func->PropertiesSize;
-    Flags = (uint32_t)func->FunctionFlags;
+    auto super = snapshot.GetObject(func.Super);
+
+    Name = snapshot.GetName(func.Name);
+    ManagedName = GetFieldNameManaged(snapshot, func);
+    PathName = GetPathName(snapshot, func);
+    PropertiesSize = func.Size;
+    Flags = (uint32_t)func.Flags;
     IsStatic = Flags & (uint32_t)EFunctionFlags::FUNC_Static;
     IsNative = Flags & (uint32_t)EFunctionFlags::FUNC_Native;
     IsPrivate = Flags & (uint32_t)EFunctionFlags::FUNC_Private;
-    IsOverride = func->SuperStruct && func->SuperStruct->IsA(UFunction::StaticClass());
+    IsOverride = super && super->Kind == ESnapshotKind::Function;
 
-    for (auto field = func->Children; field; field = field->Next)
+    vector<PropertyInfo> params;
+    for (auto field = snapshot.GetObject(func.Children); field; field = snapshot.GetObject(field->Next))
     {
-        if (!field->IsA(UProperty::StaticClass()))
+        if (field->Kind != ESnapshotKind::Property)
         {
             continue;
         }
 
-        auto prop = (UProperty*)field;
-        auto propInfo = PropertyInfo(prop, false);
+        auto propInfo = PropertyInfo(snapshot, *field, false);
         if (propInfo.IsReturnParam)
         {
             ReturnParam = propInfo;
@@ -178,10 +381,12 @@ FunctionInfo::FunctionInfo(UFunction* func)
         }
         else if (propInfo.IsParam)
         {
-            Params.push_back(propInfo);
+            params.push_back(propInfo);
         }
     }
 
+    Params = arena.CopyArray<PropertyInfo>(params);
+
     for (auto& param : Params)
     {
         if (param.IsOptionalParam && param.IsOutParam)
@@ -192,74 +397,65 @@ FunctionInfo::FunctionInfo(UFunction* func)
     }
 }
 
-ClassInfo::ClassInfo(UClass* _class) : StructInfo((UStruct*)_class)
+ClassInfo::ClassInfo(const Snapshot& snapshot, const SnapshotObject& _class, Arena& arena)
+    : StructInfo(snapshot, _class)
 {
-    Class = _class;
-    SuperClass = (UClass*)_class->SuperStruct;
-    Name = _class->GetName();
-    PathName = _class->GetPathName();
-    PackageName = _class->GetPackageName();
-    PackageNameManaged = _class->GetPackageNameManaged();
-    Flags = (uint32_t)_class->ClassFlags;
+    Class = &_class;
+    SuperClass = snapshot.GetObject(_class.Super);
+    Name = snapshot.GetName(_class.Name);
+    PathName = GetPathName(snapshot, _class);
+    PackageName = GetPackageName(snapshot, _class);
+    PackageNameManaged = arena.Intern(GetPackageNameManaged(snapshot, _class));
+    Flags = (uint32_t)_class.Flags;
     IsAbstract = Flags & (uint32_t)EClassFlags::CLASS_Abstract;
     IsInterface = Flags & (uint32_t)EClassFlags::CLASS_Interface;
     IsIntrinsic = Flags & (uint32_t)EClassFlags::CLASS_Intrinsic;
 
-    for (auto super = _class->SuperStruct; super; super = super->SuperStruct)
+    vector<string_view> interfaces;
+    for (auto interfaceIndex : snapshot.GetList(_class))
     {
-        if (super->GetPathName() == "Engine.Actor")
-        {
-            IsActor = true;
-            break;
-        }
+        interfaces.push_back(GetFieldPathNameManaged(snapshot, GetObjectChecked(snapshot, interfaceIndex)));
     }
 
-    for (int i = 0; i < _class->Interfaces.Num; i++)
-    {
-        Interfaces.push_back(GetFieldPathNameManaged(_class->Interfaces.ElementAt(i).Class));
-    }
+    Interfaces = arena.CopyArray<string_view>(interfaces);
 
-    for (auto field = _class->Children; field; field = field->Next)
+    vector<MemberRef> members;
+    for (auto field = snapshot.GetObject(_class.Children); field; field = snapshot.GetObject(field->Next))
     {
-        if (field->IsA(UProperty::StaticClass()))
+        if (field->Kind == ESnapshotKind::Property)
         {
-            Members.push_back(new PropertyInfo((UProperty*)field, false));
+            members.push_back(arena.New<PropertyInfo>(snapshot, *field, false));
         }
-        else if (field->IsA(UScriptStruct::StaticClass()))
+        else if (field->Kind == ESnapshotKind::ScriptStruct)
         {
-            Members.push_back(new StructInfo((UScriptStruct*)field));
+            members.push_back(arena.New<StructInfo>(snapshot, *field, arena));
         }
-        else if (field->IsA(UEnum::StaticClass()))
+        else if (field->Kind == ESnapshotKind::Enum)
         {
-            Members.push_back(new EnumInfo((UEnum*)field));
+            members.push_back(arena.New<EnumInfo>(snapshot, *field, arena));
         }
-        else if (field->IsA(UFunction::StaticClass()))
+        else if (field->Kind == ESnapshotKind::Function)
         {
-            auto func = (UFunction*)field;
-            auto flags = (uint32_t)func->FunctionFlags;
+            auto flags = (uint32_t)field->Flags;
             if (flags & ((uint32_t)EFunctionFlags::FUNC_Operator | (uint32_t)EFunctionFlags::FUNC_Iterator))
             {
                 continue;
             }
 
-            Members.push_back(new FunctionInfo(func));
+            members.push_back(arena.New<FunctionInfo>(snapshot, *field, arena));
         }
     }
+
+    Members = arena.CopyArray<MemberRef>(members);
 }
 
-void ClassInfo::ResolveSuper(vector<ClassInfo>& classes)
+void ClassInfo::ResolveSuper(const ClassIndex& index)
 {
-    if (!SuperClass)
-    {
-        return;
-    }
+    Super = index.Find(SuperClass);
+}
 
-    for (auto& _class : classes)
-    {
-        if (_class.Class == SuperClass)
-        {
-            Super = &_class;
-            return;
-        }
-    }
+void ClassInfo::ResolveHierarchyFlags(const ClassIndex& index)
+{
+    auto actorClass = index.Find("Engine.Actor");
+    IsActor = actorClass && actorClass != this && IsA(*actorClass);
 }
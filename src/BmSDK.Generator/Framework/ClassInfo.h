@@ -1,27 +1,64 @@
 #pragma once
 
-string GetFieldNameManaged(class UField* field);
-string GetFieldPathNameManaged(class UField* field);
+#include <span>
+#include "Snapshot.h"
+#include "TreeInterval.h"
 
-struct MemberInfo
+const string& GetFieldNameManaged(const Snapshot& snapshot, const SnapshotObject& field);
+const string& GetFieldPathNameManaged(const Snapshot& snapshot, const SnapshotObject& field);
+
+struct PropertyInfo;
+struct StructInfo;
+struct EnumInfo;
+struct FunctionInfo;
+
+enum class EMemberKind : BYTE
+{
+    Property,
+    Struct,
+    Enum,
+    Function,
+};
+
+// Tagged, non-owning reference to a class or struct member. The members themselves
+// live in the generation arena, so this is all a class needs to hold onto them.
+struct MemberRef
 {
-    virtual ~MemberInfo() = default;
+    MemberRef(const PropertyInfo* prop) : Kind(EMemberKind::Property), Property(prop) {}
+    MemberRef(const StructInfo* _struct) : Kind(EMemberKind::Struct), Struct(_struct) {}
+    MemberRef(const EnumInfo* _enum) : Kind(EMemberKind::Enum), Enum(_enum) {}
+    MemberRef(const FunctionInfo* func) : Kind(EMemberKind::Function), Function(func) {}
+
+    EMemberKind Kind;
+    union
+    {
+        const PropertyInfo* Property;
+        const StructInfo* Struct;
+        const EnumInfo* Enum;
+        const FunctionInfo* Function;
+    };
 };
 
-struct PropertyInfo : MemberInfo
+// NOTE: Strings below are views into the snapshot, the name caches or the generation
+// arena, never owned copies. Keep these types trivially destructible.
+struct PropertyInfo
 {
     PropertyInfo() = default;
-    PropertyInfo(class UProperty* prop, bool isInStruct);
+    PropertyInfo(const Snapshot& snapshot, const SnapshotObject& prop, bool isInStruct);
 
-    string Name;
-    string ManagedName;
-    string TypeName;
-    string ClassName;
+    string_view Name;
+    string_view ManagedName;
+    string_view TypeName;
+    string_view ClassName;
     int32_t ArrayDim = 0;
     int32_t Offset = 0;
     int32_t ElementSize = 0;
+    // Size of the managed type, 0 if unknown. Only equal to ElementSize when the
+    // managed value can alias the engine's memory directly.
+    int32_t ManagedSize = 0;
     int32_t BitMask = 0;
     uint64_t Flags = 0;
+    EPropertyKind Kind = {};
     bool IsInStruct = false;
     bool IsBool = false;
     bool IsParam = false;
@@ -31,35 +68,35 @@ struct PropertyInfo : MemberInfo
     bool ShouldReturnByRef = false;
 };
 
-struct StructInfo : MemberInfo
+struct StructInfo
 {
     StructInfo() = default;
-    StructInfo(class UStruct* _struct);
-    StructInfo(class UScriptStruct* _struct);
+    StructInfo(const Snapshot& snapshot, const SnapshotObject& _struct);
+    StructInfo(const Snapshot& snapshot, const SnapshotObject& _struct, class Arena& arena);
 
-    string ManagedName;
+    string_view ManagedName;
     int32_t PropertiesSize = 0;
-    vector<MemberInfo*> Members;
+    span<const MemberRef> Members;
 };
 
-struct EnumInfo : MemberInfo
+struct EnumInfo
 {
     EnumInfo() = default;
-    EnumInfo(class UEnum* _enum);
+    EnumInfo(const Snapshot& snapshot, const SnapshotObject& _enum, class Arena& arena);
 
-    string Name;
-    string ManagedName;
-    vector<string> Names;
+    string_view Name;
+    string_view ManagedName;
+    span<const string_view> Names;
 };
 
-struct FunctionInfo : MemberInfo
+struct FunctionInfo
 {
     FunctionInfo() = default;
-    FunctionInfo(class UFunction* func);
+    FunctionInfo(const Snapshot& snapshot, const SnapshotObject& func, class Arena& arena);
 
-    string Name;
-    string ManagedName;
-    string PathName;
+    string_view Name;
+    string_view ManagedName;
+    string_view PathName;
     int32_t PropertiesSize = 0;
     uint32_t Flags = 0;
     bool IsStatic = false;
@@ -69,26 +106,31 @@ struct FunctionInfo : MemberInfo
     bool ShouldSuppressOptional = false;
     bool HasReturnParam = false;
     PropertyInfo ReturnParam;
-    vector<PropertyInfo> Params;
+    span<const PropertyInfo> Params;
 };
 
 struct ClassInfo : StructInfo
 {
     ClassInfo() = default;
-    ClassInfo(class UClass* _class);
-    void ResolveSuper(vector<ClassInfo>& classes);
-
-    string Name;
-    string PathName;
-    string PackageName;
-    string PackageNameManaged;
-    class UClass* Class = nullptr;
-    class UClass* SuperClass = nullptr;
+    ClassInfo(const Snapshot& snapshot, const SnapshotObject& _class, class Arena& arena);
+    void ResolveSuper(const class ClassIndex& index);
+
+    // Needs the class tree to be numbered (see ClassIndex::NumberTree)
+    void ResolveHierarchyFlags(const class ClassIndex& index);
+    bool IsA(const ClassInfo& other) const { return Tree.IsWithin(other.Tree); }
+
+    string_view Name;
+    string_view PathName;
+    string_view PackageName;
+    string_view PackageNameManaged;
+    const SnapshotObject* Class = nullptr;
+    const SnapshotObject* SuperClass = nullptr;
     ClassInfo* Super = nullptr;
+    TreeInterval Tree;
     uint32_t Flags = 0;
     bool IsAbstract = false;
     bool IsInterface = false;
     bool IsIntrinsic = false;
     bool IsActor = false;
-    vector<string> Interfaces;
+    span<const string_view> Interfaces;
 };
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Debug.h"
 
+#ifdef _WIN32
 static Debug::DebugStream stream;
 
 void Debug::Init()
@@ -8,3 +9,4 @@ void Debug::Init()
     // Redirect stdout to the debug console
     cout.rdbuf(&stream);
 }
+#endif
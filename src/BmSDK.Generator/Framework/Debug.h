@@ -1,7 +1,9 @@
 #pragma once
 
 #include <iostream>
+#ifdef _WIN32
 #include <debugapi.h>
+#endif
 
 // ASSERT() macro.
 #define ASSERT(x)                                                                                  \
@@ -13,13 +15,14 @@
 	}
 
 // TRACE() macro. Used to write output to the debug console.
-#define TRACE(x, ...) std::cout << (std::format("Generator: "##x, __VA_ARGS__) + "\n")
+#define TRACE(...) std::cout << ("Generator: " + std::format(__VA_ARGS__) + "\n")
 
 #undef ERROR
-#define ERROR(x, ...)                                                                              \
-	TRACE(x, __VA_ARGS__);                                                                         \
+#define ERROR(...)                                                                                 \
+	TRACE(__VA_ARGS__);                                                                            \
 	abort();
 
+#ifdef _WIN32
 namespace Debug
 {
 	void Init();
@@ -37,3 +40,4 @@ namespace Debug
 		}
 	};
 }
+#endif
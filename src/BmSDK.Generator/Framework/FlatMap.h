@@ -0,0 +1,124 @@
+#pragma once
+
+#include <string_view>
+#include "Hash.h"
+
+template <typename T> struct FlatMapHash
+{
+	uint64_t operator()(T value) const
+	{
+		// Pointers and integers: murmur3 finalizer, so aligned addresses spread over all slots
+		auto h = (uint64_t)value;
+		h ^= h >> 33;
+		h *= 0xFF51AFD7ED558CCDull;
+		h ^= h >> 33;
+		h *= 0xC4CEB9FE1A85EC53ull;
+		h ^= h >> 33;
+		return h;
+	}
+};
+
+template <> struct FlatMapHash<std::string_view>
+{
+	uint64_t operator()(std::string_view value) const { return Hash::Fnv1a(value); }
+};
+
+// Open-addressing hash map with linear probing over a single flat slot array.
+// Insert-only: entries are never removed, which keeps probing trivial.
+template <typename TKey, typename TValue, typename THash = FlatMapHash<TKey>>
+class FlatMap
+{
+public:
+	void Reserve(size_t count)
+	{
+		// Keep the load factor at or below 1/2
+		size_t capacity = 16;
+		while (capacity < count * 2)
+		{
+			capacity *= 2;
+		}
+
+		if (capacity > Slots.size())
+		{
+			Rehash(capacity);
+		}
+	}
+
+	// Inserts or overwrites the value for the given key.
+	void Set(const TKey& key, const TValue& value)
+	{
+		if ((NumUsed + 1) * 2 > Slots.size())
+		{
+			Rehash(Slots.empty() ? 16 : Slots.size() * 2);
+		}
+
+		auto& slot = Probe(key);
+		if (!slot.Used)
+		{
+			slot.Used = true;
+			slot.Key = key;
+			NumUsed++;
+		}
+
+		slot.Value = value;
+	}
+
+	const TValue* Find(const TKey& key) const
+	{
+		if (Slots.empty())
+		{
+			return nullptr;
+		}
+
+		auto& slot = const_cast<FlatMap*>(this)->Probe(key);
+		return slot.Used ? &slot.Value : nullptr;
+	}
+
+	void Clear()
+	{
+		Slots.clear();
+		NumUsed = 0;
+	}
+
+	size_t Num() const { return NumUsed; }
+
+private:
+	struct Slot
+	{
+		TKey Key{};
+		TValue Value{};
+		bool Used = false;
+	};
+
+	// Returns the slot holding key, or the empty slot where it would go.
+	Slot& Probe(const TKey& key)
+	{
+		auto mask = Slots.size() - 1;
+		for (auto i = THash()(key) & mask;; i = (i + 1) & mask)
+		{
+			auto& slot = Slots[i];
+			if (!slot.Used || slot.Key == key)
+			{
+				return slot;
+			}
+		}
+	}
+
+	void Rehash(size_t capacity)
+	{
+		auto oldSlots = std::move(Slots);
+		Slots.assign(capacity, Slot());
+		NumUsed = 0;
+
+		for (auto& slot : oldSlots)
+		{
+			if (slot.Used)
+			{
+				Set(slot.Key, slot.Value);
+			}
+		}
+	}
+
+	vector<Slot> Slots;
+	size_t NumUsed = 0;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string_view>
+
+namespace Hash
+{
+	constexpr uint64_t FnvOffsetBasis = 0xCBF29CE484222325ull;
+	constexpr uint64_t FnvPrime = 0x100000001B3ull;
+
+	// 64-bit FNV-1a. Cheap, and stable across runs and machines.
+	constexpr uint64_t Fnv1a(std::string_view data, uint64_t hash = FnvOffsetBasis)
+	{
+		for (auto c : data)
+		{
+			hash = (hash ^ (uint8_t)c) * FnvPrime;
+		}
+
+		return hash;
+	}
+}
@@ -0,0 +1,97 @@
+#include "pch.h"
+#include "MappedFile.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+bool MappedFile::Open(const fs::path& path)
+{
+    Close();
+
+    File = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size = {};
+    if (!GetFileSizeEx(File, &size) || size.QuadPart == 0)
+    {
+        Close();
+        return false;
+    }
+
+    Mapping = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    Data = Mapping ? (const char*)MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!Data)
+    {
+        Close();
+        return false;
+    }
+
+    Size = (size_t)size.QuadPart;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+    }
+
+    if (Mapping)
+    {
+        CloseHandle(Mapping);
+    }
+
+    if (File != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(File);
+    }
+
+    Data = nullptr;
+    Size = 0;
+    Mapping = nullptr;
+    File = INVALID_HANDLE_VALUE;
+}
+#else
+bool MappedFile::Open(const fs::path& path)
+{
+    Close();
+
+    auto fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    auto size = lseek(fd, 0, SEEK_END);
+    auto data = size > 0 ? mmap(nullptr, (size_t)size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    Data = (const char*)data;
+    Size = (size_t)size;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (Data)
+    {
+        munmap((void*)Data, Size);
+    }
+
+    Data = nullptr;
+    Size = 0;
+}
+#endif
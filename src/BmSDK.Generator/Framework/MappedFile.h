@@ -0,0 +1,26 @@
+#pragma once
+
+#include <span>
+
+// Read-only memory mapping of a whole file. Unmapped when destroyed.
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile() { Close(); }
+
+	bool Open(const fs::path& path);
+	void Close();
+
+	span<const char> GetData() const { return { Data, Size }; }
+
+private:
+	const char* Data = nullptr;
+	size_t Size = 0;
+#ifdef _WIN32
+	HANDLE File = INVALID_HANDLE_VALUE;
+	HANDLE Mapping = nullptr;
+#endif
+};
@@ -0,0 +1,36 @@
+#include "pch.h"
+#include "NameCache.h"
+
+StringMemo NameCache::PathNames = StringMemo("Path names");
+StringMemo NameCache::FieldNamesManaged = StringMemo("Managed field names");
+StringMemo NameCache::FieldPathNamesManaged = StringMemo("Managed field paths");
+StringMemo NameCache::PropertyTypeNames = StringMemo("Managed property types");
+
+void StringMemo::Clear()
+{
+    Entries.Clear();
+    Storage.clear();
+    Hits = Misses = BytesReused = AllocsAvoided = 0;
+}
+
+void StringMemo::LogStats() const
+{
+    TRACE("{}: {} hits, {} misses, {:.1f} KB of strings and {} allocations not rebuilt", Label, Hits, Misses,
+        BytesReused / 1e3, AllocsAvoided);
+}
+
+void NameCache::Reset()
+{
+    PathNames.Clear();
+    FieldNamesManaged.Clear();
+    FieldPathNamesManaged.Clear();
+    PropertyTypeNames.Clear();
+}
+
+void NameCache::LogStats()
+{
+    PathNames.LogStats();
+    FieldNamesManaged.LogStats();
+    FieldPathNamesManaged.LogStats();
+    PropertyTypeNames.LogStats();
+}
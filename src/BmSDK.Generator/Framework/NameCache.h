@@ -0,0 +1,64 @@
+#pragma once
+
+#include <deque>
+#include "FlatMap.h"
+
+// Memoizes strings derived from reflection objects, keyed by object pointer.
+// Returned references stay valid for the whole generation run.
+class StringMemo
+{
+public:
+	StringMemo(const char* label) : Label(label) {}
+
+	template <typename TCompute> const string& Get(const void* key, TCompute&& compute)
+	{
+		if (auto res = Entries.Find(key))
+		{
+			Hits++;
+			BytesReused += (*res)->size();
+			AllocsAvoided += (*res)->size() > string().capacity() ? 1 : 0;
+			return **res;
+		}
+
+		// compute() may recurse into this memo, so only insert once it's done
+		Misses++;
+		auto& value = Storage.emplace_back(compute());
+		Entries.Set(key, &value);
+		return value;
+	}
+
+	// Drops every entry and counter. References handed out before are invalidated.
+	void Clear();
+	void LogStats() const;
+
+private:
+	const char* Label;
+	FlatMap<const void*, const string*> Entries;
+	deque<string> Storage;
+	size_t Hits = 0;
+	size_t Misses = 0;
+	// Characters in the strings handed out on hits, i.e. what would have been built again
+	size_t BytesReused = 0;
+	// Hits on strings too long for the small string buffer, i.e. heap allocations not made
+	size_t AllocsAvoided = 0;
+};
+
+// Generator-wide interning of names and paths. Building ClassInfos asks for the
+// same names and paths thousands of times per class, so each is built only once.
+// Not thread-safe: ClassInfo construction runs on a single thread.
+class NameCache
+{
+private:
+	NameCache() = delete;
+
+public:
+	// Called at the start of each generation run: entries are keyed by address, and a new
+	// snapshot may reuse the addresses of the last one
+	static void Reset();
+	static void LogStats();
+
+	static StringMemo PathNames;
+	static StringMemo FieldNamesManaged;
+	static StringMemo FieldPathNamesManaged;
+	static StringMemo PropertyTypeNames;
+};
@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "Parallel.h"
+
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	struct WorkRange
+	{
+		mutex Lock;
+		size_t Begin = 0;
+		size_t End = 0;
+	};
+
+	bool PopFront(WorkRange& range, size_t& outIndex)
+	{
+		lock_guard lock(range.Lock);
+		if (range.Begin == range.End)
+		{
+			return false;
+		}
+
+		outIndex = range.Begin++;
+		return true;
+	}
+
+	bool StealHalf(WorkRange& victim, WorkRange& thief)
+	{
+		size_t begin, end;
+		{
+			lock_guard lock(victim.Lock);
+			auto remaining = victim.End - victim.Begin;
+			if (remaining == 0)
+			{
+				return false;
+			}
+
+			// Take the back half, the victim keeps working through the front
+			end = victim.End;
+			begin = victim.End -= (remaining + 1) / 2;
+		}
+
+		// Never hold two locks at once, so concurrent thieves can't deadlock
+		lock_guard lock(thief.Lock);
+		thief.Begin = begin;
+		thief.End = end;
+		return true;
+	}
+}
+
+void Parallel::For(size_t count, const function<void(size_t)>& body)
+{
+	// No point in spinning up more workers than there are items
+	size_t numWorkers = thread::hardware_concurrency();
+	if (numWorkers == 0)
+	{
+		numWorkers = 1;
+	}
+	if (count > 0 && count < numWorkers)
+	{
+		numWorkers = count;
+	}
+
+	// Split the work into one contiguous slice per worker
+	vector<WorkRange> ranges(numWorkers);
+	for (auto i = 0u; i < numWorkers; i++)
+	{
+		ranges[i].Begin = count * i / numWorkers;
+		ranges[i].End = count * (i + 1) / numWorkers;
+	}
+
+	auto work = [&](size_t self)
+	{
+		size_t index;
+		while (true)
+		{
+			if (PopFront(ranges[self], index))
+			{
+				body(index);
+				continue;
+			}
+
+			// Own slice is empty, look for someone to steal from
+			auto stole = false;
+			for (auto k = 1u; k < numWorkers && !stole; k++)
+			{
+				stole = StealHalf(ranges[(self + k) % numWorkers], ranges[self]);
+			}
+
+			if (!stole)
+			{
+				return;
+			}
+		}
+	};
+
+	vector<thread> workers;
+	for (auto i = 1u; i < numWorkers; i++)
+	{
+		workers.emplace_back(work, i);
+	}
+
+	work(0);
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <functional>
+
+namespace Parallel
+{
+	// Runs body(i) for every i in [0, count) across all hardware threads, including the caller.
+	// Each worker starts on its own contiguous slice and steals half of another worker's
+	// remaining slice once its own runs dry, so uneven item costs still balance out.
+	void For(size_t count, const std::function<void(size_t)>& body);
+}
@@ -0,0 +1,662 @@
+#include "SignatureScanner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <thread>
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define SCANNER_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC lets any function use any intrinsic, GCC and Clang need them enabled per function
+#if defined(__GNUC__) || defined(__clang__)
+#define SCANNER_TARGET(ISA) __attribute__((target(ISA)))
+#else
+#define SCANNER_TARGET(ISA)
+#endif
+
+using namespace std;
+
+namespace
+{
+    // Sections are scanned in chunks of this size, so large ones still spread across threads
+    constexpr size_t CHUNK_SIZE = 1 << 20;
+
+    constexpr uint32_t SECTION_CONTAINS_CODE = 0x00000020;
+    constexpr uint32_t SECTION_EXECUTABLE = 0x20000000;
+
+    // Bytes that show up all over x86 code (padding, common opcodes and ModRM bytes), and so
+    // make for a poor prefilter
+    bool IsCommonByte(uint8_t b)
+    {
+        switch (b)
+        {
+            case 0x00: case 0x01: case 0x04: case 0x08: case 0x24: case 0x44: case 0x45:
+            case 0x48: case 0x4C: case 0x50: case 0x55: case 0x74: case 0x75: case 0x83:
+            case 0x85: case 0x89: case 0x8B: case 0x90: case 0xC3: case 0xCC: case 0xE8:
+            case 0xEB: case 0xFF:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    string_view Trim(string_view str)
+    {
+        while (!str.empty() && isspace((unsigned char)str.front()))
+        {
+            str.remove_prefix(1);
+        }
+        while (!str.empty() && isspace((unsigned char)str.back()))
+        {
+            str.remove_suffix(1);
+        }
+        return str;
+    }
+
+    template <typename T> bool ReadAt(span<const uint8_t> data, size_t offset, T& outValue)
+    {
+        if (offset > data.size() || data.size() - offset < sizeof(T))
+        {
+            return false;
+        }
+
+        memcpy(&outValue, data.data() + offset, sizeof(T));
+        return true;
+    }
+
+    bool MatchesAt(const uint8_t* p, const Signature& sig)
+    {
+        for (size_t i = 0; i < sig.Bytes.size(); i++)
+        {
+            if ((p[i] ^ sig.Bytes[i]) & sig.Mask[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Candidates are the positions in [begin, last] whose anchor byte matches
+    size_t FindScalar(span<const uint8_t> data, const Signature& sig, size_t begin, size_t last)
+    {
+        const auto* anchors = data.data() + sig.Anchor;
+        const auto anchor = sig.Bytes[sig.Anchor];
+        for (size_t i = begin; i <= last;)
+        {
+            auto hit = (const uint8_t*)memchr(anchors + i, anchor, last - i + 1);
+            if (!hit)
+            {
+                break;
+            }
+
+            i = hit - anchors;
+            if (MatchesAt(data.data() + i, sig))
+            {
+                return i;
+            }
+            i++;
+        }
+        return SIZE_MAX;
+    }
+
+#ifdef SCANNER_X86
+    SCANNER_TARGET("sse2")
+    size_t FindSse2(span<const uint8_t> data, const Signature& sig, size_t last)
+    {
+        const auto* anchors = data.data() + sig.Anchor;
+        const auto needle = _mm_set1_epi8((char)sig.Bytes[sig.Anchor]);
+
+        size_t i = 0;
+        for (; i <= last && last - i >= 15; i += 16)
+        {
+            auto block = _mm_loadu_si128((const __m128i*)(anchors + i));
+            auto mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+            while (mask)
+            {
+                auto pos = i + countr_zero(mask);
+                if (MatchesAt(data.data() + pos, sig))
+                {
+                    return pos;
+                }
+                mask &= mask - 1;
+            }
+        }
+        return i <= last ? FindScalar(data, sig, i, last) : SIZE_MAX;
+    }
+
+    SCANNER_TARGET("avx2")
+    size_t FindAvx2(span<const uint8_t> data, const Signature& sig, size_t last)
+    {
+        const auto* anchors = data.data() + sig.Anchor;
+        const auto needle = _mm256_set1_epi8((char)sig.Bytes[sig.Anchor]);
+
+        size_t i = 0;
+        for (; i <= last && last - i >= 31; i += 32)
+        {
+            auto block = _mm256_loadu_si256((const __m256i*)(anchors + i));
+            auto mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle));
+            while (mask)
+            {
+                auto pos = i + countr_zero(mask);
+                if (MatchesAt(data.data() + pos, sig))
+                {
+                    return pos;
+                }
+                mask &= mask - 1;
+            }
+        }
+        if (i > last)
+        {
+            return SIZE_MAX;
+        }
+
+        // Less than a block left, which SSE2 can still do in one go
+        auto pos = FindSse2(data.subspan(i), sig, last - i);
+        return pos == SIZE_MAX ? SIZE_MAX : pos + i;
+    }
+
+    bool HasAvx2()
+    {
+#ifdef _MSC_VER
+        // AVX2 needs both the CPU and the OS (saving YMM registers) to support it
+        int info[4] = {};
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6;
+        __cpuidex(info, 7, 0);
+        return osSavesYmm && (info[1] & (1 << 5));
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+
+    bool HasSse2()
+    {
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        return true;
+#elif defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 1);
+        return info[3] & (1 << 26);
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse2");
+#endif
+    }
+
+    const bool bHasAvx2 = HasAvx2();
+    const bool bHasSse2 = HasSse2();
+#endif
+
+    // Where the address a def points to is, given the RVA of its match. 0 if it's outside the image.
+    uint32_t ReadTarget(const ImageInfo& image, const SignatureDef& def, uint32_t matchRva)
+    {
+        uint32_t fieldRva = matchRva + def.Offset;
+        if (def.Target == ESignatureTarget::Match)
+        {
+            return fieldRva < image.SizeOfImage ? fieldRva : 0;
+        }
+
+        uint32_t value = 0;
+        auto section = ranges::find_if(image.CodeSections,
+            [&](const ImageSection& s) { return fieldRva >= s.Rva && fieldRva - s.Rva < s.Data.size(); });
+        if (section == image.CodeSections.end() || !ReadAt(section->Data, fieldRva - section->Rva, value))
+        {
+            return 0;
+        }
+
+        int64_t rva = def.Target == ESignatureTarget::Absolute ? (int64_t)value - (int64_t)image.AddressBase
+                                                               : (int64_t)fieldRva + 4 + (int32_t)value;
+        return rva >= 0 && rva < image.SizeOfImage ? (uint32_t)rva : 0;
+    }
+
+    // Loaded sections live at their RVA, sections in a file at their raw data offset
+    bool ReadImage(span<const uint8_t> data, bool isMapped, ImageInfo& outInfo)
+    {
+        outInfo = {};
+
+        uint16_t dosMagic = 0;
+        uint32_t peOffset = 0;
+        uint32_t peMagic = 0;
+        if (!ReadAt(data, 0, dosMagic) || dosMagic != 0x5A4D || !ReadAt(data, 0x3C, peOffset) ||
+            !ReadAt(data, peOffset, peMagic) || peMagic != 0x00004550)
+        {
+            return false;
+        }
+
+        // File header, then the optional header, whose layout depends on PE32 or PE32+
+        size_t fileHeader = peOffset + 4;
+        size_t optionalHeader = fileHeader + 20;
+        uint16_t numSections = 0;
+        uint16_t optionalHeaderSize = 0;
+        uint16_t optionalMagic = 0;
+        if (!ReadAt(data, fileHeader + 2, numSections) || !ReadAt(data, fileHeader + 4, outInfo.TimeDateStamp) ||
+            !ReadAt(data, fileHeader + 16, optionalHeaderSize) || !ReadAt(data, optionalHeader, optionalMagic) ||
+            !ReadAt(data, optionalHeader + 56, outInfo.SizeOfImage) ||
+            !ReadAt(data, optionalHeader + 64, outInfo.CheckSum))
+        {
+            return false;
+        }
+
+        if (optionalMagic == 0x10B)
+        {
+            uint32_t imageBase = 0;
+            if (!ReadAt(data, optionalHeader + 28, imageBase))
+            {
+                return false;
+            }
+            outInfo.AddressBase = imageBase;
+        }
+        else if (optionalMagic != 0x20B || !ReadAt(data, optionalHeader + 24, outInfo.AddressBase))
+        {
+            return false;
+        }
+
+        size_t sectionTable = optionalHeader + optionalHeaderSize;
+        for (size_t i = 0; i < numSections; i++)
+        {
+            size_t header = sectionTable + i * 40;
+            uint32_t virtualSize = 0, rva = 0, rawSize = 0, rawOffset = 0, flags = 0;
+            if (!ReadAt(data, header + 8, virtualSize) || !ReadAt(data, header + 12, rva) ||
+                !ReadAt(data, header + 16, rawSize) || !ReadAt(data, header + 20, rawOffset) ||
+                !ReadAt(data, header + 36, flags))
+            {
+                return false;
+            }
+
+            auto offset = isMapped ? rva : rawOffset;
+            auto size = isMapped ? virtualSize : min(rawSize, virtualSize ? virtualSize : rawSize);
+            if (!(flags & (SECTION_CONTAINS_CODE | SECTION_EXECUTABLE)) || offset >= data.size())
+            {
+                continue;
+            }
+
+            outInfo.CodeSections.push_back({ data.subspan(offset, min<size_t>(size, data.size() - offset)), rva });
+        }
+
+        ranges::sort(outInfo.CodeSections, {}, &ImageSection::Rva);
+        return true;
+    }
+
+    uint64_t HashDef(const SignatureDef& def)
+    {
+        // FNV-1a over everything that decides what the def resolves to
+        uint64_t hash = 0xCBF29CE484222325;
+        auto add = [&](string_view str)
+        {
+            for (auto c : str)
+            {
+                hash = (hash ^ (uint8_t)c) * 0x100000001B3;
+            }
+        };
+        add(def.Text);
+        add(format("|{}|{}", (int)def.Target, def.Offset));
+        return hash;
+    }
+
+    bool ParseHex(string_view str, uint64_t& outValue)
+    {
+        auto res = from_chars(str.data(), str.data() + str.size(), outValue, 16);
+        return res.ec == errc{} && res.ptr == str.data() + str.size();
+    }
+}
+
+bool Signature::Parse(string_view text, Signature& outSig)
+{
+    outSig = {};
+    while (!(text = Trim(text)).empty())
+    {
+        auto end = min(text.find_first_of(" \t"), text.size());
+        auto token = text.substr(0, end);
+        text.remove_prefix(end);
+
+        if (token == "?" || token == "??")
+        {
+            outSig.Bytes.push_back(0);
+            outSig.Mask.push_back(0);
+            continue;
+        }
+
+        uint64_t value = 0;
+        if (token.size() != 2 || !ParseHex(token, value))
+        {
+            return false;
+        }
+        outSig.Bytes.push_back((uint8_t)value);
+        outSig.Mask.push_back(0xFF);
+    }
+
+    // Prefer the first uncommon byte, but any non-wildcard byte will do
+    auto first = ranges::find(outSig.Mask, 0xFF);
+    if (first == outSig.Mask.end())
+    {
+        return false;
+    }
+
+    outSig.Anchor = first - outSig.Mask.begin();
+    for (size_t i = outSig.Anchor; i < outSig.Bytes.size(); i++)
+    {
+        if (outSig.Mask[i] && !IsCommonByte(outSig.Bytes[i]))
+        {
+            outSig.Anchor = i;
+            break;
+        }
+    }
+    return true;
+}
+
+bool ImageInfo::ReadMapped(const uint8_t* base, ImageInfo& outInfo)
+{
+    // Only the headers are known to be there until SizeOfImage has been read
+    uint32_t peOffset = 0;
+    uint32_t sizeOfImage = 0;
+    if (!ReadAt(span(base, 0x40), 0x3C, peOffset) || !ReadAt(span(base, peOffset + 0x60), peOffset + 0x50, sizeOfImage))
+    {
+        return false;
+    }
+
+    if (!ReadImage(span(base, sizeOfImage), true, outInfo))
+    {
+        return false;
+    }
+
+    outInfo.AddressBase = (uintptr_t)base;
+    return true;
+}
+
+bool ImageInfo::ReadFile(span<const uint8_t> data, ImageInfo& outInfo)
+{
+    return ReadImage(data, false, outInfo);
+}
+
+void SignatureCache::Load(const filesystem::path& path, const ImageInfo& image)
+{
+    TimeDateStamp = image.TimeDateStamp;
+    CheckSum = image.CheckSum;
+    SizeOfImage = image.SizeOfImage;
+    Entries.clear();
+    bDirty = false;
+
+    ifstream file(path);
+    string line;
+    bool bHeaderMatches = false;
+    while (getline(file, line))
+    {
+        string_view view = Trim(line);
+        if (view.empty() || view.front() == '#')
+        {
+            continue;
+        }
+
+        // "image <timestamp> <checksum> <size>" comes first, anything from another build is ignored
+        char name[128] = {};
+        uint32_t a = 0, b = 0, c = 0;
+        unsigned long long hash = 0;
+        if (!bHeaderMatches)
+        {
+            if (sscanf(line.c_str(), "image %x %x %x", &a, &b, &c) != 3 || a != TimeDateStamp || b != CheckSum ||
+                c != SizeOfImage)
+            {
+                break;
+            }
+            bHeaderMatches = true;
+        }
+        else if (sscanf(line.c_str(), "%127s %x %llx", name, &a, &hash) == 3)
+        {
+            Entries[name] = { (uint64_t)hash, a };
+        }
+    }
+
+    // A partial read means a different build or a broken file, so rewrite it
+    if (!bHeaderMatches)
+    {
+        Entries.clear();
+        bDirty = true;
+    }
+}
+
+bool SignatureCache::Save(const filesystem::path& path) const
+{
+    ofstream file(path, ios::trunc);
+    file << "# Signature scan results, rescanned whenever the executable changes\n";
+    file << format("image {:08X} {:08X} {:08X}\n", TimeDateStamp, CheckSum, SizeOfImage);
+    for (const auto& [name, entry] : Entries)
+    {
+        file << format("{} {:08X} {:016X}\n", name, entry.Rva, entry.DefHash);
+    }
+    return (bool)file;
+}
+
+bool SignatureCache::Find(const SignatureDef& def, uint32_t& outRva) const
+{
+    auto it = Entries.find(def.Name);
+    if (it == Entries.end() || it->second.DefHash != HashDef(def))
+    {
+        return false;
+    }
+
+    outRva = it->second.Rva;
+    return true;
+}
+
+void SignatureCache::Set(const SignatureDef& def, uint32_t rva)
+{
+    Entries[def.Name] = { HashDef(def), rva };
+    bDirty = true;
+}
+
+size_t SignatureScanner::Find(span<const uint8_t> data, const Signature& sig)
+{
+    if (sig.Bytes.empty() || data.size() < sig.Bytes.size())
+    {
+        return SIZE_MAX;
+    }
+
+    size_t last = data.size() - sig.Bytes.size();
+#ifdef SCANNER_X86
+    if (bHasAvx2)
+    {
+        return FindAvx2(data, sig, last);
+    }
+    if (bHasSse2)
+    {
+        return FindSse2(data, sig, last);
+    }
+#endif
+    return FindScalar(data, sig, 0, last);
+}
+
+vector<uint32_t> SignatureScanner::Scan(const ImageInfo& image, span<const SignatureDef> defs, size_t numThreads)
+{
+    size_t maxLength = 0;
+    for (const auto& def : defs)
+    {
+        maxLength = max(maxLength, def.Pattern.Bytes.size());
+    }
+
+    // Chunks overlap by a pattern's length, so matches across their edges aren't missed
+    vector<ImageSection> chunks;
+    for (const auto& section : image.CodeSections)
+    {
+        for (size_t begin = 0; begin < section.Data.size(); begin += CHUNK_SIZE)
+        {
+            auto size = min(CHUNK_SIZE + maxLength, section.Data.size() - begin);
+            chunks.push_back({ section.Data.subspan(begin, size), section.Rva + (uint32_t)begin });
+        }
+    }
+
+    // One task per chunk and def. Each def keeps the lowest RVA it matched at.
+    vector<atomic<uint32_t>> matches(defs.size());
+    for (auto& match : matches)
+    {
+        match = UINT32_MAX;
+    }
+
+    size_t numTasks = chunks.size() * defs.size();
+    atomic<size_t> nextTask = 0;
+    auto work = [&]()
+    {
+        for (size_t task; (task = nextTask++) < numTasks;)
+        {
+            const auto& chunk = chunks[task / defs.size()];
+            auto defIndex = task % defs.size();
+            auto& match = matches[defIndex];
+
+            // Anything found here would come after what's already been found
+            if (chunk.Rva >= match)
+            {
+                continue;
+            }
+
+            auto pos = Find(chunk.Data, defs[defIndex].Pattern);
+            auto rva = pos == SIZE_MAX ? UINT32_MAX : chunk.Rva + (uint32_t)pos;
+            auto prev = match.load();
+            while (rva < prev && !match.compare_exchange_weak(prev, rva))
+            {
+                // prev was reloaded, try again
+            }
+        }
+    };
+
+    if (numThreads == 0)
+    {
+        numThreads = max(thread::hardware_concurrency(), 1u);
+    }
+    numThreads = min(numThreads, numTasks);
+
+    vector<thread> workers;
+    for (size_t i = 1; i < numThreads; i++)
+    {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    vector<uint32_t> results(defs.size());
+    for (size_t i = 0; i < defs.size(); i++)
+    {
+        results[i] = matches[i] == UINT32_MAX ? 0 : ReadTarget(image, defs[i], matches[i]);
+    }
+    return results;
+}
+
+vector<uint32_t> SignatureScanner::Resolve(const ImageInfo& image, span<const SignatureDef> defs,
+    SignatureCache& cache, size_t numThreads, size_t& outNumScanned)
+{
+    vector<uint32_t> results(defs.size());
+    vector<SignatureDef> missing;
+    vector<size_t> missingIndices;
+    for (size_t i = 0; i < defs.size(); i++)
+    {
+        if (!cache.Find(defs[i], results[i]))
+        {
+            missing.push_back(defs[i]);
+            missingIndices.push_back(i);
+        }
+    }
+
+    outNumScanned = missing.size();
+    if (missing.empty())
+    {
+        return results;
+    }
+
+    auto scanned = Scan(image, missing, numThreads);
+    for (size_t i = 0; i < missing.size(); i++)
+    {
+        results[missingIndices[i]] = scanned[i];
+        cache.Set(missing[i], scanned[i]);
+    }
+    return results;
+}
+
+vector<SignatureDef> SignatureScanner::ParseDefs(string_view text, vector<string>& outErrors)
+{
+    vector<SignatureDef> defs;
+    size_t lineNumber = 0;
+    while (!text.empty())
+    {
+        auto end = min(text.find('\n'), text.size());
+        auto line = text.substr(0, end);
+        text.remove_prefix(min(end + 1, text.size()));
+        lineNumber++;
+
+        line = Trim(line.substr(0, line.find('#')));
+        if (line.empty())
+        {
+            continue;
+        }
+
+        auto fail = [&](string_view reason) { outErrors.push_back(format("Line {}: {}", lineNumber, reason)); };
+
+        auto equals = line.find('=');
+        if (equals == string_view::npos || Trim(line.substr(0, equals)).empty())
+        {
+            fail("expected 'Name = <pattern>'");
+            continue;
+        }
+
+        SignatureDef def;
+        def.Name = Trim(line.substr(0, equals));
+        auto value = line.substr(equals + 1);
+        auto comma = value.find(',');
+        def.Text = Trim(value.substr(0, comma));
+        if (!Signature::Parse(def.Text, def.Pattern))
+        {
+            fail(format("invalid pattern for {}", def.Name));
+            continue;
+        }
+
+        if (comma != string_view::npos)
+        {
+            // "<abs|rel|add> <offset>"
+            auto modifier = Trim(value.substr(comma + 1));
+            auto space = modifier.find_first_of(" \t");
+            auto kind = modifier.substr(0, space);
+            auto offset = space == string_view::npos ? string_view{} : Trim(modifier.substr(space));
+            if (!offset.empty() && offset.front() == '+')
+            {
+                offset.remove_prefix(1);
+            }
+
+            auto res = from_chars(offset.data(), offset.data() + offset.size(), def.Offset);
+            if (offset.empty() || res.ec != errc{} || res.ptr != offset.data() + offset.size())
+            {
+                fail(format("invalid offset for {}", def.Name));
+                continue;
+            }
+
+            if (kind == "abs")
+            {
+                def.Target = ESignatureTarget::Absolute;
+            }
+            else if (kind == "rel")
+            {
+                def.Target = ESignatureTarget::Relative;
+            }
+            else if (kind != "add")
+            {
+                fail(format("unknown target '{}' for {}, expected abs, rel or add", kind, def.Name));
+                continue;
+            }
+        }
+
+        defs.push_back(move(def));
+    }
+    return defs;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+// Also compiled into BmSDK.Host, so this only relies on the standard library (no pch.h).
+// Everything works on byte buffers, nothing here needs Windows or the game.
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Byte pattern with wildcards, e.g. "8B 0D ?? ?? ?? ?? 85 C9". '?' and '??' match any byte.
+struct Signature
+{
+    std::vector<uint8_t> Bytes;
+    // 0xFF where the byte has to match, 0 for wildcards
+    std::vector<uint8_t> Mask;
+    // Byte the SIMD prefilter looks for. Picked to be as rare as possible in x86 code.
+    size_t Anchor = 0;
+
+    static bool Parse(std::string_view text, Signature& outSig);
+};
+
+// Where a signature's address is read from, relative to the start of the match
+enum class ESignatureTarget : uint8_t
+{
+    // The match (plus offset) is the address
+    Match,
+    // A 32-bit absolute address at the offset, e.g. "mov ecx, [GNames]"
+    Absolute,
+    // A 32-bit displacement at the offset, relative to the end of it, e.g. "call StaticFindObject"
+    Relative,
+};
+
+struct SignatureDef
+{
+    std::string Name;
+    std::string Text;
+    Signature Pattern;
+    ESignatureTarget Target = ESignatureTarget::Match;
+    int32_t Offset = 0;
+};
+
+struct ImageSection
+{
+    std::span<const uint8_t> Data;
+    uint32_t Rva = 0;
+};
+
+// The parts of a PE image's headers the scanner needs
+struct ImageInfo
+{
+    uint32_t TimeDateStamp = 0;
+    uint32_t CheckSum = 0;
+    uint32_t SizeOfImage = 0;
+    // What absolute addresses in the code are relative to: the load address of a mapped
+    // module, or the preferred image base of a file on disk
+    uint64_t AddressBase = 0;
+    // Executable sections, sorted by RVA
+    std::vector<ImageSection> CodeSections;
+
+    // Reads the headers of a module loaded at base
+    static bool ReadMapped(const uint8_t* base, ImageInfo& outInfo);
+    // Reads the headers of a PE file read from disk, e.g. for benchmarking the scanner offline
+    static bool ReadFile(std::span<const uint8_t> data, ImageInfo& outInfo);
+};
+
+// RVAs found by earlier scans. Only valid for the exact executable they were found in, so
+// they're keyed by its timestamp, checksum and size. A cached 0 means the signature had no
+// match, which also doesn't need to be scanned for again.
+class SignatureCache
+{
+public:
+    // An empty cache is used if the file is missing, unreadable or from a different build
+    void Load(const std::filesystem::path& path, const ImageInfo& image);
+    bool Save(const std::filesystem::path& path) const;
+
+    bool Find(const SignatureDef& def, uint32_t& outRva) const;
+    void Set(const SignatureDef& def, uint32_t rva);
+
+    bool IsDirty() const { return bDirty; }
+
+private:
+    struct Entry
+    {
+        uint64_t DefHash = 0;
+        uint32_t Rva = 0;
+    };
+
+    uint32_t TimeDateStamp = 0;
+    uint32_t CheckSum = 0;
+    uint32_t SizeOfImage = 0;
+    std::unordered_map<std::string, Entry> Entries;
+    bool bDirty = false;
+};
+
+namespace SignatureScanner
+{
+    // Offset of the first match in data, or SIZE_MAX. Uses AVX2 or SSE2 where available.
+    size_t Find(std::span<const uint8_t> data, const Signature& sig);
+
+    // RVA of the first match of every def in the image's code sections, 0 if there was none.
+    // Sections are split into chunks that are scanned on numThreads threads (0 for one per
+    // core). Don't ask for more than one under the loader lock: the workers couldn't start.
+    std::vector<uint32_t> Scan(const ImageInfo& image, std::span<const SignatureDef> defs, size_t numThreads);
+
+    // Like Scan(), but answers from the cache where possible and adds anything it scanned
+    std::vector<uint32_t> Resolve(const ImageInfo& image, std::span<const SignatureDef> defs,
+        SignatureCache& cache, size_t numThreads, size_t& outNumScanned);
+
+    // Parses signature definitions, one per line, '#' starts a comment:
+    //
+    //   Name = <pattern>                 the match itself
+    //   Name = <pattern>, add <offset>   the match plus offset
+    //   Name = <pattern>, abs <offset>   the absolute address stored at match + offset
+    //   Name = <pattern>, rel <offset>   the target of the rel32 stored at match + offset
+    //
+    // Invalid lines are skipped and described in outErrors.
+    std::vector<SignatureDef> ParseDefs(std::string_view text, std::vector<std::string>& outErrors);
+}
@@ -0,0 +1,140 @@
+#include "pch.h"
+#include "Snapshot.h"
+
+#include <cstring>
+
+static uint64_t AlignUp(uint64_t value)
+{
+    return (value + 7) & ~7ull;
+}
+
+template <typename T> static bool GetTable(span<const char> data, uint64_t offset, uint64_t count, span<const T>& outTable)
+{
+    if (offset % alignof(T) != 0 || offset > data.size() || count > (data.size() - offset) / sizeof(T))
+    {
+        return false;
+    }
+
+    outTable = { (const T*)(data.data() + offset), (size_t)count };
+    return true;
+}
+
+bool Snapshot::Open(span<const char> data)
+{
+    if (data.size() < sizeof(SnapshotHeader))
+    {
+        TRACE("Snapshot is truncated ({} bytes)", data.size());
+        return false;
+    }
+
+    auto& header = *(const SnapshotHeader*)data.data();
+    if (header.Magic != SNAPSHOT_MAGIC)
+    {
+        TRACE("Not a snapshot file");
+        return false;
+    }
+
+    if (header.Version != SNAPSHOT_VERSION)
+    {
+        TRACE("Snapshot version {} doesn't match generator version {}", header.Version, SNAPSHOT_VERSION);
+        return false;
+    }
+
+    if (!GetTable(data, header.NamesOffset, header.NumNames, Names) ||
+        !GetTable(data, header.StringsOffset, header.StringsSize, Strings) ||
+        !GetTable(data, header.ObjectsOffset, header.NumObjects, Objects) ||
+        !GetTable(data, header.IndicesOffset, header.NumIndices, Indices) ||
+        header.NumClasses > header.NumObjects)
+    {
+        TRACE("Snapshot tables are out of bounds");
+        return false;
+    }
+
+    NumClasses = header.NumClasses;
+    return true;
+}
+
+string_view Snapshot::GetName(uint32_t nameIndex) const
+{
+    if (nameIndex >= Names.size())
+    {
+        return {};
+    }
+
+    auto& name = Names[nameIndex];
+    if (name.Offset > Strings.size() || name.Length > Strings.size() - name.Offset)
+    {
+        return {};
+    }
+
+    return { Strings.data() + name.Offset, name.Length };
+}
+
+const SnapshotObject* Snapshot::GetObject(uint32_t objectIndex) const
+{
+    return objectIndex < Objects.size() ? &Objects[objectIndex] : nullptr;
+}
+
+span<const uint32_t> Snapshot::GetList(const SnapshotObject& obj) const
+{
+    if (obj.ListStart > Indices.size() || obj.ListNum > Indices.size() - obj.ListStart)
+    {
+        return {};
+    }
+
+    return Indices.subspan(obj.ListStart, obj.ListNum);
+}
+
+uint32_t SnapshotBuilder::AddName(string_view name)
+{
+    auto [it, inserted] = NameIndices.try_emplace(string(name), (uint32_t)Names.size());
+    if (inserted)
+    {
+        Names.push_back({ (uint32_t)Strings.size(), (uint32_t)name.size() });
+        Strings += name;
+    }
+
+    return it->second;
+}
+
+uint32_t SnapshotBuilder::AddObject()
+{
+    SnapshotObject obj = {};
+    obj.Name = obj.ClassName = SNAPSHOT_NONE;
+    obj.Outer = obj.Super = obj.Children = obj.Next = obj.Ref = SNAPSHOT_NONE;
+
+    Objects.push_back(obj);
+    return (uint32_t)Objects.size() - 1;
+}
+
+void SnapshotBuilder::SetList(uint32_t objectIndex, span<const uint32_t> indices)
+{
+    Objects[objectIndex].ListStart = (uint32_t)Indices.size();
+    Objects[objectIndex].ListNum = (uint32_t)indices.size();
+    Indices.insert(Indices.end(), indices.begin(), indices.end());
+}
+
+vector<char> SnapshotBuilder::Build(uint32_t numClasses) const
+{
+    SnapshotHeader header = {};
+    header.Magic = SNAPSHOT_MAGIC;
+    header.Version = SNAPSHOT_VERSION;
+    header.NumNames = (uint32_t)Names.size();
+    header.NumObjects = (uint32_t)Objects.size();
+    header.NumIndices = (uint32_t)Indices.size();
+    header.NumClasses = numClasses;
+    header.NamesOffset = AlignUp(sizeof(header));
+    header.StringsOffset = AlignUp(header.NamesOffset + Names.size() * sizeof(SnapshotName));
+    header.StringsSize = Strings.size();
+    header.ObjectsOffset = AlignUp(header.StringsOffset + Strings.size());
+    header.IndicesOffset = AlignUp(header.ObjectsOffset + Objects.size() * sizeof(SnapshotObject));
+
+    // Zero-filled, so alignment padding is deterministic
+    vector<char> data(header.IndicesOffset + Indices.size() * sizeof(uint32_t));
+    memcpy(data.data(), &header, sizeof(header));
+    memcpy(data.data() + header.NamesOffset, Names.data(), Names.size() * sizeof(SnapshotName));
+    memcpy(data.data() + header.StringsOffset, Strings.data(), Strings.size());
+    memcpy(data.data() + header.ObjectsOffset, Objects.data(), Objects.size() * sizeof(SnapshotObject));
+    memcpy(data.data() + header.IndicesOffset, Indices.data(), Indices.size() * sizeof(uint32_t));
+    return data;
+}
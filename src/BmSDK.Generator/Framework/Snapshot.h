@@ -0,0 +1,137 @@
+#pragma once
+
+#include <span>
+#include <unordered_map>
+#include "Engine/EngineFlags.h"
+
+// Offline copy of everything ClassInfo reads from the running game, so the SDK can
+// be generated without it. Layout is the header followed by the name spans, the
+// string data, the object records and a shared index list, each 8-byte aligned.
+// All fields are fixed-width little-endian, so a mapped file is read in place.
+//
+// Bump SNAPSHOT_VERSION whenever a record changes shape or meaning.
+constexpr uint32_t SNAPSHOT_MAGIC = 0x53524D42; // "BMRS"
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+// Index value for "no object"
+constexpr uint32_t SNAPSHOT_NONE = 0xFFFFFFFF;
+
+// What an object record was captured as. Everything from Field up is a UField.
+enum class ESnapshotKind : BYTE
+{
+    Object,
+    Package,
+    Field,
+    Struct,
+    ScriptStruct,
+    Function,
+    Class,
+    Enum,
+    Property,
+};
+
+inline bool IsFieldKind(ESnapshotKind kind) { return kind >= ESnapshotKind::Field; }
+inline bool IsStructKind(ESnapshotKind kind) { return kind >= ESnapshotKind::Struct && kind <= ESnapshotKind::Class; }
+
+struct SnapshotHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t NumNames;
+    uint32_t NumObjects;
+    uint32_t NumIndices;
+    uint32_t NumClasses;
+    uint64_t NamesOffset;
+    uint64_t StringsOffset;
+    uint64_t StringsSize;
+    uint64_t ObjectsOffset;
+    uint64_t IndicesOffset;
+};
+
+struct SnapshotName
+{
+    uint32_t Offset;
+    uint32_t Length;
+};
+
+// One captured UObject. Object references are indices into the object records.
+struct SnapshotObject
+{
+    uint32_t Name;
+    uint32_t ClassName;
+    uint32_t Outer;
+    ESnapshotKind Kind;
+    EPropertyKind PropertyKind;
+    uint16_t Reserved;
+
+    // Structs: super struct and first child field. Fields: next field in the chain.
+    uint32_t Super;
+    uint32_t Children;
+    uint32_t Next;
+
+    // Properties: struct, enum, class or inner property, depending on PropertyKind
+    uint32_t Ref;
+
+    // Class, function or property flags, depending on Kind
+    uint64_t Flags;
+
+    // Structs: properties size. Properties: element size.
+    int32_t Size;
+    int32_t Offset;
+    int32_t ArrayDim;
+    int32_t BitMask;
+
+    // Enums: name indices. Classes: implemented interface objects.
+    uint32_t ListStart;
+    uint32_t ListNum;
+};
+
+static_assert(sizeof(SnapshotHeader) == 64, "SnapshotHeader is part of the file format");
+static_assert(sizeof(SnapshotObject) == 64, "SnapshotObject is part of the file format");
+
+// Read-only view over snapshot bytes, either mapped from disk or captured in memory.
+// The bytes must outlive the view.
+class Snapshot
+{
+public:
+    // Validates the header and table bounds. Returns false if data isn't a usable snapshot.
+    bool Open(span<const char> data);
+
+    string_view GetName(uint32_t nameIndex) const;
+    const SnapshotObject* GetObject(uint32_t objectIndex) const;
+    span<const uint32_t> GetList(const SnapshotObject& obj) const;
+
+    // Class records come first, in the order they were found in GObjects.
+    span<const SnapshotObject> GetClasses() const { return Objects.subspan(0, NumClasses); }
+    span<const SnapshotObject> GetObjects() const { return Objects; }
+
+private:
+    span<const SnapshotName> Names;
+    span<const char> Strings;
+    span<const SnapshotObject> Objects;
+    span<const uint32_t> Indices;
+    uint32_t NumClasses = 0;
+};
+
+// Accumulates names, objects and index lists, then lays them out in the snapshot format.
+class SnapshotBuilder
+{
+public:
+    uint32_t AddName(string_view name);
+
+    // Appends a zeroed record with no references and returns its index.
+    uint32_t AddObject();
+    SnapshotObject& GetObject(uint32_t objectIndex) { return Objects[objectIndex]; }
+
+    // Stores the given indices as the object's list.
+    void SetList(uint32_t objectIndex, span<const uint32_t> indices);
+
+    vector<char> Build(uint32_t numClasses) const;
+
+private:
+    vector<SnapshotName> Names;
+    string Strings;
+    unordered_map<string, uint32_t> NameIndices;
+    vector<SnapshotObject> Objects;
+    vector<uint32_t> Indices;
+};
@@ -0,0 +1,63 @@
+#include "pch.h"
+#include "TreeInterval.h"
+
+vector<TreeInterval> NumberTree(span<const uint32_t> parents)
+{
+    auto numNodes = parents.size();
+
+    // Children of every node as one flat list, in index order
+    vector<uint32_t> childStart(numNodes + 1);
+    for (auto parent : parents)
+    {
+        if (parent < numNodes)
+        {
+            childStart[parent + 1]++;
+        }
+    }
+    for (size_t i = 0; i < numNodes; i++)
+    {
+        childStart[i + 1] += childStart[i];
+    }
+
+    vector<uint32_t> children(childStart[numNodes]);
+    vector<uint32_t> childEnd(childStart.begin(), childStart.end() - 1);
+    for (uint32_t i = 0; i < numNodes; i++)
+    {
+        if (parents[i] < numNodes)
+        {
+            children[childEnd[parents[i]]++] = i;
+        }
+    }
+
+    // Iterative walk, so deep hierarchies can't overflow the stack
+    vector<TreeInterval> intervals(numNodes);
+    vector<pair<uint32_t, uint32_t>> stack;
+    uint32_t counter = 0;
+    for (uint32_t root = 0; root < numNodes; root++)
+    {
+        if (parents[root] < numNodes)
+        {
+            continue;
+        }
+
+        intervals[root].Pre = ++counter;
+        stack.emplace_back(root, childStart[root]);
+        while (!stack.empty())
+        {
+            auto& [node, nextChild] = stack.back();
+            if (nextChild < childStart[node + 1])
+            {
+                auto child = children[nextChild++];
+                intervals[child].Pre = ++counter;
+                stack.emplace_back(child, childStart[child]);
+            }
+            else
+            {
+                intervals[node].Post = counter;
+                stack.pop_back();
+            }
+        }
+    }
+
+    return intervals;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <span>
+
+constexpr uint32_t TREE_NO_PARENT = 0xFFFFFFFF;
+
+// Position of a node in a depth-first numbering of its tree. Pre is the node's own
+// number (starting at 1, so 0 means "not numbered"), Post is the highest number in
+// its subtree. A node is in another's subtree iff its Pre falls in the other's range.
+struct TreeInterval
+{
+    uint32_t Pre = 0;
+    uint32_t Post = 0;
+
+    bool IsValid() const { return Pre != 0; }
+    bool IsWithin(const TreeInterval& other) const { return other.Pre <= Pre && Pre <= other.Post; }
+};
+
+// Numbers a forest given as each node's parent index (TREE_NO_PARENT for roots).
+// Children are visited in index order, so the result is stable for the same input.
+vector<TreeInterval> NumberTree(span<const uint32_t> parents);
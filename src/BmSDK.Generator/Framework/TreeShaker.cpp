@@ -0,0 +1,202 @@
+#include "pch.h"
+#include "TreeShaker.h"
+#include "ClassIndex.h"
+#include "ClassInfo.h"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+// Classes the hand-written parts of BmSDK (Classes/, Framework/, FrameworkInternal/ and
+// Loader.cs) extend or name directly. Keep in sync with those sources; the
+// TreeShaker_FrameworkRootsCoverSources test checks them against each other.
+static constexpr string_view FrameworkRoots[] = {
+    "Engine.Actor",
+    "Engine.Canvas",
+    "Engine.CheatManager",
+    "Engine.Console",
+    "Engine.Engine",
+    "Engine.GameEngine",
+    "Engine.GameInfo",
+    "Engine.GameViewportClient",
+    "Engine.Level",
+    "Engine.Sequence",
+    "Engine.SequenceObject",
+    "Engine.SequenceOp",
+    "Engine.World",
+    "Engine.WorldInfo",
+    "BmGame.RBMPawnAI",
+    "BmGame.RCharacter",
+    "BmGame.RCheatManager",
+    "BmGame.RGFxGameViewportClient",
+    "BmGame.RGameInfo",
+    "BmGame.RGameRI",
+    "BmGame.RPawnPlayer",
+    "BmGame.RPersistentData",
+    "BmGame.RPlayerController",
+};
+
+span<const string_view> TreeShaker::GetFrameworkRoots()
+{
+    return FrameworkRoots;
+}
+
+bool TreeShaker::LoadConfig(const fs::path& path)
+{
+    ifstream file(path);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    RootPackages = { "Core" };
+    RootClasses.assign(begin(FrameworkRoots), end(FrameworkRoots));
+
+    size_t numRoots = 0;
+    string line;
+    while (getline(file, line))
+    {
+        if (auto comment = line.find('#'); comment != string::npos)
+        {
+            line.resize(comment);
+        }
+
+        istringstream lineStream(line);
+        string kind, rootPath;
+        if (!(lineStream >> kind))
+        {
+            continue;
+        }
+
+        if (!(lineStream >> rootPath))
+        {
+            TRACE("Ignoring SDK root without a path: {}", line);
+            continue;
+        }
+
+        if (kind == "package")
+        {
+            RootPackages.push_back(rootPath);
+        }
+        else if (kind == "class")
+        {
+            RootClasses.push_back(rootPath);
+        }
+        else if (kind == "function" && rootPath.rfind('.') != string::npos)
+        {
+            RootClasses.push_back(rootPath.substr(0, rootPath.rfind('.')));
+        }
+        else
+        {
+            TRACE("Ignoring unknown SDK root: {}", line);
+            continue;
+        }
+
+        numRoots++;
+    }
+
+    return numRoots > 0;
+}
+
+vector<bool> TreeShaker::Shake(const Snapshot& snapshot, span<const ClassInfo> classes, const ClassIndex& index) const
+{
+    vector<bool> isReachable(classes.size());
+    vector<const ClassInfo*> pending;
+
+    auto visitClass = [&](const ClassInfo* _class)
+        {
+            if (_class && !isReachable[_class - classes.data()])
+            {
+                isReachable[_class - classes.data()] = true;
+                pending.push_back(_class);
+            }
+        };
+
+    // Structs and enums are emitted inside the class that declares them
+    auto visitType = [&](const SnapshotObject* type)
+        {
+            while (type && type->Kind != ESnapshotKind::Class)
+            {
+                type = snapshot.GetObject(type->Outer);
+            }
+
+            visitClass(index.Find(type));
+        };
+
+    function<void(const SnapshotObject&)> visitProperty = [&](const SnapshotObject& prop)
+        {
+            auto ref = snapshot.GetObject(prop.Ref);
+            switch (prop.PropertyKind)
+            {
+                case EPropertyKind::Array:
+                    if (ref)
+                    {
+                        visitProperty(*ref);
+                    }
+                    break;
+                case EPropertyKind::Byte:
+                case EPropertyKind::Struct:
+                case EPropertyKind::Object:
+                case EPropertyKind::Component:
+                case EPropertyKind::Class:
+                case EPropertyKind::Interface:
+                    visitType(ref);
+                    break;
+                default:
+                    break;
+            }
+        };
+
+    auto visitProperties = [&](const SnapshotObject& _struct)
+        {
+            for (auto field = snapshot.GetObject(_struct.Children); field; field = snapshot.GetObject(field->Next))
+            {
+                if (field->Kind == ESnapshotKind::Property)
+                {
+                    visitProperty(*field);
+                }
+            }
+        };
+
+    for (auto& _class : classes)
+    {
+        if (ranges::find(RootPackages, _class.PackageName) != RootPackages.end() ||
+            ranges::find(RootClasses, _class.PathName) != RootClasses.end())
+        {
+            visitClass(&_class);
+        }
+    }
+
+    for (auto& rootClass : RootClasses)
+    {
+        if (!index.Find(rootClass))
+        {
+            TRACE("SDK root {} wasn't found", rootClass);
+        }
+    }
+
+    while (!pending.empty())
+    {
+        auto _class = pending.back();
+        pending.pop_back();
+
+        visitClass(_class->Super);
+        for (auto interfaceIndex : snapshot.GetList(*_class->Class))
+        {
+            visitType(snapshot.GetObject(interfaceIndex));
+        }
+
+        // Own properties, plus those of declared structs and function signatures
+        visitProperties(*_class->Class);
+        for (auto field = snapshot.GetObject(_class->Class->Children); field; field = snapshot.GetObject(field->Next))
+        {
+            if (field->Kind == ESnapshotKind::ScriptStruct || field->Kind == ESnapshotKind::Function)
+            {
+                visitProperties(*field);
+            }
+        }
+    }
+
+    return isReachable;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <span>
+
+class Snapshot;
+class ClassIndex;
+struct ClassInfo;
+
+// Trims the SDK down to the classes a config file asks for, plus everything they need
+// to compile: super classes, interfaces, and the classes behind every property type and
+// function signature, transitively. Config lines are "<kind> <path>", '#' starts a comment:
+//
+//   package BmGame
+//   class Engine.Pawn
+//   function BmGame.RPawnPlayer.PlayFaceFX
+//
+// Functions are emitted as part of their class, so they root the class that owns them.
+// Core and the classes BmSDK's own code builds on are always kept.
+class TreeShaker
+{
+public:
+    // Returns false if there is no config or it lists no roots, i.e. nothing should be shaken.
+    bool LoadConfig(const fs::path& path);
+
+    // Returns whether each class, by position in classes, is reachable from the roots.
+    vector<bool> Shake(const Snapshot& snapshot, span<const ClassInfo> classes, const ClassIndex& index) const;
+
+    // Path names of the classes BmSDK's own code needs, which every trimmed SDK keeps.
+    static span<const string_view> GetFrameworkRoots();
+
+private:
+    vector<string> RootPackages;
+    vector<string> RootClasses;
+};
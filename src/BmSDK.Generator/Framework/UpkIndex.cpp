@@ -0,0 +1,112 @@
+#include "pch.h"
+#include "UpkIndex.h"
+#include "UpkReader.h"
+#include "MappedFile.h"
+#include "Parallel.h"
+
+#include <fstream>
+
+UpkIndex UpkIndex::Load(const fs::path& path)
+{
+    UpkIndex index;
+
+    // Each line is "<kind> <size> <write time> <package name>"
+    ifstream file(path);
+    int kind = 0;
+    Entry entry;
+    string name;
+    while (file >> kind >> entry.Size >> entry.WriteTime >> ws && getline(file, name))
+    {
+        entry.Kind = (EPackageKind)kind;
+        index.Entries[name] = entry;
+    }
+
+    return index;
+}
+
+bool UpkIndex::Save(const fs::path& path) const
+{
+    ofstream file(path, ios::trunc | ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    for (auto& [name, entry] : Entries)
+    {
+        file << std::format("{} {} {} {}\n", (int)entry.Kind, entry.Size, entry.WriteTime, name);
+    }
+
+    return file.good();
+}
+
+void UpkIndex::Update(const fs::path& upkDir)
+{
+    unordered_map<string, Entry> entries;
+    vector<pair<string, fs::path>> toScan;
+
+    for (const auto& dirEntry : fs::directory_iterator(upkDir))
+    {
+        if (!dirEntry.is_regular_file() || dirEntry.path().extension() != ".upk")
+        {
+            continue;
+        }
+
+        error_code ec;
+        Entry entry;
+        entry.Size = dirEntry.file_size(ec);
+        entry.WriteTime = dirEntry.last_write_time(ec).time_since_epoch().count();
+
+        auto name = dirEntry.path().stem().string();
+        auto it = Entries.find(name);
+        if (it != Entries.end() && it->second.Size == entry.Size && it->second.WriteTime == entry.WriteTime)
+        {
+            entry.Kind = it->second.Kind;
+        }
+        else
+        {
+            toScan.emplace_back(name, dirEntry.path());
+        }
+
+        entries[name] = entry;
+    }
+
+    vector<EPackageKind> kinds(toScan.size());
+    Parallel::For(toScan.size(), [&](size_t i) { kinds[i] = ScanPackage(toScan[i].second); });
+
+    for (size_t i = 0; i < toScan.size(); i++)
+    {
+        entries[toScan[i].first].Kind = kinds[i];
+    }
+
+    Entries = move(entries);
+    NumScanned = toScan.size();
+}
+
+EPackageKind UpkIndex::ScanPackage(const fs::path& path)
+{
+    MappedFile file;
+    if (!file.Open(path))
+    {
+        return EPackageKind::Unknown;
+    }
+
+    UpkReader reader(file.GetData());
+    UpkSummary summary;
+    vector<UpkExport> exports;
+    if (!reader.ReadSummary(summary) || !reader.ReadExports(summary, exports))
+    {
+        return EPackageKind::Unknown;
+    }
+
+    // Exports whose class is UClass itself have no class reference
+    for (auto& exp : exports)
+    {
+        if (exp.ClassIndex == 0)
+        {
+            return EPackageKind::HasClasses;
+        }
+    }
+
+    return EPackageKind::NoClasses;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <unordered_map>
+
+enum class EPackageKind : BYTE
+{
+    // Header couldn't be read (compressed, or a layout we don't know)
+    Unknown,
+    NoClasses,
+    HasClasses,
+};
+
+// Which packages in a directory export UClass objects, found by reading only their
+// headers. Results are cached on disk and reused while a file's size and mtime match.
+class UpkIndex
+{
+public:
+    struct Entry
+    {
+        uint64_t Size = 0;
+        int64_t WriteTime = 0;
+        EPackageKind Kind = EPackageKind::Unknown;
+    };
+
+    static UpkIndex Load(const fs::path& path);
+    bool Save(const fs::path& path) const;
+
+    // Rescans every changed .upk in upkDir in parallel and drops packages that no longer exist.
+    void Update(const fs::path& upkDir);
+
+    // Reads the header of a single package.
+    static EPackageKind ScanPackage(const fs::path& path);
+
+    const unordered_map<string, Entry>& GetEntries() const { return Entries; }
+    size_t GetNumScanned() const { return NumScanned; }
+
+private:
+    unordered_map<string, Entry> Entries;
+    size_t NumScanned = 0;
+};
@@ -0,0 +1,216 @@
+#include "pch.h"
+#include "UpkReader.h"
+
+#include <cstring>
+
+// Package versions that changed the header layout
+constexpr uint16_t VER_TOTAL_HEADER_SIZE = 249;
+constexpr uint16_t VER_GENERATION_NET_OBJECTS = 322;
+constexpr uint16_t VER_DEPENDS_OFFSET = 415;
+constexpr uint16_t VER_EXPORT_PACKAGE_FLAGS = 475;
+constexpr uint16_t VER_COMPONENT_MAP_REMOVED = 543;
+constexpr uint16_t VER_THUMBNAIL_TABLE = 584;
+constexpr uint16_t VER_IMPORT_EXPORT_GUIDS = 623;
+
+constexpr uint32_t PKG_StoreCompressed = 0x02000000;
+constexpr uint32_t COMPRESS_Mask = 0x07;
+
+// Anything beyond these is taken as a sign of a layout we don't understand
+constexpr int32_t MAX_STRING_LENGTH = 1024;
+constexpr int32_t MAX_LIST_LENGTH = 1 << 16;
+
+bool UpkSummary::IsCompressed() const
+{
+    return CompressionFlags != 0 || NumCompressedChunks != 0 || (PackageFlags & PKG_StoreCompressed);
+}
+
+template <typename T> bool UpkReader::Read(T& outValue)
+{
+    if (Data.size() - Pos < sizeof(T))
+    {
+        return false;
+    }
+
+    memcpy(&outValue, Data.data() + Pos, sizeof(T));
+    Pos += sizeof(T);
+    return true;
+}
+
+bool UpkReader::ReadString(string& outString)
+{
+    // Positive lengths are ANSI, negative ones UTF-16. Both include the terminator.
+    int32_t length = 0;
+    if (!Read(length) || length < -MAX_STRING_LENGTH || length > MAX_STRING_LENGTH)
+    {
+        return false;
+    }
+
+    outString.clear();
+    if (length >= 0)
+    {
+        if (Data.size() - Pos < (size_t)length)
+        {
+            return false;
+        }
+
+        outString.assign(Data.data() + Pos, length > 0 ? length - 1 : 0);
+        Pos += length;
+        return true;
+    }
+
+    for (int32_t i = 0; i < -length; i++)
+    {
+        uint16_t c = 0;
+        if (!Read(c))
+        {
+            return false;
+        }
+
+        if (i < -length - 1)
+        {
+            outString.push_back(c < 0x80 ? (char)c : '?');
+        }
+    }
+
+    return true;
+}
+
+bool UpkReader::Skip(size_t numBytes)
+{
+    if (Data.size() - Pos < numBytes)
+    {
+        return false;
+    }
+
+    Pos += numBytes;
+    return true;
+}
+
+bool UpkReader::Seek(int64_t offset)
+{
+    if (offset < 0 || (uint64_t)offset > Data.size())
+    {
+        return false;
+    }
+
+    Pos = (size_t)offset;
+    return true;
+}
+
+bool UpkReader::ReadSummary(UpkSummary& outSummary)
+{
+    uint32_t tag = 0;
+    uint32_t version = 0;
+    if (!Seek(0) || !Read(tag) || tag != UPK_TAG || !Read(version))
+    {
+        return false;
+    }
+
+    auto& s = outSummary;
+    s.FileVersion = version & 0xFFFF;
+    s.LicenseeVersion = version >> 16;
+
+    string folderName;
+    if ((s.FileVersion >= VER_TOTAL_HEADER_SIZE && !Read(s.TotalHeaderSize)) || !ReadString(folderName) ||
+        !Read(s.PackageFlags) || !Read(s.NameCount) || !Read(s.NameOffset) || !Read(s.ExportCount) ||
+        !Read(s.ExportOffset) || !Read(s.ImportCount) || !Read(s.ImportOffset))
+    {
+        return false;
+    }
+
+    // Depends offset, import/export guid table, thumbnail table, package guid
+    size_t numSkipped = (s.FileVersion >= VER_DEPENDS_OFFSET ? 4 : 0) +
+        (s.FileVersion >= VER_IMPORT_EXPORT_GUIDS ? 12 : 0) + (s.FileVersion >= VER_THUMBNAIL_TABLE ? 4 : 0) + 16;
+    if (!Skip(numSkipped) || !Read(s.NumGenerations) || s.NumGenerations < 0 || s.NumGenerations > MAX_LIST_LENGTH)
+    {
+        return false;
+    }
+
+    // Generations, then engine and cooker version
+    size_t generationSize = s.FileVersion >= VER_GENERATION_NET_OBJECTS ? 12 : 8;
+    if (!Skip(s.NumGenerations * generationSize + 8) || !Read(s.CompressionFlags) || !Read(s.NumCompressedChunks))
+    {
+        return false;
+    }
+
+    // Reject anything that doesn't add up, e.g. licensee fields we don't know about
+    return (s.CompressionFlags & ~COMPRESS_Mask) == 0 && s.NumCompressedChunks >= 0 &&
+        s.NumCompressedChunks <= MAX_LIST_LENGTH && s.NameCount >= 0 && s.ExportCount >= 0 && s.ImportCount >= 0 &&
+        s.NameOffset >= 0 && s.ExportOffset >= 0 && (uint64_t)s.NameOffset <= Data.size() &&
+        (uint64_t)s.ExportOffset <= Data.size();
+}
+
+bool UpkReader::ReadNames(const UpkSummary& summary, vector<string>& outNames)
+{
+    if (summary.IsCompressed() || !Seek(summary.NameOffset))
+    {
+        return false;
+    }
+
+    outNames.clear();
+    outNames.reserve(summary.NameCount);
+    for (int32_t i = 0; i < summary.NameCount; i++)
+    {
+        // Each name is followed by its 64-bit object flags
+        if (!ReadString(outNames.emplace_back()) || !Skip(8))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool UpkReader::ReadExports(const UpkSummary& summary, vector<UpkExport>& outExports)
+{
+    if (summary.IsCompressed() || !Seek(summary.ExportOffset))
+    {
+        return false;
+    }
+
+    auto isValidRef = [&](int32_t index) { return index >= -summary.ImportCount && index <= summary.ExportCount; };
+
+    outExports.clear();
+    outExports.reserve(summary.ExportCount);
+    for (int32_t i = 0; i < summary.ExportCount; i++)
+    {
+        auto& e = outExports.emplace_back();
+        int32_t archetypeIndex = 0;
+        if (!Read(e.ClassIndex) || !Read(e.SuperIndex) || !Read(e.OuterIndex) || !Read(e.ObjectName) ||
+            !Read(e.ObjectNameNumber) || !Read(archetypeIndex) || !Read(e.ObjectFlags) || !Read(e.SerialSize) ||
+            !Read(e.SerialOffset))
+        {
+            return false;
+        }
+
+        if (summary.FileVersion < VER_COMPONENT_MAP_REMOVED)
+        {
+            // Component map: name and export index per entry
+            int32_t numComponents = 0;
+            if (!Read(numComponents) || numComponents < 0 || numComponents > MAX_LIST_LENGTH ||
+                !Skip(numComponents * 12))
+            {
+                return false;
+            }
+        }
+
+        // Export flags, then per-generation net object counts, package guid and package flags
+        int32_t numNetObjectCounts = 0;
+        if (!Skip(4) || !Read(numNetObjectCounts) || numNetObjectCounts < 0 ||
+            numNetObjectCounts > MAX_LIST_LENGTH || !Skip(numNetObjectCounts * 4 + 16) ||
+            (summary.FileVersion >= VER_EXPORT_PACKAGE_FLAGS && !Skip(4)))
+        {
+            return false;
+        }
+
+        // A wrong guess about the layout shows up as garbage here
+        if (!isValidRef(e.ClassIndex) || !isValidRef(e.SuperIndex) || !isValidRef(e.OuterIndex) ||
+            e.ObjectName < 0 || e.ObjectName >= summary.NameCount || e.SerialSize < 0 || e.SerialOffset < 0 ||
+            (uint64_t)e.SerialOffset + (uint64_t)e.SerialSize > Data.size())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <span>
+
+constexpr uint32_t UPK_TAG = 0x9E2A83C1;
+
+struct UpkSummary
+{
+    uint16_t FileVersion = 0;
+    uint16_t LicenseeVersion = 0;
+    int32_t TotalHeaderSize = 0;
+    uint32_t PackageFlags = 0;
+    int32_t NameCount = 0;
+    int32_t NameOffset = 0;
+    int32_t ExportCount = 0;
+    int32_t ExportOffset = 0;
+    int32_t ImportCount = 0;
+    int32_t ImportOffset = 0;
+    int32_t NumGenerations = 0;
+    uint32_t CompressionFlags = 0;
+    int32_t NumCompressedChunks = 0;
+
+    // Compressed packages only have their summary stored as-is, so the tables can't be read in place
+    bool IsCompressed() const;
+};
+
+struct UpkExport
+{
+    // Import (< 0) or export (> 0) reference, or 0 if the export is itself a UClass
+    int32_t ClassIndex = 0;
+    int32_t SuperIndex = 0;
+    int32_t OuterIndex = 0;
+    int32_t ObjectName = 0;
+    int32_t ObjectNameNumber = 0;
+    uint64_t ObjectFlags = 0;
+    int32_t SerialSize = 0;
+    int32_t SerialOffset = 0;
+};
+
+// Reads the uncompressed header of a UE3 package (file summary, name table and export
+// table) straight from its bytes. Pure file parsing, nothing here needs the game.
+// Every read is bounds- and sanity-checked; false means the data isn't a layout we know.
+class UpkReader
+{
+public:
+    UpkReader(span<const char> data) : Data(data) {}
+
+    bool ReadSummary(UpkSummary& outSummary);
+    bool ReadNames(const UpkSummary& summary, vector<string>& outNames);
+    bool ReadExports(const UpkSummary& summary, vector<UpkExport>& outExports);
+
+private:
+    template <typename T> bool Read(T& outValue);
+    bool ReadString(string& outString);
+    bool Skip(size_t numBytes);
+    bool Seek(int64_t offset);
+
+    span<const char> Data;
+    size_t Pos = 0;
+};
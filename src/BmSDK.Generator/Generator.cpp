@@ -0,0 +1,200 @@
+#include "pch.h"
+#include "Generator.h"
+#include "Framework/Hash.h"
+#include "Framework/NameCache.h"
+#include "Framework/Parallel.h"
+#include "Framework/Snapshot.h"
+#include "Framework/TreeShaker.h"
+#include "Printer/OutputManifest.h"
+#include "Printer/Printer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#ifdef _WIN32
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+vector<ClassInfo> Generator::Classes = {};
+Arena Generator::InfoArena;
+ClassIndex Generator::Index = {};
+
+static double GetPeakWorkingSetMB()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters = {};
+    counters.cb = sizeof(counters);
+    return GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))
+        ? counters.PeakWorkingSetSize / 1e6 : 0.0;
+#else
+    rusage usage = {};
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss / 1e3 : 0.0;
+#endif
+}
+
+bool Generator::Run(const Snapshot& snapshot, const fs::path& outDir, const fs::path& rootsPath)
+{
+    auto buildStart = chrono::steady_clock::now();
+    auto peakAtStart = GetPeakWorkingSetMB();
+    Classes.clear();
+    InfoArena.Reset();
+    NameCache::Reset();
+
+    auto classObjs = snapshot.GetClasses();
+    Classes.reserve(classObjs.size());
+    for (auto& classObj : classObjs)
+    {
+        Classes.emplace_back(snapshot, classObj, InfoArena);
+    }
+
+    auto buildTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - buildStart);
+    TRACE("Built {} class infos in {} ms", Classes.size(), buildTime.count());
+    auto peakAfterBuild = GetPeakWorkingSetMB();
+    TRACE("Class infos use {:.1f} MB of arena ({:.1f} MB reserved), peak working set {:.1f} MB (+{:.1f} MB here)",
+        InfoArena.BytesUsed() / 1e6, InfoArena.BytesReserved() / 1e6, peakAfterBuild, peakAfterBuild - peakAtStart);
+    NameCache::LogStats();
+
+    // Index classes once, then link them up through the index
+    Index.Build(Classes);
+    for (auto& classObj : Classes)
+    {
+        classObj.ResolveSuper(Index);
+    }
+
+    ClassIndex::NumberTree(Classes);
+    for (auto& classObj : Classes)
+    {
+        classObj.ResolveHierarchyFlags(Index);
+    }
+
+    // Only emit what the SDK roots can reach, if any are configured
+    vector<const ClassInfo*> emittedClasses;
+    emittedClasses.reserve(Classes.size());
+
+    TreeShaker shaker;
+    if (!rootsPath.empty() && shaker.LoadConfig(rootsPath))
+    {
+        auto isReachable = shaker.Shake(snapshot, Classes, Index);
+        for (size_t i = 0; i < Classes.size(); i++)
+        {
+            if (isReachable[i])
+            {
+                emittedClasses.push_back(&Classes[i]);
+            }
+        }
+
+        TRACE("Tree shaking kept {} of {} classes", emittedClasses.size(), Classes.size());
+    }
+    else
+    {
+        for (auto& classObj : Classes)
+        {
+            emittedClasses.push_back(&classObj);
+        }
+    }
+
+    fs::create_directories(outDir);
+
+    // Create package subdirs up front, so workers don't race on them
+    for (auto classObj : emittedClasses)
+    {
+        if (!fs::exists(outDir / classObj->PackageName))
+        {
+            TRACE("Creating output subdir {}", classObj->PackageName);
+            fs::create_directories(outDir / classObj->PackageName);
+        }
+    }
+
+    // Only touch files whose content differs from the last run, so MSBuild
+    // doesn't see every file as modified
+    auto manifestPath = outDir / ".manifest";
+    auto oldManifest = OutputManifest::Load(manifestPath);
+    OutputManifest newManifest;
+    vector<string> failedFiles;
+    mutex newManifestLock;
+    atomic<size_t> numAdded = 0, numChanged = 0, bytesWritten = 0;
+
+    auto emitFile = [&](const fs::path& relPath, const CodeWriter& writer)
+        {
+            auto key = relPath.generic_string();
+            OutputManifest::Entry entry = { Hash::Fnv1a(writer.View()), writer.Size() };
+
+            auto status = oldManifest.Compare(key, entry, outDir / relPath);
+            if (status != OutputManifest::EFileStatus::Unchanged)
+            {
+                if (!writer.WriteToFile(outDir / relPath))
+                {
+                    // Left out of the new manifest, so the next run writes it again. Whatever the
+                    // previous run left there stays until then.
+                    TRACE("Couldn't write file {}", relPath.string());
+                    lock_guard lock(newManifestLock);
+                    failedFiles.push_back(key);
+                    return;
+                }
+
+                (status == OutputManifest::EFileStatus::Added ? numAdded : numChanged)++;
+                bytesWritten += writer.Size();
+            }
+
+            lock_guard lock(newManifestLock);
+            newManifest.Set(key, entry);
+        };
+
+    // Print all classes in parallel. Each file is rendered by its own printer into
+    // its own buffer, and class infos are read-only at this point.
+    auto printStart = chrono::steady_clock::now();
+    Parallel::For(emittedClasses.size(), [&](size_t i)
+        {
+            auto& classObj = *emittedClasses.at(i);
+
+            CodeWriter writer;
+            Printer(writer).PrintFile(classObj);
+            emitFile(fs::path(classObj.PackageName) / (string(classObj.ManagedName) + ".g.cs"), writer);
+        });
+
+    // Print StaticInit file
+    CodeWriter staticInitWriter;
+    Printer(staticInitWriter).PrintStaticInit(emittedClasses);
+    emitFile("StaticInit.g.cs", staticInitWriter);
+
+    // Remove files left over from classes that no longer exist
+    vector<fs::path> orphans;
+    for (auto& entry : fs::recursive_directory_iterator(outDir))
+    {
+        auto relPath = fs::relative(entry.path(), outDir).generic_string();
+        if (entry.is_regular_file() && relPath.ends_with(".g.cs") && !newManifest.Contains(relPath) &&
+            ranges::find(failedFiles, relPath) == failedFiles.end())
+        {
+            orphans.push_back(entry.path());
+        }
+    }
+
+    for (auto& orphan : orphans)
+    {
+        fs::remove(orphan);
+    }
+
+    bool bSucceeded = failedFiles.empty();
+    if (!newManifest.Save(manifestPath))
+    {
+        TRACE("Couldn't write manifest");
+        bSucceeded = false;
+    }
+
+    auto printTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - printStart);
+    TRACE("Done printing {} classes in {} ms ({:.1f} MB written, {:.1f} MB/s)", emittedClasses.size(),
+        printTime.count(), bytesWritten / 1e6, bytesWritten / 1e3 / max<long long>(printTime.count(), 1));
+    TRACE("{} files added, {} changed, {} removed, {} unchanged", numAdded.load(), numChanged.load(),
+        orphans.size(), newManifest.Num() - numAdded - numChanged);
+
+    if (!failedFiles.empty())
+    {
+        TRACE("Failed to write {} files, the SDK is incomplete", failedFiles.size());
+    }
+
+    return bSucceeded;
+}
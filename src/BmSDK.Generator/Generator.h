@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Framework/Arena.h"
+#include "Framework/ClassIndex.h"
+#include "Framework/ClassInfo.h"
+
+class Snapshot;
+
+// Builds class infos from a reflection snapshot and prints the SDK. Doesn't touch
+// the game, so it runs the same in-game and offline (see OfflineMain.cpp).
+class Generator
+{
+private:
+    Generator() = delete;
+
+public:
+    // rootsPath optionally names an SDK roots file; see TreeShaker for the format.
+    // Returns false if any file couldn't be written.
+    static bool Run(const Snapshot& snapshot, const fs::path& outDir, const fs::path& rootsPath = {});
+
+public:
+    static vector<ClassInfo> Classes;
+
+    // Backs every member, array and string of Classes; freed in one shot per run
+    static Arena InfoArena;
+    static ClassIndex Index;
+};
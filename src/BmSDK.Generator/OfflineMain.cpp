@@ -0,0 +1,35 @@
+// Offline entry point. Regenerates the SDK from a snapshot captured in-game
+// (Generated/.snapshot), without the game. Not part of the .asi project; it's built by
+// CMakeLists.txt in this directory, which also works on Linux:
+//
+//   cmake -S src/BmSDK.Generator -B build/generator && cmake --build build/generator
+//   build/generator/BmSDK.Generator.Offline path/to/.snapshot path/to/Generated [path/to/SdkRoots.txt]
+
+#include "pch.h"
+#include "Generator.h"
+#include "Framework/MappedFile.h"
+#include "Framework/Snapshot.h"
+
+int main(int argc, char** argv)
+{
+    if (argc != 3 && argc != 4)
+    {
+        cerr << "Usage: " << argv[0] << " <snapshot> <output dir> [sdk roots]" << endl;
+        return 1;
+    }
+
+    MappedFile file;
+    if (!file.Open(argv[1]))
+    {
+        TRACE("Couldn't open snapshot {}", argv[1]);
+        return 1;
+    }
+
+    Snapshot snapshot;
+    if (!snapshot.Open(file.GetData()))
+    {
+        return 1;
+    }
+
+    return Generator::Run(snapshot, argv[2], argc == 4 ? argv[3] : "") ? 0 : 1;
+}
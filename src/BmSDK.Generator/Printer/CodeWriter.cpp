@@ -0,0 +1,33 @@
+#include "pch.h"
+#include "CodeWriter.h"
+
+#include <fstream>
+
+static constexpr string_view IndentCache = "                                                                ";
+
+CodeWriter& CodeWriter::Indent(int32_t width)
+{
+    while (width > 0)
+    {
+        auto chunk = min<size_t>(width, IndentCache.size());
+        Buffer.append(IndentCache.substr(0, chunk));
+        width -= (int32_t)chunk;
+    }
+
+    return *this;
+}
+
+bool CodeWriter::WriteToFile(const fs::path& path) const
+{
+    // Unbuffered, so the whole file goes out in one write call
+    ofstream file;
+    file.rdbuf()->pubsetbuf(nullptr, 0);
+    file.open(path, ios::trunc | ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file.write(Buffer.data(), Buffer.size());
+    return file.good();
+}
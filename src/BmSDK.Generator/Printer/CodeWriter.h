@@ -0,0 +1,57 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <string_view>
+
+// Growable in-memory buffer for emitted code. A whole file is rendered
+// into one of these, then handed to the OS with a single write.
+class CodeWriter
+{
+public:
+	CodeWriter() { Buffer.reserve(InitialCapacity); }
+
+	CodeWriter& operator<<(string_view text)
+	{
+		Buffer.append(text);
+		return *this;
+	}
+
+	CodeWriter& operator<<(char c)
+	{
+		Buffer.push_back(c);
+		return *this;
+	}
+
+	template <std::integral T>
+		requires(!std::same_as<T, char> && !std::same_as<T, bool>)
+	CodeWriter& operator<<(T value)
+	{
+		char digits[24];
+		auto res = to_chars(begin(digits), end(digits), value);
+		Buffer.append(digits, res.ptr);
+		return *this;
+	}
+
+	// Appends std::format-style output without going through a temporary string.
+	template <typename... TArgs>
+	CodeWriter& Append(format_string<TArgs...> fmt, TArgs&&... args)
+	{
+		format_to(back_inserter(Buffer), fmt, std::forward<TArgs>(args)...);
+		return *this;
+	}
+
+	// Appends the given number of spaces from a shared run of blanks.
+	CodeWriter& Indent(int32_t width);
+
+	// Writes the buffer to the given path, replacing any existing file.
+	bool WriteToFile(const fs::path& path) const;
+
+	string_view View() const { return Buffer; }
+	size_t Size() const { return Buffer.size(); }
+
+private:
+	static constexpr size_t InitialCapacity = 64 * 1024;
+
+	string Buffer;
+};
@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "OutputManifest.h"
+
+#include <fstream>
+
+OutputManifest OutputManifest::Load(const fs::path& path)
+{
+    OutputManifest manifest;
+
+    // Each line is "<hash> <size> <relative path>"
+    ifstream file(path);
+    Entry entry;
+    string relPath;
+    while (file >> hex >> entry.Hash >> dec >> entry.Size >> ws && getline(file, relPath))
+    {
+        manifest.Set(relPath, entry);
+    }
+
+    return manifest;
+}
+
+bool OutputManifest::Save(const fs::path& path) const
+{
+    ofstream file(path, ios::trunc | ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    for (auto& [relPath, entry] : Entries)
+    {
+        file << std::format("{:016x} {} {}\n", entry.Hash, entry.Size, relPath);
+    }
+
+    return file.good();
+}
+
+OutputManifest::EFileStatus OutputManifest::Compare(const string& relPath, const Entry& entry,
+    const fs::path& fullPath) const
+{
+    error_code ec;
+    auto diskSize = fs::file_size(fullPath, ec);
+    if (ec)
+    {
+        return EFileStatus::Added;
+    }
+
+    // Also check the size on disk, in case the file was touched since the last run
+    auto it = Entries.find(relPath);
+    if (it == Entries.end() || it->second.Hash != entry.Hash || it->second.Size != entry.Size ||
+        diskSize != entry.Size)
+    {
+        return EFileStatus::Changed;
+    }
+
+    return EFileStatus::Unchanged;
+}
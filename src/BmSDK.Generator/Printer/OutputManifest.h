@@ -0,0 +1,35 @@
+#pragma once
+
+#include <unordered_map>
+
+// Remembers the content hash of every file written by the previous run,
+// so unchanged files can be left untouched on disk.
+class OutputManifest
+{
+public:
+	enum class EFileStatus
+	{
+		Unchanged,
+		Added,
+		Changed,
+	};
+
+	struct Entry
+	{
+		uint64_t Hash = 0;
+		uint64_t Size = 0;
+	};
+
+	static OutputManifest Load(const fs::path& path);
+	bool Save(const fs::path& path) const;
+
+	// Compares freshly rendered content against what the previous run wrote to fullPath.
+	EFileStatus Compare(const string& relPath, const Entry& entry, const fs::path& fullPath) const;
+
+	void Set(const string& relPath, const Entry& entry) { Entries[relPath] = entry; }
+	bool Contains(const string& relPath) const { return Entries.contains(relPath); }
+	size_t Num() const { return Entries.size(); }
+
+private:
+	unordered_map<string, Entry> Entries;
+};
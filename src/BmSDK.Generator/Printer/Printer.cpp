@@ -2,89 +2,89 @@
 #include "Printer.h"
 #include "Framework/ClassInfo.h"
 
-int Printer::IndentLevel = 0;
+#include <algorithm>
 
-void Printer::PrintFile(const ClassInfo& _class, ostream& out)
+void Printer::PrintFile(const ClassInfo& _class)
 {
     // Print preprocessor directives
-    Printer::Indent(out) << "#pragma warning disable CS0108" << endl;
-    Printer::Indent(out) << "#pragma warning disable CS1591" << endl;
-    out << endl;
+    Indent() << "#pragma warning disable CS0108" << '\n';
+    Indent() << "#pragma warning disable CS1591" << '\n';
+    out << '\n';
 
     // Print namespace declaration
-    Printer::Indent(out) << "namespace " << _class.PackageNameManaged << ";" << endl;
-    out << endl;
+    Indent() << "namespace " << _class.PackageNameManaged << ";" << '\n';
+    out << '\n';
 
     // Print type
     if (_class.IsInterface)
     {
         // Print interface declaration
-        Printer::PrintInterface(_class, out);
+        PrintInterface(_class);
     }
     else
     {
         // Print class declaration
-        Printer::PrintClass(_class, out);
+        PrintClass(_class);
     }
 }
 
-void Printer::PrintInterface(const ClassInfo& _class, ostream& out)
+void Printer::PrintInterface(const ClassInfo& _class)
 {
     // Print interface comment
-    Printer::Indent(out) << "/// <summary>" << endl;
-    Printer::Indent(out) << "/// Interface: " << _class.ManagedName << "<br/>" << endl;
-    Printer::Indent(out) << "/// (size = " << _class.PropertiesSize << ")" << endl;
-    Printer::Indent(out) << "/// (flags = " << _class.Flags << ")" << endl;
-    Printer::Indent(out) << "/// </summary>" << endl;
+    Indent() << "/// <summary>" << '\n';
+    Indent() << "/// Interface: " << _class.ManagedName << "<br/>" << '\n';
+    Indent() << "/// (size = " << _class.PropertiesSize << ")" << '\n';
+    Indent() << "/// (flags = " << _class.Flags << ")" << '\n';
+    Indent() << "/// </summary>" << '\n';
 
     // Print interface declaration
-    Printer::Indent(out) << "public partial interface " << _class.ManagedName;
+    Indent() << "public partial interface " << _class.ManagedName;
 
     // Workaround to prevent Core.Interface from trying to inherit GameObject
     if (_class.PathName != "Core.Interface" && _class.Super)
     {
         out << " : " << _class.Super->PackageNameManaged << "." << _class.Super->ManagedName;
     }
-    out << endl;
+    out << '\n';
 
     // Print interface body
-    Printer::Indent(out) << "{" << endl;
-    Printer::PushIndent();
+    Indent() << "{" << '\n';
+    PushIndent();
     {
         for (auto i = 0u; i < _class.Members.size(); i++)
         {
-            auto member = _class.Members[i];
-            if (!dynamic_cast<PropertyInfo*>(member))
+            auto& member = _class.Members[i];
+            if (member.Kind != EMemberKind::Property)
             {
-                Printer::PrintMember(member, true, out);
+                PrintMember(member, true);
 
                 if (i < _class.Members.size() - 1)
                 {
-                    out << endl;
+                    out << '\n';
                 }
             }
         }
     }
-    Printer::PopIndent();
-    Printer::Indent(out) << "}" << endl;
+    PopIndent();
+    Indent() << "}" << '\n';
 }
 
-void Printer::PrintClass(const ClassInfo& _class, ostream& out)
+void Printer::PrintClass(const ClassInfo& _class)
 {
     // Print class comment
-    Printer::Indent(out) << "/// <summary>" << endl;
-    Printer::Indent(out) << "/// ";
+    Indent() << "/// <summary>" << '\n';
+    Indent() << "/// ";
     if (_class.IsAbstract)
     {
         out << "ABSTRACT ";
     }
-    Printer::Indent(out) << "Class: " << _class.ManagedName << "<br/>" << endl;
-    Printer::Indent(out) << "/// (size = " << _class.PropertiesSize << ")" << endl;
-    Printer::Indent(out) << "/// (flags = " << _class.Flags << ")" << endl;
-    Printer::Indent(out) << "/// </summary>" << endl;
+    Indent() << "Class: " << _class.ManagedName << "<br/>" << '\n';
+    Indent() << "/// (size = " << _class.PropertiesSize << ")" << '\n';
+    Indent() << "/// (flags = " << _class.Flags << ")" << '\n';
+    Indent() << "/// </summary>" << '\n';
 
     // Print class declaration
-    Printer::Indent(out) << "public partial class " << _class.ManagedName << " : ";
+    Indent() << "public partial class " << _class.ManagedName << " : ";
     // Print base class
     if (_class.Super)
     {
@@ -98,64 +98,64 @@ void Printer::PrintClass(const ClassInfo& _class, ostream& out)
             out << interfaceName << ", ";
         }
     }
-    out << "BmSDK.IGameObject" << endl;
+    out << "BmSDK.IGameObject" << '\n';
 
     // Print class body
-    Printer::Indent(out) << "{" << endl;
-    Printer::PushIndent();
+    Indent() << "{" << '\n';
+    PushIndent();
     {
         // Print StaticClass() helper
-        Printer::Indent(out) << "static BmSDK.Class s_staticClass = null;" << endl;
-        Printer::Indent(out) << "public static BmSDK.Class StaticClass()" << endl;
-        Printer::Indent(out) << "{" << endl;
-        Printer::PushIndent();
+        Indent() << "static BmSDK.Class s_staticClass = null;" << '\n';
+        Indent() << "public static BmSDK.Class StaticClass()" << '\n';
+        Indent() << "{" << '\n';
+        PushIndent();
         {
-            Printer::Indent(out) << "if (s_staticClass is null)" << endl;
-            Printer::Indent(out) << "{" << endl;
-            Printer::PushIndent();
+            Indent() << "if (s_staticClass is null)" << '\n';
+            Indent() << "{" << '\n';
+            PushIndent();
             {
-                Printer::Indent(out)
+                Indent()
                     << "s_staticClass = StaticFindObjectChecked<Class>(null, null, \""
-                    << _class.PathName << "\", false);" << endl;
-                Printer::Indent(out) << "s_staticClass.AddToRoot();" << endl;
+                    << _class.PathName << "\", false);" << '\n';
+                Indent() << "s_staticClass.AddToRoot();" << '\n';
             }
-            Printer::PopIndent();
-            Printer::Indent(out) << "}" << endl;
+            PopIndent();
+            Indent() << "}" << '\n';
 
-            Printer::Indent(out) << "return s_staticClass;" << endl;
+            Indent() << "return s_staticClass;" << '\n';
         }
-        Printer::PopIndent();
-        Printer::Indent(out) << "}" << endl;
+        PopIndent();
+        Indent() << "}" << '\n';
 
-        out << endl;
+        out << '\n';
 
         // Print strongly-typed CDO getter.
         if (_class.ManagedName != "Class")
         {
-            Printer::Indent(out) << "/// <summary>" << endl;
-            Printer::Indent(out) << "/// Gets the class default object as "
-                << _class.ManagedName << "." << endl;
-            Printer::Indent(out) << "/// </summary>" << endl;
-            Printer::Indent(out) << "public static " << _class.ManagedName
+            Indent() << "/// <summary>" << '\n';
+            Indent() << "/// Gets the class default object as "
+                << _class.ManagedName << "." << '\n';
+            Indent() << "/// </summary>" << '\n';
+            Indent() << "public static " << _class.ManagedName
                 << " DefaultObject => (" << _class.ManagedName
-                << ")StaticClass().DefaultObject;" << endl;
+                << ")StaticClass().DefaultObject;" << '\n';
 
-            out << endl;
+            out << '\n';
         }
 
         // Print internal ctor
-        Printer::Indent(out) << "internal " << _class.ManagedName << "() { }" << endl << endl;
+        Indent() << "internal " << _class.ManagedName << "() { }" << "\n\n";
 
         // Print main ctor (unless abstract)
         if (!_class.IsAbstract)
         {
-            Printer::Indent(out) << "/// <summary>" << endl;
-            Printer::Indent(out) << "/// Constructs a new " << _class.ManagedName << endl;
-            Printer::Indent(out) << "/// </summary>" << endl;
+            Indent() << "/// <summary>" << '\n';
+            Indent() << "/// Constructs a new " << _class.ManagedName << '\n';
+            Indent() << "/// </summary>" << '\n';
 
             if (_class.IsActor)
             {
-                Printer::Indent(out)
+                Indent()
                     << "public " << _class.ManagedName
                     << "(System.Numerics.Vector3 Location = default, "
                     "BmSDK.Rotator Rotation = default, "
@@ -165,41 +165,41 @@ void Printer::PrintClass(const ClassInfo& _class, ostream& out)
                     "BmSDK.Engine.Level Level = null) "
                     ": base(BmSDK.Framework.Game.SpawnActorInternal(StaticClass(), "
                     "default, Location, Rotation, Template, Owner, Instigator, Level)) { }"
-                    << endl
-                    << endl;
+                    << '\n'
+                    << '\n';
             }
             else
             {
-                Printer::Indent(out)
+                Indent()
                     << "public " << _class.ManagedName
                     << "(BmSDK.GameObject Outer, string Name = null, "
                     "BmSDK.GameObject.EObjectFlags SetFlags = 0, "
                     << _class.ManagedName
                     << " Template = null) : base(ConstructObjectInternal(StaticClass(), "
                     "Outer, Name, SetFlags, Template)) { }"
-                    << endl
-                    << endl;
+                    << '\n'
+                    << '\n';
             }
         }
 
         // Print pointer ctor
-        Printer::Indent(out) << "/// <summary>" << endl;
-        Printer::Indent(out)
-            << "/// Constructs a new wrapper instance from the given object pointer." << endl;
-        Printer::Indent(out) << "/// </summary>" << endl;
-        Printer::Indent(out) << "protected " << _class.ManagedName << "(nint ptr)";
+        Indent() << "/// <summary>" << '\n';
+        Indent()
+            << "/// Constructs a new wrapper instance from the given object pointer." << '\n';
+        Indent() << "/// </summary>" << '\n';
+        Indent() << "protected " << _class.ManagedName << "(nint ptr)";
         if (_class.Name == "Object")
         {
-            out << " { Ptr = ptr; }" << endl;
+            out << " { Ptr = ptr; }" << '\n';
         }
         else
         {
-            out << " : base(ptr) { }" << endl;
+            out << " : base(ptr) { }" << '\n';
         }
-        out << endl;
+        out << '\n';
 
         // Print strongly-typed ScriptComponent helpers
-        Printer::PrintScHelpers(_class, out);
+        PrintScHelpers(_class);
 
         // Print fields
         for (auto i = 0u; i < _class.Members.size(); i++)
@@ -211,144 +211,269 @@ void Printer::PrintClass(const ClassInfo& _class, ostream& out)
                 break;
             }
 
-            Printer::PrintMember(_class.Members[i], false, out);
+            PrintMember(_class.Members[i], false);
 
             if (i < _class.Members.size() - 1)
             {
-                out << endl;
+                out << '\n';
             }
         }
     }
-    Printer::PopIndent();
-    Printer::Indent(out) << "}" << endl;
+    PopIndent();
+    Indent() << "}" << '\n';
 }
 
-void Printer::PrintScHelpers(const ClassInfo& _class, ostream& out)
+void Printer::PrintScHelpers(const ClassInfo& _class)
 {
     auto type = _class.ManagedName;
-    Printer::PrintScHelper("void", "AttachScriptComponent", false, false, false, type, out);
-    Printer::PrintScHelper("TComponent", "AttachScriptComponent", true, true, true, type, out);
-    Printer::PrintScHelper("bool", "HasScriptComponent", false, false, false, type, out);
-    Printer::PrintScHelper("bool", "HasScriptComponent", true, false, false, type, out);
-    Printer::PrintScHelper("TComponent", "GetScriptComponent", true, false, true, type, out);
+    PrintScHelper("void", "AttachScriptComponent", false, false, false, type);
+    PrintScHelper("TComponent", "AttachScriptComponent", true, true, true, type);
+    PrintScHelper("bool", "HasScriptComponent", false, false, false, type);
+    PrintScHelper("bool", "HasScriptComponent", true, false, false, type);
+    PrintScHelper("TComponent", "GetScriptComponent", true, false, true, type);
 
     // Print GetScriptComponents (list)
-    Printer::Indent(out) << "/// <inheritdoc cref=\"GameObject.GetScriptComponents(Type)\"/>" << endl;
-    Printer::Indent(out) << "public System.Collections.Generic.IReadOnlyList<TComponent> GetScriptComponents<TComponent>()" << endl;
-    Printer::PushIndent();
-    Printer::Indent(out) << "where TComponent : class, Framework.IScriptComponent<" << type << ">" << endl;
-    Printer::Indent(out) << "=> ((GameObject)this).GetScriptComponents(typeof(TComponent))"
-        << ".Cast<TComponent>().ToList();" << endl;
-    Printer::PopIndent();
-    out << endl;
-
-    Printer::PrintScHelper("void", "DetachScriptComponent", false, false, false, type, out);
-    Printer::PrintScHelper("void", "DetachScriptComponents", true, false, false, type, out);
+    Indent() << "/// <inheritdoc cref=\"GameObject.GetScriptComponents(Type)\"/>" << '\n';
+    Indent() << "public System.Collections.Generic.IReadOnlyList<TComponent> GetScriptComponents<TComponent>()" << '\n';
+    PushIndent();
+    Indent() << "where TComponent : class, Framework.IScriptComponent<" << type << ">" << '\n';
+    Indent() << "=> ((GameObject)this).GetScriptComponents(typeof(TComponent))"
+        << ".Cast<TComponent>().ToList();" << '\n';
+    PopIndent();
+    out << '\n';
+
+    PrintScHelper("void", "DetachScriptComponent", false, false, false, type);
+    PrintScHelper("void", "DetachScriptComponents", true, false, false, type);
 }
 
-void Printer::PrintScHelper(string returnType, string helper, bool generic, bool ctor, bool cast, string type, ostream& out)
+void Printer::PrintScHelper(string_view returnType, string_view helper, bool generic, bool ctor, bool cast, string_view type)
 {
     if (generic)
     {
-        Printer::Indent(out) << "/// <inheritdoc cref=\"GameObject." << helper << "(Type)\"/>" << endl;
-        Printer::Indent(out) << "public " << returnType << " " << helper << "<TComponent>()" << endl;
-        Printer::PushIndent();
-        Printer::Indent(out) << "where TComponent : class, Framework.IScriptComponent<" << type << ">"
-            << (ctor ? ", new()" : "") << endl;
-        Printer::Indent(out) << "=> " << (cast ? "(TComponent)" : "")
-            << "((GameObject)this)." << helper << "(typeof(TComponent));" << endl;
-        Printer::PopIndent();
-        out << endl;
+        Indent() << "/// <inheritdoc cref=\"GameObject." << helper << "(Type)\"/>" << '\n';
+        Indent() << "public " << returnType << " " << helper << "<TComponent>()" << '\n';
+        PushIndent();
+        Indent() << "where TComponent : class, Framework.IScriptComponent<" << type << ">"
+            << (ctor ? ", new()" : "") << '\n';
+        Indent() << "=> " << (cast ? "(TComponent)" : "")
+            << "((GameObject)this)." << helper << "(typeof(TComponent));" << '\n';
+        PopIndent();
+        out << '\n';
     }
     else
     {
-        Printer::Indent(out) << "/// <inheritdoc cref=\"GameObject." << helper << "(Framework.IScriptComponent)\"/>" << endl;
-        Printer::Indent(out) << "public " << returnType << " " << helper << "<TComponent>(TComponent component)" << endl;
-        Printer::PushIndent();
-        Printer::Indent(out) << "where TComponent : class, Framework.IScriptComponent<" << type << ">" << endl;
-        Printer::Indent(out) << "=> ((GameObject)this)." << helper << "((Framework.IScriptComponent)component);" << endl;
-        Printer::PopIndent();
-        out << endl;
+        Indent() << "/// <inheritdoc cref=\"GameObject." << helper << "(Framework.IScriptComponent)\"/>" << '\n';
+        Indent() << "public " << returnType << " " << helper << "<TComponent>(TComponent component)" << '\n';
+        PushIndent();
+        Indent() << "where TComponent : class, Framework.IScriptComponent<" << type << ">" << '\n';
+        Indent() << "=> ((GameObject)this)." << helper << "((Framework.IScriptComponent)component);" << '\n';
+        PopIndent();
+        out << '\n';
     }
 
 }
 
-void Printer::PrintStruct(const StructInfo& _struct, ostream& out)
+// Whether a property's managed type is an unmanaged value type with the same layout as the
+// engine's, so it can be loaded and stored through a typed pointer without MarshalUtil
+static bool IsDirectAccessKind(EPropertyKind kind)
+{
+    switch (kind)
+    {
+        case EPropertyKind::Int:
+        case EPropertyKind::Byte:
+        case EPropertyKind::Float:
+        case EPropertyKind::Name:
+        case EPropertyKind::Struct:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Whether the managed value has exactly the engine's size, so reads, writes and spans through
+// a typed pointer stay inside the property. Anything else is marshalled instead.
+static bool HasDirectLayout(const PropertyInfo& prop)
+{
+    return IsDirectAccessKind(prop.Kind) && prop.ManagedSize == prop.ElementSize;
+}
+
+// Whether a struct member can be a plain [FieldOffset] field instead of an accessor property
+static bool CanPrintAsField(const PropertyInfo& prop, int32_t structSize)
+{
+    if (prop.ArrayDim != 1 || (!prop.IsBool && !IsDirectAccessKind(prop.Kind)))
+    {
+        return false;
+    }
+
+    // Layout self-check: the managed field (or shared int for bools) has to be exactly as big as
+    // the engine's, and fit. Anything else would overlap its neighbours or grow the managed struct.
+    auto managedSize = prop.IsBool ? (int32_t)sizeof(int32_t) : prop.ManagedSize;
+    if (managedSize != prop.ElementSize)
+    {
+        TRACE("Member {} is {} bytes but its managed type is {}, keeping accessor", prop.Name,
+            prop.ElementSize, managedSize);
+        return false;
+    }
+
+    if (prop.Offset < 0 || prop.Offset + prop.ElementSize > structSize)
+    {
+        TRACE("Member {} at offset {} doesn't fit in {} bytes, keeping accessor", prop.Name, prop.Offset,
+            structSize);
+        return false;
+    }
+
+    return true;
+}
+
+static string GetBitfieldName(int32_t offset)
+{
+    return "_bitfield" + to_string(offset);
+}
+
+void Printer::PrintStruct(const StructInfo& _struct)
 {
     // Print struct comment
-    Printer::Indent(out) << "/// <summary>" << endl;
-    Printer::Indent(out) << "/// Struct: " << _struct.ManagedName << endl;
-    Printer::Indent(out) << "/// </summary>" << endl;
+    Indent() << "/// <summary>" << '\n';
+    Indent() << "/// Struct: " << _struct.ManagedName << '\n';
+    Indent() << "/// </summary>" << '\n';
 
     // Print struct declaration
-    Printer::Indent(out) << "[StructLayout(LayoutKind.Explicit, Size = " << _struct.PropertiesSize
-        << ")]" << endl;
-    Printer::Indent(out) << "public partial record struct " << _struct.ManagedName << endl;
+    Indent() << "[StructLayout(LayoutKind.Explicit, Size = " << _struct.PropertiesSize
+        << ")]" << '\n';
+    Indent() << "public partial record struct " << _struct.ManagedName << '\n';
 
     // Print struct body
-    Printer::Indent(out) << "{" << endl;
-    Printer::PushIndent();
+    Indent() << "{" << '\n';
+    PushIndent();
     {
+        vector<bool> isField(_struct.Members.size());
+        for (auto i = 0u; i < _struct.Members.size(); i++)
+        {
+            auto& member = _struct.Members[i];
+            isField[i] = member.Kind == EMemberKind::Property &&
+                CanPrintAsField(*member.Property, _struct.PropertiesSize);
+        }
+
+        // Bools packed into the same int share one backing field. Being a field, it takes part in
+        // the record's equality (ToString only shows the bool properties).
+        vector<int32_t> bitfieldOffsets;
+        for (auto i = 0u; i < _struct.Members.size(); i++)
+        {
+            auto& member = _struct.Members[i];
+            if (isField[i] && member.Property->IsBool &&
+                ranges::find(bitfieldOffsets, member.Property->Offset) == bitfieldOffsets.end())
+            {
+                bitfieldOffsets.push_back(member.Property->Offset);
+            }
+        }
+
+        for (auto offset : bitfieldOffsets)
+        {
+            Indent() << "[FieldOffset(" << offset << ")] private int " << GetBitfieldName(offset) << ";" << '\n';
+        }
+
+        if (!bitfieldOffsets.empty() && !_struct.Members.empty())
+        {
+            out << '\n';
+        }
+
         for (auto i = 0u; i < _struct.Members.size(); i++)
         {
-            Printer::PrintMember(_struct.Members[i], false, out);
+            auto& member = _struct.Members[i];
+            if (isField[i])
+            {
+                PrintStructField(*member.Property);
+            }
+            else
+            {
+                PrintMember(member, false);
+            }
 
             if (i < _struct.Members.size() - 1)
             {
-                out << endl;
+                out << '\n';
             }
         }
     }
-    Printer::PopIndent();
-    Printer::Indent(out) << "}" << endl;
+    PopIndent();
+    Indent() << "}" << '\n';
 }
 
-void Printer::PrintEnum(const EnumInfo& _enum, ostream& out)
+void Printer::PrintStructField(const PropertyInfo& prop)
 {
     // Print prop comment
-    Printer::Indent(out) << "/// <summary>" << endl;
-    Printer::Indent(out) << "/// Enum: " << _enum.Name << endl;
-    Printer::Indent(out) << "/// </summary>" << endl;
+    Indent() << "/// <summary>" << '\n';
+    Indent() << "/// " << prop.ClassName << ": " << prop.Name << '\n';
+    Indent() << "/// </summary>" << '\n';
+
+    if (prop.IsBool)
+    {
+        auto bitfieldName = GetBitfieldName(prop.Offset);
+        Indent() << "public bool " << prop.ManagedName << '\n';
+        Indent() << "{" << '\n';
+        PushIndent();
+        {
+            Indent() << "readonly get => (" << bitfieldName << " & " << prop.BitMask << ") != 0;" << '\n';
+            Indent() << "set { if (value) " << bitfieldName << " |= " << prop.BitMask << "; else "
+                << bitfieldName << " &= ~" << prop.BitMask << "; }" << '\n';
+        }
+        PopIndent();
+        Indent() << "}" << '\n';
+    }
+    else
+    {
+        Indent() << "[FieldOffset(" << prop.Offset << ")] public " << prop.TypeName << " " << prop.ManagedName
+            << ";" << '\n';
+    }
+}
+
+void Printer::PrintEnum(const EnumInfo& _enum)
+{
+    // Print prop comment
+    Indent() << "/// <summary>" << '\n';
+    Indent() << "/// Enum: " << _enum.Name << '\n';
+    Indent() << "/// </summary>" << '\n';
 
     // Print prop declaration
-    Printer::Indent(out) << "public enum " << _enum.ManagedName << " : byte" << endl;
+    Indent() << "public enum " << _enum.ManagedName << " : byte" << '\n';
 
     // Print prop body
-    Printer::Indent(out) << "{" << endl;
-    Printer::PushIndent();
+    Indent() << "{" << '\n';
+    PushIndent();
     {
         for (auto i = 0u; i < _enum.Names.size(); i++)
         {
-            Printer::Indent(out) << _enum.Names.at(i) << " = " << i << "," << endl;
+            Indent() << _enum.Names[i] << " = " << i << "," << '\n';
         }
     }
-    Printer::PopIndent();
-    Printer::Indent(out) << "}" << endl;
+    PopIndent();
+    Indent() << "}" << '\n';
 }
 
-void Printer::PrintProperty(const PropertyInfo& prop, ostream& out)
+void Printer::PrintProperty(const PropertyInfo& prop)
 {
     if (!prop.IsInStruct && prop.ArrayDim > 1)
     {
-        Printer::Indent(out) << "/// <summary>" << endl;
-        Printer::Indent(out) << "/// InlineArray{" << prop.ClassName << "}: " << prop.Name << endl;
-        Printer::Indent(out) << "/// </summary>" << endl;
+        Indent() << "/// <summary>" << '\n';
+        Indent() << "/// InlineArray{" << prop.ClassName << "}: " << prop.Name << '\n';
+        Indent() << "/// </summary>" << '\n';
 
-        Printer::Indent(out) << "public InlineArray<" << prop.TypeName << "> "
+        // Elements with a direct layout can also be viewed as a span, through AsSpan()
+        Indent() << "public InlineArray<" << prop.TypeName << "> "
             << prop.ManagedName << " => new(" << prop.ArrayDim
             << ", Ptr + " << prop.Offset << ", " << prop.ElementSize << ", this);"
-            << endl << endl;
+            << "\n\n";
     }
 
     for (auto i = 0; i < prop.ArrayDim; i++)
     {
         auto propOffset = prop.Offset + (i * prop.ElementSize);
-        auto propNameManaged = prop.ManagedName;
+        auto propNameManaged = string(prop.ManagedName);
 
         // Print prop comment
-        Printer::Indent(out) << "/// <summary>" << endl;
-        Printer::Indent(out) << "/// " << prop.ClassName << ": " << prop.Name << endl;
-        Printer::Indent(out) << "/// </summary>" << endl;
+        Indent() << "/// <summary>" << '\n';
+        Indent() << "/// " << prop.ClassName << ": " << prop.Name << '\n';
+        Indent() << "/// </summary>" << '\n';
 
         if (prop.ArrayDim > 1)
         {
@@ -358,26 +483,26 @@ void Printer::PrintProperty(const PropertyInfo& prop, ostream& out)
 
         if (prop.ShouldReturnByRef)
         {
-            Printer::Indent(out) << "public unsafe ref " << prop.TypeName << " "
-                << propNameManaged << endl;
+            Indent() << "public unsafe ref " << prop.TypeName << " "
+                << propNameManaged << '\n';
 
-            Printer::PushIndent();
-            Printer::Indent(out) << "=> ref BmSDK.Framework.MarshalUtil.AsRef<"
-                << prop.TypeName << ">(Ptr + " << propOffset << ");" << endl;
-            Printer::PopIndent();
+            PushIndent();
+            Indent() << "=> ref BmSDK.Framework.MarshalUtil.AsRef<"
+                << prop.TypeName << ">(Ptr + " << propOffset << ");" << '\n';
+            PopIndent();
         }
         else
         {
             // Print prop declaration
-            Printer::Indent(out) << "public unsafe " << prop.TypeName << " "
-                << propNameManaged << endl;
+            Indent() << "public unsafe " << prop.TypeName << " "
+                << propNameManaged << '\n';
 
             // Print prop body
-            Printer::Indent(out) << "{" << endl;
-            Printer::PushIndent();
+            Indent() << "{" << '\n';
+            PushIndent();
             {
                 // Print prop getter (single line)
-                Printer::Indent(out) << "get { ";
+                Indent() << "get { ";
                 {
                     // Make Ptr available locally so we can reuse the same getter code
                     if (prop.IsInStruct)
@@ -388,8 +513,11 @@ void Printer::PrintProperty(const PropertyInfo& prop, ostream& out)
                     // Booleans (stored as bitmasks) need special handling
                     if (prop.IsBool)
                     {
-                        out << "return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + " << propOffset
-                            << ") & " << prop.BitMask << ") != 0;";
+                        out << "return (*(int*)(Ptr + " << propOffset << ") & " << prop.BitMask << ") != 0;";
+                    }
+                    else if (HasDirectLayout(prop))
+                    {
+                        out << "return *(" << prop.TypeName << "*)(Ptr + " << propOffset << ");";
                     }
                     else
                     {
@@ -402,10 +530,10 @@ void Printer::PrintProperty(const PropertyInfo& prop, ostream& out)
                         out << " };";
                     }
                 }
-                out << " }" << endl;
+                out << " }" << '\n';
 
                 // Print prop setter (single line)
-                Printer::Indent(out) << "set { ";
+                Indent() << "set { ";
                 {
                     // Make Ptr available locally so we can reuse the same setter code
                     if (prop.IsInStruct)
@@ -416,13 +544,12 @@ void Printer::PrintProperty(const PropertyInfo& prop, ostream& out)
                     // Booleans (stored as bitmasks) need special handling
                     if (prop.IsBool)
                     {
-                        out << "var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + "
-                            << propOffset << ");";
-                        out << " var newMask = value ? (currentMask | " << prop.BitMask
-                            << ") : (currentMask & ~" << prop.BitMask << ");";
-
-                        out << " BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + "
-                            << propOffset << ");";
+                        out << "if (value) *(int*)(Ptr + " << propOffset << ") |= " << prop.BitMask << ";";
+                        out << " else *(int*)(Ptr + " << propOffset << ") &= ~" << prop.BitMask << ";";
+                    }
+                    else if (HasDirectLayout(prop))
+                    {
+                        out << "*(" << prop.TypeName << "*)(Ptr + " << propOffset << ") = value;";
                     }
                     else
                     {
@@ -435,23 +562,140 @@ void Printer::PrintProperty(const PropertyInfo& prop, ostream& out)
                         out << " };";
                     }
                 }
-                out << " }" << endl;
+                out << " }" << '\n';
             }
-            Printer::PopIndent();
-            Printer::Indent(out) << "}" << endl;
+            PopIndent();
+            Indent() << "}" << '\n';
+        }
+    }
+}
+
+// How a function parameter is stored in its generated params struct
+enum class EParamFieldKind
+{
+    // Not representable as a plain field, so marshalled generically at its offset
+    None,
+    // Stored as its own managed type
+    Value,
+    // Stored as a 32-bit int, like UBoolProperty
+    Bool,
+    // Stored as the raw object pointer
+    Object,
+};
+
+static EParamFieldKind GetParamFieldKind(const PropertyInfo& param)
+{
+    if (param.ArrayDim != 1)
+    {
+        return EParamFieldKind::None;
+    }
+
+    // Same layout check as property accessors. A value whose managed type is smaller or bigger
+    // than the engine's would shift or clip the params frame, so it's marshalled at its offset.
+    switch (param.Kind)
+    {
+        case EPropertyKind::Int:
+        case EPropertyKind::Byte:
+        case EPropertyKind::Float:
+        case EPropertyKind::Name:
+        case EPropertyKind::Struct:
+            return HasDirectLayout(param) ? EParamFieldKind::Value : EParamFieldKind::None;
+        case EPropertyKind::Str:
+            // Only ever copied in and out whole, so it doesn't need to be a direct access kind
+            return param.ManagedSize == param.ElementSize ? EParamFieldKind::Value : EParamFieldKind::None;
+        case EPropertyKind::Bool:
+            return EParamFieldKind::Bool;
+        case EPropertyKind::Object:
+        case EPropertyKind::Component:
+        case EPropertyKind::Class:
+            return EParamFieldKind::Object;
+        default:
+            return EParamFieldKind::None;
+    }
+}
+
+// Expression that reads a param back out of the "parms" local after the call
+static string GetParamReadExpr(const PropertyInfo& param)
+{
+    auto name = string(param.ManagedName);
+    auto typeName = string(param.TypeName);
+    switch (GetParamFieldKind(param))
+    {
+        case EParamFieldKind::Value:
+            return "parms." + name;
+        case EParamFieldKind::Bool:
+            return "parms." + name + " != 0";
+        case EParamFieldKind::Object:
+            return "parms." + name + " == 0 ? null : (" + typeName +
+                ")BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms." + name + ")";
+        default:
+            return "BmSDK.Framework.MarshalUtil.ToManaged<" + typeName + ">((byte*)&parms + " +
+                to_string(param.Offset) + ")";
+    }
+}
+
+void Printer::PrintFunctionParams(const FunctionInfo& func, string_view structName)
+{
+    Indent() << "[StructLayout(LayoutKind.Explicit, Size = " << func.PropertiesSize << ")]" << '\n';
+    Indent() << "private struct " << structName << '\n';
+    Indent() << "{" << '\n';
+    PushIndent();
+    {
+        auto printField = [&](const PropertyInfo& param)
+            {
+                string_view fieldType;
+                switch (GetParamFieldKind(param))
+                {
+                    case EParamFieldKind::Value:
+                        fieldType = param.TypeName;
+                        break;
+                    case EParamFieldKind::Bool:
+                        fieldType = "int";
+                        break;
+                    case EParamFieldKind::Object:
+                        fieldType = "nint";
+                        break;
+                    case EParamFieldKind::None:
+                        return;
+                }
+
+                Indent() << "[FieldOffset(" << param.Offset << ")] public " << fieldType << " "
+                    << param.ManagedName << ";" << '\n';
+            };
+
+        for (auto& param : func.Params)
+        {
+            printField(param);
+        }
+
+        if (func.HasReturnParam)
+        {
+            printField(func.ReturnParam);
         }
     }
+    PopIndent();
+    Indent() << "}" << '\n';
 }
 
-void Printer::PrintFunction(const FunctionInfo& func, bool isInInterface, ostream& out)
+void Printer::PrintFunction(const FunctionInfo& func, bool isInInterface)
 {
+    // Print cached function handle, resolved on first call, and the params frame layout
+    string handleName = "s_" + string(func.ManagedName) + "Func";
+    string paramsName = string(func.ManagedName) + "_Params";
+    if (!isInInterface)
+    {
+        Indent() << "static BmSDK.Function " << handleName << " = null;" << '\n';
+        PrintFunctionParams(func, paramsName);
+        out << '\n';
+    }
+
     // Print func comment
-    Printer::Indent(out) << "/// <summary>" << endl;
-    Printer::Indent(out) << "/// Function: " << func.Name << endl;
-    Printer::Indent(out) << "/// </summary>" << endl;
+    Indent() << "/// <summary>" << '\n';
+    Indent() << "/// Function: " << func.Name << '\n';
+    Indent() << "/// </summary>" << '\n';
 
     // Print func declaration
-    Printer::Indent(out) << "public unsafe ";
+    Indent() << "public unsafe ";
     if (func.IsStatic)
     {
         out << "static ";
@@ -497,26 +741,25 @@ void Printer::PrintFunction(const FunctionInfo& func, bool isInInterface, ostrea
     out << ")";
 
     if (isInInterface) {
-        out << ";" << endl;
+        out << ";" << '\n';
         return;
     }
     else {
-        out << endl;
+        out << '\n';
     }
 
     // Print func body
-    Printer::Indent(out) << "{" << endl;
-    Printer::PushIndent();
+    Indent() << "{" << '\n';
+    PushIndent();
     {
         string ptrText = func.IsStatic ? "StaticClass().DefaultObject.Ptr" : "Ptr";
 
-        Printer::Indent(out) << "var funcManaged = "
-            "BmSDK.GameObject.StaticFindObjectChecked<BmSDK."
+        Indent() << "var funcManaged = " << handleName
+            << " \?\?= BmSDK.GameObject.StaticFindObjectChecked<BmSDK."
             "Function>(BmSDK.Function.StaticClass(), null, \""
-            << func.PathName << "\", true);" << endl;
+            << func.PathName << "\", true);" << '\n';
 
-        Printer::Indent(out) << "byte* paramsPtr = stackalloc byte[" << func.PropertiesSize << "];"
-            << endl;
+        Indent() << "var parms = new " << paramsName << "();" << '\n';
         for (auto i = 0u; i < func.Params.size(); i++)
         {
             auto& param = func.Params[i];
@@ -528,32 +771,32 @@ void Printer::PrintFunction(const FunctionInfo& func, bool isInInterface, ostrea
             }
 
             // Print
-            Printer::Indent(out) << "BmSDK.Framework.MarshalUtil.ToUnmanaged("
-                << param.ManagedName << ", paramsPtr + " << param.Offset
-                << ");" << endl;
-        }
-
-        if (func.IsNative)
-        {
-            Printer::Indent(out) << "var oldFlags = funcManaged.FunctionFlags;" << endl;
-            Printer::Indent(out) << "var oldNative = funcManaged.iNative;" << endl;
-            Printer::Indent(out)
-                << "funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;"
-                << endl;
-            Printer::Indent(out)
-                << "funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;"
-                << endl;
-            Printer::Indent(out) << "funcManaged.iNative = 0;" << endl;
+            switch (GetParamFieldKind(param))
+            {
+                case EParamFieldKind::Value:
+                    Indent() << "parms." << param.ManagedName << " = " << param.ManagedName << ";" << '\n';
+                    break;
+                case EParamFieldKind::Bool:
+                    Indent() << "parms." << param.ManagedName << " = " << param.ManagedName
+                        << " ? 1 : 0;" << '\n';
+                    break;
+                case EParamFieldKind::Object:
+                    Indent() << "parms." << param.ManagedName << " = " << param.ManagedName
+                        << "?.Ptr ?? 0;" << '\n';
+                    break;
+                case EParamFieldKind::None:
+                    Indent() << "BmSDK.Framework.MarshalUtil.ToUnmanaged("
+                        << param.ManagedName << ", (byte*)&parms + " << param.Offset
+                        << ");" << '\n';
+                    break;
+            }
         }
 
-        Printer::Indent(out) << "BmSDK.Framework.GameFunctions.ProcessEvent(" << ptrText
-            << ", funcManaged.Ptr, (nint)paramsPtr, 0);" << endl;
-
-        if (func.IsNative)
-        {
-            Printer::Indent(out) << "funcManaged.iNative = oldNative;" << endl;
-            Printer::Indent(out) << "funcManaged.FunctionFlags = oldFlags;" << endl;
-        }
+        // Native functions are called through a script-callable copy, so ProcessEvent takes
+        // the params buffer as-is without us touching the shared UFunction
+        string funcPtrText = func.IsNative ? "funcManaged.ScriptCallablePtr" : "funcManaged.Ptr";
+        Indent() << "BmSDK.Framework.GameFunctions.ProcessEvent(" << ptrText
+            << ", " << funcPtrText << ", (nint)(&parms), 0);" << '\n';
 
         // Marshal/assign out params
         for (auto i = 0u; i < func.Params.size(); i++)
@@ -562,88 +805,101 @@ void Printer::PrintFunction(const FunctionInfo& func, bool isInInterface, ostrea
 
             if (param.IsOutParam)
             {
-                Printer::Indent(out)
-                    << param.ManagedName << " = BmSDK.Framework.MarshalUtil.ToManaged<"
-                    << param.TypeName << ">(paramsPtr + " << param.Offset << ");"
-                    << endl;
+                Indent() << param.ManagedName << " = " << GetParamReadExpr(param) << ";" << '\n';
             }
         }
 
         if (func.HasReturnParam)
         {
             // Print return param declaration
-            Printer::Indent(out) << "return BmSDK.Framework.MarshalUtil.ToManaged<"
-                << func.ReturnParam.TypeName << ">(paramsPtr + "
-                << func.ReturnParam.Offset << ");" << endl;
+            Indent() << "return " << GetParamReadExpr(func.ReturnParam) << ";" << '\n';
         }
         else
         {
-            Printer::Indent(out) << "return;" << endl;
+            Indent() << "return;" << '\n';
         }
     }
-    Printer::PopIndent();
-    Printer::Indent(out) << "}" << endl;
+    PopIndent();
+    Indent() << "}" << '\n';
 }
 
-void Printer::PrintMember(const MemberInfo* member, bool isInInterface, ostream& out)
+void Printer::PrintMember(const MemberRef& member, bool isInInterface)
 {
-    if (auto prop = dynamic_cast<const PropertyInfo*>(member))
+    switch (member.Kind)
     {
-        Printer::PrintProperty(*prop, out);
-    }
-    else if (auto _struct = dynamic_cast<const StructInfo*>(member))
-    {
-        Printer::PrintStruct(*_struct, out);
-    }
-    else if (auto _enum = dynamic_cast<const EnumInfo*>(member))
-    {
-        Printer::PrintEnum(*_enum, out);
-    }
-    else if (auto func = dynamic_cast<const FunctionInfo*>(member))
-    {
-        Printer::PrintFunction(*func, isInInterface, out);
+        case EMemberKind::Property:
+            PrintProperty(*member.Property);
+            break;
+        case EMemberKind::Struct:
+            PrintStruct(*member.Struct);
+            break;
+        case EMemberKind::Enum:
+            PrintEnum(*member.Enum);
+            break;
+        case EMemberKind::Function:
+            PrintFunction(*member.Function, isInInterface);
+            break;
     }
 }
 
-void Printer::PrintStaticInit(const vector<ClassInfo>& classes, ostream& out)
+void Printer::PrintStaticInit(const vector<const ClassInfo*>& classes)
 {
-    // Print usings
-    Printer::Indent(out) << "using System.Collections.Generic;" << endl;
-    out << endl;
-    Printer::Indent(out) << "namespace BmSDK.Framework;" << endl;
-    out << endl;
+    // Sorted by path, so the tables are stable across runs and can be searched without hashing
+    auto sortedClasses = classes;
+    ranges::sort(sortedClasses, {}, [](const ClassInfo* _class) { return string_view(_class->PathName); });
+
+    // Print namespace declaration
+    Indent() << "namespace BmSDK.Framework;" << '\n';
+    out << '\n';
 
     // Print class declaration
-    Printer::Indent(out) << "internal static partial class StaticInit" << endl;
-    Printer::Indent(out) << "{" << endl;
-    Printer::PushIndent();
+    Indent() << "internal static partial class StaticInit" << '\n';
+    Indent() << "{" << '\n';
+    PushIndent();
     {
-        // Print props
-        Printer::Indent(out) << "private static Dictionary<string, Type> _classPathToManagedTypeMap = [];"
-            << endl;
-        Printer::Indent(out) << "private static Dictionary<Type, string> _managedTypeToClassPathMap = [];"
-            << endl;
-        out << endl;
-
-        // Print StaticInitClasses()
-        Printer::Indent(out) << "public static void StaticInitClasses()" << endl;
-        Printer::Indent(out) << "{" << endl;
-        Printer::PushIndent();
+        // Print class paths
+        Indent() << "private static readonly string[] s_classPaths =" << '\n';
+        Indent() << "[" << '\n';
+        PushIndent();
+        for (auto _class : sortedClasses)
+        {
+            Indent() << "\"" << _class->PathName << "\"," << '\n';
+        }
+        PopIndent();
+        Indent() << "];" << '\n';
+        out << '\n';
+
+        // Print managed types, in the same order
+        Indent() << "private static readonly Type[] s_managedTypes =" << '\n';
+        Indent() << "[" << '\n';
+        PushIndent();
+        for (auto _class : sortedClasses)
         {
-            for (auto& _class : classes)
+            Indent() << "typeof(" << _class->PackageNameManaged << "." << _class->ManagedName << ")," << '\n';
+        }
+        PopIndent();
+        Indent() << "];" << '\n';
+        out << '\n';
+
+        // Print depth-first class tree numbering as (pre, post) pairs, in the same order
+        constexpr size_t pairsPerLine = 8;
+        Indent() << "private static readonly int[] s_classTreeIntervals =" << '\n';
+        Indent() << "[" << '\n';
+        PushIndent();
+        for (size_t i = 0; i < sortedClasses.size(); i++)
+        {
+            if (i % pairsPerLine == 0)
             {
-                Printer::Indent(out) << "_classPathToManagedTypeMap[\"" << _class.PathName
-                    << "\"] = typeof(" << _class.PackageNameManaged << "."
-                    << _class.ManagedName << ");" << endl;
-
-                Printer::Indent(out) << "_managedTypeToClassPathMap[typeof("
-                    << _class.PackageNameManaged << "." << _class.ManagedName
-                    << ")] = \"" << _class.PathName << "\";" << endl;
+                Indent();
             }
+
+            auto& tree = sortedClasses[i]->Tree;
+            out << tree.Pre << ", " << tree.Post << ",";
+            out << ((i % pairsPerLine == pairsPerLine - 1 || i == sortedClasses.size() - 1) ? '\n' : ' ');
         }
-        Printer::PopIndent();
-        Printer::Indent(out) << "}" << endl;
+        PopIndent();
+        Indent() << "];" << '\n';
     }
-    Printer::PopIndent();
-    Printer::Indent(out) << "}" << endl;
+    PopIndent();
+    Indent() << "}" << '\n';
 }
@@ -1,40 +1,37 @@
+#pragma once
+
+#include "CodeWriter.h"
+
+// Prints a single output file. Each instance carries its own indentation state,
+// so several printers can run on different threads at once.
 class Printer
 {
-private:
-	Printer() = delete;
-
 public:
-	static void PrintFile(const struct ClassInfo& _class, ostream& out);
-	static void PrintStaticInit(const vector<struct ClassInfo>& classes, ostream& out);
+	Printer(CodeWriter& out) : out(out) {}
 
-private:
-	static void PrintInterface(const struct ClassInfo& _class, ostream& out);
-	static void PrintClass(const struct ClassInfo& _class, ostream& out);
-	static void PrintScHelpers(const struct ClassInfo& _class, ostream& out);
-	static void PrintScHelper(string returnType, string helper, bool generic, bool ctor, bool cast, string type, ostream& out);
-	static void PrintStruct(const struct StructInfo& _struct, ostream& out);
-	static void PrintEnum(const struct EnumInfo& _enum, ostream& out);
-	static void PrintProperty(const struct PropertyInfo& prop, ostream& out);
-	static void PrintFunction(const struct FunctionInfo& func, bool isInInterface, ostream& out);
-	static void PrintMember(const struct MemberInfo* member, bool isInInterface, ostream& out);
+	void PrintFile(const struct ClassInfo& _class);
+	void PrintStaticInit(const vector<const struct ClassInfo*>& classes);
 
-	static void PushIndent() { IndentLevel++; };
-	static void PopIndent() { IndentLevel--; };
+private:
+	void PrintInterface(const struct ClassInfo& _class);
+	void PrintClass(const struct ClassInfo& _class);
+	void PrintScHelpers(const struct ClassInfo& _class);
+	void PrintScHelper(string_view returnType, string_view helper, bool generic, bool ctor, bool cast, string_view type);
+	void PrintStruct(const struct StructInfo& _struct);
+	void PrintEnum(const struct EnumInfo& _enum);
+	void PrintProperty(const struct PropertyInfo& prop);
+	void PrintStructField(const struct PropertyInfo& prop);
+	void PrintFunction(const struct FunctionInfo& func, bool isInInterface);
+	void PrintFunctionParams(const struct FunctionInfo& func, string_view structName);
+	void PrintMember(const struct MemberRef& member, bool isInInterface);
 
-	static ostream& Indent(ostream& out)
-	{
-		for (auto i = 0; i < IndentLevel; i++)
-		{
-			for (auto j = 0; j < IndentSize; j++)
-			{
-				out << ' ';
-			}
-		}
+	void PushIndent() { IndentLevel++; };
+	void PopIndent() { IndentLevel--; };
 
-		return out;
-	};
+	CodeWriter& Indent() { return out.Indent(IndentLevel * IndentSize); };
 
 private:
-	static int32_t IndentLevel;
+	CodeWriter& out;
+	int32_t IndentLevel = 0;
 	static const int32_t IndentSize = 4;
 };
@@ -1,16 +1,17 @@
 #include "pch.h"
 #include "Runtime.h"
+#include "Generator.h"
 #include "Engine\UClass.h"
-#include "Engine\UProperty.h"
 #include "Engine\GameOffsets.h"
 #include "Engine\GameFunctions.h"
-#include "Framework\ClassInfo.h"
-#include "Printer\Printer.h"
+#include "Engine\SnapshotDumper.h"
+#include "Framework\Snapshot.h"
+#include "Framework\UpkIndex.h"
 
 #include <cstdint>
 #include <fstream>
 #include <thread>
-#include <atomic>
+#include <chrono>
 #include <regex>
 
 uintptr_t Runtime::BaseAddress = 0;
@@ -18,7 +19,9 @@ DWORD Runtime::MainThreadId = 0;
 
 TArray<UObject*>* Runtime::GObjects = 0;
 TArray<FNameEntry*>* Runtime::GNames = 0;
-vector<ClassInfo> Runtime::Classes = {};
+
+// TODO: Un-hardcode this
+const fs::path Runtime::OutDir = "..\\..\\..\\src\\BmSDK\\Generated\\";
 
 void Runtime::OnAttach()
 {
@@ -31,15 +34,18 @@ void Runtime::OnAttach()
     // Get the main thread Id
     Runtime::MainThreadId = GetCurrentThreadId();
 
-    // Set global pointers
-    Runtime::GObjects = (TArray<UObject*>*) (Runtime::BaseAddress + GameOffsets::GObjects);
-    Runtime::GNames = (TArray<FNameEntry*>*) (Runtime::BaseAddress + GameOffsets::GNames);
-    GameFunctions::Init(Runtime::BaseAddress);
-
     // Wait for keypress in another thread
     std::thread(
         []()
         {
+            // Scanning for signatures uses worker threads, which can't start under the loader lock
+            GameOffsets::Resolve(Runtime::BaseAddress, OutDir / ".." / "Signatures.txt", OutDir / ".signatures");
+
+            // Set global pointers
+            Runtime::GObjects = (TArray<UObject*>*) (Runtime::BaseAddress + GameOffsets::GObjects);
+            Runtime::GNames = (TArray<FNameEntry*>*) (Runtime::BaseAddress + GameOffsets::GNames);
+            GameFunctions::Init(Runtime::BaseAddress);
+
             TRACE("Press 'P' to start SDK generation");
             while (true)
             {
@@ -54,16 +60,32 @@ void Runtime::OnAttach()
                         continue;
                     }
 
+                    TRACE("Preparing SDK generation");
+                    auto generateStart = chrono::steady_clock::now();
+
+                    // Only touch the game while it's suspended, and only for as long as it
+                    // takes to load packages and copy their reflection data out
                     HANDLE mainThread = OpenThread(THREAD_SUSPEND_RESUME, FALSE, Runtime::MainThreadId);
                     if (mainThread) SuspendThread(mainThread);
 
-                    Runtime::GenerateSDK();
+                    auto snapshotData = Runtime::CaptureSnapshot();
 
                     if (mainThread) {
                         ResumeThread(mainThread);
                         CloseHandle(mainThread);
                     }
-                    break;
+
+                    auto suspendTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - generateStart);
+                    TRACE("Game was suspended for {} ms", suspendTime.count());
+
+                    // Everything from here on works off the snapshot while the game keeps running
+                    bool bSucceeded = Runtime::GenerateSDK(snapshotData);
+
+                    auto generateTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - generateStart);
+                    TRACE("SDK generation took {} ms in total", generateTime.count());
+
+                    // Exit game early
+                    exit(bSucceeded ? 0 : 1);
                 }
                 this_thread::sleep_for(chrono::milliseconds(100));
             }
@@ -73,13 +95,14 @@ void Runtime::OnAttach()
 
 void Runtime::LoadClassesIntoMemory() {
     TRACE("Loading all UPKs into memory");
+    auto loadStart = chrono::steady_clock::now();
 
-    const wregex packageFilter(
+    // These packages are always loaded
+    const wregex loadedFilter(L"^Core$|^Engine$|^BmGame$|^OnlineSubsystem", regex_constants::icase);
+
+    // Fallback for packages whose header couldn't be read: these never contain classes
+    const wregex assetFilter(
         L"(?:"
-        // These packages are always loaded
-        // exact match these names
-        L"^Core$|^Engine$|^BmGame$|^OnlineSubsystem|"
-        // These packages never contain classes
         // match if these are present anywhere
         L"ShaderCache|"
         // match if these are at the start
@@ -87,92 +110,74 @@ void Runtime::LoadClassesIntoMemory() {
         L")",
         regex_constants::icase);
 
+    // Find out which packages export classes from their headers alone
     const auto upkDir = fs::path{ "." } / ".." / ".." / "BmGame" / "CookedPCConsole";
-    for (const auto& entry : fs::directory_iterator(upkDir)) {
-        if (!entry.is_regular_file()) continue;	// filter files
-        if (entry.path().extension() != ".upk") continue;	// filter UPKs
-        auto name = entry.path().stem().wstring();
-
-        // Filter packages that are only for assets
-        if (regex_search(name, packageFilter)) continue;
-
-        GameFunctions::LoadPackage(0, name.c_str(), 0);
+    const auto indexPath = OutDir / ".upkindex";
+    auto index = UpkIndex::Load(indexPath);
+    index.Update(upkDir);
+    fs::create_directories(OutDir);
+    if (!index.Save(indexPath))
+    {
+        TRACE("Couldn't write package index");
     }
-    TRACE("Done loading packages");
-}
-
-void Runtime::GenerateSDK()
-{
-    TRACE("Preparing SDK generation");
-
-    LoadClassesIntoMemory();
 
-    TRACE("Scanning {} objects for classes", Runtime::GObjects->Num);
-
-    Runtime::Classes.clear();
-    for (INT i = 0; i < Runtime::GObjects->Num; i++)
-    {
-        auto obj = Runtime::GObjects->ElementAt(i);
+    size_t numLoaded = 0, numAssetOnly = 0, numUnknown = 0;
+    for (const auto& [packageName, entry] : index.GetEntries()) {
+        auto name = fs::path(packageName).wstring();
+        if (regex_search(name, loadedFilter)) continue;
 
-        bool isValid = obj != nullptr && (Runtime::GObjects->ElementAt(obj->Index) == obj);
-        if (!isValid)
-        {
+        if (entry.Kind == EPackageKind::NoClasses) {
+            numAssetOnly++;
             continue;
         }
 
-        // Collect class objects (but not the CDO)
-        if (obj->Class == UClass::StaticClass() &&
-            !(obj->ObjectFlags & (QWORD)EObjectFlags::RF_ClassDefaultObject))
-        {
-            Runtime::Classes.emplace_back((UClass*)obj);
+        if (entry.Kind == EPackageKind::Unknown) {
+            numUnknown++;
+            if (regex_search(name, assetFilter)) continue;
         }
-    }
 
-    // Clear output directory
-    TRACE("Found {} classes, preparing to print", Classes.size());
-    for (auto& classObj : Classes)
-    {
-        classObj.ResolveSuper(Classes);
+        GameFunctions::LoadPackage(0, name.c_str(), 0);
+        numLoaded++;
     }
 
-    // TODO: Un-hardcode this
-    fs::path outDir = "..\\..\\..\\src\\BmSDK\\Generated\\";
-    fs::remove_all(outDir);
-    fs::create_directory(outDir);
+    auto loadTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - loadStart);
+    TRACE("Package index: {} packages, {} rescanned, {} asset-only, {} unreadable", index.GetEntries().size(),
+        index.GetNumScanned(), numAssetOnly, numUnknown);
+    TRACE("Done loading {} packages in {} ms", numLoaded, loadTime.count());
+}
 
-    // Print some classes
-    for (auto i = 0u; i < Classes.size(); i++)
-    {
-        auto& classObj = Classes.at(i);
-        auto classFilePath =
-            outDir / classObj.PackageName / (classObj.ManagedName + ".g.cs");
+vector<char> Runtime::CaptureSnapshot()
+{
+    LoadClassesIntoMemory();
 
-        if (!fs::exists(classFilePath.parent_path()) &&
-            fs::exists(classFilePath.parent_path().parent_path()))
-        {
-            TRACE("Creating output subdir {}", classFilePath.parent_path().filename().string());
-            fs::create_directories(classFilePath.parent_path());
-        }
+    TRACE("Capturing reflection data from {} objects", Runtime::GObjects->Num);
 
-        ofstream classFileStream(classFilePath, ios::trunc | ios::binary);
-        if (!classFileStream.is_open())
-        {
-            TRACE("Couldn't open file {}", classFilePath.string());
-            continue;
-        }
+    auto captureStart = chrono::steady_clock::now();
+    auto snapshotData = SnapshotDumper().Capture();
 
-        Printer::PrintFile(classObj, classFileStream);
-    }
+    auto captureTime = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - captureStart);
+    TRACE("Captured {:.1f} MB of reflection data in {} ms", snapshotData.size() / 1e6, captureTime.count());
+    FName::LogCacheStats();
 
-    // Print StaticInit file
-    ofstream staticInitFileStream(outDir / "StaticInit.g.cs", ios::trunc | ios::binary);
-    Printer::PrintStaticInit(Classes, staticInitFileStream);
+    return snapshotData;
+}
+
+bool Runtime::GenerateSDK(const vector<char>& snapshotData)
+{
+    fs::create_directories(OutDir);
 
-    TRACE("Done writing {} classes to disk", Classes.size());
+    // Keep a copy on disk, so the SDK can be regenerated without the game (see OfflineMain.cpp)
+    ofstream snapshotFile(OutDir / ".snapshot", ios::binary | ios::trunc);
+    snapshotFile.write(snapshotData.data(), snapshotData.size());
+    if (!snapshotFile)
+    {
+        TRACE("Couldn't write snapshot file");
+    }
+    snapshotFile.close();
 
-    // Exit game early
-    exit(0);
-    return;
+    Snapshot snapshot;
+    ASSERT(snapshot.Open(snapshotData));
+    return Generator::Run(snapshot, OutDir, OutDir / ".." / "SdkRoots.txt");
 }
 
 BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved)
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "Engine\TArray.h"
-#include "Framework\ClassInfo.h"
 
 class UObject;
 class FNameEntry;
@@ -14,7 +13,13 @@ private:
 public:
     static void OnAttach();
     static void LoadClassesIntoMemory();
-    static void GenerateSDK();
+
+    // Runs while the game is suspended: loads class packages and copies out their reflection data.
+    static vector<char> CaptureSnapshot();
+
+    // Runs after the game resumes: builds and writes the SDK from the captured snapshot.
+    // Returns false if the SDK couldn't be written completely.
+    static bool GenerateSDK(const vector<char>& snapshotData);
 
 private:
     static void DetourProcessEvent();
@@ -25,5 +30,7 @@ public:
 
     static TArray<UObject*>* GObjects;
     static TArray<FNameEntry*>* GNames;
-    static vector<ClassInfo> Classes;
+
+    // Where the generated SDK and generator state files are written
+    static const fs::path OutDir;
 };
@@ -1,9 +1,21 @@
 #pragma once
 
 // Windows API
+#ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 typedef unsigned __int64 QWORD;
+#else
+// Offline builds (see OfflineMain.cpp) only need the Windows integer types
+#include <cstdint>
+typedef uint8_t BYTE;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+typedef uint64_t QWORD;
+typedef int32_t INT;
+typedef int32_t BOOL;
+#define FORCEINLINE inline
+#endif
 
 // Standard library
 #include <cstdint>
@@ -41,4 +53,6 @@ private:
 
 // Framework
 #include "Framework/Debug.h"
+#ifdef _WIN32
 #include "Framework/Detours.h"
+#endif
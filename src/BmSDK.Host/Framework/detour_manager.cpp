@@ -1,7 +1,82 @@
+#include <chrono>
+
 #include "detour_manager.h"
 #include "offsets.h"
 #include "../runtime.h"
 
+bool DetourManager::IsBatchOpen = false;
+bool DetourManager::HasBatchFailed = false;
+std::vector<DetourTiming> DetourManager::BatchTimings;
+double DetourManager::BatchCommitMilliseconds = 0;
+
+static double get_milliseconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool DetourManager::BeginBatch() {
+    if (IsBatchOpen || DetourTransactionBegin() != NO_ERROR) {
+        return false;
+    }
+
+    DetourUpdateThread(GetCurrentThread());
+    IsBatchOpen = true;
+    HasBatchFailed = false;
+    BatchTimings.clear();
+    BatchCommitMilliseconds = 0;
+    return true;
+}
+
+bool DetourManager::QueueOperation(LONG (WINAPI* operation)(PVOID*, PVOID), void** ppOrigFunc, void* pDetourFunc, const char* name) {
+    if (!IsBatchOpen) {
+        return false;
+    }
+
+    // Attaching builds the trampoline here, only patching the target is left for the commit
+    auto start = std::chrono::steady_clock::now();
+    bool isQueued = operation(ppOrigFunc, pDetourFunc) == NO_ERROR;
+    BatchTimings.push_back({ name ? name : "", get_milliseconds_since(start) });
+
+    HasBatchFailed |= !isQueued;
+    return isQueued;
+}
+
+bool DetourManager::QueueAttach(void** ppOrigFunc, void* pDetourFunc, const char* name) {
+    return QueueOperation(&DetourAttach, ppOrigFunc, pDetourFunc, name);
+}
+
+bool DetourManager::QueueDetach(void** ppOrigFunc, void* pDetourFunc, const char* name) {
+    return QueueOperation(&DetourDetach, ppOrigFunc, pDetourFunc, name);
+}
+
+bool DetourManager::CommitBatch() {
+    if (!IsBatchOpen) {
+        return false;
+    }
+
+    IsBatchOpen = false;
+
+    // Nothing of a batch is installed unless all of it can be
+    if (HasBatchFailed) {
+        DetourTransactionAbort();
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bool isCommitted = DetourTransactionCommit() == NO_ERROR;
+    BatchCommitMilliseconds = get_milliseconds_since(start);
+    return isCommitted;
+}
+
+bool DetourManager::AbortBatch() {
+    if (!IsBatchOpen) {
+        return false;
+    }
+
+    IsBatchOpen = false;
+    DetourTransactionAbort();
+    return true;
+}
+
 DECLARE_DETOUR(EngineLoopPreInit, int, __fastcall, void*, void*, void*)
 
 static int __fastcall EngineLoopPreInitDetour(void* a1, void* a2, void* Source) {
@@ -20,6 +95,33 @@ void DetourManager::RegisterEngineLoopPreInitDetour() {
     Attach(
         offsets::BaseAddress + offsets::EngineLoopPreInit,
         &EngineLoopPreInit,
-        &EngineLoopPreInitDetour
+        &EngineLoopPreInitDetour,
+        "EngineLoopPreInit"
+    );
+}
+
+DECLARE_DETOUR(ProcessInternal, void, __fastcall, void*, void*, void*, void*)
+
+ProcessInternalFilter DetourManager::ScriptCallFilter;
+static ProcessInternalFunc ProcessInternalManaged = nullptr;
+
+static void __fastcall ProcessInternalDetour(void* self, void* edx, void* Stack, void* Result) {
+    // Only enter .NET for functions something on the managed side is listening to
+    if (DetourManager::ScriptCallFilter.ShouldHandle(Stack)) {
+        ProcessInternalManaged(self, edx, Stack, Result);
+    }
+    else {
+        ProcessInternal(self, edx, Stack, Result);
+    }
+}
+
+void** DetourManager::RegisterProcessInternalDetour(void* managedHandler) {
+    ProcessInternalManaged = (ProcessInternalFunc)managedHandler;
+    bool isAttached = Attach(
+        offsets::BaseAddress + offsets::ProcessInternal,
+        &ProcessInternal,
+        &ProcessInternalDetour,
+        "ProcessInternal"
     );
+    return isAttached ? (void**)&ProcessInternal : nullptr;
 }
@@ -1,29 +1,71 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <Windows.h>
 
 #include <detours/detours.h>
 
+#include "process_internal_filter.h"
+
 #define DECLARE_DETOUR(NAME, RETURN, CONV, ...) \
     using NAME##Func = RETURN (CONV*)(__VA_ARGS__); \
     NAME##Func NAME = nullptr;
 
+struct DetourTiming {
+    std::string Name;
+    double Milliseconds;
+};
+
 class DetourManager {
 private:
     DetourManager() = delete;
 
 public:
     template <typename TFunc>
-    inline static bool Attach(uintptr_t pOrigAddr, TFunc* pOrigFunc, TFunc pDetourFunc) {
+    inline static bool Attach(uintptr_t pOrigAddr, TFunc* pOrigFunc, TFunc pDetourFunc, const char* name) {
         // Set original function reference
         *pOrigFunc = (TFunc)pOrigAddr;
 
-        // Register detour
-        DetourTransactionBegin();
-        DetourUpdateThread(GetCurrentThread());
-        DetourAttach(&(PVOID&)*pOrigFunc, pDetourFunc);
-        return DetourTransactionCommit() == NO_ERROR;
+        // Join the open batch if there is one, otherwise install right away
+        if (IsBatchOpen) {
+            return QueueAttach(&(PVOID&)*pOrigFunc, (PVOID)pDetourFunc, name);
+        }
+
+        bool isQueued = BeginBatch() && QueueAttach(&(PVOID&)*pOrigFunc, (PVOID)pDetourFunc, name);
+        return CommitBatch() && isQueued;
     }
 
+    // Operations queued between BeginBatch() and CommitBatch() are installed in a single
+    // Detours transaction, so the game's threads are only suspended once. Originals are
+    // written back to ppOrigFunc on commit, not before.
+    static bool BeginBatch();
+    static bool QueueAttach(void** ppOrigFunc, void* pDetourFunc, const char* name);
+    static bool QueueDetach(void** ppOrigFunc, void* pDetourFunc, const char* name);
+    static bool CommitBatch();
+    // Drops everything queued since BeginBatch() without installing any of it. False if no
+    // batch was open, e.g. because CommitBatch() already closed it.
+    static bool AbortBatch();
+
+    // Time each operation of the last batch took to queue, and the commit as a whole
+    static const std::vector<DetourTiming>& GetBatchTimings() { return BatchTimings; }
+    static double GetBatchCommitTime() { return BatchCommitMilliseconds; }
+
     static void RegisterEngineLoopPreInitDetour();
+
+    // Installs the native UObject::ProcessInternal() detour. Calls that pass the filter
+    // go to the given managed handler (same signature), which is responsible for calling
+    // the original itself. Returns where the original is written to once committed.
+    static void** RegisterProcessInternalDetour(void* managedHandler);
+
+    static ProcessInternalFilter ScriptCallFilter;
+
+private:
+    static bool QueueOperation(LONG (WINAPI* operation)(PVOID*, PVOID), void** ppOrigFunc, void* pDetourFunc, const char* name);
+
+    static bool IsBatchOpen;
+    static bool HasBatchFailed;
+    static std::vector<DetourTiming> BatchTimings;
+    static double BatchCommitMilliseconds;
 };
@@ -0,0 +1,38 @@
+#include "native_api.h"
+#include "offsets.h"
+
+static void* resolve(uintptr_t offset) {
+    return (void*)(offsets::BaseAddress + offset);
+}
+
+NativeApi make_native_api() {
+    NativeApi api = {};
+    api.Version = NATIVE_API_VERSION;
+    api.Size = sizeof(NativeApi);
+
+    api.BaseAddress = (void*)offsets::BaseAddress;
+    api.GObjObjects = resolve(offsets::GObjObjects);
+    api.GNames = resolve(offsets::GNames);
+    api.GError = resolve(offsets::GError);
+
+    api.AppRealloc = resolve(offsets::AppRealloc);
+    api.AppFree = resolve(offsets::AppFree);
+    api.StaticFindObject = resolve(offsets::StaticFindObject);
+    api.StaticConstructObject = resolve(offsets::StaticConstructObject);
+    api.LoadPackage = resolve(offsets::LoadPackage);
+    api.CollectGarbage = resolve(offsets::CollectGarbage);
+    api.ProcessEvent = resolve(offsets::ProcessEvent);
+    api.CallFunction = resolve(offsets::CallFunction);
+    api.FindFunction = resolve(offsets::FindFunction);
+    api.GetDefaultObject = resolve(offsets::GetDefaultObject);
+    api.SpawnActor = resolve(offsets::SpawnActor);
+    api.NameInit = resolve(offsets::NameInit);
+    api.StringCtor = resolve(offsets::StringCtor);
+
+    api.EngineTick = resolve(offsets::EngineTick);
+    api.AddObject = resolve(offsets::AddObject);
+    api.ConditionalDestroy = resolve(offsets::ConditionalDestroy);
+    api.ConditionalPostLoad = resolve(offsets::ConditionalPostLoad);
+    api.ProcessDeferredMessage = resolve(offsets::ProcessDeferredMessage);
+    return api;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Bump on any layout change, along with NativeApi.CurrentVersion in NativeApi.cs
+inline constexpr uint32_t NATIVE_API_VERSION = 2;
+
+// Engine function pointers and global addresses handed to GuardedDllMain, so managed code
+// can call straight through unmanaged function pointers instead of building delegates from
+// hardcoded offsets. NativeApi.cs mirrors this with explicit offsets; both sides pin the
+// layout at compile time, and the managed side checks Version and Size on entry.
+struct NativeApi {
+    uint32_t Version;
+    uint32_t Size;
+
+    // Globals
+    void* BaseAddress;
+    void* GObjObjects;
+    void* GNames;
+    void* GError;
+
+    // Functions
+    void* AppRealloc;
+    void* AppFree;
+    void* StaticFindObject;
+    void* StaticConstructObject;
+    void* LoadPackage;
+    void* CollectGarbage;
+    void* ProcessEvent;
+    void* CallFunction;
+    void* FindFunction;
+    void* GetDefaultObject;
+    void* SpawnActor;
+    void* NameInit;
+    void* StringCtor;
+
+    // Detour targets
+    void* EngineTick;
+    void* AddObject;
+    void* ConditionalDestroy;
+    void* ConditionalPostLoad;
+    void* ProcessDeferredMessage;
+};
+
+static_assert(sizeof(void*) == 4, "NativeApi.cs assumes the 32-bit game");
+static_assert(offsetof(NativeApi, Version) == 0);
+static_assert(offsetof(NativeApi, Size) == 4);
+static_assert(offsetof(NativeApi, BaseAddress) == 8);
+static_assert(offsetof(NativeApi, GObjObjects) == 12);
+static_assert(offsetof(NativeApi, GNames) == 16);
+static_assert(offsetof(NativeApi, GError) == 20);
+static_assert(offsetof(NativeApi, AppRealloc) == 24);
+static_assert(offsetof(NativeApi, AppFree) == 28);
+static_assert(offsetof(NativeApi, StaticFindObject) == 32);
+static_assert(offsetof(NativeApi, StaticConstructObject) == 36);
+static_assert(offsetof(NativeApi, LoadPackage) == 40);
+static_assert(offsetof(NativeApi, CollectGarbage) == 44);
+static_assert(offsetof(NativeApi, ProcessEvent) == 48);
+static_assert(offsetof(NativeApi, CallFunction) == 52);
+static_assert(offsetof(NativeApi, FindFunction) == 56);
+static_assert(offsetof(NativeApi, GetDefaultObject) == 60);
+static_assert(offsetof(NativeApi, SpawnActor) == 64);
+static_assert(offsetof(NativeApi, NameInit) == 68);
+static_assert(offsetof(NativeApi, StringCtor) == 72);
+static_assert(offsetof(NativeApi, EngineTick) == 76);
+static_assert(offsetof(NativeApi, AddObject) == 80);
+static_assert(offsetof(NativeApi, ConditionalDestroy) == 84);
+static_assert(offsetof(NativeApi, ConditionalPostLoad) == 88);
+static_assert(offsetof(NativeApi, ProcessDeferredMessage) == 92);
+static_assert(sizeof(NativeApi) == 96);
+
+// Builds the table from offsets.h. Needs offsets::BaseAddress to be set.
+NativeApi make_native_api();
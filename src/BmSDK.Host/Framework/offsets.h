@@ -4,5 +4,40 @@
 
 namespace offsets {
     inline uintptr_t BaseAddress = 0;
-    inline constexpr uintptr_t EngineLoopPreInit = 0x7DB210;
+
+    // Everything up to the member offsets can be overridden by signatures (see signatures.h),
+    // these built-in values are for the executable BmSDK was written against
+    inline uintptr_t EngineLoopPreInit = 0x7DB210;
+    inline uintptr_t ProcessInternal = 0x468A0;
+
+    // Globals
+    inline uintptr_t GNames = 0x11EC5E8;
+    inline uintptr_t GObjObjects = 0x122E900;
+    inline uintptr_t GError = 0x117BF48;
+
+    // Functions called from managed code (see native_api.h)
+    inline uintptr_t AppRealloc = 0x1EC10;
+    inline uintptr_t AppFree = 0x1EC30;
+    inline uintptr_t StaticFindObject = 0x8ED20;
+    inline uintptr_t StaticConstructObject = 0x98BE0;
+    inline uintptr_t LoadPackage = 0x9FCA0;
+    inline uintptr_t CollectGarbage = 0xAF0C0;
+    inline uintptr_t ProcessEvent = 0x46A60;
+    inline uintptr_t CallFunction = 0x4F8A0;
+    inline uintptr_t FindFunction = 0x8A980;
+    inline uintptr_t GetDefaultObject = 0x4C8E0;
+    inline uintptr_t SpawnActor = 0x321A20;
+    inline uintptr_t NameInit = 0x7E990;
+    inline uintptr_t StringCtor = 0x4650;
+
+    // Functions detoured from managed code (see native_api.h)
+    inline uintptr_t EngineTick = 0x7D8980;
+    inline uintptr_t AddObject = 0x8E0A0;
+    inline uintptr_t ConditionalDestroy = 0x8C6C0;
+    inline uintptr_t ConditionalPostLoad = 0x9A110;
+    inline uintptr_t ProcessDeferredMessage = 0x7A41F0;
+
+    // Member offsets
+    inline constexpr uintptr_t UObject_Index = 0x4;
+    inline constexpr uintptr_t FFrame_Node = 0x8;
 }
@@ -0,0 +1,36 @@
+#include "process_internal_filter.h"
+#include "offsets.h"
+
+void ProcessInternalFilter::Add(uint32_t funcIndex) {
+    // Object indices only grow as packages load, so grow to fit instead of sizing up front
+    if (funcIndex / 64 >= Bits.size()) {
+        Bits.resize(funcIndex / 64 + 1);
+    }
+
+    Bits[funcIndex / 64] |= 1ull << (funcIndex % 64);
+}
+
+void ProcessInternalFilter::Remove(uint32_t funcIndex) {
+    if (funcIndex / 64 < Bits.size()) {
+        Bits[funcIndex / 64] &= ~(1ull << (funcIndex % 64));
+    }
+}
+
+void ProcessInternalFilter::Clear() {
+    Bits.clear();
+}
+
+bool ProcessInternalFilter::Contains(uint32_t funcIndex) const {
+    return funcIndex / 64 < Bits.size() && (Bits[funcIndex / 64] & (1ull << (funcIndex % 64))) != 0;
+}
+
+bool ProcessInternalFilter::ShouldHandle(const void* stack) const {
+    if (PassAll) {
+        return true;
+    }
+
+    // FFrame::Node is the UFunction being run
+    auto node = *(const uint8_t* const*)((const uint8_t*)stack + offsets::FFrame_Node);
+    auto funcIndex = *(const uint32_t*)(node + offsets::UObject_Index);
+    return Contains(funcIndex);
+}
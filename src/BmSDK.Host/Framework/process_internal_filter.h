@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Decides which UObject::ProcessInternal() calls have to go through managed code, i.e. calls
+// to functions with redirects or lifecycle hooks. Functions are tracked by object index in a
+// bitset, so everything else can run the original without entering .NET.
+// Only reads engine memory through the passed FFrame, so it can be tested without the game.
+class ProcessInternalFilter {
+public:
+    void Add(uint32_t funcIndex);
+    void Remove(uint32_t funcIndex);
+    void Clear();
+    bool Contains(uint32_t funcIndex) const;
+
+    // Lets every call through while set, so redirects see re-entry through overrides too
+    void SetPassAll(bool passAll) { PassAll = passAll; }
+
+    // Whether the call described by the given FFrame has to go to managed code
+    bool ShouldHandle(const void* stack) const;
+
+private:
+    std::vector<uint64_t> Bits;
+    bool PassAll = false;
+};
@@ -0,0 +1,171 @@
+#include "runtime_config.h"
+
+#include <cctype>
+#include <cstdint>
+#include <limits>
+
+enum class ValueKind {
+    Bool,
+    Bytes,
+};
+
+struct KnownKey {
+    std::string_view Key;
+    std::string_view PropertyName;
+    ValueKind Kind;
+};
+
+static constexpr KnownKey KnownKeys[] = {
+    { "ConcurrentGC", "System.GC.Concurrent", ValueKind::Bool },
+    { "ServerGC", "System.GC.Server", ValueKind::Bool },
+    { "GCHeapHardLimit", "System.GC.HeapHardLimit", ValueKind::Bytes },
+    { "TieredCompilation", "System.Runtime.TieredCompilation", ValueKind::Bool },
+    { "TC_QuickJitForLoops", "System.Runtime.TieredCompilation.QuickJitForLoops", ValueKind::Bool },
+    { "TieredPGO", "System.Runtime.TieredPGO", ValueKind::Bool },
+};
+
+static std::string_view trim(std::string_view str) {
+    while (!str.empty() && isspace((unsigned char)str.front())) {
+        str.remove_prefix(1);
+    }
+    while (!str.empty() && isspace((unsigned char)str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+static bool equals_ignore_case(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < a.size(); i++) {
+        if (tolower((unsigned char)a[i]) != tolower((unsigned char)b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool parse_bool(std::string_view value, std::string& outValue) {
+    if (equals_ignore_case(value, "true") || value == "1") {
+        outValue = "true";
+        return true;
+    }
+    if (equals_ignore_case(value, "false") || value == "0") {
+        outValue = "false";
+        return true;
+    }
+    return false;
+}
+
+// Decimal or 0x-prefixed hex, with an optional K/M/G suffix. Normalized to decimal bytes.
+static bool parse_bytes(std::string_view value, std::string& outValue) {
+    uint64_t multiplier = 1;
+    if (!value.empty()) {
+        switch (toupper((unsigned char)value.back())) {
+            case 'K': multiplier = 1ull << 10; break;
+            case 'M': multiplier = 1ull << 20; break;
+            case 'G': multiplier = 1ull << 30; break;
+        }
+        if (multiplier != 1) {
+            value = trim(value.substr(0, value.size() - 1));
+        }
+    }
+
+    uint64_t base = 10;
+    if (value.size() > 2 && value[0] == '0' && (value[1] == 'x' || value[1] == 'X')) {
+        base = 16;
+        value.remove_prefix(2);
+    }
+
+    if (value.empty()) {
+        return false;
+    }
+
+    uint64_t result = 0;
+    for (char c : value) {
+        uint64_t digit = 0;
+        if (isdigit((unsigned char)c)) {
+            digit = c - '0';
+        }
+        else if (base == 16 && isxdigit((unsigned char)c)) {
+            digit = tolower((unsigned char)c) - 'a' + 10;
+        }
+        else {
+            return false;
+        }
+
+        if (result > (std::numeric_limits<uint64_t>::max() - digit) / base) {
+            return false;
+        }
+        result = result * base + digit;
+    }
+
+    if (result > std::numeric_limits<uint64_t>::max() / multiplier) {
+        return false;
+    }
+
+    outValue = std::to_string(result * multiplier);
+    return true;
+}
+
+std::vector<RuntimeProperty> parse_runtime_config(std::string_view text, std::vector<std::string>& outErrors) {
+    std::vector<RuntimeProperty> properties;
+
+    size_t lineNumber = 0;
+    while (!text.empty()) {
+        auto lineEnd = text.find('\n');
+        auto line = text.substr(0, lineEnd);
+        text.remove_prefix(lineEnd == std::string_view::npos ? text.size() : lineEnd + 1);
+        lineNumber++;
+
+        if (auto comment = line.find('#'); comment != std::string_view::npos) {
+            line = line.substr(0, comment);
+        }
+
+        line = trim(line);
+        if (line.empty()) {
+            continue;
+        }
+
+        auto error = [&](const std::string& message) {
+            outErrors.push_back("line " + std::to_string(lineNumber) + ": " + message);
+        };
+
+        auto separator = line.find('=');
+        if (separator == std::string_view::npos) {
+            error("expected Key = Value");
+            continue;
+        }
+
+        auto key = trim(line.substr(0, separator));
+        auto value = trim(line.substr(separator + 1));
+
+        const KnownKey* knownKey = nullptr;
+        for (auto& candidate : KnownKeys) {
+            if (equals_ignore_case(key, candidate.Key)) {
+                knownKey = &candidate;
+                break;
+            }
+        }
+
+        if (!knownKey) {
+            error("unknown key '" + std::string(key) + "'");
+            continue;
+        }
+
+        std::string parsedValue;
+        bool isValid = knownKey->Kind == ValueKind::Bool ? parse_bool(value, parsedValue) : parse_bytes(value, parsedValue);
+        if (!isValid) {
+            error("invalid value '" + std::string(value) + "' for " + std::string(knownKey->Key));
+            continue;
+        }
+
+        // Later lines win, same as setting the property twice would
+        std::erase_if(properties, [&](const RuntimeProperty& prop) { return prop.Name == knownKey->PropertyName; });
+        properties.push_back({ std::string(knownKey->PropertyName), parsedValue });
+    }
+
+    return properties;
+}
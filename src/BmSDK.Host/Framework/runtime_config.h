@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct RuntimeProperty {
+    std::string Name;
+    std::string Value;
+};
+
+// Parses the optional runtime config next to BmSDK.dll into CoreCLR runtime properties.
+// One "Key = Value" per line, '#' starts a comment. Supported keys:
+//
+//   ConcurrentGC = true|false           -> System.GC.Concurrent
+//   ServerGC = true|false               -> System.GC.Server
+//   GCHeapHardLimit = <bytes>[K|M|G]    -> System.GC.HeapHardLimit (also accepts 0x hex)
+//   TieredCompilation = true|false      -> System.Runtime.TieredCompilation
+//   TC_QuickJitForLoops = true|false    -> System.Runtime.TieredCompilation.QuickJitForLoops
+//   TieredPGO = true|false              -> System.Runtime.TieredPGO
+//
+// Invalid lines are skipped and described in outErrors, everything else still applies.
+// No Windows dependencies, so it can be tested anywhere.
+std::vector<RuntimeProperty> parse_runtime_config(std::string_view text, std::vector<std::string>& outErrors);
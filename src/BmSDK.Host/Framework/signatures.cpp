@@ -0,0 +1,97 @@
+#include "signatures.h"
+#include "offsets.h"
+#include "../../BmSDK.Generator/Framework/SignatureScanner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace std::chrono;
+
+struct OffsetTarget {
+    std::string_view Name;
+    uintptr_t* Offset;
+};
+
+static const OffsetTarget OffsetTargets[] = {
+    { "EngineLoopPreInit", &offsets::EngineLoopPreInit },
+    { "ProcessInternal", &offsets::ProcessInternal },
+    { "GNames", &offsets::GNames },
+    { "GObjObjects", &offsets::GObjObjects },
+    { "GError", &offsets::GError },
+    { "AppRealloc", &offsets::AppRealloc },
+    { "AppFree", &offsets::AppFree },
+    { "StaticFindObject", &offsets::StaticFindObject },
+    { "StaticConstructObject", &offsets::StaticConstructObject },
+    { "LoadPackage", &offsets::LoadPackage },
+    { "CollectGarbage", &offsets::CollectGarbage },
+    { "ProcessEvent", &offsets::ProcessEvent },
+    { "CallFunction", &offsets::CallFunction },
+    { "FindFunction", &offsets::FindFunction },
+    { "GetDefaultObject", &offsets::GetDefaultObject },
+    { "SpawnActor", &offsets::SpawnActor },
+    { "NameInit", &offsets::NameInit },
+    { "StringCtor", &offsets::StringCtor },
+    { "EngineTick", &offsets::EngineTick },
+    { "AddObject", &offsets::AddObject },
+    { "ConditionalDestroy", &offsets::ConditionalDestroy },
+    { "ConditionalPostLoad", &offsets::ConditionalPostLoad },
+    { "ProcessDeferredMessage", &offsets::ProcessDeferredMessage },
+};
+
+void signatures::resolve_offsets(const std::filesystem::path& sdkDir) {
+    std::ifstream file(sdkDir / L"BmSDK.signatures.ini");
+    if (!file.is_open()) {
+        return;
+    }
+
+    std::stringstream text;
+    text << file.rdbuf();
+    std::vector<std::string> errors;
+    auto allDefs = SignatureScanner::ParseDefs(text.str(), errors);
+    for (const auto& error : errors) {
+        std::cerr << "BmSDK.signatures.ini: " << error << std::endl;
+    }
+
+    std::vector<SignatureDef> defs;
+    std::vector<uintptr_t*> targets;
+    for (const auto& target : OffsetTargets) {
+        auto def = std::ranges::find(allDefs, target.Name, &SignatureDef::Name);
+        if (def != allDefs.end()) {
+            defs.push_back(*def);
+            targets.push_back(target.Offset);
+        }
+    }
+
+    ImageInfo image;
+    if (defs.empty() || !ImageInfo::ReadMapped((const uint8_t*)offsets::BaseAddress, image)) {
+        return;
+    }
+
+    auto resolveStart = steady_clock::now();
+
+    // We're under the loader lock here, so worker threads couldn't start until it's too late.
+    // Only a first launch on a new executable actually scans, on this thread.
+    const auto cachePath = sdkDir / L"BmSDK.signatures.cache";
+    SignatureCache cache;
+    cache.Load(cachePath, image);
+    size_t numScanned = 0;
+    auto rvas = SignatureScanner::Resolve(image, defs, cache, 1, numScanned);
+    for (size_t i = 0; i < defs.size(); i++) {
+        if (rvas[i] == 0) {
+            std::cerr << "BmSDK.Host: Signature " << defs[i].Name << " has no match, using the built-in offset" << std::endl;
+            continue;
+        }
+
+        *targets[i] = rvas[i];
+    }
+
+    if (cache.IsDirty() && !cache.Save(cachePath)) {
+        std::cerr << "BmSDK.Host: Couldn't write " << cachePath.filename().string() << std::endl;
+    }
+
+    std::cout << "BmSDK.Host: Resolved " << defs.size() << " signatures (" << numScanned << " scanned) in "
+        << duration<double, std::milli>(steady_clock::now() - resolveStart).count() << " ms" << std::endl;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <filesystem>
+
+namespace signatures {
+    // Overrides the offsets in offsets.h with the ones found for sdk/BmSDK.signatures.ini, if
+    // there is one (see SignatureScanner.h for the format). Results are cached in
+    // sdk/BmSDK.signatures.cache until the executable changes, so usually nothing is scanned.
+    // Needs offsets::BaseAddress to be set. Safe to call from DllMain.
+    void resolve_offsets(const std::filesystem::path& sdkDir);
+}
@@ -2,11 +2,23 @@
 
 #include "Framework/offsets.h"
 #include "Framework/detour_manager.h"
+#include "Framework/signatures.h"
+#include "runtime.h"
 
 static void init_runtime() {
     offsets::BaseAddress = (uintptr_t)(GetModuleHandle(NULL));
+
+    // Find this executable's offsets before anything gets hooked
+    wchar_t exePath[MAX_PATH] = {};
+    GetModuleFileNameW(NULL, exePath, MAX_PATH);
+    signatures::resolve_offsets(std::filesystem::path(exePath).parent_path() / L"sdk");
+
     DetourRestoreAfterWith();
     DetourManager::RegisterEngineLoopPreInitDetour();
+
+    // Bring .NET up in the background while the engine starts, only the managed
+    // entry point has to wait for EngineLoopPreInit
+    runtime::start_boot();
 }
 
 BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved) {
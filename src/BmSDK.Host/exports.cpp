@@ -0,0 +1,66 @@
+#include <cstdint>
+
+#include "Framework/detour_manager.h"
+
+// Functions BmSDK.dll calls back into the host for. See HostExports.cs.
+#define HOST_EXPORT extern "C" __declspec(dllexport)
+
+HOST_EXPORT bool __cdecl bmsdk_begin_detour_batch() {
+    return DetourManager::BeginBatch();
+}
+
+HOST_EXPORT bool __cdecl bmsdk_queue_detour_attach(void** ppOrigFunc, void* pDetourFunc, const char* name) {
+    return DetourManager::QueueAttach(ppOrigFunc, pDetourFunc, name);
+}
+
+HOST_EXPORT bool __cdecl bmsdk_queue_detour_detach(void** ppOrigFunc, void* pDetourFunc, const char* name) {
+    return DetourManager::QueueDetach(ppOrigFunc, pDetourFunc, name);
+}
+
+HOST_EXPORT bool __cdecl bmsdk_commit_detour_batch() {
+    return DetourManager::CommitBatch();
+}
+
+HOST_EXPORT bool __cdecl bmsdk_abort_detour_batch() {
+    return DetourManager::AbortBatch();
+}
+
+HOST_EXPORT int __cdecl bmsdk_get_detour_batch_timing_count() {
+    return (int)DetourManager::GetBatchTimings().size();
+}
+
+HOST_EXPORT bool __cdecl bmsdk_get_detour_batch_timing(int index, const char** outName, double* outMilliseconds) {
+    auto& timings = DetourManager::GetBatchTimings();
+    if (index < 0 || index >= (int)timings.size()) {
+        return false;
+    }
+
+    *outName = timings[index].Name.c_str();
+    *outMilliseconds = timings[index].Milliseconds;
+    return true;
+}
+
+HOST_EXPORT double __cdecl bmsdk_get_detour_batch_commit_time() {
+    return DetourManager::GetBatchCommitTime();
+}
+
+HOST_EXPORT void** __cdecl bmsdk_register_process_internal_detour(void* managedHandler) {
+    return DetourManager::RegisterProcessInternalDetour(managedHandler);
+}
+
+HOST_EXPORT void __cdecl bmsdk_set_process_internal_filter(uint32_t funcIndex, bool isEnabled) {
+    if (isEnabled) {
+        DetourManager::ScriptCallFilter.Add(funcIndex);
+    }
+    else {
+        DetourManager::ScriptCallFilter.Remove(funcIndex);
+    }
+}
+
+HOST_EXPORT void __cdecl bmsdk_clear_process_internal_filter() {
+    DetourManager::ScriptCallFilter.Clear();
+}
+
+HOST_EXPORT void __cdecl bmsdk_set_process_internal_pass_all(bool passAll) {
+    DetourManager::ScriptCallFilter.SetPassAll(passAll);
+}
@@ -1,5 +1,10 @@
 #include <iostream>
 #include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <future>
+#include <thread>
 
 #include <Windows.h>
 #include <cassert>
@@ -9,25 +14,41 @@
 #include <nethost.h>
 
 #include "runtime.h"
+#include "Framework/native_api.h"
+#include "Framework/runtime_config.h"
 
 using namespace std;
 using namespace std::filesystem;
+using namespace std::chrono;
 
 namespace runtime {
     // Func aliases for hostfxr
     using HostInitFn = hostfxr_initialize_for_dotnet_command_line_fn;
     using HostGetDelegateFn = hostfxr_get_runtime_delegate_fn;
     using HostCloseFn = hostfxr_close_fn;
+    using HostSetPropertyFn = hostfxr_set_runtime_property_value_fn;
     using HostLoadAssemblyFn = load_assembly_and_get_function_pointer_fn;
     // Entry point func type alias
-    typedef void(CORECLR_DELEGATE_CALLTYPE* ComponentEntryFn)();
+    typedef void(CORECLR_DELEGATE_CALLTYPE* ComponentEntryFn)(const NativeApi* api);
 
     // Funcs from hostfxr
     static HostInitFn hostInitFn = nullptr;
     static HostGetDelegateFn hostGetDelegateFn = nullptr;
     static HostCloseFn hostCloseFn = nullptr;
+    static HostSetPropertyFn hostSetPropertyFn = nullptr;
     static HostLoadAssemblyFn hostLoadAssemblyFn = nullptr;
 
+    // Managed entry point, available once the boot thread is done
+    static future<ComponentEntryFn> bootResult;
+    static steady_clock::time_point attachTime;
+
+    static void log_phase(const char* phase, steady_clock::time_point phaseStart) {
+        auto now = steady_clock::now();
+        std::cout << "BmSDK.Host: " << phase << " took "
+            << duration<double, milli>(now - phaseStart).count() << " ms ("
+            << duration<double, milli>(now - attachTime).count() << " ms since attach)" << std::endl;
+    }
+
     // Filesystem helpers
     static path get_plugin_path() {
         wstring result(MAX_PATH, L'\0');
@@ -67,8 +88,39 @@ namespace runtime {
         hostInitFn = (HostInitFn)get_export(lib, "hostfxr_initialize_for_dotnet_command_line");
         hostGetDelegateFn = (HostGetDelegateFn)get_export(lib, "hostfxr_get_runtime_delegate");
         hostCloseFn = (HostCloseFn)get_export(lib, "hostfxr_close");
+        hostSetPropertyFn = (HostSetPropertyFn)get_export(lib, "hostfxr_set_runtime_property_value");
+
+        return (hostInitFn && hostGetDelegateFn && hostCloseFn && hostSetPropertyFn);
+    }
+
+    // Apply GC/JIT settings from sdk/BmSDK.runtime.ini, if there is one. Has to happen
+    // before the runtime starts, i.e. before the first delegate is requested.
+    static void apply_runtime_config(hostfxr_handle cxt) {
+        ifstream file(get_game_dir() / L"sdk" / L"BmSDK.runtime.ini");
+        if (!file.is_open())
+            return;
 
-        return (hostInitFn && hostGetDelegateFn && hostCloseFn);
+        stringstream text;
+        text << file.rdbuf();
+
+        vector<string> errors;
+        auto properties = parse_runtime_config(text.str(), errors);
+        for (auto& error : errors) {
+            std::cerr << "BmSDK.runtime.ini: " << error << std::endl;
+        }
+
+        for (auto& prop : properties) {
+            // Names and values are plain ASCII, so widening is enough
+            const wstring name(prop.Name.begin(), prop.Name.end());
+            const wstring value(prop.Value.begin(), prop.Value.end());
+            int rc = hostSetPropertyFn(cxt, name.c_str(), value.c_str());
+            if (rc != 0) {
+                std::cerr << "Setting " << prop.Name << " failed: " << std::hex << std::showbase << rc << std::endl;
+                continue;
+            }
+
+            std::cout << "BmSDK.Host: " << prop.Name << " = " << prop.Value << std::endl;
+        }
     }
 
     // Load and initialize .NET Core and get desired function pointer for scenario
@@ -84,6 +136,8 @@ namespace runtime {
             return nullptr;
         }
 
+        apply_runtime_config(cxt);
+
         // Get the load assembly function pointer
         rc = hostGetDelegateFn(
             cxt,
@@ -96,21 +150,30 @@ namespace runtime {
         return (HostLoadAssemblyFn)hostLoadAssemblyFn;
     }
 
-    void load_dll() {
+    // Runs on the boot thread. Does everything up to having the managed entry point in hand.
+    static ComponentEntryFn boot() {
         // Load HostFxr and get exported hosting functions
+        auto phaseStart = steady_clock::now();
         if (!load_hostfxr()) {
             assert(false && "Failure: load_hostfxr()");
-            return;
+            return nullptr;
         }
+        log_phase("Loading hostfxr", phaseStart);
 
         // Initialize and start the .NET Core runtime
+        phaseStart = steady_clock::now();
         const wstring basePath = get_game_dir();
         const wstring asmPath = L"\\sdk\\BmSDK";
         const wstring dotnetDllPath = basePath + L"\\sdk\\BmSDK.dll";
         hostLoadAssemblyFn = get_dotnet_load_assembly(dotnetDllPath.c_str());
-        assert(hostLoadAssemblyFn != nullptr && "Failure: get_dotnet_load_assembly()");
+        if (hostLoadAssemblyFn == nullptr) {
+            assert(false && "Failure: get_dotnet_load_assembly()");
+            return nullptr;
+        }
+        log_phase("Initializing the runtime", phaseStart);
 
         // Load managed assembly and get function pointer to a managed method
+        phaseStart = steady_clock::now();
         const wstring dotnetType = L"BmSDK.Framework.Loader, BmSDK";
         const wstring dotnetMethod = L"GuardedDllMain";
 
@@ -126,9 +189,38 @@ namespace runtime {
 
         if (rc != 0 || GuardedDllMain == nullptr) {
             assert(false && "Failure: hostLoadAssemblyFn()");
+            return nullptr;
+        }
+        log_phase("Loading BmSDK.dll", phaseStart);
+
+        return GuardedDllMain;
+    }
+
+    void start_boot() {
+        attachTime = steady_clock::now();
+
+        // Plain thread rather than std::async, which may go through a thread pool that
+        // isn't safe to spin up under the loader lock. It only starts running once
+        // DllMain returns.
+        packaged_task<ComponentEntryFn()> bootTask(boot);
+        bootResult = bootTask.get_future();
+        thread(std::move(bootTask)).detach();
+    }
+
+    void load_dll() {
+        // Only the managed entry point has to run on the engine's thread
+        auto phaseStart = steady_clock::now();
+        ComponentEntryFn GuardedDllMain = bootResult.get();
+        log_phase("Waiting for the boot thread", phaseStart);
+        if (GuardedDllMain == nullptr) {
             return;
         }
 
-        GuardedDllMain();
+        // Engine functions and globals for the managed side, valid for the whole session
+        static const NativeApi nativeApi = make_native_api();
+
+        phaseStart = steady_clock::now();
+        GuardedDllMain(&nativeApi);
+        log_phase("Running GuardedDllMain", phaseStart);
     }
 }
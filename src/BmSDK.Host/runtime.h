@@ -1,5 +1,10 @@
 #pragma once
 
 namespace runtime {
+    // Starts finding hostfxr, initializing .NET and loading BmSDK.dll on a background thread,
+    // so it overlaps with the engine's own startup. Safe to call from DllMain.
+    void start_boot();
+
+    // Waits for the boot to finish, then runs the managed entry point on the calling thread
     void load_dll();
 }
@@ -1,3 +1,5 @@
+using System.Collections.Concurrent;
+using System.Runtime.CompilerServices;
 using BmSDK.Framework;
 
 namespace BmSDK;
@@ -17,13 +19,122 @@ public partial class Function
 
     public bool IsStatic => FunctionFlags.HasFlag(EFunctionFlags.FUNC_Static);
 
+    // Script-callable copies by native function, so wrappers of the same UFunction share one.
+    // Slots are published with a compare-exchange, so racing first calls free the losing copy.
+    private static readonly ConcurrentDictionary<IntPtr, StrongBox<IntPtr>> s_scriptCallablePtrs =
+        [];
+
+    // Original function by copy. The copy keeps the original's index, name and outer, so the
+    // native ProcessInternal() filter already treats it as the original; managed code has to
+    // map it back before wrapping it.
+    private static readonly ConcurrentDictionary<IntPtr, IntPtr> s_scriptCallableOriginals = [];
+
+    // Copies whose originals were destroyed, freed on the next engine tick
+    private static readonly ConcurrentQueue<IntPtr> s_releasedScriptCallablePtrs = [];
+
+    /// <summary>
+    /// Pointer to a copy of this function with FUNC_Native cleared and FUNC_Defined set, so
+    /// ProcessEvent can call it with a params buffer like any script function.
+    /// </summary>
+    /// <remarks>
+    /// Created on first use and freed after the original is destroyed. The copy shares the
+    /// original's children and script, and the original is never modified, so this is safe
+    /// to use reentrantly. Use <see cref="GetOriginalPtr"/> before wrapping a function pointer
+    /// that may be a copy.
+    /// </remarks>
+    internal unsafe IntPtr ScriptCallablePtr
+    {
+        get
+        {
+            var slot = s_scriptCallablePtrs.GetOrAdd(Ptr, _ => new StrongBox<IntPtr>());
+            var existingPtr = Volatile.Read(ref slot.Value);
+            if (existingPtr != IntPtr.Zero)
+            {
+                return existingPtr;
+            }
+
+            var size = (nuint)StaticClass().PropertiesSize;
+            var clonePtr = (IntPtr)NativeMemory.Alloc(size);
+            NativeMemory.Copy(Ptr.ToPointer(), clonePtr.ToPointer(), size);
+
+            var flags = (FunctionFlags & ~EFunctionFlags.FUNC_Native) | EFunctionFlags.FUNC_Defined;
+            MarshalUtil.ToUnmanaged(
+                flags,
+                (clonePtr + GameInfo.MemberOffsets.Function__FunctionFlags).ToPointer()
+            );
+            MarshalUtil.ToUnmanaged(
+                (ushort)0,
+                (clonePtr + GameInfo.MemberOffsets.Function__iNative).ToPointer()
+            );
+
+            // Mapped before it's published, so no call through it can miss the mapping
+            s_scriptCallableOriginals[clonePtr] = Ptr;
+
+            var winnerPtr = Interlocked.CompareExchange(ref slot.Value, clonePtr, IntPtr.Zero);
+            if (winnerPtr != IntPtr.Zero)
+            {
+                s_scriptCallableOriginals.TryRemove(clonePtr, out _);
+                NativeMemory.Free(clonePtr.ToPointer());
+                return winnerPtr;
+            }
+
+            return clonePtr;
+        }
+    }
+
+    /// <summary>
+    /// Returns the original function if the given pointer is a script-callable copy (see
+    /// <see cref="ScriptCallablePtr"/>), otherwise the pointer itself.
+    /// </summary>
+    internal static IntPtr GetOriginalPtr(IntPtr funcPtr) =>
+        s_scriptCallableOriginals.TryGetValue(funcPtr, out var originalPtr) ? originalPtr : funcPtr;
+
+    /// <summary>
+    /// Releases the script-callable copy of the function at the given address, if there is one.
+    /// Called once the object is destroyed, as its children and script go with it. The copy may
+    /// still be on the script stack, so it's only freed by
+    /// <see cref="FreeReleasedScriptCallablePtrs"/>.
+    /// </summary>
+    internal static void ReleaseScriptCallablePtr(IntPtr funcPtr)
+    {
+        if (s_scriptCallablePtrs.TryRemove(funcPtr, out var slot))
+        {
+            var clonePtr = Interlocked.Exchange(ref slot.Value, IntPtr.Zero);
+            if (clonePtr != IntPtr.Zero)
+            {
+                s_releasedScriptCallablePtrs.Enqueue(clonePtr);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Frees every released copy, along with any wrapper created for it. Must be called while
+    /// no script is running, i.e. at the start of an engine tick.
+    /// </summary>
+    internal static unsafe void FreeReleasedScriptCallablePtrs()
+    {
+        while (s_releasedScriptCallablePtrs.TryDequeue(out var clonePtr))
+        {
+            MarshalUtil.DestroyManagedWrapper(clonePtr);
+            s_scriptCallableOriginals.TryRemove(clonePtr, out _);
+            NativeMemory.Free(clonePtr.ToPointer());
+        }
+    }
+
     /// <summary>
     /// Property: FunctionFlags
     /// </summary>
     public unsafe EFunctionFlags FunctionFlags
     {
-        get => MarshalUtil.ToManaged<EFunctionFlags>(Ptr + 108);
-        set => MarshalUtil.ToUnmanaged(value, (Ptr + 108).ToPointer());
+        get =>
+            MarshalUtil.ToManaged<EFunctionFlags>(
+                Ptr + GameInfo.MemberOffsets.Function__FunctionFlags
+            );
+        set =>
+            MarshalUtil.ToUnmanaged(
+                value,
+                (Ptr + GameInfo.MemberOffsets.Function__FunctionFlags).ToPointer()
+            );
     }
 
     /// <summary>
@@ -31,8 +142,12 @@ public partial class Function
     /// </summary>
     public unsafe ushort iNative
     {
-        get => MarshalUtil.ToManaged<ushort>(Ptr + 112);
-        set => MarshalUtil.ToUnmanaged(value, (Ptr + 112).ToPointer());
+        get => MarshalUtil.ToManaged<ushort>(Ptr + GameInfo.MemberOffsets.Function__iNative);
+        set =>
+            MarshalUtil.ToUnmanaged(
+                value,
+                (Ptr + GameInfo.MemberOffsets.Function__iNative).ToPointer()
+            );
     }
 
     public IEnumerable<Property> EnumerateParams()
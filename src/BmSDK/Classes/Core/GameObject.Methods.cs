@@ -7,9 +7,7 @@ public partial class GameObject
     /// <summary>
     /// Returns a reference to the global objects array. Should not be used directly - see <see cref="FindObjectsSlow"/> instead.
     /// </summary>
-    private static readonly TArray<IntPtr> GObjects = new(
-        MemUtil.GetIntPointer(GameInfo.GlobalOffsets.GObjObjects)
-    );
+    private static readonly unsafe TArray<IntPtr> GObjects = new(NativeApi.Current->GObjObjects);
 
     /// <summary>
     /// Returns an enumerable containing all objects of the given type.
@@ -50,10 +48,9 @@ public partial class GameObject
                 ExactClass ? 1 : 0
             );
 
-            return Guard.NotNull(
-                (T?)(object?)MarshalUtil.ToManaged<GameObject>(&result),
-                $"Failed to find object: {Name}"
-            );
+            // Not Guard.NotNull, which would format the message on every successful lookup too
+            var obj = (T?)(object?)MarshalUtil.ToManaged<GameObject>(&result);
+            return obj ?? throw new ArgumentException($"Failed to find object: {Name}");
         }
     }
 
@@ -106,7 +103,7 @@ public partial class GameObject
             Name is null ? FName.None : new FName(Name),
             SetFlags,
             Template?.Ptr ?? 0,
-            MemUtil.GetIntPointer(GameInfo.GlobalOffsets.GError),
+            NativeApi.Current->GError,
             0,
             0
         );
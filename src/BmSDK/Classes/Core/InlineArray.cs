@@ -3,6 +3,35 @@ using BmSDK.Framework;
 
 namespace BmSDK;
 
+/// <summary>
+/// Helpers for <see cref="InlineArray{T}"/>.
+/// </summary>
+public static class InlineArray
+{
+    /// <summary>
+    /// Returns a span over the array's native memory, for hot paths. Doesn't allocate, and
+    /// indexing it is a bounds-checked read without marshalling.
+    /// </summary>
+    /// <remarks>
+    /// Only for element types laid out exactly like the engine's. Unlike the array, the span
+    /// can't check whether its object is still alive, so don't hold on to it past the object's
+    /// lifetime.
+    /// </remarks>
+    public static unsafe Span<T> AsSpan<T>(this InlineArray<T> array)
+        where T : unmanaged
+    {
+        Guard.Require(array.IsValid, "Tried accessing an invalid InlineArray");
+        if (array.Stride != sizeof(T))
+        {
+            throw new ArgumentException(
+                $"Inline array stride {array.Stride} doesn't match {typeof(T).Name} ({sizeof(T)} bytes)"
+            );
+        }
+
+        return new Span<T>(array.Ptr.ToPointer(), array.Count);
+    }
+}
+
 /// <summary>
 /// Wrapper for unmanaged inline arrays.
 /// These are of fixed size and cannot be created.
@@ -26,6 +55,10 @@ public class InlineArray<T> : IEnumerable<T>
 
     public bool IsValid => _owner.IsValid;
 
+    internal IntPtr Ptr => _ptr;
+
+    internal int Stride => _stride;
+
     public T this[int index]
     {
         get
@@ -1,6 +1,3 @@
-using Windows.Win32;
-using PInvokeDetours = Microsoft.Detours.PInvoke;
-
 namespace BmSDK.Framework;
 
 public static class DetourUtil
@@ -9,22 +6,101 @@ public static class DetourUtil
     private static readonly List<Delegate> s_detourDelegateRefs = [];
 
     // Creates a detour and returns the original function
-    public static unsafe T NewDetour<T>(IntPtr funcOffset, T detourFunc)
+    public static T NewDetour<T>(IntPtr funcOffset, T detourFunc)
         where T : Delegate
     {
-        void* origFuncPtr = MemUtil.GetPointer(funcOffset);
+        BeginBatch();
+        try
+        {
+            var detour = QueueDetour(funcOffset, detourFunc);
+            CommitBatch();
+
+            return detour.Original;
+        }
+        finally
+        {
+            AbortBatch();
+        }
+    }
+
+    /// <summary>
+    /// Starts queuing detours instead of installing them one by one. Everything queued until
+    /// <see cref="CommitBatch"/> is installed in a single transaction, so the game's threads
+    /// are only suspended once.
+    /// </summary>
+    public static void BeginBatch() =>
+        Guard.Require(HostExports.BeginDetourBatch(), "Couldn't begin a detour batch");
+
+    /// <summary>
+    /// Queues a detour in the current batch. The original can be called once it's committed.
+    /// </summary>
+    public static QueuedDetour<T> QueueDetour<T>(IntPtr funcOffset, T detourFunc)
+        where T : Delegate => QueueDetourAt(MemUtil.GetIntPointer(funcOffset), detourFunc);
+
+    /// <summary>
+    /// Like <see cref="QueueDetour"/>, but takes the function's absolute address (e.g. from
+    /// <see cref="NativeApi"/>) rather than its offset from the base address.
+    /// </summary>
+    internal static unsafe QueuedDetour<T> QueueDetourAt<T>(IntPtr funcAddress, T detourFunc)
+        where T : Delegate
+    {
+        // Detours writes the original back here on commit, so it has to outlive this call
+        var origFuncSlot = (IntPtr*)NativeMemory.Alloc((nuint)sizeof(IntPtr));
+        *origFuncSlot = funcAddress;
 
         // Get a pointer to the managed detour method
         s_detourDelegateRefs.Add(detourFunc);
-        void* managedDetourFuncPtr = Marshal.GetFunctionPointerForDelegate(detourFunc).ToPointer();
+        var managedDetourFuncPtr = Marshal.GetFunctionPointerForDelegate(detourFunc);
+
+        var name = detourFunc.Method.Name;
+        Guard.Require(
+            HostExports.QueueDetourAttach(origFuncSlot, managedDetourFuncPtr, name),
+            $"Couldn't queue detour {name}"
+        );
 
-        PInvokeDetours.DetourRestoreAfterWith();
+        return new QueuedDetour<T>(origFuncSlot);
+    }
+
+    /// <summary>
+    /// Drops the open batch without installing anything queued in it. Does nothing if there's
+    /// no open batch, so it's safe to call from a finally block after <see cref="CommitBatch"/>.
+    /// </summary>
+    public static void AbortBatch() => HostExports.AbortDetourBatch();
 
-        Guard.Require(PInvokeDetours.DetourTransactionBegin() == 0);
-        Guard.Require(PInvokeDetours.DetourUpdateThread(PInvoke.GetCurrentThread()) == 0);
-        Guard.Require(PInvokeDetours.DetourAttach(&origFuncPtr, managedDetourFuncPtr) == 0);
-        Guard.Require(PInvokeDetours.DetourTransactionCommit() == 0);
+    /// <summary>
+    /// Installs every detour queued since <see cref="BeginBatch"/> and logs how long each took.
+    /// </summary>
+    public static void CommitBatch()
+    {
+        Guard.Require(HostExports.CommitDetourBatch(), "Couldn't commit detour batch");
 
-        return Marshal.GetDelegateForFunctionPointer<T>((IntPtr)origFuncPtr);
+        var numDetours = HostExports.GetDetourBatchTimingCount();
+        for (var i = 0; i < numDetours; i++)
+        {
+            if (HostExports.GetDetourBatchTiming(i, out var namePtr, out var milliseconds))
+            {
+                var name = Marshal.PtrToStringAnsi(namePtr);
+                Debug.Log($"Queued detour {name} in {milliseconds:F3} ms");
+            }
+        }
+
+        Debug.Log(
+            $"Installed {numDetours} detour(s) in {HostExports.GetDetourBatchCommitTime():F3} ms"
+        );
     }
 }
+
+/// <summary>
+/// A detour queued with <see cref="DetourUtil.QueueDetour{T}"/>. Its original function
+/// can only be called once the batch it was queued in has been committed.
+/// </summary>
+public sealed unsafe class QueuedDetour<T>
+    where T : Delegate
+{
+    private readonly IntPtr* _origFuncSlot;
+    private T? _original;
+
+    internal QueuedDetour(IntPtr* origFuncSlot) => _origFuncSlot = origFuncSlot;
+
+    public T Original => _original ??= Marshal.GetDelegateForFunctionPointer<T>(*_origFuncSlot);
+}
@@ -186,7 +186,7 @@ public static unsafe class MarshalUtil
 
         // Get the managed type through the class object
         var managedType = !classFlags.HasFlag(Class.EClassFlags.CLASS_Interface)
-            ? StaticInit.GetManagedTypeForClassPath(GetClassPath(classPtr))
+            ? StaticInit.GetManagedTypeForClass(classPtr)
             : typeof(GameObject); // Wrap CDOs of interfaces as GameObject
 
         // Wrap this object in a managed instance
@@ -205,19 +205,6 @@ public static unsafe class MarshalUtil
         return newObj;
     }
 
-    private static string GetClassPath(IntPtr classPtr)
-    {
-        // Fetch class name.
-        var className = *(FName*)(classPtr + GameInfo.MemberOffsets.Object__Name).ToPointer();
-
-        // Fetch outer name.
-        var classOuterPtr = *(IntPtr*)(classPtr + GameInfo.MemberOffsets.Object__Outer).ToPointer();
-        var classOuterName = *(FName*)
-            (classOuterPtr + GameInfo.MemberOffsets.Object__Name).ToPointer();
-
-        return $"{classOuterName}.{className}";
-    }
-
     /// <summary>
     /// Returns a ref to unmanaged data at the specified address.
     /// </summary>
@@ -8,8 +8,13 @@ public static class MemUtil
 {
     private static IntPtr s_baseAddress = 0;
 
-    public static IntPtr GetBaseAddress()
+    public static unsafe IntPtr GetBaseAddress()
     {
+        if (s_baseAddress == 0 && NativeApi.IsInitialized)
+        {
+            s_baseAddress = NativeApi.Current->BaseAddress;
+        }
+
         if (s_baseAddress == 0)
         {
             var proc = Process.GetCurrentProcess();
@@ -25,7 +25,8 @@ internal unsafe record struct FFrame
 
     public readonly Function GetFunction()
     {
-        var nodePtr = Node;
+        // Native functions called from managed code run through a script-callable copy
+        var nodePtr = Function.GetOriginalPtr(Node);
         return MarshalUtil.ToManaged<Function>(&nodePtr);
     }
 
@@ -33,23 +33,31 @@ internal static class FindObjectsCache
             return;
         }
 
-        var nodes = new List<LinkedListNode<GameObject>>();
-        for (
-            var type = obj.GetType();
-            type != null && typeof(GameObject).IsAssignableFrom(type);
-            type = type.BaseType
-        )
+        // Chains are cached per type and end in object, so stop after GameObject
+        var supers = StaticInit.EnumerateSelfAndSupers(obj.GetType());
+        var numNodes = supers.Count;
+        for (var i = 0; i < supers.Count; i++)
         {
-            if (!s_objectsByType.TryGetValue(type, out var objects))
+            if (supers[i] == typeof(GameObject))
+            {
+                numNodes = i + 1;
+                break;
+            }
+        }
+
+        var nodes = new LinkedListNode<GameObject>[numNodes];
+        for (var i = 0; i < numNodes; i++)
+        {
+            if (!s_objectsByType.TryGetValue(supers[i], out var objects))
             {
                 objects = [];
-                s_objectsByType[type] = objects;
+                s_objectsByType[supers[i]] = objects;
             }
 
-            nodes.Add(objects.AddLast(obj));
+            nodes[i] = objects.AddLast(obj);
         }
 
-        s_removalCache[obj] = [.. nodes];
+        s_removalCache[obj] = nodes;
     }
 
     public static void Unregister(GameObject obj)
@@ -2,9 +2,11 @@ namespace BmSDK.Framework;
 
 internal static class GameFunctions
 {
+    // Engine functions called from managed code. These go straight through the pointers in
+    // NativeApi, so there's no delegate marshalling on the way in.
+
     // UObject::StaticConstructObject()
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate IntPtr StaticConstructObjectDelegate(
+    public static unsafe IntPtr StaticConstructObject(
         IntPtr InClass,
         IntPtr InOuter,
         FName InName,
@@ -13,73 +15,62 @@ internal static class GameFunctions
         IntPtr Error,
         IntPtr SubobjectRoot,
         IntPtr InInstanceGraph
-    );
+    ) =>
+        NativeApi.Current->StaticConstructObject(
+            InClass,
+            InOuter,
+            InName,
+            InFlags,
+            InTemplate,
+            Error,
+            SubobjectRoot,
+            InInstanceGraph
+        );
 
     // UObject::StaticFindObject()
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate IntPtr StaticFindObjectDelegate(
+    public static unsafe IntPtr StaticFindObject(
         IntPtr Class,
         IntPtr InOuter,
         IntPtr OrigInName,
         int ExactClass
-    );
+    ) => NativeApi.Current->StaticFindObject(Class, InOuter, OrigInName, ExactClass);
 
     // UObject::LoadPackage()
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate IntPtr LoadPackageDelegate(IntPtr InOuter, IntPtr Filename, int LoadFlags);
+    public static unsafe IntPtr LoadPackage(IntPtr InOuter, IntPtr Filename, int LoadFlags) =>
+        NativeApi.Current->LoadPackage(InOuter, Filename, LoadFlags);
 
     // UObject::CollectGarbage()
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate void CollectGarbageDelegate(
+    public static unsafe void CollectGarbage(
         GameObject.EObjectFlags KeepFlags,
         int bPerformFullPurge
-    );
+    ) => NativeApi.Current->CollectGarbage(KeepFlags, bPerformFullPurge);
 
     // UObject::ProcessEvent()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate void ProcessEventDelegate(
+    public static unsafe void ProcessEvent(
         IntPtr self,
         IntPtr Function,
         IntPtr Parms,
         IntPtr UnusedResult
-    );
-
-    // UObject::ProcessInternal()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate void ProcessInternalDelegate(IntPtr self, IntPtr Stack, IntPtr Result);
-
-    // FWindowsViewport::ProcessDeferredMessage()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate void ProcessDeferredMessageDelegate(IntPtr self, ref FDeferredMessage Message);
+    ) => NativeApi.Current->ProcessEvent(self, Function, Parms, UnusedResult);
 
     // UObject::CallFunction()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate void CallFunctionDelegate(
+    public static unsafe void CallFunction(
         IntPtr self,
         IntPtr Stack,
         IntPtr Result,
         IntPtr Function
-    );
-
-    // UObject::AddObject()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate void AddObjectDelegate(IntPtr self, int InIndex);
-
-    // UObject::~UObject()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate void ConditionalDestroyDelegate(IntPtr self);
+    ) => NativeApi.Current->CallFunction(self, Stack, Result, Function);
 
     // UObject::FindFunction()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate IntPtr FindFunctionDelegate(IntPtr self, FName InName, int Global);
+    public static unsafe IntPtr FindFunction(IntPtr self, FName InName, int Global) =>
+        NativeApi.Current->FindFunction(self, InName, Global);
 
     // UClass::GetDefaultObject()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate IntPtr GetDefaultObjectDelegate(IntPtr self, int bForce);
+    public static unsafe IntPtr GetDefaultObject(IntPtr self, int bForce) =>
+        NativeApi.Current->GetDefaultObject(self, bForce);
 
     // UWorld::SpawnActor()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate IntPtr SpawnActorDelegate(
+    public static unsafe IntPtr SpawnActor(
         IntPtr self,
         IntPtr Class,
         FName InName,
@@ -91,139 +82,64 @@ internal static class GameFunctions
         IntPtr Owner,
         IntPtr Instigator,
         int bNoFail
-    );
+    ) =>
+        NativeApi.Current->SpawnActor(
+            self,
+            Class,
+            InName,
+            Location,
+            Rotation,
+            Template,
+            bNoCollisionFail,
+            bRemoteOwned,
+            Owner,
+            Instigator,
+            bNoFail
+        );
 
     // FName::Init()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate void NameInitDelegate(
+    public static unsafe void NameInit(
         IntPtr self,
         IntPtr InName,
         int InNumber,
         int FindType,
         int bSplitName
-    );
+    ) => NativeApi.Current->NameInit(self, InName, InNumber, FindType, bSplitName);
 
     // FString::FString()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate IntPtr StringCtorDelegate(IntPtr self, IntPtr In);
+    public static unsafe IntPtr StringCtor(IntPtr self, IntPtr In) =>
+        NativeApi.Current->StringCtor(self, In);
 
     // appRealloc()
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate IntPtr AppReallocDelegate(IntPtr Original, int Count, int Alignment);
+    public static unsafe IntPtr AppRealloc(IntPtr Original, int Count, int Alignment) =>
+        NativeApi.Current->AppRealloc(Original, Count, Alignment);
 
     // appFree()
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    public delegate void AppFreeDelegate(IntPtr Original);
+    public static unsafe void AppFree(IntPtr Original) => NativeApi.Current->AppFree(Original);
 
-    // FEngineLoop::Tick()
-    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate IntPtr EngineTickDelegate(IntPtr self);
+    // Signatures of functions detoured from managed code (see Loader)
 
-    // UObject::ConditionalPostLoad()
+    // UObject::ProcessInternal()
     [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
-    public delegate void ConditionalPostLoadDelegate(IntPtr self);
-
-    private static StaticConstructObjectDelegate? _StaticConstructObject = null;
-    private static StaticFindObjectDelegate? _StaticFindObject = null;
-    private static LoadPackageDelegate? _LoadPackage = null;
-    private static CollectGarbageDelegate? _CollectGarbage = null;
-    private static ProcessEventDelegate? _ProcessEvent = null;
-    private static ProcessInternalDelegate? _ProcessInternal = null;
-    private static CallFunctionDelegate? _CallFunction = null;
-    private static AddObjectDelegate? _AddObject = null;
-    private static ConditionalDestroyDelegate? _ConditionalDestroy = null;
-    private static FindFunctionDelegate? _FindFunction = null;
-    private static GetDefaultObjectDelegate? _GetDefaultObject = null;
-    private static SpawnActorDelegate? _SpawnActor = null;
-    private static NameInitDelegate? _NameInit = null;
-    private static StringCtorDelegate? _StringCtor = null;
-    private static AppReallocDelegate? _AppRealloc = null;
-    private static AppFreeDelegate? _AppFree = null;
-    private static EngineTickDelegate? _EngineTick = null;
-
-    public static StaticConstructObjectDelegate StaticConstructObject =>
-        _StaticConstructObject ??=
-            Marshal.GetDelegateForFunctionPointer<StaticConstructObjectDelegate>(
-                MemUtil.GetIntPointer(GameInfo.FuncOffsets.StaticConstructObject)
-            );
-
-    public static StaticFindObjectDelegate StaticFindObject =>
-        _StaticFindObject ??= Marshal.GetDelegateForFunctionPointer<StaticFindObjectDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.StaticFindObject)
-        );
-
-    public static LoadPackageDelegate LoadPackage =>
-        _LoadPackage ??= Marshal.GetDelegateForFunctionPointer<LoadPackageDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.LoadPackage)
-        );
-
-    public static CollectGarbageDelegate CollectGarbage =>
-        _CollectGarbage ??= Marshal.GetDelegateForFunctionPointer<CollectGarbageDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.CollectGarbage)
-        );
-
-    public static ProcessEventDelegate ProcessEvent =>
-        _ProcessEvent ??= Marshal.GetDelegateForFunctionPointer<ProcessEventDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.ProcessEvent)
-        );
-
-    public static ProcessInternalDelegate ProcessInternal =>
-        _ProcessInternal ??= Marshal.GetDelegateForFunctionPointer<ProcessInternalDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.ProcessInternal)
-        );
-
-    public static CallFunctionDelegate CallFunction =>
-        _CallFunction ??= Marshal.GetDelegateForFunctionPointer<CallFunctionDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.CallFunction)
-        );
-
-    public static AddObjectDelegate AddObject =>
-        _AddObject ??= Marshal.GetDelegateForFunctionPointer<AddObjectDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.AddObject)
-        );
-
-    public static ConditionalDestroyDelegate ConditionalDestroy =>
-        _ConditionalDestroy ??= Marshal.GetDelegateForFunctionPointer<ConditionalDestroyDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.ConditionalDestroy)
-        );
-
-    public static FindFunctionDelegate FindFunction =>
-        _FindFunction ??= Marshal.GetDelegateForFunctionPointer<FindFunctionDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.FindFunction)
-        );
-
-    public static GetDefaultObjectDelegate GetDefaultObject =>
-        _GetDefaultObject ??= Marshal.GetDelegateForFunctionPointer<GetDefaultObjectDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.GetDefaultObject)
-        );
-
-    public static SpawnActorDelegate SpawnActor =>
-        _SpawnActor ??= Marshal.GetDelegateForFunctionPointer<SpawnActorDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.SpawnActor)
-        );
+    public delegate void ProcessInternalDelegate(IntPtr self, IntPtr Stack, IntPtr Result);
 
-    public static NameInitDelegate NameInit =>
-        _NameInit ??= Marshal.GetDelegateForFunctionPointer<NameInitDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.NameInit)
-        );
+    // FWindowsViewport::ProcessDeferredMessage()
+    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
+    public delegate void ProcessDeferredMessageDelegate(IntPtr self, ref FDeferredMessage Message);
 
-    public static StringCtorDelegate StringCtor =>
-        _StringCtor ??= Marshal.GetDelegateForFunctionPointer<StringCtorDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.StringCtor)
-        );
+    // UObject::AddObject()
+    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
+    public delegate void AddObjectDelegate(IntPtr self, int InIndex);
 
-    public static AppReallocDelegate AppRealloc =>
-        _AppRealloc ??= Marshal.GetDelegateForFunctionPointer<AppReallocDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.AppRealloc)
-        );
+    // UObject::~UObject()
+    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
+    public delegate void ConditionalDestroyDelegate(IntPtr self);
 
-    public static AppFreeDelegate AppFree =>
-        _AppFree ??= Marshal.GetDelegateForFunctionPointer<AppFreeDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.AppFree)
-        );
+    // FEngineLoop::Tick()
+    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
+    public delegate IntPtr EngineTickDelegate(IntPtr self);
 
-    public static EngineTickDelegate EngineTick =>
-        _EngineTick ??= Marshal.GetDelegateForFunctionPointer<EngineTickDelegate>(
-            MemUtil.GetIntPointer(GameInfo.FuncOffsets.EngineTick)
-        );
+    // UObject::ConditionalPostLoad()
+    [UnmanagedFunctionPointer(CallingConvention.ThisCall)]
+    public delegate void ConditionalPostLoadDelegate(IntPtr self);
 }
@@ -0,0 +1,107 @@
+namespace BmSDK.Framework;
+
+/// <summary>
+/// Functions exported by BmSDK.Host (see exports.cpp), which is already loaded by the time
+/// any managed code runs.
+/// </summary>
+internal static unsafe class HostExports
+{
+    private const string HostLibraryName = "BmSDK.Host.asi";
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_begin_detour_batch",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool BeginDetourBatch();
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_queue_detour_attach",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool QueueDetourAttach(IntPtr* origFunc, IntPtr detourFunc, string name);
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_queue_detour_detach",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool QueueDetourDetach(IntPtr* origFunc, IntPtr detourFunc, string name);
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_commit_detour_batch",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool CommitDetourBatch();
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_abort_detour_batch",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool AbortDetourBatch();
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_get_detour_batch_timing_count",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    public static extern int GetDetourBatchTimingCount();
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_get_detour_batch_timing",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    [return: MarshalAs(UnmanagedType.U1)]
+    public static extern bool GetDetourBatchTiming(
+        int index,
+        out IntPtr name,
+        out double milliseconds
+    );
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_get_detour_batch_commit_time",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    public static extern double GetDetourBatchCommitTime();
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_register_process_internal_detour",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    public static extern IntPtr* RegisterProcessInternalDetour(IntPtr managedDetour);
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_set_process_internal_filter",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    public static extern void SetProcessInternalFilter(
+        uint funcIndex,
+        [MarshalAs(UnmanagedType.U1)] bool isEnabled
+    );
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_clear_process_internal_filter",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    public static extern void ClearProcessInternalFilter();
+
+    [DllImport(
+        HostLibraryName,
+        EntryPoint = "bmsdk_set_process_internal_pass_all",
+        CallingConvention = CallingConvention.Cdecl
+    )]
+    public static extern void SetProcessInternalPassAll([MarshalAs(UnmanagedType.U1)] bool passAll);
+}
@@ -0,0 +1,150 @@
+namespace BmSDK.Framework;
+
+/// <summary>
+/// Engine function pointers and global addresses, filled in by BmSDK.Host and passed to
+/// <see cref="Loader.GuardedDllMain"/>. Mirrors native_api.h, where the same offsets are
+/// checked with static_assert - keep both in sync and bump <see cref="CurrentVersion"/>.
+/// </summary>
+[StructLayout(LayoutKind.Explicit, Size = SizeInBytes)]
+internal unsafe struct NativeApi
+{
+    public const uint CurrentVersion = 2;
+    public const int SizeInBytes = 96;
+
+    [FieldOffset(0)]
+    public uint Version;
+
+    [FieldOffset(4)]
+    public uint Size;
+
+    // Globals
+    [FieldOffset(8)]
+    public IntPtr BaseAddress;
+
+    [FieldOffset(12)]
+    public IntPtr GObjObjects;
+
+    [FieldOffset(16)]
+    public IntPtr GNames;
+
+    [FieldOffset(20)]
+    public IntPtr GError;
+
+    // appRealloc()
+    [FieldOffset(24)]
+    public delegate* unmanaged[Cdecl]<IntPtr, int, int, IntPtr> AppRealloc;
+
+    // appFree()
+    [FieldOffset(28)]
+    public delegate* unmanaged[Cdecl]<IntPtr, void> AppFree;
+
+    // UObject::StaticFindObject()
+    [FieldOffset(32)]
+    public delegate* unmanaged[Cdecl]<IntPtr, IntPtr, IntPtr, int, IntPtr> StaticFindObject;
+
+    // UObject::StaticConstructObject()
+    [FieldOffset(36)]
+    public delegate* unmanaged[Cdecl]<
+        IntPtr,
+        IntPtr,
+        FName,
+        GameObject.EObjectFlags,
+        IntPtr,
+        IntPtr,
+        IntPtr,
+        IntPtr,
+        IntPtr> StaticConstructObject;
+
+    // UObject::LoadPackage()
+    [FieldOffset(40)]
+    public delegate* unmanaged[Cdecl]<IntPtr, IntPtr, int, IntPtr> LoadPackage;
+
+    // UObject::CollectGarbage()
+    [FieldOffset(44)]
+    public delegate* unmanaged[Cdecl]<GameObject.EObjectFlags, int, void> CollectGarbage;
+
+    // UObject::ProcessEvent()
+    [FieldOffset(48)]
+    public delegate* unmanaged[Thiscall]<IntPtr, IntPtr, IntPtr, IntPtr, void> ProcessEvent;
+
+    // UObject::CallFunction()
+    [FieldOffset(52)]
+    public delegate* unmanaged[Thiscall]<IntPtr, IntPtr, IntPtr, IntPtr, void> CallFunction;
+
+    // UObject::FindFunction()
+    [FieldOffset(56)]
+    public delegate* unmanaged[Thiscall]<IntPtr, FName, int, IntPtr> FindFunction;
+
+    // UClass::GetDefaultObject()
+    [FieldOffset(60)]
+    public delegate* unmanaged[Thiscall]<IntPtr, int, IntPtr> GetDefaultObject;
+
+    // UWorld::SpawnActor()
+    [FieldOffset(64)]
+    public delegate* unmanaged[Thiscall]<
+        IntPtr,
+        IntPtr,
+        FName,
+        IntPtr,
+        IntPtr,
+        IntPtr,
+        int,
+        int,
+        IntPtr,
+        IntPtr,
+        int,
+        IntPtr> SpawnActor;
+
+    // FName::Init()
+    [FieldOffset(68)]
+    public delegate* unmanaged[Thiscall]<IntPtr, IntPtr, int, int, int, void> NameInit;
+
+    // FString::FString()
+    [FieldOffset(72)]
+    public delegate* unmanaged[Thiscall]<IntPtr, IntPtr, IntPtr> StringCtor;
+
+    // Detour targets, only ever handed to DetourUtil
+
+    // appEngineTick()
+    [FieldOffset(76)]
+    public IntPtr EngineTick;
+
+    // UObject::AddObject()
+    [FieldOffset(80)]
+    public IntPtr AddObject;
+
+    // UObject::ConditionalDestroy()
+    [FieldOffset(84)]
+    public IntPtr ConditionalDestroy;
+
+    // UObject::ConditionalPostLoad()
+    [FieldOffset(88)]
+    public IntPtr ConditionalPostLoad;
+
+    // FWindowsViewport::ProcessDeferredMessage()
+    [FieldOffset(92)]
+    public IntPtr ProcessDeferredMessage;
+
+    private static NativeApi* s_current = null;
+
+    /// <summary>
+    /// The table passed in by BmSDK.Host. Lives for the whole session.
+    /// </summary>
+    public static NativeApi* Current => s_current != null ? s_current : throw NotInitialized();
+
+    public static bool IsInitialized => s_current != null;
+
+    public static void Init(NativeApi* api)
+    {
+        Guard.Require(api != null, "BmSDK.Host passed no native API table");
+        Guard.Require(
+            api->Version == CurrentVersion && api->Size == SizeInBytes,
+            $"Native API mismatch (host v{api->Version}, {api->Size} bytes; expected v{CurrentVersion}, {SizeInBytes} bytes). Are BmSDK.Host and BmSDK out of sync?"
+        );
+
+        s_current = api;
+    }
+
+    private static InvalidOperationException NotInitialized() =>
+        new("Native API used before BmSDK.Host passed it in");
+}
@@ -0,0 +1,76 @@
+namespace BmSDK.Framework;
+
+/// <summary>
+/// Managed side of the native UObject::ProcessInternal() detour in BmSDK.Host.
+/// The host only forwards calls to functions marked here, every other call runs
+/// the original without entering .NET. Redirected functions are marked as they're
+/// configured, lifecycle hooks as they're loaded.
+/// </summary>
+internal static unsafe class ProcessInternalFilter
+{
+    // Functions Loader always needs to see, whether or not anything redirects them
+    private static readonly HashSet<string> s_hookFuncPaths = [];
+    private static readonly List<Function> s_hookFuncs = [];
+
+    // Native code only holds a function pointer, so keep the delegate alive here
+    private static GameFunctions.ProcessInternalDelegate? s_managedDetour = null;
+
+    /// <summary>
+    /// Queues the native detour with the given managed handler. Its original can be
+    /// called once the current detour batch is committed (see <see cref="DetourUtil"/>).
+    /// </summary>
+    public static QueuedDetour<GameFunctions.ProcessInternalDelegate> RegisterDetour(
+        GameFunctions.ProcessInternalDelegate managedDetour
+    )
+    {
+        s_managedDetour = managedDetour;
+        var origFuncSlot = HostExports.RegisterProcessInternalDetour(
+            Marshal.GetFunctionPointerForDelegate(managedDetour)
+        );
+
+        Guard.Require(origFuncSlot != null, "Couldn't queue the ProcessInternal detour");
+        return new QueuedDetour<GameFunctions.ProcessInternalDelegate>(origFuncSlot);
+    }
+
+    /// <summary>
+    /// Marks the function with the given path once it's loaded. Should be run before engine load.
+    /// </summary>
+    public static void AddHook(string funcPath) => s_hookFuncPaths.Add(funcPath);
+
+    /// <summary>
+    /// Marks the given function if it's a lifecycle hook.
+    /// Should be run after UFunction serialization.
+    /// </summary>
+    public static void OnFunctionLoaded(Function func, string funcPath)
+    {
+        if (s_hookFuncPaths.Contains(funcPath))
+        {
+            s_hookFuncs.Add(func);
+            Add(func);
+        }
+    }
+
+    public static void Add(Function func) =>
+        HostExports.SetProcessInternalFilter(GetObjectIndex(func), true);
+
+    public static void Remove(Function func) =>
+        HostExports.SetProcessInternalFilter(GetObjectIndex(func), false);
+
+    /// <summary>
+    /// Unmarks every function except the lifecycle hooks.
+    /// </summary>
+    public static void Reset()
+    {
+        HostExports.ClearProcessInternalFilter();
+        s_hookFuncs.ForEach(Add);
+    }
+
+    /// <summary>
+    /// Forwards every call while set. Redirects need this to see re-entry through overrides.
+    /// </summary>
+    public static void SetPassAll(bool passAll) =>
+        HostExports.SetProcessInternalPassAll(passAll);
+
+    private static uint GetObjectIndex(Function func) =>
+        *(uint*)(func.Ptr + GameInfo.MemberOffsets.Object__ObjectInternalInteger).ToPointer();
+}
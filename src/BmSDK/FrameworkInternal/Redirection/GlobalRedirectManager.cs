@@ -108,11 +108,19 @@ internal sealed class GlobalRedirectManager(BindingFlags genericRedirSearchFlags
         }
 
         var objType = obj.GetType();
+        var hasObjInterval = StaticInit.TryGetClassTreeInterval(objType, out var objInterval);
 
         return infos.Where(info =>
         {
             if (info.AllowSubtypes)
             {
+                // Both sides numbered: two integer compares, no lookups per redirect
+                if (hasObjInterval && info.TargetInterval is { } targetInterval)
+                {
+                    return targetInterval.Contains(objInterval);
+                }
+
+                // One side isn't generated, so there's no numbering to look up per redirect
                 return objType.IsAssignableTo(info.TargetType);
             }
             else
@@ -39,9 +39,9 @@ internal static class RedirectManager
     /// </summary>
     /// <returns>True, if the function had been registered for redirection;
     /// false, otherwise</returns>
-    public static bool TryConfigureFunction(Function func)
+    public static bool TryConfigureFunction(Function func, string funcPath)
     {
-        if (s_redirectFuncs.Contains(func.GetPathName()))
+        if (s_redirectFuncs.Contains(funcPath))
         {
             ConfigureFunction(func);
             return true;
@@ -54,9 +54,14 @@ internal static class RedirectManager
     /// Configures any given UFunction for redirects. Should only be run, when sure that
     /// the function is actually redirected and after the function has been serialized.
     /// </summary>
-    public static void ConfigureFunction(Function func) =>
+    public static void ConfigureFunction(Function func)
+    {
         func.FunctionFlags |= Function.EFunctionFlags.FUNC_Defined;
 
+        // Let calls to it through the native ProcessInternal() filter
+        ProcessInternalFilter.Add(func);
+    }
+
     /// <summary>
     /// Configures every registered UFunction object for redirection.
     /// This should be called after all redirects have been registered on mod reload.
@@ -120,6 +125,9 @@ internal static class RedirectManager
         var newCall = new RedirectCall(selfObj, funcObj, redirs.ToArray());
         s_redirectCalls.Push(newCall);
 
+        // Re-entry may come through overrides, which the native filter doesn't know about
+        ProcessInternalFilter.SetPassAll(true);
+
         try
         {
             newCall.NextRedirect()!.Run(selfObj, funcObj, stackPtr, Result);
@@ -128,6 +136,7 @@ internal static class RedirectManager
         {
             // Pop the function off the stack when the invocation is over
             s_redirectCalls.Pop();
+            ProcessInternalFilter.SetPassAll(s_redirectCalls.Count > 0);
         }
 
         return true;
@@ -153,5 +162,6 @@ internal static class RedirectManager
         Global.UnregisterAll();
         Local.UnregisterAll();
         s_redirectFuncs.Clear();
+        ProcessInternalFilter.Reset();
     }
 }
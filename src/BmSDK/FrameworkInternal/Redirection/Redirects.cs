@@ -37,6 +37,12 @@ internal sealed record GlobalRedirectorInfo(
 {
     public MethodInvoker Invoker { get; } = MethodInvoker.Create(RedirectMethod);
 
+    /// <summary>
+    /// Class tree numbering of <see cref="TargetType"/>, or null if it isn't a generated type.
+    /// </summary>
+    public ClassTreeInterval? TargetInterval { get; } =
+        StaticInit.TryGetClassTreeInterval(TargetType, out var interval) ? interval : null;
+
     private Type[]? _paramTypes;
 
     public Type[] GetParamTypes(Function func)
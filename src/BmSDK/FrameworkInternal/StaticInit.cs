@@ -1,15 +1,85 @@
+using System.Collections.Frozen;
 using System.Reflection;
 
 namespace BmSDK.Framework;
 
+/// <summary>
+/// Depth-first (pre, post) numbers of a generated class in the class tree.
+/// </summary>
+internal readonly record struct ClassTreeInterval(int Pre, int Post)
+{
+    /// <summary>
+    /// Whether the class numbered <paramref name="other"/> is this class or derives from it.
+    /// </summary>
+    public bool Contains(ClassTreeInterval other) => Pre <= other.Pre && other.Pre <= Post;
+}
+
 internal static partial class StaticInit
 {
     private const BindingFlags FuncSearchFlags =
         BindingFlags.Instance | BindingFlags.Static | BindingFlags.Public;
 
+    private static FrozenDictionary<string, Type> s_classPathToManagedTypeMap = null!;
+    private static FrozenDictionary<Type, string> s_managedTypeToClassPathMap = null!;
+
+    // Depth-first (pre, post) numbering of each generated type in the class tree
+    private static FrozenDictionary<Type, ClassTreeInterval> s_classTreeIntervalMap = null!;
+
+    // Self-and-supers chain of each type asked about so far, so it's only walked once
+    private static readonly Dictionary<Type, Type[]> s_selfAndSupersMap = [];
+
+    // Keyed by the class and outer FNames, so wrapping objects doesn't need to build path strings
+    private static readonly Dictionary<(int, int, int, int), Type> s_classNameToManagedTypeMap = [];
+
+    /// <summary>
+    /// Builds the lookup tables from the generated class tables.
+    /// </summary>
+    public static void StaticInitClasses()
+    {
+        s_classPathToManagedTypeMap = s_classPaths
+            .Zip(s_managedTypes)
+            .ToFrozenDictionary(pair => pair.First, pair => pair.Second);
+        s_managedTypeToClassPathMap = s_classPaths
+            .Zip(s_managedTypes)
+            .ToFrozenDictionary(pair => pair.Second, pair => pair.First);
+        s_classTreeIntervalMap = s_managedTypes
+            .Select((type, i) => (type, i))
+            .ToFrozenDictionary(
+                pair => pair.type,
+                pair => new ClassTreeInterval(
+                    s_classTreeIntervals[pair.i * 2],
+                    s_classTreeIntervals[pair.i * 2 + 1]
+                )
+            );
+    }
+
+    /// <summary>
+    /// Gets the class tree numbering of a generated type. Callers that test the same types
+    /// repeatedly should look this up once and compare intervals from then on.
+    /// </summary>
+    public static bool TryGetClassTreeInterval(Type type, out ClassTreeInterval interval) =>
+        s_classTreeIntervalMap.TryGetValue(type, out interval);
+
+    /// <summary>
+    /// Checks whether a type is or derives from another, using the class tree numbering
+    /// for generated types. Other types fall back to reflection.
+    /// </summary>
+    public static bool IsSubclassOf(Type type, Type baseType)
+    {
+        if (
+            TryGetClassTreeInterval(type, out var interval)
+            && TryGetClassTreeInterval(baseType, out var baseInterval)
+        )
+        {
+            return baseInterval.Contains(interval);
+        }
+
+        return type.IsAssignableTo(baseType);
+    }
+
     public static Type GetManagedTypeForClassPath(string classPath)
     {
-        if (_classPathToManagedTypeMap.TryGetValue(classPath, out var res))
+        if (s_classPathToManagedTypeMap.TryGetValue(classPath, out var res))
         {
             return res;
         }
@@ -18,9 +88,60 @@ internal static partial class StaticInit
         return typeof(GameObject);
     }
 
+    /// <summary>
+    /// Gets the managed type for a class object. The class path string is only built the first
+    /// time each class is seen. Classes trimmed from the SDK (see SdkRoots.txt) get the managed
+    /// type of their nearest generated super.
+    /// </summary>
+    public static Type GetManagedTypeForClass(IntPtr classPtr)
+    {
+        var (className, outerName) = GetClassNames(classPtr);
+        var key = (className.Index, className.Number, outerName.Index, outerName.Number);
+        if (!s_classNameToManagedTypeMap.TryGetValue(key, out var res))
+        {
+            res = s_classNameToManagedTypeMap[key] = FindNearestManagedType(classPtr);
+        }
+
+        return res;
+    }
+
+    private static unsafe Type FindNearestManagedType(IntPtr classPtr)
+    {
+        for (
+            var superPtr = classPtr;
+            superPtr != IntPtr.Zero;
+            superPtr = *(IntPtr*)(superPtr + GameInfo.MemberOffsets.Struct__SuperStruct).ToPointer()
+        )
+        {
+            var (superName, superOuterName) = GetClassNames(superPtr);
+            if (
+                s_classPathToManagedTypeMap.TryGetValue(
+                    $"{superOuterName}.{superName}",
+                    out var res
+                )
+            )
+            {
+                return res;
+            }
+        }
+
+        var (className, outerName) = GetClassNames(classPtr);
+        Debug.LogWarning($"Couldn't find managed type for class '{outerName}.{className}'");
+        return typeof(GameObject);
+    }
+
+    private static unsafe (FName Name, FName OuterName) GetClassNames(IntPtr classPtr)
+    {
+        var classOuterPtr = *(IntPtr*)(classPtr + GameInfo.MemberOffsets.Object__Outer).ToPointer();
+        return (
+            *(FName*)(classPtr + GameInfo.MemberOffsets.Object__Name).ToPointer(),
+            *(FName*)(classOuterPtr + GameInfo.MemberOffsets.Object__Name).ToPointer()
+        );
+    }
+
     public static string GetClassPathForManagedType(Type type)
     {
-        _managedTypeToClassPathMap.TryGetValue(type, out var res);
+        s_managedTypeToClassPathMap.TryGetValue(type, out var res);
         return Guard.NotNull(
             res,
             $"{type.FullName} is not a managed type for any in-game unmanaged type."
@@ -29,17 +150,25 @@ internal static partial class StaticInit
 
     /// <summary>
     /// Returns an enumerable collection of the specified type and all its base types, starting from the given type and
-    /// traversing up the inheritance hierarchy.
+    /// traversing up the inheritance hierarchy. Each type's chain is only walked once.
     /// </summary>
     /// <param name="type">The type from which to begin enumeration. Must not be null.</param>
     /// <returns>An enumerable sequence of <see cref="Type"/> objects, beginning with <paramref name="type"/> and followed by
     /// each of its base types up to the root.</returns>
-    public static IEnumerable<Type> EnumerateSelfAndSupers(Type type)
+    public static IReadOnlyList<Type> EnumerateSelfAndSupers(Type type)
     {
-        for (var cur = type; cur != null; cur = cur.BaseType)
+        if (!s_selfAndSupersMap.TryGetValue(type, out var res))
         {
-            yield return cur;
+            var supers = new List<Type>();
+            for (var cur = type; cur != null; cur = cur.BaseType)
+            {
+                supers.Add(cur);
+            }
+
+            res = s_selfAndSupersMap[type] = [.. supers];
         }
+
+        return res;
     }
 
     /// <summary>
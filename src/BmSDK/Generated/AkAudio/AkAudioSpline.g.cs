@@ -78,24 +78,26 @@ public partial class AkAudioSpline : BmSDK.Engine.SplineActor, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AkAudioSpline>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetAudioSpatialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetAudioSpatial_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+        [FieldOffset(4)] public System.Numerics.Vector3 SoundPosition;
+        [FieldOffset(16)] public BmSDK.Rotator SoundOrientation;
+    }
+
     /// <summary>
     /// Function: GetAudioSpatial
     /// </summary>
     public unsafe override void GetAudioSpatial(BmSDK.Engine.AkComponent akComp, out System.Numerics.Vector3 SoundPosition, out BmSDK.Rotator SoundOrientation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioSpline.GetAudioSpatial", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        SoundPosition = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
-        SoundOrientation = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 16);
+        var funcManaged = s_GetAudioSpatialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioSpline.GetAudioSpatial", true);
+        var parms = new GetAudioSpatial_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        SoundPosition = parms.SoundPosition;
+        SoundOrientation = parms.SoundOrientation;
         return;
     }
 
@@ -113,8 +115,8 @@ public partial class AkAudioSpline : BmSDK.Engine.SplineActor, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AkWwise.EListenerID SplineAudioFollowListener
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.EListenerID>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(BmSDK.Engine.AkWwise.EListenerID*)(Ptr + 512); }
+        set { *(BmSDK.Engine.AkWwise.EListenerID*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -122,8 +124,8 @@ public partial class AkAudioSpline : BmSDK.Engine.SplineActor, BmSDK.IGameObject
     /// </summary>
     public unsafe float SplineAudioSmoothing
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(float*)(Ptr + 516); }
+        set { *(float*)(Ptr + 516) = value; }
     }
 
     /// <summary>
@@ -140,8 +142,8 @@ public partial class AkAudioSpline : BmSDK.Engine.SplineActor, BmSDK.IGameObject
     /// </summary>
     public unsafe float SplineAudioNodeValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(float*)(Ptr + 524); }
+        set { *(float*)(Ptr + 524) = value; }
     }
 
     /// <summary>
@@ -149,8 +151,8 @@ public partial class AkAudioSpline : BmSDK.Engine.SplineActor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AudioSplineVisited
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 528) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 528); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 528); }
+        get { return (*(int*)(Ptr + 528) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 528) |= 1; else *(int*)(Ptr + 528) &= ~1; }
     }
 
     /// <summary>
@@ -170,8 +172,8 @@ public partial class AkAudioSpline : BmSDK.Engine.SplineActor, BmSDK.IGameObject
     /// </summary>
     public unsafe double AudioSplineLastUpdateTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<double>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(double*)(Ptr + 556); }
+        set { *(double*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -179,7 +181,7 @@ public partial class AkAudioSpline : BmSDK.Engine.SplineActor, BmSDK.IGameObject
     /// </summary>
     public unsafe float AudioSplineNodeValueBuffer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(float*)(Ptr + 564); }
+        set { *(float*)(Ptr + 564) = value; }
     }
 }
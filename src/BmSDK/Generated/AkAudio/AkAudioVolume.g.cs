@@ -78,69 +78,96 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AkAudioVolume>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UnTouchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnTouch_Params
+    {
+        [FieldOffset(0)] public nint Other;
+    }
+
     /// <summary>
     /// Function: UnTouch
     /// </summary>
     public unsafe override void UnTouch(BmSDK.Engine.Actor Other)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.UnTouch", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Other, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnTouchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.UnTouch", true);
+        var parms = new UnTouch_Params();
+        parms.Other = Other?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TouchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct Touch_Params
+    {
+        [FieldOffset(0)] public nint Other;
+        [FieldOffset(4)] public nint OtherComp;
+        [FieldOffset(8)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(20)] public System.Numerics.Vector3 HitNormal;
+    }
+
     /// <summary>
     /// Function: Touch
     /// </summary>
     public unsafe override void Touch(BmSDK.Engine.Actor Other, BmSDK.Engine.PrimitiveComponent OtherComp, System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 HitNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.Touch", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Other, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TouchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.Touch", true);
+        var parms = new Touch_Params();
+        parms.Other = Other?.Ptr ?? 0;
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        parms.HitLocation = HitLocation;
+        parms.HitNormal = HitNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleTouchInOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HandleTouchInOut_Params
+    {
+        [FieldOffset(0)] public nint Other;
+        [FieldOffset(4)] public int OtherIsTouching;
+    }
+
     /// <summary>
     /// Function: HandleTouchInOut
     /// </summary>
     public unsafe virtual void HandleTouchInOut(BmSDK.Engine.Actor Other, bool OtherIsTouching)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.HandleTouchInOut", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Other, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherIsTouching, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_HandleTouchInOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.HandleTouchInOut", true);
+        var parms = new HandleTouchInOut_Params();
+        parms.Other = Other?.Ptr ?? 0;
+        parms.OtherIsTouching = OtherIsTouching ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EvaluateAudioActivationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EvaluateAudioActivation_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: EvaluateAudioActivation
     /// </summary>
     public unsafe override float EvaluateAudioActivation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.EvaluateAudioActivation", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_EvaluateAudioActivationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.EvaluateAudioActivation", true);
+        var parms = new EvaluateAudioActivation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAudioSpatialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetAudioSpatial_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+        [FieldOffset(4)] public System.Numerics.Vector3 SoundPosition;
+        [FieldOffset(16)] public BmSDK.Rotator SoundOrientation;
     }
 
     /// <summary>
@@ -148,38 +175,31 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe override void GetAudioSpatial(BmSDK.Engine.AkComponent akComp, out System.Numerics.Vector3 SoundPosition, out BmSDK.Rotator SoundOrientation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.GetAudioSpatial", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        SoundPosition = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
-        SoundOrientation = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 16);
+        var funcManaged = s_GetAudioSpatialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.GetAudioSpatial", true);
+        var parms = new GetAudioSpatial_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        SoundPosition = parms.SoundPosition;
+        SoundOrientation = parms.SoundOrientation;
         return;
     }
 
+    static BmSDK.Function s_OverrideAkComponentDefaultsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OverrideAkComponentDefaults_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+    }
+
     /// <summary>
     /// Function: OverrideAkComponentDefaults
     /// </summary>
     public unsafe override void OverrideAkComponentDefaults(BmSDK.Engine.AkComponent akComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.OverrideAkComponentDefaults", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OverrideAkComponentDefaultsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkAudioVolume.OverrideAkComponentDefaults", true);
+        var parms = new OverrideAkComponentDefaults_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -206,8 +226,8 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ForceUpdateTouching
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 1; else *(int*)(Ptr + 488) &= ~1; }
     }
 
     /// <summary>
@@ -215,8 +235,8 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(float*)(Ptr + 492); }
+        set { *(float*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -260,8 +280,8 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe int TouchingCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 560); }
+        get { return *(int*)(Ptr + 560); }
+        set { *(int*)(Ptr + 560) = value; }
     }
 
     /// <summary>
@@ -269,8 +289,8 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe int ListenerEnvironmentCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(int*)(Ptr + 564); }
+        set { *(int*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -278,8 +298,8 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe double LastTouchingUpdateTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<double>(Ptr + 568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 568); }
+        get { return *(double*)(Ptr + 568); }
+        set { *(double*)(Ptr + 568) = value; }
     }
 
     /// <summary>
@@ -288,6 +308,8 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 8)]
     public partial record struct FTouchingActorInfo
     {
+        [FieldOffset(4)] private int _bitfield4;
+
         /// <summary>
         /// ObjectProperty: TouchingActor
         /// </summary>
@@ -300,10 +322,10 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: TouchingFlag
         /// </summary>
-        public unsafe bool TouchingFlag
+        public bool TouchingFlag
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1) != 0;
+            set { if (value) _bitfield4 |= 1; else _bitfield4 &= ~1; }
         }
     }
 
@@ -313,40 +335,30 @@ public partial class AkAudioVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 16)]
     public partial record struct FAkAxisParameter
     {
+        [FieldOffset(12)] private int _bitfield12;
+
         /// <summary>
         /// FloatProperty: High
         /// </summary>
-        public unsafe float High
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float High;
 
         /// <summary>
         /// FloatProperty: Low
         /// </summary>
-        public unsafe float Low
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Low;
 
         /// <summary>
         /// FloatProperty: Mid
         /// </summary>
-        public unsafe float Mid
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Mid;
 
         /// <summary>
         /// BoolProperty: Enabled
         /// </summary>
-        public unsafe bool Enabled
+        public bool Enabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
     }
 }
@@ -78,163 +78,198 @@ public partial class AkEmitter : BmSDK.Engine.AkSoundActor, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AkEmitter>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_StopEmitterEventsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopEmitterEvents_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopEmitterEvents
     /// </summary>
     public unsafe virtual void StopEmitterEvents()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.StopEmitterEvents", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_StopEmitterEventsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.StopEmitterEvents", true);
+        var parms = new StopEmitterEvents_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartEmitterEventsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartEmitterEvents_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartEmitterEvents
     /// </summary>
     public unsafe virtual void StartEmitterEvents()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.StartEmitterEvents", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_StartEmitterEventsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.StartEmitterEvents", true);
+        var parms = new StartEmitterEvents_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnAudioSourceDestroyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnAudioSourceDestroy_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+    }
+
     /// <summary>
     /// Function: OnAudioSourceDestroy
     /// </summary>
     public unsafe override void OnAudioSourceDestroy(BmSDK.Engine.AkComponent akComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.OnAudioSourceDestroy", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OnAudioSourceDestroyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.OnAudioSourceDestroy", true);
+        var parms = new OnAudioSourceDestroy_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnAudioSourceCreateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnAudioSourceCreate_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+    }
+
     /// <summary>
     /// Function: OnAudioSourceCreate
     /// </summary>
     public unsafe override void OnAudioSourceCreate(BmSDK.Engine.AkComponent akComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.OnAudioSourceCreate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OnAudioSourceCreateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.OnAudioSourceCreate", true);
+        var parms = new OnAudioSourceCreate_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ApplyEmitterSpatialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ApplyEmitterSpatial_Params
+    {
+    }
+
     /// <summary>
     /// Function: ApplyEmitterSpatial
     /// </summary>
     public unsafe virtual void ApplyEmitterSpatial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.ApplyEmitterSpatial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ApplyEmitterSpatialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.ApplyEmitterSpatial", true);
+        var parms = new ApplyEmitterSpatial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnToggleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnToggle_Params
+    {
+        [FieldOffset(0)] public nint ToggleAction;
+    }
+
     /// <summary>
     /// Function: OnToggle
     /// </summary>
     public unsafe virtual void OnToggle(BmSDK.Engine.SeqAct_Toggle ToggleAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.OnToggle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ToggleAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.OnToggle", true);
+        var parms = new OnToggle_Params();
+        parms.ToggleAction = ToggleAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableEmitterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EnableEmitter_Params
+    {
+        [FieldOffset(0)] public int Enable;
+    }
+
     /// <summary>
     /// Function: EnableEmitter
     /// </summary>
     public unsafe virtual void EnableEmitter(bool Enable)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.EnableEmitter", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Enable, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableEmitterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.EnableEmitter", true);
+        var parms = new EnableEmitter_Params();
+        parms.Enable = Enable ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Destroyed_Params
+    {
+    }
+
     /// <summary>
     /// Function: Destroyed
     /// </summary>
     public unsafe override void Destroyed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.Destroyed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.Destroyed", true);
+        var parms = new Destroyed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreStreamOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreStreamOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreStreamOut
     /// </summary>
     public unsafe override void PreStreamOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.PreStreamOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreStreamOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.PreStreamOut", true);
+        var parms = new PreStreamOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CleanupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Cleanup_Params
+    {
+    }
+
     /// <summary>
     /// Function: Cleanup
     /// </summary>
     public unsafe virtual void Cleanup()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.Cleanup", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CleanupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.Cleanup", true);
+        var parms = new Cleanup_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkEmitter.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -261,8 +296,8 @@ public partial class AkEmitter : BmSDK.Engine.AkSoundActor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool EmitterStartEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 456); }
+        get { return (*(int*)(Ptr + 456) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 456) |= 1; else *(int*)(Ptr + 456) &= ~1; }
     }
 
     /// <summary>
@@ -270,8 +305,8 @@ public partial class AkEmitter : BmSDK.Engine.AkSoundActor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool EmitterEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 456); }
+        get { return (*(int*)(Ptr + 456) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 456) |= 2; else *(int*)(Ptr + 456) &= ~2; }
     }
 
     /// <summary>
@@ -288,8 +323,8 @@ public partial class AkEmitter : BmSDK.Engine.AkSoundActor, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(float*)(Ptr + 472); }
+        set { *(float*)(Ptr + 472) = value; }
     }
 
     /// <summary>
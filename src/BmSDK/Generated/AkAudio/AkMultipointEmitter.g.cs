@@ -78,41 +78,49 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
         where TComponent : class, Framework.IScriptComponent<AkMultipointEmitter>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HandleUnlinkAllFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HandleUnlinkAll_Params
+    {
+    }
+
     /// <summary>
     /// Function: HandleUnlinkAll
     /// </summary>
     public unsafe virtual void HandleUnlinkAll()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.HandleUnlinkAll", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_HandleUnlinkAllFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.HandleUnlinkAll", true);
+        var parms = new HandleUnlinkAll_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleUnlinkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HandleUnlink_Params
+    {
+        [FieldOffset(0)] public nint Target;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HandleUnlink
     /// </summary>
     public unsafe virtual bool HandleUnlink(BmSDK.Engine.Actor Target)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.HandleUnlink", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_HandleUnlinkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.HandleUnlink", true);
+        var parms = new HandleUnlink_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HandleLinkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HandleLink_Params
+    {
+        [FieldOffset(0)] public nint Target;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -120,18 +128,17 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe virtual bool HandleLink(BmSDK.Engine.Actor Target)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.HandleLink", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_HandleLinkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.HandleLink", true);
+        var parms = new HandleLink_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ApplyEmitterSpatialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ApplyEmitterSpatial_Params
+    {
     }
 
     /// <summary>
@@ -139,135 +146,141 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe override void ApplyEmitterSpatial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.ApplyEmitterSpatial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ApplyEmitterSpatialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.ApplyEmitterSpatial", true);
+        var parms = new ApplyEmitterSpatial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAudioSpatialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetAudioSpatial_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+        [FieldOffset(4)] public System.Numerics.Vector3 SoundPosition;
+        [FieldOffset(16)] public BmSDK.Rotator SoundOrientation;
+    }
+
     /// <summary>
     /// Function: GetAudioSpatial
     /// </summary>
     public unsafe override void GetAudioSpatial(BmSDK.Engine.AkComponent akComp, out System.Numerics.Vector3 SoundPosition, out BmSDK.Rotator SoundOrientation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.GetAudioSpatial", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        SoundPosition = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
-        SoundOrientation = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 16);
+        var funcManaged = s_GetAudioSpatialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.GetAudioSpatial", true);
+        var parms = new GetAudioSpatial_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        SoundPosition = parms.SoundPosition;
+        SoundOrientation = parms.SoundOrientation;
         return;
     }
 
+    static BmSDK.Function s_OnAudioDebugRenderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OnAudioDebugRender_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+        [FieldOffset(4)] public int DebugCulled;
+    }
+
     /// <summary>
     /// Function: OnAudioDebugRender
     /// </summary>
     public unsafe override void OnAudioDebugRender(BmSDK.Engine.AkComponent akComp, bool DebugCulled)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.OnAudioDebugRender", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DebugCulled, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OnAudioDebugRenderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.OnAudioDebugRender", true);
+        var parms = new OnAudioDebugRender_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        parms.DebugCulled = DebugCulled ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnAudioTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OnAudioTick_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+        [FieldOffset(4)] public float TimeDelta;
+    }
+
     /// <summary>
     /// Function: OnAudioTick
     /// </summary>
     public unsafe override void OnAudioTick(BmSDK.Engine.AkComponent akComp, float TimeDelta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.OnAudioTick", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeDelta, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OnAudioTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.OnAudioTick", true);
+        var parms = new OnAudioTick_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        parms.TimeDelta = TimeDelta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnAudioSourceDestroyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnAudioSourceDestroy_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+    }
+
     /// <summary>
     /// Function: OnAudioSourceDestroy
     /// </summary>
     public unsafe override void OnAudioSourceDestroy(BmSDK.Engine.AkComponent akComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.OnAudioSourceDestroy", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OnAudioSourceDestroyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.OnAudioSourceDestroy", true);
+        var parms = new OnAudioSourceDestroy_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnAudioSourceCreateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnAudioSourceCreate_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+    }
+
     /// <summary>
     /// Function: OnAudioSourceCreate
     /// </summary>
     public unsafe override void OnAudioSourceCreate(BmSDK.Engine.AkComponent akComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.OnAudioSourceCreate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OnAudioSourceCreateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.OnAudioSourceCreate", true);
+        var parms = new OnAudioSourceCreate_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAkComponentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetAkComponent_Params
+    {
+        [FieldOffset(0)] public int AllowCreate;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAkComponent
     /// </summary>
     public unsafe override BmSDK.Engine.AkComponent GetAkComponent(bool AllowCreate = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.GetAkComponent", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AllowCreate, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkComponent>(paramsPtr + 4);
+        var funcManaged = s_GetAkComponentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.GetAkComponent", true);
+        var parms = new GetAkComponent_Params();
+        parms.AllowCreate = AllowCreate ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkComponent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_UnlinkToActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnlinkToActor_Params
+    {
+        [FieldOffset(0)] public nint LinkTarget;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -275,11 +288,19 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe override bool UnlinkToActor(BmSDK.Engine.Actor LinkTarget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.UnlinkToActor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LinkTarget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UnlinkToActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.UnlinkToActor", true);
+        var parms = new UnlinkToActor_Params();
+        parms.LinkTarget = LinkTarget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_LinkToActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct LinkToActor_Params
+    {
+        [FieldOffset(0)] public nint LinkTarget;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -287,11 +308,17 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe override bool LinkToActor(BmSDK.Engine.Actor LinkTarget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.LinkToActor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LinkTarget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_LinkToActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.LinkToActor", true);
+        var parms = new LinkToActor_Params();
+        parms.LinkTarget = LinkTarget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Destroyed_Params
+    {
     }
 
     /// <summary>
@@ -299,20 +326,26 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe override void Destroyed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.Destroyed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.Destroyed", true);
+        var parms = new Destroyed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreStreamOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreStreamOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreStreamOut
     /// </summary>
     public unsafe override void PreStreamOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.PreStreamOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreStreamOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkMultipointEmitter.PreStreamOut", true);
+        var parms = new PreStreamOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -321,8 +354,8 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.AkAudio.AkMultipointEmitter.EMultipointEmitterType MultipointType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.AkMultipointEmitter.EMultipointEmitterType>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(BmSDK.AkAudio.AkMultipointEmitter.EMultipointEmitterType*)(Ptr + 480); }
+        set { *(BmSDK.AkAudio.AkMultipointEmitter.EMultipointEmitterType*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -330,8 +363,8 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.Engine.AkWwise.EListenerID MultipointFollowListener
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.EListenerID>(Ptr + 481); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 481); }
+        get { return *(BmSDK.Engine.AkWwise.EListenerID*)(Ptr + 481); }
+        set { *(BmSDK.Engine.AkWwise.EListenerID*)(Ptr + 481) = value; }
     }
 
     /// <summary>
@@ -348,8 +381,8 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe bool MultipointParameterIsGlobal
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 1; else *(int*)(Ptr + 488) &= ~1; }
     }
 
     /// <summary>
@@ -357,8 +390,8 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe bool MultipointProximityParameterIsGlobal
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 2; else *(int*)(Ptr + 488) &= ~2; }
     }
 
     /// <summary>
@@ -366,8 +399,8 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe bool EmitterLinkVisited
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 4; else *(int*)(Ptr + 488) &= ~4; }
     }
 
     /// <summary>
@@ -384,8 +417,8 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe float MultipointNodeValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(float*)(Ptr + 496); }
+        set { *(float*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -393,8 +426,8 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe float MultipointNodeProximityRadiusMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(float*)(Ptr + 500); }
+        set { *(float*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -402,8 +435,8 @@ public partial class AkMultipointEmitter : BmSDK.AkAudio.AkEmitter, BmSDK.IGameO
     /// </summary>
     public unsafe float MultipointNodeProximityRadiusMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }
+        get { return *(float*)(Ptr + 504); }
+        set { *(float*)(Ptr + 504) = value; }
     }
 
     /// <summary>
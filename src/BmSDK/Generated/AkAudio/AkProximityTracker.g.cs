@@ -78,34 +78,41 @@ public partial class AkProximityTracker : BmSDK.Engine.Actor, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AkProximityTracker>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_OnToggleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnToggle_Params
+    {
+        [FieldOffset(0)] public nint ToggleAction;
+    }
+
     /// <summary>
     /// Function: OnToggle
     /// </summary>
     public unsafe virtual void OnToggle(BmSDK.Engine.SeqAct_Toggle ToggleAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkProximityTracker.OnToggle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ToggleAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkProximityTracker.OnToggle", true);
+        var parms = new OnToggle_Params();
+        parms.ToggleAction = ToggleAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EvaluateAudioActivationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EvaluateAudioActivation_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: EvaluateAudioActivation
     /// </summary>
     public unsafe override float EvaluateAudioActivation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkProximityTracker.EvaluateAudioActivation", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_EvaluateAudioActivationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "AkAudio.AkProximityTracker.EvaluateAudioActivation", true);
+        var parms = new EvaluateAudioActivation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -113,8 +120,8 @@ public partial class AkProximityTracker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AkWwise.EListenerID ProximityFollowListener
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.EListenerID>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(BmSDK.Engine.AkWwise.EListenerID*)(Ptr + 428); }
+        set { *(BmSDK.Engine.AkWwise.EListenerID*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -131,8 +138,8 @@ public partial class AkProximityTracker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ProximityTrackerEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 436) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 436); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 436); }
+        get { return (*(int*)(Ptr + 436) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 436) |= 1; else *(int*)(Ptr + 436) &= ~1; }
     }
 
     /// <summary>
@@ -140,8 +147,8 @@ public partial class AkProximityTracker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float OneRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(float*)(Ptr + 440); }
+        set { *(float*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -149,8 +156,8 @@ public partial class AkProximityTracker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZeroRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(float*)(Ptr + 444); }
+        set { *(float*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -176,8 +183,8 @@ public partial class AkProximityTracker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastActivationValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(float*)(Ptr + 456); }
+        set { *(float*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -185,7 +192,7 @@ public partial class AkProximityTracker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastDistanceToListenerSqr
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(float*)(Ptr + 460); }
+        set { *(float*)(Ptr + 460) = value; }
     }
 }
@@ -92,8 +92,8 @@ public partial class InterpTrackAkEvent : BmSDK.Engine.InterpTrack, BmSDK.IGameO
     /// </summary>
     public unsafe bool bFireEventsWhenForwards
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 1; else *(int*)(Ptr + 124) &= ~1; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class InterpTrackAkEvent : BmSDK.Engine.InterpTrack, BmSDK.IGameO
     /// </summary>
     public unsafe bool bFireEventsWhenBackwards
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 2; else *(int*)(Ptr + 124) &= ~2; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class InterpTrackAkEvent : BmSDK.Engine.InterpTrack, BmSDK.IGameO
     /// </summary>
     public unsafe bool bContinueSoundOnMatineeEnd
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 4; else *(int*)(Ptr + 124) &= ~4; }
     }
 
     /// <summary>
@@ -123,11 +123,7 @@ public partial class InterpTrackAkEvent : BmSDK.Engine.InterpTrack, BmSDK.IGameO
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Time;
 
         /// <summary>
         /// ObjectProperty: Event
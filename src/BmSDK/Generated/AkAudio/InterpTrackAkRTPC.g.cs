@@ -92,7 +92,7 @@ public partial class InterpTrackAkRTPC : BmSDK.Engine.InterpTrackFloatBase, BmSD
     /// </summary>
     public unsafe bool GlobalParam
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 188); }
+        get { return (*(int*)(Ptr + 188) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 188) |= 1; else *(int*)(Ptr + 188) &= ~1; }
     }
 }
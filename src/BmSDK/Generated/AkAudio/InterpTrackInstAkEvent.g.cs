@@ -83,8 +83,8 @@ public partial class InterpTrackInstAkEvent : BmSDK.Engine.InterpTrackInst, BmSD
     /// </summary>
     public unsafe float LastUpdatePosition
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(float*)(Ptr + 44); }
+        set { *(float*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class SeqAct_AkAudioEvent : BmSDK.Engine.SequenceAction, BmSDK.IG
     /// </summary>
     public unsafe int PendingCallbacks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(int*)(Ptr + 208); }
+        set { *(int*)(Ptr + 208) = value; }
     }
 }
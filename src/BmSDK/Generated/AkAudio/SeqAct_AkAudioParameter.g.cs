@@ -92,8 +92,8 @@ public partial class SeqAct_AkAudioParameter : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe float ToValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(float*)(Ptr + 208); }
+        set { *(float*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SeqAct_AkAudioParameter : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe float InterpolationTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(float*)(Ptr + 212); }
+        set { *(float*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class SeqAct_AkAudioParameter : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe float CurrentInterpolationTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class SeqAct_AkAudioParameter : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe double InterpolationStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<double>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(double*)(Ptr + 232); }
+        set { *(double*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -141,28 +141,16 @@ public partial class SeqAct_AkAudioParameter : BmSDK.Engine.SequenceAction, BmSD
         /// <summary>
         /// IntProperty: InterpolationSourceID
         /// </summary>
-        public unsafe int InterpolationSourceID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int InterpolationSourceID;
 
         /// <summary>
         /// FloatProperty: InterpolationStartValue
         /// </summary>
-        public unsafe float InterpolationStartValue
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float InterpolationStartValue;
 
         /// <summary>
         /// FloatProperty: InterpolationEndValue
         /// </summary>
-        public unsafe float InterpolationEndValue
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float InterpolationEndValue;
     }
 }
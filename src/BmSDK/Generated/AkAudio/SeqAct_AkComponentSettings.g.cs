@@ -92,8 +92,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool AutoPlayLifetimeEvent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 208); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool NeverAutoDestroySource
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 209); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 209); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 209); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 209) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool AlwaysAutoCreateSource
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 210); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 210); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 210); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 210) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool AutoDestroySourceWhenHidden
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 211); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 211); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 211); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 211) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool AutoDestroySourceWhenDead
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 212); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool KillSoundsOnDestroy
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 213); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 213); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 213); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 213) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool CameraDistanceParameters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 214); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 214); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 214); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 214) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool CameraOffsetParameters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 215); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 215); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 215); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 215) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool CameraAngleParameters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 216); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool PlayerDistanceParameters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 217); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 217); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 217); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 217) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool PlayerOffsetParameters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 218); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 218); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 218); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 218) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool PlayerAngleParameters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 219); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 219); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 219); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 219) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool ObjectVelocityParameters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 220); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool Enable2DMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 221); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 221); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 221); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 221) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool DialogueMeter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 222); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 222); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 222); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 222) = value; }
     }
 
     /// <summary>
@@ -227,8 +227,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool Occlusion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 223); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 223); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 223); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 223) = value; }
     }
 
     /// <summary>
@@ -236,8 +236,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool ParameterOnlyOcclusion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 224); }
+        set { *(BmSDK.AkAudio.SeqAct_AkComponentSettings.EAkComponentSettingsBool*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -254,8 +254,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float OcclusionUpdateTimeFast
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(float*)(Ptr + 232); }
+        set { *(float*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -263,8 +263,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float OcclusionUpdateTimeSlow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(float*)(Ptr + 236); }
+        set { *(float*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -272,8 +272,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float OcclusionInterpolationTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(float*)(Ptr + 240); }
+        set { *(float*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -281,8 +281,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float OcclusionScalingDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(float*)(Ptr + 244); }
+        set { *(float*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -290,8 +290,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float OcclusionMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(float*)(Ptr + 248); }
+        set { *(float*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -299,8 +299,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float OcclusionMultiplierAux
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(float*)(Ptr + 252); }
+        set { *(float*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -308,8 +308,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float WetDryMixVolume
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(float*)(Ptr + 256); }
+        set { *(float*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -317,8 +317,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float WetDryMixVolumeAux
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(float*)(Ptr + 260); }
+        set { *(float*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -326,8 +326,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float FalloffRadiusMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -335,8 +335,8 @@ public partial class SeqAct_AkComponentSettings : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float FalloffEnhancement
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
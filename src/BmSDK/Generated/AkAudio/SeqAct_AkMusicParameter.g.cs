@@ -92,8 +92,8 @@ public partial class SeqAct_AkMusicParameter : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe float ToValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(float*)(Ptr + 208); }
+        set { *(float*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class SeqAct_AkMusicParameter : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe float InterpolationTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(float*)(Ptr + 212); }
+        set { *(float*)(Ptr + 212) = value; }
     }
 }
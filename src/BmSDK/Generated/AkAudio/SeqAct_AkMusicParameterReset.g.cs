@@ -83,8 +83,8 @@ public partial class SeqAct_AkMusicParameterReset : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe float InterpolationTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(float*)(Ptr + 204); }
+        set { *(float*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class SeqAct_AkMusicParameterReset : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe bool OnlyResetThese
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 1; else *(int*)(Ptr + 220) &= ~1; }
     }
 }
@@ -92,8 +92,8 @@ public partial class SeqAct_AkMusicSync : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe float WaitTimeout
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(float*)(Ptr + 216); }
+        set { *(float*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SeqAct_AkMusicSync : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe float WaitTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(float*)(Ptr + 220); }
+        set { *(float*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class SeqAct_AkMusicSync : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe int WaitResult
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(int*)(Ptr + 224); }
+        set { *(int*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class SeqAct_AkMusicSync : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe bool Waiting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 228); }
+        get { return (*(int*)(Ptr + 228) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 228) |= 1; else *(int*)(Ptr + 228) &= ~1; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class SeqAct_AkStartMusic : BmSDK.Engine.SequenceAction, BmSDK.IG
     /// </summary>
     public unsafe bool AutoStatesOnOff
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 208); }
+        get { return (*(int*)(Ptr + 208) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 208) |= 1; else *(int*)(Ptr + 208) &= ~1; }
     }
 }
@@ -83,7 +83,7 @@ public partial class SeqAct_AkStopMusic : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe bool ResetMusicStates
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 1; else *(int*)(Ptr + 204) &= ~1; }
     }
 }
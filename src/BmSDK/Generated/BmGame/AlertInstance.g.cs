@@ -78,16 +78,31 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AlertInstance>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UpdateTypeIfBetterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateTypeIfBetter_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.AlertInstance.InterruptType NewType;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: UpdateTypeIfBetter
     /// </summary>
     public unsafe virtual bool UpdateTypeIfBetter(BmSDK.BmGame.AlertInstance.InterruptType NewType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.UpdateTypeIfBetter", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateTypeIfBetterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.UpdateTypeIfBetter", true);
+        var parms = new UpdateTypeIfBetter_Params();
+        parms.NewType = NewType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetPriority_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -95,10 +110,18 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetPriority()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.GetPriority", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.GetPriority", true);
+        var parms = new GetPriority_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetInterruptPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetInterruptPriority_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.AlertInstance.InterruptType TestType;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -106,11 +129,20 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static int GetInterruptPriority(BmSDK.BmGame.AlertInstance.InterruptType TestType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.GetInterruptPriority", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetInterruptPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.GetInterruptPriority", true);
+        var parms = new GetInterruptPriority_Params();
+        parms.TestType = TestType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct UpdateAlert_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 NewLocation;
+        [FieldOffset(12)] public BmSDK.BmGame.AlertInstance.InterruptType NewType;
+        [FieldOffset(16)] public float BackDateTime;
     }
 
     /// <summary>
@@ -118,24 +150,31 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void UpdateAlert(System.Numerics.Vector3 NewLocation, BmSDK.BmGame.AlertInstance.InterruptType NewType, float BackDateTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.UpdateAlert", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewType, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BackDateTime, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.UpdateAlert", true);
+        var parms = new UpdateAlert_Params();
+        parms.NewLocation = NewLocation;
+        parms.NewType = NewType;
+        parms.BackDateTime = BackDateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAlertLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetAlertLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAlertLocation
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetAlertLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.GetAlertLocation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetAlertLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.AlertInstance.GetAlertLocation", true);
+        var parms = new GetAlertLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -158,8 +197,8 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.AlertInstance.InterruptType Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.AlertInstance.InterruptType>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.BmGame.AlertInstance.InterruptType*)(Ptr + 60); }
+        set { *(BmSDK.BmGame.AlertInstance.InterruptType*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -167,8 +206,8 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.AlertInstance.VisibilityCategory StoredVisibility
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.AlertInstance.VisibilityCategory>(Ptr + 61); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 61); }
+        get { return *(BmSDK.BmGame.AlertInstance.VisibilityCategory*)(Ptr + 61); }
+        set { *(BmSDK.BmGame.AlertInstance.VisibilityCategory*)(Ptr + 61) = value; }
     }
 
     /// <summary>
@@ -176,8 +215,8 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float TimeSinceAlert
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -185,8 +224,8 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float TimeSinceSeen
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -194,8 +233,8 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float SightLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -203,8 +242,8 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 1; else *(int*)(Ptr + 76) &= ~1; }
     }
 
     /// <summary>
@@ -212,8 +251,8 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bGlanceable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 2; else *(int*)(Ptr + 76) &= ~2; }
     }
 
     /// <summary>
@@ -221,8 +260,8 @@ public partial class AlertInstance : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float TryGlanceTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
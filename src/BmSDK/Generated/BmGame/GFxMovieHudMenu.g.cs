@@ -78,61 +78,95 @@ public partial class GFxMovieHudMenu : BmSDK.GFxUI.GFxMoviePlayer, BmSDK.IGameOb
         where TComponent : class, Framework.IScriptComponent<GFxMovieHudMenu>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_QuitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Quit_Params
+    {
+    }
+
     /// <summary>
     /// Function: Quit
     /// </summary>
     public unsafe virtual void Quit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.Quit", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_QuitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.Quit", true);
+        var parms = new Quit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MenuCloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MenuClose_Params
+    {
+    }
+
     /// <summary>
     /// Function: MenuClose
     /// </summary>
     public unsafe virtual void MenuClose()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.MenuClose", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MenuCloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.MenuClose", true);
+        var parms = new MenuClose_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MenuOpenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MenuOpen_Params
+    {
+    }
+
     /// <summary>
     /// Function: MenuOpen
     /// </summary>
     public unsafe virtual void MenuOpen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.MenuOpen", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MenuOpenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.MenuOpen", true);
+        var parms = new MenuOpen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetupResolutionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetupResolution_Params
+    {
+        [FieldOffset(0)] public int X;
+        [FieldOffset(4)] public int Y;
+    }
+
     /// <summary>
     /// Function: SetupResolution
     /// </summary>
     public unsafe virtual void SetupResolution(int X, int Y)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.SetupResolution", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetupResolutionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.SetupResolution", true);
+        var parms = new SetupResolution_Params();
+        parms.X = X;
+        parms.Y = Y;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Start_Params
+    {
+        [FieldOffset(0)] public int StartPaused;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Start
     /// </summary>
     public unsafe override bool Start(bool StartPaused = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.Start", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartPaused, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_StartFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.GFxMovieHudMenu.Start", true);
+        var parms = new Start_Params();
+        parms.StartPaused = StartPaused ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 }
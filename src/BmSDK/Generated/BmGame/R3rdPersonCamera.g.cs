@@ -78,35 +78,50 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<R3rdPersonCamera>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UpdateCameraPositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateCameraPosition_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ProperReset;
+    }
+
     /// <summary>
     /// Function: UpdateCameraPosition
     /// </summary>
     public unsafe virtual void UpdateCameraPosition(float DeltaTime, bool ProperReset = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateCameraPosition", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ProperReset, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateCameraPositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateCameraPosition", true);
+        var parms = new UpdateCameraPosition_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.ProperReset = ProperReset ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetYawAnchorRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetYawAnchorRotation_Params
+    {
+        [FieldOffset(0)] public BmSDK.Rotator ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetYawAnchorRotation
     /// </summary>
     public unsafe virtual BmSDK.Rotator GetYawAnchorRotation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.GetYawAnchorRotation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 0);
+        var funcManaged = s_GetYawAnchorRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.GetYawAnchorRotation", true);
+        var parms = new GetYawAnchorRotation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetTunnelCameraDirectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetTunnelCameraDirection_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 InDirection;
     }
 
     /// <summary>
@@ -114,67 +129,96 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void GetTunnelCameraDirection(out System.Numerics.Vector3 InDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.GetTunnelCameraDirection", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        InDirection = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetTunnelCameraDirectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.GetTunnelCameraDirection", true);
+        var parms = new GetTunnelCameraDirection_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        InDirection = parms.InDirection;
         return;
     }
 
+    static BmSDK.Function s_SetOverrideMotionBlurFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetOverrideMotionBlur_Params
+    {
+        [FieldOffset(0)] public float NewMBAmount;
+        [FieldOffset(4)] public float MBTransitionTime;
+    }
+
     /// <summary>
     /// Function: SetOverrideMotionBlur
     /// </summary>
     public unsafe virtual void SetOverrideMotionBlur(float NewMBAmount, float MBTransitionTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetOverrideMotionBlur", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMBAmount, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MBTransitionTime, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetOverrideMotionBlurFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetOverrideMotionBlur", true);
+        var parms = new SetOverrideMotionBlur_Params();
+        parms.NewMBAmount = NewMBAmount;
+        parms.MBTransitionTime = MBTransitionTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetOverrideFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ResetOverrideFOV_Params
+    {
+        [FieldOffset(0)] public float FOVTransitionTime;
+    }
+
     /// <summary>
     /// Function: ResetOverrideFOV
     /// </summary>
     public unsafe virtual void ResetOverrideFOV(float FOVTransitionTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetOverrideFOV", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FOVTransitionTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetOverrideFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetOverrideFOV", true);
+        var parms = new ResetOverrideFOV_Params();
+        parms.FOVTransitionTime = FOVTransitionTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetOverrideFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetOverrideFOV_Params
+    {
+        [FieldOffset(0)] public float NewFOV;
+        [FieldOffset(4)] public float FOVTransitionTime;
+    }
+
     /// <summary>
     /// Function: SetOverrideFOV
     /// </summary>
     public unsafe virtual void SetOverrideFOV(float NewFOV, float FOVTransitionTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetOverrideFOV", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewFOV, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FOVTransitionTime, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetOverrideFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetOverrideFOV", true);
+        var parms = new SetOverrideFOV_Params();
+        parms.NewFOV = NewFOV;
+        parms.FOVTransitionTime = FOVTransitionTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetTargetActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetTargetActor_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetTargetActor
     /// </summary>
     public unsafe virtual BmSDK.Engine.Actor GetTargetActor()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.GetTargetActor", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(paramsPtr + 0);
+        var funcManaged = s_GetTargetActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.GetTargetActor", true);
+        var parms = new GetTargetActor_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Actor)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_UnlockCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnlockCamera_Params
+    {
     }
 
     /// <summary>
@@ -182,124 +226,155 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void UnlockCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UnlockCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UnlockCamera", true);
+        var parms = new UnlockCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LockCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct LockCamera_Params
+    {
+        [FieldOffset(0)] public float LockedTime;
+    }
+
     /// <summary>
     /// Function: LockCamera
     /// </summary>
     public unsafe virtual void LockCamera(float LockedTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LockCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LockedTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LockCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LockCamera", true);
+        var parms = new LockCamera_Params();
+        parms.LockedTime = LockedTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOffMotionBlurFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TurnOffMotionBlur_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOffMotionBlur
     /// </summary>
     public unsafe virtual void TurnOffMotionBlur()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.TurnOffMotionBlur", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOffMotionBlurFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.TurnOffMotionBlur", true);
+        var parms = new TurnOffMotionBlur_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FillCameraCacheFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct FillCameraCache_Params
+    {
+        [FieldOffset(0)] public BmSDK.GameObject.FTPOV NewPOV;
+    }
+
     /// <summary>
     /// Function: FillCameraCache
     /// </summary>
     public unsafe override void FillCameraCache(out BmSDK.GameObject.FTPOV NewPOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.FillCameraCache", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        NewPOV = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FTPOV>(paramsPtr + 0);
+        var funcManaged = s_FillCameraCacheFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.FillCameraCache", true);
+        var parms = new FillCameraCache_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        NewPOV = parms.NewPOV;
         return;
     }
 
+    static BmSDK.Function s_HideClippingObjectsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct HideClippingObjects_Params
+    {
+        [FieldOffset(0)] public BmSDK.GameObject.FTPOV NewPOV;
+    }
+
     /// <summary>
     /// Function: HideClippingObjects
     /// </summary>
     public unsafe virtual void HideClippingObjects(out BmSDK.GameObject.FTPOV NewPOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.HideClippingObjects", true);
-        byte* paramsPtr = stackalloc byte[28];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        NewPOV = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FTPOV>(paramsPtr + 0);
+        var funcManaged = s_HideClippingObjectsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.HideClippingObjects", true);
+        var parms = new HideClippingObjects_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        NewPOV = parms.NewPOV;
         return;
     }
 
+    static BmSDK.Function s_UpdateZoomFocusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateZoomFocus_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateZoomFocus
     /// </summary>
     public unsafe virtual void UpdateZoomFocus(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateZoomFocus", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateZoomFocusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateZoomFocus", true);
+        var parms = new UpdateZoomFocus_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SetViewTarget_Params
+    {
+        [FieldOffset(0)] public nint NewViewTarget;
+        [FieldOffset(4)] public BmSDK.Engine.Camera.FViewTargetTransitionParams TransitionParams;
+    }
+
     /// <summary>
     /// Function: SetViewTarget
     /// </summary>
     public unsafe override void SetViewTarget(BmSDK.Engine.Actor NewViewTarget, BmSDK.Engine.Camera.FViewTargetTransitionParams TransitionParams = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetViewTarget", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewViewTarget, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionParams, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetViewTarget", true);
+        var parms = new SetViewTarget_Params();
+        parms.NewViewTarget = NewViewTarget?.Ptr ?? 0;
+        parms.TransitionParams = TransitionParams;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BlendViewTargetsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 120)]
+    private struct BlendViewTargets_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.Camera.FTViewTarget A;
+        [FieldOffset(44)] public BmSDK.Engine.Camera.FTViewTarget B;
+        [FieldOffset(88)] public float Alpha;
+        [FieldOffset(92)] public BmSDK.GameObject.FTPOV ReturnValue;
+    }
+
     /// <summary>
     /// Function: BlendViewTargets
     /// </summary>
     public unsafe override BmSDK.GameObject.FTPOV BlendViewTargets(out BmSDK.Engine.Camera.FTViewTarget A, out BmSDK.Engine.Camera.FTViewTarget B, float Alpha)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.BlendViewTargets", true);
-        byte* paramsPtr = stackalloc byte[120];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Alpha, paramsPtr + 88);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        A = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Camera.FTViewTarget>(paramsPtr + 0);
-        B = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Camera.FTViewTarget>(paramsPtr + 44);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FTPOV>(paramsPtr + 92);
+        var funcManaged = s_BlendViewTargetsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.BlendViewTargets", true);
+        var parms = new BlendViewTargets_Params();
+        parms.Alpha = Alpha;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        A = parms.A;
+        B = parms.B;
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetRasFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetRasFOV_Params
+    {
+        [FieldOffset(0)] public float NewFOV;
     }
 
     /// <summary>
@@ -307,408 +382,605 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetRasFOV(float NewFOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetRasFOV", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewFOV, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRasFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetRasFOV", true);
+        var parms = new SetRasFOV_Params();
+        parms.NewFOV = NewFOV;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CancelBlockedZoomFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CancelBlockedZoom_Params
+    {
+    }
+
     /// <summary>
     /// Function: CancelBlockedZoom
     /// </summary>
     public unsafe virtual void CancelBlockedZoom()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CancelBlockedZoom", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CancelBlockedZoomFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CancelBlockedZoom", true);
+        var parms = new CancelBlockedZoom_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CancelAndBlockZoomFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CancelAndBlockZoom_Params
+    {
+        [FieldOffset(0)] public float T;
+    }
+
     /// <summary>
     /// Function: CancelAndBlockZoom
     /// </summary>
     public unsafe virtual void CancelAndBlockZoom(float T = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CancelAndBlockZoom", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(T, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CancelAndBlockZoomFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CancelAndBlockZoom", true);
+        var parms = new CancelAndBlockZoom_Params();
+        parms.T = T;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CancelZoomFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CancelZoom_Params
+    {
+    }
+
     /// <summary>
     /// Function: CancelZoom
     /// </summary>
     public unsafe virtual void CancelZoom()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CancelZoom", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CancelZoomFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CancelZoom", true);
+        var parms = new CancelZoom_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceZoomCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ForceZoomCamera_Params
+    {
+        [FieldOffset(0)] public float OverrideZoomFOV;
+    }
+
     /// <summary>
     /// Function: ForceZoomCamera
     /// </summary>
     public unsafe virtual void ForceZoomCamera(float OverrideZoomFOV = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ForceZoomCamera", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OverrideZoomFOV, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceZoomCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ForceZoomCamera", true);
+        var parms = new ForceZoomCamera_Params();
+        parms.OverrideZoomFOV = OverrideZoomFOV;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleCameraZoomFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ToggleCameraZoom_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleCameraZoom
     /// </summary>
     public unsafe virtual void ToggleCameraZoom()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ToggleCameraZoom", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleCameraZoomFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ToggleCameraZoom", true);
+        var parms = new ToggleCameraZoom_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleAlternativeWalkCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleAlternativeWalkCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleAlternativeWalkCamera
     /// </summary>
     public unsafe virtual void ToggleAlternativeWalkCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ToggleAlternativeWalkCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleAlternativeWalkCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ToggleAlternativeWalkCamera", true);
+        var parms = new ToggleAlternativeWalkCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SettingsChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SettingsChanged_Params
+    {
+    }
+
     /// <summary>
     /// Function: SettingsChanged
     /// </summary>
     public unsafe virtual void SettingsChanged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SettingsChanged", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SettingsChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SettingsChanged", true);
+        var parms = new SettingsChanged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraZoomOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraZoomOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraZoomOut
     /// </summary>
     public unsafe virtual void DebugCameraZoomOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraZoomOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraZoomOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraZoomOut", true);
+        var parms = new DebugCameraZoomOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraZoomInFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraZoomIn_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraZoomIn
     /// </summary>
     public unsafe virtual void DebugCameraZoomIn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraZoomIn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraZoomInFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraZoomIn", true);
+        var parms = new DebugCameraZoomIn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraBackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraBack_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraBack
     /// </summary>
     public unsafe virtual void DebugCameraBack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraBack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraBackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraBack", true);
+        var parms = new DebugCameraBack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraForwardFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraForward_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraForward
     /// </summary>
     public unsafe virtual void DebugCameraForward()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraForward", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraForwardFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraForward", true);
+        var parms = new DebugCameraForward_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraRightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraRight_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraRight
     /// </summary>
     public unsafe virtual void DebugCameraRight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraRight", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraRightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraRight", true);
+        var parms = new DebugCameraRight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraLeft_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraLeft
     /// </summary>
     public unsafe virtual void DebugCameraLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraLeft", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraLeft", true);
+        var parms = new DebugCameraLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraUp_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraUp
     /// </summary>
     public unsafe virtual void DebugCameraUp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraUp", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraUp", true);
+        var parms = new DebugCameraUp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraDown_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraDown
     /// </summary>
     public unsafe virtual void DebugCameraDown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraDown", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DebugCameraDown", true);
+        var parms = new DebugCameraDown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetToPlayerCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetToPlayerCam_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetToPlayerCam
     /// </summary>
     public unsafe virtual void ResetToPlayerCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetToPlayerCam", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetToPlayerCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetToPlayerCam", true);
+        var parms = new ResetToPlayerCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CombatEnableCameraDragFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CombatEnableCameraDrag_Params
+    {
+    }
+
     /// <summary>
     /// Function: CombatEnableCameraDrag
     /// </summary>
     public unsafe virtual void CombatEnableCameraDrag()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CombatEnableCameraDrag", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatEnableCameraDragFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CombatEnableCameraDrag", true);
+        var parms = new CombatEnableCameraDrag_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CombatDisableCameraDragFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CombatDisableCameraDrag_Params
+    {
+        [FieldOffset(0)] public float Time;
+    }
+
     /// <summary>
     /// Function: CombatDisableCameraDrag
     /// </summary>
     public unsafe virtual void CombatDisableCameraDrag(float Time = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CombatDisableCameraDrag", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Time, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatDisableCameraDragFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CombatDisableCameraDrag", true);
+        var parms = new CombatDisableCameraDrag_Params();
+        parms.Time = Time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableCameraDragHardResetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableCameraDragHardReset_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableCameraDragHardReset
     /// </summary>
     public unsafe virtual void EnableCameraDragHardReset()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EnableCameraDragHardReset", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableCameraDragHardResetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EnableCameraDragHardReset", true);
+        var parms = new EnableCameraDragHardReset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableCameraDragHardResetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisableCameraDragHardReset_Params
+    {
+        [FieldOffset(0)] public float Time;
+    }
+
     /// <summary>
     /// Function: DisableCameraDragHardReset
     /// </summary>
     public unsafe virtual void DisableCameraDragHardReset(float Time = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DisableCameraDragHardReset", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Time, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableCameraDragHardResetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DisableCameraDragHardReset", true);
+        var parms = new DisableCameraDragHardReset_Params();
+        parms.Time = Time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableCameraDragFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableCameraDrag_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableCameraDrag
     /// </summary>
     public unsafe virtual void EnableCameraDrag()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EnableCameraDrag", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableCameraDragFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EnableCameraDrag", true);
+        var parms = new EnableCameraDrag_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableCameraDragFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisableCameraDrag_Params
+    {
+        [FieldOffset(0)] public float Time;
+    }
+
     /// <summary>
     /// Function: DisableCameraDrag
     /// </summary>
     public unsafe virtual void DisableCameraDrag(float Time = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DisableCameraDrag", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Time, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DisableCameraDragFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DisableCameraDrag", true);
+        var parms = new DisableCameraDrag_Params();
+        parms.Time = Time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableCameraCollisionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableCameraCollision_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableCameraCollision
     /// </summary>
     public unsafe virtual void EnableCameraCollision()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EnableCameraCollision", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableCameraCollisionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EnableCameraCollision", true);
+        var parms = new EnableCameraCollision_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableCameraCollisionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisableCameraCollision_Params
+    {
+        [FieldOffset(0)] public float DisableTime;
+    }
+
     /// <summary>
     /// Function: DisableCameraCollision
     /// </summary>
     public unsafe virtual void DisableCameraCollision(float DisableTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DisableCameraCollision", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DisableTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableCameraCollisionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.DisableCameraCollision", true);
+        var parms = new DisableCameraCollision_Params();
+        parms.DisableTime = DisableTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideCamRefreshFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideCamRefresh_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideCamRefresh
     /// </summary>
     public unsafe virtual void HideCamRefresh()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.HideCamRefresh", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideCamRefreshFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.HideCamRefresh", true);
+        var parms = new HideCamRefresh_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeDofFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct ChangeDof_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RDOFManager.FDofStruct newDof;
+    }
+
     /// <summary>
     /// Function: ChangeDof
     /// </summary>
     public unsafe virtual void ChangeDof(BmSDK.BmGame.RDOFManager.FDofStruct newDof)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ChangeDof", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(newDof, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeDofFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ChangeDof", true);
+        var parms = new ChangeDof_Params();
+        parms.newDof = newDof;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetDofFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetDof_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetDof
     /// </summary>
     public unsafe virtual void ResetDof()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetDof", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetDofFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetDof", true);
+        var parms = new ResetDof_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ApplyCameraModifiersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ApplyCameraModifiers_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.GameObject.FTPOV OutPOV;
+    }
+
     /// <summary>
     /// Function: ApplyCameraModifiers
     /// </summary>
     public unsafe override void ApplyCameraModifiers(float DeltaTime, out BmSDK.GameObject.FTPOV OutPOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ApplyCameraModifiers", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        OutPOV = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FTPOV>(paramsPtr + 4);
+        var funcManaged = s_ApplyCameraModifiersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ApplyCameraModifiers", true);
+        var parms = new ApplyCameraModifiers_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        OutPOV = parms.OutPOV;
         return;
     }
 
+    static BmSDK.Function s_ApplyModifiersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct ApplyModifiers_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.GameObject.FTPOV OutPOV;
+    }
+
     /// <summary>
     /// Function: ApplyModifiers
     /// </summary>
     public unsafe virtual void ApplyModifiers(float DeltaTime, out BmSDK.GameObject.FTPOV OutPOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ApplyModifiers", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        OutPOV = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FTPOV>(paramsPtr + 4);
+        var funcManaged = s_ApplyModifiersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ApplyModifiers", true);
+        var parms = new ApplyModifiers_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        OutPOV = parms.OutPOV;
         return;
     }
 
+    static BmSDK.Function s_ResetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Reset_Params
+    {
+    }
+
     /// <summary>
     /// Function: Reset
     /// </summary>
     public unsafe override void Reset()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.Reset", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.Reset", true);
+        var parms = new Reset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EndJumpCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EndJumpCam_Params
+    {
+    }
+
     /// <summary>
     /// Function: EndJumpCam
     /// </summary>
     public unsafe virtual void EndJumpCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EndJumpCam", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EndJumpCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EndJumpCam", true);
+        var parms = new EndJumpCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetGlidingCameraSmoothingStrengthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetGlidingCameraSmoothingStrength_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName StateName;
+        [FieldOffset(8)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetGlidingCameraSmoothingStrength
     /// </summary>
     public unsafe virtual float GetGlidingCameraSmoothingStrength(BmSDK.FName StateName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.GetGlidingCameraSmoothingStrength", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StateName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_GetGlidingCameraSmoothingStrengthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.GetGlidingCameraSmoothingStrength", true);
+        var parms = new GetGlidingCameraSmoothingStrength_Params();
+        parms.StateName = StateName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_LeaveTunnelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LeaveTunnel_Params
+    {
     }
 
     /// <summary>
@@ -716,271 +988,372 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void LeaveTunnel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LeaveTunnel", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LeaveTunnelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LeaveTunnel", true);
+        var parms = new LeaveTunnel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnterTunnelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnterTunnel_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnterTunnel
     /// </summary>
     public unsafe virtual void EnterTunnel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EnterTunnel", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnterTunnelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.EnterTunnel", true);
+        var parms = new EnterTunnel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ProcessOverLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ProcessOverLook_Params
+    {
+    }
+
     /// <summary>
     /// Function: ProcessOverLook
     /// </summary>
     public unsafe virtual void ProcessOverLook()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ProcessOverLook", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ProcessOverLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ProcessOverLook", true);
+        var parms = new ProcessOverLook_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCombatDistModifierFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCombatDistModifier_Params
+    {
+        [FieldOffset(0)] public float NewDistModifier;
+    }
+
     /// <summary>
     /// Function: SetCombatDistModifier
     /// </summary>
     public unsafe virtual void SetCombatDistModifier(float NewDistModifier)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetCombatDistModifier", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewDistModifier, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCombatDistModifierFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetCombatDistModifier", true);
+        var parms = new SetCombatDistModifier_Params();
+        parms.NewDistModifier = NewDistModifier;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCombatFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCombatFOV_Params
+    {
+        [FieldOffset(0)] public float NewFOV;
+    }
+
     /// <summary>
     /// Function: SetCombatFOV
     /// </summary>
     public unsafe virtual void SetCombatFOV(float NewFOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetCombatFOV", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewFOV, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCombatFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetCombatFOV", true);
+        var parms = new SetCombatFOV_Params();
+        parms.NewFOV = NewFOV;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCombatCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCombatCamera_Params
+    {
+        [FieldOffset(0)] public int setFlag;
+    }
+
     /// <summary>
     /// Function: SetCombatCamera
     /// </summary>
     public unsafe virtual void SetCombatCamera(bool setFlag)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetCombatCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(setFlag, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCombatCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetCombatCamera", true);
+        var parms = new SetCombatCamera_Params();
+        parms.setFlag = setFlag ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RevertCameraTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RevertCameraTarget_Params
+    {
+        [FieldOffset(0)] public float BlendTime;
+        [FieldOffset(4)] public int bResetCam;
+        [FieldOffset(8)] public int BlendBatmanRelativePosition;
+    }
+
     /// <summary>
     /// Function: RevertCameraTarget
     /// </summary>
     public unsafe virtual void RevertCameraTarget(float BlendTime = default, bool bResetCam = default, bool BlendBatmanRelativePosition = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.RevertCameraTarget", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bResetCam, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendBatmanRelativePosition, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RevertCameraTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.RevertCameraTarget", true);
+        var parms = new RevertCameraTarget_Params();
+        parms.BlendTime = BlendTime;
+        parms.bResetCam = bResetCam ? 1 : 0;
+        parms.BlendBatmanRelativePosition = BlendBatmanRelativePosition ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCameraTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCameraTarget_Params
+    {
+        [FieldOffset(0)] public nint Target;
+    }
+
     /// <summary>
     /// Function: SetCameraTarget
     /// </summary>
     public unsafe virtual void SetCameraTarget(BmSDK.Engine.Actor Target)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetCameraTarget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCameraTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetCameraTarget", true);
+        var parms = new SetCameraTarget_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BlendToCameraTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct BlendToCameraTarget_Params
+    {
+        [FieldOffset(0)] public nint Target;
+        [FieldOffset(4)] public float BlendTime;
+        [FieldOffset(8)] public int bResetCam;
+        [FieldOffset(12)] public BmSDK.Rotator ResetRotation;
+        [FieldOffset(24)] public int BlendBatmanRelativePosition;
+    }
+
     /// <summary>
     /// Function: BlendToCameraTarget
     /// </summary>
     public unsafe virtual void BlendToCameraTarget(BmSDK.Engine.Actor Target, float BlendTime, bool bResetCam = default, BmSDK.Rotator ResetRotation = default, bool BlendBatmanRelativePosition = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.BlendToCameraTarget", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendTime, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bResetCam, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ResetRotation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendBatmanRelativePosition, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_BlendToCameraTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.BlendToCameraTarget", true);
+        var parms = new BlendToCameraTarget_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        parms.BlendTime = BlendTime;
+        parms.bResetCam = bResetCam ? 1 : 0;
+        parms.ResetRotation = ResetRotation;
+        parms.BlendBatmanRelativePosition = BlendBatmanRelativePosition ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFreeCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct UpdateFreeCam_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 DesiredCameraPosition;
+        [FieldOffset(12)] public BmSDK.Rotator DesiredCameraRotation;
+        [FieldOffset(24)] public float DesiredCameraFOV;
+        [FieldOffset(28)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateFreeCam
     /// </summary>
     public unsafe virtual void UpdateFreeCam(System.Numerics.Vector3 DesiredCameraPosition, BmSDK.Rotator DesiredCameraRotation, float DesiredCameraFOV, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateFreeCam", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredCameraPosition, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredCameraRotation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredCameraFOV, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 28);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateFreeCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateFreeCam", true);
+        var parms = new UpdateFreeCam_Params();
+        parms.DesiredCameraPosition = DesiredCameraPosition;
+        parms.DesiredCameraRotation = DesiredCameraRotation;
+        parms.DesiredCameraFOV = DesiredCameraFOV;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TransitionInterpolateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TransitionInterpolate_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: TransitionInterpolate
     /// </summary>
     public unsafe virtual void TransitionInterpolate(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.TransitionInterpolate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_TransitionInterpolateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.TransitionInterpolate", true);
+        var parms = new TransitionInterpolate_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ResetCamera_Params
+    {
+        [FieldOffset(0)] public BmSDK.Rotator ResetRotation;
+        [FieldOffset(12)] public int bResetForBlend;
+        [FieldOffset(16)] public int bResetSmoother;
+    }
+
     /// <summary>
     /// Function: ResetCamera
     /// </summary>
     public unsafe virtual void ResetCamera(BmSDK.Rotator ResetRotation = default, bool bResetForBlend = default, bool bResetSmoother = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetCamera", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ResetRotation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bResetForBlend, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bResetSmoother, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetCamera", true);
+        var parms = new ResetCamera_Params();
+        parms.ResetRotation = ResetRotation;
+        parms.bResetForBlend = bResetForBlend ? 1 : 0;
+        parms.bResetSmoother = bResetSmoother ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct UpdateViewTarget_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.Camera.FTViewTarget OutVT;
+        [FieldOffset(44)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateViewTarget
     /// </summary>
     public unsafe override void UpdateViewTarget(out BmSDK.Engine.Camera.FTViewTarget OutVT, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateViewTarget", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 44);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        OutVT = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Camera.FTViewTarget>(paramsPtr + 0);
+        var funcManaged = s_UpdateViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateViewTarget", true);
+        var parms = new UpdateViewTarget_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        OutVT = parms.OutVT;
         return;
     }
 
+    static BmSDK.Function s_UpdateViewTargetCameraActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct UpdateViewTargetCameraActor_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.Camera.FTViewTarget OutVT;
+        [FieldOffset(44)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateViewTargetCameraActor
     /// </summary>
     public unsafe virtual void UpdateViewTargetCameraActor(out BmSDK.Engine.Camera.FTViewTarget OutVT, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateViewTargetCameraActor", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        OutVT = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Camera.FTViewTarget>(paramsPtr + 0);
+        var funcManaged = s_UpdateViewTargetCameraActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateViewTargetCameraActor", true);
+        var parms = new UpdateViewTargetCameraActor_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        OutVT = parms.OutVT;
         return;
     }
 
+    static BmSDK.Function s_UpdateCurrentCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct UpdateCurrentCamera_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 DesiredCameraPosition;
+        [FieldOffset(12)] public BmSDK.Rotator DesiredCameraRotation;
+        [FieldOffset(24)] public float DesiredCameraFOV;
+        [FieldOffset(28)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateCurrentCamera
     /// </summary>
     public unsafe virtual void UpdateCurrentCamera(System.Numerics.Vector3 DesiredCameraPosition, BmSDK.Rotator DesiredCameraRotation, float DesiredCameraFOV, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateCurrentCamera", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredCameraPosition, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredCameraRotation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredCameraFOV, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateCurrentCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateCurrentCamera", true);
+        var parms = new UpdateCurrentCamera_Params();
+        parms.DesiredCameraPosition = DesiredCameraPosition;
+        parms.DesiredCameraRotation = DesiredCameraRotation;
+        parms.DesiredCameraFOV = DesiredCameraFOV;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ProcessViewRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ProcessViewRotation_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.Rotator out_ViewRotation;
+        [FieldOffset(16)] public BmSDK.Rotator out_DeltaRot;
+    }
+
     /// <summary>
     /// Function: ProcessViewRotation
     /// </summary>
     public unsafe override void ProcessViewRotation(float DeltaTime, out BmSDK.Rotator out_ViewRotation, out BmSDK.Rotator out_DeltaRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ProcessViewRotation", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        out_ViewRotation = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 4);
-        out_DeltaRot = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 16);
+        var funcManaged = s_ProcessViewRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ProcessViewRotation", true);
+        var parms = new ProcessViewRotation_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        out_ViewRotation = parms.out_ViewRotation;
+        out_DeltaRot = parms.out_DeltaRot;
         return;
     }
 
+    static BmSDK.Function s_UpdateCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateCamera_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateCamera
     /// </summary>
     public unsafe override void UpdateCamera(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateCamera", true);
+        var parms = new UpdateCamera_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FollowCameraRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FollowCameraRotation_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FollowCameraRotation
     /// </summary>
     public unsafe virtual bool FollowCameraRotation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.FollowCameraRotation", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_FollowCameraRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.FollowCameraRotation", true);
+        var parms = new FollowCameraRotation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_LookAroundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct LookAround_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.Rotator LookInput;
     }
 
     /// <summary>
@@ -988,160 +1361,239 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void LookAround(float DeltaTime, BmSDK.Rotator LookInput)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookAround", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LookInput, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LookAroundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookAround", true);
+        var parms = new LookAround_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.LookInput = LookInput;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitializeForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitializeFor_Params
+    {
+        [FieldOffset(0)] public nint PC;
+    }
+
     /// <summary>
     /// Function: InitializeFor
     /// </summary>
     public unsafe override void InitializeFor(BmSDK.Engine.PlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.InitializeFor", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitializeForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.InitializeFor", true);
+        var parms = new InitializeFor_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SaveFreeCameraConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 124)]
+    private struct SaveFreeCameraConfig_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.R3rdPersonCamera.FFreeCameraConfig ConfigToSave;
+    }
+
     /// <summary>
     /// Function: SaveFreeCameraConfig
     /// </summary>
     public unsafe virtual void SaveFreeCameraConfig(out BmSDK.BmGame.R3rdPersonCamera.FFreeCameraConfig ConfigToSave)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SaveFreeCameraConfig", true);
-        byte* paramsPtr = stackalloc byte[124];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        ConfigToSave = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.R3rdPersonCamera.FFreeCameraConfig>(paramsPtr + 0);
+        var funcManaged = s_SaveFreeCameraConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SaveFreeCameraConfig", true);
+        var parms = new SaveFreeCameraConfig_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        ConfigToSave = parms.ConfigToSave;
         return;
     }
 
+    static BmSDK.Function s_SetFreeCameraConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 124)]
+    private struct SetFreeCameraConfig_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.R3rdPersonCamera.FFreeCameraConfig NewConfig;
+    }
+
     /// <summary>
     /// Function: SetFreeCameraConfig
     /// </summary>
     public unsafe virtual void SetFreeCameraConfig(BmSDK.BmGame.R3rdPersonCamera.FFreeCameraConfig NewConfig)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetFreeCameraConfig", true);
-        byte* paramsPtr = stackalloc byte[124];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewConfig, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetFreeCameraConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetFreeCameraConfig", true);
+        var parms = new SetFreeCameraConfig_Params();
+        parms.NewConfig = NewConfig;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopCameraWanderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopCameraWander_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopCameraWander
     /// </summary>
     public unsafe virtual void StopCameraWander()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.StopCameraWander", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopCameraWanderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.StopCameraWander", true);
+        var parms = new StopCameraWander_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartCameraWanderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct StartCameraWander_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.R3rdPersonCamera.FCameraWanderSettings NewSettings;
+    }
+
     /// <summary>
     /// Function: StartCameraWander
     /// </summary>
     public unsafe virtual void StartCameraWander(BmSDK.BmGame.R3rdPersonCamera.FCameraWanderSettings NewSettings)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.StartCameraWander", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSettings, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartCameraWanderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.StartCameraWander", true);
+        var parms = new StartCameraWander_Params();
+        parms.NewSettings = NewSettings;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveAllCameraEmittersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveAllCameraEmitters_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveAllCameraEmitters
     /// </summary>
     public unsafe virtual void RemoveAllCameraEmitters()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.RemoveAllCameraEmitters", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveAllCameraEmittersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.RemoveAllCameraEmitters", true);
+        var parms = new RemoveAllCameraEmitters_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveCameraEmitterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveCameraEmitter_Params
+    {
+        [FieldOffset(0)] public nint Emitter;
+    }
+
     /// <summary>
     /// Function: RemoveCameraEmitter
     /// </summary>
     public unsafe virtual void RemoveCameraEmitter(BmSDK.BmGame.RBMCameraEmitter Emitter)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.RemoveCameraEmitter", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Emitter, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveCameraEmitterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.RemoveCameraEmitter", true);
+        var parms = new RemoveCameraEmitter_Params();
+        parms.Emitter = Emitter?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddCameraEmitterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddCameraEmitter_Params
+    {
+        [FieldOffset(0)] public nint Emitter;
+    }
+
     /// <summary>
     /// Function: AddCameraEmitter
     /// </summary>
     public unsafe virtual void AddCameraEmitter(BmSDK.BmGame.RBMCameraEmitter Emitter)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.AddCameraEmitter", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Emitter, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddCameraEmitterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.AddCameraEmitter", true);
+        var parms = new AddCameraEmitter_Params();
+        parms.Emitter = Emitter?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopLookAtFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopLookAt_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopLookAt
     /// </summary>
     public unsafe virtual void StopLookAt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.StopLookAt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopLookAtFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.StopLookAt", true);
+        var parms = new StopLookAt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LookAtCommonFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct LookAtCommon_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.CameraLookAtStrength Strength;
+        [FieldOffset(4)] public int FollowPitch;
+        [FieldOffset(8)] public int FollowYaw;
+        [FieldOffset(12)] public float Duration;
+        [FieldOffset(16)] public BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed;
+        [FieldOffset(20)] public int bUseOffset;
+        [FieldOffset(24)] public int bAllowZoom;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: LookAtCommon
     /// </summary>
     public unsafe virtual bool LookAtCommon(BmSDK.BmGame.RGameInfo.CameraLookAtStrength Strength, bool FollowPitch, bool FollowYaw, float Duration, BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed, bool bUseOffset, bool bAllowZoom = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookAtCommon", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Strength, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FollowPitch, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FollowYaw, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseOffset, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAllowZoom, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_LookAtCommonFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookAtCommon", true);
+        var parms = new LookAtCommon_Params();
+        parms.Strength = Strength;
+        parms.FollowPitch = FollowPitch ? 1 : 0;
+        parms.FollowYaw = FollowYaw ? 1 : 0;
+        parms.Duration = Duration;
+        parms.Speed = Speed;
+        parms.bUseOffset = bUseOffset ? 1 : 0;
+        parms.bAllowZoom = bAllowZoom ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_LookAtPositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct LookAtPosition_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 LookLocation;
+        [FieldOffset(12)] public BmSDK.BmGame.RGameInfo.CameraLookAtStrength Strength;
+        [FieldOffset(16)] public int FollowPitch;
+        [FieldOffset(20)] public int FollowYaw;
+        [FieldOffset(24)] public float Duration;
+        [FieldOffset(28)] public BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed;
+        [FieldOffset(32)] public int bUseOffset;
     }
 
     /// <summary>
@@ -1149,66 +1601,108 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void LookAtPosition(System.Numerics.Vector3 LookLocation, BmSDK.BmGame.RGameInfo.CameraLookAtStrength Strength = default, bool FollowPitch = default, bool FollowYaw = default, float Duration = default, BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed = default, bool bUseOffset = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookAtPosition", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LookLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Strength, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FollowPitch, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FollowYaw, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseOffset, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LookAtPositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookAtPosition", true);
+        var parms = new LookAtPosition_Params();
+        parms.LookLocation = LookLocation;
+        parms.Strength = Strength;
+        parms.FollowPitch = FollowPitch ? 1 : 0;
+        parms.FollowYaw = FollowYaw ? 1 : 0;
+        parms.Duration = Duration;
+        parms.Speed = Speed;
+        parms.bUseOffset = bUseOffset ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LookAtActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct LookAtActor_Params
+    {
+        [FieldOffset(0)] public nint LookActor;
+        [FieldOffset(4)] public System.Numerics.Vector3 Offset;
+        [FieldOffset(16)] public BmSDK.BmGame.RGameInfo.CameraLookAtStrength Strength;
+        [FieldOffset(20)] public int FollowPitch;
+        [FieldOffset(24)] public int FollowYaw;
+        [FieldOffset(28)] public float Duration;
+        [FieldOffset(32)] public BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed;
+        [FieldOffset(36)] public int bUseOffset;
+        [FieldOffset(40)] public int bAllowZoom;
+    }
+
     /// <summary>
     /// Function: LookAtActor
     /// </summary>
     public unsafe virtual void LookAtActor(BmSDK.Engine.Actor LookActor, System.Numerics.Vector3 Offset = default, BmSDK.BmGame.RGameInfo.CameraLookAtStrength Strength = default, bool FollowPitch = default, bool FollowYaw = default, float Duration = default, BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed = default, bool bUseOffset = default, bool bAllowZoom = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookAtActor", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LookActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Offset, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Strength, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FollowPitch, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FollowYaw, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseOffset, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAllowZoom, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LookAtActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookAtActor", true);
+        var parms = new LookAtActor_Params();
+        parms.LookActor = LookActor?.Ptr ?? 0;
+        parms.Offset = Offset;
+        parms.Strength = Strength;
+        parms.FollowPitch = FollowPitch ? 1 : 0;
+        parms.FollowYaw = FollowYaw ? 1 : 0;
+        parms.Duration = Duration;
+        parms.Speed = Speed;
+        parms.bUseOffset = bUseOffset ? 1 : 0;
+        parms.bAllowZoom = bAllowZoom ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LookInDirectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct LookInDirection_Params
+    {
+        [FieldOffset(0)] public BmSDK.Rotator Direction;
+        [FieldOffset(12)] public BmSDK.BmGame.RGameInfo.CameraLookAtStrength Strength;
+        [FieldOffset(16)] public int FollowPitch;
+        [FieldOffset(20)] public int FollowYaw;
+        [FieldOffset(24)] public float Duration;
+        [FieldOffset(28)] public BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed;
+        [FieldOffset(32)] public int bUseOffset;
+    }
+
     /// <summary>
     /// Function: LookInDirection
     /// </summary>
     public unsafe virtual void LookInDirection(BmSDK.Rotator Direction, BmSDK.BmGame.RGameInfo.CameraLookAtStrength Strength = default, bool FollowPitch = default, bool FollowYaw = default, float Duration = default, BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed = default, bool bUseOffset = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookInDirection", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Direction, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Strength, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FollowPitch, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FollowYaw, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseOffset, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LookInDirectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.LookInDirection", true);
+        var parms = new LookInDirection_Params();
+        parms.Direction = Direction;
+        parms.Strength = Strength;
+        parms.FollowPitch = FollowPitch ? 1 : 0;
+        parms.FollowYaw = FollowYaw ? 1 : 0;
+        parms.Duration = Duration;
+        parms.Speed = Speed;
+        parms.bUseOffset = bUseOffset ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AllowZoomCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AllowZoomCamera_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AllowZoomCamera
     /// </summary>
     public unsafe virtual bool AllowZoomCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.AllowZoomCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AllowZoomCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.AllowZoomCamera", true);
+        var parms = new AllowZoomCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateBatarangOutOfRangeFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateBatarangOutOfRangeFX_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -1216,77 +1710,82 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void UpdateBatarangOutOfRangeFX(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateBatarangOutOfRangeFX", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateBatarangOutOfRangeFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateBatarangOutOfRangeFX", true);
+        var parms = new UpdateBatarangOutOfRangeFX_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetBatarangOutOfRangeFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetBatarangOutOfRangeFX_Params
+    {
+        [FieldOffset(0)] public float Strength;
+    }
+
     /// <summary>
     /// Function: SetBatarangOutOfRangeFX
     /// </summary>
     public unsafe virtual void SetBatarangOutOfRangeFX(float Strength)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetBatarangOutOfRangeFX", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Strength, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetBatarangOutOfRangeFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.SetBatarangOutOfRangeFX", true);
+        var parms = new SetBatarangOutOfRangeFX_Params();
+        parms.Strength = Strength;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckLocation_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckLocation
     /// </summary>
     public unsafe virtual void CheckLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CheckLocation", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_CheckLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.CheckLocation", true);
+        var parms = new CheckLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetSmootherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetSmoother_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetSmoother
     /// </summary>
     public unsafe virtual void ResetSmoother()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetSmoother", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ResetSmootherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.ResetSmoother", true);
+        var parms = new ResetSmoother_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateCameraWanderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateCameraWander_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateCameraWander
     /// </summary>
     public unsafe virtual void UpdateCameraWander(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateCameraWander", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateCameraWanderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.R3rdPersonCamera.UpdateCameraWander", true);
+        var parms = new UpdateCameraWander_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -1299,61 +1798,49 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: LastSmoothDistance
         /// </summary>
-        public unsafe float LastSmoothDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float LastSmoothDistance;
 
         /// <summary>
         /// IntProperty: CurrentSmootherIndex
         /// </summary>
-        public unsafe int CurrentSmootherIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int CurrentSmootherIndex;
 
         /// <summary>
         /// IntProperty: MinSmootherIndex
         /// </summary>
-        public unsafe int MinSmootherIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int MinSmootherIndex;
 
         /// <summary>
         /// FloatProperty: DirectionDistance
         /// </summary>
         public unsafe float DirectionDistance_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// FloatProperty: DirectionDistance
         /// </summary>
         public unsafe float DirectionDistance_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// FloatProperty: DirectionDistance
         /// </summary>
         public unsafe float DirectionDistance_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
         /// <summary>
         /// FloatProperty: DirectionDistance
         /// </summary>
         public unsafe float DirectionDistance_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 24) = value; }; }
         }
     }
 
@@ -1366,38 +1853,22 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: X
         /// </summary>
-        public unsafe float X
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float X;
 
         /// <summary>
         /// FloatProperty: Y
         /// </summary>
-        public unsafe float Y
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Y;
 
         /// <summary>
         /// FloatProperty: Z
         /// </summary>
-        public unsafe float Z
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Z;
 
         /// <summary>
         /// FloatProperty: W
         /// </summary>
-        public unsafe float W
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float W;
     }
 
     /// <summary>
@@ -1409,38 +1880,22 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: DegreesPerSecond
         /// </summary>
-        public unsafe float DegreesPerSecond
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float DegreesPerSecond;
 
         /// <summary>
         /// FloatProperty: SlowDownAngle
         /// </summary>
-        public unsafe float SlowDownAngle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float SlowDownAngle;
 
         /// <summary>
         /// FloatProperty: AccelerationModifier
         /// </summary>
-        public unsafe float AccelerationModifier
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float AccelerationModifier;
 
         /// <summary>
         /// FloatProperty: DecelerationModifier
         /// </summary>
-        public unsafe float DecelerationModifier
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float DecelerationModifier;
     }
 
     /// <summary>
@@ -1449,167 +1904,105 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 68)]
     public partial record struct FCameraWanderSettings
     {
+        [FieldOffset(40)] private int _bitfield40;
+
         /// <summary>
         /// FloatProperty: CameraWanderMagnitude
         /// </summary>
-        public unsafe float CameraWanderMagnitude
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float CameraWanderMagnitude;
 
         /// <summary>
         /// FloatProperty: CameraWanderFOVMagnitude
         /// </summary>
-        public unsafe float CameraWanderFOVMagnitude
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float CameraWanderFOVMagnitude;
 
         /// <summary>
         /// FloatProperty: CameraWanderXMagnitude
         /// </summary>
-        public unsafe float CameraWanderXMagnitude
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float CameraWanderXMagnitude;
 
         /// <summary>
         /// FloatProperty: CameraWanderRotationMagnitude
         /// </summary>
-        public unsafe float CameraWanderRotationMagnitude
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float CameraWanderRotationMagnitude;
 
         /// <summary>
         /// FloatProperty: CameraWanderRollMagnitude
         /// </summary>
-        public unsafe float CameraWanderRollMagnitude
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float CameraWanderRollMagnitude;
 
         /// <summary>
         /// FloatProperty: CameraWanderSinComponent1
         /// </summary>
-        public unsafe float CameraWanderSinComponent1
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float CameraWanderSinComponent1;
 
         /// <summary>
         /// FloatProperty: CameraWanderSinComponent2
         /// </summary>
-        public unsafe float CameraWanderSinComponent2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float CameraWanderSinComponent2;
 
         /// <summary>
         /// FloatProperty: CameraWanderSinComponent3
         /// </summary>
-        public unsafe float CameraWanderSinComponent3
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float CameraWanderSinComponent3;
 
         /// <summary>
         /// FloatProperty: CameraWanderZOffset
         /// </summary>
-        public unsafe float CameraWanderZOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float CameraWanderZOffset;
 
         /// <summary>
         /// FloatProperty: Priority
         /// </summary>
-        public unsafe float Priority
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float Priority;
 
         /// <summary>
         /// BoolProperty: bOnceOnly
         /// </summary>
-        public unsafe bool bOnceOnly
+        public bool bOnceOnly
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 40); }; }
+            readonly get => (_bitfield40 & 1) != 0;
+            set { if (value) _bitfield40 |= 1; else _bitfield40 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bOneWayWander
         /// </summary>
-        public unsafe bool bOneWayWander
+        public bool bOneWayWander
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 40); }; }
+            readonly get => (_bitfield40 & 2) != 0;
+            set { if (value) _bitfield40 |= 2; else _bitfield40 &= ~2; }
         }
 
         /// <summary>
         /// FloatProperty: OneWayTimer
         /// </summary>
-        public unsafe float OneWayTimer
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float OneWayTimer;
 
         /// <summary>
         /// FloatProperty: OriginalY
         /// </summary>
-        public unsafe float OriginalY
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public float OriginalY;
 
         /// <summary>
         /// FloatProperty: OriginalZ
         /// </summary>
-        public unsafe float OriginalZ
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public float OriginalZ;
 
         /// <summary>
         /// FloatProperty: OriginalRoll
         /// </summary>
-        public unsafe float OriginalRoll
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float OriginalRoll;
 
         /// <summary>
         /// FloatProperty: OriginalPitch
         /// </summary>
-        public unsafe float OriginalPitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float OriginalPitch;
 
         /// <summary>
         /// FloatProperty: OriginalYaw
         /// </summary>
-        public unsafe float OriginalYaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float OriginalYaw;
     }
 
     /// <summary>
@@ -1617,8 +2010,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bTurnedInTunnel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 1; else *(int*)(Ptr + 1232) &= ~1; }
     }
 
     /// <summary>
@@ -1626,8 +2019,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverrideCameraFOV
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 2; else *(int*)(Ptr + 1232) &= ~2; }
     }
 
     /// <summary>
@@ -1635,8 +2028,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool LockInPlace
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 4; else *(int*)(Ptr + 1232) &= ~4; }
     }
 
     /// <summary>
@@ -1644,8 +2037,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHidePlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 8; else *(int*)(Ptr + 1232) &= ~8; }
     }
 
     /// <summary>
@@ -1653,8 +2046,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInterpPos
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 16; else *(int*)(Ptr + 1232) &= ~16; }
     }
 
     /// <summary>
@@ -1662,8 +2055,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisallowRoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 32; else *(int*)(Ptr + 1232) &= ~32; }
     }
 
     /// <summary>
@@ -1671,8 +2064,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAffectsControllerRotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 64; else *(int*)(Ptr + 1232) &= ~64; }
     }
 
     /// <summary>
@@ -1680,8 +2073,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bTemporarilyDisableCameraDrag
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 128; else *(int*)(Ptr + 1232) &= ~128; }
     }
 
     /// <summary>
@@ -1689,8 +2082,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bStatePermanentlyDragsCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 256; else *(int*)(Ptr + 1232) &= ~256; }
     }
 
     /// <summary>
@@ -1698,8 +2091,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDragOnlyFollowsDeliberateDirection
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 512; else *(int*)(Ptr + 1232) &= ~512; }
     }
 
     /// <summary>
@@ -1707,8 +2100,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bStatePermanentlyDisablesCameraDrag
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 1024; else *(int*)(Ptr + 1232) &= ~1024; }
     }
 
     /// <summary>
@@ -1716,8 +2109,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseTightFocusPoints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 2048; else *(int*)(Ptr + 1232) &= ~2048; }
     }
 
     /// <summary>
@@ -1725,8 +2118,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisableCameraSmoothing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 4096; else *(int*)(Ptr + 1232) &= ~4096; }
     }
 
     /// <summary>
@@ -1734,8 +2127,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bFollowPelvis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 8192; else *(int*)(Ptr + 1232) &= ~8192; }
     }
 
     /// <summary>
@@ -1743,8 +2136,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOnlyFollowPelvisZ
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 16384; else *(int*)(Ptr + 1232) &= ~16384; }
     }
 
     /// <summary>
@@ -1752,8 +2145,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisableCameraCollision
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 32768; else *(int*)(Ptr + 1232) &= ~32768; }
     }
 
     /// <summary>
@@ -1761,8 +2154,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSwayWithPelvis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 65536; else *(int*)(Ptr + 1232) &= ~65536; }
     }
 
     /// <summary>
@@ -1770,8 +2163,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisableCamerCollisionDuringBlend
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 131072; else *(int*)(Ptr + 1232) &= ~131072; }
     }
 
     /// <summary>
@@ -1779,8 +2172,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCameraDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 262144; else *(int*)(Ptr + 1232) &= ~262144; }
     }
 
     /// <summary>
@@ -1788,8 +2181,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCameraDebugCollision
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 524288; else *(int*)(Ptr + 1232) &= ~524288; }
     }
 
     /// <summary>
@@ -1797,8 +2190,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDebugPlayerPath
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 1048576; else *(int*)(Ptr + 1232) &= ~1048576; }
     }
 
     /// <summary>
@@ -1806,8 +2199,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDebugCameraSmoothing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 2097152; else *(int*)(Ptr + 1232) &= ~2097152; }
     }
 
     /// <summary>
@@ -1815,8 +2208,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForce3rdPersonCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 4194304; else *(int*)(Ptr + 1232) &= ~4194304; }
     }
 
     /// <summary>
@@ -1824,8 +2217,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDontModifySitOffsetWhenLookingUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 8388608; else *(int*)(Ptr + 1232) &= ~8388608; }
     }
 
     /// <summary>
@@ -1833,8 +2226,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseAbsoluteHeadOffset
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 16777216; else *(int*)(Ptr + 1232) &= ~16777216; }
     }
 
     /// <summary>
@@ -1842,8 +2235,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bActuallyUsingAbsoluteHeadRot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 33554432; else *(int*)(Ptr + 1232) &= ~33554432; }
     }
 
     /// <summary>
@@ -1851,8 +2244,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInterpingHeadRot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 67108864; else *(int*)(Ptr + 1232) &= ~67108864; }
     }
 
     /// <summary>
@@ -1860,8 +2253,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAlternativeCam
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 134217728; else *(int*)(Ptr + 1232) &= ~134217728; }
     }
 
     /// <summary>
@@ -1869,8 +2262,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDontClipPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 268435456; else *(int*)(Ptr + 1232) &= ~268435456; }
     }
 
     /// <summary>
@@ -1878,8 +2271,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCameraWandering
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 536870912; else *(int*)(Ptr + 1232) &= ~536870912; }
     }
 
     /// <summary>
@@ -1887,8 +2280,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCamOverrideDof
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= 1073741824; else *(int*)(Ptr + 1232) &= ~1073741824; }
     }
 
     /// <summary>
@@ -1896,8 +2289,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableMotionBlur
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1232); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1232); }
+        get { return (*(int*)(Ptr + 1232) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 1232) |= -2147483648; else *(int*)(Ptr + 1232) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -1905,8 +2298,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceZoom
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 1; else *(int*)(Ptr + 1236) &= ~1; }
     }
 
     /// <summary>
@@ -1914,8 +2307,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool CameraLocked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 2; else *(int*)(Ptr + 1236) &= ~2; }
     }
 
     /// <summary>
@@ -1923,8 +2316,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool CameraBlendBatmanRelativePosition
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 4; else *(int*)(Ptr + 1236) &= ~4; }
     }
 
     /// <summary>
@@ -1932,8 +2325,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsCombatCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 8; else *(int*)(Ptr + 1236) &= ~8; }
     }
 
     /// <summary>
@@ -1941,8 +2334,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsVenomCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 16; else *(int*)(Ptr + 1236) &= ~16; }
     }
 
     /// <summary>
@@ -1950,8 +2343,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool EnableCameraAssist
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 32; else *(int*)(Ptr + 1236) &= ~32; }
     }
 
     /// <summary>
@@ -1959,8 +2352,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceCameraDragOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 64; else *(int*)(Ptr + 1236) &= ~64; }
     }
 
     /// <summary>
@@ -1968,8 +2361,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCombatDisableCameraDrag
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 128; else *(int*)(Ptr + 1236) &= ~128; }
     }
 
     /// <summary>
@@ -1977,8 +2370,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverrideTransitionIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 256; else *(int*)(Ptr + 1236) &= ~256; }
     }
 
     /// <summary>
@@ -1986,8 +2379,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool PawnHiddenByCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 512; else *(int*)(Ptr + 1236) &= ~512; }
     }
 
     /// <summary>
@@ -1995,8 +2388,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool LookAtUsesDefaultOffset
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 1024; else *(int*)(Ptr + 1236) &= ~1024; }
     }
 
     /// <summary>
@@ -2004,8 +2397,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool UsePitchForLookAt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 2048; else *(int*)(Ptr + 1236) &= ~2048; }
     }
 
     /// <summary>
@@ -2013,8 +2406,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool UseYawForLookAt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 4096; else *(int*)(Ptr + 1236) &= ~4096; }
     }
 
     /// <summary>
@@ -2022,8 +2415,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCeilingRetainOffsetDuringZoom
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 8192; else *(int*)(Ptr + 1236) &= ~8192; }
     }
 
     /// <summary>
@@ -2031,8 +2424,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool DontDrawClosePawns
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 16384; else *(int*)(Ptr + 1236) &= ~16384; }
     }
 
     /// <summary>
@@ -2040,8 +2433,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bPauseAndPanCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 32768; else *(int*)(Ptr + 1236) &= ~32768; }
     }
 
     /// <summary>
@@ -2049,8 +2442,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bModifyPPForResonatorSreen
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 65536; else *(int*)(Ptr + 1236) &= ~65536; }
     }
 
     /// <summary>
@@ -2058,8 +2451,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseFullSway
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 131072; else *(int*)(Ptr + 1236) &= ~131072; }
     }
 
     /// <summary>
@@ -2067,8 +2460,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRetainOffsetDuringZoom
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 262144; else *(int*)(Ptr + 1236) &= ~262144; }
     }
 
     /// <summary>
@@ -2076,8 +2469,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseHeadOffsetCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 524288; else *(int*)(Ptr + 1236) &= ~524288; }
     }
 
     /// <summary>
@@ -2085,8 +2478,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverrideCrouchHeadCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 1048576; else *(int*)(Ptr + 1236) &= ~1048576; }
     }
 
     /// <summary>
@@ -2094,8 +2487,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bBatmanFacesCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 2097152; else *(int*)(Ptr + 1236) &= ~2097152; }
     }
 
     /// <summary>
@@ -2103,8 +2496,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCustomCameraZoomAllowed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 4194304; else *(int*)(Ptr + 1236) &= ~4194304; }
     }
 
     /// <summary>
@@ -2112,8 +2505,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDontSaveConfig
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 8388608; else *(int*)(Ptr + 1236) &= ~8388608; }
     }
 
     /// <summary>
@@ -2121,8 +2514,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Debug_TurnOffZoomDof
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 16777216; else *(int*)(Ptr + 1236) &= ~16777216; }
     }
 
     /// <summary>
@@ -2130,8 +2523,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceFollowFullPelvisZ
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1236); }
+        get { return (*(int*)(Ptr + 1236) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 1236) |= 33554432; else *(int*)(Ptr + 1236) &= ~33554432; }
     }
 
     /// <summary>
@@ -2145,8 +2538,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1252); }
+        get { return *(float*)(Ptr + 1252); }
+        set { *(float*)(Ptr + 1252) = value; }
     }
 
     /// <summary>
@@ -2154,8 +2547,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverrideCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1256); }
+        get { return *(float*)(Ptr + 1256); }
+        set { *(float*)(Ptr + 1256) = value; }
     }
 
     /// <summary>
@@ -2163,8 +2556,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverrideCameraFOVTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1260); }
+        get { return *(float*)(Ptr + 1260); }
+        set { *(float*)(Ptr + 1260) = value; }
     }
 
     /// <summary>
@@ -2172,8 +2565,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverrideCameraFOVTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1264); }
+        get { return *(float*)(Ptr + 1264); }
+        set { *(float*)(Ptr + 1264) = value; }
     }
 
     /// <summary>
@@ -2181,8 +2574,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastOverrideCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1268); }
+        get { return *(float*)(Ptr + 1268); }
+        set { *(float*)(Ptr + 1268) = value; }
     }
 
     /// <summary>
@@ -2190,8 +2583,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentOverrideCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1272); }
+        get { return *(float*)(Ptr + 1272); }
+        set { *(float*)(Ptr + 1272) = value; }
     }
 
     /// <summary>
@@ -2199,8 +2592,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverrideMotionBlurBlendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1276); }
+        get { return *(float*)(Ptr + 1276); }
+        set { *(float*)(Ptr + 1276) = value; }
     }
 
     /// <summary>
@@ -2208,8 +2601,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverrideMotionBlurAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1280); }
+        get { return *(float*)(Ptr + 1280); }
+        set { *(float*)(Ptr + 1280) = value; }
     }
 
     /// <summary>
@@ -2217,8 +2610,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OldMotionBlurBlendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1284); }
+        get { return *(float*)(Ptr + 1284); }
+        set { *(float*)(Ptr + 1284) = value; }
     }
 
     /// <summary>
@@ -2226,8 +2619,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OldMotionBlurAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1288); }
+        get { return *(float*)(Ptr + 1288); }
+        set { *(float*)(Ptr + 1288) = value; }
     }
 
     /// <summary>
@@ -2235,8 +2628,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float bOverrideMotionBlurSettings
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1292); }
+        get { return *(float*)(Ptr + 1292); }
+        set { *(float*)(Ptr + 1292) = value; }
     }
 
     /// <summary>
@@ -2268,8 +2661,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ExtraCameraZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1344); }
+        get { return *(float*)(Ptr + 1344); }
+        set { *(float*)(Ptr + 1344) = value; }
     }
 
     /// <summary>
@@ -2289,8 +2682,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentExtraCameraZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1372); }
+        get { return *(float*)(Ptr + 1372); }
+        set { *(float*)(Ptr + 1372) = value; }
     }
 
     /// <summary>
@@ -2307,8 +2700,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float TargetFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1380); }
+        get { return *(float*)(Ptr + 1380); }
+        set { *(float*)(Ptr + 1380) = value; }
     }
 
     /// <summary>
@@ -2337,8 +2730,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1420); }
+        get { return *(float*)(Ptr + 1420); }
+        set { *(float*)(Ptr + 1420) = value; }
     }
 
     /// <summary>
@@ -2370,8 +2763,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float TimeInCurrentState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1472); }
+        get { return *(float*)(Ptr + 1472); }
+        set { *(float*)(Ptr + 1472) = value; }
     }
 
     /// <summary>
@@ -2379,8 +2772,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float TransitionTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1476); }
+        get { return *(float*)(Ptr + 1476); }
+        set { *(float*)(Ptr + 1476) = value; }
     }
 
     /// <summary>
@@ -2388,8 +2781,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int maxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1480); }
+        get { return *(int*)(Ptr + 1480); }
+        set { *(int*)(Ptr + 1480) = value; }
     }
 
     /// <summary>
@@ -2397,8 +2790,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int MinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1484); }
+        get { return *(int*)(Ptr + 1484); }
+        set { *(int*)(Ptr + 1484) = value; }
     }
 
     /// <summary>
@@ -2406,8 +2799,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1488); }
+        get { return *(int*)(Ptr + 1488); }
+        set { *(int*)(Ptr + 1488) = value; }
     }
 
     /// <summary>
@@ -2415,8 +2808,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int MinYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1492); }
+        get { return *(int*)(Ptr + 1492); }
+        set { *(int*)(Ptr + 1492) = value; }
     }
 
     /// <summary>
@@ -2424,8 +2817,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentMaxYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1496); }
+        get { return *(float*)(Ptr + 1496); }
+        set { *(float*)(Ptr + 1496) = value; }
     }
 
     /// <summary>
@@ -2433,8 +2826,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentMinYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1500); }
+        get { return *(float*)(Ptr + 1500); }
+        set { *(float*)(Ptr + 1500) = value; }
     }
 
     /// <summary>
@@ -2442,8 +2835,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1504); }
+        get { return *(float*)(Ptr + 1504); }
+        set { *(float*)(Ptr + 1504) = value; }
     }
 
     /// <summary>
@@ -2451,8 +2844,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1508); }
+        get { return *(float*)(Ptr + 1508); }
+        set { *(float*)(Ptr + 1508) = value; }
     }
 
     /// <summary>
@@ -2466,8 +2859,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float YawAccel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1524); }
+        get { return *(float*)(Ptr + 1524); }
+        set { *(float*)(Ptr + 1524) = value; }
     }
 
     /// <summary>
@@ -2475,8 +2868,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PitchAccel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1528); }
+        get { return *(float*)(Ptr + 1528); }
+        set { *(float*)(Ptr + 1528) = value; }
     }
 
     /// <summary>
@@ -2484,8 +2877,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float YawDecel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1532); }
+        get { return *(float*)(Ptr + 1532); }
+        set { *(float*)(Ptr + 1532) = value; }
     }
 
     /// <summary>
@@ -2493,8 +2886,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PitchDecel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1536); }
+        get { return *(float*)(Ptr + 1536); }
+        set { *(float*)(Ptr + 1536) = value; }
     }
 
     /// <summary>
@@ -2502,8 +2895,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CameraCeilingLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1540); }
+        get { return *(float*)(Ptr + 1540); }
+        set { *(float*)(Ptr + 1540) = value; }
     }
 
     /// <summary>
@@ -2511,8 +2904,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CameraFloorLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1544); }
+        get { return *(float*)(Ptr + 1544); }
+        set { *(float*)(Ptr + 1544) = value; }
     }
 
     /// <summary>
@@ -2526,8 +2919,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float WalkStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1560); }
+        get { return *(float*)(Ptr + 1560); }
+        set { *(float*)(Ptr + 1560) = value; }
     }
 
     /// <summary>
@@ -2547,8 +2940,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float DialogueStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1588); }
+        get { return *(float*)(Ptr + 1588); }
+        set { *(float*)(Ptr + 1588) = value; }
     }
 
     /// <summary>
@@ -2568,8 +2961,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ForensicsScanStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1616); }
+        get { return *(float*)(Ptr + 1616); }
+        set { *(float*)(Ptr + 1616) = value; }
     }
 
     /// <summary>
@@ -2589,8 +2982,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float UsingSpotlightStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1644); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1644); }
+        get { return *(float*)(Ptr + 1644); }
+        set { *(float*)(Ptr + 1644) = value; }
     }
 
     /// <summary>
@@ -2610,8 +3003,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ForensicsFilterStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1672); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1672); }
+        get { return *(float*)(Ptr + 1672); }
+        set { *(float*)(Ptr + 1672) = value; }
     }
 
     /// <summary>
@@ -2631,8 +3024,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1700); }
+        get { return *(float*)(Ptr + 1700); }
+        set { *(float*)(Ptr + 1700) = value; }
     }
 
     /// <summary>
@@ -2640,8 +3033,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float BoostRunFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1704); }
+        get { return *(float*)(Ptr + 1704); }
+        set { *(float*)(Ptr + 1704) = value; }
     }
 
     /// <summary>
@@ -2661,8 +3054,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PairedAnimationStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1732); }
+        get { return *(float*)(Ptr + 1732); }
+        set { *(float*)(Ptr + 1732) = value; }
     }
 
     /// <summary>
@@ -2682,8 +3075,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float StealthStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1760); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1760); }
+        get { return *(float*)(Ptr + 1760); }
+        set { *(float*)(Ptr + 1760) = value; }
     }
 
     /// <summary>
@@ -2691,8 +3084,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverworldStealthStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1764); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1764); }
+        get { return *(float*)(Ptr + 1764); }
+        set { *(float*)(Ptr + 1764) = value; }
     }
 
     /// <summary>
@@ -2712,8 +3105,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float TunnelStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1792); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1792); }
+        get { return *(float*)(Ptr + 1792); }
+        set { *(float*)(Ptr + 1792) = value; }
     }
 
     /// <summary>
@@ -2745,8 +3138,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float FallingStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1844); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1844); }
+        get { return *(float*)(Ptr + 1844); }
+        set { *(float*)(Ptr + 1844) = value; }
     }
 
     /// <summary>
@@ -2760,8 +3153,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float FallingStateSwingSmoothingStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1860); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1860); }
+        get { return *(float*)(Ptr + 1860); }
+        set { *(float*)(Ptr + 1860) = value; }
     }
 
     /// <summary>
@@ -2769,8 +3162,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float FallingStateSwingTransitionTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1864); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1864); }
+        get { return *(float*)(Ptr + 1864); }
+        set { *(float*)(Ptr + 1864) = value; }
     }
 
     /// <summary>
@@ -2784,8 +3177,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float GrappleAimCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1880); }
+        get { return *(float*)(Ptr + 1880); }
+        set { *(float*)(Ptr + 1880) = value; }
     }
 
     /// <summary>
@@ -2799,8 +3192,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int GrappleAimMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1896); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1896); }
+        get { return *(int*)(Ptr + 1896); }
+        set { *(int*)(Ptr + 1896) = value; }
     }
 
     /// <summary>
@@ -2808,8 +3201,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int GrappleAimMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1900); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1900); }
+        get { return *(int*)(Ptr + 1900); }
+        set { *(int*)(Ptr + 1900) = value; }
     }
 
     /// <summary>
@@ -2823,8 +3216,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float HarpoonAimCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1916); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1916); }
+        get { return *(float*)(Ptr + 1916); }
+        set { *(float*)(Ptr + 1916) = value; }
     }
 
     /// <summary>
@@ -2838,8 +3231,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int HarpoonAimMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1932); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1932); }
+        get { return *(int*)(Ptr + 1932); }
+        set { *(int*)(Ptr + 1932) = value; }
     }
 
     /// <summary>
@@ -2847,8 +3240,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int HarpoonAimMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1936); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1936); }
+        get { return *(int*)(Ptr + 1936); }
+        set { *(int*)(Ptr + 1936) = value; }
     }
 
     /// <summary>
@@ -2862,8 +3255,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MagneticBlastAimCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1952); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1952); }
+        get { return *(float*)(Ptr + 1952); }
+        set { *(float*)(Ptr + 1952) = value; }
     }
 
     /// <summary>
@@ -2877,8 +3270,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int MagneticBlastAimMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1968); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1968); }
+        get { return *(int*)(Ptr + 1968); }
+        set { *(int*)(Ptr + 1968) = value; }
     }
 
     /// <summary>
@@ -2886,8 +3279,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int MagneticBlastAimMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1972); }
+        get { return *(int*)(Ptr + 1972); }
+        set { *(int*)(Ptr + 1972) = value; }
     }
 
     /// <summary>
@@ -2901,8 +3294,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float FreezeJammerAimCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1988); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1988); }
+        get { return *(float*)(Ptr + 1988); }
+        set { *(float*)(Ptr + 1988) = value; }
     }
 
     /// <summary>
@@ -2916,8 +3309,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int FreezeJammerAimMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2004); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2004); }
+        get { return *(int*)(Ptr + 2004); }
+        set { *(int*)(Ptr + 2004) = value; }
     }
 
     /// <summary>
@@ -2925,8 +3318,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int FreezeJammerAimMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2008); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2008); }
+        get { return *(int*)(Ptr + 2008); }
+        set { *(int*)(Ptr + 2008) = value; }
     }
 
     /// <summary>
@@ -2940,8 +3333,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float JokerGunAimCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2024); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2024); }
+        get { return *(float*)(Ptr + 2024); }
+        set { *(float*)(Ptr + 2024) = value; }
     }
 
     /// <summary>
@@ -2949,8 +3342,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int JokerGunAimMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2028); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2028); }
+        get { return *(int*)(Ptr + 2028); }
+        set { *(int*)(Ptr + 2028) = value; }
     }
 
     /// <summary>
@@ -2958,8 +3351,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int JokerGunAimMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2032); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2032); }
+        get { return *(int*)(Ptr + 2032); }
+        set { *(int*)(Ptr + 2032) = value; }
     }
 
     /// <summary>
@@ -2973,8 +3366,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LineLauncherAimCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2048); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2048); }
+        get { return *(float*)(Ptr + 2048); }
+        set { *(float*)(Ptr + 2048) = value; }
     }
 
     /// <summary>
@@ -2988,8 +3381,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int LineLauncherAimMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2064); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2064); }
+        get { return *(int*)(Ptr + 2064); }
+        set { *(int*)(Ptr + 2064) = value; }
     }
 
     /// <summary>
@@ -2997,8 +3390,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int LineLauncherAimMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2068); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2068); }
+        get { return *(int*)(Ptr + 2068); }
+        set { *(int*)(Ptr + 2068) = value; }
     }
 
     /// <summary>
@@ -3012,8 +3405,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float BatarangAimCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2084); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2084); }
+        get { return *(float*)(Ptr + 2084); }
+        set { *(float*)(Ptr + 2084) = value; }
     }
 
     /// <summary>
@@ -3027,8 +3420,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int BatarangAimMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2100); }
+        get { return *(int*)(Ptr + 2100); }
+        set { *(int*)(Ptr + 2100) = value; }
     }
 
     /// <summary>
@@ -3036,8 +3429,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int BatarangAimMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2104); }
+        get { return *(int*)(Ptr + 2104); }
+        set { *(int*)(Ptr + 2104) = value; }
     }
 
     /// <summary>
@@ -3051,8 +3444,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float WallClimbStartCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2120); }
+        get { return *(float*)(Ptr + 2120); }
+        set { *(float*)(Ptr + 2120) = value; }
     }
 
     /// <summary>
@@ -3072,8 +3465,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PounceCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2148); }
+        get { return *(float*)(Ptr + 2148); }
+        set { *(float*)(Ptr + 2148) = value; }
     }
 
     /// <summary>
@@ -3099,8 +3492,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float BatTrackerAimCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2188); }
+        get { return *(float*)(Ptr + 2188); }
+        set { *(float*)(Ptr + 2188) = value; }
     }
 
     /// <summary>
@@ -3120,8 +3513,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CorridorCombatStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2216); }
+        get { return *(float*)(Ptr + 2216); }
+        set { *(float*)(Ptr + 2216) = value; }
     }
 
     /// <summary>
@@ -3129,8 +3522,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float HighCombatStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2220); }
+        get { return *(float*)(Ptr + 2220); }
+        set { *(float*)(Ptr + 2220) = value; }
     }
 
     /// <summary>
@@ -3144,8 +3537,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LookStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2236); }
+        get { return *(float*)(Ptr + 2236); }
+        set { *(float*)(Ptr + 2236) = value; }
     }
 
     /// <summary>
@@ -3159,8 +3552,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int LookStateMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2252); }
+        get { return *(int*)(Ptr + 2252); }
+        set { *(int*)(Ptr + 2252) = value; }
     }
 
     /// <summary>
@@ -3168,8 +3561,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int LookStateMinPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2256); }
+        get { return *(int*)(Ptr + 2256); }
+        set { *(int*)(Ptr + 2256) = value; }
     }
 
     /// <summary>
@@ -3177,8 +3570,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LookModeScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2260); }
+        get { return *(float*)(Ptr + 2260); }
+        set { *(float*)(Ptr + 2260) = value; }
     }
 
     /// <summary>
@@ -3186,8 +3579,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LookSpringBack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2264); }
+        get { return *(float*)(Ptr + 2264); }
+        set { *(float*)(Ptr + 2264) = value; }
     }
 
     /// <summary>
@@ -3195,8 +3588,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float GrappleLookSpringBack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2268); }
+        get { return *(float*)(Ptr + 2268); }
+        set { *(float*)(Ptr + 2268) = value; }
     }
 
     /// <summary>
@@ -3204,8 +3597,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float GrappleCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2272); }
+        get { return *(float*)(Ptr + 2272); }
+        set { *(float*)(Ptr + 2272) = value; }
     }
 
     /// <summary>
@@ -3213,8 +3606,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2276); }
+        get { return *(float*)(Ptr + 2276); }
+        set { *(float*)(Ptr + 2276) = value; }
     }
 
     /// <summary>
@@ -3228,8 +3621,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CoverRightCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2292); }
+        get { return *(float*)(Ptr + 2292); }
+        set { *(float*)(Ptr + 2292) = value; }
     }
 
     /// <summary>
@@ -3249,8 +3642,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float AlcoveCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2320); }
+        get { return *(float*)(Ptr + 2320); }
+        set { *(float*)(Ptr + 2320) = value; }
     }
 
     /// <summary>
@@ -3276,8 +3669,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float GlidingCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2360); }
+        get { return *(float*)(Ptr + 2360); }
+        set { *(float*)(Ptr + 2360) = value; }
     }
 
     /// <summary>
@@ -3285,8 +3678,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float GlidingCameraExtraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2364); }
+        get { return *(float*)(Ptr + 2364); }
+        set { *(float*)(Ptr + 2364) = value; }
     }
 
     /// <summary>
@@ -3300,8 +3693,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float GlideLagStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2380); }
+        get { return *(float*)(Ptr + 2380); }
+        set { *(float*)(Ptr + 2380) = value; }
     }
 
     /// <summary>
@@ -3309,8 +3702,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float GlideLagBoostStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2384); }
+        get { return *(float*)(Ptr + 2384); }
+        set { *(float*)(Ptr + 2384) = value; }
     }
 
     /// <summary>
@@ -3318,8 +3711,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float GlideLagStrengthBlendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2388); }
+        get { return *(float*)(Ptr + 2388); }
+        set { *(float*)(Ptr + 2388) = value; }
     }
 
     /// <summary>
@@ -3327,8 +3720,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float DiveCameraOrientationTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2392); }
+        get { return *(float*)(Ptr + 2392); }
+        set { *(float*)(Ptr + 2392) = value; }
     }
 
     /// <summary>
@@ -3348,8 +3741,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float BoostGlidingCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2420); }
+        get { return *(float*)(Ptr + 2420); }
+        set { *(float*)(Ptr + 2420) = value; }
     }
 
     /// <summary>
@@ -3381,8 +3774,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float SilentPredCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2472); }
+        get { return *(float*)(Ptr + 2472); }
+        set { *(float*)(Ptr + 2472) = value; }
     }
 
     /// <summary>
@@ -3396,8 +3789,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomSilentPredCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2488); }
+        get { return *(float*)(Ptr + 2488); }
+        set { *(float*)(Ptr + 2488) = value; }
     }
 
     /// <summary>
@@ -3417,8 +3810,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float HangCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2516); }
+        get { return *(float*)(Ptr + 2516); }
+        set { *(float*)(Ptr + 2516) = value; }
     }
 
     /// <summary>
@@ -3432,8 +3825,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinFreeCameraDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2532); }
+        get { return *(float*)(Ptr + 2532); }
+        set { *(float*)(Ptr + 2532) = value; }
     }
 
     /// <summary>
@@ -3441,8 +3834,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxFreeCameraDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2536); }
+        get { return *(float*)(Ptr + 2536); }
+        set { *(float*)(Ptr + 2536) = value; }
     }
 
     /// <summary>
@@ -3450,8 +3843,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ShortCamSpringConst
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2540); }
+        get { return *(float*)(Ptr + 2540); }
+        set { *(float*)(Ptr + 2540) = value; }
     }
 
     /// <summary>
@@ -3459,8 +3852,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LongCamSpringConst
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2544); }
+        get { return *(float*)(Ptr + 2544); }
+        set { *(float*)(Ptr + 2544) = value; }
     }
 
     /// <summary>
@@ -3474,8 +3867,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentShortCamSpringConst
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2560); }
+        get { return *(float*)(Ptr + 2560); }
+        set { *(float*)(Ptr + 2560) = value; }
     }
 
     /// <summary>
@@ -3483,8 +3876,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentLongCamSpringConst
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2564); }
+        get { return *(float*)(Ptr + 2564); }
+        set { *(float*)(Ptr + 2564) = value; }
     }
 
     /// <summary>
@@ -3498,8 +3891,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxFreeCameraPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2580); }
+        get { return *(int*)(Ptr + 2580); }
+        set { *(int*)(Ptr + 2580) = value; }
     }
 
     /// <summary>
@@ -3507,8 +3900,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int MinFreeCameraPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2584); }
+        get { return *(int*)(Ptr + 2584); }
+        set { *(int*)(Ptr + 2584) = value; }
     }
 
     /// <summary>
@@ -3516,8 +3909,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomSensitivityMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2588); }
+        get { return *(float*)(Ptr + 2588); }
+        set { *(float*)(Ptr + 2588) = value; }
     }
 
     /// <summary>
@@ -3525,8 +3918,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LookSensitivityMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2592); }
+        get { return *(float*)(Ptr + 2592); }
+        set { *(float*)(Ptr + 2592) = value; }
     }
 
     /// <summary>
@@ -3534,8 +3927,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float HarpoonSensitivityMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2596); }
+        get { return *(float*)(Ptr + 2596); }
+        set { *(float*)(Ptr + 2596) = value; }
     }
 
     /// <summary>
@@ -3543,8 +3936,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float JokerGunSensitivityMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2600); }
+        get { return *(float*)(Ptr + 2600); }
+        set { *(float*)(Ptr + 2600) = value; }
     }
 
     /// <summary>
@@ -3582,8 +3975,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZipLineCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2664); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2664); }
+        get { return *(float*)(Ptr + 2664); }
+        set { *(float*)(Ptr + 2664) = value; }
     }
 
     /// <summary>
@@ -3609,8 +4002,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float HarpoonPullCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2704); }
+        get { return *(float*)(Ptr + 2704); }
+        set { *(float*)(Ptr + 2704) = value; }
     }
 
     /// <summary>
@@ -3654,8 +4047,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float SwingingFromAboveCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2780); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2780); }
+        get { return *(float*)(Ptr + 2780); }
+        set { *(float*)(Ptr + 2780) = value; }
     }
 
     /// <summary>
@@ -3669,8 +4062,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CeilingClimbCamFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2796); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2796); }
+        get { return *(float*)(Ptr + 2796); }
+        set { *(float*)(Ptr + 2796) = value; }
     }
 
     /// <summary>
@@ -3690,8 +4083,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2824); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2824); }
+        get { return *(float*)(Ptr + 2824); }
+        set { *(float*)(Ptr + 2824) = value; }
     }
 
     /// <summary>
@@ -3699,8 +4092,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2828); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2828); }
+        get { return *(float*)(Ptr + 2828); }
+        set { *(float*)(Ptr + 2828) = value; }
     }
 
     /// <summary>
@@ -3708,8 +4101,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float RaftPullFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2832); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2832); }
+        get { return *(float*)(Ptr + 2832); }
+        set { *(float*)(Ptr + 2832) = value; }
     }
 
     /// <summary>
@@ -3717,8 +4110,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int ForcedPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2836); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2836); }
+        get { return *(int*)(Ptr + 2836); }
+        set { *(int*)(Ptr + 2836) = value; }
     }
 
     /// <summary>
@@ -3738,8 +4131,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float TransitionFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2864); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2864); }
+        get { return *(float*)(Ptr + 2864); }
+        set { *(float*)(Ptr + 2864) = value; }
     }
 
     /// <summary>
@@ -3747,8 +4140,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentMinFreeCameraDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2868); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2868); }
+        get { return *(float*)(Ptr + 2868); }
+        set { *(float*)(Ptr + 2868) = value; }
     }
 
     /// <summary>
@@ -3756,8 +4149,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentMaxFreeCameraDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2872); }
+        get { return *(float*)(Ptr + 2872); }
+        set { *(float*)(Ptr + 2872) = value; }
     }
 
     /// <summary>
@@ -3798,8 +4191,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentSitOffsetPower
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2928); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2928); }
+        get { return *(float*)(Ptr + 2928); }
+        set { *(float*)(Ptr + 2928) = value; }
     }
 
     /// <summary>
@@ -3825,8 +4218,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float StateSitOffsetPower
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2968); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2968); }
+        get { return *(float*)(Ptr + 2968); }
+        set { *(float*)(Ptr + 2968) = value; }
     }
 
     /// <summary>
@@ -3834,8 +4227,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float StateDefaultCameraPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2972); }
+        get { return *(float*)(Ptr + 2972); }
+        set { *(float*)(Ptr + 2972) = value; }
     }
 
     /// <summary>
@@ -3843,8 +4236,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentDefaultCameraPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2976); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2976); }
+        get { return *(float*)(Ptr + 2976); }
+        set { *(float*)(Ptr + 2976) = value; }
     }
 
     /// <summary>
@@ -3852,8 +4245,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentCameraFollowPelvisXY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2980); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2980); }
+        get { return *(float*)(Ptr + 2980); }
+        set { *(float*)(Ptr + 2980) = value; }
     }
 
     /// <summary>
@@ -3861,8 +4254,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentCameraFollowPelvisZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2984); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2984); }
+        get { return *(float*)(Ptr + 2984); }
+        set { *(float*)(Ptr + 2984) = value; }
     }
 
     /// <summary>
@@ -3870,8 +4263,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentPelvisSway
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2988); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2988); }
+        get { return *(float*)(Ptr + 2988); }
+        set { *(float*)(Ptr + 2988) = value; }
     }
 
     /// <summary>
@@ -3885,8 +4278,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float EdgeSwingCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3004); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3004); }
+        get { return *(float*)(Ptr + 3004); }
+        set { *(float*)(Ptr + 3004) = value; }
     }
 
     /// <summary>
@@ -3918,8 +4311,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinZoomFarBlur
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3108); }
+        get { return *(float*)(Ptr + 3108); }
+        set { *(float*)(Ptr + 3108) = value; }
     }
 
     /// <summary>
@@ -3933,8 +4326,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float VenomHenchmenCombatCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3176); }
+        get { return *(float*)(Ptr + 3176); }
+        set { *(float*)(Ptr + 3176) = value; }
     }
 
     /// <summary>
@@ -3942,8 +4335,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PenguinBeatdownFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3180); }
+        get { return *(float*)(Ptr + 3180); }
+        set { *(float*)(Ptr + 3180) = value; }
     }
 
     /// <summary>
@@ -4335,8 +4728,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LookDownVantageCamFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11120); }
+        get { return *(float*)(Ptr + 11120); }
+        set { *(float*)(Ptr + 11120) = value; }
     }
 
     /// <summary>
@@ -4356,8 +4749,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float AlternativeWalkCamFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11260); }
+        get { return *(float*)(Ptr + 11260); }
+        set { *(float*)(Ptr + 11260) = value; }
     }
 
     /// <summary>
@@ -4365,8 +4758,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float SlideStateCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11264); }
+        get { return *(float*)(Ptr + 11264); }
+        set { *(float*)(Ptr + 11264) = value; }
     }
 
     /// <summary>
@@ -4380,8 +4773,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float DiveOverRailingPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11280); }
+        get { return *(float*)(Ptr + 11280); }
+        set { *(float*)(Ptr + 11280) = value; }
     }
 
     /// <summary>
@@ -4389,8 +4782,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CameraWanderTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11284); }
+        get { return *(float*)(Ptr + 11284); }
+        set { *(float*)(Ptr + 11284) = value; }
     }
 
     /// <summary>
@@ -4410,8 +4803,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CameraWanderFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11312); }
+        get { return *(float*)(Ptr + 11312); }
+        set { *(float*)(Ptr + 11312) = value; }
     }
 
     /// <summary>
@@ -4455,8 +4848,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int GlideShakeId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 11876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11876); }
+        get { return *(int*)(Ptr + 11876); }
+        set { *(int*)(Ptr + 11876) = value; }
     }
 
     /// <summary>
@@ -4464,8 +4857,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float Test
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11880); }
+        get { return *(float*)(Ptr + 11880); }
+        set { *(float*)(Ptr + 11880) = value; }
     }
 
     /// <summary>
@@ -4491,8 +4884,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int GrappleMaxPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 11892); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11892); }
+        get { return *(int*)(Ptr + 11892); }
+        set { *(int*)(Ptr + 11892) = value; }
     }
 
     /// <summary>
@@ -4524,8 +4917,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CornerStateFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11944); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11944); }
+        get { return *(float*)(Ptr + 11944); }
+        set { *(float*)(Ptr + 11944) = value; }
     }
 
     /// <summary>
@@ -4545,8 +4938,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomedFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11972); }
+        get { return *(float*)(Ptr + 11972); }
+        set { *(float*)(Ptr + 11972) = value; }
     }
 
     /// <summary>
@@ -4554,8 +4947,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomProp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11976); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11976); }
+        get { return *(float*)(Ptr + 11976); }
+        set { *(float*)(Ptr + 11976) = value; }
     }
 
     /// <summary>
@@ -4563,8 +4956,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ForceZoomFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11980); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11980); }
+        get { return *(float*)(Ptr + 11980); }
+        set { *(float*)(Ptr + 11980) = value; }
     }
 
     /// <summary>
@@ -4572,8 +4965,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MotionBlurAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11984); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11984); }
+        get { return *(float*)(Ptr + 11984); }
+        set { *(float*)(Ptr + 11984) = value; }
     }
 
     /// <summary>
@@ -4581,8 +4974,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MotionBlurBlendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11988); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11988); }
+        get { return *(float*)(Ptr + 11988); }
+        set { *(float*)(Ptr + 11988) = value; }
     }
 
     /// <summary>
@@ -4590,8 +4983,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float InitialMotionBlurAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11992); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11992); }
+        get { return *(float*)(Ptr + 11992); }
+        set { *(float*)(Ptr + 11992) = value; }
     }
 
     /// <summary>
@@ -4599,8 +4992,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float InitialMotionBlurMaxVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 11996); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11996); }
+        get { return *(float*)(Ptr + 11996); }
+        set { *(float*)(Ptr + 11996) = value; }
     }
 
     /// <summary>
@@ -4608,8 +5001,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinCameraMotionBlur
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12000); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12000); }
+        get { return *(float*)(Ptr + 12000); }
+        set { *(float*)(Ptr + 12000) = value; }
     }
 
     /// <summary>
@@ -4623,8 +5016,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12016); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12016); }
+        get { return *(float*)(Ptr + 12016); }
+        set { *(float*)(Ptr + 12016) = value; }
     }
 
     /// <summary>
@@ -4644,8 +5037,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverrideBloomValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12044); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12044); }
+        get { return *(float*)(Ptr + 12044); }
+        set { *(float*)(Ptr + 12044) = value; }
     }
 
     /// <summary>
@@ -4653,8 +5046,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LoadedAspectRatio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12048); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12048); }
+        get { return *(float*)(Ptr + 12048); }
+        set { *(float*)(Ptr + 12048) = value; }
     }
 
     /// <summary>
@@ -4662,8 +5055,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentCameraAssistStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12052); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12052); }
+        get { return *(float*)(Ptr + 12052); }
+        set { *(float*)(Ptr + 12052) = value; }
     }
 
     /// <summary>
@@ -4671,8 +5064,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CameraAssistBuildUpTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12056); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12056); }
+        get { return *(float*)(Ptr + 12056); }
+        set { *(float*)(Ptr + 12056) = value; }
     }
 
     /// <summary>
@@ -4692,8 +5085,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastStepUpOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12084); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12084); }
+        get { return *(float*)(Ptr + 12084); }
+        set { *(float*)(Ptr + 12084) = value; }
     }
 
     /// <summary>
@@ -4719,8 +5112,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverrideTransitionInDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12112); }
+        get { return *(float*)(Ptr + 12112); }
+        set { *(float*)(Ptr + 12112) = value; }
     }
 
     /// <summary>
@@ -4737,8 +5130,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.CameraLookAtSpeed LookAtSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.CameraLookAtSpeed>(Ptr + 12128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12128); }
+        get { return *(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed*)(Ptr + 12128); }
+        set { *(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed*)(Ptr + 12128) = value; }
     }
 
     /// <summary>
@@ -4746,8 +5139,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.CameraLookAtType LookAtType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.CameraLookAtType>(Ptr + 12129); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12129); }
+        get { return *(BmSDK.BmGame.RGameInfo.CameraLookAtType*)(Ptr + 12129); }
+        set { *(BmSDK.BmGame.RGameInfo.CameraLookAtType*)(Ptr + 12129) = value; }
     }
 
     /// <summary>
@@ -4755,8 +5148,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.CameraLookAtStrength LookAtStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.CameraLookAtStrength>(Ptr + 12130); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12130); }
+        get { return *(BmSDK.BmGame.RGameInfo.CameraLookAtStrength*)(Ptr + 12130); }
+        set { *(BmSDK.BmGame.RGameInfo.CameraLookAtStrength*)(Ptr + 12130) = value; }
     }
 
     /// <summary>
@@ -4764,8 +5157,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe byte CurrentZoomPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 12131); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12131); }
+        get { return *(byte*)(Ptr + 12131); }
+        set { *(byte*)(Ptr + 12131) = value; }
     }
 
     /// <summary>
@@ -4818,8 +5211,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomFocusSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12208); }
+        get { return *(float*)(Ptr + 12208); }
+        set { *(float*)(Ptr + 12208) = value; }
     }
 
     /// <summary>
@@ -4827,8 +5220,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxZoomFocusDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12212); }
+        get { return *(float*)(Ptr + 12212); }
+        set { *(float*)(Ptr + 12212) = value; }
     }
 
     /// <summary>
@@ -4854,8 +5247,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName RunOverlayName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 12240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12240); }
+        get { return *(BmSDK.FName*)(Ptr + 12240); }
+        set { *(BmSDK.FName*)(Ptr + 12240) = value; }
     }
 
     /// <summary>
@@ -4863,8 +5256,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunOverlayStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12248); }
+        get { return *(float*)(Ptr + 12248); }
+        set { *(float*)(Ptr + 12248) = value; }
     }
 
     /// <summary>
@@ -4872,8 +5265,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunOverlayZeroFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12252); }
+        get { return *(float*)(Ptr + 12252); }
+        set { *(float*)(Ptr + 12252) = value; }
     }
 
     /// <summary>
@@ -4881,8 +5274,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float HelicopterCameraFOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12256); }
+        get { return *(float*)(Ptr + 12256); }
+        set { *(float*)(Ptr + 12256) = value; }
     }
 
     /// <summary>
@@ -4899,8 +5292,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorPPFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12264); }
+        get { return *(float*)(Ptr + 12264); }
+        set { *(float*)(Ptr + 12264) = value; }
     }
 
     /// <summary>
@@ -4908,8 +5301,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorScreenScene_HighlightsMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12268); }
+        get { return *(float*)(Ptr + 12268); }
+        set { *(float*)(Ptr + 12268) = value; }
     }
 
     /// <summary>
@@ -4917,8 +5310,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorScreenScene_MidTonesMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12272); }
+        get { return *(float*)(Ptr + 12272); }
+        set { *(float*)(Ptr + 12272) = value; }
     }
 
     /// <summary>
@@ -4926,8 +5319,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorScreenScene_ShadowsMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12276); }
+        get { return *(float*)(Ptr + 12276); }
+        set { *(float*)(Ptr + 12276) = value; }
     }
 
     /// <summary>
@@ -4935,8 +5328,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorScreenScene_DOFNear
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12280); }
+        get { return *(float*)(Ptr + 12280); }
+        set { *(float*)(Ptr + 12280) = value; }
     }
 
     /// <summary>
@@ -4944,8 +5337,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorScreenScene_DOFFar
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12284); }
+        get { return *(float*)(Ptr + 12284); }
+        set { *(float*)(Ptr + 12284) = value; }
     }
 
     /// <summary>
@@ -4953,8 +5346,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorScreenScene_DOFFalloff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12288); }
+        get { return *(float*)(Ptr + 12288); }
+        set { *(float*)(Ptr + 12288) = value; }
     }
 
     /// <summary>
@@ -4962,8 +5355,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorScreenScene_DOFRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12292); }
+        get { return *(float*)(Ptr + 12292); }
+        set { *(float*)(Ptr + 12292) = value; }
     }
 
     /// <summary>
@@ -4971,8 +5364,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ResonatorScreenScene_DOFDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12296); }
+        get { return *(float*)(Ptr + 12296); }
+        set { *(float*)(Ptr + 12296) = value; }
     }
 
     /// <summary>
@@ -5036,8 +5429,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe int CameraSmoothingCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12460); }
+        get { return *(int*)(Ptr + 12460); }
+        set { *(int*)(Ptr + 12460) = value; }
     }
 
     /// <summary>
@@ -5045,8 +5438,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float SmoothingConfigMaxVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12464); }
+        get { return *(float*)(Ptr + 12464); }
+        set { *(float*)(Ptr + 12464) = value; }
     }
 
     /// <summary>
@@ -5054,8 +5447,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float SmoothingConfigStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12468); }
+        get { return *(float*)(Ptr + 12468); }
+        set { *(float*)(Ptr + 12468) = value; }
     }
 
     /// <summary>
@@ -5063,8 +5456,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float SmoothingConfigMaxAccel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12472); }
+        get { return *(float*)(Ptr + 12472); }
+        set { *(float*)(Ptr + 12472) = value; }
     }
 
     /// <summary>
@@ -5072,8 +5465,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentSmoothingConfigStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12476); }
+        get { return *(float*)(Ptr + 12476); }
+        set { *(float*)(Ptr + 12476) = value; }
     }
 
     /// <summary>
@@ -5081,8 +5474,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverworldRunningConfigStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12480); }
+        get { return *(float*)(Ptr + 12480); }
+        set { *(float*)(Ptr + 12480) = value; }
     }
 
     /// <summary>
@@ -5090,8 +5483,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float NormalConfigStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12484); }
+        get { return *(float*)(Ptr + 12484); }
+        set { *(float*)(Ptr + 12484) = value; }
     }
 
     /// <summary>
@@ -5111,8 +5504,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastCameraMoveTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12512); }
+        get { return *(float*)(Ptr + 12512); }
+        set { *(float*)(Ptr + 12512) = value; }
     }
 
     /// <summary>
@@ -5120,8 +5513,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PelvisFollowZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12516); }
+        get { return *(float*)(Ptr + 12516); }
+        set { *(float*)(Ptr + 12516) = value; }
     }
 
     /// <summary>
@@ -5129,8 +5522,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PelvisFollowXY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12520); }
+        get { return *(float*)(Ptr + 12520); }
+        set { *(float*)(Ptr + 12520) = value; }
     }
 
     /// <summary>
@@ -5138,8 +5531,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PelvisSway
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12524); }
+        get { return *(float*)(Ptr + 12524); }
+        set { *(float*)(Ptr + 12524) = value; }
     }
 
     /// <summary>
@@ -5152,72 +5545,72 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomPoints_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12528); }
+        get { return *(float*)(Ptr + 12528); }
+        set { *(float*)(Ptr + 12528) = value; }
     }
     /// <summary>
     /// FloatProperty: ZoomPoints
     /// </summary>
     public unsafe float ZoomPoints_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12532); }
+        get { return *(float*)(Ptr + 12532); }
+        set { *(float*)(Ptr + 12532) = value; }
     }
     /// <summary>
     /// FloatProperty: ZoomPoints
     /// </summary>
     public unsafe float ZoomPoints_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12536); }
+        get { return *(float*)(Ptr + 12536); }
+        set { *(float*)(Ptr + 12536) = value; }
     }
     /// <summary>
     /// FloatProperty: ZoomPoints
     /// </summary>
     public unsafe float ZoomPoints_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12540); }
+        get { return *(float*)(Ptr + 12540); }
+        set { *(float*)(Ptr + 12540) = value; }
     }
     /// <summary>
     /// FloatProperty: ZoomPoints
     /// </summary>
     public unsafe float ZoomPoints_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12544); }
+        get { return *(float*)(Ptr + 12544); }
+        set { *(float*)(Ptr + 12544) = value; }
     }
     /// <summary>
     /// FloatProperty: ZoomPoints
     /// </summary>
     public unsafe float ZoomPoints_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12548); }
+        get { return *(float*)(Ptr + 12548); }
+        set { *(float*)(Ptr + 12548) = value; }
     }
     /// <summary>
     /// FloatProperty: ZoomPoints
     /// </summary>
     public unsafe float ZoomPoints_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12552); }
+        get { return *(float*)(Ptr + 12552); }
+        set { *(float*)(Ptr + 12552) = value; }
     }
     /// <summary>
     /// FloatProperty: ZoomPoints
     /// </summary>
     public unsafe float ZoomPoints_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12556); }
+        get { return *(float*)(Ptr + 12556); }
+        set { *(float*)(Ptr + 12556) = value; }
     }
     /// <summary>
     /// FloatProperty: ZoomPoints
     /// </summary>
     public unsafe float ZoomPoints_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12560); }
+        get { return *(float*)(Ptr + 12560); }
+        set { *(float*)(Ptr + 12560) = value; }
     }
 
     /// <summary>
@@ -5327,8 +5720,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZoomPointAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12780); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12780); }
+        get { return *(float*)(Ptr + 12780); }
+        set { *(float*)(Ptr + 12780) = value; }
     }
 
     /// <summary>
@@ -5336,8 +5729,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float TightZoomPointAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12784); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12784); }
+        get { return *(float*)(Ptr + 12784); }
+        set { *(float*)(Ptr + 12784) = value; }
     }
 
     /// <summary>
@@ -5351,8 +5744,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunStatePelvisXY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12816); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12816); }
+        get { return *(float*)(Ptr + 12816); }
+        set { *(float*)(Ptr + 12816) = value; }
     }
 
     /// <summary>
@@ -5360,8 +5753,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunStatePelvisZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12820); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12820); }
+        get { return *(float*)(Ptr + 12820); }
+        set { *(float*)(Ptr + 12820) = value; }
     }
 
     /// <summary>
@@ -5369,8 +5762,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunStatePelvisSway
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12824); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12824); }
+        get { return *(float*)(Ptr + 12824); }
+        set { *(float*)(Ptr + 12824) = value; }
     }
 
     /// <summary>
@@ -5378,8 +5771,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float DefaultPelvisFollowZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12828); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12828); }
+        get { return *(float*)(Ptr + 12828); }
+        set { *(float*)(Ptr + 12828) = value; }
     }
 
     /// <summary>
@@ -5387,8 +5780,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float DefaultPelvisFollowXY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12832); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12832); }
+        get { return *(float*)(Ptr + 12832); }
+        set { *(float*)(Ptr + 12832) = value; }
     }
 
     /// <summary>
@@ -5396,8 +5789,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float DefaultPelvisSway
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12836); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12836); }
+        get { return *(float*)(Ptr + 12836); }
+        set { *(float*)(Ptr + 12836) = value; }
     }
 
     /// <summary>
@@ -5405,8 +5798,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastCollisionDistSqr
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12840); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12840); }
+        get { return *(float*)(Ptr + 12840); }
+        set { *(float*)(Ptr + 12840) = value; }
     }
 
     /// <summary>
@@ -5414,8 +5807,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxCollisionDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12844); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12844); }
+        get { return *(float*)(Ptr + 12844); }
+        set { *(float*)(Ptr + 12844) = value; }
     }
 
     /// <summary>
@@ -5435,8 +5828,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CustomCameraFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12984); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12984); }
+        get { return *(float*)(Ptr + 12984); }
+        set { *(float*)(Ptr + 12984) = value; }
     }
 
     /// <summary>
@@ -5444,8 +5837,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CustomCameraZoomFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12988); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12988); }
+        get { return *(float*)(Ptr + 12988); }
+        set { *(float*)(Ptr + 12988) = value; }
     }
 
     /// <summary>
@@ -5459,8 +5852,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float CustomCameraTransitionTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 13004); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 13004); }
+        get { return *(float*)(Ptr + 13004); }
+        set { *(float*)(Ptr + 13004) = value; }
     }
 
     /// <summary>
@@ -5483,8 +5876,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float BatarangOutOfRangeFXStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 13024); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 13024); }
+        get { return *(float*)(Ptr + 13024); }
+        set { *(float*)(Ptr + 13024) = value; }
     }
 
     /// <summary>
@@ -5501,8 +5894,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float PitchDragSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 13032); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 13032); }
+        get { return *(float*)(Ptr + 13032); }
+        set { *(float*)(Ptr + 13032) = value; }
     }
 
     /// <summary>
@@ -5510,8 +5903,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float DefaultPitchDragSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 13036); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 13036); }
+        get { return *(float*)(Ptr + 13036); }
+        set { *(float*)(Ptr + 13036) = value; }
     }
 
     /// <summary>
@@ -5519,8 +5912,8 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     /// </summary>
     public unsafe float FallingPitchDragSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 13040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 13040); }
+        get { return *(float*)(Ptr + 13040); }
+        set { *(float*)(Ptr + 13040) = value; }
     }
 
     /// <summary>
@@ -5529,157 +5922,100 @@ public partial class R3rdPersonCamera : BmSDK.Engine.Camera, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 124)]
     public partial record struct FFreeCameraConfig
     {
+        [FieldOffset(92)] private int _bitfield92;
+        [FieldOffset(120)] private int _bitfield120;
+
         /// <summary>
         /// StructProperty: StateFreeCameraSitOffsetMin
         /// </summary>
-        public unsafe System.Numerics.Vector3 StateFreeCameraSitOffsetMin
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector3 StateFreeCameraSitOffsetMin;
 
         /// <summary>
         /// StructProperty: StateFreeCameraSitOffsetMax
         /// </summary>
-        public unsafe System.Numerics.Vector3 StateFreeCameraSitOffsetMax
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public System.Numerics.Vector3 StateFreeCameraSitOffsetMax;
 
         /// <summary>
         /// StructProperty: StateFreeCameraPullOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 StateFreeCameraPullOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public System.Numerics.Vector3 StateFreeCameraPullOffset;
 
         /// <summary>
         /// StructProperty: CameraPivotOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 CameraPivotOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public System.Numerics.Vector3 CameraPivotOffset;
 
         /// <summary>
         /// StructProperty: ZoomedOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 ZoomedOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public System.Numerics.Vector3 ZoomedOffset;
 
         /// <summary>
         /// FloatProperty: maxPitch
         /// </summary>
-        public unsafe float maxPitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float maxPitch;
 
         /// <summary>
         /// FloatProperty: MinPitch
         /// </summary>
-        public unsafe float MinPitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float MinPitch;
 
         /// <summary>
         /// FloatProperty: MinFreeCameraDistance
         /// </summary>
-        public unsafe float MinFreeCameraDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float MinFreeCameraDistance;
 
         /// <summary>
         /// FloatProperty: MaxFreeCameraDistance
         /// </summary>
-        public unsafe float MaxFreeCameraDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
-        }
+        [FieldOffset(72)] public float MaxFreeCameraDistance;
 
         /// <summary>
         /// FloatProperty: ShortCamSpringConst
         /// </summary>
-        public unsafe float ShortCamSpringConst
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
-        }
+        [FieldOffset(76)] public float ShortCamSpringConst;
 
         /// <summary>
         /// FloatProperty: LongCamSpringConst
         /// </summary>
-        public unsafe float LongCamSpringConst
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
-        }
+        [FieldOffset(80)] public float LongCamSpringConst;
 
         /// <summary>
         /// FloatProperty: DefaultCameraPitch
         /// </summary>
-        public unsafe float DefaultCameraPitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
-        }
+        [FieldOffset(84)] public float DefaultCameraPitch;
 
         /// <summary>
         /// FloatProperty: CameraSitOffsetPower
         /// </summary>
-        public unsafe float CameraSitOffsetPower
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
-        }
+        [FieldOffset(88)] public float CameraSitOffsetPower;
 
         /// <summary>
         /// BoolProperty: bUseSeparate43Settings
         /// </summary>
-        public unsafe bool bUseSeparate43Settings
+        public bool bUseSeparate43Settings
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }; }
+            readonly get => (_bitfield92 & 1) != 0;
+            set { if (value) _bitfield92 |= 1; else _bitfield92 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: StateFreeCamera43SitOffsetMax
         /// </summary>
-        public unsafe System.Numerics.Vector3 StateFreeCamera43SitOffsetMax
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public System.Numerics.Vector3 StateFreeCamera43SitOffsetMax;
 
         /// <summary>
         /// StructProperty: StateFreeCamera43SitOffsetMin
         /// </summary>
-        public unsafe System.Numerics.Vector3 StateFreeCamera43SitOffsetMin
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 108); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }; }
-        }
+        [FieldOffset(108)] public System.Numerics.Vector3 StateFreeCamera43SitOffsetMin;
 
         /// <summary>
         /// BoolProperty: bDontModifySitOffsetWhenLookingUp
         /// </summary>
-        public unsafe bool bDontModifySitOffsetWhenLookingUp
+        public bool bDontModifySitOffsetWhenLookingUp
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }; }
+            readonly get => (_bitfield120 & 1) != 0;
+            set { if (value) _bitfield120 |= 1; else _bitfield120 &= ~1; }
         }
     }
 }
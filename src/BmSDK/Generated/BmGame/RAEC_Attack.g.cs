@@ -78,28 +78,49 @@ public partial class RAEC_Attack : BmSDK.BmGame.RAEC_Attack_Base, BmSDK.IGameObj
         where TComponent : class, Framework.IScriptComponent<RAEC_Attack>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PlayExclaimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct PlayExclaim_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 EventCentre;
+    }
+
     /// <summary>
     /// Function: PlayExclaim
     /// </summary>
     public unsafe virtual void PlayExclaim(System.Numerics.Vector3 EventCentre)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.PlayExclaim", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventCentre, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayExclaimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.PlayExclaim", true);
+        var parms = new PlayExclaim_Params();
+        parms.EventCentre = EventCentre;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateSmokeAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CreateSmokeAEC_Params
+    {
+        [FieldOffset(0)] public nint NewSmokeScreen;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateSmokeAEC
     /// </summary>
     public unsafe override BmSDK.BmGame.RAEC_Attack_Smoke CreateSmokeAEC(BmSDK.BmGame.RSmokeScreen NewSmokeScreen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.CreateSmokeAEC", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSmokeScreen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAEC_Attack_Smoke>(paramsPtr + 4);
+        var funcManaged = s_CreateSmokeAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.CreateSmokeAEC", true);
+        var parms = new CreateSmokeAEC_Params();
+        parms.NewSmokeScreen = NewSmokeScreen?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RAEC_Attack_Smoke)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_PlayerDeadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayerDead_Params
+    {
     }
 
     /// <summary>
@@ -107,56 +128,90 @@ public partial class RAEC_Attack : BmSDK.BmGame.RAEC_Attack_Base, BmSDK.IGameObj
     /// </summary>
     public unsafe override void PlayerDead()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.PlayerDead", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerDeadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.PlayerDead", true);
+        var parms = new PlayerDead_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanVantageEscapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct BatmanVantageEscape_Params
+    {
+    }
+
     /// <summary>
     /// Function: BatmanVantageEscape
     /// </summary>
     public unsafe override void BatmanVantageEscape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.BatmanVantageEscape", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanVantageEscapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.BatmanVantageEscape", true);
+        var parms = new BatmanVantageEscape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnregisterSniperAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnregisterSniperAEC_Params
+    {
+        [FieldOffset(0)] public nint ExSniperAEC;
+    }
+
     /// <summary>
     /// Function: UnregisterSniperAEC
     /// </summary>
     public unsafe virtual void UnregisterSniperAEC(BmSDK.BmGame.RAEC_Search_Sub_Sniper ExSniperAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.UnregisterSniperAEC", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExSniperAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterSniperAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.UnregisterSniperAEC", true);
+        var parms = new UnregisterSniperAEC_Params();
+        parms.ExSniperAEC = ExSniperAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterSniperAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RegisterSniperAEC_Params
+    {
+        [FieldOffset(0)] public nint NewSniperAEC;
+    }
+
     /// <summary>
     /// Function: RegisterSniperAEC
     /// </summary>
     public unsafe virtual void RegisterSniperAEC(BmSDK.BmGame.RAEC_Search_Sub_Sniper NewSniperAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.RegisterSniperAEC", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSniperAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterSniperAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.RegisterSniperAEC", true);
+        var parms = new RegisterSniperAEC_Params();
+        parms.NewSniperAEC = NewSniperAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugsAttackingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ThugsAttacking_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ThugsAttacking
     /// </summary>
     public unsafe virtual bool ThugsAttacking()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ThugsAttacking", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ThugsAttackingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ThugsAttacking", true);
+        var parms = new ThugsAttacking_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AreAttackersActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct AreAttackersActive_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameRI.EPredAttackState ReturnValue;
     }
 
     /// <summary>
@@ -164,10 +219,16 @@ public partial class RAEC_Attack : BmSDK.BmGame.RAEC_Attack_Base, BmSDK.IGameObj
     /// </summary>
     public unsafe override BmSDK.BmGame.RGameRI.EPredAttackState AreAttackersActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.AreAttackersActive", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameRI.EPredAttackState>(paramsPtr + 0);
+        var funcManaged = s_AreAttackersActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.AreAttackersActive", true);
+        var parms = new AreAttackersActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_AttackEventFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AttackEventFinished_Params
+    {
     }
 
     /// <summary>
@@ -175,59 +236,96 @@ public partial class RAEC_Attack : BmSDK.BmGame.RAEC_Attack_Base, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void AttackEventFinished()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.AttackEventFinished", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AttackEventFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.AttackEventFinished", true);
+        var parms = new AttackEventFinished_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PrepChaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PrepChase_Params
+    {
+    }
+
     /// <summary>
     /// Function: PrepChase
     /// </summary>
     public unsafe virtual void PrepChase()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.PrepChase", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PrepChaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.PrepChase", true);
+        var parms = new PrepChase_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpecialBarkAvailableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SpecialBarkAvailable_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.BarkType TypeOfSpecialBark;
+    }
+
     /// <summary>
     /// Function: SpecialBarkAvailable
     /// </summary>
     public unsafe virtual void SpecialBarkAvailable(BmSDK.BmGame.RBMAIController.BarkType TypeOfSpecialBark)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.SpecialBarkAvailable", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TypeOfSpecialBark, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpecialBarkAvailableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.SpecialBarkAvailable", true);
+        var parms = new SpecialBarkAvailable_Params();
+        parms.TypeOfSpecialBark = TypeOfSpecialBark;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpecialMoveEndNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SpecialMoveEndNotify_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 NotifyLoc;
+    }
+
     /// <summary>
     /// Function: SpecialMoveEndNotify
     /// </summary>
     public unsafe override void SpecialMoveEndNotify(System.Numerics.Vector3 NotifyLoc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.SpecialMoveEndNotify", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotifyLoc, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpecialMoveEndNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.SpecialMoveEndNotify", true);
+        var parms = new SpecialMoveEndNotify_Params();
+        parms.NotifyLoc = NotifyLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleGadgetImpactNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct HandleGadgetImpactNoise_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(24)] public float ReactRange;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HandleGadgetImpactNoise
     /// </summary>
     public unsafe override bool HandleGadgetImpactNoise(System.Numerics.Vector3 HitLoc, System.Numerics.Vector3 ThrownFromPos, float ReactRange)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.HandleGadgetImpactNoise", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ReactRange, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_HandleGadgetImpactNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.HandleGadgetImpactNoise", true);
+        var parms = new HandleGadgetImpactNoise_Params();
+        parms.HitLoc = HitLoc;
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.ReactRange = ReactRange;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ThugEscapedTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ThugEscapedTakedown_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
     }
 
     /// <summary>
@@ -235,116 +333,177 @@ public partial class RAEC_Attack : BmSDK.BmGame.RAEC_Attack_Base, BmSDK.IGameObj
     /// </summary>
     public unsafe override void ThugEscapedTakedown(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ThugEscapedTakedown", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugEscapedTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ThugEscapedTakedown", true);
+        var parms = new ThugEscapedTakedown_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddAttackerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AddAttacker_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+        [FieldOffset(4)] public int bPlaySpottedLine;
+    }
+
     /// <summary>
     /// Function: AddAttacker
     /// </summary>
     public unsafe override void AddAttacker(BmSDK.BmGame.RBMAIController NewMember, bool bPlaySpottedLine = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.AddAttacker", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlaySpottedLine, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddAttackerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.AddAttacker", true);
+        var parms = new AddAttacker_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        parms.bPlaySpottedLine = bPlaySpottedLine ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugSawPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ThugSawPlayer_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: ThugSawPlayer
     /// </summary>
     public unsafe override void ThugSawPlayer(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ThugSawPlayer", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugSawPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ThugSawPlayer", true);
+        var parms = new ThugSawPlayer_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceNearbyAttackLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ForceNearbyAttackLook_Params
+    {
+    }
+
     /// <summary>
     /// Function: ForceNearbyAttackLook
     /// </summary>
     public unsafe override void ForceNearbyAttackLook()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ForceNearbyAttackLook", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceNearbyAttackLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ForceNearbyAttackLook", true);
+        var parms = new ForceNearbyAttackLook_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceStartAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForceStartAttack_Params
+    {
+        [FieldOffset(0)] public int bForceRestart;
+    }
+
     /// <summary>
     /// Function: ForceStartAttack
     /// </summary>
     public unsafe override void ForceStartAttack(bool bForceRestart = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ForceStartAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceRestart, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceStartAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.ForceStartAttack", true);
+        var parms = new ForceStartAttack_Params();
+        parms.bForceRestart = bForceRestart ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IndirectAlertTriggeredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IndirectAlertTriggered_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 AlertLoc;
+    }
+
     /// <summary>
     /// Function: IndirectAlertTriggered
     /// </summary>
     public unsafe override void IndirectAlertTriggered(System.Numerics.Vector3 AlertLoc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.IndirectAlertTriggered", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AlertLoc, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IndirectAlertTriggeredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.IndirectAlertTriggered", true);
+        var parms = new IndirectAlertTriggered_Params();
+        parms.AlertLoc = AlertLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveChildFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RemoveChild_Params
+    {
+        [FieldOffset(0)] public nint RemAEC;
+    }
+
     /// <summary>
     /// Function: RemoveChild
     /// </summary>
     public unsafe override void RemoveChild(BmSDK.BmGame.RAlertEventCoordinatorBase RemAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.RemoveChild", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RemAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveChildFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.RemoveChild", true);
+        var parms = new RemoveChild_Params();
+        parms.RemAEC = RemAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_VillainStolenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct VillainStolen_Params
+    {
+        [FieldOffset(0)] public nint Stolen;
+    }
+
     /// <summary>
     /// Function: VillainStolen
     /// </summary>
     public unsafe override void VillainStolen(BmSDK.BmGame.RBMAIController Stolen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.VillainStolen", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Stolen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_VillainStolenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.VillainStolen", true);
+        var parms = new VillainStolen_Params();
+        parms.Stolen = Stolen?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TargetPlayerUpdatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TargetPlayerUpdated_Params
+    {
+    }
+
     /// <summary>
     /// Function: TargetPlayerUpdated
     /// </summary>
     public unsafe override void TargetPlayerUpdated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.TargetPlayerUpdated", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TargetPlayerUpdatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.TargetPlayerUpdated", true);
+        var parms = new TargetPlayerUpdated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateChildrenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CreateChildren_Params
+    {
+    }
+
     /// <summary>
     /// Function: CreateChildren
     /// </summary>
     public unsafe override void CreateChildren()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.CreateChildren", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CreateChildrenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack.CreateChildren", true);
+        var parms = new CreateChildren_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -389,8 +548,8 @@ public partial class RAEC_Attack : BmSDK.BmGame.RAEC_Attack_Base, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bSpottedThisConverge
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 1; else *(int*)(Ptr + 484) &= ~1; }
     }
 
     /// <summary>
@@ -398,8 +557,8 @@ public partial class RAEC_Attack : BmSDK.BmGame.RAEC_Attack_Base, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bAttackStarted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 2; else *(int*)(Ptr + 484) &= ~2; }
     }
 
     /// <summary>
@@ -407,8 +566,8 @@ public partial class RAEC_Attack : BmSDK.BmGame.RAEC_Attack_Base, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bVantageEscapePlayed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 4; else *(int*)(Ptr + 484) &= ~4; }
     }
 
     /// <summary>
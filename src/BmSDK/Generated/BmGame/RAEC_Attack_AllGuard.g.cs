@@ -78,16 +78,30 @@ public partial class RAEC_Attack_AllGuard : BmSDK.BmGame.RAEC_Attack_Base, BmSDK
         where TComponent : class, Framework.IScriptComponent<RAEC_Attack_AllGuard>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CreateSmokeAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CreateSmokeAEC_Params
+    {
+        [FieldOffset(0)] public nint NewSmokeScreen;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateSmokeAEC
     /// </summary>
     public unsafe override BmSDK.BmGame.RAEC_Attack_Smoke CreateSmokeAEC(BmSDK.BmGame.RSmokeScreen NewSmokeScreen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.CreateSmokeAEC", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSmokeScreen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAEC_Attack_Smoke>(paramsPtr + 4);
+        var funcManaged = s_CreateSmokeAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.CreateSmokeAEC", true);
+        var parms = new CreateSmokeAEC_Params();
+        parms.NewSmokeScreen = NewSmokeScreen?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RAEC_Attack_Smoke)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_BatmanVantageEscapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BatmanVantageEscape_Params
+    {
     }
 
     /// <summary>
@@ -95,36 +109,61 @@ public partial class RAEC_Attack_AllGuard : BmSDK.BmGame.RAEC_Attack_Base, BmSDK
     /// </summary>
     public unsafe override void BatmanVantageEscape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.BatmanVantageEscape", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanVantageEscapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.BatmanVantageEscape", true);
+        var parms = new BatmanVantageEscape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugEscapedTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ThugEscapedTakedown_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: ThugEscapedTakedown
     /// </summary>
     public unsafe override void ThugEscapedTakedown(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.ThugEscapedTakedown", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugEscapedTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.ThugEscapedTakedown", true);
+        var parms = new ThugEscapedTakedown_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleGadgetImpactNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct HandleGadgetImpactNoise_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(24)] public float ReactRange;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HandleGadgetImpactNoise
     /// </summary>
     public unsafe override bool HandleGadgetImpactNoise(System.Numerics.Vector3 HitLoc, System.Numerics.Vector3 ThrownFromPos, float ReactRange)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.HandleGadgetImpactNoise", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ReactRange, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_HandleGadgetImpactNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.HandleGadgetImpactNoise", true);
+        var parms = new HandleGadgetImpactNoise_Params();
+        parms.HitLoc = HitLoc;
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.ReactRange = ReactRange;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AddAttackerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AddAttacker_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+        [FieldOffset(4)] public int bPlaySpottedLine;
     }
 
     /// <summary>
@@ -132,71 +171,113 @@ public partial class RAEC_Attack_AllGuard : BmSDK.BmGame.RAEC_Attack_Base, BmSDK
     /// </summary>
     public unsafe override void AddAttacker(BmSDK.BmGame.RBMAIController NewMember, bool bPlaySpottedLine = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.AddAttacker", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlaySpottedLine, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddAttackerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.AddAttacker", true);
+        var parms = new AddAttacker_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        parms.bPlaySpottedLine = bPlaySpottedLine ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AlertAndAddAttackerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AlertAndAddAttacker_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: AlertAndAddAttacker
     /// </summary>
     public unsafe override void AlertAndAddAttacker(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.AlertAndAddAttacker", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AlertAndAddAttackerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.AlertAndAddAttacker", true);
+        var parms = new AlertAndAddAttacker_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugSawPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ThugSawPlayer_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: ThugSawPlayer
     /// </summary>
     public unsafe override void ThugSawPlayer(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.ThugSawPlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugSawPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.ThugSawPlayer", true);
+        var parms = new ThugSawPlayer_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceStartAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForceStartAttack_Params
+    {
+        [FieldOffset(0)] public int bForceRestart;
+    }
+
     /// <summary>
     /// Function: ForceStartAttack
     /// </summary>
     public unsafe override void ForceStartAttack(bool bForceRestart = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.ForceStartAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceRestart, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceStartAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.ForceStartAttack", true);
+        var parms = new ForceStartAttack_Params();
+        parms.bForceRestart = bForceRestart ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IndirectAlertTriggeredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IndirectAlertTriggered_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 AlertLoc;
+    }
+
     /// <summary>
     /// Function: IndirectAlertTriggered
     /// </summary>
     public unsafe override void IndirectAlertTriggered(System.Numerics.Vector3 AlertLoc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.IndirectAlertTriggered", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AlertLoc, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IndirectAlertTriggeredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.IndirectAlertTriggered", true);
+        var parms = new IndirectAlertTriggered_Params();
+        parms.AlertLoc = AlertLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AreAttackersActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AreAttackersActive_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameRI.EPredAttackState ReturnValue;
+    }
+
     /// <summary>
     /// Function: AreAttackersActive
     /// </summary>
     public unsafe override BmSDK.BmGame.RGameRI.EPredAttackState AreAttackersActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.AreAttackersActive", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameRI.EPredAttackState>(paramsPtr + 0);
+        var funcManaged = s_AreAttackersActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.AreAttackersActive", true);
+        var parms = new AreAttackersActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_RemoveChildFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RemoveChild_Params
+    {
+        [FieldOffset(0)] public nint RemAEC;
     }
 
     /// <summary>
@@ -204,10 +285,10 @@ public partial class RAEC_Attack_AllGuard : BmSDK.BmGame.RAEC_Attack_Base, BmSDK
     /// </summary>
     public unsafe override void RemoveChild(BmSDK.BmGame.RAlertEventCoordinatorBase RemAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.RemoveChild", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RemAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveChildFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_AllGuard.RemoveChild", true);
+        var parms = new RemoveChild_Params();
+        parms.RemAEC = RemAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -78,16 +78,30 @@ public partial class RAEC_Attack_Base : BmSDK.BmGame.RAlertEventCoordinatorBase,
         where TComponent : class, Framework.IScriptComponent<RAEC_Attack_Base>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CreateSmokeAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CreateSmokeAEC_Params
+    {
+        [FieldOffset(0)] public nint NewSmokeScreen;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateSmokeAEC
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RAEC_Attack_Smoke CreateSmokeAEC(BmSDK.BmGame.RSmokeScreen NewSmokeScreen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.CreateSmokeAEC", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSmokeScreen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAEC_Attack_Smoke>(paramsPtr + 4);
+        var funcManaged = s_CreateSmokeAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.CreateSmokeAEC", true);
+        var parms = new CreateSmokeAEC_Params();
+        parms.NewSmokeScreen = NewSmokeScreen?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RAEC_Attack_Smoke)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_PlayerDeadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayerDead_Params
+    {
     }
 
     /// <summary>
@@ -95,59 +109,97 @@ public partial class RAEC_Attack_Base : BmSDK.BmGame.RAlertEventCoordinatorBase,
     /// </summary>
     public unsafe virtual void PlayerDead()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.PlayerDead", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerDeadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.PlayerDead", true);
+        var parms = new PlayerDead_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpecialMoveEndNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SpecialMoveEndNotify_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 NotifyLoc;
+    }
+
     /// <summary>
     /// Function: SpecialMoveEndNotify
     /// </summary>
     public unsafe virtual void SpecialMoveEndNotify(System.Numerics.Vector3 NotifyLoc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.SpecialMoveEndNotify", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotifyLoc, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpecialMoveEndNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.SpecialMoveEndNotify", true);
+        var parms = new SpecialMoveEndNotify_Params();
+        parms.NotifyLoc = NotifyLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanVantageEscapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BatmanVantageEscape_Params
+    {
+    }
+
     /// <summary>
     /// Function: BatmanVantageEscape
     /// </summary>
     public unsafe virtual void BatmanVantageEscape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.BatmanVantageEscape", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanVantageEscapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.BatmanVantageEscape", true);
+        var parms = new BatmanVantageEscape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugEscapedTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ThugEscapedTakedown_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: ThugEscapedTakedown
     /// </summary>
     public unsafe virtual void ThugEscapedTakedown(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.ThugEscapedTakedown", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugEscapedTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.ThugEscapedTakedown", true);
+        var parms = new ThugEscapedTakedown_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleGadgetImpactNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct HandleGadgetImpactNoise_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(24)] public float ReactRange;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HandleGadgetImpactNoise
     /// </summary>
     public unsafe virtual bool HandleGadgetImpactNoise(System.Numerics.Vector3 HitLoc, System.Numerics.Vector3 ThrownFromPos, float ReactRange)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.HandleGadgetImpactNoise", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ReactRange, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_HandleGadgetImpactNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.HandleGadgetImpactNoise", true);
+        var parms = new HandleGadgetImpactNoise_Params();
+        parms.HitLoc = HitLoc;
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.ReactRange = ReactRange;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AddAttackerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AddAttacker_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+        [FieldOffset(4)] public int bPlaySpottedLine;
     }
 
     /// <summary>
@@ -155,82 +207,130 @@ public partial class RAEC_Attack_Base : BmSDK.BmGame.RAlertEventCoordinatorBase,
     /// </summary>
     public unsafe virtual void AddAttacker(BmSDK.BmGame.RBMAIController NewMember, bool bPlaySpottedLine = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.AddAttacker", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlaySpottedLine, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddAttackerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.AddAttacker", true);
+        var parms = new AddAttacker_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        parms.bPlaySpottedLine = bPlaySpottedLine ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AlertAndAddAttackerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AlertAndAddAttacker_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: AlertAndAddAttacker
     /// </summary>
     public unsafe virtual void AlertAndAddAttacker(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.AlertAndAddAttacker", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AlertAndAddAttackerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.AlertAndAddAttacker", true);
+        var parms = new AlertAndAddAttacker_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugSawPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ThugSawPlayer_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: ThugSawPlayer
     /// </summary>
     public unsafe virtual void ThugSawPlayer(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.ThugSawPlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugSawPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.ThugSawPlayer", true);
+        var parms = new ThugSawPlayer_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceNearbyAttackLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ForceNearbyAttackLook_Params
+    {
+    }
+
     /// <summary>
     /// Function: ForceNearbyAttackLook
     /// </summary>
     public unsafe virtual void ForceNearbyAttackLook()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.ForceNearbyAttackLook", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceNearbyAttackLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.ForceNearbyAttackLook", true);
+        var parms = new ForceNearbyAttackLook_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceStartAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForceStartAttack_Params
+    {
+        [FieldOffset(0)] public int bForceRestart;
+    }
+
     /// <summary>
     /// Function: ForceStartAttack
     /// </summary>
     public unsafe virtual void ForceStartAttack(bool bForceRestart = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.ForceStartAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceRestart, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceStartAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.ForceStartAttack", true);
+        var parms = new ForceStartAttack_Params();
+        parms.bForceRestart = bForceRestart ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IndirectAlertTriggeredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IndirectAlertTriggered_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 AlertLoc;
+    }
+
     /// <summary>
     /// Function: IndirectAlertTriggered
     /// </summary>
     public unsafe virtual void IndirectAlertTriggered(System.Numerics.Vector3 AlertLoc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.IndirectAlertTriggered", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AlertLoc, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IndirectAlertTriggeredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.IndirectAlertTriggered", true);
+        var parms = new IndirectAlertTriggered_Params();
+        parms.AlertLoc = AlertLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AreAttackersActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct AreAttackersActive_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameRI.EPredAttackState ReturnValue;
+    }
+
     /// <summary>
     /// Function: AreAttackersActive
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RGameRI.EPredAttackState AreAttackersActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.AreAttackersActive", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameRI.EPredAttackState>(paramsPtr + 0);
+        var funcManaged = s_AreAttackersActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.AreAttackersActive", true);
+        var parms = new AreAttackersActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UnregisterGuardAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnregisterGuardAEC_Params
+    {
+        [FieldOffset(0)] public nint ExGuardAEC;
     }
 
     /// <summary>
@@ -238,68 +338,100 @@ public partial class RAEC_Attack_Base : BmSDK.BmGame.RAlertEventCoordinatorBase,
     /// </summary>
     public unsafe virtual void UnregisterGuardAEC(BmSDK.BmGame.RAEC_Search_Sub_Guard ExGuardAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.UnregisterGuardAEC", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExGuardAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterGuardAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.UnregisterGuardAEC", true);
+        var parms = new UnregisterGuardAEC_Params();
+        parms.ExGuardAEC = ExGuardAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterGuardAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RegisterGuardAEC_Params
+    {
+        [FieldOffset(0)] public nint NewGuardAEC;
+    }
+
     /// <summary>
     /// Function: RegisterGuardAEC
     /// </summary>
     public unsafe virtual void RegisterGuardAEC(BmSDK.BmGame.RAEC_Search_Sub_Guard NewGuardAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.RegisterGuardAEC", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGuardAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterGuardAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.RegisterGuardAEC", true);
+        var parms = new RegisterGuardAEC_Params();
+        parms.NewGuardAEC = NewGuardAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetThoughtsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetThoughts_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetThoughts
     /// </summary>
     public unsafe override void GetThoughts(out BmSDK.TArray<BmSDK.Engine.Actor.FThought> ThoughtList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.GetThoughts", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>(paramsPtr + 0);
+        var funcManaged = s_GetThoughtsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.GetThoughts", true);
+        var parms = new GetThoughts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_TargetPlayerUpdatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TargetPlayerUpdated_Params
+    {
+    }
+
     /// <summary>
     /// Function: TargetPlayerUpdated
     /// </summary>
     public unsafe virtual void TargetPlayerUpdated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.TargetPlayerUpdated", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TargetPlayerUpdatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.TargetPlayerUpdated", true);
+        var parms = new TargetPlayerUpdated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitForPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitForPlayer_Params
+    {
+        [FieldOffset(0)] public nint NewTargetPlayer;
+    }
+
     /// <summary>
     /// Function: InitForPlayer
     /// </summary>
     public unsafe virtual void InitForPlayer(BmSDK.BmGame.RPawnPlayer NewTargetPlayer)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.InitForPlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTargetPlayer, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitForPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.InitForPlayer", true);
+        var parms = new InitForPlayer_Params();
+        parms.NewTargetPlayer = NewTargetPlayer?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateChildrenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CreateChildren_Params
+    {
+    }
+
     /// <summary>
     /// Function: CreateChildren
     /// </summary>
     public unsafe virtual void CreateChildren()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.CreateChildren", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CreateChildrenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Base.CreateChildren", true);
+        var parms = new CreateChildren_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
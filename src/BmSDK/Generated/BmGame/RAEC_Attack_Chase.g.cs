@@ -78,18 +78,34 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
         where TComponent : class, Framework.IScriptComponent<RAEC_Attack_Chase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetFenceNodeLockForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetFenceNodeLockFor_Params
+    {
+        [FieldOffset(0)] public nint TestCon;
+        [FieldOffset(4)] public nint TargetNode;
+        [FieldOffset(8)] public System.Numerics.Vector3 LockPos;
+        [FieldOffset(20)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetFenceNodeLockFor
     /// </summary>
     public unsafe virtual bool GetFenceNodeLockFor(BmSDK.BmGame.RBMAIController TestCon, BmSDK.BmGame.RBMPathNode_FenceJumpProxy TargetNode, System.Numerics.Vector3 LockPos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetFenceNodeLockFor", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestCon, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetNode, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LockPos, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 20);
+        var funcManaged = s_GetFenceNodeLockForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetFenceNodeLockFor", true);
+        var parms = new GetFenceNodeLockFor_Params();
+        parms.TestCon = TestCon?.Ptr ?? 0;
+        parms.TargetNode = TargetNode?.Ptr ?? 0;
+        parms.LockPos = LockPos;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DoChaseInProgressBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DoChaseInProgressBark_Params
+    {
     }
 
     /// <summary>
@@ -97,44 +113,73 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual void DoChaseInProgressBark()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.DoChaseInProgressBark", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoChaseInProgressBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.DoChaseInProgressBark", true);
+        var parms = new DoChaseInProgressBark_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopDistantRunnersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StopDistantRunners_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopDistantRunners
     /// </summary>
     public unsafe virtual void StopDistantRunners()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.StopDistantRunners", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopDistantRunnersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.StopDistantRunners", true);
+        var parms = new StopDistantRunners_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DropPriorityDueToVantageEscapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DropPriorityDueToVantageEscape_Params
+    {
+    }
+
     /// <summary>
     /// Function: DropPriorityDueToVantageEscape
     /// </summary>
     public unsafe virtual void DropPriorityDueToVantageEscape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.DropPriorityDueToVantageEscape", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DropPriorityDueToVantageEscapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.DropPriorityDueToVantageEscape", true);
+        var parms = new DropPriorityDueToVantageEscape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateSmokeAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CreateSmokeAEC_Params
+    {
+        [FieldOffset(0)] public nint NewSmokeScreen;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateSmokeAEC
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RAEC_Attack_Smoke CreateSmokeAEC(BmSDK.BmGame.RSmokeScreen NewSmokeScreen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.CreateSmokeAEC", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSmokeScreen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAEC_Attack_Smoke>(paramsPtr + 4);
+        var funcManaged = s_CreateSmokeAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.CreateSmokeAEC", true);
+        var parms = new CreateSmokeAEC_Params();
+        parms.NewSmokeScreen = NewSmokeScreen?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RAEC_Attack_Smoke)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_AreOtherPawnsInRadiusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct AreOtherPawnsInRadius_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ExplodePoint;
+        [FieldOffset(12)] public float ExplodeRadius;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -142,12 +187,20 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool AreOtherPawnsInRadius(System.Numerics.Vector3 ExplodePoint, float ExplodeRadius)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.AreOtherPawnsInRadius", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExplodePoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExplodeRadius, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_AreOtherPawnsInRadiusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.AreOtherPawnsInRadius", true);
+        var parms = new AreOtherPawnsInRadius_Params();
+        parms.ExplodePoint = ExplodePoint;
+        parms.ExplodeRadius = ExplodeRadius;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsSafeToThrowGrenadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct IsSafeToThrowGrenade_Params
+    {
+        [FieldOffset(0)] public float ShortestDistToRunToTarget;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -155,11 +208,19 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool IsSafeToThrowGrenade(float ShortestDistToRunToTarget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.IsSafeToThrowGrenade", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ShortestDistToRunToTarget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsSafeToThrowGrenadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.IsSafeToThrowGrenade", true);
+        var parms = new IsSafeToThrowGrenade_Params();
+        parms.ShortestDistToRunToTarget = ShortestDistToRunToTarget;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryAssignVentThrowerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct TryAssignVentThrower_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 NewChasePos;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -167,11 +228,18 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool TryAssignVentThrower(out System.Numerics.Vector3 NewChasePos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.TryAssignVentThrower", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        NewChasePos = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_TryAssignVentThrowerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.TryAssignVentThrower", true);
+        var parms = new TryAssignVentThrower_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        NewChasePos = parms.NewChasePos;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FindTunnelFunnelToGrenadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FindTunnelFunnelToGrenade_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -179,10 +247,17 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RTunnelFunnel FindTunnelFunnelToGrenade()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FindTunnelFunnelToGrenade", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RTunnelFunnel>(paramsPtr + 0);
+        var funcManaged = s_FindTunnelFunnelToGrenadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FindTunnelFunnelToGrenade", true);
+        var parms = new FindTunnelFunnelToGrenade_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RTunnelFunnel)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_TryGrenadeThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct TryGrenadeThrow_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -190,10 +265,17 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool TryGrenadeThrow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.TryGrenadeThrow", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_TryGrenadeThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.TryGrenadeThrow", true);
+        var parms = new TryGrenadeThrow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitThugEdgeSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitThugEdgeSearch_Params
+    {
+        [FieldOffset(0)] public int TS_j;
     }
 
     /// <summary>
@@ -201,48 +283,79 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual void InitThugEdgeSearch(int TS_j)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitThugEdgeSearch", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TS_j, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitThugEdgeSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitThugEdgeSearch", true);
+        var parms = new InitThugEdgeSearch_Params();
+        parms.TS_j = TS_j;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitEdgeSearchMultiNavHandleWrapperFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitEdgeSearchMultiNavHandleWrapper_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitEdgeSearchMultiNavHandleWrapper
     /// </summary>
     public unsafe virtual void InitEdgeSearchMultiNavHandleWrapper()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitEdgeSearchMultiNavHandleWrapper", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitEdgeSearchMultiNavHandleWrapperFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitEdgeSearchMultiNavHandleWrapper", true);
+        var parms = new InitEdgeSearchMultiNavHandleWrapper_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostLadderChaseAssignFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PostLadderChaseAssign_Params
+    {
+        [FieldOffset(0)] public nint C;
+    }
+
     /// <summary>
     /// Function: PostLadderChaseAssign
     /// </summary>
     public unsafe virtual void PostLadderChaseAssign(BmSDK.BmGame.RBMAIController C)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.PostLadderChaseAssign", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(C, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostLadderChaseAssignFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.PostLadderChaseAssign", true);
+        var parms = new PostLadderChaseAssign_Params();
+        parms.C = C?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetBestPushPastRootChildFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetBestPushPastRootChild_Params
+    {
+        [FieldOffset(0)] public nint TestChasePoint;
+        [FieldOffset(4)] public float TargetDepth;
+        [FieldOffset(8)] public float DepthSoFar;
+        [FieldOffset(12)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetBestPushPastRootChild
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RChasePoint GetBestPushPastRootChild(BmSDK.BmGame.RChasePoint TestChasePoint, float TargetDepth, float DepthSoFar)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetBestPushPastRootChild", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestChasePoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetDepth, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DepthSoFar, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChasePoint>(paramsPtr + 12);
+        var funcManaged = s_GetBestPushPastRootChildFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetBestPushPastRootChild", true);
+        var parms = new GetBestPushPastRootChild_Params();
+        parms.TestChasePoint = TestChasePoint?.Ptr ?? 0;
+        parms.TargetDepth = TargetDepth;
+        parms.DepthSoFar = DepthSoFar;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RChasePoint)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_MarkAssignedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct MarkAssigned_Params
+    {
+        [FieldOffset(0)] public nint LatestChildChasePoint;
+        [FieldOffset(4)] public nint AlreadyDoneChasePoint;
     }
 
     /// <summary>
@@ -250,116 +363,185 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual void MarkAssigned(BmSDK.BmGame.RChasePoint LatestChildChasePoint, BmSDK.BmGame.RChasePoint AlreadyDoneChasePoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.MarkAssigned", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LatestChildChasePoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AlreadyDoneChasePoint, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MarkAssignedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.MarkAssigned", true);
+        var parms = new MarkAssigned_Params();
+        parms.LatestChildChasePoint = LatestChildChasePoint?.Ptr ?? 0;
+        parms.AlreadyDoneChasePoint = AlreadyDoneChasePoint?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitChaserFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct InitChaser_Params
+    {
+        [FieldOffset(0)] public nint C;
+        [FieldOffset(4)] public int bForceThroughChaseRoot;
+        [FieldOffset(8)] public float RootDist;
+    }
+
     /// <summary>
     /// Function: InitChaser
     /// </summary>
     public unsafe virtual void InitChaser(BmSDK.BmGame.RBMAIController C, bool bForceThroughChaseRoot = default, float RootDist = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitChaser", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(C, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceThroughChaseRoot, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RootDist, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitChaserFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitChaser", true);
+        var parms = new InitChaser_Params();
+        parms.C = C?.Ptr ?? 0;
+        parms.bForceThroughChaseRoot = bForceThroughChaseRoot ? 1 : 0;
+        parms.RootDist = RootDist;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearChaseSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearChaseSearch_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearChaseSearch
     /// </summary>
     public unsafe virtual void ClearChaseSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearChaseSearch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearChaseSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearChaseSearch", true);
+        var parms = new ClearChaseSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearThugEdgeRequestsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearThugEdgeRequests_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearThugEdgeRequests
     /// </summary>
     public unsafe virtual void ClearThugEdgeRequests()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearThugEdgeRequests", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearThugEdgeRequestsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearThugEdgeRequests", true);
+        var parms = new ClearThugEdgeRequests_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearEdgeSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearEdgeSearch_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearEdgeSearch
     /// </summary>
     public unsafe virtual void ClearEdgeSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearEdgeSearch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearEdgeSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearEdgeSearch", true);
+        var parms = new ClearEdgeSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearGrenVentRequestsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearGrenVentRequests_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearGrenVentRequests
     /// </summary>
     public unsafe virtual void ClearGrenVentRequests()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearGrenVentRequests", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearGrenVentRequestsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearGrenVentRequests", true);
+        var parms = new ClearGrenVentRequests_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearChaseRootRequestsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearChaseRootRequests_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearChaseRootRequests
     /// </summary>
     public unsafe virtual void ClearChaseRootRequests()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearChaseRootRequests", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearChaseRootRequestsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearChaseRootRequests", true);
+        var parms = new ClearChaseRootRequests_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearAllNavRequestsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearAllNavRequests_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearAllNavRequests
     /// </summary>
     public unsafe virtual void ClearAllNavRequests()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearAllNavRequests", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearAllNavRequestsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ClearAllNavRequests", true);
+        var parms = new ClearAllNavRequests_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishChaseForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct FinishChaseFor_Params
+    {
+        [FieldOffset(0)] public nint FinishedSub;
+    }
+
     /// <summary>
     /// Function: FinishChaseFor
     /// </summary>
     public unsafe virtual void FinishChaseFor(BmSDK.BmGame.RAEC_Attack_Sub_Chase FinishedSub)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FinishChaseFor", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishedSub, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishChaseForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FinishChaseFor", true);
+        var parms = new FinishChaseFor_Params();
+        parms.FinishedSub = FinishedSub?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindInterceptMeetFollowerChasePointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FindInterceptMeetFollowerChasePoint_Params
+    {
+        [FieldOffset(0)] public nint TestCP;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: FindInterceptMeetFollowerChasePoint
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RChasePoint FindInterceptMeetFollowerChasePoint(BmSDK.BmGame.RChasePoint TestCP)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FindInterceptMeetFollowerChasePoint", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestCP, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChasePoint>(paramsPtr + 4);
+        var funcManaged = s_FindInterceptMeetFollowerChasePointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FindInterceptMeetFollowerChasePoint", true);
+        var parms = new FindInterceptMeetFollowerChasePoint_Params();
+        parms.TestCP = TestCP?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RChasePoint)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_FindBestChildChasePointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct FindBestChildChasePoint_Params
+    {
+        [FieldOffset(0)] public nint Arrivee;
+        [FieldOffset(4)] public nint TestCP;
+        [FieldOffset(8)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -367,12 +549,21 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RChasePoint FindBestChildChasePoint(BmSDK.BmGame.RAEC_Attack_Sub_Chase Arrivee, BmSDK.BmGame.RChasePoint TestCP)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FindBestChildChasePoint", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Arrivee, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestCP, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChasePoint>(paramsPtr + 8);
+        var funcManaged = s_FindBestChildChasePointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FindBestChildChasePoint", true);
+        var parms = new FindBestChildChasePoint_Params();
+        parms.Arrivee = Arrivee?.Ptr ?? 0;
+        parms.TestCP = TestCP?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RChasePoint)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetScoreForBranchPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct GetScoreForBranchPoint_Params
+    {
+        [FieldOffset(0)] public nint Arrivee;
+        [FieldOffset(4)] public nint TestCP;
+        [FieldOffset(8)] public float ReturnValue;
     }
 
     /// <summary>
@@ -380,12 +571,21 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual float GetScoreForBranchPoint(BmSDK.BmGame.RAEC_Attack_Sub_Chase Arrivee, BmSDK.BmGame.RChasePoint TestCP)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetScoreForBranchPoint", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Arrivee, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestCP, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_GetScoreForBranchPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetScoreForBranchPoint", true);
+        var parms = new GetScoreForBranchPoint_Params();
+        parms.Arrivee = Arrivee?.Ptr ?? 0;
+        parms.TestCP = TestCP?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNextChasePointForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetNextChasePointFor_Params
+    {
+        [FieldOffset(0)] public nint Arrivee;
+        [FieldOffset(4)] public nint NextChasePoint;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -393,12 +593,18 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool GetNextChasePointFor(BmSDK.BmGame.RAEC_Attack_Sub_Chase Arrivee, out BmSDK.BmGame.RChasePoint NextChasePoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetNextChasePointFor", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Arrivee, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        NextChasePoint = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChasePoint>(paramsPtr + 4);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_GetNextChasePointForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetNextChasePointFor", true);
+        var parms = new GetNextChasePointFor_Params();
+        parms.Arrivee = Arrivee?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        NextChasePoint = parms.NextChasePoint == 0 ? null : (BmSDK.BmGame.RChasePoint)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.NextChasePoint);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitUnreachableChaseHandlingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitUnreachableChaseHandling_Params
+    {
     }
 
     /// <summary>
@@ -406,124 +612,195 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual void InitUnreachableChaseHandling()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitUnreachableChaseHandling", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitUnreachableChaseHandlingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitUnreachableChaseHandling", true);
+        var parms = new InitUnreachableChaseHandling_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CullBranchesHeadingAwayFromPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CullBranchesHeadingAwayFromPlayer_Params
+    {
+    }
+
     /// <summary>
     /// Function: CullBranchesHeadingAwayFromPlayer
     /// </summary>
     public unsafe virtual void CullBranchesHeadingAwayFromPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.CullBranchesHeadingAwayFromPlayer", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CullBranchesHeadingAwayFromPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.CullBranchesHeadingAwayFromPlayer", true);
+        var parms = new CullBranchesHeadingAwayFromPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChaseSearchFailedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ChaseSearchFailed_Params
+    {
+        [FieldOffset(0)] public nint CompletedSearch;
+    }
+
     /// <summary>
     /// Function: ChaseSearchFailed
     /// </summary>
     public unsafe virtual void ChaseSearchFailed(BmSDK.BmGame.RChaseLocationSearch CompletedSearch)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ChaseSearchFailed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CompletedSearch, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChaseSearchFailedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ChaseSearchFailed", true);
+        var parms = new ChaseSearchFailed_Params();
+        parms.CompletedSearch = CompletedSearch?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChaseSearchDoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ChaseSearchDone_Params
+    {
+        [FieldOffset(0)] public nint CompletedSearch;
+    }
+
     /// <summary>
     /// Function: ChaseSearchDone
     /// </summary>
     public unsafe virtual void ChaseSearchDone(BmSDK.BmGame.RChaseLocationSearch CompletedSearch)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ChaseSearchDone", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CompletedSearch, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChaseSearchDoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ChaseSearchDone", true);
+        var parms = new ChaseSearchDone_Params();
+        parms.CompletedSearch = CompletedSearch?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChaseFailAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ChaseFailAlert_Params
+    {
+    }
+
     /// <summary>
     /// Function: ChaseFailAlert
     /// </summary>
     public unsafe virtual void ChaseFailAlert()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ChaseFailAlert", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChaseFailAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.ChaseFailAlert", true);
+        var parms = new ChaseFailAlert_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitVentPathSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct InitVentPathSearch_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitVentPathSearch
     /// </summary>
     public unsafe virtual void InitVentPathSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitVentPathSearch", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitVentPathSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitVentPathSearch", true);
+        var parms = new InitVentPathSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitChaseRootSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitChaseRootSearch_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitChaseRootSearch
     /// </summary>
     public unsafe virtual void InitChaseRootSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitChaseRootSearch", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitChaseRootSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitChaseRootSearch", true);
+        var parms = new InitChaseRootSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindOverLookFencesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 92)]
+    private struct FindOverLookFences_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 EstimatedPlayerPos;
+    }
+
     /// <summary>
     /// Function: FindOverLookFences
     /// </summary>
     public unsafe virtual void FindOverLookFences(System.Numerics.Vector3 EstimatedPlayerPos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FindOverLookFences", true);
-        byte* paramsPtr = stackalloc byte[92];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EstimatedPlayerPos, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FindOverLookFencesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.FindOverLookFences", true);
+        var parms = new FindOverLookFences_Params();
+        parms.EstimatedPlayerPos = EstimatedPlayerPos;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitEdgeWatchFinderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct InitEdgeWatchFinder_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitEdgeWatchFinder
     /// </summary>
     public unsafe virtual void InitEdgeWatchFinder()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitEdgeWatchFinder", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitEdgeWatchFinderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitEdgeWatchFinder", true);
+        var parms = new InitEdgeWatchFinder_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitChaseTreeFinderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitChaseTreeFinder_Params
+    {
+        [FieldOffset(0)] public nint DangerLadder;
+    }
+
     /// <summary>
     /// Function: InitChaseTreeFinder
     /// </summary>
     public unsafe virtual void InitChaseTreeFinder(BmSDK.BmGame.RLadder DangerLadder = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitChaseTreeFinder", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DangerLadder, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitChaseTreeFinderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitChaseTreeFinder", true);
+        var parms = new InitChaseTreeFinder_Params();
+        parms.DangerLadder = DangerLadder?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetDangerLadderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDangerLadder_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetDangerLadder
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RLadder GetDangerLadder()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetDangerLadder", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RLadder>(paramsPtr + 0);
+        var funcManaged = s_GetDangerLadderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetDangerLadder", true);
+        var parms = new GetDangerLadder_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RLadder)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_InitCeilingWatchAndWaitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct InitCeilingWatchAndWait_Params
+    {
     }
 
     /// <summary>
@@ -531,80 +808,127 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe virtual void InitCeilingWatchAndWait()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitCeilingWatchAndWait", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitCeilingWatchAndWaitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.InitCeilingWatchAndWait", true);
+        var parms = new InitCeilingWatchAndWait_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PrepChaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PrepChase_Params
+    {
+    }
+
     /// <summary>
     /// Function: PrepChase
     /// </summary>
     public unsafe virtual void PrepChase()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.PrepChase", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PrepChaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.PrepChase", true);
+        var parms = new PrepChase_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryDrawChaseStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TryDrawChaseState_Params
+    {
+    }
+
     /// <summary>
     /// Function: TryDrawChaseState
     /// </summary>
     public unsafe virtual void TryDrawChaseState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.TryDrawChaseState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TryDrawChaseStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.TryDrawChaseState", true);
+        var parms = new TryDrawChaseState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct NotifyFinished_Params
+    {
+        [FieldOffset(0)] public nint FinishedCon;
+        [FieldOffset(4)] public nint FinishedAction;
+    }
+
     /// <summary>
     /// Function: NotifyFinished
     /// </summary>
     public unsafe override void NotifyFinished(BmSDK.BmGame.RBMAIController FinishedCon, BmSDK.BmGame.RBMAIAction FinishedAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.NotifyFinished", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishedCon, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishedAction, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.NotifyFinished", true);
+        var parms = new NotifyFinished_Params();
+        parms.FinishedCon = FinishedCon?.Ptr ?? 0;
+        parms.FinishedAction = FinishedAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_VillainStolenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct VillainStolen_Params
+    {
+        [FieldOffset(0)] public nint Stolen;
+    }
+
     /// <summary>
     /// Function: VillainStolen
     /// </summary>
     public unsafe override void VillainStolen(BmSDK.BmGame.RBMAIController Stolen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.VillainStolen", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Stolen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_VillainStolenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.VillainStolen", true);
+        var parms = new VillainStolen_Params();
+        parms.Stolen = Stolen?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetThoughtsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetThoughts_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetThoughts
     /// </summary>
     public unsafe override void GetThoughts(out BmSDK.TArray<BmSDK.Engine.Actor.FThought> ThoughtList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetThoughts", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>(paramsPtr + 0);
+        var funcManaged = s_GetThoughtsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.GetThoughts", true);
+        var parms = new GetThoughts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_AreAttackersActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AreAttackersActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AreAttackersActive
     /// </summary>
     public unsafe virtual bool AreAttackersActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.AreAttackersActive", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AreAttackersActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.AreAttackersActive", true);
+        var parms = new AreAttackersActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RemoveChildFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RemoveChild_Params
+    {
+        [FieldOffset(0)] public nint RemAEC;
     }
 
     /// <summary>
@@ -612,44 +936,63 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe override void RemoveChild(BmSDK.BmGame.RAlertEventCoordinatorBase RemAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.RemoveChild", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RemAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveChildFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.RemoveChild", true);
+        var parms = new RemoveChild_Params();
+        parms.RemAEC = RemAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreStreamOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreStreamOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreStreamOut
     /// </summary>
     public unsafe override void PreStreamOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.PreStreamOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreStreamOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.PreStreamOut", true);
+        var parms = new PreStreamOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTargetPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetTargetPlayer_Params
+    {
+        [FieldOffset(0)] public nint NewTargetPlayer;
+    }
+
     /// <summary>
     /// Function: SetTargetPlayer
     /// </summary>
     public unsafe virtual void SetTargetPlayer(BmSDK.BmGame.RPawnPlayer NewTargetPlayer)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.SetTargetPlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTargetPlayer, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTargetPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.SetTargetPlayer", true);
+        var parms = new SetTargetPlayer_Params();
+        parms.NewTargetPlayer = NewTargetPlayer?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Chase.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -667,8 +1010,8 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe bool bChasingFromSighting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 456); }
+        get { return (*(int*)(Ptr + 456) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 456) |= 1; else *(int*)(Ptr + 456) &= ~1; }
     }
 
     /// <summary>
@@ -676,8 +1019,8 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe bool bChaseTreeReady
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 456); }
+        get { return (*(int*)(Ptr + 456) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 456) |= 2; else *(int*)(Ptr + 456) &= ~2; }
     }
 
     /// <summary>
@@ -685,8 +1028,8 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe bool bChaseTreeGood
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 456); }
+        get { return (*(int*)(Ptr + 456) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 456) |= 4; else *(int*)(Ptr + 456) &= ~4; }
     }
 
     /// <summary>
@@ -694,8 +1037,8 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe bool bChaseAfterGrenade
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 456); }
+        get { return (*(int*)(Ptr + 456) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 456) |= 8; else *(int*)(Ptr + 456) &= ~8; }
     }
 
     /// <summary>
@@ -781,8 +1124,8 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe int ThugEdgeSearchIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }
+        get { return *(int*)(Ptr + 536); }
+        set { *(int*)(Ptr + 536) = value; }
     }
 
     /// <summary>
@@ -817,7 +1160,7 @@ public partial class RAEC_Attack_Chase : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IGame
     /// </summary>
     public unsafe float LastChaseEndTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 560); }
+        get { return *(float*)(Ptr + 560); }
+        set { *(float*)(Ptr + 560) = value; }
     }
 }
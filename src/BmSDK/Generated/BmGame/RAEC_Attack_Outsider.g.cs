@@ -78,37 +78,62 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
         where TComponent : class, Framework.IScriptComponent<RAEC_Attack_Outsider>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PlayEndBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct PlayEndBark_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayEndBark
     /// </summary>
     public unsafe virtual void PlayEndBark()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.PlayEndBark", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayEndBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.PlayEndBark", true);
+        var parms = new PlayEndBark_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DropPriorityAsSmokeClearedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DropPriorityAsSmokeCleared_Params
+    {
+    }
+
     /// <summary>
     /// Function: DropPriorityAsSmokeCleared
     /// </summary>
     public unsafe virtual void DropPriorityAsSmokeCleared()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.DropPriorityAsSmokeCleared", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DropPriorityAsSmokeClearedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.DropPriorityAsSmokeCleared", true);
+        var parms = new DropPriorityAsSmokeCleared_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AllPerimThugsFinishedShootingAndAtLeastOneIsInPositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct AllPerimThugsFinishedShootingAndAtLeastOneIsInPosition_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AllPerimThugsFinishedShootingAndAtLeastOneIsInPosition
     /// </summary>
     public unsafe virtual bool AllPerimThugsFinishedShootingAndAtLeastOneIsInPosition()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.AllPerimThugsFinishedShootingAndAtLeastOneIsInPosition", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AllPerimThugsFinishedShootingAndAtLeastOneIsInPositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.AllPerimThugsFinishedShootingAndAtLeastOneIsInPosition", true);
+        var parms = new AllPerimThugsFinishedShootingAndAtLeastOneIsInPosition_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitThugSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct InitThugSearch_Params
+    {
     }
 
     /// <summary>
@@ -116,59 +141,99 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe virtual void InitThugSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.InitThugSearch", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitThugSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.InitThugSearch", true);
+        var parms = new InitThugSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPotentialLateJoinerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddPotentialLateJoiner_Params
+    {
+        [FieldOffset(0)] public nint C;
+    }
+
     /// <summary>
     /// Function: AddPotentialLateJoiner
     /// </summary>
     public unsafe virtual void AddPotentialLateJoiner(BmSDK.BmGame.RBMAIController C)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.AddPotentialLateJoiner", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(C, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPotentialLateJoinerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.AddPotentialLateJoiner", true);
+        var parms = new AddPotentialLateJoiner_Params();
+        parms.C = C?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddWatcherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct AddWatcher_Params
+    {
+        [FieldOffset(0)] public nint C;
+        [FieldOffset(4)] public int bCanSeeSmoke;
+    }
+
     /// <summary>
     /// Function: AddWatcher
     /// </summary>
     public unsafe virtual void AddWatcher(BmSDK.BmGame.RBMAIController C, bool bCanSeeSmoke)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.AddWatcher", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(C, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanSeeSmoke, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddWatcherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.AddWatcher", true);
+        var parms = new AddWatcher_Params();
+        parms.C = C?.Ptr ?? 0;
+        parms.bCanSeeSmoke = bCanSeeSmoke ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindPerimStartPosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct FindPerimStartPos_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StartPos;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FindPerimStartPos
     /// </summary>
     public unsafe virtual bool FindPerimStartPos(out System.Numerics.Vector3 StartPos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.FindPerimStartPos", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        StartPos = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_FindPerimStartPosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.FindPerimStartPos", true);
+        var parms = new FindPerimStartPos_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        StartPos = parms.StartPos;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetSmokeScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SetSmokeScreen_Params
+    {
+        [FieldOffset(0)] public nint NewSmokeScreen;
+        [FieldOffset(4)] public int bNewIsExtinguisher;
+        [FieldOffset(8)] public int bNewIsRepeatExtiguisher;
+        [FieldOffset(12)] public int bNewThugsInsideCloud;
     }
 
     /// <summary>
@@ -176,47 +241,65 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe virtual void SetSmokeScreen(BmSDK.BmGame.RSmokeScreen NewSmokeScreen, bool bNewIsExtinguisher, bool bNewIsRepeatExtiguisher, bool bNewThugsInsideCloud)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.SetSmokeScreen", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSmokeScreen, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewIsExtinguisher, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewIsRepeatExtiguisher, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewThugsInsideCloud, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSmokeScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.SetSmokeScreen", true);
+        var parms = new SetSmokeScreen_Params();
+        parms.NewSmokeScreen = NewSmokeScreen?.Ptr ?? 0;
+        parms.bNewIsExtinguisher = bNewIsExtinguisher ? 1 : 0;
+        parms.bNewIsRepeatExtiguisher = bNewIsRepeatExtiguisher ? 1 : 0;
+        parms.bNewThugsInsideCloud = bNewThugsInsideCloud ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearThugSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearThugSearch_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearThugSearch
     /// </summary>
     public unsafe virtual void ClearThugSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.ClearThugSearch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearThugSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.ClearThugSearch", true);
+        var parms = new ClearThugSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetThoughtsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetThoughts_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetThoughts
     /// </summary>
     public unsafe override void GetThoughts(out BmSDK.TArray<BmSDK.Engine.Actor.FThought> ThoughtList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.GetThoughts", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>(paramsPtr + 0);
+        var funcManaged = s_GetThoughtsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.GetThoughts", true);
+        var parms = new GetThoughts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_PreStreamOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreStreamOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreStreamOut
     /// </summary>
     public unsafe override void PreStreamOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.PreStreamOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreStreamOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Attack_Outsider.PreStreamOut", true);
+        var parms = new PreStreamOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -226,13 +309,15 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     [StructLayout(LayoutKind.Explicit, Size = 8)]
     public partial record struct FWatcherSearch
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: bIgnoreIfPathTooLong
         /// </summary>
-        public unsafe bool bIgnoreIfPathTooLong
+        public bool bIgnoreIfPathTooLong
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
@@ -259,8 +344,8 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe float SmokeStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(float*)(Ptr + 456); }
+        set { *(float*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -268,8 +353,8 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe bool bIsExtinguisher
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 460); }
+        get { return (*(int*)(Ptr + 460) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 460) |= 1; else *(int*)(Ptr + 460) &= ~1; }
     }
 
     /// <summary>
@@ -277,8 +362,8 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe bool bIsRepeatExtiguisher
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 460); }
+        get { return (*(int*)(Ptr + 460) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 460) |= 2; else *(int*)(Ptr + 460) &= ~2; }
     }
 
     /// <summary>
@@ -286,8 +371,8 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe bool bHasHadThugOnPerim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 460); }
+        get { return (*(int*)(Ptr + 460) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 460) |= 4; else *(int*)(Ptr + 460) &= ~4; }
     }
 
     /// <summary>
@@ -295,8 +380,8 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe bool bThugsInsideCloud
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 460); }
+        get { return (*(int*)(Ptr + 460) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 460) |= 8; else *(int*)(Ptr + 460) &= ~8; }
     }
 
     /// <summary>
@@ -304,8 +389,8 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe bool bAllPerimThugsAdded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 460); }
+        get { return (*(int*)(Ptr + 460) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 460) |= 16; else *(int*)(Ptr + 460) &= ~16; }
     }
 
     /// <summary>
@@ -313,8 +398,8 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe bool bShouldShoot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 460); }
+        get { return (*(int*)(Ptr + 460) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 460) |= 32; else *(int*)(Ptr + 460) &= ~32; }
     }
 
     /// <summary>
@@ -322,8 +407,8 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe bool bPlayedEndBark
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 460); }
+        get { return (*(int*)(Ptr + 460) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 460) |= 64; else *(int*)(Ptr + 460) &= ~64; }
     }
 
     /// <summary>
@@ -367,7 +452,7 @@ public partial class RAEC_Attack_Outsider : BmSDK.BmGame.RAEC_SubGroup, BmSDK.IG
     /// </summary>
     public unsafe float ReleaseTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(float*)(Ptr + 496); }
+        set { *(float*)(Ptr + 496) = value; }
     }
 }
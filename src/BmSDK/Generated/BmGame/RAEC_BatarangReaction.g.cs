@@ -78,26 +78,46 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
         where TComponent : class, Framework.IScriptComponent<RAEC_BatarangReaction>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ClearTestRequestsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearTestRequests_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearTestRequests
     /// </summary>
     public unsafe virtual void ClearTestRequests()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ClearTestRequests", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearTestRequestsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ClearTestRequests", true);
+        var parms = new ClearTestRequests_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRandomThugToSpeakIfNobodyIsRECedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetRandomThugToSpeakIfNobodyIsRECed_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRandomThugToSpeakIfNobodyIsRECed
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMAIController GetRandomThugToSpeakIfNobodyIsRECed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.GetRandomThugToSpeakIfNobodyIsRECed", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIController>(paramsPtr + 0);
+        var funcManaged = s_GetRandomThugToSpeakIfNobodyIsRECedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.GetRandomThugToSpeakIfNobodyIsRECed", true);
+        var parms = new GetRandomThugToSpeakIfNobodyIsRECed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMAIController)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetRandomThugToSpeakFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetRandomThugToSpeak_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -105,10 +125,18 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMAIController GetRandomThugToSpeak()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.GetRandomThugToSpeak", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIController>(paramsPtr + 0);
+        var funcManaged = s_GetRandomThugToSpeakFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.GetRandomThugToSpeak", true);
+        var parms = new GetRandomThugToSpeak_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMAIController)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ProcessThugSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct ProcessThugSearch_Params
+    {
+        [FieldOffset(12)] public int bUncappedDist;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -116,12 +144,20 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe virtual bool ProcessThugSearch(BmSDK.TArray<BmSDK.BmGame.RMultiNavHandleWrapper> TargetThugSearch, bool bUncappedDist)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ProcessThugSearch", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetThugSearch, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUncappedDist, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_ProcessThugSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ProcessThugSearch", true);
+        var parms = new ProcessThugSearch_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetThugSearch, (byte*)&parms + 0);
+        parms.bUncappedDist = bUncappedDist ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PawnCanSeeLastPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PawnCanSeeLastPoint_Params
+    {
+        [FieldOffset(0)] public nint TestPawn;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -129,11 +165,17 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe virtual bool PawnCanSeeLastPoint(BmSDK.BmGame.RBMPawnAI TestPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.PawnCanSeeLastPoint", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_PawnCanSeeLastPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.PawnCanSeeLastPoint", true);
+        var parms = new PawnCanSeeLastPoint_Params();
+        parms.TestPawn = TestPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitThugSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct InitThugSearch_Params
+    {
     }
 
     /// <summary>
@@ -141,32 +183,60 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe virtual void InitThugSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.InitThugSearch", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitThugSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.InitThugSearch", true);
+        var parms = new InitThugSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartResponderSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartResponderSearch_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartResponderSearch
     /// </summary>
     public unsafe virtual void StartResponderSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.StartResponderSearch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartResponderSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.StartResponderSearch", true);
+        var parms = new StartResponderSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResponderSearchActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ResponderSearchActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ResponderSearchActive
     /// </summary>
     public unsafe virtual bool ResponderSearchActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ResponderSearchActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ResponderSearchActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ResponderSearchActive", true);
+        var parms = new ResponderSearchActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DoJumpReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 132)]
+    private struct DoJumpReaction_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(24)] public int bThrownFromGarg;
+        [FieldOffset(28)] public float JumpRange;
+        [FieldOffset(32)] public int NewBRangID;
+        [FieldOffset(36)] public int bDueToBodyDrop;
+        [FieldOffset(40)] public nint BodyDodger;
+        [FieldOffset(44)] public int bTerrorShootStartle;
+        [FieldOffset(48)] public int bAwardRECScareMedal;
     }
 
     /// <summary>
@@ -174,30 +244,43 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe virtual void DoJumpReaction(System.Numerics.Vector3 HitLoc, System.Numerics.Vector3 ThrownFromPos, bool bThrownFromGarg, float JumpRange, int NewBRangID = default, bool bDueToBodyDrop = default, BmSDK.BmGame.RBMAIController BodyDodger = default, bool bTerrorShootStartle = default, bool bAwardRECScareMedal = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.DoJumpReaction", true);
-        byte* paramsPtr = stackalloc byte[132];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThrownFromGarg, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(JumpRange, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewBRangID, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDueToBodyDrop, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BodyDodger, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTerrorShootStartle, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAwardRECScareMedal, paramsPtr + 48);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoJumpReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.DoJumpReaction", true);
+        var parms = new DoJumpReaction_Params();
+        parms.HitLoc = HitLoc;
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.bThrownFromGarg = bThrownFromGarg ? 1 : 0;
+        parms.JumpRange = JumpRange;
+        parms.NewBRangID = NewBRangID;
+        parms.bDueToBodyDrop = bDueToBodyDrop ? 1 : 0;
+        parms.BodyDodger = BodyDodger?.Ptr ?? 0;
+        parms.bTerrorShootStartle = bTerrorShootStartle ? 1 : 0;
+        parms.bAwardRECScareMedal = bAwardRECScareMedal ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasThugsReactingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasThugsReacting_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasThugsReacting
     /// </summary>
     public unsafe virtual bool HasThugsReacting()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.HasThugsReacting", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasThugsReactingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.HasThugsReacting", true);
+        var parms = new HasThugsReacting_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ExitIntoAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ExitIntoAttack_Params
+    {
     }
 
     /// <summary>
@@ -205,125 +288,210 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe virtual void ExitIntoAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ExitIntoAttack", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ExitIntoAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ExitIntoAttack", true);
+        var parms = new ExitIntoAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugGotBatarangedOutOfFrozenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ThugGotBatarangedOutOfFrozen_Params
+    {
+        [FieldOffset(0)] public nint NewCon;
+    }
+
     /// <summary>
     /// Function: ThugGotBatarangedOutOfFrozen
     /// </summary>
     public unsafe virtual void ThugGotBatarangedOutOfFrozen(BmSDK.BmGame.RBMAIController NewCon)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ThugGotBatarangedOutOfFrozen", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCon, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugGotBatarangedOutOfFrozenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ThugGotBatarangedOutOfFrozen", true);
+        var parms = new ThugGotBatarangedOutOfFrozen_Params();
+        parms.NewCon = NewCon?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugGotUpFromBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ThugGotUpFromBatarang_Params
+    {
+        [FieldOffset(0)] public nint TestThug;
+    }
+
     /// <summary>
     /// Function: ThugGotUpFromBatarang
     /// </summary>
     public unsafe virtual void ThugGotUpFromBatarang(BmSDK.BmGame.RPawnVillain TestThug)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ThugGotUpFromBatarang", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestThug, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugGotUpFromBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ThugGotUpFromBatarang", true);
+        var parms = new ThugGotUpFromBatarang_Params();
+        parms.TestThug = TestThug?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ManDownBodyDodgeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct ManDownBodyDodge_Params
+    {
+        [FieldOffset(0)] public nint Dodger;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(16)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(28)] public int bThrownFromGarg;
+        [FieldOffset(32)] public int LaunchID;
+    }
+
     /// <summary>
     /// Function: ManDownBodyDodge
     /// </summary>
     public unsafe virtual void ManDownBodyDodge(BmSDK.BmGame.RBMAIController Dodger, System.Numerics.Vector3 HitLoc, System.Numerics.Vector3 ThrownFromPos, bool bThrownFromGarg, int LaunchID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ManDownBodyDodge", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Dodger, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThrownFromGarg, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LaunchID, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ManDownBodyDodgeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ManDownBodyDodge", true);
+        var parms = new ManDownBodyDodge_Params();
+        parms.Dodger = Dodger?.Ptr ?? 0;
+        parms.HitLoc = HitLoc;
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.bThrownFromGarg = bThrownFromGarg ? 1 : 0;
+        parms.LaunchID = LaunchID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct ThugHit_Params
+    {
+        [FieldOffset(0)] public nint NewVictim;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(16)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(28)] public int bThrownFromGarg;
+        [FieldOffset(32)] public BmSDK.BmGame.RBMAIController.BRAECReactionType Type;
+        [FieldOffset(36)] public int NewLaunchID;
+        [FieldOffset(40)] public int bAwardRECScareMedal;
+    }
+
     /// <summary>
     /// Function: ThugHit
     /// </summary>
     public unsafe virtual void ThugHit(BmSDK.BmGame.RPawnVillain NewVictim, System.Numerics.Vector3 HitLoc, System.Numerics.Vector3 ThrownFromPos, bool bThrownFromGarg, BmSDK.BmGame.RBMAIController.BRAECReactionType Type, int NewLaunchID, bool bAwardRECScareMedal = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ThugHit", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewVictim, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThrownFromGarg, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLaunchID, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAwardRECScareMedal, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ThugHit", true);
+        var parms = new ThugHit_Params();
+        parms.NewVictim = NewVictim?.Ptr ?? 0;
+        parms.HitLoc = HitLoc;
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.bThrownFromGarg = bThrownFromGarg ? 1 : 0;
+        parms.Type = Type;
+        parms.NewLaunchID = NewLaunchID;
+        parms.bAwardRECScareMedal = bAwardRECScareMedal ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MakeRicochetNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct MakeRicochetNoise_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(24)] public int bThrownFromGarg;
+        [FieldOffset(28)] public BmSDK.BmGame.RBMAIController.BRAECReactionType Type;
+        [FieldOffset(32)] public int LaunchID;
+        [FieldOffset(36)] public int bTerrorShootStartle;
+    }
+
     /// <summary>
     /// Function: MakeRicochetNoise
     /// </summary>
     public unsafe virtual void MakeRicochetNoise(System.Numerics.Vector3 HitLoc, System.Numerics.Vector3 ThrownFromPos, bool bThrownFromGarg, BmSDK.BmGame.RBMAIController.BRAECReactionType Type, int LaunchID, bool bTerrorShootStartle = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.MakeRicochetNoise", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThrownFromGarg, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LaunchID, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTerrorShootStartle, paramsPtr + 36);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MakeRicochetNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.MakeRicochetNoise", true);
+        var parms = new MakeRicochetNoise_Params();
+        parms.HitLoc = HitLoc;
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.bThrownFromGarg = bThrownFromGarg ? 1 : 0;
+        parms.Type = Type;
+        parms.LaunchID = LaunchID;
+        parms.bTerrorShootStartle = bTerrorShootStartle ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForThrowReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct CheckForThrowReaction_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(12)] public BmSDK.BmGame.RBMAIController.BRAECReactionType Type;
+        [FieldOffset(16)] public int LaunchID;
+    }
+
     /// <summary>
     /// Function: CheckForThrowReaction
     /// </summary>
     public unsafe virtual void CheckForThrowReaction(System.Numerics.Vector3 ThrownFromPos, BmSDK.BmGame.RBMAIController.BRAECReactionType Type, int LaunchID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.CheckForThrowReaction", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LaunchID, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckForThrowReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.CheckForThrowReaction", true);
+        var parms = new CheckForThrowReaction_Params();
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.Type = Type;
+        parms.LaunchID = LaunchID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleHostageTakerReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct HandleHostageTakerReaction_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(12)] public float JumpRange;
+    }
+
     /// <summary>
     /// Function: HandleHostageTakerReaction
     /// </summary>
     public unsafe virtual void HandleHostageTakerReaction(System.Numerics.Vector3 HitLoc, float JumpRange)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.HandleHostageTakerReaction", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(JumpRange, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HandleHostageTakerReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.HandleHostageTakerReaction", true);
+        var parms = new HandleHostageTakerReaction_Params();
+        parms.HitLoc = HitLoc;
+        parms.JumpRange = JumpRange;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetParamsFromReactionTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetParamsFromReactionType_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.BRAECReactionType TestType;
+        [FieldOffset(4)] public float JumpRange;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetParamsFromReactionType
     /// </summary>
     public unsafe virtual bool GetParamsFromReactionType(BmSDK.BmGame.RBMAIController.BRAECReactionType TestType, out float JumpRange)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.GetParamsFromReactionType", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        JumpRange = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_GetParamsFromReactionTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.GetParamsFromReactionType", true);
+        var parms = new GetParamsFromReactionType_Params();
+        parms.TestType = TestType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        JumpRange = parms.JumpRange;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ThugSawThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ThugSawThrow_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(12)] public int NewLaunchID;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -331,12 +499,19 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe virtual bool ThugSawThrow(System.Numerics.Vector3 ThrownFromPos, int NewLaunchID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ThugSawThrow", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLaunchID, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_ThugSawThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.ThugSawThrow", true);
+        var parms = new ThugSawThrow_Params();
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.NewLaunchID = NewLaunchID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UnregisterGuardAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnregisterGuardAEC_Params
+    {
+        [FieldOffset(0)] public nint ExGuardAEC;
     }
 
     /// <summary>
@@ -344,57 +519,83 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe virtual void UnregisterGuardAEC(BmSDK.BmGame.RAEC_Search_Sub_Guard ExGuardAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.UnregisterGuardAEC", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExGuardAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterGuardAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.UnregisterGuardAEC", true);
+        var parms = new UnregisterGuardAEC_Params();
+        parms.ExGuardAEC = ExGuardAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterGuardAECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RegisterGuardAEC_Params
+    {
+        [FieldOffset(0)] public nint NewGuardAEC;
+    }
+
     /// <summary>
     /// Function: RegisterGuardAEC
     /// </summary>
     public unsafe virtual void RegisterGuardAEC(BmSDK.BmGame.RAEC_Search_Sub_Guard NewGuardAEC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.RegisterGuardAEC", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGuardAEC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterGuardAECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.RegisterGuardAEC", true);
+        var parms = new RegisterGuardAEC_Params();
+        parms.NewGuardAEC = NewGuardAEC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetThoughtsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetThoughts_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetThoughts
     /// </summary>
     public unsafe override void GetThoughts(out BmSDK.TArray<BmSDK.Engine.Actor.FThought> ThoughtList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.GetThoughts", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>(paramsPtr + 0);
+        var funcManaged = s_GetThoughtsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.GetThoughts", true);
+        var parms = new GetThoughts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.Tick", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreStreamOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreStreamOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreStreamOut
     /// </summary>
     public unsafe override void PreStreamOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.PreStreamOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreStreamOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_BatarangReaction.PreStreamOut", true);
+        var parms = new PreStreamOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -421,8 +622,8 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe int CurrentBRangID
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(int*)(Ptr + 488); }
+        set { *(int*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -430,8 +631,8 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe bool bShockBatarang
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 492); }
+        get { return (*(int*)(Ptr + 492) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 492) |= 1; else *(int*)(Ptr + 492) &= ~1; }
     }
 
     /// <summary>
@@ -439,8 +640,8 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe bool bPlayedWhereFromBark
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 492); }
+        get { return (*(int*)(Ptr + 492) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 492) |= 2; else *(int*)(Ptr + 492) &= ~2; }
     }
 
     /// <summary>
@@ -448,8 +649,8 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe bool bHadVictim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 492); }
+        get { return (*(int*)(Ptr + 492) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 492) |= 4; else *(int*)(Ptr + 492) &= ~4; }
     }
 
     /// <summary>
@@ -457,8 +658,8 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe bool bUrgentlyNeedMoreWatchers
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 492); }
+        get { return (*(int*)(Ptr + 492) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 492) |= 8; else *(int*)(Ptr + 492) &= ~8; }
     }
 
     /// <summary>
@@ -466,8 +667,8 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe float DisperseTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(float*)(Ptr + 496); }
+        set { *(float*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -475,8 +676,8 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe float PostGetupTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(float*)(Ptr + 500); }
+        set { *(float*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -493,8 +694,8 @@ public partial class RAEC_BatarangReaction : BmSDK.BmGame.RAlertEventCoordinator
     /// </summary>
     public unsafe float ReleaseTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 508); }
+        get { return *(float*)(Ptr + 508); }
+        set { *(float*)(Ptr + 508) = value; }
     }
 
     /// <summary>
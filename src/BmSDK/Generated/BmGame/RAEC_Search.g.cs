@@ -78,196 +78,321 @@ public partial class RAEC_Search : BmSDK.BmGame.RAEC_SearchBase, BmSDK.IGameObje
         where TComponent : class, Framework.IScriptComponent<RAEC_Search>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ReassignToPredatorPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ReassignToPredatorPoint_Params
+    {
+        [FieldOffset(0)] public nint PointLeader;
+        [FieldOffset(4)] public nint PredatorPoint;
+    }
+
     /// <summary>
     /// Function: ReassignToPredatorPoint
     /// </summary>
     public unsafe virtual void ReassignToPredatorPoint(BmSDK.BmGame.RAEC_Search_Sub PointLeader, BmSDK.BmGame.RPredatorSpecialMovePointBase PredatorPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.ReassignToPredatorPoint", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PointLeader, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PredatorPoint, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReassignToPredatorPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.ReassignToPredatorPoint", true);
+        var parms = new ReassignToPredatorPoint_Params();
+        parms.PointLeader = PointLeader?.Ptr ?? 0;
+        parms.PredatorPoint = PredatorPoint?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReassignToCornerTerrifiedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ReassignToCornerTerrified_Params
+    {
+        [FieldOffset(0)] public nint CornerLeader;
+        [FieldOffset(4)] public nint StartCorner;
+        [FieldOffset(8)] public nint EndCorner;
+    }
+
     /// <summary>
     /// Function: ReassignToCornerTerrified
     /// </summary>
     public unsafe virtual void ReassignToCornerTerrified(BmSDK.BmGame.RAEC_Search_Sub_Terrified CornerLeader, BmSDK.BmGame.RCornerWallMarker StartCorner, BmSDK.BmGame.RCornerWallMarker EndCorner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.ReassignToCornerTerrified", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CornerLeader, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartCorner, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndCorner, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReassignToCornerTerrifiedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.ReassignToCornerTerrified", true);
+        var parms = new ReassignToCornerTerrified_Params();
+        parms.CornerLeader = CornerLeader?.Ptr ?? 0;
+        parms.StartCorner = StartCorner?.Ptr ?? 0;
+        parms.EndCorner = EndCorner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReassignToRailPeekFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ReassignToRailPeek_Params
+    {
+        [FieldOffset(0)] public nint PeekLeader;
+        [FieldOffset(4)] public nint FenceNode;
+        [FieldOffset(8)] public System.Numerics.Vector3 StartPoint;
+    }
+
     /// <summary>
     /// Function: ReassignToRailPeek
     /// </summary>
     public unsafe virtual void ReassignToRailPeek(BmSDK.BmGame.RAEC_Search_Sub PeekLeader, BmSDK.BmGame.RBMPathNode_FenceJump FenceNode, System.Numerics.Vector3 StartPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.ReassignToRailPeek", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PeekLeader, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FenceNode, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartPoint, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReassignToRailPeekFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.ReassignToRailPeek", true);
+        var parms = new ReassignToRailPeek_Params();
+        parms.PeekLeader = PeekLeader?.Ptr ?? 0;
+        parms.FenceNode = FenceNode?.Ptr ?? 0;
+        parms.StartPoint = StartPoint;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReassignToCornerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ReassignToCorner_Params
+    {
+        [FieldOffset(0)] public nint CornerLeader;
+        [FieldOffset(4)] public nint StartCorner;
+        [FieldOffset(8)] public nint EndCorner;
+    }
+
     /// <summary>
     /// Function: ReassignToCorner
     /// </summary>
     public unsafe virtual void ReassignToCorner(BmSDK.BmGame.RAEC_Search_Sub CornerLeader, BmSDK.BmGame.RCornerWallMarker StartCorner, BmSDK.BmGame.RCornerWallMarker EndCorner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.ReassignToCorner", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CornerLeader, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartCorner, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndCorner, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReassignToCornerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.ReassignToCorner", true);
+        var parms = new ReassignToCorner_Params();
+        parms.CornerLeader = CornerLeader?.Ptr ?? 0;
+        parms.StartCorner = StartCorner?.Ptr ?? 0;
+        parms.EndCorner = EndCorner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignFromTerrorCornerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct AssignFromTerrorCorner_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+        [FieldOffset(4)] public BmSDK.BmGame.RAEC_Search_Sub.FRestoreSearchState OldState;
+    }
+
     /// <summary>
     /// Function: AssignFromTerrorCorner
     /// </summary>
     public unsafe virtual void AssignFromTerrorCorner(BmSDK.BmGame.RBMAIController NewMember, BmSDK.BmGame.RAEC_Search_Sub.FRestoreSearchState OldState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignFromTerrorCorner", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OldState, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignFromTerrorCornerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignFromTerrorCorner", true);
+        var parms = new AssignFromTerrorCorner_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        parms.OldState = OldState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignFromFollowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct AssignFromFollow_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+        [FieldOffset(4)] public BmSDK.BmGame.RAEC_Search_Sub.FRestoreSearchState OldState;
+    }
+
     /// <summary>
     /// Function: AssignFromFollow
     /// </summary>
     public unsafe override void AssignFromFollow(BmSDK.BmGame.RBMAIController NewMember, BmSDK.BmGame.RAEC_Search_Sub.FRestoreSearchState OldState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignFromFollow", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OldState, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignFromFollowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignFromFollow", true);
+        var parms = new AssignFromFollow_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        parms.OldState = OldState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignToSniperPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct AssignToSniperPoint_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: AssignToSniperPoint
     /// </summary>
     public unsafe virtual void AssignToSniperPoint(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToSniperPoint", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignToSniperPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToSniperPoint", true);
+        var parms = new AssignToSniperPoint_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignToSmashGeneratorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AssignToSmashGenerators_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: AssignToSmashGenerators
     /// </summary>
     public unsafe virtual void AssignToSmashGenerators(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToSmashGenerators", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignToSmashGeneratorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToSmashGenerators", true);
+        var parms = new AssignToSmashGenerators_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignToSmashGargoylesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AssignToSmashGargoyles_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: AssignToSmashGargoyles
     /// </summary>
     public unsafe virtual void AssignToSmashGargoyles(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToSmashGargoyles", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignToSmashGargoylesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToSmashGargoyles", true);
+        var parms = new AssignToSmashGargoyles_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignFromThermalFailFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AssignFromThermalFail_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: AssignFromThermalFail
     /// </summary>
     public unsafe virtual void AssignFromThermalFail(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignFromThermalFail", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignFromThermalFailFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignFromThermalFail", true);
+        var parms = new AssignFromThermalFail_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct Assign_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+        [FieldOffset(4)] public int bFirstAttempt;
+        [FieldOffset(8)] public int bHasHintLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 HintLoc;
+    }
+
     /// <summary>
     /// Function: Assign
     /// </summary>
     public unsafe override void Assign(BmSDK.BmGame.RBMAIController NewMember, bool bFirstAttempt = default, bool bHasHintLoc = default, System.Numerics.Vector3 HintLoc = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.Assign", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFirstAttempt, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHasHintLoc, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HintLoc, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.Assign", true);
+        var parms = new Assign_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        parms.bFirstAttempt = bFirstAttempt ? 1 : 0;
+        parms.bHasHintLoc = bHasHintLoc ? 1 : 0;
+        parms.HintLoc = HintLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignToImmiediateSmashFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AssignToImmiediateSmash_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: AssignToImmiediateSmash
     /// </summary>
     public unsafe virtual void AssignToImmiediateSmash(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToImmiediateSmash", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignToImmiediateSmashFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToImmiediateSmash", true);
+        var parms = new AssignToImmiediateSmash_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignToGuardFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AssignToGuard_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+    }
+
     /// <summary>
     /// Function: AssignToGuard
     /// </summary>
     public unsafe virtual void AssignToGuard(BmSDK.BmGame.RBMAIController NewMember)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToGuard", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignToGuardFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.AssignToGuard", true);
+        var parms = new AssignToGuard_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendToGuardPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SendToGuardPoint_Params
+    {
+        [FieldOffset(0)] public nint NewGuardCon;
+        [FieldOffset(4)] public nint GuardPoint;
+    }
+
     /// <summary>
     /// Function: SendToGuardPoint
     /// </summary>
     public unsafe virtual void SendToGuardPoint(BmSDK.BmGame.RBMAIController NewGuardCon, BmSDK.BmGame.RGuardPoint GuardPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.SendToGuardPoint", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGuardCon, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GuardPoint, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendToGuardPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.SendToGuardPoint", true);
+        var parms = new SendToGuardPoint_Params();
+        parms.NewGuardCon = NewGuardCon?.Ptr ?? 0;
+        parms.GuardPoint = GuardPoint?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanSnipeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanSnipe_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanSnipe
     /// </summary>
     public unsafe override bool CanSnipe()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.CanSnipe", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanSnipeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.CanSnipe", true);
+        var parms = new CanSnipe_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetNewFearLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetNewFearLevel_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMRoomAIState.VillainFearLevel FearLevel;
     }
 
     /// <summary>
@@ -275,10 +400,10 @@ public partial class RAEC_Search : BmSDK.BmGame.RAEC_SearchBase, BmSDK.IGameObje
     /// </summary>
     public unsafe override void SetNewFearLevel(BmSDK.BmGame.RBMRoomAIState.VillainFearLevel FearLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.SetNewFearLevel", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FearLevel, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNewFearLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search.SetNewFearLevel", true);
+        var parms = new SetNewFearLevel_Params();
+        parms.FearLevel = FearLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
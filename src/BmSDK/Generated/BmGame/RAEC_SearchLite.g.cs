@@ -78,15 +78,29 @@ public partial class RAEC_SearchLite : BmSDK.BmGame.RAEC_SearchBase, BmSDK.IGame
         where TComponent : class, Framework.IScriptComponent<RAEC_SearchLite>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetCurrentPatrolIDsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetCurrentPatrolIDs_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetCurrentPatrolIDs
     /// </summary>
     public unsafe virtual BmSDK.TArray<int> GetCurrentPatrolIDs()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_SearchLite.GetCurrentPatrolIDs", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 0);
+        var funcManaged = s_GetCurrentPatrolIDsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_SearchLite.GetCurrentPatrolIDs", true);
+        var parms = new GetCurrentPatrolIDs_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 0);
+    }
+
+    static BmSDK.Function s_AssignFromFollowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct AssignFromFollow_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+        [FieldOffset(4)] public BmSDK.BmGame.RAEC_Search_Sub.FRestoreSearchState OldState;
     }
 
     /// <summary>
@@ -94,38 +108,55 @@ public partial class RAEC_SearchLite : BmSDK.BmGame.RAEC_SearchBase, BmSDK.IGame
     /// </summary>
     public unsafe override void AssignFromFollow(BmSDK.BmGame.RBMAIController NewMember, BmSDK.BmGame.RAEC_Search_Sub.FRestoreSearchState OldState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_SearchLite.AssignFromFollow", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OldState, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignFromFollowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_SearchLite.AssignFromFollow", true);
+        var parms = new AssignFromFollow_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        parms.OldState = OldState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AssignFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Assign_Params
+    {
+        [FieldOffset(0)] public nint NewMember;
+        [FieldOffset(4)] public int bFirstAttempt;
+        [FieldOffset(8)] public int bHasHintLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 HintLoc;
+    }
+
     /// <summary>
     /// Function: Assign
     /// </summary>
     public unsafe override void Assign(BmSDK.BmGame.RBMAIController NewMember, bool bFirstAttempt = default, bool bHasHintLoc = default, System.Numerics.Vector3 HintLoc = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_SearchLite.Assign", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMember, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFirstAttempt, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHasHintLoc, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HintLoc, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AssignFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_SearchLite.Assign", true);
+        var parms = new Assign_Params();
+        parms.NewMember = NewMember?.Ptr ?? 0;
+        parms.bFirstAttempt = bFirstAttempt ? 1 : 0;
+        parms.bHasHintLoc = bHasHintLoc ? 1 : 0;
+        parms.HintLoc = HintLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNewFearLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetNewFearLevel_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMRoomAIState.VillainFearLevel FearLevel;
+    }
+
     /// <summary>
     /// Function: SetNewFearLevel
     /// </summary>
     public unsafe override void SetNewFearLevel(BmSDK.BmGame.RBMRoomAIState.VillainFearLevel FearLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_SearchLite.SetNewFearLevel", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FearLevel, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNewFearLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_SearchLite.SetNewFearLevel", true);
+        var parms = new SetNewFearLevel_Params();
+        parms.FearLevel = FearLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -78,26 +78,47 @@ public partial class RAEC_Search_Sub_Thermal : BmSDK.BmGame.RAEC_Search_Sub, BmS
         where TComponent : class, Framework.IScriptComponent<RAEC_Search_Sub_Thermal>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_AtUltimateDestFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AtUltimateDest_Params
+    {
+    }
+
     /// <summary>
     /// Function: AtUltimateDest
     /// </summary>
     public unsafe override void AtUltimateDest()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.AtUltimateDest", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AtUltimateDestFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.AtUltimateDest", true);
+        var parms = new AtUltimateDest_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNextVantagePointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SetNextVantagePoint_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RAEC_Search_Sub_Thermal.VantageSearchResult ReturnValue;
+    }
+
     /// <summary>
     /// Function: SetNextVantagePoint
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RAEC_Search_Sub_Thermal.VantageSearchResult SetNextVantagePoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.SetNextVantagePoint", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAEC_Search_Sub_Thermal.VantageSearchResult>(paramsPtr + 0);
+        var funcManaged = s_SetNextVantagePointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.SetNextVantagePoint", true);
+        var parms = new SetNextVantagePoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetStateForChosenPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetStateForChosenPoint_Params
+    {
+        [FieldOffset(0)] public nint BestVantage;
+        [FieldOffset(4)] public System.Numerics.Vector3 VantageCheckStandPoint;
     }
 
     /// <summary>
@@ -105,36 +126,51 @@ public partial class RAEC_Search_Sub_Thermal : BmSDK.BmGame.RAEC_Search_Sub, BmS
     /// </summary>
     public unsafe virtual void SetStateForChosenPoint(BmSDK.BmGame.RHidePoint BestVantage, System.Numerics.Vector3 VantageCheckStandPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.SetStateForChosenPoint", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BestVantage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VantageCheckStandPoint, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetStateForChosenPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.SetStateForChosenPoint", true);
+        var parms = new SetStateForChosenPoint_Params();
+        parms.BestVantage = BestVantage?.Ptr ?? 0;
+        parms.VantageCheckStandPoint = VantageCheckStandPoint;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartFromChaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct StartFromChase_Params
+    {
+        [FieldOffset(0)] public nint NewCon;
+        [FieldOffset(4)] public System.Numerics.Vector3 NewUDestFromChase;
+    }
+
     /// <summary>
     /// Function: StartFromChase
     /// </summary>
     public unsafe override void StartFromChase(BmSDK.BmGame.RBMAIController NewCon, System.Numerics.Vector3 NewUDestFromChase)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.StartFromChase", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCon, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewUDestFromChase, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartFromChaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.StartFromChase", true);
+        var parms = new StartFromChase_Params();
+        parms.NewCon = NewCon?.Ptr ?? 0;
+        parms.NewUDestFromChase = NewUDestFromChase;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckHandleForSpecialMovesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CheckHandleForSpecialMoves_Params
+    {
+        [FieldOffset(0)] public nint ActiveHandle;
+    }
+
     /// <summary>
     /// Function: CheckHandleForSpecialMoves
     /// </summary>
     public unsafe override void CheckHandleForSpecialMoves(BmSDK.BmGame.RNavigationHandle ActiveHandle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.CheckHandleForSpecialMoves", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ActiveHandle, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckHandleForSpecialMovesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAEC_Search_Sub_Thermal.CheckHandleForSpecialMoves", true);
+        var parms = new CheckHandleForSpecialMoves_Params();
+        parms.ActiveHandle = ActiveHandle?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -172,7 +208,7 @@ public partial class RAEC_Search_Sub_Thermal : BmSDK.BmGame.RAEC_Search_Sub, BmS
     /// </summary>
     public unsafe bool bAntibacktrackNextUDest
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 580) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 580); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 580); }
+        get { return (*(int*)(Ptr + 580) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 580) |= 1; else *(int*)(Ptr + 580) &= ~1; }
     }
 }
@@ -145,10 +145,6 @@ public partial class RActorFactoryBreakablePropStatic : BmSDK.Engine.ActorFactor
         /// <summary>
         /// FloatProperty: CollideDamageScale
         /// </summary>
-        public unsafe float CollideDamageScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float CollideDamageScale;
     }
 }
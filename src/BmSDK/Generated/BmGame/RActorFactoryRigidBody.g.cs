@@ -83,8 +83,8 @@ public partial class RActorFactoryRigidBody : BmSDK.Engine.ActorFactoryRigidBody
     /// </summary>
     public unsafe bool bDoDamage
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }
+        get { return (*(int*)(Ptr + 152) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 152) |= 1; else *(int*)(Ptr + 152) &= ~1; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class RActorFactoryRigidBody : BmSDK.Engine.ActorFactoryRigidBody
     /// </summary>
     public unsafe bool bDontBlockActors
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }
+        get { return (*(int*)(Ptr + 152) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 152) |= 2; else *(int*)(Ptr + 152) &= ~2; }
     }
 }
@@ -96,11 +96,7 @@ public partial class RAddContentCharacterSelect : BmSDK.BmGame.RAdditionalConten
         /// <summary>
         /// NameProperty: BoneOrSocketName
         /// </summary>
-        public unsafe BmSDK.FName BoneOrSocketName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.FName BoneOrSocketName;
     }
 
     /// <summary>
@@ -162,8 +158,8 @@ public partial class RAddContentCharacterSelect : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe BmSDK.FName AnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(BmSDK.FName*)(Ptr + 104); }
+        set { *(BmSDK.FName*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -171,8 +167,8 @@ public partial class RAddContentCharacterSelect : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe BmSDK.FName SelectedAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(BmSDK.FName*)(Ptr + 112); }
+        set { *(BmSDK.FName*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -180,8 +176,8 @@ public partial class RAddContentCharacterSelect : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe float SelectedAnimTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -189,8 +185,8 @@ public partial class RAddContentCharacterSelect : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe BmSDK.FName RandomAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(BmSDK.FName*)(Ptr + 124); }
+        set { *(BmSDK.FName*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -198,8 +194,8 @@ public partial class RAddContentCharacterSelect : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe float RandomAnimTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(float*)(Ptr + 132); }
+        set { *(float*)(Ptr + 132) = value; }
     }
 
     /// <summary>
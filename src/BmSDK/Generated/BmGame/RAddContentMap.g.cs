@@ -83,7 +83,7 @@ public partial class RAddContentMap : BmSDK.BmGame.RAdditionalContent, BmSDK.IGa
     /// </summary>
     public unsafe int IntTest
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(int*)(Ptr + 48); }
+        set { *(int*)(Ptr + 48) = value; }
     }
 }
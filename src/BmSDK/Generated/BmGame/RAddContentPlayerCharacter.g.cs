@@ -160,64 +160,64 @@ public partial class RAddContentPlayerCharacter : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleInner_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(BmSDK.FName*)(Ptr + 80); }
+        set { *(BmSDK.FName*)(Ptr + 80) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleInner
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleInner_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(BmSDK.FName*)(Ptr + 88); }
+        set { *(BmSDK.FName*)(Ptr + 88) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleInner
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleInner_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(BmSDK.FName*)(Ptr + 96); }
+        set { *(BmSDK.FName*)(Ptr + 96) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleInner
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleInner_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(BmSDK.FName*)(Ptr + 104); }
+        set { *(BmSDK.FName*)(Ptr + 104) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleInner
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleInner_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(BmSDK.FName*)(Ptr + 112); }
+        set { *(BmSDK.FName*)(Ptr + 112) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleInner
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleInner_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.FName*)(Ptr + 120); }
+        set { *(BmSDK.FName*)(Ptr + 120) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleInner
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleInner_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(BmSDK.FName*)(Ptr + 128); }
+        set { *(BmSDK.FName*)(Ptr + 128) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleInner
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleInner_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(BmSDK.FName*)(Ptr + 136); }
+        set { *(BmSDK.FName*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -230,64 +230,64 @@ public partial class RAddContentPlayerCharacter : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleOuter_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(BmSDK.FName*)(Ptr + 144); }
+        set { *(BmSDK.FName*)(Ptr + 144) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleOuter
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleOuter_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(BmSDK.FName*)(Ptr + 152); }
+        set { *(BmSDK.FName*)(Ptr + 152) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleOuter
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleOuter_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(BmSDK.FName*)(Ptr + 160); }
+        set { *(BmSDK.FName*)(Ptr + 160) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleOuter
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleOuter_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }
+        get { return *(BmSDK.FName*)(Ptr + 168); }
+        set { *(BmSDK.FName*)(Ptr + 168) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleOuter
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleOuter_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(BmSDK.FName*)(Ptr + 176); }
+        set { *(BmSDK.FName*)(Ptr + 176) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleOuter
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleOuter_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(BmSDK.FName*)(Ptr + 184); }
+        set { *(BmSDK.FName*)(Ptr + 184) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleOuter
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleOuter_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+        get { return *(BmSDK.FName*)(Ptr + 192); }
+        set { *(BmSDK.FName*)(Ptr + 192) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsConsoleOuter
     /// </summary>
     public unsafe BmSDK.FName GadgetsConsoleOuter_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 200); }
+        get { return *(BmSDK.FName*)(Ptr + 200); }
+        set { *(BmSDK.FName*)(Ptr + 200) = value; }
     }
 
     /// <summary>
@@ -300,96 +300,96 @@ public partial class RAddContentPlayerCharacter : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(BmSDK.FName*)(Ptr + 208); }
+        set { *(BmSDK.FName*)(Ptr + 208) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(BmSDK.FName*)(Ptr + 216); }
+        set { *(BmSDK.FName*)(Ptr + 216) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(BmSDK.FName*)(Ptr + 224); }
+        set { *(BmSDK.FName*)(Ptr + 224) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(BmSDK.FName*)(Ptr + 232); }
+        set { *(BmSDK.FName*)(Ptr + 232) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(BmSDK.FName*)(Ptr + 240); }
+        set { *(BmSDK.FName*)(Ptr + 240) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(BmSDK.FName*)(Ptr + 248); }
+        set { *(BmSDK.FName*)(Ptr + 248) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(BmSDK.FName*)(Ptr + 256); }
+        set { *(BmSDK.FName*)(Ptr + 256) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(BmSDK.FName*)(Ptr + 264); }
+        set { *(BmSDK.FName*)(Ptr + 264) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(BmSDK.FName*)(Ptr + 272); }
+        set { *(BmSDK.FName*)(Ptr + 272) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_9
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 280); }
+        get { return *(BmSDK.FName*)(Ptr + 280); }
+        set { *(BmSDK.FName*)(Ptr + 280) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_10
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(BmSDK.FName*)(Ptr + 288); }
+        set { *(BmSDK.FName*)(Ptr + 288) = value; }
     }
     /// <summary>
     /// NameProperty: GadgetsPC
     /// </summary>
     public unsafe BmSDK.FName GadgetsPC_11
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -415,7 +415,7 @@ public partial class RAddContentPlayerCharacter : BmSDK.BmGame.RAdditionalConten
     /// </summary>
     public unsafe int ReferenceCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(int*)(Ptr + 320); }
+        set { *(int*)(Ptr + 320) = value; }
     }
 }
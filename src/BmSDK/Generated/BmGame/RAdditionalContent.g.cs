@@ -78,7 +78,7 @@ public partial class RAdditionalContent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int TestID
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 }
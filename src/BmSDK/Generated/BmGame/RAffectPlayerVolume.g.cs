@@ -78,30 +78,47 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
         where TComponent : class, Framework.IScriptComponent<RAffectPlayerVolume>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UnTouchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UnTouch_Params
+    {
+        [FieldOffset(0)] public nint Other;
+    }
+
     /// <summary>
     /// Function: UnTouch
     /// </summary>
     public unsafe override void UnTouch(BmSDK.Engine.Actor Other)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAffectPlayerVolume.UnTouch", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Other, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnTouchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAffectPlayerVolume.UnTouch", true);
+        var parms = new UnTouch_Params();
+        parms.Other = Other?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TouchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct Touch_Params
+    {
+        [FieldOffset(0)] public nint Other;
+        [FieldOffset(4)] public nint OtherComp;
+        [FieldOffset(8)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(20)] public System.Numerics.Vector3 HitNormal;
+    }
+
     /// <summary>
     /// Function: Touch
     /// </summary>
     public unsafe override void Touch(BmSDK.Engine.Actor Other, BmSDK.Engine.PrimitiveComponent OtherComp, System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 HitNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAffectPlayerVolume.Touch", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Other, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TouchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAffectPlayerVolume.Touch", true);
+        var parms = new Touch_Params();
+        parms.Other = Other?.Ptr ?? 0;
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        parms.HitLocation = HitLocation;
+        parms.HitNormal = HitNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -119,8 +136,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoJump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 1; else *(int*)(Ptr + 484) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +145,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool SlowDownPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 2; else *(int*)(Ptr + 484) &= ~2; }
     }
 
     /// <summary>
@@ -137,8 +154,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoLedgeGrab
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 4; else *(int*)(Ptr + 484) &= ~4; }
     }
 
     /// <summary>
@@ -146,8 +163,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool ForceLineLauncherCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 8; else *(int*)(Ptr + 484) &= ~8; }
     }
 
     /// <summary>
@@ -155,8 +172,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool DisableAIAlerts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 16; else *(int*)(Ptr + 484) &= ~16; }
     }
 
     /// <summary>
@@ -164,8 +181,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool CanPerchOnLowRailings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 32; else *(int*)(Ptr + 484) &= ~32; }
     }
 
     /// <summary>
@@ -173,8 +190,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool ForceCrouch
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 64; else *(int*)(Ptr + 484) &= ~64; }
     }
 
     /// <summary>
@@ -182,8 +199,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool Allow128Jump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 128; else *(int*)(Ptr + 484) &= ~128; }
     }
 
     /// <summary>
@@ -191,8 +208,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool SlipperyIce
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 256; else *(int*)(Ptr + 484) &= ~256; }
     }
 
     /// <summary>
@@ -200,8 +217,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoTunnelCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 512; else *(int*)(Ptr + 484) &= ~512; }
     }
 
     /// <summary>
@@ -209,8 +226,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoGlide
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 1024; else *(int*)(Ptr + 484) &= ~1024; }
     }
 
     /// <summary>
@@ -218,8 +235,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool DontDoTakedownDOFChange
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 2048; else *(int*)(Ptr + 484) &= ~2048; }
     }
 
     /// <summary>
@@ -227,8 +244,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool DisableTakedowns
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 4096; else *(int*)(Ptr + 484) &= ~4096; }
     }
 
     /// <summary>
@@ -236,8 +253,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoClimb
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 8192; else *(int*)(Ptr + 484) &= ~8192; }
     }
 
     /// <summary>
@@ -245,8 +262,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool UseHighTunnelGrateCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 16384; else *(int*)(Ptr + 484) &= ~16384; }
     }
 
     /// <summary>
@@ -254,8 +271,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool SlowDownStandardGlide
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 32768; else *(int*)(Ptr + 484) &= ~32768; }
     }
 
     /// <summary>
@@ -263,8 +280,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoDropFromCeiling
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 65536; else *(int*)(Ptr + 484) &= ~65536; }
     }
 
     /// <summary>
@@ -272,8 +289,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool SuppressCompassInOverworld
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 131072; else *(int*)(Ptr + 484) &= ~131072; }
     }
 
     /// <summary>
@@ -281,8 +298,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoRailingLookDownCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 262144; else *(int*)(Ptr + 484) &= ~262144; }
     }
 
     /// <summary>
@@ -290,8 +307,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoAutomaticTutorials
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 524288; else *(int*)(Ptr + 484) &= ~524288; }
     }
 
     /// <summary>
@@ -299,8 +316,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoPunchWeakWalls
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 1048576; else *(int*)(Ptr + 484) &= ~1048576; }
     }
 
     /// <summary>
@@ -308,8 +325,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool StopPlayerFallingOffEdges
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 2097152; else *(int*)(Ptr + 484) &= ~2097152; }
     }
 
     /// <summary>
@@ -317,8 +334,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool VisibleInReflections
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 4194304; else *(int*)(Ptr + 484) &= ~4194304; }
     }
 
     /// <summary>
@@ -326,8 +343,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool DisablePounces
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 8388608; else *(int*)(Ptr + 484) &= ~8388608; }
     }
 
     /// <summary>
@@ -335,8 +352,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool StopTaunt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 16777216; else *(int*)(Ptr + 484) &= ~16777216; }
     }
 
     /// <summary>
@@ -344,8 +361,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool AllowCatwomanInterrogations
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 33554432; else *(int*)(Ptr + 484) &= ~33554432; }
     }
 
     /// <summary>
@@ -353,8 +370,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool CloseLineLauncherCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 67108864; else *(int*)(Ptr + 484) &= ~67108864; }
     }
 
     /// <summary>
@@ -362,8 +379,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool SupressCombatCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 134217728; else *(int*)(Ptr + 484) &= ~134217728; }
     }
 
     /// <summary>
@@ -371,8 +388,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool DontAllowCancelBatarangCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 268435456; else *(int*)(Ptr + 484) &= ~268435456; }
     }
 
     /// <summary>
@@ -380,8 +397,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool ForceGlideKickCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 536870912; else *(int*)(Ptr + 484) &= ~536870912; }
     }
 
     /// <summary>
@@ -389,8 +406,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoVantagePointCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 1073741824; else *(int*)(Ptr + 484) &= ~1073741824; }
     }
 
     /// <summary>
@@ -398,8 +415,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool SuppressOverrideMoves
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= -2147483648; else *(int*)(Ptr + 484) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -407,8 +424,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool LowLineLauncher
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 1; else *(int*)(Ptr + 488) &= ~1; }
     }
 
     /// <summary>
@@ -416,8 +433,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoLineLauncherFlip
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 2; else *(int*)(Ptr + 488) &= ~2; }
     }
 
     /// <summary>
@@ -425,8 +442,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoWaterGrappleRescue
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 4; else *(int*)(Ptr + 488) &= ~4; }
     }
 
     /// <summary>
@@ -434,8 +451,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoEnvironmentCounters
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 8; else *(int*)(Ptr + 488) &= ~8; }
     }
 
     /// <summary>
@@ -443,8 +460,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool ForceConsiderRopeOnLedgeTakedown
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 16; else *(int*)(Ptr + 488) &= ~16; }
     }
 
     /// <summary>
@@ -452,8 +469,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool ForceNoRopeOnLedgeTakedown
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 32; else *(int*)(Ptr + 488) &= ~32; }
     }
 
     /// <summary>
@@ -461,8 +478,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool DisableInformantScans
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 64; else *(int*)(Ptr + 488) &= ~64; }
     }
 
     /// <summary>
@@ -470,8 +487,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool AlwaysAllowLedgeTakedown
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 128; else *(int*)(Ptr + 488) &= ~128; }
     }
 
     /// <summary>
@@ -479,8 +496,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NarrowCombatZone
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 256; else *(int*)(Ptr + 488) &= ~256; }
     }
 
     /// <summary>
@@ -488,8 +505,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool AllowGlideAchievement
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 512; else *(int*)(Ptr + 488) &= ~512; }
     }
 
     /// <summary>
@@ -497,8 +514,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool AntiWaterVolume
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 1024; else *(int*)(Ptr + 488) &= ~1024; }
     }
 
     /// <summary>
@@ -506,8 +523,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoDropOffRailings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 2048; else *(int*)(Ptr + 488) &= ~2048; }
     }
 
     /// <summary>
@@ -515,8 +532,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoClimbDown
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 4096; else *(int*)(Ptr + 488) &= ~4096; }
     }
 
     /// <summary>
@@ -524,8 +541,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool ForceCatwomanLedgeClimb
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 8192; else *(int*)(Ptr + 488) &= ~8192; }
     }
 
     /// <summary>
@@ -533,8 +550,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool AllowSteepDiagonalRailings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 16384; else *(int*)(Ptr + 488) &= ~16384; }
     }
 
     /// <summary>
@@ -542,8 +559,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoWireWalk
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 32768; else *(int*)(Ptr + 488) &= ~32768; }
     }
 
     /// <summary>
@@ -551,8 +568,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoDiveOffEdges
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 65536; else *(int*)(Ptr + 488) &= ~65536; }
     }
 
     /// <summary>
@@ -560,8 +577,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoSprayGel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 131072; else *(int*)(Ptr + 488) &= ~131072; }
     }
 
     /// <summary>
@@ -569,8 +586,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool ChurchTower
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 262144; else *(int*)(Ptr + 488) &= ~262144; }
     }
 
     /// <summary>
@@ -578,8 +595,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoGlideKick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 524288; else *(int*)(Ptr + 488) &= ~524288; }
     }
 
     /// <summary>
@@ -587,8 +604,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoGlideClimb
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 1048576; else *(int*)(Ptr + 488) &= ~1048576; }
     }
 
     /// <summary>
@@ -596,8 +613,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoWallInterrogation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 2097152; else *(int*)(Ptr + 488) &= ~2097152; }
     }
 
     /// <summary>
@@ -605,8 +622,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoFloorInterrogation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 4194304; else *(int*)(Ptr + 488) &= ~4194304; }
     }
 
     /// <summary>
@@ -614,8 +631,8 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool NoResonator
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 8388608; else *(int*)(Ptr + 488) &= ~8388608; }
     }
 
     /// <summary>
@@ -623,7 +640,7 @@ public partial class RAffectPlayerVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.EStasisLevel ForceStasisLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EStasisLevel>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(BmSDK.BmGame.RGameInfo.EStasisLevel*)(Ptr + 492); }
+        set { *(BmSDK.BmGame.RGameInfo.EStasisLevel*)(Ptr + 492) = value; }
     }
 }
@@ -124,8 +124,8 @@ public partial class RAimingConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RAimingConfig.EAimingReference Reference
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAimingConfig.EAimingReference>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(BmSDK.BmGame.RAimingConfig.EAimingReference*)(Ptr + 104); }
+        set { *(BmSDK.BmGame.RAimingConfig.EAimingReference*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -133,8 +133,8 @@ public partial class RAimingConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Reference_Axis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(int*)(Ptr + 108); }
+        set { *(int*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -142,8 +142,8 @@ public partial class RAimingConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Reference_AxisNegate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 112); }
+        get { return (*(int*)(Ptr + 112) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 112) |= 1; else *(int*)(Ptr + 112) &= ~1; }
     }
 
     /// <summary>
@@ -151,8 +151,8 @@ public partial class RAimingConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Reference_YawOnly
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 112); }
+        get { return (*(int*)(Ptr + 112) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 112) |= 2; else *(int*)(Ptr + 112) &= ~2; }
     }
 
     /// <summary>
@@ -160,8 +160,8 @@ public partial class RAimingConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Reference_PitchOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(float*)(Ptr + 116); }
+        set { *(float*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -169,8 +169,8 @@ public partial class RAimingConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float LimitScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -178,8 +178,8 @@ public partial class RAimingConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float LookAt_LimitScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -188,31 +188,25 @@ public partial class RAimingConfig : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 12)]
     public partial record struct FAimingPartConfig
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: Enabled
         /// </summary>
-        public unsafe bool Enabled
+        public bool Enabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: Yaw
         /// </summary>
-        public unsafe float Yaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Yaw;
 
         /// <summary>
         /// FloatProperty: Pitch
         /// </summary>
-        public unsafe float Pitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Pitch;
     }
 }
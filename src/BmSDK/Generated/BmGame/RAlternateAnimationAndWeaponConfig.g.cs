@@ -78,16 +78,31 @@ public partial class RAlternateAnimationAndWeaponConfig : BmSDK.BmGame.RConfig,
         where TComponent : class, Framework.IScriptComponent<RAlternateAnimationAndWeaponConfig>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CreateBasicWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1040)]
+    private struct CreateBasicWeaponConfig_Params
+    {
+        [FieldOffset(0)] public nint NewOwner;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateBasicWeaponConfig
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RWeaponConfig CreateBasicWeaponConfig(BmSDK.GameObject NewOwner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.CreateBasicWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[1040];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewOwner, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWeaponConfig>(paramsPtr + 4);
+        var funcManaged = s_CreateBasicWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.CreateBasicWeaponConfig", true);
+        var parms = new CreateBasicWeaponConfig_Params();
+        parms.NewOwner = NewOwner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWeaponConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetWeaponUpAimingConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetWeaponUpAimingConfig_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -95,10 +110,18 @@ public partial class RAlternateAnimationAndWeaponConfig : BmSDK.BmGame.RConfig,
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RAimingConfig GetWeaponUpAimingConfig()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.GetWeaponUpAimingConfig", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAimingConfig>(paramsPtr + 0);
+        var funcManaged = s_GetWeaponUpAimingConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.GetWeaponUpAimingConfig", true);
+        var parms = new GetWeaponUpAimingConfig_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RAimingConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Change_Params
+    {
+        [FieldOffset(0)] public nint ParentWeapon;
+        [FieldOffset(4)] public nint NPC;
     }
 
     /// <summary>
@@ -106,41 +129,47 @@ public partial class RAlternateAnimationAndWeaponConfig : BmSDK.BmGame.RConfig,
     /// </summary>
     public unsafe virtual void Change(BmSDK.BmGame.RBMWeapon ParentWeapon, BmSDK.BmGame.RBMPawnAI NPC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.Change", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ParentWeapon, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NPC, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.Change", true);
+        var parms = new Change_Params();
+        parms.ParentWeapon = ParentWeapon?.Ptr ?? 0;
+        parms.NPC = NPC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Setup_Params
+    {
+        [FieldOffset(0)] public nint ParentWeapon;
+    }
+
     /// <summary>
     /// Function: Setup
     /// </summary>
     public unsafe virtual void Setup(BmSDK.BmGame.RBMWeapon ParentWeapon)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.Setup", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ParentWeapon, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.Setup", true);
+        var parms = new Setup_Params();
+        parms.ParentWeapon = ParentWeapon?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FixBrokenDefaultFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FixBrokenDefault_Params
+    {
+    }
+
     /// <summary>
     /// Function: FixBrokenDefault
     /// </summary>
     public unsafe virtual void FixBrokenDefault()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.FixBrokenDefault", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_FixBrokenDefaultFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAlternateAnimationAndWeaponConfig.FixBrokenDefault", true);
+        var parms = new FixBrokenDefault_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -153,20 +182,12 @@ public partial class RAlternateAnimationAndWeaponConfig : BmSDK.BmGame.RConfig,
         /// <summary>
         /// NameProperty: AnimName
         /// </summary>
-        public unsafe BmSDK.FName AnimName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName AnimName;
 
         /// <summary>
         /// NameProperty: SubtractAnim
         /// </summary>
-        public unsafe BmSDK.FName SubtractAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName SubtractAnim;
     }
 
     /// <summary>
@@ -178,20 +199,12 @@ public partial class RAlternateAnimationAndWeaponConfig : BmSDK.BmGame.RConfig,
         /// <summary>
         /// NameProperty: AnimName
         /// </summary>
-        public unsafe BmSDK.FName AnimName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName AnimName;
 
         /// <summary>
         /// NameProperty: Identifier
         /// </summary>
-        public unsafe BmSDK.FName Identifier
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName Identifier;
     }
 
     /// <summary>
@@ -203,56 +216,32 @@ public partial class RAlternateAnimationAndWeaponConfig : BmSDK.BmGame.RConfig,
         /// <summary>
         /// NameProperty: StandAnim
         /// </summary>
-        public unsafe BmSDK.FName StandAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName StandAnim;
 
         /// <summary>
         /// NameProperty: WalkAnim
         /// </summary>
-        public unsafe BmSDK.FName WalkAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName WalkAnim;
 
         /// <summary>
         /// NameProperty: RunAnim
         /// </summary>
-        public unsafe BmSDK.FName RunAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.FName RunAnim;
 
         /// <summary>
         /// NameProperty: BackWalkAnim
         /// </summary>
-        public unsafe BmSDK.FName BackWalkAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.FName BackWalkAnim;
 
         /// <summary>
         /// NameProperty: BackRunAnim
         /// </summary>
-        public unsafe BmSDK.FName BackRunAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.FName BackRunAnim;
 
         /// <summary>
         /// FloatProperty: LegAnimYawStr
         /// </summary>
-        public unsafe float LegAnimYawStr
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float LegAnimYawStr;
     }
 
     /// <summary>
@@ -269,8 +258,8 @@ public partial class RAlternateAnimationAndWeaponConfig : BmSDK.BmGame.RConfig,
     /// </summary>
     public unsafe BmSDK.FName AttachBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.FName*)(Ptr + 48); }
+        set { *(BmSDK.FName*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -323,8 +312,8 @@ public partial class RAlternateAnimationAndWeaponConfig : BmSDK.BmGame.RConfig,
     /// </summary>
     public unsafe bool bAllowTurningToAim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 1; else *(int*)(Ptr + 76) &= ~1; }
     }
 
     /// <summary>
@@ -87,11 +87,7 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: AddAnim
         /// </summary>
-        public unsafe BmSDK.FName AddAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName AddAnim;
 
         /// <summary>
         /// ObjectProperty: CustomAddAnim
@@ -105,11 +101,7 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: SubtractAnim
         /// </summary>
-        public unsafe BmSDK.FName SubtractAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.FName SubtractAnim;
 
         /// <summary>
         /// ObjectProperty: CustomSubtractAnim
@@ -123,29 +115,17 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: SubtractMode
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode SubtractMode
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode SubtractMode;
 
         /// <summary>
         /// StructProperty: Weight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public BmSDK.BmGame.RAnimConfig.FWeight Weight;
 
         /// <summary>
         /// StructProperty: HideWeight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight HideWeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.BmGame.RAnimConfig.FWeight HideWeight;
     }
 
     /// <summary>
@@ -157,38 +137,22 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: AddAnim
         /// </summary>
-        public unsafe BmSDK.FName AddAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName AddAnim;
 
         /// <summary>
         /// NameProperty: SubtractAnim
         /// </summary>
-        public unsafe BmSDK.FName SubtractAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName SubtractAnim;
 
         /// <summary>
         /// ByteProperty: SubtractMode
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode SubtractMode
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode SubtractMode;
 
         /// <summary>
         /// StructProperty: Weight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.BmGame.RAnimConfig.FWeight Weight;
     }
 
     /// <summary>
@@ -197,14 +161,12 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 40)]
     public partial record struct FCustomAnimConfig
     {
+        [FieldOffset(36)] private int _bitfield36;
+
         /// <summary>
         /// NameProperty: FullBodyAnim
         /// </summary>
-        public unsafe BmSDK.FName FullBodyAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName FullBodyAnim;
 
         /// <summary>
         /// ObjectProperty: CustomFullBodyAnim
@@ -218,11 +180,7 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: UpperBodyAnim
         /// </summary>
-        public unsafe BmSDK.FName UpperBodyAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.FName UpperBodyAnim;
 
         /// <summary>
         /// ObjectProperty: CustomUpperBodyAnim
@@ -245,11 +203,7 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: PresetAimingConfig
         /// </summary>
-        public unsafe BmSDK.BmGame.RPresetAimingConfigs.EPresetAimingConfig PresetAimingConfig
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPresetAimingConfigs.EPresetAimingConfig>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public BmSDK.BmGame.RPresetAimingConfigs.EPresetAimingConfig PresetAimingConfig;
 
         /// <summary>
         /// ObjectProperty: Directions
@@ -263,19 +217,19 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: DontConsumeAdditiveWeight
         /// </summary>
-        public unsafe bool DontConsumeAdditiveWeight
+        public bool DontConsumeAdditiveWeight
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 1) != 0;
+            set { if (value) _bitfield36 |= 1; else _bitfield36 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: PerAnimAiming
         /// </summary>
-        public unsafe bool PerAnimAiming
+        public bool PerAnimAiming
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 2) != 0;
+            set { if (value) _bitfield36 |= 2; else _bitfield36 &= ~2; }
         }
     }
 
@@ -285,23 +239,17 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 36)]
     public partial record struct FAnimConfig
     {
+        [FieldOffset(32)] private int _bitfield32;
+
         /// <summary>
         /// NameProperty: FullBodyAnim
         /// </summary>
-        public unsafe BmSDK.FName FullBodyAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName FullBodyAnim;
 
         /// <summary>
         /// NameProperty: UpperBodyAnim
         /// </summary>
-        public unsafe BmSDK.FName UpperBodyAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName UpperBodyAnim;
 
         /// <summary>
         /// ObjectProperty: AimingConfig
@@ -315,11 +263,7 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: PresetAimingConfig
         /// </summary>
-        public unsafe BmSDK.BmGame.RPresetAimingConfigs.EPresetAimingConfig PresetAimingConfig
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPresetAimingConfigs.EPresetAimingConfig>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.BmGame.RPresetAimingConfigs.EPresetAimingConfig PresetAimingConfig;
 
         /// <summary>
         /// ObjectProperty: Directions
@@ -333,28 +277,24 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: AdditiveSubtractMode
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode AdditiveSubtractMode
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public BmSDK.BmGame.RAnimConfig.EAdditiveSubtractMode AdditiveSubtractMode;
 
         /// <summary>
         /// BoolProperty: DontConsumeAdditiveWeight
         /// </summary>
-        public unsafe bool DontConsumeAdditiveWeight
+        public bool DontConsumeAdditiveWeight
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 1) != 0;
+            set { if (value) _bitfield32 |= 1; else _bitfield32 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: PerAnimAiming
         /// </summary>
-        public unsafe bool PerAnimAiming
+        public bool PerAnimAiming
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 2) != 0;
+            set { if (value) _bitfield32 |= 2; else _bitfield32 &= ~2; }
         }
     }
 
@@ -388,10 +328,6 @@ public partial class RAnimConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Value
         /// </summary>
-        public unsafe float Value
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Value;
     }
 }
@@ -83,7 +83,7 @@ public partial class RAnimNode_Additive : BmSDK.Engine.AnimNodeBlendBase, BmSDK.
     /// </summary>
     public unsafe float Weight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class RAnimNode_Bat : BmSDK.Engine.AnimNode, BmSDK.IGameObject
     /// </summary>
     public unsafe float RandomTimeOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(float*)(Ptr + 208); }
+        set { *(float*)(Ptr + 208) = value; }
     }
 }
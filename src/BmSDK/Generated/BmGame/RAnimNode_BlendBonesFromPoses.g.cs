@@ -78,41 +78,41 @@ public partial class RAnimNode_BlendBonesFromPoses : BmSDK.Engine.AnimNodeBlendB
         where TComponent : class, Framework.IScriptComponent<RAnimNode_BlendBonesFromPoses>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetTargetBlendWeightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetTargetBlendWeight_Params
+    {
+        [FieldOffset(0)] public float NewTargetWeight;
+        [FieldOffset(4)] public float NewTargetBlendDuration;
+    }
+
     /// <summary>
     /// Function: SetTargetBlendWeight
     /// </summary>
     public unsafe virtual void SetTargetBlendWeight(float NewTargetWeight, float NewTargetBlendDuration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_BlendBonesFromPoses.SetTargetBlendWeight", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTargetWeight, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTargetBlendDuration, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetTargetBlendWeightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_BlendBonesFromPoses.SetTargetBlendWeight", true);
+        var parms = new SetTargetBlendWeight_Params();
+        parms.NewTargetWeight = NewTargetWeight;
+        parms.NewTargetBlendDuration = NewTargetBlendDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetBlendPosesFromSkeletalMeshCompFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetBlendPosesFromSkeletalMeshComp_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetBlendPosesFromSkeletalMeshComp
     /// </summary>
     public unsafe virtual void SetBlendPosesFromSkeletalMeshComp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_BlendBonesFromPoses.SetBlendPosesFromSkeletalMeshComp", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetBlendPosesFromSkeletalMeshCompFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_BlendBonesFromPoses.SetBlendPosesFromSkeletalMeshComp", true);
+        var parms = new SetBlendPosesFromSkeletalMeshComp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -130,8 +130,8 @@ public partial class RAnimNode_BlendBonesFromPoses : BmSDK.Engine.AnimNodeBlendB
     /// </summary>
     public unsafe float TargetBlendWeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(float*)(Ptr + 240); }
+        set { *(float*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -139,8 +139,8 @@ public partial class RAnimNode_BlendBonesFromPoses : BmSDK.Engine.AnimNodeBlendB
     /// </summary>
     public unsafe float TargetBlendDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(float*)(Ptr + 244); }
+        set { *(float*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -167,59 +167,41 @@ public partial class RAnimNode_BlendBonesFromPoses : BmSDK.Engine.AnimNodeBlendB
     [StructLayout(LayoutKind.Explicit, Size = 68)]
     public partial record struct FBlendBoneData
     {
+        [FieldOffset(48)] private int _bitfield48;
+
         /// <summary>
         /// NameProperty: BoneName
         /// </summary>
-        public unsafe BmSDK.FName BoneName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName BoneName;
 
         /// <summary>
         /// StructProperty: PoseRotation
         /// </summary>
-        public unsafe BmSDK.GameObject.FQuat PoseRotation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FQuat>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.GameObject.FQuat PoseRotation;
 
         /// <summary>
         /// StructProperty: PoseTranslation
         /// </summary>
-        public unsafe System.Numerics.Vector3 PoseTranslation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public System.Numerics.Vector3 PoseTranslation;
 
         /// <summary>
         /// FloatProperty: PoseScale
         /// </summary>
-        public unsafe float PoseScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float PoseScale;
 
         /// <summary>
         /// BoolProperty: bMaintainOrigChildRotation
         /// </summary>
-        public unsafe bool bMaintainOrigChildRotation
+        public bool bMaintainOrigChildRotation
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }; }
+            readonly get => (_bitfield48 & 1) != 0;
+            set { if (value) _bitfield48 |= 1; else _bitfield48 &= ~1; }
         }
 
         /// <summary>
         /// IntProperty: BoneIndex
         /// </summary>
-        public unsafe int BoneIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public int BoneIndex;
 
         /// <summary>
         /// ArrayProperty: ChildBoneIndices
@@ -78,43 +78,53 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
         where TComponent : class, Framework.IScriptComponent<RAnimNode_Cape>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetAnimTreeNodeBlendValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetAnimTreeNodeBlendValue_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName setNodeName;
+        [FieldOffset(8)] public float blendValue;
+    }
+
     /// <summary>
     /// Function: SetAnimTreeNodeBlendValue
     /// </summary>
     public unsafe virtual void SetAnimTreeNodeBlendValue(BmSDK.FName setNodeName, float blendValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.SetAnimTreeNodeBlendValue", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(setNodeName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(blendValue, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetAnimTreeNodeBlendValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.SetAnimTreeNodeBlendValue", true);
+        var parms = new SetAnimTreeNodeBlendValue_Params();
+        parms.setNodeName = setNodeName;
+        parms.blendValue = blendValue;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAnimTreeNodeBlendValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetAnimTreeNodeBlendValue_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName getNodeName;
+        [FieldOffset(8)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAnimTreeNodeBlendValue
     /// </summary>
     public unsafe virtual float GetAnimTreeNodeBlendValue(BmSDK.FName getNodeName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetAnimTreeNodeBlendValue", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(getNodeName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_GetAnimTreeNodeBlendValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetAnimTreeNodeBlendValue", true);
+        var parms = new GetAnimTreeNodeBlendValue_Params();
+        parms.getNodeName = getNodeName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetStateAnimNodeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetStateAnimNode_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName AnimStateName;
+        [FieldOffset(8)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -122,18 +132,18 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe virtual BmSDK.Engine.AnimNode GetStateAnimNode(BmSDK.FName AnimStateName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetStateAnimNode", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimStateName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimNode>(paramsPtr + 8);
+        var funcManaged = s_GetStateAnimNodeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetStateAnimNode", true);
+        var parms = new GetStateAnimNode_Params();
+        parms.AnimStateName = AnimStateName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AnimNode)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetCurrentCapeAnimNodeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetCurrentCapeAnimNode_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -141,17 +151,17 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe virtual BmSDK.Engine.AnimNode GetCurrentCapeAnimNode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetCurrentCapeAnimNode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimNode>(paramsPtr + 0);
+        var funcManaged = s_GetCurrentCapeAnimNodeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetCurrentCapeAnimNode", true);
+        var parms = new GetCurrentCapeAnimNode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AnimNode)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetNumBonesInCapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetNumBonesInCape_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -159,17 +169,17 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe virtual int GetNumBonesInCape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetNumBonesInCape", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetNumBonesInCapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetNumBonesInCape", true);
+        var parms = new GetNumBonesInCape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetHasCurrentAnimEndedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetHasCurrentAnimEnded_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -177,17 +187,16 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe virtual bool GetHasCurrentAnimEnded()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetHasCurrentAnimEnded", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_GetHasCurrentAnimEndedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.GetHasCurrentAnimEnded", true);
+        var parms = new GetHasCurrentAnimEnded_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ResumeAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResumeAnim_Params
+    {
     }
 
     /// <summary>
@@ -195,64 +204,67 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe virtual void ResumeAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.ResumeAnim", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ResumeAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.ResumeAnim", true);
+        var parms = new ResumeAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PauseAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PauseAnim_Params
+    {
+    }
+
     /// <summary>
     /// Function: PauseAnim
     /// </summary>
     public unsafe virtual void PauseAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.PauseAnim", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PauseAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.PauseAnim", true);
+        var parms = new PauseAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct ChangeAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewAnimName;
+        [FieldOffset(8)] public BmSDK.FName NewAnimNodeName;
+        [FieldOffset(16)] public int NewIsMirrored;
+        [FieldOffset(20)] public int isBlendOldAnim;
+        [FieldOffset(24)] public float BlendDuration;
+        [FieldOffset(28)] public int bBlendPose;
+        [FieldOffset(32)] public float PoseBlendDuration;
+        [FieldOffset(36)] public float AnimStartTime;
+        [FieldOffset(40)] public float AnimPlayRate;
+        [FieldOffset(44)] public BmSDK.FName SetParentTimeSyncAnimName;
+        [FieldOffset(52)] public float SetParentTimeSyncAnimOffset;
+        [FieldOffset(56)] public int bSetSyncParentAnimMirroredness;
+    }
+
     /// <summary>
     /// Function: ChangeAnim
     /// </summary>
     public unsafe virtual void ChangeAnim(BmSDK.FName NewAnimName, BmSDK.FName NewAnimNodeName = default, bool NewIsMirrored = default, bool isBlendOldAnim = default, float BlendDuration = default, bool bBlendPose = default, float PoseBlendDuration = default, float AnimStartTime = default, float AnimPlayRate = default, BmSDK.FName SetParentTimeSyncAnimName = default, float SetParentTimeSyncAnimOffset = default, bool bSetSyncParentAnimMirroredness = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.ChangeAnim", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewAnimName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewAnimNodeName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewIsMirrored, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(isBlendOldAnim, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendDuration, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bBlendPose, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PoseBlendDuration, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimStartTime, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPlayRate, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SetParentTimeSyncAnimName, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SetParentTimeSyncAnimOffset, paramsPtr + 52);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSetSyncParentAnimMirroredness, paramsPtr + 56);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ChangeAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimNode_Cape.ChangeAnim", true);
+        var parms = new ChangeAnim_Params();
+        parms.NewAnimName = NewAnimName;
+        parms.NewAnimNodeName = NewAnimNodeName;
+        parms.NewIsMirrored = NewIsMirrored ? 1 : 0;
+        parms.isBlendOldAnim = isBlendOldAnim ? 1 : 0;
+        parms.BlendDuration = BlendDuration;
+        parms.bBlendPose = bBlendPose ? 1 : 0;
+        parms.PoseBlendDuration = PoseBlendDuration;
+        parms.AnimStartTime = AnimStartTime;
+        parms.AnimPlayRate = AnimPlayRate;
+        parms.SetParentTimeSyncAnimName = SetParentTimeSyncAnimName;
+        parms.SetParentTimeSyncAnimOffset = SetParentTimeSyncAnimOffset;
+        parms.bSetSyncParentAnimMirroredness = bSetSyncParentAnimMirroredness ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -261,8 +273,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName DefaultAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(BmSDK.FName*)(Ptr + 228); }
+        set { *(BmSDK.FName*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -270,8 +282,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool bCinematic
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 1; else *(int*)(Ptr + 236) &= ~1; }
     }
 
     /// <summary>
@@ -279,8 +291,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool CurrCapeIsBlendOldAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 2; else *(int*)(Ptr + 236) &= ~2; }
     }
 
     /// <summary>
@@ -288,8 +300,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool CurrCapeIsBlendPose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 4; else *(int*)(Ptr + 236) &= ~4; }
     }
 
     /// <summary>
@@ -297,8 +309,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool NewCapeIsMirrored
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 8; else *(int*)(Ptr + 236) &= ~8; }
     }
 
     /// <summary>
@@ -306,8 +318,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool NewCapeIsBlendOldAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 16; else *(int*)(Ptr + 236) &= ~16; }
     }
 
     /// <summary>
@@ -315,8 +327,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool NewCapeIsBlendPose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 32; else *(int*)(Ptr + 236) &= ~32; }
     }
 
     /// <summary>
@@ -324,8 +336,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool bNewSyncParentAnimMirroredness
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 64; else *(int*)(Ptr + 236) &= ~64; }
     }
 
     /// <summary>
@@ -333,8 +345,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool ForceRestartAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 128; else *(int*)(Ptr + 236) &= ~128; }
     }
 
     /// <summary>
@@ -342,8 +354,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool HasCurrentAnimEnded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 256; else *(int*)(Ptr + 236) &= ~256; }
     }
 
     /// <summary>
@@ -351,8 +363,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool IsBlendWeightSettingEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 512; else *(int*)(Ptr + 236) &= ~512; }
     }
 
     /// <summary>
@@ -360,8 +372,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool bSyncParentAnimMirroredness
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 1024; else *(int*)(Ptr + 236) &= ~1024; }
     }
 
     /// <summary>
@@ -369,8 +381,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe bool IsAnimPaused
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 236); }
+        get { return (*(int*)(Ptr + 236) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 236) |= 2048; else *(int*)(Ptr + 236) &= ~2048; }
     }
 
     /// <summary>
@@ -378,8 +390,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float SliderPos
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(float*)(Ptr + 240); }
+        set { *(float*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -387,8 +399,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName CurrCapeAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(BmSDK.FName*)(Ptr + 244); }
+        set { *(BmSDK.FName*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -396,8 +408,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName CurrCapeAnimNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(BmSDK.FName*)(Ptr + 252); }
+        set { *(BmSDK.FName*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -405,8 +417,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float CurrCapeNewAnimBlendDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(float*)(Ptr + 260); }
+        set { *(float*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -414,8 +426,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float CurrCapeBlendPoseDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -423,8 +435,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName NewCapeAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(BmSDK.FName*)(Ptr + 268); }
+        set { *(BmSDK.FName*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -432,8 +444,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName NewCapeAnimNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(BmSDK.FName*)(Ptr + 276); }
+        set { *(BmSDK.FName*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -441,8 +453,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float NewCapeNewAnimBlendDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }
+        get { return *(float*)(Ptr + 284); }
+        set { *(float*)(Ptr + 284) = value; }
     }
 
     /// <summary>
@@ -450,8 +462,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float NewCapeBlendPoseDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(float*)(Ptr + 288); }
+        set { *(float*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -459,8 +471,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float NewAnimStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }
+        get { return *(float*)(Ptr + 292); }
+        set { *(float*)(Ptr + 292) = value; }
     }
 
     /// <summary>
@@ -468,8 +480,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float NewAnimPlayRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -477,8 +489,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName NewParentTimeSyncAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(BmSDK.FName*)(Ptr + 300); }
+        set { *(BmSDK.FName*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -486,8 +498,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float NewParentTimeSyncAnimOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(float*)(Ptr + 308); }
+        set { *(float*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -495,8 +507,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float ChangeAnimRequestTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(float*)(Ptr + 312); }
+        set { *(float*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -504,8 +516,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float RootBlendWeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(float*)(Ptr + 316); }
+        set { *(float*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -513,8 +525,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float Child1BlendWeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(float*)(Ptr + 320); }
+        set { *(float*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -522,8 +534,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float Child2BlendWeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(float*)(Ptr + 324); }
+        set { *(float*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -531,8 +543,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName ParentAttachBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(BmSDK.FName*)(Ptr + 328); }
+        set { *(BmSDK.FName*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -540,8 +552,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe int ParentAttachBoneIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(int*)(Ptr + 336); }
+        set { *(int*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -549,8 +561,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe int ParentAttachParentBoneIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(int*)(Ptr + 340); }
+        set { *(int*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -558,8 +570,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float CurrAnimPlayRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(float*)(Ptr + 344); }
+        set { *(float*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -567,8 +579,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName ParentTimeSyncAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -576,8 +588,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe float ParentTimeSyncAnimOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(float*)(Ptr + 356); }
+        set { *(float*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -621,8 +633,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName PoseBlendAnimNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -630,8 +642,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName StateAnimBlendNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -639,8 +651,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName PrevStateAnimMirrorNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -648,8 +660,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName PrevStateAnimNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.FName*)(Ptr + 432); }
+        set { *(BmSDK.FName*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -657,8 +669,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName CurrStateAnimMirrorNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(BmSDK.FName*)(Ptr + 440); }
+        set { *(BmSDK.FName*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -666,8 +678,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName CurrStateAnimNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(BmSDK.FName*)(Ptr + 448); }
+        set { *(BmSDK.FName*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -675,8 +687,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName BoneNameReadFormatString
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(BmSDK.FName*)(Ptr + 456); }
+        set { *(BmSDK.FName*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -684,8 +696,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.FName BoneNameWriteFormatString
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(BmSDK.FName*)(Ptr + 464); }
+        set { *(BmSDK.FName*)(Ptr + 464) = value; }
     }
 
     /// <summary>
@@ -693,8 +705,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe int ChainIndexingOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(int*)(Ptr + 472); }
+        set { *(int*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -702,8 +714,8 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
     /// </summary>
     public unsafe int LinkIndexingOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(int*)(Ptr + 476); }
+        set { *(int*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -787,20 +799,12 @@ public partial class RAnimNode_Cape : BmSDK.Engine.AnimNodeBlendBase, BmSDK.IGam
         /// <summary>
         /// IntProperty: ChainIndex
         /// </summary>
-        public unsafe int ChainIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int ChainIndex;
 
         /// <summary>
         /// IntProperty: LinkIndex
         /// </summary>
-        public unsafe int LinkIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int LinkIndex;
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RAnimNotify_AnimSpeech : BmSDK.BmGame.RAnimNotify_Script, B
     /// </summary>
     public unsafe bool IsEmote
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }
+        get { return (*(int*)(Ptr + 72) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 72) |= 1; else *(int*)(Ptr + 72) &= ~1; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RAnimNotify_AnimSpeech : BmSDK.BmGame.RAnimNotify_Script, B
     /// </summary>
     public unsafe bool CharacterFilter_Enabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }
+        get { return (*(int*)(Ptr + 72) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 72) |= 2; else *(int*)(Ptr + 72) &= ~2; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RAnimNotify_AnimSpeech : BmSDK.BmGame.RAnimNotify_Script, B
     /// </summary>
     public unsafe int Chance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(int*)(Ptr + 76); }
+        set { *(int*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -78,8 +78,8 @@ public partial class RAnimNotify_BeginEnd : BmSDK.Engine.AnimNotify, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_BeginEnd.EBeginEndType Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_BeginEnd.EBeginEndType>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_BeginEnd.EBeginEndType*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_BeginEnd.EBeginEndType*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RAnimNotify_BeginRagdoll : BmSDK.Engine.AnimNotify, BmSDK.I
     /// </summary>
     public unsafe float BlendInDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(float*)(Ptr + 44); }
+        set { *(float*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RAnimNotify_BeginRagdoll : BmSDK.Engine.AnimNotify, BmSDK.I
     /// </summary>
     public unsafe float BlendOutDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -113,8 +113,8 @@ public partial class RAnimNotify_BeginRagdoll : BmSDK.Engine.AnimNotify, BmSDK.I
     /// </summary>
     public unsafe bool MotorAll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1; else *(int*)(Ptr + 60) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RAnimNotify_BeginRagdoll : BmSDK.Engine.AnimNotify, BmSDK.I
     /// </summary>
     public unsafe float MotorSpringScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -137,7 +137,7 @@ public partial class RAnimNotify_BeginRagdoll : BmSDK.Engine.AnimNotify, BmSDK.I
     /// </summary>
     public unsafe float MotorDampingScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RAnimNotify_Camera : BmSDK.Engine.AnimNotify, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_Camera.CamNotifyType NotifyType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_Camera.CamNotifyType>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_Camera.CamNotifyType*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_Camera.CamNotifyType*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RAnimNotify_Camera : BmSDK.Engine.AnimNotify, BmSDK.IGameOb
     /// </summary>
     public unsafe float DesiredValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RAnimNotify_Camera : BmSDK.Engine.AnimNotify, BmSDK.IGameOb
     /// </summary>
     public unsafe float TimeToChange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
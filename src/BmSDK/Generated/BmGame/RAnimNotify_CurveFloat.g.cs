@@ -83,8 +83,8 @@ public partial class RAnimNotify_CurveFloat : BmSDK.Engine.AnimNotify, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.FName CurveName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RAnimNotify_CurveFloat : BmSDK.Engine.AnimNotify, BmSDK.IGa
     /// </summary>
     public unsafe float NewValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RAnimNotify_CurveFloat : BmSDK.Engine.AnimNotify, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_CurveFloat.EFloatControlType ControlType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_CurveFloat.EFloatControlType>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.BmGame.RAnimNotify_CurveFloat.EFloatControlType*)(Ptr + 56); }
+        set { *(BmSDK.BmGame.RAnimNotify_CurveFloat.EFloatControlType*)(Ptr + 56) = value; }
     }
 
     /// <summary>
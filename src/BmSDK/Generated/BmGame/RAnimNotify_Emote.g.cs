@@ -83,8 +83,8 @@ public partial class RAnimNotify_Emote : BmSDK.BmGame.RAnimNotify_Script, BmSDK.
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_Emote.EEmoteType EmoteType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_Emote.EEmoteType>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(BmSDK.BmGame.RAnimNotify_Emote.EEmoteType*)(Ptr + 68); }
+        set { *(BmSDK.BmGame.RAnimNotify_Emote.EEmoteType*)(Ptr + 68) = value; }
     }
 
     /// <summary>
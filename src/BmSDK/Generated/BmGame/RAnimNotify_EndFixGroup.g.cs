@@ -83,7 +83,7 @@ public partial class RAnimNotify_EndFixGroup : BmSDK.Engine.AnimNotify, BmSDK.IG
     /// </summary>
     public unsafe BmSDK.FName GroupName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class RAnimNotify_EndRagdoll : BmSDK.Engine.AnimNotify, BmSDK.IGa
     /// </summary>
     public unsafe float BlendOutDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(float*)(Ptr + 44); }
+        set { *(float*)(Ptr + 44) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RAnimNotify_FootPassing : BmSDK.Engine.AnimNotify, BmSDK.IG
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_FootPassing.EFootPassing Passing
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_FootPassing.EFootPassing>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_FootPassing.EFootPassing*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_FootPassing.EFootPassing*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RAnimNotify_FootSyncOut : BmSDK.Engine.AnimNotify, BmSDK.IG
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimUtil.EFootSyncPoint SyncPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.EFootSyncPoint>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimUtil.EFootSyncPoint*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimUtil.EFootSyncPoint*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class RAnimNotify_FootSyncOut : BmSDK.Engine.AnimNotify, BmSDK.IG
     /// </summary>
     public unsafe BmSDK.BmGame.RPoseConfig.EMovementSpeed Speed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.EMovementSpeed>(Ptr + 45); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 45); }
+        get { return *(BmSDK.BmGame.RPoseConfig.EMovementSpeed*)(Ptr + 45); }
+        set { *(BmSDK.BmGame.RPoseConfig.EMovementSpeed*)(Ptr + 45) = value; }
     }
 }
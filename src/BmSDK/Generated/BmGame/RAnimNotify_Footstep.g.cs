@@ -83,8 +83,8 @@ public partial class RAnimNotify_Footstep : BmSDK.Engine.AnimNotify, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_Footstep.EFoot Foot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_Footstep.EFoot>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_Footstep.EFoot*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_Footstep.EFoot*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RAnimNotify_Footstep : BmSDK.Engine.AnimNotify, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_Footstep.EContactType Contact
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_Footstep.EContactType>(Ptr + 45); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 45); }
+        get { return *(BmSDK.BmGame.RAnimNotify_Footstep.EContactType*)(Ptr + 45); }
+        set { *(BmSDK.BmGame.RAnimNotify_Footstep.EContactType*)(Ptr + 45) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RAnimNotify_Footstep : BmSDK.Engine.AnimNotify, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_Footstep.EFootstepSurfaceFinder SurfaceFinder
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_Footstep.EFootstepSurfaceFinder>(Ptr + 46); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 46); }
+        get { return *(BmSDK.BmGame.RAnimNotify_Footstep.EFootstepSurfaceFinder*)(Ptr + 46); }
+        set { *(BmSDK.BmGame.RAnimNotify_Footstep.EFootstepSurfaceFinder*)(Ptr + 46) = value; }
     }
 
     /// <summary>
@@ -78,8 +78,8 @@ public partial class RAnimNotify_IK : BmSDK.Engine.AnimNotify, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_IK.EIKHand Hand
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_IK.EIKHand>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_IK.EIKHand*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_IK.EIKHand*)(Ptr + 44) = value; }
     }
 
     /// <summary>
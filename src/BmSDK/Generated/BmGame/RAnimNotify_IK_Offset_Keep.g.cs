@@ -83,7 +83,7 @@ public partial class RAnimNotify_IK_Offset_Keep : BmSDK.BmGame.RAnimNotify_IK, B
     /// </summary>
     public unsafe float BlendOutDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 }
@@ -89,7 +89,7 @@ public partial class RAnimNotify_IdleConfigOutput : BmSDK.Engine.AnimNotify_Scri
     /// </summary>
     public unsafe BmSDK.FName KismetOutputName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(BmSDK.FName*)(Ptr + 72); }
+        set { *(BmSDK.FName*)(Ptr + 72) = value; }
     }
 }
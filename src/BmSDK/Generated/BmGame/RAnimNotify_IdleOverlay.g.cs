@@ -83,7 +83,7 @@ public partial class RAnimNotify_IdleOverlay : BmSDK.BmGame.RAnimNotify_Script,
     /// </summary>
     public unsafe bool bInUse
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 }
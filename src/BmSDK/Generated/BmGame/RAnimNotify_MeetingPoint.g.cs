@@ -84,31 +84,33 @@ public partial class RAnimNotify_MeetingPoint : BmSDK.Engine.AnimNotify, BmSDK.I
     [StructLayout(LayoutKind.Explicit, Size = 4)]
     public partial record struct FMeetingPointTranslationComponents
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: X
         /// </summary>
-        public unsafe bool X
+        public bool X
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Y
         /// </summary>
-        public unsafe bool Y
+        public bool Y
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: Z
         /// </summary>
-        public unsafe bool Z
+        public bool Z
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4) != 0;
+            set { if (value) _bitfield0 |= 4; else _bitfield0 &= ~4; }
         }
     }
 
@@ -118,31 +120,33 @@ public partial class RAnimNotify_MeetingPoint : BmSDK.Engine.AnimNotify, BmSDK.I
     [StructLayout(LayoutKind.Explicit, Size = 4)]
     public partial record struct FMeetingPointRotationComponents
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: Yaw
         /// </summary>
-        public unsafe bool Yaw
+        public bool Yaw
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Pitch
         /// </summary>
-        public unsafe bool Pitch
+        public bool Pitch
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: Roll
         /// </summary>
-        public unsafe bool Roll
+        public bool Roll
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4) != 0;
+            set { if (value) _bitfield0 |= 4; else _bitfield0 &= ~4; }
         }
     }
 
@@ -151,8 +155,8 @@ public partial class RAnimNotify_MeetingPoint : BmSDK.Engine.AnimNotify, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_MeetingPoint.EMeetingPointType Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_MeetingPoint.EMeetingPointType>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_MeetingPoint.EMeetingPointType*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_MeetingPoint.EMeetingPointType*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -160,8 +164,8 @@ public partial class RAnimNotify_MeetingPoint : BmSDK.Engine.AnimNotify, BmSDK.I
     /// </summary>
     public unsafe bool Rotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1; else *(int*)(Ptr + 48) &= ~1; }
     }
 
     /// <summary>
@@ -169,8 +173,8 @@ public partial class RAnimNotify_MeetingPoint : BmSDK.Engine.AnimNotify, BmSDK.I
     /// </summary>
     public unsafe bool Translation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 2; else *(int*)(Ptr + 48) &= ~2; }
     }
 
     /// <summary>
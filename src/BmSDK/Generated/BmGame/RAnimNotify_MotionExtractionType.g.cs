@@ -83,8 +83,8 @@ public partial class RAnimNotify_MotionExtractionType : BmSDK.Engine.AnimNotify,
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_MotionExtractionType.EMotionExtractionType Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_MotionExtractionType.EMotionExtractionType>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_MotionExtractionType.EMotionExtractionType*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_MotionExtractionType.EMotionExtractionType*)(Ptr + 44) = value; }
     }
 
     /// <summary>
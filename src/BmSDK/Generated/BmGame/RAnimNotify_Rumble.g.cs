@@ -92,7 +92,7 @@ public partial class RAnimNotify_Rumble : BmSDK.Engine.AnimNotify, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bPlayIfNotOnPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1; else *(int*)(Ptr + 48) &= ~1; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_SpawnParticleFX.BoneOrSocketSource BoneOrSocket
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_SpawnParticleFX.BoneOrSocketSource>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_SpawnParticleFX.BoneOrSocketSource*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_SpawnParticleFX.BoneOrSocketSource*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe BmSDK.FName SocketName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.FName*)(Ptr + 48); }
+        set { *(BmSDK.FName*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe BmSDK.FName SocketNameMirrored
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.FName*)(Ptr + 56); }
+        set { *(BmSDK.FName*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe bool AttachToBone
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe bool IgnoreBoneYaw
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 2; else *(int*)(Ptr + 68) &= ~2; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe bool IgnoreBonePitch
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 4; else *(int*)(Ptr + 68) &= ~4; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe bool IgnoreBoneRoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 8; else *(int*)(Ptr + 68) &= ~8; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe bool SnapToGround
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 16; else *(int*)(Ptr + 68) &= ~16; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe bool EditorPreview
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 32; else *(int*)(Ptr + 68) &= ~32; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RAnimNotify_SpawnParticleFX : BmSDK.Engine.AnimNotify, BmSD
     /// </summary>
     public unsafe int TranslucencySortPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(int*)(Ptr + 72); }
+        set { *(int*)(Ptr + 72) = value; }
     }
 
     /// <summary>
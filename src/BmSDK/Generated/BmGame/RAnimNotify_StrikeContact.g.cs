@@ -87,38 +87,22 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
         /// <summary>
         /// FloatProperty: CapeAnimDelay
         /// </summary>
-        public unsafe float CapeAnimDelay
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float CapeAnimDelay;
 
         /// <summary>
         /// FloatProperty: CapeStopAnimDelay
         /// </summary>
-        public unsafe float CapeStopAnimDelay
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float CapeStopAnimDelay;
 
         /// <summary>
         /// NameProperty: DestCapeStateName
         /// </summary>
-        public unsafe BmSDK.FName DestCapeStateName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName DestCapeStateName;
 
         /// <summary>
         /// NameProperty: CapeAnimName
         /// </summary>
-        public unsafe BmSDK.FName CapeAnimName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.FName CapeAnimName;
     }
 
     /// <summary>
@@ -127,103 +111,105 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
     [StructLayout(LayoutKind.Explicit, Size = 4)]
     public partial record struct FNotifyStrikeFlags
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: bDisableTargetCollision
         /// </summary>
-        public unsafe bool bDisableTargetCollision
+        public bool bDisableTargetCollision
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bCanBeFinalBlow
         /// </summary>
-        public unsafe bool bCanBeFinalBlow
+        public bool bCanBeFinalBlow
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bTravelsBeyondTarget
         /// </summary>
-        public unsafe bool bTravelsBeyondTarget
+        public bool bTravelsBeyondTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4) != 0;
+            set { if (value) _bitfield0 |= 4; else _bitfield0 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bCanPerformWithNoTarget
         /// </summary>
-        public unsafe bool bCanPerformWithNoTarget
+        public bool bCanPerformWithNoTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8) != 0;
+            set { if (value) _bitfield0 |= 8; else _bitfield0 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bCanPerformOnBlocker
         /// </summary>
-        public unsafe bool bCanPerformOnBlocker
+        public bool bCanPerformOnBlocker
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16) != 0;
+            set { if (value) _bitfield0 |= 16; else _bitfield0 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: bPrimeHitReaction
         /// </summary>
-        public unsafe bool bPrimeHitReaction
+        public bool bPrimeHitReaction
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 32) != 0;
+            set { if (value) _bitfield0 |= 32; else _bitfield0 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: bHitsLow
         /// </summary>
-        public unsafe bool bHitsLow
+        public bool bHitsLow
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 64) != 0;
+            set { if (value) _bitfield0 |= 64; else _bitfield0 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: bRemovesHelmet
         /// </summary>
-        public unsafe bool bRemovesHelmet
+        public bool bRemovesHelmet
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 128) != 0;
+            set { if (value) _bitfield0 |= 128; else _bitfield0 &= ~128; }
         }
 
         /// <summary>
         /// BoolProperty: bCanBeMirrored
         /// </summary>
-        public unsafe bool bCanBeMirrored
+        public bool bCanBeMirrored
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 256) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 256) != 0;
+            set { if (value) _bitfield0 |= 256; else _bitfield0 &= ~256; }
         }
 
         /// <summary>
         /// BoolProperty: bPreStrike
         /// </summary>
-        public unsafe bool bPreStrike
+        public bool bPreStrike
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 512) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 512) != 0;
+            set { if (value) _bitfield0 |= 512; else _bitfield0 &= ~512; }
         }
 
         /// <summary>
         /// BoolProperty: bOverrideMovementExit
         /// </summary>
-        public unsafe bool bOverrideMovementExit
+        public bool bOverrideMovementExit
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1024) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1024) != 0;
+            set { if (value) _bitfield0 |= 1024; else _bitfield0 &= ~1024; }
         }
     }
 
@@ -236,101 +222,57 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
         /// <summary>
         /// NameProperty: HitReactionAnimName
         /// </summary>
-        public unsafe BmSDK.FName HitReactionAnimName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName HitReactionAnimName;
 
         /// <summary>
         /// ByteProperty: DamageBone
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.BoneNameList DamageBone
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.BoneNameList>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.BmGame.RPawnPlayerCombat.BoneNameList DamageBone;
 
         /// <summary>
         /// ByteProperty: DamageImpactBone
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.BoneNameList DamageImpactBone
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.BoneNameList>(Ptr + 9); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 9); }; }
-        }
+        [FieldOffset(9)] public BmSDK.BmGame.RPawnPlayerCombat.BoneNameList DamageImpactBone;
 
         /// <summary>
         /// ByteProperty: Strike_PlayerStrikingBone
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.BoneNameList Strike_PlayerStrikingBone
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.BoneNameList>(Ptr + 10); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 10); }; }
-        }
+        [FieldOffset(10)] public BmSDK.BmGame.RPawnPlayerCombat.BoneNameList Strike_PlayerStrikingBone;
 
         /// <summary>
         /// ByteProperty: Strike_TargetImpactBone
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.BoneNameList Strike_TargetImpactBone
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.BoneNameList>(Ptr + 11); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 11); }; }
-        }
+        [FieldOffset(11)] public BmSDK.BmGame.RPawnPlayerCombat.BoneNameList Strike_TargetImpactBone;
 
         /// <summary>
         /// FloatProperty: DamageCollisionRadius
         /// </summary>
-        public unsafe float DamageCollisionRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float DamageCollisionRadius;
 
         /// <summary>
         /// FloatProperty: DamageCollisionDuration
         /// </summary>
-        public unsafe float DamageCollisionDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float DamageCollisionDuration;
 
         /// <summary>
         /// StructProperty: DamageCollisionProjection
         /// </summary>
-        public unsafe System.Numerics.Vector3 DamageCollisionProjection
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public System.Numerics.Vector3 DamageCollisionProjection;
 
         /// <summary>
         /// StructProperty: DamageDirection
         /// </summary>
-        public unsafe System.Numerics.Vector3 DamageDirection
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public System.Numerics.Vector3 DamageDirection;
 
         /// <summary>
         /// FloatProperty: DamageForceMultiplier
         /// </summary>
-        public unsafe float DamageForceMultiplier
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float DamageForceMultiplier;
 
         /// <summary>
         /// ByteProperty: DamageARF
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnCombat.AdditionalRagdollForce DamageARF
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnCombat.AdditionalRagdollForce>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public BmSDK.BmGame.RPawnCombat.AdditionalRagdollForce DamageARF;
     }
 
     /// <summary>
@@ -342,20 +284,12 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
         /// <summary>
         /// ByteProperty: StrikeCameraDirection
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.CameraDirection StrikeCameraDirection
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.CameraDirection>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnPlayerCombat.CameraDirection StrikeCameraDirection;
 
         /// <summary>
         /// IntProperty: Dummy
         /// </summary>
-        public unsafe int Dummy
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int Dummy;
     }
 
     /// <summary>
@@ -393,8 +327,8 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
     /// </summary>
     public unsafe int UnlockChapter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(int*)(Ptr + 144); }
+        set { *(int*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -402,8 +336,8 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
     /// </summary>
     public unsafe int CombatSetID
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(int*)(Ptr + 148); }
+        set { *(int*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -411,8 +345,8 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
     /// </summary>
     public unsafe bool bNoTrail
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }
+        get { return (*(int*)(Ptr + 152) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 152) |= 1; else *(int*)(Ptr + 152) &= ~1; }
     }
 
     /// <summary>
@@ -420,8 +354,8 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
     /// </summary>
     public unsafe bool bActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }
+        get { return (*(int*)(Ptr + 152) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 152) |= 2; else *(int*)(Ptr + 152) &= ~2; }
     }
 
     /// <summary>
@@ -433,82 +367,46 @@ public partial class RAnimNotify_StrikeContact : BmSDK.Engine.AnimNotify, BmSDK.
         /// <summary>
         /// ByteProperty: StrikeDir
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeDirection StrikeDir
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeDirection>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeDirection StrikeDir;
 
         /// <summary>
         /// ByteProperty: StrikeHand
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeHand StrikeHand
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeHand>(Ptr + 1); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1); }; }
-        }
+        [FieldOffset(1)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeHand StrikeHand;
 
         /// <summary>
         /// ByteProperty: StrikeStrength
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeStrength StrikeStrength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeStrength>(Ptr + 2); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2); }; }
-        }
+        [FieldOffset(2)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeStrength StrikeStrength;
 
         /// <summary>
         /// ByteProperty: StrikeRange
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeRange StrikeRange
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeRange>(Ptr + 3); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3); }; }
-        }
+        [FieldOffset(3)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeRange StrikeRange;
 
         /// <summary>
         /// ByteProperty: PrevStrikeHand
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeHand PrevStrikeHand
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeHand>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeHand PrevStrikeHand;
 
         /// <summary>
         /// ByteProperty: StrikeDmgDir
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeDamageDirection StrikeDmgDir
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeDamageDirection>(Ptr + 5); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5); }; }
-        }
+        [FieldOffset(5)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeDamageDirection StrikeDmgDir;
 
         /// <summary>
         /// ByteProperty: StrikeTurnMotion
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeTurnMotion StrikeTurnMotion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeTurnMotion>(Ptr + 6); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6); }; }
-        }
+        [FieldOffset(6)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeTurnMotion StrikeTurnMotion;
 
         /// <summary>
         /// ByteProperty: PrevStrikeTurnMotion
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeTurnMotion PrevStrikeTurnMotion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeTurnMotion>(Ptr + 7); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7); }; }
-        }
+        [FieldOffset(7)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeTurnMotion PrevStrikeTurnMotion;
 
         /// <summary>
         /// ByteProperty: StrikeTargetType
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeTargetType StrikeTargetType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeTargetType>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.BmGame.RPawnPlayerCombat.StrikeTargetType StrikeTargetType;
     }
 }
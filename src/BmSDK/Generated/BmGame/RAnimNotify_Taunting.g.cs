@@ -83,7 +83,7 @@ public partial class RAnimNotify_Taunting : BmSDK.Engine.AnimNotify, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.BmGame.RGameRI.ETauntNotifyType Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameRI.ETauntNotifyType>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RGameRI.ETauntNotifyType*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RGameRI.ETauntNotifyType*)(Ptr + 44) = value; }
     }
 }
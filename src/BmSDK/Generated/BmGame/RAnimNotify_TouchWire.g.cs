@@ -93,8 +93,8 @@ public partial class RAnimNotify_TouchWire : BmSDK.Engine.AnimNotify, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnPlayer.OverheadRopeControlPointType LimbType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.OverheadRopeControlPointType>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RPawnPlayer.OverheadRopeControlPointType*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RPawnPlayer.OverheadRopeControlPointType*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -102,8 +102,8 @@ public partial class RAnimNotify_TouchWire : BmSDK.Engine.AnimNotify, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_TouchWire.LimbOnOrOff OnOrOff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_TouchWire.LimbOnOrOff>(Ptr + 45); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 45); }
+        get { return *(BmSDK.BmGame.RAnimNotify_TouchWire.LimbOnOrOff*)(Ptr + 45); }
+        set { *(BmSDK.BmGame.RAnimNotify_TouchWire.LimbOnOrOff*)(Ptr + 45) = value; }
     }
 
     /// <summary>
@@ -111,7 +111,7 @@ public partial class RAnimNotify_TouchWire : BmSDK.Engine.AnimNotify, BmSDK.IGam
     /// </summary>
     public unsafe bool CanBeLastLimbToComeOff
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1; else *(int*)(Ptr + 48) &= ~1; }
     }
 }
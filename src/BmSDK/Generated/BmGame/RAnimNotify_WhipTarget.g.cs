@@ -83,8 +83,8 @@ public partial class RAnimNotify_WhipTarget : BmSDK.Engine.AnimNotify, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimNotify_WhipTarget.WhipTargetingType TargetingType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimNotify_WhipTarget.WhipTargetingType>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.RAnimNotify_WhipTarget.WhipTargetingType*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.RAnimNotify_WhipTarget.WhipTargetingType*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RAnimNotify_WhipTarget : BmSDK.Engine.AnimNotify, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.FName TargetingStartBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.FName*)(Ptr + 48); }
+        set { *(BmSDK.FName*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RAnimNotify_WhipTarget : BmSDK.Engine.AnimNotify, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.FName TargetingEndBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.FName*)(Ptr + 56); }
+        set { *(BmSDK.FName*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -100,20 +100,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: HeadIndex
         /// </summary>
-        public unsafe int HeadIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int HeadIndex;
 
         /// <summary>
         /// IntProperty: GundummyIndex
         /// </summary>
-        public unsafe int GundummyIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int GundummyIndex;
     }
 
     /// <summary>
@@ -122,119 +114,121 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 52)]
     public partial record struct FDirectionalAnimState
     {
+        [FieldOffset(48)] private int _bitfield48;
+
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 8) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_5
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 20) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_6
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 24) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_7
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 28) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_8
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 32); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 32) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_9
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 36); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 36) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_10
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 40) = value; }; }
         }
         /// <summary>
         /// StructProperty: Weights
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weights_11
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 44); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimConfig.FWeight*)(Ptr + 44) = value; }; }
         }
 
         /// <summary>
         /// BoolProperty: InsideSetWeights
         /// </summary>
-        public unsafe bool InsideSetWeights
+        public bool InsideSetWeights
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }; }
+            readonly get => (_bitfield48 & 1) != 0;
+            set { if (value) _bitfield48 |= 1; else _bitfield48 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Active
         /// </summary>
-        public unsafe bool Active
+        public bool Active
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }; }
+            readonly get => (_bitfield48 & 2) != 0;
+            set { if (value) _bitfield48 |= 2; else _bitfield48 &= ~2; }
         }
     }
 
@@ -249,58 +243,54 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimCycle Data_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimCycle>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimCycle Data_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimCycle>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimCycle Data_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimCycle>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 32); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 32) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimCycle Data_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimCycle>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 48); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 48) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimCycle Data_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimCycle>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 64); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 64) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimCycle Data_5
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimCycle>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 80); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimCycle*)(Ptr + 80) = value; }; }
         }
 
         /// <summary>
         /// IntProperty: Num
         /// </summary>
-        public unsafe int Num
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public int Num;
     }
 
     /// <summary>
@@ -314,32 +304,32 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// </summary>
         public unsafe float FootSyncPointTimes_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// FloatProperty: FootSyncPointTimes
         /// </summary>
         public unsafe float FootSyncPointTimes_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: FootSyncPointTimes
         /// </summary>
         public unsafe float FootSyncPointTimes_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
         /// <summary>
         /// FloatProperty: FootSyncPointTimes
         /// </summary>
         public unsafe float FootSyncPointTimes_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
     }
 
@@ -352,20 +342,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Phase
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FCyclePhase Phase
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FCyclePhase>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil.FCyclePhase Phase;
 
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Time;
     }
 
     /// <summary>
@@ -377,20 +359,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: FootSyncPoint
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.EFootSyncPoint FootSyncPoint
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.EFootSyncPoint>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil.EFootSyncPoint FootSyncPoint;
 
         /// <summary>
         /// IntProperty: LoopIndex
         /// </summary>
-        public unsafe int LoopIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int LoopIndex;
     }
 
     /// <summary>
@@ -430,11 +404,7 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Time;
 
         /// <summary>
         /// ArrayProperty: Thoughts
@@ -452,32 +422,26 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 40)]
     public partial record struct FAnimTarget
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: IsActive
         /// </summary>
-        public unsafe bool IsActive
+        public bool IsActive
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: Position
         /// </summary>
-        public unsafe System.Numerics.Vector3 Position
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 Position;
 
         /// <summary>
         /// ByteProperty: PositionSpace
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.EAbsoluteOrRelative PositionSpace
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.EAbsoluteOrRelative>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.BmGame.RAnimUtil.EAbsoluteOrRelative PositionSpace;
 
         /// <summary>
         /// ObjectProperty: Actor
@@ -491,20 +455,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: ActorBoneName
         /// </summary>
-        public unsafe BmSDK.FName ActorBoneName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.FName ActorBoneName;
 
         /// <summary>
         /// NameProperty: Description
         /// </summary>
-        public unsafe BmSDK.FName Description
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.FName Description;
     }
 
     /// <summary>
@@ -516,20 +472,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Yaw
         /// </summary>
-        public unsafe float Yaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Yaw;
 
         /// <summary>
         /// FloatProperty: Pitch
         /// </summary>
-        public unsafe float Pitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Pitch;
     }
 
     /// <summary>
@@ -538,6 +486,8 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 20)]
     public partial record struct FNotifyAnim
     {
+        [FieldOffset(16)] private int _bitfield16;
+
         /// <summary>
         /// ObjectProperty: Sequence
         /// </summary>
@@ -550,19 +500,15 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Time
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan Time;
 
         /// <summary>
         /// BoolProperty: Mirrored
         /// </summary>
-        public unsafe bool Mirrored
+        public bool Mirrored
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 1) != 0;
+            set { if (value) _bitfield16 |= 1; else _bitfield16 &= ~1; }
         }
     }
 
@@ -587,29 +533,17 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Value
         /// </summary>
-        public unsafe float Value
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Value;
 
         /// <summary>
         /// FloatProperty: Target
         /// </summary>
-        public unsafe float Target
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Target;
 
         /// <summary>
         /// FloatProperty: Velocity
         /// </summary>
-        public unsafe float Velocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Velocity;
     }
 
     /// <summary>
@@ -632,74 +566,70 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement Cache_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// StructProperty: Cache
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement Cache_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// StructProperty: Cache
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement Cache_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 28) = value; }; }
         }
         /// <summary>
         /// StructProperty: Cache
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement Cache_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 40) = value; }; }
         }
         /// <summary>
         /// StructProperty: Cache
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement Cache_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 52); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 52) = value; }; }
         }
         /// <summary>
         /// StructProperty: Cache
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement Cache_5
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 64); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 64) = value; }; }
         }
         /// <summary>
         /// StructProperty: Cache
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement Cache_6
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 76); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 76) = value; }; }
         }
         /// <summary>
         /// StructProperty: Cache
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement Cache_7
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 88); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FAnimSequenceCacheElement*)(Ptr + 88) = value; }; }
         }
 
         /// <summary>
         /// IntProperty: NextCacheIndex
         /// </summary>
-        public unsafe int NextCacheIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }; }
-        }
+        [FieldOffset(100)] public int NextCacheIndex;
     }
 
     /// <summary>
@@ -765,104 +695,70 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 56)]
     public partial record struct FProportionalMotion
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: Enabled
         /// </summary>
-        public unsafe bool Enabled
+        public bool Enabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Teleport
         /// </summary>
-        public unsafe bool Teleport
+        public bool Teleport
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// FloatProperty: TranslationXProportion
         /// </summary>
-        public unsafe float TranslationXProportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float TranslationXProportion;
 
         /// <summary>
         /// FloatProperty: TranslationYProportion
         /// </summary>
-        public unsafe float TranslationYProportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float TranslationYProportion;
 
         /// <summary>
         /// FloatProperty: TranslationZProportion
         /// </summary>
-        public unsafe float TranslationZProportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float TranslationZProportion;
 
         /// <summary>
         /// StructProperty: Translation
         /// </summary>
-        public unsafe System.Numerics.Vector3 Translation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 Translation;
 
         /// <summary>
         /// FloatProperty: TranslationDistanceCap
         /// </summary>
-        public unsafe float TranslationDistanceCap
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float TranslationDistanceCap;
 
         /// <summary>
         /// FloatProperty: RotationYawProportion
         /// </summary>
-        public unsafe float RotationYawProportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float RotationYawProportion;
 
         /// <summary>
         /// FloatProperty: RotationPitchProportion
         /// </summary>
-        public unsafe float RotationPitchProportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float RotationPitchProportion;
 
         /// <summary>
         /// FloatProperty: RotationRollProportion
         /// </summary>
-        public unsafe float RotationRollProportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float RotationRollProportion;
 
         /// <summary>
         /// StructProperty: Rotation
         /// </summary>
-        public unsafe BmSDK.Rotator Rotation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public BmSDK.Rotator Rotation;
     }
 
     /// <summary>
@@ -874,20 +770,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Translation
         /// </summary>
-        public unsafe System.Numerics.Vector3 Translation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector3 Translation;
 
         /// <summary>
         /// FloatProperty: Yaw
         /// </summary>
-        public unsafe float Yaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float Yaw;
     }
 
     /// <summary>
@@ -917,11 +805,7 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: SubtractTime
         /// </summary>
-        public unsafe float SubtractTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float SubtractTime;
     }
 
     /// <summary>
@@ -951,29 +835,17 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: SubtractTime
         /// </summary>
-        public unsafe float SubtractTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float SubtractTime;
 
         /// <summary>
         /// StructProperty: Weight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RAnimConfig.FWeight Weight;
 
         /// <summary>
         /// StructProperty: HideWeight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight HideWeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.BmGame.RAnimConfig.FWeight HideWeight;
     }
 
     /// <summary>
@@ -982,6 +854,8 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 20)]
     public partial record struct FResolvedAnimConfig
     {
+        [FieldOffset(16)] private int _bitfield16;
+
         /// <summary>
         /// ObjectProperty: Parts
         /// </summary>
@@ -1020,19 +894,19 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: DontConsumeAdditiveWeight
         /// </summary>
-        public unsafe bool DontConsumeAdditiveWeight
+        public bool DontConsumeAdditiveWeight
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 1) != 0;
+            set { if (value) _bitfield16 |= 1; else _bitfield16 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: PerAnimAiming
         /// </summary>
-        public unsafe bool PerAnimAiming
+        public bool PerAnimAiming
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 2) != 0;
+            set { if (value) _bitfield16 |= 2; else _bitfield16 &= ~2; }
         }
     }
 
@@ -1045,65 +919,37 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: BlendUpper
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight BlendUpper
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimConfig.FWeight BlendUpper;
 
         /// <summary>
         /// StructProperty: BlendLower
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight BlendLower
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.BmGame.RAnimConfig.FWeight BlendLower;
 
         /// <summary>
         /// StructProperty: DataUpper
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight DataUpper
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.BmGame.RAnimConfig.FWeight DataUpper;
 
         /// <summary>
         /// StructProperty: DataLower
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight DataLower
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RAnimConfig.FWeight DataLower;
 
         /// <summary>
         /// StructProperty: Motion
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Motion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.BmGame.RAnimConfig.FWeight Motion;
 
         /// <summary>
         /// StructProperty: Aiming
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Aiming
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.BmGame.RAnimConfig.FWeight Aiming;
 
         /// <summary>
         /// StructProperty: Additive
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Additive
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.BmGame.RAnimConfig.FWeight Additive;
     }
 
     /// <summary>
@@ -1135,29 +981,17 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Current
         /// </summary>
-        public unsafe float Current
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Current;
 
         /// <summary>
         /// FloatProperty: Previous
         /// </summary>
-        public unsafe float Previous
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Previous;
 
         /// <summary>
         /// IntProperty: Wraps
         /// </summary>
-        public unsafe int Wraps
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int Wraps;
     }
 
     /// <summary>
@@ -1166,21 +1000,23 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 484)]
     public partial record struct FAnimConstants
     {
+        [FieldOffset(120)] private int _bitfield120;
+
         /// <summary>
         /// StructProperty: PartBones
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FArrayOfByte PartBones_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FArrayOfByte>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FArrayOfByte*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FArrayOfByte*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: PartBones
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FArrayOfByte PartBones_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FArrayOfByte>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FArrayOfByte*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FArrayOfByte*)(Ptr + 12) = value; }; }
         }
 
         /// <summary>
@@ -1197,177 +1033,177 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// </summary>
         public unsafe int BoneIndices_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 36); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 36) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 40) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 44); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 44) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 48); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 48) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 52); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 52) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_5
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 56); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 56) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_6
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 60); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 60) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_7
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 64); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 64) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_8
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 68); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 68) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_9
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 72); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 72) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_10
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 76); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 76) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_11
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 80); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 80) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_12
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 84); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 84) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_13
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 88); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 88) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_14
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 92); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 92) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_15
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 96); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 96) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_16
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 100); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 100) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_17
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 104); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 104) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_18
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 108); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 108) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_19
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 112); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 112) = value; }; }
         }
         /// <summary>
         /// IntProperty: BoneIndices
         /// </summary>
         public unsafe int BoneIndices_20
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 116); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 116) = value; }; }
         }
 
         /// <summary>
         /// BoolProperty: BoneIndicesAllPresent
         /// </summary>
-        public unsafe bool BoneIndicesAllPresent
+        public bool BoneIndicesAllPresent
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }; }
+            readonly get => (_bitfield120 & 1) != 0;
+            set { if (value) _bitfield120 |= 1; else _bitfield120 &= ~1; }
         }
 
         /// <summary>
@@ -1375,51 +1211,43 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// </summary>
         public unsafe int OptionalBoneIndices_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 124); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 124) = value; }; }
         }
         /// <summary>
         /// IntProperty: OptionalBoneIndices
         /// </summary>
         public unsafe int OptionalBoneIndices_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 128); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 128) = value; }; }
         }
         /// <summary>
         /// IntProperty: OptionalBoneIndices
         /// </summary>
         public unsafe int OptionalBoneIndices_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 132); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 132) = value; }; }
         }
         /// <summary>
         /// IntProperty: OptionalBoneIndices
         /// </summary>
         public unsafe int OptionalBoneIndices_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 136); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 136) = value; }; }
         }
 
         /// <summary>
         /// StructProperty: BodyIndices
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FRagdollIndices BodyIndices
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FRagdollIndices>(Ptr + 140); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }; }
-        }
+        [FieldOffset(140)] public BmSDK.BmGame.RAnimUtil.FRagdollIndices BodyIndices;
 
         /// <summary>
         /// StructProperty: ConstraintIndices
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FRagdollIndices ConstraintIndices
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FRagdollIndices>(Ptr + 284); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }; }
-        }
+        [FieldOffset(284)] public BmSDK.BmGame.RAnimUtil.FRagdollIndices ConstraintIndices;
 
         /// <summary>
         /// ArrayProperty: AllMainBodyIndices
@@ -1451,11 +1279,7 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: BoneMasses
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FBoneMasses BoneMasses
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FBoneMasses>(Ptr + 464); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }; }
-        }
+        [FieldOffset(464)] public BmSDK.BmGame.RAnimUtil.FBoneMasses BoneMasses;
     }
 
     /// <summary>
@@ -1476,20 +1300,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Total
         /// </summary>
-        public unsafe float Total
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float Total;
 
         /// <summary>
         /// FloatProperty: OneOverTotal
         /// </summary>
-        public unsafe float OneOverTotal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float OneOverTotal;
     }
 
     /// <summary>
@@ -1501,20 +1317,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: BoneIndex
         /// </summary>
-        public unsafe int BoneIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int BoneIndex;
 
         /// <summary>
         /// FloatProperty: Mass
         /// </summary>
-        public unsafe float Mass
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Mass;
     }
 
     /// <summary>
@@ -1691,112 +1499,114 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 4)]
     public partial record struct FRagdollParts
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: Spine
         /// </summary>
-        public unsafe bool Spine
+        public bool Spine
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Pelvis
         /// </summary>
-        public unsafe bool Pelvis
+        public bool Pelvis
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: Head
         /// </summary>
-        public unsafe bool Head
+        public bool Head
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4) != 0;
+            set { if (value) _bitfield0 |= 4; else _bitfield0 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: LeftUpperArm
         /// </summary>
-        public unsafe bool LeftUpperArm
+        public bool LeftUpperArm
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8) != 0;
+            set { if (value) _bitfield0 |= 8; else _bitfield0 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: LeftLowerArm
         /// </summary>
-        public unsafe bool LeftLowerArm
+        public bool LeftLowerArm
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16) != 0;
+            set { if (value) _bitfield0 |= 16; else _bitfield0 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: RightUpperArm
         /// </summary>
-        public unsafe bool RightUpperArm
+        public bool RightUpperArm
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 32) != 0;
+            set { if (value) _bitfield0 |= 32; else _bitfield0 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: RightLowerArm
         /// </summary>
-        public unsafe bool RightLowerArm
+        public bool RightLowerArm
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 64) != 0;
+            set { if (value) _bitfield0 |= 64; else _bitfield0 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: LeftUpperLeg
         /// </summary>
-        public unsafe bool LeftUpperLeg
+        public bool LeftUpperLeg
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 128) != 0;
+            set { if (value) _bitfield0 |= 128; else _bitfield0 &= ~128; }
         }
 
         /// <summary>
         /// BoolProperty: LeftLowerLeg
         /// </summary>
-        public unsafe bool LeftLowerLeg
+        public bool LeftLowerLeg
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 256) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 256) != 0;
+            set { if (value) _bitfield0 |= 256; else _bitfield0 &= ~256; }
         }
 
         /// <summary>
         /// BoolProperty: RightUpperLeg
         /// </summary>
-        public unsafe bool RightUpperLeg
+        public bool RightUpperLeg
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 512) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 512) != 0;
+            set { if (value) _bitfield0 |= 512; else _bitfield0 &= ~512; }
         }
 
         /// <summary>
         /// BoolProperty: RightLowerLeg
         /// </summary>
-        public unsafe bool RightLowerLeg
+        public bool RightLowerLeg
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1024) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1024) != 0;
+            set { if (value) _bitfield0 |= 1024; else _bitfield0 &= ~1024; }
         }
 
         /// <summary>
         /// BoolProperty: Misc
         /// </summary>
-        public unsafe bool Misc
+        public bool Misc
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2048) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2048) != 0;
+            set { if (value) _bitfield0 |= 2048; else _bitfield0 &= ~2048; }
         }
     }
 
@@ -1809,20 +1619,12 @@ public partial class RAnimUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: SourceBone
         /// </summary>
-        public unsafe int SourceBone
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int SourceBone;
 
         /// <summary>
         /// StructProperty: Action
         /// </summary>
-        public unsafe BmSDK.BmGame.RMirrorConfig.FMirrorAction Action
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RMirrorConfig.FMirrorAction>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.BmGame.RMirrorConfig.FMirrorAction Action;
     }
 
     /// <summary>
@@ -82,20 +82,12 @@ public partial class RAnimUtil_AdditiveAnimOutput : BmSDK.GameObject, BmSDK.IGam
         /// <summary>
         /// StructProperty: Anims
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AdditiveAnimOutput.FFinalAdditiveAnimArray Anims
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AdditiveAnimOutput.FFinalAdditiveAnimArray>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_AdditiveAnimOutput.FFinalAdditiveAnimArray Anims;
 
         /// <summary>
         /// StructProperty: MirroredAnims
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AdditiveAnimOutput.FFinalAdditiveAnimArray MirroredAnims
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AdditiveAnimOutput.FFinalAdditiveAnimArray>(Ptr + 1552); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1552); }; }
-        }
+        [FieldOffset(1552)] public BmSDK.BmGame.RAnimUtil_AdditiveAnimOutput.FFinalAdditiveAnimArray MirroredAnims;
     }
 
     /// <summary>
@@ -236,11 +228,7 @@ public partial class RAnimUtil_AdditiveAnimOutput : BmSDK.GameObject, BmSDK.IGam
         /// <summary>
         /// IntProperty: Num
         /// </summary>
-        public unsafe int Num
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1536); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1536); }; }
-        }
+        [FieldOffset(1536)] public int Num;
     }
 
     /// <summary>
@@ -252,20 +240,12 @@ public partial class RAnimUtil_AdditiveAnimOutput : BmSDK.GameObject, BmSDK.IGam
         /// <summary>
         /// StructProperty: AddMotionAtom
         /// </summary>
-        public unsafe BmSDK.GameObject.FBoneAtom AddMotionAtom
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FBoneAtom>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FBoneAtom AddMotionAtom;
 
         /// <summary>
         /// StructProperty: SubtractMotionAtom
         /// </summary>
-        public unsafe BmSDK.GameObject.FBoneAtom SubtractMotionAtom
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FBoneAtom>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.GameObject.FBoneAtom SubtractMotionAtom;
 
         /// <summary>
         /// ObjectProperty: Add
@@ -279,11 +259,7 @@ public partial class RAnimUtil_AdditiveAnimOutput : BmSDK.GameObject, BmSDK.IGam
         /// <summary>
         /// FloatProperty: AddTime
         /// </summary>
-        public unsafe float AddTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float AddTime;
 
         /// <summary>
         /// ObjectProperty: Subtract
@@ -297,19 +273,11 @@ public partial class RAnimUtil_AdditiveAnimOutput : BmSDK.GameObject, BmSDK.IGam
         /// <summary>
         /// FloatProperty: SubtractTime
         /// </summary>
-        public unsafe float SubtractTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
-        }
+        [FieldOffset(76)] public float SubtractTime;
 
         /// <summary>
         /// StructProperty: Weight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
-        }
+        [FieldOffset(80)] public BmSDK.BmGame.RAnimConfig.FWeight Weight;
     }
 }
@@ -118,11 +118,7 @@ public partial class RAnimUtil_AimingOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// StructProperty: References
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FAimingReferences References
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FAimingReferences>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public BmSDK.BmGame.RAnimUtil.FAimingReferences References;
     }
 
     /// <summary>
@@ -147,6 +143,8 @@ public partial class RAnimUtil_AimingOutput : BmSDK.GameObject, BmSDK.IGameObjec
     [StructLayout(LayoutKind.Explicit, Size = 28)]
     public partial record struct FAimingGroup
     {
+        [FieldOffset(12)] private int _bitfield12;
+
         /// <summary>
         /// ArrayProperty: Bones
         /// </summary>
@@ -159,29 +157,25 @@ public partial class RAnimUtil_AimingOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// BoolProperty: IsLeaf
         /// </summary>
-        public unsafe bool IsLeaf
+        public bool IsLeaf
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Active
         /// </summary>
-        public unsafe bool Active
+        public bool Active
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 2) != 0;
+            set { if (value) _bitfield12 |= 2; else _bitfield12 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: Proportion
         /// </summary>
-        public unsafe System.Numerics.Vector3 Proportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 Proportion;
     }
 
     /// <summary>
@@ -190,22 +184,20 @@ public partial class RAnimUtil_AimingOutput : BmSDK.GameObject, BmSDK.IGameObjec
     [StructLayout(LayoutKind.Explicit, Size = 8)]
     public partial record struct FAimingGroupBone
     {
+        [FieldOffset(4)] private int _bitfield4;
+
         /// <summary>
         /// ByteProperty: AimingBoneIndex
         /// </summary>
-        public unsafe byte AimingBoneIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public byte AimingBoneIndex;
 
         /// <summary>
         /// BoolProperty: Active
         /// </summary>
-        public unsafe bool Active
+        public bool Active
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1) != 0;
+            set { if (value) _bitfield4 |= 1; else _bitfield4 &= ~1; }
         }
     }
 
@@ -218,56 +210,32 @@ public partial class RAnimUtil_AimingOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// StructProperty: RefPose
         /// </summary>
-        public unsafe BmSDK.GameObject.FQuat RefPose
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FQuat>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FQuat RefPose;
 
         /// <summary>
         /// StructProperty: OneOverPositiveLimit
         /// </summary>
-        public unsafe System.Numerics.Vector3 OneOverPositiveLimit
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 OneOverPositiveLimit;
 
         /// <summary>
         /// StructProperty: OneOverNegativeLimit
         /// </summary>
-        public unsafe System.Numerics.Vector3 OneOverNegativeLimit
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector3 OneOverNegativeLimit;
 
         /// <summary>
         /// StructProperty: Proportion
         /// </summary>
-        public unsafe System.Numerics.Vector3 Proportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 Proportion;
 
         /// <summary>
         /// ByteProperty: BoneIndex
         /// </summary>
-        public unsafe byte BoneIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public byte BoneIndex;
 
         /// <summary>
         /// ByteProperty: ParentAimingBoneIndex
         /// </summary>
-        public unsafe byte ParentAimingBoneIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 53); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 53); }; }
-        }
+        [FieldOffset(53)] public byte ParentAimingBoneIndex;
     }
 
     /// <summary>
@@ -276,6 +244,8 @@ public partial class RAnimUtil_AimingOutput : BmSDK.GameObject, BmSDK.IGameObjec
     [StructLayout(LayoutKind.Explicit, Size = 12)]
     public partial record struct FWeightedAimingConfig
     {
+        [FieldOffset(8)] private int _bitfield8;
+
         /// <summary>
         /// ObjectProperty: Config
         /// </summary>
@@ -288,19 +258,15 @@ public partial class RAnimUtil_AimingOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// StructProperty: Weight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.BmGame.RAnimConfig.FWeight Weight;
 
         /// <summary>
         /// BoolProperty: Mirrored
         /// </summary>
-        public unsafe bool Mirrored
+        public bool Mirrored
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 1) != 0;
+            set { if (value) _bitfield8 |= 1; else _bitfield8 &= ~1; }
         }
     }
 }
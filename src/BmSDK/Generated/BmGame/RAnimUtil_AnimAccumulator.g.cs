@@ -84,85 +84,69 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FBodyWeight RemainingPoseWeight_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FBodyWeight>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: RemainingPoseWeight
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FBodyWeight RemainingPoseWeight_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FBodyWeight>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 28) = value; }; }
         }
         /// <summary>
         /// StructProperty: RemainingPoseWeight
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FBodyWeight RemainingPoseWeight_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FBodyWeight>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 56); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 56) = value; }; }
         }
         /// <summary>
         /// StructProperty: RemainingPoseWeight
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FBodyWeight RemainingPoseWeight_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FBodyWeight>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 84); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 84) = value; }; }
         }
         /// <summary>
         /// StructProperty: RemainingPoseWeight
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FBodyWeight RemainingPoseWeight_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FBodyWeight>(Ptr + 112); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 112); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 112) = value; }; }
         }
         /// <summary>
         /// StructProperty: RemainingPoseWeight
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil.FBodyWeight RemainingPoseWeight_5
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FBodyWeight>(Ptr + 140); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 140); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil.FBodyWeight*)(Ptr + 140) = value; }; }
         }
 
         /// <summary>
         /// StructProperty: AnimOutput
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSampleArray AnimOutput
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSampleArray>(Ptr + 168); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }; }
-        }
+        [FieldOffset(168)] public BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSampleArray AnimOutput;
 
         /// <summary>
         /// StructProperty: AdditiveAnimOutput
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSampleArray AdditiveAnimOutput
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSampleArray>(Ptr + 2476); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2476); }; }
-        }
+        [FieldOffset(2476)] public BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSampleArray AdditiveAnimOutput;
 
         /// <summary>
         /// StructProperty: MotionOutput
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FTranslationYaw MotionOutput
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FTranslationYaw>(Ptr + 3504); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3504); }; }
-        }
+        [FieldOffset(3504)] public BmSDK.BmGame.RAnimUtil.FTranslationYaw MotionOutput;
 
         /// <summary>
         /// StructProperty: ProportionalMotion
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FProportionalMotion ProportionalMotion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FProportionalMotion>(Ptr + 3520); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3520); }; }
-        }
+        [FieldOffset(3520)] public BmSDK.BmGame.RAnimUtil.FProportionalMotion ProportionalMotion;
     }
 
     /// <summary>
@@ -176,138 +160,134 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 64); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 64) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 128); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 128); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 128) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 192); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 192); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 192) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 256); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 256); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 256) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_5
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 320); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 320); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 320) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_6
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 384); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 384); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 384) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_7
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 448); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 448); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 448) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_8
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 512); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 512); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 512) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_9
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 576); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 576); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 576); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 576) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_10
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 640); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 640); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 640); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 640) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_11
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 704); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 704); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 704); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 704) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_12
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 768); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 768); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 768); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 768) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_13
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 832); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 832); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 832); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 832) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_14
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 896); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 896); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 896); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 896) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample Data_15
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample>(Ptr + 960); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 960); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 960); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAdditiveAnimSample*)(Ptr + 960) = value; }; }
         }
 
         /// <summary>
         /// IntProperty: Num
         /// </summary>
-        public unsafe int Num
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1024); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1024); }; }
-        }
+        [FieldOffset(1024)] public int Num;
     }
 
     /// <summary>
@@ -319,29 +299,17 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
         /// <summary>
         /// StructProperty: Sample
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FAdditiveAnimSample Sample
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FAdditiveAnimSample>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_AnimAccumulator.FAdditiveAnimSample Sample;
 
         /// <summary>
         /// StructProperty: Weight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public BmSDK.BmGame.RAnimConfig.FWeight Weight;
 
         /// <summary>
         /// StructProperty: MotionWeight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight MotionWeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public BmSDK.BmGame.RAnimConfig.FWeight MotionWeight;
     }
 
     /// <summary>
@@ -350,67 +318,49 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
     [StructLayout(LayoutKind.Explicit, Size = 56)]
     public partial record struct FAdditiveAnimSample
     {
+        [FieldOffset(52)] private int _bitfield52;
+
         /// <summary>
         /// StructProperty: AnimConfig
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FResolvedAdditiveAnimConfig AnimConfig
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FResolvedAdditiveAnimConfig>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil.FResolvedAdditiveAnimConfig AnimConfig;
 
         /// <summary>
         /// StructProperty: AddTime
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan AddTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan AddTime;
 
         /// <summary>
         /// ByteProperty: RootBoneSubtractionMode
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.ERootBoneSubtractionMode RootBoneSubtractionMode
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.ERootBoneSubtractionMode>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.BmGame.RAnimUtil.ERootBoneSubtractionMode RootBoneSubtractionMode;
 
         /// <summary>
         /// StructProperty: BeginRootBoneTranslationOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 BeginRootBoneTranslationOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector3 BeginRootBoneTranslationOffset;
 
         /// <summary>
         /// StructProperty: EndRootBoneTranslationOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 EndRootBoneTranslationOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 EndRootBoneTranslationOffset;
 
         /// <summary>
         /// BoolProperty: Mirrored
         /// </summary>
-        public unsafe bool Mirrored
+        public bool Mirrored
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }; }
+            readonly get => (_bitfield52 & 1) != 0;
+            set { if (value) _bitfield52 |= 1; else _bitfield52 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: IssueNotifies
         /// </summary>
-        public unsafe bool IssueNotifies
+        public bool IssueNotifies
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }; }
+            readonly get => (_bitfield52 & 2) != 0;
+            set { if (value) _bitfield52 |= 2; else _bitfield52 &= ~2; }
         }
     }
 
@@ -425,202 +375,198 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 96); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 96) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 192); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 192); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 192) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 288); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 288); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 288) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 384); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 384); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 384) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_5
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 480); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 480); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 480) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_6
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 576); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 576); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 576); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 576) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_7
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 672); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 672); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 672); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 672) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_8
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 768); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 768); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 768); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 768) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_9
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 864); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 864); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 864); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 864) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_10
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 960); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 960); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 960); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 960) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_11
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1056); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1056); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1056); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1056) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_12
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1152); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1152); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1152); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1152) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_13
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1248); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1248); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1248); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1248) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_14
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1344); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1344); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1344); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1344) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_15
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1440); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1440); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1440); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1440) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_16
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1536); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1536); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1536); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1536) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_17
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1632); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1632); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1632); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1632) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_18
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1728); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1728); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1728); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1728) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_19
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1824); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1824); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1824); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1824) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_20
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 1920); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1920); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1920); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 1920) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_21
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 2016); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2016); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 2016); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 2016) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_22
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 2112); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2112); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 2112); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 2112) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample Data_23
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample>(Ptr + 2208); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2208); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 2208); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimAccumulator.FWeightedAnimSample*)(Ptr + 2208) = value; }; }
         }
 
         /// <summary>
         /// IntProperty: Num
         /// </summary>
-        public unsafe int Num
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2304); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2304); }; }
-        }
+        [FieldOffset(2304)] public int Num;
     }
 
     /// <summary>
@@ -632,20 +578,12 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
         /// <summary>
         /// StructProperty: Sample
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimAccumulator.FAnimSample Sample
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimAccumulator.FAnimSample>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_AnimAccumulator.FAnimSample Sample;
 
         /// <summary>
         /// StructProperty: Weight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FBodyWeight Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FBodyWeight>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public BmSDK.BmGame.RAnimUtil.FBodyWeight Weight;
     }
 
     /// <summary>
@@ -654,6 +592,8 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
     [StructLayout(LayoutKind.Explicit, Size = 68)]
     public partial record struct FAnimSample
     {
+        [FieldOffset(64)] private int _bitfield64;
+
         /// <summary>
         /// ObjectProperty: UpperBodyAnim
         /// </summary>
@@ -684,20 +624,12 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
         /// <summary>
         /// StructProperty: Time
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan Time;
 
         /// <summary>
         /// ByteProperty: RootBoneSubtractionMode
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.ERootBoneSubtractionMode RootBoneSubtractionMode
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.ERootBoneSubtractionMode>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.BmGame.RAnimUtil.ERootBoneSubtractionMode RootBoneSubtractionMode;
 
         /// <summary>
         /// ObjectProperty: RootBoneSubtractionAnim
@@ -711,64 +643,48 @@ public partial class RAnimUtil_AnimAccumulator : BmSDK.GameObject, BmSDK.IGameOb
         /// <summary>
         /// FloatProperty: RootBoneExtractionYaw
         /// </summary>
-        public unsafe float RootBoneExtractionYaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float RootBoneExtractionYaw;
 
         /// <summary>
         /// FloatProperty: RootBoneExtractionScale
         /// </summary>
-        public unsafe float RootBoneExtractionScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float RootBoneExtractionScale;
 
         /// <summary>
         /// StructProperty: BeginRootBoneTranslationOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 BeginRootBoneTranslationOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 BeginRootBoneTranslationOffset;
 
         /// <summary>
         /// StructProperty: EndRootBoneTranslationOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 EndRootBoneTranslationOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public System.Numerics.Vector3 EndRootBoneTranslationOffset;
 
         /// <summary>
         /// BoolProperty: AllowNotifies
         /// </summary>
-        public unsafe bool AllowNotifies
+        public bool AllowNotifies
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }; }
+            readonly get => (_bitfield64 & 1) != 0;
+            set { if (value) _bitfield64 |= 1; else _bitfield64 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Mirrored
         /// </summary>
-        public unsafe bool Mirrored
+        public bool Mirrored
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }; }
+            readonly get => (_bitfield64 & 2) != 0;
+            set { if (value) _bitfield64 |= 2; else _bitfield64 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: PerAnimAiming
         /// </summary>
-        public unsafe bool PerAnimAiming
+        public bool PerAnimAiming
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }; }
+            readonly get => (_bitfield64 & 4) != 0;
+            set { if (value) _bitfield64 |= 4; else _bitfield64 &= ~4; }
         }
     }
 }
@@ -82,20 +82,12 @@ public partial class RAnimUtil_AnimOutput : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Anims
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArrays Anims
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArrays>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArrays Anims;
 
         /// <summary>
         /// StructProperty: MirroredAnims
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArrays MirroredAnims
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArrays>(Ptr + 1488); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1488); }; }
-        }
+        [FieldOffset(1488)] public BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArrays MirroredAnims;
     }
 
     /// <summary>
@@ -107,29 +99,17 @@ public partial class RAnimUtil_AnimOutput : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: FullBody
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray FullBody
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray FullBody;
 
         /// <summary>
         /// StructProperty: LowerBody
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray LowerBody
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray>(Ptr + 496); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }; }
-        }
+        [FieldOffset(496)] public BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray LowerBody;
 
         /// <summary>
         /// StructProperty: UpperBody
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray UpperBody
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray>(Ptr + 992); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 992); }; }
-        }
+        [FieldOffset(992)] public BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnimArray UpperBody;
     }
 
     /// <summary>
@@ -141,91 +121,87 @@ public partial class RAnimUtil_AnimOutput : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Num
         /// </summary>
-        public unsafe int Num
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int Num;
 
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 64); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 64) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 112); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 112); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 112) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 160); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 160); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 160) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 208); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 208); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 208) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_5
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 256); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 256); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 256) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_6
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 304); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 304); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 304) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_7
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 352); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 352); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 352) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_8
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 400); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 400); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 400) = value; }; }
         }
         /// <summary>
         /// StructProperty: Data
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim Data_9
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim>(Ptr + 448); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 448); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_AnimOutput.FFinalAnim*)(Ptr + 448) = value; }; }
         }
     }
 
@@ -238,11 +214,7 @@ public partial class RAnimUtil_AnimOutput : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: MotionAtom
         /// </summary>
-        public unsafe BmSDK.GameObject.FBoneAtom MotionAtom
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FBoneAtom>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FBoneAtom MotionAtom;
 
         /// <summary>
         /// ObjectProperty: Sequence
@@ -256,20 +228,12 @@ public partial class RAnimUtil_AnimOutput : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float Time;
 
         /// <summary>
         /// StructProperty: Weight
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FWeight Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FWeight>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public BmSDK.BmGame.RAnimConfig.FWeight Weight;
 
         /// <summary>
         /// ObjectProperty: PerAnimAimingConfig
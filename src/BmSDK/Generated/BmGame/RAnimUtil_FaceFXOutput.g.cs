@@ -101,8 +101,8 @@ public partial class RAnimUtil_FaceFXOutput : BmSDK.GameObject, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool ReduceBlinksAndEyeMovements
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }
+        get { return (*(int*)(Ptr + 72) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 72) |= 1; else *(int*)(Ptr + 72) &= ~1; }
     }
 
     /// <summary>
@@ -114,29 +114,17 @@ public partial class RAnimUtil_FaceFXOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// ByteProperty: SequenceState
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_FaceFXOutput.EBlinkSequenceState SequenceState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_FaceFXOutput.EBlinkSequenceState>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_FaceFXOutput.EBlinkSequenceState SequenceState;
 
         /// <summary>
         /// FloatProperty: RegisterValue
         /// </summary>
-        public unsafe float RegisterValue
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float RegisterValue;
 
         /// <summary>
         /// FloatProperty: TimeRemaining
         /// </summary>
-        public unsafe float TimeRemaining
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float TimeRemaining;
     }
 
     /// <summary>
@@ -95,16 +95,16 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandState Hands_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandState>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandState*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandState*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: Hands
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandState Hands_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandState>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandState*)(Ptr + 84); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandState*)(Ptr + 84) = value; }; }
         }
     }
 
@@ -117,74 +117,42 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// ByteProperty: State
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_IKHandOutput.EIKHAnd_PerHandState State
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_IKHandOutput.EIKHAnd_PerHandState>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_IKHandOutput.EIKHAnd_PerHandState State;
 
         /// <summary>
         /// StructProperty: LockedReferencePointTranslation
         /// </summary>
-        public unsafe System.Numerics.Vector3 LockedReferencePointTranslation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 LockedReferencePointTranslation;
 
         /// <summary>
         /// StructProperty: LockedReferencePointRotation
         /// </summary>
-        public unsafe BmSDK.Rotator LockedReferencePointRotation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.Rotator LockedReferencePointRotation;
 
         /// <summary>
         /// StructProperty: PredictedTranslation
         /// </summary>
-        public unsafe System.Numerics.Vector3 PredictedTranslation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector3 PredictedTranslation;
 
         /// <summary>
         /// StructProperty: AdjustedTranslation
         /// </summary>
-        public unsafe System.Numerics.Vector3 AdjustedTranslation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 AdjustedTranslation;
 
         /// <summary>
         /// StructProperty: TargetOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 TargetOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public System.Numerics.Vector3 TargetOffset;
 
         /// <summary>
         /// StructProperty: BlendTime
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan BlendTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan BlendTime;
 
         /// <summary>
         /// FloatProperty: BlendOutDuration
         /// </summary>
-        public unsafe float BlendOutDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
-        }
+        [FieldOffset(76)] public float BlendOutDuration;
 
         /// <summary>
         /// ObjectProperty: OffsetLock
@@ -224,16 +192,16 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandNotifies Hands_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandNotifies>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandNotifies*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandNotifies*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: Hands
         /// </summary>
         public unsafe BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandNotifies Hands_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandNotifies>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandNotifies*)(Ptr + 48); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RAnimUtil_IKHandOutput.FIKHand_PerHandNotifies*)(Ptr + 48) = value; }; }
         }
     }
 
@@ -243,13 +211,15 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
     [StructLayout(LayoutKind.Explicit, Size = 48)]
     public partial record struct FIKHand_PerHandNotifies
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: Enabled
         /// </summary>
-        public unsafe bool Enabled
+        public bool Enabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
@@ -264,11 +234,7 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// FloatProperty: OffsetLockTime
         /// </summary>
-        public unsafe float OffsetLockTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float OffsetLockTime;
 
         /// <summary>
         /// ObjectProperty: OffsetPredict
@@ -282,11 +248,7 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// FloatProperty: OffsetPredictTime
         /// </summary>
-        public unsafe float OffsetPredictTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float OffsetPredictTime;
 
         /// <summary>
         /// ObjectProperty: OffsetHit
@@ -300,11 +262,7 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// FloatProperty: OffsetHitTime
         /// </summary>
-        public unsafe float OffsetHitTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float OffsetHitTime;
 
         /// <summary>
         /// ObjectProperty: OffsetKeep
@@ -318,11 +276,7 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// FloatProperty: OffsetKeepTime
         /// </summary>
-        public unsafe float OffsetKeepTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float OffsetKeepTime;
 
         /// <summary>
         /// ObjectProperty: OffsetOff
@@ -336,11 +290,7 @@ public partial class RAnimUtil_IKHandOutput : BmSDK.GameObject, BmSDK.IGameObjec
         /// <summary>
         /// FloatProperty: OffsetOffTime
         /// </summary>
-        public unsafe float OffsetOffTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float OffsetOffTime;
 
         /// <summary>
         /// ObjectProperty: Anim
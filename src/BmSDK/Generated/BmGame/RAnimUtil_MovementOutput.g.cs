@@ -79,67 +79,53 @@ public partial class RAnimUtil_MovementOutput : BmSDK.GameObject, BmSDK.IGameObj
     [StructLayout(LayoutKind.Explicit, Size = 84)]
     public partial record struct FMovementOutput
     {
+        [FieldOffset(80)] private int _bitfield80;
+
         /// <summary>
         /// FloatProperty: RagdollFacing
         /// </summary>
-        public unsafe float RagdollFacing
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float RagdollFacing;
 
         /// <summary>
         /// FloatProperty: YawVelocity
         /// </summary>
-        public unsafe float YawVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float YawVelocity;
 
         /// <summary>
         /// StructProperty: ProceduralMovement
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_MovementOutput.FProceduralMovement ProceduralMovement
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_MovementOutput.FProceduralMovement>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.BmGame.RAnimUtil_MovementOutput.FProceduralMovement ProceduralMovement;
 
         /// <summary>
         /// StructProperty: TranslationError
         /// </summary>
-        public unsafe System.Numerics.Vector3 TranslationError
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public System.Numerics.Vector3 TranslationError;
 
         /// <summary>
         /// BoolProperty: CheatsEnabled
         /// </summary>
-        public unsafe bool CheatsEnabled
+        public bool CheatsEnabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }; }
+            readonly get => (_bitfield80 & 1) != 0;
+            set { if (value) _bitfield80 |= 1; else _bitfield80 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: PreAnimUpdateHandledFalling
         /// </summary>
-        public unsafe bool PreAnimUpdateHandledFalling
+        public bool PreAnimUpdateHandledFalling
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }; }
+            readonly get => (_bitfield80 & 2) != 0;
+            set { if (value) _bitfield80 |= 2; else _bitfield80 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bUpdatedRagdollLastFrame
         /// </summary>
-        public unsafe bool bUpdatedRagdollLastFrame
+        public bool bUpdatedRagdollLastFrame
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }; }
+            readonly get => (_bitfield80 & 4) != 0;
+            set { if (value) _bitfield80 |= 4; else _bitfield80 &= ~4; }
         }
     }
 
@@ -149,85 +135,65 @@ public partial class RAnimUtil_MovementOutput : BmSDK.GameObject, BmSDK.IGameObj
     [StructLayout(LayoutKind.Explicit, Size = 60)]
     public partial record struct FProceduralMovement
     {
+        [FieldOffset(0)] private int _bitfield0;
+        [FieldOffset(36)] private int _bitfield36;
+        [FieldOffset(52)] private int _bitfield52;
+
         /// <summary>
         /// BoolProperty: Enabled
         /// </summary>
-        public unsafe bool Enabled
+        public bool Enabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: AddTranslationVelocity
         /// </summary>
-        public unsafe System.Numerics.Vector3 AddTranslationVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 AddTranslationVelocity;
 
         /// <summary>
         /// StructProperty: AddTranslation
         /// </summary>
-        public unsafe System.Numerics.Vector3 AddTranslation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 AddTranslation;
 
         /// <summary>
         /// FloatProperty: AddYaw
         /// </summary>
-        public unsafe float AddYaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float AddYaw;
 
         /// <summary>
         /// FloatProperty: AddYawVelocity
         /// </summary>
-        public unsafe float AddYawVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float AddYawVelocity;
 
         /// <summary>
         /// BoolProperty: OverrideTranslationVelocityEnabled
         /// </summary>
-        public unsafe bool OverrideTranslationVelocityEnabled
+        public bool OverrideTranslationVelocityEnabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 1) != 0;
+            set { if (value) _bitfield36 |= 1; else _bitfield36 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: OverrideTranslationVelocity
         /// </summary>
-        public unsafe System.Numerics.Vector3 OverrideTranslationVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 OverrideTranslationVelocity;
 
         /// <summary>
         /// BoolProperty: OverrideYawVelocityEnabled
         /// </summary>
-        public unsafe bool OverrideYawVelocityEnabled
+        public bool OverrideYawVelocityEnabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }; }
+            readonly get => (_bitfield52 & 1) != 0;
+            set { if (value) _bitfield52 |= 1; else _bitfield52 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: OverrideYawVelocity
         /// </summary>
-        public unsafe float OverrideYawVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float OverrideYawVelocity;
     }
 }
@@ -79,68 +79,50 @@ public partial class RAnimUtil_MovementPlayer : BmSDK.GameObject, BmSDK.IGameObj
     [StructLayout(LayoutKind.Explicit, Size = 92)]
     public partial record struct FMovementPlayer
     {
+        [FieldOffset(12)] private int _bitfield12;
+
         /// <summary>
         /// StructProperty: CurrentCycleTime
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FCycleTime CurrentCycleTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FCycleTime>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil.FCycleTime CurrentCycleTime;
 
         /// <summary>
         /// BoolProperty: HasWeightedAnims
         /// </summary>
-        public unsafe bool HasWeightedAnims
+        public bool HasWeightedAnims
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: HackHackHackFirstPerson
         /// </summary>
-        public unsafe bool HackHackHackFirstPerson
+        public bool HackHackHackFirstPerson
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 2) != 0;
+            set { if (value) _bitfield12 |= 2; else _bitfield12 &= ~2; }
         }
 
         /// <summary>
         /// FloatProperty: AppliedYawVelocity
         /// </summary>
-        public unsafe float AppliedYawVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float AppliedYawVelocity;
 
         /// <summary>
         /// StructProperty: OneShotMovementCycle
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_MovementPlayer.FOneShotMovementCycle OneShotMovementCycle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_MovementPlayer.FOneShotMovementCycle>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.BmGame.RAnimUtil_MovementPlayer.FOneShotMovementCycle OneShotMovementCycle;
 
         /// <summary>
         /// FloatProperty: LeftRightWeight
         /// </summary>
-        public unsafe float LeftRightWeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
-        }
+        [FieldOffset(84)] public float LeftRightWeight;
 
         /// <summary>
         /// FloatProperty: LeftRightWeightVelocity
         /// </summary>
-        public unsafe float LeftRightWeightVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
-        }
+        [FieldOffset(88)] public float LeftRightWeightVelocity;
     }
 
     /// <summary>
@@ -152,92 +134,52 @@ public partial class RAnimUtil_MovementPlayer : BmSDK.GameObject, BmSDK.IGameObj
         /// <summary>
         /// ByteProperty: State
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_MovementPlayer.EOneShotMovementCycleState State
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_MovementPlayer.EOneShotMovementCycleState>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_MovementPlayer.EOneShotMovementCycleState State;
 
         /// <summary>
         /// StructProperty: Anim
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FResolvedAnimConfig Anim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FResolvedAnimConfig>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.BmGame.RAnimUtil.FResolvedAnimConfig Anim;
 
         /// <summary>
         /// StructProperty: TransitionId
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId TransitionId
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId TransitionId;
 
         /// <summary>
         /// IntProperty: BeginLoopIndex
         /// </summary>
-        public unsafe int BeginLoopIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int BeginLoopIndex;
 
         /// <summary>
         /// ByteProperty: BeginPoint
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.EFootSyncPoint BeginPoint
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.EFootSyncPoint>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.BmGame.RAnimUtil.EFootSyncPoint BeginPoint;
 
         /// <summary>
         /// FloatProperty: BeginTime
         /// </summary>
-        public unsafe float BeginTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float BeginTime;
 
         /// <summary>
         /// ByteProperty: BlendOutPoint
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.EFootSyncPoint BlendOutPoint
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.EFootSyncPoint>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public BmSDK.BmGame.RAnimUtil.EFootSyncPoint BlendOutPoint;
 
         /// <summary>
         /// FloatProperty: BlendOutTime
         /// </summary>
-        public unsafe float BlendOutTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float BlendOutTime;
 
         /// <summary>
         /// FloatProperty: EndTime
         /// </summary>
-        public unsafe float EndTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public float EndTime;
 
         /// <summary>
         /// StructProperty: Time
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public BmSDK.BmGame.RAnimUtil.FNormalizedTimeSpan Time;
     }
 
     /// <summary>
@@ -78,22 +78,22 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
         where TComponent : class, Framework.IScriptComponent<RAnimUtil_PhysicsOutput>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_DisableInheritVelocityForNFramesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisableInheritVelocityForNFrames_Params
+    {
+        [FieldOffset(0)] public int N;
+    }
+
     /// <summary>
     /// Function: DisableInheritVelocityForNFrames
     /// </summary>
     public unsafe virtual void DisableInheritVelocityForNFrames(int N)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimUtil_PhysicsOutput.DisableInheritVelocityForNFrames", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(N, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DisableInheritVelocityForNFramesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAnimUtil_PhysicsOutput.DisableInheritVelocityForNFrames", true);
+        var parms = new DisableInheritVelocityForNFrames_Params();
+        parms.N = N;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -102,8 +102,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool HasFlappyBits
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1; else *(int*)(Ptr + 44) &= ~1; }
     }
 
     /// <summary>
@@ -111,8 +111,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool HasRFlaps
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 2; else *(int*)(Ptr + 44) &= ~2; }
     }
 
     /// <summary>
@@ -120,8 +120,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool AlwaysActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 4; else *(int*)(Ptr + 44) &= ~4; }
     }
 
     /// <summary>
@@ -129,8 +129,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool ForceAlwaysActiveOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 8; else *(int*)(Ptr + 44) &= ~8; }
     }
 
     /// <summary>
@@ -138,8 +138,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool UseStrungUpRagdoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 16; else *(int*)(Ptr + 44) &= ~16; }
     }
 
     /// <summary>
@@ -147,8 +147,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool ForceCollideWithPhysicsRagdolls
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 32; else *(int*)(Ptr + 44) &= ~32; }
     }
 
     /// <summary>
@@ -156,8 +156,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool ForceNoCollideWithPhysicsRagdolls
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 64; else *(int*)(Ptr + 44) &= ~64; }
     }
 
     /// <summary>
@@ -165,8 +165,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool ForceCollideWithVenomHenchmanThrowChannelsOnly
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 128; else *(int*)(Ptr + 44) &= ~128; }
     }
 
     /// <summary>
@@ -174,8 +174,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe bool Dirty
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 256; else *(int*)(Ptr + 44) &= ~256; }
     }
 
     /// <summary>
@@ -222,8 +222,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe float PreviousDeltaSeconds
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(float*)(Ptr + 240); }
+        set { *(float*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -231,8 +231,8 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     /// </summary>
     public unsafe int DisableInheritVelocityFrames
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(int*)(Ptr + 244); }
+        set { *(int*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -241,14 +241,12 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     [StructLayout(LayoutKind.Explicit, Size = 92)]
     public partial record struct FRagdollStack
     {
+        [FieldOffset(88)] private int _bitfield88;
+
         /// <summary>
         /// StructProperty: State
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_PhysicsOutput.FRagdollState State
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_PhysicsOutput.FRagdollState>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_PhysicsOutput.FRagdollState State;
 
         /// <summary>
         /// ObjectProperty: CurrentBeginNotify
@@ -289,10 +287,10 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
         /// <summary>
         /// BoolProperty: StackDirty
         /// </summary>
-        public unsafe bool StackDirty
+        public bool StackDirty
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }; }
+            readonly get => (_bitfield88 & 1) != 0;
+            set { if (value) _bitfield88 |= 1; else _bitfield88 &= ~1; }
         }
     }
 
@@ -302,14 +300,12 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     [StructLayout(LayoutKind.Explicit, Size = 56)]
     public partial record struct FRagdollState
     {
+        [FieldOffset(40)] private int _bitfield40;
+
         /// <summary>
         /// FloatProperty: Weight
         /// </summary>
-        public unsafe float Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Weight;
 
         /// <summary>
         /// ArrayProperty: FixedBodies
@@ -332,37 +328,25 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
         /// <summary>
         /// FloatProperty: MotorWeight
         /// </summary>
-        public unsafe float MotorWeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float MotorWeight;
 
         /// <summary>
         /// FloatProperty: MotorDampingScale
         /// </summary>
-        public unsafe float MotorDampingScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float MotorDampingScale;
 
         /// <summary>
         /// FloatProperty: MotorLimitsScale
         /// </summary>
-        public unsafe float MotorLimitsScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float MotorLimitsScale;
 
         /// <summary>
         /// BoolProperty: MotorSubsetEnabled
         /// </summary>
-        public unsafe bool MotorSubsetEnabled
+        public bool MotorSubsetEnabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 40); }; }
+            readonly get => (_bitfield40 & 1) != 0;
+            set { if (value) _bitfield40 |= 1; else _bitfield40 &= ~1; }
         }
 
         /// <summary>
@@ -381,59 +365,42 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
     [StructLayout(LayoutKind.Explicit, Size = 88)]
     public partial record struct FRagdollTransition
     {
+        [FieldOffset(0)] private int _bitfield0;
+        [FieldOffset(72)] private int _bitfield72;
+
         /// <summary>
         /// BoolProperty: Unfixed
         /// </summary>
-        public unsafe bool Unfixed
+        public bool Unfixed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// NameProperty: Description
         /// </summary>
-        public unsafe BmSDK.FName Description
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.FName Description;
 
         /// <summary>
         /// ByteProperty: Instigator
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_PhysicsOutput.ERagdollTransitionInstigator Instigator
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_PhysicsOutput.ERagdollTransitionInstigator>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RAnimUtil_PhysicsOutput.ERagdollTransitionInstigator Instigator;
 
         /// <summary>
         /// FloatProperty: BlendInDuration
         /// </summary>
-        public unsafe float BlendInDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float BlendInDuration;
 
         /// <summary>
         /// FloatProperty: BlendTime
         /// </summary>
-        public unsafe float BlendTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float BlendTime;
 
         /// <summary>
         /// FloatProperty: BlendOutDuration
         /// </summary>
-        public unsafe float BlendOutDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float BlendOutDuration;
 
         /// <summary>
         /// ArrayProperty: FixedBodies
@@ -456,55 +423,35 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
         /// <summary>
         /// FloatProperty: MotorWeightBlendFrom
         /// </summary>
-        public unsafe float MotorWeightBlendFrom
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public float MotorWeightBlendFrom;
 
         /// <summary>
         /// FloatProperty: MotorWeightBlendTo
         /// </summary>
-        public unsafe float MotorWeightBlendTo
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float MotorWeightBlendTo;
 
         /// <summary>
         /// FloatProperty: MotorWeightBlendDuration
         /// </summary>
-        public unsafe float MotorWeightBlendDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float MotorWeightBlendDuration;
 
         /// <summary>
         /// FloatProperty: MotorWeightBlendTimeRemaining
         /// </summary>
-        public unsafe float MotorWeightBlendTimeRemaining
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float MotorWeightBlendTimeRemaining;
 
         /// <summary>
         /// FloatProperty: MotorDampingScale
         /// </summary>
-        public unsafe float MotorDampingScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float MotorDampingScale;
 
         /// <summary>
         /// BoolProperty: MotorSubsetEnabled
         /// </summary>
-        public unsafe bool MotorSubsetEnabled
+        public bool MotorSubsetEnabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }; }
+            readonly get => (_bitfield72 & 1) != 0;
+            set { if (value) _bitfield72 |= 1; else _bitfield72 &= ~1; }
         }
 
         /// <summary>
@@ -536,65 +483,37 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
         /// <summary>
         /// NameProperty: Name
         /// </summary>
-        public unsafe BmSDK.FName Name
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName Name;
 
         /// <summary>
         /// StructProperty: FirstNormal
         /// </summary>
-        public unsafe System.Numerics.Vector3 FirstNormal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public System.Numerics.Vector3 FirstNormal;
 
         /// <summary>
         /// StructProperty: FirstAxis
         /// </summary>
-        public unsafe System.Numerics.Vector3 FirstAxis
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public System.Numerics.Vector3 FirstAxis;
 
         /// <summary>
         /// StructProperty: SecondNormal
         /// </summary>
-        public unsafe System.Numerics.Vector3 SecondNormal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public System.Numerics.Vector3 SecondNormal;
 
         /// <summary>
         /// StructProperty: SecondAxis
         /// </summary>
-        public unsafe System.Numerics.Vector3 SecondAxis
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public System.Numerics.Vector3 SecondAxis;
 
         /// <summary>
         /// FloatProperty: Swing1Limit
         /// </summary>
-        public unsafe float Swing1Limit
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float Swing1Limit;
 
         /// <summary>
         /// FloatProperty: Swing2Limit
         /// </summary>
-        public unsafe float Swing2Limit
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float Swing2Limit;
     }
 
     /// <summary>
@@ -606,38 +525,22 @@ public partial class RAnimUtil_PhysicsOutput : BmSDK.GameObject, BmSDK.IGameObje
         /// <summary>
         /// ByteProperty: Type
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimUtil_PhysicsOutput.ERagdollForceType Type
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_PhysicsOutput.ERagdollForceType>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_PhysicsOutput.ERagdollForceType Type;
 
         /// <summary>
         /// StructProperty: Translation
         /// </summary>
-        public unsafe System.Numerics.Vector3 Translation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 Translation;
 
         /// <summary>
         /// StructProperty: Rotation
         /// </summary>
-        public unsafe System.Numerics.Vector3 Rotation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 Rotation;
 
         /// <summary>
         /// IntProperty: BodyIndex
         /// </summary>
-        public unsafe int BodyIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int BodyIndex;
     }
 
     /// <summary>
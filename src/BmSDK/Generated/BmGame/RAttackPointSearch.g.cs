@@ -78,15 +78,28 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RAttackPointSearch>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetThoughtStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetThoughtString_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetThoughtString
     /// </summary>
     public unsafe virtual BmSDK.FString GetThoughtString()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.GetThoughtString", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetThoughtStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.GetThoughtString", true);
+        var parms = new GetThoughtString_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ReleaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Release_Params
+    {
     }
 
     /// <summary>
@@ -94,66 +107,86 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void Release()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.Release", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReleaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.Release", true);
+        var parms = new Release_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct StartSearch_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 NewTargetLocation;
+        [FieldOffset(12)] public float NewAttackRadius;
+        [FieldOffset(16)] public BmSDK.FName NewClaimName;
+        [FieldOffset(24)] public BmSDK.BmGame.RAttackPointSearch.StanceVisType NewStanceToCheck;
+        [FieldOffset(40)] public float NewSubDivideSizeTarget;
+        [FieldOffset(44)] public int bNewAutoAdjustToFloor;
+        [FieldOffset(48)] public int bNewAdjustHeightForHumanTargetSize;
+    }
+
     /// <summary>
     /// Function: StartSearch
     /// </summary>
     public unsafe virtual void StartSearch(System.Numerics.Vector3 NewTargetLocation, float NewAttackRadius, BmSDK.FName NewClaimName, BmSDK.BmGame.RAttackPointSearch.StanceVisType NewStanceToCheck, BmSDK.TArray<BmSDK.Engine.Pylon> NewPylonList, float NewSubDivideSizeTarget, bool bNewAutoAdjustToFloor, bool bNewAdjustHeightForHumanTargetSize)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.StartSearch", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTargetLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewAttackRadius, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewClaimName, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewStanceToCheck, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPylonList, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSubDivideSizeTarget, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewAutoAdjustToFloor, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewAdjustHeightForHumanTargetSize, paramsPtr + 48);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.StartSearch", true);
+        var parms = new StartSearch_Params();
+        parms.NewTargetLocation = NewTargetLocation;
+        parms.NewAttackRadius = NewAttackRadius;
+        parms.NewClaimName = NewClaimName;
+        parms.NewStanceToCheck = NewStanceToCheck;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPylonList, (byte*)&parms + 28);
+        parms.NewSubDivideSizeTarget = NewSubDivideSizeTarget;
+        parms.bNewAutoAdjustToFloor = bNewAutoAdjustToFloor ? 1 : 0;
+        parms.bNewAdjustHeightForHumanTargetSize = bNewAdjustHeightForHumanTargetSize ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowDebugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowDebug_Params
+    {
+        [FieldOffset(0)] public int bPermanent;
+    }
+
     /// <summary>
     /// Function: ShowDebug
     /// </summary>
     public unsafe virtual void ShowDebug(bool bPermanent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.ShowDebug", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPermanent, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ShowDebugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.ShowDebug", true);
+        var parms = new ShowDebug_Params();
+        parms.bPermanent = bPermanent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SearchFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SearchFinished_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SearchFinished
     /// </summary>
     public unsafe virtual bool SearchFinished()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.SearchFinished", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_SearchFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.SearchFinished", true);
+        var parms = new SearchFinished_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsAvailableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsAvailable_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -161,17 +194,17 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsAvailable()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.IsAvailable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsAvailableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.IsAvailable", true);
+        var parms = new IsAvailable_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Search_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -179,17 +212,10 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void Search(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.Search", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAttackPointSearch.Search", true);
+        var parms = new Search_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -232,8 +258,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AttackRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -259,8 +285,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int AttackPointCheckID
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(int*)(Ptr + 84); }
+        set { *(int*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -286,8 +312,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName ClaimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(BmSDK.FName*)(Ptr + 96); }
+        set { *(BmSDK.FName*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -295,8 +321,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RAttackPointSearch.AttackPointSearchState CurrState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAttackPointSearch.AttackPointSearchState>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(BmSDK.BmGame.RAttackPointSearch.AttackPointSearchState*)(Ptr + 104); }
+        set { *(BmSDK.BmGame.RAttackPointSearch.AttackPointSearchState*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -304,8 +330,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RAttackPointSearch.StanceVisType StanceToCheck
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAttackPointSearch.StanceVisType>(Ptr + 105); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 105); }
+        get { return *(BmSDK.BmGame.RAttackPointSearch.StanceVisType*)(Ptr + 105); }
+        set { *(BmSDK.BmGame.RAttackPointSearch.StanceVisType*)(Ptr + 105) = value; }
     }
 
     /// <summary>
@@ -322,8 +348,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int VisCheckIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(int*)(Ptr + 120); }
+        set { *(int*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -331,8 +357,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float SubDivideSizeTarget
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -340,8 +366,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAutoAdjustToFloor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 1; else *(int*)(Ptr + 128) &= ~1; }
     }
 
     /// <summary>
@@ -349,8 +375,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAdjustHeightForHumanTargetSize
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 2; else *(int*)(Ptr + 128) &= ~2; }
     }
 
     /// <summary>
@@ -358,8 +384,8 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float SearchStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(float*)(Ptr + 132); }
+        set { *(float*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -368,31 +394,29 @@ public partial class RAttackPointSearch : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 16)]
     public partial record struct FAttackPoint
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: bCanSeeStandingTarget
         /// </summary>
-        public unsafe bool bCanSeeStandingTarget
+        public bool bCanSeeStandingTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bCanSeeCrouchingTarget
         /// </summary>
-        public unsafe bool bCanSeeCrouchingTarget
+        public bool bCanSeeCrouchingTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: Location
         /// </summary>
-        public unsafe System.Numerics.Vector3 Location
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 Location;
     }
 }
@@ -78,205 +78,313 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
         where TComponent : class, Framework.IScriptComponent<RAudioPoint>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_TakeDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct TakeDamage_Params
+    {
+        [FieldOffset(0)] public int Damage;
+        [FieldOffset(4)] public nint InstigatedBy;
+        [FieldOffset(8)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(20)] public System.Numerics.Vector3 Momentum;
+        [FieldOffset(32)] public nint DamageType;
+        [FieldOffset(36)] public BmSDK.Engine.Actor.FTraceHitInfo HitInfo;
+        [FieldOffset(72)] public nint DamageCauser;
+    }
+
     /// <summary>
     /// Function: TakeDamage
     /// </summary>
     public unsafe override void TakeDamage(int Damage, BmSDK.Engine.Controller InstigatedBy, System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 Momentum, BmSDK.Class DamageType, BmSDK.Engine.Actor.FTraceHitInfo HitInfo = default, BmSDK.Engine.Actor DamageCauser = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.TakeDamage", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Damage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InstigatedBy, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Momentum, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitInfo, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageCauser, paramsPtr + 72);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TakeDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.TakeDamage", true);
+        var parms = new TakeDamage_Params();
+        parms.Damage = Damage;
+        parms.InstigatedBy = InstigatedBy?.Ptr ?? 0;
+        parms.HitLocation = HitLocation;
+        parms.Momentum = Momentum;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        parms.HitInfo = HitInfo;
+        parms.DamageCauser = DamageCauser?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetPositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetPosition_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetPosition
     /// </summary>
     public unsafe virtual void ResetPosition()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.ResetPosition", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetPositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.ResetPosition", true);
+        var parms = new ResetPosition_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float dt;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float dt)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dt, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.Tick", true);
+        var parms = new Tick_Params();
+        parms.dt = dt;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoSpeech_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoSpeech
     /// </summary>
     public unsafe virtual void DoSpeech()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.DoSpeech", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.DoSpeech", true);
+        var parms = new DoSpeech_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AkOnVocalFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct AkOnVocalFinished_Params
+    {
+        [FieldOffset(0)] public int CallbackFlags;
+        [FieldOffset(4)] public BmSDK.Engine.AkWwise.FAkSoundHandle SoundHandle;
+        [FieldOffset(16)] public int MarkerID;
+    }
+
     /// <summary>
     /// Function: AkOnVocalFinished
     /// </summary>
     public unsafe virtual void AkOnVocalFinished(int CallbackFlags, BmSDK.Engine.AkWwise.FAkSoundHandle SoundHandle, int MarkerID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.AkOnVocalFinished", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CallbackFlags, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundHandle, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerID, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AkOnVocalFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.AkOnVocalFinished", true);
+        var parms = new AkOnVocalFinished_Params();
+        parms.CallbackFlags = CallbackFlags;
+        parms.SoundHandle = SoundHandle;
+        parms.MarkerID = MarkerID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartSpeech_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartSpeech
     /// </summary>
     public unsafe virtual void StartSpeech()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StartSpeech", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StartSpeech", true);
+        var parms = new StartSpeech_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartBongFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartBong_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartBong
     /// </summary>
     public unsafe virtual void StartBong()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StartBong", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartBongFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StartBong", true);
+        var parms = new StartBong_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayBingBongFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PlayBingBong_Params
+    {
+        [FieldOffset(0)] public float delayTime;
+        [FieldOffset(4)] public nint BingEvent;
+    }
+
     /// <summary>
     /// Function: PlayBingBong
     /// </summary>
     public unsafe virtual void PlayBingBong(float delayTime, BmSDK.Engine.AkEvent BingEvent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.PlayBingBong", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(delayTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BingEvent, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayBingBongFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.PlayBingBong", true);
+        var parms = new PlayBingBong_Params();
+        parms.delayTime = delayTime;
+        parms.BingEvent = BingEvent?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopSpeech_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopSpeech
     /// </summary>
     public unsafe virtual void StopSpeech()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StopSpeech", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StopSpeech", true);
+        var parms = new StopSpeech_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlaySpeakerSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PlaySpeakerSpeech_Params
+    {
+        [FieldOffset(0)] public nint DialogueEvent;
+        [FieldOffset(4)] public float delayTime;
+    }
+
     /// <summary>
     /// Function: PlaySpeakerSpeech
     /// </summary>
     public unsafe virtual void PlaySpeakerSpeech(BmSDK.Engine.RDialogueEvent DialogueEvent, float delayTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.PlaySpeakerSpeech", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueEvent, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(delayTime, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySpeakerSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.PlaySpeakerSpeech", true);
+        var parms = new PlaySpeakerSpeech_Params();
+        parms.DialogueEvent = DialogueEvent?.Ptr ?? 0;
+        parms.delayTime = delayTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartBackgroundMusicFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartBackgroundMusic_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartBackgroundMusic
     /// </summary>
     public unsafe virtual void StartBackgroundMusic()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StartBackgroundMusic", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartBackgroundMusicFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StartBackgroundMusic", true);
+        var parms = new StartBackgroundMusic_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OccludeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Occlude_Params
+    {
+        [FieldOffset(0)] public int bOcclude;
+    }
+
     /// <summary>
     /// Function: Occlude
     /// </summary>
     public unsafe virtual void Occlude(bool bOcclude)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.Occlude", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOcclude, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OccludeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.Occlude", true);
+        var parms = new Occlude_Params();
+        parms.bOcclude = bOcclude ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopBackgroundMusicFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopBackgroundMusic_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopBackgroundMusic
     /// </summary>
     public unsafe virtual void StopBackgroundMusic()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StopBackgroundMusic", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopBackgroundMusicFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.StopBackgroundMusic", true);
+        var parms = new StopBackgroundMusic_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetBackgroundMusicFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetBackgroundMusic_Params
+    {
+        [FieldOffset(0)] public nint BackgroundMusicEvent;
+        [FieldOffset(4)] public int StartMusic;
+    }
+
     /// <summary>
     /// Function: SetBackgroundMusic
     /// </summary>
     public unsafe virtual void SetBackgroundMusic(BmSDK.Engine.AkEvent BackgroundMusicEvent, bool StartMusic)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.SetBackgroundMusic", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BackgroundMusicEvent, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartMusic, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetBackgroundMusicFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.SetBackgroundMusic", true);
+        var parms = new SetBackgroundMusic_Params();
+        parms.BackgroundMusicEvent = BackgroundMusicEvent?.Ptr ?? 0;
+        parms.StartMusic = StartMusic ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverrideAkComponentDefaultsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OverrideAkComponentDefaults_Params
+    {
+        [FieldOffset(0)] public nint akComp;
+    }
+
     /// <summary>
     /// Function: OverrideAkComponentDefaults
     /// </summary>
     public unsafe override void OverrideAkComponentDefaults(BmSDK.Engine.AkComponent akComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.OverrideAkComponentDefaults", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(akComp, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OverrideAkComponentDefaultsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPoint.OverrideAkComponentDefaults", true);
+        var parms = new OverrideAkComponentDefaults_Params();
+        parms.akComp = akComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -300,8 +408,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe float BackgroundMusicDelayTime_ms
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(float*)(Ptr + 456); }
+        set { *(float*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -309,8 +417,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe float StoredDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(float*)(Ptr + 460); }
+        set { *(float*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -318,8 +426,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe float StoredBongDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(float*)(Ptr + 464); }
+        set { *(float*)(Ptr + 464) = value; }
     }
 
     /// <summary>
@@ -327,8 +435,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bDontMoveCloser
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 468); }
+        get { return (*(int*)(Ptr + 468) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 468) |= 1; else *(int*)(Ptr + 468) &= ~1; }
     }
 
     /// <summary>
@@ -336,8 +444,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe bool nextFrame
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 468); }
+        get { return (*(int*)(Ptr + 468) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 468) |= 2; else *(int*)(Ptr + 468) &= ~2; }
     }
 
     /// <summary>
@@ -345,8 +453,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bTalking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 468); }
+        get { return (*(int*)(Ptr + 468) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 468) |= 4; else *(int*)(Ptr + 468) &= ~4; }
     }
 
     /// <summary>
@@ -354,8 +462,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bBroken
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 468); }
+        get { return (*(int*)(Ptr + 468) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 468) |= 8; else *(int*)(Ptr + 468) &= ~8; }
     }
 
     /// <summary>
@@ -363,8 +471,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe float cachedDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(float*)(Ptr + 472); }
+        set { *(float*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -378,8 +486,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe float setV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(float*)(Ptr + 488); }
+        set { *(float*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -387,8 +495,8 @@ public partial class RAudioPoint : BmSDK.Engine.StaticMeshActor, BmSDK.IGameObje
     /// </summary>
     public unsafe float oldSetV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(float*)(Ptr + 492); }
+        set { *(float*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -78,16 +78,31 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
         where TComponent : class, Framework.IScriptComponent<RAudioPointController>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetInterceptHudLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetInterceptHudLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HudLocation;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetInterceptHudLocation
     /// </summary>
     public unsafe override bool GetInterceptHudLocation(out System.Numerics.Vector3 HudLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.GetInterceptHudLocation", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HudLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_GetInterceptHudLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.GetInterceptHudLocation", true);
+        var parms = new GetInterceptHudLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HudLocation = parms.HudLocation;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsSpeakingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsSpeaking_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -95,10 +110,17 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe override bool IsSpeaking()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.IsSpeaking", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsSpeakingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.IsSpeaking", true);
+        var parms = new IsSpeaking_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float Delta;
     }
 
     /// <summary>
@@ -106,51 +128,84 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe override void Tick(float Delta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Delta, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.Tick", true);
+        var parms = new Tick_Params();
+        parms.Delta = Delta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnToggleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OnToggle_Params
+    {
+        [FieldOffset(0)] public nint Action;
+    }
+
     /// <summary>
     /// Function: OnToggle
     /// </summary>
     public unsafe virtual void OnToggle(BmSDK.Engine.SeqAct_Toggle Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.OnToggle", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.OnToggle", true);
+        var parms = new OnToggle_Params();
+        parms.Action = Action?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BongCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct BongCallback_Params
+    {
+        [FieldOffset(0)] public int CallbackFlags;
+        [FieldOffset(4)] public BmSDK.Engine.AkWwise.FAkSoundHandle SoundHandle;
+        [FieldOffset(16)] public int MarkerID;
+    }
+
     /// <summary>
     /// Function: BongCallback
     /// </summary>
     public unsafe virtual void BongCallback(int CallbackFlags, BmSDK.Engine.AkWwise.FAkSoundHandle SoundHandle, int MarkerID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.BongCallback", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CallbackFlags, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundHandle, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerID, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BongCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.BongCallback", true);
+        var parms = new BongCallback_Params();
+        parms.CallbackFlags = CallbackFlags;
+        parms.SoundHandle = SoundHandle;
+        parms.MarkerID = MarkerID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayBingBongFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct PlayBingBong_Params
+    {
+        [FieldOffset(0)] public nint DialogueLine;
+        [FieldOffset(4)] public BmSDK.BmGame.RGameInfo.VocalPriority Priority;
+        [FieldOffset(8)] public nint Trigger;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PlayBingBong
     /// </summary>
     public unsafe virtual bool PlayBingBong(BmSDK.Engine.RDialogueLine DialogueLine, BmSDK.BmGame.RGameInfo.VocalPriority Priority, BmSDK.Engine.SequenceAction Trigger)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlayBingBong", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueLine, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Priority, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Trigger, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_PlayBingBongFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlayBingBong", true);
+        var parms = new PlayBingBong_Params();
+        parms.DialogueLine = DialogueLine?.Ptr ?? 0;
+        parms.Priority = Priority;
+        parms.Trigger = Trigger?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnStopSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OnStopSpeech_Params
+    {
+        [FieldOffset(0)] public nint SpeechAction;
     }
 
     /// <summary>
@@ -158,320 +213,466 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe virtual void OnStopSpeech(BmSDK.BmGame.RBMSeqAct_StopSpeech SpeechAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.OnStopSpeech", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnStopSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.OnStopSpeech", true);
+        var parms = new OnStopSpeech_Params();
+        parms.SpeechAction = SpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlaySpeechInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct PlaySpeechInternal_Params
+    {
+        [FieldOffset(0)] public nint DialogueLine;
+        [FieldOffset(4)] public BmSDK.BmGame.RGameInfo.VocalPriority Priority;
+        [FieldOffset(8)] public nint PlaySpeechAction;
+        [FieldOffset(12)] public int bPlayEarcon;
+    }
+
     /// <summary>
     /// Function: PlaySpeechInternal
     /// </summary>
     public unsafe override void PlaySpeechInternal(BmSDK.Engine.RDialogueLine DialogueLine, BmSDK.BmGame.RGameInfo.VocalPriority Priority = default, BmSDK.Engine.SequenceAction PlaySpeechAction = default, bool bPlayEarcon = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlaySpeechInternal", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueLine, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Priority, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlaySpeechAction, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayEarcon, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySpeechInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlaySpeechInternal", true);
+        var parms = new PlaySpeechInternal_Params();
+        parms.DialogueLine = DialogueLine?.Ptr ?? 0;
+        parms.Priority = Priority;
+        parms.PlaySpeechAction = PlaySpeechAction?.Ptr ?? 0;
+        parms.bPlayEarcon = bPlayEarcon ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopExtraFaceFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopExtraFaceFX_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopExtraFaceFX
     /// </summary>
     public unsafe virtual void StopExtraFaceFX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopExtraFaceFX", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopExtraFaceFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopExtraFaceFX", true);
+        var parms = new StopExtraFaceFX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopHeadSpeakingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopHeadSpeaking_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopHeadSpeaking
     /// </summary>
     public unsafe virtual void StopHeadSpeaking()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopHeadSpeaking", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopHeadSpeakingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopHeadSpeaking", true);
+        var parms = new StopHeadSpeaking_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlaySpeechForRealFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PlaySpeechForReal_Params
+    {
+        [FieldOffset(0)] public nint DialogueLine;
+        [FieldOffset(4)] public BmSDK.BmGame.RGameInfo.VocalPriority Priority;
+        [FieldOffset(8)] public nint PlaySpeechAction;
+    }
+
     /// <summary>
     /// Function: PlaySpeechForReal
     /// </summary>
     public unsafe virtual void PlaySpeechForReal(BmSDK.Engine.RDialogueLine DialogueLine, BmSDK.BmGame.RGameInfo.VocalPriority Priority = default, BmSDK.Engine.SequenceAction PlaySpeechAction = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlaySpeechForReal", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueLine, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Priority, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlaySpeechAction, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySpeechForRealFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlaySpeechForReal", true);
+        var parms = new PlaySpeechForReal_Params();
+        parms.DialogueLine = DialogueLine?.Ptr ?? 0;
+        parms.Priority = Priority;
+        parms.PlaySpeechAction = PlaySpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FaceFXAudioStoppedCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FaceFXAudioStoppedCallback_Params
+    {
+    }
+
     /// <summary>
     /// Function: FaceFXAudioStoppedCallback
     /// </summary>
     public unsafe override void FaceFXAudioStoppedCallback()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.FaceFXAudioStoppedCallback", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FaceFXAudioStoppedCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.FaceFXAudioStoppedCallback", true);
+        var parms = new FaceFXAudioStoppedCallback_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FaceFXAudioStartedCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct FaceFXAudioStartedCallback_Params
+    {
+        [FieldOffset(0)] public nint DialogueEvent;
+    }
+
     /// <summary>
     /// Function: FaceFXAudioStartedCallback
     /// </summary>
     public unsafe override void FaceFXAudioStartedCallback(BmSDK.Engine.RDialogueEvent DialogueEvent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.FaceFXAudioStartedCallback", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueEvent, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FaceFXAudioStartedCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.FaceFXAudioStartedCallback", true);
+        var parms = new FaceFXAudioStartedCallback_Params();
+        parms.DialogueEvent = DialogueEvent?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLocFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetLoc_Params
+    {
+        [FieldOffset(0)] public int setPl;
+    }
+
     /// <summary>
     /// Function: SetLoc
     /// </summary>
     public unsafe virtual void SetLoc(bool setPl)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.SetLoc", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(setPl, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLocFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.SetLoc", true);
+        var parms = new SetLoc_Params();
+        parms.setPl = setPl ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HeadSpeakingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HeadSpeaking_Params
+    {
+        [FieldOffset(0)] public float Time;
+    }
+
     /// <summary>
     /// Function: HeadSpeaking
     /// </summary>
     public unsafe virtual void HeadSpeaking(float Time)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.HeadSpeaking", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Time, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_HeadSpeakingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.HeadSpeaking", true);
+        var parms = new HeadSpeaking_Params();
+        parms.Time = Time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SortDistancesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SortDistances_Params
+    {
+        [FieldOffset(0)] public int bForceUpdate;
+    }
+
     /// <summary>
     /// Function: SortDistances
     /// </summary>
     public unsafe virtual void SortDistances(bool bForceUpdate)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.SortDistances", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceUpdate, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SortDistancesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.SortDistances", true);
+        var parms = new SortDistances_Params();
+        parms.bForceUpdate = bForceUpdate ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPlayerPositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GetPlayerPosition_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetPlayerPosition
     /// </summary>
     public unsafe virtual void GetPlayerPosition()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.GetPlayerPosition", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_GetPlayerPositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.GetPlayerPosition", true);
+        var parms = new GetPlayerPosition_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlaySpeechCombinedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlaySpeechCombined_Params
+    {
+        [FieldOffset(0)] public nint SpeechAction;
+    }
+
     /// <summary>
     /// Function: PlaySpeechCombined
     /// </summary>
     public unsafe virtual void PlaySpeechCombined(BmSDK.BmGame.RSeqAct_PlaySpeechCombined SpeechAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlaySpeechCombined", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySpeechCombinedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlaySpeechCombined", true);
+        var parms = new PlaySpeechCombined_Params();
+        parms.SpeechAction = SpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnPlaySpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnPlaySpeech_Params
+    {
+        [FieldOffset(0)] public nint SpeechAction;
+    }
+
     /// <summary>
     /// Function: OnPlaySpeech
     /// </summary>
     public unsafe virtual void OnPlaySpeech(BmSDK.BmGame.RBMSeqAct_PlaySpeech SpeechAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.OnPlaySpeech", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnPlaySpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.OnPlaySpeech", true);
+        var parms = new OnPlaySpeech_Params();
+        parms.SpeechAction = SpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlaySpeechGenericFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlaySpeechGeneric_Params
+    {
+        [FieldOffset(0)] public nint DialogueLine;
+        [FieldOffset(4)] public int bInterruptCurrentSpeech;
+        [FieldOffset(8)] public nint SpeechAction;
+    }
+
     /// <summary>
     /// Function: PlaySpeechGeneric
     /// </summary>
     public unsafe virtual void PlaySpeechGeneric(BmSDK.Engine.RDialogueLine DialogueLine, bool bInterruptCurrentSpeech, BmSDK.BmGame.RSeqAct_PlaySpeechBase SpeechAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlaySpeechGeneric", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueLine, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInterruptCurrentSpeech, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechAction, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySpeechGenericFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PlaySpeechGeneric", true);
+        var parms = new PlaySpeechGeneric_Params();
+        parms.DialogueLine = DialogueLine?.Ptr ?? 0;
+        parms.bInterruptCurrentSpeech = bInterruptCurrentSpeech ? 1 : 0;
+        parms.SpeechAction = SpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IntSetStasisFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IntSetStasis_Params
+    {
+        [FieldOffset(0)] public int V;
+    }
+
     /// <summary>
     /// Function: IntSetStasis
     /// </summary>
     public unsafe virtual void IntSetStasis(bool V)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.IntSetStasis", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IntSetStasisFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.IntSetStasis", true);
+        var parms = new IntSetStasis_Params();
+        parms.V = V ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OccludeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Occlude_Params
+    {
+        [FieldOffset(0)] public int bOcclude;
+    }
+
     /// <summary>
     /// Function: Occlude
     /// </summary>
     public unsafe virtual void Occlude(bool bOcclude)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.Occlude", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOcclude, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OccludeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.Occlude", true);
+        var parms = new Occlude_Params();
+        parms.bOcclude = bOcclude ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopFaceAtFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopFaceAt_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopFaceAt
     /// </summary>
     public unsafe override void StopFaceAt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopFaceAt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopFaceAtFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopFaceAt", true);
+        var parms = new StopFaceAt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopLookAtFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopLookAt_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopLookAt
     /// </summary>
     public unsafe override void StopLookAt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopLookAt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopLookAtFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopLookAt", true);
+        var parms = new StopLookAt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopAimAtFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopAimAt_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopAimAt
     /// </summary>
     public unsafe override void StopAimAt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopAimAt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopAimAtFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.StopAimAt", true);
+        var parms = new StopAimAt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AimInDirectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct AimInDirection_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Direction;
+        [FieldOffset(12)] public BmSDK.FName Description;
+        [FieldOffset(20)] public BmSDK.BmGame.RAnimConfig.EYesNoDefault AllowTurningToAim;
+        [FieldOffset(24)] public float LimitScale;
+    }
+
     /// <summary>
     /// Function: AimInDirection
     /// </summary>
     public unsafe override void AimInDirection(System.Numerics.Vector3 Direction, BmSDK.FName Description = default, BmSDK.BmGame.RAnimConfig.EYesNoDefault AllowTurningToAim = default, float LimitScale = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.AimInDirection", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Direction, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Description, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AllowTurningToAim, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LimitScale, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AimInDirectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.AimInDirection", true);
+        var parms = new AimInDirection_Params();
+        parms.Direction = Direction;
+        parms.Description = Description;
+        parms.AllowTurningToAim = AllowTurningToAim;
+        parms.LimitScale = LimitScale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AimAtActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct AimAtActor_Params
+    {
+        [FieldOffset(0)] public nint Actor;
+        [FieldOffset(4)] public BmSDK.FName Description;
+        [FieldOffset(12)] public BmSDK.FName ActorBoneName;
+        [FieldOffset(20)] public BmSDK.BmGame.RAnimConfig.EYesNoDefault AllowTurningToAim;
+        [FieldOffset(24)] public float LimitScale;
+    }
+
     /// <summary>
     /// Function: AimAtActor
     /// </summary>
     public unsafe override void AimAtActor(BmSDK.Engine.Actor Actor, BmSDK.FName Description = default, BmSDK.FName ActorBoneName = default, BmSDK.BmGame.RAnimConfig.EYesNoDefault AllowTurningToAim = default, float LimitScale = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.AimAtActor", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Actor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Description, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ActorBoneName, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AllowTurningToAim, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LimitScale, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AimAtActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.AimAtActor", true);
+        var parms = new AimAtActor_Params();
+        parms.Actor = Actor?.Ptr ?? 0;
+        parms.Description = Description;
+        parms.ActorBoneName = ActorBoneName;
+        parms.AllowTurningToAim = AllowTurningToAim;
+        parms.LimitScale = LimitScale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitBackgroundMusicFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitBackgroundMusic_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitBackgroundMusic
     /// </summary>
     public unsafe virtual void InitBackgroundMusic()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.InitBackgroundMusic", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitBackgroundMusicFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.InitBackgroundMusic", true);
+        var parms = new InitBackgroundMusic_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAkComponentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetAkComponent_Params
+    {
+        [FieldOffset(0)] public int AllowCreate;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAkComponent
     /// </summary>
     public unsafe override BmSDK.Engine.AkComponent GetAkComponent(bool AllowCreate = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.GetAkComponent", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AllowCreate, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkComponent>(paramsPtr + 4);
+        var funcManaged = s_GetAkComponentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.GetAkComponent", true);
+        var parms = new GetAkComponent_Params();
+        parms.AllowCreate = AllowCreate ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkComponent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetOverrideActualEventActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetOverrideActualEventActor_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -479,10 +680,10 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe override BmSDK.Engine.Actor GetOverrideActualEventActor()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.GetOverrideActualEventActor", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(paramsPtr + 0);
+        var funcManaged = s_GetOverrideActualEventActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RAudioPointController.GetOverrideActualEventActor", true);
+        var parms = new GetOverrideActualEventActor_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Actor)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -499,8 +700,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool TVController
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 1; else *(int*)(Ptr + 1840) &= ~1; }
     }
 
     /// <summary>
@@ -508,8 +709,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool HarleyHeadController
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 2; else *(int*)(Ptr + 1840) &= ~2; }
     }
 
     /// <summary>
@@ -517,8 +718,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bPostBeginPlayed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 4; else *(int*)(Ptr + 1840) &= ~4; }
     }
 
     /// <summary>
@@ -526,8 +727,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bIgnoreBing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 8; else *(int*)(Ptr + 1840) &= ~8; }
     }
 
     /// <summary>
@@ -535,8 +736,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bBingBongPlaying
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 16; else *(int*)(Ptr + 1840) &= ~16; }
     }
 
     /// <summary>
@@ -544,8 +745,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bAdvanceHeadTime
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 32; else *(int*)(Ptr + 1840) &= ~32; }
     }
 
     /// <summary>
@@ -553,8 +754,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bSorted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 64; else *(int*)(Ptr + 1840) &= ~64; }
     }
 
     /// <summary>
@@ -562,8 +763,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 128; else *(int*)(Ptr + 1840) &= ~128; }
     }
 
     /// <summary>
@@ -571,8 +772,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bOldEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 256; else *(int*)(Ptr + 1840) &= ~256; }
     }
 
     /// <summary>
@@ -580,8 +781,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bAllowBingBong
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 512; else *(int*)(Ptr + 1840) &= ~512; }
     }
 
     /// <summary>
@@ -589,8 +790,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bHeadSpeaking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 1024; else *(int*)(Ptr + 1840) &= ~1024; }
     }
 
     /// <summary>
@@ -598,8 +799,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe bool bBongMarkerFinished
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1840); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1840); }
+        get { return (*(int*)(Ptr + 1840) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 1840) |= 2048; else *(int*)(Ptr + 1840) &= ~2048; }
     }
 
     /// <summary>
@@ -670,8 +871,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.VocalPriority StoredPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.VocalPriority>(Ptr + 1880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1880); }
+        get { return *(BmSDK.BmGame.RGameInfo.VocalPriority*)(Ptr + 1880); }
+        set { *(BmSDK.BmGame.RGameInfo.VocalPriority*)(Ptr + 1880) = value; }
     }
 
     /// <summary>
@@ -679,8 +880,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe float timeSpeaking
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1884); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1884); }
+        get { return *(float*)(Ptr + 1884); }
+        set { *(float*)(Ptr + 1884) = value; }
     }
 
     /// <summary>
@@ -718,8 +919,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe float WorldPlayTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1920); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1920); }
+        get { return *(float*)(Ptr + 1920); }
+        set { *(float*)(Ptr + 1920) = value; }
     }
 
     /// <summary>
@@ -727,8 +928,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe float lastDelta
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1924); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1924); }
+        get { return *(float*)(Ptr + 1924); }
+        set { *(float*)(Ptr + 1924) = value; }
     }
 
     /// <summary>
@@ -736,8 +937,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe float GoodFramerate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1928); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1928); }
+        get { return *(float*)(Ptr + 1928); }
+        set { *(float*)(Ptr + 1928) = value; }
     }
 
     /// <summary>
@@ -745,8 +946,8 @@ public partial class RAudioPointController : BmSDK.BmGame.RPawnCharacter, BmSDK.
     /// </summary>
     public unsafe int SpeakersToPlayOn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1932); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1932); }
+        get { return *(int*)(Ptr + 1932); }
+        set { *(int*)(Ptr + 1932) = value; }
     }
 
     /// <summary>
@@ -84,6 +84,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 32)]
     public partial record struct FInterrogationAnimations
     {
+        [FieldOffset(28)] private int _bitfield28;
+
         /// <summary>
         /// ObjectProperty: VillainAnimSet
         /// </summary>
@@ -96,46 +98,34 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: InterrogationStartAnim
         /// </summary>
-        public unsafe BmSDK.FName InterrogationStartAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.FName InterrogationStartAnim;
 
         /// <summary>
         /// ByteProperty: InterrogationPose
         /// </summary>
-        public unsafe BmSDK.BmGame.RBM2IdleConfig.EInterrogationPose InterrogationPose
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.EInterrogationPose>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RBM2IdleConfig.EInterrogationPose InterrogationPose;
 
         /// <summary>
         /// StructProperty: InterrogationOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 InterrogationOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 InterrogationOffset;
 
         /// <summary>
         /// BoolProperty: bUseIdleConfigLocator
         /// </summary>
-        public unsafe bool bUseIdleConfigLocator
+        public bool bUseIdleConfigLocator
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 28); }; }
+            readonly get => (_bitfield28 & 1) != 0;
+            set { if (value) _bitfield28 |= 1; else _bitfield28 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bUseIdleConfigInterrogationLocator
         /// </summary>
-        public unsafe bool bUseIdleConfigInterrogationLocator
+        public bool bUseIdleConfigInterrogationLocator
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 28); }; }
+            readonly get => (_bitfield28 & 2) != 0;
+            set { if (value) _bitfield28 |= 2; else _bitfield28 &= ~2; }
         }
     }
 
@@ -174,20 +164,12 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: IdleTriplet
         /// </summary>
-        public unsafe BmSDK.BmGame.RBM2IdleConfig.FBM2IdleSet IdleTriplet
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.FBM2IdleSet>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RBM2IdleConfig.FBM2IdleSet IdleTriplet;
 
         /// <summary>
         /// StructProperty: Randoms
         /// </summary>
-        public unsafe BmSDK.BmGame.RBM2IdleConfig.FRandomAnimationData Randoms
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.FRandomAnimationData>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.BmGame.RBM2IdleConfig.FRandomAnimationData Randoms;
     }
 
     /// <summary>
@@ -199,11 +181,7 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: IdleTriplet
         /// </summary>
-        public unsafe BmSDK.BmGame.RBM2IdleConfig.FBM2IdleSet IdleTriplet
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.FBM2IdleSet>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RBM2IdleConfig.FBM2IdleSet IdleTriplet;
 
         /// <summary>
         /// ArrayProperty: Events
@@ -217,20 +195,12 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Randoms
         /// </summary>
-        public unsafe BmSDK.BmGame.RBM2IdleConfig.FRandomAnimationData Randoms
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.FRandomAnimationData>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public BmSDK.BmGame.RBM2IdleConfig.FRandomAnimationData Randoms;
 
         /// <summary>
         /// StructProperty: StartledAnimations
         /// </summary>
-        public unsafe BmSDK.BmGame.RBM2IdleConfig.FStartledAnimationData StartledAnimations
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.FStartledAnimationData>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public BmSDK.BmGame.RBM2IdleConfig.FStartledAnimationData StartledAnimations;
     }
 
     /// <summary>
@@ -242,20 +212,12 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: FrontStartle
         /// </summary>
-        public unsafe BmSDK.BmGame.RBM2IdleConfig.FRandomAnimation FrontStartle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.FRandomAnimation>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RBM2IdleConfig.FRandomAnimation FrontStartle;
 
         /// <summary>
         /// StructProperty: BackStartle
         /// </summary>
-        public unsafe BmSDK.BmGame.RBM2IdleConfig.FRandomAnimation BackStartle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.FRandomAnimation>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RBM2IdleConfig.FRandomAnimation BackStartle;
     }
 
     /// <summary>
@@ -276,20 +238,12 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: MinTimeBetweenRandomAnimations
         /// </summary>
-        public unsafe float MinTimeBetweenRandomAnimations
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float MinTimeBetweenRandomAnimations;
 
         /// <summary>
         /// FloatProperty: MaxTimeBetweenRandomAnimations
         /// </summary>
-        public unsafe float MaxTimeBetweenRandomAnimations
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float MaxTimeBetweenRandomAnimations;
     }
 
     /// <summary>
@@ -298,31 +252,29 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 12)]
     public partial record struct FRandomAnimation
     {
+        [FieldOffset(8)] private int _bitfield8;
+
         /// <summary>
         /// NameProperty: AnimationName
         /// </summary>
-        public unsafe BmSDK.FName AnimationName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName AnimationName;
 
         /// <summary>
         /// BoolProperty: bHasNoMovement
         /// </summary>
-        public unsafe bool bHasNoMovement
+        public bool bHasNoMovement
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 1) != 0;
+            set { if (value) _bitfield8 |= 1; else _bitfield8 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bAllowAimAt
         /// </summary>
-        public unsafe bool bAllowAimAt
+        public bool bAllowAimAt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 2) != 0;
+            set { if (value) _bitfield8 |= 2; else _bitfield8 &= ~2; }
         }
     }
 
@@ -332,49 +284,43 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 20)]
     public partial record struct FEventAnimationData
     {
+        [FieldOffset(16)] private int _bitfield16;
+
         /// <summary>
         /// NameProperty: AnimationName
         /// </summary>
-        public unsafe BmSDK.FName AnimationName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName AnimationName;
 
         /// <summary>
         /// NameProperty: KismetInputLinkName
         /// </summary>
-        public unsafe BmSDK.FName KismetInputLinkName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName KismetInputLinkName;
 
         /// <summary>
         /// BoolProperty: bHasNoMovement
         /// </summary>
-        public unsafe bool bHasNoMovement
+        public bool bHasNoMovement
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 1) != 0;
+            set { if (value) _bitfield16 |= 1; else _bitfield16 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bAllowAimAt
         /// </summary>
-        public unsafe bool bAllowAimAt
+        public bool bAllowAimAt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 2) != 0;
+            set { if (value) _bitfield16 |= 2; else _bitfield16 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bCanStartleDuring
         /// </summary>
-        public unsafe bool bCanStartleDuring
+        public bool bCanStartleDuring
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 4) != 0;
+            set { if (value) _bitfield16 |= 4; else _bitfield16 &= ~4; }
         }
     }
 
@@ -387,29 +333,17 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: TransIn
         /// </summary>
-        public unsafe BmSDK.FName TransIn
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName TransIn;
 
         /// <summary>
         /// NameProperty: Idle
         /// </summary>
-        public unsafe BmSDK.FName Idle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName Idle;
 
         /// <summary>
         /// NameProperty: TransOut
         /// </summary>
-        public unsafe BmSDK.FName TransOut
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.FName TransOut;
     }
 
     /// <summary>
@@ -444,8 +378,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RBM2IdleConfig.BM2RelativeTransitionStyle IdleRelativeStyle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBM2IdleConfig.BM2RelativeTransitionStyle>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.BmGame.RBM2IdleConfig.BM2RelativeTransitionStyle*)(Ptr + 204); }
+        set { *(BmSDK.BmGame.RBM2IdleConfig.BM2RelativeTransitionStyle*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -462,8 +396,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName EndMovementStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(BmSDK.FName*)(Ptr + 212); }
+        set { *(BmSDK.FName*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -471,8 +405,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName EndWeaponStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(BmSDK.FName*)(Ptr + 220); }
+        set { *(BmSDK.FName*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -480,8 +414,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsAllowedToInstantlyChangeAnimation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 228); }
+        get { return (*(int*)(Ptr + 228) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 228) |= 1; else *(int*)(Ptr + 228) &= ~1; }
     }
 
     /// <summary>
@@ -489,8 +423,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsAllowedToInstantlyChangeAnimationEvenInTransition
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 228); }
+        get { return (*(int*)(Ptr + 228) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 228) |= 2; else *(int*)(Ptr + 228) &= ~2; }
     }
 
     /// <summary>
@@ -498,8 +432,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bStartIdleFromStart
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 228); }
+        get { return (*(int*)(Ptr + 228) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 228) |= 4; else *(int*)(Ptr + 228) &= ~4; }
     }
 
     /// <summary>
@@ -516,8 +450,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe float minTimeBetweenWalkVariants
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(float*)(Ptr + 236); }
+        set { *(float*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -525,8 +459,8 @@ public partial class RBM2IdleConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe float maxTimeBetweenWalkVariants
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(float*)(Ptr + 240); }
+        set { *(float*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -78,27 +78,47 @@ public partial class RBMAIAction_ArmourThugCasBrag : BmSDK.BmGame.RBMAIAction, B
         where TComponent : class, Framework.IScriptComponent<RBMAIAction_ArmourThugCasBrag>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PlayBragAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PlayBragAnim_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayBragAnim
     /// </summary>
     public unsafe virtual void PlayBragAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_ArmourThugCasBrag.PlayBragAnim", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayBragAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_ArmourThugCasBrag.PlayBragAnim", true);
+        var parms = new PlayBragAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActionTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct ActionTick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.BmGame.RBMAIAction.ActionTickResult ReturnValue;
+    }
+
     /// <summary>
     /// Function: ActionTick
     /// </summary>
     public unsafe override BmSDK.BmGame.RBMAIAction.ActionTickResult ActionTick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_ArmourThugCasBrag.ActionTick", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIAction.ActionTickResult>(paramsPtr + 4);
+        var funcManaged = s_ActionTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_ArmourThugCasBrag.ActionTick", true);
+        var parms = new ActionTick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_OnActivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnActivate_Params
+    {
     }
 
     /// <summary>
@@ -106,21 +126,28 @@ public partial class RBMAIAction_ArmourThugCasBrag : BmSDK.BmGame.RBMAIAction, B
     /// </summary>
     public unsafe override void OnActivate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_ArmourThugCasBrag.OnActivate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnActivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_ArmourThugCasBrag.OnActivate", true);
+        var parms = new OnActivate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCasualtyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCasualty_Params
+    {
+        [FieldOffset(0)] public nint NewCas;
+    }
+
     /// <summary>
     /// Function: SetCasualty
     /// </summary>
     public unsafe virtual void SetCasualty(BmSDK.BmGame.RPawnVillain NewCas)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_ArmourThugCasBrag.SetCasualty", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCas, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCasualtyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_ArmourThugCasBrag.SetCasualty", true);
+        var parms = new SetCasualty_Params();
+        parms.NewCas = NewCas?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -138,8 +165,8 @@ public partial class RBMAIAction_ArmourThugCasBrag : BmSDK.BmGame.RBMAIAction, B
     /// </summary>
     public unsafe bool bStartedPlayBrag
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 576) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 576); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 576); }
+        get { return (*(int*)(Ptr + 576) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 576) |= 1; else *(int*)(Ptr + 576) &= ~1; }
     }
 
     /// <summary>
@@ -147,8 +174,8 @@ public partial class RBMAIAction_ArmourThugCasBrag : BmSDK.BmGame.RBMAIAction, B
     /// </summary>
     public unsafe bool bIsExiting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 576) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 576); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 576); }
+        get { return (*(int*)(Ptr + 576) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 576) |= 2; else *(int*)(Ptr + 576) &= ~2; }
     }
 
     /// <summary>
@@ -156,8 +183,8 @@ public partial class RBMAIAction_ArmourThugCasBrag : BmSDK.BmGame.RBMAIAction, B
     /// </summary>
     public unsafe int PrevAnimIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 580); }
+        get { return *(int*)(Ptr + 580); }
+        set { *(int*)(Ptr + 580) = value; }
     }
 
     /// <summary>
@@ -171,7 +198,7 @@ public partial class RBMAIAction_ArmourThugCasBrag : BmSDK.BmGame.RBMAIAction, B
     /// </summary>
     public unsafe float NewAnimTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 588); }
+        get { return *(float*)(Ptr + 588); }
+        set { *(float*)(Ptr + 588) = value; }
     }
 }
@@ -73,16 +73,25 @@ public partial class RBMAIAction_WeaponSwitch : BmSDK.BmGame.RBMAIAction, BmSDK.
         where TComponent : class, Framework.IScriptComponent<RBMAIAction_WeaponSwitch>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_WeaponSwitchCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct WeaponSwitchCallback_Params
+    {
+        [FieldOffset(0)] public nint NewWeapon;
+        [FieldOffset(4)] public nint OldWeapon;
+        [FieldOffset(8)] public BmSDK.BmGame.RGameRI.WeaponSwitchCallbackResult ReturnValue;
+    }
+
     /// <summary>
     /// Function: WeaponSwitchCallback
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RGameRI.WeaponSwitchCallbackResult WeaponSwitchCallback(BmSDK.Engine.Inventory NewWeapon, BmSDK.Engine.Inventory OldWeapon)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_WeaponSwitch.WeaponSwitchCallback", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewWeapon, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OldWeapon, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameRI.WeaponSwitchCallbackResult>(paramsPtr + 8);
+        var funcManaged = s_WeaponSwitchCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIAction_WeaponSwitch.WeaponSwitchCallback", true);
+        var parms = new WeaponSwitchCallback_Params();
+        parms.NewWeapon = NewWeapon?.Ptr ?? 0;
+        parms.OldWeapon = OldWeapon?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 }
@@ -78,15 +78,28 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
         where TComponent : class, Framework.IScriptComponent<RBMAIController>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_IdleConfigIsBlockingLowPriorityPredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IdleConfigIsBlockingLowPriorityPred_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IdleConfigIsBlockingLowPriorityPred
     /// </summary>
     public unsafe virtual bool IdleConfigIsBlockingLowPriorityPred()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IdleConfigIsBlockingLowPriorityPred", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IdleConfigIsBlockingLowPriorityPredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IdleConfigIsBlockingLowPriorityPred", true);
+        var parms = new IdleConfigIsBlockingLowPriorityPred_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TakedownCancelledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TakedownCancelled_Params
+    {
     }
 
     /// <summary>
@@ -94,32 +107,54 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void TakedownCancelled()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TakedownCancelled", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TakedownCancelledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TakedownCancelled", true);
+        var parms = new TakedownCancelled_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyGunJamDiscoveredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct NotifyGunJamDiscovered_Params
+    {
+    }
+
     /// <summary>
     /// Function: NotifyGunJamDiscovered
     /// </summary>
     public unsafe virtual void NotifyGunJamDiscovered()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyGunJamDiscovered", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyGunJamDiscoveredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyGunJamDiscovered", true);
+        var parms = new NotifyGunJamDiscovered_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsPredThugInSmokeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsPredThugInSmoke_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsPredThugInSmoke
     /// </summary>
     public unsafe virtual bool IsPredThugInSmoke()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsPredThugInSmoke", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsPredThugInSmokeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsPredThugInSmoke", true);
+        var parms = new IsPredThugInSmoke_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_NotifyPathEdgeReachedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct NotifyPathEdgeReached_Params
+    {
+        [FieldOffset(0)] public nint NotifyAction;
+        [FieldOffset(4)] public nint NotifyHandle;
+        [FieldOffset(8)] public int EdgeID;
     }
 
     /// <summary>
@@ -127,146 +162,231 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void NotifyPathEdgeReached(BmSDK.BmGame.RBMAIAction NotifyAction, BmSDK.BmGame.RNavigationHandle NotifyHandle, int EdgeID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyPathEdgeReached", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotifyAction, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotifyHandle, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EdgeID, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyPathEdgeReachedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyPathEdgeReached", true);
+        var parms = new NotifyPathEdgeReached_Params();
+        parms.NotifyAction = NotifyAction?.Ptr ?? 0;
+        parms.NotifyHandle = NotifyHandle?.Ptr ?? 0;
+        parms.EdgeID = EdgeID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyPathFoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct NotifyPathFound_Params
+    {
+        [FieldOffset(0)] public nint NotifyAction;
+        [FieldOffset(4)] public nint NotifyHandle;
+    }
+
     /// <summary>
     /// Function: NotifyPathFound
     /// </summary>
     public unsafe virtual void NotifyPathFound(BmSDK.BmGame.RBMAIAction NotifyAction, BmSDK.BmGame.RNavigationHandle NotifyHandle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyPathFound", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotifyAction, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotifyHandle, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyPathFoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyPathFound", true);
+        var parms = new NotifyPathFound_Params();
+        parms.NotifyAction = NotifyAction?.Ptr ?? 0;
+        parms.NotifyHandle = NotifyHandle?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct NotifyEvent_Params
+    {
+        [FieldOffset(0)] public nint NotifyAction;
+        [FieldOffset(4)] public BmSDK.FString EventType;
+    }
+
     /// <summary>
     /// Function: NotifyEvent
     /// </summary>
     public unsafe virtual void NotifyEvent(BmSDK.BmGame.RBMAIAction NotifyAction, BmSDK.FString EventType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyEvent", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotifyAction, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyEvent", true);
+        var parms = new NotifyEvent_Params();
+        parms.NotifyAction = NotifyAction?.Ptr ?? 0;
+        parms.EventType = EventType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyFailedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NotifyFailed_Params
+    {
+        [FieldOffset(0)] public nint FinishedAction;
+    }
+
     /// <summary>
     /// Function: NotifyFailed
     /// </summary>
     public unsafe virtual void NotifyFailed(BmSDK.BmGame.RBMAIAction FinishedAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyFailed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishedAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyFailedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyFailed", true);
+        var parms = new NotifyFailed_Params();
+        parms.FinishedAction = FinishedAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyStoppedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NotifyStopped_Params
+    {
+        [FieldOffset(0)] public nint FinishedAction;
+    }
+
     /// <summary>
     /// Function: NotifyStopped
     /// </summary>
     public unsafe virtual void NotifyStopped(BmSDK.BmGame.RBMAIAction FinishedAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyStopped", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishedAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyStoppedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyStopped", true);
+        var parms = new NotifyStopped_Params();
+        parms.FinishedAction = FinishedAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NotifyFinished_Params
+    {
+        [FieldOffset(0)] public nint FinishedAction;
+    }
+
     /// <summary>
     /// Function: NotifyFinished
     /// </summary>
     public unsafe virtual void NotifyFinished(BmSDK.BmGame.RBMAIAction FinishedAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyFinished", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishedAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyFinished", true);
+        var parms = new NotifyFinished_Params();
+        parms.FinishedAction = FinishedAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SeenAnotherThugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SeenAnotherThug_Params
+    {
+        [FieldOffset(0)] public nint SeenPawn;
+    }
+
     /// <summary>
     /// Function: SeenAnotherThug
     /// </summary>
     public unsafe virtual void SeenAnotherThug(BmSDK.BmGame.RPawnVillain SeenPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SeenAnotherThug", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SeenPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SeenAnotherThugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SeenAnotherThug", true);
+        var parms = new SeenAnotherThug_Params();
+        parms.SeenPawn = SeenPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishGlanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinishGlance_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinishGlance
     /// </summary>
     public unsafe virtual void FinishGlance()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FinishGlance", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishGlanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FinishGlance", true);
+        var parms = new FinishGlance_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateGlanceTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateGlanceTarget_Params
+    {
+        [FieldOffset(0)] public nint NewBestGlanceable;
+        [FieldOffset(4)] public int NewGlancePriority;
+    }
+
     /// <summary>
     /// Function: UpdateGlanceTarget
     /// </summary>
     public unsafe virtual void UpdateGlanceTarget(BmSDK.BmGame.AlertInstance NewBestGlanceable, int NewGlancePriority)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.UpdateGlanceTarget", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewBestGlanceable, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGlancePriority, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateGlanceTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.UpdateGlanceTarget", true);
+        var parms = new UpdateGlanceTarget_Params();
+        parms.NewBestGlanceable = NewBestGlanceable?.Ptr ?? 0;
+        parms.NewGlancePriority = NewGlancePriority;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PawnBumpedByPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PawnBumpedByPlayer_Params
+    {
+        [FieldOffset(0)] public nint Player;
+    }
+
     /// <summary>
     /// Function: PawnBumpedByPlayer
     /// </summary>
     public unsafe virtual void PawnBumpedByPlayer(BmSDK.BmGame.RPawnPlayer Player)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PawnBumpedByPlayer", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PawnBumpedByPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PawnBumpedByPlayer", true);
+        var parms = new PawnBumpedByPlayer_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EndPredatorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EndPredator_Params
+    {
+    }
+
     /// <summary>
     /// Function: EndPredator
     /// </summary>
     public unsafe virtual void EndPredator()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.EndPredator", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EndPredatorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.EndPredator", true);
+        var parms = new EndPredator_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsClaimedByFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsClaimedBy_Params
+    {
+        [FieldOffset(0)] public nint TestCoord;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsClaimedBy
     /// </summary>
     public unsafe virtual bool IsClaimedBy(BmSDK.BmGame.RAlertEventCoordinatorBase TestCoord)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsClaimedBy", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestCoord, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsClaimedByFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsClaimedBy", true);
+        var parms = new IsClaimedBy_Params();
+        parms.TestCoord = TestCoord?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_LowerCurrentPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LowerCurrentPriority_Params
+    {
     }
 
     /// <summary>
@@ -274,36 +394,61 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void LowerCurrentPriority()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.LowerCurrentPriority", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LowerCurrentPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.LowerCurrentPriority", true);
+        var parms = new LowerCurrentPriority_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdatePriority_Params
+    {
+        [FieldOffset(0)] public int NewPriority;
+    }
+
     /// <summary>
     /// Function: UpdatePriority
     /// </summary>
     public unsafe virtual void UpdatePriority(int NewPriority)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.UpdatePriority", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPriority, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdatePriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.UpdatePriority", true);
+        var parms = new UpdatePriority_Params();
+        parms.NewPriority = NewPriority;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SuccessfullyClaimedByFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SuccessfullyClaimedBy_Params
+    {
+        [FieldOffset(0)] public nint NewCoord;
+        [FieldOffset(4)] public int NewPriority;
+        [FieldOffset(8)] public int bForceClaim;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SuccessfullyClaimedBy
     /// </summary>
     public unsafe virtual bool SuccessfullyClaimedBy(BmSDK.BmGame.RAlertEventCoordinatorBase NewCoord, int NewPriority, bool bForceClaim = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SuccessfullyClaimedBy", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCoord, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPriority, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceClaim, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_SuccessfullyClaimedByFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SuccessfullyClaimedBy", true);
+        var parms = new SuccessfullyClaimedBy_Params();
+        parms.NewCoord = NewCoord?.Ptr ?? 0;
+        parms.NewPriority = NewPriority;
+        parms.bForceClaim = bForceClaim ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanBeClaimedByFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanBeClaimedBy_Params
+    {
+        [FieldOffset(0)] public int NewPriority;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -311,11 +456,18 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool CanBeClaimedBy(int NewPriority)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanBeClaimedBy", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPriority, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanBeClaimedByFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanBeClaimedBy", true);
+        var parms = new CanBeClaimedBy_Params();
+        parms.NewPriority = NewPriority;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsLitePredThugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsLitePredThug_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -323,10 +475,16 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool IsLitePredThug()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsLitePredThug", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsLitePredThugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsLitePredThug", true);
+        var parms = new IsLitePredThug_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_NotifyGunEmptyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NotifyGunEmpty_Params
+    {
     }
 
     /// <summary>
@@ -334,76 +492,119 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void NotifyGunEmpty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyGunEmpty", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyGunEmptyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.NotifyGunEmpty", true);
+        var parms = new NotifyGunEmpty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetUpNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GetUpNotify_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetUpNotify
     /// </summary>
     public unsafe virtual void GetUpNotify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetUpNotify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GetUpNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetUpNotify", true);
+        var parms = new GetUpNotify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinalBlowFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinalBlowFinished_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinalBlowFinished
     /// </summary>
     public unsafe virtual void FinalBlowFinished()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FinalBlowFinished", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinalBlowFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FinalBlowFinished", true);
+        var parms = new FinalBlowFinished_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinalBlowTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinalBlowTarget_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinalBlowTarget
     /// </summary>
     public unsafe virtual void FinalBlowTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FinalBlowTarget", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinalBlowTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FinalBlowTarget", true);
+        var parms = new FinalBlowTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsBeingTakenDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IsBeingTakenDown_Params
+    {
+    }
+
     /// <summary>
     /// Function: IsBeingTakenDown
     /// </summary>
     public unsafe virtual void IsBeingTakenDown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsBeingTakenDown", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IsBeingTakenDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsBeingTakenDown", true);
+        var parms = new IsBeingTakenDown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayHangAttackScreamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayHangAttackScream_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayHangAttackScream
     /// </summary>
     public unsafe virtual void PlayHangAttackScream()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayHangAttackScream", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayHangAttackScreamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayHangAttackScream", true);
+        var parms = new PlayHangAttackScream_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanBatmanGrabFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanBatmanGrab_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.BatmanGrabType ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanBatmanGrab
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMAIController.BatmanGrabType CanBatmanGrab()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanBatmanGrab", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIController.BatmanGrabType>(paramsPtr + 0);
+        var funcManaged = s_CanBatmanGrabFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanBatmanGrab", true);
+        var parms = new CanBatmanGrab_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_BroadcastBatmanSpottedToSnipersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct BroadcastBatmanSpottedToSnipers_Params
+    {
     }
 
     /// <summary>
@@ -411,118 +612,189 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void BroadcastBatmanSpottedToSnipers()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.BroadcastBatmanSpottedToSnipers", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BroadcastBatmanSpottedToSnipersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.BroadcastBatmanSpottedToSnipers", true);
+        var parms = new BroadcastBatmanSpottedToSnipers_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PredThugDisarmedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PredThugDisarmed_Params
+    {
+    }
+
     /// <summary>
     /// Function: PredThugDisarmed
     /// </summary>
     public unsafe virtual void PredThugDisarmed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PredThugDisarmed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PredThugDisarmedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PredThugDisarmed", true);
+        var parms = new PredThugDisarmed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetupNoisyTakedownWithNoReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetupNoisyTakedownWithNoReaction_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.CasualtyScreamReason ScreamReason;
+    }
+
     /// <summary>
     /// Function: SetupNoisyTakedownWithNoReaction
     /// </summary>
     public unsafe virtual void SetupNoisyTakedownWithNoReaction(BmSDK.BmGame.RBMAIController.CasualtyScreamReason ScreamReason)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetupNoisyTakedownWithNoReaction", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreamReason, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetupNoisyTakedownWithNoReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetupNoisyTakedownWithNoReaction", true);
+        var parms = new SetupNoisyTakedownWithNoReaction_Params();
+        parms.ScreamReason = ScreamReason;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoNoisyTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct DoNoisyTakedown_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.CasualtyScreamReason ScreamReason;
+    }
+
     /// <summary>
     /// Function: DoNoisyTakedown
     /// </summary>
     public unsafe virtual void DoNoisyTakedown(BmSDK.BmGame.RBMAIController.CasualtyScreamReason ScreamReason)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DoNoisyTakedown", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreamReason, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoNoisyTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DoNoisyTakedown", true);
+        var parms = new DoNoisyTakedown_Params();
+        parms.ScreamReason = ScreamReason;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearAlertsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearAlerts_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearAlerts
     /// </summary>
     public unsafe virtual void ClearAlerts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearAlerts", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearAlertsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearAlerts", true);
+        var parms = new ClearAlerts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct AddAlert_Params
+    {
+        [FieldOffset(0)] public nint NewActor;
+        [FieldOffset(4)] public System.Numerics.Vector3 NewLocation;
+        [FieldOffset(16)] public BmSDK.BmGame.AlertInstance.InterruptType NewType;
+        [FieldOffset(20)] public int bAddIfNew;
+        [FieldOffset(24)] public float BackDateTime;
+    }
+
     /// <summary>
     /// Function: AddAlert
     /// </summary>
     public unsafe virtual void AddAlert(BmSDK.Engine.Actor NewActor, System.Numerics.Vector3 NewLocation, BmSDK.BmGame.AlertInstance.InterruptType NewType, bool bAddIfNew = default, float BackDateTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddAlert", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewType, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAddIfNew, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BackDateTime, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddAlert", true);
+        var parms = new AddAlert_Params();
+        parms.NewActor = NewActor?.Ptr ?? 0;
+        parms.NewLocation = NewLocation;
+        parms.NewType = NewType;
+        parms.bAddIfNew = bAddIfNew ? 1 : 0;
+        parms.BackDateTime = BackDateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveAlertActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveAlertActor_Params
+    {
+        [FieldOffset(0)] public nint ExAlertActor;
+    }
+
     /// <summary>
     /// Function: RemoveAlertActor
     /// </summary>
     public unsafe virtual void RemoveAlertActor(BmSDK.Engine.Actor ExAlertActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RemoveAlertActor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExAlertActor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveAlertActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RemoveAlertActor", true);
+        var parms = new RemoveAlertActor_Params();
+        parms.ExAlertActor = ExAlertActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddNewAlertActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddNewAlertActor_Params
+    {
+        [FieldOffset(0)] public nint NewAlertActor;
+    }
+
     /// <summary>
     /// Function: AddNewAlertActor
     /// </summary>
     public unsafe virtual void AddNewAlertActor(BmSDK.Engine.Actor NewAlertActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddNewAlertActor", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewAlertActor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddNewAlertActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddNewAlertActor", true);
+        var parms = new AddNewAlertActor_Params();
+        parms.NewAlertActor = NewAlertActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FireSeenEventsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FireSeenEvents_Params
+    {
+    }
+
     /// <summary>
     /// Function: FireSeenEvents
     /// </summary>
     public unsafe virtual void FireSeenEvents()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FireSeenEvents", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FireSeenEventsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FireSeenEvents", true);
+        var parms = new FireSeenEvents_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldIgnoreSilentPredatorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldIgnoreSilentPredator_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldIgnoreSilentPredator
     /// </summary>
     public unsafe virtual bool ShouldIgnoreSilentPredator()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ShouldIgnoreSilentPredator", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldIgnoreSilentPredatorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ShouldIgnoreSilentPredator", true);
+        var parms = new ShouldIgnoreSilentPredator_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RoomFearChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct RoomFearChanged_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMRoomAIState.VillainFearLevel NewLevel;
     }
 
     /// <summary>
@@ -530,22 +802,36 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void RoomFearChanged(BmSDK.BmGame.RBMRoomAIState.VillainFearLevel NewLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RoomFearChanged", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLevel, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RoomFearChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RoomFearChanged", true);
+        var parms = new RoomFearChanged_Params();
+        parms.NewLevel = NewLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAnimationFearLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 2)]
+    private struct GetAnimationFearLevel_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMRoomAIState.VillainFearLevel ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAnimationFearLevel
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMRoomAIState.VillainFearLevel GetAnimationFearLevel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetAnimationFearLevel", true);
-        byte* paramsPtr = stackalloc byte[2];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMRoomAIState.VillainFearLevel>(paramsPtr + 0);
+        var funcManaged = s_GetAnimationFearLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetAnimationFearLevel", true);
+        var parms = new GetAnimationFearLevel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDialogueFearLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct GetDialogueFearLevel_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMRoomAIState.VillainFearLevel ReturnValue;
     }
 
     /// <summary>
@@ -553,10 +839,18 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMRoomAIState.VillainFearLevel GetDialogueFearLevel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetDialogueFearLevel", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMRoomAIState.VillainFearLevel>(paramsPtr + 0);
+        var funcManaged = s_GetDialogueFearLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetDialogueFearLevel", true);
+        var parms = new GetDialogueFearLevel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetBarkPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetBarkPriority_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.BarkType BarkIndex;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -564,11 +858,18 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual int GetBarkPriority(BmSDK.BmGame.RBMAIController.BarkType BarkIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetBarkPriority", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BarkIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetBarkPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetBarkPriority", true);
+        var parms = new GetBarkPriority_Params();
+        parms.BarkIndex = BarkIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_OnStopSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnStopSpeech_Params
+    {
+        [FieldOffset(0)] public nint SpeechAction;
     }
 
     /// <summary>
@@ -576,85 +877,140 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void OnStopSpeech(BmSDK.BmGame.RBMSeqAct_StopSpeech SpeechAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.OnStopSpeech", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnStopSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.OnStopSpeech", true);
+        var parms = new OnStopSpeech_Params();
+        parms.SpeechAction = SpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlaySpeechCombinedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlaySpeechCombined_Params
+    {
+        [FieldOffset(0)] public nint SpeechAction;
+    }
+
     /// <summary>
     /// Function: PlaySpeechCombined
     /// </summary>
     public unsafe virtual void PlaySpeechCombined(BmSDK.BmGame.RSeqAct_PlaySpeechCombined SpeechAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlaySpeechCombined", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySpeechCombinedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlaySpeechCombined", true);
+        var parms = new PlaySpeechCombined_Params();
+        parms.SpeechAction = SpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnPlaySpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnPlaySpeech_Params
+    {
+        [FieldOffset(0)] public nint SpeechAction;
+    }
+
     /// <summary>
     /// Function: OnPlaySpeech
     /// </summary>
     public unsafe virtual void OnPlaySpeech(BmSDK.BmGame.RBMSeqAct_PlaySpeech SpeechAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.OnPlaySpeech", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnPlaySpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.OnPlaySpeech", true);
+        var parms = new OnPlaySpeech_Params();
+        parms.SpeechAction = SpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlaySpeechGenericFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlaySpeechGeneric_Params
+    {
+        [FieldOffset(0)] public nint DialogueLine;
+        [FieldOffset(4)] public int bInterruptCurrentSpeech;
+        [FieldOffset(8)] public nint SpeechAction;
+    }
+
     /// <summary>
     /// Function: PlaySpeechGeneric
     /// </summary>
     public unsafe virtual void PlaySpeechGeneric(BmSDK.Engine.RDialogueLine DialogueLine, bool bInterruptCurrentSpeech, BmSDK.BmGame.RSeqAct_PlaySpeechBase SpeechAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlaySpeechGeneric", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueLine, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInterruptCurrentSpeech, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechAction, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySpeechGenericFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlaySpeechGeneric", true);
+        var parms = new PlaySpeechGeneric_Params();
+        parms.DialogueLine = DialogueLine?.Ptr ?? 0;
+        parms.bInterruptCurrentSpeech = bInterruptCurrentSpeech ? 1 : 0;
+        parms.SpeechAction = SpeechAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddFlagsForNumberOfGargsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct AddFlagsForNumberOfGargs_Params
+    {
+        [FieldOffset(0)] public nint ContextFlags;
+    }
+
     /// <summary>
     /// Function: AddFlagsForNumberOfGargs
     /// </summary>
     public unsafe virtual void AddFlagsForNumberOfGargs(out BmSDK.BmGame.RBarkFlagBase ContextFlags)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddFlagsForNumberOfGargs", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ContextFlags = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBarkFlagBase>(paramsPtr + 0);
+        var funcManaged = s_AddFlagsForNumberOfGargsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddFlagsForNumberOfGargs", true);
+        var parms = new AddFlagsForNumberOfGargs_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ContextFlags = parms.ContextFlags == 0 ? null : (BmSDK.BmGame.RBarkFlagBase)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ContextFlags);
         return;
     }
 
+    static BmSDK.Function s_SetEnvironmentFlagsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetEnvironmentFlags_Params
+    {
+        [FieldOffset(0)] public nint FB;
+    }
+
     /// <summary>
     /// Function: SetEnvironmentFlags
     /// </summary>
     public unsafe virtual void SetEnvironmentFlags(out BmSDK.BmGame.RBarkFlagBase FB)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetEnvironmentFlags", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        FB = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBarkFlagBase>(paramsPtr + 0);
+        var funcManaged = s_SetEnvironmentFlagsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetEnvironmentFlags", true);
+        var parms = new SetEnvironmentFlags_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        FB = parms.FB == 0 ? null : (BmSDK.BmGame.RBarkFlagBase)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.FB);
         return;
     }
 
+    static BmSDK.Function s_PlayExclaimBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PlayExclaimBark_Params
+    {
+        [FieldOffset(0)] public int TestPriority;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PlayExclaimBark
     /// </summary>
     public unsafe virtual bool PlayExclaimBark(int TestPriority)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayExclaimBark", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPriority, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_PlayExclaimBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayExclaimBark", true);
+        var parms = new PlayExclaimBark_Params();
+        parms.TestPriority = TestPriority;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayBarkFromIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct PlayBarkFromIndex_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.BarkType CueIndex;
+        [FieldOffset(4)] public nint BarkSubject;
+        [FieldOffset(20)] public int bIsFollowOn;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -662,14 +1018,21 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool PlayBarkFromIndex(BmSDK.BmGame.RBMAIController.BarkType CueIndex, BmSDK.Engine.Actor BarkSubject = default, BmSDK.TArray<BmSDK.BmGame.RBarkFlagBase.FBarkFlag> ExtraFlags = default, bool bIsFollowOn = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayBarkFromIndex", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CueIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BarkSubject, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExtraFlags, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsFollowOn, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_PlayBarkFromIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayBarkFromIndex", true);
+        var parms = new PlayBarkFromIndex_Params();
+        parms.CueIndex = CueIndex;
+        parms.BarkSubject = BarkSubject?.Ptr ?? 0;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExtraFlags, (byte*)&parms + 8);
+        parms.bIsFollowOn = bIsFollowOn ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayBarkFromIndexIfQuietFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PlayBarkFromIndexIfQuiet_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.BarkType CueIndex;
     }
 
     /// <summary>
@@ -677,35 +1040,55 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void PlayBarkFromIndexIfQuiet(BmSDK.BmGame.RBMAIController.BarkType CueIndex, BmSDK.TArray<BmSDK.BmGame.RBarkFlagBase.FBarkFlag> ExtraFlags = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayBarkFromIndexIfQuiet", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CueIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExtraFlags, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayBarkFromIndexIfQuietFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayBarkFromIndexIfQuiet", true);
+        var parms = new PlayBarkFromIndexIfQuiet_Params();
+        parms.CueIndex = CueIndex;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExtraFlags, (byte*)&parms + 4);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayTannoyResponseBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 2)]
+    private struct PlayTannoyResponseBark_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.ThugResponseType ResponseType;
+    }
+
     /// <summary>
     /// Function: PlayTannoyResponseBark
     /// </summary>
     public unsafe virtual void PlayTannoyResponseBark(BmSDK.BmGame.RGameInfo.ThugResponseType ResponseType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayTannoyResponseBark", true);
-        byte* paramsPtr = stackalloc byte[2];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ResponseType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayTannoyResponseBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayTannoyResponseBark", true);
+        var parms = new PlayTannoyResponseBark_Params();
+        parms.ResponseType = ResponseType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayRandomBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayRandomBark_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PlayRandomBark
     /// </summary>
     public unsafe virtual bool PlayRandomBark()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayRandomBark", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_PlayRandomBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayRandomBark", true);
+        var parms = new PlayRandomBark_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DrawViewConeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 100)]
+    private struct DrawViewCone_Params
+    {
     }
 
     /// <summary>
@@ -713,60 +1096,98 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void DrawViewCone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DrawViewCone", true);
-        byte* paramsPtr = stackalloc byte[100];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawViewConeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DrawViewCone", true);
+        var parms = new DrawViewCone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetThoughtsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct GetThoughts_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetThoughts
     /// </summary>
     public unsafe virtual void GetThoughts(out BmSDK.TArray<BmSDK.Engine.Actor.FThought> ThoughtList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetThoughts", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>(paramsPtr + 0);
+        var funcManaged = s_GetThoughtsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetThoughts", true);
+        var parms = new GetThoughts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_AddThoughtFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct AddThought_Params
+    {
+        [FieldOffset(12)] public BmSDK.FString ThoughtText;
+        [FieldOffset(24)] public int R;
+        [FieldOffset(28)] public int G;
+        [FieldOffset(32)] public int B;
+    }
+
     /// <summary>
     /// Function: AddThought
     /// </summary>
     public unsafe virtual void AddThought(out BmSDK.TArray<BmSDK.Engine.Actor.FThought> ThoughtList, BmSDK.FString ThoughtText, int R = default, int G = default, int B = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddThought", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThoughtText, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(R, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(G, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(B, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>(paramsPtr + 0);
+        var funcManaged = s_AddThoughtFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddThought", true);
+        var parms = new AddThought_Params();
+        parms.ThoughtText = ThoughtText;
+        parms.R = R;
+        parms.G = G;
+        parms.B = B;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveFromAIManagerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveFromAIManager_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveFromAIManager
     /// </summary>
     public unsafe override void RemoveFromAIManager()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RemoveFromAIManager", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveFromAIManagerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RemoveFromAIManager", true);
+        var parms = new RemoveFromAIManager_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanCheckFallingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanCheckFalling_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanCheckFalling
     /// </summary>
     public unsafe virtual bool CanCheckFalling()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanCheckFalling", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanCheckFallingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanCheckFalling", true);
+        var parms = new CanCheckFalling_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DodgeLineLaunchKickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DodgeLineLaunchKick_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+        [FieldOffset(4)] public System.Numerics.Vector3 KickDirection;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -774,12 +1195,20 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool DodgeLineLaunchKick(BmSDK.BmGame.RPawnPlayer Attacker, System.Numerics.Vector3 KickDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DodgeLineLaunchKick", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(KickDirection, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_DodgeLineLaunchKickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DodgeLineLaunchKick", true);
+        var parms = new DodgeLineLaunchKick_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        parms.KickDirection = KickDirection;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DodgeDropAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DodgeDropAttack_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -787,11 +1216,24 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool DodgeDropAttack(BmSDK.BmGame.RPawnPlayer Attacker)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DodgeDropAttack", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_DodgeDropAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DodgeDropAttack", true);
+        var parms = new DodgeDropAttack_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckDodgeProjectileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct CheckDodgeProjectile_Params
+    {
+        [FieldOffset(0)] public nint Thrower;
+        [FieldOffset(4)] public BmSDK.FName TargetBone;
+        [FieldOffset(12)] public System.Numerics.Vector3 ProjPos;
+        [FieldOffset(24)] public int BatarangID;
+        [FieldOffset(28)] public int bForceDodge;
+        [FieldOffset(32)] public int bSteerableProj;
+        [FieldOffset(36)] public int ReturnValue;
     }
 
     /// <summary>
@@ -799,16 +1241,23 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool CheckDodgeProjectile(BmSDK.BmGame.RPawn Thrower, BmSDK.FName TargetBone, System.Numerics.Vector3 ProjPos, int BatarangID, bool bForceDodge = default, bool bSteerableProj = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CheckDodgeProjectile", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Thrower, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBone, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ProjPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BatarangID, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceDodge, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSteerableProj, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 36);
+        var funcManaged = s_CheckDodgeProjectileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CheckDodgeProjectile", true);
+        var parms = new CheckDodgeProjectile_Params();
+        parms.Thrower = Thrower?.Ptr ?? 0;
+        parms.TargetBone = TargetBone;
+        parms.ProjPos = ProjPos;
+        parms.BatarangID = BatarangID;
+        parms.bForceDodge = bForceDodge ? 1 : 0;
+        parms.bSteerableProj = bSteerableProj ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetDodgeClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDodgeClass_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -816,10 +1265,19 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.Class GetDodgeClass()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetDodgeClass", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetDodgeClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetDodgeClass", true);
+        var parms = new GetDodgeClass_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_CanDodgeProjectileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CanDodgeProjectile_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ThrownFromPos;
+        [FieldOffset(12)] public int CheckBatarangID;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -827,12 +1285,20 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool CanDodgeProjectile(System.Numerics.Vector3 ThrownFromPos, int CheckBatarangID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanDodgeProjectile", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownFromPos, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckBatarangID, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_CanDodgeProjectileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanDodgeProjectile", true);
+        var parms = new CanDodgeProjectile_Params();
+        parms.ThrownFromPos = ThrownFromPos;
+        parms.CheckBatarangID = CheckBatarangID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BlockAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct BlockAttack_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+        [FieldOffset(4)] public nint dmgType;
     }
 
     /// <summary>
@@ -840,49 +1306,83 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void BlockAttack(BmSDK.BmGame.RPawnCombat Attacker, BmSDK.Class dmgType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.BlockAttack", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BlockAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.BlockAttack", true);
+        var parms = new BlockAttack_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PrepareToBlockAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PrepareToBlockAttack_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+    }
+
     /// <summary>
     /// Function: PrepareToBlockAttack
     /// </summary>
     public unsafe virtual void PrepareToBlockAttack(BmSDK.BmGame.RPawnCombat Attacker)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PrepareToBlockAttack", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PrepareToBlockAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PrepareToBlockAttack", true);
+        var parms = new PrepareToBlockAttack_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RepelAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RepelAttack_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+    }
+
     /// <summary>
     /// Function: RepelAttack
     /// </summary>
     public unsafe virtual void RepelAttack(BmSDK.BmGame.RPawnCombat Attacker)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RepelAttack", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RepelAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RepelAttack", true);
+        var parms = new RepelAttack_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleFreezeClusterGrenadeHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct HandleFreezeClusterGrenadeHit_Params
+    {
+        [FieldOffset(0)] public nint Player;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitNormal;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HandleFreezeClusterGrenadeHit
     /// </summary>
     public unsafe virtual bool HandleFreezeClusterGrenadeHit(BmSDK.BmGame.RPawnPlayer Player, System.Numerics.Vector3 HitNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HandleFreezeClusterGrenadeHit", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_HandleFreezeClusterGrenadeHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HandleFreezeClusterGrenadeHit", true);
+        var parms = new HandleFreezeClusterGrenadeHit_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        parms.HitNormal = HitNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HandleFreezeBlastHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct HandleFreezeBlastHit_Params
+    {
+        [FieldOffset(0)] public nint Player;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitNormal;
+        [FieldOffset(16)] public nint Proj;
+        [FieldOffset(20)] public int bInstantFreeze;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -890,14 +1390,25 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool HandleFreezeBlastHit(BmSDK.BmGame.RPawnPlayer Player, System.Numerics.Vector3 HitNormal, BmSDK.BmGame.RFreezeSprayProjectile Proj = default, bool bInstantFreeze = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HandleFreezeBlastHit", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proj, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantFreeze, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_HandleFreezeBlastHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HandleFreezeBlastHit", true);
+        var parms = new HandleFreezeBlastHit_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        parms.HitNormal = HitNormal;
+        parms.Proj = Proj?.Ptr ?? 0;
+        parms.bInstantFreeze = bInstantFreeze ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TakeElectricityDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct TakeElectricityDamage_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 HitNormal;
+        [FieldOffset(24)] public nint HitActor;
+        [FieldOffset(28)] public int bKill;
+        [FieldOffset(32)] public nint dmgType;
     }
 
     /// <summary>
@@ -905,40 +1416,63 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void TakeElectricityDamage(System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 HitNormal, BmSDK.Engine.Actor HitActor = default, bool bKill = default, BmSDK.Class dmgType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TakeElectricityDamage", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitActor, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bKill, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TakeElectricityDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TakeElectricityDamage", true);
+        var parms = new TakeElectricityDamage_Params();
+        parms.HitLocation = HitLocation;
+        parms.HitNormal = HitNormal;
+        parms.HitActor = HitActor?.Ptr ?? 0;
+        parms.bKill = bKill ? 1 : 0;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GoRagdollFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 280)]
+    private struct GoRagdoll_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo;
+        [FieldOffset(244)] public BmSDK.BmGame.RGameInfo.RagdollStunType NewStunType;
+        [FieldOffset(248)] public int bKill;
+    }
+
     /// <summary>
     /// Function: GoRagdoll
     /// </summary>
     public unsafe virtual void GoRagdoll(BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo, BmSDK.BmGame.RGameInfo.RagdollStunType NewStunType = default, bool bKill = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GoRagdoll", true);
-        byte* paramsPtr = stackalloc byte[280];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DmgInfo, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewStunType, paramsPtr + 244);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bKill, paramsPtr + 248);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GoRagdollFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GoRagdoll", true);
+        var parms = new GoRagdoll_Params();
+        parms.DmgInfo = DmgInfo;
+        parms.NewStunType = NewStunType;
+        parms.bKill = bKill ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsStunnedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsStunned_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsStunned
     /// </summary>
     public unsafe virtual bool IsStunned()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsStunned", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsStunnedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsStunned", true);
+        var parms = new IsStunned_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetStunnedRagdollFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetStunnedRagdoll_Params
+    {
+        [FieldOffset(0)] public int bNewValue;
     }
 
     /// <summary>
@@ -946,34 +1480,55 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetStunnedRagdoll(bool bNewValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetStunnedRagdoll", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewValue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetStunnedRagdollFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetStunnedRagdoll", true);
+        var parms = new SetStunnedRagdoll_Params();
+        parms.bNewValue = bNewValue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RedirectedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Redirected_Params
+    {
+    }
+
     /// <summary>
     /// Function: Redirected
     /// </summary>
     public unsafe virtual void Redirected()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.Redirected", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RedirectedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.Redirected", true);
+        var parms = new Redirected_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanBeHitInCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanBeHitInCombat_Params
+    {
+        [FieldOffset(0)] public nint DamageType;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanBeHitInCombat
     /// </summary>
     public unsafe virtual bool CanBeHitInCombat(BmSDK.BmGame.RDamageType DamageType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanBeHitInCombat", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanBeHitInCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanBeHitInCombat", true);
+        var parms = new CanBeHitInCombat_Params();
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CombatMoveInitialisedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CombatMoveInitialised_Params
+    {
+        [FieldOffset(0)] public nint NewMove;
     }
 
     /// <summary>
@@ -981,22 +1536,36 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void CombatMoveInitialised(BmSDK.BmGame.RCombatMove NewMove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CombatMoveInitialised", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatMoveInitialisedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CombatMoveInitialised", true);
+        var parms = new CombatMoveInitialised_Params();
+        parms.NewMove = NewMove?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCMFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetCM_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCM
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMCombatManager GetCM()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetCM", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMCombatManager>(paramsPtr + 0);
+        var funcManaged = s_GetCMFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetCM", true);
+        var parms = new GetCM_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMCombatManager)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_DemoteBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DemoteBehaviour_Params
+    {
+        [FieldOffset(0)] public nint BehaviourToDemote;
     }
 
     /// <summary>
@@ -1004,56 +1573,80 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void DemoteBehaviour(BmSDK.BmGame.RBMBehaviour BehaviourToDemote)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DemoteBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehaviourToDemote, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DemoteBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DemoteBehaviour", true);
+        var parms = new DemoteBehaviour_Params();
+        parms.BehaviourToDemote = BehaviourToDemote?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InstantExitBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InstantExitBehaviour_Params
+    {
+        [FieldOffset(0)] public nint BehaviourToExit;
+        [FieldOffset(4)] public int bCallEndInterrupt;
+    }
+
     /// <summary>
     /// Function: InstantExitBehaviour
     /// </summary>
     public unsafe virtual void InstantExitBehaviour(BmSDK.BmGame.RBMBehaviour BehaviourToExit, bool bCallEndInterrupt = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.InstantExitBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehaviourToExit, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCallEndInterrupt, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InstantExitBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.InstantExitBehaviour", true);
+        var parms = new InstantExitBehaviour_Params();
+        parms.BehaviourToExit = BehaviourToExit?.Ptr ?? 0;
+        parms.bCallEndInterrupt = bCallEndInterrupt ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TickBehaviour_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: TickBehaviour
     /// </summary>
     public unsafe virtual void TickBehaviour(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TickBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_TickBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TickBehaviour", true);
+        var parms = new TickBehaviour_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PointIsValidLookatPosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct PointIsValidLookatPos_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TestPos;
+        [FieldOffset(12)] public int bDoTrace;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PointIsValidLookatPos
     /// </summary>
     public unsafe virtual bool PointIsValidLookatPos(System.Numerics.Vector3 TestPos, bool bDoTrace = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PointIsValidLookatPos", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPos, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDoTrace, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_PointIsValidLookatPosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PointIsValidLookatPos", true);
+        var parms = new PointIsValidLookatPos_Params();
+        parms.TestPos = TestPos;
+        parms.bDoTrace = bDoTrace ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetDirectionOfFocusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetDirectionOfFocus_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -1061,10 +1654,16 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetDirectionOfFocus()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetDirectionOfFocus", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetDirectionOfFocusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetDirectionOfFocus", true);
+        var parms = new GetDirectionOfFocus_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SpawnDefaultBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnDefaultBehaviour_Params
+    {
     }
 
     /// <summary>
@@ -1072,21 +1671,35 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SpawnDefaultBehaviour()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnDefaultBehaviour", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnDefaultBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnDefaultBehaviour", true);
+        var parms = new SpawnDefaultBehaviour_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetEntryAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetEntryAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetEntryAnim
     /// </summary>
     public unsafe virtual BmSDK.FName GetEntryAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetEntryAnim", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
+        var funcManaged = s_GetEntryAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetEntryAnim", true);
+        var parms = new GetEntryAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetEntryAnimSetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetEntryAnimSet_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1094,10 +1707,17 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.Engine.AnimSet GetEntryAnimSet()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetEntryAnimSet", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSet>(paramsPtr + 0);
+        var funcManaged = s_GetEntryAnimSetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetEntryAnimSet", true);
+        var parms = new GetEntryAnimSet_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AnimSet)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsValidSpeakerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsValidSpeaker_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1105,10 +1725,16 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool IsValidSpeaker()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsValidSpeaker", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsValidSpeakerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsValidSpeaker", true);
+        var parms = new IsValidSpeaker_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ProcessWeaponChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ProcessWeaponChange_Params
+    {
     }
 
     /// <summary>
@@ -1116,32 +1742,52 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void ProcessWeaponChange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ProcessWeaponChange", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ProcessWeaponChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ProcessWeaponChange", true);
+        var parms = new ProcessWeaponChange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeaponChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct WeaponChanged_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeaponChanged
     /// </summary>
     public unsafe virtual void WeaponChanged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.WeaponChanged", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeaponChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.WeaponChanged", true);
+        var parms = new WeaponChanged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldCombatantForceCombatCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldCombatantForceCombatCamera_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldCombatantForceCombatCamera
     /// </summary>
     public unsafe virtual bool ShouldCombatantForceCombatCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ShouldCombatantForceCombatCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldCombatantForceCombatCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ShouldCombatantForceCombatCamera", true);
+        var parms = new ShouldCombatantForceCombatCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShouldCombatantLockDoorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldCombatantLockDoors_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1149,10 +1795,17 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool ShouldCombatantLockDoors()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ShouldCombatantLockDoors", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldCombatantLockDoorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ShouldCombatantLockDoors", true);
+        var parms = new ShouldCombatantLockDoors_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClearCombatBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearCombatBehaviour_Params
+    {
+        [FieldOffset(0)] public nint CombatBehaviourToClear;
     }
 
     /// <summary>
@@ -1160,34 +1813,55 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void ClearCombatBehaviour(BmSDK.BmGame.RBMBehaviour_Combat CombatBehaviourToClear)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearCombatBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CombatBehaviourToClear, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearCombatBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearCombatBehaviour", true);
+        var parms = new ClearCombatBehaviour_Params();
+        parms.CombatBehaviourToClear = CombatBehaviourToClear?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCombatBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCombatBehaviour_Params
+    {
+        [FieldOffset(0)] public nint NewCombatBehaviour;
+    }
+
     /// <summary>
     /// Function: SetCombatBehaviour
     /// </summary>
     public unsafe virtual void SetCombatBehaviour(BmSDK.BmGame.RBMBehaviour_Combat NewCombatBehaviour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetCombatBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCombatBehaviour, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCombatBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetCombatBehaviour", true);
+        var parms = new SetCombatBehaviour_Params();
+        parms.NewCombatBehaviour = NewCombatBehaviour?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindAndUseWanderPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FindAndUseWanderPoint_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FindAndUseWanderPoint
     /// </summary>
     public unsafe virtual bool FindAndUseWanderPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FindAndUseWanderPoint", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_FindAndUseWanderPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FindAndUseWanderPoint", true);
+        var parms = new FindAndUseWanderPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetNextWanderPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetNextWanderPoint_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1195,10 +1869,17 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RWanderPoint GetNextWanderPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetNextWanderPoint", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWanderPoint>(paramsPtr + 0);
+        var funcManaged = s_GetNextWanderPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetNextWanderPoint", true);
+        var parms = new GetNextWanderPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWanderPoint)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SpawnPostFleeIdleBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SpawnPostFleeIdleBehaviour_Params
+    {
+        [FieldOffset(0)] public int bInstant;
     }
 
     /// <summary>
@@ -1206,115 +1887,183 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SpawnPostFleeIdleBehaviour(bool bInstant = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnPostFleeIdleBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstant, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnPostFleeIdleBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnPostFleeIdleBehaviour", true);
+        var parms = new SpawnPostFleeIdleBehaviour_Params();
+        parms.bInstant = bInstant ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnFleeBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SpawnFleeBehaviour_Params
+    {
+        [FieldOffset(0)] public int bInstant;
+    }
+
     /// <summary>
     /// Function: SpawnFleeBehaviour
     /// </summary>
     public unsafe virtual void SpawnFleeBehaviour(bool bInstant = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnFleeBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstant, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnFleeBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnFleeBehaviour", true);
+        var parms = new SpawnFleeBehaviour_Params();
+        parms.bInstant = bInstant ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnCombatBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SpawnCombatBehaviour_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnCombatBehaviour
     /// </summary>
     public unsafe virtual void SpawnCombatBehaviour()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnCombatBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnCombatBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnCombatBehaviour", true);
+        var parms = new SpawnCombatBehaviour_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ExitCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ExitCombat_Params
+    {
+    }
+
     /// <summary>
     /// Function: ExitCombat
     /// </summary>
     public unsafe virtual void ExitCombat()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ExitCombat", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ExitCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ExitCombat", true);
+        var parms = new ExitCombat_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnterCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct EnterCombat_Params
+    {
+        [FieldOffset(0)] public int bCanReactFirst;
+        [FieldOffset(4)] public int bForceIntoCombat;
+    }
+
     /// <summary>
     /// Function: EnterCombat
     /// </summary>
     public unsafe virtual void EnterCombat(bool bCanReactFirst = default, bool bForceIntoCombat = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.EnterCombat", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanReactFirst, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceIntoCombat, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnterCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.EnterCombat", true);
+        var parms = new EnterCombat_Params();
+        parms.bCanReactFirst = bCanReactFirst ? 1 : 0;
+        parms.bForceIntoCombat = bForceIntoCombat ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnterCombatWithDefaultsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnterCombatWithDefaults_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnterCombatWithDefaults
     /// </summary>
     public unsafe virtual void EnterCombatWithDefaults()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.EnterCombatWithDefaults", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnterCombatWithDefaultsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.EnterCombatWithDefaults", true);
+        var parms = new EnterCombatWithDefaults_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DelayedEnterCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DelayedEnterCombat_Params
+    {
+        [FieldOffset(0)] public float Delay;
+    }
+
     /// <summary>
     /// Function: DelayedEnterCombat
     /// </summary>
     public unsafe virtual void DelayedEnterCombat(float Delay)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DelayedEnterCombat", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Delay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DelayedEnterCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DelayedEnterCombat", true);
+        var parms = new DelayedEnterCombat_Params();
+        parms.Delay = Delay;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayEnterCombatCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayEnterCombatCue_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayEnterCombatCue
     /// </summary>
     public unsafe virtual void PlayEnterCombatCue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayEnterCombatCue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayEnterCombatCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PlayEnterCombatCue", true);
+        var parms = new PlayEnterCombatCue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HandleNoise_Params
+    {
+        [FieldOffset(0)] public nint PlayerInstigator;
+    }
+
     /// <summary>
     /// Function: HandleNoise
     /// </summary>
     public unsafe virtual void HandleNoise(BmSDK.BmGame.RPawnPlayer PlayerInstigator)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HandleNoise", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInstigator, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HandleNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HandleNoise", true);
+        var parms = new HandleNoise_Params();
+        parms.PlayerInstigator = PlayerInstigator?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetBehaviourCustomEyeLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetBehaviourCustomEyeLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetBehaviourCustomEyeLocation
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetBehaviourCustomEyeLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetBehaviourCustomEyeLocation", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetBehaviourCustomEyeLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetBehaviourCustomEyeLocation", true);
+        var parms = new GetBehaviourCustomEyeLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_AdjustAnimatedAimDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct AdjustAnimatedAimDir_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 AnimatedDir;
+        [FieldOffset(12)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -1322,11 +2071,18 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 AdjustAnimatedAimDir(System.Numerics.Vector3 AnimatedDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AdjustAnimatedAimDir", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimatedDir, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_AdjustAnimatedAimDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AdjustAnimatedAimDir", true);
+        var parms = new AdjustAnimatedAimDir_Params();
+        parms.AnimatedDir = AnimatedDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DoPlayerLookAtFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DoPlayerLookAt_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -1334,23 +2090,39 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void DoPlayerLookAt(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DoPlayerLookAt", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoPlayerLookAtFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DoPlayerLookAt", true);
+        var parms = new DoPlayerLookAt_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanLookAtPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct CanLookAtPlayer_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanLookAtPlayer
     /// </summary>
     public unsafe virtual bool CanLookAtPlayer(BmSDK.BmGame.RPawnPlayer PlayerPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanLookAtPlayer", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanLookAtPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CanLookAtPlayer", true);
+        var parms = new CanLookAtPlayer_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateNotVisibleAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateNotVisibleAlert_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public nint A;
     }
 
     /// <summary>
@@ -1358,31 +2130,44 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void UpdateNotVisibleAlert(float DeltaTime, BmSDK.BmGame.AlertInstance A)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.UpdateNotVisibleAlert", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateNotVisibleAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.UpdateNotVisibleAlert", true);
+        var parms = new UpdateNotVisibleAlert_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.A = A?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAlertTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetAlertText_Params
+    {
+        [FieldOffset(0)] public nint Al;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAlertText
     /// </summary>
     public unsafe virtual BmSDK.FString GetAlertText(BmSDK.BmGame.AlertInstance Al)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetAlertText", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Al, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_GetAlertTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetAlertText", true);
+        var parms = new GetAlertText_Params();
+        parms.Al = Al?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetLOSTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetLOSText_Params
+    {
+        [FieldOffset(0)] public nint TestActor;
+        [FieldOffset(4)] public BmSDK.FString LOSString;
+        [FieldOffset(16)] public byte R;
+        [FieldOffset(17)] public byte G;
+        [FieldOffset(18)] public byte B;
+        [FieldOffset(20)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1390,15 +2175,21 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool GetLOSText(BmSDK.Engine.Actor TestActor, out BmSDK.FString LOSString, out byte R, out byte G, out byte B)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetLOSText", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestActor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        LOSString = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
-        R = BmSDK.Framework.MarshalUtil.ToManaged<byte>(paramsPtr + 16);
-        G = BmSDK.Framework.MarshalUtil.ToManaged<byte>(paramsPtr + 17);
-        B = BmSDK.Framework.MarshalUtil.ToManaged<byte>(paramsPtr + 18);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 20);
+        var funcManaged = s_GetLOSTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetLOSText", true);
+        var parms = new GetLOSText_Params();
+        parms.TestActor = TestActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        LOSString = parms.LOSString;
+        R = parms.R;
+        G = parms.G;
+        B = parms.B;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TriggerPawnActivatedEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerPawnActivatedEvent_Params
+    {
     }
 
     /// <summary>
@@ -1406,22 +2197,36 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void TriggerPawnActivatedEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TriggerPawnActivatedEvent", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerPawnActivatedEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TriggerPawnActivatedEvent", true);
+        var parms = new TriggerPawnActivatedEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerPawnEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TriggerPawnEvent_Params
+    {
+        [FieldOffset(0)] public nint EventClass;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TriggerPawnEvent
     /// </summary>
     public unsafe virtual bool TriggerPawnEvent(BmSDK.Class EventClass)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TriggerPawnEvent", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventClass, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TriggerPawnEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TriggerPawnEvent", true);
+        var parms = new TriggerPawnEvent_Params();
+        parms.EventClass = EventClass?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OutputBehaviourStackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OutputBehaviourStack_Params
+    {
     }
 
     /// <summary>
@@ -1429,47 +2234,79 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void OutputBehaviourStack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.OutputBehaviourStack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OutputBehaviourStackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.OutputBehaviourStack", true);
+        var parms = new OutputBehaviourStack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ExitConditionActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ExitConditionActivated_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ExitConditionString;
+    }
+
     /// <summary>
     /// Function: ExitConditionActivated
     /// </summary>
     public unsafe virtual void ExitConditionActivated(BmSDK.FString ExitConditionString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ExitConditionActivated", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExitConditionString, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ExitConditionActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ExitConditionActivated", true);
+        var parms = new ExitConditionActivated_Params();
+        parms.ExitConditionString = ExitConditionString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddToBehaviourHistoryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AddToBehaviourHistory_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString BehaviourInfoString;
+    }
+
     /// <summary>
     /// Function: AddToBehaviourHistory
     /// </summary>
     public unsafe virtual void AddToBehaviourHistory(BmSDK.FString BehaviourInfoString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddToBehaviourHistory", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehaviourInfoString, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddToBehaviourHistoryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddToBehaviourHistory", true);
+        var parms = new AddToBehaviourHistory_Params();
+        parms.BehaviourInfoString = BehaviourInfoString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetBehaviourOfClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetBehaviourOfClass_Params
+    {
+        [FieldOffset(0)] public nint TestClass;
+        [FieldOffset(4)] public int bExact;
+        [FieldOffset(8)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetBehaviourOfClass
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMBehaviour GetBehaviourOfClass(BmSDK.Class TestClass, bool bExact = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetBehaviourOfClass", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bExact, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMBehaviour>(paramsPtr + 8);
+        var funcManaged = s_GetBehaviourOfClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetBehaviourOfClass", true);
+        var parms = new GetBehaviourOfClass_Params();
+        parms.TestClass = TestClass?.Ptr ?? 0;
+        parms.bExact = bExact ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMBehaviour)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_HasBehaviourOfClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HasBehaviourOfClass_Params
+    {
+        [FieldOffset(0)] public nint TestClass;
+        [FieldOffset(4)] public int bExact;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1477,12 +2314,19 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool HasBehaviourOfClass(BmSDK.Class TestClass, bool bExact = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HasBehaviourOfClass", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bExact, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_HasBehaviourOfClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HasBehaviourOfClass", true);
+        var parms = new HasBehaviourOfClass_Params();
+        parms.TestClass = TestClass?.Ptr ?? 0;
+        parms.bExact = bExact ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RemoveBehaviourFromListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveBehaviourFromList_Params
+    {
+        [FieldOffset(0)] public nint BehaviourToRemove;
     }
 
     /// <summary>
@@ -1490,22 +2334,35 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void RemoveBehaviourFromList(BmSDK.BmGame.RBMBehaviour BehaviourToRemove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RemoveBehaviourFromList", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehaviourToRemove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveBehaviourFromListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RemoveBehaviourFromList", true);
+        var parms = new RemoveBehaviourFromList_Params();
+        parms.BehaviourToRemove = BehaviourToRemove?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetLastBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetLastBehaviour_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetLastBehaviour
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMBehaviour GetLastBehaviour()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetLastBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMBehaviour>(paramsPtr + 0);
+        var funcManaged = s_GetLastBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetLastBehaviour", true);
+        var parms = new GetLastBehaviour_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMBehaviour)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_TryClearSpecialMovesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TryClearSpecialMoves_Params
+    {
     }
 
     /// <summary>
@@ -1513,112 +2370,168 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void TryClearSpecialMoves()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TryClearSpecialMoves", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TryClearSpecialMovesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TryClearSpecialMoves", true);
+        var parms = new TryClearSpecialMoves_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearSpawnedBehavioursFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ClearSpawnedBehaviours_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearSpawnedBehaviours
     /// </summary>
     public unsafe virtual void ClearSpawnedBehaviours()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearSpawnedBehaviours", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearSpawnedBehavioursFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearSpawnedBehaviours", true);
+        var parms = new ClearSpawnedBehaviours_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearBehavioursOfClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ClearBehavioursOfClass_Params
+    {
+        [FieldOffset(0)] public nint TestClass;
+        [FieldOffset(4)] public int bExact;
+    }
+
     /// <summary>
     /// Function: ClearBehavioursOfClass
     /// </summary>
     public unsafe virtual void ClearBehavioursOfClass(BmSDK.Class TestClass, bool bExact = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearBehavioursOfClass", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bExact, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearBehavioursOfClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearBehavioursOfClass", true);
+        var parms = new ClearBehavioursOfClass_Params();
+        parms.TestClass = TestClass?.Ptr ?? 0;
+        parms.bExact = bExact ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearInterruptBehavioursFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ClearInterruptBehaviours_Params
+    {
+        [FieldOffset(0)] public int bCallEndInterrupt;
+    }
+
     /// <summary>
     /// Function: ClearInterruptBehaviours
     /// </summary>
     public unsafe virtual void ClearInterruptBehaviours(bool bCallEndInterrupt = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearInterruptBehaviours", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCallEndInterrupt, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearInterruptBehavioursFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearInterruptBehaviours", true);
+        var parms = new ClearInterruptBehaviours_Params();
+        parms.bCallEndInterrupt = bCallEndInterrupt ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearNonInterruptBehavioursFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ClearNonInterruptBehaviours_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearNonInterruptBehaviours
     /// </summary>
     public unsafe virtual void ClearNonInterruptBehaviours()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearNonInterruptBehaviours", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearNonInterruptBehavioursFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearNonInterruptBehaviours", true);
+        var parms = new ClearNonInterruptBehaviours_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearBehaviourListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearBehaviourList_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearBehaviourList
     /// </summary>
     public unsafe virtual void ClearBehaviourList()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearBehaviourList", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClearBehaviourListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ClearBehaviourList", true);
+        var parms = new ClearBehaviourList_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveExitConditionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveExitCondition_Params
+    {
+        [FieldOffset(0)] public nint ToRemove;
+    }
+
     /// <summary>
     /// Function: RemoveExitCondition
     /// </summary>
     public unsafe virtual void RemoveExitCondition(BmSDK.BmGame.RBMExitCondition ToRemove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RemoveExitCondition", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ToRemove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveExitConditionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RemoveExitCondition", true);
+        var parms = new RemoveExitCondition_Params();
+        parms.ToRemove = ToRemove?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddExitConditionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddExitCondition_Params
+    {
+        [FieldOffset(0)] public nint NewExitCondition;
+    }
+
     /// <summary>
     /// Function: AddExitCondition
     /// </summary>
     public unsafe virtual void AddExitCondition(BmSDK.BmGame.RBMExitCondition NewExitCondition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddExitCondition", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewExitCondition, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddExitConditionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.AddExitCondition", true);
+        var parms = new AddExitCondition_Params();
+        parms.NewExitCondition = NewExitCondition?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SpawnBehaviour_Params
+    {
+        [FieldOffset(0)] public nint BehaviourClass;
+        [FieldOffset(4)] public nint ParentBehaviour;
+        [FieldOffset(8)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: SpawnBehaviour
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMBehaviour SpawnBehaviour(BmSDK.Class BehaviourClass, BmSDK.BmGame.RBMBehaviour ParentBehaviour = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnBehaviour", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehaviourClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ParentBehaviour, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMBehaviour>(paramsPtr + 8);
+        var funcManaged = s_SpawnBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SpawnBehaviour", true);
+        var parms = new SpawnBehaviour_Params();
+        parms.BehaviourClass = BehaviourClass?.Ptr ?? 0;
+        parms.ParentBehaviour = ParentBehaviour?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMBehaviour)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ActivateSpawnedBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ActivateSpawnedBehaviour_Params
+    {
+        [FieldOffset(0)] public nint SpawnedBehaviour;
     }
 
     /// <summary>
@@ -1626,23 +2539,38 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void ActivateSpawnedBehaviour(BmSDK.BmGame.RBMBehaviour SpawnedBehaviour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ActivateSpawnedBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnedBehaviour, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateSpawnedBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ActivateSpawnedBehaviour", true);
+        var parms = new ActivateSpawnedBehaviour_Params();
+        parms.SpawnedBehaviour = SpawnedBehaviour?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateSpawnedBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CreateSpawnedBehaviour_Params
+    {
+        [FieldOffset(0)] public nint BehaviourClass;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateSpawnedBehaviour
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMBehaviour CreateSpawnedBehaviour(BmSDK.Class BehaviourClass)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CreateSpawnedBehaviour", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehaviourClass, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMBehaviour>(paramsPtr + 4);
+        var funcManaged = s_CreateSpawnedBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CreateSpawnedBehaviour", true);
+        var parms = new CreateSpawnedBehaviour_Params();
+        parms.BehaviourClass = BehaviourClass?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMBehaviour)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_RegisterSpawnedBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RegisterSpawnedBehaviour_Params
+    {
+        [FieldOffset(0)] public nint NewBehaviour;
     }
 
     /// <summary>
@@ -1650,24 +2578,41 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void RegisterSpawnedBehaviour(BmSDK.BmGame.RBMBehaviour NewBehaviour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RegisterSpawnedBehaviour", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewBehaviour, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterSpawnedBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RegisterSpawnedBehaviour", true);
+        var parms = new RegisterSpawnedBehaviour_Params();
+        parms.NewBehaviour = NewBehaviour?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PriorityIsGreaterThanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PriorityIsGreaterThan_Params
+    {
+        [FieldOffset(0)] public nint BehA;
+        [FieldOffset(4)] public nint BehB;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PriorityIsGreaterThan
     /// </summary>
     public unsafe virtual bool PriorityIsGreaterThan(BmSDK.BmGame.RBMBehaviour BehA, BmSDK.BmGame.RBMBehaviour BehB)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PriorityIsGreaterThan", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehA, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehB, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_PriorityIsGreaterThanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PriorityIsGreaterThan", true);
+        var parms = new PriorityIsGreaterThan_Params();
+        parms.BehA = BehA?.Ptr ?? 0;
+        parms.BehB = BehB?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RegisterNewBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RegisterNewBehaviour_Params
+    {
+        [FieldOffset(0)] public nint NewBehaviour;
+        [FieldOffset(4)] public int bInsertAtEnd;
     }
 
     /// <summary>
@@ -1675,126 +2620,198 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void RegisterNewBehaviour(BmSDK.BmGame.RBMBehaviour NewBehaviour, bool bInsertAtEnd = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RegisterNewBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewBehaviour, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInsertAtEnd, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterNewBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.RegisterNewBehaviour", true);
+        var parms = new RegisterNewBehaviour_Params();
+        parms.NewBehaviour = NewBehaviour?.Ptr ?? 0;
+        parms.bInsertAtEnd = bInsertAtEnd ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleNewBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HandleNewBehaviour_Params
+    {
+        [FieldOffset(0)] public nint NewBehaviour;
+    }
+
     /// <summary>
     /// Function: HandleNewBehaviour
     /// </summary>
     public unsafe virtual void HandleNewBehaviour(BmSDK.BmGame.RBMBehaviour NewBehaviour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HandleNewBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewBehaviour, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HandleNewBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.HandleNewBehaviour", true);
+        var parms = new HandleNewBehaviour_Params();
+        parms.NewBehaviour = NewBehaviour?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CleanUpBeforeRemoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CleanUpBeforeRemove_Params
+    {
+    }
+
     /// <summary>
     /// Function: CleanUpBeforeRemove
     /// </summary>
     public unsafe virtual void CleanUpBeforeRemove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CleanUpBeforeRemove", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CleanUpBeforeRemoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CleanUpBeforeRemove", true);
+        var parms = new CleanUpBeforeRemove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PawnDiedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PawnDied_Params
+    {
+        [FieldOffset(0)] public nint inPawn;
+    }
+
     /// <summary>
     /// Function: PawnDied
     /// </summary>
     public unsafe override void PawnDied(BmSDK.Engine.Pawn inPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PawnDied", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PawnDiedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PawnDied", true);
+        var parms = new PawnDied_Params();
+        parms.inPawn = inPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnPossessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnPossess_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnPossess
     /// </summary>
     public unsafe override void UnPossess()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.UnPossess", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnPossessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.UnPossess", true);
+        var parms = new UnPossess_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostInitCharacterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostInitCharacter_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostInitCharacter
     /// </summary>
     public unsafe virtual void PostInitCharacter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PostInitCharacter", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostInitCharacterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PostInitCharacter", true);
+        var parms = new PostInitCharacter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReRegisterControllerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReRegisterController_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReRegisterController
     /// </summary>
     public unsafe virtual void ReRegisterController()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ReRegisterController", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReRegisterControllerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ReRegisterController", true);
+        var parms = new ReRegisterController_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PossessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Possess_Params
+    {
+        [FieldOffset(0)] public nint inPawn;
+        [FieldOffset(4)] public int bVehicleTransition;
+    }
+
     /// <summary>
     /// Function: Possess
     /// </summary>
     public unsafe override void Possess(BmSDK.Engine.Pawn inPawn, bool bVehicleTransition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.Possess", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVehicleTransition, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PossessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.Possess", true);
+        var parms = new Possess_Params();
+        parms.inPawn = inPawn?.Ptr ?? 0;
+        parms.bVehicleTransition = bVehicleTransition ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickMeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TickMe_Params
+    {
+    }
+
     /// <summary>
     /// Function: TickMe
     /// </summary>
     public unsafe virtual void TickMe()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TickMe", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickMeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TickMe", true);
+        var parms = new TickMe_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsBatarangableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsBatarangable_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsBatarangable
     /// </summary>
     public unsafe virtual bool IsBatarangable()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsBatarangable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsBatarangableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsBatarangable", true);
+        var parms = new IsBatarangable_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetTickIsDisabledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetTickIsDisabled_Params
+    {
+        [FieldOffset(0)] public int bInDisabled;
     }
 
     /// <summary>
@@ -1802,38 +2819,44 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe override void SetTickIsDisabled(bool bInDisabled)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetTickIsDisabled", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInDisabled, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetTickIsDisabledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.SetTickIsDisabled", true);
+        var parms = new SetTickIsDisabled_Params();
+        parms.bInDisabled = bInDisabled ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindRailingForPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct FindRailingForPoint_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 LockPoint;
+        [FieldOffset(12)] public System.Numerics.Vector3 LockPosition;
+        [FieldOffset(24)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: FindRailingForPoint
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMPathNode_FenceJump FindRailingForPoint(System.Numerics.Vector3 LockPoint, out System.Numerics.Vector3 LockPosition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FindRailingForPoint", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LockPoint, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        LockPosition = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMPathNode_FenceJump>(paramsPtr + 24);
+        var funcManaged = s_FindRailingForPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FindRailingForPoint", true);
+        var parms = new FindRailingForPoint_Params();
+        parms.LockPoint = LockPoint;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        LockPosition = parms.LockPosition;
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMPathNode_FenceJump)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_CalcVisibilityForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 33)]
+    private struct CalcVisibilityFor_Params
+    {
+        [FieldOffset(0)] public nint A;
+        [FieldOffset(4)] public System.Numerics.Vector3 Checkpoint;
+        [FieldOffset(16)] public float CanSeePercent;
+        [FieldOffset(20)] public System.Numerics.Vector3 LookDir;
+        [FieldOffset(32)] public BmSDK.BmGame.AlertInstance.VisibilityCategory ReturnValue;
     }
 
     /// <summary>
@@ -1841,21 +2864,22 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.AlertInstance.VisibilityCategory CalcVisibilityFor(BmSDK.Engine.Actor A, System.Numerics.Vector3 Checkpoint = default, float CanSeePercent = default, System.Numerics.Vector3 LookDir = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CalcVisibilityFor", true);
-        byte* paramsPtr = stackalloc byte[33];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Checkpoint, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CanSeePercent, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LookDir, paramsPtr + 20);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.AlertInstance.VisibilityCategory>(paramsPtr + 32);
+        var funcManaged = s_CalcVisibilityForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.CalcVisibilityFor", true);
+        var parms = new CalcVisibilityFor_Params();
+        parms.A = A?.Ptr ?? 0;
+        parms.Checkpoint = Checkpoint;
+        parms.CanSeePercent = CanSeePercent;
+        parms.LookDir = LookDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_FindAlertForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FindAlertFor_Params
+    {
+        [FieldOffset(0)] public nint A;
+        [FieldOffset(4)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1863,18 +2887,18 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.AlertInstance FindAlertFor(BmSDK.Engine.Actor A)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FindAlertFor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.AlertInstance>(paramsPtr + 4);
+        var funcManaged = s_FindAlertForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FindAlertFor", true);
+        var parms = new FindAlertFor_Params();
+        parms.A = A?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.AlertInstance)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_FindAlertForPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FindAlertForPlayer_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1882,17 +2906,17 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.AlertInstance FindAlertForPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FindAlertForPlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.AlertInstance>(paramsPtr + 0);
+        var funcManaged = s_FindAlertForPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.FindAlertForPlayer", true);
+        var parms = new FindAlertForPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.AlertInstance)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_PawnInStasisFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PawnInStasis_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1900,17 +2924,18 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool PawnInStasis()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PawnInStasis", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_PawnInStasisFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.PawnInStasis", true);
+        var parms = new PawnInStasis_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShutDownBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShutDownBehaviour_Params
+    {
+        [FieldOffset(0)] public nint BehaviourToExit;
+        [FieldOffset(4)] public int bCallEndInterrupt;
     }
 
     /// <summary>
@@ -1918,56 +2943,55 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void ShutDownBehaviour(BmSDK.BmGame.RBMBehaviour BehaviourToExit, bool bCallEndInterrupt = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ShutDownBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BehaviourToExit, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCallEndInterrupt, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ShutDownBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ShutDownBehaviour", true);
+        var parms = new ShutDownBehaviour_Params();
+        parms.BehaviourToExit = BehaviourToExit?.Ptr ?? 0;
+        parms.bCallEndInterrupt = bCallEndInterrupt ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickBehaviourStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TickBehaviourState_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: TickBehaviourState
     /// </summary>
     public unsafe virtual void TickBehaviourState(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TickBehaviourState", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_TickBehaviourStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.TickBehaviourState", true);
+        var parms = new TickBehaviourState_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAIManagerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetAIManager_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAIManager
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMAIManager GetAIManager()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetAIManager", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIManager>(paramsPtr + 0);
+        var funcManaged = s_GetAIManagerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetAIManager", true);
+        var parms = new GetAIManager_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMAIManager)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_DoFaceFXForFearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoFaceFXForFear_Params
+    {
     }
 
     /// <summary>
@@ -1975,35 +2999,35 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void DoFaceFXForFear()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DoFaceFXForFear", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DoFaceFXForFearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.DoFaceFXForFear", true);
+        var parms = new DoFaceFXForFear_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSilentPredatorGlanceStanceNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetSilentPredatorGlanceStanceName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSilentPredatorGlanceStanceName
     /// </summary>
     public unsafe virtual BmSDK.FName GetSilentPredatorGlanceStanceName()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetSilentPredatorGlanceStanceName", true);
-        byte* paramsPtr = stackalloc byte[8];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
+        var funcManaged = s_GetSilentPredatorGlanceStanceNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetSilentPredatorGlanceStanceName", true);
+        var parms = new GetSilentPredatorGlanceStanceName_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetSilentPredatorStanceNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetSilentPredatorStanceName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ReturnValue;
     }
 
     /// <summary>
@@ -2011,17 +3035,17 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.FName GetSilentPredatorStanceName()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetSilentPredatorStanceName", true);
-        byte* paramsPtr = stackalloc byte[8];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
+        var funcManaged = s_GetSilentPredatorStanceNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetSilentPredatorStanceName", true);
+        var parms = new GetSilentPredatorStanceName_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ProcessSpottableAlertsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ProcessSpottableAlerts_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -2029,36 +3053,37 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void ProcessSpottableAlerts(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ProcessSpottableAlerts", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ProcessSpottableAlertsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.ProcessSpottableAlerts", true);
+        var parms = new ProcessSpottableAlerts_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetVisionCheckEyeLocFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetVisionCheckEyeLoc_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetVisionCheckEyeLoc
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetVisionCheckEyeLoc()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetVisionCheckEyeLoc", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetVisionCheckEyeLocFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetVisionCheckEyeLoc", true);
+        var parms = new GetVisionCheckEyeLoc_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetViewDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetViewDir_Params
+    {
+        [FieldOffset(0)] public int bFixUpAnimAimDir;
+        [FieldOffset(4)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -2066,18 +3091,21 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetViewDir(bool bFixUpAnimAimDir = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetViewDir", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFixUpAnimAimDir, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_GetViewDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetViewDir", true);
+        var parms = new GetViewDir_Params();
+        parms.bFixUpAnimAimDir = bFixUpAnimAimDir ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsPointInFOVWithLookDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 29)]
+    private struct IsPointInFOVWithLookDir_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TestPos;
+        [FieldOffset(12)] public System.Numerics.Vector3 LookDir;
+        [FieldOffset(24)] public int bUseActualAimDirForCloseCheck;
+        [FieldOffset(28)] public BmSDK.BmGame.RBMAIController.FOVcategory ReturnValue;
     }
 
     /// <summary>
@@ -2085,20 +3113,23 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMAIController.FOVcategory IsPointInFOVWithLookDir(System.Numerics.Vector3 TestPos, System.Numerics.Vector3 LookDir, bool bUseActualAimDirForCloseCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsPointInFOVWithLookDir", true);
-        byte* paramsPtr = stackalloc byte[29];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPos, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LookDir, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseActualAimDirForCloseCheck, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIController.FOVcategory>(paramsPtr + 28);
+        var funcManaged = s_IsPointInFOVWithLookDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsPointInFOVWithLookDir", true);
+        var parms = new IsPointInFOVWithLookDir_Params();
+        parms.TestPos = TestPos;
+        parms.LookDir = LookDir;
+        parms.bUseActualAimDirForCloseCheck = bUseActualAimDirForCloseCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsPointInFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 21)]
+    private struct IsPointInFOV_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TestPos;
+        [FieldOffset(12)] public int bFixUpAnimAimDir;
+        [FieldOffset(16)] public int bUseActualAimDirForCloseCheck;
+        [FieldOffset(20)] public BmSDK.BmGame.RBMAIController.FOVcategory ReturnValue;
     }
 
     /// <summary>
@@ -2106,20 +3137,23 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMAIController.FOVcategory IsPointInFOV(System.Numerics.Vector3 TestPos, bool bFixUpAnimAimDir = default, bool bUseActualAimDirForCloseCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsPointInFOV", true);
-        byte* paramsPtr = stackalloc byte[21];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPos, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFixUpAnimAimDir, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseActualAimDirForCloseCheck, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIController.FOVcategory>(paramsPtr + 20);
+        var funcManaged = s_IsPointInFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsPointInFOV", true);
+        var parms = new IsPointInFOV_Params();
+        parms.TestPos = TestPos;
+        parms.bFixUpAnimAimDir = bFixUpAnimAimDir ? 1 : 0;
+        parms.bUseActualAimDirForCloseCheck = bUseActualAimDirForCloseCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsInFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 13)]
+    private struct IsInFOV_Params
+    {
+        [FieldOffset(0)] public nint TestActor;
+        [FieldOffset(4)] public int bFixUpAnimAimDir;
+        [FieldOffset(8)] public int bUseActualAimDirForCloseCheck;
+        [FieldOffset(12)] public BmSDK.BmGame.RBMAIController.FOVcategory ReturnValue;
     }
 
     /// <summary>
@@ -2127,20 +3161,21 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMAIController.FOVcategory IsInFOV(BmSDK.Engine.Actor TestActor, bool bFixUpAnimAimDir = default, bool bUseActualAimDirForCloseCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsInFOV", true);
-        byte* paramsPtr = stackalloc byte[13];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFixUpAnimAimDir, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseActualAimDirForCloseCheck, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIController.FOVcategory>(paramsPtr + 12);
+        var funcManaged = s_IsInFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsInFOV", true);
+        var parms = new IsInFOV_Params();
+        parms.TestActor = TestActor?.Ptr ?? 0;
+        parms.bFixUpAnimAimDir = bFixUpAnimAimDir ? 1 : 0;
+        parms.bUseActualAimDirForCloseCheck = bUseActualAimDirForCloseCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsRunningBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsRunningBehaviour_Params
+    {
+        [FieldOffset(0)] public nint TestBehaviour;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2148,18 +3183,19 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool IsRunningBehaviour(BmSDK.BmGame.RBMBehaviour TestBehaviour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsRunningBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestBehaviour, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsRunningBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.IsRunningBehaviour", true);
+        var parms = new IsRunningBehaviour_Params();
+        parms.TestBehaviour = TestBehaviour?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetBehaviour_Params
+    {
+        [FieldOffset(0)] public int Index;
+        [FieldOffset(4)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -2167,18 +3203,11 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMBehaviour GetBehaviour(int Index = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMBehaviour>(paramsPtr + 4);
+        var funcManaged = s_GetBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController.GetBehaviour", true);
+        var parms = new GetBehaviour_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMBehaviour)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -2393,8 +3422,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bDeactivatingBehaviour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 1; else *(int*)(Ptr + 892) &= ~1; }
     }
 
     /// <summary>
@@ -2402,8 +3431,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bRegistered
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 2; else *(int*)(Ptr + 892) &= ~2; }
     }
 
     /// <summary>
@@ -2411,8 +3440,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bHasHadBehaviour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 4; else *(int*)(Ptr + 892) &= ~4; }
     }
 
     /// <summary>
@@ -2420,8 +3449,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bInCombat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 8; else *(int*)(Ptr + 892) &= ~8; }
     }
 
     /// <summary>
@@ -2429,8 +3458,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bWeaponChanged
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 16; else *(int*)(Ptr + 892) &= ~16; }
     }
 
     /// <summary>
@@ -2438,8 +3467,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bHadCombatBehaviour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 32; else *(int*)(Ptr + 892) &= ~32; }
     }
 
     /// <summary>
@@ -2447,8 +3476,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bUseCombatAreas
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 64; else *(int*)(Ptr + 892) &= ~64; }
     }
 
     /// <summary>
@@ -2456,8 +3485,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bStoreIdleConfig
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 128; else *(int*)(Ptr + 892) &= ~128; }
     }
 
     /// <summary>
@@ -2465,8 +3494,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bFinalBlowFaceFX
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 256; else *(int*)(Ptr + 892) &= ~256; }
     }
 
     /// <summary>
@@ -2474,8 +3503,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bCachedSeenSeqEvents
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 512; else *(int*)(Ptr + 892) &= ~512; }
     }
 
     /// <summary>
@@ -2483,8 +3512,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bPlayedEnterCombatSound
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 1024; else *(int*)(Ptr + 892) &= ~1024; }
     }
 
     /// <summary>
@@ -2492,8 +3521,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bBehaviourControlledTick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 2048; else *(int*)(Ptr + 892) &= ~2048; }
     }
 
     /// <summary>
@@ -2501,8 +3530,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bCachedIsStunned
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 4096; else *(int*)(Ptr + 892) &= ~4096; }
     }
 
     /// <summary>
@@ -2510,8 +3539,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bVisionIsBlocked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 8192; else *(int*)(Ptr + 892) &= ~8192; }
     }
 
     /// <summary>
@@ -2519,8 +3548,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bDeliberateLookAway
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 16384; else *(int*)(Ptr + 892) &= ~16384; }
     }
 
     /// <summary>
@@ -2528,8 +3557,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bStunnedRagdoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 32768; else *(int*)(Ptr + 892) &= ~32768; }
     }
 
     /// <summary>
@@ -2537,8 +3566,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bLookedAtPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 65536; else *(int*)(Ptr + 892) &= ~65536; }
     }
 
     /// <summary>
@@ -2546,8 +3575,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bUseHeadBoneAsViewDir
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 131072; else *(int*)(Ptr + 892) &= ~131072; }
     }
 
     /// <summary>
@@ -2555,8 +3584,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bForceShortenPathCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 262144; else *(int*)(Ptr + 892) &= ~262144; }
     }
 
     /// <summary>
@@ -2564,8 +3593,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bHasSeenBMDuringAlert
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 524288; else *(int*)(Ptr + 892) &= ~524288; }
     }
 
     /// <summary>
@@ -2573,8 +3602,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bBehaviourCustomEyeLocation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 1048576; else *(int*)(Ptr + 892) &= ~1048576; }
     }
 
     /// <summary>
@@ -2582,8 +3611,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bBumpedLastPawnMoveTick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 2097152; else *(int*)(Ptr + 892) &= ~2097152; }
     }
 
     /// <summary>
@@ -2591,8 +3620,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bHaveCachedAnimatedAimDir
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 4194304; else *(int*)(Ptr + 892) &= ~4194304; }
     }
 
     /// <summary>
@@ -2600,8 +3629,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bBehaviourIsRunningAEC
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 892); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 892); }
+        get { return (*(int*)(Ptr + 892) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 892) |= 8388608; else *(int*)(Ptr + 892) &= ~8388608; }
     }
 
     /// <summary>
@@ -2609,8 +3638,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe int TriggerActivationEventFrames
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 896); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 896); }
+        get { return *(int*)(Ptr + 896); }
+        set { *(int*)(Ptr + 896) = value; }
     }
 
     /// <summary>
@@ -2654,8 +3683,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float TimeSinceActivatedSeenEvents
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 924); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 924); }
+        get { return *(float*)(Ptr + 924); }
+        set { *(float*)(Ptr + 924) = value; }
     }
 
     /// <summary>
@@ -2681,8 +3710,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float SuspectLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 936); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 936); }
+        get { return *(float*)(Ptr + 936); }
+        set { *(float*)(Ptr + 936) = value; }
     }
 
     /// <summary>
@@ -2690,8 +3719,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float SpottedLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 940); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 940); }
+        get { return *(float*)(Ptr + 940); }
+        set { *(float*)(Ptr + 940) = value; }
     }
 
     /// <summary>
@@ -2699,8 +3728,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float MinCanSeePercent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 944); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 944); }
+        get { return *(float*)(Ptr + 944); }
+        set { *(float*)(Ptr + 944) = value; }
     }
 
     /// <summary>
@@ -2708,8 +3737,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float SimpleFOVCheckRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 948); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 948); }
+        get { return *(float*)(Ptr + 948); }
+        set { *(float*)(Ptr + 948) = value; }
     }
 
     /// <summary>
@@ -2717,8 +3746,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float Attack360AwarenessRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 952); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 952); }
+        get { return *(float*)(Ptr + 952); }
+        set { *(float*)(Ptr + 952) = value; }
     }
 
     /// <summary>
@@ -2735,8 +3764,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float AlertPriorityTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 968); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 968); }
+        get { return *(float*)(Ptr + 968); }
+        set { *(float*)(Ptr + 968) = value; }
     }
 
     /// <summary>
@@ -2744,8 +3773,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float LastBarkTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 972); }
+        get { return *(float*)(Ptr + 972); }
+        set { *(float*)(Ptr + 972) = value; }
     }
 
     /// <summary>
@@ -2753,8 +3782,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe int LastBarkPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 976); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 976); }
+        get { return *(int*)(Ptr + 976); }
+        set { *(int*)(Ptr + 976) = value; }
     }
 
     /// <summary>
@@ -2771,8 +3800,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float LookAtPlayerTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 992); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 992); }
+        get { return *(float*)(Ptr + 992); }
+        set { *(float*)(Ptr + 992) = value; }
     }
 
     /// <summary>
@@ -2780,8 +3809,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float LookAtPlayerDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 996); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 996); }
+        get { return *(float*)(Ptr + 996); }
+        set { *(float*)(Ptr + 996) = value; }
     }
 
     /// <summary>
@@ -2789,8 +3818,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float LastSearchInvestigateMoveTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1000); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1000); }
+        get { return *(float*)(Ptr + 1000); }
+        set { *(float*)(Ptr + 1000) = value; }
     }
 
     /// <summary>
@@ -2798,8 +3827,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.FName HeadBone
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 1004); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1004); }
+        get { return *(BmSDK.FName*)(Ptr + 1004); }
+        set { *(BmSDK.FName*)(Ptr + 1004) = value; }
     }
 
     /// <summary>
@@ -2807,8 +3836,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.FName NervousIdleVariantName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 1012); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1012); }
+        get { return *(BmSDK.FName*)(Ptr + 1012); }
+        set { *(BmSDK.FName*)(Ptr + 1012) = value; }
     }
 
     /// <summary>
@@ -2825,8 +3854,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.FName NoStateName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 1024); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1024); }
+        get { return *(BmSDK.FName*)(Ptr + 1024); }
+        set { *(BmSDK.FName*)(Ptr + 1024) = value; }
     }
 
     /// <summary>
@@ -2834,8 +3863,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float BumpedTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1032); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1032); }
+        get { return *(float*)(Ptr + 1032); }
+        set { *(float*)(Ptr + 1032) = value; }
     }
 
     /// <summary>
@@ -2849,8 +3878,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe float LastCheckUnconsciousThugTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1048); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1048); }
+        get { return *(float*)(Ptr + 1048); }
+        set { *(float*)(Ptr + 1048) = value; }
     }
 
     /// <summary>
@@ -2876,8 +3905,8 @@ public partial class RBMAIController : BmSDK.Engine.AIController, BmSDK.IGameObj
     /// </summary>
     public unsafe int CurrentPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1060); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1060); }
+        get { return *(int*)(Ptr + 1060); }
+        set { *(int*)(Ptr + 1060) = value; }
     }
 
     /// <summary>
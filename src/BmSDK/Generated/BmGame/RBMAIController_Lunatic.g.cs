@@ -78,18 +78,29 @@ public partial class RBMAIController_Lunatic : BmSDK.BmGame.RBMAIController, BmS
         where TComponent : class, Framework.IScriptComponent<RBMAIController_Lunatic>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CalcVisibilityForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct CalcVisibilityFor_Params
+    {
+        [FieldOffset(0)] public nint A;
+        [FieldOffset(4)] public System.Numerics.Vector3 CheckLocation;
+        [FieldOffset(16)] public float CanSeePercent;
+        [FieldOffset(20)] public System.Numerics.Vector3 LookDir;
+        [FieldOffset(32)] public BmSDK.BmGame.AlertInstance.VisibilityCategory ReturnValue;
+    }
+
     /// <summary>
     /// Function: CalcVisibilityFor
     /// </summary>
     public unsafe override BmSDK.BmGame.AlertInstance.VisibilityCategory CalcVisibilityFor(BmSDK.Engine.Actor A, System.Numerics.Vector3 CheckLocation = default, float CanSeePercent = default, System.Numerics.Vector3 LookDir = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController_Lunatic.CalcVisibilityFor", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CanSeePercent, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LookDir, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.AlertInstance.VisibilityCategory>(paramsPtr + 32);
+        var funcManaged = s_CalcVisibilityForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController_Lunatic.CalcVisibilityFor", true);
+        var parms = new CalcVisibilityFor_Params();
+        parms.A = A?.Ptr ?? 0;
+        parms.CheckLocation = CheckLocation;
+        parms.CanSeePercent = CanSeePercent;
+        parms.LookDir = LookDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 }
@@ -78,14 +78,21 @@ public partial class RBMAIController_Venom : BmSDK.BmGame.RBMAIController, BmSDK
         where TComponent : class, Framework.IScriptComponent<RBMAIController_Venom>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CanBatmanGrabFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanBatmanGrab_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.BatmanGrabType ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanBatmanGrab
     /// </summary>
     public unsafe override BmSDK.BmGame.RBMAIController.BatmanGrabType CanBatmanGrab()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController_Venom.CanBatmanGrab", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIController.BatmanGrabType>(paramsPtr + 0);
+        var funcManaged = s_CanBatmanGrabFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMAIController_Venom.CanBatmanGrab", true);
+        var parms = new CanBatmanGrab_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 }
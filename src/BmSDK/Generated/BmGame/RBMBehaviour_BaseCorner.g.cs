@@ -73,14 +73,20 @@ public partial class RBMBehaviour_BaseCorner : BmSDK.BmGame.RBMBehaviour, BmSDK.
         where TComponent : class, Framework.IScriptComponent<RBMBehaviour_BaseCorner>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_Abort_SpottedFriendlyAheadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Abort_SpottedFriendlyAhead_Params
+    {
+    }
+
     /// <summary>
     /// Function: Abort_SpottedFriendlyAhead
     /// </summary>
     public unsafe virtual void Abort_SpottedFriendlyAhead()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_BaseCorner.Abort_SpottedFriendlyAhead", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Abort_SpottedFriendlyAheadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_BaseCorner.Abort_SpottedFriendlyAhead", true);
+        var parms = new Abort_SpottedFriendlyAhead_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -104,8 +110,8 @@ public partial class RBMBehaviour_BaseCorner : BmSDK.BmGame.RBMBehaviour, BmSDK.
     /// </summary>
     public unsafe float PauseTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(float*)(Ptr + 412); }
+        set { *(float*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -113,8 +119,8 @@ public partial class RBMBehaviour_BaseCorner : BmSDK.BmGame.RBMBehaviour, BmSDK.
     /// </summary>
     public unsafe BmSDK.FName StanceName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -122,8 +128,8 @@ public partial class RBMBehaviour_BaseCorner : BmSDK.BmGame.RBMBehaviour, BmSDK.
     /// </summary>
     public unsafe BmSDK.FName InTransition
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -131,8 +137,8 @@ public partial class RBMBehaviour_BaseCorner : BmSDK.BmGame.RBMBehaviour, BmSDK.
     /// </summary>
     public unsafe BmSDK.FName OutTransition
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.FName*)(Ptr + 432); }
+        set { *(BmSDK.FName*)(Ptr + 432) = value; }
     }
 
     /// <summary>
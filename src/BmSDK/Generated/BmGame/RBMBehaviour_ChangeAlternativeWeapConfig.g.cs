@@ -78,15 +78,28 @@ public partial class RBMBehaviour_ChangeAlternativeWeapConfig : BmSDK.Engine.Seq
         where TComponent : class, Framework.IScriptComponent<RBMBehaviour_ChangeAlternativeWeapConfig>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_ChangeAlternativeWeapConfig.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_ChangeAlternativeWeapConfig.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Activated_Params
+    {
     }
 
     /// <summary>
@@ -94,9 +107,9 @@ public partial class RBMBehaviour_ChangeAlternativeWeapConfig : BmSDK.Engine.Seq
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_ChangeAlternativeWeapConfig.Activated", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_ChangeAlternativeWeapConfig.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -114,8 +127,8 @@ public partial class RBMBehaviour_ChangeAlternativeWeapConfig : BmSDK.Engine.Seq
     /// </summary>
     public unsafe bool bResetStance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 208); }
+        get { return (*(int*)(Ptr + 208) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 208) |= 1; else *(int*)(Ptr + 208) &= ~1; }
     }
 
     /// <summary>
@@ -78,50 +78,83 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
         where TComponent : class, Framework.IScriptComponent<RBMBehaviour_CombatRas>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HitFinalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 244)]
+    private struct HitFinal_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo;
+    }
+
     /// <summary>
     /// Function: HitFinal
     /// </summary>
     public unsafe virtual void HitFinal(out BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.HitFinal", true);
-        byte* paramsPtr = stackalloc byte[244];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        DmgInfo = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnCombat.FDamageInfo>(paramsPtr + 0);
+        var funcManaged = s_HitFinalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.HitFinal", true);
+        var parms = new HitFinal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        DmgInfo = parms.DmgInfo;
         return;
     }
 
+    static BmSDK.Function s_UpdateTauntFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateTaunt_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateTaunt
     /// </summary>
     public unsafe virtual void UpdateTaunt(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.UpdateTaunt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateTauntFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.UpdateTaunt", true);
+        var parms = new UpdateTaunt_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetTimeTillTauntFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetTimeTillTaunt_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetTimeTillTaunt
     /// </summary>
     public unsafe virtual void ResetTimeTillTaunt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.ResetTimeTillTaunt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetTimeTillTauntFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.ResetTimeTillTaunt", true);
+        var parms = new ResetTimeTillTaunt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRasLevitateLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetRasLevitateLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRasLevitateLocation
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetRasLevitateLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GetRasLevitateLocation", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetRasLevitateLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GetRasLevitateLocation", true);
+        var parms = new GetRasLevitateLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_StartAppearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartAppear_Params
+    {
     }
 
     /// <summary>
@@ -129,39 +162,65 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual void StartAppear()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.StartAppear", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartAppearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.StartAppear", true);
+        var parms = new StartAppear_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BuildSwordClusterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct BuildSwordCluster_Params
+    {
+        [FieldOffset(0)] public int NumBlades;
+        [FieldOffset(4)] public System.Numerics.Vector3 SpawnPos;
+        [FieldOffset(16)] public System.Numerics.Vector3 FenceVec;
+        [FieldOffset(28)] public System.Numerics.Vector3 MoveDir;
+    }
+
     /// <summary>
     /// Function: BuildSwordCluster
     /// </summary>
     public unsafe virtual void BuildSwordCluster(int NumBlades, System.Numerics.Vector3 SpawnPos, System.Numerics.Vector3 FenceVec, System.Numerics.Vector3 MoveDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.BuildSwordCluster", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NumBlades, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnPos, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FenceVec, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveDir, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BuildSwordClusterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.BuildSwordCluster", true);
+        var parms = new BuildSwordCluster_Params();
+        parms.NumBlades = NumBlades;
+        parms.SpawnPos = SpawnPos;
+        parms.FenceVec = FenceVec;
+        parms.MoveDir = MoveDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SelectSlotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SelectSlot_Params
+    {
+        [FieldOffset(0)] public int Min;
+        [FieldOffset(4)] public int Max;
+        [FieldOffset(8)] public int Exclude;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SelectSlot
     /// </summary>
     public unsafe virtual int SelectSlot(int Min, int Max, int Exclude)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SelectSlot", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Min, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Max, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Exclude, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 12);
+        var funcManaged = s_SelectSlotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SelectSlot", true);
+        var parms = new SelectSlot_Params();
+        parms.Min = Min;
+        parms.Max = Max;
+        parms.Exclude = Exclude;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_LaunchSwordClusterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 41)]
+    private struct LaunchSwordCluster_Params
+    {
     }
 
     /// <summary>
@@ -169,32 +228,52 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual void LaunchSwordCluster()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.LaunchSwordCluster", true);
-        byte* paramsPtr = stackalloc byte[41];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LaunchSwordClusterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.LaunchSwordCluster", true);
+        var parms = new LaunchSwordCluster_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateClusterLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpdateClusterLevel_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateClusterLevel
     /// </summary>
     public unsafe virtual void UpdateClusterLevel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.UpdateClusterLevel", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateClusterLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.UpdateClusterLevel", true);
+        var parms = new UpdateClusterLevel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetNextSwordAttackTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetNextSwordAttackTime_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetNextSwordAttackTime
     /// </summary>
     public unsafe virtual float GetNextSwordAttackTime()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GetNextSwordAttackTime", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetNextSwordAttackTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GetNextSwordAttackTime", true);
+        var parms = new GetNextSwordAttackTime_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateSwordAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateSwordAttack_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -202,22 +281,36 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual void UpdateSwordAttack(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.UpdateSwordAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateSwordAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.UpdateSwordAttack", true);
+        var parms = new UpdateSwordAttack_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AttackTargetPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AttackTargetPawn_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AttackTargetPawn
     /// </summary>
     public unsafe override bool AttackTargetPawn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.AttackTargetPawn", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AttackTargetPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.AttackTargetPawn", true);
+        var parms = new AttackTargetPawn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShouldMagBlastLockOnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldMagBlastLockOn_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -225,10 +318,17 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual bool ShouldMagBlastLockOn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.ShouldMagBlastLockOn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldMagBlastLockOnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.ShouldMagBlastLockOn", true);
+        var parms = new ShouldMagBlastLockOn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsBatarangableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsBatarangable_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -236,10 +336,18 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual bool IsBatarangable()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.IsBatarangable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsBatarangableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.IsBatarangable", true);
+        var parms = new IsBatarangable_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanBeHitInCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanBeHitInCombat_Params
+    {
+        [FieldOffset(0)] public nint DamageType;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -247,11 +355,17 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe override bool CanBeHitInCombat(BmSDK.BmGame.RDamageType DamageType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.CanBeHitInCombat", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanBeHitInCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.CanBeHitInCombat", true);
+        var parms = new CanBeHitInCombat_Params();
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GotoCombatStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GotoCombatState_Params
+    {
     }
 
     /// <summary>
@@ -259,24 +373,41 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe override void GotoCombatState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GotoCombatState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GotoCombatStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GotoCombatState", true);
+        var parms = new GotoCombatState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasClearPathToCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct HasClearPathToCombat_Params
+    {
+        [FieldOffset(0)] public int bForceCheck;
+        [FieldOffset(4)] public int bDefaultValue;
+        [FieldOffset(8)] public int bForceCheckOnActualPosition;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasClearPathToCombat
     /// </summary>
     public unsafe override bool HasClearPathToCombat(bool bForceCheck = default, bool bDefaultValue = default, bool bForceCheckOnActualPosition = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.HasClearPathToCombat", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceCheck, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDefaultValue, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceCheckOnActualPosition, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_HasClearPathToCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.HasClearPathToCombat", true);
+        var parms = new HasClearPathToCombat_Params();
+        parms.bForceCheck = bForceCheck ? 1 : 0;
+        parms.bDefaultValue = bDefaultValue ? 1 : 0;
+        parms.bForceCheckOnActualPosition = bForceCheckOnActualPosition ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanRedirectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanRedirect_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -284,10 +415,18 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual bool CanRedirect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.CanRedirect", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanRedirectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.CanRedirect", true);
+        var parms = new CanRedirect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DamagedByFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 248)]
+    private struct DamagedBy_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo;
+        [FieldOffset(244)] public int ReturnValue;
     }
 
     /// <summary>
@@ -295,11 +434,19 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual bool DamagedBy(BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.DamagedBy", true);
-        byte* paramsPtr = stackalloc byte[248];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DmgInfo, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 244);
+        var funcManaged = s_DamagedByFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.DamagedBy", true);
+        var parms = new DamagedBy_Params();
+        parms.DmgInfo = DmgInfo;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ModifyDamageAmountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ModifyDamageAmount_Params
+    {
+        [FieldOffset(0)] public nint dmgType;
+        [FieldOffset(4)] public float DmgAmount;
     }
 
     /// <summary>
@@ -307,23 +454,37 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual void ModifyDamageAmount(BmSDK.Class dmgType, out float DmgAmount)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.ModifyDamageAmount", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        DmgAmount = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_ModifyDamageAmountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.ModifyDamageAmount", true);
+        var parms = new ModifyDamageAmount_Params();
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        DmgAmount = parms.DmgAmount;
         return;
     }
 
+    static BmSDK.Function s_BossCanTakeGooHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BossCanTakeGooHit_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: BossCanTakeGooHit
     /// </summary>
     public unsafe virtual bool BossCanTakeGooHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.BossCanTakeGooHit", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_BossCanTakeGooHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.BossCanTakeGooHit", true);
+        var parms = new BossCanTakeGooHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsCurrentCombatantFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsCurrentCombatant_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -331,10 +492,18 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe override bool IsCurrentCombatant()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.IsCurrentCombatant", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsCurrentCombatantFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.IsCurrentCombatant", true);
+        var parms = new IsCurrentCombatant_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetTargetPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetTargetPriority_Params
+    {
+        [FieldOffset(0)] public nint dmgType;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -342,11 +511,18 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual float GetTargetPriority(BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GetTargetPriority", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetTargetPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GetTargetPriority", true);
+        var parms = new GetTargetPriority_Params();
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_HitByBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HitByBatarang_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -354,10 +530,18 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual bool HitByBatarang()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.HitByBatarang", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HitByBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.HitByBatarang", true);
+        var parms = new HitByBatarang_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OverrideHarpoonHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OverrideHarpoonHit_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -365,11 +549,17 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe virtual bool OverrideHarpoonHit(BmSDK.BmGame.RPawnPlayer PlayerPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.OverrideHarpoonHit", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_OverrideHarpoonHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.OverrideHarpoonHit", true);
+        var parms = new OverrideHarpoonHit_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnActivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnActivate_Params
+    {
     }
 
     /// <summary>
@@ -377,147 +567,216 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe override void OnActivate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.OnActivate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnActivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.OnActivate", true);
+        var parms = new OnActivate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayTauntFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayTaunt_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayTaunt
     /// </summary>
     public unsafe virtual void PlayTaunt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.PlayTaunt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayTauntFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.PlayTaunt", true);
+        var parms = new PlayTaunt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnCombatMoveExitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnCombatMoveExit_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnCombatMoveExit
     /// </summary>
     public unsafe virtual void OnCombatMoveExit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.OnCombatMoveExit", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnCombatMoveExitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.OnCombatMoveExit", true);
+        var parms = new OnCombatMoveExit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckEndPhaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckEndPhase_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckEndPhase
     /// </summary>
     public unsafe virtual void CheckEndPhase()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.CheckEndPhase", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckEndPhaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.CheckEndPhase", true);
+        var parms = new CheckEndPhase_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryDisarmByMagneticBlastFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct TryDisarmByMagneticBlast_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Impulse;
+        [FieldOffset(12)] public nint Attacker;
+        [FieldOffset(16)] public nint Receiver;
+        [FieldOffset(20)] public int bSuccessfulDisarm;
+    }
+
     /// <summary>
     /// Function: TryDisarmByMagneticBlast
     /// </summary>
     public unsafe virtual void TryDisarmByMagneticBlast(System.Numerics.Vector3 Impulse, BmSDK.BmGame.RPawnCombat Attacker, BmSDK.BmGame.RMagneticBlastReceiver Receiver, bool bSuccessfulDisarm)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.TryDisarmByMagneticBlast", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Impulse, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Receiver, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSuccessfulDisarm, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TryDisarmByMagneticBlastFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.TryDisarmByMagneticBlast", true);
+        var parms = new TryDisarmByMagneticBlast_Params();
+        parms.Impulse = Impulse;
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        parms.Receiver = Receiver?.Ptr ?? 0;
+        parms.bSuccessfulDisarm = bSuccessfulDisarm ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnChopAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnChopAttack_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnChopAttack
     /// </summary>
     public unsafe virtual void SpawnChopAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SpawnChopAttack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnChopAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SpawnChopAttack", true);
+        var parms = new SpawnChopAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnSwordAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnSwordAttack_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnSwordAttack
     /// </summary>
     public unsafe virtual void SpawnSwordAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SpawnSwordAttack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnSwordAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SpawnSwordAttack", true);
+        var parms = new SpawnSwordAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnChargeAttackCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnChargeAttackComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnChargeAttackComplete
     /// </summary>
     public unsafe virtual void OnChargeAttackComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.OnChargeAttackComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnChargeAttackCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.OnChargeAttackComplete", true);
+        var parms = new OnChargeAttackComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnChargeAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnChargeAttack_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnChargeAttack
     /// </summary>
     public unsafe virtual void SpawnChargeAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SpawnChargeAttack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnChargeAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SpawnChargeAttack", true);
+        var parms = new SpawnChargeAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnDemonBlastFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnDemonBlast_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnDemonBlast
     /// </summary>
     public unsafe virtual void SpawnDemonBlast()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SpawnDemonBlast", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnDemonBlastFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.SpawnDemonBlast", true);
+        var parms = new SpawnDemonBlast_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DamageCollisionWithFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DamageCollisionWith_Params
+    {
+        [FieldOffset(0)] public nint OtherPawn;
+    }
+
     /// <summary>
     /// Function: DamageCollisionWith
     /// </summary>
     public unsafe virtual void DamageCollisionWith(BmSDK.BmGame.RPawnCombat OtherPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.DamageCollisionWith", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DamageCollisionWithFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.DamageCollisionWith", true);
+        var parms = new DamageCollisionWith_Params();
+        parms.OtherPawn = OtherPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetForceToGiveToPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetForceToGiveToPawn_Params
+    {
+        [FieldOffset(0)] public nint ForceReceiver;
+        [FieldOffset(4)] public float MaxForce;
+        [FieldOffset(8)] public float MinRange;
+        [FieldOffset(12)] public float MaxRange;
+        [FieldOffset(16)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetForceToGiveToPawn
     /// </summary>
     public unsafe override System.Numerics.Vector3 GetForceToGiveToPawn(BmSDK.BmGame.RPawnCombat ForceReceiver, float MaxForce, float MinRange = default, float MaxRange = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GetForceToGiveToPawn", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceReceiver, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxForce, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MinRange, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxRange, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
+        var funcManaged = s_GetForceToGiveToPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMBehaviour_CombatRas.GetForceToGiveToPawn", true);
+        var parms = new GetForceToGiveToPawn_Params();
+        parms.ForceReceiver = ForceReceiver?.Ptr ?? 0;
+        parms.MaxForce = MaxForce;
+        parms.MinRange = MinRange;
+        parms.MaxRange = MaxRange;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -536,8 +795,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float TimeInState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 764); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 764); }
+        get { return *(float*)(Ptr + 764); }
+        set { *(float*)(Ptr + 764) = value; }
     }
 
     /// <summary>
@@ -545,8 +804,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe bool bHintActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 768); }
+        get { return (*(int*)(Ptr + 768) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 768) |= 1; else *(int*)(Ptr + 768) &= ~1; }
     }
 
     /// <summary>
@@ -554,8 +813,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe bool bExitedPoweredUpState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 768); }
+        get { return (*(int*)(Ptr + 768) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 768) |= 2; else *(int*)(Ptr + 768) &= ~2; }
     }
 
     /// <summary>
@@ -563,8 +822,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe bool bShouldDoRasAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 768); }
+        get { return (*(int*)(Ptr + 768) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 768) |= 4; else *(int*)(Ptr + 768) &= ~4; }
     }
 
     /// <summary>
@@ -572,8 +831,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe bool bSwordAttackOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 768); }
+        get { return (*(int*)(Ptr + 768) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 768) |= 8; else *(int*)(Ptr + 768) &= ~8; }
     }
 
     /// <summary>
@@ -581,8 +840,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe bool bForceMiddleSwordCluster
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 768); }
+        get { return (*(int*)(Ptr + 768) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 768) |= 16; else *(int*)(Ptr + 768) &= ~16; }
     }
 
     /// <summary>
@@ -614,8 +873,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float DemonBlastTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 784); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 784); }
+        get { return *(float*)(Ptr + 784); }
+        set { *(float*)(Ptr + 784) = value; }
     }
 
     /// <summary>
@@ -623,8 +882,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float LastDamageTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 788); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 788); }
+        get { return *(float*)(Ptr + 788); }
+        set { *(float*)(Ptr + 788) = value; }
     }
 
     /// <summary>
@@ -632,8 +891,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float ElectricDamageRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 792); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 792); }
+        get { return *(float*)(Ptr + 792); }
+        set { *(float*)(Ptr + 792) = value; }
     }
 
     /// <summary>
@@ -641,8 +900,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe int NumSuccessfulHits
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 796); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 796); }
+        get { return *(int*)(Ptr + 796); }
+        set { *(int*)(Ptr + 796) = value; }
     }
 
     /// <summary>
@@ -659,8 +918,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float StartManoTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 812); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 812); }
+        get { return *(float*)(Ptr + 812); }
+        set { *(float*)(Ptr + 812) = value; }
     }
 
     /// <summary>
@@ -668,8 +927,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float TillNextSwordAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 816); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 816); }
+        get { return *(float*)(Ptr + 816); }
+        set { *(float*)(Ptr + 816) = value; }
     }
 
     /// <summary>
@@ -677,8 +936,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float SwordAttackTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 820); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 820); }
+        get { return *(float*)(Ptr + 820); }
+        set { *(float*)(Ptr + 820) = value; }
     }
 
     /// <summary>
@@ -686,8 +945,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float SwordClusterOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 824); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 824); }
+        get { return *(float*)(Ptr + 824); }
+        set { *(float*)(Ptr + 824) = value; }
     }
 
     /// <summary>
@@ -695,8 +954,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float BladeOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 828); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 828); }
+        get { return *(float*)(Ptr + 828); }
+        set { *(float*)(Ptr + 828) = value; }
     }
 
     /// <summary>
@@ -704,8 +963,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe int AttacksSinceChop
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 832); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 832); }
+        get { return *(int*)(Ptr + 832); }
+        set { *(int*)(Ptr + 832) = value; }
     }
 
     /// <summary>
@@ -713,8 +972,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float TimeTillBurstOut
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 836); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 836); }
+        get { return *(float*)(Ptr + 836); }
+        set { *(float*)(Ptr + 836) = value; }
     }
 
     /// <summary>
@@ -722,8 +981,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float TimeTillSpawnSpectral
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 840); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 840); }
+        get { return *(float*)(Ptr + 840); }
+        set { *(float*)(Ptr + 840) = value; }
     }
 
     /// <summary>
@@ -731,8 +990,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float TimeTillSpawnShield
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 844); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 844); }
+        get { return *(float*)(Ptr + 844); }
+        set { *(float*)(Ptr + 844) = value; }
     }
 
     /// <summary>
@@ -740,8 +999,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float DamageAmountREC
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 848); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 848); }
+        get { return *(float*)(Ptr + 848); }
+        set { *(float*)(Ptr + 848) = value; }
     }
 
     /// <summary>
@@ -749,8 +1008,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float DamageAmountFreeze
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 852); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 852); }
+        get { return *(float*)(Ptr + 852); }
+        set { *(float*)(Ptr + 852) = value; }
     }
 
     /// <summary>
@@ -758,8 +1017,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float DamageTolerence
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 856); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 856); }
+        get { return *(float*)(Ptr + 856); }
+        set { *(float*)(Ptr + 856) = value; }
     }
 
     /// <summary>
@@ -767,8 +1026,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float TimeTillTaunt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 860); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 860); }
+        get { return *(float*)(Ptr + 860); }
+        set { *(float*)(Ptr + 860) = value; }
     }
 
     /// <summary>
@@ -776,8 +1035,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe int LastTaunt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 864); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 864); }
+        get { return *(int*)(Ptr + 864); }
+        set { *(int*)(Ptr + 864) = value; }
     }
 
     /// <summary>
@@ -785,8 +1044,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe float MaxDamageTolerence
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 868); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 868); }
+        get { return *(float*)(Ptr + 868); }
+        set { *(float*)(Ptr + 868) = value; }
     }
 
     /// <summary>
@@ -794,8 +1053,8 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe BmSDK.BmGame.RBMBehaviour_CombatRas.ESwordClusterLevel SwordClusterLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMBehaviour_CombatRas.ESwordClusterLevel>(Ptr + 872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 872); }
+        get { return *(BmSDK.BmGame.RBMBehaviour_CombatRas.ESwordClusterLevel*)(Ptr + 872); }
+        set { *(BmSDK.BmGame.RBMBehaviour_CombatRas.ESwordClusterLevel*)(Ptr + 872) = value; }
     }
 
     /// <summary>
@@ -803,7 +1062,7 @@ public partial class RBMBehaviour_CombatRas : BmSDK.BmGame.RBMBehaviour_CombatAI
     /// </summary>
     public unsafe int NumTimesHitGiantRas
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 876); }
+        get { return *(int*)(Ptr + 876); }
+        set { *(int*)(Ptr + 876) = value; }
     }
 }
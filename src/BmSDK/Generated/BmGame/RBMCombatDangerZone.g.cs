@@ -78,27 +78,47 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
         where TComponent : class, Framework.IScriptComponent<RBMCombatDangerZone>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_DamagePawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DamagePawn_Params
+    {
+        [FieldOffset(0)] public nint PawnToDamage;
+    }
+
     /// <summary>
     /// Function: DamagePawn
     /// </summary>
     public unsafe virtual void DamagePawn(BmSDK.BmGame.RPawn PawnToDamage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.DamagePawn", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PawnToDamage, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DamagePawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.DamagePawn", true);
+        var parms = new DamagePawn_Params();
+        parms.PawnToDamage = PawnToDamage?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldDoDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldDoDamage_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldDoDamage
     /// </summary>
     public unsafe virtual bool ShouldDoDamage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.ShouldDoDamage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldDoDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.ShouldDoDamage", true);
+        var parms = new ShouldDoDamage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DamageActorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DamageActors_Params
+    {
     }
 
     /// <summary>
@@ -106,143 +126,217 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
     /// </summary>
     public unsafe virtual void DamageActors()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.DamageActors", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DamageActorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.DamageActors", true);
+        var parms = new DamageActors_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnblockPathsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnblockPaths_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnblockPaths
     /// </summary>
     public unsafe virtual void UnblockPaths()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.UnblockPaths", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnblockPathsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.UnblockPaths", true);
+        var parms = new UnblockPaths_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BlockPathsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BlockPaths_Params
+    {
+    }
+
     /// <summary>
     /// Function: BlockPaths
     /// </summary>
     public unsafe virtual void BlockPaths()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.BlockPaths", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BlockPathsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.BlockPaths", true);
+        var parms = new BlockPaths_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateModifiedSpecListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct UpdateModifiedSpecList_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateModifiedSpecList
     /// </summary>
     public unsafe virtual void UpdateModifiedSpecList()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.UpdateModifiedSpecList", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateModifiedSpecListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.UpdateModifiedSpecList", true);
+        var parms = new UpdateModifiedSpecList_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddModifiedNodeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddModifiedNode_Params
+    {
+        [FieldOffset(0)] public nint NewNode;
+    }
+
     /// <summary>
     /// Function: AddModifiedNode
     /// </summary>
     public unsafe virtual void AddModifiedNode(BmSDK.BmGame.RPathNode NewNode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.AddModifiedNode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewNode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddModifiedNodeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.AddModifiedNode", true);
+        var parms = new AddModifiedNode_Params();
+        parms.NewNode = NewNode?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartDamagingActorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartDamagingActors_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartDamagingActors
     /// </summary>
     public unsafe virtual void StartDamagingActors()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.StartDamagingActors", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartDamagingActorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.StartDamagingActors", true);
+        var parms = new StartDamagingActors_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleOffFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleOff_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleOff
     /// </summary>
     public unsafe virtual void ToggleOff()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.ToggleOff", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleOffFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.ToggleOff", true);
+        var parms = new ToggleOff_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleOnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleOn_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleOn
     /// </summary>
     public unsafe virtual void ToggleOn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.ToggleOn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleOnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.ToggleOn", true);
+        var parms = new ToggleOn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AlertCombatPawnsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct AlertCombatPawns_Params
+    {
+    }
+
     /// <summary>
     /// Function: AlertCombatPawns
     /// </summary>
     public unsafe virtual void AlertCombatPawns()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.AlertCombatPawns", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AlertCombatPawnsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.AlertCombatPawns", true);
+        var parms = new AlertCombatPawns_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnToggleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OnToggle_Params
+    {
+        [FieldOffset(0)] public nint inAction;
+    }
+
     /// <summary>
     /// Function: OnToggle
     /// </summary>
     public unsafe override void OnToggle(BmSDK.Engine.SeqAct_Toggle inAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.OnToggle", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.OnToggle", true);
+        var parms = new OnToggle_Params();
+        parms.inAction = inAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOffFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TurnOff_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOff
     /// </summary>
     public unsafe virtual void TurnOff()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.TurnOff", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOffFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.TurnOff", true);
+        var parms = new TurnOff_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TurnOn_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOn
     /// </summary>
     public unsafe virtual void TurnOn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.TurnOn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.TurnOn", true);
+        var parms = new TurnOn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatDangerZone.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -251,8 +345,8 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
     /// </summary>
     public unsafe bool bActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 560); }
+        get { return (*(int*)(Ptr + 560) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 560) |= 1; else *(int*)(Ptr + 560) &= ~1; }
     }
 
     /// <summary>
@@ -260,8 +354,8 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
     /// </summary>
     public unsafe bool bDamageActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 560); }
+        get { return (*(int*)(Ptr + 560) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 560) |= 2; else *(int*)(Ptr + 560) &= ~2; }
     }
 
     /// <summary>
@@ -269,8 +363,8 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
     /// </summary>
     public unsafe bool bIsForHole
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 560); }
+        get { return (*(int*)(Ptr + 560) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 560) |= 4; else *(int*)(Ptr + 560) &= ~4; }
     }
 
     /// <summary>
@@ -305,8 +399,8 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
     /// </summary>
     public unsafe float DamageDoneToPlayer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 592); }
+        get { return *(float*)(Ptr + 592); }
+        set { *(float*)(Ptr + 592) = value; }
     }
 
     /// <summary>
@@ -314,8 +408,8 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
     /// </summary>
     public unsafe float DamageDoneToEnemies
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 596); }
+        get { return *(float*)(Ptr + 596); }
+        set { *(float*)(Ptr + 596) = value; }
     }
 
     /// <summary>
@@ -323,8 +417,8 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
     /// </summary>
     public unsafe float DamageDoneToFriendlies
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 600); }
+        get { return *(float*)(Ptr + 600); }
+        set { *(float*)(Ptr + 600) = value; }
     }
 
     /// <summary>
@@ -332,7 +426,7 @@ public partial class RBMCombatDangerZone : BmSDK.Engine.PhysicsVolume, BmSDK.IGa
     /// </summary>
     public unsafe float DamageActivationDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 604); }
+        get { return *(float*)(Ptr + 604); }
+        set { *(float*)(Ptr + 604) = value; }
     }
 }
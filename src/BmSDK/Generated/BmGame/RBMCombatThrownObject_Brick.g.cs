@@ -78,16 +78,24 @@ public partial class RBMCombatThrownObject_Brick : BmSDK.BmGame.RBMCombatThrownO
         where TComponent : class, Framework.IScriptComponent<RBMCombatThrownObject_Brick>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HitCombatPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HitCombatPawn_Params
+    {
+        [FieldOffset(0)] public nint HitPawn;
+        [FieldOffset(4)] public float Speed;
+    }
+
     /// <summary>
     /// Function: HitCombatPawn
     /// </summary>
     public unsafe override void HitCombatPawn(BmSDK.BmGame.RPawnCombat HitPawn, float Speed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatThrownObject_Brick.HitCombatPawn", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitCombatPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCombatThrownObject_Brick.HitCombatPawn", true);
+        var parms = new HitCombatPawn_Params();
+        parms.HitPawn = HitPawn?.Ptr ?? 0;
+        parms.Speed = Speed;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -96,7 +104,7 @@ public partial class RBMCombatThrownObject_Brick : BmSDK.BmGame.RBMCombatThrownO
     /// </summary>
     public unsafe float DamageGiven
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 720); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 720); }
+        get { return *(float*)(Ptr + 720); }
+        set { *(float*)(Ptr + 720) = value; }
     }
 }
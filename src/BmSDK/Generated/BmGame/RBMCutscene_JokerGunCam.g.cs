@@ -78,15 +78,23 @@ public partial class RBMCutscene_JokerGunCam : BmSDK.BmGame.RBMCutscene_BatClawC
         where TComponent : class, Framework.IScriptComponent<RBMCutscene_JokerGunCam>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CanUseCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanUseCam_Params
+    {
+        [FieldOffset(0)] public nint CheckCutscene;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseCam
     /// </summary>
     public unsafe static bool CanUseCam(BmSDK.BmGame.RBMCutsceneBase CheckCutscene)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCutscene_JokerGunCam.CanUseCam", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckCutscene, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanUseCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMCutscene_JokerGunCam.CanUseCam", true);
+        var parms = new CanUseCam_Params();
+        parms.CheckCutscene = CheckCutscene?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 }
@@ -78,27 +78,48 @@ public partial class RBMDeathCutscene : BmSDK.BmGame.RBMCutsceneBase, BmSDK.IGam
         where TComponent : class, Framework.IScriptComponent<RBMDeathCutscene>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_StrikeImpactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StrikeImpact_Params
+    {
+        [FieldOffset(0)] public int bFinalImpact;
+    }
+
     /// <summary>
     /// Function: StrikeImpact
     /// </summary>
     public unsafe virtual void StrikeImpact(bool bFinalImpact = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.StrikeImpact", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFinalImpact, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StrikeImpactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.StrikeImpact", true);
+        var parms = new StrikeImpact_Params();
+        parms.bFinalImpact = bFinalImpact ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetKillerPawnLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetKillerPawnLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetKillerPawnLocation
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetKillerPawnLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.GetKillerPawnLocation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetKillerPawnLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.GetKillerPawnLocation", true);
+        var parms = new GetKillerPawnLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetKillerPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetKillerPawn_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -106,10 +127,16 @@ public partial class RBMDeathCutscene : BmSDK.BmGame.RBMCutsceneBase, BmSDK.IGam
     /// </summary>
     public unsafe virtual BmSDK.Engine.Pawn GetKillerPawn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.GetKillerPawn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Pawn>(paramsPtr + 0);
+        var funcManaged = s_GetKillerPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.GetKillerPawn", true);
+        var parms = new GetKillerPawn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Pawn)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_PickCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PickCamera_Params
+    {
     }
 
     /// <summary>
@@ -117,38 +144,57 @@ public partial class RBMDeathCutscene : BmSDK.BmGame.RBMCutsceneBase, BmSDK.IGam
     /// </summary>
     public unsafe override void PickCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.PickCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PickCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.PickCamera", true);
+        var parms = new PickCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseDeathCutsceneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 144)]
+    private struct InitialiseDeathCutscene_Params
+    {
+        [FieldOffset(0)] public nint NewCutsceneOwner;
+        [FieldOffset(4)] public nint NewCutsceneTarget;
+        [FieldOffset(8)] public nint NewCutsceneKiller;
+        [FieldOffset(12)] public BmSDK.BmGame.RPawnPlayerCombat.FStrikeInfo NewStrikeInfo;
+        [FieldOffset(136)] public nint DeathCamClass;
+        [FieldOffset(140)] public float NewTimeUntilImpact;
+    }
+
     /// <summary>
     /// Function: InitialiseDeathCutscene
     /// </summary>
     public unsafe virtual void InitialiseDeathCutscene(BmSDK.BmGame.RPlayerController NewCutsceneOwner, BmSDK.BmGame.RPawn NewCutsceneTarget, BmSDK.BmGame.RPawn NewCutsceneKiller, BmSDK.BmGame.RPawnPlayerCombat.FStrikeInfo NewStrikeInfo, BmSDK.Class DeathCamClass, float NewTimeUntilImpact)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.InitialiseDeathCutscene", true);
-        byte* paramsPtr = stackalloc byte[144];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCutsceneOwner, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCutsceneTarget, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCutsceneKiller, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewStrikeInfo, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeathCamClass, paramsPtr + 136);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTimeUntilImpact, paramsPtr + 140);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseDeathCutsceneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.InitialiseDeathCutscene", true);
+        var parms = new InitialiseDeathCutscene_Params();
+        parms.NewCutsceneOwner = NewCutsceneOwner?.Ptr ?? 0;
+        parms.NewCutsceneTarget = NewCutsceneTarget?.Ptr ?? 0;
+        parms.NewCutsceneKiller = NewCutsceneKiller?.Ptr ?? 0;
+        parms.NewStrikeInfo = NewStrikeInfo;
+        parms.DeathCamClass = DeathCamClass?.Ptr ?? 0;
+        parms.NewTimeUntilImpact = NewTimeUntilImpact;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseBoneFollowersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitialiseBoneFollowers_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName TargetBoneToFollow;
+    }
+
     /// <summary>
     /// Function: InitialiseBoneFollowers
     /// </summary>
     public unsafe override void InitialiseBoneFollowers(BmSDK.FName TargetBoneToFollow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.InitialiseBoneFollowers", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBoneToFollow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseBoneFollowersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDeathCutscene.InitialiseBoneFollowers", true);
+        var parms = new InitialiseBoneFollowers_Params();
+        parms.TargetBoneToFollow = TargetBoneToFollow;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -181,8 +227,8 @@ public partial class RBMDeathCutscene : BmSDK.BmGame.RBMCutsceneBase, BmSDK.IGam
     /// </summary>
     public unsafe float TimeUntilImpact
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1020); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1020); }
+        get { return *(float*)(Ptr + 1020); }
+        set { *(float*)(Ptr + 1020) = value; }
     }
 
     /// <summary>
@@ -190,7 +236,7 @@ public partial class RBMDeathCutscene : BmSDK.BmGame.RBMCutsceneBase, BmSDK.IGam
     /// </summary>
     public unsafe float InitialTimeUntilImpact
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1024); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1024); }
+        get { return *(float*)(Ptr + 1024); }
+        set { *(float*)(Ptr + 1024) = value; }
     }
 }
@@ -78,50 +78,83 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
         where TComponent : class, Framework.IScriptComponent<RBMDialogueCoordinator>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_DecreaseDialogueFrequencyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DecreaseDialogueFrequency_Params
+    {
+    }
+
     /// <summary>
     /// Function: DecreaseDialogueFrequency
     /// </summary>
     public unsafe virtual void DecreaseDialogueFrequency()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.DecreaseDialogueFrequency", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DecreaseDialogueFrequencyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.DecreaseDialogueFrequency", true);
+        var parms = new DecreaseDialogueFrequency_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetRoomSpecificBiasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetRoomSpecificBias_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetRoomSpecificBias
     /// </summary>
     public unsafe virtual void ResetRoomSpecificBias()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.ResetRoomSpecificBias", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetRoomSpecificBiasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.ResetRoomSpecificBias", true);
+        var parms = new ResetRoomSpecificBias_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMinRandomBarkTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetMinRandomBarkTime_Params
+    {
+        [FieldOffset(0)] public float NewMin;
+    }
+
     /// <summary>
     /// Function: SetMinRandomBarkTime
     /// </summary>
     public unsafe virtual void SetMinRandomBarkTime(float NewMin)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.SetMinRandomBarkTime", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMin, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMinRandomBarkTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.SetMinRandomBarkTime", true);
+        var parms = new SetMinRandomBarkTime_Params();
+        parms.NewMin = NewMin;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetDeadGuyBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetDeadGuyBark_Params
+    {
+        [FieldOffset(0)] public nint DeadGuy;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetDeadGuyBark
     /// </summary>
     public unsafe virtual BmSDK.Engine.RDialogueLine GetDeadGuyBark(BmSDK.BmGame.RPawnVillain DeadGuy)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetDeadGuyBark", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeadGuy, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RDialogueLine>(paramsPtr + 4);
+        var funcManaged = s_GetDeadGuyBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetDeadGuyBark", true);
+        var parms = new GetDeadGuyBark_Params();
+        parms.DeadGuy = DeadGuy?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.RDialogueLine)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_InstigateRandomBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct InstigateRandomBark_Params
+    {
     }
 
     /// <summary>
@@ -129,67 +162,108 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void InstigateRandomBark()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.InstigateRandomBark", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InstigateRandomBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.InstigateRandomBark", true);
+        var parms = new InstigateRandomBark_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FunctionalityTestFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FunctionalityTest_Params
+    {
+    }
+
     /// <summary>
     /// Function: FunctionalityTest
     /// </summary>
     public unsafe virtual void FunctionalityTest()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.FunctionalityTest", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FunctionalityTestFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.FunctionalityTest", true);
+        var parms = new FunctionalityTest_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpQueueStateToLogFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DumpQueueStateToLog_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpQueueStateToLog
     /// </summary>
     public unsafe virtual void DumpQueueStateToLog()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.DumpQueueStateToLog", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpQueueStateToLogFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.DumpQueueStateToLog", true);
+        var parms = new DumpQueueStateToLog_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseSpeakersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct InitialiseSpeakers_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitialiseSpeakers
     /// </summary>
     public unsafe virtual void InitialiseSpeakers()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.InitialiseSpeakers", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseSpeakersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.InitialiseSpeakers", true);
+        var parms = new InitialiseSpeakers_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PawnDiedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PawnDied_Params
+    {
+        [FieldOffset(0)] public nint DeadPawn;
+    }
+
     /// <summary>
     /// Function: PawnDied
     /// </summary>
     public unsafe virtual void PawnDied(BmSDK.BmGame.RPawnVillain DeadPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.PawnDied", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeadPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PawnDiedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.PawnDied", true);
+        var parms = new PawnDied_Params();
+        parms.DeadPawn = DeadPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetReplyBarkTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 2)]
+    private struct GetReplyBarkType_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBarkSet.EConvoBarkType CurrentState;
+        [FieldOffset(1)] public BmSDK.BmGame.RBarkSet.EConvoBarkType ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetReplyBarkType
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBarkSet.EConvoBarkType GetReplyBarkType(BmSDK.BmGame.RBarkSet.EConvoBarkType CurrentState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetReplyBarkType", true);
-        byte* paramsPtr = stackalloc byte[2];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentState, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBarkSet.EConvoBarkType>(paramsPtr + 1);
+        var funcManaged = s_GetReplyBarkTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetReplyBarkType", true);
+        var parms = new GetReplyBarkType_Params();
+        parms.CurrentState = CurrentState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetFollowOnBarkTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 2)]
+    private struct GetFollowOnBarkType_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBarkSet.EConvoBarkType CurrentState;
+        [FieldOffset(1)] public BmSDK.BmGame.RBarkSet.EConvoBarkType ReturnValue;
     }
 
     /// <summary>
@@ -197,11 +271,19 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBarkSet.EConvoBarkType GetFollowOnBarkType(BmSDK.BmGame.RBarkSet.EConvoBarkType CurrentState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetFollowOnBarkType", true);
-        byte* paramsPtr = stackalloc byte[2];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentState, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBarkSet.EConvoBarkType>(paramsPtr + 1);
+        var funcManaged = s_GetFollowOnBarkTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetFollowOnBarkType", true);
+        var parms = new GetFollowOnBarkType_Params();
+        parms.CurrentState = CurrentState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ContinuePercentageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ContinuePercentage_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBarkSet.EConvoBarkType CurrentState;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -209,11 +291,18 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual float ContinuePercentage(BmSDK.BmGame.RBarkSet.EConvoBarkType CurrentState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.ContinuePercentage", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentState, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_ContinuePercentageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.ContinuePercentage", true);
+        var parms = new ContinuePercentage_Params();
+        parms.CurrentState = CurrentState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ContinueConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct ContinueConversation_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -221,10 +310,17 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool ContinueConversation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.ContinueConversation", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ContinueConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.ContinueConversation", true);
+        var parms = new ContinueConversation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FreeLockFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FreeLock_Params
+    {
+        [FieldOffset(0)] public nint ExLockee;
     }
 
     /// <summary>
@@ -232,34 +328,55 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void FreeLock(BmSDK.BmGame.RAlertEventCoordinatorBase ExLockee)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.FreeLock", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExLockee, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FreeLockFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.FreeLock", true);
+        var parms = new FreeLock_Params();
+        parms.ExLockee = ExLockee?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLockFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetLock_Params
+    {
+        [FieldOffset(0)] public nint NewLockee;
+    }
+
     /// <summary>
     /// Function: SetLock
     /// </summary>
     public unsafe virtual void SetLock(BmSDK.BmGame.RAlertEventCoordinatorBase NewLockee)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.SetLock", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLockee, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLockFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.SetLock", true);
+        var parms = new SetLock_Params();
+        parms.NewLockee = NewLockee?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DialogueLockedByEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DialogueLockedByEvent_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: DialogueLockedByEvent
     /// </summary>
     public unsafe virtual bool DialogueLockedByEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.DialogueLockedByEvent", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_DialogueLockedByEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.DialogueLockedByEvent", true);
+        var parms = new DialogueLockedByEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanPlayBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanPlayBark_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -267,10 +384,17 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool CanPlayBark()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.CanPlayBark", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanPlayBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.CanPlayBark", true);
+        var parms = new CanPlayBark_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StopCurrentConversationIfPawnInvolvedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StopCurrentConversationIfPawnInvolved_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
     }
 
     /// <summary>
@@ -278,46 +402,77 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void StopCurrentConversationIfPawnInvolved(BmSDK.BmGame.RPawnVillain Pawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.StopCurrentConversationIfPawnInvolved", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopCurrentConversationIfPawnInvolvedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.StopCurrentConversationIfPawnInvolved", true);
+        var parms = new StopCurrentConversationIfPawnInvolved_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopCurrentConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopCurrentConversation_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopCurrentConversation
     /// </summary>
     public unsafe virtual void StopCurrentConversation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.StopCurrentConversation", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopCurrentConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.StopCurrentConversation", true);
+        var parms = new StopCurrentConversation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayCurrentLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayCurrentLine_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayCurrentLine
     /// </summary>
     public unsafe virtual void PlayCurrentLine()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.PlayCurrentLine", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayCurrentLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.PlayCurrentLine", true);
+        var parms = new PlayCurrentLine_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddFollowOnConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct AddFollowOnConversation_Params
+    {
+        [FieldOffset(0)] public nint Speaker;
+        [FieldOffset(4)] public nint ContextFlags;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AddFollowOnConversation
     /// </summary>
     public unsafe virtual bool AddFollowOnConversation(BmSDK.BmGame.RPawnVillain Speaker, BmSDK.BmGame.RBarkFlagBase ContextFlags)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.AddFollowOnConversation", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speaker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ContextFlags, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_AddFollowOnConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.AddFollowOnConversation", true);
+        var parms = new AddFollowOnConversation_Params();
+        parms.Speaker = Speaker?.Ptr ?? 0;
+        parms.ContextFlags = ContextFlags?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_QueueBarkConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct QueueBarkConversation_Params
+    {
+        [FieldOffset(0)] public nint Speaker;
+        [FieldOffset(4)] public int Priority;
+        [FieldOffset(8)] public nint ContextFlags;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -325,13 +480,21 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool QueueBarkConversation(BmSDK.BmGame.RPawnVillain Speaker, int Priority, BmSDK.BmGame.RBarkFlagBase ContextFlags)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.QueueBarkConversation", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speaker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Priority, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ContextFlags, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_QueueBarkConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.QueueBarkConversation", true);
+        var parms = new QueueBarkConversation_Params();
+        parms.Speaker = Speaker?.Ptr ?? 0;
+        parms.Priority = Priority;
+        parms.ContextFlags = ContextFlags?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PawnPlayBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct PawnPlayBark_Params
+    {
+        [FieldOffset(0)] public nint Speaker;
+        [FieldOffset(4)] public nint ContextFlags;
     }
 
     /// <summary>
@@ -339,24 +502,39 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void PawnPlayBark(BmSDK.BmGame.RPawnVillain Speaker, BmSDK.BmGame.RBarkFlagBase ContextFlags)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.PawnPlayBark", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speaker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ContextFlags, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PawnPlayBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.PawnPlayBark", true);
+        var parms = new PawnPlayBark_Params();
+        parms.Speaker = Speaker?.Ptr ?? 0;
+        parms.ContextFlags = ContextFlags?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PawnIsCurrentSpeakerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PawnIsCurrentSpeaker_Params
+    {
+        [FieldOffset(0)] public nint TestPawn;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PawnIsCurrentSpeaker
     /// </summary>
     public unsafe virtual bool PawnIsCurrentSpeaker(BmSDK.BmGame.RPawnVillain TestPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.PawnIsCurrentSpeaker", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_PawnIsCurrentSpeakerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.PawnIsCurrentSpeaker", true);
+        var parms = new PawnIsCurrentSpeaker_Params();
+        parms.TestPawn = TestPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HasBarksToPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasBarksToPlay_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -364,10 +542,16 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool HasBarksToPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.HasBarksToPlay", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasBarksToPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.HasBarksToPlay", true);
+        var parms = new HasBarksToPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ResetLastSpeechTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetLastSpeechTime_Params
+    {
     }
 
     /// <summary>
@@ -375,58 +559,95 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void ResetLastSpeechTime()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.ResetLastSpeechTime", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetLastSpeechTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.ResetLastSpeechTime", true);
+        var parms = new ResetLastSpeechTime_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GameInfoTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GameInfoTick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: GameInfoTick
     /// </summary>
     public unsafe virtual void GameInfoTick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GameInfoTick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GameInfoTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GameInfoTick", true);
+        var parms = new GameInfoTick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddScriptedConversationBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddScriptedConversationBehaviour_Params
+    {
+        [FieldOffset(0)] public nint Conversation;
+    }
+
     /// <summary>
     /// Function: AddScriptedConversationBehaviour
     /// </summary>
     public unsafe virtual void AddScriptedConversationBehaviour(BmSDK.BmGame.RBMBehaviour_StartConversation Conversation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.AddScriptedConversationBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conversation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddScriptedConversationBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.AddScriptedConversationBehaviour", true);
+        var parms = new AddScriptedConversationBehaviour_Params();
+        parms.Conversation = Conversation?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveScriptedConversationBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveScriptedConversationBehaviour_Params
+    {
+        [FieldOffset(0)] public nint Conversation;
+    }
+
     /// <summary>
     /// Function: RemoveScriptedConversationBehaviour
     /// </summary>
     public unsafe virtual void RemoveScriptedConversationBehaviour(BmSDK.BmGame.RBMBehaviour_StartConversation Conversation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.RemoveScriptedConversationBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conversation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveScriptedConversationBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.RemoveScriptedConversationBehaviour", true);
+        var parms = new RemoveScriptedConversationBehaviour_Params();
+        parms.Conversation = Conversation?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSpeakersScriptedConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetSpeakersScriptedConversation_Params
+    {
+        [FieldOffset(0)] public nint Speaker;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSpeakersScriptedConversation
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMBehaviour_StartConversation GetSpeakersScriptedConversation(BmSDK.Engine.Pawn Speaker)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetSpeakersScriptedConversation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speaker, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMBehaviour_StartConversation>(paramsPtr + 4);
+        var funcManaged = s_GetSpeakersScriptedConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetSpeakersScriptedConversation", true);
+        var parms = new GetSpeakersScriptedConversation_Params();
+        parms.Speaker = Speaker?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMBehaviour_StartConversation)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsInBarkConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsInBarkConversation_Params
+    {
+        [FieldOffset(0)] public nint Speaker;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -434,11 +655,21 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool IsInBarkConversation(BmSDK.Engine.Pawn Speaker)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.IsInBarkConversation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speaker, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsInBarkConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.IsInBarkConversation", true);
+        var parms = new IsInBarkConversation_Params();
+        parms.Speaker = Speaker?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetBarkFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetBark_Params
+    {
+        [FieldOffset(0)] public nint Barker;
+        [FieldOffset(4)] public BmSDK.BmGame.RBarkSet.EConvoBarkType BarkType;
+        [FieldOffset(8)] public nint ContextFlags;
+        [FieldOffset(12)] public BmSDK.BmGame.RBarkSet.FBarkDefinition ReturnValue;
     }
 
     /// <summary>
@@ -446,20 +677,13 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBarkSet.FBarkDefinition GetBark(BmSDK.BmGame.RPawnVillain Barker, BmSDK.BmGame.RBarkSet.EConvoBarkType BarkType, BmSDK.BmGame.RBarkFlagBase ContextFlags)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetBark", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Barker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BarkType, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ContextFlags, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBarkSet.FBarkDefinition>(paramsPtr + 12);
+        var funcManaged = s_GetBarkFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMDialogueCoordinator.GetBark", true);
+        var parms = new GetBark_Params();
+        parms.Barker = Barker?.Ptr ?? 0;
+        parms.BarkType = BarkType;
+        parms.ContextFlags = ContextFlags?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -488,8 +712,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe float TimeWithoutBark
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 528); }
+        get { return *(float*)(Ptr + 528); }
+        set { *(float*)(Ptr + 528) = value; }
     }
 
     /// <summary>
@@ -497,8 +721,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bBarksEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 532); }
+        get { return (*(int*)(Ptr + 532) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 532) |= 1; else *(int*)(Ptr + 532) &= ~1; }
     }
 
     /// <summary>
@@ -506,8 +730,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bRandomBarksEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 532); }
+        get { return (*(int*)(Ptr + 532) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 532) |= 2; else *(int*)(Ptr + 532) &= ~2; }
     }
 
     /// <summary>
@@ -515,8 +739,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bReactiveBarksOnly
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 532); }
+        get { return (*(int*)(Ptr + 532) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 532) |= 4; else *(int*)(Ptr + 532) &= ~4; }
     }
 
     /// <summary>
@@ -524,8 +748,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bPredIdleConfigSpeaking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 532); }
+        get { return (*(int*)(Ptr + 532) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 532) |= 8; else *(int*)(Ptr + 532) &= ~8; }
     }
 
     /// <summary>
@@ -533,8 +757,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe float MinRandomBarkTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }
+        get { return *(float*)(Ptr + 536); }
+        set { *(float*)(Ptr + 536) = value; }
     }
 
     /// <summary>
@@ -542,8 +766,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe float CurrRandomBarkTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(float*)(Ptr + 540); }
+        set { *(float*)(Ptr + 540) = value; }
     }
 
     /// <summary>
@@ -560,8 +784,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe float TimeWithoutTannoyBark
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(float*)(Ptr + 548); }
+        set { *(float*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -569,8 +793,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe float MinTannoyTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(float*)(Ptr + 552); }
+        set { *(float*)(Ptr + 552) = value; }
     }
 
     /// <summary>
@@ -587,8 +811,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe int RoomSpecificBias
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 568); }
+        get { return *(int*)(Ptr + 568); }
+        set { *(int*)(Ptr + 568) = value; }
     }
 
     /// <summary>
@@ -596,8 +820,8 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
     /// </summary>
     public unsafe int SteelA1SpecialCaseCounter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 572); }
+        get { return *(int*)(Ptr + 572); }
+        set { *(int*)(Ptr + 572) = value; }
     }
 
     /// <summary>
@@ -618,20 +842,12 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
         /// <summary>
         /// StructProperty: BarkToPlay
         /// </summary>
-        public unsafe BmSDK.BmGame.RBarkSet.FBarkDefinition BarkToPlay
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBarkSet.FBarkDefinition>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RBarkSet.FBarkDefinition BarkToPlay;
 
         /// <summary>
         /// IntProperty: Priority
         /// </summary>
-        public unsafe int Priority
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public int Priority;
 
         /// <summary>
         /// ObjectProperty: ContextFlags
@@ -645,11 +861,7 @@ public partial class RBMDialogueCoordinator : BmSDK.Engine.Actor, BmSDK.IGameObj
         /// <summary>
         /// IntProperty: CurrentSpeaker
         /// </summary>
-        public unsafe int CurrentSpeaker
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public int CurrentSpeaker;
     }
 
     /// <summary>
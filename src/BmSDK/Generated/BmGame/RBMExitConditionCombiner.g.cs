@@ -78,14 +78,20 @@ public partial class RBMExitConditionCombiner : BmSDK.BmGame.RBMExitCondition, B
         where TComponent : class, Framework.IScriptComponent<RBMExitConditionCombiner>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_TriggerExitConditionCombinerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerExitConditionCombiner_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerExitConditionCombiner
     /// </summary>
     public unsafe virtual void TriggerExitConditionCombiner()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMExitConditionCombiner.TriggerExitConditionCombiner", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerExitConditionCombinerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMExitConditionCombiner.TriggerExitConditionCombiner", true);
+        var parms = new TriggerExitConditionCombiner_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -94,8 +100,8 @@ public partial class RBMExitConditionCombiner : BmSDK.BmGame.RBMExitCondition, B
     /// </summary>
     public unsafe int NumExitConditions
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(int*)(Ptr + 264); }
+        set { *(int*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -103,8 +109,8 @@ public partial class RBMExitConditionCombiner : BmSDK.BmGame.RBMExitCondition, B
     /// </summary>
     public unsafe bool bAllMustBeActiveInSameFrame
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 268) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 268); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 268); }
+        get { return (*(int*)(Ptr + 268) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 268) |= 1; else *(int*)(Ptr + 268) &= ~1; }
     }
 
     /// <summary>
@@ -112,8 +118,8 @@ public partial class RBMExitConditionCombiner : BmSDK.BmGame.RBMExitCondition, B
     /// </summary>
     public unsafe bool bMustActivateInOrder
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 268) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 268); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 268); }
+        get { return (*(int*)(Ptr + 268) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 268) |= 2; else *(int*)(Ptr + 268) &= ~2; }
     }
 
     /// <summary>
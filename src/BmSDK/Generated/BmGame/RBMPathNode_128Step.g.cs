@@ -78,18 +78,28 @@ public partial class RBMPathNode_128Step : BmSDK.BmGame.RBMPathNode_VariablePosi
         where TComponent : class, Framework.IScriptComponent<RBMPathNode_128Step>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_Use128StepFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct Use128Step_Params
+    {
+        [FieldOffset(0)] public nint User;
+        [FieldOffset(4)] public int EdgeType;
+        [FieldOffset(8)] public System.Numerics.Vector3 JumpDirection;
+        [FieldOffset(20)] public System.Numerics.Vector3 JumpLocation;
+    }
+
     /// <summary>
     /// Function: Use128Step
     /// </summary>
     public unsafe virtual void Use128Step(BmSDK.BmGame.RBMPawnAI User, int EdgeType, System.Numerics.Vector3 JumpDirection, System.Numerics.Vector3 JumpLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_128Step.Use128Step", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(User, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EdgeType, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(JumpDirection, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(JumpLocation, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Use128StepFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_128Step.Use128Step", true);
+        var parms = new Use128Step_Params();
+        parms.User = User?.Ptr ?? 0;
+        parms.EdgeType = EdgeType;
+        parms.JumpDirection = JumpDirection;
+        parms.JumpLocation = JumpLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -98,8 +108,8 @@ public partial class RBMPathNode_128Step : BmSDK.BmGame.RBMPathNode_VariablePosi
     /// </summary>
     public unsafe System.IntPtr VfTable_IInterface_NavMeshPathObject
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 732); }
+        get { return *(System.IntPtr*)(Ptr + 732); }
+        set { *(System.IntPtr*)(Ptr + 732) = value; }
     }
 
     /// <summary>
@@ -107,8 +117,8 @@ public partial class RBMPathNode_128Step : BmSDK.BmGame.RBMPathNode_VariablePosi
     /// </summary>
     public unsafe float LastLockTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 736); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 736); }
+        get { return *(float*)(Ptr + 736); }
+        set { *(float*)(Ptr + 736) = value; }
     }
 
     /// <summary>
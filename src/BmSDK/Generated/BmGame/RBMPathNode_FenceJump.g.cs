@@ -78,17 +78,37 @@ public partial class RBMPathNode_FenceJump : BmSDK.BmGame.RBMPathNode_VariablePo
         where TComponent : class, Framework.IScriptComponent<RBMPathNode_FenceJump>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetEyePosForFenceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetEyePosForFence_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StandPoint;
+        [FieldOffset(12)] public System.Numerics.Vector3 FenceTopPoint;
+        [FieldOffset(24)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetEyePosForFence
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetEyePosForFence(System.Numerics.Vector3 StandPoint, System.Numerics.Vector3 FenceTopPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_FenceJump.GetEyePosForFence", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StandPoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FenceTopPoint, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 24);
+        var funcManaged = s_GetEyePosForFenceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_FenceJump.GetEyePosForFence", true);
+        var parms = new GetEyePosForFence_Params();
+        parms.StandPoint = StandPoint;
+        parms.FenceTopPoint = FenceTopPoint;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UseFenceJumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct UseFenceJump_Params
+    {
+        [FieldOffset(0)] public nint Handle;
+        [FieldOffset(4)] public nint User;
+        [FieldOffset(8)] public int EdgeType;
+        [FieldOffset(12)] public System.Numerics.Vector3 JumpDirection;
+        [FieldOffset(24)] public System.Numerics.Vector3 JumpLocation;
     }
 
     /// <summary>
@@ -96,14 +116,14 @@ public partial class RBMPathNode_FenceJump : BmSDK.BmGame.RBMPathNode_VariablePo
     /// </summary>
     public unsafe virtual void UseFenceJump(BmSDK.Engine.NavigationHandle Handle, BmSDK.BmGame.RBMPawnAI User, int EdgeType, System.Numerics.Vector3 JumpDirection, System.Numerics.Vector3 JumpLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_FenceJump.UseFenceJump", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Handle, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(User, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EdgeType, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(JumpDirection, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(JumpLocation, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UseFenceJumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_FenceJump.UseFenceJump", true);
+        var parms = new UseFenceJump_Params();
+        parms.Handle = Handle?.Ptr ?? 0;
+        parms.User = User?.Ptr ?? 0;
+        parms.EdgeType = EdgeType;
+        parms.JumpDirection = JumpDirection;
+        parms.JumpLocation = JumpLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -112,8 +132,8 @@ public partial class RBMPathNode_FenceJump : BmSDK.BmGame.RBMPathNode_VariablePo
     /// </summary>
     public unsafe System.IntPtr VfTable_IInterface_NavMeshPathObject
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 732); }
+        get { return *(System.IntPtr*)(Ptr + 732); }
+        set { *(System.IntPtr*)(Ptr + 732) = value; }
     }
 
     /// <summary>
@@ -121,8 +141,8 @@ public partial class RBMPathNode_FenceJump : BmSDK.BmGame.RBMPathNode_VariablePo
     /// </summary>
     public unsafe float LastLockTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 736); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 736); }
+        get { return *(float*)(Ptr + 736); }
+        set { *(float*)(Ptr + 736) = value; }
     }
 
     /// <summary>
@@ -130,8 +150,8 @@ public partial class RBMPathNode_FenceJump : BmSDK.BmGame.RBMPathNode_VariablePo
     /// </summary>
     public unsafe bool bPeekOnly
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 740) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 740); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 740); }
+        get { return (*(int*)(Ptr + 740) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 740) |= 1; else *(int*)(Ptr + 740) &= ~1; }
     }
 
     /// <summary>
@@ -139,7 +159,7 @@ public partial class RBMPathNode_FenceJump : BmSDK.BmGame.RBMPathNode_VariablePo
     /// </summary>
     public unsafe bool bAutoAdjustEndPoints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 740) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 740); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 740); }
+        get { return (*(int*)(Ptr + 740) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 740) |= 2; else *(int*)(Ptr + 740) &= ~2; }
     }
 }
@@ -73,30 +73,47 @@ public partial class RBMPathNode_SpecialMove : BmSDK.BmGame.RPathNode, BmSDK.IGa
         where TComponent : class, Framework.IScriptComponent<RBMPathNode_SpecialMove>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UnlockSlotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnlockSlot_Params
+    {
+        [FieldOffset(0)] public nint User;
+    }
+
     /// <summary>
     /// Function: UnlockSlot
     /// </summary>
     public unsafe virtual void UnlockSlot(BmSDK.BmGame.RPawn User)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_SpecialMove.UnlockSlot", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(User, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockSlotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_SpecialMove.UnlockSlot", true);
+        var parms = new UnlockSlot_Params();
+        parms.User = User?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetDynamicMoveSlotForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetDynamicMoveSlotFor_Params
+    {
+        [FieldOffset(0)] public nint User;
+        [FieldOffset(4)] public System.Numerics.Vector3 DestPoint;
+        [FieldOffset(16)] public System.Numerics.Vector3 SlotLocation;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetDynamicMoveSlotFor
     /// </summary>
     public unsafe virtual bool GetDynamicMoveSlotFor(BmSDK.BmGame.RPawn User, System.Numerics.Vector3 DestPoint, out System.Numerics.Vector3 SlotLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_SpecialMove.GetDynamicMoveSlotFor", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(User, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DestPoint, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        SlotLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_GetDynamicMoveSlotForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMPathNode_SpecialMove.GetDynamicMoveSlotFor", true);
+        var parms = new GetDynamicMoveSlotFor_Params();
+        parms.User = User?.Ptr ?? 0;
+        parms.DestPoint = DestPoint;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        SlotLocation = parms.SlotLocation;
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -104,8 +121,8 @@ public partial class RBMPathNode_SpecialMove : BmSDK.BmGame.RPathNode, BmSDK.IGa
     /// </summary>
     public unsafe int NodesInSpecialMove
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 668); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 668); }
+        get { return *(int*)(Ptr + 668); }
+        set { *(int*)(Ptr + 668) = value; }
     }
 
     /// <summary>
@@ -78,30 +78,47 @@ public partial class RBMWeapon_SmashedSegment : BmSDK.Engine.KActorSpawnable, Bm
         where TComponent : class, Framework.IScriptComponent<RBMWeapon_SmashedSegment>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetSegmentMeshFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct SetSegmentMesh_Params
+    {
+        [FieldOffset(0)] public nint NewMesh;
+        [FieldOffset(4)] public System.Numerics.Vector3 Vel;
+        [FieldOffset(16)] public System.Numerics.Vector3 AngVel;
+        [FieldOffset(28)] public System.Numerics.Vector3 NewLocation;
+        [FieldOffset(40)] public BmSDK.Rotator NewRotation;
+    }
+
     /// <summary>
     /// Function: SetSegmentMesh
     /// </summary>
     public unsafe virtual void SetSegmentMesh(BmSDK.Engine.StaticMesh NewMesh, System.Numerics.Vector3 Vel, System.Numerics.Vector3 AngVel, System.Numerics.Vector3 NewLocation, BmSDK.Rotator NewRotation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMWeapon_SmashedSegment.SetSegmentMesh", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMesh, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Vel, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AngVel, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLocation, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewRotation, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSegmentMeshFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMWeapon_SmashedSegment.SetSegmentMesh", true);
+        var parms = new SetSegmentMesh_Params();
+        parms.NewMesh = NewMesh?.Ptr ?? 0;
+        parms.Vel = Vel;
+        parms.AngVel = AngVel;
+        parms.NewLocation = NewLocation;
+        parms.NewRotation = NewRotation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyCheckFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DestroyCheck_Params
+    {
+    }
+
     /// <summary>
     /// Function: DestroyCheck
     /// </summary>
     public unsafe virtual void DestroyCheck()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMWeapon_SmashedSegment.DestroyCheck", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyCheckFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBMWeapon_SmashedSegment.DestroyCheck", true);
+        var parms = new DestroyCheck_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -83,8 +83,8 @@ public partial class RBarkSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool LoadedBanks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1; else *(int*)(Ptr + 44) &= ~1; }
     }
 
     /// <summary>
@@ -105,11 +105,7 @@ public partial class RBarkSet : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: voicetype
         /// </summary>
-        public unsafe BmSDK.FName voicetype
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName voicetype;
 
         /// <summary>
         /// ArrayProperty: Bark
@@ -130,11 +126,7 @@ public partial class RBarkSet : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: BarkType
         /// </summary>
-        public unsafe BmSDK.BmGame.RBarkSet.EConvoBarkType BarkType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBarkSet.EConvoBarkType>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RBarkSet.EConvoBarkType BarkType;
 
         /// <summary>
         /// ObjectProperty: FlagBase
@@ -148,20 +140,12 @@ public partial class RBarkSet : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: ChapterFlag
         /// </summary>
-        public unsafe int ChapterFlag
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int ChapterFlag;
 
         /// <summary>
         /// FloatProperty: Weighting
         /// </summary>
-        public unsafe float Weighting
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float Weighting;
 
         /// <summary>
         /// ObjectProperty: DialogueLine
@@ -78,17 +78,26 @@ public partial class RBmBatmanCutscene : BmSDK.BmGame.RBMCutsceneBase, BmSDK.IGa
         where TComponent : class, Framework.IScriptComponent<RBmBatmanCutscene>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_InitialiseBatmanCutsceneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct InitialiseBatmanCutscene_Params
+    {
+        [FieldOffset(0)] public nint NewCutsceneOwner;
+        [FieldOffset(4)] public nint NewCutsceneTarget;
+        [FieldOffset(8)] public BmSDK.BmGame.RBmBatmanCutscene.BatmanCutsceneType Type;
+    }
+
     /// <summary>
     /// Function: InitialiseBatmanCutscene
     /// </summary>
     public unsafe virtual void InitialiseBatmanCutscene(BmSDK.BmGame.RPlayerController NewCutsceneOwner, BmSDK.BmGame.RPawn NewCutsceneTarget, BmSDK.BmGame.RBmBatmanCutscene.BatmanCutsceneType Type)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBmBatmanCutscene.InitialiseBatmanCutscene", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCutsceneOwner, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCutsceneTarget, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseBatmanCutsceneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBmBatmanCutscene.InitialiseBatmanCutscene", true);
+        var parms = new InitialiseBatmanCutscene_Params();
+        parms.NewCutsceneOwner = NewCutsceneOwner?.Ptr ?? 0;
+        parms.NewCutsceneTarget = NewCutsceneTarget?.Ptr ?? 0;
+        parms.Type = Type;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -97,8 +106,8 @@ public partial class RBmBatmanCutscene : BmSDK.BmGame.RBMCutsceneBase, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.BmGame.RBmBatmanCutscene.BatmanCutsceneType CutsceneType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBmBatmanCutscene.BatmanCutsceneType>(Ptr + 888); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 888); }
+        get { return *(BmSDK.BmGame.RBmBatmanCutscene.BatmanCutsceneType*)(Ptr + 888); }
+        set { *(BmSDK.BmGame.RBmBatmanCutscene.BatmanCutsceneType*)(Ptr + 888) = value; }
     }
 
     /// <summary>
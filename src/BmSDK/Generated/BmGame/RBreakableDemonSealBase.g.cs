@@ -78,15 +78,29 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
         where TComponent : class, Framework.IScriptComponent<RBreakableDemonSealBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UseSecretLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UseSecretLocation_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: UseSecretLocation
     /// </summary>
     public unsafe virtual bool UseSecretLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.UseSecretLocation", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_UseSecretLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.UseSecretLocation", true);
+        var parms = new UseSecretLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetSecretLocationYFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSecretLocationY_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -94,10 +108,17 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe virtual int GetSecretLocationY()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretLocationY", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetSecretLocationYFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretLocationY", true);
+        var parms = new GetSecretLocationY_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetSecretLocationXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSecretLocationX_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -105,10 +126,17 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe virtual int GetSecretLocationX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretLocationX", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetSecretLocationXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretLocationX", true);
+        var parms = new GetSecretLocationX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetSecretZoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct GetSecretZone_Params
+    {
+        [FieldOffset(0)] public byte ReturnValue;
     }
 
     /// <summary>
@@ -116,10 +144,17 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe virtual byte GetSecretZone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretZone", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<byte>(paramsPtr + 0);
+        var funcManaged = s_GetSecretZoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretZone", true);
+        var parms = new GetSecretZone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetSecretPickupIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSecretPickupIndex_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -127,10 +162,17 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe virtual int GetSecretPickupIndex()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretPickupIndex", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetSecretPickupIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretPickupIndex", true);
+        var parms = new GetSecretPickupIndex_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetSecretSubTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetSecretSubType_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -138,10 +180,17 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe virtual BmSDK.FString GetSecretSubType()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretSubType", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetSecretSubTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretSubType", true);
+        var parms = new GetSecretSubType_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetSecretNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetSecretName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -149,10 +198,17 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe virtual BmSDK.FString GetSecretName()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretName", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetSecretNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.GetSecretName", true);
+        var parms = new GetSecretName_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsValidSecretFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsValidSecret_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -160,10 +216,10 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe virtual bool IsValidSecret()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.IsValidSecret", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsValidSecretFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableDemonSealBase.IsValidSecret", true);
+        var parms = new IsValidSecret_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -171,8 +227,8 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe System.IntPtr VfTable_IRSecretInterface
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(System.IntPtr*)(Ptr + 468); }
+        set { *(System.IntPtr*)(Ptr + 468) = value; }
     }
 
     /// <summary>
@@ -180,8 +236,8 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe int SecretIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(int*)(Ptr + 472); }
+        set { *(int*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -189,8 +245,8 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.ERiddlerLocationName>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(BmSDK.BmGame.RPersistentData.ERiddlerLocationName*)(Ptr + 476); }
+        set { *(BmSDK.BmGame.RPersistentData.ERiddlerLocationName*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -198,8 +254,8 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe int SecretX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(int*)(Ptr + 480); }
+        set { *(int*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -207,8 +263,8 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe int SecretY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(int*)(Ptr + 484); }
+        set { *(int*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -216,7 +272,7 @@ public partial class RBreakableDemonSealBase : BmSDK.BmGame.RHarpoonTriggerBase,
     /// </summary>
     public unsafe bool bUseSecretLocation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 1; else *(int*)(Ptr + 488) &= ~1; }
     }
 }
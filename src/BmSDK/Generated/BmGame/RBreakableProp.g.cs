@@ -78,123 +78,203 @@ public partial class RBreakableProp : BmSDK.BmGame.RBreakablePropStatic, BmSDK.I
         where TComponent : class, Framework.IScriptComponent<RBreakableProp>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Init_Params
+    {
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.Init", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.Init", true);
+        var parms = new Init_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitCollideDamageScaleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitCollideDamageScale_Params
+    {
+        [FieldOffset(0)] public float DamageScale;
+    }
+
     /// <summary>
     /// Function: InitCollideDamageScale
     /// </summary>
     public unsafe override void InitCollideDamageScale(float DamageScale)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.InitCollideDamageScale", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageScale, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitCollideDamageScaleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.InitCollideDamageScale", true);
+        var parms = new InitCollideDamageScale_Params();
+        parms.DamageScale = DamageScale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct Bump_Params
+    {
+        [FieldOffset(0)] public nint Other;
+        [FieldOffset(4)] public nint OtherComp;
+        [FieldOffset(8)] public System.Numerics.Vector3 HitNormal;
+    }
+
     /// <summary>
     /// Function: Bump
     /// </summary>
     public unsafe override void Bump(BmSDK.Engine.Actor Other, BmSDK.Engine.PrimitiveComponent OtherComp, System.Numerics.Vector3 HitNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.Bump", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Other, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.Bump", true);
+        var parms = new Bump_Params();
+        parms.Other = Other?.Ptr ?? 0;
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        parms.HitNormal = HitNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RigidBodyCollisionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct RigidBodyCollision_Params
+    {
+        [FieldOffset(0)] public nint HitComponent;
+        [FieldOffset(4)] public nint OtherComponent;
+        [FieldOffset(8)] public BmSDK.Engine.Actor.FCollisionImpactData RigidCollisionData;
+        [FieldOffset(44)] public int ContactIndex;
+        [FieldOffset(48)] public float Speed;
+        [FieldOffset(52)] public int Index0;
+        [FieldOffset(56)] public int Index1;
+    }
+
     /// <summary>
     /// Function: RigidBodyCollision
     /// </summary>
     public unsafe override void RigidBodyCollision(BmSDK.Engine.PrimitiveComponent HitComponent, BmSDK.Engine.PrimitiveComponent OtherComponent, out BmSDK.Engine.Actor.FCollisionImpactData RigidCollisionData, int ContactIndex, float Speed, int Index0, int Index1)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.RigidBodyCollision", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitComponent, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComponent, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ContactIndex, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index0, paramsPtr + 52);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index1, paramsPtr + 56);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        RigidCollisionData = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.FCollisionImpactData>(paramsPtr + 8);
+        var funcManaged = s_RigidBodyCollisionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.RigidBodyCollision", true);
+        var parms = new RigidBodyCollision_Params();
+        parms.HitComponent = HitComponent?.Ptr ?? 0;
+        parms.OtherComponent = OtherComponent?.Ptr ?? 0;
+        parms.ContactIndex = ContactIndex;
+        parms.Speed = Speed;
+        parms.Index0 = Index0;
+        parms.Index1 = Index1;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        RigidCollisionData = parms.RigidCollisionData;
         return;
     }
 
+    static BmSDK.Function s_DoImpactDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct DoImpactDamage_Params
+    {
+        [FieldOffset(0)] public nint HitActor;
+        [FieldOffset(4)] public float HitVelocity;
+        [FieldOffset(8)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(20)] public System.Numerics.Vector3 HitNormal;
+    }
+
     /// <summary>
     /// Function: DoImpactDamage
     /// </summary>
     public unsafe virtual void DoImpactDamage(BmSDK.Engine.Actor HitActor, float HitVelocity, System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 HitNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.DoImpactDamage", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitVelocity, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoImpactDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.DoImpactDamage", true);
+        var parms = new DoImpactDamage_Params();
+        parms.HitActor = HitActor?.Ptr ?? 0;
+        parms.HitVelocity = HitVelocity;
+        parms.HitLocation = HitLocation;
+        parms.HitNormal = HitNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TakeRadiusDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct TakeRadiusDamage_Params
+    {
+        [FieldOffset(0)] public nint InstigatedBy;
+        [FieldOffset(4)] public float BaseDamage;
+        [FieldOffset(8)] public float DamageRadius;
+        [FieldOffset(12)] public nint DamageType;
+        [FieldOffset(16)] public float Momentum;
+        [FieldOffset(20)] public System.Numerics.Vector3 HurtOrigin;
+        [FieldOffset(32)] public int bFullDamage;
+        [FieldOffset(36)] public nint DamageCauser;
+        [FieldOffset(40)] public float DamageFalloffExponent;
+    }
+
     /// <summary>
     /// Function: TakeRadiusDamage
     /// </summary>
     public unsafe override void TakeRadiusDamage(BmSDK.Engine.Controller InstigatedBy, float BaseDamage, float DamageRadius, BmSDK.Class DamageType, float Momentum, System.Numerics.Vector3 HurtOrigin, bool bFullDamage, BmSDK.Engine.Actor DamageCauser, float DamageFalloffExponent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.TakeRadiusDamage", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InstigatedBy, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BaseDamage, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageRadius, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Momentum, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HurtOrigin, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFullDamage, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageCauser, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageFalloffExponent, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TakeRadiusDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.TakeRadiusDamage", true);
+        var parms = new TakeRadiusDamage_Params();
+        parms.InstigatedBy = InstigatedBy?.Ptr ?? 0;
+        parms.BaseDamage = BaseDamage;
+        parms.DamageRadius = DamageRadius;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        parms.Momentum = Momentum;
+        parms.HurtOrigin = HurtOrigin;
+        parms.bFullDamage = bFullDamage ? 1 : 0;
+        parms.DamageCauser = DamageCauser?.Ptr ?? 0;
+        parms.DamageFalloffExponent = DamageFalloffExponent;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TakeDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct TakeDamage_Params
+    {
+        [FieldOffset(0)] public int Damage;
+        [FieldOffset(4)] public nint EventInstigator;
+        [FieldOffset(8)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(20)] public System.Numerics.Vector3 Momentum;
+        [FieldOffset(32)] public nint DamageType;
+        [FieldOffset(36)] public BmSDK.Engine.Actor.FTraceHitInfo HitInfo;
+        [FieldOffset(72)] public nint DamageCauser;
+    }
+
     /// <summary>
     /// Function: TakeDamage
     /// </summary>
     public unsafe override void TakeDamage(int Damage, BmSDK.Engine.Controller EventInstigator, System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 Momentum, BmSDK.Class DamageType, BmSDK.Engine.Actor.FTraceHitInfo HitInfo = default, BmSDK.Engine.Actor DamageCauser = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.TakeDamage", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Damage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventInstigator, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Momentum, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitInfo, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageCauser, paramsPtr + 72);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TakeDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.TakeDamage", true);
+        var parms = new TakeDamage_Params();
+        parms.Damage = Damage;
+        parms.EventInstigator = EventInstigator?.Ptr ?? 0;
+        parms.HitLocation = HitLocation;
+        parms.Momentum = Momentum;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        parms.HitInfo = HitInfo;
+        parms.DamageCauser = DamageCauser?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetToDamageStageMeshFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetToDamageStageMesh_Params
+    {
+        [FieldOffset(0)] public int stage;
+    }
+
     /// <summary>
     /// Function: SetToDamageStageMesh
     /// </summary>
     public unsafe override void SetToDamageStageMesh(int stage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.SetToDamageStageMesh", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(stage, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetToDamageStageMeshFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RBreakableProp.SetToDamageStageMesh", true);
+        var parms = new SetToDamageStageMesh_Params();
+        parms.stage = stage;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -203,7 +283,7 @@ public partial class RBreakableProp : BmSDK.BmGame.RBreakablePropStatic, BmSDK.I
     /// </summary>
     public unsafe float CollideDamageScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 748); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 748); }
+        get { return *(float*)(Ptr + 748); }
+        set { *(float*)(Ptr + 748) = value; }
     }
 }
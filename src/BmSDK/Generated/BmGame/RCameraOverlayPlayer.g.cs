@@ -78,51 +78,77 @@ public partial class RCameraOverlayPlayer : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RCameraOverlayPlayer>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_StopAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct StopAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName LayerName;
+        [FieldOffset(8)] public float BlendOutTime;
+    }
+
     /// <summary>
     /// Function: StopAnim
     /// </summary>
     public unsafe virtual void StopAnim(BmSDK.FName LayerName, float BlendOutTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCameraOverlayPlayer.StopAnim", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LayerName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendOutTime, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_StopAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCameraOverlayPlayer.StopAnim", true);
+        var parms = new StopAnim_Params();
+        parms.LayerName = LayerName;
+        parms.BlendOutTime = BlendOutTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NativePlayAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct NativePlayAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName AnimName;
+        [FieldOffset(8)] public int bNewMirrored;
+        [FieldOffset(12)] public int bNewLooping;
+        [FieldOffset(16)] public nint NewCustomAnimSet;
+        [FieldOffset(20)] public BmSDK.FName LayerName;
+        [FieldOffset(28)] public float Weight;
+        [FieldOffset(32)] public float LinkSpeed;
+        [FieldOffset(36)] public float ZeroFrame;
+        [FieldOffset(40)] public int IgnoreX;
+        [FieldOffset(44)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: NativePlayAnim
     /// </summary>
     public unsafe virtual bool NativePlayAnim(BmSDK.FName AnimName, bool bNewMirrored, bool bNewLooping, BmSDK.Engine.AnimSet NewCustomAnimSet, BmSDK.FName LayerName, float Weight, float LinkSpeed, float ZeroFrame, bool IgnoreX)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCameraOverlayPlayer.NativePlayAnim", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewMirrored, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewLooping, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCustomAnimSet, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LayerName, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Weight, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LinkSpeed, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ZeroFrame, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IgnoreX, paramsPtr + 40);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 44);
+        var funcManaged = s_NativePlayAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCameraOverlayPlayer.NativePlayAnim", true);
+        var parms = new NativePlayAnim_Params();
+        parms.AnimName = AnimName;
+        parms.bNewMirrored = bNewMirrored ? 1 : 0;
+        parms.bNewLooping = bNewLooping ? 1 : 0;
+        parms.NewCustomAnimSet = NewCustomAnimSet?.Ptr ?? 0;
+        parms.LayerName = LayerName;
+        parms.Weight = Weight;
+        parms.LinkSpeed = LinkSpeed;
+        parms.ZeroFrame = ZeroFrame;
+        parms.IgnoreX = IgnoreX ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct PlayAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName AnimName;
+        [FieldOffset(8)] public BmSDK.FName LayerName;
+        [FieldOffset(16)] public int bNewMirrored;
+        [FieldOffset(20)] public int bNewLooping;
+        [FieldOffset(24)] public nint NewCustomAnimSet;
+        [FieldOffset(28)] public float Weight;
+        [FieldOffset(32)] public float LinkSpeed;
+        [FieldOffset(36)] public float ZeroFrame;
+        [FieldOffset(40)] public int IgnoreX;
+        [FieldOffset(44)] public int ReturnValue;
     }
 
     /// <summary>
@@ -130,19 +156,19 @@ public partial class RCameraOverlayPlayer : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool PlayAnim(BmSDK.FName AnimName, BmSDK.FName LayerName, bool bNewMirrored = default, bool bNewLooping = default, BmSDK.Engine.AnimSet NewCustomAnimSet = default, float Weight = default, float LinkSpeed = default, float ZeroFrame = default, bool IgnoreX = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCameraOverlayPlayer.PlayAnim", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LayerName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewMirrored, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewLooping, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCustomAnimSet, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Weight, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LinkSpeed, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ZeroFrame, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IgnoreX, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 44);
+        var funcManaged = s_PlayAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCameraOverlayPlayer.PlayAnim", true);
+        var parms = new PlayAnim_Params();
+        parms.AnimName = AnimName;
+        parms.LayerName = LayerName;
+        parms.bNewMirrored = bNewMirrored ? 1 : 0;
+        parms.bNewLooping = bNewLooping ? 1 : 0;
+        parms.NewCustomAnimSet = NewCustomAnimSet?.Ptr ?? 0;
+        parms.Weight = Weight;
+        parms.LinkSpeed = LinkSpeed;
+        parms.ZeroFrame = ZeroFrame;
+        parms.IgnoreX = IgnoreX ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -178,23 +204,18 @@ public partial class RCameraOverlayPlayer : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 124)]
     public partial record struct FCameraOverlayLayer
     {
+        [FieldOffset(20)] private int _bitfield20;
+        [FieldOffset(32)] private int _bitfield32;
+
         /// <summary>
         /// NameProperty: LayerName
         /// </summary>
-        public unsafe BmSDK.FName LayerName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName LayerName;
 
         /// <summary>
         /// NameProperty: AnimSequence
         /// </summary>
-        public unsafe BmSDK.FName AnimSequence
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName AnimSequence;
 
         /// <summary>
         /// ObjectProperty: CustomAnimSet
@@ -208,74 +229,58 @@ public partial class RCameraOverlayPlayer : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: bActive
         /// </summary>
-        public unsafe bool bActive
+        public bool bActive
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 1) != 0;
+            set { if (value) _bitfield20 |= 1; else _bitfield20 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bIgnoreXTranslation
         /// </summary>
-        public unsafe bool bIgnoreXTranslation
+        public bool bIgnoreXTranslation
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 2) != 0;
+            set { if (value) _bitfield20 |= 2; else _bitfield20 &= ~2; }
         }
 
         /// <summary>
         /// FloatProperty: AnimStrength
         /// </summary>
-        public unsafe float AnimStrength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float AnimStrength;
 
         /// <summary>
         /// FloatProperty: AnimStrengthFactor
         /// </summary>
-        public unsafe float AnimStrengthFactor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float AnimStrengthFactor;
 
         /// <summary>
         /// BoolProperty: bLooping
         /// </summary>
-        public unsafe bool bLooping
+        public bool bLooping
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 1) != 0;
+            set { if (value) _bitfield32 |= 1; else _bitfield32 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bMirrored
         /// </summary>
-        public unsafe bool bMirrored
+        public bool bMirrored
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 2) != 0;
+            set { if (value) _bitfield32 |= 2; else _bitfield32 &= ~2; }
         }
 
         /// <summary>
         /// FloatProperty: PlaybackSpeed
         /// </summary>
-        public unsafe float PlaybackSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float PlaybackSpeed;
 
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float Time;
 
         /// <summary>
         /// ObjectProperty: FoundAnim
@@ -289,37 +294,21 @@ public partial class RCameraOverlayPlayer : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: ZeroAtom
         /// </summary>
-        public unsafe BmSDK.GameObject.FMatrix ZeroAtom
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMatrix>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public BmSDK.GameObject.FMatrix ZeroAtom;
 
         /// <summary>
         /// FloatProperty: LinkToSpeed
         /// </summary>
-        public unsafe float LinkToSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }; }
-        }
+        [FieldOffset(112)] public float LinkToSpeed;
 
         /// <summary>
         /// FloatProperty: BlendOutTime
         /// </summary>
-        public unsafe float BlendOutTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 116); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }; }
-        }
+        [FieldOffset(116)] public float BlendOutTime;
 
         /// <summary>
         /// FloatProperty: BlendTime
         /// </summary>
-        public unsafe float BlendTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }; }
-        }
+        [FieldOffset(120)] public float BlendTime;
     }
 }
@@ -83,8 +83,8 @@ public partial class RCapeCollisionShapeConfig : BmSDK.GameObject, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.FName AttachBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RCapeCollisionShapeConfig : BmSDK.GameObject, BmSDK.IGameOb
     /// </summary>
     public unsafe bool IsLockVertical
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1; else *(int*)(Ptr + 52) &= ~1; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RCapeCollisionShapeConfig : BmSDK.GameObject, BmSDK.IGameOb
     /// </summary>
     public unsafe bool IsLockForwardsVectorHoriz
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 2; else *(int*)(Ptr + 52) &= ~2; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RCapeCollisionShapeConfig : BmSDK.GameObject, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.BmGame.RCapeCollisionShapeConfig.ECollisionShape ShapeType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeCollisionShapeConfig.ECollisionShape>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.BmGame.RCapeCollisionShapeConfig.ECollisionShape*)(Ptr + 56); }
+        set { *(BmSDK.BmGame.RCapeCollisionShapeConfig.ECollisionShape*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -152,8 +152,8 @@ public partial class RCapeCollisionShapeConfig : BmSDK.GameObject, BmSDK.IGameOb
     /// </summary>
     public unsafe float Length1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CapeDataVersionNumber
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumChainsInCape
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(int*)(Ptr + 48); }
+        set { *(int*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinAutoPauseTimeStep
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName DefaultCapeStateName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.FName*)(Ptr + 92); }
+        set { *(BmSDK.FName*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName CinematicCapeStateName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(BmSDK.FName*)(Ptr + 100); }
+        set { *(BmSDK.FName*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CapeChainWidth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(float*)(Ptr + 112); }
+        set { *(float*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -254,8 +254,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DefaultCapeBoneOverstretchLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(float*)(Ptr + 224); }
+        set { *(float*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -269,8 +269,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsUseManualDamping
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 240); }
+        get { return (*(int*)(Ptr + 240) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 240) |= 1; else *(int*)(Ptr + 240) &= ~1; }
     }
 
     /// <summary>
@@ -278,8 +278,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsUseHorizontalParentRelativeDamping
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 240); }
+        get { return (*(int*)(Ptr + 240) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 240) |= 2; else *(int*)(Ptr + 240) &= ~2; }
     }
 
     /// <summary>
@@ -287,8 +287,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsUseVerticalParentRelativeDamping
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 240); }
+        get { return (*(int*)(Ptr + 240) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 240) |= 4; else *(int*)(Ptr + 240) &= ~4; }
     }
 
     /// <summary>
@@ -296,8 +296,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float HorizontalDamping
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(float*)(Ptr + 244); }
+        set { *(float*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -305,8 +305,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float VerticalDamping
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(float*)(Ptr + 248); }
+        set { *(float*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -314,8 +314,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float InterChainSpringStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(float*)(Ptr + 252); }
+        set { *(float*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -323,8 +323,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float InterChainSpringStrengthIncreaseRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(float*)(Ptr + 256); }
+        set { *(float*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -332,8 +332,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinHandleDeepCapeIntersectionVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(float*)(Ptr + 260); }
+        set { *(float*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -341,8 +341,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float HandleDeepCapeIntersectionStopDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -350,8 +350,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float SupportConstraintLengthRatio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -371,8 +371,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxForwardWindComponent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -380,8 +380,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumAffectedBonesPerChain
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(int*)(Ptr + 300); }
+        set { *(int*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -389,8 +389,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float WindForceDropoffProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(float*)(Ptr + 304); }
+        set { *(float*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -398,8 +398,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int WindForceDropoffPower
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(int*)(Ptr + 308); }
+        set { *(int*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -407,8 +407,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float WindFlutterForceMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(float*)(Ptr + 312); }
+        set { *(float*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -416,8 +416,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float WindForceMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(float*)(Ptr + 316); }
+        set { *(float*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -425,8 +425,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName ParentAttachBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(BmSDK.FName*)(Ptr + 320); }
+        set { *(BmSDK.FName*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -434,8 +434,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName CapeAnimNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(BmSDK.FName*)(Ptr + 328); }
+        set { *(BmSDK.FName*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -452,8 +452,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName DefaultAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -461,8 +461,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName BoneNameReadFormatString
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(BmSDK.FName*)(Ptr + 356); }
+        set { *(BmSDK.FName*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -470,8 +470,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName BoneNameWriteFormatString
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(BmSDK.FName*)(Ptr + 364); }
+        set { *(BmSDK.FName*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -479,8 +479,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ChainIndexingOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(int*)(Ptr + 372); }
+        set { *(int*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -488,8 +488,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int LinkIndexingOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(int*)(Ptr + 376); }
+        set { *(int*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -506,8 +506,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float BackwardsDepthBias
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(float*)(Ptr + 392); }
+        set { *(float*)(Ptr + 392) = value; }
     }
 
     /// <summary>
@@ -515,8 +515,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ForwardsDepthBias
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(float*)(Ptr + 396); }
+        set { *(float*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -524,8 +524,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float InterpStartAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }
+        get { return *(float*)(Ptr + 400); }
+        set { *(float*)(Ptr + 400) = value; }
     }
 
     /// <summary>
@@ -533,8 +533,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float InterpEndAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(float*)(Ptr + 404); }
+        set { *(float*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -542,8 +542,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CapeGlideToggleMaxChangePerSec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(float*)(Ptr + 408); }
+        set { *(float*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -551,8 +551,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CapeStateMaterialConstantMaxChangePerSec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(float*)(Ptr + 412); }
+        set { *(float*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -560,8 +560,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CapeRainToggleMaxChangePerSec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(float*)(Ptr + 416); }
+        set { *(float*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -569,8 +569,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName CapeRainToggleMaterialConstantName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(BmSDK.FName*)(Ptr + 420); }
+        set { *(BmSDK.FName*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -578,8 +578,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName CapeSpeedToggleMaterialConstantName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(BmSDK.FName*)(Ptr + 428); }
+        set { *(BmSDK.FName*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -587,8 +587,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinDepthBiasTestDistanceFromCameraPlane
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -596,8 +596,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CinematicMinDepthBiasTestDistanceFromCameraPlane
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(float*)(Ptr + 440); }
+        set { *(float*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -605,8 +605,8 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float HeadDepthBiasMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(float*)(Ptr + 444); }
+        set { *(float*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -618,47 +618,27 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Chain1Index
         /// </summary>
-        public unsafe int Chain1Index
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int Chain1Index;
 
         /// <summary>
         /// IntProperty: Link1Index
         /// </summary>
-        public unsafe int Link1Index
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int Link1Index;
 
         /// <summary>
         /// IntProperty: Chain2Index
         /// </summary>
-        public unsafe int Chain2Index
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int Chain2Index;
 
         /// <summary>
         /// IntProperty: Link2Index
         /// </summary>
-        public unsafe int Link2Index
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int Link2Index;
 
         /// <summary>
         /// FloatProperty: MinLength
         /// </summary>
-        public unsafe float MinLength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float MinLength;
     }
 
     /// <summary>
@@ -670,20 +650,12 @@ public partial class RCapeConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: ConnectionIndex1
         /// </summary>
-        public unsafe int ConnectionIndex1
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int ConnectionIndex1;
 
         /// <summary>
         /// IntProperty: ConnectionIndex2
         /// </summary>
-        public unsafe int ConnectionIndex2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int ConnectionIndex2;
     }
 
     /// <summary>
@@ -78,21 +78,20 @@ public partial class RCapeRenderingComponent : BmSDK.Engine.ActorComponent, BmSD
         where TComponent : class, Framework.IScriptComponent<RCapeRenderingComponent>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HandleDebugLineDrawingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HandleDebugLineDrawing_Params
+    {
+    }
+
     /// <summary>
     /// Function: HandleDebugLineDrawing
     /// </summary>
     public unsafe virtual void HandleDebugLineDrawing()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeRenderingComponent.HandleDebugLineDrawing", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_HandleDebugLineDrawingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeRenderingComponent.HandleDebugLineDrawing", true);
+        var parms = new HandleDebugLineDrawing_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -101,8 +100,8 @@ public partial class RCapeRenderingComponent : BmSDK.Engine.ActorComponent, BmSD
     /// </summary>
     public unsafe bool IsRenderCape
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }
+        get { return (*(int*)(Ptr + 72) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 72) |= 1; else *(int*)(Ptr + 72) &= ~1; }
     }
 
     /// <summary>
@@ -110,8 +109,8 @@ public partial class RCapeRenderingComponent : BmSDK.Engine.ActorComponent, BmSD
     /// </summary>
     public unsafe int DebugRenderBoneChainIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(int*)(Ptr + 76); }
+        set { *(int*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -119,8 +118,8 @@ public partial class RCapeRenderingComponent : BmSDK.Engine.ActorComponent, BmSD
     /// </summary>
     public unsafe int DebugRenderBoneLinkIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(int*)(Ptr + 80); }
+        set { *(int*)(Ptr + 80) = value; }
     }
 
     /// <summary>
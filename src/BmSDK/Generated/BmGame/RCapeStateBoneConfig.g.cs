@@ -102,23 +102,19 @@ public partial class RCapeStateBoneConfig : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 92)]
     public partial record struct FCapeStateDataIndicator
     {
+        [FieldOffset(24)] private int _bitfield24;
+        [FieldOffset(36)] private int _bitfield36;
+        [FieldOffset(64)] private int _bitfield64;
+
         /// <summary>
         /// IntProperty: ChainIndex
         /// </summary>
-        public unsafe int ChainIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int ChainIndex;
 
         /// <summary>
         /// IntProperty: BoneIndex
         /// </summary>
-        public unsafe int BoneIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int BoneIndex;
 
         /// <summary>
         /// ArrayProperty: ParentSkinningBoneDatas
@@ -132,146 +128,106 @@ public partial class RCapeStateBoneConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: StateEffectType
         /// </summary>
-        public unsafe BmSDK.BmGame.RCapeStateBoneConfig.EStateEffectType StateEffectType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateBoneConfig.EStateEffectType>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.BmGame.RCapeStateBoneConfig.EStateEffectType StateEffectType;
 
         /// <summary>
         /// ByteProperty: BoneState
         /// </summary>
-        public unsafe BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState BoneState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState>(Ptr + 21); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 21); }; }
-        }
+        [FieldOffset(21)] public BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState BoneState;
 
         /// <summary>
         /// BoolProperty: IsCollide
         /// </summary>
-        public unsafe bool IsCollide
+        public bool IsCollide
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 1) != 0;
+            set { if (value) _bitfield24 |= 1; else _bitfield24 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bForceDisableCollisionWithWorld
         /// </summary>
-        public unsafe bool bForceDisableCollisionWithWorld
+        public bool bForceDisableCollisionWithWorld
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 2) != 0;
+            set { if (value) _bitfield24 |= 2; else _bitfield24 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: IsForceRefPose
         /// </summary>
-        public unsafe bool IsForceRefPose
+        public bool IsForceRefPose
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 4) != 0;
+            set { if (value) _bitfield24 |= 4; else _bitfield24 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: IsIgnoreWindEffects
         /// </summary>
-        public unsafe bool IsIgnoreWindEffects
+        public bool IsIgnoreWindEffects
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 8) != 0;
+            set { if (value) _bitfield24 |= 8; else _bitfield24 &= ~8; }
         }
 
         /// <summary>
         /// FloatProperty: AnimDriveJointLinearComponentStrengthOverride
         /// </summary>
-        public unsafe float AnimDriveJointLinearComponentStrengthOverride
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float AnimDriveJointLinearComponentStrengthOverride;
 
         /// <summary>
         /// FloatProperty: AnimDriveJointAngularComponentStrengthOverride
         /// </summary>
-        public unsafe float AnimDriveJointAngularComponentStrengthOverride
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float AnimDriveJointAngularComponentStrengthOverride;
 
         /// <summary>
         /// BoolProperty: bPushUsingParentComponentBone
         /// </summary>
-        public unsafe bool bPushUsingParentComponentBone
+        public bool bPushUsingParentComponentBone
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 1) != 0;
+            set { if (value) _bitfield36 |= 1; else _bitfield36 &= ~1; }
         }
 
         /// <summary>
         /// NameProperty: PushBoneName
         /// </summary>
-        public unsafe BmSDK.FName PushBoneName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public BmSDK.FName PushBoneName;
 
         /// <summary>
         /// StructProperty: PushTowardsDirection
         /// </summary>
-        public unsafe System.Numerics.Vector3 PushTowardsDirection
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public System.Numerics.Vector3 PushTowardsDirection;
 
         /// <summary>
         /// FloatProperty: PushAngle
         /// </summary>
-        public unsafe float PushAngle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float PushAngle;
 
         /// <summary>
         /// BoolProperty: bPushUsingParentComponentBone2
         /// </summary>
-        public unsafe bool bPushUsingParentComponentBone2
+        public bool bPushUsingParentComponentBone2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }; }
+            readonly get => (_bitfield64 & 1) != 0;
+            set { if (value) _bitfield64 |= 1; else _bitfield64 &= ~1; }
         }
 
         /// <summary>
         /// NameProperty: PushBoneName2
         /// </summary>
-        public unsafe BmSDK.FName PushBoneName2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public BmSDK.FName PushBoneName2;
 
         /// <summary>
         /// StructProperty: PushTowardsDirection2
         /// </summary>
-        public unsafe System.Numerics.Vector3 PushTowardsDirection2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
-        }
+        [FieldOffset(76)] public System.Numerics.Vector3 PushTowardsDirection2;
 
         /// <summary>
         /// FloatProperty: PushAngle2
         /// </summary>
-        public unsafe float PushAngle2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
-        }
+        [FieldOffset(88)] public float PushAngle2;
     }
 
     /// <summary>
@@ -283,29 +239,17 @@ public partial class RCapeStateBoneConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: SkinningBoneName
         /// </summary>
-        public unsafe BmSDK.FName SkinningBoneName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName SkinningBoneName;
 
         /// <summary>
         /// FloatProperty: SkinningBoneWeight
         /// </summary>
-        public unsafe float SkinningBoneWeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float SkinningBoneWeight;
 
         /// <summary>
         /// ByteProperty: SkinningType
         /// </summary>
-        public unsafe BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneSkinningType SkinningType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneSkinningType>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneSkinningType SkinningType;
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName CapeStateName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName AnimStateName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(BmSDK.FName*)(Ptr + 52); }
+        set { *(BmSDK.FName*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName AnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsMirrorAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsBlendInAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 2; else *(int*)(Ptr + 68) &= ~2; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bBlendInPose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 4; else *(int*)(Ptr + 68) &= ~4; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsDisableSupportConstraints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 8; else *(int*)(Ptr + 68) &= ~8; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsAllowCollisionShapeCollisionWithAllBones
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 16; else *(int*)(Ptr + 68) &= ~16; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableSupportSprings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 32; else *(int*)(Ptr + 68) &= ~32; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool DisableWorldCollision
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 64; else *(int*)(Ptr + 68) &= ~64; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsApplyRotationBackForces
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 128; else *(int*)(Ptr + 68) &= ~128; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bBlendToDesiredSpringWeight
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 256; else *(int*)(Ptr + 68) &= ~256; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsEnableRunEffect
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 512; else *(int*)(Ptr + 68) &= ~512; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSyncParentAnimMirroredness
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1024; else *(int*)(Ptr + 68) &= ~1024; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool OnlyTakeParentTranslationAtAttachPos
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 2048; else *(int*)(Ptr + 68) &= ~2048; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool DisableHeadDepthBias
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 4096; else *(int*)(Ptr + 68) &= ~4096; }
     }
 
     /// <summary>
@@ -227,8 +227,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDebugDisableState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 8192; else *(int*)(Ptr + 68) &= ~8192; }
     }
 
     /// <summary>
@@ -236,8 +236,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimBlendInDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -245,8 +245,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float PoseBlendDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -254,8 +254,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RCapeStateConfig.EAutoForwardType AutoForwardType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateConfig.EAutoForwardType>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(BmSDK.BmGame.RCapeStateConfig.EAutoForwardType*)(Ptr + 80); }
+        set { *(BmSDK.BmGame.RCapeStateConfig.EAutoForwardType*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -263,8 +263,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RCapeStateConfig.OverstretchHandlingMethod StateOvertretchHandlingMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateConfig.OverstretchHandlingMethod>(Ptr + 81); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 81); }
+        get { return *(BmSDK.BmGame.RCapeStateConfig.OverstretchHandlingMethod*)(Ptr + 81); }
+        set { *(BmSDK.BmGame.RCapeStateConfig.OverstretchHandlingMethod*)(Ptr + 81) = value; }
     }
 
     /// <summary>
@@ -272,8 +272,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AutoForwardTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -281,8 +281,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName AutoForwardToCapeStateName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(BmSDK.FName*)(Ptr + 88); }
+        set { *(BmSDK.FName*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -317,8 +317,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimDriveJointLinearComponentForceLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(float*)(Ptr + 116); }
+        set { *(float*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -326,8 +326,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimDriveJointLinearComponentStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -335,8 +335,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimDriveJointLinearComponentDamping
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -344,8 +344,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimDriveJointAngularComponentForceLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 
     /// <summary>
@@ -353,8 +353,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimDriveJointAngularComponentStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(float*)(Ptr + 132); }
+        set { *(float*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -362,8 +362,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimDriveJointAngularComponentDamping
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(float*)(Ptr + 136); }
+        set { *(float*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -371,8 +371,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DriveToAnimatedTolerance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(float*)(Ptr + 140); }
+        set { *(float*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -380,8 +380,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinApplyRotVel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(float*)(Ptr + 144); }
+        set { *(float*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -389,8 +389,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ForceStrengthMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(float*)(Ptr + 148); }
+        set { *(float*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -398,8 +398,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxForceCap
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(float*)(Ptr + 152); }
+        set { *(float*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -407,8 +407,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ChainPosStrengthMultiplierMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(float*)(Ptr + 156); }
+        set { *(float*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -416,8 +416,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ChainPosStrengthMultiplierChangeOverLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -425,8 +425,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverstretchHandlingDistanceOverride
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 
     /// <summary>
@@ -434,8 +434,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float SpringWeightBlendSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }
+        get { return *(float*)(Ptr + 168); }
+        set { *(float*)(Ptr + 168) = value; }
     }
 
     /// <summary>
@@ -443,8 +443,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunEffectStartLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 172); }
+        get { return *(float*)(Ptr + 172); }
+        set { *(float*)(Ptr + 172) = value; }
     }
 
     /// <summary>
@@ -452,8 +452,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunEffectStartForceStrengthMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(float*)(Ptr + 176); }
+        set { *(float*)(Ptr + 176) = value; }
     }
 
     /// <summary>
@@ -461,8 +461,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float RunEffectForceStrengthMultiplierIncreaseRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(float*)(Ptr + 180); }
+        set { *(float*)(Ptr + 180) = value; }
     }
 
     /// <summary>
@@ -470,8 +470,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName ParentTimeSyncAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(BmSDK.FName*)(Ptr + 184); }
+        set { *(BmSDK.FName*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -479,8 +479,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ParentTimeSyncOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+        get { return *(float*)(Ptr + 192); }
+        set { *(float*)(Ptr + 192) = value; }
     }
 
     /// <summary>
@@ -488,8 +488,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DepthBiasMagnitudeClamp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 196); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 196); }
+        get { return *(float*)(Ptr + 196); }
+        set { *(float*)(Ptr + 196) = value; }
     }
 
     /// <summary>
@@ -497,8 +497,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DepthBiasMagnitudeClampCentrePos
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 200); }
+        get { return *(float*)(Ptr + 200); }
+        set { *(float*)(Ptr + 200) = value; }
     }
 
     /// <summary>
@@ -506,8 +506,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ForwardDepthBiasOverride
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(float*)(Ptr + 204); }
+        set { *(float*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -515,8 +515,8 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float BackwardDepthBiasOverride
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(float*)(Ptr + 208); }
+        set { *(float*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -548,29 +548,17 @@ public partial class RCapeStateConfig : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: MaterialConstantName
         /// </summary>
-        public unsafe BmSDK.FName MaterialConstantName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName MaterialConstantName;
 
         /// <summary>
         /// FloatProperty: MaterialConstantValue
         /// </summary>
-        public unsafe float MaterialConstantValue
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float MaterialConstantValue;
 
         /// <summary>
         /// FloatProperty: MaterialConstantMaxChangePerSecond
         /// </summary>
-        public unsafe float MaterialConstantMaxChangePerSecond
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float MaterialConstantMaxChangePerSecond;
     }
 
     /// <summary>
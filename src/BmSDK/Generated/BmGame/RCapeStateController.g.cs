@@ -78,95 +78,107 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RCapeStateController>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetCapeToBoneDataReferencePoseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetCapeToBoneDataReferencePose_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetCapeToBoneDataReferencePose
     /// </summary>
     public unsafe virtual void SetCapeToBoneDataReferencePose()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.SetCapeToBoneDataReferencePose", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetCapeToBoneDataReferencePoseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.SetCapeToBoneDataReferencePose", true);
+        var parms = new SetCapeToBoneDataReferencePose_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCapeToCurrentAnimPoseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCapeToCurrentAnimPose_Params
+    {
+        [FieldOffset(0)] public int IsEvaluateAnim;
+    }
+
     /// <summary>
     /// Function: SetCapeToCurrentAnimPose
     /// </summary>
     public unsafe virtual void SetCapeToCurrentAnimPose(bool IsEvaluateAnim = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.SetCapeToCurrentAnimPose", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IsEvaluateAnim, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetCapeToCurrentAnimPoseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.SetCapeToCurrentAnimPose", true);
+        var parms = new SetCapeToCurrentAnimPose_Params();
+        parms.IsEvaluateAnim = IsEvaluateAnim ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResumeCapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResumeCape_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResumeCape
     /// </summary>
     public unsafe virtual void ResumeCape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.ResumeCape", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ResumeCapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.ResumeCape", true);
+        var parms = new ResumeCape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PauseCapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PauseCape_Params
+    {
+    }
+
     /// <summary>
     /// Function: PauseCape
     /// </summary>
     public unsafe virtual void PauseCape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.PauseCape", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PauseCapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.PauseCape", true);
+        var parms = new PauseCape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetIsPausedOrPendingPausedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetIsPausedOrPendingPaused_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetIsPausedOrPendingPaused
     /// </summary>
     public unsafe virtual bool GetIsPausedOrPendingPaused()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.GetIsPausedOrPendingPaused", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_GetIsPausedOrPendingPausedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.GetIsPausedOrPendingPaused", true);
+        var parms = new GetIsPausedOrPendingPaused_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BeginCinematicStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct BeginCinematicState_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName AnimName;
+        [FieldOffset(8)] public nint TemplateStateConfig;
+        [FieldOffset(12)] public float AnimStartTime;
+        [FieldOffset(16)] public float AnimPlayRate;
+        [FieldOffset(20)] public BmSDK.FName SyncAnimName;
+        [FieldOffset(28)] public float SyncAnimOffset;
+        [FieldOffset(32)] public int bMirrored;
+        [FieldOffset(36)] public int bClearVelocityOnExit;
+        [FieldOffset(40)] public int bTeleportToInitialPose;
     }
 
     /// <summary>
@@ -174,168 +186,171 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void BeginCinematicState(BmSDK.FName AnimName, BmSDK.BmGame.RCapeStateConfig TemplateStateConfig, float AnimStartTime, float AnimPlayRate = default, BmSDK.FName SyncAnimName = default, float SyncAnimOffset = default, bool bMirrored = default, bool bClearVelocityOnExit = default, bool bTeleportToInitialPose = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.BeginCinematicState", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TemplateStateConfig, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimStartTime, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPlayRate, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SyncAnimName, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SyncAnimOffset, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bMirrored, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bClearVelocityOnExit, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTeleportToInitialPose, paramsPtr + 40);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_BeginCinematicStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.BeginCinematicState", true);
+        var parms = new BeginCinematicState_Params();
+        parms.AnimName = AnimName;
+        parms.TemplateStateConfig = TemplateStateConfig?.Ptr ?? 0;
+        parms.AnimStartTime = AnimStartTime;
+        parms.AnimPlayRate = AnimPlayRate;
+        parms.SyncAnimName = SyncAnimName;
+        parms.SyncAnimOffset = SyncAnimOffset;
+        parms.bMirrored = bMirrored ? 1 : 0;
+        parms.bClearVelocityOnExit = bClearVelocityOnExit ? 1 : 0;
+        parms.bTeleportToInitialPose = bTeleportToInitialPose ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCapeStateAndTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SetCapeStateAndTime_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewCapeStateName;
+        [FieldOffset(8)] public float NewCapeStateTime;
+        [FieldOffset(12)] public float AnimPlayRate;
+        [FieldOffset(16)] public int bMirrored;
+        [FieldOffset(20)] public BmSDK.FName AnimName;
+        [FieldOffset(28)] public BmSDK.FName SyncAnimNameOverride;
+        [FieldOffset(36)] public float SyncAnimOffsetOverride;
+    }
+
     /// <summary>
     /// Function: SetCapeStateAndTime
     /// </summary>
     public unsafe virtual void SetCapeStateAndTime(BmSDK.FName NewCapeStateName, float NewCapeStateTime, float AnimPlayRate = default, bool bMirrored = default, BmSDK.FName AnimName = default, BmSDK.FName SyncAnimNameOverride = default, float SyncAnimOffsetOverride = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.SetCapeStateAndTime", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCapeStateName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCapeStateTime, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPlayRate, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bMirrored, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SyncAnimNameOverride, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SyncAnimOffsetOverride, paramsPtr + 36);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetCapeStateAndTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.SetCapeStateAndTime", true);
+        var parms = new SetCapeStateAndTime_Params();
+        parms.NewCapeStateName = NewCapeStateName;
+        parms.NewCapeStateTime = NewCapeStateTime;
+        parms.AnimPlayRate = AnimPlayRate;
+        parms.bMirrored = bMirrored ? 1 : 0;
+        parms.AnimName = AnimName;
+        parms.SyncAnimNameOverride = SyncAnimNameOverride;
+        parms.SyncAnimOffsetOverride = SyncAnimOffsetOverride;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCapeStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct SetCapeState_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewCapeStateName;
+        [FieldOffset(8)] public BmSDK.FName NewCapeAnimName;
+        [FieldOffset(16)] public float AnimStartTime;
+        [FieldOffset(20)] public float AnimPlayRate;
+        [FieldOffset(24)] public int ForceRestart;
+        [FieldOffset(28)] public int ForceInitialPose;
+        [FieldOffset(32)] public int bMirrored;
+    }
+
     /// <summary>
     /// Function: SetCapeState
     /// </summary>
     public unsafe virtual void SetCapeState(BmSDK.FName NewCapeStateName, BmSDK.FName NewCapeAnimName, float AnimStartTime = default, float AnimPlayRate = default, bool ForceRestart = default, bool ForceInitialPose = default, bool bMirrored = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.SetCapeState", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCapeStateName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCapeAnimName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimStartTime, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPlayRate, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceRestart, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceInitialPose, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bMirrored, paramsPtr + 32);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetCapeStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.SetCapeState", true);
+        var parms = new SetCapeState_Params();
+        parms.NewCapeStateName = NewCapeStateName;
+        parms.NewCapeAnimName = NewCapeAnimName;
+        parms.AnimStartTime = AnimStartTime;
+        parms.AnimPlayRate = AnimPlayRate;
+        parms.ForceRestart = ForceRestart ? 1 : 0;
+        parms.ForceInitialPose = ForceInitialPose ? 1 : 0;
+        parms.bMirrored = bMirrored ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Update
     /// </summary>
     public unsafe virtual void Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.Update", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePauseStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpdatePauseState_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdatePauseState
     /// </summary>
     public unsafe virtual void UpdatePauseState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.UpdatePauseState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdatePauseStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.UpdatePauseState", true);
+        var parms = new UpdatePauseState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinaliseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Finalise_Params
+    {
+    }
+
     /// <summary>
     /// Function: Finalise
     /// </summary>
     public unsafe virtual void Finalise()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.Finalise", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_FinaliseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.Finalise", true);
+        var parms = new Finalise_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Initialise_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName InitialCapeStateName;
+    }
+
     /// <summary>
     /// Function: Initialise
     /// </summary>
     public unsafe virtual void Initialise(BmSDK.FName InitialCapeStateName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.Initialise", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InitialCapeStateName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.Initialise", true);
+        var parms = new Initialise_Params();
+        parms.InitialCapeStateName = InitialCapeStateName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetIsInitialisedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetIsInitialised_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetIsInitialised
     /// </summary>
     public unsafe virtual bool GetIsInitialised()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.GetIsInitialised", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_GetIsInitialisedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCapeStateController.GetIsInitialised", true);
+        var parms = new GetIsInitialised_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -352,8 +367,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsInitialised
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1; else *(int*)(Ptr + 48) &= ~1; }
     }
 
     /// <summary>
@@ -361,8 +376,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsCapePauseRequested
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 2; else *(int*)(Ptr + 48) &= ~2; }
     }
 
     /// <summary>
@@ -370,8 +385,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsSubUpdatePauseRequested
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 4; else *(int*)(Ptr + 48) &= ~4; }
     }
 
     /// <summary>
@@ -379,8 +394,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsCapePaused
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 8; else *(int*)(Ptr + 48) &= ~8; }
     }
 
     /// <summary>
@@ -388,8 +403,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsCapeStateMirrored
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 16; else *(int*)(Ptr + 48) &= ~16; }
     }
 
     /// <summary>
@@ -397,8 +412,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsClearVelocityOnStateExit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 32; else *(int*)(Ptr + 48) &= ~32; }
     }
 
     /// <summary>
@@ -406,8 +421,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsDebugForceAnimated
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 64; else *(int*)(Ptr + 48) &= ~64; }
     }
 
     /// <summary>
@@ -415,8 +430,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsForceCapeToAnimPose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 128; else *(int*)(Ptr + 48) &= ~128; }
     }
 
     /// <summary>
@@ -424,8 +439,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AutoForwardTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -442,8 +457,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr CapePhysicsRef
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(System.IntPtr*)(Ptr + 60); }
+        set { *(System.IntPtr*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -451,8 +466,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName CapeStateName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(BmSDK.FName*)(Ptr + 64); }
+        set { *(BmSDK.FName*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -493,8 +508,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CachedCapeStateDataIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(int*)(Ptr + 272); }
+        set { *(int*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -517,8 +532,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float TimeSinceMovedBackwards
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }
+        get { return *(float*)(Ptr + 400); }
+        set { *(float*)(Ptr + 400) = value; }
     }
 
     /// <summary>
@@ -526,8 +541,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float RemainingWorldCollisionDisableTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(float*)(Ptr + 404); }
+        set { *(float*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -553,8 +568,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DebugRenderBoneIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(int*)(Ptr + 432); }
+        set { *(int*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -562,8 +577,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DeepIntersectionHandlingNumTestChainVsShapesPerFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(int*)(Ptr + 436); }
+        set { *(int*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -571,8 +586,8 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DeepIntersectionHandlingCurrChainShapeIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(int*)(Ptr + 440); }
+        set { *(int*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -593,20 +608,12 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: ParentAttachPointLocalToWorld
         /// </summary>
-        public unsafe BmSDK.GameObject.FMatrix ParentAttachPointLocalToWorld
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMatrix>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FMatrix ParentAttachPointLocalToWorld;
 
         /// <summary>
         /// StructProperty: ParentAttachPointRefLocalToWorld
         /// </summary>
-        public unsafe BmSDK.GameObject.FMatrix ParentAttachPointRefLocalToWorld
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMatrix>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public BmSDK.GameObject.FMatrix ParentAttachPointRefLocalToWorld;
 
         /// <summary>
         /// ArrayProperty: SkinningBoneLocalToWorlds
@@ -645,29 +652,17 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: CachedBoneConfigFindIndex
         /// </summary>
-        public unsafe int CachedBoneConfigFindIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int CachedBoneConfigFindIndex;
 
         /// <summary>
         /// NameProperty: AutoForwardToStateName
         /// </summary>
-        public unsafe BmSDK.FName AutoForwardToStateName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName AutoForwardToStateName;
 
         /// <summary>
         /// FloatProperty: AutoForwardTimer
         /// </summary>
-        public unsafe float AutoForwardTimer
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float AutoForwardTimer;
 
         /// <summary>
         /// ArrayProperty: CapeShapeDatas
@@ -710,149 +705,111 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 68)]
     public partial record struct FCapeStateBoneData
     {
+        [FieldOffset(24)] private int _bitfield24;
+
         /// <summary>
         /// StructProperty: FakeSkinBoneDatas
         /// </summary>
-        public unsafe BmSDK.BmGame.RCapeStateController.FCapeBoneFakeSkinningDatas FakeSkinBoneDatas
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateController.FCapeBoneFakeSkinningDatas>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RCapeStateController.FCapeBoneFakeSkinningDatas FakeSkinBoneDatas;
 
         /// <summary>
         /// FloatProperty: AnimDriveJointLinearComponentStrengthOverride
         /// </summary>
-        public unsafe float AnimDriveJointLinearComponentStrengthOverride
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float AnimDriveJointLinearComponentStrengthOverride;
 
         /// <summary>
         /// FloatProperty: AnimDriveJointAngularComponentStrengthOverride
         /// </summary>
-        public unsafe float AnimDriveJointAngularComponentStrengthOverride
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float AnimDriveJointAngularComponentStrengthOverride;
 
         /// <summary>
         /// ByteProperty: BoneState
         /// </summary>
-        public unsafe BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState BoneState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState BoneState;
 
         /// <summary>
         /// BoolProperty: BoneCollisionState
         /// </summary>
-        public unsafe bool BoneCollisionState
+        public bool BoneCollisionState
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 1) != 0;
+            set { if (value) _bitfield24 |= 1; else _bitfield24 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: BoneWorldCollisionState
         /// </summary>
-        public unsafe bool BoneWorldCollisionState
+        public bool BoneWorldCollisionState
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 2) != 0;
+            set { if (value) _bitfield24 |= 2; else _bitfield24 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: BoneForceRefState
         /// </summary>
-        public unsafe bool BoneForceRefState
+        public bool BoneForceRefState
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 4) != 0;
+            set { if (value) _bitfield24 |= 4; else _bitfield24 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: BoneIgnoreWindEffects
         /// </summary>
-        public unsafe bool BoneIgnoreWindEffects
+        public bool BoneIgnoreWindEffects
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 8) != 0;
+            set { if (value) _bitfield24 |= 8; else _bitfield24 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bPushUsingParentComponentBone
         /// </summary>
-        public unsafe bool bPushUsingParentComponentBone
+        public bool bPushUsingParentComponentBone
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 16) != 0;
+            set { if (value) _bitfield24 |= 16; else _bitfield24 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: bPushUsingParentComponentBone2
         /// </summary>
-        public unsafe bool bPushUsingParentComponentBone2
+        public bool bPushUsingParentComponentBone2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 32) != 0;
+            set { if (value) _bitfield24 |= 32; else _bitfield24 &= ~32; }
         }
 
         /// <summary>
         /// IntProperty: PushBoneIndex
         /// </summary>
-        public unsafe int PushBoneIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int PushBoneIndex;
 
         /// <summary>
         /// IntProperty: PushBoneIndex2
         /// </summary>
-        public unsafe int PushBoneIndex2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public int PushBoneIndex2;
 
         /// <summary>
         /// StructProperty: PushTowardsDirection
         /// </summary>
-        public unsafe System.Numerics.Vector3 PushTowardsDirection
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public System.Numerics.Vector3 PushTowardsDirection;
 
         /// <summary>
         /// StructProperty: PushTowardsDirection2
         /// </summary>
-        public unsafe System.Numerics.Vector3 PushTowardsDirection2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public System.Numerics.Vector3 PushTowardsDirection2;
 
         /// <summary>
         /// FloatProperty: PushAngle
         /// </summary>
-        public unsafe float PushAngle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float PushAngle;
 
         /// <summary>
         /// FloatProperty: PushAngle2
         /// </summary>
-        public unsafe float PushAngle2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float PushAngle2;
     }
 
     /// <summary>
@@ -880,29 +837,17 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: BoneIndex
         /// </summary>
-        public unsafe int BoneIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int BoneIndex;
 
         /// <summary>
         /// FloatProperty: BoneWeight
         /// </summary>
-        public unsafe float BoneWeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float BoneWeight;
 
         /// <summary>
         /// ByteProperty: SkinningType
         /// </summary>
-        public unsafe BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneSkinningType SkinningType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneSkinningType>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneSkinningType SkinningType;
     }
 
     /// <summary>
@@ -923,20 +868,12 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: PhysShapeMesh
         /// </summary>
-        public unsafe System.IntPtr PhysShapeMesh
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.IntPtr PhysShapeMesh;
 
         /// <summary>
         /// StructProperty: PhysShapeActor
         /// </summary>
-        public unsafe System.IntPtr PhysShapeActor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public System.IntPtr PhysShapeActor;
     }
 
     /// <summary>
@@ -948,29 +885,17 @@ public partial class RCapeStateController : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: BoneState
         /// </summary>
-        public unsafe BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState BoneState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RCapeStateBoneConfig.ECapeBoneState BoneState;
 
         /// <summary>
         /// ByteProperty: BoneVisibility
         /// </summary>
-        public unsafe BmSDK.BmGame.RCapeStateController.ECapeBoneVisibility BoneVisibility
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCapeStateController.ECapeBoneVisibility>(Ptr + 1); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1); }; }
-        }
+        [FieldOffset(1)] public BmSDK.BmGame.RCapeStateController.ECapeBoneVisibility BoneVisibility;
 
         /// <summary>
         /// StructProperty: StoredPose
         /// </summary>
-        public unsafe BmSDK.GameObject.FMatrix StoredPose
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMatrix>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.GameObject.FMatrix StoredPose;
     }
 
     /// <summary>
@@ -78,39 +78,67 @@ public partial class RCeilingClimbVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
         where TComponent : class, Framework.IScriptComponent<RCeilingClimbVolume>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_OnToggleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnToggle_Params
+    {
+        [FieldOffset(0)] public nint Action;
+    }
+
     /// <summary>
     /// Function: OnToggle
     /// </summary>
     public unsafe override void OnToggle(BmSDK.Engine.SeqAct_Toggle Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.OnToggle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.OnToggle", true);
+        var parms = new OnToggle_Params();
+        parms.Action = Action?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlinkToActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnlinkToActor_Params
+    {
+        [FieldOffset(0)] public nint LinkTarget;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: UnlinkToActor
     /// </summary>
     public unsafe override bool UnlinkToActor(BmSDK.Engine.Actor LinkTarget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.UnlinkToActor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LinkTarget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UnlinkToActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.UnlinkToActor", true);
+        var parms = new UnlinkToActor_Params();
+        parms.LinkTarget = LinkTarget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DebugDrawVolumeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugDrawVolume_Params
+    {
+        [FieldOffset(0)] public int bDrawPersistent;
     }
 
     /// <summary>
@@ -118,35 +146,27 @@ public partial class RCeilingClimbVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe virtual void DebugDrawVolume(bool bDrawPersistent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.DebugDrawVolume", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawPersistent, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DebugDrawVolumeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.DebugDrawVolume", true);
+        var parms = new DebugDrawVolume_Params();
+        parms.bDrawPersistent = bDrawPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FlagGrapplePointsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FlagGrapplePoints_Params
+    {
+    }
+
     /// <summary>
     /// Function: FlagGrapplePoints
     /// </summary>
     public unsafe virtual void FlagGrapplePoints()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.FlagGrapplePoints", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_FlagGrapplePointsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCeilingClimbVolume.FlagGrapplePoints", true);
+        var parms = new FlagGrapplePoints_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -336,80 +356,80 @@ public partial class RCeilingClimbVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe byte PointsCrossLevel_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(byte*)(Ptr + 552); }
+        set { *(byte*)(Ptr + 552) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 553); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 553); }
+        get { return *(byte*)(Ptr + 553); }
+        set { *(byte*)(Ptr + 553) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 554); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 554); }
+        get { return *(byte*)(Ptr + 554); }
+        set { *(byte*)(Ptr + 554) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 555); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 555); }
+        get { return *(byte*)(Ptr + 555); }
+        set { *(byte*)(Ptr + 555) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(byte*)(Ptr + 556); }
+        set { *(byte*)(Ptr + 556) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 557); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 557); }
+        get { return *(byte*)(Ptr + 557); }
+        set { *(byte*)(Ptr + 557) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 558); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 558); }
+        get { return *(byte*)(Ptr + 558); }
+        set { *(byte*)(Ptr + 558) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 559); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 559); }
+        get { return *(byte*)(Ptr + 559); }
+        set { *(byte*)(Ptr + 559) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 560); }
+        get { return *(byte*)(Ptr + 560); }
+        set { *(byte*)(Ptr + 560) = value; }
     }
     /// <summary>
     /// ByteProperty: PointsCrossLevel
     /// </summary>
     public unsafe byte PointsCrossLevel_9
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 561); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 561); }
+        get { return *(byte*)(Ptr + 561); }
+        set { *(byte*)(Ptr + 561) = value; }
     }
 
     /// <summary>
@@ -417,8 +437,8 @@ public partial class RCeilingClimbVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe int TouchingGrapples
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(int*)(Ptr + 564); }
+        set { *(int*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -426,8 +446,8 @@ public partial class RCeilingClimbVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 568) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 568); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 568); }
+        get { return (*(int*)(Ptr + 568) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 568) |= 1; else *(int*)(Ptr + 568) &= ~1; }
     }
 
     /// <summary>
@@ -435,8 +455,8 @@ public partial class RCeilingClimbVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCantPounceUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 568) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 568); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 568); }
+        get { return (*(int*)(Ptr + 568) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 568) |= 2; else *(int*)(Ptr + 568) &= ~2; }
     }
 
     /// <summary>
@@ -444,8 +464,8 @@ public partial class RCeilingClimbVolume : BmSDK.Engine.Volume, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bNoDropFromCeiling
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 568) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 568); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 568); }
+        get { return (*(int*)(Ptr + 568) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 568) |= 4; else *(int*)(Ptr + 568) &= ~4; }
     }
 
     /// <summary>
@@ -78,29 +78,53 @@ public partial class RChallengeGoalDefinitions : BmSDK.Engine.Actor, BmSDK.IGame
         where TComponent : class, Framework.IScriptComponent<RChallengeGoalDefinitions>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_EraseAllLeaderBoardsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct EraseAllLeaderBoards_Params
+    {
+    }
+
     /// <summary>
     /// Function: EraseAllLeaderBoards
     /// </summary>
     public unsafe virtual void EraseAllLeaderBoards()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeGoalDefinitions.EraseAllLeaderBoards", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EraseAllLeaderBoardsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeGoalDefinitions.EraseAllLeaderBoards", true);
+        var parms = new EraseAllLeaderBoards_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FetchPredatorGoalInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct FetchPredatorGoalInfo_Params
+    {
+        [FieldOffset(0)] public int ChallengeID;
+        [FieldOffset(4)] public BmSDK.BmGame.RChallengeManager.EPlayableCharacters Character;
+        [FieldOffset(20)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FetchPredatorGoalInfo
     /// </summary>
     public unsafe virtual int FetchPredatorGoalInfo(int ChallengeID, BmSDK.BmGame.RChallengeManager.EPlayableCharacters Character, out BmSDK.TArray<BmSDK.BmGame.RGameInfo.EGameAction> Goals)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeGoalDefinitions.FetchPredatorGoalInfo", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeID, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Character, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Goals = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.BmGame.RGameInfo.EGameAction>>(paramsPtr + 8);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 20);
+        var funcManaged = s_FetchPredatorGoalInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeGoalDefinitions.FetchPredatorGoalInfo", true);
+        var parms = new FetchPredatorGoalInfo_Params();
+        parms.ChallengeID = ChallengeID;
+        parms.Character = Character;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Goals = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.BmGame.RGameInfo.EGameAction>>((byte*)&parms + 8);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_FetchCombatGoalInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct FetchCombatGoalInfo_Params
+    {
+        [FieldOffset(0)] public int ChallengeID;
+        [FieldOffset(4)] public BmSDK.BmGame.RChallengeManager.EPlayableCharacters Character;
+        [FieldOffset(20)] public int ReturnValue;
     }
 
     /// <summary>
@@ -108,13 +132,13 @@ public partial class RChallengeGoalDefinitions : BmSDK.Engine.Actor, BmSDK.IGame
     /// </summary>
     public unsafe virtual int FetchCombatGoalInfo(int ChallengeID, BmSDK.BmGame.RChallengeManager.EPlayableCharacters Character, out BmSDK.TArray<int> Goals)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeGoalDefinitions.FetchCombatGoalInfo", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeID, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Character, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Goals = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 8);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 20);
+        var funcManaged = s_FetchCombatGoalInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeGoalDefinitions.FetchCombatGoalInfo", true);
+        var parms = new FetchCombatGoalInfo_Params();
+        parms.ChallengeID = ChallengeID;
+        parms.Character = Character;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Goals = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 8);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -135,11 +159,7 @@ public partial class RChallengeGoalDefinitions : BmSDK.Engine.Actor, BmSDK.IGame
         /// <summary>
         /// IntProperty: ChallengeID
         /// </summary>
-        public unsafe int ChallengeID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int ChallengeID;
 
         /// <summary>
         /// ArrayProperty: GoalsByCharacter
@@ -160,44 +180,36 @@ public partial class RChallengeGoalDefinitions : BmSDK.Engine.Actor, BmSDK.IGame
         /// <summary>
         /// ByteProperty: Character
         /// </summary>
-        public unsafe BmSDK.BmGame.RChallengeManager.EPlayableCharacters Character
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChallengeManager.EPlayableCharacters>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RChallengeManager.EPlayableCharacters Character;
 
         /// <summary>
         /// IntProperty: LeaderboardId
         /// </summary>
-        public unsafe int LeaderboardId
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int LeaderboardId;
 
         /// <summary>
         /// IntProperty: ChallengeScores
         /// </summary>
         public unsafe int ChallengeScores_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 8) = value; }; }
         }
         /// <summary>
         /// IntProperty: ChallengeScores
         /// </summary>
         public unsafe int ChallengeScores_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// IntProperty: ChallengeScores
         /// </summary>
         public unsafe int ChallengeScores_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 16) = value; }; }
         }
 
         /// <summary>
@@ -205,24 +217,24 @@ public partial class RChallengeGoalDefinitions : BmSDK.Engine.Actor, BmSDK.IGame
         /// </summary>
         public unsafe BmSDK.BmGame.RGameInfo.EGameAction ChallengeActions_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EGameAction>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 20) = value; }; }
         }
         /// <summary>
         /// ByteProperty: ChallengeActions
         /// </summary>
         public unsafe BmSDK.BmGame.RGameInfo.EGameAction ChallengeActions_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EGameAction>(Ptr + 21); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 21); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 21); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 21) = value; }; }
         }
         /// <summary>
         /// ByteProperty: ChallengeActions
         /// </summary>
         public unsafe BmSDK.BmGame.RGameInfo.EGameAction ChallengeActions_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EGameAction>(Ptr + 22); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 22); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 22); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 22) = value; }; }
         }
     }
 }
@@ -78,37 +78,55 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RChallengeManager>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetCurrentInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct GetCurrentInfo_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RChallengeManager.EPlayableCharacters outCharacter;
+        [FieldOffset(4)] public int outChallengeID;
+        [FieldOffset(8)] public byte bOutPredator;
+    }
+
     /// <summary>
     /// Function: GetCurrentInfo
     /// </summary>
     public unsafe virtual void GetCurrentInfo(out BmSDK.BmGame.RChallengeManager.EPlayableCharacters outCharacter, out int outChallengeID, out byte bOutPredator)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCurrentInfo", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        outCharacter = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChallengeManager.EPlayableCharacters>(paramsPtr + 0);
-        outChallengeID = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
-        bOutPredator = BmSDK.Framework.MarshalUtil.ToManaged<byte>(paramsPtr + 8);
+        var funcManaged = s_GetCurrentInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCurrentInfo", true);
+        var parms = new GetCurrentInfo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        outCharacter = parms.outCharacter;
+        outChallengeID = parms.outChallengeID;
+        bOutPredator = parms.bOutPredator;
         return;
     }
 
+    static BmSDK.Function s_ToTimeStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ToTimeString_Params
+    {
+        [FieldOffset(0)] public int Value;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: ToTimeString
     /// </summary>
     public unsafe virtual BmSDK.FString ToTimeString(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.ToTimeString", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_ToTimeStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.ToTimeString", true);
+        var parms = new ToTimeString_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_PlayableCharactersNameToEnumFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct PlayableCharactersNameToEnum_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString CharName;
+        [FieldOffset(12)] public BmSDK.BmGame.RChallengeManager.EPlayableCharacters ReturnValue;
     }
 
     /// <summary>
@@ -116,11 +134,18 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RChallengeManager.EPlayableCharacters PlayableCharactersNameToEnum(BmSDK.FString CharName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.PlayableCharactersNameToEnum", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChallengeManager.EPlayableCharacters>(paramsPtr + 12);
+        var funcManaged = s_PlayableCharactersNameToEnumFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.PlayableCharactersNameToEnum", true);
+        var parms = new PlayableCharactersNameToEnum_Params();
+        parms.CharName = CharName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetCharacterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct GetCharacter_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RChallengeManager.EPlayableCharacters ReturnValue;
     }
 
     /// <summary>
@@ -128,10 +153,18 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RChallengeManager.EPlayableCharacters GetCharacter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCharacter", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChallengeManager.EPlayableCharacters>(paramsPtr + 0);
+        var funcManaged = s_GetCharacterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCharacter", true);
+        var parms = new GetCharacter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetCharacterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetCharacter_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString CharacterName;
+        [FieldOffset(12)] public BmSDK.FString FullCharacterName;
     }
 
     /// <summary>
@@ -139,58 +172,91 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetCharacter(BmSDK.FString CharacterName, BmSDK.FString FullCharacterName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetCharacter", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FullCharacterName, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCharacterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetCharacter", true);
+        var parms = new SetCharacter_Params();
+        parms.CharacterName = CharacterName;
+        parms.FullCharacterName = FullCharacterName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Dump_Params
+    {
+    }
+
     /// <summary>
     /// Function: Dump
     /// </summary>
     public unsafe virtual void Dump()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.Dump", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.Dump", true);
+        var parms = new Dump_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetGoalTitlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetGoalTitles_Params
+    {
+        [FieldOffset(0)] public int Round;
+    }
+
     /// <summary>
     /// Function: GetGoalTitles
     /// </summary>
     public unsafe virtual void GetGoalTitles(int Round, out BmSDK.TArray<BmSDK.FString> GoalTitles)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetGoalTitles", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Round, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        GoalTitles = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.FString>>(paramsPtr + 4);
+        var funcManaged = s_GetGoalTitlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetGoalTitles", true);
+        var parms = new GetGoalTitles_Params();
+        parms.Round = Round;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        GoalTitles = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.FString>>((byte*)&parms + 4);
         return;
     }
 
+    static BmSDK.Function s_DecrementRetriesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DecrementRetries_Params
+    {
+    }
+
     /// <summary>
     /// Function: DecrementRetries
     /// </summary>
     public unsafe virtual void DecrementRetries()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.DecrementRetries", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DecrementRetriesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.DecrementRetries", true);
+        var parms = new DecrementRetries_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRetriesLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetRetriesLeft_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRetriesLeft
     /// </summary>
     public unsafe virtual int GetRetriesLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetRetriesLeft", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetRetriesLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetRetriesLeft", true);
+        var parms = new GetRetriesLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetCurrentURLFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetCurrentURL_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -198,10 +264,17 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.FString GetCurrentURL()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCurrentURL", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetCurrentURLFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCurrentURL", true);
+        var parms = new GetCurrentURL_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsDLCMapFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsDLCMap_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -209,10 +282,17 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsDLCMap()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsDLCMap", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsDLCMapFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsDLCMap", true);
+        var parms = new IsDLCMap_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsRankedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsRanked_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -220,10 +300,17 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsRanked()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsRanked", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsRankedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsRanked", true);
+        var parms = new IsRanked_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsCampaignFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsCampaign_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -231,10 +318,17 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsCampaign()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsCampaign", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsCampaignFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsCampaign", true);
+        var parms = new IsCampaign_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsLastRoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsLastRound_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -242,10 +336,17 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsLastRound()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsLastRound", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsLastRoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsLastRound", true);
+        var parms = new IsLastRound_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetCurrentRoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetCurrentRound_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -253,10 +354,16 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetCurrentRound()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCurrentRound", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetCurrentRoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCurrentRound", true);
+        var parms = new GetCurrentRound_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetNextRoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetNextRound_Params
+    {
     }
 
     /// <summary>
@@ -264,22 +371,37 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetNextRound()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetNextRound", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNextRoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetNextRound", true);
+        var parms = new SetNextRound_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsModifierActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsModifierActive_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EChallengeModifiers new_modifier;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsModifierActive
     /// </summary>
     public unsafe virtual bool IsModifierActive(BmSDK.BmGame.RGameInfo.EChallengeModifiers new_modifier)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsModifierActive", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_modifier, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsModifierActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsModifierActive", true);
+        var parms = new IsModifierActive_Params();
+        parms.new_modifier = new_modifier;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AddModifierForCurrentRoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AddModifierForCurrentRound_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EChallengeModifiers new_modifier;
     }
 
     /// <summary>
@@ -287,146 +409,233 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void AddModifierForCurrentRound(BmSDK.BmGame.RGameInfo.EChallengeModifiers new_modifier)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.AddModifierForCurrentRound", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_modifier, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddModifierForCurrentRoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.AddModifierForCurrentRound", true);
+        var parms = new AddModifierForCurrentRound_Params();
+        parms.new_modifier = new_modifier;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearCurrentRoundModifiersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearCurrentRoundModifiers_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearCurrentRoundModifiers
     /// </summary>
     public unsafe virtual void ClearCurrentRoundModifiers()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.ClearCurrentRoundModifiers", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearCurrentRoundModifiersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.ClearCurrentRoundModifiers", true);
+        var parms = new ClearCurrentRoundModifiers_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayerUsesARetryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayerUsesARetry_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayerUsesARetry
     /// </summary>
     public unsafe virtual void PlayerUsesARetry()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.PlayerUsesARetry", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerUsesARetryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.PlayerUsesARetry", true);
+        var parms = new PlayerUsesARetry_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayerAcceptsCurrentRoundResultsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayerAcceptsCurrentRoundResults_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayerAcceptsCurrentRoundResults
     /// </summary>
     public unsafe virtual void PlayerAcceptsCurrentRoundResults()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.PlayerAcceptsCurrentRoundResults", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerAcceptsCurrentRoundResultsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.PlayerAcceptsCurrentRoundResults", true);
+        var parms = new PlayerAcceptsCurrentRoundResults_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRoundMedalsEarnedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct SetRoundMedalsEarned_Params
+    {
+        [FieldOffset(0)] public int Round;
+        [FieldOffset(4)] public byte medals_earned;
+    }
+
     /// <summary>
     /// Function: SetRoundMedalsEarned
     /// </summary>
     public unsafe virtual void SetRoundMedalsEarned(int Round, byte medals_earned)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetRoundMedalsEarned", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Round, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(medals_earned, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRoundMedalsEarnedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetRoundMedalsEarned", true);
+        var parms = new SetRoundMedalsEarned_Params();
+        parms.Round = Round;
+        parms.medals_earned = medals_earned;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetActiveRoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetActiveRound_Params
+    {
+        [FieldOffset(0)] public int Round;
+    }
+
     /// <summary>
     /// Function: SetActiveRound
     /// </summary>
     public unsafe virtual void SetActiveRound(int Round)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetActiveRound", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Round, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetActiveRoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetActiveRound", true);
+        var parms = new SetActiveRound_Params();
+        parms.Round = Round;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPredatorStatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct AddPredatorStat_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString event_name;
+        [FieldOffset(12)] public float event_time;
+    }
+
     /// <summary>
     /// Function: AddPredatorStat
     /// </summary>
     public unsafe virtual void AddPredatorStat(BmSDK.FString event_name, float event_time)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.AddPredatorStat", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(event_name, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(event_time, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPredatorStatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.AddPredatorStat", true);
+        var parms = new AddPredatorStat_Params();
+        parms.event_name = event_name;
+        parms.event_time = event_time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPredatorMedalActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct AddPredatorMedalAction_Params
+    {
+        [FieldOffset(0)] public nint RPC;
+        [FieldOffset(4)] public BmSDK.BmGame.RGameInfo.EGameAction Action;
+    }
+
     /// <summary>
     /// Function: AddPredatorMedalAction
     /// </summary>
     public unsafe virtual void AddPredatorMedalAction(BmSDK.BmGame.RPlayerController RPC, BmSDK.BmGame.RGameInfo.EGameAction Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.AddPredatorMedalAction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPredatorMedalActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.AddPredatorMedalAction", true);
+        var parms = new AddPredatorMedalAction_Params();
+        parms.RPC = RPC?.Ptr ?? 0;
+        parms.Action = Action;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPredatorActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AddPredatorAction_Params
+    {
+        [FieldOffset(0)] public nint RPC;
+        [FieldOffset(4)] public BmSDK.BmGame.RGameInfo.EGameAction Action;
+    }
+
     /// <summary>
     /// Function: AddPredatorAction
     /// </summary>
     public unsafe virtual void AddPredatorAction(BmSDK.BmGame.RPlayerController RPC, BmSDK.BmGame.RGameInfo.EGameAction Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.AddPredatorAction", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPredatorActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.AddPredatorAction", true);
+        var parms = new AddPredatorAction_Params();
+        parms.RPC = RPC?.Ptr ?? 0;
+        parms.Action = Action;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearPredatorStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearPredatorStats_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearPredatorStats
     /// </summary>
     public unsafe virtual void ClearPredatorStats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.ClearPredatorStats", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearPredatorStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.ClearPredatorStats", true);
+        var parms = new ClearPredatorStats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BuildChallengeListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct BuildChallengeList_Params
+    {
+        [FieldOffset(0)] public int selected;
+        [FieldOffset(4)] public int bInRanked;
+        [FieldOffset(8)] public nint GoalDefs;
+    }
+
     /// <summary>
     /// Function: BuildChallengeList
     /// </summary>
     public unsafe virtual void BuildChallengeList(int selected, bool bInRanked, BmSDK.BmGame.RChallengeGoalDefinitions GoalDefs)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.BuildChallengeList", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(selected, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInRanked, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GoalDefs, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BuildChallengeListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.BuildChallengeList", true);
+        var parms = new BuildChallengeList_Params();
+        parms.selected = selected;
+        parms.bInRanked = bInRanked ? 1 : 0;
+        parms.GoalDefs = GoalDefs?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FilloutChallengeMatchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct FilloutChallengeMatch_Params
+    {
+        [FieldOffset(0)] public int inID;
+        [FieldOffset(4)] public nint GoalDefs;
+        [FieldOffset(8)] public BmSDK.BmGame.RChallengeManager.FChallengeMatch ReturnValue;
+    }
+
     /// <summary>
     /// Function: FilloutChallengeMatch
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RChallengeManager.FChallengeMatch FilloutChallengeMatch(int inID, BmSDK.BmGame.RChallengeGoalDefinitions GoalDefs)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.FilloutChallengeMatch", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inID, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GoalDefs, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChallengeManager.FChallengeMatch>(paramsPtr + 8);
+        var funcManaged = s_FilloutChallengeMatchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.FilloutChallengeMatch", true);
+        var parms = new FilloutChallengeMatch_Params();
+        parms.inID = inID;
+        parms.GoalDefs = GoalDefs?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetDefaultsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetDefaults_Params
+    {
     }
 
     /// <summary>
@@ -434,22 +643,38 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetDefaults()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetDefaults", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDefaultsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.SetDefaults", true);
+        var parms = new SetDefaults_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsPredatorMapFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct IsPredatorMap_Params
+    {
+        [FieldOffset(0)] public int Id;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsPredatorMap
     /// </summary>
     public unsafe virtual bool IsPredatorMap(int Id)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsPredatorMap", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsPredatorMapFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsPredatorMap", true);
+        var parms = new IsPredatorMap_Params();
+        parms.Id = Id;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetFlagForModifierFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetFlagForModifier_Params
+    {
+        [FieldOffset(0)] public int test_mod;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -457,11 +682,17 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.FString GetFlagForModifier(int test_mod)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetFlagForModifier", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(test_mod, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_GetFlagForModifierFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetFlagForModifier", true);
+        var parms = new GetFlagForModifier_Params();
+        parms.test_mod = test_mod;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CheckModifierAvailabilityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckModifierAvailability_Params
+    {
     }
 
     /// <summary>
@@ -469,22 +700,37 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void CheckModifierAvailability()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.CheckModifierAvailability", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckModifierAvailabilityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.CheckModifierAvailability", true);
+        var parms = new CheckModifierAvailability_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsModifierAvailableForCustomFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsModifierAvailableForCustom_Params
+    {
+        [FieldOffset(0)] public int test_mod;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsModifierAvailableForCustom
     /// </summary>
     public unsafe virtual bool IsModifierAvailableForCustom(int test_mod)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsModifierAvailableForCustom", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(test_mod, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsModifierAvailableForCustomFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.IsModifierAvailableForCustom", true);
+        var parms = new IsModifierAvailableForCustom_Params();
+        parms.test_mod = test_mod;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetCampaignIDsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct GetCampaignIDs_Params
+    {
+        [FieldOffset(0)] public int Id;
     }
 
     /// <summary>
@@ -492,11 +738,19 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.TArray<int> GetCampaignIDs(int Id)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCampaignIDs", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 4);
+        var funcManaged = s_GetCampaignIDsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetCampaignIDs", true);
+        var parms = new GetCampaignIDs_Params();
+        parms.Id = Id;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 4);
+    }
+
+    static BmSDK.Function s_GetChallengeMapIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetChallengeMapIndex_Params
+    {
+        [FieldOffset(0)] public int Id;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -504,11 +758,18 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetChallengeMapIndex(int Id)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetChallengeMapIndex", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetChallengeMapIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetChallengeMapIndex", true);
+        var parms = new GetChallengeMapIndex_Params();
+        parms.Id = Id;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRGIFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetRGI_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -516,10 +777,10 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RGameInfo GetRGI()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetRGI", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo>(paramsPtr + 0);
+        var funcManaged = s_GetRGIFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChallengeManager.GetRGI", true);
+        var parms = new GetRGI_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RGameInfo)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -531,11 +792,7 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: GameAction
         /// </summary>
-        public unsafe BmSDK.BmGame.RGameInfo.EGameAction GameAction
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EGameAction>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EGameAction GameAction;
 
         /// <summary>
         /// StrProperty: DBString
@@ -553,40 +810,30 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 36)]
     public partial record struct FChallengeMatch
     {
+        [FieldOffset(8)] private int _bitfield8;
+
         /// <summary>
         /// ByteProperty: Id
         /// </summary>
-        public unsafe byte Id
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public byte Id;
 
         /// <summary>
         /// ByteProperty: PackId
         /// </summary>
-        public unsafe byte PackId
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 1); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1); }; }
-        }
+        [FieldOffset(1)] public byte PackId;
 
         /// <summary>
         /// IntProperty: LeaderboardId
         /// </summary>
-        public unsafe int LeaderboardId
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int LeaderboardId;
 
         /// <summary>
         /// BoolProperty: bPredator
         /// </summary>
-        public unsafe bool bPredator
+        public bool bPredator
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 1) != 0;
+            set { if (value) _bitfield8 |= 1; else _bitfield8 &= ~1; }
         }
 
         /// <summary>
@@ -676,8 +923,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool FreeMedalIsActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 1; else *(int*)(Ptr + 128) &= ~1; }
     }
 
     /// <summary>
@@ -685,8 +932,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRanked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 2; else *(int*)(Ptr + 128) &= ~2; }
     }
 
     /// <summary>
@@ -694,8 +941,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCurrentMapIsDLC
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 4; else *(int*)(Ptr + 128) &= ~4; }
     }
 
     /// <summary>
@@ -739,8 +986,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RChallengeManager.EPlayableCharacters CurrentCharacter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChallengeManager.EPlayableCharacters>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(BmSDK.BmGame.RChallengeManager.EPlayableCharacters*)(Ptr + 180); }
+        set { *(BmSDK.BmGame.RChallengeManager.EPlayableCharacters*)(Ptr + 180) = value; }
     }
 
     /// <summary>
@@ -748,8 +995,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentOptions.ChallengeMode CurrentChallengeMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentOptions.ChallengeMode>(Ptr + 181); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 181); }
+        get { return *(BmSDK.BmGame.RPersistentOptions.ChallengeMode*)(Ptr + 181); }
+        set { *(BmSDK.BmGame.RPersistentOptions.ChallengeMode*)(Ptr + 181) = value; }
     }
 
     /// <summary>
@@ -757,8 +1004,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte CampaignPackId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 182); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 182); }
+        get { return *(byte*)(Ptr + 182); }
+        set { *(byte*)(Ptr + 182) = value; }
     }
 
     /// <summary>
@@ -766,8 +1013,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CampaignId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(int*)(Ptr + 184); }
+        set { *(int*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -775,8 +1022,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CurrentChallengeId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 188); }
+        get { return *(int*)(Ptr + 188); }
+        set { *(int*)(Ptr + 188) = value; }
     }
 
     /// <summary>
@@ -784,8 +1031,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CurrentLeaderboardId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+        get { return *(int*)(Ptr + 192); }
+        set { *(int*)(Ptr + 192) = value; }
     }
 
     /// <summary>
@@ -802,8 +1049,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CurrentRound
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(int*)(Ptr + 208); }
+        set { *(int*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -811,8 +1058,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CurrentRetrysLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(int*)(Ptr + 212); }
+        set { *(int*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -820,8 +1067,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CombatRound
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(int*)(Ptr + 216); }
+        set { *(int*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -829,8 +1076,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DumpCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(int*)(Ptr + 220); }
+        set { *(int*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -865,8 +1112,8 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int BestCachedRating
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(int*)(Ptr + 260); }
+        set { *(int*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -890,110 +1137,62 @@ public partial class RChallengeManager : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Ranked
         /// </summary>
-        public unsafe int Ranked
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int Ranked;
 
         /// <summary>
         /// IntProperty: RankedTotal
         /// </summary>
-        public unsafe int RankedTotal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int RankedTotal;
 
         /// <summary>
         /// IntProperty: RankedDLC
         /// </summary>
-        public unsafe int RankedDLC
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int RankedDLC;
 
         /// <summary>
         /// IntProperty: RankedDLCTotal
         /// </summary>
-        public unsafe int RankedDLCTotal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int RankedDLCTotal;
 
         /// <summary>
         /// IntProperty: Custom
         /// </summary>
-        public unsafe int Custom
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int Custom;
 
         /// <summary>
         /// IntProperty: CustomTotal
         /// </summary>
-        public unsafe int CustomTotal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public int CustomTotal;
 
         /// <summary>
         /// IntProperty: CustomDLC
         /// </summary>
-        public unsafe int CustomDLC
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int CustomDLC;
 
         /// <summary>
         /// IntProperty: CustomDLCTotal
         /// </summary>
-        public unsafe int CustomDLCTotal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int CustomDLCTotal;
 
         /// <summary>
         /// IntProperty: Campaign
         /// </summary>
-        public unsafe int Campaign
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public int Campaign;
 
         /// <summary>
         /// IntProperty: CampaignTotal
         /// </summary>
-        public unsafe int CampaignTotal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public int CampaignTotal;
 
         /// <summary>
         /// IntProperty: CampaignDLC
         /// </summary>
-        public unsafe int CampaignDLC
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public int CampaignDLC;
 
         /// <summary>
         /// IntProperty: CampaignDLCTotal
         /// </summary>
-        public unsafe int CampaignDLCTotal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public int CampaignDLCTotal;
     }
 
     /// <summary>
@@ -96,11 +96,7 @@ public partial class RChapterLineSet : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Weight
         /// </summary>
-        public unsafe float Weight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Weight;
 
         /// <summary>
         /// ObjectProperty: ChapterDialogueLine
@@ -114,11 +110,7 @@ public partial class RChapterLineSet : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: UseWeight
         /// </summary>
-        public unsafe float UseWeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float UseWeight;
     }
 
     /// <summary>
@@ -73,30 +73,45 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RCharacter>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_StaticCreatePawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct StaticCreatePawn_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Location;
+        [FieldOffset(12)] public BmSDK.Rotator Rotation;
+        [FieldOffset(24)] public nint UseSpawnPoint;
+        [FieldOffset(28)] public nint SpawnPawnClass;
+        [FieldOffset(32)] public nint SpawnCharactersType;
+        [FieldOffset(36)] public int SnapToGround;
+        [FieldOffset(40)] public BmSDK.FName InitialMovementStance;
+        [FieldOffset(48)] public BmSDK.FName InitialWeaponStance;
+        [FieldOffset(56)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: StaticCreatePawn
     /// </summary>
     public unsafe static BmSDK.BmGame.RBMPawnAI StaticCreatePawn(System.Numerics.Vector3 Location, BmSDK.Rotator Rotation, BmSDK.Engine.Actor UseSpawnPoint, BmSDK.Class SpawnPawnClass, BmSDK.Class SpawnCharactersType, bool SnapToGround, BmSDK.FName InitialMovementStance, BmSDK.FName InitialWeaponStance)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.StaticCreatePawn", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Location, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Rotation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UseSpawnPoint, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnPawnClass, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnCharactersType, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SnapToGround, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InitialMovementStance, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InitialWeaponStance, paramsPtr + 48);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMPawnAI>(paramsPtr + 56);
+        var funcManaged = s_StaticCreatePawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.StaticCreatePawn", true);
+        var parms = new StaticCreatePawn_Params();
+        parms.Location = Location;
+        parms.Rotation = Rotation;
+        parms.UseSpawnPoint = UseSpawnPoint?.Ptr ?? 0;
+        parms.SpawnPawnClass = SpawnPawnClass?.Ptr ?? 0;
+        parms.SpawnCharactersType = SpawnCharactersType?.Ptr ?? 0;
+        parms.SnapToGround = SnapToGround ? 1 : 0;
+        parms.InitialMovementStance = InitialMovementStance;
+        parms.InitialWeaponStance = InitialWeaponStance;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMPawnAI)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetCustomFallingSoundEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetCustomFallingSoundEvent_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -104,10 +119,17 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.RDialogueLine GetCustomFallingSoundEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetCustomFallingSoundEvent", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RDialogueLine>(paramsPtr + 0);
+        var funcManaged = s_GetCustomFallingSoundEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetCustomFallingSoundEvent", true);
+        var parms = new GetCustomFallingSoundEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.RDialogueLine)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetRunningToCombatSoundEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetRunningToCombatSoundEvent_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -115,10 +137,17 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.RDialogueLine GetRunningToCombatSoundEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetRunningToCombatSoundEvent", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RDialogueLine>(paramsPtr + 0);
+        var funcManaged = s_GetRunningToCombatSoundEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetRunningToCombatSoundEvent", true);
+        var parms = new GetRunningToCombatSoundEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.RDialogueLine)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetEnterCombatSoundEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetEnterCombatSoundEvent_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -126,10 +155,17 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.RDialogueLine GetEnterCombatSoundEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetEnterCombatSoundEvent", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RDialogueLine>(paramsPtr + 0);
+        var funcManaged = s_GetEnterCombatSoundEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetEnterCombatSoundEvent", true);
+        var parms = new GetEnterCombatSoundEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.RDialogueLine)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetStrikeImpactCue_BodyKickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStrikeImpactCue_BodyKick_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -137,10 +173,17 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.AkEvent GetStrikeImpactCue_BodyKick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_BodyKick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetStrikeImpactCue_BodyKickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_BodyKick", true);
+        var parms = new GetStrikeImpactCue_BodyKick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetStrikeImpactCue_BodyPunchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStrikeImpactCue_BodyPunch_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -148,10 +191,17 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.AkEvent GetStrikeImpactCue_BodyPunch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_BodyPunch", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetStrikeImpactCue_BodyPunchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_BodyPunch", true);
+        var parms = new GetStrikeImpactCue_BodyPunch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetStrikeImpactCue_HeadKickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStrikeImpactCue_HeadKick_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -159,10 +209,17 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.AkEvent GetStrikeImpactCue_HeadKick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_HeadKick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetStrikeImpactCue_HeadKickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_HeadKick", true);
+        var parms = new GetStrikeImpactCue_HeadKick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetStrikeImpactCue_HeadPunchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStrikeImpactCue_HeadPunch_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -170,10 +227,17 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.AkEvent GetStrikeImpactCue_HeadPunch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_HeadPunch", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetStrikeImpactCue_HeadPunchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_HeadPunch", true);
+        var parms = new GetStrikeImpactCue_HeadPunch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetStrikeImpactCue_CounterBlockFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStrikeImpactCue_CounterBlock_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -181,10 +245,17 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.AkEvent GetStrikeImpactCue_CounterBlock()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_CounterBlock", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetStrikeImpactCue_CounterBlockFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_CounterBlock", true);
+        var parms = new GetStrikeImpactCue_CounterBlock_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetStrikeImpactCue_FinishingBlowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStrikeImpactCue_FinishingBlow_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -192,10 +263,19 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.AkEvent GetStrikeImpactCue_FinishingBlow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_FinishingBlow", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetStrikeImpactCue_FinishingBlowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.GetStrikeImpactCue_FinishingBlow", true);
+        var parms = new GetStrikeImpactCue_FinishingBlow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_UpdateCustomPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateCustomPhysics_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+        [FieldOffset(4)] public float DeltaTime;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -203,12 +283,19 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static bool UpdateCustomPhysics(BmSDK.BmGame.RBMPawnAI Pawn, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.UpdateCustomPhysics", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_UpdateCustomPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.UpdateCustomPhysics", true);
+        var parms = new UpdateCustomPhysics_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetupCustomPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetupCustomPhysics_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
     }
 
     /// <summary>
@@ -216,10 +303,10 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static void SetupCustomPhysics(BmSDK.BmGame.RBMPawnAI Pawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.SetupCustomPhysics", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetupCustomPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacter.SetupCustomPhysics", true);
+        var parms = new SetupCustomPhysics_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -246,47 +333,27 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: BoneName1
         /// </summary>
-        public unsafe BmSDK.FName BoneName1
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName BoneName1;
 
         /// <summary>
         /// StructProperty: BonePos1
         /// </summary>
-        public unsafe System.Numerics.Vector3 BonePos1
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public System.Numerics.Vector3 BonePos1;
 
         /// <summary>
         /// NameProperty: BoneName2
         /// </summary>
-        public unsafe BmSDK.FName BoneName2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.FName BoneName2;
 
         /// <summary>
         /// StructProperty: BonePos2
         /// </summary>
-        public unsafe System.Numerics.Vector3 BonePos2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector3 BonePos2;
 
         /// <summary>
         /// FloatProperty: Length
         /// </summary>
-        public unsafe float Length
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float Length;
     }
 
     /// <summary>
@@ -307,11 +374,7 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: AttachBone
         /// </summary>
-        public unsafe BmSDK.FName AttachBone
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.FName AttachBone;
     }
 
     /// <summary>
@@ -370,6 +433,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 36)]
     public partial record struct FCharacterStaticPropsChar
     {
+        [FieldOffset(32)] private int _bitfield32;
+
         /// <summary>
         /// ObjectProperty: Prop
         /// </summary>
@@ -382,11 +447,7 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: SocketToAttachPropTo
         /// </summary>
-        public unsafe BmSDK.FName SocketToAttachPropTo
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.FName SocketToAttachPropTo;
 
         /// <summary>
         /// ObjectProperty: SpecialXrayMat
@@ -400,28 +461,20 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: BoneToAttachPropTo
         /// </summary>
-        public unsafe BmSDK.FName BoneToAttachPropTo
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.FName BoneToAttachPropTo;
 
         /// <summary>
         /// NameProperty: PropGlobalFlagCheck
         /// </summary>
-        public unsafe BmSDK.FName PropGlobalFlagCheck
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.FName PropGlobalFlagCheck;
 
         /// <summary>
         /// BoolProperty: bAllowInXray
         /// </summary>
-        public unsafe bool bAllowInXray
+        public bool bAllowInXray
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 1) != 0;
+            set { if (value) _bitfield32 |= 1; else _bitfield32 &= ~1; }
         }
     }
 
@@ -431,6 +484,9 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 84)]
     public partial record struct FCharacterSkeletalPropsChar
     {
+        [FieldOffset(48)] private int _bitfield48;
+        [FieldOffset(60)] private int _bitfield60;
+
         /// <summary>
         /// ObjectProperty: Prop
         /// </summary>
@@ -452,11 +508,7 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: MultiPropChance
         /// </summary>
-        public unsafe float MultiPropChance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float MultiPropChance;
 
         /// <summary>
         /// ObjectProperty: PropPhys
@@ -470,64 +522,52 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: SocketToAttachPropTo
         /// </summary>
-        public unsafe BmSDK.FName SocketToAttachPropTo
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.FName SocketToAttachPropTo;
 
         /// <summary>
         /// NameProperty: BoneToAttachPropTo
         /// </summary>
-        public unsafe BmSDK.FName BoneToAttachPropTo
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.FName BoneToAttachPropTo;
 
         /// <summary>
         /// NameProperty: PropGlobalFlagCheck
         /// </summary>
-        public unsafe BmSDK.FName PropGlobalFlagCheck
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public BmSDK.FName PropGlobalFlagCheck;
 
         /// <summary>
         /// BoolProperty: bRemovePropOnStrike
         /// </summary>
-        public unsafe bool bRemovePropOnStrike
+        public bool bRemovePropOnStrike
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }; }
+            readonly get => (_bitfield48 & 1) != 0;
+            set { if (value) _bitfield48 |= 1; else _bitfield48 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bRemovePropOnDeath
         /// </summary>
-        public unsafe bool bRemovePropOnDeath
+        public bool bRemovePropOnDeath
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }; }
+            readonly get => (_bitfield48 & 2) != 0;
+            set { if (value) _bitfield48 |= 2; else _bitfield48 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bRemovedProp
         /// </summary>
-        public unsafe bool bRemovedProp
+        public bool bRemovedProp
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }; }
+            readonly get => (_bitfield48 & 4) != 0;
+            set { if (value) _bitfield48 |= 4; else _bitfield48 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bDontAllowColorChange
         /// </summary>
-        public unsafe bool bDontAllowColorChange
+        public bool bDontAllowColorChange
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }; }
+            readonly get => (_bitfield48 & 8) != 0;
+            set { if (value) _bitfield48 |= 8; else _bitfield48 &= ~8; }
         }
 
         /// <summary>
@@ -551,20 +591,16 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: bUsesParentAnim
         /// </summary>
-        public unsafe bool bUsesParentAnim
+        public bool bUsesParentAnim
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }; }
+            readonly get => (_bitfield60 & 1) != 0;
+            set { if (value) _bitfield60 |= 1; else _bitfield60 &= ~1; }
         }
 
         /// <summary>
         /// ByteProperty: ParentAnimComponentMode
         /// </summary>
-        public unsafe BmSDK.Engine.RSkeletalMeshComponent_Export.EParentAnimComponentMode ParentAnimComponentMode
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RSkeletalMeshComponent_Export.EParentAnimComponentMode>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public BmSDK.Engine.RSkeletalMeshComponent_Export.EParentAnimComponentMode ParentAnimComponentMode;
 
         /// <summary>
         /// ObjectProperty: AnimTree
@@ -660,8 +696,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseAsOccluder
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1; else *(int*)(Ptr + 60) &= ~1; }
     }
 
     /// <summary>
@@ -669,8 +705,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisallowXraySkinDistanceFading
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 2; else *(int*)(Ptr + 60) &= ~2; }
     }
 
     /// <summary>
@@ -678,8 +714,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool BareFoot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 4; else *(int*)(Ptr + 60) &= ~4; }
     }
 
     /// <summary>
@@ -687,8 +723,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsMassiveInSize
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 8; else *(int*)(Ptr + 60) &= ~8; }
     }
 
     /// <summary>
@@ -696,8 +732,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceDrawScale
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 16; else *(int*)(Ptr + 60) &= ~16; }
     }
 
     /// <summary>
@@ -705,8 +741,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAlwaysRagdollWhenHit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 32; else *(int*)(Ptr + 60) &= ~32; }
     }
 
     /// <summary>
@@ -714,8 +750,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCanBeHurtByStrike
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 64; else *(int*)(Ptr + 60) &= ~64; }
     }
 
     /// <summary>
@@ -723,8 +759,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bArmoured
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 128; else *(int*)(Ptr + 60) &= ~128; }
     }
 
     /// <summary>
@@ -732,8 +768,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAlwaysMirrorCombat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 256; else *(int*)(Ptr + 60) &= ~256; }
     }
 
     /// <summary>
@@ -741,8 +777,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsRandom
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 512; else *(int*)(Ptr + 60) &= ~512; }
     }
 
     /// <summary>
@@ -750,8 +786,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasFlappyBits
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1024; else *(int*)(Ptr + 60) &= ~1024; }
     }
 
     /// <summary>
@@ -759,8 +795,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAlwaysUsePhysics
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 2048; else *(int*)(Ptr + 60) &= ~2048; }
     }
 
     /// <summary>
@@ -768,8 +804,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableFloorCorrection
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 4096; else *(int*)(Ptr + 60) &= ~4096; }
     }
 
     /// <summary>
@@ -777,8 +813,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseRandomCombatPoses
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 8192; else *(int*)(Ptr + 60) &= ~8192; }
     }
 
     /// <summary>
@@ -786,8 +822,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsGeneric
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 16384; else *(int*)(Ptr + 60) &= ~16384; }
     }
 
     /// <summary>
@@ -795,8 +831,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsHooded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 32768; else *(int*)(Ptr + 60) &= ~32768; }
     }
 
     /// <summary>
@@ -804,8 +840,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsBreakable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 65536; else *(int*)(Ptr + 60) &= ~65536; }
     }
 
     /// <summary>
@@ -813,8 +849,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bBreakOnDeath
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 131072; else *(int*)(Ptr + 60) &= ~131072; }
     }
 
     /// <summary>
@@ -822,8 +858,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSilentRagdoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 262144; else *(int*)(Ptr + 60) &= ~262144; }
     }
 
     /// <summary>
@@ -831,8 +867,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasEnterCombatReactions
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 524288; else *(int*)(Ptr + 60) &= ~524288; }
     }
 
     /// <summary>
@@ -840,8 +876,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bExtendGlideKickStunTime
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1048576; else *(int*)(Ptr + 60) &= ~1048576; }
     }
 
     /// <summary>
@@ -849,8 +885,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSuppressDeathTips
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 2097152; else *(int*)(Ptr + 60) &= ~2097152; }
     }
 
     /// <summary>
@@ -858,8 +894,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAllowCustomPhysics
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 4194304; else *(int*)(Ptr + 60) &= ~4194304; }
     }
 
     /// <summary>
@@ -867,8 +903,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAllowCustomPhysicsUpdate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 8388608; else *(int*)(Ptr + 60) &= ~8388608; }
     }
 
     /// <summary>
@@ -894,8 +930,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName NameFromScriptDatabase
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(BmSDK.FName*)(Ptr + 72); }
+        set { *(BmSDK.FName*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -903,8 +939,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DrawScaleMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -921,8 +957,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Health
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(int*)(Ptr + 96); }
+        set { *(int*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -930,8 +966,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float HealthMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -939,8 +975,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CombatDifficultyModifier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(int*)(Ptr + 104); }
+        set { *(int*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -1092,8 +1128,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumCombatOverlays
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(int*)(Ptr + 228); }
+        set { *(int*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -1128,8 +1164,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName EntryAnim_AnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(BmSDK.FName*)(Ptr + 244); }
+        set { *(BmSDK.FName*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -1242,8 +1278,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int FatThinPropIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(int*)(Ptr + 372); }
+        set { *(int*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -1251,8 +1287,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RBMCombatManager.EWeaponConfigType FriendlyWeaponConfigType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMCombatManager.EWeaponConfigType>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(BmSDK.BmGame.RBMCombatManager.EWeaponConfigType*)(Ptr + 376); }
+        set { *(BmSDK.BmGame.RBMCombatManager.EWeaponConfigType*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -1260,8 +1296,8 @@ public partial class RCharacter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RCharacter.GangTypeEnum GangType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCharacter.GangTypeEnum>(Ptr + 377); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 377); }
+        get { return *(BmSDK.BmGame.RCharacter.GangTypeEnum*)(Ptr + 377); }
+        set { *(BmSDK.BmGame.RCharacter.GangTypeEnum*)(Ptr + 377) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RCharacterBioCue : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe int ForceRandomLine
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(int*)(Ptr + 52); }
+        set { *(int*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -78,15 +78,23 @@ public partial class RCharacterRandom : BmSDK.BmGame.RCharacter, BmSDK.IGameObje
         where TComponent : class, Framework.IScriptComponent<RCharacterRandom>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetRandomTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetRandomType_Params
+    {
+        [FieldOffset(0)] public int randomVal;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRandomType
     /// </summary>
     public unsafe static BmSDK.Class GetRandomType(int randomVal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacterRandom.GetRandomType", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(randomVal, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 4);
+        var funcManaged = s_GetRandomTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCharacterRandom.GetRandomType", true);
+        var parms = new GetRandomType_Params();
+        parms.randomVal = randomVal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 }
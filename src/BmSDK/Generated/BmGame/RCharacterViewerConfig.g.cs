@@ -83,8 +83,8 @@ public partial class RCharacterViewerConfig : BmSDK.BmGame.RConfig, BmSDK.IGameO
     /// </summary>
     public unsafe float FOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(float*)(Ptr + 44); }
+        set { *(float*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RCharacterViewerConfig : BmSDK.BmGame.RConfig, BmSDK.IGameO
     /// </summary>
     public unsafe float FOVMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RCharacterViewerConfig : BmSDK.BmGame.RConfig, BmSDK.IGameO
     /// </summary>
     public unsafe float FOVMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class RCharacterViewerConfig : BmSDK.BmGame.RConfig, BmSDK.IGameO
     /// </summary>
     public unsafe float HeightMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -125,8 +125,8 @@ public partial class RCharacterViewerConfig : BmSDK.BmGame.RConfig, BmSDK.IGameO
     /// </summary>
     public unsafe float HeightMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -134,8 +134,8 @@ public partial class RCharacterViewerConfig : BmSDK.BmGame.RConfig, BmSDK.IGameO
     /// </summary>
     public unsafe float InitialHeightProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -143,8 +143,8 @@ public partial class RCharacterViewerConfig : BmSDK.BmGame.RConfig, BmSDK.IGameO
     /// </summary>
     public unsafe float Height
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -152,7 +152,7 @@ public partial class RCharacterViewerConfig : BmSDK.BmGame.RConfig, BmSDK.IGameO
     /// </summary>
     public unsafe float CameraDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 }
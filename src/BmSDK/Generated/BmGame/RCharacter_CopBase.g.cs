@@ -78,8 +78,8 @@ public partial class RCharacter_CopBase : BmSDK.BmGame.RCharacter, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.FName BodyColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class RCharacter_CopBase : BmSDK.BmGame.RCharacter, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.FName ShirtPatternName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class RCharacter_CopBase : BmSDK.BmGame.RCharacter, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.FName ShirtPatternColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -78,8 +78,8 @@ public partial class RCharacter_GuardBM2_TigerBaseBase : BmSDK.BmGame.RCharacter
     /// </summary>
     public unsafe BmSDK.FName BodyColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
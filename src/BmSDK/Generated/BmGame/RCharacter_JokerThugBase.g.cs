@@ -78,8 +78,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName PaintColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName ClothesColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName BodyColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName TattoPatternsParamName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.FName*)(Ptr + 432); }
+        set { *(BmSDK.FName*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -114,8 +114,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName ClothPatternParamName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(BmSDK.FName*)(Ptr + 440); }
+        set { *(BmSDK.FName*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName JokerLogoPositionName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(BmSDK.FName*)(Ptr + 448); }
+        set { *(BmSDK.FName*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -132,8 +132,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName JokerLogoSizeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(BmSDK.FName*)(Ptr + 456); }
+        set { *(BmSDK.FName*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -141,8 +141,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe bool bCanRandomise
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 464) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 464); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 464); }
+        get { return (*(int*)(Ptr + 464) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 464) |= 1; else *(int*)(Ptr + 464) &= ~1; }
     }
 
     /// <summary>
@@ -150,8 +150,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe bool bApplyClothesColoursToBody
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 464) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 464); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 464); }
+        get { return (*(int*)(Ptr + 464) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 464) |= 2; else *(int*)(Ptr + 464) &= ~2; }
     }
 
     /// <summary>
@@ -222,8 +222,8 @@ public partial class RCharacter_JokerThugBase : BmSDK.BmGame.RCharacter, BmSDK.I
     /// </summary>
     public unsafe float ChanceOfJokerLogo
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(float*)(Ptr + 552); }
+        set { *(float*)(Ptr + 552) = value; }
     }
 
     /// <summary>
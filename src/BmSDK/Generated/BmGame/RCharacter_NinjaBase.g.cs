@@ -78,8 +78,8 @@ public partial class RCharacter_NinjaBase : BmSDK.BmGame.RCharacter, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName ClothesColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class RCharacter_NinjaBase : BmSDK.BmGame.RCharacter, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName BodyColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class RCharacter_NinjaBase : BmSDK.BmGame.RCharacter, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName ClothesDesatName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class RCharacter_NinjaBase : BmSDK.BmGame.RCharacter, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName HairColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.FName*)(Ptr + 432); }
+        set { *(BmSDK.FName*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -150,7 +150,7 @@ public partial class RCharacter_NinjaBase : BmSDK.BmGame.RCharacter, BmSDK.IGame
     /// </summary>
     public unsafe bool bCanRandomise
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 488); }
+        get { return (*(int*)(Ptr + 488) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 488) |= 1; else *(int*)(Ptr + 488) &= ~1; }
     }
 }
@@ -78,8 +78,8 @@ public partial class RCharacter_PDLC_HarleyThugBase : BmSDK.BmGame.RCharacter, B
     /// </summary>
     public unsafe BmSDK.FName BodyColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class RCharacter_PDLC_HarleyThugBase : BmSDK.BmGame.RCharacter, B
     /// </summary>
     public unsafe bool bCanRandomise
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 1; else *(int*)(Ptr + 416) &= ~1; }
     }
 
     /// <summary>
@@ -78,8 +78,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe BmSDK.FName LegClothesColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe BmSDK.FName ClothesColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe BmSDK.FName BodyColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe BmSDK.FName LegDesatName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.FName*)(Ptr + 432); }
+        set { *(BmSDK.FName*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -114,8 +114,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe bool bCanRandomise
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 440); }
+        get { return (*(int*)(Ptr + 440) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 440) |= 1; else *(int*)(Ptr + 440) &= ~1; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe bool bCanRandomiseHeadApparel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 440); }
+        get { return (*(int*)(Ptr + 440) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 440) |= 2; else *(int*)(Ptr + 440) &= ~2; }
     }
 
     /// <summary>
@@ -168,8 +168,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe BmSDK.FName HeadApparelColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(BmSDK.FName*)(Ptr + 492); }
+        set { *(BmSDK.FName*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -177,8 +177,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe BmSDK.FName HeadApparelPatternName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(BmSDK.FName*)(Ptr + 500); }
+        set { *(BmSDK.FName*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -186,8 +186,8 @@ public partial class RCharacter_PenguinThugBase : BmSDK.BmGame.RCharacter, BmSDK
     /// </summary>
     public unsafe BmSDK.FName HeadApparelPatternColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 508); }
+        get { return *(BmSDK.FName*)(Ptr + 508); }
+        set { *(BmSDK.FName*)(Ptr + 508) = value; }
     }
 
     /// <summary>
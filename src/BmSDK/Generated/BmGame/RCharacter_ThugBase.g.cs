@@ -78,8 +78,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.FName VestOnName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.FName BlackHeadName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.FName VestColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.FName ClothesColourName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.FName*)(Ptr + 432); }
+        set { *(BmSDK.FName*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -114,8 +114,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.FName TattoosOnName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(BmSDK.FName*)(Ptr + 440); }
+        set { *(BmSDK.FName*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe bool VestOnDef
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 448); }
+        get { return (*(int*)(Ptr + 448) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 448) |= 1; else *(int*)(Ptr + 448) &= ~1; }
     }
 
     /// <summary>
@@ -132,8 +132,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe bool TattoosOnDef
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 448); }
+        get { return (*(int*)(Ptr + 448) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 448) |= 2; else *(int*)(Ptr + 448) &= ~2; }
     }
 
     /// <summary>
@@ -141,8 +141,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe bool bCanRandomise
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 448); }
+        get { return (*(int*)(Ptr + 448) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 448) |= 4; else *(int*)(Ptr + 448) &= ~4; }
     }
 
     /// <summary>
@@ -150,8 +150,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe bool bSyncVestAndClothesColour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 448); }
+        get { return (*(int*)(Ptr + 448) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 448) |= 8; else *(int*)(Ptr + 448) &= ~8; }
     }
 
     /// <summary>
@@ -159,8 +159,8 @@ public partial class RCharacter_ThugBase : BmSDK.BmGame.RCharacter, BmSDK.IGameO
     /// </summary>
     public unsafe bool BlackHeadDef
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 448); }
+        get { return (*(int*)(Ptr + 448) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 448) |= 16; else *(int*)(Ptr + 448) &= ~16; }
     }
 
     /// <summary>
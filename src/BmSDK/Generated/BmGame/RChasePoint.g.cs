@@ -78,31 +78,57 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RChasePoint>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ShowChaseBranchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct ShowChaseBranch_Params
+    {
+        [FieldOffset(0)] public nint DrawActor;
+        [FieldOffset(4)] public System.Numerics.Vector3 Offset;
+        [FieldOffset(16)] public float ChaseDist;
+        [FieldOffset(20)] public float ChaseTime;
+        [FieldOffset(24)] public nint TestActor;
+    }
+
     /// <summary>
     /// Function: ShowChaseBranch
     /// </summary>
     public unsafe virtual void ShowChaseBranch(BmSDK.Engine.Actor DrawActor, System.Numerics.Vector3 Offset, float ChaseDist, float ChaseTime, BmSDK.Engine.Actor TestActor = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.ShowChaseBranch", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DrawActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Offset, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChaseDist, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChaseTime, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestActor, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowChaseBranchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.ShowChaseBranch", true);
+        var parms = new ShowChaseBranch_Params();
+        parms.DrawActor = DrawActor?.Ptr ?? 0;
+        parms.Offset = Offset;
+        parms.ChaseDist = ChaseDist;
+        parms.ChaseTime = ChaseTime;
+        parms.TestActor = TestActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RecursiveHasCheckedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RecursiveHasChecked_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: RecursiveHasChecked
     /// </summary>
     public unsafe virtual bool RecursiveHasChecked()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.RecursiveHasChecked", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_RecursiveHasCheckedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.RecursiveHasChecked", true);
+        var parms = new RecursiveHasChecked_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FindNextBranchChildFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FindNextBranchChild_Params
+    {
+        [FieldOffset(0)] public float TimeSinceStart;
+        [FieldOffset(4)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -110,11 +136,17 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RChasePoint FindNextBranchChild(float TimeSinceStart)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.FindNextBranchChild", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeSinceStart, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChasePoint>(paramsPtr + 4);
+        var funcManaged = s_FindNextBranchChildFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.FindNextBranchChild", true);
+        var parms = new FindNextBranchChild_Params();
+        parms.TimeSinceStart = TimeSinceStart;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RChasePoint)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_FindTipsFromCompletelyUncheckedBranchesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct FindTipsFromCompletelyUncheckedBranches_Params
+    {
     }
 
     /// <summary>
@@ -122,22 +154,36 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void FindTipsFromCompletelyUncheckedBranches(out BmSDK.TArray<BmSDK.BmGame.RChasePoint> UncheckedTips)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.FindTipsFromCompletelyUncheckedBranches", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        UncheckedTips = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.BmGame.RChasePoint>>(paramsPtr + 0);
+        var funcManaged = s_FindTipsFromCompletelyUncheckedBranchesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.FindTipsFromCompletelyUncheckedBranches", true);
+        var parms = new FindTipsFromCompletelyUncheckedBranches_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        UncheckedTips = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.BmGame.RChasePoint>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_GetNumAvailableAtBranchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetNumAvailableAtBranch_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetNumAvailableAtBranch
     /// </summary>
     public unsafe virtual int GetNumAvailableAtBranch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetNumAvailableAtBranch", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetNumAvailableAtBranchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetNumAvailableAtBranch", true);
+        var parms = new GetNumAvailableAtBranch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNumDownBranchRecursiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetNumDownBranchRecursive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -145,10 +191,17 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetNumDownBranchRecursive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetNumDownBranchRecursive", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetNumDownBranchRecursiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetNumDownBranchRecursive", true);
+        var parms = new GetNumDownBranchRecursive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UnregisterChaserFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnregisterChaser_Params
+    {
+        [FieldOffset(0)] public nint ExChaser;
     }
 
     /// <summary>
@@ -156,101 +209,117 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void UnregisterChaser(BmSDK.BmGame.RAEC_Attack_Sub_Chase ExChaser)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.UnregisterChaser", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExChaser, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterChaserFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.UnregisterChaser", true);
+        var parms = new UnregisterChaser_Params();
+        parms.ExChaser = ExChaser?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterChaserFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RegisterChaser_Params
+    {
+        [FieldOffset(0)] public nint NewChaser;
+    }
+
     /// <summary>
     /// Function: RegisterChaser
     /// </summary>
     public unsafe virtual void RegisterChaser(BmSDK.BmGame.RAEC_Attack_Sub_Chase NewChaser)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.RegisterChaser", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewChaser, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterChaserFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.RegisterChaser", true);
+        var parms = new RegisterChaser_Params();
+        parms.NewChaser = NewChaser?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRadiusFromCenterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetRadiusFromCenter_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TreeLocation;
+        [FieldOffset(12)] public float MaxRadiusSq;
+    }
+
     /// <summary>
     /// Function: GetRadiusFromCenter
     /// </summary>
     public unsafe virtual void GetRadiusFromCenter(System.Numerics.Vector3 TreeLocation, out float MaxRadiusSq)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetRadiusFromCenter", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TreeLocation, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        MaxRadiusSq = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 12);
+        var funcManaged = s_GetRadiusFromCenterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetRadiusFromCenter", true);
+        var parms = new GetRadiusFromCenter_Params();
+        parms.TreeLocation = TreeLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        MaxRadiusSq = parms.MaxRadiusSq;
         return;
     }
 
+    static BmSDK.Function s_GetAveragePointLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetAveragePointLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TreeLocation;
+        [FieldOffset(12)] public int NumPoints;
+    }
+
     /// <summary>
     /// Function: GetAveragePointLocation
     /// </summary>
     public unsafe virtual void GetAveragePointLocation(out System.Numerics.Vector3 TreeLocation, out int NumPoints)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetAveragePointLocation", true);
-        byte* paramsPtr = stackalloc byte[16];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        TreeLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        NumPoints = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 12);
+        var funcManaged = s_GetAveragePointLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetAveragePointLocation", true);
+        var parms = new GetAveragePointLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        TreeLocation = parms.TreeLocation;
+        NumPoints = parms.NumPoints;
         return;
     }
 
+    static BmSDK.Function s_GetTreeBoundsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetTreeBounds_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TreeLocation;
+        [FieldOffset(12)] public float TreeRadius;
+    }
+
     /// <summary>
     /// Function: GetTreeBounds
     /// </summary>
     public unsafe virtual void GetTreeBounds(out System.Numerics.Vector3 TreeLocation, out float TreeRadius)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetTreeBounds", true);
-        byte* paramsPtr = stackalloc byte[16];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        TreeLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        TreeRadius = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 12);
+        var funcManaged = s_GetTreeBoundsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetTreeBounds", true);
+        var parms = new GetTreeBounds_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        TreeLocation = parms.TreeLocation;
+        TreeRadius = parms.TreeRadius;
         return;
     }
 
+    static BmSDK.Function s_HasBeenCheckedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasBeenChecked_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasBeenChecked
     /// </summary>
     public unsafe virtual bool HasBeenChecked()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.HasBeenChecked", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasBeenCheckedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.HasBeenChecked", true);
+        var parms = new HasBeenChecked_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_MarkAsCheckedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct MarkAsChecked_Params
+    {
     }
 
     /// <summary>
@@ -258,54 +327,55 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void MarkAsChecked()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.MarkAsChecked", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_MarkAsCheckedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.MarkAsChecked", true);
+        var parms = new MarkAsChecked_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveBranchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveBranch_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveBranch
     /// </summary>
     public unsafe virtual void RemoveBranch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.RemoveBranch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RemoveBranchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.RemoveBranch", true);
+        var parms = new RemoveBranch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BranchContainsLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct BranchContainsLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TestLocation;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: BranchContainsLocation
     /// </summary>
     public unsafe virtual bool BranchContainsLocation(System.Numerics.Vector3 TestLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.BranchContainsLocation", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestLocation, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_BranchContainsLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.BranchContainsLocation", true);
+        var parms = new BranchContainsLocation_Params();
+        parms.TestLocation = TestLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetIntersectionWithHandlePathFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetIntersectionWithHandlePath_Params
+    {
+        [FieldOffset(0)] public nint TestHandle;
+        [FieldOffset(4)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -313,18 +383,11 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RChasePoint GetIntersectionWithHandlePath(BmSDK.BmGame.RNavigationHandle TestHandle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetIntersectionWithHandlePath", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestHandle, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RChasePoint>(paramsPtr + 4);
+        var funcManaged = s_GetIntersectionWithHandlePathFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RChasePoint.GetIntersectionWithHandlePath", true);
+        var parms = new GetIntersectionWithHandlePath_Params();
+        parms.TestHandle = TestHandle?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RChasePoint)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -345,11 +408,7 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: VertID
         /// </summary>
-        public unsafe int VertID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int VertID;
     }
 
     /// <summary>
@@ -372,8 +431,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Vert1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(int*)(Ptr + 60); }
+        set { *(int*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -381,8 +440,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Vert2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(int*)(Ptr + 64); }
+        set { *(int*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -390,8 +449,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int PrevPoly
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(int*)(Ptr + 68); }
+        set { *(int*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -399,8 +458,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NextPoly
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(int*)(Ptr + 72); }
+        set { *(int*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -417,8 +476,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDeadEnd
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 1; else *(int*)(Ptr + 88) &= ~1; }
     }
 
     /// <summary>
@@ -426,8 +485,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bBeenChecked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 2; else *(int*)(Ptr + 88) &= ~2; }
     }
 
     /// <summary>
@@ -435,8 +494,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsVisibleFromRoot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 4; else *(int*)(Ptr + 88) &= ~4; }
     }
 
     /// <summary>
@@ -444,8 +503,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte NumBranches
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(byte*)(Ptr + 92); }
+        set { *(byte*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -453,8 +512,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte NumAssigned
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 93); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 93); }
+        get { return *(byte*)(Ptr + 93); }
+        set { *(byte*)(Ptr + 93) = value; }
     }
 
     /// <summary>
@@ -462,8 +521,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte AbstractChasers
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 94); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 94); }
+        get { return *(byte*)(Ptr + 94); }
+        set { *(byte*)(Ptr + 94) = value; }
     }
 
     /// <summary>
@@ -489,8 +548,8 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DistFromSearchStart
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(float*)(Ptr + 112); }
+        set { *(float*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -507,7 +566,7 @@ public partial class RChasePoint : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DebugID
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(int*)(Ptr + 128); }
+        set { *(int*)(Ptr + 128) = value; }
     }
 }
@@ -78,1743 +78,2723 @@ public partial class RCheatManager : BmSDK.Engine.CheatManager, BmSDK.IGameObjec
         where TComponent : class, Framework.IScriptComponent<RCheatManager>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_TestStatsRevengeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct TestStatsRevenge_Params
+    {
+        [FieldOffset(0)] public int Batman;
+        [FieldOffset(4)] public int Catwoman;
+        [FieldOffset(8)] public int Robin;
+        [FieldOffset(12)] public int Nightwing;
+    }
+
     /// <summary>
     /// Function: TestStatsRevenge
     /// </summary>
     public unsafe virtual void TestStatsRevenge(int Batman, int Catwoman, int Robin, int Nightwing)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsRevenge", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Batman, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Catwoman, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Robin, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Nightwing, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsRevengeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsRevenge", true);
+        var parms = new TestStatsRevenge_Params();
+        parms.Batman = Batman;
+        parms.Catwoman = Catwoman;
+        parms.Robin = Robin;
+        parms.Nightwing = Nightwing;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestStatsUpgradesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct TestStatsUpgrades_Params
+    {
+        [FieldOffset(0)] public int Batman;
+        [FieldOffset(4)] public int Catwoman;
+    }
+
     /// <summary>
     /// Function: TestStatsUpgrades
     /// </summary>
     public unsafe virtual void TestStatsUpgrades(int Batman, int Catwoman)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsUpgrades", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Batman, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Catwoman, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsUpgradesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsUpgrades", true);
+        var parms = new TestStatsUpgrades_Params();
+        parms.Batman = Batman;
+        parms.Catwoman = Catwoman;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestStatsRiddlerGrid100Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TestStatsRiddlerGrid100_Params
+    {
+    }
+
     /// <summary>
     /// Function: TestStatsRiddlerGrid100
     /// </summary>
     public unsafe virtual void TestStatsRiddlerGrid100()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsRiddlerGrid100", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsRiddlerGrid100Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsRiddlerGrid100", true);
+        var parms = new TestStatsRiddlerGrid100_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestStatsRiddlerGridFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct TestStatsRiddlerGrid_Params
+    {
+        [FieldOffset(0)] public int Batman;
+        [FieldOffset(4)] public int Catwoman;
+    }
+
     /// <summary>
     /// Function: TestStatsRiddlerGrid
     /// </summary>
     public unsafe virtual void TestStatsRiddlerGrid(int Batman, int Catwoman)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsRiddlerGrid", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Batman, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Catwoman, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsRiddlerGridFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsRiddlerGrid", true);
+        var parms = new TestStatsRiddlerGrid_Params();
+        parms.Batman = Batman;
+        parms.Catwoman = Catwoman;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestStatsClearRiddlerGridFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TestStatsClearRiddlerGrid_Params
+    {
+    }
+
     /// <summary>
     /// Function: TestStatsClearRiddlerGrid
     /// </summary>
     public unsafe virtual void TestStatsClearRiddlerGrid()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsClearRiddlerGrid", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsClearRiddlerGridFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsClearRiddlerGrid", true);
+        var parms = new TestStatsClearRiddlerGrid_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestStatsCWLootFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TestStatsCWLoot_Params
+    {
+        [FieldOffset(0)] public int Quantity;
+    }
+
     /// <summary>
     /// Function: TestStatsCWLoot
     /// </summary>
     public unsafe virtual void TestStatsCWLoot(int Quantity)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsCWLoot", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Quantity, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsCWLootFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsCWLoot", true);
+        var parms = new TestStatsCWLoot_Params();
+        parms.Quantity = Quantity;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestStatsSide100Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TestStatsSide100_Params
+    {
+    }
+
     /// <summary>
     /// Function: TestStatsSide100
     /// </summary>
     public unsafe virtual void TestStatsSide100()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsSide100", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsSide100Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsSide100", true);
+        var parms = new TestStatsSide100_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestStatsSideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct TestStatsSide_Params
+    {
+        [FieldOffset(0)] public int Azrael;
+        [FieldOffset(4)] public int Bane;
+        [FieldOffset(8)] public int Deadshot;
+        [FieldOffset(12)] public int Hush;
+        [FieldOffset(16)] public int Hatter;
+        [FieldOffset(20)] public int Nora;
+        [FieldOffset(24)] public int Riddler;
+        [FieldOffset(28)] public int Zsasz;
+        [FieldOffset(32)] public int ARTrain;
+        [FieldOffset(36)] public int Iceberg;
+        [FieldOffset(40)] public int Freeze;
+        [FieldOffset(44)] public int Bullies;
+    }
+
     /// <summary>
     /// Function: TestStatsSide
     /// </summary>
     public unsafe virtual void TestStatsSide(int Azrael, int Bane, int Deadshot, int Hush, int Hatter, int Nora, int Riddler, int Zsasz, int ARTrain, int Iceberg, int Freeze, int Bullies)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsSide", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Azrael, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bane, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Deadshot, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Hush, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Hatter, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Nora, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Riddler, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zsasz, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ARTrain, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Iceberg, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Freeze, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bullies, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsSideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsSide", true);
+        var parms = new TestStatsSide_Params();
+        parms.Azrael = Azrael;
+        parms.Bane = Bane;
+        parms.Deadshot = Deadshot;
+        parms.Hush = Hush;
+        parms.Hatter = Hatter;
+        parms.Nora = Nora;
+        parms.Riddler = Riddler;
+        parms.Zsasz = Zsasz;
+        parms.ARTrain = ARTrain;
+        parms.Iceberg = Iceberg;
+        parms.Freeze = Freeze;
+        parms.Bullies = Bullies;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestStatsStoryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TestStatsStory_Params
+    {
+        [FieldOffset(0)] public int Percentage;
+    }
+
     /// <summary>
     /// Function: TestStatsStory
     /// </summary>
     public unsafe virtual void TestStatsStory(int Percentage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsStory", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Percentage, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestStatsStoryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestStatsStory", true);
+        var parms = new TestStatsStory_Params();
+        parms.Percentage = Percentage;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GFxSafeFrameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GFxSafeFrame_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: GFxSafeFrame
     /// </summary>
     public unsafe virtual void GFxSafeFrame(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.GFxSafeFrame", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GFxSafeFrameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.GFxSafeFrame", true);
+        var parms = new GFxSafeFrame_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpamBatarangsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpamBatarangs_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpamBatarangs
     /// </summary>
     public unsafe virtual void SpamBatarangs()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SpamBatarangs", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpamBatarangsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SpamBatarangs", true);
+        var parms = new SpamBatarangs_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MassJamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MassJam_Params
+    {
+    }
+
     /// <summary>
     /// Function: MassJam
     /// </summary>
     public unsafe virtual void MassJam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.MassJam", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MassJamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.MassJam", true);
+        var parms = new MassJam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOffSicknessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TurnOffSickness_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOffSickness
     /// </summary>
     public unsafe virtual void TurnOffSickness()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TurnOffSickness", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOffSicknessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TurnOffSickness", true);
+        var parms = new TurnOffSickness_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestBatmanIncFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TestBatmanInc_Params
+    {
+    }
+
     /// <summary>
     /// Function: TestBatmanInc
     /// </summary>
     public unsafe virtual void TestBatmanInc()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestBatmanInc", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestBatmanIncFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestBatmanInc", true);
+        var parms = new TestBatmanInc_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RiddlerPickupDebugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RiddlerPickupDebug_Params
+    {
+    }
+
     /// <summary>
     /// Function: RiddlerPickupDebug
     /// </summary>
     public unsafe virtual void RiddlerPickupDebug()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.RiddlerPickupDebug", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RiddlerPickupDebugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.RiddlerPickupDebug", true);
+        var parms = new RiddlerPickupDebug_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpPDatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DumpPDat_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpPDat
     /// </summary>
     public unsafe virtual void DumpPDat()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpPDat", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpPDatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpPDat", true);
+        var parms = new DumpPDat_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RiddlerRevealItemsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct RiddlerRevealItems_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString MapName;
+    }
+
     /// <summary>
     /// Function: RiddlerRevealItems
     /// </summary>
     public unsafe virtual void RiddlerRevealItems(BmSDK.FString MapName = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.RiddlerRevealItems", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MapName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RiddlerRevealItemsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.RiddlerRevealItems", true);
+        var parms = new RiddlerRevealItems_Params();
+        parms.MapName = MapName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerHeatConcealEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerHeatConcealEffect_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerHeatConcealEffect
     /// </summary>
     public unsafe virtual void TriggerHeatConcealEffect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TriggerHeatConcealEffect", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerHeatConcealEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TriggerHeatConcealEffect", true);
+        var parms = new TriggerHeatConcealEffect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddScreenShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AddScreenShake_Params
+    {
+        [FieldOffset(0)] public float Strength;
+    }
+
     /// <summary>
     /// Function: AddScreenShake
     /// </summary>
     public unsafe virtual void AddScreenShake(float Strength = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.AddScreenShake", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Strength, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddScreenShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.AddScreenShake", true);
+        var parms = new AddScreenShake_Params();
+        parms.Strength = Strength;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BmRagDollFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BmRagDoll_Params
+    {
+    }
+
     /// <summary>
     /// Function: BmRagDoll
     /// </summary>
     public unsafe virtual void BmRagDoll()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.BmRagDoll", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BmRagDollFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.BmRagDoll", true);
+        var parms = new BmRagDoll_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetControlTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetControlType_Params
+    {
+        [FieldOffset(0)] public int Type;
+    }
+
     /// <summary>
     /// Function: SetControlType
     /// </summary>
     public unsafe virtual void SetControlType(int Type)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetControlType", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetControlTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetControlType", true);
+        var parms = new SetControlType_Params();
+        parms.Type = Type;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSideStoryDebug_ZsaszFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSideStoryDebug_Zsasz_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetSideStoryDebug_Zsasz
     /// </summary>
     public unsafe virtual void SetSideStoryDebug_Zsasz(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Zsasz", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryDebug_ZsaszFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Zsasz", true);
+        var parms = new SetSideStoryDebug_Zsasz_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSideStoryDebug_RiddlerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSideStoryDebug_Riddler_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetSideStoryDebug_Riddler
     /// </summary>
     public unsafe virtual void SetSideStoryDebug_Riddler(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Riddler", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryDebug_RiddlerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Riddler", true);
+        var parms = new SetSideStoryDebug_Riddler_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSideStoryDebug_NoraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSideStoryDebug_Nora_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetSideStoryDebug_Nora
     /// </summary>
     public unsafe virtual void SetSideStoryDebug_Nora(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Nora", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryDebug_NoraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Nora", true);
+        var parms = new SetSideStoryDebug_Nora_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSideStoryDebug_MadHatterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSideStoryDebug_MadHatter_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetSideStoryDebug_MadHatter
     /// </summary>
     public unsafe virtual void SetSideStoryDebug_MadHatter(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_MadHatter", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryDebug_MadHatterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_MadHatter", true);
+        var parms = new SetSideStoryDebug_MadHatter_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSideStoryDebug_HushFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSideStoryDebug_Hush_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetSideStoryDebug_Hush
     /// </summary>
     public unsafe virtual void SetSideStoryDebug_Hush(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Hush", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryDebug_HushFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Hush", true);
+        var parms = new SetSideStoryDebug_Hush_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSideStoryDebug_DeadshotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSideStoryDebug_Deadshot_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetSideStoryDebug_Deadshot
     /// </summary>
     public unsafe virtual void SetSideStoryDebug_Deadshot(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Deadshot", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryDebug_DeadshotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Deadshot", true);
+        var parms = new SetSideStoryDebug_Deadshot_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSideStoryDebug_BaneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSideStoryDebug_Bane_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetSideStoryDebug_Bane
     /// </summary>
     public unsafe virtual void SetSideStoryDebug_Bane(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Bane", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryDebug_BaneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Bane", true);
+        var parms = new SetSideStoryDebug_Bane_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSideStoryDebug_AzraelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSideStoryDebug_Azrael_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetSideStoryDebug_Azrael
     /// </summary>
     public unsafe virtual void SetSideStoryDebug_Azrael(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Azrael", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryDebug_AzraelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetSideStoryDebug_Azrael", true);
+        var parms = new SetSideStoryDebug_Azrael_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SS_RevealFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct SS_Reveal_Params
+    {
+    }
+
     /// <summary>
     /// Function: SS_Reveal
     /// </summary>
     public unsafe virtual void SS_Reveal()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SS_Reveal", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SS_RevealFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SS_Reveal", true);
+        var parms = new SS_Reveal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SS_UnlockFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 13)]
+    private struct SS_Unlock_Params
+    {
+        [FieldOffset(0)] public int bLock;
+    }
+
     /// <summary>
     /// Function: SS_Unlock
     /// </summary>
     public unsafe virtual void SS_Unlock(bool bLock = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SS_Unlock", true);
-        byte* paramsPtr = stackalloc byte[13];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLock, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SS_UnlockFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SS_Unlock", true);
+        var parms = new SS_Unlock_Params();
+        parms.bLock = bLock ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugLoadGameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugLoadGame_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugLoadGame
     /// </summary>
     public unsafe virtual void DebugLoadGame()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugLoadGame", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugLoadGameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugLoadGame", true);
+        var parms = new DebugLoadGame_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CycleAIPhysWalkingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CycleAIPhysWalking_Params
+    {
+    }
+
     /// <summary>
     /// Function: CycleAIPhysWalking
     /// </summary>
     public unsafe virtual void CycleAIPhysWalking()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.CycleAIPhysWalking", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CycleAIPhysWalkingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.CycleAIPhysWalking", true);
+        var parms = new CycleAIPhysWalking_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpPawnsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DumpPawns_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpPawns
     /// </summary>
     public unsafe virtual void DumpPawns()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpPawns", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpPawnsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpPawns", true);
+        var parms = new DumpPawns_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowVPointAttackCacheFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowVPointAttackCache_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowVPointAttackCache
     /// </summary>
     public unsafe virtual void ShowVPointAttackCache()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ShowVPointAttackCache", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowVPointAttackCacheFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ShowVPointAttackCache", true);
+        var parms = new ShowVPointAttackCache_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowProgressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowProgress_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowProgress
     /// </summary>
     public unsafe virtual void ShowProgress()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ShowProgress", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowProgressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ShowProgress", true);
+        var parms = new ShowProgress_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SplitScreenMovieCaptureFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SplitScreenMovieCapture_Params
+    {
+    }
+
     /// <summary>
     /// Function: SplitScreenMovieCapture
     /// </summary>
     public unsafe virtual void SplitScreenMovieCapture()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SplitScreenMovieCapture", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SplitScreenMovieCaptureFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SplitScreenMovieCapture", true);
+        var parms = new SplitScreenMovieCapture_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCamera2PadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCamera2Pad_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCamera2Pad
     /// </summary>
     public unsafe virtual void DebugCamera2Pad()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCamera2Pad", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCamera2PadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCamera2Pad", true);
+        var parms = new DebugCamera2Pad_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KillMeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct KillMe_Params
+    {
+    }
+
     /// <summary>
     /// Function: KillMe
     /// </summary>
     public unsafe virtual void KillMe()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.KillMe", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KillMeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.KillMe", true);
+        var parms = new KillMe_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestLevelHiddenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TestLevelHidden_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName LevelName;
+        [FieldOffset(8)] public int Value;
+    }
+
     /// <summary>
     /// Function: TestLevelHidden
     /// </summary>
     public unsafe virtual void TestLevelHidden(BmSDK.FName LevelName, bool Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestLevelHidden", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LevelName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestLevelHiddenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestLevelHidden", true);
+        var parms = new TestLevelHidden_Params();
+        parms.LevelName = LevelName;
+        parms.Value = Value ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EraseAllLeaderBoardsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EraseAllLeaderBoards_Params
+    {
+    }
+
     /// <summary>
     /// Function: EraseAllLeaderBoards
     /// </summary>
     public unsafe virtual void EraseAllLeaderBoards()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.EraseAllLeaderBoards", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EraseAllLeaderBoardsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.EraseAllLeaderBoards", true);
+        var parms = new EraseAllLeaderBoards_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EraseLeaderBoardFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EraseLeaderBoard_Params
+    {
+        [FieldOffset(0)] public int BoardID;
+    }
+
     /// <summary>
     /// Function: EraseLeaderBoard
     /// </summary>
     public unsafe virtual void EraseLeaderBoard(int BoardID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.EraseLeaderBoard", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BoardID, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EraseLeaderBoardFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.EraseLeaderBoard", true);
+        var parms = new EraseLeaderBoard_Params();
+        parms.BoardID = BoardID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EraseMeFromLeaderBoardFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct EraseMeFromLeaderBoard_Params
+    {
+        [FieldOffset(0)] public int BoardID;
+    }
+
     /// <summary>
     /// Function: EraseMeFromLeaderBoard
     /// </summary>
     public unsafe virtual void EraseMeFromLeaderBoard(int BoardID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.EraseMeFromLeaderBoard", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BoardID, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EraseMeFromLeaderBoardFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.EraseMeFromLeaderBoard", true);
+        var parms = new EraseMeFromLeaderBoard_Params();
+        parms.BoardID = BoardID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHardFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetHard_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetHard
     /// </summary>
     public unsafe virtual void SetHard()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetHard", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHardFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetHard", true);
+        var parms = new SetHard_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNormalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetNormal_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetNormal
     /// </summary>
     public unsafe virtual void SetNormal()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetNormal", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNormalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetNormal", true);
+        var parms = new SetNormal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetEasyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetEasy_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetEasy
     /// </summary>
     public unsafe virtual void SetEasy()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetEasy", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetEasyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetEasy", true);
+        var parms = new SetEasy_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHardDifficultyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetHardDifficulty_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetHardDifficulty
     /// </summary>
     public unsafe virtual void SetHardDifficulty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetHardDifficulty", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHardDifficultyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetHardDifficulty", true);
+        var parms = new SetHardDifficulty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNormalDifficultyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetNormalDifficulty_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetNormalDifficulty
     /// </summary>
     public unsafe virtual void SetNormalDifficulty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetNormalDifficulty", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNormalDifficultyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetNormalDifficulty", true);
+        var parms = new SetNormalDifficulty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetEasyDifficultyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetEasyDifficulty_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetEasyDifficulty
     /// </summary>
     public unsafe virtual void SetEasyDifficulty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetEasyDifficulty", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetEasyDifficultyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SetEasyDifficulty", true);
+        var parms = new SetEasyDifficulty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestTargetCursorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct TestTargetCursor_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString cursorstr;
+        [FieldOffset(12)] public BmSDK.FString Str;
+    }
+
     /// <summary>
     /// Function: TestTargetCursor
     /// </summary>
     public unsafe virtual void TestTargetCursor(BmSDK.FString cursorstr, BmSDK.FString Str)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestTargetCursor", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(cursorstr, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Str, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestTargetCursorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestTargetCursor", true);
+        var parms = new TestTargetCursor_Params();
+        parms.cursorstr = cursorstr;
+        parms.Str = Str;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestScoreSetHPFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TestScoreSetHP_Params
+    {
+        [FieldOffset(0)] public int InCurrent;
+        [FieldOffset(4)] public int InMaximum;
+    }
+
     /// <summary>
     /// Function: TestScoreSetHP
     /// </summary>
     public unsafe virtual void TestScoreSetHP(int InCurrent, int InMaximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestScoreSetHP", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InCurrent, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InMaximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestScoreSetHPFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestScoreSetHP", true);
+        var parms = new TestScoreSetHP_Params();
+        parms.InCurrent = InCurrent;
+        parms.InMaximum = InMaximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestScoreSetXPFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TestScoreSetXP_Params
+    {
+        [FieldOffset(0)] public int InCurrent;
+        [FieldOffset(4)] public int InMaximum;
+    }
+
     /// <summary>
     /// Function: TestScoreSetXP
     /// </summary>
     public unsafe virtual void TestScoreSetXP(int InCurrent, int InMaximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestScoreSetXP", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InCurrent, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InMaximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestScoreSetXPFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestScoreSetXP", true);
+        var parms = new TestScoreSetXP_Params();
+        parms.InCurrent = InCurrent;
+        parms.InMaximum = InMaximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestScoreSetPointsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TestScoreSetPoints_Params
+    {
+        [FieldOffset(0)] public int InCurrent;
+    }
+
     /// <summary>
     /// Function: TestScoreSetPoints
     /// </summary>
     public unsafe virtual void TestScoreSetPoints(int InCurrent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestScoreSetPoints", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InCurrent, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestScoreSetPointsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestScoreSetPoints", true);
+        var parms = new TestScoreSetPoints_Params();
+        parms.InCurrent = InCurrent;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestScoreShowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TestScoreShow_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString show;
+    }
+
     /// <summary>
     /// Function: TestScoreShow
     /// </summary>
     public unsafe virtual void TestScoreShow(BmSDK.FString show)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestScoreShow", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(show, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestScoreShowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestScoreShow", true);
+        var parms = new TestScoreShow_Params();
+        parms.show = show;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TestCombo_Params
+    {
+        [FieldOffset(0)] public int InValue;
+        [FieldOffset(4)] public int PowerUpValue;
+    }
+
     /// <summary>
     /// Function: TestCombo
     /// </summary>
     public unsafe virtual void TestCombo(int InValue, int PowerUpValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestCombo", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InValue, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PowerUpValue, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestCombo", true);
+        var parms = new TestCombo_Params();
+        parms.InValue = InValue;
+        parms.PowerUpValue = PowerUpValue;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestZoomModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TestZoomMode_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString InString;
+    }
+
     /// <summary>
     /// Function: TestZoomMode
     /// </summary>
     public unsafe virtual void TestZoomMode(BmSDK.FString InString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestZoomMode", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InString, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestZoomModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestZoomMode", true);
+        var parms = new TestZoomMode_Params();
+        parms.InString = InString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GiveRiddlerMapFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GiveRiddlerMap_Params
+    {
+    }
+
     /// <summary>
     /// Function: GiveRiddlerMap
     /// </summary>
     public unsafe virtual void GiveRiddlerMap()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.GiveRiddlerMap", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GiveRiddlerMapFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.GiveRiddlerMap", true);
+        var parms = new GiveRiddlerMap_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockRiddlerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnlockRiddler_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockRiddler
     /// </summary>
     public unsafe virtual void UnlockRiddler()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockRiddler", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockRiddlerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockRiddler", true);
+        var parms = new UnlockRiddler_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockCatwomanEpisodesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UnlockCatwomanEpisodes_Params
+    {
+        [FieldOffset(0)] public int bJustCharacter;
+    }
+
     /// <summary>
     /// Function: UnlockCatwomanEpisodes
     /// </summary>
     public unsafe virtual void UnlockCatwomanEpisodes(bool bJustCharacter = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockCatwomanEpisodes", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bJustCharacter, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockCatwomanEpisodesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockCatwomanEpisodes", true);
+        var parms = new UnlockCatwomanEpisodes_Params();
+        parms.bJustCharacter = bJustCharacter ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockTapesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnlockTapes_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockTapes
     /// </summary>
     public unsafe virtual void UnlockTapes()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockTapes", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockTapesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockTapes", true);
+        var parms = new UnlockTapes_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockBiosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnlockBios_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockBios
     /// </summary>
     public unsafe virtual void UnlockBios()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockBios", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockBiosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockBios", true);
+        var parms = new UnlockBios_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockGalleryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnlockGallery_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockGallery
     /// </summary>
     public unsafe virtual void UnlockGallery()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockGallery", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockGalleryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockGallery", true);
+        var parms = new UnlockGallery_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockTapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnlockTape_Params
+    {
+        [FieldOffset(0)] public int Id;
+    }
+
     /// <summary>
     /// Function: UnlockTape
     /// </summary>
     public unsafe virtual void UnlockTape(int Id)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockTape", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockTapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockTape", true);
+        var parms = new UnlockTape_Params();
+        parms.Id = Id;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockCityStoryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnlockCityStory_Params
+    {
+        [FieldOffset(0)] public int StoryId;
+    }
+
     /// <summary>
     /// Function: UnlockCityStory
     /// </summary>
     public unsafe virtual void UnlockCityStory(int StoryId = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockCityStory", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StoryId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockCityStoryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockCityStory", true);
+        var parms = new UnlockCityStory_Params();
+        parms.StoryId = StoryId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockBioFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnlockBio_Params
+    {
+        [FieldOffset(0)] public int Id;
+    }
+
     /// <summary>
     /// Function: UnlockBio
     /// </summary>
     public unsafe virtual void UnlockBio(int Id)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockBio", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockBioFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockBio", true);
+        var parms = new UnlockBio_Params();
+        parms.Id = Id;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockChallengeModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UnlockChallengeMode_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockChallengeMode
     /// </summary>
     public unsafe virtual void UnlockChallengeMode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockChallengeMode", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockChallengeModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockChallengeMode", true);
+        var parms = new UnlockChallengeMode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockChallengeIDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnlockChallengeID_Params
+    {
+        [FieldOffset(0)] public int Id;
+    }
+
     /// <summary>
     /// Function: UnlockChallengeID
     /// </summary>
     public unsafe virtual void UnlockChallengeID(int Id)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockChallengeID", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockChallengeIDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockChallengeID", true);
+        var parms = new UnlockChallengeID_Params();
+        parms.Id = Id;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UCMFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UCM_Params
+    {
+    }
+
     /// <summary>
     /// Function: UCM
     /// </summary>
     public unsafe virtual void UCM()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UCM", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UCMFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UCM", true);
+        var parms = new UCM_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockCharacterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UnlockCharacter_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString CharName;
+    }
+
     /// <summary>
     /// Function: UnlockCharacter
     /// </summary>
     public unsafe virtual void UnlockCharacter(BmSDK.FString CharName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockCharacter", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockCharacterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockCharacter", true);
+        var parms = new UnlockCharacter_Params();
+        parms.CharName = CharName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestAchievementFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TestAchievement_Params
+    {
+        [FieldOffset(0)] public int IDNumber;
+    }
+
     /// <summary>
     /// Function: TestAchievement
     /// </summary>
     public unsafe virtual void TestAchievement(int IDNumber)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestAchievement", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IDNumber, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestAchievementFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestAchievement", true);
+        var parms = new TestAchievement_Params();
+        parms.IDNumber = IDNumber;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockAllAchievementsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnlockAllAchievements_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockAllAchievements
     /// </summary>
     public unsafe virtual void UnlockAllAchievements()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockAllAchievements", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockAllAchievementsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockAllAchievements", true);
+        var parms = new UnlockAllAchievements_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockWayneTechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UnlockWayneTech_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockWayneTech
     /// </summary>
     public unsafe virtual void UnlockWayneTech()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockWayneTech", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockWayneTechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockWayneTech", true);
+        var parms = new UnlockWayneTech_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockAllFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnlockAll_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockAll
     /// </summary>
     public unsafe virtual void UnlockAll()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockAll", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockAllFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockAll", true);
+        var parms = new UnlockAll_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UAFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UA_Params
+    {
+    }
+
     /// <summary>
     /// Function: UA
     /// </summary>
     public unsafe virtual void UA()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UA", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UAFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UA", true);
+        var parms = new UA_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockNewGamePlusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnlockNewGamePlus_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlockNewGamePlus
     /// </summary>
     public unsafe virtual void UnlockNewGamePlus()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockNewGamePlus", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockNewGamePlusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockNewGamePlus", true);
+        var parms = new UnlockNewGamePlus_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestSetGlobalFlagFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct TestSetGlobalFlag_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FlagName;
+        [FieldOffset(12)] public int bSet;
+    }
+
     /// <summary>
     /// Function: TestSetGlobalFlag
     /// </summary>
     public unsafe virtual void TestSetGlobalFlag(BmSDK.FString FlagName, bool bSet = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestSetGlobalFlag", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FlagName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSet, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestSetGlobalFlagFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestSetGlobalFlag", true);
+        var parms = new TestSetGlobalFlag_Params();
+        parms.FlagName = FlagName;
+        parms.bSet = bSet ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestNoSavingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TestNoSaving_Params
+    {
+    }
+
     /// <summary>
     /// Function: TestNoSaving
     /// </summary>
     public unsafe virtual void TestNoSaving()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestNoSaving", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TestNoSavingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TestNoSaving", true);
+        var parms = new TestNoSaving_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetRoomFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetRoom_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetRoom
     /// </summary>
     public unsafe virtual void ResetRoom()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ResetRoom", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetRoomFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ResetRoom", true);
+        var parms = new ResetRoom_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpPawnLevelVolFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DumpPawnLevelVol_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpPawnLevelVol
     /// </summary>
     public unsafe virtual void DumpPawnLevelVol()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpPawnLevelVol", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpPawnLevelVolFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpPawnLevelVol", true);
+        var parms = new DumpPawnLevelVol_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpRoomStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DumpRoomState_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpRoomState
     /// </summary>
     public unsafe virtual void DumpRoomState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpRoomState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpRoomStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpRoomState", true);
+        var parms = new DumpRoomState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpDialogueCoordFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DumpDialogueCoord_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpDialogueCoord
     /// </summary>
     public unsafe virtual void DumpDialogueCoord()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpDialogueCoord", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpDialogueCoordFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpDialogueCoord", true);
+        var parms = new DumpDialogueCoord_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpAllNavFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DumpAllNav_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpAllNav
     /// </summary>
     public unsafe virtual void DumpAllNav()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpAllNav", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpAllNavFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DumpAllNav", true);
+        var parms = new DumpAllNav_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MakeTerrifiedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct MakeTerrified_Params
+    {
+    }
+
     /// <summary>
     /// Function: MakeTerrified
     /// </summary>
     public unsafe virtual void MakeTerrified()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.MakeTerrified", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MakeTerrifiedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.MakeTerrified", true);
+        var parms = new MakeTerrified_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BarkDewedgeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BarkDewedge_Params
+    {
+    }
+
     /// <summary>
     /// Function: BarkDewedge
     /// </summary>
     public unsafe virtual void BarkDewedge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.BarkDewedge", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BarkDewedgeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.BarkDewedge", true);
+        var parms = new BarkDewedge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BarkWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BarkWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: BarkWTF
     /// </summary>
     public unsafe virtual void BarkWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.BarkWTF", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BarkWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.BarkWTF", true);
+        var parms = new BarkWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugTomMillerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugTomMiller_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugTomMiller
     /// </summary>
     public unsafe virtual void DebugTomMiller()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugTomMiller", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugTomMillerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugTomMiller", true);
+        var parms = new DebugTomMiller_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugInteractableItemsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugInteractableItems_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugInteractableItems
     /// </summary>
     public unsafe virtual void DebugInteractableItems()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugInteractableItems", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugInteractableItemsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugInteractableItems", true);
+        var parms = new DebugInteractableItems_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugPlayerObstructionsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugPlayerObstructions_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugPlayerObstructions
     /// </summary>
     public unsafe virtual void DebugPlayerObstructions()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugPlayerObstructions", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugPlayerObstructionsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugPlayerObstructions", true);
+        var parms = new DebugPlayerObstructions_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LockGlideButtonFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LockGlideButton_Params
+    {
+    }
+
     /// <summary>
     /// Function: LockGlideButton
     /// </summary>
     public unsafe virtual void LockGlideButton()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.LockGlideButton", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LockGlideButtonFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.LockGlideButton", true);
+        var parms = new LockGlideButton_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InstantCasualtyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InstantCasualty_Params
+    {
+    }
+
     /// <summary>
     /// Function: InstantCasualty
     /// </summary>
     public unsafe virtual void InstantCasualty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.InstantCasualty", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InstantCasualtyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.InstantCasualty", true);
+        var parms = new InstantCasualty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugUpgradeEquipmentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugUpgradeEquipment_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugUpgradeEquipment
     /// </summary>
     public unsafe virtual void DebugUpgradeEquipment()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugUpgradeEquipment", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugUpgradeEquipmentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugUpgradeEquipment", true);
+        var parms = new DebugUpgradeEquipment_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InfiniteGadgetsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InfiniteGadgets_Params
+    {
+    }
+
     /// <summary>
     /// Function: InfiniteGadgets
     /// </summary>
     public unsafe virtual void InfiniteGadgets()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.InfiniteGadgets", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InfiniteGadgetsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.InfiniteGadgets", true);
+        var parms = new InfiniteGadgets_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugRemoveArmourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugRemoveArmour_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugRemoveArmour
     /// </summary>
     public unsafe virtual void DebugRemoveArmour()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugRemoveArmour", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugRemoveArmourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugRemoveArmour", true);
+        var parms = new DebugRemoveArmour_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugGiveArmourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugGiveArmour_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugGiveArmour
     /// </summary>
     public unsafe virtual void DebugGiveArmour()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugGiveArmour", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugGiveArmourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugGiveArmour", true);
+        var parms = new DebugGiveArmour_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpgradeEquipmentMenuFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpgradeEquipmentMenu_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpgradeEquipmentMenu
     /// </summary>
     public unsafe virtual void UpgradeEquipmentMenu()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UpgradeEquipmentMenu", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpgradeEquipmentMenuFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UpgradeEquipmentMenu", true);
+        var parms = new UpgradeEquipmentMenu_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugGiveFreezeBlastFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugGiveFreezeBlast_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugGiveFreezeBlast
     /// </summary>
     public unsafe virtual void DebugGiveFreezeBlast()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugGiveFreezeBlast", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugGiveFreezeBlastFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugGiveFreezeBlast", true);
+        var parms = new DebugGiveFreezeBlast_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockAllUpgradesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnlockAllUpgrades_Params
+    {
+        [FieldOffset(0)] public int Unlock;
+    }
+
     /// <summary>
     /// Function: UnlockAllUpgrades
     /// </summary>
     public unsafe virtual void UnlockAllUpgrades(bool Unlock = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockAllUpgrades", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Unlock, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockAllUpgradesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlockAllUpgrades", true);
+        var parms = new UnlockAllUpgrades_Params();
+        parms.Unlock = Unlock ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugGiveAllGadgetsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugGiveAllGadgets_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugGiveAllGadgets
     /// </summary>
     public unsafe virtual void DebugGiveAllGadgets()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugGiveAllGadgets", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugGiveAllGadgetsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugGiveAllGadgets", true);
+        var parms = new DebugGiveAllGadgets_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeaponConfigWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct WeaponConfigWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeaponConfigWTF
     /// </summary>
     public unsafe virtual void WeaponConfigWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.WeaponConfigWTF", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeaponConfigWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.WeaponConfigWTF", true);
+        var parms = new WeaponConfigWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PPWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PPWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: PPWTF
     /// </summary>
     public unsafe virtual void PPWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.PPWTF", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PPWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.PPWTF", true);
+        var parms = new PPWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlinkWBIDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnlinkWBID_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnlinkWBID
     /// </summary>
     public unsafe virtual void UnlinkWBID()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlinkWBID", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlinkWBIDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UnlinkWBID", true);
+        var parms = new UnlinkWBID_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayerWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayerWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayerWTF
     /// </summary>
     public unsafe virtual void PlayerWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.PlayerWTF", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.PlayerWTF", true);
+        var parms = new PlayerWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpecialActionXPFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpecialActionXP_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpecialActionXP
     /// </summary>
     public unsafe virtual void SpecialActionXP()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SpecialActionXP", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpecialActionXPFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SpecialActionXP", true);
+        var parms = new SpecialActionXP_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddXPFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AddXP_Params
+    {
+    }
+
     /// <summary>
     /// Function: AddXP
     /// </summary>
     public unsafe virtual void AddXP()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.AddXP", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddXPFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.AddXP", true);
+        var parms = new AddXP_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugForce3rdPersonCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugForce3rdPersonCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugForce3rdPersonCamera
     /// </summary>
     public unsafe virtual void DebugForce3rdPersonCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugForce3rdPersonCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugForce3rdPersonCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugForce3rdPersonCamera", true);
+        var parms = new DebugForce3rdPersonCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCamera
     /// </summary>
     public unsafe virtual void DebugCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCamera", true);
+        var parms = new DebugCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleMagicGunStartleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ToggleMagicGunStartle_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleMagicGunStartle
     /// </summary>
     public unsafe virtual void ToggleMagicGunStartle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleMagicGunStartle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleMagicGunStartleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleMagicGunStartle", true);
+        var parms = new ToggleMagicGunStartle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleMagicSmasherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ToggleMagicSmasher_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleMagicSmasher
     /// </summary>
     public unsafe virtual void ToggleMagicSmasher()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleMagicSmasher", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleMagicSmasherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleMagicSmasher", true);
+        var parms = new ToggleMagicSmasher_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleAIPathsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ToggleAIPaths_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleAIPaths
     /// </summary>
     public unsafe virtual void ToggleAIPaths()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleAIPaths", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleAIPathsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleAIPaths", true);
+        var parms = new ToggleAIPaths_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TogglePathsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TogglePaths_Params
+    {
+    }
+
     /// <summary>
     /// Function: TogglePaths
     /// </summary>
     public unsafe virtual void TogglePaths()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TogglePaths", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TogglePathsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TogglePaths", true);
+        var parms = new TogglePaths_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TogglePhysicsGrabberFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TogglePhysicsGrabber_Params
+    {
+    }
+
     /// <summary>
     /// Function: TogglePhysicsGrabber
     /// </summary>
     public unsafe virtual void TogglePhysicsGrabber()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TogglePhysicsGrabber", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TogglePhysicsGrabberFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TogglePhysicsGrabber", true);
+        var parms = new TogglePhysicsGrabber_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOffEnemiesCanAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TurnOffEnemiesCanAttack_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOffEnemiesCanAttack
     /// </summary>
     public unsafe virtual void TurnOffEnemiesCanAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TurnOffEnemiesCanAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOffEnemiesCanAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TurnOffEnemiesCanAttack", true);
+        var parms = new TurnOffEnemiesCanAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleEnemiesCanAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ToggleEnemiesCanAttack_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleEnemiesCanAttack
     /// </summary>
     public unsafe virtual void ToggleEnemiesCanAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleEnemiesCanAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleEnemiesCanAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleEnemiesCanAttack", true);
+        var parms = new ToggleEnemiesCanAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayThoughtsOnAllFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisplayThoughtsOnAll_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisplayThoughtsOnAll
     /// </summary>
     public unsafe virtual void DisplayThoughtsOnAll()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DisplayThoughtsOnAll", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayThoughtsOnAllFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DisplayThoughtsOnAll", true);
+        var parms = new DisplayThoughtsOnAll_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StepPawnDisplayingThoughtsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct StepPawnDisplayingThoughts_Params
+    {
+    }
+
     /// <summary>
     /// Function: StepPawnDisplayingThoughts
     /// </summary>
     public unsafe virtual void StepPawnDisplayingThoughts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.StepPawnDisplayingThoughts", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StepPawnDisplayingThoughtsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.StepPawnDisplayingThoughts", true);
+        var parms = new StepPawnDisplayingThoughts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleThoughtsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ToggleThoughts_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleThoughts
     /// </summary>
     public unsafe virtual void ToggleThoughts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleThoughts", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleThoughtsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleThoughts", true);
+        var parms = new ToggleThoughts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugViewDistFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DebugViewDist_Params
+    {
+        [FieldOffset(0)] public float newdist;
+    }
+
     /// <summary>
     /// Function: DebugViewDist
     /// </summary>
     public unsafe virtual void DebugViewDist(float newdist)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugViewDist", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(newdist, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugViewDistFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugViewDist", true);
+        var parms = new DebugViewDist_Params();
+        parms.newdist = newdist;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugFocusViewDistFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DebugFocusViewDist_Params
+    {
+        [FieldOffset(0)] public float newdist;
+    }
+
     /// <summary>
     /// Function: DebugFocusViewDist
     /// </summary>
     public unsafe virtual void DebugFocusViewDist(float newdist)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugFocusViewDist", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(newdist, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugFocusViewDistFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugFocusViewDist", true);
+        var parms = new DebugFocusViewDist_Params();
+        parms.newdist = newdist;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugExtendedViewDistFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DebugExtendedViewDist_Params
+    {
+        [FieldOffset(0)] public float newdist;
+    }
+
     /// <summary>
     /// Function: DebugExtendedViewDist
     /// </summary>
     public unsafe virtual void DebugExtendedViewDist(float newdist)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugExtendedViewDist", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(newdist, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugExtendedViewDistFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugExtendedViewDist", true);
+        var parms = new DebugExtendedViewDist_Params();
+        parms.newdist = newdist;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugVertFovFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DebugVertFov_Params
+    {
+        [FieldOffset(0)] public int NewFOV;
+    }
+
     /// <summary>
     /// Function: DebugVertFov
     /// </summary>
     public unsafe virtual void DebugVertFov(int NewFOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugVertFov", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewFOV, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugVertFovFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugVertFov", true);
+        var parms = new DebugVertFov_Params();
+        parms.NewFOV = NewFOV;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugFovFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DebugFov_Params
+    {
+        [FieldOffset(0)] public int NewFOV;
+    }
+
     /// <summary>
     /// Function: DebugFov
     /// </summary>
     public unsafe virtual void DebugFov(int NewFOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugFov", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewFOV, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugFovFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugFov", true);
+        var parms = new DebugFov_Params();
+        parms.NewFOV = NewFOV;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopDebugCameraMovementFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopDebugCameraMovement_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopDebugCameraMovement
     /// </summary>
     public unsafe virtual void StopDebugCameraMovement()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.StopDebugCameraMovement", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopDebugCameraMovementFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.StopDebugCameraMovement", true);
+        var parms = new StopDebugCameraMovement_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraZoomOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugCameraZoomOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraZoomOut
     /// </summary>
     public unsafe virtual void DebugCameraZoomOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraZoomOut", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraZoomOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraZoomOut", true);
+        var parms = new DebugCameraZoomOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraZoomInFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugCameraZoomIn_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraZoomIn
     /// </summary>
     public unsafe virtual void DebugCameraZoomIn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraZoomIn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraZoomInFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraZoomIn", true);
+        var parms = new DebugCameraZoomIn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraBackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugCameraBack_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraBack
     /// </summary>
     public unsafe virtual void DebugCameraBack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraBack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraBackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraBack", true);
+        var parms = new DebugCameraBack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraForwardFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugCameraForward_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraForward
     /// </summary>
     public unsafe virtual void DebugCameraForward()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraForward", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraForwardFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraForward", true);
+        var parms = new DebugCameraForward_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraRightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugCameraRight_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraRight
     /// </summary>
     public unsafe virtual void DebugCameraRight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraRight", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraRightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraRight", true);
+        var parms = new DebugCameraRight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugCameraLeft_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraLeft
     /// </summary>
     public unsafe virtual void DebugCameraLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraLeft", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraLeft", true);
+        var parms = new DebugCameraLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugCameraUp_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraUp
     /// </summary>
     public unsafe virtual void DebugCameraUp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraUp", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraUp", true);
+        var parms = new DebugCameraUp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DebugCameraDown_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraDown
     /// </summary>
     public unsafe virtual void DebugCameraDown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraDown", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugCameraDown", true);
+        var parms = new DebugCameraDown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugKillAllEnemiesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugKillAllEnemies_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugKillAllEnemies
     /// </summary>
     public unsafe virtual void DebugKillAllEnemies()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugKillAllEnemies", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugKillAllEnemiesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.DebugKillAllEnemies", true);
+        var parms = new DebugKillAllEnemies_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetSpottedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetSpotted_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetSpotted
     /// </summary>
     public unsafe virtual void ResetSpotted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ResetSpotted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetSpottedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ResetSpotted", true);
+        var parms = new ResetSpotted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpecialMoveCheatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpecialMoveCheat_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpecialMoveCheat
     /// </summary>
     public unsafe virtual void SpecialMoveCheat()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SpecialMoveCheat", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpecialMoveCheatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.SpecialMoveCheat", true);
+        var parms = new SpecialMoveCheat_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RestoreHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RestoreHealth_Params
+    {
+    }
+
     /// <summary>
     /// Function: RestoreHealth
     /// </summary>
     public unsafe virtual void RestoreHealth()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.RestoreHealth", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RestoreHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.RestoreHealth", true);
+        var parms = new RestoreHealth_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InvisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Invisible_Params
+    {
+    }
+
     /// <summary>
     /// Function: Invisible
     /// </summary>
     public unsafe virtual void Invisible()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.Invisible", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InvisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.Invisible", true);
+        var parms = new Invisible_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpgradeMagFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpgradeMag_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpgradeMag
     /// </summary>
     public unsafe virtual void UpgradeMag()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UpgradeMag", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpgradeMagFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.UpgradeMag", true);
+        var parms = new UpgradeMag_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PauseAndPanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PauseAndPan_Params
+    {
+    }
+
     /// <summary>
     /// Function: PauseAndPan
     /// </summary>
     public unsafe virtual void PauseAndPan()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.PauseAndPan", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PauseAndPanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.PauseAndPan", true);
+        var parms = new PauseAndPan_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TeleportFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Teleport_Params
+    {
+    }
+
     /// <summary>
     /// Function: Teleport
     /// </summary>
     public unsafe override void Teleport()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.Teleport", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TeleportFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.Teleport", true);
+        var parms = new Teleport_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerRandomOverlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerRandomOverlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerRandomOverlay
     /// </summary>
     public unsafe virtual void TriggerRandomOverlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TriggerRandomOverlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerRandomOverlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.TriggerRandomOverlay", true);
+        var parms = new TriggerRandomOverlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RefreshPathsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RefreshPaths_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshPaths
     /// </summary>
     public unsafe virtual void RefreshPaths()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.RefreshPaths", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshPathsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.RefreshPaths", true);
+        var parms = new RefreshPaths_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableDebugCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableDebugCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableDebugCamera
     /// </summary>
     public unsafe override void EnableDebugCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.EnableDebugCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableDebugCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.EnableDebugCamera", true);
+        var parms = new EnableDebugCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleLowSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleLowSpeed_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleLowSpeed
     /// </summary>
     public unsafe virtual void ToggleLowSpeed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleLowSpeed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleLowSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleLowSpeed", true);
+        var parms = new ToggleLowSpeed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleSuperHighSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleSuperHighSpeed_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleSuperHighSpeed
     /// </summary>
     public unsafe virtual void ToggleSuperHighSpeed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleSuperHighSpeed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleSuperHighSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleSuperHighSpeed", true);
+        var parms = new ToggleSuperHighSpeed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleHighSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleHighSpeed_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleHighSpeed
     /// </summary>
     public unsafe virtual void ToggleHighSpeed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleHighSpeed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleHighSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleHighSpeed", true);
+        var parms = new ToggleHighSpeed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SlomoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Slomo_Params
+    {
+        [FieldOffset(0)] public float T;
+    }
+
     /// <summary>
     /// Function: Slomo
     /// </summary>
     public unsafe override void Slomo(float T)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.Slomo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(T, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SlomoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.Slomo", true);
+        var parms = new Slomo_Params();
+        parms.T = T;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleGhostFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleGhost_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleGhost
     /// </summary>
     public unsafe virtual void ToggleGhost()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleGhost", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleGhostFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleGhost", true);
+        var parms = new ToggleGhost_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReloadLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReloadLevel_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReloadLevel
     /// </summary>
     public unsafe virtual void ReloadLevel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ReloadLevel", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReloadLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ReloadLevel", true);
+        var parms = new ReloadLevel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleScreenshotCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleScreenshotCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleScreenshotCamera
     /// </summary>
     public unsafe virtual void ToggleScreenshotCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleScreenshotCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleScreenshotCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleScreenshotCamera", true);
+        var parms = new ToggleScreenshotCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleLookInvertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleLookInvert_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleLookInvert
     /// </summary>
     public unsafe virtual void ToggleLookInvert()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleLookInvert", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleLookInvertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ToggleLookInvert", true);
+        var parms = new ToggleLookInvert_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GotoNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GotoName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString InName;
+    }
+
     /// <summary>
     /// Function: GotoName
     /// </summary>
     public unsafe virtual void GotoName(BmSDK.FString InName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.GotoName", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GotoNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.GotoName", true);
+        var parms = new GotoName_Params();
+        parms.InName = InName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ListNamesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct ListNames_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString InName;
+    }
+
     /// <summary>
     /// Function: ListNames
     /// </summary>
     public unsafe virtual void ListNames(BmSDK.FString InName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ListNames", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ListNamesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ListNames", true);
+        var parms = new ListNames_Params();
+        parms.InName = InName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ListDynamicActorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ListDynamicActors_Params
+    {
+    }
+
     /// <summary>
     /// Function: ListDynamicActors
     /// </summary>
     public unsafe override void ListDynamicActors()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ListDynamicActors", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ListDynamicActorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCheatManager.ListDynamicActors", true);
+        var parms = new ListDynamicActors_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -1823,8 +2803,8 @@ public partial class RCheatManager : BmSDK.Engine.CheatManager, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bIgnoreDamage
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 1; else *(int*)(Ptr + 76) &= ~1; }
     }
 
     /// <summary>
@@ -1832,8 +2812,8 @@ public partial class RCheatManager : BmSDK.Engine.CheatManager, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCapeForwards
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 2; else *(int*)(Ptr + 76) &= ~2; }
     }
 
     /// <summary>
@@ -1841,8 +2821,8 @@ public partial class RCheatManager : BmSDK.Engine.CheatManager, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCapeGliding
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 4; else *(int*)(Ptr + 76) &= ~4; }
     }
 
     /// <summary>
@@ -1850,7 +2830,7 @@ public partial class RCheatManager : BmSDK.Engine.CheatManager, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUnlockedAllUpgrades
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 8; else *(int*)(Ptr + 76) &= ~8; }
     }
 }
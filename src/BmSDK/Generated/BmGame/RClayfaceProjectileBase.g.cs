@@ -73,16 +73,24 @@ public partial class RClayfaceProjectileBase : BmSDK.Engine.DynamicSMActor, BmSD
         where TComponent : class, Framework.IScriptComponent<RClayfaceProjectileBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HitLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct HitLevel_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 HitNormal;
+    }
+
     /// <summary>
     /// Function: HitLevel
     /// </summary>
     public unsafe virtual void HitLevel(System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 HitNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RClayfaceProjectileBase.HitLevel", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RClayfaceProjectileBase.HitLevel", true);
+        var parms = new HitLevel_Params();
+        parms.HitLocation = HitLocation;
+        parms.HitNormal = HitNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -78,91 +78,144 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
         where TComponent : class, Framework.IScriptComponent<RCombatMove_LunaticGrab_Cam>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_EndCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EndCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: EndCamera
     /// </summary>
     public unsafe virtual void EndCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.EndCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EndCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.EndCamera", true);
+        var parms = new EndCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.Tick", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDestLookAtPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetDestLookAtPoint_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetDestLookAtPoint
     /// </summary>
     public unsafe virtual void SetDestLookAtPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.SetDestLookAtPoint", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDestLookAtPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.SetDestLookAtPoint", true);
+        var parms = new SetDestLookAtPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCamStageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SetCamStage_Params
+    {
+        [FieldOffset(0)] public int NewStage;
+        [FieldOffset(4)] public System.Numerics.Vector3 ForDir;
+        [FieldOffset(16)] public int bSnap;
+    }
+
     /// <summary>
     /// Function: SetCamStage
     /// </summary>
     public unsafe virtual void SetCamStage(int NewStage, System.Numerics.Vector3 ForDir, bool bSnap = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.SetCamStage", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewStage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForDir, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSnap, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCamStageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.SetCamStage", true);
+        var parms = new SetCamStage_Params();
+        parms.NewStage = NewStage;
+        parms.ForDir = ForDir;
+        parms.bSnap = bSnap ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateProgressLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateProgressLevel_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateProgressLevel
     /// </summary>
     public unsafe virtual void UpdateProgressLevel(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.UpdateProgressLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateProgressLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.UpdateProgressLevel", true);
+        var parms = new UpdateProgressLevel_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetProgressLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetProgressLevel_Params
+    {
+        [FieldOffset(0)] public float NormalisedProgress;
+    }
+
     /// <summary>
     /// Function: SetProgressLevel
     /// </summary>
     public unsafe virtual void SetProgressLevel(float NormalisedProgress)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.SetProgressLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NormalisedProgress, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetProgressLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.SetProgressLevel", true);
+        var parms = new SetProgressLevel_Params();
+        parms.NormalisedProgress = NormalisedProgress;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct StartCamera_Params
+    {
+        [FieldOffset(0)] public nint BatmanPawn;
+        [FieldOffset(4)] public System.Numerics.Vector3 ForDir;
+        [FieldOffset(16)] public float NewStage2HeightOffset;
+        [FieldOffset(20)] public float NewCamDistMulti;
+        [FieldOffset(24)] public float NewCamDropOffset;
+    }
+
     /// <summary>
     /// Function: StartCamera
     /// </summary>
     public unsafe virtual void StartCamera(BmSDK.BmGame.RPawnCombat BatmanPawn, System.Numerics.Vector3 ForDir, float NewStage2HeightOffset = default, float NewCamDistMulti = default, float NewCamDropOffset = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.StartCamera", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BatmanPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForDir, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewStage2HeightOffset, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCamDistMulti, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCamDropOffset, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_LunaticGrab_Cam.StartCamera", true);
+        var parms = new StartCamera_Params();
+        parms.BatmanPawn = BatmanPawn?.Ptr ?? 0;
+        parms.ForDir = ForDir;
+        parms.NewStage2HeightOffset = NewStage2HeightOffset;
+        parms.NewCamDistMulti = NewCamDistMulti;
+        parms.NewCamDropOffset = NewCamDropOffset;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -180,8 +233,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CamYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 856); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 856); }
+        get { return *(float*)(Ptr + 856); }
+        set { *(float*)(Ptr + 856) = value; }
     }
 
     /// <summary>
@@ -189,8 +242,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe bool bStarted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 860) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 860); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 860); }
+        get { return (*(int*)(Ptr + 860) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 860) |= 1; else *(int*)(Ptr + 860) &= ~1; }
     }
 
     /// <summary>
@@ -198,8 +251,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe int CamStage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 864); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 864); }
+        get { return *(int*)(Ptr + 864); }
+        set { *(int*)(Ptr + 864) = value; }
     }
 
     /// <summary>
@@ -213,8 +266,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CamDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 880); }
+        get { return *(float*)(Ptr + 880); }
+        set { *(float*)(Ptr + 880) = value; }
     }
 
     /// <summary>
@@ -222,8 +275,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float MinCamDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 884); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 884); }
+        get { return *(float*)(Ptr + 884); }
+        set { *(float*)(Ptr + 884) = value; }
     }
 
     /// <summary>
@@ -231,8 +284,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float MaxCamDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 888); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 888); }
+        get { return *(float*)(Ptr + 888); }
+        set { *(float*)(Ptr + 888) = value; }
     }
 
     /// <summary>
@@ -240,8 +293,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CamDropAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 892); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 892); }
+        get { return *(float*)(Ptr + 892); }
+        set { *(float*)(Ptr + 892) = value; }
     }
 
     /// <summary>
@@ -249,8 +302,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float MinCamDropAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 896); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 896); }
+        get { return *(float*)(Ptr + 896); }
+        set { *(float*)(Ptr + 896) = value; }
     }
 
     /// <summary>
@@ -258,8 +311,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float MaxCamDropAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 900); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 900); }
+        get { return *(float*)(Ptr + 900); }
+        set { *(float*)(Ptr + 900) = value; }
     }
 
     /// <summary>
@@ -267,8 +320,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CamRotateSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 904); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 904); }
+        get { return *(float*)(Ptr + 904); }
+        set { *(float*)(Ptr + 904) = value; }
     }
 
     /// <summary>
@@ -276,8 +329,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CamShakeScalar
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 908); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 908); }
+        get { return *(float*)(Ptr + 908); }
+        set { *(float*)(Ptr + 908) = value; }
     }
 
     /// <summary>
@@ -285,8 +338,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CurrProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 912); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 912); }
+        get { return *(float*)(Ptr + 912); }
+        set { *(float*)(Ptr + 912) = value; }
     }
 
     /// <summary>
@@ -294,8 +347,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float DestProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 916); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 916); }
+        get { return *(float*)(Ptr + 916); }
+        set { *(float*)(Ptr + 916) = value; }
     }
 
     /// <summary>
@@ -303,8 +356,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CamUpdateSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 920); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 920); }
+        get { return *(float*)(Ptr + 920); }
+        set { *(float*)(Ptr + 920) = value; }
     }
 
     /// <summary>
@@ -324,8 +377,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float Stage2HeightOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 948); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 948); }
+        get { return *(float*)(Ptr + 948); }
+        set { *(float*)(Ptr + 948) = value; }
     }
 
     /// <summary>
@@ -333,8 +386,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CamDistMulti
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 952); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 952); }
+        get { return *(float*)(Ptr + 952); }
+        set { *(float*)(Ptr + 952) = value; }
     }
 
     /// <summary>
@@ -342,8 +395,8 @@ public partial class RCombatMove_LunaticGrab_Cam : BmSDK.Engine.CameraActor, BmS
     /// </summary>
     public unsafe float CamDropOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 956); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 956); }
+        get { return *(float*)(Ptr + 956); }
+        set { *(float*)(Ptr + 956) = value; }
     }
 
     /// <summary>
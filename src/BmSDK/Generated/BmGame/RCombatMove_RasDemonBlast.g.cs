@@ -78,61 +78,100 @@ public partial class RCombatMove_RasDemonBlast : BmSDK.BmGame.RCombatMove_RasAtt
         where TComponent : class, Framework.IScriptComponent<RCombatMove_RasDemonBlast>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ExitMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ExitMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: ExitMove
     /// </summary>
     public unsafe override void ExitMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.ExitMove", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ExitMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.ExitMove", true);
+        var parms = new ExitMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartChargeUpFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartChargeUpFX_Params
+    {
+        [FieldOffset(0)] public int Variation;
+    }
+
     /// <summary>
     /// Function: StartChargeUpFX
     /// </summary>
     public unsafe virtual void StartChargeUpFX(int Variation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.StartChargeUpFX", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Variation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartChargeUpFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.StartChargeUpFX", true);
+        var parms = new StartChargeUpFX_Params();
+        parms.Variation = Variation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnTryQueueNextThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnTryQueueNextThrow_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnTryQueueNextThrow
     /// </summary>
     public unsafe virtual void OnTryQueueNextThrow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.OnTryQueueNextThrow", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnTryQueueNextThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.OnTryQueueNextThrow", true);
+        var parms = new OnTryQueueNextThrow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnReleaseShurikanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnReleaseShurikan_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnReleaseShurikan
     /// </summary>
     public unsafe virtual void OnReleaseShurikan()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.OnReleaseShurikan", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnReleaseShurikanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.OnReleaseShurikan", true);
+        var parms = new OnReleaseShurikan_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetThrowTransitionNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetThrowTransitionName_Params
+    {
+        [FieldOffset(0)] public int Variation;
+        [FieldOffset(4)] public BmSDK.FName ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetThrowTransitionName
     /// </summary>
     public unsafe virtual BmSDK.FName GetThrowTransitionName(int Variation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.GetThrowTransitionName", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Variation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 4);
+        var funcManaged = s_GetThrowTransitionNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.GetThrowTransitionName", true);
+        var parms = new GetThrowTransitionName_Params();
+        parms.Variation = Variation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SelectThrowVariationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SelectThrowVariation_Params
+    {
     }
 
     /// <summary>
@@ -140,21 +179,34 @@ public partial class RCombatMove_RasDemonBlast : BmSDK.BmGame.RCombatMove_RasAtt
     /// </summary>
     public unsafe virtual void SelectThrowVariation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.SelectThrowVariation", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SelectThrowVariationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.SelectThrowVariation", true);
+        var parms = new SelectThrowVariation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsAttackingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsAttacking_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsAttacking
     /// </summary>
     public unsafe override bool IsAttacking()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.IsAttacking", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsAttackingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.IsAttacking", true);
+        var parms = new IsAttacking_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Initialise_Params
+    {
     }
 
     /// <summary>
@@ -162,9 +214,9 @@ public partial class RCombatMove_RasDemonBlast : BmSDK.BmGame.RCombatMove_RasAtt
     /// </summary>
     public unsafe override void Initialise()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.Initialise", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasDemonBlast.Initialise", true);
+        var parms = new Initialise_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -197,8 +249,8 @@ public partial class RCombatMove_RasDemonBlast : BmSDK.BmGame.RCombatMove_RasAtt
     /// </summary>
     public unsafe int NumThrows
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 528); }
+        get { return *(int*)(Ptr + 528); }
+        set { *(int*)(Ptr + 528) = value; }
     }
 
     /// <summary>
@@ -206,8 +258,8 @@ public partial class RCombatMove_RasDemonBlast : BmSDK.BmGame.RCombatMove_RasAtt
     /// </summary>
     public unsafe int NumThrowVariations
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(int*)(Ptr + 532); }
+        set { *(int*)(Ptr + 532) = value; }
     }
 
     /// <summary>
@@ -215,7 +267,7 @@ public partial class RCombatMove_RasDemonBlast : BmSDK.BmGame.RCombatMove_RasAtt
     /// </summary>
     public unsafe int CurrentThrowVariation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }
+        get { return *(int*)(Ptr + 536); }
+        set { *(int*)(Ptr + 536) = value; }
     }
 }
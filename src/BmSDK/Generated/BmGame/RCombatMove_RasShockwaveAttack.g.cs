@@ -78,26 +78,46 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
         where TComponent : class, Framework.IScriptComponent<RCombatMove_RasShockwaveAttack>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ExitMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ExitMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: ExitMove
     /// </summary>
     public unsafe override void ExitMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasShockwaveAttack.ExitMove", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ExitMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasShockwaveAttack.ExitMove", true);
+        var parms = new ExitMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsAttackingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsAttacking_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsAttacking
     /// </summary>
     public unsafe override bool IsAttacking()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasShockwaveAttack.IsAttacking", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsAttackingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasShockwaveAttack.IsAttacking", true);
+        var parms = new IsAttacking_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UnleashAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnleashAttack_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -105,10 +125,16 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe override bool UnleashAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasShockwaveAttack.UnleashAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_UnleashAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasShockwaveAttack.UnleashAttack", true);
+        var parms = new UnleashAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Initialise_Params
+    {
     }
 
     /// <summary>
@@ -116,9 +142,9 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe override void Initialise()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasShockwaveAttack.Initialise", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCombatMove_RasShockwaveAttack.Initialise", true);
+        var parms = new Initialise_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -127,8 +153,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe BmSDK.FName InMoveStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(BmSDK.FName*)(Ptr + 516); }
+        set { *(BmSDK.FName*)(Ptr + 516) = value; }
     }
 
     /// <summary>
@@ -136,8 +162,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe BmSDK.FName InTransition
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(BmSDK.FName*)(Ptr + 524); }
+        set { *(BmSDK.FName*)(Ptr + 524) = value; }
     }
 
     /// <summary>
@@ -145,8 +171,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe BmSDK.FName DestMoveStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(BmSDK.FName*)(Ptr + 532); }
+        set { *(BmSDK.FName*)(Ptr + 532) = value; }
     }
 
     /// <summary>
@@ -154,8 +180,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe BmSDK.FName ShockwaveTransition
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(BmSDK.FName*)(Ptr + 540); }
+        set { *(BmSDK.FName*)(Ptr + 540) = value; }
     }
 
     /// <summary>
@@ -163,8 +189,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe float ShockwaveActiveTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(float*)(Ptr + 548); }
+        set { *(float*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -172,8 +198,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe float ShockwaveTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(float*)(Ptr + 552); }
+        set { *(float*)(Ptr + 552) = value; }
     }
 
     /// <summary>
@@ -181,8 +207,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe float DamageRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(float*)(Ptr + 556); }
+        set { *(float*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -196,8 +222,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe bool bDodged
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 564); }
+        get { return (*(int*)(Ptr + 564) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 564) |= 1; else *(int*)(Ptr + 564) &= ~1; }
     }
 
     /// <summary>
@@ -205,8 +231,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe bool bShockwaveActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 564); }
+        get { return (*(int*)(Ptr + 564) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 564) |= 2; else *(int*)(Ptr + 564) &= ~2; }
     }
 
     /// <summary>
@@ -214,8 +240,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe bool bFirstCollisionCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 564); }
+        get { return (*(int*)(Ptr + 564) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 564) |= 4; else *(int*)(Ptr + 564) &= ~4; }
     }
 
     /// <summary>
@@ -223,8 +249,8 @@ public partial class RCombatMove_RasShockwaveAttack : BmSDK.BmGame.RCombatMove_R
     /// </summary>
     public unsafe float OriginalRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 568); }
+        get { return *(float*)(Ptr + 568); }
+        set { *(float*)(Ptr + 568) = value; }
     }
 
     /// <summary>
@@ -78,147 +78,226 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
         where TComponent : class, Framework.IScriptComponent<RControllableChatteringTeethBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_AlertPeopleToExplosionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AlertPeopleToExplosion_Params
+    {
+    }
+
     /// <summary>
     /// Function: AlertPeopleToExplosion
     /// </summary>
     public unsafe virtual void AlertPeopleToExplosion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.AlertPeopleToExplosion", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AlertPeopleToExplosionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.AlertPeopleToExplosion", true);
+        var parms = new AlertPeopleToExplosion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DamageNearbyFractureWallsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DamageNearbyFractureWalls_Params
+    {
+    }
+
     /// <summary>
     /// Function: DamageNearbyFractureWalls
     /// </summary>
     public unsafe virtual void DamageNearbyFractureWalls()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.DamageNearbyFractureWalls", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DamageNearbyFractureWallsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.DamageNearbyFractureWalls", true);
+        var parms = new DamageNearbyFractureWalls_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DamageNearbyPeopleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DamageNearbyPeople_Params
+    {
+    }
+
     /// <summary>
     /// Function: DamageNearbyPeople
     /// </summary>
     public unsafe virtual void DamageNearbyPeople()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.DamageNearbyPeople", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DamageNearbyPeopleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.DamageNearbyPeople", true);
+        var parms = new DamageNearbyPeople_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerExplodeEffectsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerExplodeEffects_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerExplodeEffects
     /// </summary>
     public unsafe virtual void TriggerExplodeEffects()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.TriggerExplodeEffects", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerExplodeEffectsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.TriggerExplodeEffects", true);
+        var parms = new TriggerExplodeEffects_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerDropSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerDropSound_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerDropSound
     /// </summary>
     public unsafe virtual void TriggerDropSound()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.TriggerDropSound", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerDropSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.TriggerDropSound", true);
+        var parms = new TriggerDropSound_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerExplosionRumbleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerExplosionRumble_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerExplosionRumble
     /// </summary>
     public unsafe virtual void TriggerExplosionRumble()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.TriggerExplosionRumble", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerExplosionRumbleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.TriggerExplosionRumble", true);
+        var parms = new TriggerExplosionRumble_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ApplyExplosionCameraShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ApplyExplosionCameraShake_Params
+    {
+    }
+
     /// <summary>
     /// Function: ApplyExplosionCameraShake
     /// </summary>
     public unsafe virtual void ApplyExplosionCameraShake()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.ApplyExplosionCameraShake", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ApplyExplosionCameraShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.ApplyExplosionCameraShake", true);
+        var parms = new ApplyExplosionCameraShake_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveTeethPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveTeethPhysics_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveTeethPhysics
     /// </summary>
     public unsafe virtual void RemoveTeethPhysics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.RemoveTeethPhysics", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveTeethPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.RemoveTeethPhysics", true);
+        var parms = new RemoveTeethPhysics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishStandSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinishStandSpecialMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinishStandSpecialMove
     /// </summary>
     public unsafe virtual void FinishStandSpecialMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.FinishStandSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishStandSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.FinishStandSpecialMove", true);
+        var parms = new FinishStandSpecialMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyTeethCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DestroyTeethCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: DestroyTeethCamera
     /// </summary>
     public unsafe virtual void DestroyTeethCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.DestroyTeethCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyTeethCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.DestroyTeethCamera", true);
+        var parms = new DestroyTeethCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyTeethFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DestroyTeeth_Params
+    {
+    }
+
     /// <summary>
     /// Function: DestroyTeeth
     /// </summary>
     public unsafe virtual void DestroyTeeth()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.DestroyTeeth", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyTeethFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.DestroyTeeth", true);
+        var parms = new DestroyTeeth_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayPreExplodeAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayPreExplodeAnim_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayPreExplodeAnim
     /// </summary>
     public unsafe virtual void PlayPreExplodeAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.PlayPreExplodeAnim", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayPreExplodeAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.PlayPreExplodeAnim", true);
+        var parms = new PlayPreExplodeAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetJumpBlenderAnimNodeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetJumpBlenderAnimNode_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetJumpBlenderAnimNode
     /// </summary>
     public unsafe virtual BmSDK.Engine.AnimNodeCrossfader GetJumpBlenderAnimNode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.GetJumpBlenderAnimNode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimNodeCrossfader>(paramsPtr + 0);
+        var funcManaged = s_GetJumpBlenderAnimNodeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RControllableChatteringTeethBase.GetJumpBlenderAnimNode", true);
+        var parms = new GetJumpBlenderAnimNode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AnimNodeCrossfader)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -226,8 +305,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe BmSDK.BmGame.RControllableChatteringTeethBase.EChatteringTeethState TeethState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RControllableChatteringTeethBase.EChatteringTeethState>(Ptr + 1092); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1092); }
+        get { return *(BmSDK.BmGame.RControllableChatteringTeethBase.EChatteringTeethState*)(Ptr + 1092); }
+        set { *(BmSDK.BmGame.RControllableChatteringTeethBase.EChatteringTeethState*)(Ptr + 1092) = value; }
     }
 
     /// <summary>
@@ -235,8 +314,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe BmSDK.BmGame.RControllableChatteringTeethBase.EExplosionOutcome ExplosionOutcome
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RControllableChatteringTeethBase.EExplosionOutcome>(Ptr + 1093); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1093); }
+        get { return *(BmSDK.BmGame.RControllableChatteringTeethBase.EExplosionOutcome*)(Ptr + 1093); }
+        set { *(BmSDK.BmGame.RControllableChatteringTeethBase.EExplosionOutcome*)(Ptr + 1093) = value; }
     }
 
     /// <summary>
@@ -253,8 +332,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe bool bExploded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1100) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1100); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1100); }
+        get { return (*(int*)(Ptr + 1100) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1100) |= 1; else *(int*)(Ptr + 1100) &= ~1; }
     }
 
     /// <summary>
@@ -262,8 +341,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe bool bExplosionTriggered
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1100) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1100); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1100); }
+        get { return (*(int*)(Ptr + 1100) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1100) |= 2; else *(int*)(Ptr + 1100) &= ~2; }
     }
 
     /// <summary>
@@ -271,8 +350,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe float MinJumpingFloorAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1104); }
+        get { return *(float*)(Ptr + 1104); }
+        set { *(float*)(Ptr + 1104) = value; }
     }
 
     /// <summary>
@@ -280,8 +359,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe float JumpBlendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1108); }
+        get { return *(float*)(Ptr + 1108); }
+        set { *(float*)(Ptr + 1108) = value; }
     }
 
     /// <summary>
@@ -289,8 +368,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe float MinVillainDistanceBeforeAutoExplode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1112); }
+        get { return *(float*)(Ptr + 1112); }
+        set { *(float*)(Ptr + 1112) = value; }
     }
 
     /// <summary>
@@ -298,8 +377,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe float MaxTurnSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1116); }
+        get { return *(float*)(Ptr + 1116); }
+        set { *(float*)(Ptr + 1116) = value; }
     }
 
     /// <summary>
@@ -307,8 +386,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe float AutoExplodeTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1120); }
+        get { return *(float*)(Ptr + 1120); }
+        set { *(float*)(Ptr + 1120) = value; }
     }
 
     /// <summary>
@@ -316,8 +395,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe float AutoExplodeDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1124); }
+        get { return *(float*)(Ptr + 1124); }
+        set { *(float*)(Ptr + 1124) = value; }
     }
 
     /// <summary>
@@ -325,8 +404,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe float ActualExplodeDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1128); }
+        get { return *(float*)(Ptr + 1128); }
+        set { *(float*)(Ptr + 1128) = value; }
     }
 
     /// <summary>
@@ -361,8 +440,8 @@ public partial class RControllableChatteringTeethBase : BmSDK.Engine.Pawn, BmSDK
     /// </summary>
     public unsafe float PostExplodeDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1144); }
+        get { return *(float*)(Ptr + 1144); }
+        set { *(float*)(Ptr + 1144) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RCrimeSceneAsset : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName CrimeSceneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RCrimeSceneAsset : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName OptionalCasefileName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(BmSDK.FName*)(Ptr + 52); }
+        set { *(BmSDK.FName*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RCrimeSceneAsset : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe bool DoNotEnterScanMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1; else *(int*)(Ptr + 60) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RCrimeSceneAsset : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe int FireEventWhenPartiallyComplete
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(int*)(Ptr + 80); }
+        set { *(int*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -137,7 +137,7 @@ public partial class RCrimeSceneAsset : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe int LockPlayerControlWhenPartiallyComplete
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(int*)(Ptr + 84); }
+        set { *(int*)(Ptr + 84) = value; }
     }
 }
@@ -92,8 +92,8 @@ public partial class RCrowdTrigger : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int ChecksPerFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(int*)(Ptr + 432); }
+        set { *(int*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RCrowdTrigger : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float CheckRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -78,30 +78,46 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
         where TComponent : class, Framework.IScriptComponent<RCwGrappleGunBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PointAndLineCheckFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct PointAndLineCheck_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 HitNormal;
+        [FieldOffset(24)] public System.Numerics.Vector3 End;
+        [FieldOffset(36)] public System.Numerics.Vector3 Start;
+        [FieldOffset(48)] public System.Numerics.Vector3 Extent;
+        [FieldOffset(60)] public int ExtraTraceFlags;
+        [FieldOffset(64)] public int bIgnoreRailings;
+        [FieldOffset(68)] public int bDebugDraw;
+        [FieldOffset(72)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PointAndLineCheck
     /// </summary>
     public unsafe virtual bool PointAndLineCheck(out System.Numerics.Vector3 HitLocation, out System.Numerics.Vector3 HitNormal, System.Numerics.Vector3 End, System.Numerics.Vector3 Start, System.Numerics.Vector3 Extent, int ExtraTraceFlags = default, bool bIgnoreRailings = default, bool bDebugDraw = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.PointAndLineCheck", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(End, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Start, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Extent, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExtraTraceFlags, paramsPtr + 60);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnoreRailings, paramsPtr + 64);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugDraw, paramsPtr + 68);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        HitLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        HitNormal = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 72);
+        var funcManaged = s_PointAndLineCheckFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.PointAndLineCheck", true);
+        var parms = new PointAndLineCheck_Params();
+        parms.End = End;
+        parms.Start = Start;
+        parms.Extent = Extent;
+        parms.ExtraTraceFlags = ExtraTraceFlags;
+        parms.bIgnoreRailings = bIgnoreRailings ? 1 : 0;
+        parms.bDebugDraw = bDebugDraw ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        HitLocation = parms.HitLocation;
+        HitNormal = parms.HitNormal;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetChainStartLocatorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetChainStartLocator_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 PlayerLocation;
+        [FieldOffset(12)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -109,18 +125,22 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RClimbLocator GetChainStartLocator(System.Numerics.Vector3 PlayerLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetChainStartLocator", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerLocation, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RClimbLocator>(paramsPtr + 12);
+        var funcManaged = s_GetChainStartLocatorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetChainStartLocator", true);
+        var parms = new GetChainStartLocator_Params();
+        parms.PlayerLocation = PlayerLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RClimbLocator)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetLocatorChainLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct GetLocatorChainLocation_Params
+    {
+        [FieldOffset(0)] public nint LowestChainLocator;
+        [FieldOffset(4)] public System.Numerics.Vector3 InLocation;
+        [FieldOffset(16)] public System.Numerics.Vector3 TargetLocation;
+        [FieldOffset(28)] public int bAlignLowerPoints;
+        [FieldOffset(32)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -128,21 +148,20 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetLocatorChainLocation(BmSDK.BmGame.RClimbLocator LowestChainLocator, System.Numerics.Vector3 InLocation, System.Numerics.Vector3 TargetLocation, bool bAlignLowerPoints = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetLocatorChainLocation", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LowestChainLocator, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLocation, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAlignLowerPoints, paramsPtr + 28);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 32);
+        var funcManaged = s_GetLocatorChainLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetLocatorChainLocation", true);
+        var parms = new GetLocatorChainLocation_Params();
+        parms.LowestChainLocator = LowestChainLocator?.Ptr ?? 0;
+        parms.InLocation = InLocation;
+        parms.TargetLocation = TargetLocation;
+        parms.bAlignLowerPoints = bAlignLowerPoints ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_HandleGlobalPounceTargetingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HandleGlobalPounceTargeting_Params
+    {
     }
 
     /// <summary>
@@ -150,36 +169,38 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void HandleGlobalPounceTargeting()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.HandleGlobalPounceTargeting", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_HandleGlobalPounceTargetingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.HandleGlobalPounceTargeting", true);
+        var parms = new HandleGlobalPounceTargeting_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PickNextLowerSwingHeightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 988)]
+    private struct PickNextLowerSwingHeight_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo ClimbInfo;
+        [FieldOffset(984)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PickNextLowerSwingHeight
     /// </summary>
     public unsafe virtual bool PickNextLowerSwingHeight(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo ClimbInfo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.PickNextLowerSwingHeight", true);
-        byte* paramsPtr = stackalloc byte[988];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        ClimbInfo = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 984);
+        var funcManaged = s_PickNextLowerSwingHeightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.PickNextLowerSwingHeight", true);
+        var parms = new PickNextLowerSwingHeight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        ClimbInfo = parms.ClimbInfo;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckForCeilingTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct CheckForCeilingTarget_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 CeilingTargetLocation;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -187,18 +208,20 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckForCeilingTarget(out System.Numerics.Vector3 CeilingTargetLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckForCeilingTarget", true);
-        byte* paramsPtr = stackalloc byte[16];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        CeilingTargetLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_CheckForCeilingTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckForCeilingTarget", true);
+        var parms = new CheckForCeilingTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        CeilingTargetLocation = parms.CeilingTargetLocation;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckThisGrappleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CheckThisGrapple_Params
+    {
+        [FieldOffset(0)] public nint ThisGrapplePoint;
+        [FieldOffset(4)] public nint ThisHidePoint;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -206,19 +229,21 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckThisGrapple(BmSDK.BmGame.RGrapplePoint ThisGrapplePoint = default, BmSDK.BmGame.RHidePoint ThisHidePoint = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckThisGrapple", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThisGrapplePoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThisHidePoint, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_CheckThisGrappleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckThisGrapple", true);
+        var parms = new CheckThisGrapple_Params();
+        parms.ThisGrapplePoint = ThisGrapplePoint?.Ptr ?? 0;
+        parms.ThisHidePoint = ThisHidePoint?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetInBoundVectorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetInBoundVector_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StartVelocity;
+        [FieldOffset(12)] public System.Numerics.Vector3 EndVelocity;
+        [FieldOffset(24)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -226,19 +251,18 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetInBoundVector(System.Numerics.Vector3 StartVelocity, System.Numerics.Vector3 EndVelocity)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetInBoundVector", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartVelocity, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndVelocity, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 24);
+        var funcManaged = s_GetInBoundVectorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetInBoundVector", true);
+        var parms = new GetInBoundVector_Params();
+        parms.StartVelocity = StartVelocity;
+        parms.EndVelocity = EndVelocity;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_StoreCurrentClimbInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StoreCurrentClimbInfo_Params
+    {
     }
 
     /// <summary>
@@ -246,37 +270,44 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void StoreCurrentClimbInfo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.StoreCurrentClimbInfo", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_StoreCurrentClimbInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.StoreCurrentClimbInfo", true);
+        var parms = new StoreCurrentClimbInfo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawPounceBlockingVolumesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 992)]
+    private struct DrawPounceBlockingVolumes_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo Info;
+        [FieldOffset(984)] public int bDrawPersistent;
+        [FieldOffset(988)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: DrawPounceBlockingVolumes
     /// </summary>
     public unsafe virtual bool DrawPounceBlockingVolumes(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo Info, bool bDrawPersistent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.DrawPounceBlockingVolumes", true);
-        byte* paramsPtr = stackalloc byte[992];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawPersistent, paramsPtr + 984);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Info = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 988);
+        var funcManaged = s_DrawPounceBlockingVolumesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.DrawPounceBlockingVolumes", true);
+        var parms = new DrawPounceBlockingVolumes_Params();
+        parms.bDrawPersistent = bDrawPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Info = parms.Info;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckWallPounceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1180)]
+    private struct CheckWallPounce_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo Info;
+        [FieldOffset(984)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath NewPath;
+        [FieldOffset(1164)] public int FromPoint;
+        [FieldOffset(1168)] public int bOptimisePass;
+        [FieldOffset(1172)] public int bTweakFinalPounce;
+        [FieldOffset(1176)] public int ReturnValue;
     }
 
     /// <summary>
@@ -284,22 +315,23 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckWallPounce(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo Info, out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath NewPath, int FromPoint, bool bOptimisePass, bool bTweakFinalPounce = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckWallPounce", true);
-        byte* paramsPtr = stackalloc byte[1180];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FromPoint, paramsPtr + 1164);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOptimisePass, paramsPtr + 1168);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTweakFinalPounce, paramsPtr + 1172);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Info = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo>(paramsPtr + 0);
-        NewPath = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath>(paramsPtr + 984);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 1176);
+        var funcManaged = s_CheckWallPounceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckWallPounce", true);
+        var parms = new CheckWallPounce_Params();
+        parms.FromPoint = FromPoint;
+        parms.bOptimisePass = bOptimisePass ? 1 : 0;
+        parms.bTweakFinalPounce = bTweakFinalPounce ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Info = parms.Info;
+        NewPath = parms.NewPath;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OptimisePathFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 988)]
+    private struct OptimisePath_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo Info;
+        [FieldOffset(984)] public int bIgnoreDangleEdges;
     }
 
     /// <summary>
@@ -307,46 +339,54 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void OptimisePath(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo Info, bool bIgnoreDangleEdges)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.OptimisePath", true);
-        byte* paramsPtr = stackalloc byte[988];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnoreDangleEdges, paramsPtr + 984);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Info = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo>(paramsPtr + 0);
+        var funcManaged = s_OptimisePathFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.OptimisePath", true);
+        var parms = new OptimisePath_Params();
+        parms.bIgnoreDangleEdges = bIgnoreDangleEdges ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Info = parms.Info;
         return;
     }
 
+    static BmSDK.Function s_GetClosestLandEdgeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct GetClosestLandEdge_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 OriginalLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 OriginalNormal;
+        [FieldOffset(36)] public float HTolerance;
+        [FieldOffset(40)] public float VToleranceUp;
+        [FieldOffset(44)] public float VExtraDangleToleranceUp;
+        [FieldOffset(48)] public float VToleranceDown;
+        [FieldOffset(52)] public int bIgnoreLimits;
+        [FieldOffset(56)] public int bIgnoreDangle;
+        [FieldOffset(60)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetClosestLandEdge
     /// </summary>
     public unsafe virtual bool GetClosestLandEdge(System.Numerics.Vector3 OriginalLocation, System.Numerics.Vector3 OriginalNormal, out BmSDK.TArray<BmSDK.BmGame.RCwGrappleGunBase.FClimbLedges> Ledges, float HTolerance, float VToleranceUp, float VExtraDangleToleranceUp, float VToleranceDown, bool bIgnoreLimits, bool bIgnoreDangle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetClosestLandEdge", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OriginalLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OriginalNormal, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HTolerance, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VToleranceUp, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VExtraDangleToleranceUp, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VToleranceDown, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnoreLimits, paramsPtr + 52);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnoreDangle, paramsPtr + 56);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Ledges = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.BmGame.RCwGrappleGunBase.FClimbLedges>>(paramsPtr + 24);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 60);
+        var funcManaged = s_GetClosestLandEdgeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetClosestLandEdge", true);
+        var parms = new GetClosestLandEdge_Params();
+        parms.OriginalLocation = OriginalLocation;
+        parms.OriginalNormal = OriginalNormal;
+        parms.HTolerance = HTolerance;
+        parms.VToleranceUp = VToleranceUp;
+        parms.VExtraDangleToleranceUp = VExtraDangleToleranceUp;
+        parms.VToleranceDown = VToleranceDown;
+        parms.bIgnoreLimits = bIgnoreLimits ? 1 : 0;
+        parms.bIgnoreDangle = bIgnoreDangle ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Ledges = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.BmGame.RCwGrappleGunBase.FClimbLedges>>((byte*)&parms + 24);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DrawClimbRouteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DrawClimbRoute_Params
+    {
+        [FieldOffset(0)] public int bPersistent;
     }
 
     /// <summary>
@@ -354,23 +394,41 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void DrawClimbRoute(bool bPersistent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.DrawClimbRoute", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPersistent, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawClimbRouteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.DrawClimbRoute", true);
+        var parms = new DrawClimbRoute_Params();
+        parms.bPersistent = bPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsWallClimbMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsWallClimbMove_Params
+    {
+        [FieldOffset(0)] public nint Config;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsWallClimbMove
     /// </summary>
     public unsafe virtual bool IsWallClimbMove(BmSDK.BmGame.RSpecialMoveConfig Config)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsWallClimbMove", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Config, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsWallClimbMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsWallClimbMove", true);
+        var parms = new IsWallClimbMove_Params();
+        parms.Config = Config?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StartWallClimbCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct StartWallClimbCamera_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 CurrentLandLocation;
+        [FieldOffset(12)] public int FirstClimbPointIndex;
+        [FieldOffset(16)] public int bEstimatedLandPoint;
+        [FieldOffset(20)] public int bFromSwing;
     }
 
     /// <summary>
@@ -378,35 +436,48 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void StartWallClimbCamera(System.Numerics.Vector3 CurrentLandLocation, int FirstClimbPointIndex = default, bool bEstimatedLandPoint = default, bool bFromSwing = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.StartWallClimbCamera", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentLandLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FirstClimbPointIndex, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEstimatedLandPoint, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFromSwing, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartWallClimbCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.StartWallClimbCamera", true);
+        var parms = new StartWallClimbCamera_Params();
+        parms.CurrentLandLocation = CurrentLandLocation;
+        parms.FirstClimbPointIndex = FirstClimbPointIndex;
+        parms.bEstimatedLandPoint = bEstimatedLandPoint ? 1 : 0;
+        parms.bFromSwing = bFromSwing ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanClimbToHidePointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct CanClimbToHidePoint_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StartLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 GrappleLocation;
+        [FieldOffset(24)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(36)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanClimbToHidePoint
     /// </summary>
     public unsafe virtual bool CanClimbToHidePoint(System.Numerics.Vector3 StartLocation, System.Numerics.Vector3 GrappleLocation, System.Numerics.Vector3 WallNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CanClimbToHidePoint", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GrappleLocation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallNormal, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 36);
+        var funcManaged = s_CanClimbToHidePointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CanClimbToHidePoint", true);
+        var parms = new CanClimbToHidePoint_Params();
+        parms.StartLocation = StartLocation;
+        parms.GrappleLocation = GrappleLocation;
+        parms.WallNormal = WallNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanClimbToGrapplePointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct CanClimbToGrapplePoint_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StartLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 GrappleLocation;
+        [FieldOffset(24)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(36)] public int ReturnValue;
     }
 
     /// <summary>
@@ -414,20 +485,23 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CanClimbToGrapplePoint(System.Numerics.Vector3 StartLocation, System.Numerics.Vector3 GrappleLocation, System.Numerics.Vector3 WallNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CanClimbToGrapplePoint", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GrappleLocation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallNormal, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 36);
+        var funcManaged = s_CanClimbToGrapplePointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CanClimbToGrapplePoint", true);
+        var parms = new CanClimbToGrapplePoint_Params();
+        parms.StartLocation = StartLocation;
+        parms.GrappleLocation = GrappleLocation;
+        parms.WallNormal = WallNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClampToLineSegmentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct ClampToLineSegment_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 P;
+        [FieldOffset(12)] public System.Numerics.Vector3 A;
+        [FieldOffset(24)] public System.Numerics.Vector3 B;
+        [FieldOffset(36)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -435,20 +509,31 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 ClampToLineSegment(System.Numerics.Vector3 P, System.Numerics.Vector3 A, System.Numerics.Vector3 B)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.ClampToLineSegment", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(P, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(B, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 36);
+        var funcManaged = s_ClampToLineSegmentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.ClampToLineSegment", true);
+        var parms = new ClampToLineSegment_Params();
+        parms.P = P;
+        parms.A = A;
+        parms.B = B;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_InitialWallCheckFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 272)]
+    private struct InitialWallCheck_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 WallLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(24)] public System.Numerics.Vector3 Right;
+        [FieldOffset(36)] public float OutTolerance;
+        [FieldOffset(40)] public float InTolerance;
+        [FieldOffset(44)] public System.Numerics.Vector3 TargetLocation;
+        [FieldOffset(56)] public System.Numerics.Vector3 TargetWallLocation;
+        [FieldOffset(68)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath NewPath;
+        [FieldOffset(248)] public BmSDK.BmGame.RCwGrappleGunBase.EStartPoints StartCheck;
+        [FieldOffset(252)] public int bForcePounceCheck;
+        [FieldOffset(256)] public System.Numerics.Vector3 NewWallLocation;
+        [FieldOffset(268)] public int ReturnValue;
     }
 
     /// <summary>
@@ -456,28 +541,30 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool InitialWallCheck(System.Numerics.Vector3 WallLocation, System.Numerics.Vector3 WallNormal, System.Numerics.Vector3 Right, float OutTolerance, float InTolerance, System.Numerics.Vector3 TargetLocation, System.Numerics.Vector3 TargetWallLocation, out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath NewPath, BmSDK.BmGame.RCwGrappleGunBase.EStartPoints StartCheck, bool bForcePounceCheck, out System.Numerics.Vector3 NewWallLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.InitialWallCheck", true);
-        byte* paramsPtr = stackalloc byte[272];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallNormal, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Right, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OutTolerance, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InTolerance, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLocation, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetWallLocation, paramsPtr + 56);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartCheck, paramsPtr + 248);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForcePounceCheck, paramsPtr + 252);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        NewPath = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath>(paramsPtr + 68);
-        NewWallLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 256);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 268);
+        var funcManaged = s_InitialWallCheckFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.InitialWallCheck", true);
+        var parms = new InitialWallCheck_Params();
+        parms.WallLocation = WallLocation;
+        parms.WallNormal = WallNormal;
+        parms.Right = Right;
+        parms.OutTolerance = OutTolerance;
+        parms.InTolerance = InTolerance;
+        parms.TargetLocation = TargetLocation;
+        parms.TargetWallLocation = TargetWallLocation;
+        parms.StartCheck = StartCheck;
+        parms.bForcePounceCheck = bForcePounceCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        NewPath = parms.NewPath;
+        NewWallLocation = parms.NewWallLocation;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CreateClimbRouteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 120)]
+    private struct CreateClimbRoute_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc;
+        [FieldOffset(112)] public int bPersistent;
+        [FieldOffset(116)] public int ReturnValue;
     }
 
     /// <summary>
@@ -485,19 +572,24 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CreateClimbRoute(out BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc, bool bPersistent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CreateClimbRoute", true);
-        byte* paramsPtr = stackalloc byte[120];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPersistent, paramsPtr + 112);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 116);
+        var funcManaged = s_CreateClimbRouteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CreateClimbRoute", true);
+        var parms = new CreateClimbRoute_Params();
+        parms.bPersistent = bPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckPounceToGrappleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct CheckPounceToGrapple_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TargetLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(24)] public System.Numerics.Vector3 PlayerLoc;
+        [FieldOffset(36)] public int bDrawDebug;
+        [FieldOffset(40)] public int bDrawPersistent;
+        [FieldOffset(44)] public int ReturnValue;
     }
 
     /// <summary>
@@ -505,22 +597,29 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckPounceToGrapple(System.Numerics.Vector3 TargetLoc, System.Numerics.Vector3 WallNormal, System.Numerics.Vector3 PlayerLoc, bool bDrawDebug = default, bool bDrawPersistent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckPounceToGrapple", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallNormal, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerLoc, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawDebug, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawPersistent, paramsPtr + 40);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 44);
+        var funcManaged = s_CheckPounceToGrappleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckPounceToGrapple", true);
+        var parms = new CheckPounceToGrapple_Params();
+        parms.TargetLoc = TargetLoc;
+        parms.WallNormal = WallNormal;
+        parms.PlayerLoc = PlayerLoc;
+        parms.bDrawDebug = bDrawDebug ? 1 : 0;
+        parms.bDrawPersistent = bDrawPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitialPathCheckFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 248)]
+    private struct InitialPathCheck_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath NewPath;
+        [FieldOffset(180)] public System.Numerics.Vector3 TargetLocation;
+        [FieldOffset(192)] public System.Numerics.Vector3 TargetWallLocation;
+        [FieldOffset(204)] public System.Numerics.Vector3 WallLocation;
+        [FieldOffset(216)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(228)] public System.Numerics.Vector3 CheckExtent;
+        [FieldOffset(240)] public int bLimitCheckToPlane;
+        [FieldOffset(244)] public int ReturnValue;
     }
 
     /// <summary>
@@ -528,24 +627,30 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool InitialPathCheck(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath NewPath, System.Numerics.Vector3 TargetLocation, System.Numerics.Vector3 TargetWallLocation, System.Numerics.Vector3 WallLocation, System.Numerics.Vector3 WallNormal, System.Numerics.Vector3 CheckExtent, bool bLimitCheckToPlane)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.InitialPathCheck", true);
-        byte* paramsPtr = stackalloc byte[248];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLocation, paramsPtr + 180);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetWallLocation, paramsPtr + 192);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallLocation, paramsPtr + 204);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallNormal, paramsPtr + 216);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckExtent, paramsPtr + 228);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLimitCheckToPlane, paramsPtr + 240);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        NewPath = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 244);
+        var funcManaged = s_InitialPathCheckFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.InitialPathCheck", true);
+        var parms = new InitialPathCheck_Params();
+        parms.TargetLocation = TargetLocation;
+        parms.TargetWallLocation = TargetWallLocation;
+        parms.WallLocation = WallLocation;
+        parms.WallNormal = WallNormal;
+        parms.CheckExtent = CheckExtent;
+        parms.bLimitCheckToPlane = bLimitCheckToPlane ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        NewPath = parms.NewPath;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckPounceToWallFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct CheckPounceToWall_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 WallLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(24)] public System.Numerics.Vector3 PlayerLoc;
+        [FieldOffset(36)] public int bLimitCheckToPlane;
+        [FieldOffset(40)] public int bDrawDebug;
+        [FieldOffset(44)] public int bDrawPersistent;
+        [FieldOffset(48)] public int ReturnValue;
     }
 
     /// <summary>
@@ -553,23 +658,24 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckPounceToWall(System.Numerics.Vector3 WallLoc, System.Numerics.Vector3 WallNormal, System.Numerics.Vector3 PlayerLoc, bool bLimitCheckToPlane, bool bDrawDebug = default, bool bDrawPersistent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckPounceToWall", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallNormal, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerLoc, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLimitCheckToPlane, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawDebug, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawPersistent, paramsPtr + 44);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 48);
+        var funcManaged = s_CheckPounceToWallFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckPounceToWall", true);
+        var parms = new CheckPounceToWall_Params();
+        parms.WallLoc = WallLoc;
+        parms.WallNormal = WallNormal;
+        parms.PlayerLoc = PlayerLoc;
+        parms.bLimitCheckToPlane = bLimitCheckToPlane ? 1 : 0;
+        parms.bDrawDebug = bDrawDebug ? 1 : 0;
+        parms.bDrawPersistent = bDrawPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetBestWallClimbIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetBestWallClimbIndex_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 EndLocation;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -577,18 +683,18 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual int GetBestWallClimbIndex(System.Numerics.Vector3 EndLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetBestWallClimbIndex", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndLocation, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 12);
+        var funcManaged = s_GetBestWallClimbIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetBestWallClimbIndex", true);
+        var parms = new GetBestWallClimbIndex_Params();
+        parms.EndLocation = EndLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAerialSwingGrappleTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetAerialSwingGrappleTarget_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -596,17 +702,19 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetAerialSwingGrappleTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingGrappleTarget", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetAerialSwingGrappleTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingGrappleTarget", true);
+        var parms = new GetAerialSwingGrappleTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAerialSwingTargetNormalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetAerialSwingTargetNormal_Params
+    {
+        [FieldOffset(0)] public nint NewGrapplePoint;
+        [FieldOffset(4)] public System.Numerics.Vector3 TargetLocation;
+        [FieldOffset(16)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -614,19 +722,23 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetAerialSwingTargetNormal(BmSDK.BmGame.RGrapplePoint NewGrapplePoint = default, System.Numerics.Vector3 TargetLocation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingTargetNormal", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGrapplePoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLocation, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
+        var funcManaged = s_GetAerialSwingTargetNormalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingTargetNormal", true);
+        var parms = new GetAerialSwingTargetNormal_Params();
+        parms.NewGrapplePoint = NewGrapplePoint?.Ptr ?? 0;
+        parms.TargetLocation = TargetLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAerialSwingTargetLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetAerialSwingTargetLocation_Params
+    {
+        [FieldOffset(0)] public int bOnlyEstimate;
+        [FieldOffset(4)] public int bOnWall;
+        [FieldOffset(8)] public int bDebugDraw;
+        [FieldOffset(12)] public int bDrawPersistent;
+        [FieldOffset(16)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -634,21 +746,23 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetAerialSwingTargetLocation(bool bOnlyEstimate = default, bool bOnWall = default, bool bDebugDraw = default, bool bDrawPersistent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingTargetLocation", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOnlyEstimate, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOnWall, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugDraw, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawPersistent, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
+        var funcManaged = s_GetAerialSwingTargetLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingTargetLocation", true);
+        var parms = new GetAerialSwingTargetLocation_Params();
+        parms.bOnlyEstimate = bOnlyEstimate ? 1 : 0;
+        parms.bOnWall = bOnWall ? 1 : 0;
+        parms.bDebugDraw = bDebugDraw ? 1 : 0;
+        parms.bDrawPersistent = bDrawPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAerialSwingEstimatedTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetAerialSwingEstimatedTarget_Params
+    {
+        [FieldOffset(0)] public nint NewGrapplePoint;
+        [FieldOffset(4)] public System.Numerics.Vector3 TargetLocation;
+        [FieldOffset(16)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -656,19 +770,23 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetAerialSwingEstimatedTarget(BmSDK.BmGame.RGrapplePoint NewGrapplePoint = default, System.Numerics.Vector3 TargetLocation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingEstimatedTarget", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGrapplePoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLocation, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
+        var funcManaged = s_GetAerialSwingEstimatedTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingEstimatedTarget", true);
+        var parms = new GetAerialSwingEstimatedTarget_Params();
+        parms.NewGrapplePoint = NewGrapplePoint?.Ptr ?? 0;
+        parms.TargetLocation = TargetLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetIdealSwingParametersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct GetIdealSwingParameters_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StartLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 EndLocation;
+        [FieldOffset(24)] public System.Numerics.Vector3 WallLocation;
+        [FieldOffset(36)] public float IdealSwingTime;
+        [FieldOffset(40)] public float IdealSwingLength;
     }
 
     /// <summary>
@@ -676,34 +794,44 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void GetIdealSwingParameters(System.Numerics.Vector3 StartLocation, System.Numerics.Vector3 EndLocation, System.Numerics.Vector3 WallLocation, out float IdealSwingTime, out float IdealSwingLength)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetIdealSwingParameters", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndLocation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallLocation, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        IdealSwingTime = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 36);
-        IdealSwingLength = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 40);
+        var funcManaged = s_GetIdealSwingParametersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetIdealSwingParameters", true);
+        var parms = new GetIdealSwingParameters_Params();
+        parms.StartLocation = StartLocation;
+        parms.EndLocation = EndLocation;
+        parms.WallLocation = WallLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        IdealSwingTime = parms.IdealSwingTime;
+        IdealSwingLength = parms.IdealSwingLength;
         return;
     }
 
+    static BmSDK.Function s_GetAerialSwingWallEndParamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetAerialSwingWallEndParams_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 PlayerLocation;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAerialSwingWallEndParams
     /// </summary>
     public unsafe virtual bool GetAerialSwingWallEndParams(out System.Numerics.Vector3 PlayerLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingWallEndParams", true);
-        byte* paramsPtr = stackalloc byte[16];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        PlayerLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_GetAerialSwingWallEndParamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingWallEndParams", true);
+        var parms = new GetAerialSwingWallEndParams_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        PlayerLocation = parms.PlayerLocation;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetAerialSwingEndParamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetAerialSwingEndParams_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 PlayerLocation;
+        [FieldOffset(12)] public int bOnlyEstimate;
+        [FieldOffset(16)] public int bDebugDraw;
     }
 
     /// <summary>
@@ -711,42 +839,48 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void GetAerialSwingEndParams(out System.Numerics.Vector3 PlayerLocation, bool bOnlyEstimate = default, bool bDebugDraw = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingEndParams", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOnlyEstimate, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugDraw, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        PlayerLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetAerialSwingEndParamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingEndParams", true);
+        var parms = new GetAerialSwingEndParams_Params();
+        parms.bOnlyEstimate = bOnlyEstimate ? 1 : 0;
+        parms.bDebugDraw = bDebugDraw ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        PlayerLocation = parms.PlayerLocation;
         return;
     }
 
+    static BmSDK.Function s_GetAerialSwingStartParamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetAerialSwingStartParams_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Origin;
+        [FieldOffset(12)] public System.Numerics.Vector3 StartVelocity;
+        [FieldOffset(24)] public float StartTime;
+        [FieldOffset(28)] public int bDrawDebug;
+        [FieldOffset(32)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAerialSwingStartParams
     /// </summary>
     public unsafe virtual bool GetAerialSwingStartParams(out System.Numerics.Vector3 Origin, out System.Numerics.Vector3 StartVelocity, out float StartTime, bool bDrawDebug)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingStartParams", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawDebug, paramsPtr + 28);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Origin = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        StartVelocity = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        StartTime = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 24);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 32);
+        var funcManaged = s_GetAerialSwingStartParamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetAerialSwingStartParams", true);
+        var parms = new GetAerialSwingStartParams_Params();
+        parms.bDrawDebug = bDrawDebug ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Origin = parms.Origin;
+        StartVelocity = parms.StartVelocity;
+        StartTime = parms.StartTime;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsValidClimbStartPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 188)]
+    private struct IsValidClimbStartPoint_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath CheckPath;
+        [FieldOffset(180)] public int bNewPath;
+        [FieldOffset(184)] public int ReturnValue;
     }
 
     /// <summary>
@@ -754,19 +888,19 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsValidClimbStartPoint(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath CheckPath, bool bNewPath = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsValidClimbStartPoint", true);
-        byte* paramsPtr = stackalloc byte[188];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewPath, paramsPtr + 180);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        CheckPath = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 184);
+        var funcManaged = s_IsValidClimbStartPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsValidClimbStartPoint", true);
+        var parms = new IsValidClimbStartPoint_Params();
+        parms.bNewPath = bNewPath ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        CheckPath = parms.CheckPath;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetEdgeSwingGrappleTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetEdgeSwingGrappleTarget_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -774,17 +908,18 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetEdgeSwingGrappleTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingGrappleTarget", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetEdgeSwingGrappleTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingGrappleTarget", true);
+        var parms = new GetEdgeSwingGrappleTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetEdgeSwingGrappleTargetingParamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetEdgeSwingGrappleTargetingParams_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Origin;
+        [FieldOffset(12)] public BmSDK.Rotator AimDirection;
     }
 
     /// <summary>
@@ -792,38 +927,39 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void GetEdgeSwingGrappleTargetingParams(out System.Numerics.Vector3 Origin, out BmSDK.Rotator AimDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingGrappleTargetingParams", true);
-        byte* paramsPtr = stackalloc byte[24];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Origin = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        AimDirection = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 12);
+        var funcManaged = s_GetEdgeSwingGrappleTargetingParamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingGrappleTargetingParams", true);
+        var parms = new GetEdgeSwingGrappleTargetingParams_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Origin = parms.Origin;
+        AimDirection = parms.AimDirection;
         return;
     }
 
+    static BmSDK.Function s_GetEdgeSwingWallLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetEdgeSwingWallLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(12)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetEdgeSwingWallLocation
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetEdgeSwingWallLocation(out System.Numerics.Vector3 WallNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingWallLocation", true);
-        byte* paramsPtr = stackalloc byte[24];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        WallNormal = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetEdgeSwingWallLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingWallLocation", true);
+        var parms = new GetEdgeSwingWallLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        WallNormal = parms.WallNormal;
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetEdgeSwingWallEndParamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetEdgeSwingWallEndParams_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 PlayerLocation;
     }
 
     /// <summary>
@@ -831,59 +967,66 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void GetEdgeSwingWallEndParams(out System.Numerics.Vector3 PlayerLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingWallEndParams", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        PlayerLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetEdgeSwingWallEndParamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingWallEndParams", true);
+        var parms = new GetEdgeSwingWallEndParams_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        PlayerLocation = parms.PlayerLocation;
         return;
     }
 
+    static BmSDK.Function s_GetEdgeSwingEndParamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetEdgeSwingEndParams_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 PlayerLocation;
+        [FieldOffset(12)] public int bOnlyEstimate;
+        [FieldOffset(16)] public int bDebugDraw;
+    }
+
     /// <summary>
     /// Function: GetEdgeSwingEndParams
     /// </summary>
     public unsafe virtual void GetEdgeSwingEndParams(out System.Numerics.Vector3 PlayerLocation, bool bOnlyEstimate = default, bool bDebugDraw = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingEndParams", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOnlyEstimate, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugDraw, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        PlayerLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetEdgeSwingEndParamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingEndParams", true);
+        var parms = new GetEdgeSwingEndParams_Params();
+        parms.bOnlyEstimate = bOnlyEstimate ? 1 : 0;
+        parms.bDebugDraw = bDebugDraw ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        PlayerLocation = parms.PlayerLocation;
         return;
     }
 
+    static BmSDK.Function s_GetEdgeSwingTargetNormalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetEdgeSwingTargetNormal_Params
+    {
+        [FieldOffset(0)] public nint NewGrapplePoint;
+        [FieldOffset(4)] public System.Numerics.Vector3 TargetLocation;
+        [FieldOffset(16)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetEdgeSwingTargetNormal
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetEdgeSwingTargetNormal(BmSDK.BmGame.RGrapplePoint NewGrapplePoint = default, System.Numerics.Vector3 TargetLocation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingTargetNormal", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGrapplePoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLocation, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
+        var funcManaged = s_GetEdgeSwingTargetNormalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingTargetNormal", true);
+        var parms = new GetEdgeSwingTargetNormal_Params();
+        parms.NewGrapplePoint = NewGrapplePoint?.Ptr ?? 0;
+        parms.TargetLocation = TargetLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetEdgeSwingTargetLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetEdgeSwingTargetLocation_Params
+    {
+        [FieldOffset(0)] public int bOnlyEstimate;
+        [FieldOffset(4)] public int bOnWall;
+        [FieldOffset(8)] public int bDebugDraw;
+        [FieldOffset(12)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -891,20 +1034,22 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetEdgeSwingTargetLocation(bool bOnlyEstimate = default, bool bOnWall = default, bool bDebugDraw = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingTargetLocation", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOnlyEstimate, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOnWall, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugDraw, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetEdgeSwingTargetLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingTargetLocation", true);
+        var parms = new GetEdgeSwingTargetLocation_Params();
+        parms.bOnlyEstimate = bOnlyEstimate ? 1 : 0;
+        parms.bOnWall = bOnWall ? 1 : 0;
+        parms.bDebugDraw = bDebugDraw ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetEdgeSwingEstimatedTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetEdgeSwingEstimatedTarget_Params
+    {
+        [FieldOffset(0)] public nint NewGrapplePoint;
+        [FieldOffset(4)] public System.Numerics.Vector3 TargetLocation;
+        [FieldOffset(16)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -912,19 +1057,23 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetEdgeSwingEstimatedTarget(BmSDK.BmGame.RGrapplePoint NewGrapplePoint = default, System.Numerics.Vector3 TargetLocation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingEstimatedTarget", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGrapplePoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLocation, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
+        var funcManaged = s_GetEdgeSwingEstimatedTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingEstimatedTarget", true);
+        var parms = new GetEdgeSwingEstimatedTarget_Params();
+        parms.NewGrapplePoint = NewGrapplePoint?.Ptr ?? 0;
+        parms.TargetLocation = TargetLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetEdgeSwingStartParamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetEdgeSwingStartParams_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Origin;
+        [FieldOffset(12)] public System.Numerics.Vector3 StartVelocity;
+        [FieldOffset(24)] public float StartTime;
+        [FieldOffset(28)] public int bDrawDebug;
+        [FieldOffset(32)] public int ReturnValue;
     }
 
     /// <summary>
@@ -932,21 +1081,21 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool GetEdgeSwingStartParams(out System.Numerics.Vector3 Origin, out System.Numerics.Vector3 StartVelocity, out float StartTime, bool bDrawDebug)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingStartParams", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawDebug, paramsPtr + 28);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Origin = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        StartVelocity = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        StartTime = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 24);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 32);
+        var funcManaged = s_GetEdgeSwingStartParamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetEdgeSwingStartParams", true);
+        var parms = new GetEdgeSwingStartParams_Params();
+        parms.bDrawDebug = bDrawDebug ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Origin = parms.Origin;
+        StartVelocity = parms.StartVelocity;
+        StartTime = parms.StartTime;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsWallClimbStartInDirectPounceRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsWallClimbStartInDirectPounceRange_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -954,17 +1103,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsWallClimbStartInDirectPounceRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsWallClimbStartInDirectPounceRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsWallClimbStartInDirectPounceRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsWallClimbStartInDirectPounceRange", true);
+        var parms = new IsWallClimbStartInDirectPounceRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsHidePointInClimbDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsHidePointInClimbDistance_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -972,17 +1121,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsHidePointInClimbDistance()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsHidePointInClimbDistance", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsHidePointInClimbDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsHidePointInClimbDistance", true);
+        var parms = new IsHidePointInClimbDistance_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsHidePointInPounceDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsHidePointInPounceDistance_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -990,17 +1139,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsHidePointInPounceDistance()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsHidePointInPounceDistance", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsHidePointInPounceDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsHidePointInPounceDistance", true);
+        var parms = new IsHidePointInPounceDistance_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsGrapplePointInClimbDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsGrapplePointInClimbDistance_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1008,17 +1157,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsGrapplePointInClimbDistance()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsGrapplePointInClimbDistance", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsGrapplePointInClimbDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsGrapplePointInClimbDistance", true);
+        var parms = new IsGrapplePointInClimbDistance_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsGrapplePointInPounceDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsGrapplePointInPounceDistance_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1026,17 +1175,23 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsGrapplePointInPounceDistance()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsGrapplePointInPounceDistance", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsGrapplePointInPounceDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsGrapplePointInPounceDistance", true);
+        var parms = new IsGrapplePointInPounceDistance_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TraceGroundPathFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct TraceGroundPath_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Start;
+        [FieldOffset(12)] public System.Numerics.Vector3 End;
+        [FieldOffset(24)] public System.Numerics.Vector3 DirXY;
+        [FieldOffset(36)] public int Steps;
+        [FieldOffset(40)] public float HeightTolerance;
+        [FieldOffset(44)] public int bDebugExtraPounce;
+        [FieldOffset(48)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1044,23 +1199,27 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool TraceGroundPath(System.Numerics.Vector3 Start, System.Numerics.Vector3 End, System.Numerics.Vector3 DirXY, int Steps, float HeightTolerance, bool bDebugExtraPounce = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.TraceGroundPath", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Start, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(End, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DirXY, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Steps, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HeightTolerance, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugExtraPounce, paramsPtr + 44);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 48);
+        var funcManaged = s_TraceGroundPathFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.TraceGroundPath", true);
+        var parms = new TraceGroundPath_Params();
+        parms.Start = Start;
+        parms.End = End;
+        parms.DirXY = DirXY;
+        parms.Steps = Steps;
+        parms.HeightTolerance = HeightTolerance;
+        parms.bDebugExtraPounce = bDebugExtraPounce ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TraceGroundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 144)]
+    private struct TraceGround_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 Direction;
+        [FieldOffset(24)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc;
+        [FieldOffset(136)] public int bDebugExtraPounce;
+        [FieldOffset(140)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1068,21 +1227,26 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool TraceGround(out System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 Direction, out BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc, bool bDebugExtraPounce)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.TraceGround", true);
-        byte* paramsPtr = stackalloc byte[144];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Direction, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugExtraPounce, paramsPtr + 136);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        HitLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(paramsPtr + 24);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 140);
+        var funcManaged = s_TraceGroundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.TraceGround", true);
+        var parms = new TraceGround_Params();
+        parms.Direction = Direction;
+        parms.bDebugExtraPounce = bDebugExtraPounce ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        HitLocation = parms.HitLocation;
+        Loc = parms.Loc;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanLongPounceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1120)]
+    private struct CanLongPounce_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo Info;
+        [FieldOffset(984)] public int bHideOrGrapplePoint;
+        [FieldOffset(988)] public System.Numerics.Vector3 WallLocation;
+        [FieldOffset(1000)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc;
+        [FieldOffset(1112)] public int bDebugLongPounce;
+        [FieldOffset(1116)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1090,22 +1254,27 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CanLongPounce(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo Info, bool bHideOrGrapplePoint, System.Numerics.Vector3 WallLocation, out BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc, bool bDebugLongPounce = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CanLongPounce", true);
-        byte* paramsPtr = stackalloc byte[1120];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHideOrGrapplePoint, paramsPtr + 984);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallLocation, paramsPtr + 988);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugLongPounce, paramsPtr + 1112);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Info = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo>(paramsPtr + 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(paramsPtr + 1000);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 1116);
+        var funcManaged = s_CanLongPounceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CanLongPounce", true);
+        var parms = new CanLongPounce_Params();
+        parms.bHideOrGrapplePoint = bHideOrGrapplePoint ? 1 : 0;
+        parms.WallLocation = WallLocation;
+        parms.bDebugLongPounce = bDebugLongPounce ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Info = parms.Info;
+        Loc = parms.Loc;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckLongPounceFloorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 148)]
+    private struct CheckLongPounceFloor_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc;
+        [FieldOffset(112)] public System.Numerics.Vector3 WallLocation;
+        [FieldOffset(124)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(136)] public int bDebugDraw;
+        [FieldOffset(140)] public int bDebugLongPounce;
+        [FieldOffset(144)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1113,22 +1282,25 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckLongPounceFloor(out BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc, System.Numerics.Vector3 WallLocation, System.Numerics.Vector3 WallNormal, bool bDebugDraw = default, bool bDebugLongPounce = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckLongPounceFloor", true);
-        byte* paramsPtr = stackalloc byte[148];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallLocation, paramsPtr + 112);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallNormal, paramsPtr + 124);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugDraw, paramsPtr + 136);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugLongPounce, paramsPtr + 140);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 144);
+        var funcManaged = s_CheckLongPounceFloorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckLongPounceFloor", true);
+        var parms = new CheckLongPounceFloor_Params();
+        parms.WallLocation = WallLocation;
+        parms.WallNormal = WallNormal;
+        parms.bDebugDraw = bDebugDraw ? 1 : 0;
+        parms.bDebugLongPounce = bDebugLongPounce ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsLongPounceDistFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct IsLongPounceDist_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StartLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 WallLocation;
+        [FieldOffset(24)] public int bDirectPounceCheck;
+        [FieldOffset(28)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1136,20 +1308,20 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsLongPounceDist(System.Numerics.Vector3 StartLocation, System.Numerics.Vector3 WallLocation, bool bDirectPounceCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsLongPounceDist", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WallLocation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDirectPounceCheck, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_IsLongPounceDistFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsLongPounceDist", true);
+        var parms = new IsLongPounceDist_Params();
+        parms.StartLocation = StartLocation;
+        parms.WallLocation = WallLocation;
+        parms.bDirectPounceCheck = bDirectPounceCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckAerialSwingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckAerialSwing_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1157,17 +1329,18 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckAerialSwing()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckAerialSwing", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CheckAerialSwingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckAerialSwing", true);
+        var parms = new CheckAerialSwing_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckAerialSwingCollisionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct CheckAerialSwingCollision_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 FirstHitLocation;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1175,18 +1348,20 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckAerialSwingCollision(out System.Numerics.Vector3 FirstHitLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckAerialSwingCollision", true);
-        byte* paramsPtr = stackalloc byte[16];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        FirstHitLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_CheckAerialSwingCollisionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckAerialSwingCollision", true);
+        var parms = new CheckAerialSwingCollision_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        FirstHitLocation = parms.FirstHitLocation;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckEdgeSwingCollisionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CheckEdgeSwingCollision_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 FirstHitLocation;
+        [FieldOffset(12)] public int bTryShortJump;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1194,19 +1369,22 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckEdgeSwingCollision(out System.Numerics.Vector3 FirstHitLocation, bool bTryShortJump = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckEdgeSwingCollision", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTryShortJump, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        FirstHitLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_CheckEdgeSwingCollisionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckEdgeSwingCollision", true);
+        var parms = new CheckEdgeSwingCollision_Params();
+        parms.bTryShortJump = bTryShortJump ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        FirstHitLocation = parms.FirstHitLocation;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateInitialLocatorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 300)]
+    private struct UpdateInitialLocator_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc;
+        [FieldOffset(112)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath CheckPath;
+        [FieldOffset(292)] public int bNewPath;
+        [FieldOffset(296)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1214,20 +1392,20 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool UpdateInitialLocator(out BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc, out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath CheckPath, bool bNewPath = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.UpdateInitialLocator", true);
-        byte* paramsPtr = stackalloc byte[300];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewPath, paramsPtr + 292);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(paramsPtr + 0);
-        CheckPath = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath>(paramsPtr + 112);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 296);
+        var funcManaged = s_UpdateInitialLocatorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.UpdateInitialLocator", true);
+        var parms = new UpdateInitialLocator_Params();
+        parms.bNewPath = bNewPath ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        CheckPath = parms.CheckPath;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckSwingFromEdgeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckSwingFromEdge_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1235,17 +1413,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckSwingFromEdge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckSwingFromEdge", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CheckSwingFromEdgeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckSwingFromEdge", true);
+        var parms = new CheckSwingFromEdge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GotSwingTargetPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GotSwingTargetPoint_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1253,17 +1431,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool GotSwingTargetPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GotSwingTargetPoint", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_GotSwingTargetPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GotSwingTargetPoint", true);
+        var parms = new GotSwingTargetPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GotEdgeSwingTargetPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GotEdgeSwingTargetPoint_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1271,17 +1449,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool GotEdgeSwingTargetPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GotEdgeSwingTargetPoint", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_GotEdgeSwingTargetPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GotEdgeSwingTargetPoint", true);
+        var parms = new GotEdgeSwingTargetPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsAutoSwingToGargoyleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsAutoSwingToGargoyle_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1289,17 +1467,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsAutoSwingToGargoyle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsAutoSwingToGargoyle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsAutoSwingToGargoyleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsAutoSwingToGargoyle", true);
+        var parms = new IsAutoSwingToGargoyle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsAutoSwingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsAutoSwing_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1307,17 +1485,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsAutoSwing()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsAutoSwing", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsAutoSwingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.IsAutoSwing", true);
+        var parms = new IsAutoSwing_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckDelayedSwingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckDelayedSwing_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1325,17 +1503,18 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool CheckDelayedSwing()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckDelayedSwing", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CheckDelayedSwingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CheckDelayedSwing", true);
+        var parms = new CheckDelayedSwing_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HandlePounceTargetingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HandlePounceTargeting_Params
+    {
+        [FieldOffset(0)] public int bGrappleCheck;
+        [FieldOffset(4)] public int Iteration;
     }
 
     /// <summary>
@@ -1343,37 +1522,44 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void HandlePounceTargeting(bool bGrappleCheck = default, int Iteration = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.HandlePounceTargeting", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bGrappleCheck, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Iteration, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_HandlePounceTargetingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.HandlePounceTargeting", true);
+        var parms = new HandlePounceTargeting_Params();
+        parms.bGrappleCheck = bGrappleCheck ? 1 : 0;
+        parms.Iteration = Iteration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateSwingPathsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateSwingPaths_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: UpdateSwingPaths
     /// </summary>
     public unsafe virtual bool UpdateSwingPaths()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.UpdateSwingPaths", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_UpdateSwingPathsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.UpdateSwingPaths", true);
+        var parms = new UpdateSwingPaths_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SwingLineCheckFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 72)]
+    private struct SwingLineCheck_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 HitNormal;
+        [FieldOffset(24)] public System.Numerics.Vector3 EndLocation;
+        [FieldOffset(36)] public System.Numerics.Vector3 StartLocation;
+        [FieldOffset(48)] public System.Numerics.Vector3 CheckExtent;
+        [FieldOffset(60)] public int bStartWithPointCheck;
+        [FieldOffset(64)] public int bDrawDebug;
+        [FieldOffset(68)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1381,24 +1567,25 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool SwingLineCheck(out System.Numerics.Vector3 HitLocation, out System.Numerics.Vector3 HitNormal, System.Numerics.Vector3 EndLocation, System.Numerics.Vector3 StartLocation, System.Numerics.Vector3 CheckExtent, bool bStartWithPointCheck, bool bDrawDebug = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.SwingLineCheck", true);
-        byte* paramsPtr = stackalloc byte[72];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndLocation, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartLocation, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckExtent, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bStartWithPointCheck, paramsPtr + 60);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawDebug, paramsPtr + 64);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        HitLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        HitNormal = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 68);
+        var funcManaged = s_SwingLineCheckFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.SwingLineCheck", true);
+        var parms = new SwingLineCheck_Params();
+        parms.EndLocation = EndLocation;
+        parms.StartLocation = StartLocation;
+        parms.CheckExtent = CheckExtent;
+        parms.bStartWithPointCheck = bStartWithPointCheck ? 1 : 0;
+        parms.bDrawDebug = bDrawDebug ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        HitLocation = parms.HitLocation;
+        HitNormal = parms.HitNormal;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetJumpVelocityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetJumpVelocity_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Direction;
+        [FieldOffset(12)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -1406,18 +1593,20 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetJumpVelocity(System.Numerics.Vector3 Direction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetJumpVelocity", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Direction, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetJumpVelocityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetJumpVelocity", true);
+        var parms = new GetJumpVelocity_Params();
+        parms.Direction = Direction;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateFlightPathFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateFlightPath_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int bModifyTranitionTime;
+        [FieldOffset(8)] public int bFirstFrame;
     }
 
     /// <summary>
@@ -1425,40 +1614,44 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void UpdateFlightPath(float DeltaTime, bool bModifyTranitionTime, bool bFirstFrame)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.UpdateFlightPath", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bModifyTranitionTime, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFirstFrame, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateFlightPathFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.UpdateFlightPath", true);
+        var parms = new UpdateFlightPath_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.bModifyTranitionTime = bModifyTranitionTime ? 1 : 0;
+        parms.bFirstFrame = bFirstFrame ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetFlightPathDeltaTangentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 108)]
+    private struct GetFlightPathDeltaTangent_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters SP;
+        [FieldOffset(92)] public float Proportion;
+        [FieldOffset(96)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetFlightPathDeltaTangent
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetFlightPathDeltaTangent(out BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters SP, float Proportion)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetFlightPathDeltaTangent", true);
-        byte* paramsPtr = stackalloc byte[108];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proportion, paramsPtr + 92);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        SP = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 96);
+        var funcManaged = s_GetFlightPathDeltaTangentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetFlightPathDeltaTangent", true);
+        var parms = new GetFlightPathDeltaTangent_Params();
+        parms.Proportion = Proportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        SP = parms.SP;
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetFlightPathTangentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 108)]
+    private struct GetFlightPathTangent_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters SP;
+        [FieldOffset(92)] public float Proportion;
+        [FieldOffset(96)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -1466,19 +1659,21 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetFlightPathTangent(out BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters SP, float Proportion)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetFlightPathTangent", true);
-        byte* paramsPtr = stackalloc byte[108];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proportion, paramsPtr + 92);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        SP = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 96);
+        var funcManaged = s_GetFlightPathTangentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetFlightPathTangent", true);
+        var parms = new GetFlightPathTangent_Params();
+        parms.Proportion = Proportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        SP = parms.SP;
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetFlightPathPositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 108)]
+    private struct GetFlightPathPosition_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters SP;
+        [FieldOffset(92)] public float Proportion;
+        [FieldOffset(96)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -1486,19 +1681,20 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetFlightPathPosition(out BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters SP, float Proportion)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetFlightPathPosition", true);
-        byte* paramsPtr = stackalloc byte[108];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proportion, paramsPtr + 92);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        SP = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 96);
+        var funcManaged = s_GetFlightPathPositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.GetFlightPathPosition", true);
+        var parms = new GetFlightPathPosition_Params();
+        parms.Proportion = Proportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        SP = parms.SP;
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DrawSwingPathFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 988)]
+    private struct DrawSwingPath_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo ClimbInfo;
+        [FieldOffset(984)] public int bPersistent;
     }
 
     /// <summary>
@@ -1506,48 +1702,52 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void DrawSwingPath(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo ClimbInfo, bool bPersistent = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.DrawSwingPath", true);
-        byte* paramsPtr = stackalloc byte[988];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPersistent, paramsPtr + 984);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        ClimbInfo = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo>(paramsPtr + 0);
+        var funcManaged = s_DrawSwingPathFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.DrawSwingPath", true);
+        var parms = new DrawSwingPath_Params();
+        parms.bPersistent = bPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        ClimbInfo = parms.ClimbInfo;
         return;
     }
 
+    static BmSDK.Function s_CalculateSwingPathFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1068)]
+    private struct CalculateSwingPath_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo ClimbInfo;
+        [FieldOffset(984)] public System.Numerics.Vector3 DesiredStartLocation;
+        [FieldOffset(996)] public System.Numerics.Vector3 TargetLocation;
+        [FieldOffset(1008)] public System.Numerics.Vector3 StartVelocity;
+        [FieldOffset(1020)] public System.Numerics.Vector3 EndVelocity;
+        [FieldOffset(1032)] public float IdealSwingTime;
+        [FieldOffset(1036)] public float IdealSwingLength;
+        [FieldOffset(1040)] public float CheckSizeMod;
+        [FieldOffset(1044)] public System.Numerics.Vector3 FirstHitLocation;
+        [FieldOffset(1056)] public int bDebugDraw;
+        [FieldOffset(1060)] public int bDrawPersistent;
+        [FieldOffset(1064)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CalculateSwingPath
     /// </summary>
     public unsafe virtual bool CalculateSwingPath(out BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo ClimbInfo, System.Numerics.Vector3 DesiredStartLocation, System.Numerics.Vector3 TargetLocation, System.Numerics.Vector3 StartVelocity, System.Numerics.Vector3 EndVelocity, float IdealSwingTime, float IdealSwingLength, float CheckSizeMod, out System.Numerics.Vector3 FirstHitLocation, bool bDebugDraw, bool bDrawPersistent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CalculateSwingPath", true);
-        byte* paramsPtr = stackalloc byte[1068];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredStartLocation, paramsPtr + 984);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLocation, paramsPtr + 996);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartVelocity, paramsPtr + 1008);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndVelocity, paramsPtr + 1020);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IdealSwingTime, paramsPtr + 1032);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IdealSwingLength, paramsPtr + 1036);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckSizeMod, paramsPtr + 1040);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugDraw, paramsPtr + 1056);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDrawPersistent, paramsPtr + 1060);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        ClimbInfo = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbInfo>(paramsPtr + 0);
-        FirstHitLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 1044);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 1064);
+        var funcManaged = s_CalculateSwingPathFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RCwGrappleGunBase.CalculateSwingPath", true);
+        var parms = new CalculateSwingPath_Params();
+        parms.DesiredStartLocation = DesiredStartLocation;
+        parms.TargetLocation = TargetLocation;
+        parms.StartVelocity = StartVelocity;
+        parms.EndVelocity = EndVelocity;
+        parms.IdealSwingTime = IdealSwingTime;
+        parms.IdealSwingLength = IdealSwingLength;
+        parms.CheckSizeMod = CheckSizeMod;
+        parms.bDebugDraw = bDebugDraw ? 1 : 0;
+        parms.bDrawPersistent = bDrawPersistent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        ClimbInfo = parms.ClimbInfo;
+        FirstHitLocation = parms.FirstHitLocation;
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -1556,31 +1756,25 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     [StructLayout(LayoutKind.Explicit, Size = 28)]
     public partial record struct FClimbLedges
     {
+        [FieldOffset(24)] private int _bitfield24;
+
         /// <summary>
         /// StructProperty: Location
         /// </summary>
-        public unsafe System.Numerics.Vector3 Location
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector3 Location;
 
         /// <summary>
         /// StructProperty: Normal
         /// </summary>
-        public unsafe System.Numerics.Vector3 Normal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public System.Numerics.Vector3 Normal;
 
         /// <summary>
         /// BoolProperty: bDangleLedge
         /// </summary>
-        public unsafe bool bDangleLedge
+        public bool bDangleLedge
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 1) != 0;
+            set { if (value) _bitfield24 |= 1; else _bitfield24 &= ~1; }
         }
     }
 
@@ -1602,131 +1796,105 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     [StructLayout(LayoutKind.Explicit, Size = 984)]
     public partial record struct FWallClimbInfo
     {
+        [FieldOffset(180)] private int _bitfield180;
+        [FieldOffset(188)] private int _bitfield188;
+        [FieldOffset(328)] private int _bitfield328;
+        [FieldOffset(428)] private int _bitfield428;
+        [FieldOffset(444)] private int _bitfield444;
+        [FieldOffset(508)] private int _bitfield508;
+        [FieldOffset(640)] private int _bitfield640;
+        [FieldOffset(768)] private int _bitfield768;
+        [FieldOffset(916)] private int _bitfield916;
+
         /// <summary>
         /// StructProperty: ClimbPath
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath ClimbPath
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RCwGrappleGunBase.FWallClimbPath ClimbPath;
 
         /// <summary>
         /// BoolProperty: bGotValidPath
         /// </summary>
-        public unsafe bool bGotValidPath
+        public bool bGotValidPath
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 180); }; }
+            readonly get => (_bitfield180 & 1) != 0;
+            set { if (value) _bitfield180 |= 1; else _bitfield180 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bEdgeSwingCheckNewPath
         /// </summary>
-        public unsafe bool bEdgeSwingCheckNewPath
+        public bool bEdgeSwingCheckNewPath
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 180); }; }
+            readonly get => (_bitfield180 & 2) != 0;
+            set { if (value) _bitfield180 |= 2; else _bitfield180 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bUsingFallbackPath
         /// </summary>
-        public unsafe bool bUsingFallbackPath
+        public bool bUsingFallbackPath
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 180); }; }
+            readonly get => (_bitfield180 & 4) != 0;
+            set { if (value) _bitfield180 |= 4; else _bitfield180 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bFromWallStick
         /// </summary>
-        public unsafe bool bFromWallStick
+        public bool bFromWallStick
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 180); }; }
+            readonly get => (_bitfield180 & 8) != 0;
+            set { if (value) _bitfield180 |= 8; else _bitfield180 &= ~8; }
         }
 
         /// <summary>
         /// ByteProperty: LastFailedPreferedClimbPath
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection LastFailedPreferedClimbPath
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection>(Ptr + 184); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }; }
-        }
+        [FieldOffset(184)] public BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection LastFailedPreferedClimbPath;
 
         /// <summary>
         /// ByteProperty: LastFailedEdgeSwingPreferedClimbPath
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection LastFailedEdgeSwingPreferedClimbPath
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection>(Ptr + 185); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 185); }; }
-        }
+        [FieldOffset(185)] public BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection LastFailedEdgeSwingPreferedClimbPath;
 
         /// <summary>
         /// ByteProperty: LastFailedAerialSwingPreferedClimbPath
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection LastFailedAerialSwingPreferedClimbPath
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection>(Ptr + 186); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 186); }; }
-        }
+        [FieldOffset(186)] public BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection LastFailedAerialSwingPreferedClimbPath;
 
         /// <summary>
         /// BoolProperty: bLastFailedDueToPounceDistance
         /// </summary>
-        public unsafe bool bLastFailedDueToPounceDistance
+        public bool bLastFailedDueToPounceDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 188); }; }
+            readonly get => (_bitfield188 & 1) != 0;
+            set { if (value) _bitfield188 |= 1; else _bitfield188 &= ~1; }
         }
 
         /// <summary>
         /// ByteProperty: LastFailReason
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.ClimbPathFailReason LastFailReason
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.ClimbPathFailReason>(Ptr + 192); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }; }
-        }
+        [FieldOffset(192)] public BmSDK.BmGame.RCwGrappleGunBase.ClimbPathFailReason LastFailReason;
 
         /// <summary>
         /// ByteProperty: LastSuccessfulPreferedClimbPath
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection LastSuccessfulPreferedClimbPath
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection>(Ptr + 193); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 193); }; }
-        }
+        [FieldOffset(193)] public BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection LastSuccessfulPreferedClimbPath;
 
         /// <summary>
         /// ByteProperty: LastFailedStartPoint
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.EStartPoints LastFailedStartPoint
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.EStartPoints>(Ptr + 194); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 194); }; }
-        }
+        [FieldOffset(194)] public BmSDK.BmGame.RCwGrappleGunBase.EStartPoints LastFailedStartPoint;
 
         /// <summary>
         /// StructProperty: LastCheckedAerialSwingStart
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastCheckedAerialSwingStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 196); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 196); }; }
-        }
+        [FieldOffset(196)] public System.Numerics.Vector3 LastCheckedAerialSwingStart;
 
         /// <summary>
         /// StructProperty: InitialLocator
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator InitialLocator
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(Ptr + 208); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }; }
-        }
+        [FieldOffset(208)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator InitialLocator;
 
         /// <summary>
         /// ObjectProperty: LastValidGrapplePoint
@@ -1749,380 +1917,276 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
         /// <summary>
         /// BoolProperty: bLastValidIsCeilingTarget
         /// </summary>
-        public unsafe bool bLastValidIsCeilingTarget
+        public bool bLastValidIsCeilingTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 328) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 328); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 328); }; }
+            readonly get => (_bitfield328 & 1) != 0;
+            set { if (value) _bitfield328 |= 1; else _bitfield328 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: LastValidCeilingLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastValidCeilingLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 332); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }; }
-        }
+        [FieldOffset(332)] public System.Numerics.Vector3 LastValidCeilingLocation;
 
         /// <summary>
         /// StructProperty: WallNormal
         /// </summary>
-        public unsafe System.Numerics.Vector3 WallNormal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 344); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }; }
-        }
+        [FieldOffset(344)] public System.Numerics.Vector3 WallNormal;
 
         /// <summary>
         /// StructProperty: LastTargetLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastTargetLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 356); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }; }
-        }
+        [FieldOffset(356)] public System.Numerics.Vector3 LastTargetLocation;
 
         /// <summary>
         /// StructProperty: LastTargetWallLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastTargetWallLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 368); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }; }
-        }
+        [FieldOffset(368)] public System.Numerics.Vector3 LastTargetWallLocation;
 
         /// <summary>
         /// StructProperty: LastMaxRight
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastMaxRight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 380); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }; }
-        }
+        [FieldOffset(380)] public System.Numerics.Vector3 LastMaxRight;
 
         /// <summary>
         /// StructProperty: LastMaxLeft
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastMaxLeft
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 392); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }; }
-        }
+        [FieldOffset(392)] public System.Numerics.Vector3 LastMaxLeft;
 
         /// <summary>
         /// StructProperty: LastGrappleRight
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastGrappleRight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 404); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }; }
-        }
+        [FieldOffset(404)] public System.Numerics.Vector3 LastGrappleRight;
 
         /// <summary>
         /// StructProperty: LastGrappleLeft
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastGrappleLeft
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 416); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }; }
-        }
+        [FieldOffset(416)] public System.Numerics.Vector3 LastGrappleLeft;
 
         /// <summary>
         /// BoolProperty: bLastExtremeRight
         /// </summary>
-        public unsafe bool bLastExtremeRight
+        public bool bLastExtremeRight
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 428) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 428); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 428); }; }
+            readonly get => (_bitfield428 & 1) != 0;
+            set { if (value) _bitfield428 |= 1; else _bitfield428 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bLastExtremeLeft
         /// </summary>
-        public unsafe bool bLastExtremeLeft
+        public bool bLastExtremeLeft
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 428) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 428); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 428); }; }
+            readonly get => (_bitfield428 & 2) != 0;
+            set { if (value) _bitfield428 |= 2; else _bitfield428 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: EdgeSwingLaunchLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 EdgeSwingLaunchLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 432); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }; }
-        }
+        [FieldOffset(432)] public System.Numerics.Vector3 EdgeSwingLaunchLocation;
 
         /// <summary>
         /// BoolProperty: bEdgeSwingPointCheckFailed
         /// </summary>
-        public unsafe bool bEdgeSwingPointCheckFailed
+        public bool bEdgeSwingPointCheckFailed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }; }
+            readonly get => (_bitfield444 & 1) != 0;
+            set { if (value) _bitfield444 |= 1; else _bitfield444 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bValidEdgeSwingTarget
         /// </summary>
-        public unsafe bool bValidEdgeSwingTarget
+        public bool bValidEdgeSwingTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }; }
+            readonly get => (_bitfield444 & 2) != 0;
+            set { if (value) _bitfield444 |= 2; else _bitfield444 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bAerialSwingPointCheckFailed
         /// </summary>
-        public unsafe bool bAerialSwingPointCheckFailed
+        public bool bAerialSwingPointCheckFailed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }; }
+            readonly get => (_bitfield444 & 4) != 0;
+            set { if (value) _bitfield444 |= 4; else _bitfield444 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bValidAerialSwingTarget
         /// </summary>
-        public unsafe bool bValidAerialSwingTarget
+        public bool bValidAerialSwingTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }; }
+            readonly get => (_bitfield444 & 8) != 0;
+            set { if (value) _bitfield444 |= 8; else _bitfield444 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bValidDirectPounceTarget
         /// </summary>
-        public unsafe bool bValidDirectPounceTarget
+        public bool bValidDirectPounceTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }; }
+            readonly get => (_bitfield444 & 16) != 0;
+            set { if (value) _bitfield444 |= 16; else _bitfield444 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: bValidWallClimbTarget
         /// </summary>
-        public unsafe bool bValidWallClimbTarget
+        public bool bValidWallClimbTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }; }
+            readonly get => (_bitfield444 & 32) != 0;
+            set { if (value) _bitfield444 |= 32; else _bitfield444 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: bValidCeilingTarget
         /// </summary>
-        public unsafe bool bValidCeilingTarget
+        public bool bValidCeilingTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }; }
+            readonly get => (_bitfield444 & 64) != 0;
+            set { if (value) _bitfield444 |= 64; else _bitfield444 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: bValidVantageSwingTarget
         /// </summary>
-        public unsafe bool bValidVantageSwingTarget
+        public bool bValidVantageSwingTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }; }
+            readonly get => (_bitfield444 & 128) != 0;
+            set { if (value) _bitfield444 |= 128; else _bitfield444 &= ~128; }
         }
 
         /// <summary>
         /// StructProperty: AssociatedGrapplePoint
         /// </summary>
-        public unsafe System.IntPtr AssociatedGrapplePoint
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 448); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }; }
-        }
+        [FieldOffset(448)] public System.IntPtr AssociatedGrapplePoint;
 
         /// <summary>
         /// FloatProperty: AssociatedBonusScore
         /// </summary>
-        public unsafe float AssociatedBonusScore
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 452); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }; }
-        }
+        [FieldOffset(452)] public float AssociatedBonusScore;
 
         /// <summary>
         /// StructProperty: LockedExtendedEdgeSwingStart
         /// </summary>
-        public unsafe System.Numerics.Vector3 LockedExtendedEdgeSwingStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 456); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }; }
-        }
+        [FieldOffset(456)] public System.Numerics.Vector3 LockedExtendedEdgeSwingStart;
 
         /// <summary>
         /// StructProperty: LockedExtendedEdgeSwingWallLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 LockedExtendedEdgeSwingWallLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 468); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }; }
-        }
+        [FieldOffset(468)] public System.Numerics.Vector3 LockedExtendedEdgeSwingWallLocation;
 
         /// <summary>
         /// StructProperty: LockedExtendedAerialSwingStart
         /// </summary>
-        public unsafe System.Numerics.Vector3 LockedExtendedAerialSwingStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 480); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }; }
-        }
+        [FieldOffset(480)] public System.Numerics.Vector3 LockedExtendedAerialSwingStart;
 
         /// <summary>
         /// StructProperty: PlayerStartLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 PlayerStartLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 492); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }; }
-        }
+        [FieldOffset(492)] public System.Numerics.Vector3 PlayerStartLocation;
 
         /// <summary>
         /// FloatProperty: SwingHeightOffset
         /// </summary>
-        public unsafe float SwingHeightOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 504); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }; }
-        }
+        [FieldOffset(504)] public float SwingHeightOffset;
 
         /// <summary>
         /// BoolProperty: bDebugNewPath
         /// </summary>
-        public unsafe bool bDebugNewPath
+        public bool bDebugNewPath
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 508); }; }
+            readonly get => (_bitfield508 & 1) != 0;
+            set { if (value) _bitfield508 |= 1; else _bitfield508 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: InitialWallLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 InitialWallLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 512); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }; }
-        }
+        [FieldOffset(512)] public System.Numerics.Vector3 InitialWallLocation;
 
         /// <summary>
         /// StructProperty: InitialLandLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 InitialLandLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 524); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }; }
-        }
+        [FieldOffset(524)] public System.Numerics.Vector3 InitialLandLocation;
 
         /// <summary>
         /// StructProperty: SwingParams
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters SwingParams
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters>(Ptr + 536); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }; }
-        }
+        [FieldOffset(536)] public BmSDK.BmGame.RCwGrappleGunBase.FSwingParameters SwingParams;
 
         /// <summary>
         /// StructProperty: LastFailedSwingLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastFailedSwingLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 628); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 628); }; }
-        }
+        [FieldOffset(628)] public System.Numerics.Vector3 LastFailedSwingLocation;
 
         /// <summary>
         /// BoolProperty: bCheckedLPounceWall
         /// </summary>
-        public unsafe bool bCheckedLPounceWall
+        public bool bCheckedLPounceWall
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 640) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 640); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 640); }; }
+            readonly get => (_bitfield640 & 1) != 0;
+            set { if (value) _bitfield640 |= 1; else _bitfield640 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bFoundLPounceWall
         /// </summary>
-        public unsafe bool bFoundLPounceWall
+        public bool bFoundLPounceWall
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 640) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 640); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 640); }; }
+            readonly get => (_bitfield640 & 2) != 0;
+            set { if (value) _bitfield640 |= 2; else _bitfield640 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: LPounceWallLocation
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator LPounceWallLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(Ptr + 644); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 644); }; }
-        }
+        [FieldOffset(644)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator LPounceWallLocation;
 
         /// <summary>
         /// StructProperty: LastLPounceWallCheckPlayerLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastLPounceWallCheckPlayerLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 756); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 756); }; }
-        }
+        [FieldOffset(756)] public System.Numerics.Vector3 LastLPounceWallCheckPlayerLocation;
 
         /// <summary>
         /// BoolProperty: bFoundLPounceToTarget
         /// </summary>
-        public unsafe bool bFoundLPounceToTarget
+        public bool bFoundLPounceToTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 768); }; }
+            readonly get => (_bitfield768 & 1) != 0;
+            set { if (value) _bitfield768 |= 1; else _bitfield768 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bCheckedLPounceToTarget
         /// </summary>
-        public unsafe bool bCheckedLPounceToTarget
+        public bool bCheckedLPounceToTarget
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 768); }; }
+            readonly get => (_bitfield768 & 2) != 0;
+            set { if (value) _bitfield768 |= 2; else _bitfield768 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: LPounceToTargetLocation
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator LPounceToTargetLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(Ptr + 772); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 772); }; }
-        }
+        [FieldOffset(772)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator LPounceToTargetLocation;
 
         /// <summary>
         /// StructProperty: LastLPounceTargetCheckPlayerLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 LastLPounceTargetCheckPlayerLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 884); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 884); }; }
-        }
+        [FieldOffset(884)] public System.Numerics.Vector3 LastLPounceTargetCheckPlayerLocation;
 
         /// <summary>
         /// NameProperty: LastLPounceTargetCheckState
         /// </summary>
-        public unsafe BmSDK.FName LastLPounceTargetCheckState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 896); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 896); }; }
-        }
+        [FieldOffset(896)] public BmSDK.FName LastLPounceTargetCheckState;
 
         /// <summary>
         /// IntProperty: ArrayIndex
         /// </summary>
-        public unsafe int ArrayIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 904); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 904); }; }
-        }
+        [FieldOffset(904)] public int ArrayIndex;
 
         /// <summary>
         /// ObjectProperty: GrapplePoint
@@ -2145,101 +2209,73 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
         /// <summary>
         /// BoolProperty: bEdgeSwingPointNeedsCheck
         /// </summary>
-        public unsafe bool bEdgeSwingPointNeedsCheck
+        public bool bEdgeSwingPointNeedsCheck
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 916) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 916); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 916); }; }
+            readonly get => (_bitfield916 & 1) != 0;
+            set { if (value) _bitfield916 |= 1; else _bitfield916 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bEdgeSwingUseShortPounceOff
         /// </summary>
-        public unsafe bool bEdgeSwingUseShortPounceOff
+        public bool bEdgeSwingUseShortPounceOff
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 916) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 916); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 916); }; }
+            readonly get => (_bitfield916 & 2) != 0;
+            set { if (value) _bitfield916 |= 2; else _bitfield916 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bAerialSwingPointNeedsCheck
         /// </summary>
-        public unsafe bool bAerialSwingPointNeedsCheck
+        public bool bAerialSwingPointNeedsCheck
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 916) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 916); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 916); }; }
+            readonly get => (_bitfield916 & 4) != 0;
+            set { if (value) _bitfield916 |= 4; else _bitfield916 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bLastSwingCheckWasShortSwing
         /// </summary>
-        public unsafe bool bLastSwingCheckWasShortSwing
+        public bool bLastSwingCheckWasShortSwing
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 916) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 916); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 916); }; }
+            readonly get => (_bitfield916 & 8) != 0;
+            set { if (value) _bitfield916 |= 8; else _bitfield916 &= ~8; }
         }
 
         /// <summary>
         /// StructProperty: DebugLastSwingStartLoc
         /// </summary>
-        public unsafe System.Numerics.Vector3 DebugLastSwingStartLoc
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 920); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 920); }; }
-        }
+        [FieldOffset(920)] public System.Numerics.Vector3 DebugLastSwingStartLoc;
 
         /// <summary>
         /// StructProperty: DebugLastSwingStartVel
         /// </summary>
-        public unsafe System.Numerics.Vector3 DebugLastSwingStartVel
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 932); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 932); }; }
-        }
+        [FieldOffset(932)] public System.Numerics.Vector3 DebugLastSwingStartVel;
 
         /// <summary>
         /// FloatProperty: SwingStartTime
         /// </summary>
-        public unsafe float SwingStartTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 944); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 944); }; }
-        }
+        [FieldOffset(944)] public float SwingStartTime;
 
         /// <summary>
         /// IntProperty: PathRetries
         /// </summary>
-        public unsafe int PathRetries
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 948); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 948); }; }
-        }
+        [FieldOffset(948)] public int PathRetries;
 
         /// <summary>
         /// IntProperty: PathRecalcs
         /// </summary>
-        public unsafe int PathRecalcs
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 952); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 952); }; }
-        }
+        [FieldOffset(952)] public int PathRecalcs;
 
         /// <summary>
         /// StructProperty: ToGrappleLine
         /// </summary>
-        public unsafe System.Numerics.Vector3 ToGrappleLine
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 956); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 956); }; }
-        }
+        [FieldOffset(956)] public System.Numerics.Vector3 ToGrappleLine;
 
         /// <summary>
         /// StructProperty: ToRight
         /// </summary>
-        public unsafe System.Numerics.Vector3 ToRight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 968); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 968); }; }
-        }
+        [FieldOffset(968)] public System.Numerics.Vector3 ToRight;
 
         /// <summary>
         /// ObjectProperty: ClimbLocator
@@ -2257,130 +2293,84 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     [StructLayout(LayoutKind.Explicit, Size = 92)]
     public partial record struct FSwingParameters
     {
+        [FieldOffset(88)] private int _bitfield88;
+
         /// <summary>
         /// StructProperty: SwingStartLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 SwingStartLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector3 SwingStartLocation;
 
         /// <summary>
         /// StructProperty: SwingStartTangent
         /// </summary>
-        public unsafe System.Numerics.Vector3 SwingStartTangent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public System.Numerics.Vector3 SwingStartTangent;
 
         /// <summary>
         /// StructProperty: SwingEndLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 SwingEndLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public System.Numerics.Vector3 SwingEndLocation;
 
         /// <summary>
         /// StructProperty: SwingEndTangent
         /// </summary>
-        public unsafe System.Numerics.Vector3 SwingEndTangent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public System.Numerics.Vector3 SwingEndTangent;
 
         /// <summary>
         /// StructProperty: SwingWallLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 SwingWallLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public System.Numerics.Vector3 SwingWallLocation;
 
         /// <summary>
         /// FloatProperty: SwingTime
         /// </summary>
-        public unsafe float SwingTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float SwingTime;
 
         /// <summary>
         /// FloatProperty: OneOverSwingTime
         /// </summary>
-        public unsafe float OneOverSwingTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float OneOverSwingTime;
 
         /// <summary>
         /// FloatProperty: ProportionAlongPath
         /// </summary>
-        public unsafe float ProportionAlongPath
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float ProportionAlongPath;
 
         /// <summary>
         /// FloatProperty: ProportionAtAnimationStart
         /// </summary>
-        public unsafe float ProportionAtAnimationStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
-        }
+        [FieldOffset(72)] public float ProportionAtAnimationStart;
 
         /// <summary>
         /// FloatProperty: IdealEndYaw
         /// </summary>
-        public unsafe float IdealEndYaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
-        }
+        [FieldOffset(76)] public float IdealEndYaw;
 
         /// <summary>
         /// FloatProperty: IdealStartPitch
         /// </summary>
-        public unsafe float IdealStartPitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
-        }
+        [FieldOffset(80)] public float IdealStartPitch;
 
         /// <summary>
         /// FloatProperty: IdealEndPitch
         /// </summary>
-        public unsafe float IdealEndPitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
-        }
+        [FieldOffset(84)] public float IdealEndPitch;
 
         /// <summary>
         /// BoolProperty: bUsed
         /// </summary>
-        public unsafe bool bUsed
+        public bool bUsed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }; }
+            readonly get => (_bitfield88 & 1) != 0;
+            set { if (value) _bitfield88 |= 1; else _bitfield88 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bValid
         /// </summary>
-        public unsafe bool bValid
+        public bool bValid
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }; }
+            readonly get => (_bitfield88 & 2) != 0;
+            set { if (value) _bitfield88 |= 2; else _bitfield88 &= ~2; }
         }
     }
 
@@ -2402,13 +2392,17 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     [StructLayout(LayoutKind.Explicit, Size = 180)]
     public partial record struct FWallClimbPath
     {
+        [FieldOffset(0)] private int _bitfield0;
+        [FieldOffset(16)] private int _bitfield16;
+        [FieldOffset(24)] private int _bitfield24;
+
         /// <summary>
         /// BoolProperty: bSearchedEdges
         /// </summary>
-        public unsafe bool bSearchedEdges
+        public bool bSearchedEdges
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
@@ -2423,10 +2417,10 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
         /// <summary>
         /// BoolProperty: bClimbToVantagePoint
         /// </summary>
-        public unsafe bool bClimbToVantagePoint
+        public bool bClimbToVantagePoint
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 1) != 0;
+            set { if (value) _bitfield16 |= 1; else _bitfield16 &= ~1; }
         }
 
         /// <summary>
@@ -2441,56 +2435,36 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
         /// <summary>
         /// BoolProperty: bClimbToCeiling
         /// </summary>
-        public unsafe bool bClimbToCeiling
+        public bool bClimbToCeiling
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 1) != 0;
+            set { if (value) _bitfield24 |= 1; else _bitfield24 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: TargetLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 TargetLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector3 TargetLocation;
 
         /// <summary>
         /// StructProperty: TargetNormal
         /// </summary>
-        public unsafe System.Numerics.Vector3 TargetNormal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 TargetNormal;
 
         /// <summary>
         /// StructProperty: OriginalPlayerLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 OriginalPlayerLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public System.Numerics.Vector3 OriginalPlayerLocation;
 
         /// <summary>
         /// StructProperty: TargetFeature
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator TargetFeature
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator TargetFeature;
 
         /// <summary>
         /// FloatProperty: NumClimbSteps
         /// </summary>
-        public unsafe float NumClimbSteps
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 176); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }; }
-        }
+        [FieldOffset(176)] public float NumClimbSteps;
     }
 
     /// <summary>
@@ -2499,275 +2473,179 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     [StructLayout(LayoutKind.Explicit, Size = 292)]
     public partial record struct FWallLandPoint
     {
+        [FieldOffset(0)] private int _bitfield0;
+        [FieldOffset(64)] private int _bitfield64;
+        [FieldOffset(192)] private int _bitfield192;
+
         /// <summary>
         /// BoolProperty: bFoundEdge
         /// </summary>
-        public unsafe bool bFoundEdge
+        public bool bFoundEdge
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bDangleEdge
         /// </summary>
-        public unsafe bool bDangleEdge
+        public bool bDangleEdge
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: Location
         /// </summary>
-        public unsafe System.Numerics.Vector3 Location
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 Location;
 
         /// <summary>
         /// StructProperty: OriginalLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 OriginalLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 OriginalLocation;
 
         /// <summary>
         /// StructProperty: OriginalNormal
         /// </summary>
-        public unsafe System.Numerics.Vector3 OriginalNormal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector3 OriginalNormal;
 
         /// <summary>
         /// StructProperty: NextHoldLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 NextHoldLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 NextHoldLocation;
 
         /// <summary>
         /// StructProperty: NextHoldNormal
         /// </summary>
-        public unsafe System.Numerics.Vector3 NextHoldNormal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public System.Numerics.Vector3 NextHoldNormal;
 
         /// <summary>
         /// BoolProperty: bGotAnyEdge
         /// </summary>
-        public unsafe bool bGotAnyEdge
+        public bool bGotAnyEdge
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }; }
+            readonly get => (_bitfield64 & 1) != 0;
+            set { if (value) _bitfield64 |= 1; else _bitfield64 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: Normal
         /// </summary>
-        public unsafe System.Numerics.Vector3 Normal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public System.Numerics.Vector3 Normal;
 
         /// <summary>
         /// ByteProperty: InDir
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection InDir
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
-        }
+        [FieldOffset(80)] public BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection InDir;
 
         /// <summary>
         /// ByteProperty: OutDir
         /// </summary>
-        public unsafe BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection OutDir
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection>(Ptr + 81); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 81); }; }
-        }
+        [FieldOffset(81)] public BmSDK.BmGame.RCwGrappleGunBase.EClawClimbDirection OutDir;
 
         /// <summary>
         /// StructProperty: CheckRefLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 CheckRefLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
-        }
+        [FieldOffset(84)] public System.Numerics.Vector3 CheckRefLocation;
 
         /// <summary>
         /// StructProperty: CheckStart
         /// </summary>
-        public unsafe System.Numerics.Vector3 CheckStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public System.Numerics.Vector3 CheckStart;
 
         /// <summary>
         /// StructProperty: CheckEnd
         /// </summary>
-        public unsafe System.Numerics.Vector3 CheckEnd
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 108); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }; }
-        }
+        [FieldOffset(108)] public System.Numerics.Vector3 CheckEnd;
 
         /// <summary>
         /// StructProperty: CheckExtent
         /// </summary>
-        public unsafe System.Numerics.Vector3 CheckExtent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 120); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }; }
-        }
+        [FieldOffset(120)] public System.Numerics.Vector3 CheckExtent;
 
         /// <summary>
         /// StructProperty: HitLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 HitLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 132); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }; }
-        }
+        [FieldOffset(132)] public System.Numerics.Vector3 HitLocation;
 
         /// <summary>
         /// StructProperty: FootCheckStart
         /// </summary>
-        public unsafe System.Numerics.Vector3 FootCheckStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 144); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }; }
-        }
+        [FieldOffset(144)] public System.Numerics.Vector3 FootCheckStart;
 
         /// <summary>
         /// StructProperty: FootCheckEnd
         /// </summary>
-        public unsafe System.Numerics.Vector3 FootCheckEnd
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 156); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }; }
-        }
+        [FieldOffset(156)] public System.Numerics.Vector3 FootCheckEnd;
 
         /// <summary>
         /// StructProperty: FootCheckExtent
         /// </summary>
-        public unsafe System.Numerics.Vector3 FootCheckExtent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 168); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }; }
-        }
+        [FieldOffset(168)] public System.Numerics.Vector3 FootCheckExtent;
 
         /// <summary>
         /// StructProperty: FootHitLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 FootHitLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 180); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }; }
-        }
+        [FieldOffset(180)] public System.Numerics.Vector3 FootHitLocation;
 
         /// <summary>
         /// BoolProperty: FootCheckDone
         /// </summary>
-        public unsafe bool FootCheckDone
+        public bool FootCheckDone
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 192) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 192); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 192); }; }
+            readonly get => (_bitfield192 & 1) != 0;
+            set { if (value) _bitfield192 |= 1; else _bitfield192 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: FootCheckFailed
         /// </summary>
-        public unsafe bool FootCheckFailed
+        public bool FootCheckFailed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 192) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 192); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 192); }; }
+            readonly get => (_bitfield192 & 2) != 0;
+            set { if (value) _bitfield192 |= 2; else _bitfield192 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: SpotCheck
         /// </summary>
-        public unsafe System.Numerics.Vector3 SpotCheck
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 196); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 196); }; }
-        }
+        [FieldOffset(196)] public System.Numerics.Vector3 SpotCheck;
 
         /// <summary>
         /// StructProperty: ToNextExtent
         /// </summary>
-        public unsafe System.Numerics.Vector3 ToNextExtent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 208); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }; }
-        }
+        [FieldOffset(208)] public System.Numerics.Vector3 ToNextExtent;
 
         /// <summary>
         /// StructProperty: ToNextStart
         /// </summary>
-        public unsafe System.Numerics.Vector3 ToNextStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 220); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }; }
-        }
+        [FieldOffset(220)] public System.Numerics.Vector3 ToNextStart;
 
         /// <summary>
         /// StructProperty: ToNextEnd
         /// </summary>
-        public unsafe System.Numerics.Vector3 ToNextEnd
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 232); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }; }
-        }
+        [FieldOffset(232)] public System.Numerics.Vector3 ToNextEnd;
 
         /// <summary>
         /// StructProperty: Spot2Check
         /// </summary>
-        public unsafe System.Numerics.Vector3 Spot2Check
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 244); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }; }
-        }
+        [FieldOffset(244)] public System.Numerics.Vector3 Spot2Check;
 
         /// <summary>
         /// StructProperty: ToNext2Extent
         /// </summary>
-        public unsafe System.Numerics.Vector3 ToNext2Extent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 256); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }; }
-        }
+        [FieldOffset(256)] public System.Numerics.Vector3 ToNext2Extent;
 
         /// <summary>
         /// StructProperty: ToNext2Start
         /// </summary>
-        public unsafe System.Numerics.Vector3 ToNext2Start
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 268); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }; }
-        }
+        [FieldOffset(268)] public System.Numerics.Vector3 ToNext2Start;
 
         /// <summary>
         /// StructProperty: ToNext2End
         /// </summary>
-        public unsafe System.Numerics.Vector3 ToNext2End
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 280); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 280); }; }
-        }
+        [FieldOffset(280)] public System.Numerics.Vector3 ToNext2End;
     }
 
     /// <summary>
@@ -3149,8 +3027,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float CamSwitchTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1880); }
+        get { return *(float*)(Ptr + 1880); }
+        set { *(float*)(Ptr + 1880) = value; }
     }
 
     /// <summary>
@@ -3158,8 +3036,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxWhipBoost2dRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1884); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1884); }
+        get { return *(float*)(Ptr + 1884); }
+        set { *(float*)(Ptr + 1884) = value; }
     }
 
     /// <summary>
@@ -3167,8 +3045,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugTargetModes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 1; else *(int*)(Ptr + 1888) &= ~1; }
     }
 
     /// <summary>
@@ -3176,8 +3054,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugSwingPath
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 2; else *(int*)(Ptr + 1888) &= ~2; }
     }
 
     /// <summary>
@@ -3185,8 +3063,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugWallClimb
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 4; else *(int*)(Ptr + 1888) &= ~4; }
     }
 
     /// <summary>
@@ -3194,8 +3072,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugWallClimbPersistent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 8; else *(int*)(Ptr + 1888) &= ~8; }
     }
 
     /// <summary>
@@ -3203,8 +3081,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugDrawPath
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 16; else *(int*)(Ptr + 1888) &= ~16; }
     }
 
     /// <summary>
@@ -3212,8 +3090,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugDrawPathPersistent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 32; else *(int*)(Ptr + 1888) &= ~32; }
     }
 
     /// <summary>
@@ -3221,8 +3099,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugDrawPathPounces
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 64; else *(int*)(Ptr + 1888) &= ~64; }
     }
 
     /// <summary>
@@ -3230,8 +3108,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugDrawPathWallChecks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 128; else *(int*)(Ptr + 1888) &= ~128; }
     }
 
     /// <summary>
@@ -3239,8 +3117,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugDrawInitialTestPersistent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 256; else *(int*)(Ptr + 1888) &= ~256; }
     }
 
     /// <summary>
@@ -3248,8 +3126,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugDrawCeilingChecks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 512; else *(int*)(Ptr + 1888) &= ~512; }
     }
 
     /// <summary>
@@ -3257,8 +3135,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugForcePathRecalculation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 1024; else *(int*)(Ptr + 1888) &= ~1024; }
     }
 
     /// <summary>
@@ -3266,8 +3144,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugForceFallbackPath
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 2048; else *(int*)(Ptr + 1888) &= ~2048; }
     }
 
     /// <summary>
@@ -3275,8 +3153,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugEdgeSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 4096; else *(int*)(Ptr + 1888) &= ~4096; }
     }
 
     /// <summary>
@@ -3284,8 +3162,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugEdgeSwingLaunch
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 8192; else *(int*)(Ptr + 1888) &= ~8192; }
     }
 
     /// <summary>
@@ -3293,8 +3171,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugEdgeSwingStartCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 16384; else *(int*)(Ptr + 1888) &= ~16384; }
     }
 
     /// <summary>
@@ -3302,8 +3180,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugEdgeSwingSkipFinalPounceCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 32768; else *(int*)(Ptr + 1888) &= ~32768; }
     }
 
     /// <summary>
@@ -3311,8 +3189,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugSkipInitialSwingHitCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 65536; else *(int*)(Ptr + 1888) &= ~65536; }
     }
 
     /// <summary>
@@ -3320,8 +3198,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugShortEdgeSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 131072; else *(int*)(Ptr + 1888) &= ~131072; }
     }
 
     /// <summary>
@@ -3329,8 +3207,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugAerialSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 262144; else *(int*)(Ptr + 1888) &= ~262144; }
     }
 
     /// <summary>
@@ -3338,8 +3216,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugLongPounceIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 524288; else *(int*)(Ptr + 1888) &= ~524288; }
     }
 
     /// <summary>
@@ -3347,8 +3225,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugLongPounceInDirectPounce
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 1048576; else *(int*)(Ptr + 1888) &= ~1048576; }
     }
 
     /// <summary>
@@ -3356,8 +3234,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugLongPounceDraw
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 2097152; else *(int*)(Ptr + 1888) &= ~2097152; }
     }
 
     /// <summary>
@@ -3365,8 +3243,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugInitialPounceToWall
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 4194304; else *(int*)(Ptr + 1888) &= ~4194304; }
     }
 
     /// <summary>
@@ -3374,8 +3252,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugCheckWallStick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 8388608; else *(int*)(Ptr + 1888) &= ~8388608; }
     }
 
     /// <summary>
@@ -3383,8 +3261,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugSkipInitialPathTest
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 16777216; else *(int*)(Ptr + 1888) &= ~16777216; }
     }
 
     /// <summary>
@@ -3392,8 +3270,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugSuppressGrapplePoints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 33554432; else *(int*)(Ptr + 1888) &= ~33554432; }
     }
 
     /// <summary>
@@ -3401,8 +3279,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugDelayedSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 67108864; else *(int*)(Ptr + 1888) &= ~67108864; }
     }
 
     /// <summary>
@@ -3410,8 +3288,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugSwingStart
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 134217728; else *(int*)(Ptr + 1888) &= ~134217728; }
     }
 
     /// <summary>
@@ -3419,8 +3297,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugDrawLinkedHidePoints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 268435456; else *(int*)(Ptr + 1888) &= ~268435456; }
     }
 
     /// <summary>
@@ -3428,8 +3306,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugClimbLocators
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 536870912; else *(int*)(Ptr + 1888) &= ~536870912; }
     }
 
     /// <summary>
@@ -3437,8 +3315,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugPounceTargetingIterations
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= 1073741824; else *(int*)(Ptr + 1888) &= ~1073741824; }
     }
 
     /// <summary>
@@ -3446,8 +3324,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugLocatorChainAlignment
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1888); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1888); }
+        get { return (*(int*)(Ptr + 1888) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 1888) |= -2147483648; else *(int*)(Ptr + 1888) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -3455,8 +3333,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bEnableEdgeSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 1; else *(int*)(Ptr + 1892) &= ~1; }
     }
 
     /// <summary>
@@ -3464,8 +3342,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bEnableDelayedSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 2; else *(int*)(Ptr + 1892) &= ~2; }
     }
 
     /// <summary>
@@ -3473,8 +3351,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bAutoClimbFromWallStick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 4; else *(int*)(Ptr + 1892) &= ~4; }
     }
 
     /// <summary>
@@ -3482,8 +3360,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bClimbUseLookAt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 8; else *(int*)(Ptr + 1892) &= ~8; }
     }
 
     /// <summary>
@@ -3491,8 +3369,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bClimbCamOverlay
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 16; else *(int*)(Ptr + 1892) &= ~16; }
     }
 
     /// <summary>
@@ -3500,8 +3378,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bPawnAtSwingEdge
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 32; else *(int*)(Ptr + 1892) &= ~32; }
     }
 
     /// <summary>
@@ -3509,8 +3387,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bScaleLR
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 64; else *(int*)(Ptr + 1892) &= ~64; }
     }
 
     /// <summary>
@@ -3518,8 +3396,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bScaleLRClampMin
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 128; else *(int*)(Ptr + 1892) &= ~128; }
     }
 
     /// <summary>
@@ -3527,8 +3405,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bScaleLRClampMax
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 256; else *(int*)(Ptr + 1892) &= ~256; }
     }
 
     /// <summary>
@@ -3536,8 +3414,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bScaleUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 512; else *(int*)(Ptr + 1892) &= ~512; }
     }
 
     /// <summary>
@@ -3545,8 +3423,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bClipLR
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 1024; else *(int*)(Ptr + 1892) &= ~1024; }
     }
 
     /// <summary>
@@ -3554,8 +3432,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bClipUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 2048; else *(int*)(Ptr + 1892) &= ~2048; }
     }
 
     /// <summary>
@@ -3563,8 +3441,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bFinalScaleLR
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 4096; else *(int*)(Ptr + 1892) &= ~4096; }
     }
 
     /// <summary>
@@ -3572,8 +3450,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bFinalScaleUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 8192; else *(int*)(Ptr + 1892) &= ~8192; }
     }
 
     /// <summary>
@@ -3581,8 +3459,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bFinalClipLR
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 16384; else *(int*)(Ptr + 1892) &= ~16384; }
     }
 
     /// <summary>
@@ -3590,8 +3468,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bFinalClipUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 32768; else *(int*)(Ptr + 1892) &= ~32768; }
     }
 
     /// <summary>
@@ -3599,8 +3477,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bOptimisePaths
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 65536; else *(int*)(Ptr + 1892) &= ~65536; }
     }
 
     /// <summary>
@@ -3608,8 +3486,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugVantageTrace
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 131072; else *(int*)(Ptr + 1892) &= ~131072; }
     }
 
     /// <summary>
@@ -3617,8 +3495,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bUseNewVantagePath
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 262144; else *(int*)(Ptr + 1892) &= ~262144; }
     }
 
     /// <summary>
@@ -3626,8 +3504,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bDebugForceHoldOntoLedge
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 524288; else *(int*)(Ptr + 1892) &= ~524288; }
     }
 
     /// <summary>
@@ -3635,8 +3513,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bLastCeilingCheckResult
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 1048576; else *(int*)(Ptr + 1892) &= ~1048576; }
     }
 
     /// <summary>
@@ -3644,8 +3522,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bTriggeredWhipImpactFX
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 2097152; else *(int*)(Ptr + 1892) &= ~2097152; }
     }
 
     /// <summary>
@@ -3653,8 +3531,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bExtraPounceTargetIteration
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 4194304; else *(int*)(Ptr + 1892) &= ~4194304; }
     }
 
     /// <summary>
@@ -3662,8 +3540,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bEnableSwingParamsCaching
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 8388608; else *(int*)(Ptr + 1892) &= ~8388608; }
     }
 
     /// <summary>
@@ -3671,8 +3549,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bGASSPLastResult
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1892); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1892); }
+        get { return (*(int*)(Ptr + 1892) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 1892) |= 16777216; else *(int*)(Ptr + 1892) &= ~16777216; }
     }
 
     /// <summary>
@@ -3680,8 +3558,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinimumSwingTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1896); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1896); }
+        get { return *(float*)(Ptr + 1896); }
+        set { *(float*)(Ptr + 1896) = value; }
     }
 
     /// <summary>
@@ -3689,8 +3567,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int CurrentLandPointIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1900); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1900); }
+        get { return *(int*)(Ptr + 1900); }
+        set { *(int*)(Ptr + 1900) = value; }
     }
 
     /// <summary>
@@ -3710,8 +3588,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float LastClimbInfoTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3872); }
+        get { return *(float*)(Ptr + 3872); }
+        set { *(float*)(Ptr + 3872) = value; }
     }
 
     /// <summary>
@@ -3719,8 +3597,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float LastClimbInfoDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3876); }
+        get { return *(float*)(Ptr + 3876); }
+        set { *(float*)(Ptr + 3876) = value; }
     }
 
     /// <summary>
@@ -3749,8 +3627,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxDistanceToWall
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4016); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4016); }
+        get { return *(float*)(Ptr + 4016); }
+        set { *(float*)(Ptr + 4016) = value; }
     }
 
     /// <summary>
@@ -3758,8 +3636,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxDistanceToWallDirectPounce
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4020); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4020); }
+        get { return *(float*)(Ptr + 4020); }
+        set { *(float*)(Ptr + 4020) = value; }
     }
 
     /// <summary>
@@ -3767,8 +3645,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxDirectPounceDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4024); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4024); }
+        get { return *(float*)(Ptr + 4024); }
+        set { *(float*)(Ptr + 4024) = value; }
     }
 
     /// <summary>
@@ -3776,8 +3654,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxHDistanceToPouncePoints
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4028); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4028); }
+        get { return *(float*)(Ptr + 4028); }
+        set { *(float*)(Ptr + 4028) = value; }
     }
 
     /// <summary>
@@ -3785,8 +3663,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxPounceHeightToVantagePoints
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4032); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4032); }
+        get { return *(float*)(Ptr + 4032); }
+        set { *(float*)(Ptr + 4032) = value; }
     }
 
     /// <summary>
@@ -3794,8 +3672,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxPounceHeightToVantagePointsHPH
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4036); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4036); }
+        get { return *(float*)(Ptr + 4036); }
+        set { *(float*)(Ptr + 4036) = value; }
     }
 
     /// <summary>
@@ -3803,8 +3681,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxPounceHeightToLedges
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4040); }
+        get { return *(float*)(Ptr + 4040); }
+        set { *(float*)(Ptr + 4040) = value; }
     }
 
     /// <summary>
@@ -3812,8 +3690,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinPounceHeightToLedges
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4044); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4044); }
+        get { return *(float*)(Ptr + 4044); }
+        set { *(float*)(Ptr + 4044) = value; }
     }
 
     /// <summary>
@@ -3821,8 +3699,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxDistanceToWallDirectPounceHPH
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4048); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4048); }
+        get { return *(float*)(Ptr + 4048); }
+        set { *(float*)(Ptr + 4048) = value; }
     }
 
     /// <summary>
@@ -3830,8 +3708,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxDirectPounceDistanceHPH
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4052); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4052); }
+        get { return *(float*)(Ptr + 4052); }
+        set { *(float*)(Ptr + 4052) = value; }
     }
 
     /// <summary>
@@ -3839,8 +3717,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxWallClimbCosRightAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4056); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4056); }
+        get { return *(float*)(Ptr + 4056); }
+        set { *(float*)(Ptr + 4056) = value; }
     }
 
     /// <summary>
@@ -3848,8 +3726,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinWallClimbMargin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4060); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4060); }
+        get { return *(float*)(Ptr + 4060); }
+        set { *(float*)(Ptr + 4060) = value; }
     }
 
     /// <summary>
@@ -3857,8 +3735,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxWallClimbWidth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4064); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4064); }
+        get { return *(float*)(Ptr + 4064); }
+        set { *(float*)(Ptr + 4064) = value; }
     }
 
     /// <summary>
@@ -3866,8 +3744,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxHorizontalWallPounce
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4068); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4068); }
+        get { return *(float*)(Ptr + 4068); }
+        set { *(float*)(Ptr + 4068) = value; }
     }
 
     /// <summary>
@@ -3875,8 +3753,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float GrappleTargetEdgeMaxCos
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4072); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4072); }
+        get { return *(float*)(Ptr + 4072); }
+        set { *(float*)(Ptr + 4072) = value; }
     }
 
     /// <summary>
@@ -3884,8 +3762,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float GrappleTargetNormalMaxCos
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4076); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4076); }
+        get { return *(float*)(Ptr + 4076); }
+        set { *(float*)(Ptr + 4076) = value; }
     }
 
     /// <summary>
@@ -3893,8 +3771,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float VantagePathWidth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4080); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4080); }
+        get { return *(float*)(Ptr + 4080); }
+        set { *(float*)(Ptr + 4080) = value; }
     }
 
     /// <summary>
@@ -3902,8 +3780,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float VantagePathWidthNew
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4084); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4084); }
+        get { return *(float*)(Ptr + 4084); }
+        set { *(float*)(Ptr + 4084) = value; }
     }
 
     /// <summary>
@@ -3911,8 +3789,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxEdgeToAerialDelayTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4088); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4088); }
+        get { return *(float*)(Ptr + 4088); }
+        set { *(float*)(Ptr + 4088) = value; }
     }
 
     /// <summary>
@@ -3920,8 +3798,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxAerialToAerialDelayTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4092); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4092); }
+        get { return *(float*)(Ptr + 4092); }
+        set { *(float*)(Ptr + 4092) = value; }
     }
 
     /// <summary>
@@ -3938,8 +3816,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.BmGame.RCwGrappleGunBase.EClawClimbStartMode ClawClimbStartMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RCwGrappleGunBase.EClawClimbStartMode>(Ptr + 4100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4100); }
+        get { return *(BmSDK.BmGame.RCwGrappleGunBase.EClawClimbStartMode*)(Ptr + 4100); }
+        set { *(BmSDK.BmGame.RCwGrappleGunBase.EClawClimbStartMode*)(Ptr + 4100) = value; }
     }
 
     /// <summary>
@@ -3947,8 +3825,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float CamOverlayStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4104); }
+        get { return *(float*)(Ptr + 4104); }
+        set { *(float*)(Ptr + 4104) = value; }
     }
 
     /// <summary>
@@ -4055,8 +3933,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float EdgeSwingLaunchCheckShift
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4264); }
+        get { return *(float*)(Ptr + 4264); }
+        set { *(float*)(Ptr + 4264) = value; }
     }
 
     /// <summary>
@@ -4064,8 +3942,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float SwingStartIdealZTolerance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4268); }
+        get { return *(float*)(Ptr + 4268); }
+        set { *(float*)(Ptr + 4268) = value; }
     }
 
     /// <summary>
@@ -4073,8 +3951,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float SwingStartMaxZAbovePlayerTolerance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4272); }
+        get { return *(float*)(Ptr + 4272); }
+        set { *(float*)(Ptr + 4272) = value; }
     }
 
     /// <summary>
@@ -4082,8 +3960,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float EdgeSwingGrappleTargetPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4276); }
+        get { return *(float*)(Ptr + 4276); }
+        set { *(float*)(Ptr + 4276) = value; }
     }
 
     /// <summary>
@@ -4091,8 +3969,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float EdgeSwingExtraFallFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4280); }
+        get { return *(float*)(Ptr + 4280); }
+        set { *(float*)(Ptr + 4280) = value; }
     }
 
     /// <summary>
@@ -4100,8 +3978,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinEdgeSwingDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4284); }
+        get { return *(float*)(Ptr + 4284); }
+        set { *(float*)(Ptr + 4284) = value; }
     }
 
     /// <summary>
@@ -4109,8 +3987,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxEdgeSwingTan
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4288); }
+        get { return *(float*)(Ptr + 4288); }
+        set { *(float*)(Ptr + 4288) = value; }
     }
 
     /// <summary>
@@ -4118,8 +3996,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float CloseSwingDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4292); }
+        get { return *(float*)(Ptr + 4292); }
+        set { *(float*)(Ptr + 4292) = value; }
     }
 
     /// <summary>
@@ -4127,8 +4005,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxDistanceForAimedEdgeSwingGrapple
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4296); }
+        get { return *(float*)(Ptr + 4296); }
+        set { *(float*)(Ptr + 4296) = value; }
     }
 
     /// <summary>
@@ -4136,8 +4014,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinSwingWallLandToGrappleDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4300); }
+        get { return *(float*)(Ptr + 4300); }
+        set { *(float*)(Ptr + 4300) = value; }
     }
 
     /// <summary>
@@ -4145,8 +4023,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinEdgeShortSwingHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4304); }
+        get { return *(float*)(Ptr + 4304); }
+        set { *(float*)(Ptr + 4304) = value; }
     }
 
     /// <summary>
@@ -4154,8 +4032,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float EdgeShortSwingHDistThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4308); }
+        get { return *(float*)(Ptr + 4308); }
+        set { *(float*)(Ptr + 4308) = value; }
     }
 
     /// <summary>
@@ -4163,8 +4041,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ForceShortPounceOffHThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4312); }
+        get { return *(float*)(Ptr + 4312); }
+        set { *(float*)(Ptr + 4312) = value; }
     }
 
     /// <summary>
@@ -4172,8 +4050,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ForceShortPounceOffZThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4316); }
+        get { return *(float*)(Ptr + 4316); }
+        set { *(float*)(Ptr + 4316) = value; }
     }
 
     /// <summary>
@@ -4181,8 +4059,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinAerialSwingDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4320); }
+        get { return *(float*)(Ptr + 4320); }
+        set { *(float*)(Ptr + 4320) = value; }
     }
 
     /// <summary>
@@ -4190,8 +4068,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float AerialSwingTargetCloseRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4324); }
+        get { return *(float*)(Ptr + 4324); }
+        set { *(float*)(Ptr + 4324) = value; }
     }
 
     /// <summary>
@@ -4199,8 +4077,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float AerialSwingTargetMaxExtraDrop
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4328); }
+        get { return *(float*)(Ptr + 4328); }
+        set { *(float*)(Ptr + 4328) = value; }
     }
 
     /// <summary>
@@ -4208,8 +4086,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float AerialSwingTargetDropPerMs
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4332); }
+        get { return *(float*)(Ptr + 4332); }
+        set { *(float*)(Ptr + 4332) = value; }
     }
 
     /// <summary>
@@ -4217,8 +4095,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxSwingWallTargetHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4336); }
+        get { return *(float*)(Ptr + 4336); }
+        set { *(float*)(Ptr + 4336) = value; }
     }
 
     /// <summary>
@@ -4226,8 +4104,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxSwingHeightOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4340); }
+        get { return *(float*)(Ptr + 4340); }
+        set { *(float*)(Ptr + 4340) = value; }
     }
 
     /// <summary>
@@ -4235,8 +4113,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinSwingHeightOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4344); }
+        get { return *(float*)(Ptr + 4344); }
+        set { *(float*)(Ptr + 4344) = value; }
     }
 
     /// <summary>
@@ -4244,8 +4122,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ClimbStartPointExtraDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4348); }
+        get { return *(float*)(Ptr + 4348); }
+        set { *(float*)(Ptr + 4348) = value; }
     }
 
     /// <summary>
@@ -4265,8 +4143,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float WallCheckOut
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4376); }
+        get { return *(float*)(Ptr + 4376); }
+        set { *(float*)(Ptr + 4376) = value; }
     }
 
     /// <summary>
@@ -4274,8 +4152,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float WallCheckIn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4380); }
+        get { return *(float*)(Ptr + 4380); }
+        set { *(float*)(Ptr + 4380) = value; }
     }
 
     /// <summary>
@@ -4283,8 +4161,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float WallCheckInVantage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4384); }
+        get { return *(float*)(Ptr + 4384); }
+        set { *(float*)(Ptr + 4384) = value; }
     }
 
     /// <summary>
@@ -4292,8 +4170,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxWallOut
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4388); }
+        get { return *(float*)(Ptr + 4388); }
+        set { *(float*)(Ptr + 4388) = value; }
     }
 
     /// <summary>
@@ -4331,8 +4209,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float WallHandToFootCheckZDiff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4452); }
+        get { return *(float*)(Ptr + 4452); }
+        set { *(float*)(Ptr + 4452) = value; }
     }
 
     /// <summary>
@@ -4340,8 +4218,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float WallHandsToFeetInTolerance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4456); }
+        get { return *(float*)(Ptr + 4456); }
+        set { *(float*)(Ptr + 4456) = value; }
     }
 
     /// <summary>
@@ -4349,8 +4227,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float AlongWallCheckDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4460); }
+        get { return *(float*)(Ptr + 4460); }
+        set { *(float*)(Ptr + 4460) = value; }
     }
 
     /// <summary>
@@ -4358,8 +4236,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float AlongWallExtraEndOutOfWallDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4464); }
+        get { return *(float*)(Ptr + 4464); }
+        set { *(float*)(Ptr + 4464) = value; }
     }
 
     /// <summary>
@@ -4367,8 +4245,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float AlongWallExtraStartOutOfWallDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4468); }
+        get { return *(float*)(Ptr + 4468); }
+        set { *(float*)(Ptr + 4468) = value; }
     }
 
     /// <summary>
@@ -4376,8 +4254,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float AlongWallExtraEndIntoWallDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4472); }
+        get { return *(float*)(Ptr + 4472); }
+        set { *(float*)(Ptr + 4472) = value; }
     }
 
     /// <summary>
@@ -4385,8 +4263,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float AlongWallExtraStartIntoWallDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4476); }
+        get { return *(float*)(Ptr + 4476); }
+        set { *(float*)(Ptr + 4476) = value; }
     }
 
     /// <summary>
@@ -4394,8 +4272,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float EdgeLocationCheckDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4480); }
+        get { return *(float*)(Ptr + 4480); }
+        set { *(float*)(Ptr + 4480) = value; }
     }
 
     /// <summary>
@@ -4403,8 +4281,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float GrappleCheckOut
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4484); }
+        get { return *(float*)(Ptr + 4484); }
+        set { *(float*)(Ptr + 4484) = value; }
     }
 
     /// <summary>
@@ -4418,8 +4296,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxWallStickHidePointInDiff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4500); }
+        get { return *(float*)(Ptr + 4500); }
+        set { *(float*)(Ptr + 4500) = value; }
     }
 
     /// <summary>
@@ -4427,8 +4305,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxWallStickHidePointOutDiff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4504); }
+        get { return *(float*)(Ptr + 4504); }
+        set { *(float*)(Ptr + 4504) = value; }
     }
 
     /// <summary>
@@ -4436,8 +4314,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxRunningEdgeSwingCheckRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4508); }
+        get { return *(float*)(Ptr + 4508); }
+        set { *(float*)(Ptr + 4508) = value; }
     }
 
     /// <summary>
@@ -4445,8 +4323,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinRunningEdgeSwingCheckRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4512); }
+        get { return *(float*)(Ptr + 4512); }
+        set { *(float*)(Ptr + 4512) = value; }
     }
 
     /// <summary>
@@ -4454,8 +4332,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxStandingEdgeSwingCheckRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4516); }
+        get { return *(float*)(Ptr + 4516); }
+        set { *(float*)(Ptr + 4516) = value; }
     }
 
     /// <summary>
@@ -4463,8 +4341,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinStandingEdgeSwingCheckRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4520); }
+        get { return *(float*)(Ptr + 4520); }
+        set { *(float*)(Ptr + 4520) = value; }
     }
 
     /// <summary>
@@ -4472,8 +4350,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float EdgeSwingCheckRangeSteps
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4524); }
+        get { return *(float*)(Ptr + 4524); }
+        set { *(float*)(Ptr + 4524) = value; }
     }
 
     /// <summary>
@@ -4490,8 +4368,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float SwingJumpToWallPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4532); }
+        get { return *(float*)(Ptr + 4532); }
+        set { *(float*)(Ptr + 4532) = value; }
     }
 
     /// <summary>
@@ -4499,8 +4377,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float SwingJumpToWallSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4536); }
+        get { return *(float*)(Ptr + 4536); }
+        set { *(float*)(Ptr + 4536) = value; }
     }
 
     /// <summary>
@@ -4508,8 +4386,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FirstClimbStepToCeiling
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4540); }
+        get { return *(float*)(Ptr + 4540); }
+        set { *(float*)(Ptr + 4540) = value; }
     }
 
     /// <summary>
@@ -4523,8 +4401,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float CeilingTraceHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4556); }
+        get { return *(float*)(Ptr + 4556); }
+        set { *(float*)(Ptr + 4556) = value; }
     }
 
     /// <summary>
@@ -4532,8 +4410,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinLRDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4560); }
+        get { return *(float*)(Ptr + 4560); }
+        set { *(float*)(Ptr + 4560) = value; }
     }
 
     /// <summary>
@@ -4541,8 +4419,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxLRDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4564); }
+        get { return *(float*)(Ptr + 4564); }
+        set { *(float*)(Ptr + 4564) = value; }
     }
 
     /// <summary>
@@ -4550,8 +4428,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinLRScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4568); }
+        get { return *(float*)(Ptr + 4568); }
+        set { *(float*)(Ptr + 4568) = value; }
     }
 
     /// <summary>
@@ -4559,8 +4437,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxLRScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4572); }
+        get { return *(float*)(Ptr + 4572); }
+        set { *(float*)(Ptr + 4572) = value; }
     }
 
     /// <summary>
@@ -4568,8 +4446,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float LRScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4576); }
+        get { return *(float*)(Ptr + 4576); }
+        set { *(float*)(Ptr + 4576) = value; }
     }
 
     /// <summary>
@@ -4577,8 +4455,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinUpDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4580); }
+        get { return *(float*)(Ptr + 4580); }
+        set { *(float*)(Ptr + 4580) = value; }
     }
 
     /// <summary>
@@ -4586,8 +4464,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxUpDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4584); }
+        get { return *(float*)(Ptr + 4584); }
+        set { *(float*)(Ptr + 4584) = value; }
     }
 
     /// <summary>
@@ -4595,8 +4473,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4588); }
+        get { return *(float*)(Ptr + 4588); }
+        set { *(float*)(Ptr + 4588) = value; }
     }
 
     /// <summary>
@@ -4604,8 +4482,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4592); }
+        get { return *(float*)(Ptr + 4592); }
+        set { *(float*)(Ptr + 4592) = value; }
     }
 
     /// <summary>
@@ -4613,8 +4491,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float UpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4596); }
+        get { return *(float*)(Ptr + 4596); }
+        set { *(float*)(Ptr + 4596) = value; }
     }
 
     /// <summary>
@@ -4622,8 +4500,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ClipLRIdealDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4600); }
+        get { return *(float*)(Ptr + 4600); }
+        set { *(float*)(Ptr + 4600) = value; }
     }
 
     /// <summary>
@@ -4631,8 +4509,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ClipLRPer100
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4604); }
+        get { return *(float*)(Ptr + 4604); }
+        set { *(float*)(Ptr + 4604) = value; }
     }
 
     /// <summary>
@@ -4640,8 +4518,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ClipLRMaxTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4608); }
+        get { return *(float*)(Ptr + 4608); }
+        set { *(float*)(Ptr + 4608) = value; }
     }
 
     /// <summary>
@@ -4649,8 +4527,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ClipUpIdealDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4612); }
+        get { return *(float*)(Ptr + 4612); }
+        set { *(float*)(Ptr + 4612) = value; }
     }
 
     /// <summary>
@@ -4658,8 +4536,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ClipUpPer100
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4616); }
+        get { return *(float*)(Ptr + 4616); }
+        set { *(float*)(Ptr + 4616) = value; }
     }
 
     /// <summary>
@@ -4667,8 +4545,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float ClipUpMaxTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4620); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4620); }
+        get { return *(float*)(Ptr + 4620); }
+        set { *(float*)(Ptr + 4620) = value; }
     }
 
     /// <summary>
@@ -4676,8 +4554,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalMinLRDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4624); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4624); }
+        get { return *(float*)(Ptr + 4624); }
+        set { *(float*)(Ptr + 4624) = value; }
     }
 
     /// <summary>
@@ -4685,8 +4563,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalMaxLRDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4628); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4628); }
+        get { return *(float*)(Ptr + 4628); }
+        set { *(float*)(Ptr + 4628) = value; }
     }
 
     /// <summary>
@@ -4694,8 +4572,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalMinLRScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4632); }
+        get { return *(float*)(Ptr + 4632); }
+        set { *(float*)(Ptr + 4632) = value; }
     }
 
     /// <summary>
@@ -4703,8 +4581,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalMaxLRScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4636); }
+        get { return *(float*)(Ptr + 4636); }
+        set { *(float*)(Ptr + 4636) = value; }
     }
 
     /// <summary>
@@ -4712,8 +4590,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalLRScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4640); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4640); }
+        get { return *(float*)(Ptr + 4640); }
+        set { *(float*)(Ptr + 4640) = value; }
     }
 
     /// <summary>
@@ -4721,8 +4599,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalMinUpDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4644); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4644); }
+        get { return *(float*)(Ptr + 4644); }
+        set { *(float*)(Ptr + 4644) = value; }
     }
 
     /// <summary>
@@ -4730,8 +4608,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalMaxUpDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4648); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4648); }
+        get { return *(float*)(Ptr + 4648); }
+        set { *(float*)(Ptr + 4648) = value; }
     }
 
     /// <summary>
@@ -4739,8 +4617,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalMinUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4652); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4652); }
+        get { return *(float*)(Ptr + 4652); }
+        set { *(float*)(Ptr + 4652) = value; }
     }
 
     /// <summary>
@@ -4748,8 +4626,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalMaxUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4656); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4656); }
+        get { return *(float*)(Ptr + 4656); }
+        set { *(float*)(Ptr + 4656) = value; }
     }
 
     /// <summary>
@@ -4757,8 +4635,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4660); }
+        get { return *(float*)(Ptr + 4660); }
+        set { *(float*)(Ptr + 4660) = value; }
     }
 
     /// <summary>
@@ -4766,8 +4644,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalClipLRIdealDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4664); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4664); }
+        get { return *(float*)(Ptr + 4664); }
+        set { *(float*)(Ptr + 4664) = value; }
     }
 
     /// <summary>
@@ -4775,8 +4653,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalClipLRPer100
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4668); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4668); }
+        get { return *(float*)(Ptr + 4668); }
+        set { *(float*)(Ptr + 4668) = value; }
     }
 
     /// <summary>
@@ -4784,8 +4662,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalClipLRMaxTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4672); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4672); }
+        get { return *(float*)(Ptr + 4672); }
+        set { *(float*)(Ptr + 4672) = value; }
     }
 
     /// <summary>
@@ -4793,8 +4671,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalClipUpIdealDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4676); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4676); }
+        get { return *(float*)(Ptr + 4676); }
+        set { *(float*)(Ptr + 4676) = value; }
     }
 
     /// <summary>
@@ -4802,8 +4680,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalClipUpPer100
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4680); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4680); }
+        get { return *(float*)(Ptr + 4680); }
+        set { *(float*)(Ptr + 4680) = value; }
     }
 
     /// <summary>
@@ -4811,8 +4689,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float FinalClipUpMaxTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4684); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4684); }
+        get { return *(float*)(Ptr + 4684); }
+        set { *(float*)(Ptr + 4684) = value; }
     }
 
     /// <summary>
@@ -4820,8 +4698,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float PounceDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4688); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4688); }
+        get { return *(float*)(Ptr + 4688); }
+        set { *(float*)(Ptr + 4688) = value; }
     }
 
     /// <summary>
@@ -4829,8 +4707,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float EdgeVUpTolerancePercentage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4692); }
+        get { return *(float*)(Ptr + 4692); }
+        set { *(float*)(Ptr + 4692) = value; }
     }
 
     /// <summary>
@@ -4838,8 +4716,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float EdgeVDownTolerancePercentage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4696); }
+        get { return *(float*)(Ptr + 4696); }
+        set { *(float*)(Ptr + 4696) = value; }
     }
 
     /// <summary>
@@ -4847,8 +4725,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MinEdgeVDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4700); }
+        get { return *(float*)(Ptr + 4700); }
+        set { *(float*)(Ptr + 4700) = value; }
     }
 
     /// <summary>
@@ -4856,8 +4734,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float MaxAerialTargetingAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4704); }
+        get { return *(float*)(Ptr + 4704); }
+        set { *(float*)(Ptr + 4704) = value; }
     }
 
     /// <summary>
@@ -4865,8 +4743,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float VantageWallTraceSide
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4708); }
+        get { return *(float*)(Ptr + 4708); }
+        set { *(float*)(Ptr + 4708) = value; }
     }
 
     /// <summary>
@@ -4874,8 +4752,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float VantageWallTraceDown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4712); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4712); }
+        get { return *(float*)(Ptr + 4712); }
+        set { *(float*)(Ptr + 4712) = value; }
     }
 
     /// <summary>
@@ -4883,8 +4761,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float VantageWallTraceOut
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4716); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4716); }
+        get { return *(float*)(Ptr + 4716); }
+        set { *(float*)(Ptr + 4716) = value; }
     }
 
     /// <summary>
@@ -4892,8 +4770,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float VantageWallTraceIn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4720); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4720); }
+        get { return *(float*)(Ptr + 4720); }
+        set { *(float*)(Ptr + 4720) = value; }
     }
 
     /// <summary>
@@ -4901,8 +4779,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float VantagePathMinDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4724); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4724); }
+        get { return *(float*)(Ptr + 4724); }
+        set { *(float*)(Ptr + 4724) = value; }
     }
 
     /// <summary>
@@ -4931,8 +4809,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float LastCeilingCheckFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4756); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4756); }
+        get { return *(float*)(Ptr + 4756); }
+        set { *(float*)(Ptr + 4756) = value; }
     }
 
     /// <summary>
@@ -4946,8 +4824,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int NumPounceItersPerUpdate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4772); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4772); }
+        get { return *(int*)(Ptr + 4772); }
+        set { *(int*)(Ptr + 4772) = value; }
     }
 
     /// <summary>
@@ -4955,8 +4833,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MaxPounceSingleLineChecks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4776); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4776); }
+        get { return *(int*)(Ptr + 4776); }
+        set { *(int*)(Ptr + 4776) = value; }
     }
 
     /// <summary>
@@ -4964,8 +4842,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MaxPounceSingleLineChecksCoherency
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4780); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4780); }
+        get { return *(int*)(Ptr + 4780); }
+        set { *(int*)(Ptr + 4780) = value; }
     }
 
     /// <summary>
@@ -4973,8 +4851,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MaxPounceSingleLineChecksLowPrio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4784); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4784); }
+        get { return *(int*)(Ptr + 4784); }
+        set { *(int*)(Ptr + 4784) = value; }
     }
 
     /// <summary>
@@ -4982,8 +4860,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MaxFullPounceIters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4788); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4788); }
+        get { return *(int*)(Ptr + 4788); }
+        set { *(int*)(Ptr + 4788) = value; }
     }
 
     /// <summary>
@@ -4991,8 +4869,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int PounceSingleLineChecks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4792); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4792); }
+        get { return *(int*)(Ptr + 4792); }
+        set { *(int*)(Ptr + 4792) = value; }
     }
 
     /// <summary>
@@ -5000,8 +4878,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int PounceSingleLineChecksTotal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4796); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4796); }
+        get { return *(int*)(Ptr + 4796); }
+        set { *(int*)(Ptr + 4796) = value; }
     }
 
     /// <summary>
@@ -5009,8 +4887,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float LastPounceSingleLineCheck
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4800); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4800); }
+        get { return *(float*)(Ptr + 4800); }
+        set { *(float*)(Ptr + 4800) = value; }
     }
 
     /// <summary>
@@ -5018,8 +4896,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float SwingStartCheckTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4804); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4804); }
+        get { return *(float*)(Ptr + 4804); }
+        set { *(float*)(Ptr + 4804) = value; }
     }
 
     /// <summary>
@@ -5027,8 +4905,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int SwingStartCheckIterations
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4808); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4808); }
+        get { return *(int*)(Ptr + 4808); }
+        set { *(int*)(Ptr + 4808) = value; }
     }
 
     /// <summary>
@@ -5036,8 +4914,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MaxSwingPathChecks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4812); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4812); }
+        get { return *(int*)(Ptr + 4812); }
+        set { *(int*)(Ptr + 4812) = value; }
     }
 
     /// <summary>
@@ -5045,8 +4923,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MinSwingPathChecks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4816); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4816); }
+        get { return *(int*)(Ptr + 4816); }
+        set { *(int*)(Ptr + 4816) = value; }
     }
 
     /// <summary>
@@ -5054,8 +4932,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float SwingPathCheckUnits
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4820); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4820); }
+        get { return *(float*)(Ptr + 4820); }
+        set { *(float*)(Ptr + 4820) = value; }
     }
 
     /// <summary>
@@ -5063,8 +4941,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int SwingLineChecks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4824); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4824); }
+        get { return *(int*)(Ptr + 4824); }
+        set { *(int*)(Ptr + 4824) = value; }
     }
 
     /// <summary>
@@ -5072,8 +4950,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int SwingLineChecksTotal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4828); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4828); }
+        get { return *(int*)(Ptr + 4828); }
+        set { *(int*)(Ptr + 4828) = value; }
     }
 
     /// <summary>
@@ -5081,8 +4959,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float LastSwingLineCheck
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4832); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4832); }
+        get { return *(float*)(Ptr + 4832); }
+        set { *(float*)(Ptr + 4832) = value; }
     }
 
     /// <summary>
@@ -5090,8 +4968,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MaxSwingLineChecks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4836); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4836); }
+        get { return *(int*)(Ptr + 4836); }
+        set { *(int*)(Ptr + 4836) = value; }
     }
 
     /// <summary>
@@ -5099,8 +4977,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MaxSwingLineChecksCoherency
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4840); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4840); }
+        get { return *(int*)(Ptr + 4840); }
+        set { *(int*)(Ptr + 4840) = value; }
     }
 
     /// <summary>
@@ -5108,8 +4986,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe int MaxSwingLineChecksLowPrio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4844); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4844); }
+        get { return *(int*)(Ptr + 4844); }
+        set { *(int*)(Ptr + 4844) = value; }
     }
 
     /// <summary>
@@ -5165,8 +5043,8 @@ public partial class RCwGrappleGunBase : BmSDK.BmGame.RGrappleGun, BmSDK.IGameOb
     /// </summary>
     public unsafe float GASSPLastSwingStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4888); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4888); }
+        get { return *(float*)(Ptr + 4888); }
+        set { *(float*)(Ptr + 4888) = value; }
     }
 
     /// <summary>
@@ -94,8 +94,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bStunOnHit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1; else *(int*)(Ptr + 84) &= ~1; }
     }
 
     /// <summary>
@@ -103,8 +103,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bZapOnHit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2; else *(int*)(Ptr + 84) &= ~2; }
     }
 
     /// <summary>
@@ -112,8 +112,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceRagdoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 4; else *(int*)(Ptr + 84) &= ~4; }
     }
 
     /// <summary>
@@ -121,8 +121,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceNoRagdoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 8; else *(int*)(Ptr + 84) &= ~8; }
     }
 
     /// <summary>
@@ -130,8 +130,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCanBeBlockedByWeapon
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 16; else *(int*)(Ptr + 84) &= ~16; }
     }
 
     /// <summary>
@@ -139,8 +139,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCanBeBlockedByArmour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 32; else *(int*)(Ptr + 84) &= ~32; }
     }
 
     /// <summary>
@@ -148,8 +148,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bStumblesArmouredThugs
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 64; else *(int*)(Ptr + 84) &= ~64; }
     }
 
     /// <summary>
@@ -157,8 +157,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCanAlwaysBeBlockedByWeapon
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 128; else *(int*)(Ptr + 84) &= ~128; }
     }
 
     /// <summary>
@@ -166,8 +166,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCanBeRepelled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 256; else *(int*)(Ptr + 84) &= ~256; }
     }
 
     /// <summary>
@@ -175,8 +175,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCannotBeUsedIfBlocked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 512; else *(int*)(Ptr + 84) &= ~512; }
     }
 
     /// <summary>
@@ -184,8 +184,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bTriggerPlayerDealthReaction
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1024; else *(int*)(Ptr + 84) &= ~1024; }
     }
 
     /// <summary>
@@ -193,8 +193,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bStopPlayerRunning
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2048; else *(int*)(Ptr + 84) &= ~2048; }
     }
 
     /// <summary>
@@ -202,8 +202,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIgnoreHitReaction
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 4096; else *(int*)(Ptr + 84) &= ~4096; }
     }
 
     /// <summary>
@@ -211,8 +211,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCancelVelocityOnRagdoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 8192; else *(int*)(Ptr + 84) &= ~8192; }
     }
 
     /// <summary>
@@ -220,8 +220,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInvalidateFlawlessFreeflow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 16384; else *(int*)(Ptr + 84) &= ~16384; }
     }
 
     /// <summary>
@@ -229,8 +229,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAwardBasicTakedownOnKO
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 32768; else *(int*)(Ptr + 84) &= ~32768; }
     }
 
     /// <summary>
@@ -238,8 +238,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCanTargetIfTargettedByBatarang
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 65536; else *(int*)(Ptr + 84) &= ~65536; }
     }
 
     /// <summary>
@@ -247,8 +247,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCheckForMaxVelocityCap
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 131072; else *(int*)(Ptr + 84) &= ~131072; }
     }
 
     /// <summary>
@@ -256,8 +256,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSilentDamage
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 262144; else *(int*)(Ptr + 84) &= ~262144; }
     }
 
     /// <summary>
@@ -265,8 +265,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRequiresPairedAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 524288; else *(int*)(Ptr + 84) &= ~524288; }
     }
 
     /// <summary>
@@ -274,8 +274,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisableDetectiveMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1048576; else *(int*)(Ptr + 84) &= ~1048576; }
     }
 
     /// <summary>
@@ -283,8 +283,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCanUseCloseTargetCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2097152; else *(int*)(Ptr + 84) &= ~2097152; }
     }
 
     /// <summary>
@@ -292,8 +292,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceFinalBlowCamIfLastCombatant
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 4194304; else *(int*)(Ptr + 84) &= ~4194304; }
     }
 
     /// <summary>
@@ -301,8 +301,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bKnifeBladeComboAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 8388608; else *(int*)(Ptr + 84) &= ~8388608; }
     }
 
     /// <summary>
@@ -310,8 +310,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bNinjaBladeComboAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 16777216; else *(int*)(Ptr + 84) &= ~16777216; }
     }
 
     /// <summary>
@@ -319,8 +319,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDamageMakesAwareOfPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 33554432; else *(int*)(Ptr + 84) &= ~33554432; }
     }
 
     /// <summary>
@@ -328,8 +328,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCantIgnoreHitReaction
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 67108864; else *(int*)(Ptr + 84) &= ~67108864; }
     }
 
     /// <summary>
@@ -337,8 +337,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bApplyRagdollImpulseToAllBones
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 134217728; else *(int*)(Ptr + 84) &= ~134217728; }
     }
 
     /// <summary>
@@ -346,8 +346,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe int ForceDamageEffectsAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(int*)(Ptr + 88); }
+        set { *(int*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -355,8 +355,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe int DamageToShield
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(int*)(Ptr + 92); }
+        set { *(int*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -364,8 +364,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe float BatmanDamageScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -373,8 +373,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxStrikeDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -382,8 +382,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxVenomStrikeDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -391,8 +391,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverridePlayerHitDelayTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(float*)(Ptr + 108); }
+        set { *(float*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -400,8 +400,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.EGameAction KOGameAction
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EGameAction>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 112); }
+        set { *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -409,8 +409,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.EComboMoveType MoveType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EComboMoveType>(Ptr + 113); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 113); }
+        get { return *(BmSDK.BmGame.RGameInfo.EComboMoveType*)(Ptr + 113); }
+        set { *(BmSDK.BmGame.RGameInfo.EComboMoveType*)(Ptr + 113) = value; }
     }
 
     /// <summary>
@@ -418,8 +418,8 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RDamageType.EBatmanArmourType ArmourType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDamageType.EBatmanArmourType>(Ptr + 114); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 114); }
+        get { return *(BmSDK.BmGame.RDamageType.EBatmanArmourType*)(Ptr + 114); }
+        set { *(BmSDK.BmGame.RDamageType.EBatmanArmourType*)(Ptr + 114) = value; }
     }
 
     /// <summary>
@@ -427,7 +427,7 @@ public partial class RDamageType : BmSDK.Engine.DamageType, BmSDK.IGameObject
     /// </summary>
     public unsafe int Priority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(int*)(Ptr + 116); }
+        set { *(int*)(Ptr + 116) = value; }
     }
 }
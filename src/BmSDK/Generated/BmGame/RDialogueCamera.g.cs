@@ -78,52 +78,87 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
         where TComponent : class, Framework.IScriptComponent<RDialogueCamera>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetNewCloseCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetNewCloseCamValues_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetNewCloseCamValues
     /// </summary>
     public unsafe virtual void SetNewCloseCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetNewCloseCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNewCloseCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetNewCloseCamValues", true);
+        var parms = new SetNewCloseCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetNewCloseBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct GetNewCloseBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetNewCloseBMCamValues
     /// </summary>
     public unsafe virtual void GetNewCloseBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetNewCloseBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetNewCloseBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetNewCloseBMCamValues", true);
+        var parms = new GetNewCloseBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetNewCloseCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct GetNewCloseCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetNewCloseCamValues
     /// </summary>
     public unsafe virtual void GetNewCloseCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetNewCloseCamValues", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetNewCloseCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetNewCloseCamValues", true);
+        var parms = new GetNewCloseCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseNewCloseCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct CanUseNewCloseCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseNewCloseCam
     /// </summary>
     public unsafe virtual bool CanUseNewCloseCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseNewCloseCam", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseNewCloseCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseNewCloseCam", true);
+        var parms = new CanUseNewCloseCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetMaxGuardCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetMaxGuardCamValues_Params
+    {
     }
 
     /// <summary>
@@ -131,84 +166,135 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetMaxGuardCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetMaxGuardCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMaxGuardCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetMaxGuardCamValues", true);
+        var parms = new SetMaxGuardCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetMaxGuardCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetMaxGuardCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetMaxGuardCamValues
     /// </summary>
     public unsafe virtual void GetMaxGuardCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetMaxGuardCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetMaxGuardCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetMaxGuardCamValues", true);
+        var parms = new GetMaxGuardCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetMaxGuardBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetMaxGuardBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetMaxGuardBMCamValues
     /// </summary>
     public unsafe virtual void GetMaxGuardBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetMaxGuardBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetMaxGuardBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetMaxGuardBMCamValues", true);
+        var parms = new GetMaxGuardBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_SetChairViewNoFovLeftDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetChairViewNoFovLeftDualCamValues_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetChairViewNoFovLeftDualCamValues
     /// </summary>
     public unsafe virtual void SetChairViewNoFovLeftDualCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetChairViewNoFovLeftDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetChairViewNoFovLeftDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetChairViewNoFovLeftDualCamValues", true);
+        var parms = new SetChairViewNoFovLeftDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetChairViewNoFovLeftDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetChairViewNoFovLeftDualCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetChairViewNoFovLeftDualCamValues
     /// </summary>
     public unsafe virtual void GetChairViewNoFovLeftDualCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewNoFovLeftDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetChairViewNoFovLeftDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewNoFovLeftDualCamValues", true);
+        var parms = new GetChairViewNoFovLeftDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetChairViewNoFovLeftDualBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetChairViewNoFovLeftDualBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetChairViewNoFovLeftDualBMCamValues
     /// </summary>
     public unsafe virtual void GetChairViewNoFovLeftDualBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewNoFovLeftDualBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetChairViewNoFovLeftDualBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewNoFovLeftDualBMCamValues", true);
+        var parms = new GetChairViewNoFovLeftDualBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseChairViewNoFovLeftDualCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CanUseChairViewNoFovLeftDualCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseChairViewNoFovLeftDualCam
     /// </summary>
     public unsafe virtual bool CanUseChairViewNoFovLeftDualCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseChairViewNoFovLeftDualCam", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseChairViewNoFovLeftDualCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseChairViewNoFovLeftDualCam", true);
+        var parms = new CanUseChairViewNoFovLeftDualCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetChairViewNoFovRightDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetChairViewNoFovRightDualCamValues_Params
+    {
     }
 
     /// <summary>
@@ -216,47 +302,76 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetChairViewNoFovRightDualCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetChairViewNoFovRightDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetChairViewNoFovRightDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetChairViewNoFovRightDualCamValues", true);
+        var parms = new SetChairViewNoFovRightDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetChairViewNoFovRightDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetChairViewNoFovRightDualCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetChairViewNoFovRightDualCamValues
     /// </summary>
     public unsafe virtual void GetChairViewNoFovRightDualCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewNoFovRightDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetChairViewNoFovRightDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewNoFovRightDualCamValues", true);
+        var parms = new GetChairViewNoFovRightDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetChairViewNoFovRightDualBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetChairViewNoFovRightDualBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetChairViewNoFovRightDualBMCamValues
     /// </summary>
     public unsafe virtual void GetChairViewNoFovRightDualBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewNoFovRightDualBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetChairViewNoFovRightDualBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewNoFovRightDualBMCamValues", true);
+        var parms = new GetChairViewNoFovRightDualBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseChairViewNoFovRightDualCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CanUseChairViewNoFovRightDualCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseChairViewNoFovRightDualCam
     /// </summary>
     public unsafe virtual bool CanUseChairViewNoFovRightDualCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseChairViewNoFovRightDualCam", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseChairViewNoFovRightDualCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseChairViewNoFovRightDualCam", true);
+        var parms = new CanUseChairViewNoFovRightDualCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetChairViewLeftDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetChairViewLeftDualCamValues_Params
+    {
     }
 
     /// <summary>
@@ -264,47 +379,76 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetChairViewLeftDualCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetChairViewLeftDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetChairViewLeftDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetChairViewLeftDualCamValues", true);
+        var parms = new SetChairViewLeftDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetChairViewLeftDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetChairViewLeftDualCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetChairViewLeftDualCamValues
     /// </summary>
     public unsafe virtual void GetChairViewLeftDualCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewLeftDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetChairViewLeftDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewLeftDualCamValues", true);
+        var parms = new GetChairViewLeftDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetChairViewLeftDualBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetChairViewLeftDualBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetChairViewLeftDualBMCamValues
     /// </summary>
     public unsafe virtual void GetChairViewLeftDualBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewLeftDualBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetChairViewLeftDualBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewLeftDualBMCamValues", true);
+        var parms = new GetChairViewLeftDualBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseChairViewLeftDualCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CanUseChairViewLeftDualCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseChairViewLeftDualCam
     /// </summary>
     public unsafe virtual bool CanUseChairViewLeftDualCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseChairViewLeftDualCam", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseChairViewLeftDualCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseChairViewLeftDualCam", true);
+        var parms = new CanUseChairViewLeftDualCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetChairViewRightDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetChairViewRightDualCamValues_Params
+    {
     }
 
     /// <summary>
@@ -312,47 +456,76 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetChairViewRightDualCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetChairViewRightDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetChairViewRightDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetChairViewRightDualCamValues", true);
+        var parms = new SetChairViewRightDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetChairViewRightDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetChairViewRightDualCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetChairViewRightDualCamValues
     /// </summary>
     public unsafe virtual void GetChairViewRightDualCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewRightDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetChairViewRightDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewRightDualCamValues", true);
+        var parms = new GetChairViewRightDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetChairViewRightDualBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetChairViewRightDualBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetChairViewRightDualBMCamValues
     /// </summary>
     public unsafe virtual void GetChairViewRightDualBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewRightDualBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetChairViewRightDualBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetChairViewRightDualBMCamValues", true);
+        var parms = new GetChairViewRightDualBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseChairViewRightDualCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CanUseChairViewRightDualCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseChairViewRightDualCam
     /// </summary>
     public unsafe virtual bool CanUseChairViewRightDualCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseChairViewRightDualCam", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseChairViewRightDualCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseChairViewRightDualCam", true);
+        var parms = new CanUseChairViewRightDualCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetCloseLeftDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetCloseLeftDualCamValues_Params
+    {
     }
 
     /// <summary>
@@ -360,47 +533,76 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetCloseLeftDualCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCloseLeftDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCloseLeftDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCloseLeftDualCamValues", true);
+        var parms = new SetCloseLeftDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCloseLeftDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetCloseLeftDualCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetCloseLeftDualCamValues
     /// </summary>
     public unsafe virtual void GetCloseLeftDualCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseLeftDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetCloseLeftDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseLeftDualCamValues", true);
+        var parms = new GetCloseLeftDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetCloseLeftDualBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetCloseLeftDualBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetCloseLeftDualBMCamValues
     /// </summary>
     public unsafe virtual void GetCloseLeftDualBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseLeftDualBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetCloseLeftDualBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseLeftDualBMCamValues", true);
+        var parms = new GetCloseLeftDualBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseCloseLeftDualCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CanUseCloseLeftDualCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseCloseLeftDualCam
     /// </summary>
     public unsafe virtual bool CanUseCloseLeftDualCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseCloseLeftDualCam", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseCloseLeftDualCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseCloseLeftDualCam", true);
+        var parms = new CanUseCloseLeftDualCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetCloseRightDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetCloseRightDualCamValues_Params
+    {
     }
 
     /// <summary>
@@ -408,47 +610,76 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetCloseRightDualCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCloseRightDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCloseRightDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCloseRightDualCamValues", true);
+        var parms = new SetCloseRightDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCloseRightDualBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetCloseRightDualBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetCloseRightDualBMCamValues
     /// </summary>
     public unsafe virtual void GetCloseRightDualBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseRightDualBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetCloseRightDualBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseRightDualBMCamValues", true);
+        var parms = new GetCloseRightDualBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetCloseRightDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetCloseRightDualCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetCloseRightDualCamValues
     /// </summary>
     public unsafe virtual void GetCloseRightDualCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseRightDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetCloseRightDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseRightDualCamValues", true);
+        var parms = new GetCloseRightDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseCloseRightDualCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CanUseCloseRightDualCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseCloseRightDualCam
     /// </summary>
     public unsafe virtual bool CanUseCloseRightDualCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseCloseRightDualCam", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseCloseRightDualCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseCloseRightDualCam", true);
+        var parms = new CanUseCloseRightDualCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetRightSideDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetRightSideDualCamValues_Params
+    {
     }
 
     /// <summary>
@@ -456,47 +687,76 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetRightSideDualCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetRightSideDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRightSideDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetRightSideDualCamValues", true);
+        var parms = new SetRightSideDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRightSideDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetRightSideDualCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetRightSideDualCamValues
     /// </summary>
     public unsafe virtual void GetRightSideDualCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetRightSideDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetRightSideDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetRightSideDualCamValues", true);
+        var parms = new GetRightSideDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetRightSideDualBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetRightSideDualBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetRightSideDualBMCamValues
     /// </summary>
     public unsafe virtual void GetRightSideDualBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetRightSideDualBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetRightSideDualBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetRightSideDualBMCamValues", true);
+        var parms = new GetRightSideDualBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseRightSideDualCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CanUseRightSideDualCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseRightSideDualCam
     /// </summary>
     public unsafe virtual bool CanUseRightSideDualCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseRightSideDualCam", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseRightSideDualCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseRightSideDualCam", true);
+        var parms = new CanUseRightSideDualCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetLeftSideDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetLeftSideDualCamValues_Params
+    {
     }
 
     /// <summary>
@@ -504,47 +764,76 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetLeftSideDualCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetLeftSideDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLeftSideDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetLeftSideDualCamValues", true);
+        var parms = new SetLeftSideDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetLeftSideDualBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetLeftSideDualBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetLeftSideDualBMCamValues
     /// </summary>
     public unsafe virtual void GetLeftSideDualBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetLeftSideDualBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetLeftSideDualBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetLeftSideDualBMCamValues", true);
+        var parms = new GetLeftSideDualBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetLeftSideDualCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetLeftSideDualCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetLeftSideDualCamValues
     /// </summary>
     public unsafe virtual void GetLeftSideDualCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetLeftSideDualCamValues", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetLeftSideDualCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetLeftSideDualCamValues", true);
+        var parms = new GetLeftSideDualCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_CanUseLeftSideDualCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CanUseLeftSideDualCam_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUseLeftSideDualCam
     /// </summary>
     public unsafe virtual bool CanUseLeftSideDualCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseLeftSideDualCam", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseLeftSideDualCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CanUseLeftSideDualCam", true);
+        var parms = new CanUseLeftSideDualCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetSideRightCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetSideRightCamValues_Params
+    {
     }
 
     /// <summary>
@@ -552,295 +841,475 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void SetSideRightCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetSideRightCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideRightCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetSideRightCamValues", true);
+        var parms = new SetSideRightCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSideRightCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct GetSideRightCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetSideRightCamValues
     /// </summary>
     public unsafe virtual void GetSideRightCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetSideRightCamValues", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetSideRightCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetSideRightCamValues", true);
+        var parms = new GetSideRightCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetSideRightBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct GetSideRightBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetSideRightBMCamValues
     /// </summary>
     public unsafe virtual void GetSideRightBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetSideRightBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetSideRightBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetSideRightBMCamValues", true);
+        var parms = new GetSideRightBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_SetSideLeftCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetSideLeftCamValues_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetSideLeftCamValues
     /// </summary>
     public unsafe virtual void SetSideLeftCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetSideLeftCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideLeftCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetSideLeftCamValues", true);
+        var parms = new SetSideLeftCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSideLeftBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct GetSideLeftBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetSideLeftBMCamValues
     /// </summary>
     public unsafe virtual void GetSideLeftBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetSideLeftBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetSideLeftBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetSideLeftBMCamValues", true);
+        var parms = new GetSideLeftBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetSideLeftCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct GetSideLeftCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetSideLeftCamValues
     /// </summary>
     public unsafe virtual void GetSideLeftCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetSideLeftCamValues", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetSideLeftCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetSideLeftCamValues", true);
+        var parms = new GetSideLeftCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_SetCloseLeftCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetCloseLeftCamValues_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetCloseLeftCamValues
     /// </summary>
     public unsafe virtual void SetCloseLeftCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCloseLeftCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCloseLeftCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCloseLeftCamValues", true);
+        var parms = new SetCloseLeftCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCloseLeftCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetCloseLeftCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetCloseLeftCamValues
     /// </summary>
     public unsafe virtual void GetCloseLeftCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseLeftCamValues", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetCloseLeftCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseLeftCamValues", true);
+        var parms = new GetCloseLeftCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetCloseLeftBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetCloseLeftBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetCloseLeftBMCamValues
     /// </summary>
     public unsafe virtual void GetCloseLeftBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseLeftBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetCloseLeftBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseLeftBMCamValues", true);
+        var parms = new GetCloseLeftBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_SetCloseRightCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetCloseRightCamValues_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetCloseRightCamValues
     /// </summary>
     public unsafe virtual void SetCloseRightCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCloseRightCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCloseRightCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCloseRightCamValues", true);
+        var parms = new SetCloseRightCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCloseRightBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetCloseRightBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetCloseRightBMCamValues
     /// </summary>
     public unsafe virtual void GetCloseRightBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseRightBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetCloseRightBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseRightBMCamValues", true);
+        var parms = new GetCloseRightBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetCloseRightCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetCloseRightCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetCloseRightCamValues
     /// </summary>
     public unsafe virtual void GetCloseRightCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseRightCamValues", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetCloseRightCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetCloseRightCamValues", true);
+        var parms = new GetCloseRightCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_SetRightSideCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetRightSideCamValues_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetRightSideCamValues
     /// </summary>
     public unsafe virtual void SetRightSideCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetRightSideCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRightSideCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetRightSideCamValues", true);
+        var parms = new SetRightSideCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRightSideCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetRightSideCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetRightSideCamValues
     /// </summary>
     public unsafe virtual void GetRightSideCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetRightSideCamValues", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetRightSideCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetRightSideCamValues", true);
+        var parms = new GetRightSideCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetRightSideBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetRightSideBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetRightSideBMCamValues
     /// </summary>
     public unsafe virtual void GetRightSideBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetRightSideBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetRightSideBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetRightSideBMCamValues", true);
+        var parms = new GetRightSideBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_SetLeftSideCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetLeftSideCamValues_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetLeftSideCamValues
     /// </summary>
     public unsafe virtual void SetLeftSideCamValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetLeftSideCamValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLeftSideCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetLeftSideCamValues", true);
+        var parms = new SetLeftSideCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetLeftSideBMCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetLeftSideBMCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetLeftSideBMCamValues
     /// </summary>
     public unsafe virtual void GetLeftSideBMCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetLeftSideBMCamValues", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetLeftSideBMCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetLeftSideBMCamValues", true);
+        var parms = new GetLeftSideBMCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_GetLeftSideCamValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetLeftSideCamValues_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Loc;
+        [FieldOffset(12)] public System.Numerics.Vector3 Rot;
+    }
+
     /// <summary>
     /// Function: GetLeftSideCamValues
     /// </summary>
     public unsafe virtual void GetLeftSideCamValues(out System.Numerics.Vector3 Loc, out System.Numerics.Vector3 Rot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetLeftSideCamValues", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Loc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        Rot = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetLeftSideCamValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.GetLeftSideCamValues", true);
+        var parms = new GetLeftSideCamValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Loc = parms.Loc;
+        Rot = parms.Rot;
         return;
     }
 
+    static BmSDK.Function s_LookAroundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct LookAround_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.Rotator LookInput;
+    }
+
     /// <summary>
     /// Function: LookAround
     /// </summary>
     public unsafe virtual void LookAround(float DeltaTime, BmSDK.Rotator LookInput)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.LookAround", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LookInput, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LookAroundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.LookAround", true);
+        var parms = new LookAround_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.LookInput = LookInput;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.Tick", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 72)]
+    private struct SetCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetCamera
     /// </summary>
     public unsafe virtual void SetCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCamera", true);
-        byte* paramsPtr = stackalloc byte[72];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCamera", true);
+        var parms = new SetCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCameraValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetCameraValues_Params
+    {
+        [FieldOffset(0)] public int AllowedCams;
+        [FieldOffset(4)] public int bNotAllowedToTouchUp;
+    }
+
     /// <summary>
     /// Function: SetCameraValues
     /// </summary>
     public unsafe virtual void SetCameraValues(int AllowedCams, bool bNotAllowedToTouchUp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCameraValues", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AllowedCams, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNotAllowedToTouchUp, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCameraValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.SetCameraValues", true);
+        var parms = new SetCameraValues_Params();
+        parms.AllowedCams = AllowedCams;
+        parms.bNotAllowedToTouchUp = bNotAllowedToTouchUp ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PickDialogueCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PickDialogueCamera_Params
+    {
+        [FieldOffset(0)] public int IsBatmanTalking;
+        [FieldOffset(4)] public int OnlyShowtalker;
+        [FieldOffset(8)] public int bNotAllowedToTouchUp;
+    }
+
     /// <summary>
     /// Function: PickDialogueCamera
     /// </summary>
     public unsafe virtual void PickDialogueCamera(bool IsBatmanTalking, bool OnlyShowtalker, bool bNotAllowedToTouchUp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.PickDialogueCamera", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IsBatmanTalking, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OnlyShowtalker, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNotAllowedToTouchUp, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PickDialogueCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.PickDialogueCamera", true);
+        var parms = new PickDialogueCamera_Params();
+        parms.IsBatmanTalking = IsBatmanTalking ? 1 : 0;
+        parms.OnlyShowtalker = OnlyShowtalker ? 1 : 0;
+        parms.bNotAllowedToTouchUp = bNotAllowedToTouchUp ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsNotShowcaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsNotShowcase_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsNotShowcase
     /// </summary>
     public unsafe virtual bool IsNotShowcase()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.IsNotShowcase", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsNotShowcaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.IsNotShowcase", true);
+        var parms = new IsNotShowcase_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TestMovementFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct TestMovement_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 NewLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 lookDest;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -848,12 +1317,20 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual bool TestMovement(System.Numerics.Vector3 NewLoc, System.Numerics.Vector3 lookDest)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.TestMovement", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(lookDest, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_TestMovementFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.TestMovement", true);
+        var parms = new TestMovement_Params();
+        parms.NewLoc = NewLoc;
+        parms.lookDest = lookDest;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CameraAnimationTriggerCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct CameraAnimationTriggerCallback_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName TagName;
+        [FieldOffset(20)] public float Time;
     }
 
     /// <summary>
@@ -861,62 +1338,92 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void CameraAnimationTriggerCallback(BmSDK.FName TagName, BmSDK.TArray<BmSDK.FString> Params, float Time)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CameraAnimationTriggerCallback", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TagName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Params, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Time, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CameraAnimationTriggerCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.CameraAnimationTriggerCallback", true);
+        var parms = new CameraAnimationTriggerCallback_Params();
+        parms.TagName = TagName;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Params, (byte*)&parms + 8);
+        parms.Time = Time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Stop_Params
+    {
+        [FieldOffset(0)] public float timeToBlend;
+    }
+
     /// <summary>
     /// Function: Stop
     /// </summary>
     public unsafe virtual void Stop(float timeToBlend)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.Stop", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(timeToBlend, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.Stop", true);
+        var parms = new Stop_Params();
+        parms.timeToBlend = timeToBlend;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Initialise_Params
+    {
+        [FieldOffset(0)] public nint Target;
+    }
+
     /// <summary>
     /// Function: Initialise
     /// </summary>
     public unsafe virtual void Initialise(BmSDK.BmGame.RPawn Target)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.Initialise", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.Initialise", true);
+        var parms = new Initialise_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayDebugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DisplayDebug_Params
+    {
+        [FieldOffset(0)] public nint HUD;
+        [FieldOffset(4)] public float out_YL;
+        [FieldOffset(8)] public float out_YPos;
+    }
+
     /// <summary>
     /// Function: DisplayDebug
     /// </summary>
     public unsafe override void DisplayDebug(BmSDK.Engine.HUD HUD, out float out_YL, out float out_YPos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.DisplayDebug", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HUD, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        out_YL = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
-        out_YPos = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_DisplayDebugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.DisplayDebug", true);
+        var parms = new DisplayDebug_Params();
+        parms.HUD = HUD?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        out_YL = parms.out_YL;
+        out_YPos = parms.out_YPos;
         return;
     }
 
+    static BmSDK.Function s_ForensicsDofFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForensicsDof_Params
+    {
+        [FieldOffset(0)] public int On;
+    }
+
     /// <summary>
     /// Function: ForensicsDof
     /// </summary>
     public unsafe virtual void ForensicsDof(bool On)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.ForensicsDof", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(On, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForensicsDofFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueCamera.ForensicsDof", true);
+        var parms = new ForensicsDof_Params();
+        parms.On = On ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -943,8 +1450,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe float MinDistanceToTarget
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 872); }
+        get { return *(float*)(Ptr + 872); }
+        set { *(float*)(Ptr + 872) = value; }
     }
 
     /// <summary>
@@ -967,8 +1474,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.FName BoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 892); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 892); }
+        get { return *(BmSDK.FName*)(Ptr + 892); }
+        set { *(BmSDK.FName*)(Ptr + 892) = value; }
     }
 
     /// <summary>
@@ -988,8 +1495,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe float CameraFov
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 924); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 924); }
+        get { return *(float*)(Ptr + 924); }
+        set { *(float*)(Ptr + 924) = value; }
     }
 
     /// <summary>
@@ -1009,8 +1516,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe float LookModeScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 952); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 952); }
+        get { return *(float*)(Ptr + 952); }
+        set { *(float*)(Ptr + 952) = value; }
     }
 
     /// <summary>
@@ -1018,8 +1525,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe float LookSpringBack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 956); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 956); }
+        get { return *(float*)(Ptr + 956); }
+        set { *(float*)(Ptr + 956) = value; }
     }
 
     /// <summary>
@@ -1039,8 +1546,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe int PickedCamera
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1088); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1088); }
+        get { return *(int*)(Ptr + 1088); }
+        set { *(int*)(Ptr + 1088) = value; }
     }
 
     /// <summary>
@@ -1048,8 +1555,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bIsBatmanTalking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1092); }
+        get { return (*(int*)(Ptr + 1092) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1092) |= 1; else *(int*)(Ptr + 1092) &= ~1; }
     }
 
     /// <summary>
@@ -1057,8 +1564,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bOnlyShowTalker
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1092); }
+        get { return (*(int*)(Ptr + 1092) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1092) |= 2; else *(int*)(Ptr + 1092) &= ~2; }
     }
 
     /// <summary>
@@ -1066,8 +1573,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bPickedLeftSide
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1092); }
+        get { return (*(int*)(Ptr + 1092) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 1092) |= 4; else *(int*)(Ptr + 1092) &= ~4; }
     }
 
     /// <summary>
@@ -1075,8 +1582,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bPickedClose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1092); }
+        get { return (*(int*)(Ptr + 1092) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 1092) |= 8; else *(int*)(Ptr + 1092) &= ~8; }
     }
 
     /// <summary>
@@ -1084,8 +1591,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bHasPickedDistance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1092); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1092); }
+        get { return (*(int*)(Ptr + 1092) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 1092) |= 16; else *(int*)(Ptr + 1092) &= ~16; }
     }
 
     /// <summary>
@@ -1093,8 +1600,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe float OldBatmanZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1096); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1096); }
+        get { return *(float*)(Ptr + 1096); }
+        set { *(float*)(Ptr + 1096) = value; }
     }
 
     /// <summary>
@@ -1102,8 +1609,8 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe float LightTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1100); }
+        get { return *(float*)(Ptr + 1100); }
+        set { *(float*)(Ptr + 1100) = value; }
     }
 
     /// <summary>
@@ -1111,7 +1618,7 @@ public partial class RDialogueCamera : BmSDK.BmGame.RCameraActor, BmSDK.IGameObj
     /// </summary>
     public unsafe float LightMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1104); }
+        get { return *(float*)(Ptr + 1104); }
+        set { *(float*)(Ptr + 1104) = value; }
     }
 }
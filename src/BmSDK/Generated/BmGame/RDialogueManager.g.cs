@@ -78,364 +78,518 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RDialogueManager>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UnregisterPackageLoadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UnregisterPackageLoad_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString LoadingPackage;
+        [FieldOffset(12)] public int FromRandom;
+    }
+
     /// <summary>
     /// Function: UnregisterPackageLoad
     /// </summary>
     public unsafe virtual void UnregisterPackageLoad(BmSDK.FString LoadingPackage, bool FromRandom = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterPackageLoad", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LoadingPackage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FromRandom, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UnregisterPackageLoadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterPackageLoad", true);
+        var parms = new UnregisterPackageLoad_Params();
+        parms.LoadingPackage = LoadingPackage;
+        parms.FromRandom = FromRandom ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterPackageLoadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct RegisterPackageLoad_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString LoadingPackage;
+        [FieldOffset(12)] public int FromRandom;
+    }
+
     /// <summary>
     /// Function: RegisterPackageLoad
     /// </summary>
     public unsafe virtual void RegisterPackageLoad(BmSDK.FString LoadingPackage, bool FromRandom = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterPackageLoad", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LoadingPackage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FromRandom, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RegisterPackageLoadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterPackageLoad", true);
+        var parms = new RegisterPackageLoad_Params();
+        parms.LoadingPackage = LoadingPackage;
+        parms.FromRandom = FromRandom ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GFXClearSubtitleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GFXClearSubtitle_Params
+    {
+    }
+
     /// <summary>
     /// Function: GFXClearSubtitle
     /// </summary>
     public unsafe virtual void GFXClearSubtitle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.GFXClearSubtitle", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_GFXClearSubtitleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.GFXClearSubtitle", true);
+        var parms = new GFXClearSubtitle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GFXSetSubtitleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GFXSetSubtitle_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString sub;
+    }
+
     /// <summary>
     /// Function: GFXSetSubtitle
     /// </summary>
     public unsafe virtual void GFXSetSubtitle(BmSDK.FString sub)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.GFXSetSubtitle", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(sub, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_GFXSetSubtitleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.GFXSetSubtitle", true);
+        var parms = new GFXSetSubtitle_Params();
+        parms.sub = sub;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TapeLoadedRefFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TapeLoadedRef_Params
+    {
+        [FieldOffset(0)] public nint Tape;
+    }
+
     /// <summary>
     /// Function: TapeLoadedRef
     /// </summary>
     public unsafe virtual void TapeLoadedRef(BmSDK.BmGame.RFullTape Tape)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.TapeLoadedRef", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Tape, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TapeLoadedRefFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.TapeLoadedRef", true);
+        var parms = new TapeLoadedRef_Params();
+        parms.Tape = Tape?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SurveillanceStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SurveillanceState_Params
+    {
+        [FieldOffset(0)] public int SetState;
+    }
+
     /// <summary>
     /// Function: SurveillanceState
     /// </summary>
     public unsafe virtual void SurveillanceState(bool SetState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.SurveillanceState", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SetState, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SurveillanceStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.SurveillanceState", true);
+        var parms = new SurveillanceState_Params();
+        parms.SetState = SetState ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlaySpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct PlaySpeech_Params
+    {
+        [FieldOffset(0)] public nint SpeechActor;
+        [FieldOffset(4)] public nint DialogueLine;
+        [FieldOffset(8)] public BmSDK.BmGame.RGameInfo.VocalPriority Priority;
+        [FieldOffset(12)] public nint PlaySpeechAction;
+        [FieldOffset(16)] public int bPlayEarcon;
+    }
+
     /// <summary>
     /// Function: PlaySpeech
     /// </summary>
     public unsafe virtual void PlaySpeech(BmSDK.Engine.Actor SpeechActor, BmSDK.Engine.RDialogueLine DialogueLine, BmSDK.BmGame.RGameInfo.VocalPriority Priority = default, BmSDK.Engine.SequenceAction PlaySpeechAction = default, bool bPlayEarcon = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PlaySpeech", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueLine, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Priority, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlaySpeechAction, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayEarcon, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PlaySpeech", true);
+        var parms = new PlaySpeech_Params();
+        parms.SpeechActor = SpeechActor?.Ptr ?? 0;
+        parms.DialogueLine = DialogueLine?.Ptr ?? 0;
+        parms.Priority = Priority;
+        parms.PlaySpeechAction = PlaySpeechAction?.Ptr ?? 0;
+        parms.bPlayEarcon = bPlayEarcon ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ActivateDialogue_Params
+    {
+        [FieldOffset(0)] public nint Speech;
+    }
+
     /// <summary>
     /// Function: ActivateDialogue
     /// </summary>
     public unsafe virtual void ActivateDialogue(BmSDK.BmGame.RSeqAct_PlaySpeechBase Speech)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ActivateDialogue", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speech, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ActivateDialogue", true);
+        var parms = new ActivateDialogue_Params();
+        parms.Speech = Speech?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnregisterSingleLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnregisterSingleLine_Params
+    {
+        [FieldOffset(0)] public nint Line;
+    }
+
     /// <summary>
     /// Function: UnregisterSingleLine
     /// </summary>
     public unsafe virtual void UnregisterSingleLine(BmSDK.Engine.RDialogueLine Line)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterSingleLine", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Line, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterSingleLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterSingleLine", true);
+        var parms = new UnregisterSingleLine_Params();
+        parms.Line = Line?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterSingleLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RegisterSingleLine_Params
+    {
+        [FieldOffset(0)] public nint Line;
+        [FieldOffset(4)] public BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType;
+        [FieldOffset(8)] public int ManagedBanks;
+        [FieldOffset(12)] public BmSDK.FString RadioStation;
+    }
+
     /// <summary>
     /// Function: RegisterSingleLine
     /// </summary>
     public unsafe virtual void RegisterSingleLine(BmSDK.Engine.RDialogueLine Line, BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType, bool ManagedBanks = default, BmSDK.FString RadioStation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterSingleLine", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Line, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueType, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ManagedBanks, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RadioStation, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterSingleLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterSingleLine", true);
+        var parms = new RegisterSingleLine_Params();
+        parms.Line = Line?.Ptr ?? 0;
+        parms.DialogueType = DialogueType;
+        parms.ManagedBanks = ManagedBanks ? 1 : 0;
+        parms.RadioStation = RadioStation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnregisterConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnregisterConversation_Params
+    {
+        [FieldOffset(0)] public nint Conv;
+    }
+
     /// <summary>
     /// Function: UnregisterConversation
     /// </summary>
     public unsafe virtual void UnregisterConversation(BmSDK.BmGame.RScriptConversation Conv)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterConversation", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conv, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterConversation", true);
+        var parms = new UnregisterConversation_Params();
+        parms.Conv = Conv?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RegisterConversation_Params
+    {
+        [FieldOffset(0)] public nint Conv;
+        [FieldOffset(4)] public BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType;
+        [FieldOffset(8)] public int ManagedBanks;
+        [FieldOffset(12)] public BmSDK.FString RadioStation;
+    }
+
     /// <summary>
     /// Function: RegisterConversation
     /// </summary>
     public unsafe virtual void RegisterConversation(BmSDK.BmGame.RScriptConversation Conv, BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType, bool ManagedBanks = default, BmSDK.FString RadioStation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterConversation", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conv, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueType, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ManagedBanks, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RadioStation, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterConversation", true);
+        var parms = new RegisterConversation_Params();
+        parms.Conv = Conv?.Ptr ?? 0;
+        parms.DialogueType = DialogueType;
+        parms.ManagedBanks = ManagedBanks ? 1 : 0;
+        parms.RadioStation = RadioStation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnregisterSpeakerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnregisterSpeaker_Params
+    {
+        [FieldOffset(0)] public nint Actor;
+        [FieldOffset(4)] public int checkDelete;
+    }
+
     /// <summary>
     /// Function: UnregisterSpeaker
     /// </summary>
     public unsafe virtual void UnregisterSpeaker(BmSDK.Engine.Actor Actor, bool checkDelete)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterSpeaker", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Actor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(checkDelete, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterSpeakerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterSpeaker", true);
+        var parms = new UnregisterSpeaker_Params();
+        parms.Actor = Actor?.Ptr ?? 0;
+        parms.checkDelete = checkDelete ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterSpeakerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct RegisterSpeaker_Params
+    {
+        [FieldOffset(0)] public nint Actor;
+        [FieldOffset(4)] public BmSDK.Engine.AkWwise.EDialogueHelperType SpeakerType;
+    }
+
     /// <summary>
     /// Function: RegisterSpeaker
     /// </summary>
     public unsafe virtual void RegisterSpeaker(BmSDK.Engine.Actor Actor, BmSDK.Engine.AkWwise.EDialogueHelperType SpeakerType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterSpeaker", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Actor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeakerType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterSpeakerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterSpeaker", true);
+        var parms = new RegisterSpeaker_Params();
+        parms.Actor = Actor?.Ptr ?? 0;
+        parms.SpeakerType = SpeakerType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float Delta;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float Delta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Delta, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.Tick", true);
+        var parms = new Tick_Params();
+        parms.Delta = Delta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePendingDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct UpdatePendingDialogue_Params
+    {
+        [FieldOffset(0)] public float Delta;
+    }
+
     /// <summary>
     /// Function: UpdatePendingDialogue
     /// </summary>
     public unsafe virtual void UpdatePendingDialogue(float Delta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UpdatePendingDialogue", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Delta, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdatePendingDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UpdatePendingDialogue", true);
+        var parms = new UpdatePendingDialogue_Params();
+        parms.Delta = Delta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateActorListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateActorList_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateActorList
     /// </summary>
     public unsafe virtual void UpdateActorList()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UpdateActorList", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateActorListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UpdateActorList", true);
+        var parms = new UpdateActorList_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateRunningSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateRunningSpeech_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateRunningSpeech
     /// </summary>
     public unsafe virtual void UpdateRunningSpeech()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UpdateRunningSpeech", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateRunningSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UpdateRunningSpeech", true);
+        var parms = new UpdateRunningSpeech_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetFlagDialogueManagerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetFlagDialogueManager_Params
+    {
+        [FieldOffset(0)] public int flag;
+    }
+
     /// <summary>
     /// Function: SetFlagDialogueManager
     /// </summary>
     public unsafe virtual void SetFlagDialogueManager(bool flag)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.SetFlagDialogueManager", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(flag, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetFlagDialogueManagerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.SetFlagDialogueManager", true);
+        var parms = new SetFlagDialogueManager_Params();
+        parms.flag = flag ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveTVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveTV_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveTV
     /// </summary>
     public unsafe virtual void RemoveTV()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RemoveTV", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveTVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RemoveTV", true);
+        var parms = new RemoveTV_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddTVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AddTV_Params
+    {
+    }
+
     /// <summary>
     /// Function: AddTV
     /// </summary>
     public unsafe virtual void AddTV()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.AddTV", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddTVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.AddTV", true);
+        var parms = new AddTV_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopTapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopTape_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopTape
     /// </summary>
     public unsafe virtual void StopTape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.StopTape", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopTapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.StopTape", true);
+        var parms = new StopTape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddLineToDialogueManagerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddLineToDialogueManager_Params
+    {
+        [FieldOffset(0)] public nint Line;
+    }
+
     /// <summary>
     /// Function: AddLineToDialogueManager
     /// </summary>
     public unsafe virtual void AddLineToDialogueManager(BmSDK.Engine.RDialogueLine Line)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.AddLineToDialogueManager", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Line, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddLineToDialogueManagerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.AddLineToDialogueManager", true);
+        var parms = new AddLineToDialogueManager_Params();
+        parms.Line = Line?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BumpRandomDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BumpRandomDialogue_Params
+    {
+    }
+
     /// <summary>
     /// Function: BumpRandomDialogue
     /// </summary>
     public unsafe virtual void BumpRandomDialogue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.BumpRandomDialogue", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_BumpRandomDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.BumpRandomDialogue", true);
+        var parms = new BumpRandomDialogue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckRegisteredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CheckRegistered_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckRegistered
     /// </summary>
     public unsafe virtual bool CheckRegistered(BmSDK.BmGame.RPawn Pawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CheckRegistered", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CheckRegisteredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CheckRegistered", true);
+        var parms = new CheckRegistered_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_LineIsActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct LineIsActive_Params
+    {
+        [FieldOffset(0)] public nint Line;
     }
 
     /// <summary>
@@ -443,96 +597,101 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void LineIsActive(BmSDK.Engine.RDialogueLine Line)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.LineIsActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Line, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_LineIsActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.LineIsActive", true);
+        var parms = new LineIsActive_Params();
+        parms.Line = Line?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ConversationIsActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ConversationIsActive_Params
+    {
+        [FieldOffset(0)] public nint Conversation;
+    }
+
     /// <summary>
     /// Function: ConversationIsActive
     /// </summary>
     public unsafe virtual void ConversationIsActive(BmSDK.BmGame.RScriptConversation Conversation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ConversationIsActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conversation, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ConversationIsActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ConversationIsActive", true);
+        var parms = new ConversationIsActive_Params();
+        parms.Conversation = Conversation?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveBankInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RemoveBankInfo_Params
+    {
+        [FieldOffset(0)] public nint Bank;
+    }
+
     /// <summary>
     /// Function: RemoveBankInfo
     /// </summary>
     public unsafe virtual void RemoveBankInfo(BmSDK.Engine.AkBank Bank)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RemoveBankInfo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bank, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RemoveBankInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RemoveBankInfo", true);
+        var parms = new RemoveBankInfo_Params();
+        parms.Bank = Bank?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddBankInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct AddBankInfo_Params
+    {
+        [FieldOffset(0)] public nint Bank;
+        [FieldOffset(4)] public int DoLoadInDialogueManager;
+        [FieldOffset(8)] public int AlsoLoadStreams;
+        [FieldOffset(12)] public int ErrorOnLoad;
+    }
+
     /// <summary>
     /// Function: AddBankInfo
     /// </summary>
     public unsafe virtual void AddBankInfo(BmSDK.Engine.AkBank Bank, bool DoLoadInDialogueManager, bool AlsoLoadStreams, bool ErrorOnLoad = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.AddBankInfo", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bank, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DoLoadInDialogueManager, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AlsoLoadStreams, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ErrorOnLoad, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_AddBankInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.AddBankInfo", true);
+        var parms = new AddBankInfo_Params();
+        parms.Bank = Bank?.Ptr ?? 0;
+        parms.DoLoadInDialogueManager = DoLoadInDialogueManager ? 1 : 0;
+        parms.AlsoLoadStreams = AlsoLoadStreams ? 1 : 0;
+        parms.ErrorOnLoad = ErrorOnLoad ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsTapePlayingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsTapePlaying_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsTapePlaying
     /// </summary>
     public unsafe virtual bool IsTapePlaying()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.IsTapePlaying", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsTapePlayingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.IsTapePlaying", true);
+        var parms = new IsTapePlaying_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsConversationLoadedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsConversationLoaded_Params
+    {
+        [FieldOffset(0)] public nint Conversation;
+        [FieldOffset(4)] public nint SingleLine;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -540,19 +699,23 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsConversationLoaded(BmSDK.BmGame.RScriptConversation Conversation, BmSDK.Engine.RDialogueLine SingleLine)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.IsConversationLoaded", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conversation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SingleLine, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_IsConversationLoadedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.IsConversationLoaded", true);
+        var parms = new IsConversationLoaded_Params();
+        parms.Conversation = Conversation?.Ptr ?? 0;
+        parms.SingleLine = SingleLine?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_LoadConversationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct LoadConversation_Params
+    {
+        [FieldOffset(0)] public nint Conversation;
+        [FieldOffset(4)] public nint SingleLine;
+        [FieldOffset(8)] public float TimeToKeep;
+        [FieldOffset(12)] public int RemoveFromGame;
+        [FieldOffset(16)] public int OnlyLoadBanks;
     }
 
     /// <summary>
@@ -560,175 +723,178 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void LoadConversation(BmSDK.BmGame.RScriptConversation Conversation, BmSDK.Engine.RDialogueLine SingleLine, float TimeToKeep, bool RemoveFromGame, bool OnlyLoadBanks = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.LoadConversation", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conversation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SingleLine, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeToKeep, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RemoveFromGame, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OnlyLoadBanks, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_LoadConversationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.LoadConversation", true);
+        var parms = new LoadConversation_Params();
+        parms.Conversation = Conversation?.Ptr ?? 0;
+        parms.SingleLine = SingleLine?.Ptr ?? 0;
+        parms.TimeToKeep = TimeToKeep;
+        parms.RemoveFromGame = RemoveFromGame ? 1 : 0;
+        parms.OnlyLoadBanks = OnlyLoadBanks ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePendingDialogueLoadingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdatePendingDialogueLoading_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdatePendingDialogueLoading
     /// </summary>
     public unsafe virtual void UpdatePendingDialogueLoading(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UpdatePendingDialogueLoading", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdatePendingDialogueLoadingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UpdatePendingDialogueLoading", true);
+        var parms = new UpdatePendingDialogueLoading_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InternalStopTapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InternalStopTape_Params
+    {
+    }
+
     /// <summary>
     /// Function: InternalStopTape
     /// </summary>
     public unsafe virtual void InternalStopTape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.InternalStopTape", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_InternalStopTapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.InternalStopTape", true);
+        var parms = new InternalStopTape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayTapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PlayTape_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TapeName;
+        [FieldOffset(12)] public int TapeNumber;
+    }
+
     /// <summary>
     /// Function: PlayTape
     /// </summary>
     public unsafe virtual void PlayTape(BmSDK.FString TapeName, int TapeNumber)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PlayTape", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TapeName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TapeNumber, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PlayTapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PlayTape", true);
+        var parms = new PlayTape_Params();
+        parms.TapeName = TapeName;
+        parms.TapeNumber = TapeNumber;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitTapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InitTape_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitTape
     /// </summary>
     public unsafe virtual void InitTape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.InitTape", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_InitTapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.InitTape", true);
+        var parms = new InitTape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayerChangeResetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayerChangeReset_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayerChangeReset
     /// </summary>
     public unsafe virtual void PlayerChangeReset()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PlayerChangeReset", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PlayerChangeResetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PlayerChangeReset", true);
+        var parms = new PlayerChangeReset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Reset_Params
+    {
+    }
+
     /// <summary>
     /// Function: Reset
     /// </summary>
     public unsafe override void Reset()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.Reset", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ResetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.Reset", true);
+        var parms = new Reset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LinePackageLoadedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct LinePackageLoaded_Params
+    {
+        [FieldOffset(0)] public int Id;
+    }
+
     /// <summary>
     /// Function: LinePackageLoaded
     /// </summary>
     public unsafe virtual void LinePackageLoaded(int Id)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.LinePackageLoaded", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_LinePackageLoadedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.LinePackageLoaded", true);
+        var parms = new LinePackageLoaded_Params();
+        parms.Id = Id;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LinePackageLoadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct LinePackageLoad_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Info;
+        [FieldOffset(12)] public BmSDK.FString Line;
+        [FieldOffset(24)] public BmSDK.FString Package;
+        [FieldOffset(36)] public int RadioStart;
+        [FieldOffset(40)] public nint PawnToPlayOn;
+        [FieldOffset(44)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: LinePackageLoad
     /// </summary>
     public unsafe virtual bool LinePackageLoad(BmSDK.FString Info, BmSDK.FString Line, BmSDK.FString Package, bool RadioStart, BmSDK.Engine.Actor PawnToPlayOn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.LinePackageLoad", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Info, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Line, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Package, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RadioStart, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PawnToPlayOn, paramsPtr + 40);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 44);
+        var funcManaged = s_LinePackageLoadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.LinePackageLoad", true);
+        var parms = new LinePackageLoad_Params();
+        parms.Info = Info;
+        parms.Line = Line;
+        parms.Package = Package;
+        parms.RadioStart = RadioStart ? 1 : 0;
+        parms.PawnToPlayOn = PawnToPlayOn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ProcessTriggersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ProcessTriggers_Params
+    {
+        [FieldOffset(0)] public nint DialogueEvent;
+        [FieldOffset(4)] public nint A;
     }
 
     /// <summary>
@@ -736,38 +902,42 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ProcessTriggers(BmSDK.Engine.RDialogueEvent DialogueEvent, BmSDK.Engine.Actor A)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ProcessTriggers", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueEvent, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ProcessTriggersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ProcessTriggers", true);
+        var parms = new ProcessTriggers_Params();
+        parms.DialogueEvent = DialogueEvent?.Ptr ?? 0;
+        parms.A = A?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpeechReadyToStartFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SpeechReadyToStart_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RDialogueManager.FRPendingSpeech Speech;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SpeechReadyToStart
     /// </summary>
     public unsafe virtual bool SpeechReadyToStart(out BmSDK.BmGame.RDialogueManager.FRPendingSpeech Speech)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.SpeechReadyToStart", true);
-        byte* paramsPtr = stackalloc byte[20];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Speech = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.FRPendingSpeech>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_SpeechReadyToStartFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.SpeechReadyToStart", true);
+        var parms = new SpeechReadyToStart_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Speech = parms.Speech;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OkToPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct OkToPlay_Params
+    {
+        [FieldOffset(0)] public nint Speech;
+        [FieldOffset(16)] public int ErrorIfNoPlay;
+        [FieldOffset(20)] public int DoNotModifyTables;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -775,21 +945,24 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool OkToPlay(BmSDK.Engine.SequenceAction Speech, BmSDK.TArray<BmSDK.BmGame.RPawn> Pawns, bool ErrorIfNoPlay, bool DoNotModifyTables)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.OkToPlay", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speech, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawns, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ErrorIfNoPlay, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DoNotModifyTables, paramsPtr + 20);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_OkToPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.OkToPlay", true);
+        var parms = new OkToPlay_Params();
+        parms.Speech = Speech?.Ptr ?? 0;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawns, (byte*)&parms + 4);
+        parms.ErrorIfNoPlay = ErrorIfNoPlay ? 1 : 0;
+        parms.DoNotModifyTables = DoNotModifyTables ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OkToPlayNoteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct OkToPlayNote_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RDialogueManager.eDialogueFailResponse Reason;
+        [FieldOffset(4)] public nint Speech;
+        [FieldOffset(8)] public int ErrorIfNoPlay;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -797,20 +970,22 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool OkToPlayNote(BmSDK.BmGame.RDialogueManager.eDialogueFailResponse Reason, BmSDK.Engine.SequenceAction Speech = default, bool ErrorIfNoPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.OkToPlayNote", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Reason, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speech, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ErrorIfNoPlay, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_OkToPlayNoteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.OkToPlayNote", true);
+        var parms = new OkToPlayNote_Params();
+        parms.Reason = Reason;
+        parms.Speech = Speech?.Ptr ?? 0;
+        parms.ErrorIfNoPlay = ErrorIfNoPlay ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanThisPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct CanThisPlay_Params
+    {
+        [FieldOffset(0)] public nint Conv;
+        [FieldOffset(4)] public nint Line;
+        [FieldOffset(8)] public BmSDK.BmGame.RDialogueManager.eDialogueFailResponse ReturnValue;
     }
 
     /// <summary>
@@ -818,19 +993,23 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RDialogueManager.eDialogueFailResponse CanThisPlay(BmSDK.BmGame.RScriptConversation Conv, BmSDK.Engine.RDialogueLine Line)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CanThisPlay", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conv, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Line, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.eDialogueFailResponse>(paramsPtr + 8);
+        var funcManaged = s_CanThisPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CanThisPlay", true);
+        var parms = new CanThisPlay_Params();
+        parms.Conv = Conv?.Ptr ?? 0;
+        parms.Line = Line?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CheckTypeCanPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 17)]
+    private struct CheckTypeCanPlay_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.AkWwise.EDialogueHelperType DialogueType;
+        [FieldOffset(4)] public nint DialogueEvent;
+        [FieldOffset(8)] public BmSDK.Engine.RDialogueEvent.EPriority Priority;
+        [FieldOffset(12)] public int bAlreadyPlaying;
+        [FieldOffset(16)] public BmSDK.BmGame.RDialogueManager.eDialogueFailResponse ReturnValue;
     }
 
     /// <summary>
@@ -838,21 +1017,21 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RDialogueManager.eDialogueFailResponse CheckTypeCanPlay(BmSDK.Engine.AkWwise.EDialogueHelperType DialogueType, BmSDK.Engine.RDialogueEvent DialogueEvent, BmSDK.Engine.RDialogueEvent.EPriority Priority, bool bAlreadyPlaying = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CheckTypeCanPlay", true);
-        byte* paramsPtr = stackalloc byte[17];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueEvent, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Priority, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAlreadyPlaying, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.eDialogueFailResponse>(paramsPtr + 16);
+        var funcManaged = s_CheckTypeCanPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CheckTypeCanPlay", true);
+        var parms = new CheckTypeCanPlay_Params();
+        parms.DialogueType = DialogueType;
+        parms.DialogueEvent = DialogueEvent?.Ptr ?? 0;
+        parms.Priority = Priority;
+        parms.bAlreadyPlaying = bAlreadyPlaying ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UnregisterSingleLineInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnregisterSingleLineInternal_Params
+    {
+        [FieldOffset(0)] public nint Line;
     }
 
     /// <summary>
@@ -860,139 +1039,151 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void UnregisterSingleLineInternal(BmSDK.Engine.RDialogueLine Line)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterSingleLineInternal", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Line, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UnregisterSingleLineInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterSingleLineInternal", true);
+        var parms = new UnregisterSingleLineInternal_Params();
+        parms.Line = Line?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterSingleLineInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RegisterSingleLineInternal_Params
+    {
+        [FieldOffset(0)] public nint Line;
+        [FieldOffset(4)] public BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType;
+        [FieldOffset(8)] public int ManagedBanks;
+        [FieldOffset(12)] public BmSDK.FString RadioStation;
+    }
+
     /// <summary>
     /// Function: RegisterSingleLineInternal
     /// </summary>
     public unsafe virtual void RegisterSingleLineInternal(BmSDK.Engine.RDialogueLine Line, BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType, bool ManagedBanks = default, BmSDK.FString RadioStation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterSingleLineInternal", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Line, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueType, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ManagedBanks, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RadioStation, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RegisterSingleLineInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterSingleLineInternal", true);
+        var parms = new RegisterSingleLineInternal_Params();
+        parms.Line = Line?.Ptr ?? 0;
+        parms.DialogueType = DialogueType;
+        parms.ManagedBanks = ManagedBanks ? 1 : 0;
+        parms.RadioStation = RadioStation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnregisterConversationInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnregisterConversationInternal_Params
+    {
+        [FieldOffset(0)] public nint Conv;
+    }
+
     /// <summary>
     /// Function: UnregisterConversationInternal
     /// </summary>
     public unsafe virtual void UnregisterConversationInternal(BmSDK.BmGame.RScriptConversation Conv)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterConversationInternal", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conv, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UnregisterConversationInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterConversationInternal", true);
+        var parms = new UnregisterConversationInternal_Params();
+        parms.Conv = Conv?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterConversationInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RegisterConversationInternal_Params
+    {
+        [FieldOffset(0)] public nint Conv;
+        [FieldOffset(4)] public BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType;
+        [FieldOffset(8)] public int ManagedBanks;
+        [FieldOffset(12)] public BmSDK.FString RadioStation;
+    }
+
     /// <summary>
     /// Function: RegisterConversationInternal
     /// </summary>
     public unsafe virtual void RegisterConversationInternal(BmSDK.BmGame.RScriptConversation Conv, BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType, bool ManagedBanks = default, BmSDK.FString RadioStation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterConversationInternal", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Conv, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueType, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ManagedBanks, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RadioStation, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RegisterConversationInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterConversationInternal", true);
+        var parms = new RegisterConversationInternal_Params();
+        parms.Conv = Conv?.Ptr ?? 0;
+        parms.DialogueType = DialogueType;
+        parms.ManagedBanks = ManagedBanks ? 1 : 0;
+        parms.RadioStation = RadioStation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnregisterSpeakerInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UnregisterSpeakerInternal_Params
+    {
+        [FieldOffset(0)] public nint Actor;
+        [FieldOffset(4)] public int checkDelete;
+    }
+
     /// <summary>
     /// Function: UnregisterSpeakerInternal
     /// </summary>
     public unsafe virtual void UnregisterSpeakerInternal(BmSDK.Engine.Actor Actor, bool checkDelete)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterSpeakerInternal", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Actor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(checkDelete, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UnregisterSpeakerInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.UnregisterSpeakerInternal", true);
+        var parms = new UnregisterSpeakerInternal_Params();
+        parms.Actor = Actor?.Ptr ?? 0;
+        parms.checkDelete = checkDelete ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterSpeakerInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct RegisterSpeakerInternal_Params
+    {
+        [FieldOffset(0)] public nint Actor;
+        [FieldOffset(4)] public BmSDK.Engine.AkWwise.EDialogueHelperType SpeakerType;
+    }
+
     /// <summary>
     /// Function: RegisterSpeakerInternal
     /// </summary>
     public unsafe virtual void RegisterSpeakerInternal(BmSDK.Engine.Actor Actor, BmSDK.Engine.AkWwise.EDialogueHelperType SpeakerType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterSpeakerInternal", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Actor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeakerType, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RegisterSpeakerInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterSpeakerInternal", true);
+        var parms = new RegisterSpeakerInternal_Params();
+        parms.Actor = Actor?.Ptr ?? 0;
+        parms.SpeakerType = SpeakerType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NumberOfSlotsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NumberOfSlots_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: NumberOfSlots
     /// </summary>
     public unsafe virtual int NumberOfSlots()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.NumberOfSlots", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_NumberOfSlotsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.NumberOfSlots", true);
+        var parms = new NumberOfSlots_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_PlaySpeechInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct PlaySpeechInternal_Params
+    {
+        [FieldOffset(0)] public nint SpeechActor;
+        [FieldOffset(4)] public nint DialogueLine;
+        [FieldOffset(8)] public BmSDK.BmGame.RGameInfo.VocalPriority Priority;
+        [FieldOffset(12)] public nint PlaySpeechAction;
+        [FieldOffset(16)] public int bPlayEarcon;
     }
 
     /// <summary>
@@ -1000,87 +1191,95 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void PlaySpeechInternal(BmSDK.Engine.Actor SpeechActor, BmSDK.Engine.RDialogueLine DialogueLine, BmSDK.BmGame.RGameInfo.VocalPriority Priority, BmSDK.Engine.SequenceAction PlaySpeechAction, bool bPlayEarcon)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PlaySpeechInternal", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueLine, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Priority, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlaySpeechAction, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayEarcon, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PlaySpeechInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.PlaySpeechInternal", true);
+        var parms = new PlaySpeechInternal_Params();
+        parms.SpeechActor = SpeechActor?.Ptr ?? 0;
+        parms.DialogueLine = DialogueLine?.Ptr ?? 0;
+        parms.Priority = Priority;
+        parms.PlaySpeechAction = PlaySpeechAction?.Ptr ?? 0;
+        parms.bPlayEarcon = bPlayEarcon ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopSpeakingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct StopSpeaking_Params
+    {
+        [FieldOffset(0)] public nint A;
+        [FieldOffset(4)] public BmSDK.Engine.AkWwise.FAkSoundHandle Handle;
+        [FieldOffset(16)] public int ActorDelete;
+    }
+
     /// <summary>
     /// Function: StopSpeaking
     /// </summary>
     public unsafe virtual void StopSpeaking(BmSDK.Engine.Actor A, out BmSDK.Engine.AkWwise.FAkSoundHandle Handle, bool ActorDelete = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.StopSpeaking", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ActorDelete, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Handle = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.FAkSoundHandle>(paramsPtr + 4);
+        var funcManaged = s_StopSpeakingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.StopSpeaking", true);
+        var parms = new StopSpeaking_Params();
+        parms.A = A?.Ptr ?? 0;
+        parms.ActorDelete = ActorDelete ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Handle = parms.Handle;
         return;
     }
 
+    static BmSDK.Function s_StopSpeakingNoHandleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct StopSpeakingNoHandle_Params
+    {
+        [FieldOffset(0)] public nint A;
+        [FieldOffset(4)] public int ForceStop;
+        [FieldOffset(8)] public int ActorDelete;
+    }
+
     /// <summary>
     /// Function: StopSpeakingNoHandle
     /// </summary>
     public unsafe virtual void StopSpeakingNoHandle(BmSDK.Engine.Actor A, bool ForceStop, bool ActorDelete = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.StopSpeakingNoHandle", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceStop, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ActorDelete, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_StopSpeakingNoHandleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.StopSpeakingNoHandle", true);
+        var parms = new StopSpeakingNoHandle_Params();
+        parms.A = A?.Ptr ?? 0;
+        parms.ForceStop = ForceStop ? 1 : 0;
+        parms.ActorDelete = ActorDelete ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartSpeakingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct StartSpeaking_Params
+    {
+        [FieldOffset(0)] public nint A;
+        [FieldOffset(4)] public nint DialogueEvent;
+        [FieldOffset(20)] public int SoundCallbackFlags;
+        [FieldOffset(24)] public float FaceFXStartTime;
+        [FieldOffset(28)] public BmSDK.Engine.AkWwise.FAkSoundHandle ReturnValue;
+    }
+
     /// <summary>
     /// Function: StartSpeaking
     /// </summary>
     public unsafe virtual BmSDK.Engine.AkWwise.FAkSoundHandle StartSpeaking(BmSDK.Engine.Actor A, BmSDK.Engine.RDialogueEvent DialogueEvent, System.IntPtr SoundCallbackDelegate = default, int SoundCallbackFlags = default, float FaceFXStartTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.StartSpeaking", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueEvent, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundCallbackDelegate, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundCallbackFlags, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FaceFXStartTime, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.FAkSoundHandle>(paramsPtr + 28);
+        var funcManaged = s_StartSpeakingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.StartSpeaking", true);
+        var parms = new StartSpeaking_Params();
+        parms.A = A?.Ptr ?? 0;
+        parms.DialogueEvent = DialogueEvent?.Ptr ?? 0;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundCallbackDelegate, (byte*)&parms + 8);
+        parms.SoundCallbackFlags = SoundCallbackFlags;
+        parms.FaceFXStartTime = FaceFXStartTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanContinueRingingPhoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanContinueRingingPhone_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1088,17 +1287,17 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool CanContinueRingingPhone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CanContinueRingingPhone", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanContinueRingingPhoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CanContinueRingingPhone", true);
+        var parms = new CanContinueRingingPhone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanRingPhoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanRingPhone_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1106,17 +1305,16 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool CanRingPhone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CanRingPhone", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanRingPhoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.CanRingPhone", true);
+        var parms = new CanRingPhone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Init_Params
+    {
     }
 
     /// <summary>
@@ -1124,35 +1322,38 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void Init()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.Init", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.Init", true);
+        var parms = new Init_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AreHelicoptersAggressiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AreHelicoptersAggressive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AreHelicoptersAggressive
     /// </summary>
     public unsafe virtual bool AreHelicoptersAggressive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.AreHelicoptersAggressive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AreHelicoptersAggressiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.AreHelicoptersAggressive", true);
+        var parms = new AreHelicoptersAggressive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DebugNoteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DebugNote_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Note;
+        [FieldOffset(12)] public BmSDK.BmGame.RDialogueManager.eDialogueDebugNoteState State;
+        [FieldOffset(16)] public int Surv;
+        [FieldOffset(20)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1160,20 +1361,19 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool DebugNote(BmSDK.FString Note, BmSDK.BmGame.RDialogueManager.eDialogueDebugNoteState State = default, bool Surv = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.DebugNote", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Note, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(State, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Surv, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 20);
+        var funcManaged = s_DebugNoteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.DebugNote", true);
+        var parms = new DebugNote_Params();
+        parms.Note = Note;
+        parms.State = State;
+        parms.Surv = Surv ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClearAllAliasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearAllAlias_Params
+    {
     }
 
     /// <summary>
@@ -1181,97 +1381,95 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ClearAllAlias()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ClearAllAlias", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClearAllAliasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ClearAllAlias", true);
+        var parms = new ClearAllAlias_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearAliasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ClearAlias_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString CharacterName;
+    }
+
     /// <summary>
     /// Function: ClearAlias
     /// </summary>
     public unsafe virtual void ClearAlias(BmSDK.FString CharacterName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ClearAlias", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClearAliasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.ClearAlias", true);
+        var parms = new ClearAlias_Params();
+        parms.CharacterName = CharacterName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterAliasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RegisterAlias_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString CharacterName;
+        [FieldOffset(12)] public BmSDK.FString NewCharacterName;
+    }
+
     /// <summary>
     /// Function: RegisterAlias
     /// </summary>
     public unsafe virtual void RegisterAlias(BmSDK.FString CharacterName, BmSDK.FString NewCharacterName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterAlias", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCharacterName, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RegisterAliasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.RegisterAlias", true);
+        var parms = new RegisterAlias_Params();
+        parms.CharacterName = CharacterName;
+        parms.NewCharacterName = NewCharacterName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetUsedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SetUsed_Params
+    {
+        [FieldOffset(0)] public nint LineSet;
+        [FieldOffset(4)] public BmSDK.BmGame.RChapterLineSet.FChapterLineDefinition LineIn;
+        [FieldOffset(16)] public int ToSet;
+    }
+
     /// <summary>
     /// Function: SetUsed
     /// </summary>
     public unsafe virtual void SetUsed(BmSDK.BmGame.RChapterLineSet LineSet, BmSDK.BmGame.RChapterLineSet.FChapterLineDefinition LineIn, bool ToSet)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.SetUsed", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineSet, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineIn, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ToSet, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetUsedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.SetUsed", true);
+        var parms = new SetUsed_Params();
+        parms.LineSet = LineSet?.Ptr ?? 0;
+        parms.LineIn = LineIn;
+        parms.ToSet = ToSet ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetUsedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetUsed_Params
+    {
+        [FieldOffset(0)] public nint LineSet;
+        [FieldOffset(4)] public BmSDK.BmGame.RChapterLineSet.FChapterLineDefinition LineIn;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetUsed
     /// </summary>
     public unsafe virtual bool GetUsed(BmSDK.BmGame.RChapterLineSet LineSet, BmSDK.BmGame.RChapterLineSet.FChapterLineDefinition LineIn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.GetUsed", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineSet, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineIn, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_GetUsedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDialogueManager.GetUsed", true);
+        var parms = new GetUsed_Params();
+        parms.LineSet = LineSet?.Ptr ?? 0;
+        parms.LineIn = LineIn;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -1318,11 +1516,7 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float Time;
     }
 
     /// <summary>
@@ -1331,41 +1525,31 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 16)]
     public partial record struct FRPendingSpeech
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: Active
         /// </summary>
-        public unsafe bool Active
+        public bool Active
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// ByteProperty: Error
         /// </summary>
-        public unsafe BmSDK.BmGame.RDialogueManager.ePendingErrorType Error
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.ePendingErrorType>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.BmGame.RDialogueManager.ePendingErrorType Error;
 
         /// <summary>
         /// ByteProperty: PendingState
         /// </summary>
-        public unsafe BmSDK.BmGame.RDialogueManager.ePendingState PendingState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.ePendingState>(Ptr + 5); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5); }; }
-        }
+        [FieldOffset(5)] public BmSDK.BmGame.RDialogueManager.ePendingState PendingState;
 
         /// <summary>
         /// FloatProperty: DebugTime
         /// </summary>
-        public unsafe float DebugTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float DebugTime;
 
         /// <summary>
         /// ObjectProperty: Speech
@@ -1383,6 +1567,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 24)]
     public partial record struct FPreLoadedDialogue
     {
+        [FieldOffset(20)] private int _bitfield20;
+
         /// <summary>
         /// ObjectProperty: Conversation
         /// </summary>
@@ -1404,46 +1590,30 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: TimeToKeepAround
         /// </summary>
-        public unsafe float TimeToKeepAround
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float TimeToKeepAround;
 
         /// <summary>
         /// ByteProperty: PendingState
         /// </summary>
-        public unsafe BmSDK.BmGame.RDialogueManager.ePendingState PendingState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.ePendingState>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RDialogueManager.ePendingState PendingState;
 
         /// <summary>
         /// ByteProperty: PendingError
         /// </summary>
-        public unsafe BmSDK.BmGame.RDialogueManager.ePendingErrorType PendingError
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.ePendingErrorType>(Ptr + 13); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 13); }; }
-        }
+        [FieldOffset(13)] public BmSDK.BmGame.RDialogueManager.ePendingErrorType PendingError;
 
         /// <summary>
         /// FloatProperty: DebugTime
         /// </summary>
-        public unsafe float DebugTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float DebugTime;
 
         /// <summary>
         /// BoolProperty: JustLoadBanks
         /// </summary>
-        public unsafe bool JustLoadBanks
+        public bool JustLoadBanks
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 1) != 0;
+            set { if (value) _bitfield20 |= 1; else _bitfield20 &= ~1; }
         }
     }
 
@@ -1485,29 +1655,17 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Time;
 
         /// <summary>
         /// StructProperty: Position
         /// </summary>
-        public unsafe System.Numerics.Vector3 Position
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 Position;
 
         /// <summary>
         /// FloatProperty: Size
         /// </summary>
-        public unsafe float Size
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float Size;
     }
 
     /// <summary>
@@ -1516,6 +1674,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 44)]
     public partial record struct FRRegisteredConversation
     {
+        [FieldOffset(32)] private int _bitfield32;
+
         /// <summary>
         /// ObjectProperty: ScriptConversation
         /// </summary>
@@ -1546,56 +1706,36 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: DialogueType
         /// </summary>
-        public unsafe BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.BmGame.RSeqAct_PlaySpeechBase.EDialogueType DialogueType;
 
         /// <summary>
         /// IntProperty: CurrentPriority
         /// </summary>
-        public unsafe int CurrentPriority
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int CurrentPriority;
 
         /// <summary>
         /// IntProperty: ConversationID
         /// </summary>
-        public unsafe int ConversationID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int ConversationID;
 
         /// <summary>
         /// BoolProperty: bBanksManaged
         /// </summary>
-        public unsafe bool bBanksManaged
+        public bool bBanksManaged
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 1) != 0;
+            set { if (value) _bitfield32 |= 1; else _bitfield32 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: TimeAdded
         /// </summary>
-        public unsafe float TimeAdded
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float TimeAdded;
 
         /// <summary>
         /// FloatProperty: TimeInactive
         /// </summary>
-        public unsafe float TimeInactive
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float TimeInactive;
     }
 
     /// <summary>
@@ -1604,6 +1744,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 44)]
     public partial record struct FRPendingDialogue
     {
+        [FieldOffset(36)] private int _bitfield36;
+
         /// <summary>
         /// StrProperty: PackageLine
         /// </summary>
@@ -1643,29 +1785,21 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: PendingState
         /// </summary>
-        public unsafe BmSDK.BmGame.RDialogueManager.ePendingLoadState PendingState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.ePendingLoadState>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.BmGame.RDialogueManager.ePendingLoadState PendingState;
 
         /// <summary>
         /// BoolProperty: RadioStart
         /// </summary>
-        public unsafe bool RadioStart
+        public bool RadioStart
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 1) != 0;
+            set { if (value) _bitfield36 |= 1; else _bitfield36 &= ~1; }
         }
 
         /// <summary>
         /// IntProperty: Id
         /// </summary>
-        public unsafe int Id
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public int Id;
     }
 
     /// <summary>
@@ -1689,14 +1823,12 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 32)]
     public partial record struct FDialogueDebugNotes
     {
+        [FieldOffset(20)] private int _bitfield20;
+
         /// <summary>
         /// IntProperty: Number
         /// </summary>
-        public unsafe int Number
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int Number;
 
         /// <summary>
         /// StrProperty: Note
@@ -1710,38 +1842,26 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: NoteState
         /// </summary>
-        public unsafe BmSDK.BmGame.RDialogueManager.eDialogueDebugNoteState NoteState
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RDialogueManager.eDialogueDebugNoteState>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.BmGame.RDialogueManager.eDialogueDebugNoteState NoteState;
 
         /// <summary>
         /// BoolProperty: Surveillance
         /// </summary>
-        public unsafe bool Surveillance
+        public bool Surveillance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 1) != 0;
+            set { if (value) _bitfield20 |= 1; else _bitfield20 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float Time;
 
         /// <summary>
         /// FloatProperty: StartTime
         /// </summary>
-        public unsafe float StartTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float StartTime;
     }
 
     /// <summary>
@@ -1762,6 +1882,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 28)]
     public partial record struct FBanksLoadedInfo
     {
+        [FieldOffset(24)] private int _bitfield24;
+
         /// <summary>
         /// StrProperty: BankName
         /// </summary>
@@ -1774,37 +1896,25 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: LoadCount
         /// </summary>
-        public unsafe int LoadCount
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int LoadCount;
 
         /// <summary>
         /// IntProperty: HookCount
         /// </summary>
-        public unsafe int HookCount
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int HookCount;
 
         /// <summary>
         /// FloatProperty: TimeLoaded
         /// </summary>
-        public unsafe float TimeLoaded
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float TimeLoaded;
 
         /// <summary>
         /// BoolProperty: Error
         /// </summary>
-        public unsafe bool Error
+        public bool Error
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 1) != 0;
+            set { if (value) _bitfield24 |= 1; else _bitfield24 &= ~1; }
         }
     }
 
@@ -1831,8 +1941,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int CurrentSurvDialogueConvID
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(int*)(Ptr + 436); }
+        set { *(int*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -1840,8 +1950,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxActiveLines
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(int*)(Ptr + 440); }
+        set { *(int*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -1867,8 +1977,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr DebugFileWriter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(System.IntPtr*)(Ptr + 564); }
+        set { *(System.IntPtr*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -1876,8 +1986,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr DebugInfoFileWriter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 568); }
+        get { return *(System.IntPtr*)(Ptr + 568); }
+        set { *(System.IntPtr*)(Ptr + 568) = value; }
     }
 
     /// <summary>
@@ -1885,8 +1995,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ActivatedThroughWarning
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 1; else *(int*)(Ptr + 572) &= ~1; }
     }
 
     /// <summary>
@@ -1894,8 +2004,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool SurveillanceAllowed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 2; else *(int*)(Ptr + 572) &= ~2; }
     }
 
     /// <summary>
@@ -1903,8 +2013,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool CurrentPlayerCanUseSurveillance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 4; else *(int*)(Ptr + 572) &= ~4; }
     }
 
     /// <summary>
@@ -1912,8 +2022,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDialogueSet
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 8; else *(int*)(Ptr + 572) &= ~8; }
     }
 
     /// <summary>
@@ -1921,8 +2031,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TVIsPriority
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 16; else *(int*)(Ptr + 572) &= ~16; }
     }
 
     /// <summary>
@@ -1930,8 +2040,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TapeIsPlaying
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 32; else *(int*)(Ptr + 572) &= ~32; }
     }
 
     /// <summary>
@@ -1939,8 +2049,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TapeIsPriority
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 64; else *(int*)(Ptr + 572) &= ~64; }
     }
 
     /// <summary>
@@ -1948,8 +2058,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TelephoneIsPlaying
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 128; else *(int*)(Ptr + 572) &= ~128; }
     }
 
     /// <summary>
@@ -1957,8 +2067,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TelephoneIsPriority
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 256; else *(int*)(Ptr + 572) &= ~256; }
     }
 
     /// <summary>
@@ -1966,8 +2076,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool RiddleIsPlaying
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 512; else *(int*)(Ptr + 572) &= ~512; }
     }
 
     /// <summary>
@@ -1975,8 +2085,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool RiddleIsPriority
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 1024; else *(int*)(Ptr + 572) &= ~1024; }
     }
 
     /// <summary>
@@ -1984,8 +2094,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool BroadCastActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 2048; else *(int*)(Ptr + 572) &= ~2048; }
     }
 
     /// <summary>
@@ -1993,8 +2103,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool OldCurrentPlayerCanUseSurveillance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 4096; else *(int*)(Ptr + 572) &= ~4096; }
     }
 
     /// <summary>
@@ -2002,8 +2112,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool HighestIsSingleLine
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 8192; else *(int*)(Ptr + 572) &= ~8192; }
     }
 
     /// <summary>
@@ -2011,8 +2121,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TapeLoaded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 16384; else *(int*)(Ptr + 572) &= ~16384; }
     }
 
     /// <summary>
@@ -2020,8 +2130,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TapePlaying
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 32768; else *(int*)(Ptr + 572) &= ~32768; }
     }
 
     /// <summary>
@@ -2029,8 +2139,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TapeError
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 65536; else *(int*)(Ptr + 572) &= ~65536; }
     }
 
     /// <summary>
@@ -2038,8 +2148,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool TapeBankLoading
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 572); }
+        get { return (*(int*)(Ptr + 572) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 572) |= 131072; else *(int*)(Ptr + 572) &= ~131072; }
     }
 
     /// <summary>
@@ -2047,8 +2157,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float ActivatedThroughWarningTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 576); }
+        get { return *(float*)(Ptr + 576); }
+        set { *(float*)(Ptr + 576) = value; }
     }
 
     /// <summary>
@@ -2074,8 +2184,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int LoadingSets
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 604); }
+        get { return *(int*)(Ptr + 604); }
+        set { *(int*)(Ptr + 604) = value; }
     }
 
     /// <summary>
@@ -2083,8 +2193,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int TVsActive
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 608); }
+        get { return *(int*)(Ptr + 608); }
+        set { *(int*)(Ptr + 608) = value; }
     }
 
     /// <summary>
@@ -2113,8 +2223,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int TapeSubtitle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 660); }
+        get { return *(int*)(Ptr + 660); }
+        set { *(int*)(Ptr + 660) = value; }
     }
 
     /// <summary>
@@ -2140,8 +2250,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr RandomPackageLoading
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 672); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 672); }
+        get { return *(System.IntPtr*)(Ptr + 672); }
+        set { *(System.IntPtr*)(Ptr + 672) = value; }
     }
 
     /// <summary>
@@ -2167,8 +2277,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int DebugNoteNumber
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 748); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 748); }
+        get { return *(int*)(Ptr + 748); }
+        set { *(int*)(Ptr + 748) = value; }
     }
 
     /// <summary>
@@ -2194,8 +2304,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr HighestDialogue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 776); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 776); }
+        get { return *(System.IntPtr*)(Ptr + 776); }
+        set { *(System.IntPtr*)(Ptr + 776) = value; }
     }
 
     /// <summary>
@@ -2311,8 +2421,8 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float DebugStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 908); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 908); }
+        get { return *(float*)(Ptr + 908); }
+        set { *(float*)(Ptr + 908) = value; }
     }
 
     /// <summary>
@@ -2330,13 +2440,15 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 24)]
     public partial record struct FLineLoadedCallbackSt
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: InUse
         /// </summary>
-        public unsafe bool InUse
+        public bool InUse
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
@@ -2351,11 +2463,7 @@ public partial class RDialogueManager : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Id
         /// </summary>
-        public unsafe int Id
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int Id;
 
         /// <summary>
         /// StrProperty: PackageName
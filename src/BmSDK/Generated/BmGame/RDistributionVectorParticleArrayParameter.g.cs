@@ -83,8 +83,8 @@ public partial class RDistributionVectorParticleArrayParameter : BmSDK.Engine.Di
     /// </summary>
     public unsafe float LastRenderTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(float*)(Ptr + 144); }
+        set { *(float*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RDistributionVectorParticleArrayParameter : BmSDK.Engine.Di
     /// </summary>
     public unsafe int ParticleIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(int*)(Ptr + 148); }
+        set { *(int*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class RDistributionVectorParticleArrayParameter : BmSDK.Engine.Di
     /// </summary>
     public unsafe int DynamicCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(int*)(Ptr + 152); }
+        set { *(int*)(Ptr + 152) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class RDmgType_Ranged : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe float StaggerBatmanRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RDmgType_SimultaneousCounter : BmSDK.BmGame.RDmgType_Strike
     /// </summary>
     public unsafe int AlignmentPad
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(int*)(Ptr + 140); }
+        set { *(int*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class RDmgType_SimultaneousCounter : BmSDK.BmGame.RDmgType_Strike
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnPlayerCombat.CounterStrength CounterStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.CounterStrength>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(BmSDK.BmGame.RPawnPlayerCombat.CounterStrength*)(Ptr + 144); }
+        set { *(BmSDK.BmGame.RPawnPlayerCombat.CounterStrength*)(Ptr + 144) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bAddScore
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 1; else *(int*)(Ptr + 120) &= ~1; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bCanSlowMo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 2; else *(int*)(Ptr + 120) &= ~2; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bIncCombo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 4; else *(int*)(Ptr + 120) &= ~4; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bAdvanceToFreeFlow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 8; else *(int*)(Ptr + 120) &= ~8; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bEnableMotionBlur
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 16; else *(int*)(Ptr + 120) &= ~16; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe int StrikeDamage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(int*)(Ptr + 124); }
+        set { *(int*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe float StrainAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeStrength StrikeStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeStrength>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(BmSDK.BmGame.RPawnPlayerCombat.StrikeStrength*)(Ptr + 132); }
+        set { *(BmSDK.BmGame.RPawnPlayerCombat.StrikeStrength*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnPlayerCombat.StrikeRange StrikeRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerCombat.StrikeRange>(Ptr + 133); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 133); }
+        get { return *(BmSDK.BmGame.RPawnPlayerCombat.StrikeRange*)(Ptr + 133); }
+        set { *(BmSDK.BmGame.RPawnPlayerCombat.StrikeRange*)(Ptr + 133) = value; }
     }
 
     /// <summary>
@@ -164,7 +164,7 @@ public partial class RDmgType_Strike : BmSDK.BmGame.RDamageType, BmSDK.IGameObje
     /// </summary>
     public unsafe float PreferredTargetDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(float*)(Ptr + 136); }
+        set { *(float*)(Ptr + 136) = value; }
     }
 }
@@ -78,48 +78,73 @@ public partial class RDownloadableContentManager : BmSDK.Engine.DownloadableCont
         where TComponent : class, Framework.IScriptComponent<RDownloadableContentManager>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UnloadDLCFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnloadDLC_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnloadDLC
     /// </summary>
     public unsafe virtual void UnloadDLC()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDownloadableContentManager.UnloadDLC", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnloadDLCFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDownloadableContentManager.UnloadDLC", true);
+        var parms = new UnloadDLC_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RefreshDLCEnumCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RefreshDLCEnumComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshDLCEnumComplete
     /// </summary>
     public unsafe override void RefreshDLCEnumComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDownloadableContentManager.RefreshDLCEnumComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshDLCEnumCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDownloadableContentManager.RefreshDLCEnumComplete", true);
+        var parms = new RefreshDLCEnumComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RefreshDLCFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RefreshDLC_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshDLC
     /// </summary>
     public unsafe override void RefreshDLC()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDownloadableContentManager.RefreshDLC", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshDLCFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDownloadableContentManager.RefreshDLC", true);
+        var parms = new RefreshDLC_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsScanInProgressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsScanInProgress_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsScanInProgress
     /// </summary>
     public unsafe virtual bool IsScanInProgress()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDownloadableContentManager.IsScanInProgress", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsScanInProgressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RDownloadableContentManager.IsScanInProgress", true);
+        var parms = new IsScanInProgress_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -127,8 +152,8 @@ public partial class RDownloadableContentManager : BmSDK.Engine.DownloadableCont
     /// </summary>
     public unsafe bool bScanInProgress
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 1; else *(int*)(Ptr + 216) &= ~1; }
     }
 
     /// <summary>
@@ -136,7 +161,7 @@ public partial class RDownloadableContentManager : BmSDK.Engine.DownloadableCont
     /// </summary>
     public unsafe bool bReloadDLC
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 2; else *(int*)(Ptr + 216) &= ~2; }
     }
 }
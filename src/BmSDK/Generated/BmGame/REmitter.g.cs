@@ -78,26 +78,39 @@ public partial class REmitter : BmSDK.Engine.Emitter, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<REmitter>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GoIntoStasisFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GoIntoStasis_Params
+    {
+    }
+
     /// <summary>
     /// Function: GoIntoStasis
     /// </summary>
     public unsafe virtual void GoIntoStasis()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REmitter.GoIntoStasis", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GoIntoStasisFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REmitter.GoIntoStasis", true);
+        var parms = new GoIntoStasis_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnParticleSystemFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnParticleSystemFinished_Params
+    {
+        [FieldOffset(0)] public nint FinishedComponent;
+    }
+
     /// <summary>
     /// Function: OnParticleSystemFinished
     /// </summary>
     public unsafe override void OnParticleSystemFinished(BmSDK.Engine.ParticleSystemComponent FinishedComponent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REmitter.OnParticleSystemFinished", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishedComponent, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnParticleSystemFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REmitter.OnParticleSystemFinished", true);
+        var parms = new OnParticleSystemFinished_Params();
+        parms.FinishedComponent = FinishedComponent?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -106,8 +119,8 @@ public partial class REmitter : BmSDK.Engine.Emitter, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bResetTemplateOnFinish
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 440); }
+        get { return (*(int*)(Ptr + 440) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 440) |= 1; else *(int*)(Ptr + 440) &= ~1; }
     }
 
     /// <summary>
@@ -115,7 +128,7 @@ public partial class REmitter : BmSDK.Engine.Emitter, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bPutIntoStasisOnFinish
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 440); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 440); }
+        get { return (*(int*)(Ptr + 440) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 440) |= 2; else *(int*)(Ptr + 440) &= ~2; }
     }
 }
@@ -83,7 +83,7 @@ public partial class REnvironmentCheckTicker : BmSDK.Engine.ActorComponent, BmSD
     /// </summary>
     public unsafe bool bGrappleGunTicker
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }
+        get { return (*(int*)(Ptr + 72) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 72) |= 1; else *(int*)(Ptr + 72) &= ~1; }
     }
 }
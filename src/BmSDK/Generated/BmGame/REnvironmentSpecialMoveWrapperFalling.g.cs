@@ -83,8 +83,8 @@ public partial class REnvironmentSpecialMoveWrapperFalling : BmSDK.BmGame.REnvir
     /// </summary>
     public unsafe float MinFallSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class REnvironmentSpecialMoveWrapperFalling : BmSDK.BmGame.REnvir
     /// </summary>
     public unsafe float MaxFallSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 }
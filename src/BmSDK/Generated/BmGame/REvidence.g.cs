@@ -83,8 +83,8 @@ public partial class REvidence : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.REvidence.DevicePostProcessEffects PPColour
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.REvidence.DevicePostProcessEffects>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.BmGame.REvidence.DevicePostProcessEffects*)(Ptr + 44); }
+        set { *(BmSDK.BmGame.REvidence.DevicePostProcessEffects*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class REvidence : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName ScannedFlag
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.FName*)(Ptr + 48); }
+        set { *(BmSDK.FName*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class REvidence : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     /// </summary>
     public unsafe bool DoNotRotateParticleFx
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 144); }
+        get { return (*(int*)(Ptr + 144) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 144) |= 1; else *(int*)(Ptr + 144) &= ~1; }
     }
 
     /// <summary>
@@ -78,28 +78,50 @@ public partial class REvidenceLog : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<REvidenceLog>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetEvidenceAnnouncedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetEvidenceAnnounced_Params
+    {
+        [FieldOffset(0)] public nint evidence;
+    }
+
     /// <summary>
     /// Function: SetEvidenceAnnounced
     /// </summary>
     public unsafe virtual void SetEvidenceAnnounced(BmSDK.GameObject evidence)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetEvidenceAnnounced", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(evidence, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetEvidenceAnnouncedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetEvidenceAnnounced", true);
+        var parms = new SetEvidenceAnnounced_Params();
+        parms.evidence = evidence?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetEvidenceFoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetEvidenceFound_Params
+    {
+        [FieldOffset(0)] public nint evidence;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SetEvidenceFound
     /// </summary>
     public unsafe virtual bool SetEvidenceFound(BmSDK.GameObject evidence)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetEvidenceFound", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(evidence, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_SetEvidenceFoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetEvidenceFound", true);
+        var parms = new SetEvidenceFound_Params();
+        parms.evidence = evidence?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetEvidenceScannedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetEvidenceScanned_Params
+    {
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -107,11 +129,19 @@ public partial class REvidenceLog : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool SetEvidenceScanned(BmSDK.BmGame.REvidenceInterface evidence)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetEvidenceScanned", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(evidence, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_SetEvidenceScannedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetEvidenceScanned", true);
+        var parms = new SetEvidenceScanned_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(evidence, (byte*)&parms + 0);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsRoomUnlockedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsRoomUnlocked_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName roomName;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -119,11 +149,20 @@ public partial class REvidenceLog : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsRoomUnlocked(BmSDK.FName roomName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.IsRoomUnlocked", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(roomName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_IsRoomUnlockedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.IsRoomUnlocked", true);
+        var parms = new IsRoomUnlocked_Params();
+        parms.roomName = roomName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetRoomUnlockedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetRoomUnlocked_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName roomName;
+        [FieldOffset(8)] public int bUnLock;
+        [FieldOffset(12)] public nint PC;
     }
 
     /// <summary>
@@ -131,36 +170,58 @@ public partial class REvidenceLog : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetRoomUnlocked(BmSDK.FName roomName, bool bUnLock, BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetRoomUnlocked", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(roomName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUnLock, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRoomUnlockedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetRoomUnlocked", true);
+        var parms = new SetRoomUnlocked_Params();
+        parms.roomName = roomName;
+        parms.bUnLock = bUnLock ? 1 : 0;
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RefreshRoomsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RefreshRooms_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshRooms
     /// </summary>
     public unsafe virtual void RefreshRooms()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.RefreshRooms", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshRoomsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.RefreshRooms", true);
+        var parms = new RefreshRooms_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasEvidenceBeenFoundAndNotAnnouncedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HasEvidenceBeenFoundAndNotAnnounced_Params
+    {
+        [FieldOffset(0)] public nint evidence;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasEvidenceBeenFoundAndNotAnnounced
     /// </summary>
     public unsafe virtual bool HasEvidenceBeenFoundAndNotAnnounced(BmSDK.GameObject evidence)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.HasEvidenceBeenFoundAndNotAnnounced", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(evidence, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_HasEvidenceBeenFoundAndNotAnnouncedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.HasEvidenceBeenFoundAndNotAnnounced", true);
+        var parms = new HasEvidenceBeenFoundAndNotAnnounced_Params();
+        parms.evidence = evidence?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HasEvidenceBeenScannedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HasEvidenceBeenScanned_Params
+    {
+        [FieldOffset(0)] public nint evidence;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -168,11 +229,18 @@ public partial class REvidenceLog : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool HasEvidenceBeenScanned(BmSDK.BmGame.REvidence evidence)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.HasEvidenceBeenScanned", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(evidence, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_HasEvidenceBeenScannedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.HasEvidenceBeenScanned", true);
+        var parms = new HasEvidenceBeenScanned_Params();
+        parms.evidence = evidence?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetFilterNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetFilterName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -180,10 +248,16 @@ public partial class REvidenceLog : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.FString GetFilterName()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.GetFilterName", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetFilterNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.GetFilterName", true);
+        var parms = new GetFilterName_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DeleteFilterAndAwardXpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DeleteFilterAndAwardXp_Params
+    {
     }
 
     /// <summary>
@@ -191,21 +265,28 @@ public partial class REvidenceLog : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void DeleteFilterAndAwardXp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.DeleteFilterAndAwardXp", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DeleteFilterAndAwardXpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.DeleteFilterAndAwardXp", true);
+        var parms = new DeleteFilterAndAwardXp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetOwnerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetOwner_Params
+    {
+        [FieldOffset(0)] public nint Owner;
+    }
+
     /// <summary>
     /// Function: SetOwner
     /// </summary>
     public unsafe virtual void SetOwner(BmSDK.BmGame.RPlayerController Owner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetOwner", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Owner, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetOwnerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.REvidenceLog.SetOwner", true);
+        var parms = new SetOwner_Params();
+        parms.Owner = Owner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -250,7 +331,7 @@ public partial class REvidenceLog : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float TimeToDisplayEvidenceFound
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 }
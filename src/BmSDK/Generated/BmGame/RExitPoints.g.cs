@@ -78,16 +78,24 @@ public partial class RExitPoints : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RExitPoints>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ShowDebugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ShowDebug_Params
+    {
+        [FieldOffset(0)] public nint DebugActor;
+        [FieldOffset(4)] public int bPerm;
+    }
+
     /// <summary>
     /// Function: ShowDebug
     /// </summary>
     public unsafe virtual void ShowDebug(BmSDK.Engine.Actor DebugActor, bool bPerm = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RExitPoints.ShowDebug", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DebugActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPerm, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowDebugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RExitPoints.ShowDebug", true);
+        var parms = new ShowDebug_Params();
+        parms.DebugActor = DebugActor?.Ptr ?? 0;
+        parms.bPerm = bPerm ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -109,11 +117,7 @@ public partial class RExitPoints : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: ViewEdge
         /// </summary>
-        public unsafe System.Numerics.Vector3 ViewEdge
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public System.Numerics.Vector3 ViewEdge;
     }
 
     /// <summary>
@@ -127,8 +131,8 @@ public partial class RExitPoints : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float PerimeterRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -136,8 +140,8 @@ public partial class RExitPoints : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ViewRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -78,39 +78,60 @@ public partial class RForensicDnaSplatStaticNonScan : BmSDK.BmGame.RForensicDnaS
         where TComponent : class, Framework.IScriptComponent<RForensicDnaSplatStaticNonScan>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_RegisterEvidenceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RegisterEvidence_Params
+    {
+    }
+
     /// <summary>
     /// Function: RegisterEvidence
     /// </summary>
     public unsafe override void RegisterEvidence()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RForensicDnaSplatStaticNonScan.RegisterEvidence", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterEvidenceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RForensicDnaSplatStaticNonScan.RegisterEvidence", true);
+        var parms = new RegisterEvidence_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_showFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct show_Params
+    {
+        [FieldOffset(0)] public float _show;
+        [FieldOffset(4)] public int ShowMode;
+    }
+
     /// <summary>
     /// Function: show
     /// </summary>
     public unsafe override void show(float _show, int ShowMode = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RForensicDnaSplatStaticNonScan.show", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_show, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ShowMode, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_showFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RForensicDnaSplatStaticNonScan.show", true);
+        var parms = new show_Params();
+        parms._show = _show;
+        parms.ShowMode = ShowMode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanBeScannedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanBeScanned_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanBeScanned
     /// </summary>
     public unsafe override bool CanBeScanned()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RForensicDnaSplatStaticNonScan.CanBeScanned", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanBeScannedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RForensicDnaSplatStaticNonScan.CanBeScanned", true);
+        var parms = new CanBeScanned_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -118,8 +139,8 @@ public partial class RForensicDnaSplatStaticNonScan : BmSDK.BmGame.RForensicDnaS
     /// </summary>
     public unsafe bool OldEvidenceToBeFiltered
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 516) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 516); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 516); }
+        get { return (*(int*)(Ptr + 516) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 516) |= 1; else *(int*)(Ptr + 516) &= ~1; }
     }
 
     /// <summary>
@@ -127,8 +148,8 @@ public partial class RForensicDnaSplatStaticNonScan : BmSDK.BmGame.RForensicDnaS
     /// </summary>
     public unsafe float RandomFilterOutTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 520); }
+        get { return *(float*)(Ptr + 520); }
+        set { *(float*)(Ptr + 520) = value; }
     }
 
     /// <summary>
@@ -136,7 +157,7 @@ public partial class RForensicDnaSplatStaticNonScan : BmSDK.BmGame.RForensicDnaS
     /// </summary>
     public unsafe float CurrentRandomFilterTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(float*)(Ptr + 524); }
+        set { *(float*)(Ptr + 524) = value; }
     }
 }
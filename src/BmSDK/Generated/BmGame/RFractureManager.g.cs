@@ -78,18 +78,28 @@ public partial class RFractureManager : BmSDK.Engine.FractureManager, BmSDK.IGam
         where TComponent : class, Framework.IScriptComponent<RFractureManager>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SpawnChunkDestroyEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct SpawnChunkDestroyEffect_Params
+    {
+        [FieldOffset(0)] public nint Effect;
+        [FieldOffset(4)] public BmSDK.GameObject.FBox ChunkBox;
+        [FieldOffset(32)] public System.Numerics.Vector3 ChunkDir;
+        [FieldOffset(44)] public float Scale;
+    }
+
     /// <summary>
     /// Function: SpawnChunkDestroyEffect
     /// </summary>
     public unsafe override void SpawnChunkDestroyEffect(BmSDK.Engine.ParticleSystem Effect, BmSDK.GameObject.FBox ChunkBox, System.Numerics.Vector3 ChunkDir, float Scale)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RFractureManager.SpawnChunkDestroyEffect", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Effect, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChunkBox, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChunkDir, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Scale, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnChunkDestroyEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RFractureManager.SpawnChunkDestroyEffect", true);
+        var parms = new SpawnChunkDestroyEffect_Params();
+        parms.Effect = Effect?.Ptr ?? 0;
+        parms.ChunkBox = ChunkBox;
+        parms.ChunkDir = ChunkDir;
+        parms.Scale = Scale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -83,8 +83,8 @@ public partial class RFreezeTargetLocation : BmSDK.Engine.Actor, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bHasRegisteredSelf
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 428) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 428); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 428); }
+        get { return (*(int*)(Ptr + 428) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 428) |= 1; else *(int*)(Ptr + 428) &= ~1; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class RFreezeTargetLocation : BmSDK.Engine.Actor, BmSDK.IGameObje
     /// </summary>
     public unsafe BmSDK.BmGame.RForensicsDevice.SpecialTrackingMode ForensicTargetType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RForensicsDevice.SpecialTrackingMode>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.BmGame.RForensicsDevice.SpecialTrackingMode*)(Ptr + 432); }
+        set { *(BmSDK.BmGame.RForensicsDevice.SpecialTrackingMode*)(Ptr + 432) = value; }
     }
 }
@@ -78,22 +78,22 @@ public partial class RFullTape : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RFullTape>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_FullyCookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FullyCook_Params
+    {
+        [FieldOffset(0)] public int bStripData;
+    }
+
     /// <summary>
     /// Function: FullyCook
     /// </summary>
     public unsafe virtual void FullyCook(bool bStripData)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RFullTape.FullyCook", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bStripData, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_FullyCookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RFullTape.FullyCook", true);
+        var parms = new FullyCook_Params();
+        parms.bStripData = bStripData ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -120,8 +120,8 @@ public partial class RFullTape : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool FullTape
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1; else *(int*)(Ptr + 52) &= ~1; }
     }
 
     /// <summary>
@@ -129,8 +129,8 @@ public partial class RFullTape : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bFullyCooked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 2; else *(int*)(Ptr + 52) &= ~2; }
     }
 
     /// <summary>
@@ -160,11 +160,7 @@ public partial class RFullTape : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Duration
         /// </summary>
-        public unsafe float Duration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Duration;
 
         /// <summary>
         /// StrProperty: SubtitleCharacterName
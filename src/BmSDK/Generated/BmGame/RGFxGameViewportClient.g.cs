@@ -78,58 +78,99 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
         where TComponent : class, Framework.IScriptComponent<RGFxGameViewportClient>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetProgressMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SetProgressMessage_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.PlayerController.EProgressMessageType MessageType;
+        [FieldOffset(4)] public BmSDK.FString Message;
+        [FieldOffset(16)] public BmSDK.FString Title;
+        [FieldOffset(28)] public int bIgnoreFutureNetworkMessages;
+    }
+
     /// <summary>
     /// Function: SetProgressMessage
     /// </summary>
     public unsafe override void SetProgressMessage(BmSDK.Engine.PlayerController.EProgressMessageType MessageType, BmSDK.FString Message, BmSDK.FString Title = default, bool bIgnoreFutureNetworkMessages = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.SetProgressMessage", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MessageType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Message, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Title, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnoreFutureNetworkMessages, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetProgressMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.SetProgressMessage", true);
+        var parms = new SetProgressMessage_Params();
+        parms.MessageType = MessageType;
+        parms.Message = Message;
+        parms.Title = Title;
+        parms.bIgnoreFutureNetworkMessages = bIgnoreFutureNetworkMessages ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClosePopupsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClosePopups_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClosePopups
     /// </summary>
     public unsafe virtual void ClosePopups()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.ClosePopups", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClosePopupsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.ClosePopups", true);
+        var parms = new ClosePopups_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveErrorPopupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveErrorPopup_Params
+    {
+        [FieldOffset(0)] public nint MovieRef;
+    }
+
     /// <summary>
     /// Function: RemoveErrorPopup
     /// </summary>
     public unsafe virtual void RemoveErrorPopup(BmSDK.BmGame.RGFxMoviePopupRequester MovieRef)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.RemoveErrorPopup", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MovieRef, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveErrorPopupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.RemoveErrorPopup", true);
+        var parms = new RemoveErrorPopup_Params();
+        parms.MovieRef = MovieRef?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OpenPopUpErrorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct OpenPopUpError_Params
+    {
+        [FieldOffset(0)] public nint RPC;
+        [FieldOffset(4)] public BmSDK.BmGame.RGFxMoviePopupRequester.GPopup_Type TheType;
+        [FieldOffset(8)] public nint RespondTo;
+        [FieldOffset(12)] public BmSDK.FString Message;
+        [FieldOffset(36)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: OpenPopUpError
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RGFxMoviePopupRequester OpenPopUpError(BmSDK.BmGame.RPlayerController RPC, BmSDK.BmGame.RGFxMoviePopupRequester.GPopup_Type TheType, BmSDK.BmGame.RGFxMovie RespondTo, BmSDK.FString Message, BmSDK.TArray<BmSDK.FString> Prompts)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.OpenPopUpError", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheType, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RespondTo, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Message, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Prompts, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGFxMoviePopupRequester>(paramsPtr + 36);
+        var funcManaged = s_OpenPopUpErrorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.OpenPopUpError", true);
+        var parms = new OpenPopUpError_Params();
+        parms.RPC = RPC?.Ptr ?? 0;
+        parms.TheType = TheType;
+        parms.RespondTo = RespondTo?.Ptr ?? 0;
+        parms.Message = Message;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Prompts, (byte*)&parms + 24);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RGFxMoviePopupRequester)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_DrawTransitionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct DrawTransition_Params
+    {
+        [FieldOffset(0)] public nint Canvas;
     }
 
     /// <summary>
@@ -137,46 +178,74 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
     /// </summary>
     public unsafe override void DrawTransition(BmSDK.Engine.Canvas Canvas)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.DrawTransition", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Canvas, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawTransitionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.DrawTransition", true);
+        var parms = new DrawTransition_Params();
+        parms.Canvas = Canvas?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowSessionInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct ShowSessionInfo_Params
+    {
+        [FieldOffset(0)] public nint C;
+    }
+
     /// <summary>
     /// Function: ShowSessionInfo
     /// </summary>
     public unsafe virtual void ShowSessionInfo(BmSDK.Engine.Canvas C)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.ShowSessionInfo", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(C, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowSessionInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.ShowSessionInfo", true);
+        var parms = new ShowSessionInfo_Params();
+        parms.C = C?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleSessionInfoDisplayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleSessionInfoDisplay_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleSessionInfoDisplay
     /// </summary>
     public unsafe virtual void ToggleSessionInfoDisplay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.ToggleSessionInfoDisplay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleSessionInfoDisplayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.ToggleSessionInfoDisplay", true);
+        var parms = new ToggleSessionInfoDisplay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString OutError;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(out BmSDK.FString OutError)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.Init", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        OutError = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.Init", true);
+        var parms = new Init_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        OutError = parms.OutError;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetSubtitleMinYFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSubtitleMinY_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -184,17 +253,17 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
     /// </summary>
     public unsafe virtual float GetSubtitleMinY()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.GetSubtitleMinY", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetSubtitleMinYFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.GetSubtitleMinY", true);
+        var parms = new GetSubtitleMinY_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDisplayGammaReferenceBrightnessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDisplayGammaReferenceBrightness_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -202,17 +271,17 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
     /// </summary>
     public unsafe virtual float GetDisplayGammaReferenceBrightness()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.GetDisplayGammaReferenceBrightness", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetDisplayGammaReferenceBrightnessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.GetDisplayGammaReferenceBrightness", true);
+        var parms = new GetDisplayGammaReferenceBrightness_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_InstallOurGFxHandlersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InstallOurGFxHandlers_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -220,17 +289,16 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
     /// </summary>
     public unsafe virtual bool InstallOurGFxHandlers()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.InstallOurGFxHandlers", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_InstallOurGFxHandlersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.InstallOurGFxHandlers", true);
+        var parms = new InstallOurGFxHandlers_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetupGameFontsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetupGameFonts_Params
+    {
     }
 
     /// <summary>
@@ -238,16 +306,9 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
     /// </summary>
     public unsafe virtual void SetupGameFonts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.SetupGameFonts", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetupGameFontsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxGameViewportClient.SetupGameFonts", true);
+        var parms = new SetupGameFonts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -256,8 +317,8 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
     /// </summary>
     public unsafe bool bShowCalibrationImage
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 280); }
+        get { return (*(int*)(Ptr + 280) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 280) |= 1; else *(int*)(Ptr + 280) &= ~1; }
     }
 
     /// <summary>
@@ -265,8 +326,8 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
     /// </summary>
     public unsafe bool bShowSessionDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 280); }
+        get { return (*(int*)(Ptr + 280) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 280) |= 2; else *(int*)(Ptr + 280) &= ~2; }
     }
 
     /// <summary>
@@ -283,7 +344,7 @@ public partial class RGFxGameViewportClient : BmSDK.Engine.GameViewportClient, B
     /// </summary>
     public unsafe float SubtitleYLast
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 }
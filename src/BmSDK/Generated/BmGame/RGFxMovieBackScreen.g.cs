@@ -78,148 +78,194 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
         where TComponent : class, Framework.IScriptComponent<RGFxMovieBackScreen>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_XI_RiddlerGrid_SelectItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct XI_RiddlerGrid_SelectItem_Params
+    {
+        [FieldOffset(0)] public int GridId;
+        [FieldOffset(4)] public int GridIndex;
+    }
+
     /// <summary>
     /// Function: XI_RiddlerGrid_SelectItem
     /// </summary>
     public unsafe virtual void XI_RiddlerGrid_SelectItem(int GridId, int GridIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.XI_RiddlerGrid_SelectItem", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GridId, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GridIndex, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_XI_RiddlerGrid_SelectItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.XI_RiddlerGrid_SelectItem", true);
+        var parms = new XI_RiddlerGrid_SelectItem_Params();
+        parms.GridId = GridId;
+        parms.GridIndex = GridIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_XI_ClosedScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct XI_ClosedScreen_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ScreenName;
+    }
+
     /// <summary>
     /// Function: XI_ClosedScreen
     /// </summary>
     public unsafe virtual void XI_ClosedScreen(BmSDK.FString ScreenName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.XI_ClosedScreen", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreenName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_XI_ClosedScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.XI_ClosedScreen", true);
+        var parms = new XI_ClosedScreen_Params();
+        parms.ScreenName = ScreenName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_XI_OpenedScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct XI_OpenedScreen_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ScreenName;
+    }
+
     /// <summary>
     /// Function: XI_OpenedScreen
     /// </summary>
     public unsafe virtual void XI_OpenedScreen(BmSDK.FString ScreenName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.XI_OpenedScreen", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreenName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_XI_OpenedScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.XI_OpenedScreen", true);
+        var parms = new XI_OpenedScreen_Params();
+        parms.ScreenName = ScreenName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayRiddleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayRiddle_Params
+    {
+        [FieldOffset(0)] public int Idx;
+    }
+
     /// <summary>
     /// Function: PlayRiddle
     /// </summary>
     public unsafe virtual void PlayRiddle(int Idx)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayRiddle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Idx, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PlayRiddleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayRiddle", true);
+        var parms = new PlayRiddle_Params();
+        parms.Idx = Idx;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoTickRiddlerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoTickRiddler_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoTickRiddler
     /// </summary>
     public unsafe virtual void DoTickRiddler()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.DoTickRiddler", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DoTickRiddlerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.DoTickRiddler", true);
+        var parms = new DoTickRiddler_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnloadRiddlerBanksFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnloadRiddlerBanks_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnloadRiddlerBanks
     /// </summary>
     public unsafe virtual void UnloadRiddlerBanks()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.UnloadRiddlerBanks", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UnloadRiddlerBanksFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.UnloadRiddlerBanks", true);
+        var parms = new UnloadRiddlerBanks_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LoadRiddlerBanksFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LoadRiddlerBanks_Params
+    {
+    }
+
     /// <summary>
     /// Function: LoadRiddlerBanks
     /// </summary>
     public unsafe virtual void LoadRiddlerBanks()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.LoadRiddlerBanks", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_LoadRiddlerBanksFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.LoadRiddlerBanks", true);
+        var parms = new LoadRiddlerBanks_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayAzraelMinigameDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PlayAzraelMinigameDialogue_Params
+    {
+        [FieldOffset(0)] public byte dialogue_index;
+    }
+
     /// <summary>
     /// Function: PlayAzraelMinigameDialogue
     /// </summary>
     public unsafe virtual void PlayAzraelMinigameDialogue(byte dialogue_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayAzraelMinigameDialogue", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dialogue_index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayAzraelMinigameDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayAzraelMinigameDialogue", true);
+        var parms = new PlayAzraelMinigameDialogue_Params();
+        parms.dialogue_index = dialogue_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HangUpZsaszPhoneAudioFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HangUpZsaszPhoneAudio_Params
+    {
+    }
+
     /// <summary>
     /// Function: HangUpZsaszPhoneAudio
     /// </summary>
     public unsafe virtual void HangUpZsaszPhoneAudio()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.HangUpZsaszPhoneAudio", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HangUpZsaszPhoneAudioFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.HangUpZsaszPhoneAudio", true);
+        var parms = new HangUpZsaszPhoneAudio_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartZsaszPhoneAudioFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartZsaszPhoneAudio_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: StartZsaszPhoneAudio
     /// </summary>
     public unsafe virtual bool StartZsaszPhoneAudio()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.StartZsaszPhoneAudio", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_StartZsaszPhoneAudioFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.StartZsaszPhoneAudio", true);
+        var parms = new StartZsaszPhoneAudio_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetZsaszTowerMaximumScoreToReachFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetZsaszTowerMaximumScoreToReach_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -227,10 +273,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual float GetZsaszTowerMaximumScoreToReach()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszTowerMaximumScoreToReach", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetZsaszTowerMaximumScoreToReachFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszTowerMaximumScoreToReach", true);
+        var parms = new GetZsaszTowerMaximumScoreToReach_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetZsaszTowerMinimumScoreToReachFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetZsaszTowerMinimumScoreToReach_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -238,10 +291,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual float GetZsaszTowerMinimumScoreToReach()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszTowerMinimumScoreToReach", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetZsaszTowerMinimumScoreToReachFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszTowerMinimumScoreToReach", true);
+        var parms = new GetZsaszTowerMinimumScoreToReach_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetZsaszTowerActivationPeriodRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetZsaszTowerActivationPeriodRange_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -249,10 +309,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual float GetZsaszTowerActivationPeriodRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszTowerActivationPeriodRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetZsaszTowerActivationPeriodRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszTowerActivationPeriodRange", true);
+        var parms = new GetZsaszTowerActivationPeriodRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetZsaszTowerActivationMinPeriodFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetZsaszTowerActivationMinPeriod_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -260,10 +327,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual float GetZsaszTowerActivationMinPeriod()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszTowerActivationMinPeriod", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetZsaszTowerActivationMinPeriodFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszTowerActivationMinPeriod", true);
+        var parms = new GetZsaszTowerActivationMinPeriod_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetZsaszPercentAccumulatedPerSecondOnTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetZsaszPercentAccumulatedPerSecondOnTarget_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -271,10 +345,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual float GetZsaszPercentAccumulatedPerSecondOnTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszPercentAccumulatedPerSecondOnTarget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetZsaszPercentAccumulatedPerSecondOnTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszPercentAccumulatedPerSecondOnTarget", true);
+        var parms = new GetZsaszPercentAccumulatedPerSecondOnTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetZsaszInterTowerMovementPeriodFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetZsaszInterTowerMovementPeriod_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -282,10 +363,16 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual float GetZsaszInterTowerMovementPeriod()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszInterTowerMovementPeriod", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetZsaszInterTowerMovementPeriodFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszInterTowerMovementPeriod", true);
+        var parms = new GetZsaszInterTowerMovementPeriod_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DoTickZsaszFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoTickZsasz_Params
+    {
     }
 
     /// <summary>
@@ -293,105 +380,158 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void DoTickZsasz()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.DoTickZsasz", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoTickZsaszFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.DoTickZsasz", true);
+        var parms = new DoTickZsasz_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetZsaszTickEnabledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetZsaszTickEnabled_Params
+    {
+        [FieldOffset(0)] public int should_enable;
+    }
+
     /// <summary>
     /// Function: SetZsaszTickEnabled
     /// </summary>
     public unsafe virtual void SetZsaszTickEnabled(bool should_enable)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetZsaszTickEnabled", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(should_enable, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetZsaszTickEnabledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetZsaszTickEnabled", true);
+        var parms = new SetZsaszTickEnabled_Params();
+        parms.should_enable = should_enable ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRumbleFromFlashFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetRumbleFromFlash_Params
+    {
+        [FieldOffset(0)] public float left_rumble;
+        [FieldOffset(4)] public float right_rumble;
+    }
+
     /// <summary>
     /// Function: SetRumbleFromFlash
     /// </summary>
     public unsafe virtual void SetRumbleFromFlash(float left_rumble, float right_rumble)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetRumbleFromFlash", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(left_rumble, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(right_rumble, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRumbleFromFlashFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetRumbleFromFlash", true);
+        var parms = new SetRumbleFromFlash_Params();
+        parms.left_rumble = left_rumble;
+        parms.right_rumble = right_rumble;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMouseCursorEnabledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetMouseCursorEnabled_Params
+    {
+        [FieldOffset(0)] public int is_enabled;
+    }
+
     /// <summary>
     /// Function: SetMouseCursorEnabled
     /// </summary>
     public unsafe virtual void SetMouseCursorEnabled(bool is_enabled)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetMouseCursorEnabled", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_enabled, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMouseCursorEnabledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetMouseCursorEnabled", true);
+        var parms = new SetMouseCursorEnabled_Params();
+        parms.is_enabled = is_enabled ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreemptivelyBlockInputForMinigameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreemptivelyBlockInputForMinigame_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreemptivelyBlockInputForMinigame
     /// </summary>
     public unsafe virtual void PreemptivelyBlockInputForMinigame()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PreemptivelyBlockInputForMinigame", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreemptivelyBlockInputForMinigameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PreemptivelyBlockInputForMinigame", true);
+        var parms = new PreemptivelyBlockInputForMinigame_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetMousePositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ResetMousePosition_Params
+    {
+        [FieldOffset(0)] public float x_prop;
+        [FieldOffset(4)] public float y_prop;
+    }
+
     /// <summary>
     /// Function: ResetMousePosition
     /// </summary>
     public unsafe virtual void ResetMousePosition(float x_prop, float y_prop)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ResetMousePosition", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(x_prop, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(y_prop, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ResetMousePositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ResetMousePosition", true);
+        var parms = new ResetMousePosition_Params();
+        parms.x_prop = x_prop;
+        parms.y_prop = y_prop;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RiddlerSaveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RiddlerSave_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+        [FieldOffset(4)] public int IndexX;
+        [FieldOffset(8)] public int IndexY;
+    }
+
     /// <summary>
     /// Function: RiddlerSave
     /// </summary>
     public unsafe virtual void RiddlerSave(int LocIndex, int IndexX, int IndexY)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RiddlerSave", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IndexX, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IndexY, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RiddlerSaveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RiddlerSave", true);
+        var parms = new RiddlerSave_Params();
+        parms.LocIndex = LocIndex;
+        parms.IndexX = IndexX;
+        parms.IndexY = IndexY;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnlockRiddlerRowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 53)]
+    private struct UnlockRiddlerRow_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+        [FieldOffset(4)] public int RowIndex;
+        [FieldOffset(8)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: UnlockRiddlerRow
     /// </summary>
     public unsafe virtual BmSDK.FString UnlockRiddlerRow(int LocIndex, int RowIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.UnlockRiddlerRow", true);
-        byte* paramsPtr = stackalloc byte[53];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RowIndex, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 8);
+        var funcManaged = s_UnlockRiddlerRowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.UnlockRiddlerRow", true);
+        var parms = new UnlockRiddlerRow_Params();
+        parms.LocIndex = LocIndex;
+        parms.RowIndex = RowIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_PrepBatmanChallengeRequirementsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PrepBatmanChallengeRequirements_Params
+    {
     }
 
     /// <summary>
@@ -399,23 +539,39 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void PrepBatmanChallengeRequirements(out BmSDK.TArray<int> AreNotPossible)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PrepBatmanChallengeRequirements", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        AreNotPossible = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 0);
+        var funcManaged = s_PrepBatmanChallengeRequirementsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PrepBatmanChallengeRequirements", true);
+        var parms = new PrepBatmanChallengeRequirements_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        AreNotPossible = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_GetBatmanItemInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetBatmanItemInfo_Params
+    {
+        [FieldOffset(0)] public int InChallengeId;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetBatmanItemInfo
     /// </summary>
     public unsafe virtual BmSDK.FString GetBatmanItemInfo(int InChallengeId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetBatmanItemInfo", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InChallengeId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_GetBatmanItemInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetBatmanItemInfo", true);
+        var parms = new GetBatmanItemInfo_Params();
+        parms.InChallengeId = InChallengeId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetBatmanItemDetailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct GetBatmanItemDetails_Params
+    {
+        [FieldOffset(0)] public int InChallengeId;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -423,11 +579,18 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual BmSDK.FString GetBatmanItemDetails(int InChallengeId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetBatmanItemDetails", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InChallengeId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_GetBatmanItemDetailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetBatmanItemDetails", true);
+        var parms = new GetBatmanItemDetails_Params();
+        parms.InChallengeId = InChallengeId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ClearRiddlerNewLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ClearRiddlerNewLocation_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
     }
 
     /// <summary>
@@ -435,36 +598,60 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void ClearRiddlerNewLocation(int LocIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearRiddlerNewLocation", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearRiddlerNewLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearRiddlerNewLocation", true);
+        var parms = new ClearRiddlerNewLocation_Params();
+        parms.LocIndex = LocIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickOffRiddlerItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct TickOffRiddlerItem_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+        [FieldOffset(4)] public int ItemIndex;
+        [FieldOffset(8)] public int Value;
+    }
+
     /// <summary>
     /// Function: TickOffRiddlerItem
     /// </summary>
     public unsafe virtual void TickOffRiddlerItem(int LocIndex, int ItemIndex, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.TickOffRiddlerItem", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemIndex, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickOffRiddlerItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.TickOffRiddlerItem", true);
+        var parms = new TickOffRiddlerItem_Params();
+        parms.LocIndex = LocIndex;
+        parms.ItemIndex = ItemIndex;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CountRiddlerPercentGotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct CountRiddlerPercentGot_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: CountRiddlerPercentGot
     /// </summary>
     public unsafe virtual BmSDK.FString CountRiddlerPercentGot()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.CountRiddlerPercentGot", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_CountRiddlerPercentGotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.CountRiddlerPercentGot", true);
+        var parms = new CountRiddlerPercentGot_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_RequestRiddlerPageDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 96)]
+    private struct RequestRiddlerPageData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+        [FieldOffset(12)] public int LocIndex;
     }
 
     /// <summary>
@@ -472,57 +659,91 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void RequestRiddlerPageData(BmSDK.FString TargetPath, int LocIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestRiddlerPageData", true);
-        byte* paramsPtr = stackalloc byte[96];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestRiddlerPageDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestRiddlerPageData", true);
+        var parms = new RequestRiddlerPageData_Params();
+        parms.TargetPath = TargetPath;
+        parms.LocIndex = LocIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestRiddlerDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct RequestRiddlerData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: RequestRiddlerData
     /// </summary>
     public unsafe virtual void RequestRiddlerData(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestRiddlerData", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestRiddlerDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestRiddlerData", true);
+        var parms = new RequestRiddlerData_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OpenRiddlerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OpenRiddler_Params
+    {
+    }
+
     /// <summary>
     /// Function: OpenRiddler
     /// </summary>
     public unsafe virtual void OpenRiddler()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenRiddler", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OpenRiddlerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenRiddler", true);
+        var parms = new OpenRiddler_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearNewRingingPhoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearNewRingingPhone_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearNewRingingPhone
     /// </summary>
     public unsafe virtual void ClearNewRingingPhone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearNewRingingPhone", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearNewRingingPhoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearNewRingingPhone", true);
+        var parms = new ClearNewRingingPhone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsNewRingingPhoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsNewRingingPhone_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsNewRingingPhone
     /// </summary>
     public unsafe virtual bool IsNewRingingPhone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsNewRingingPhone", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsNewRingingPhoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsNewRingingPhone", true);
+        var parms = new IsNewRingingPhone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsZsaszRaceCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsZsaszRaceComplete_Params
+    {
+        [FieldOffset(0)] public int race_index;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -530,11 +751,18 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsZsaszRaceComplete(int race_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsZsaszRaceComplete", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(race_index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsZsaszRaceCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsZsaszRaceComplete", true);
+        var parms = new IsZsaszRaceComplete_Params();
+        parms.race_index = race_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetZsaszRingingPhoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetZsaszRingingPhone_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -542,10 +770,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual int GetZsaszRingingPhone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszRingingPhone", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetZsaszRingingPhoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszRingingPhone", true);
+        var parms = new GetZsaszRingingPhone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNumRacesCompletedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetNumRacesCompleted_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -553,10 +788,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual int GetNumRacesCompleted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetNumRacesCompleted", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetNumRacesCompletedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetNumRacesCompleted", true);
+        var parms = new GetNumRacesCompleted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetZsaszIntroSequenceDelayRemainingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetZsaszIntroSequenceDelayRemaining_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -564,10 +806,18 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual float GetZsaszIntroSequenceDelayRemaining()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszIntroSequenceDelayRemaining", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetZsaszIntroSequenceDelayRemainingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetZsaszIntroSequenceDelayRemaining", true);
+        var parms = new GetZsaszIntroSequenceDelayRemaining_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetCharacterPercentageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCharacterPercentage_Params
+    {
+        [FieldOffset(0)] public int CharacterIndex;
+        [FieldOffset(4)] public int PercentageValue;
     }
 
     /// <summary>
@@ -575,102 +825,163 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void SetCharacterPercentage(int CharacterIndex, int PercentageValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCharacterPercentage", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PercentageValue, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCharacterPercentageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCharacterPercentage", true);
+        var parms = new SetCharacterPercentage_Params();
+        parms.CharacterIndex = CharacterIndex;
+        parms.PercentageValue = PercentageValue;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCharacterProgressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCharacterProgress_Params
+    {
+        [FieldOffset(0)] public int CharacterIndex;
+        [FieldOffset(4)] public int ProgressValue;
+    }
+
     /// <summary>
     /// Function: SetCharacterProgress
     /// </summary>
     public unsafe virtual void SetCharacterProgress(int CharacterIndex, int ProgressValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCharacterProgress", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ProgressValue, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCharacterProgressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCharacterProgress", true);
+        var parms = new SetCharacterProgress_Params();
+        parms.CharacterIndex = CharacterIndex;
+        parms.ProgressValue = ProgressValue;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCharacterProgressTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCharacterProgressText_Params
+    {
+        [FieldOffset(0)] public int CharacterIndex;
+        [FieldOffset(4)] public int TextId;
+    }
+
     /// <summary>
     /// Function: SetCharacterProgressText
     /// </summary>
     public unsafe virtual void SetCharacterProgressText(int CharacterIndex, int TextId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCharacterProgressText", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextId, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCharacterProgressTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCharacterProgressText", true);
+        var parms = new SetCharacterProgressText_Params();
+        parms.CharacterIndex = CharacterIndex;
+        parms.TextId = TextId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCharacterSynopsisTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCharacterSynopsisText_Params
+    {
+        [FieldOffset(0)] public int CharacterIndex;
+        [FieldOffset(4)] public int TextId;
+    }
+
     /// <summary>
     /// Function: SetCharacterSynopsisText
     /// </summary>
     public unsafe virtual void SetCharacterSynopsisText(int CharacterIndex, int TextId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCharacterSynopsisText", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextId, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCharacterSynopsisTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCharacterSynopsisText", true);
+        var parms = new SetCharacterSynopsisText_Params();
+        parms.CharacterIndex = CharacterIndex;
+        parms.TextId = TextId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestProgressDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct RequestProgressData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: RequestProgressData
     /// </summary>
     public unsafe virtual void RequestProgressData(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestProgressData", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestProgressDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestProgressData", true);
+        var parms = new RequestProgressData_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetProgressCharacterListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetProgressCharacterList_Params
+    {
+        [FieldOffset(0)] public nint PData;
+        [FieldOffset(4)] public nint PShared;
+    }
+
     /// <summary>
     /// Function: GetProgressCharacterList
     /// </summary>
     public unsafe virtual void GetProgressCharacterList(BmSDK.BmGame.RPersistentData PData, BmSDK.BmGame.RPersistentShared PShared, out BmSDK.TArray<BmSDK.FString> CharList, out BmSDK.TArray<int> BioUnlockedList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetProgressCharacterList", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PData, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PShared, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        CharList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.FString>>(paramsPtr + 8);
-        BioUnlockedList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 20);
+        var funcManaged = s_GetProgressCharacterListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetProgressCharacterList", true);
+        var parms = new GetProgressCharacterList_Params();
+        parms.PData = PData?.Ptr ?? 0;
+        parms.PShared = PShared?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        CharList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.FString>>((byte*)&parms + 8);
+        BioUnlockedList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 20);
         return;
     }
 
+    static BmSDK.Function s_EnygmaSaveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct EnygmaSave_Params
+    {
+        [FieldOffset(0)] public int IndexLeft;
+        [FieldOffset(4)] public int IndexRight;
+    }
+
     /// <summary>
     /// Function: EnygmaSave
     /// </summary>
     public unsafe virtual void EnygmaSave(int IndexLeft, int IndexRight)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.EnygmaSave", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IndexLeft, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IndexRight, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnygmaSaveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.EnygmaSave", true);
+        var parms = new EnygmaSave_Params();
+        parms.IndexLeft = IndexLeft;
+        parms.IndexRight = IndexRight;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnygmaGotEnoughMsgDoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EnygmaGotEnoughMsgDone_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: EnygmaGotEnoughMsgDone
     /// </summary>
     public unsafe virtual bool EnygmaGotEnoughMsgDone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.EnygmaGotEnoughMsgDone", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_EnygmaGotEnoughMsgDoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.EnygmaGotEnoughMsgDone", true);
+        var parms = new EnygmaGotEnoughMsgDone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayEnygmaDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct PlayEnygmaDialogue_Params
+    {
+        [FieldOffset(0)] public int PlayId;
     }
 
     /// <summary>
@@ -678,35 +989,57 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void PlayEnygmaDialogue(int PlayId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayEnygmaDialogue", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayEnygmaDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayEnygmaDialogue", true);
+        var parms = new PlayEnygmaDialogue_Params();
+        parms.PlayId = PlayId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GuessRiddleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GuessRiddle_Params
+    {
+        [FieldOffset(0)] public int bCorrectGuess;
+        [FieldOffset(4)] public int RiddleId;
+    }
+
     /// <summary>
     /// Function: GuessRiddle
     /// </summary>
     public unsafe virtual void GuessRiddle(bool bCorrectGuess, int RiddleId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GuessRiddle", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCorrectGuess, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RiddleId, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GuessRiddleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GuessRiddle", true);
+        var parms = new GuessRiddle_Params();
+        parms.bCorrectGuess = bCorrectGuess ? 1 : 0;
+        parms.RiddleId = RiddleId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCooldownTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetCooldownTimer_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCooldownTimer
     /// </summary>
     public unsafe virtual float GetCooldownTimer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetCooldownTimer", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetCooldownTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetCooldownTimer", true);
+        var parms = new GetCooldownTimer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetEnygmaRiddleNumberFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetEnygmaRiddleNumber_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -714,10 +1047,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual int GetEnygmaRiddleNumber()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetEnygmaRiddleNumber", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetEnygmaRiddleNumberFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetEnygmaRiddleNumber", true);
+        var parms = new GetEnygmaRiddleNumber_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsEnygmaRiddleActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsEnygmaRiddleActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -725,10 +1065,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsEnygmaRiddleActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsEnygmaRiddleActive", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsEnygmaRiddleActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsEnygmaRiddleActive", true);
+        var parms = new IsEnygmaRiddleActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsEnygmaRiddleSolvedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsEnygmaRiddleSolved_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -736,10 +1083,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsEnygmaRiddleSolved()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsEnygmaRiddleSolved", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsEnygmaRiddleSolvedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsEnygmaRiddleSolved", true);
+        var parms = new IsEnygmaRiddleSolved_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RequestEnygmaDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct RequestEnygmaData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
     }
 
     /// <summary>
@@ -747,216 +1101,327 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void RequestEnygmaData(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestEnygmaData", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestEnygmaDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestEnygmaData", true);
+        var parms = new RequestEnygmaData_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OpenEnygmaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OpenEnygma_Params
+    {
+    }
+
     /// <summary>
     /// Function: OpenEnygma
     /// </summary>
     public unsafe virtual void OpenEnygma()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenEnygma", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OpenEnygmaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenEnygma", true);
+        var parms = new OpenEnygma_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LoadedBioPackageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LoadedBioPackage_Params
+    {
+    }
+
     /// <summary>
     /// Function: LoadedBioPackage
     /// </summary>
     public unsafe virtual void LoadedBioPackage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.LoadedBioPackage", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LoadedBioPackageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.LoadedBioPackage", true);
+        var parms = new LoadedBioPackage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LoadBioPackageSFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct LoadBioPackageSF_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString PackageName;
+        [FieldOffset(12)] public BmSDK.FString TheBioCallback;
+    }
+
     /// <summary>
     /// Function: LoadBioPackageSF
     /// </summary>
     public unsafe virtual void LoadBioPackageSF(BmSDK.FString PackageName, BmSDK.FString TheBioCallback)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.LoadBioPackageSF", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PackageName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheBioCallback, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_LoadBioPackageSFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.LoadBioPackageSF", true);
+        var parms = new LoadBioPackageSF_Params();
+        parms.PackageName = PackageName;
+        parms.TheBioCallback = TheBioCallback;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CancelBioPackagesSFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CancelBioPackagesSF_Params
+    {
+    }
+
     /// <summary>
     /// Function: CancelBioPackagesSF
     /// </summary>
     public unsafe virtual void CancelBioPackagesSF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.CancelBioPackagesSF", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_CancelBioPackagesSFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.CancelBioPackagesSF", true);
+        var parms = new CancelBioPackagesSF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BioSaveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct BioSave_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+        [FieldOffset(4)] public int Loc0Index;
+        [FieldOffset(8)] public int Loc1Index;
+        [FieldOffset(12)] public int Loc2Index;
+        [FieldOffset(16)] public int PageIndex;
+        [FieldOffset(20)] public int TapeIndex;
+    }
+
     /// <summary>
     /// Function: BioSave
     /// </summary>
     public unsafe virtual void BioSave(int LocIndex, int Loc0Index, int Loc1Index, int Loc2Index, int PageIndex, int TapeIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.BioSave", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Loc0Index, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Loc1Index, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Loc2Index, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PageIndex, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TapeIndex, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BioSaveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.BioSave", true);
+        var parms = new BioSave_Params();
+        parms.LocIndex = LocIndex;
+        parms.Loc0Index = Loc0Index;
+        parms.Loc1Index = Loc1Index;
+        parms.Loc2Index = Loc2Index;
+        parms.PageIndex = PageIndex;
+        parms.TapeIndex = TapeIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearCityStoryNewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearCityStoryNew_Params
+    {
+        [FieldOffset(0)] public int Index;
+    }
+
     /// <summary>
     /// Function: ClearCityStoryNew
     /// </summary>
     public unsafe virtual void ClearCityStoryNew(int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearCityStoryNew", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearCityStoryNewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearCityStoryNew", true);
+        var parms = new ClearCityStoryNew_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearBioNewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearBioNew_Params
+    {
+        [FieldOffset(0)] public int Index;
+    }
+
     /// <summary>
     /// Function: ClearBioNew
     /// </summary>
     public unsafe virtual void ClearBioNew(int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearBioNew", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearBioNewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearBioNew", true);
+        var parms = new ClearBioNew_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestBiosLocNewsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct RequestBiosLocNews_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: RequestBiosLocNews
     /// </summary>
     public unsafe virtual void RequestBiosLocNews(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestBiosLocNews", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestBiosLocNewsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestBiosLocNews", true);
+        var parms = new RequestBiosLocNews_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestBiosDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 116)]
+    private struct RequestBiosData_Params
+    {
+        [FieldOffset(0)] public int PageId;
+        [FieldOffset(4)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: RequestBiosData
     /// </summary>
     public unsafe virtual void RequestBiosData(int PageId, BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestBiosData", true);
-        byte* paramsPtr = stackalloc byte[116];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PageId, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestBiosDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestBiosData", true);
+        var parms = new RequestBiosData_Params();
+        parms.PageId = PageId;
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestBiosBaseDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct RequestBiosBaseData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: RequestBiosBaseData
     /// </summary>
     public unsafe virtual void RequestBiosBaseData(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestBiosBaseData", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestBiosBaseDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestBiosBaseData", true);
+        var parms = new RequestBiosBaseData_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetBioCharacterListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetBioCharacterList_Params
+    {
+    }
+
     /// <summary>
     /// Function: GetBioCharacterList
     /// </summary>
     public unsafe virtual void GetBioCharacterList(out BmSDK.TArray<BmSDK.FString> CharList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetBioCharacterList", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        CharList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.FString>>(paramsPtr + 0);
+        var funcManaged = s_GetBioCharacterListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetBioCharacterList", true);
+        var parms = new GetBioCharacterList_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        CharList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.FString>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_OpenBiosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct OpenBios_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EBioCharacter Bio_Character;
+        [FieldOffset(4)] public int PageId;
+        [FieldOffset(8)] public int TapeID;
+        [FieldOffset(12)] public int bAutoPlayTape;
+        [FieldOffset(16)] public int CityIndex;
+    }
+
     /// <summary>
     /// Function: OpenBios
     /// </summary>
     public unsafe virtual void OpenBios(BmSDK.BmGame.RPersistentData.EBioCharacter Bio_Character, int PageId, int TapeID, bool bAutoPlayTape, int CityIndex = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenBios", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bio_Character, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PageId, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TapeID, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAutoPlayTape, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CityIndex, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OpenBiosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenBios", true);
+        var parms = new OpenBios_Params();
+        parms.Bio_Character = Bio_Character;
+        parms.PageId = PageId;
+        parms.TapeID = TapeID;
+        parms.bAutoPlayTape = bAutoPlayTape ? 1 : 0;
+        parms.CityIndex = CityIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpgradeSaveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpgradeSave_Params
+    {
+        [FieldOffset(0)] public int CategoryIndex;
+        [FieldOffset(4)] public int ItemIndex;
+    }
+
     /// <summary>
     /// Function: UpgradeSave
     /// </summary>
     public unsafe virtual void UpgradeSave(int CategoryIndex, int ItemIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.UpgradeSave", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CategoryIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemIndex, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpgradeSaveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.UpgradeSave", true);
+        var parms = new UpgradeSave_Params();
+        parms.CategoryIndex = CategoryIndex;
+        parms.ItemIndex = ItemIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ToggleTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+        [FieldOffset(12)] public BmSDK.BmGame.RPersistentData.ETutorialType TutorialID;
+    }
+
     /// <summary>
     /// Function: ToggleTutorial
     /// </summary>
     public unsafe virtual void ToggleTutorial(BmSDK.FString ItemName, BmSDK.BmGame.RPersistentData.ETutorialType TutorialID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ToggleTutorial", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TutorialID, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ToggleTutorial", true);
+        var parms = new ToggleTutorial_Params();
+        parms.ItemName = ItemName;
+        parms.TutorialID = TutorialID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsTutorialEnabledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct IsTutorialEnabled_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+        [FieldOffset(12)] public BmSDK.BmGame.RPersistentData.ETutorialType TutorialID;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsTutorialEnabled
     /// </summary>
     public unsafe virtual bool IsTutorialEnabled(BmSDK.FString ItemName, BmSDK.BmGame.RPersistentData.ETutorialType TutorialID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsTutorialEnabled", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TutorialID, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_IsTutorialEnabledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsTutorialEnabled", true);
+        var parms = new IsTutorialEnabled_Params();
+        parms.ItemName = ItemName;
+        parms.TutorialID = TutorialID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UnlockUpgradeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct UnlockUpgrade_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+        [FieldOffset(12)] public BmSDK.BmGame.RPersistentData.ETutorialType TutorialID;
+        [FieldOffset(16)] public int bIsCatwomanUpgrade;
     }
 
     /// <summary>
@@ -964,56 +1429,79 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void UnlockUpgrade(BmSDK.FString ItemName, BmSDK.BmGame.RPersistentData.ETutorialType TutorialID, bool bIsCatwomanUpgrade)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.UnlockUpgrade", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TutorialID, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsCatwomanUpgrade, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockUpgradeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.UnlockUpgrade", true);
+        var parms = new UnlockUpgrade_Params();
+        parms.ItemName = ItemName;
+        parms.TutorialID = TutorialID;
+        parms.bIsCatwomanUpgrade = bIsCatwomanUpgrade ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearUpgradeNewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearUpgradeNew_Params
+    {
+        [FieldOffset(0)] public int Index;
+    }
+
     /// <summary>
     /// Function: ClearUpgradeNew
     /// </summary>
     public unsafe virtual void ClearUpgradeNew(int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearUpgradeNew", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearUpgradeNewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.ClearUpgradeNew", true);
+        var parms = new ClearUpgradeNew_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestUpgradeScoreDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct RequestUpgradeScoreData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: RequestUpgradeScoreData
     /// </summary>
     public unsafe virtual void RequestUpgradeScoreData(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestUpgradeScoreData", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestUpgradeScoreDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestUpgradeScoreData", true);
+        var parms = new RequestUpgradeScoreData_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetXPNeededStrFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetXPNeededStr_Params
+    {
+        [FieldOffset(0)] public int XPNeeded;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetXPNeededStr
     /// </summary>
     public unsafe virtual BmSDK.FString GetXPNeededStr(int XPNeeded)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetXPNeededStr", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XPNeeded, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_GetXPNeededStrFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetXPNeededStr", true);
+        var parms = new GetXPNeededStr_Params();
+        parms.XPNeeded = XPNeeded;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_RequestUpgradeItemsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 200)]
+    private struct RequestUpgradeItems_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+        [FieldOffset(12)] public int CategoryId;
     }
 
     /// <summary>
@@ -1021,59 +1509,95 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void RequestUpgradeItems(BmSDK.FString TargetPath, int CategoryId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestUpgradeItems", true);
-        byte* paramsPtr = stackalloc byte[200];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CategoryId, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestUpgradeItemsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestUpgradeItems", true);
+        var parms = new RequestUpgradeItems_Params();
+        parms.TargetPath = TargetPath;
+        parms.CategoryId = CategoryId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestUpgradeDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct RequestUpgradeData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: RequestUpgradeData
     /// </summary>
     public unsafe virtual void RequestUpgradeData(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestUpgradeData", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestUpgradeDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestUpgradeData", true);
+        var parms = new RequestUpgradeData_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OpenUpgradesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OpenUpgrades_Params
+    {
+    }
+
     /// <summary>
     /// Function: OpenUpgrades
     /// </summary>
     public unsafe virtual void OpenUpgrades()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenUpgrades", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OpenUpgradesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenUpgrades", true);
+        var parms = new OpenUpgrades_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetStickAngMagFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetStickAngMag_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetBasePath;
+    }
+
     /// <summary>
     /// Function: GetStickAngMag
     /// </summary>
     public unsafe virtual void GetStickAngMag(BmSDK.FString TargetBasePath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetStickAngMag", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBasePath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GetStickAngMagFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetStickAngMag", true);
+        var parms = new GetStickAngMag_Params();
+        parms.TargetBasePath = TargetBasePath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCameraRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetCameraRotation_Params
+    {
+        [FieldOffset(0)] public int Axis;
+        [FieldOffset(4)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCameraRotation
     /// </summary>
     public unsafe virtual float GetCameraRotation(int Axis)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetCameraRotation", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Axis, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetCameraRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetCameraRotation", true);
+        var parms = new GetCameraRotation_Params();
+        parms.Axis = Axis;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPlayerRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetPlayerRotation_Params
+    {
+        [FieldOffset(0)] public int Axis;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -1081,11 +1605,18 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual float GetPlayerRotation(int Axis)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetPlayerRotation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Axis, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetPlayerRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetPlayerRotation", true);
+        var parms = new GetPlayerRotation_Params();
+        parms.Axis = Axis;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPlayerRoomDescriptionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetPlayerRoomDescription_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -1093,10 +1624,17 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual BmSDK.FString GetPlayerRoomDescription()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetPlayerRoomDescription", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetPlayerRoomDescriptionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetPlayerRoomDescription", true);
+        var parms = new GetPlayerRoomDescription_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_StopMapIconDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct StopMapIconDialogue_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString IconName;
     }
 
     /// <summary>
@@ -1104,23 +1642,40 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void StopMapIconDialogue(BmSDK.FString IconName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.StopMapIconDialogue", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IconName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopMapIconDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.StopMapIconDialogue", true);
+        var parms = new StopMapIconDialogue_Params();
+        parms.IconName = IconName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayMapIconDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct PlayMapIconDialogue_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString IconName;
+        [FieldOffset(12)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: PlayMapIconDialogue
     /// </summary>
     public unsafe virtual BmSDK.FString PlayMapIconDialogue(BmSDK.FString IconName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayMapIconDialogue", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IconName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
+        var funcManaged = s_PlayMapIconDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayMapIconDialogue", true);
+        var parms = new PlayMapIconDialogue_Params();
+        parms.IconName = IconName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_RiddleNameCorrectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct RiddleNameCorrect_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+        [FieldOffset(12)] public BmSDK.FString InName;
+        [FieldOffset(24)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -1128,12 +1683,22 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual BmSDK.FString RiddleNameCorrect(BmSDK.FString ItemName, BmSDK.FString InName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RiddleNameCorrect", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InName, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 24);
+        var funcManaged = s_RiddleNameCorrectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RiddleNameCorrect", true);
+        var parms = new RiddleNameCorrect_Params();
+        parms.ItemName = ItemName;
+        parms.InName = InName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetCustomWaypointSideStoryInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 84)]
+    private struct SetCustomWaypointSideStoryInfo_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString SS_Character;
+        [FieldOffset(12)] public BmSDK.FString VisibleFlag;
+        [FieldOffset(24)] public BmSDK.FString DoneFlag;
+        [FieldOffset(36)] public BmSDK.FString StatesNew;
     }
 
     /// <summary>
@@ -1141,93 +1706,151 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void SetCustomWaypointSideStoryInfo(BmSDK.FString SS_Character, BmSDK.FString VisibleFlag, BmSDK.FString DoneFlag, BmSDK.FString StatesNew)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCustomWaypointSideStoryInfo", true);
-        byte* paramsPtr = stackalloc byte[84];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SS_Character, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VisibleFlag, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DoneFlag, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StatesNew, paramsPtr + 36);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCustomWaypointSideStoryInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCustomWaypointSideStoryInfo", true);
+        var parms = new SetCustomWaypointSideStoryInfo_Params();
+        parms.SS_Character = SS_Character;
+        parms.VisibleFlag = VisibleFlag;
+        parms.DoneFlag = DoneFlag;
+        parms.StatesNew = StatesNew;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCustomWaypointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct SetCustomWaypoint_Params
+    {
+        [FieldOffset(0)] public int bEnabled;
+        [FieldOffset(4)] public float atX;
+        [FieldOffset(8)] public float atY;
+        [FieldOffset(12)] public float atZ;
+        [FieldOffset(16)] public BmSDK.FString WayPointName;
+        [FieldOffset(28)] public BmSDK.FString WayPointTypeName;
+        [FieldOffset(40)] public BmSDK.FString WayPointSubTypeName;
+    }
+
     /// <summary>
     /// Function: SetCustomWaypoint
     /// </summary>
     public unsafe virtual void SetCustomWaypoint(bool bEnabled, float atX, float atY, float atZ, BmSDK.FString WayPointName, BmSDK.FString WayPointTypeName, BmSDK.FString WayPointSubTypeName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCustomWaypoint", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnabled, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(atX, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(atY, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(atZ, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WayPointName, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WayPointTypeName, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WayPointSubTypeName, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCustomWaypointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetCustomWaypoint", true);
+        var parms = new SetCustomWaypoint_Params();
+        parms.bEnabled = bEnabled ? 1 : 0;
+        parms.atX = atX;
+        parms.atY = atY;
+        parms.atZ = atZ;
+        parms.WayPointName = WayPointName;
+        parms.WayPointTypeName = WayPointTypeName;
+        parms.WayPointSubTypeName = WayPointSubTypeName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveMapObjFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RemoveMapObj_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: RemoveMapObj
     /// </summary>
     public unsafe virtual void RemoveMapObj(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RemoveMapObj", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveMapObjFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RemoveMapObj", true);
+        var parms = new RemoveMapObj_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MapSaveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MapSave_Params
+    {
+        [FieldOffset(0)] public int DBIndex;
+    }
+
     /// <summary>
     /// Function: MapSave
     /// </summary>
     public unsafe virtual void MapSave(int DBIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.MapSave", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DBIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MapSaveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.MapSave", true);
+        var parms = new MapSave_Params();
+        parms.DBIndex = DBIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FetchCWLootCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct FetchCWLootCount_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: FetchCWLootCount
     /// </summary>
     public unsafe virtual void FetchCWLootCount(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.FetchCWLootCount", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FetchCWLootCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.FetchCWLootCount", true);
+        var parms = new FetchCWLootCount_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FetchRiddlerSecretsCountsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct FetchRiddlerSecretsCounts_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+        [FieldOffset(12)] public BmSDK.FString MapName;
+    }
+
     /// <summary>
     /// Function: FetchRiddlerSecretsCounts
     /// </summary>
     public unsafe virtual void FetchRiddlerSecretsCounts(BmSDK.FString TargetPath, BmSDK.FString MapName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.FetchRiddlerSecretsCounts", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MapName, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FetchRiddlerSecretsCountsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.FetchRiddlerSecretsCounts", true);
+        var parms = new FetchRiddlerSecretsCounts_Params();
+        parms.TargetPath = TargetPath;
+        parms.MapName = MapName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForChapterSpecificRiddlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CheckForChapterSpecificRiddles_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckForChapterSpecificRiddles
     /// </summary>
     public unsafe virtual bool CheckForChapterSpecificRiddles(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.CheckForChapterSpecificRiddles", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_CheckForChapterSpecificRiddlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.CheckForChapterSpecificRiddles", true);
+        var parms = new CheckForChapterSpecificRiddles_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RequestPMapIconDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 144)]
+    private struct RequestPMapIconData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString MapName;
+        [FieldOffset(12)] public BmSDK.FString TargetBasePath;
     }
 
     /// <summary>
@@ -1235,84 +1858,133 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void RequestPMapIconData(BmSDK.FString MapName, BmSDK.FString TargetBasePath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestPMapIconData", true);
-        byte* paramsPtr = stackalloc byte[144];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MapName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBasePath, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestPMapIconDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestPMapIconData", true);
+        var parms = new RequestPMapIconData_Params();
+        parms.MapName = MapName;
+        parms.TargetBasePath = TargetBasePath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestMapFlagDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct RequestMapFlagData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetBasePath;
+    }
+
     /// <summary>
     /// Function: RequestMapFlagData
     /// </summary>
     public unsafe virtual void RequestMapFlagData(BmSDK.FString TargetBasePath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestMapFlagData", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBasePath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestMapFlagDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestMapFlagData", true);
+        var parms = new RequestMapFlagData_Params();
+        parms.TargetBasePath = TargetBasePath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestCriminalDBDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct RequestCriminalDBData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: RequestCriminalDBData
     /// </summary>
     public unsafe virtual void RequestCriminalDBData(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestCriminalDBData", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestCriminalDBDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestCriminalDBData", true);
+        var parms = new RequestCriminalDBData_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestMapDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 80)]
+    private struct RequestMapData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetBasePath;
+    }
+
     /// <summary>
     /// Function: RequestMapData
     /// </summary>
     public unsafe virtual void RequestMapData(BmSDK.FString TargetBasePath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestMapData", true);
-        byte* paramsPtr = stackalloc byte[80];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBasePath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestMapDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestMapData", true);
+        var parms = new RequestMapData_Params();
+        parms.TargetBasePath = TargetBasePath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestObjectiveDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct RequestObjectiveData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetObjectiveNames;
+    }
+
     /// <summary>
     /// Function: RequestObjectiveData
     /// </summary>
     public unsafe virtual void RequestObjectiveData(BmSDK.FString TargetObjectiveNames)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestObjectiveData", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetObjectiveNames, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestObjectiveDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestObjectiveData", true);
+        var parms = new RequestObjectiveData_Params();
+        parms.TargetObjectiveNames = TargetObjectiveNames;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OpenMapFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OpenMap_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TheMapScript;
+    }
+
     /// <summary>
     /// Function: OpenMap
     /// </summary>
     public unsafe virtual void OpenMap(BmSDK.FString TheMapScript)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenMap", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheMapScript, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OpenMapFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OpenMap", true);
+        var parms = new OpenMap_Params();
+        parms.TheMapScript = TheMapScript;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestBackScreenDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct RequestBackScreenData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetPath;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: RequestBackScreenData
     /// </summary>
     public unsafe virtual int RequestBackScreenData(BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestBackScreenData", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 12);
+        var funcManaged = s_RequestBackScreenDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.RequestBackScreenData", true);
+        var parms = new RequestBackScreenData_Params();
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DestroyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Destroy_Params
+    {
     }
 
     /// <summary>
@@ -1320,39 +1992,51 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void Destroy()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.Destroy", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.Destroy", true);
+        var parms = new Destroy_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnClosedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct OnClosed_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnClosed
     /// </summary>
     public unsafe virtual void OnClosed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OnClosed", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnClosedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OnClosed", true);
+        var parms = new OnClosed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPlayingBiosPackageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetPlayingBiosPackage_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetPlayingBiosPackage
     /// </summary>
     public unsafe virtual BmSDK.FString GetPlayingBiosPackage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetPlayingBiosPackage", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetPlayingBiosPackageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.GetPlayingBiosPackage", true);
+        var parms = new GetPlayingBiosPackage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_PlayTapeFinishedCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayTapeFinishedCallback_Params
+    {
     }
 
     /// <summary>
@@ -1360,97 +2044,143 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe override void PlayTapeFinishedCallback()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayTapeFinishedCallback", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayTapeFinishedCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PlayTapeFinishedCallback", true);
+        var parms = new PlayTapeFinishedCallback_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSubtitleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetSubtitle_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TheText;
+    }
+
     /// <summary>
     /// Function: SetSubtitle
     /// </summary>
     public unsafe override void SetSubtitle(BmSDK.FString TheText)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetSubtitle", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheText, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSubtitleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetSubtitle", true);
+        var parms = new SetSubtitle_Params();
+        parms.TheText = TheText;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnTick_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnTick
     /// </summary>
     public unsafe virtual void OnTick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OnTick", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.OnTick", true);
+        var parms = new OnTick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PromptClickedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PromptClicked_Params
+    {
+        [FieldOffset(0)] public int PromptId;
+    }
+
     /// <summary>
     /// Function: PromptClicked
     /// </summary>
     public unsafe virtual void PromptClicked(int PromptId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PromptClicked", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PromptId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PromptClickedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.PromptClicked", true);
+        var parms = new PromptClicked_Params();
+        parms.PromptId = PromptId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StoreVariablesToPDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StoreVariablesToPData_Params
+    {
+    }
+
     /// <summary>
     /// Function: StoreVariablesToPData
     /// </summary>
     public unsafe virtual void StoreVariablesToPData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.StoreVariablesToPData", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StoreVariablesToPDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.StoreVariablesToPData", true);
+        var parms = new StoreVariablesToPData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetVariablesFromPDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetVariablesFromPData_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetVariablesFromPData
     /// </summary>
     public unsafe virtual void SetVariablesFromPData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetVariablesFromPData", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetVariablesFromPDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.SetVariablesFromPData", true);
+        var parms = new SetVariablesFromPData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint LocPlay;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.Engine.LocalPlayer LocPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.Init", true);
+        var parms = new Init_Params();
+        parms.LocPlay = LocPlay?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsRiddleActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsRiddleActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsRiddleActive
     /// </summary>
     public unsafe virtual bool IsRiddleActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsRiddleActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsRiddleActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsRiddleActive", true);
+        var parms = new IsRiddleActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsTelephoneActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsTelephoneActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1458,17 +2188,16 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual bool IsTelephoneActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsTelephoneActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsTelephoneActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.IsTelephoneActive", true);
+        var parms = new IsTelephoneActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TickTapePlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TickTapePlayer_Params
+    {
     }
 
     /// <summary>
@@ -1476,16 +2205,9 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe virtual void TickTapePlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.TickTapePlayer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_TickTapePlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieBackScreen.TickTapePlayer", true);
+        var parms = new TickTapePlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -1539,8 +2261,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter MapCriminalDBIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 556); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -1548,8 +2270,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter ProgressCharacter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 557); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 557); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 557); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 557) = value; }
     }
 
     /// <summary>
@@ -1557,8 +2279,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe byte RiddlerLocIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 558); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 558); }
+        get { return *(byte*)(Ptr + 558); }
+        set { *(byte*)(Ptr + 558) = value; }
     }
 
     /// <summary>
@@ -1566,8 +2288,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe byte RiddlerIndexX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 559); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 559); }
+        get { return *(byte*)(Ptr + 559); }
+        set { *(byte*)(Ptr + 559) = value; }
     }
 
     /// <summary>
@@ -1575,8 +2297,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe byte RiddlerIndexY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 560); }
+        get { return *(byte*)(Ptr + 560); }
+        set { *(byte*)(Ptr + 560) = value; }
     }
 
     /// <summary>
@@ -1584,8 +2306,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.BmGame.RGFxMovieBackScreen.BackScreenType SelectedScreen
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGFxMovieBackScreen.BackScreenType>(Ptr + 561); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 561); }
+        get { return *(BmSDK.BmGame.RGFxMovieBackScreen.BackScreenType*)(Ptr + 561); }
+        set { *(BmSDK.BmGame.RGFxMovieBackScreen.BackScreenType*)(Ptr + 561) = value; }
     }
 
     /// <summary>
@@ -1593,8 +2315,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.BmGame.RGFxMovieBackScreen.RiddleLoadingStatus RiddlerStatus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGFxMovieBackScreen.RiddleLoadingStatus>(Ptr + 562); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 562); }
+        get { return *(BmSDK.BmGame.RGFxMovieBackScreen.RiddleLoadingStatus*)(Ptr + 562); }
+        set { *(BmSDK.BmGame.RGFxMovieBackScreen.RiddleLoadingStatus*)(Ptr + 562) = value; }
     }
 
     /// <summary>
@@ -1620,8 +2342,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bMovedUserMarker
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 1; else *(int*)(Ptr + 588) &= ~1; }
     }
 
     /// <summary>
@@ -1629,8 +2351,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool BioAutoSelect
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 2; else *(int*)(Ptr + 588) &= ~2; }
     }
 
     /// <summary>
@@ -1638,8 +2360,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool BiobAutoPlay
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 4; else *(int*)(Ptr + 588) &= ~4; }
     }
 
     /// <summary>
@@ -1647,8 +2369,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bEnygmaClosePending
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 8; else *(int*)(Ptr + 588) &= ~8; }
     }
 
     /// <summary>
@@ -1656,8 +2378,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool RumbleActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 16; else *(int*)(Ptr + 588) &= ~16; }
     }
 
     /// <summary>
@@ -1665,8 +2387,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bManualOpen
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 32; else *(int*)(Ptr + 588) &= ~32; }
     }
 
     /// <summary>
@@ -1674,8 +2396,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bSaveGameWhenClosed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 64; else *(int*)(Ptr + 588) &= ~64; }
     }
 
     /// <summary>
@@ -1683,8 +2405,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool TickRiddler
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 128; else *(int*)(Ptr + 588) &= ~128; }
     }
 
     /// <summary>
@@ -1692,8 +2414,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool TickZsasz
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 256; else *(int*)(Ptr + 588) &= ~256; }
     }
 
     /// <summary>
@@ -1701,8 +2423,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool ZsaszPhoneActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 512; else *(int*)(Ptr + 588) &= ~512; }
     }
 
     /// <summary>
@@ -1710,8 +2432,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe bool ZsaszPhoneBlockedBySystemUI
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 1024; else *(int*)(Ptr + 588) &= ~1024; }
     }
 
     /// <summary>
@@ -1728,8 +2450,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe int UpgradeCategoryIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 604); }
+        get { return *(int*)(Ptr + 604); }
+        set { *(int*)(Ptr + 604) = value; }
     }
 
     /// <summary>
@@ -1737,8 +2459,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe int UpgradeItemIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 608); }
+        get { return *(int*)(Ptr + 608); }
+        set { *(int*)(Ptr + 608) = value; }
     }
 
     /// <summary>
@@ -1746,8 +2468,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe int BioLocIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 612); }
+        get { return *(int*)(Ptr + 612); }
+        set { *(int*)(Ptr + 612) = value; }
     }
 
     /// <summary>
@@ -1764,8 +2486,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe int BioPageId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 628); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 628); }
+        get { return *(int*)(Ptr + 628); }
+        set { *(int*)(Ptr + 628) = value; }
     }
 
     /// <summary>
@@ -1773,8 +2495,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe int BioTapeId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 632); }
+        get { return *(int*)(Ptr + 632); }
+        set { *(int*)(Ptr + 632) = value; }
     }
 
     /// <summary>
@@ -1800,8 +2522,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe int EnygmaIndexLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 660); }
+        get { return *(int*)(Ptr + 660); }
+        set { *(int*)(Ptr + 660) = value; }
     }
 
     /// <summary>
@@ -1809,8 +2531,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe int EnygmaIndexRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 664); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 664); }
+        get { return *(int*)(Ptr + 664); }
+        set { *(int*)(Ptr + 664) = value; }
     }
 
     /// <summary>
@@ -1818,8 +2540,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe float FlashRumbleValueLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 668); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 668); }
+        get { return *(float*)(Ptr + 668); }
+        set { *(float*)(Ptr + 668) = value; }
     }
 
     /// <summary>
@@ -1827,8 +2549,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe float FlashRumbleValueRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 672); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 672); }
+        get { return *(float*)(Ptr + 672); }
+        set { *(float*)(Ptr + 672) = value; }
     }
 
     /// <summary>
@@ -1890,8 +2612,8 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
     /// </summary>
     public unsafe int RiddleToPlay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 732); }
+        get { return *(int*)(Ptr + 732); }
+        set { *(int*)(Ptr + 732) = value; }
     }
 
     /// <summary>
@@ -1921,11 +2643,7 @@ public partial class RGFxMovieBackScreen : BmSDK.BmGame.RGFxMovie, BmSDK.IGameOb
         /// <summary>
         /// ByteProperty: Id
         /// </summary>
-        public unsafe BmSDK.BmGame.RHUDPrompt.EControlIcon Id
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RHUDPrompt.EControlIcon>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RHUDPrompt.EControlIcon Id;
 
         /// <summary>
         /// StrProperty: Label
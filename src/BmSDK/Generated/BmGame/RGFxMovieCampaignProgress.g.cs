@@ -78,43 +78,74 @@ public partial class RGFxMovieCampaignProgress : BmSDK.BmGame.RGFxMovie, BmSDK.I
         where TComponent : class, Framework.IScriptComponent<RGFxMovieCampaignProgress>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetCampaignCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetCampaignComplete_Params
+    {
+        [FieldOffset(0)] public int CampaignComplete;
+        [FieldOffset(4)] public int TotalMedals;
+        [FieldOffset(8)] public int MaxMedals;
+        [FieldOffset(12)] public int PreviousBest;
+    }
+
     /// <summary>
     /// Function: SetCampaignComplete
     /// </summary>
     public unsafe virtual void SetCampaignComplete(bool CampaignComplete, int TotalMedals, int MaxMedals, int PreviousBest)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SetCampaignComplete", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CampaignComplete, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TotalMedals, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxMedals, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PreviousBest, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCampaignCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SetCampaignComplete", true);
+        var parms = new SetCampaignComplete_Params();
+        parms.CampaignComplete = CampaignComplete ? 1 : 0;
+        parms.TotalMedals = TotalMedals;
+        parms.MaxMedals = MaxMedals;
+        parms.PreviousBest = PreviousBest;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CampaignCompleteAutoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CampaignCompleteAuto_Params
+    {
+        [FieldOffset(0)] public int CurrentRoundComplete;
+    }
+
     /// <summary>
     /// Function: CampaignCompleteAuto
     /// </summary>
     public unsafe virtual void CampaignCompleteAuto(bool CurrentRoundComplete)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.CampaignCompleteAuto", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentRoundComplete, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CampaignCompleteAutoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.CampaignCompleteAuto", true);
+        var parms = new CampaignCompleteAuto_Params();
+        parms.CurrentRoundComplete = CurrentRoundComplete ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetTotalMedalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetTotalMedals_Params
+    {
+        [FieldOffset(0)] public nint ChalMan;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetTotalMedals
     /// </summary>
     public unsafe virtual int GetTotalMedals(BmSDK.BmGame.RChallengeManager ChalMan)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.GetTotalMedals", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChalMan, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetTotalMedalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.GetTotalMedals", true);
+        var parms = new GetTotalMedals_Params();
+        parms.ChalMan = ChalMan?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_FreeRetryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FreeRetry_Params
+    {
     }
 
     /// <summary>
@@ -122,83 +153,133 @@ public partial class RGFxMovieCampaignProgress : BmSDK.BmGame.RGFxMovie, BmSDK.I
     /// </summary>
     public unsafe virtual void FreeRetry()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.FreeRetry", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FreeRetryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.FreeRetry", true);
+        var parms = new FreeRetry_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpendRetryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpendRetry_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpendRetry
     /// </summary>
     public unsafe virtual void SpendRetry()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SpendRetry", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpendRetryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SpendRetry", true);
+        var parms = new SpendRetry_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BankPlusMedalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BankPlusMedals_Params
+    {
+    }
+
     /// <summary>
     /// Function: BankPlusMedals
     /// </summary>
     public unsafe virtual void BankPlusMedals()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.BankPlusMedals", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BankPlusMedalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.BankPlusMedals", true);
+        var parms = new BankPlusMedals_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPlusMedalCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetPlusMedalCount_Params
+    {
+        [FieldOffset(0)] public int new_count;
+    }
+
     /// <summary>
     /// Function: SetPlusMedalCount
     /// </summary>
     public unsafe virtual void SetPlusMedalCount(int new_count)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SetPlusMedalCount", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_count, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPlusMedalCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SetPlusMedalCount", true);
+        var parms = new SetPlusMedalCount_Params();
+        parms.new_count = new_count;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRoundInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetRoundInfo_Params
+    {
+        [FieldOffset(0)] public int round_index;
+        [FieldOffset(4)] public int map_index;
+        [FieldOffset(8)] public int medals_earned;
+    }
+
     /// <summary>
     /// Function: SetRoundInfo
     /// </summary>
     public unsafe virtual void SetRoundInfo(int round_index, int map_index, int medals_earned)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SetRoundInfo", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(round_index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(map_index, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(medals_earned, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRoundInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SetRoundInfo", true);
+        var parms = new SetRoundInfo_Params();
+        parms.round_index = round_index;
+        parms.map_index = map_index;
+        parms.medals_earned = medals_earned;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCampaignInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCampaignInfo_Params
+    {
+        [FieldOffset(0)] public int curr_round;
+        [FieldOffset(4)] public int total_retries;
+    }
+
     /// <summary>
     /// Function: SetCampaignInfo
     /// </summary>
     public unsafe virtual void SetCampaignInfo(int curr_round, int total_retries)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SetCampaignInfo", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(curr_round, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(total_retries, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCampaignInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.SetCampaignInfo", true);
+        var parms = new SetCampaignInfo_Params();
+        parms.curr_round = curr_round;
+        parms.total_retries = total_retries;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRoundMedalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetRoundMedals_Params
+    {
+        [FieldOffset(0)] public int round_index;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRoundMedals
     /// </summary>
     public unsafe virtual int GetRoundMedals(int round_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.GetRoundMedals", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(round_index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetRoundMedalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.GetRoundMedals", true);
+        var parms = new GetRoundMedals_Params();
+        parms.round_index = round_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_RequestCampaignInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RequestCampaignInfo_Params
+    {
     }
 
     /// <summary>
@@ -206,102 +287,155 @@ public partial class RGFxMovieCampaignProgress : BmSDK.BmGame.RGFxMovie, BmSDK.I
     /// </summary>
     public unsafe virtual void RequestCampaignInfo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.RequestCampaignInfo", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestCampaignInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.RequestCampaignInfo", true);
+        var parms = new RequestCampaignInfo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnCloseHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnCloseHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnCloseHUD
     /// </summary>
     public unsafe virtual void OnCloseHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.OnCloseHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnCloseHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.OnCloseHUD", true);
+        var parms = new OnCloseHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CloseScreen_Params
+    {
+    }
+
     /// <summary>
     /// Function: CloseScreen
     /// </summary>
     public unsafe virtual void CloseScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.CloseScreen", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.CloseScreen", true);
+        var parms = new CloseScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Hide_Params
+    {
+    }
+
     /// <summary>
     /// Function: Hide
     /// </summary>
     public unsafe virtual void Hide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.Hide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.Hide", true);
+        var parms = new Hide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_showFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct show_Params
+    {
+        [FieldOffset(0)] public int Mode;
+    }
+
     /// <summary>
     /// Function: show
     /// </summary>
     public unsafe virtual void show(int Mode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.show", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Mode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_showFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.show", true);
+        var parms = new show_Params();
+        parms.Mode = Mode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HideItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: HideItem
     /// </summary>
     public unsafe virtual void HideItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.HideItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.HideItem", true);
+        var parms = new HideItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShowItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: ShowItem
     /// </summary>
     public unsafe virtual void ShowItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.ShowItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.ShowItem", true);
+        var parms = new ShowItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KismetControlsInOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct KismetControlsInOut_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: KismetControlsInOut
     /// </summary>
     public unsafe virtual void KismetControlsInOut(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.KismetControlsInOut", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KismetControlsInOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.KismetControlsInOut", true);
+        var parms = new KismetControlsInOut_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint LocPlay;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.Engine.LocalPlayer LocPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieCampaignProgress.Init", true);
+        var parms = new Init_Params();
+        parms.LocPlay = LocPlay?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
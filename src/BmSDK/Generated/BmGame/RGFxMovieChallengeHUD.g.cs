@@ -78,82 +78,132 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
         where TComponent : class, Framework.IScriptComponent<RGFxMovieChallengeHUD>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_RequestH2HCombatDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RequestH2HCombatData_Params
+    {
+    }
+
     /// <summary>
     /// Function: RequestH2HCombatData
     /// </summary>
     public unsafe virtual void RequestH2HCombatData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestH2HCombatData", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestH2HCombatDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestH2HCombatData", true);
+        var parms = new RequestH2HCombatData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowH2HCombatCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowH2HCombatComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowH2HCombatComplete
     /// </summary>
     public unsafe virtual void ShowH2HCombatComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowH2HCombatComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowH2HCombatCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowH2HCombatComplete", true);
+        var parms = new ShowH2HCombatComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StatsContinueNoWaitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StatsContinueNoWait_Params
+    {
+    }
+
     /// <summary>
     /// Function: StatsContinueNoWait
     /// </summary>
     public unsafe virtual void StatsContinueNoWait()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.StatsContinueNoWait", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StatsContinueNoWaitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.StatsContinueNoWait", true);
+        var parms = new StatsContinueNoWait_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StatsWaitFurtherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StatsWaitFurther_Params
+    {
+    }
+
     /// <summary>
     /// Function: StatsWaitFurther
     /// </summary>
     public unsafe virtual void StatsWaitFurther()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.StatsWaitFurther", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StatsWaitFurtherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.StatsWaitFurther", true);
+        var parms = new StatsWaitFurther_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Error_StatsTimeOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Error_StatsTimeOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: Error_StatsTimeOut
     /// </summary>
     public unsafe virtual void Error_StatsTimeOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.Error_StatsTimeOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Error_StatsTimeOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.Error_StatsTimeOut", true);
+        var parms = new Error_StatsTimeOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerSaveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TriggerSave_Params
+    {
+        [FieldOffset(0)] public int bToMemoryOnly;
+    }
+
     /// <summary>
     /// Function: TriggerSave
     /// </summary>
     public unsafe virtual void TriggerSave(bool bToMemoryOnly)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.TriggerSave", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bToMemoryOnly, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerSaveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.TriggerSave", true);
+        var parms = new TriggerSave_Params();
+        parms.bToMemoryOnly = bToMemoryOnly ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsWritingStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsWritingStats_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsWritingStats
     /// </summary>
     public unsafe virtual bool IsWritingStats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.IsWritingStats", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsWritingStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.IsWritingStats", true);
+        var parms = new IsWritingStats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ChallengeYRetryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ChallengeYRetry_Params
+    {
     }
 
     /// <summary>
@@ -161,202 +211,319 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe virtual void ChallengeYRetry()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ChallengeYRetry", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChallengeYRetryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ChallengeYRetry", true);
+        var parms = new ChallengeYRetry_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestEnduranceScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RequestEnduranceScore_Params
+    {
+    }
+
     /// <summary>
     /// Function: RequestEnduranceScore
     /// </summary>
     public unsafe virtual void RequestEnduranceScore()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestEnduranceScore", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestEnduranceScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestEnduranceScore", true);
+        var parms = new RequestEnduranceScore_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnduranceDoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnduranceDone_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnduranceDone
     /// </summary>
     public unsafe virtual void EnduranceDone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.EnduranceDone", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnduranceDoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.EnduranceDone", true);
+        var parms = new EnduranceDone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnduranceDoneCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnduranceDoneCallback_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnduranceDoneCallback
     /// </summary>
     public unsafe virtual void EnduranceDoneCallback()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.EnduranceDoneCallback", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnduranceDoneCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.EnduranceDoneCallback", true);
+        var parms = new EnduranceDoneCallback_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowEnduranceCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowEnduranceComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowEnduranceComplete
     /// </summary>
     public unsafe virtual void ShowEnduranceComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowEnduranceComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowEnduranceCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowEnduranceComplete", true);
+        var parms = new ShowEnduranceComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Flash_HandleStatsWriteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Flash_HandleStatsWrite_Params
+    {
+    }
+
     /// <summary>
     /// Function: Flash_HandleStatsWrite
     /// </summary>
     public unsafe virtual void Flash_HandleStatsWrite()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.Flash_HandleStatsWrite", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Flash_HandleStatsWriteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.Flash_HandleStatsWrite", true);
+        var parms = new Flash_HandleStatsWrite_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StoreCampaignProgressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct StoreCampaignProgress_Params
+    {
+    }
+
     /// <summary>
     /// Function: StoreCampaignProgress
     /// </summary>
     public unsafe virtual void StoreCampaignProgress()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.StoreCampaignProgress", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StoreCampaignProgressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.StoreCampaignProgress", true);
+        var parms = new StoreCampaignProgress_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PredatorGoalsClosedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PredatorGoalsClosed_Params
+    {
+    }
+
     /// <summary>
     /// Function: PredatorGoalsClosed
     /// </summary>
     public unsafe virtual void PredatorGoalsClosed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PredatorGoalsClosed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PredatorGoalsClosedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PredatorGoalsClosed", true);
+        var parms = new PredatorGoalsClosed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClosePredatorChallengeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClosePredatorChallenge_Params
+    {
+        [FieldOffset(0)] public int bAltF4;
+    }
+
     /// <summary>
     /// Function: ClosePredatorChallenge
     /// </summary>
     public unsafe virtual void ClosePredatorChallenge(bool bAltF4)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ClosePredatorChallenge", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAltF4, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClosePredatorChallengeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ClosePredatorChallenge", true);
+        var parms = new ClosePredatorChallenge_Params();
+        parms.bAltF4 = bAltF4 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PredatorWinDoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PredatorWinDone_Params
+    {
+    }
+
     /// <summary>
     /// Function: PredatorWinDone
     /// </summary>
     public unsafe virtual void PredatorWinDone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PredatorWinDone", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PredatorWinDoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PredatorWinDone", true);
+        var parms = new PredatorWinDone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PredatorWinDoneCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PredatorWinDoneCallback_Params
+    {
+    }
+
     /// <summary>
     /// Function: PredatorWinDoneCallback
     /// </summary>
     public unsafe virtual void PredatorWinDoneCallback()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PredatorWinDoneCallback", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PredatorWinDoneCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PredatorWinDoneCallback", true);
+        var parms = new PredatorWinDoneCallback_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestPredatorDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct RequestPredatorData_Params
+    {
+    }
+
     /// <summary>
     /// Function: RequestPredatorData
     /// </summary>
     public unsafe virtual void RequestPredatorData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestPredatorData", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestPredatorDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestPredatorData", true);
+        var parms = new RequestPredatorData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowPredatorWonFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowPredatorWon_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowPredatorWon
     /// </summary>
     public unsafe virtual void ShowPredatorWon()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowPredatorWon", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowPredatorWonFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowPredatorWon", true);
+        var parms = new ShowPredatorWon_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendPredatorGoalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SendPredatorGoals_Params
+    {
+        [FieldOffset(0)] public int bTickOff;
+    }
+
     /// <summary>
     /// Function: SendPredatorGoals
     /// </summary>
     public unsafe virtual void SendPredatorGoals(bool bTickOff)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendPredatorGoals", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTickOff, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendPredatorGoalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendPredatorGoals", true);
+        var parms = new SendPredatorGoals_Params();
+        parms.bTickOff = bTickOff ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePredatorHUDGoalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpdatePredatorHUDGoals_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdatePredatorHUDGoals
     /// </summary>
     public unsafe virtual void UpdatePredatorHUDGoals()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.UpdatePredatorHUDGoals", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdatePredatorHUDGoalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.UpdatePredatorHUDGoals", true);
+        var parms = new UpdatePredatorHUDGoals_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableClientsideClockFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableClientsideClock_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableClientsideClock
     /// </summary>
     public unsafe virtual void EnableClientsideClock()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.EnableClientsideClock", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableClientsideClockFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.EnableClientsideClock", true);
+        var parms = new EnableClientsideClock_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPredatorTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetPredatorTimer_Params
+    {
+        [FieldOffset(0)] public float NewValue;
+        [FieldOffset(4)] public int ShowOnHud;
+    }
+
     /// <summary>
     /// Function: SetPredatorTimer
     /// </summary>
     public unsafe virtual void SetPredatorTimer(float NewValue, bool ShowOnHud = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetPredatorTimer", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewValue, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ShowOnHud, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPredatorTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetPredatorTimer", true);
+        var parms = new SetPredatorTimer_Params();
+        parms.NewValue = NewValue;
+        parms.ShowOnHud = ShowOnHud ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AchievedGoalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AchievedGoal_Params
+    {
+        [FieldOffset(0)] public int GoalIndex;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AchievedGoal
     /// </summary>
     public unsafe virtual bool AchievedGoal(int GoalIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.AchievedGoal", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GoalIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_AchievedGoalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.AchievedGoal", true);
+        var parms = new AchievedGoal_Params();
+        parms.GoalIndex = GoalIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetGoalGAsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 3)]
+    private struct SetGoalGAs_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EGameAction GoalGA1;
+        [FieldOffset(1)] public BmSDK.BmGame.RGameInfo.EGameAction GoalGA2;
+        [FieldOffset(2)] public BmSDK.BmGame.RGameInfo.EGameAction GoalGA3;
     }
 
     /// <summary>
@@ -364,25 +531,39 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe virtual void SetGoalGAs(BmSDK.BmGame.RGameInfo.EGameAction GoalGA1, BmSDK.BmGame.RGameInfo.EGameAction GoalGA2, BmSDK.BmGame.RGameInfo.EGameAction GoalGA3)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetGoalGAs", true);
-        byte* paramsPtr = stackalloc byte[3];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GoalGA1, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GoalGA2, paramsPtr + 1);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GoalGA3, paramsPtr + 2);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetGoalGAsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetGoalGAs", true);
+        var parms = new SetGoalGAs_Params();
+        parms.GoalGA1 = GoalGA1;
+        parms.GoalGA2 = GoalGA2;
+        parms.GoalGA3 = GoalGA3;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetGoalIDFromGAFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetGoalIDFromGA_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EGameAction GA;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetGoalIDFromGA
     /// </summary>
     public unsafe virtual int GetGoalIDFromGA(BmSDK.BmGame.RGameInfo.EGameAction GA)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.GetGoalIDFromGA", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GA, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetGoalIDFromGAFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.GetGoalIDFromGA", true);
+        var parms = new GetGoalIDFromGA_Params();
+        parms.GA = GA;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_WaveCompletedDoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct WaveCompletedDone_Params
+    {
     }
 
     /// <summary>
@@ -390,119 +571,195 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe virtual void WaveCompletedDone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.WaveCompletedDone", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WaveCompletedDoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.WaveCompletedDone", true);
+        var parms = new WaveCompletedDone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WaveCompleteDoneCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct WaveCompleteDoneCallback_Params
+    {
+    }
+
     /// <summary>
     /// Function: WaveCompleteDoneCallback
     /// </summary>
     public unsafe virtual void WaveCompleteDoneCallback()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.WaveCompleteDoneCallback", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WaveCompleteDoneCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.WaveCompleteDoneCallback", true);
+        var parms = new WaveCompleteDoneCallback_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestWaveDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RequestWaveData_Params
+    {
+    }
+
     /// <summary>
     /// Function: RequestWaveData
     /// </summary>
     public unsafe virtual void RequestWaveData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestWaveData", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestWaveDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestWaveData", true);
+        var parms = new RequestWaveData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendWaveDataP2Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SendWaveDataP2_Params
+    {
+        [FieldOffset(0)] public int WaveNumber;
+        [FieldOffset(4)] public int Score;
+        [FieldOffset(8)] public int Variation;
+        [FieldOffset(12)] public int inVariationBonus;
+        [FieldOffset(16)] public int WaveBonus;
+        [FieldOffset(20)] public int EndlessBonus;
+        [FieldOffset(24)] public int ChallengeBonus;
+        [FieldOffset(28)] public int Medal;
+        [FieldOffset(32)] public int GadgetVariation;
+        [FieldOffset(36)] public int GadgetVariationBonus;
+    }
+
     /// <summary>
     /// Function: SendWaveDataP2
     /// </summary>
     public unsafe virtual void SendWaveDataP2(int WaveNumber, int Score, int Variation, int inVariationBonus, int WaveBonus, int EndlessBonus, int ChallengeBonus, int Medal, int GadgetVariation, int GadgetVariationBonus)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendWaveDataP2", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WaveNumber, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Score, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Variation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inVariationBonus, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WaveBonus, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndlessBonus, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeBonus, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Medal, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetVariation, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetVariationBonus, paramsPtr + 36);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendWaveDataP2Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendWaveDataP2", true);
+        var parms = new SendWaveDataP2_Params();
+        parms.WaveNumber = WaveNumber;
+        parms.Score = Score;
+        parms.Variation = Variation;
+        parms.inVariationBonus = inVariationBonus;
+        parms.WaveBonus = WaveBonus;
+        parms.EndlessBonus = EndlessBonus;
+        parms.ChallengeBonus = ChallengeBonus;
+        parms.Medal = Medal;
+        parms.GadgetVariation = GadgetVariation;
+        parms.GadgetVariationBonus = GadgetVariationBonus;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendWaveDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SendWaveData_Params
+    {
+        [FieldOffset(0)] public int WaveNumber;
+        [FieldOffset(4)] public int Score;
+        [FieldOffset(8)] public int Variation;
+        [FieldOffset(12)] public int inVariationBonus;
+        [FieldOffset(16)] public int WaveBonus;
+        [FieldOffset(20)] public int EndlessBonus;
+        [FieldOffset(24)] public int ChallengeBonus;
+        [FieldOffset(28)] public int Medal;
+        [FieldOffset(32)] public int GadgetVariation;
+        [FieldOffset(36)] public int GadgetVariationBonus;
+    }
+
     /// <summary>
     /// Function: SendWaveData
     /// </summary>
     public unsafe virtual void SendWaveData(int WaveNumber, int Score, int Variation, int inVariationBonus, int WaveBonus, int EndlessBonus, int ChallengeBonus, int Medal, int GadgetVariation, int GadgetVariationBonus)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendWaveData", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WaveNumber, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Score, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Variation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inVariationBonus, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WaveBonus, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndlessBonus, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeBonus, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Medal, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetVariation, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetVariationBonus, paramsPtr + 36);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendWaveDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendWaveData", true);
+        var parms = new SendWaveData_Params();
+        parms.WaveNumber = WaveNumber;
+        parms.Score = Score;
+        parms.Variation = Variation;
+        parms.inVariationBonus = inVariationBonus;
+        parms.WaveBonus = WaveBonus;
+        parms.EndlessBonus = EndlessBonus;
+        parms.ChallengeBonus = ChallengeBonus;
+        parms.Medal = Medal;
+        parms.GadgetVariation = GadgetVariation;
+        parms.GadgetVariationBonus = GadgetVariationBonus;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetKeyListenerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetKeyListener_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetKeyListener
     /// </summary>
     public unsafe virtual void ResetKeyListener()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ResetKeyListener", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetKeyListenerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ResetKeyListener", true);
+        var parms = new ResetKeyListener_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCurrentRoundMedalCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCurrentRoundMedalCount_Params
+    {
+        [FieldOffset(0)] public int num_medals;
+    }
+
     /// <summary>
     /// Function: SetCurrentRoundMedalCount
     /// </summary>
     public unsafe virtual void SetCurrentRoundMedalCount(int num_medals)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCurrentRoundMedalCount", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(num_medals, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCurrentRoundMedalCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCurrentRoundMedalCount", true);
+        var parms = new SetCurrentRoundMedalCount_Params();
+        parms.num_medals = num_medals;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BankPlusMedalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BankPlusMedals_Params
+    {
+    }
+
     /// <summary>
     /// Function: BankPlusMedals
     /// </summary>
     public unsafe virtual void BankPlusMedals()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.BankPlusMedals", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BankPlusMedalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.BankPlusMedals", true);
+        var parms = new BankPlusMedals_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldWaitForCampaignResultsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShouldWaitForCampaignResults_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldWaitForCampaignResults
     /// </summary>
     public unsafe virtual bool ShouldWaitForCampaignResults()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShouldWaitForCampaignResults", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldWaitForCampaignResultsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShouldWaitForCampaignResults", true);
+        var parms = new ShouldWaitForCampaignResults_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CallCampaignRestartFunctionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CallCampaignRestartFunction_Params
+    {
     }
 
     /// <summary>
@@ -510,270 +767,427 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe virtual void CallCampaignRestartFunction()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.CallCampaignRestartFunction", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CallCampaignRestartFunctionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.CallCampaignRestartFunction", true);
+        var parms = new CallCampaignRestartFunction_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PopupRequester_CallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PopupRequester_Callback_Params
+    {
+        [FieldOffset(0)] public nint ThePopUpMsg;
+        [FieldOffset(4)] public int ButtonId;
+    }
+
     /// <summary>
     /// Function: PopupRequester_Callback
     /// </summary>
     public unsafe override void PopupRequester_Callback(BmSDK.BmGame.RGFxMoviePopupRequester ThePopUpMsg, int ButtonId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PopupRequester_Callback", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThePopUpMsg, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ButtonId, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PopupRequester_CallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PopupRequester_Callback", true);
+        var parms = new PopupRequester_Callback_Params();
+        parms.ThePopUpMsg = ThePopUpMsg?.Ptr ?? 0;
+        parms.ButtonId = ButtonId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowRestartPopupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShowRestartPopup_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ASCallbackFunction;
+    }
+
     /// <summary>
     /// Function: ShowRestartPopup
     /// </summary>
     public unsafe virtual void ShowRestartPopup(BmSDK.FString ASCallbackFunction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowRestartPopup", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ASCallbackFunction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowRestartPopupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowRestartPopup", true);
+        var parms = new ShowRestartPopup_Params();
+        parms.ASCallbackFunction = ASCallbackFunction;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetFreeMedalActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetFreeMedalActive_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetFreeMedalActive
     /// </summary>
     public unsafe virtual void SetFreeMedalActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetFreeMedalActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetFreeMedalActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetFreeMedalActive", true);
+        var parms = new SetFreeMedalActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerFinalWavePromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerFinalWavePrompt_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerFinalWavePrompt
     /// </summary>
     public unsafe virtual void TriggerFinalWavePrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.TriggerFinalWavePrompt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerFinalWavePromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.TriggerFinalWavePrompt", true);
+        var parms = new TriggerFinalWavePrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowWaveCompleteMultiFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowWaveCompleteMulti_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowWaveCompleteMulti
     /// </summary>
     public unsafe virtual void ShowWaveCompleteMulti()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowWaveCompleteMulti", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowWaveCompleteMultiFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowWaveCompleteMulti", true);
+        var parms = new ShowWaveCompleteMulti_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowWaveCompleteMultiTriggerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowWaveCompleteMultiTrigger_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowWaveCompleteMultiTrigger
     /// </summary>
     public unsafe virtual void ShowWaveCompleteMultiTrigger()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowWaveCompleteMultiTrigger", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowWaveCompleteMultiTriggerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowWaveCompleteMultiTrigger", true);
+        var parms = new ShowWaveCompleteMultiTrigger_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowWaveCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowWaveComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowWaveComplete
     /// </summary>
     public unsafe virtual void ShowWaveComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowWaveComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowWaveCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowWaveComplete", true);
+        var parms = new ShowWaveComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowWaveCompleteTriggerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowWaveCompleteTrigger_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowWaveCompleteTrigger
     /// </summary>
     public unsafe virtual void ShowWaveCompleteTrigger()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowWaveCompleteTrigger", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowWaveCompleteTriggerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowWaveCompleteTrigger", true);
+        var parms = new ShowWaveCompleteTrigger_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideCombatGoalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideCombatGoals_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideCombatGoals
     /// </summary>
     public unsafe virtual void HideCombatGoals()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.HideCombatGoals", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideCombatGoalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.HideCombatGoals", true);
+        var parms = new HideCombatGoals_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCombatGoalsModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCombatGoalsMode_Params
+    {
+        [FieldOffset(0)] public int is_game;
+    }
+
     /// <summary>
     /// Function: SetCombatGoalsMode
     /// </summary>
     public unsafe virtual void SetCombatGoalsMode(bool is_game)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCombatGoalsMode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_game, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCombatGoalsModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCombatGoalsMode", true);
+        var parms = new SetCombatGoalsMode_Params();
+        parms.is_game = is_game ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowPersonalBestPrivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowPersonalBestPrivate_Params
+    {
+        [FieldOffset(0)] public int TypeIsPersonalBest;
+    }
+
     /// <summary>
     /// Function: ShowPersonalBestPrivate
     /// </summary>
     public unsafe virtual void ShowPersonalBestPrivate(bool TypeIsPersonalBest)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowPersonalBestPrivate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TypeIsPersonalBest, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowPersonalBestPrivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowPersonalBestPrivate", true);
+        var parms = new ShowPersonalBestPrivate_Params();
+        parms.TypeIsPersonalBest = TypeIsPersonalBest ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowPersonalBestFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowPersonalBest_Params
+    {
+        [FieldOffset(0)] public int bLeaderboard;
+    }
+
     /// <summary>
     /// Function: ShowPersonalBest
     /// </summary>
     public unsafe virtual void ShowPersonalBest(bool bLeaderboard)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowPersonalBest", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLeaderboard, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowPersonalBestFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowPersonalBest", true);
+        var parms = new ShowPersonalBest_Params();
+        parms.bLeaderboard = bLeaderboard ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearPrompts_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearPrompts
     /// </summary>
     public unsafe virtual void ClearPrompts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ClearPrompts", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ClearPrompts", true);
+        var parms = new ClearPrompts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetPrompt_Params
+    {
+        [FieldOffset(0)] public int Id;
+        [FieldOffset(4)] public BmSDK.FString Label;
+    }
+
     /// <summary>
     /// Function: SetPrompt
     /// </summary>
     public unsafe virtual void SetPrompt(int Id, BmSDK.FString Label)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetPrompt", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Label, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetPrompt", true);
+        var parms = new SetPrompt_Params();
+        parms.Id = Id;
+        parms.Label = Label;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChallengeRetryUIFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ChallengeRetryUI_Params
+    {
+    }
+
     /// <summary>
     /// Function: ChallengeRetryUI
     /// </summary>
     public unsafe virtual void ChallengeRetryUI()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ChallengeRetryUI", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChallengeRetryUIFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ChallengeRetryUI", true);
+        var parms = new ChallengeRetryUI_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowLostFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowLost_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowLost
     /// </summary>
     public unsafe virtual void ShowLost()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowLost", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowLostFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowLost", true);
+        var parms = new ShowLost_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetChallengeStatsColumnsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetChallengeStatsColumns_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Title1;
+        [FieldOffset(12)] public BmSDK.FString Title2;
+    }
+
     /// <summary>
     /// Function: SetChallengeStatsColumns
     /// </summary>
     public unsafe virtual void SetChallengeStatsColumns(BmSDK.FString Title1, BmSDK.FString Title2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetChallengeStatsColumns", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Title1, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Title2, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetChallengeStatsColumnsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetChallengeStatsColumns", true);
+        var parms = new SetChallengeStatsColumns_Params();
+        parms.Title1 = Title1;
+        parms.Title2 = Title2;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendChallengeStatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct SendChallengeStat_Params
+    {
+        [FieldOffset(0)] public int player_index;
+        [FieldOffset(4)] public int stat_index;
+        [FieldOffset(8)] public BmSDK.FString stat_name;
+        [FieldOffset(20)] public BmSDK.FString stat_value;
+        [FieldOffset(32)] public int stat_param;
+    }
+
     /// <summary>
     /// Function: SendChallengeStat
     /// </summary>
     public unsafe virtual void SendChallengeStat(int player_index, int stat_index, BmSDK.FString stat_name, BmSDK.FString stat_value, int stat_param)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendChallengeStat", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(player_index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(stat_index, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(stat_name, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(stat_value, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(stat_param, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendChallengeStatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendChallengeStat", true);
+        var parms = new SendChallengeStat_Params();
+        parms.player_index = player_index;
+        parms.stat_index = stat_index;
+        parms.stat_name = stat_name;
+        parms.stat_value = stat_value;
+        parms.stat_param = stat_param;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNumChallengeStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetNumChallengeStats_Params
+    {
+        [FieldOffset(0)] public int num_stats;
+    }
+
     /// <summary>
     /// Function: SetNumChallengeStats
     /// </summary>
     public unsafe virtual void SetNumChallengeStats(int num_stats)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetNumChallengeStats", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(num_stats, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNumChallengeStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetNumChallengeStats", true);
+        var parms = new SetNumChallengeStats_Params();
+        parms.num_stats = num_stats;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetChallengeStatsTypeIsCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetChallengeStatsTypeIsCombat_Params
+    {
+        [FieldOffset(0)] public int is_combat;
+    }
+
     /// <summary>
     /// Function: SetChallengeStatsTypeIsCombat
     /// </summary>
     public unsafe virtual void SetChallengeStatsTypeIsCombat(bool is_combat)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetChallengeStatsTypeIsCombat", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_combat, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetChallengeStatsTypeIsCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetChallengeStatsTypeIsCombat", true);
+        var parms = new SetChallengeStatsTypeIsCombat_Params();
+        parms.is_combat = is_combat ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestChallengeStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RequestChallengeStats_Params
+    {
+    }
+
     /// <summary>
     /// Function: RequestChallengeStats
     /// </summary>
     public unsafe virtual void RequestChallengeStats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestChallengeStats", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestChallengeStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.RequestChallengeStats", true);
+        var parms = new RequestChallengeStats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetTimeStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetTimeString_Params
+    {
+        [FieldOffset(0)] public int TimeNumber;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetTimeString
     /// </summary>
     public unsafe virtual BmSDK.FString GetTimeString(int TimeNumber)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.GetTimeString", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeNumber, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_GetTimeStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.GetTimeString", true);
+        var parms = new GetTimeString_Params();
+        parms.TimeNumber = TimeNumber;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_PublishChallengeStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PublishChallengeStats_Params
+    {
     }
 
     /// <summary>
@@ -781,366 +1195,582 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe virtual void PublishChallengeStats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PublishChallengeStats", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PublishChallengeStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.PublishChallengeStats", true);
+        var parms = new PublishChallengeStats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowSplitscreenLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowSplitscreenLine_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowSplitscreenLine
     /// </summary>
     public unsafe virtual void ShowSplitscreenLine(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowSplitscreenLine", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowSplitscreenLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowSplitscreenLine", true);
+        var parms = new ShowSplitscreenLine_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IntroDoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct IntroDone_Params
+    {
+    }
+
     /// <summary>
     /// Function: IntroDone
     /// </summary>
     public unsafe virtual void IntroDone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.IntroDone", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IntroDoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.IntroDone", true);
+        var parms = new IntroDone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IntroDoneCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IntroDoneCallback_Params
+    {
+    }
+
     /// <summary>
     /// Function: IntroDoneCallback
     /// </summary>
     public unsafe virtual void IntroDoneCallback()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.IntroDoneCallback", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IntroDoneCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.IntroDoneCallback", true);
+        var parms = new IntroDoneCallback_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetIntroTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetIntroText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+    }
+
     /// <summary>
     /// Function: SetIntroText
     /// </summary>
     public unsafe virtual void SetIntroText(BmSDK.FString Text)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetIntroText", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetIntroTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetIntroText", true);
+        var parms = new SetIntroText_Params();
+        parms.Text = Text;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowIntroFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowIntro_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowIntro
     /// </summary>
     public unsafe virtual void ShowIntro()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowIntro", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowIntroFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowIntro", true);
+        var parms = new ShowIntro_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EndWaveOrWinDisplayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EndWaveOrWinDisplay_Params
+    {
+    }
+
     /// <summary>
     /// Function: EndWaveOrWinDisplay
     /// </summary>
     public unsafe virtual void EndWaveOrWinDisplay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.EndWaveOrWinDisplay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EndWaveOrWinDisplayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.EndWaveOrWinDisplay", true);
+        var parms = new EndWaveOrWinDisplay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickPredatorItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TickPredatorItem_Params
+    {
+        [FieldOffset(0)] public int Id;
+    }
+
     /// <summary>
     /// Function: TickPredatorItem
     /// </summary>
     public unsafe virtual void TickPredatorItem(int Id)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.TickPredatorItem", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickPredatorItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.TickPredatorItem", true);
+        var parms = new TickPredatorItem_Params();
+        parms.Id = Id;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPredatorItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct AddPredatorItem_Params
+    {
+        [FieldOffset(0)] public int Id;
+        [FieldOffset(4)] public BmSDK.FString Description;
+    }
+
     /// <summary>
     /// Function: AddPredatorItem
     /// </summary>
     public unsafe virtual void AddPredatorItem(int Id, BmSDK.FString Description)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.AddPredatorItem", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Description, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPredatorItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.AddPredatorItem", true);
+        var parms = new AddPredatorItem_Params();
+        parms.Id = Id;
+        parms.Description = Description;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetGadgetsDisabledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetGadgetsDisabled_Params
+    {
+        [FieldOffset(0)] public int are_disabled;
+    }
+
     /// <summary>
     /// Function: SetGadgetsDisabled
     /// </summary>
     public unsafe virtual void SetGadgetsDisabled(bool are_disabled)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetGadgetsDisabled", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(are_disabled, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetGadgetsDisabledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetGadgetsDisabled", true);
+        var parms = new SetGadgetsDisabled_Params();
+        parms.are_disabled = are_disabled ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowGoalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowGoals_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowGoals
     /// </summary>
     public unsafe virtual void ShowGoals(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowGoals", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowGoalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowGoals", true);
+        var parms = new ShowGoals_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetTime_Params
+    {
+        [FieldOffset(0)] public float inTimeSecs;
+    }
+
     /// <summary>
     /// Function: SetTime
     /// </summary>
     public unsafe virtual void SetTime(float inTimeSecs)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetTime", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inTimeSecs, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetTime", true);
+        var parms = new SetTime_Params();
+        parms.inTimeSecs = inTimeSecs;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCombinedComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCombinedCombo_Params
+    {
+        [FieldOffset(0)] public int Value;
+        [FieldOffset(4)] public int bPowerUp;
+    }
+
     /// <summary>
     /// Function: SetCombinedCombo
     /// </summary>
     public unsafe virtual void SetCombinedCombo(int Value, bool bPowerUp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCombinedCombo", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPowerUp, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCombinedComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCombinedCombo", true);
+        var parms = new SetCombinedCombo_Params();
+        parms.Value = Value;
+        parms.bPowerUp = bPowerUp ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetCombo_Params
+    {
+        [FieldOffset(0)] public int ColourID;
+        [FieldOffset(4)] public int ComboNumber;
+        [FieldOffset(8)] public int ComboValue;
+        [FieldOffset(12)] public BmSDK.FString movename;
+    }
+
     /// <summary>
     /// Function: SetCombo
     /// </summary>
     public unsafe virtual void SetCombo(int ColourID, int ComboNumber, int ComboValue, BmSDK.FString movename)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCombo", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ColourID, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboNumber, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboValue, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(movename, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCombo", true);
+        var parms = new SetCombo_Params();
+        parms.ColourID = ColourID;
+        parms.ComboNumber = ComboNumber;
+        parms.ComboValue = ComboValue;
+        parms.movename = movename;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetScore_Params
+    {
+        [FieldOffset(0)] public int Score;
+    }
+
     /// <summary>
     /// Function: SetScore
     /// </summary>
     public unsafe virtual void SetScore(int Score)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetScore", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Score, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetScore", true);
+        var parms = new SetScore_Params();
+        parms.Score = Score;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCampaignProgressVisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCampaignProgressVisible_Params
+    {
+        [FieldOffset(0)] public int is_visible;
+    }
+
     /// <summary>
     /// Function: SetCampaignProgressVisible
     /// </summary>
     public unsafe virtual void SetCampaignProgressVisible(bool is_visible)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCampaignProgressVisible", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_visible, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCampaignProgressVisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetCampaignProgressVisible", true);
+        var parms = new SetCampaignProgressVisible_Params();
+        parms.is_visible = is_visible ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnCloseHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnCloseHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnCloseHUD
     /// </summary>
     public unsafe virtual void OnCloseHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.OnCloseHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnCloseHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.OnCloseHUD", true);
+        var parms = new OnCloseHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CloseScreen_Params
+    {
+    }
+
     /// <summary>
     /// Function: CloseScreen
     /// </summary>
     public unsafe virtual void CloseScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.CloseScreen", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.CloseScreen", true);
+        var parms = new CloseScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Hide_Params
+    {
+    }
+
     /// <summary>
     /// Function: Hide
     /// </summary>
     public unsafe virtual void Hide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.Hide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.Hide", true);
+        var parms = new Hide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_showFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct show_Params
+    {
+        [FieldOffset(0)] public int Mode;
+    }
+
     /// <summary>
     /// Function: show
     /// </summary>
     public unsafe virtual void show(int Mode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.show", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Mode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_showFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.show", true);
+        var parms = new show_Params();
+        parms.Mode = Mode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HideItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: HideItem
     /// </summary>
     public unsafe virtual void HideItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.HideItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.HideItem", true);
+        var parms = new HideItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShowItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: ShowItem
     /// </summary>
     public unsafe virtual void ShowItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowItem", true);
+        var parms = new ShowItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KismetControlsInOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct KismetControlsInOut_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: KismetControlsInOut
     /// </summary>
     public unsafe virtual void KismetControlsInOut(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.KismetControlsInOut", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KismetControlsInOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.KismetControlsInOut", true);
+        var parms = new KismetControlsInOut_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTickRealTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetTickRealTime_Params
+    {
+        [FieldOffset(0)] public int bRealTime;
+    }
+
     /// <summary>
     /// Function: SetTickRealTime
     /// </summary>
     public unsafe virtual void SetTickRealTime(bool bRealTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetTickRealTime", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bRealTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTickRealTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetTickRealTime", true);
+        var parms = new SetTickRealTime_Params();
+        parms.bRealTime = bRealTime ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint LocPlay;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.Engine.LocalPlayer LocPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.Init", true);
+        var parms = new Init_Params();
+        parms.LocPlay = LocPlay?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceFocusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForceFocus_Params
+    {
+        [FieldOffset(0)] public int GiveFocus;
+    }
+
     /// <summary>
     /// Function: ForceFocus
     /// </summary>
     public unsafe virtual void ForceFocus(bool GiveFocus)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ForceFocus", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GiveFocus, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceFocusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ForceFocus", true);
+        var parms = new ForceFocus_Params();
+        parms.GiveFocus = GiveFocus ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNumStarsSinglePlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetNumStarsSinglePlayer_Params
+    {
+        [FieldOffset(0)] public int num_stars;
+        [FieldOffset(4)] public int Snap;
+    }
+
     /// <summary>
     /// Function: SetNumStarsSinglePlayer
     /// </summary>
     public unsafe virtual void SetNumStarsSinglePlayer(int num_stars, bool Snap)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetNumStarsSinglePlayer", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(num_stars, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Snap, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNumStarsSinglePlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetNumStarsSinglePlayer", true);
+        var parms = new SetNumStarsSinglePlayer_Params();
+        parms.num_stars = num_stars;
+        parms.Snap = Snap ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPlayerControllerTimerVisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetPlayerControllerTimerVisible_Params
+    {
+        [FieldOffset(0)] public int bVis;
+    }
+
     /// <summary>
     /// Function: SetPlayerControllerTimerVisible
     /// </summary>
     public unsafe virtual void SetPlayerControllerTimerVisible(bool bVis)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetPlayerControllerTimerVisible", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVis, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPlayerControllerTimerVisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetPlayerControllerTimerVisible", true);
+        var parms = new SetPlayerControllerTimerVisible_Params();
+        parms.bVis = bVis ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideScore_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideScore
     /// </summary>
     public unsafe virtual void HideScore()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.HideScore", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.HideScore", true);
+        var parms = new HideScore_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowScore_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowScore
     /// </summary>
     public unsafe virtual void ShowScore()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowScore", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.ShowScore", true);
+        var parms = new ShowScore_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsFinalWaveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsFinalWave_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsFinalWave
     /// </summary>
     public unsafe virtual bool IsFinalWave()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.IsFinalWave", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsFinalWaveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.IsFinalWave", true);
+        var parms = new IsFinalWave_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetMedalScoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetMedalScores_Params
+    {
+        [FieldOffset(0)] public int NewBronzeScore;
+        [FieldOffset(4)] public int NewSilverScore;
+        [FieldOffset(8)] public int NewGoldScore;
     }
 
     /// <summary>
@@ -1148,70 +1778,108 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe virtual void SetMedalScores(int NewBronzeScore, int NewSilverScore, int NewGoldScore)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetMedalScores", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewBronzeScore, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSilverScore, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGoldScore, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMedalScoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetMedalScores", true);
+        var parms = new SetMedalScores_Params();
+        parms.NewBronzeScore = NewBronzeScore;
+        parms.NewSilverScore = NewSilverScore;
+        parms.NewGoldScore = NewGoldScore;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendMedalScoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SendMedalScores_Params
+    {
+        [FieldOffset(0)] public int NewBronzeScore;
+        [FieldOffset(4)] public int NewSilverScore;
+        [FieldOffset(8)] public int NewGoldScore;
+    }
+
     /// <summary>
     /// Function: SendMedalScores
     /// </summary>
     public unsafe virtual void SendMedalScores(int NewBronzeScore, int NewSilverScore, int NewGoldScore)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendMedalScores", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewBronzeScore, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSilverScore, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewGoldScore, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendMedalScoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SendMedalScores", true);
+        var parms = new SendMedalScores_Params();
+        parms.NewBronzeScore = NewBronzeScore;
+        parms.NewSilverScore = NewSilverScore;
+        parms.NewGoldScore = NewGoldScore;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddWaveInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct AddWaveInfo_Params
+    {
+        [FieldOffset(0)] public int Player;
+        [FieldOffset(4)] public int WaveScore;
+        [FieldOffset(8)] public int VariationScore;
+        [FieldOffset(12)] public int VariationCount;
+        [FieldOffset(16)] public int GadgetVariationScore;
+        [FieldOffset(20)] public int GadgetVariationCount;
+        [FieldOffset(24)] public int NoHitBonus;
+        [FieldOffset(28)] public int EndlessComboBonus;
+        [FieldOffset(32)] public int NeverHitBonus;
+    }
+
     /// <summary>
     /// Function: AddWaveInfo
     /// </summary>
     public unsafe virtual void AddWaveInfo(int Player, int WaveScore, int VariationScore, int VariationCount, int GadgetVariationScore, int GadgetVariationCount, int NoHitBonus, int EndlessComboBonus, int NeverHitBonus)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.AddWaveInfo", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WaveScore, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VariationScore, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VariationCount, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetVariationScore, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetVariationCount, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NoHitBonus, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndlessComboBonus, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NeverHitBonus, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddWaveInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.AddWaveInfo", true);
+        var parms = new AddWaveInfo_Params();
+        parms.Player = Player;
+        parms.WaveScore = WaveScore;
+        parms.VariationScore = VariationScore;
+        parms.VariationCount = VariationCount;
+        parms.GadgetVariationScore = GadgetVariationScore;
+        parms.GadgetVariationCount = GadgetVariationCount;
+        parms.NoHitBonus = NoHitBonus;
+        parms.EndlessComboBonus = EndlessComboBonus;
+        parms.NeverHitBonus = NeverHitBonus;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNumberOfWavesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetNumberOfWaves_Params
+    {
+        [FieldOffset(0)] public int NewNumberOfWaves;
+    }
+
     /// <summary>
     /// Function: SetNumberOfWaves
     /// </summary>
     public unsafe virtual void SetNumberOfWaves(int NewNumberOfWaves)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetNumberOfWaves", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewNumberOfWaves, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNumberOfWavesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetNumberOfWaves", true);
+        var parms = new SetNumberOfWaves_Params();
+        parms.NewNumberOfWaves = NewNumberOfWaves;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSubtitlesSuppressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSubtitlesSuppressed_Params
+    {
+        [FieldOffset(0)] public int Suppress;
+    }
+
     /// <summary>
     /// Function: SetSubtitlesSuppressed
     /// </summary>
     public unsafe virtual void SetSubtitlesSuppressed(bool Suppress)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetSubtitlesSuppressed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Suppress, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSubtitlesSuppressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeHUD.SetSubtitlesSuppressed", true);
+        var parms = new SetSubtitlesSuppressed_Params();
+        parms.Suppress = Suppress ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -1232,8 +1900,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe int NumberOfWaves
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(int*)(Ptr + 496); }
+        set { *(int*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -1241,8 +1909,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe int TotalScore
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(int*)(Ptr + 500); }
+        set { *(int*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -1331,8 +1999,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe int LastMedal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 612); }
+        get { return *(int*)(Ptr + 612); }
+        set { *(int*)(Ptr + 612) = value; }
     }
 
     /// <summary>
@@ -1340,8 +2008,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe int BronzeScore
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 616); }
+        get { return *(int*)(Ptr + 616); }
+        set { *(int*)(Ptr + 616) = value; }
     }
 
     /// <summary>
@@ -1349,8 +2017,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe int SilverScore
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 620); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 620); }
+        get { return *(int*)(Ptr + 620); }
+        set { *(int*)(Ptr + 620) = value; }
     }
 
     /// <summary>
@@ -1358,8 +2026,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe int GoldScore
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 624); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 624); }
+        get { return *(int*)(Ptr + 624); }
+        set { *(int*)(Ptr + 624) = value; }
     }
 
     /// <summary>
@@ -1385,8 +2053,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe float PredatorTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 652); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 652); }
+        get { return *(float*)(Ptr + 652); }
+        set { *(float*)(Ptr + 652) = value; }
     }
 
     /// <summary>
@@ -1394,8 +2062,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe bool bNoPause
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 656) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 656); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 656); }
+        get { return (*(int*)(Ptr + 656) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 656) |= 1; else *(int*)(Ptr + 656) &= ~1; }
     }
 
     /// <summary>
@@ -1403,8 +2071,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe bool SubtitlesWereOriginallyOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 656) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 656); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 656); }
+        get { return (*(int*)(Ptr + 656) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 656) |= 2; else *(int*)(Ptr + 656) &= ~2; }
     }
 
     /// <summary>
@@ -1421,8 +2089,8 @@ public partial class RGFxMovieChallengeHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.BmGame.RGFxMovieChallengeHUD.ChallengeModeEnum CurrentChallengeMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGFxMovieChallengeHUD.ChallengeModeEnum>(Ptr + 672); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 672); }
+        get { return *(BmSDK.BmGame.RGFxMovieChallengeHUD.ChallengeModeEnum*)(Ptr + 672); }
+        set { *(BmSDK.BmGame.RGFxMovieChallengeHUD.ChallengeModeEnum*)(Ptr + 672) = value; }
     }
 
     /// <summary>
@@ -78,61 +78,100 @@ public partial class RGFxMovieChallengeModifiers : BmSDK.BmGame.RGFxMovie, BmSDK
         where TComponent : class, Framework.IScriptComponent<RGFxMovieChallengeModifiers>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_OnFadeCompleted_CallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnFadeCompleted_Callback_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnFadeCompleted_Callback
     /// </summary>
     public unsafe override void OnFadeCompleted_Callback()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.OnFadeCompleted_Callback", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnFadeCompleted_CallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.OnFadeCompleted_Callback", true);
+        var parms = new OnFadeCompleted_Callback_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RefreshPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RefreshPrompts_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshPrompts
     /// </summary>
     public unsafe virtual void RefreshPrompts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.RefreshPrompts", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.RefreshPrompts", true);
+        var parms = new RefreshPrompts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CallAbortFunctionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CallAbortFunction_Params
+    {
+    }
+
     /// <summary>
     /// Function: CallAbortFunction
     /// </summary>
     public unsafe virtual void CallAbortFunction()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.CallAbortFunction", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CallAbortFunctionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.CallAbortFunction", true);
+        var parms = new CallAbortFunction_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PopupRequester_CallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PopupRequester_Callback_Params
+    {
+        [FieldOffset(0)] public nint ThePopUpMsg;
+        [FieldOffset(4)] public int ButtonId;
+    }
+
     /// <summary>
     /// Function: PopupRequester_Callback
     /// </summary>
     public unsafe override void PopupRequester_Callback(BmSDK.BmGame.RGFxMoviePopupRequester ThePopUpMsg, int ButtonId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.PopupRequester_Callback", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThePopUpMsg, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ButtonId, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PopupRequester_CallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.PopupRequester_Callback", true);
+        var parms = new PopupRequester_Callback_Params();
+        parms.ThePopUpMsg = ThePopUpMsg?.Ptr ?? 0;
+        parms.ButtonId = ButtonId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_IsCatwomanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FE_IsCatwoman_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FE_IsCatwoman
     /// </summary>
     public unsafe virtual bool FE_IsCatwoman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.FE_IsCatwoman", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_FE_IsCatwomanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.FE_IsCatwoman", true);
+        var parms = new FE_IsCatwoman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShowAbortPopupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowAbortPopup_Params
+    {
     }
 
     /// <summary>
@@ -140,223 +179,346 @@ public partial class RGFxMovieChallengeModifiers : BmSDK.BmGame.RGFxMovie, BmSDK
     /// </summary>
     public unsafe virtual void ShowAbortPopup()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.ShowAbortPopup", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowAbortPopupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.ShowAbortPopup", true);
+        var parms = new ShowAbortPopup_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetGoalTitlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct GetGoalTitles_Params
+    {
+        [FieldOffset(0)] public int Round;
+        [FieldOffset(4)] public BmSDK.FString TargetPath;
+    }
+
     /// <summary>
     /// Function: GetGoalTitles
     /// </summary>
     public unsafe virtual void GetGoalTitles(int Round, BmSDK.FString TargetPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.GetGoalTitles", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Round, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPath, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GetGoalTitlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.GetGoalTitles", true);
+        var parms = new GetGoalTitles_Params();
+        parms.Round = Round;
+        parms.TargetPath = TargetPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetChallengeDetailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetChallengeDetails_Params
+    {
+        [FieldOffset(0)] public int ChallengeIndex;
+        [FieldOffset(4)] public int CurrentRound;
+    }
+
     /// <summary>
     /// Function: SetChallengeDetails
     /// </summary>
     public unsafe virtual void SetChallengeDetails(int ChallengeIndex, int CurrentRound)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetChallengeDetails", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentRound, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetChallengeDetailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetChallengeDetails", true);
+        var parms = new SetChallengeDetails_Params();
+        parms.ChallengeIndex = ChallengeIndex;
+        parms.CurrentRound = CurrentRound;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRankedInstructionsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SetRankedInstructions_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetRankedInstructions
     /// </summary>
     public unsafe virtual void SetRankedInstructions(BmSDK.TArray<BmSDK.FString> RankedInstructionsText)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetRankedInstructions", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RankedInstructionsText, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRankedInstructionsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetRankedInstructions", true);
+        var parms = new SetRankedInstructions_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(RankedInstructionsText, (byte*)&parms + 0);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNumModifiersAvailableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetNumModifiersAvailable_Params
+    {
+        [FieldOffset(0)] public int NumAvailable;
+    }
+
     /// <summary>
     /// Function: SetNumModifiersAvailable
     /// </summary>
     public unsafe virtual void SetNumModifiersAvailable(int NumAvailable)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetNumModifiersAvailable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NumAvailable, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNumModifiersAvailableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetNumModifiersAvailable", true);
+        var parms = new SetNumModifiersAvailable_Params();
+        parms.NumAvailable = NumAvailable;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishedSyncFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinishedSync_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinishedSync
     /// </summary>
     public unsafe virtual void FinishedSync()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.FinishedSync", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishedSyncFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.FinishedSync", true);
+        var parms = new FinishedSync_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NoteEntryUsedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NoteEntryUsed_Params
+    {
+        [FieldOffset(0)] public int entry_index;
+    }
+
     /// <summary>
     /// Function: NoteEntryUsed
     /// </summary>
     public unsafe virtual void NoteEntryUsed(int entry_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.NoteEntryUsed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(entry_index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NoteEntryUsedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.NoteEntryUsed", true);
+        var parms = new NoteEntryUsed_Params();
+        parms.entry_index = entry_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddTileEntryAutoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddTileEntryAuto_Params
+    {
+        [FieldOffset(0)] public int entry_index;
+    }
+
     /// <summary>
     /// Function: AddTileEntryAuto
     /// </summary>
     public unsafe virtual void AddTileEntryAuto(int entry_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.AddTileEntryAuto", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(entry_index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddTileEntryAutoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.AddTileEntryAuto", true);
+        var parms = new AddTileEntryAuto_Params();
+        parms.entry_index = entry_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRoundsRemainingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetRoundsRemaining_Params
+    {
+        [FieldOffset(0)] public int rounds_remaining;
+    }
+
     /// <summary>
     /// Function: SetRoundsRemaining
     /// </summary>
     public unsafe virtual void SetRoundsRemaining(int rounds_remaining)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetRoundsRemaining", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(rounds_remaining, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRoundsRemainingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetRoundsRemaining", true);
+        var parms = new SetRoundsRemaining_Params();
+        parms.rounds_remaining = rounds_remaining;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetChallengeModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetChallengeMode_Params
+    {
+        [FieldOffset(0)] public int challenge_type_mode;
+    }
+
     /// <summary>
     /// Function: SetChallengeMode
     /// </summary>
     public unsafe virtual void SetChallengeMode(int challenge_type_mode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetChallengeMode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(challenge_type_mode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetChallengeModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetChallengeMode", true);
+        var parms = new SetChallengeMode_Params();
+        parms.challenge_type_mode = challenge_type_mode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnCloseHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnCloseHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnCloseHUD
     /// </summary>
     public unsafe virtual void OnCloseHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.OnCloseHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnCloseHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.OnCloseHUD", true);
+        var parms = new OnCloseHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CloseScreen_Params
+    {
+    }
+
     /// <summary>
     /// Function: CloseScreen
     /// </summary>
     public unsafe virtual void CloseScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.CloseScreen", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.CloseScreen", true);
+        var parms = new CloseScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Hide_Params
+    {
+    }
+
     /// <summary>
     /// Function: Hide
     /// </summary>
     public unsafe virtual void Hide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.Hide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.Hide", true);
+        var parms = new Hide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_showFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct show_Params
+    {
+        [FieldOffset(0)] public int Mode;
+    }
+
     /// <summary>
     /// Function: show
     /// </summary>
     public unsafe virtual void show(int Mode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.show", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Mode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_showFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.show", true);
+        var parms = new show_Params();
+        parms.Mode = Mode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HideItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: HideItem
     /// </summary>
     public unsafe virtual void HideItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.HideItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.HideItem", true);
+        var parms = new HideItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShowItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: ShowItem
     /// </summary>
     public unsafe virtual void ShowItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.ShowItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.ShowItem", true);
+        var parms = new ShowItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KismetControlsInOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct KismetControlsInOut_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: KismetControlsInOut
     /// </summary>
     public unsafe virtual void KismetControlsInOut(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.KismetControlsInOut", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KismetControlsInOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.KismetControlsInOut", true);
+        var parms = new KismetControlsInOut_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTickRealTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetTickRealTime_Params
+    {
+        [FieldOffset(0)] public int bRealTime;
+    }
+
     /// <summary>
     /// Function: SetTickRealTime
     /// </summary>
     public unsafe virtual void SetTickRealTime(bool bRealTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetTickRealTime", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bRealTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTickRealTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.SetTickRealTime", true);
+        var parms = new SetTickRealTime_Params();
+        parms.bRealTime = bRealTime ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint LocPlay;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.Engine.LocalPlayer LocPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieChallengeModifiers.Init", true);
+        var parms = new Init_Params();
+        parms.LocPlay = LocPlay?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
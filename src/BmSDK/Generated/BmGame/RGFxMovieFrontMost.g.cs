@@ -78,144 +78,224 @@ public partial class RGFxMovieFrontMost : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObj
         where TComponent : class, Framework.IScriptComponent<RGFxMovieFrontMost>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PromptClickedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PromptClicked_Params
+    {
+        [FieldOffset(0)] public int PromptId;
+    }
+
     /// <summary>
     /// Function: PromptClicked
     /// </summary>
     public unsafe virtual void PromptClicked(int PromptId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.PromptClicked", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PromptId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PromptClickedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.PromptClicked", true);
+        var parms = new PromptClicked_Params();
+        parms.PromptId = PromptId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPromptModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetPromptMode_Params
+    {
+        [FieldOffset(0)] public int bLeft;
+        [FieldOffset(4)] public int bVertical;
+    }
+
     /// <summary>
     /// Function: SetPromptMode
     /// </summary>
     public unsafe virtual void SetPromptMode(bool bLeft, bool bVertical)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetPromptMode", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLeft, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVertical, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPromptModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetPromptMode", true);
+        var parms = new SetPromptMode_Params();
+        parms.bLeft = bLeft ? 1 : 0;
+        parms.bVertical = bVertical ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMainPromptAtYFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetMainPromptAtY_Params
+    {
+        [FieldOffset(0)] public float atY;
+    }
+
     /// <summary>
     /// Function: SetMainPromptAtY
     /// </summary>
     public unsafe virtual void SetMainPromptAtY(float atY)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetMainPromptAtY", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(atY, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMainPromptAtYFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetMainPromptAtY", true);
+        var parms = new SetMainPromptAtY_Params();
+        parms.atY = atY;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReFetchAndBuildPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReFetchAndBuildPrompts_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReFetchAndBuildPrompts
     /// </summary>
     public unsafe virtual void ReFetchAndBuildPrompts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ReFetchAndBuildPrompts", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReFetchAndBuildPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ReFetchAndBuildPrompts", true);
+        var parms = new ReFetchAndBuildPrompts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RebuildPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RebuildPrompts_Params
+    {
+    }
+
     /// <summary>
     /// Function: RebuildPrompts
     /// </summary>
     public unsafe virtual void RebuildPrompts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.RebuildPrompts", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RebuildPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.RebuildPrompts", true);
+        var parms = new RebuildPrompts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMainPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetMainPrompt_Params
+    {
+        [FieldOffset(0)] public int Id;
+        [FieldOffset(4)] public BmSDK.FString Label;
+        [FieldOffset(16)] public float Alpha;
+        [FieldOffset(20)] public float TextAlpha;
+    }
+
     /// <summary>
     /// Function: SetMainPrompt
     /// </summary>
     public unsafe virtual void SetMainPrompt(int Id, BmSDK.FString Label, float Alpha, float TextAlpha)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetMainPrompt", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Label, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Alpha, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextAlpha, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMainPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetMainPrompt", true);
+        var parms = new SetMainPrompt_Params();
+        parms.Id = Id;
+        parms.Label = Label;
+        parms.Alpha = Alpha;
+        parms.TextAlpha = TextAlpha;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetPrompt_Params
+    {
+        [FieldOffset(0)] public int Id;
+        [FieldOffset(4)] public BmSDK.FString Label;
+        [FieldOffset(16)] public float Alpha;
+        [FieldOffset(20)] public float TextAlpha;
+    }
+
     /// <summary>
     /// Function: SetPrompt
     /// </summary>
     public unsafe virtual void SetPrompt(int Id, BmSDK.FString Label, float Alpha, float TextAlpha)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetPrompt", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Id, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Label, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Alpha, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextAlpha, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetPrompt", true);
+        var parms = new SetPrompt_Params();
+        parms.Id = Id;
+        parms.Label = Label;
+        parms.Alpha = Alpha;
+        parms.TextAlpha = TextAlpha;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReLayoutPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReLayoutPrompts_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReLayoutPrompts
     /// </summary>
     public unsafe virtual void ReLayoutPrompts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ReLayoutPrompts", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReLayoutPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ReLayoutPrompts", true);
+        var parms = new ReLayoutPrompts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearPrompts_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearPrompts
     /// </summary>
     public unsafe virtual void ClearPrompts()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ClearPrompts", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ClearPrompts", true);
+        var parms = new ClearPrompts_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerSavingErrorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerSavingError_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerSavingError
     /// </summary>
     public unsafe virtual void TriggerSavingError()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.TriggerSavingError", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerSavingErrorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.TriggerSavingError", true);
+        var parms = new TriggerSavingError_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsSavingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsSaving_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsSaving
     /// </summary>
     public unsafe virtual int IsSaving()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.IsSaving", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_IsSavingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.IsSaving", true);
+        var parms = new IsSaving_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ShowLoadingPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShowLoadingPrompt_Params
+    {
+        [FieldOffset(0)] public int bShow;
+        [FieldOffset(4)] public int bForceOff;
     }
 
     /// <summary>
@@ -223,232 +303,354 @@ public partial class RGFxMovieFrontMost : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObj
     /// </summary>
     public unsafe virtual void ShowLoadingPrompt(bool bShow, bool bForceOff = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ShowLoadingPrompt", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceOff, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowLoadingPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ShowLoadingPrompt", true);
+        var parms = new ShowLoadingPrompt_Params();
+        parms.bShow = bShow ? 1 : 0;
+        parms.bForceOff = bForceOff ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowSkipPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShowSkipPrompt_Params
+    {
+        [FieldOffset(0)] public int bShow;
+        [FieldOffset(4)] public int bForceOff;
+    }
+
     /// <summary>
     /// Function: ShowSkipPrompt
     /// </summary>
     public unsafe virtual void ShowSkipPrompt(bool bShow, bool bForceOff = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ShowSkipPrompt", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceOff, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowSkipPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ShowSkipPrompt", true);
+        var parms = new ShowSkipPrompt_Params();
+        parms.bShow = bShow ? 1 : 0;
+        parms.bForceOff = bForceOff ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleSavingIconFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ToggleSavingIcon_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ToggleSavingIcon
     /// </summary>
     public unsafe virtual void ToggleSavingIcon(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ToggleSavingIcon", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleSavingIconFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ToggleSavingIcon", true);
+        var parms = new ToggleSavingIcon_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSimpleFadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetSimpleFade_Params
+    {
+        [FieldOffset(0)] public float Opacity;
+        [FieldOffset(4)] public int RGB;
+    }
+
     /// <summary>
     /// Function: SetSimpleFade
     /// </summary>
     public unsafe virtual void SetSimpleFade(float Opacity, int RGB = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetSimpleFade", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Opacity, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RGB, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSimpleFadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetSimpleFade", true);
+        var parms = new SetSimpleFade_Params();
+        parms.Opacity = Opacity;
+        parms.RGB = RGB;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FadeInRGBFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FadeInRGB_Params
+    {
+        [FieldOffset(0)] public float OverSecs;
+        [FieldOffset(4)] public int RGB;
+    }
+
     /// <summary>
     /// Function: FadeInRGB
     /// </summary>
     public unsafe virtual void FadeInRGB(float OverSecs, int RGB = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeInRGB", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OverSecs, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RGB, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FadeInRGBFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeInRGB", true);
+        var parms = new FadeInRGB_Params();
+        parms.OverSecs = OverSecs;
+        parms.RGB = RGB;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FadeOutRGBFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FadeOutRGB_Params
+    {
+        [FieldOffset(0)] public float OverSecs;
+        [FieldOffset(4)] public int RGB;
+    }
+
     /// <summary>
     /// Function: FadeOutRGB
     /// </summary>
     public unsafe virtual void FadeOutRGB(float OverSecs, int RGB = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeOutRGB", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OverSecs, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RGB, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FadeOutRGBFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeOutRGB", true);
+        var parms = new FadeOutRGB_Params();
+        parms.OverSecs = OverSecs;
+        parms.RGB = RGB;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FadeAnimatedDone_CBFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FadeAnimatedDone_CB_Params
+    {
+        [FieldOffset(0)] public int bBlackscreen;
+    }
+
     /// <summary>
     /// Function: FadeAnimatedDone_CB
     /// </summary>
     public unsafe virtual void FadeAnimatedDone_CB(bool bBlackscreen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeAnimatedDone_CB", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bBlackscreen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FadeAnimatedDone_CBFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeAnimatedDone_CB", true);
+        var parms = new FadeAnimatedDone_CB_Params();
+        parms.bBlackscreen = bBlackscreen ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FadeCallbackMeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FadeCallbackMe_Params
+    {
+        [FieldOffset(0)] public nint CallMeBack;
+    }
+
     /// <summary>
     /// Function: FadeCallbackMe
     /// </summary>
     public unsafe virtual void FadeCallbackMe(BmSDK.BmGame.RGFxMovie CallMeBack)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeCallbackMe", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CallMeBack, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FadeCallbackMeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeCallbackMe", true);
+        var parms = new FadeCallbackMe_Params();
+        parms.CallMeBack = CallMeBack?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerFadeInFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct TriggerFadeIn_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGFxMovieFrontMost.AnimatedFadeType FadeType;
+    }
+
     /// <summary>
     /// Function: TriggerFadeIn
     /// </summary>
     public unsafe virtual void TriggerFadeIn(BmSDK.BmGame.RGFxMovieFrontMost.AnimatedFadeType FadeType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.TriggerFadeIn", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerFadeInFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.TriggerFadeIn", true);
+        var parms = new TriggerFadeIn_Params();
+        parms.FadeType = FadeType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerFadeOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct TriggerFadeOut_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGFxMovieFrontMost.AnimatedFadeType FadeType;
+        [FieldOffset(4)] public int bInstantly;
+    }
+
     /// <summary>
     /// Function: TriggerFadeOut
     /// </summary>
     public unsafe virtual void TriggerFadeOut(BmSDK.BmGame.RGFxMovieFrontMost.AnimatedFadeType FadeType, bool bInstantly)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.TriggerFadeOut", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantly, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerFadeOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.TriggerFadeOut", true);
+        var parms = new TriggerFadeOut_Params();
+        parms.FadeType = FadeType;
+        parms.bInstantly = bInstantly ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSubtitlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SetSubtitles_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TheText;
+        [FieldOffset(12)] public int Justification;
+        [FieldOffset(16)] public int TextColour;
+    }
+
     /// <summary>
     /// Function: SetSubtitles
     /// </summary>
     public unsafe virtual void SetSubtitles(BmSDK.FString TheText, int Justification, int TextColour = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetSubtitles", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheText, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Justification, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextColour, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSubtitlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetSubtitles", true);
+        var parms = new SetSubtitles_Params();
+        parms.TheText = TheText;
+        parms.Justification = Justification;
+        parms.TextColour = TextColour;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSubtitles_setFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SetSubtitles_set_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TheText;
+        [FieldOffset(12)] public int Justification;
+        [FieldOffset(16)] public int TextColour;
+    }
+
     /// <summary>
     /// Function: SetSubtitles_set
     /// </summary>
     public unsafe virtual void SetSubtitles_set(BmSDK.FString TheText, int Justification, int TextColour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetSubtitles_set", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheText, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Justification, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextColour, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSubtitles_setFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetSubtitles_set", true);
+        var parms = new SetSubtitles_set_Params();
+        parms.TheText = TheText;
+        parms.Justification = Justification;
+        parms.TextColour = TextColour;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetToolTipFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetToolTip_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TheText;
+    }
+
     /// <summary>
     /// Function: SetToolTip
     /// </summary>
     public unsafe override void SetToolTip(BmSDK.FString TheText = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetToolTip", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheText, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetToolTipFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.SetToolTip", true);
+        var parms = new SetToolTip_Params();
+        parms.TheText = TheText;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FadeInMCFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct FadeInMC_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FadeName;
+    }
+
     /// <summary>
     /// Function: FadeInMC
     /// </summary>
     public unsafe virtual void FadeInMC(BmSDK.FString FadeName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeInMC", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FadeInMCFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeInMC", true);
+        var parms = new FadeInMC_Params();
+        parms.FadeName = FadeName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FadeOutMCFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct FadeOutMC_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FadeName;
+        [FieldOffset(12)] public int bInstantly;
+    }
+
     /// <summary>
     /// Function: FadeOutMC
     /// </summary>
     public unsafe virtual void FadeOutMC(BmSDK.FString FadeName, bool bInstantly)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeOutMC", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantly, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FadeOutMCFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.FadeOutMC", true);
+        var parms = new FadeOutMC_Params();
+        parms.FadeName = FadeName;
+        parms.bInstantly = bInstantly ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowSafeFrameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowSafeFrame_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowSafeFrame
     /// </summary>
     public unsafe virtual void ShowSafeFrame(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ShowSafeFrame", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowSafeFrameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ShowSafeFrame", true);
+        var parms = new ShowSafeFrame_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint LocPlay;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.Engine.LocalPlayer LocPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.Init", true);
+        var parms = new Init_Params();
+        parms.LocPlay = LocPlay?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldFadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldFade_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldFade
     /// </summary>
     public unsafe virtual bool ShouldFade()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ShouldFade", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldFadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieFrontMost.ShouldFade", true);
+        var parms = new ShouldFade_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -78,41 +78,71 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RGFxMovieHUD>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ShowCreditsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ShowCredits_Params
+    {
+        [FieldOffset(0)] public float Delay;
+    }
+
     /// <summary>
     /// Function: ShowCredits
     /// </summary>
     public unsafe virtual void ShowCredits(float Delay, BmSDK.TArray<BmSDK.FString> CreditList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowCredits", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Delay, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CreditList, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowCreditsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowCredits", true);
+        var parms = new ShowCredits_Params();
+        parms.Delay = Delay;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(CreditList, (byte*)&parms + 4);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowCreditsASFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowCreditsAS_Params
+    {
+        [FieldOffset(0)] public float Delay;
+    }
+
     /// <summary>
     /// Function: ShowCreditsAS
     /// </summary>
     public unsafe virtual void ShowCreditsAS(float Delay)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowCreditsAS", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Delay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowCreditsASFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowCreditsAS", true);
+        var parms = new ShowCreditsAS_Params();
+        parms.Delay = Delay;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ObjectivesPromptCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct ObjectivesPromptCallback_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString KeyType;
+        [FieldOffset(12)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: ObjectivesPromptCallback
     /// </summary>
     public unsafe virtual BmSDK.FString ObjectivesPromptCallback(BmSDK.FString KeyType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ObjectivesPromptCallback", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(KeyType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
+        var funcManaged = s_ObjectivesPromptCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ObjectivesPromptCallback", true);
+        var parms = new ObjectivesPromptCallback_Params();
+        parms.KeyType = KeyType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ShowRiddleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ShowRiddle_Params
+    {
+        [FieldOffset(0)] public int bShow;
+        [FieldOffset(4)] public BmSDK.FString RiddleText;
     }
 
     /// <summary>
@@ -120,186 +150,291 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ShowRiddle(bool bShow, BmSDK.FString RiddleText)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowRiddle", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RiddleText, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowRiddleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowRiddle", true);
+        var parms = new ShowRiddle_Params();
+        parms.bShow = bShow ? 1 : 0;
+        parms.RiddleText = RiddleText;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetZoomModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetZoomMode_Params
+    {
+        [FieldOffset(0)] public int bEnabled;
+        [FieldOffset(4)] public float HeadAngle;
+    }
+
     /// <summary>
     /// Function: SetZoomMode
     /// </summary>
     public unsafe virtual void SetZoomMode(bool bEnabled, float HeadAngle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetZoomMode", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnabled, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HeadAngle, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetZoomModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetZoomMode", true);
+        var parms = new SetZoomMode_Params();
+        parms.bEnabled = bEnabled ? 1 : 0;
+        parms.HeadAngle = HeadAngle;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowCriticalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowCritical_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowCritical
     /// </summary>
     public unsafe virtual void ShowCritical()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowCritical", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowCriticalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowCritical", true);
+        var parms = new ShowCritical_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCombo_Params
+    {
+        [FieldOffset(0)] public int Value;
+        [FieldOffset(4)] public int bPowerUp;
+    }
+
     /// <summary>
     /// Function: SetCombo
     /// </summary>
     public unsafe virtual void SetCombo(int Value, bool bPowerUp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetCombo", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPowerUp, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetCombo", true);
+        var parms = new SetCombo_Params();
+        parms.Value = Value;
+        parms.bPowerUp = bPowerUp ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowLevelUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowLevelUp_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowLevelUp
     /// </summary>
     public unsafe virtual void ShowLevelUp(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowLevelUp", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowLevelUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowLevelUp", true);
+        var parms = new ShowLevelUp_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowLevelUpTriggerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowLevelUpTrigger_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowLevelUpTrigger
     /// </summary>
     public unsafe virtual void ShowLevelUpTrigger(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowLevelUpTrigger", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowLevelUpTriggerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowLevelUpTrigger", true);
+        var parms = new ShowLevelUpTrigger_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowXPBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowXPBar_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowXPBar
     /// </summary>
     public unsafe virtual void ShowXPBar(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowXPBar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowXPBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowXPBar", true);
+        var parms = new ShowXPBar_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetXPBarTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetXPBarTarget_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetXPBarTarget
     /// </summary>
     public unsafe virtual void SetXPBarTarget(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetXPBarTarget", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetXPBarTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetXPBarTarget", true);
+        var parms = new SetXPBarTarget_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetXPBarCurrentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetXPBarCurrent_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetXPBarCurrent
     /// </summary>
     public unsafe virtual void SetXPBarCurrent(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetXPBarCurrent", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetXPBarCurrentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetXPBarCurrent", true);
+        var parms = new SetXPBarCurrent_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowHealthBar_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowHealthBar
     /// </summary>
     public unsafe virtual void ShowHealthBar(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowHealthBar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.ShowHealthBar", true);
+        var parms = new ShowHealthBar_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetHealthBar_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetHealthBar
     /// </summary>
     public unsafe virtual void SetHealthBar(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetHealthBar", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.SetHealthBar", true);
+        var parms = new SetHealthBar_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitHealthBar_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: InitHealthBar
     /// </summary>
     public unsafe virtual void InitHealthBar(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.InitHealthBar", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.InitHealthBar", true);
+        var parms = new InitHealthBar_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_QueueXPMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct QueueXPMessage_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Title;
+        [FieldOffset(12)] public BmSDK.FString Message;
+        [FieldOffset(24)] public float HoldDuration;
+    }
+
     /// <summary>
     /// Function: QueueXPMessage
     /// </summary>
     public unsafe virtual void QueueXPMessage(BmSDK.FString Title, BmSDK.FString Message, float HoldDuration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.QueueXPMessage", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Title, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Message, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HoldDuration, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_QueueXPMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.QueueXPMessage", true);
+        var parms = new QueueXPMessage_Params();
+        parms.Title = Title;
+        parms.Message = Message;
+        parms.HoldDuration = HoldDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MarkXPBarAsFullFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MarkXPBarAsFull_Params
+    {
+        [FieldOffset(0)] public int bIsFull;
+    }
+
     /// <summary>
     /// Function: MarkXPBarAsFull
     /// </summary>
     public unsafe virtual void MarkXPBarAsFull(bool bIsFull)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.MarkXPBarAsFull", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsFull, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MarkXPBarAsFullFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.MarkXPBarAsFull", true);
+        var parms = new MarkXPBarAsFull_Params();
+        parms.bIsFull = bIsFull ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint LocPlay;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.Engine.LocalPlayer LocPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieHUD.Init", true);
+        var parms = new Init_Params();
+        parms.LocPlay = LocPlay?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -364,8 +499,8 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSurpressLevelupSound
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 508); }
+        get { return (*(int*)(Ptr + 508) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 508) |= 1; else *(int*)(Ptr + 508) &= ~1; }
     }
 
     /// <summary>
@@ -373,8 +508,8 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bXPBarFull
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 508); }
+        get { return (*(int*)(Ptr + 508) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 508) |= 2; else *(int*)(Ptr + 508) &= ~2; }
     }
 
     /// <summary>
@@ -382,8 +517,8 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Anytime_bVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 508); }
+        get { return (*(int*)(Ptr + 508) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 508) |= 4; else *(int*)(Ptr + 508) &= ~4; }
     }
 
     /// <summary>
@@ -391,8 +526,8 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Anytime_bRestart
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 508); }
+        get { return (*(int*)(Ptr + 508) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 508) |= 8; else *(int*)(Ptr + 508) &= ~8; }
     }
 
     /// <summary>
@@ -400,8 +535,8 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseSplitScreenPrompts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 508); }
+        get { return (*(int*)(Ptr + 508) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 508) |= 16; else *(int*)(Ptr + 508) &= ~16; }
     }
 
     /// <summary>
@@ -409,8 +544,8 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe float Anytime_X
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(float*)(Ptr + 512); }
+        set { *(float*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -418,8 +553,8 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe float Anytime_Y
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(float*)(Ptr + 516); }
+        set { *(float*)(Ptr + 516) = value; }
     }
 
     /// <summary>
@@ -427,8 +562,8 @@ public partial class RGFxMovieHUD : BmSDK.BmGame.RGFxMovie, BmSDK.IGameObject
     /// </summary>
     public unsafe float Anytime_Depth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 520); }
+        get { return *(float*)(Ptr + 520); }
+        set { *(float*)(Ptr + 520) = value; }
     }
 
     /// <summary>
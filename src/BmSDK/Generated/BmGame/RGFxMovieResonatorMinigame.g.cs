@@ -78,540 +78,854 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
         where TComponent : class, Framework.IScriptComponent<RGFxMovieResonatorMinigame>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_RadioScannerAudioCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct RadioScannerAudioCallback_Params
+    {
+        [FieldOffset(0)] public int CallbackFlags;
+        [FieldOffset(4)] public BmSDK.Engine.AkWwise.FAkSoundHandle SoundHandle;
+        [FieldOffset(16)] public int MarkerID;
+    }
+
     /// <summary>
     /// Function: RadioScannerAudioCallback
     /// </summary>
     public unsafe virtual void RadioScannerAudioCallback(int CallbackFlags, BmSDK.Engine.AkWwise.FAkSoundHandle SoundHandle, int MarkerID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RadioScannerAudioCallback", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CallbackFlags, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundHandle, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerID, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RadioScannerAudioCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RadioScannerAudioCallback", true);
+        var parms = new RadioScannerAudioCallback_Params();
+        parms.CallbackFlags = CallbackFlags;
+        parms.SoundHandle = SoundHandle;
+        parms.MarkerID = MarkerID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RadioScannerAudioMarkerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct RadioScannerAudioMarker_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.AkWwise.FAkSoundHandle SoundHandle;
+        [FieldOffset(12)] public int MarkerID;
+    }
+
     /// <summary>
     /// Function: RadioScannerAudioMarker
     /// </summary>
     public unsafe virtual void RadioScannerAudioMarker(BmSDK.Engine.AkWwise.FAkSoundHandle SoundHandle, int MarkerID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RadioScannerAudioMarker", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundHandle, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerID, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RadioScannerAudioMarkerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RadioScannerAudioMarker", true);
+        var parms = new RadioScannerAudioMarker_Params();
+        parms.SoundHandle = SoundHandle;
+        parms.MarkerID = MarkerID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_CloseResonatorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FE_CloseResonator_Params
+    {
+    }
+
     /// <summary>
     /// Function: FE_CloseResonator
     /// </summary>
     public unsafe virtual void FE_CloseResonator()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_CloseResonator", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_CloseResonatorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_CloseResonator", true);
+        var parms = new FE_CloseResonator_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_StartResonatorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FE_StartResonator_Params
+    {
+    }
+
     /// <summary>
     /// Function: FE_StartResonator
     /// </summary>
     public unsafe virtual void FE_StartResonator()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_StartResonator", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_StartResonatorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_StartResonator", true);
+        var parms = new FE_StartResonator_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_NotifyPasswordFoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FE_NotifyPasswordFound_Params
+    {
+    }
+
     /// <summary>
     /// Function: FE_NotifyPasswordFound
     /// </summary>
     public unsafe virtual void FE_NotifyPasswordFound()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_NotifyPasswordFound", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_NotifyPasswordFoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_NotifyPasswordFound", true);
+        var parms = new FE_NotifyPasswordFound_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_PlayResonatorAudioEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FE_PlayResonatorAudioEvent_Params
+    {
+        [FieldOffset(0)] public int event_index;
+    }
+
     /// <summary>
     /// Function: FE_PlayResonatorAudioEvent
     /// </summary>
     public unsafe virtual void FE_PlayResonatorAudioEvent(int event_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_PlayResonatorAudioEvent", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(event_index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_PlayResonatorAudioEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_PlayResonatorAudioEvent", true);
+        var parms = new FE_PlayResonatorAudioEvent_Params();
+        parms.event_index = event_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_SetRumbleFromFlashFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FE_SetRumbleFromFlash_Params
+    {
+        [FieldOffset(0)] public float left_rumble;
+        [FieldOffset(4)] public float right_rumble;
+    }
+
     /// <summary>
     /// Function: FE_SetRumbleFromFlash
     /// </summary>
     public unsafe virtual void FE_SetRumbleFromFlash(float left_rumble, float right_rumble)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetRumbleFromFlash", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(left_rumble, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(right_rumble, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_SetRumbleFromFlashFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetRumbleFromFlash", true);
+        var parms = new FE_SetRumbleFromFlash_Params();
+        parms.left_rumble = left_rumble;
+        parms.right_rumble = right_rumble;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_RedoPasswordPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FE_RedoPasswordPrompts_Params
+    {
+        [FieldOffset(0)] public int _CanCyclePasswords;
+    }
+
     /// <summary>
     /// Function: FE_RedoPasswordPrompts
     /// </summary>
     public unsafe virtual void FE_RedoPasswordPrompts(bool _CanCyclePasswords)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_RedoPasswordPrompts", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_CanCyclePasswords, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_RedoPasswordPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_RedoPasswordPrompts", true);
+        var parms = new FE_RedoPasswordPrompts_Params();
+        parms._CanCyclePasswords = _CanCyclePasswords ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_RedoDisruptedPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FE_RedoDisruptedPrompts_Params
+    {
+        [FieldOffset(0)] public int _CanExit;
+    }
+
     /// <summary>
     /// Function: FE_RedoDisruptedPrompts
     /// </summary>
     public unsafe virtual void FE_RedoDisruptedPrompts(bool _CanExit)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_RedoDisruptedPrompts", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_CanExit, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_RedoDisruptedPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_RedoDisruptedPrompts", true);
+        var parms = new FE_RedoDisruptedPrompts_Params();
+        parms._CanExit = _CanExit ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_RedoRadioPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct FE_RedoRadioPrompts_Params
+    {
+        [FieldOffset(0)] public int _RadioCanScan;
+        [FieldOffset(4)] public int _RadioCanMove;
+        [FieldOffset(8)] public int _RadioCanFlick;
+    }
+
     /// <summary>
     /// Function: FE_RedoRadioPrompts
     /// </summary>
     public unsafe virtual void FE_RedoRadioPrompts(bool _RadioCanScan, bool _RadioCanMove, bool _RadioCanFlick)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_RedoRadioPrompts", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RadioCanScan, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RadioCanMove, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RadioCanFlick, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_RedoRadioPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_RedoRadioPrompts", true);
+        var parms = new FE_RedoRadioPrompts_Params();
+        parms._RadioCanScan = _RadioCanScan ? 1 : 0;
+        parms._RadioCanMove = _RadioCanMove ? 1 : 0;
+        parms._RadioCanFlick = _RadioCanFlick ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_StopRadioFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FE_StopRadio_Params
+    {
+    }
+
     /// <summary>
     /// Function: FE_StopRadio
     /// </summary>
     public unsafe virtual void FE_StopRadio()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_StopRadio", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_StopRadioFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_StopRadio", true);
+        var parms = new FE_StopRadio_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_SetCurrentRadioDecryptedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FE_SetCurrentRadioDecrypted_Params
+    {
+    }
+
     /// <summary>
     /// Function: FE_SetCurrentRadioDecrypted
     /// </summary>
     public unsafe virtual void FE_SetCurrentRadioDecrypted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetCurrentRadioDecrypted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_SetCurrentRadioDecryptedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetCurrentRadioDecrypted", true);
+        var parms = new FE_SetCurrentRadioDecrypted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_SetCurrentRadioWarbleXYFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FE_SetCurrentRadioWarbleXY_Params
+    {
+        [FieldOffset(0)] public float value_x;
+        [FieldOffset(4)] public float value_y;
+    }
+
     /// <summary>
     /// Function: FE_SetCurrentRadioWarbleXY
     /// </summary>
     public unsafe virtual void FE_SetCurrentRadioWarbleXY(float value_x, float value_y)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetCurrentRadioWarbleXY", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(value_x, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(value_y, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_SetCurrentRadioWarbleXYFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetCurrentRadioWarbleXY", true);
+        var parms = new FE_SetCurrentRadioWarbleXY_Params();
+        parms.value_x = value_x;
+        parms.value_y = value_y;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_SetCurrentRadioAudioLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FE_SetCurrentRadioAudioLevel_Params
+    {
+        [FieldOffset(0)] public float zero_to_one;
+    }
+
     /// <summary>
     /// Function: FE_SetCurrentRadioAudioLevel
     /// </summary>
     public unsafe virtual void FE_SetCurrentRadioAudioLevel(float zero_to_one)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetCurrentRadioAudioLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(zero_to_one, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_SetCurrentRadioAudioLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetCurrentRadioAudioLevel", true);
+        var parms = new FE_SetCurrentRadioAudioLevel_Params();
+        parms.zero_to_one = zero_to_one;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_SetCurrentRadioStationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct FE_SetCurrentRadioStation_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString RadioStationName;
+        [FieldOffset(12)] public int CurrentSequence;
+        [FieldOffset(16)] public int encrypted;
+    }
+
     /// <summary>
     /// Function: FE_SetCurrentRadioStation
     /// </summary>
     public unsafe virtual void FE_SetCurrentRadioStation(BmSDK.FString RadioStationName, int CurrentSequence, bool encrypted)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetCurrentRadioStation", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RadioStationName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentSequence, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(encrypted, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_SetCurrentRadioStationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetCurrentRadioStation", true);
+        var parms = new FE_SetCurrentRadioStation_Params();
+        parms.RadioStationName = RadioStationName;
+        parms.CurrentSequence = CurrentSequence;
+        parms.encrypted = encrypted ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRadioAudioStatesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetRadioAudioStates_Params
+    {
+        [FieldOffset(0)] public nint base_state;
+        [FieldOffset(4)] public nint sequence_state;
+    }
+
     /// <summary>
     /// Function: SetRadioAudioStates
     /// </summary>
     public unsafe virtual void SetRadioAudioStates(BmSDK.Engine.AkStateName base_state, BmSDK.Engine.AkStateName sequence_state)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetRadioAudioStates", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(base_state, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(sequence_state, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRadioAudioStatesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetRadioAudioStates", true);
+        var parms = new SetRadioAudioStates_Params();
+        parms.base_state = base_state?.Ptr ?? 0;
+        parms.sequence_state = sequence_state?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_SetRadioStationFoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct FE_SetRadioStationFound_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString RadioStationName;
+    }
+
     /// <summary>
     /// Function: FE_SetRadioStationFound
     /// </summary>
     public unsafe virtual void FE_SetRadioStationFound(BmSDK.FString RadioStationName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetRadioStationFound", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RadioStationName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_SetRadioStationFoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_SetRadioStationFound", true);
+        var parms = new FE_SetRadioStationFound_Params();
+        parms.RadioStationName = RadioStationName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_TriggerOneShotRadioEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct FE_TriggerOneShotRadioEvent_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString RadioStationName;
+    }
+
     /// <summary>
     /// Function: FE_TriggerOneShotRadioEvent
     /// </summary>
     public unsafe virtual void FE_TriggerOneShotRadioEvent(BmSDK.FString RadioStationName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_TriggerOneShotRadioEvent", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RadioStationName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_TriggerOneShotRadioEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_TriggerOneShotRadioEvent", true);
+        var parms = new FE_TriggerOneShotRadioEvent_Params();
+        parms.RadioStationName = RadioStationName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_PasswordCrackerCrashedEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FE_PasswordCrackerCrashedEvent_Params
+    {
+    }
+
     /// <summary>
     /// Function: FE_PasswordCrackerCrashedEvent
     /// </summary>
     public unsafe virtual void FE_PasswordCrackerCrashedEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_PasswordCrackerCrashedEvent", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_PasswordCrackerCrashedEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_PasswordCrackerCrashedEvent", true);
+        var parms = new FE_PasswordCrackerCrashedEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FE_TellFlashAboutControllerStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FE_TellFlashAboutControllerState_Params
+    {
+    }
+
     /// <summary>
     /// Function: FE_TellFlashAboutControllerState
     /// </summary>
     public unsafe virtual void FE_TellFlashAboutControllerState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_TellFlashAboutControllerState", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FE_TellFlashAboutControllerStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.FE_TellFlashAboutControllerState", true);
+        var parms = new FE_TellFlashAboutControllerState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayResonatorAudioEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlayResonatorAudioEvent_Params
+    {
+        [FieldOffset(0)] public int event_index;
+    }
+
     /// <summary>
     /// Function: PlayResonatorAudioEvent
     /// </summary>
     public unsafe virtual void PlayResonatorAudioEvent(int event_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.PlayResonatorAudioEvent", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(event_index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayResonatorAudioEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.PlayResonatorAudioEvent", true);
+        var parms = new PlayResonatorAudioEvent_Params();
+        parms.event_index = event_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KillPasswordAudioFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct KillPasswordAudio_Params
+    {
+    }
+
     /// <summary>
     /// Function: KillPasswordAudio
     /// </summary>
     public unsafe virtual void KillPasswordAudio()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.KillPasswordAudio", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KillPasswordAudioFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.KillPasswordAudio", true);
+        var parms = new KillPasswordAudio_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartPasswordAudioFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartPasswordAudio_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartPasswordAudio
     /// </summary>
     public unsafe virtual void StartPasswordAudio()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.StartPasswordAudio", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartPasswordAudioFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.StartPasswordAudio", true);
+        var parms = new StartPasswordAudio_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayMinigamePromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisplayMinigamePrompts_Params
+    {
+        [FieldOffset(0)] public nint HelpPrompt;
+    }
+
     /// <summary>
     /// Function: DisplayMinigamePrompts
     /// </summary>
     public unsafe virtual void DisplayMinigamePrompts(BmSDK.BmGame.RHUDPrompt HelpPrompt)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.DisplayMinigamePrompts", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HelpPrompt, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayMinigamePromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.DisplayMinigamePrompts", true);
+        var parms = new DisplayMinigamePrompts_Params();
+        parms.HelpPrompt = HelpPrompt?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRumbleFromFlashFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetRumbleFromFlash_Params
+    {
+        [FieldOffset(0)] public float left_rumble;
+        [FieldOffset(4)] public float right_rumble;
+    }
+
     /// <summary>
     /// Function: SetRumbleFromFlash
     /// </summary>
     public unsafe virtual void SetRumbleFromFlash(float left_rumble, float right_rumble)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetRumbleFromFlash", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(left_rumble, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(right_rumble, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRumbleFromFlashFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetRumbleFromFlash", true);
+        var parms = new SetRumbleFromFlash_Params();
+        parms.left_rumble = left_rumble;
+        parms.right_rumble = right_rumble;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RedoRadioPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RedoRadioPrompts_Params
+    {
+        [FieldOffset(0)] public int _RadioCanScan;
+        [FieldOffset(4)] public int _RadioCanMove;
+        [FieldOffset(8)] public int _RadioCanFlick;
+    }
+
     /// <summary>
     /// Function: RedoRadioPrompts
     /// </summary>
     public unsafe virtual void RedoRadioPrompts(bool _RadioCanScan, bool _RadioCanMove, bool _RadioCanFlick)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RedoRadioPrompts", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RadioCanScan, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RadioCanMove, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RadioCanFlick, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RedoRadioPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RedoRadioPrompts", true);
+        var parms = new RedoRadioPrompts_Params();
+        parms._RadioCanScan = _RadioCanScan ? 1 : 0;
+        parms._RadioCanMove = _RadioCanMove ? 1 : 0;
+        parms._RadioCanFlick = _RadioCanFlick ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MakeUnresponsiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct MakeUnresponsive_Params
+    {
+    }
+
     /// <summary>
     /// Function: MakeUnresponsive
     /// </summary>
     public unsafe virtual void MakeUnresponsive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.MakeUnresponsive", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MakeUnresponsiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.MakeUnresponsive", true);
+        var parms = new MakeUnresponsive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestQuitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RequestQuit_Params
+    {
+    }
+
     /// <summary>
     /// Function: RequestQuit
     /// </summary>
     public unsafe virtual void RequestQuit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RequestQuit", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestQuitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RequestQuit", true);
+        var parms = new RequestQuit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BroadcastIsJammedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BroadcastIsJammed_Params
+    {
+    }
+
     /// <summary>
     /// Function: BroadcastIsJammed
     /// </summary>
     public unsafe virtual void BroadcastIsJammed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.BroadcastIsJammed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BroadcastIsJammedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.BroadcastIsJammed", true);
+        var parms = new BroadcastIsJammed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableEncryptedChipIntroFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableEncryptedChipIntro_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableEncryptedChipIntro
     /// </summary>
     public unsafe virtual void EnableEncryptedChipIntro()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.EnableEncryptedChipIntro", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableEncryptedChipIntroFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.EnableEncryptedChipIntro", true);
+        var parms = new EnableEncryptedChipIntro_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddStationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct AddStation_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString StationName;
+        [FieldOffset(12)] public float FrequencyX;
+        [FieldOffset(16)] public float FrequencyY;
+        [FieldOffset(20)] public int TransmissionRadius;
+        [FieldOffset(24)] public byte CurrentSequence;
+        [FieldOffset(28)] public int HasBeenFound;
+        [FieldOffset(32)] public int HasHadHint;
+        [FieldOffset(36)] public int IsEncrypted;
+        [FieldOffset(40)] public int Mandatory;
+        [FieldOffset(44)] public int EasterEgg;
+        [FieldOffset(48)] public BmSDK.FString StationTransmitterType;
+        [FieldOffset(60)] public BmSDK.FString StationEncryptionType;
+        [FieldOffset(72)] public BmSDK.FString StationEncryptionStrength;
+        [FieldOffset(84)] public int HasOneShotEvent;
+    }
+
     /// <summary>
     /// Function: AddStation
     /// </summary>
     public unsafe virtual void AddStation(BmSDK.FString StationName, float FrequencyX, float FrequencyY, int TransmissionRadius, byte CurrentSequence, bool HasBeenFound, bool HasHadHint, bool IsEncrypted, bool Mandatory, bool EasterEgg, BmSDK.FString StationTransmitterType, BmSDK.FString StationEncryptionType, BmSDK.FString StationEncryptionStrength, bool HasOneShotEvent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.AddStation", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StationName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FrequencyX, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FrequencyY, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransmissionRadius, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentSequence, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HasBeenFound, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HasHadHint, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IsEncrypted, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Mandatory, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EasterEgg, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StationTransmitterType, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StationEncryptionType, paramsPtr + 60);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StationEncryptionStrength, paramsPtr + 72);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HasOneShotEvent, paramsPtr + 84);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddStationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.AddStation", true);
+        var parms = new AddStation_Params();
+        parms.StationName = StationName;
+        parms.FrequencyX = FrequencyX;
+        parms.FrequencyY = FrequencyY;
+        parms.TransmissionRadius = TransmissionRadius;
+        parms.CurrentSequence = CurrentSequence;
+        parms.HasBeenFound = HasBeenFound ? 1 : 0;
+        parms.HasHadHint = HasHadHint ? 1 : 0;
+        parms.IsEncrypted = IsEncrypted ? 1 : 0;
+        parms.Mandatory = Mandatory ? 1 : 0;
+        parms.EasterEgg = EasterEgg ? 1 : 0;
+        parms.StationTransmitterType = StationTransmitterType;
+        parms.StationEncryptionType = StationEncryptionType;
+        parms.StationEncryptionStrength = StationEncryptionStrength;
+        parms.HasOneShotEvent = HasOneShotEvent ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetAudioInterceptDetailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetAudioInterceptDetails_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString StationName;
+        [FieldOffset(12)] public BmSDK.FString SpeakerName;
+    }
+
     /// <summary>
     /// Function: SetAudioInterceptDetails
     /// </summary>
     public unsafe virtual void SetAudioInterceptDetails(BmSDK.FString StationName, BmSDK.FString SpeakerName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetAudioInterceptDetails", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StationName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeakerName, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAudioInterceptDetailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetAudioInterceptDetails", true);
+        var parms = new SetAudioInterceptDetails_Params();
+        parms.StationName = StationName;
+        parms.SpeakerName = SpeakerName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RedoDisruptedPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RedoDisruptedPrompts_Params
+    {
+        [FieldOffset(0)] public int _CanExit;
+    }
+
     /// <summary>
     /// Function: RedoDisruptedPrompts
     /// </summary>
     public unsafe virtual void RedoDisruptedPrompts(bool _CanExit)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RedoDisruptedPrompts", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_CanExit, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RedoDisruptedPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RedoDisruptedPrompts", true);
+        var parms = new RedoDisruptedPrompts_Params();
+        parms._CanExit = _CanExit ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetControlBoxParamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct SetControlBoxParams_Params
+    {
+        [FieldOffset(0)] public int _SecurityLevel;
+        [FieldOffset(4)] public BmSDK.FString _HackingNetworkString;
+        [FieldOffset(16)] public BmSDK.FString _HackingTargetString;
+        [FieldOffset(28)] public int _PasswordDifficultyLevel;
+    }
+
     /// <summary>
     /// Function: SetControlBoxParams
     /// </summary>
     public unsafe virtual void SetControlBoxParams(int _SecurityLevel, BmSDK.FString _HackingNetworkString, BmSDK.FString _HackingTargetString, int _PasswordDifficultyLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetControlBoxParams", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_SecurityLevel, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_HackingNetworkString, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_HackingTargetString, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_PasswordDifficultyLevel, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetControlBoxParamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetControlBoxParams", true);
+        var parms = new SetControlBoxParams_Params();
+        parms._SecurityLevel = _SecurityLevel;
+        parms._HackingNetworkString = _HackingNetworkString;
+        parms._HackingTargetString = _HackingTargetString;
+        parms._PasswordDifficultyLevel = _PasswordDifficultyLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDistortionEffectActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetDistortionEffectActive_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetDistortionEffectActive
     /// </summary>
     public unsafe virtual void SetDistortionEffectActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetDistortionEffectActive", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDistortionEffectActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetDistortionEffectActive", true);
+        var parms = new SetDistortionEffectActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetImminentJammingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetImminentJamming_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetImminentJamming
     /// </summary>
     public unsafe virtual void SetImminentJamming()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetImminentJamming", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetImminentJammingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetImminentJamming", true);
+        var parms = new SetImminentJamming_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHighSecurityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetHighSecurity_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetHighSecurity
     /// </summary>
     public unsafe virtual void SetHighSecurity()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetHighSecurity", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHighSecurityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetHighSecurity", true);
+        var parms = new SetHighSecurity_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RedoPasswordPromptsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RedoPasswordPrompts_Params
+    {
+        [FieldOffset(0)] public int _CanCyclePasswords;
+    }
+
     /// <summary>
     /// Function: RedoPasswordPrompts
     /// </summary>
     public unsafe virtual void RedoPasswordPrompts(bool _CanCyclePasswords)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RedoPasswordPrompts", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_CanCyclePasswords, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RedoPasswordPromptsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.RedoPasswordPrompts", true);
+        var parms = new RedoPasswordPrompts_Params();
+        parms._CanCyclePasswords = _CanCyclePasswords ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartResonatorMiniGameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartResonatorMiniGame_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartResonatorMiniGame
     /// </summary>
     public unsafe virtual void StartResonatorMiniGame()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.StartResonatorMiniGame", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartResonatorMiniGameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.StartResonatorMiniGame", true);
+        var parms = new StartResonatorMiniGame_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetResonatorPasswordFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetResonatorPassword_Params
+    {
+        [FieldOffset(0)] public int password_index;
+        [FieldOffset(4)] public BmSDK.FString the_password;
+    }
+
     /// <summary>
     /// Function: SetResonatorPassword
     /// </summary>
     public unsafe virtual void SetResonatorPassword(int password_index, BmSDK.FString the_password)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetResonatorPassword", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(password_index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(the_password, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetResonatorPasswordFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetResonatorPassword", true);
+        var parms = new SetResonatorPassword_Params();
+        parms.password_index = password_index;
+        parms.the_password = the_password;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInstructionTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetInstructionText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString new_instructions;
+    }
+
     /// <summary>
     /// Function: SetInstructionText
     /// </summary>
     public unsafe virtual void SetInstructionText(BmSDK.FString new_instructions)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetInstructionText", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_instructions, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInstructionTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetInstructionText", true);
+        var parms = new SetInstructionText_Params();
+        parms.new_instructions = new_instructions;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableDebugActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableDebugAction_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableDebugAction
     /// </summary>
     public unsafe virtual void EnableDebugAction()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.EnableDebugAction", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableDebugActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.EnableDebugAction", true);
+        var parms = new EnableDebugAction_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TestThenClearFlagFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct TestThenClearFlag_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FlagName;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TestThenClearFlag
     /// </summary>
     public unsafe virtual bool TestThenClearFlag(BmSDK.FString FlagName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.TestThenClearFlag", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FlagName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_TestThenClearFlagFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.TestThenClearFlag", true);
+        var parms = new TestThenClearFlag_Params();
+        parms.FlagName = FlagName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnCloseMinigameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnCloseMinigame_Params
+    {
     }
 
     /// <summary>
@@ -619,160 +933,246 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe virtual void OnCloseMinigame()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.OnCloseMinigame", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnCloseMinigameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.OnCloseMinigame", true);
+        var parms = new OnCloseMinigame_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CloseScreen_Params
+    {
+    }
+
     /// <summary>
     /// Function: CloseScreen
     /// </summary>
     public unsafe virtual void CloseScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.CloseScreen", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.CloseScreen", true);
+        var parms = new CloseScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Hide_Params
+    {
+    }
+
     /// <summary>
     /// Function: Hide
     /// </summary>
     public unsafe virtual void Hide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.Hide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.Hide", true);
+        var parms = new Hide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_showFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct show_Params
+    {
+    }
+
     /// <summary>
     /// Function: show
     /// </summary>
     public unsafe virtual void show()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.show", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_showFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.show", true);
+        var parms = new show_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HideItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: HideItem
     /// </summary>
     public unsafe virtual void HideItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.HideItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.HideItem", true);
+        var parms = new HideItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShowItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: ShowItem
     /// </summary>
     public unsafe virtual void ShowItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.ShowItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.ShowItem", true);
+        var parms = new ShowItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KismetControlsInOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct KismetControlsInOut_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: KismetControlsInOut
     /// </summary>
     public unsafe virtual void KismetControlsInOut(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.KismetControlsInOut", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KismetControlsInOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.KismetControlsInOut", true);
+        var parms = new KismetControlsInOut_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LoadMiniGameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct LoadMiniGame_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString minigame_path;
+    }
+
     /// <summary>
     /// Function: LoadMiniGame
     /// </summary>
     public unsafe virtual void LoadMiniGame(BmSDK.FString minigame_path)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.LoadMiniGame", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(minigame_path, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LoadMiniGameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.LoadMiniGame", true);
+        var parms = new LoadMiniGame_Params();
+        parms.minigame_path = minigame_path;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendCachedMousePositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SendCachedMousePosition_Params
+    {
+    }
+
     /// <summary>
     /// Function: SendCachedMousePosition
     /// </summary>
     public unsafe virtual void SendCachedMousePosition()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SendCachedMousePosition", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendCachedMousePositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SendCachedMousePosition", true);
+        var parms = new SendCachedMousePosition_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCachedMousePositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCachedMousePosition_Params
+    {
+        [FieldOffset(0)] public float _fCachedMouseX;
+        [FieldOffset(4)] public float _fCachedMouseY;
+    }
+
     /// <summary>
     /// Function: SetCachedMousePosition
     /// </summary>
     public unsafe virtual void SetCachedMousePosition(float _fCachedMouseX, float _fCachedMouseY)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetCachedMousePosition", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_fCachedMouseX, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_fCachedMouseY, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCachedMousePositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SetCachedMousePosition", true);
+        var parms = new SetCachedMousePosition_Params();
+        parms._fCachedMouseX = _fCachedMouseX;
+        parms._fCachedMouseY = _fCachedMouseY;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MinigameTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MinigameTick_Params
+    {
+    }
+
     /// <summary>
     /// Function: MinigameTick
     /// </summary>
     public unsafe virtual void MinigameTick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.MinigameTick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MinigameTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.MinigameTick", true);
+        var parms = new MinigameTick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateHudVisibilityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateHudVisibility_Params
+    {
+        [FieldOffset(0)] public int bVisible;
+    }
+
     /// <summary>
     /// Function: UpdateHudVisibility
     /// </summary>
     public unsafe override void UpdateHudVisibility(bool bVisible)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.UpdateHudVisibility", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVisible, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateHudVisibilityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.UpdateHudVisibility", true);
+        var parms = new UpdateHudVisibility_Params();
+        parms.bVisible = bVisible ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendRandomCharacterStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SendRandomCharacterString_Params
+    {
+    }
+
     /// <summary>
     /// Function: SendRandomCharacterString
     /// </summary>
     public unsafe virtual void SendRandomCharacterString()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SendRandomCharacterString", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendRandomCharacterStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.SendRandomCharacterString", true);
+        var parms = new SendRandomCharacterString_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint LocPlay;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.Engine.LocalPlayer LocPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.Init", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGFxMovieResonatorMinigame.Init", true);
+        var parms = new Init_Params();
+        parms.LocPlay = LocPlay?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -818,8 +1218,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool RadioCanScan
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 1; else *(int*)(Ptr + 496) &= ~1; }
     }
 
     /// <summary>
@@ -827,8 +1227,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool RadioCanMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 2; else *(int*)(Ptr + 496) &= ~2; }
     }
 
     /// <summary>
@@ -836,8 +1236,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool RadioCanFlick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 4; else *(int*)(Ptr + 496) &= ~4; }
     }
 
     /// <summary>
@@ -845,8 +1245,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool CanExit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 8; else *(int*)(Ptr + 496) &= ~8; }
     }
 
     /// <summary>
@@ -854,8 +1254,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool CanCyclePasswords
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 16; else *(int*)(Ptr + 496) &= ~16; }
     }
 
     /// <summary>
@@ -863,8 +1263,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool bIsHighSecurity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 32; else *(int*)(Ptr + 496) &= ~32; }
     }
 
     /// <summary>
@@ -872,8 +1272,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool bJammingImminent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 64; else *(int*)(Ptr + 496) &= ~64; }
     }
 
     /// <summary>
@@ -881,8 +1281,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool bAlreadyJammed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 128; else *(int*)(Ptr + 496) &= ~128; }
     }
 
     /// <summary>
@@ -890,8 +1290,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool bIsInPasswordMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 256; else *(int*)(Ptr + 496) &= ~256; }
     }
 
     /// <summary>
@@ -899,8 +1299,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool RumbleEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 512; else *(int*)(Ptr + 496) &= ~512; }
     }
 
     /// <summary>
@@ -908,8 +1308,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe bool bAnyMandatoryStations
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 496); }
+        get { return (*(int*)(Ptr + 496) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 496) |= 1024; else *(int*)(Ptr + 496) &= ~1024; }
     }
 
     /// <summary>
@@ -926,8 +1326,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe BmSDK.BmGame.RHUDPrompt.EControlIcon GadgetHelpIcon
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RHUDPrompt.EControlIcon>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(BmSDK.BmGame.RHUDPrompt.EControlIcon*)(Ptr + 512); }
+        set { *(BmSDK.BmGame.RHUDPrompt.EControlIcon*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -962,8 +1362,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe float FlashRumbleValueLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(float*)(Ptr + 552); }
+        set { *(float*)(Ptr + 552) = value; }
     }
 
     /// <summary>
@@ -971,8 +1371,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe float FlashRumbleValueRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(float*)(Ptr + 556); }
+        set { *(float*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -980,8 +1380,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe int SecurityLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 560); }
+        get { return *(int*)(Ptr + 560); }
+        set { *(int*)(Ptr + 560) = value; }
     }
 
     /// <summary>
@@ -1007,8 +1407,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe float fCachedMouseX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 588); }
+        get { return *(float*)(Ptr + 588); }
+        set { *(float*)(Ptr + 588) = value; }
     }
 
     /// <summary>
@@ -1016,8 +1416,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe float fCachedMouseY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 592); }
+        get { return *(float*)(Ptr + 592); }
+        set { *(float*)(Ptr + 592) = value; }
     }
 
     /// <summary>
@@ -1031,8 +1431,8 @@ public partial class RGFxMovieResonatorMinigame : BmSDK.BmGame.RGFxMovie, BmSDK.
     /// </summary>
     public unsafe int PasswordDifficultyLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 608); }
+        get { return *(int*)(Ptr + 608); }
+        set { *(int*)(Ptr + 608) = value; }
     }
 
     /// <summary>
@@ -78,258 +78,394 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RGadgetSelect>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_DisplayedGadgetChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisplayedGadgetChanged_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisplayedGadgetChanged
     /// </summary>
     public unsafe virtual void DisplayedGadgetChanged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.DisplayedGadgetChanged", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayedGadgetChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.DisplayedGadgetChanged", true);
+        var parms = new DisplayedGadgetChanged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DrawHUD_Params
+    {
+        [FieldOffset(0)] public nint H;
+    }
+
     /// <summary>
     /// Function: DrawHUD
     /// </summary>
     public unsafe virtual void DrawHUD(BmSDK.Engine.HUD H)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.DrawHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(H, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.DrawHUD", true);
+        var parms = new DrawHUD_Params();
+        parms.H = H?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowRequiredGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShowRequiredGadget_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName GadgetName;
+    }
+
     /// <summary>
     /// Function: ShowRequiredGadget
     /// </summary>
     public unsafe virtual void ShowRequiredGadget(BmSDK.FName GadgetName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.ShowRequiredGadget", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowRequiredGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.ShowRequiredGadget", true);
+        var parms = new ShowRequiredGadget_Params();
+        parms.GadgetName = GadgetName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowFailedGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowFailedGadget_Params
+    {
+        [FieldOffset(0)] public nint TheGadget;
+    }
+
     /// <summary>
     /// Function: ShowFailedGadget
     /// </summary>
     public unsafe virtual void ShowFailedGadget(BmSDK.BmGame.RInventoryGadget TheGadget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.ShowFailedGadget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheGadget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowFailedGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.ShowFailedGadget", true);
+        var parms = new ShowFailedGadget_Params();
+        parms.TheGadget = TheGadget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendGadgetsToFlashFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SendGadgetsToFlash_Params
+    {
+    }
+
     /// <summary>
     /// Function: SendGadgetsToFlash
     /// </summary>
     public unsafe virtual void SendGadgetsToFlash()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.SendGadgetsToFlash", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendGadgetsToFlashFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.SendGadgetsToFlash", true);
+        var parms = new SendGadgetsToFlash_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideGadgetSelectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideGadgetSelect_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideGadgetSelect
     /// </summary>
     public unsafe virtual void HideGadgetSelect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.HideGadgetSelect", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideGadgetSelectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.HideGadgetSelect", true);
+        var parms = new HideGadgetSelect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GadgetUpdatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GadgetUpdated_Params
+    {
+    }
+
     /// <summary>
     /// Function: GadgetUpdated
     /// </summary>
     public unsafe virtual void GadgetUpdated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.GadgetUpdated", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GadgetUpdatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.GadgetUpdated", true);
+        var parms = new GadgetUpdated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint PC;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe virtual void Init(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.Init", true);
+        var parms = new Init_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoubleGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 2)]
+    private struct DoubleGadget_Params
+    {
+        [FieldOffset(0)] public byte Row;
+        [FieldOffset(1)] public byte Column;
+    }
+
     /// <summary>
     /// Function: DoubleGadget
     /// </summary>
     public unsafe virtual void DoubleGadget(byte Row, byte Column)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.DoubleGadget", true);
-        byte* paramsPtr = stackalloc byte[2];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Row, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Column, paramsPtr + 1);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoubleGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.DoubleGadget", true);
+        var parms = new DoubleGadget_Params();
+        parms.Row = Row;
+        parms.Column = Column;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GadgetSelectedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 2)]
+    private struct GadgetSelected_Params
+    {
+        [FieldOffset(0)] public byte Row;
+        [FieldOffset(1)] public byte Column;
+    }
+
     /// <summary>
     /// Function: GadgetSelected
     /// </summary>
     public unsafe virtual void GadgetSelected(byte Row, byte Column)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.GadgetSelected", true);
-        byte* paramsPtr = stackalloc byte[2];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Row, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Column, paramsPtr + 1);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GadgetSelectedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.GadgetSelected", true);
+        var parms = new GadgetSelected_Params();
+        parms.Row = Row;
+        parms.Column = Column;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CycleGadgetsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CycleGadgets_Params
+    {
+        [FieldOffset(0)] public int Direction;
+    }
+
     /// <summary>
     /// Function: CycleGadgets
     /// </summary>
     public unsafe virtual void CycleGadgets(int Direction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.CycleGadgets", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Direction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CycleGadgetsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.CycleGadgets", true);
+        var parms = new CycleGadgets_Params();
+        parms.Direction = Direction;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PrevGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PrevGadget_Params
+    {
+    }
+
     /// <summary>
     /// Function: PrevGadget
     /// </summary>
     public unsafe virtual void PrevGadget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.PrevGadget", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PrevGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.PrevGadget", true);
+        var parms = new PrevGadget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NextGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NextGadget_Params
+    {
+    }
+
     /// <summary>
     /// Function: NextGadget
     /// </summary>
     public unsafe virtual void NextGadget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.NextGadget", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NextGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.NextGadget", true);
+        var parms = new NextGadget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SelectGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SelectGadget_Params
+    {
+        [FieldOffset(0)] public int Gadget;
+    }
+
     /// <summary>
     /// Function: SelectGadget
     /// </summary>
     public unsafe virtual void SelectGadget(int Gadget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.SelectGadget", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Gadget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SelectGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.SelectGadget", true);
+        var parms = new SelectGadget_Params();
+        parms.Gadget = Gadget;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateSelectedGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateSelectedGadget_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int bCanCycleGadgets;
+    }
+
     /// <summary>
     /// Function: UpdateSelectedGadget
     /// </summary>
     public unsafe virtual void UpdateSelectedGadget(float DeltaTime, bool bCanCycleGadgets)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.UpdateSelectedGadget", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanCycleGadgets, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateSelectedGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.UpdateSelectedGadget", true);
+        var parms = new UpdateSelectedGadget_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.bCanCycleGadgets = bCanCycleGadgets ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe virtual void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.Tick", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowHighlightedGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowHighlightedGadget_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowHighlightedGadget
     /// </summary>
     public unsafe virtual void ShowHighlightedGadget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.ShowHighlightedGadget", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowHighlightedGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.ShowHighlightedGadget", true);
+        var parms = new ShowHighlightedGadget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHUDHiddenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetHUDHidden_Params
+    {
+        [FieldOffset(0)] public int bHide;
+        [FieldOffset(4)] public int bImmediate;
+    }
+
     /// <summary>
     /// Function: SetHUDHidden
     /// </summary>
     public unsafe virtual void SetHUDHidden(bool bHide, bool bImmediate = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.SetHUDHidden", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bImmediate, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHUDHiddenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.SetHUDHidden", true);
+        var parms = new SetHUDHidden_Params();
+        parms.bHide = bHide ? 1 : 0;
+        parms.bImmediate = bImmediate ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AutoSelectGadgetAndOpenHudFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AutoSelectGadgetAndOpenHud_Params
+    {
+        [FieldOffset(0)] public nint GadgetClass;
+        [FieldOffset(4)] public int ShowChangeOnHud;
+    }
+
     /// <summary>
     /// Function: AutoSelectGadgetAndOpenHud
     /// </summary>
     public unsafe virtual void AutoSelectGadgetAndOpenHud(BmSDK.Class GadgetClass, bool ShowChangeOnHud = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.AutoSelectGadgetAndOpenHud", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ShowChangeOnHud, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AutoSelectGadgetAndOpenHudFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.AutoSelectGadgetAndOpenHud", true);
+        var parms = new AutoSelectGadgetAndOpenHud_Params();
+        parms.GadgetClass = GadgetClass?.Ptr ?? 0;
+        parms.ShowChangeOnHud = ShowChangeOnHud ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GadgetGadgetSelectedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GadgetGadgetSelected_Params
+    {
+    }
+
     /// <summary>
     /// Function: GadgetGadgetSelected
     /// </summary>
     public unsafe virtual void GadgetGadgetSelected()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.GadgetGadgetSelected", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GadgetGadgetSelectedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.GadgetGadgetSelected", true);
+        var parms = new GadgetGadgetSelected_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PawnChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PawnChanged_Params
+    {
+    }
+
     /// <summary>
     /// Function: PawnChanged
     /// </summary>
     public unsafe virtual void PawnChanged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.PawnChanged", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PawnChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelect.PawnChanged", true);
+        var parms = new PawnChanged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -347,8 +483,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float FadeTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -356,8 +492,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float TimeTillFadeOut
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -365,8 +501,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDrawPCLayout
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 
     /// <summary>
@@ -374,8 +510,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShowingGadgetHud
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 2; else *(int*)(Ptr + 56) &= ~2; }
     }
 
     /// <summary>
@@ -383,8 +519,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool NetClientHasInitialisedFlash
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 4; else *(int*)(Ptr + 56) &= ~4; }
     }
 
     /// <summary>
@@ -392,8 +528,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool WaitingToRecentre
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 8; else *(int*)(Ptr + 56) &= ~8; }
     }
 
     /// <summary>
@@ -401,8 +537,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DiagonalInDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -410,8 +546,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DiagonalOutDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -419,8 +555,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte SelectedColumn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(byte*)(Ptr + 68); }
+        set { *(byte*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -428,8 +564,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte SelectedRow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 69); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 69); }
+        get { return *(byte*)(Ptr + 69); }
+        set { *(byte*)(Ptr + 69) = value; }
     }
 
     /// <summary>
@@ -437,8 +573,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte LastColumn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 70); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 70); }
+        get { return *(byte*)(Ptr + 70); }
+        set { *(byte*)(Ptr + 70) = value; }
     }
 
     /// <summary>
@@ -446,8 +582,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte LastRow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 71); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 71); }
+        get { return *(byte*)(Ptr + 71); }
+        set { *(byte*)(Ptr + 71) = value; }
     }
 
     /// <summary>
@@ -455,8 +591,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte LastHighlightedColumn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(byte*)(Ptr + 72); }
+        set { *(byte*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -464,8 +600,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte LastHighlightedRow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 73); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 73); }
+        get { return *(byte*)(Ptr + 73); }
+        set { *(byte*)(Ptr + 73) = value; }
     }
 
     /// <summary>
@@ -473,8 +609,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte DoubleTapColumn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 74); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 74); }
+        get { return *(byte*)(Ptr + 74); }
+        set { *(byte*)(Ptr + 74) = value; }
     }
 
     /// <summary>
@@ -482,8 +618,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte DoubleTapRow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 75); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 75); }
+        get { return *(byte*)(Ptr + 75); }
+        set { *(byte*)(Ptr + 75) = value; }
     }
 
     /// <summary>
@@ -491,8 +627,8 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastSelectionTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -500,7 +636,7 @@ public partial class RGadgetSelect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DoubleTapTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 }
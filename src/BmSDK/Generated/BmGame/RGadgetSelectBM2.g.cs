@@ -78,52 +78,89 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
         where TComponent : class, Framework.IScriptComponent<RGadgetSelectBM2>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PawnChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PawnChanged_Params
+    {
+    }
+
     /// <summary>
     /// Function: PawnChanged
     /// </summary>
     public unsafe override void PawnChanged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.PawnChanged", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PawnChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.PawnChanged", true);
+        var parms = new PawnChanged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideGadgetSelectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideGadgetSelect_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideGadgetSelect
     /// </summary>
     public unsafe override void HideGadgetSelect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.HideGadgetSelect", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideGadgetSelectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.HideGadgetSelect", true);
+        var parms = new HideGadgetSelect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GadgetSelectedInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GadgetSelectedInternal_Params
+    {
+        [FieldOffset(0)] public byte Row;
+        [FieldOffset(1)] public byte Column;
+    }
+
     /// <summary>
     /// Function: GadgetSelectedInternal
     /// </summary>
     public unsafe virtual void GadgetSelectedInternal(byte Row, byte Column)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.GadgetSelectedInternal", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Row, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Column, paramsPtr + 1);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GadgetSelectedInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.GadgetSelectedInternal", true);
+        var parms = new GadgetSelectedInternal_Params();
+        parms.Row = Row;
+        parms.Column = Column;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsGadgetPresentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct IsGadgetPresent_Params
+    {
+        [FieldOffset(0)] public int GadgetIndex;
+        [FieldOffset(4)] public int OuterRing;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsGadgetPresent
     /// </summary>
     public unsafe virtual bool IsGadgetPresent(int GadgetIndex, bool OuterRing)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.IsGadgetPresent", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OuterRing, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_IsGadgetPresentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.IsGadgetPresent", true);
+        var parms = new IsGadgetPresent_Params();
+        parms.GadgetIndex = GadgetIndex;
+        parms.OuterRing = OuterRing ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GadgetSelectedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GadgetSelected_Params
+    {
+        [FieldOffset(0)] public byte Row;
+        [FieldOffset(1)] public byte Column;
     }
 
     /// <summary>
@@ -131,49 +168,80 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe override void GadgetSelected(byte Row, byte Column)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.GadgetSelected", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Row, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Column, paramsPtr + 1);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GadgetSelectedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.GadgetSelected", true);
+        var parms = new GadgetSelected_Params();
+        parms.Row = Row;
+        parms.Column = Column;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoubleGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DoubleGadget_Params
+    {
+        [FieldOffset(0)] public byte Row;
+        [FieldOffset(1)] public byte Column;
+    }
+
     /// <summary>
     /// Function: DoubleGadget
     /// </summary>
     public unsafe override void DoubleGadget(byte Row, byte Column)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.DoubleGadget", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Row, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Column, paramsPtr + 1);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoubleGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.DoubleGadget", true);
+        var parms = new DoubleGadget_Params();
+        parms.Row = Row;
+        parms.Column = Column;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.Tick", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetGadgetIndexPCFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetGadgetIndexPC_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName GadgetName;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetGadgetIndexPC
     /// </summary>
     public unsafe virtual int GetGadgetIndexPC(BmSDK.FName GadgetName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.GetGadgetIndexPC", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_GetGadgetIndexPCFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.GetGadgetIndexPC", true);
+        var parms = new GetGadgetIndexPC_Params();
+        parms.GadgetName = GadgetName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetGadgetIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetGadgetIndex_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName GadgetName;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -181,11 +249,18 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe virtual int GetGadgetIndex(BmSDK.FName GadgetName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.GetGadgetIndex", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_GetGadgetIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.GetGadgetIndex", true);
+        var parms = new GetGadgetIndex_Params();
+        parms.GadgetName = GadgetName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ShowRequiredGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShowRequiredGadget_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName GadgetName;
     }
 
     /// <summary>
@@ -193,48 +268,77 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe override void ShowRequiredGadget(BmSDK.FName GadgetName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.ShowRequiredGadget", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowRequiredGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.ShowRequiredGadget", true);
+        var parms = new ShowRequiredGadget_Params();
+        parms.GadgetName = GadgetName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowFailedGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowFailedGadget_Params
+    {
+        [FieldOffset(0)] public nint TheGadget;
+    }
+
     /// <summary>
     /// Function: ShowFailedGadget
     /// </summary>
     public unsafe override void ShowFailedGadget(BmSDK.BmGame.RInventoryGadget TheGadget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.ShowFailedGadget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheGadget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowFailedGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.ShowFailedGadget", true);
+        var parms = new ShowFailedGadget_Params();
+        parms.TheGadget = TheGadget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct ChangeState_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState NewState;
+    }
+
     /// <summary>
     /// Function: ChangeState
     /// </summary>
     public unsafe virtual void ChangeState(BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState NewState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.ChangeState", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewState, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.ChangeState", true);
+        var parms = new ChangeState_Params();
+        parms.NewState = NewState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CoordinatesToGadgetIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CoordinatesToGadgetIndex_Params
+    {
+        [FieldOffset(0)] public int Column;
+        [FieldOffset(4)] public int Row;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CoordinatesToGadgetIndex
     /// </summary>
     public unsafe virtual int CoordinatesToGadgetIndex(int Column, int Row)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.CoordinatesToGadgetIndex", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Column, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Row, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_CoordinatesToGadgetIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.CoordinatesToGadgetIndex", true);
+        var parms = new CoordinatesToGadgetIndex_Params();
+        parms.Column = Column;
+        parms.Row = Row;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateGadgetListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateGadgetList_Params
+    {
     }
 
     /// <summary>
@@ -242,56 +346,83 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe virtual void UpdateGadgetList()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.UpdateGadgetList", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateGadgetListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.UpdateGadgetList", true);
+        var parms = new UpdateGadgetList_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AutoSelectGadgetAndOpenHudFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct AutoSelectGadgetAndOpenHud_Params
+    {
+        [FieldOffset(0)] public nint GadgetClass;
+        [FieldOffset(4)] public int ShowChangeOnHud;
+    }
+
     /// <summary>
     /// Function: AutoSelectGadgetAndOpenHud
     /// </summary>
     public unsafe override void AutoSelectGadgetAndOpenHud(BmSDK.Class GadgetClass, bool ShowChangeOnHud = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.AutoSelectGadgetAndOpenHud", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GadgetClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ShowChangeOnHud, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AutoSelectGadgetAndOpenHudFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.AutoSelectGadgetAndOpenHud", true);
+        var parms = new AutoSelectGadgetAndOpenHud_Params();
+        parms.GadgetClass = GadgetClass?.Ptr ?? 0;
+        parms.ShowChangeOnHud = ShowChangeOnHud ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayedGadgetChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisplayedGadgetChanged_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisplayedGadgetChanged
     /// </summary>
     public unsafe override void DisplayedGadgetChanged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.DisplayedGadgetChanged", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayedGadgetChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.DisplayedGadgetChanged", true);
+        var parms = new DisplayedGadgetChanged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SynchroniseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Synchronise_Params
+    {
+    }
+
     /// <summary>
     /// Function: Synchronise
     /// </summary>
     public unsafe virtual void Synchronise()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.Synchronise", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SynchroniseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.Synchronise", true);
+        var parms = new Synchronise_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint PC;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectBM2.Init", true);
+        var parms = new Init_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -317,64 +448,64 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(BmSDK.FName*)(Ptr + 84); }
+        set { *(BmSDK.FName*)(Ptr + 84) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.FName*)(Ptr + 92); }
+        set { *(BmSDK.FName*)(Ptr + 92) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(BmSDK.FName*)(Ptr + 100); }
+        set { *(BmSDK.FName*)(Ptr + 100) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(BmSDK.FName*)(Ptr + 108); }
+        set { *(BmSDK.FName*)(Ptr + 108) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(BmSDK.FName*)(Ptr + 116); }
+        set { *(BmSDK.FName*)(Ptr + 116) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(BmSDK.FName*)(Ptr + 124); }
+        set { *(BmSDK.FName*)(Ptr + 124) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(BmSDK.FName*)(Ptr + 132); }
+        set { *(BmSDK.FName*)(Ptr + 132) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(BmSDK.FName*)(Ptr + 140); }
+        set { *(BmSDK.FName*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -382,8 +513,8 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe int CurrentDisplayGadget
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(int*)(Ptr + 148); }
+        set { *(int*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -391,8 +522,8 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe int CurrentDoubleGadgetIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(int*)(Ptr + 152); }
+        set { *(int*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -400,8 +531,8 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe int RequiredGadgetIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(int*)(Ptr + 156); }
+        set { *(int*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -418,8 +549,8 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState CurrentState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState*)(Ptr + 164); }
+        set { *(BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState*)(Ptr + 164) = value; }
     }
 
     /// <summary>
@@ -427,8 +558,8 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState PreviousOpenState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState>(Ptr + 165); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 165); }
+        get { return *(BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState*)(Ptr + 165); }
+        set { *(BmSDK.BmGame.RGadgetSelectBM2.EGadgetSelectState*)(Ptr + 165) = value; }
     }
 
     /// <summary>
@@ -436,7 +567,7 @@ public partial class RGadgetSelectBM2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameO
     /// </summary>
     public unsafe bool bIsSynced
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 168) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 168); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 168); }
+        get { return (*(int*)(Ptr + 168) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 168) |= 1; else *(int*)(Ptr + 168) &= ~1; }
     }
 }
@@ -78,121 +78,189 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
         where TComponent : class, Framework.IScriptComponent<RGadgetSelectV2>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PawnChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PawnChanged_Params
+    {
+    }
+
     /// <summary>
     /// Function: PawnChanged
     /// </summary>
     public unsafe override void PawnChanged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.PawnChanged", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PawnChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.PawnChanged", true);
+        var parms = new PawnChanged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideGadgetSelectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideGadgetSelect_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideGadgetSelect
     /// </summary>
     public unsafe override void HideGadgetSelect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.HideGadgetSelect", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideGadgetSelectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.HideGadgetSelect", true);
+        var parms = new HideGadgetSelect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GadgetUpdatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GadgetUpdated_Params
+    {
+    }
+
     /// <summary>
     /// Function: GadgetUpdated
     /// </summary>
     public unsafe override void GadgetUpdated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.GadgetUpdated", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GadgetUpdatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.GadgetUpdated", true);
+        var parms = new GadgetUpdated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoubleGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DoubleGadget_Params
+    {
+        [FieldOffset(0)] public byte Row;
+        [FieldOffset(1)] public byte Column;
+    }
+
     /// <summary>
     /// Function: DoubleGadget
     /// </summary>
     public unsafe override void DoubleGadget(byte Row, byte Column)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.DoubleGadget", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Row, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Column, paramsPtr + 1);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoubleGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.DoubleGadget", true);
+        var parms = new DoubleGadget_Params();
+        parms.Row = Row;
+        parms.Column = Column;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GadgetSelectedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GadgetSelected_Params
+    {
+        [FieldOffset(0)] public byte Row;
+        [FieldOffset(1)] public byte Column;
+    }
+
     /// <summary>
     /// Function: GadgetSelected
     /// </summary>
     public unsafe override void GadgetSelected(byte Row, byte Column)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.GadgetSelected", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Row, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Column, paramsPtr + 1);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GadgetSelectedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.GadgetSelected", true);
+        var parms = new GadgetSelected_Params();
+        parms.Row = Row;
+        parms.Column = Column;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.Tick", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct DrawHUD_Params
+    {
+        [FieldOffset(0)] public nint H;
+    }
+
     /// <summary>
     /// Function: DrawHUD
     /// </summary>
     public unsafe override void DrawHUD(BmSDK.Engine.HUD H)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.DrawHUD", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(H, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.DrawHUD", true);
+        var parms = new DrawHUD_Params();
+        parms.H = H?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct ChangeState_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGadgetSelectV2.EGadgetSelectState NewState;
+    }
+
     /// <summary>
     /// Function: ChangeState
     /// </summary>
     public unsafe virtual void ChangeState(BmSDK.BmGame.RGadgetSelectV2.EGadgetSelectState NewState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.ChangeState", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewState, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.ChangeState", true);
+        var parms = new ChangeState_Params();
+        parms.NewState = NewState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateGadgetListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateGadgetList_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateGadgetList
     /// </summary>
     public unsafe virtual void UpdateGadgetList()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.UpdateGadgetList", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateGadgetListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.UpdateGadgetList", true);
+        var parms = new UpdateGadgetList_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint PC;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGadgetSelectV2.Init", true);
+        var parms = new Init_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -294,72 +362,72 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
     /// </summary>
     public unsafe int UpSelectIndex_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 188); }
+        get { return *(int*)(Ptr + 188); }
+        set { *(int*)(Ptr + 188) = value; }
     }
     /// <summary>
     /// IntProperty: UpSelectIndex
     /// </summary>
     public unsafe int UpSelectIndex_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+        get { return *(int*)(Ptr + 192); }
+        set { *(int*)(Ptr + 192) = value; }
     }
     /// <summary>
     /// IntProperty: UpSelectIndex
     /// </summary>
     public unsafe int UpSelectIndex_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 196); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 196); }
+        get { return *(int*)(Ptr + 196); }
+        set { *(int*)(Ptr + 196) = value; }
     }
     /// <summary>
     /// IntProperty: UpSelectIndex
     /// </summary>
     public unsafe int UpSelectIndex_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 200); }
+        get { return *(int*)(Ptr + 200); }
+        set { *(int*)(Ptr + 200) = value; }
     }
     /// <summary>
     /// IntProperty: UpSelectIndex
     /// </summary>
     public unsafe int UpSelectIndex_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(int*)(Ptr + 204); }
+        set { *(int*)(Ptr + 204) = value; }
     }
     /// <summary>
     /// IntProperty: UpSelectIndex
     /// </summary>
     public unsafe int UpSelectIndex_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(int*)(Ptr + 208); }
+        set { *(int*)(Ptr + 208) = value; }
     }
     /// <summary>
     /// IntProperty: UpSelectIndex
     /// </summary>
     public unsafe int UpSelectIndex_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(int*)(Ptr + 212); }
+        set { *(int*)(Ptr + 212) = value; }
     }
     /// <summary>
     /// IntProperty: UpSelectIndex
     /// </summary>
     public unsafe int UpSelectIndex_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(int*)(Ptr + 216); }
+        set { *(int*)(Ptr + 216) = value; }
     }
     /// <summary>
     /// IntProperty: UpSelectIndex
     /// </summary>
     public unsafe int UpSelectIndex_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(int*)(Ptr + 220); }
+        set { *(int*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -372,72 +440,72 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
     /// </summary>
     public unsafe int DownSelectIndex_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(int*)(Ptr + 224); }
+        set { *(int*)(Ptr + 224) = value; }
     }
     /// <summary>
     /// IntProperty: DownSelectIndex
     /// </summary>
     public unsafe int DownSelectIndex_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(int*)(Ptr + 228); }
+        set { *(int*)(Ptr + 228) = value; }
     }
     /// <summary>
     /// IntProperty: DownSelectIndex
     /// </summary>
     public unsafe int DownSelectIndex_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(int*)(Ptr + 232); }
+        set { *(int*)(Ptr + 232) = value; }
     }
     /// <summary>
     /// IntProperty: DownSelectIndex
     /// </summary>
     public unsafe int DownSelectIndex_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(int*)(Ptr + 236); }
+        set { *(int*)(Ptr + 236) = value; }
     }
     /// <summary>
     /// IntProperty: DownSelectIndex
     /// </summary>
     public unsafe int DownSelectIndex_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(int*)(Ptr + 240); }
+        set { *(int*)(Ptr + 240) = value; }
     }
     /// <summary>
     /// IntProperty: DownSelectIndex
     /// </summary>
     public unsafe int DownSelectIndex_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(int*)(Ptr + 244); }
+        set { *(int*)(Ptr + 244) = value; }
     }
     /// <summary>
     /// IntProperty: DownSelectIndex
     /// </summary>
     public unsafe int DownSelectIndex_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(int*)(Ptr + 248); }
+        set { *(int*)(Ptr + 248) = value; }
     }
     /// <summary>
     /// IntProperty: DownSelectIndex
     /// </summary>
     public unsafe int DownSelectIndex_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(int*)(Ptr + 252); }
+        set { *(int*)(Ptr + 252) = value; }
     }
     /// <summary>
     /// IntProperty: DownSelectIndex
     /// </summary>
     public unsafe int DownSelectIndex_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(int*)(Ptr + 256); }
+        set { *(int*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -541,64 +609,64 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(BmSDK.FName*)(Ptr + 376); }
+        set { *(BmSDK.FName*)(Ptr + 376) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }
+        get { return *(BmSDK.FName*)(Ptr + 384); }
+        set { *(BmSDK.FName*)(Ptr + 384) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(BmSDK.FName*)(Ptr + 392); }
+        set { *(BmSDK.FName*)(Ptr + 392) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }
+        get { return *(BmSDK.FName*)(Ptr + 400); }
+        set { *(BmSDK.FName*)(Ptr + 400) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgets_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.FName*)(Ptr + 432); }
+        set { *(BmSDK.FName*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -611,64 +679,64 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.FName CurrentExtraGadgets_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(BmSDK.FName*)(Ptr + 440); }
+        set { *(BmSDK.FName*)(Ptr + 440) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentExtraGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentExtraGadgets_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(BmSDK.FName*)(Ptr + 448); }
+        set { *(BmSDK.FName*)(Ptr + 448) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentExtraGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentExtraGadgets_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(BmSDK.FName*)(Ptr + 456); }
+        set { *(BmSDK.FName*)(Ptr + 456) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentExtraGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentExtraGadgets_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(BmSDK.FName*)(Ptr + 464); }
+        set { *(BmSDK.FName*)(Ptr + 464) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentExtraGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentExtraGadgets_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(BmSDK.FName*)(Ptr + 472); }
+        set { *(BmSDK.FName*)(Ptr + 472) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentExtraGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentExtraGadgets_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(BmSDK.FName*)(Ptr + 480); }
+        set { *(BmSDK.FName*)(Ptr + 480) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentExtraGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentExtraGadgets_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(BmSDK.FName*)(Ptr + 488); }
+        set { *(BmSDK.FName*)(Ptr + 488) = value; }
     }
     /// <summary>
     /// NameProperty: CurrentExtraGadgets
     /// </summary>
     public unsafe BmSDK.FName CurrentExtraGadgets_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(BmSDK.FName*)(Ptr + 496); }
+        set { *(BmSDK.FName*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -681,64 +749,64 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
     /// </summary>
     public unsafe byte CurrentAllowSubClasses_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }
+        get { return *(byte*)(Ptr + 504); }
+        set { *(byte*)(Ptr + 504) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentAllowSubClasses
     /// </summary>
     public unsafe byte CurrentAllowSubClasses_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 505); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 505); }
+        get { return *(byte*)(Ptr + 505); }
+        set { *(byte*)(Ptr + 505) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentAllowSubClasses
     /// </summary>
     public unsafe byte CurrentAllowSubClasses_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 506); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 506); }
+        get { return *(byte*)(Ptr + 506); }
+        set { *(byte*)(Ptr + 506) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentAllowSubClasses
     /// </summary>
     public unsafe byte CurrentAllowSubClasses_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 507); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 507); }
+        get { return *(byte*)(Ptr + 507); }
+        set { *(byte*)(Ptr + 507) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentAllowSubClasses
     /// </summary>
     public unsafe byte CurrentAllowSubClasses_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 508); }
+        get { return *(byte*)(Ptr + 508); }
+        set { *(byte*)(Ptr + 508) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentAllowSubClasses
     /// </summary>
     public unsafe byte CurrentAllowSubClasses_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 509); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 509); }
+        get { return *(byte*)(Ptr + 509); }
+        set { *(byte*)(Ptr + 509) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentAllowSubClasses
     /// </summary>
     public unsafe byte CurrentAllowSubClasses_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 510); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 510); }
+        get { return *(byte*)(Ptr + 510); }
+        set { *(byte*)(Ptr + 510) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentAllowSubClasses
     /// </summary>
     public unsafe byte CurrentAllowSubClasses_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 511); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 511); }
+        get { return *(byte*)(Ptr + 511); }
+        set { *(byte*)(Ptr + 511) = value; }
     }
 
     /// <summary>
@@ -746,8 +814,8 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.BmGame.RGadgetSelectV2.EGadgetSelectState CurrentState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGadgetSelectV2.EGadgetSelectState>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(BmSDK.BmGame.RGadgetSelectV2.EGadgetSelectState*)(Ptr + 512); }
+        set { *(BmSDK.BmGame.RGadgetSelectV2.EGadgetSelectState*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -760,72 +828,72 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
     /// </summary>
     public unsafe int CurrentSelectIndex_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(int*)(Ptr + 516); }
+        set { *(int*)(Ptr + 516) = value; }
     }
     /// <summary>
     /// IntProperty: CurrentSelectIndex
     /// </summary>
     public unsafe int CurrentSelectIndex_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 520); }
+        get { return *(int*)(Ptr + 520); }
+        set { *(int*)(Ptr + 520) = value; }
     }
     /// <summary>
     /// IntProperty: CurrentSelectIndex
     /// </summary>
     public unsafe int CurrentSelectIndex_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(int*)(Ptr + 524); }
+        set { *(int*)(Ptr + 524) = value; }
     }
     /// <summary>
     /// IntProperty: CurrentSelectIndex
     /// </summary>
     public unsafe int CurrentSelectIndex_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 528); }
+        get { return *(int*)(Ptr + 528); }
+        set { *(int*)(Ptr + 528) = value; }
     }
     /// <summary>
     /// IntProperty: CurrentSelectIndex
     /// </summary>
     public unsafe int CurrentSelectIndex_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(int*)(Ptr + 532); }
+        set { *(int*)(Ptr + 532) = value; }
     }
     /// <summary>
     /// IntProperty: CurrentSelectIndex
     /// </summary>
     public unsafe int CurrentSelectIndex_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }
+        get { return *(int*)(Ptr + 536); }
+        set { *(int*)(Ptr + 536) = value; }
     }
     /// <summary>
     /// IntProperty: CurrentSelectIndex
     /// </summary>
     public unsafe int CurrentSelectIndex_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(int*)(Ptr + 540); }
+        set { *(int*)(Ptr + 540) = value; }
     }
     /// <summary>
     /// IntProperty: CurrentSelectIndex
     /// </summary>
     public unsafe int CurrentSelectIndex_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 544); }
+        get { return *(int*)(Ptr + 544); }
+        set { *(int*)(Ptr + 544) = value; }
     }
     /// <summary>
     /// IntProperty: CurrentSelectIndex
     /// </summary>
     public unsafe int CurrentSelectIndex_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(int*)(Ptr + 548); }
+        set { *(int*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -833,7 +901,7 @@ public partial class RGadgetSelectV2 : BmSDK.BmGame.RGadgetSelect, BmSDK.IGameOb
     /// </summary>
     public unsafe int GadgetToDisplay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(int*)(Ptr + 552); }
+        set { *(int*)(Ptr + 552) = value; }
     }
 }
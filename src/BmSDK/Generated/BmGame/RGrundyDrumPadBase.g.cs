@@ -78,26 +78,39 @@ public partial class RGrundyDrumPadBase : BmSDK.Engine.SkeletalMeshActor, BmSDK.
         where TComponent : class, Framework.IScriptComponent<RGrundyDrumPadBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HitByExplosionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HitByExplosion_Params
+    {
+    }
+
     /// <summary>
     /// Function: HitByExplosion
     /// </summary>
     public unsafe virtual void HitByExplosion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGrundyDrumPadBase.HitByExplosion", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByExplosionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGrundyDrumPadBase.HitByExplosion", true);
+        var parms = new HitByExplosion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetVulnerabilityRadiusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetVulnerabilityRadius_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetVulnerabilityRadius
     /// </summary>
     public unsafe virtual float GetVulnerabilityRadius()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGrundyDrumPadBase.GetVulnerabilityRadius", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetVulnerabilityRadiusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RGrundyDrumPadBase.GetVulnerabilityRadius", true);
+        var parms = new GetVulnerabilityRadius_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -78,29 +78,51 @@ public partial class RHUDPrompt : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RHUDPrompt>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetHighPriorityInstructionsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetHighPriorityInstructions_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString NewInstructions;
+    }
+
     /// <summary>
     /// Function: SetHighPriorityInstructions
     /// </summary>
     public unsafe virtual void SetHighPriorityInstructions(BmSDK.FString NewInstructions)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.SetHighPriorityInstructions", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewInstructions, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHighPriorityInstructionsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.SetHighPriorityInstructions", true);
+        var parms = new SetHighPriorityInstructions_Params();
+        parms.NewInstructions = NewInstructions;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInstructionsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SetInstructions_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString NewInstructions;
+        [FieldOffset(12)] public int CanOverrideEmptyKismet;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SetInstructions
     /// </summary>
     public unsafe virtual bool SetInstructions(BmSDK.FString NewInstructions, bool CanOverrideEmptyKismet = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.SetInstructions", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewInstructions, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CanOverrideEmptyKismet, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_SetInstructionsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.SetInstructions", true);
+        var parms = new SetInstructions_Params();
+        parms.NewInstructions = NewInstructions;
+        parms.CanOverrideEmptyKismet = CanOverrideEmptyKismet ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetLinesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetLines_Params
+    {
     }
 
     /// <summary>
@@ -108,102 +130,125 @@ public partial class RHUDPrompt : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void GetLines()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.GetLines", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GetLinesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.GetLines", true);
+        var parms = new GetLines_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetOverridePromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 13)]
+    private struct SetOverridePrompt_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+        [FieldOffset(12)] public BmSDK.BmGame.RHUDPrompt.EControlIcon Icon;
+    }
+
     /// <summary>
     /// Function: SetOverridePrompt
     /// </summary>
     public unsafe virtual void SetOverridePrompt(BmSDK.FString Text, BmSDK.BmGame.RHUDPrompt.EControlIcon Icon = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.SetOverridePrompt", true);
-        byte* paramsPtr = stackalloc byte[13];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Icon, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetOverridePromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.SetOverridePrompt", true);
+        var parms = new SetOverridePrompt_Params();
+        parms.Text = Text;
+        parms.Icon = Icon;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DrawHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: DrawHUD
     /// </summary>
     public unsafe virtual void DrawHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.DrawHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.DrawHUD", true);
+        var parms = new DrawHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetLinesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetLines_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetLines
     /// </summary>
     public unsafe virtual void ResetLines()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.ResetLines", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ResetLinesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.ResetLines", true);
+        var parms = new ResetLines_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct AddLine_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+        [FieldOffset(12)] public BmSDK.BmGame.RHUDPrompt.EControlIcon Icon;
+        [FieldOffset(16)] public int Main;
+        [FieldOffset(20)] public int bHammerButton;
+        [FieldOffset(24)] public int bAddHighlight;
+    }
+
     /// <summary>
     /// Function: AddLine
     /// </summary>
     public unsafe virtual void AddLine(BmSDK.FString Text, BmSDK.BmGame.RHUDPrompt.EControlIcon Icon = default, bool Main = default, bool bHammerButton = default, bool bAddHighlight = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.AddLine", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Icon, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Main, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHammerButton, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAddHighlight, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_AddLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.AddLine", true);
+        var parms = new AddLine_Params();
+        parms.Text = Text;
+        parms.Icon = Icon;
+        parms.Main = Main ? 1 : 0;
+        parms.bHammerButton = bHammerButton ? 1 : 0;
+        parms.bAddHighlight = bAddHighlight ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HelpLinesMatchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct HelpLinesMatch_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RHUDPrompt.FHelpLine HL1;
+        [FieldOffset(20)] public BmSDK.BmGame.RHUDPrompt.FHelpLine HL2;
+        [FieldOffset(40)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HelpLinesMatch
     /// </summary>
     public unsafe virtual bool HelpLinesMatch(out BmSDK.BmGame.RHUDPrompt.FHelpLine HL1, out BmSDK.BmGame.RHUDPrompt.FHelpLine HL2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.HelpLinesMatch", true);
-        byte* paramsPtr = stackalloc byte[44];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        HL1 = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RHUDPrompt.FHelpLine>(paramsPtr + 0);
-        HL2 = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RHUDPrompt.FHelpLine>(paramsPtr + 20);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 40);
+        var funcManaged = s_HelpLinesMatchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.HelpLinesMatch", true);
+        var parms = new HelpLinesMatch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        HL1 = parms.HL1;
+        HL2 = parms.HL2;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AddTutorialLineLocFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct AddTutorialLineLoc_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+        [FieldOffset(12)] public BmSDK.BmGame.RHUDPrompt.EControlIcon Icon;
+        [FieldOffset(16)] public int Main;
+        [FieldOffset(20)] public int bHammerButton;
+        [FieldOffset(24)] public int bAddHighlight;
     }
 
     /// <summary>
@@ -211,46 +256,68 @@ public partial class RHUDPrompt : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void AddTutorialLineLoc(BmSDK.FString Text, BmSDK.BmGame.RHUDPrompt.EControlIcon Icon = default, bool Main = default, bool bHammerButton = default, bool bAddHighlight = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.AddTutorialLineLoc", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Icon, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Main, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHammerButton, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAddHighlight, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddTutorialLineLocFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.AddTutorialLineLoc", true);
+        var parms = new AddTutorialLineLoc_Params();
+        parms.Text = Text;
+        parms.Icon = Icon;
+        parms.Main = Main ? 1 : 0;
+        parms.bHammerButton = bHammerButton ? 1 : 0;
+        parms.bAddHighlight = bAddHighlight ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddGadgetLineLocFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct AddGadgetLineLoc_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+        [FieldOffset(12)] public BmSDK.BmGame.RHUDPrompt.EControlIcon Icon;
+        [FieldOffset(16)] public int Main;
+        [FieldOffset(20)] public int bHammerButton;
+        [FieldOffset(24)] public int bAddHighlight;
+    }
+
     /// <summary>
     /// Function: AddGadgetLineLoc
     /// </summary>
     public unsafe virtual void AddGadgetLineLoc(BmSDK.FString Text, BmSDK.BmGame.RHUDPrompt.EControlIcon Icon = default, bool Main = default, bool bHammerButton = default, bool bAddHighlight = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.AddGadgetLineLoc", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Icon, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Main, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHammerButton, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAddHighlight, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddGadgetLineLocFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.AddGadgetLineLoc", true);
+        var parms = new AddGadgetLineLoc_Params();
+        parms.Text = Text;
+        parms.Icon = Icon;
+        parms.Main = Main ? 1 : 0;
+        parms.bHammerButton = bHammerButton ? 1 : 0;
+        parms.bAddHighlight = bAddHighlight ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddLineLocFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct AddLineLoc_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+        [FieldOffset(12)] public BmSDK.BmGame.RHUDPrompt.EControlIcon Icon;
+        [FieldOffset(16)] public int Main;
+        [FieldOffset(20)] public int bHammerButton;
+        [FieldOffset(24)] public int bAddHighlight;
+    }
+
     /// <summary>
     /// Function: AddLineLoc
     /// </summary>
     public unsafe virtual void AddLineLoc(BmSDK.FString Text, BmSDK.BmGame.RHUDPrompt.EControlIcon Icon = default, bool Main = default, bool bHammerButton = default, bool bAddHighlight = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.AddLineLoc", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Icon, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Main, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHammerButton, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAddHighlight, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddLineLocFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHUDPrompt.AddLineLoc", true);
+        var parms = new AddLineLoc_Params();
+        parms.Text = Text;
+        parms.Icon = Icon;
+        parms.Main = Main ? 1 : 0;
+        parms.bHammerButton = bHammerButton ? 1 : 0;
+        parms.bAddHighlight = bAddHighlight ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -268,8 +335,8 @@ public partial class RHUDPrompt : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverridePromptIsActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1; else *(int*)(Ptr + 48) &= ~1; }
     }
 
     /// <summary>
@@ -277,8 +344,8 @@ public partial class RHUDPrompt : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverridePromptShouldBeActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 2; else *(int*)(Ptr + 48) &= ~2; }
     }
 
     /// <summary>
@@ -371,20 +438,12 @@ public partial class RHUDPrompt : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: Icon
         /// </summary>
-        public unsafe BmSDK.BmGame.RHUDPrompt.EControlIcon Icon
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RHUDPrompt.EControlIcon>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RHUDPrompt.EControlIcon Icon;
 
         /// <summary>
         /// IntProperty: Alpha
         /// </summary>
-        public unsafe int Alpha
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int Alpha;
     }
 
     /// <summary>
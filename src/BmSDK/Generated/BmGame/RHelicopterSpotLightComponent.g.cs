@@ -83,7 +83,7 @@ public partial class RHelicopterSpotLightComponent : BmSDK.Engine.SpotLightCompo
     /// </summary>
     public unsafe bool AbsoluteRotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 548) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 548); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 548); }
+        get { return (*(int*)(Ptr + 548) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 548) |= 1; else *(int*)(Ptr + 548) &= ~1; }
     }
 }
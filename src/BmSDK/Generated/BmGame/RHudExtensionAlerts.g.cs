@@ -78,162 +78,256 @@ public partial class RHudExtensionAlerts : BmSDK.BmGame.RHudExtension, BmSDK.IGa
         where TComponent : class, Framework.IScriptComponent<RHudExtensionAlerts>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetInvestigateModeActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetInvestigateModeActive_Params
+    {
+        [FieldOffset(0)] public int InvModeActive;
+    }
+
     /// <summary>
     /// Function: SetInvestigateModeActive
     /// </summary>
     public unsafe virtual void SetInvestigateModeActive(bool InvModeActive)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetInvestigateModeActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InvModeActive, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInvestigateModeActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetInvestigateModeActive", true);
+        var parms = new SetInvestigateModeActive_Params();
+        parms.InvModeActive = InvModeActive ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetIsInvestigateModeAutoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetIsInvestigateModeAuto_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetIsInvestigateModeAuto
     /// </summary>
     public unsafe virtual void SetIsInvestigateModeAuto()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetIsInvestigateModeAuto", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetIsInvestigateModeAutoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetIsInvestigateModeAuto", true);
+        var parms = new SetIsInvestigateModeAuto_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMovieStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetMovieState_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString movie_name;
+        [FieldOffset(12)] public BmSDK.FString target_frame;
+    }
+
     /// <summary>
     /// Function: SetMovieState
     /// </summary>
     public unsafe virtual void SetMovieState(BmSDK.FString movie_name, BmSDK.FString target_frame)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetMovieState", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(movie_name, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(target_frame, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMovieStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetMovieState", true);
+        var parms = new SetMovieState_Params();
+        parms.movie_name = movie_name;
+        parms.target_frame = target_frame;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideForensicAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideForensicAlert_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideForensicAlert
     /// </summary>
     public unsafe virtual void HideForensicAlert()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.HideForensicAlert", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideForensicAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.HideForensicAlert", true);
+        var parms = new HideForensicAlert_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetForensicAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetForensicAlert_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString forensic_text;
+    }
+
     /// <summary>
     /// Function: SetForensicAlert
     /// </summary>
     public unsafe virtual void SetForensicAlert(BmSDK.FString forensic_text)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetForensicAlert", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(forensic_text, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetForensicAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetForensicAlert", true);
+        var parms = new SetForensicAlert_Params();
+        parms.forensic_text = forensic_text;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideAudioAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideAudioAlert_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideAudioAlert
     /// </summary>
     public unsafe virtual void HideAudioAlert()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.HideAudioAlert", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideAudioAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.HideAudioAlert", true);
+        var parms = new HideAudioAlert_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRingingPhoneAngleAndDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetRingingPhoneAngleAndDistance_Params
+    {
+        [FieldOffset(0)] public float the_angle;
+        [FieldOffset(4)] public int distance_metres;
+    }
+
     /// <summary>
     /// Function: SetRingingPhoneAngleAndDistance
     /// </summary>
     public unsafe virtual void SetRingingPhoneAngleAndDistance(float the_angle, int distance_metres)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetRingingPhoneAngleAndDistance", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(the_angle, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(distance_metres, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRingingPhoneAngleAndDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetRingingPhoneAngleAndDistance", true);
+        var parms = new SetRingingPhoneAngleAndDistance_Params();
+        parms.the_angle = the_angle;
+        parms.distance_metres = distance_metres;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRingingPhoneDetailFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetRingingPhoneDetail_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString telephone_number;
+    }
+
     /// <summary>
     /// Function: SetRingingPhoneDetail
     /// </summary>
     public unsafe virtual void SetRingingPhoneDetail(BmSDK.FString telephone_number)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetRingingPhoneDetail", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(telephone_number, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRingingPhoneDetailFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetRingingPhoneDetail", true);
+        var parms = new SetRingingPhoneDetail_Params();
+        parms.telephone_number = telephone_number;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInterceptAngleAndRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetInterceptAngleAndRange_Params
+    {
+        [FieldOffset(0)] public float intercept_angle;
+        [FieldOffset(4)] public int distance_metres;
+    }
+
     /// <summary>
     /// Function: SetInterceptAngleAndRange
     /// </summary>
     public unsafe virtual void SetInterceptAngleAndRange(float intercept_angle, int distance_metres)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetInterceptAngleAndRange", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(intercept_angle, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(distance_metres, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInterceptAngleAndRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetInterceptAngleAndRange", true);
+        var parms = new SetInterceptAngleAndRange_Params();
+        parms.intercept_angle = intercept_angle;
+        parms.distance_metres = distance_metres;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRadioInterceptAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetRadioInterceptAlert_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString text1;
+        [FieldOffset(12)] public BmSDK.FString text2;
+    }
+
     /// <summary>
     /// Function: SetRadioInterceptAlert
     /// </summary>
     public unsafe virtual void SetRadioInterceptAlert(BmSDK.FString text1, BmSDK.FString text2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetRadioInterceptAlert", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(text1, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(text2, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRadioInterceptAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetRadioInterceptAlert", true);
+        var parms = new SetRadioInterceptAlert_Params();
+        parms.text1 = text1;
+        parms.text2 = text2;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetAudioFrameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetAudioFrame_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString new_frame;
+    }
+
     /// <summary>
     /// Function: SetAudioFrame
     /// </summary>
     public unsafe virtual void SetAudioFrame(BmSDK.FString new_frame)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetAudioFrame", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_frame, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAudioFrameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.SetAudioFrame", true);
+        var parms = new SetAudioFrame_Params();
+        parms.new_frame = new_frame;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Close_Params
+    {
+    }
+
     /// <summary>
     /// Function: Close
     /// </summary>
     public unsafe override void Close()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.Close", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.Close", true);
+        var parms = new Close_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+        [FieldOffset(4)] public BmSDK.FString _ExtensionName;
+        [FieldOffset(16)] public BmSDK.FString _ExtensionPath;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(BmSDK.BmGame.RPlayerController _RPC, BmSDK.FString _ExtensionName, BmSDK.FString _ExtensionPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.Init", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionPath, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionAlerts.Init", true);
+        var parms = new Init_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        parms._ExtensionName = _ExtensionName;
+        parms._ExtensionPath = _ExtensionPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
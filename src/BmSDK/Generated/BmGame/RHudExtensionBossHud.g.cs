@@ -78,204 +78,320 @@ public partial class RHudExtensionBossHud : BmSDK.BmGame.RHudExtension, BmSDK.IG
         where TComponent : class, Framework.IScriptComponent<RHudExtensionBossHud>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetTelemetryInformationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetTelemetryInformation_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ColourMode;
+        [FieldOffset(12)] public BmSDK.FString TelemetryMessage;
+    }
+
     /// <summary>
     /// Function: SetTelemetryInformation
     /// </summary>
     public unsafe virtual void SetTelemetryInformation(BmSDK.FString ColourMode, BmSDK.FString TelemetryMessage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetTelemetryInformation", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ColourMode, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TelemetryMessage, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTelemetryInformationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetTelemetryInformation", true);
+        var parms = new SetTelemetryInformation_Params();
+        parms.ColourMode = ColourMode;
+        parms.TelemetryMessage = TelemetryMessage;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FailedJammingAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FailedJammingAlert_Params
+    {
+    }
+
     /// <summary>
     /// Function: FailedJammingAlert
     /// </summary>
     public unsafe virtual void FailedJammingAlert()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.FailedJammingAlert", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FailedJammingAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.FailedJammingAlert", true);
+        var parms = new FailedJammingAlert_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AbortDetectiveJammingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AbortDetectiveJamming_Params
+    {
+    }
+
     /// <summary>
     /// Function: AbortDetectiveJamming
     /// </summary>
     public unsafe virtual void AbortDetectiveJamming()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.AbortDetectiveJamming", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AbortDetectiveJammingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.AbortDetectiveJamming", true);
+        var parms = new AbortDetectiveJamming_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitiateDetectiveJammingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InitiateDetectiveJamming_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitiateDetectiveJamming
     /// </summary>
     public unsafe virtual void InitiateDetectiveJamming()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.InitiateDetectiveJamming", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitiateDetectiveJammingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.InitiateDetectiveJamming", true);
+        var parms = new InitiateDetectiveJamming_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowLockingOnStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowLockingOnState_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowLockingOnState
     /// </summary>
     public unsafe virtual void ShowLockingOnState(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.ShowLockingOnState", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowLockingOnStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.ShowLockingOnState", true);
+        var parms = new ShowLockingOnState_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDetectiveJammerLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetDetectiveJammerLevel_Params
+    {
+        [FieldOffset(0)] public float zeroToOne;
+    }
+
     /// <summary>
     /// Function: SetDetectiveJammerLevel
     /// </summary>
     public unsafe virtual void SetDetectiveJammerLevel(float zeroToOne)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetDetectiveJammerLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(zeroToOne, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDetectiveJammerLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetDetectiveJammerLevel", true);
+        var parms = new SetDetectiveJammerLevel_Params();
+        parms.zeroToOne = zeroToOne;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInvestigateModeActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetInvestigateModeActive_Params
+    {
+        [FieldOffset(0)] public int InvModeActive;
+    }
+
     /// <summary>
     /// Function: SetInvestigateModeActive
     /// </summary>
     public unsafe virtual void SetInvestigateModeActive(bool InvModeActive)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetInvestigateModeActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InvModeActive, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInvestigateModeActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetInvestigateModeActive", true);
+        var parms = new SetInvestigateModeActive_Params();
+        parms.InvModeActive = InvModeActive ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetIsInvestigateModeAutoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetIsInvestigateModeAuto_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetIsInvestigateModeAuto
     /// </summary>
     public unsafe virtual void SetIsInvestigateModeAuto()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetIsInvestigateModeAuto", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetIsInvestigateModeAutoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetIsInvestigateModeAuto", true);
+        var parms = new SetIsInvestigateModeAuto_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopRechargeGenericFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopRechargeGeneric_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopRechargeGeneric
     /// </summary>
     public unsafe virtual void StopRechargeGeneric()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.StopRechargeGeneric", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopRechargeGenericFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.StopRechargeGeneric", true);
+        var parms = new StopRechargeGeneric_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartRechargeGenericFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartRechargeGeneric_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartRechargeGeneric
     /// </summary>
     public unsafe virtual void StartRechargeGeneric()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.StartRechargeGeneric", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartRechargeGenericFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.StartRechargeGeneric", true);
+        var parms = new StartRechargeGeneric_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShakeBossHealthBarGenericFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShakeBossHealthBarGeneric_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShakeBossHealthBarGeneric
     /// </summary>
     public unsafe virtual void ShakeBossHealthBarGeneric()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.ShakeBossHealthBarGeneric", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShakeBossHealthBarGenericFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.ShakeBossHealthBarGeneric", true);
+        var parms = new ShakeBossHealthBarGeneric_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShakeBossHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShakeBossHealthBar_Params
+    {
+        [FieldOffset(0)] public int shake_magnitude;
+        [FieldOffset(4)] public float shake_duration;
+    }
+
     /// <summary>
     /// Function: ShakeBossHealthBar
     /// </summary>
     public unsafe virtual void ShakeBossHealthBar(int shake_magnitude, float shake_duration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.ShakeBossHealthBar", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(shake_magnitude, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(shake_duration, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShakeBossHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.ShakeBossHealthBar", true);
+        var parms = new ShakeBossHealthBar_Params();
+        parms.shake_magnitude = shake_magnitude;
+        parms.shake_duration = shake_duration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetBossArmourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetBossArmour_Params
+    {
+        [FieldOffset(0)] public float current_armour;
+    }
+
     /// <summary>
     /// Function: SetBossArmour
     /// </summary>
     public unsafe virtual void SetBossArmour(float current_armour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetBossArmour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(current_armour, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetBossArmourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetBossArmour", true);
+        var parms = new SetBossArmour_Params();
+        parms.current_armour = current_armour;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetBossHealthNoShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetBossHealthNoShake_Params
+    {
+        [FieldOffset(0)] public float new_health;
+    }
+
     /// <summary>
     /// Function: SetBossHealthNoShake
     /// </summary>
     public unsafe virtual void SetBossHealthNoShake(float new_health)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetBossHealthNoShake", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_health, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetBossHealthNoShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.SetBossHealthNoShake", true);
+        var parms = new SetBossHealthNoShake_Params();
+        parms.new_health = new_health;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitHealthBar_Params
+    {
+        [FieldOffset(0)] public float init_health;
+    }
+
     /// <summary>
     /// Function: InitHealthBar
     /// </summary>
     public unsafe virtual void InitHealthBar(float init_health)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.InitHealthBar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(init_health, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.InitHealthBar", true);
+        var parms = new InitHealthBar_Params();
+        parms.init_health = init_health;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Close_Params
+    {
+    }
+
     /// <summary>
     /// Function: Close
     /// </summary>
     public unsafe override void Close()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.Close", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.Close", true);
+        var parms = new Close_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+        [FieldOffset(4)] public BmSDK.FString _ExtensionName;
+        [FieldOffset(16)] public BmSDK.FString _ExtensionPath;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(BmSDK.BmGame.RPlayerController _RPC, BmSDK.FString _ExtensionName, BmSDK.FString _ExtensionPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.Init", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionPath, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionBossHud.Init", true);
+        var parms = new Init_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        parms._ExtensionName = _ExtensionName;
+        parms._ExtensionPath = _ExtensionPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -301,8 +417,8 @@ public partial class RHudExtensionBossHud : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool bInvestigateModeActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 156); }
+        get { return (*(int*)(Ptr + 156) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 156) |= 1; else *(int*)(Ptr + 156) &= ~1; }
     }
 
     /// <summary>
@@ -310,8 +426,8 @@ public partial class RHudExtensionBossHud : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool ShowPlayerHealthWhenBossHealthFirstShown
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 156); }
+        get { return (*(int*)(Ptr + 156) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 156) |= 2; else *(int*)(Ptr + 156) &= ~2; }
     }
 
     /// <summary>
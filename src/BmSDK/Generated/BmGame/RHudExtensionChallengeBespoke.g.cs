@@ -78,109 +78,175 @@ public partial class RHudExtensionChallengeBespoke : BmSDK.BmGame.RHudExtension,
         where TComponent : class, Framework.IScriptComponent<RHudExtensionChallengeBespoke>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UpdatePushYourLuckBandDetailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdatePushYourLuckBandDetails_Params
+    {
+        [FieldOffset(0)] public int Band_Index;
+        [FieldOffset(4)] public int Bonus_Points;
+        [FieldOffset(8)] public int Bonus_Time;
+    }
+
     /// <summary>
     /// Function: UpdatePushYourLuckBandDetails
     /// </summary>
     public unsafe virtual void UpdatePushYourLuckBandDetails(int Band_Index, int Bonus_Points, int Bonus_Time)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.UpdatePushYourLuckBandDetails", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Band_Index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bonus_Points, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bonus_Time, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdatePushYourLuckBandDetailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.UpdatePushYourLuckBandDetails", true);
+        var parms = new UpdatePushYourLuckBandDetails_Params();
+        parms.Band_Index = Band_Index;
+        parms.Bonus_Points = Bonus_Points;
+        parms.Bonus_Time = Bonus_Time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PushYourLuckShakeGaugeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PushYourLuckShakeGauge_Params
+    {
+    }
+
     /// <summary>
     /// Function: PushYourLuckShakeGauge
     /// </summary>
     public unsafe virtual void PushYourLuckShakeGauge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.PushYourLuckShakeGauge", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PushYourLuckShakeGaugeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.PushYourLuckShakeGauge", true);
+        var parms = new PushYourLuckShakeGauge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PushYourLuckBankValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PushYourLuckBankValue_Params
+    {
+        [FieldOffset(0)] public int bank_level;
+        [FieldOffset(4)] public int Score;
+        [FieldOffset(8)] public int Bonus_Time;
+        [FieldOffset(12)] public int max_gauge;
+    }
+
     /// <summary>
     /// Function: PushYourLuckBankValue
     /// </summary>
     public unsafe virtual void PushYourLuckBankValue(int bank_level, int Score, int Bonus_Time, bool max_gauge)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.PushYourLuckBankValue", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bank_level, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Score, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bonus_Time, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(max_gauge, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PushYourLuckBankValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.PushYourLuckBankValue", true);
+        var parms = new PushYourLuckBankValue_Params();
+        parms.bank_level = bank_level;
+        parms.Score = Score;
+        parms.Bonus_Time = Bonus_Time;
+        parms.max_gauge = max_gauge ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPushYourLuckGaugeValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetPushYourLuckGaugeValue_Params
+    {
+        [FieldOffset(0)] public int raw_value;
+    }
+
     /// <summary>
     /// Function: SetPushYourLuckGaugeValue
     /// </summary>
     public unsafe virtual void SetPushYourLuckGaugeValue(int raw_value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.SetPushYourLuckGaugeValue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(raw_value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPushYourLuckGaugeValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.SetPushYourLuckGaugeValue", true);
+        var parms = new SetPushYourLuckGaugeValue_Params();
+        parms.raw_value = raw_value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPushYourLuckBandDetailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SetPushYourLuckBandDetails_Params
+    {
+        [FieldOffset(0)] public int Band_Index;
+        [FieldOffset(4)] public BmSDK.FString Band_Title;
+        [FieldOffset(16)] public int Bonus_Points;
+        [FieldOffset(20)] public int Bonus_Time;
+        [FieldOffset(24)] public int GaugeValueForNext;
+    }
+
     /// <summary>
     /// Function: SetPushYourLuckBandDetails
     /// </summary>
     public unsafe virtual void SetPushYourLuckBandDetails(int Band_Index, BmSDK.FString Band_Title, int Bonus_Points, int Bonus_Time, int GaugeValueForNext)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.SetPushYourLuckBandDetails", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Band_Index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Band_Title, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bonus_Points, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bonus_Time, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GaugeValueForNext, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPushYourLuckBandDetailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.SetPushYourLuckBandDetails", true);
+        var parms = new SetPushYourLuckBandDetails_Params();
+        parms.Band_Index = Band_Index;
+        parms.Band_Title = Band_Title;
+        parms.Bonus_Points = Bonus_Points;
+        parms.Bonus_Time = Bonus_Time;
+        parms.GaugeValueForNext = GaugeValueForNext;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHeadToHeadBankLocalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetHeadToHeadBankLocal_Params
+    {
+        [FieldOffset(0)] public int bank_level;
+    }
+
     /// <summary>
     /// Function: SetHeadToHeadBankLocal
     /// </summary>
     public unsafe virtual void SetHeadToHeadBankLocal(int bank_level)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.SetHeadToHeadBankLocal", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bank_level, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHeadToHeadBankLocalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.SetHeadToHeadBankLocal", true);
+        var parms = new SetHeadToHeadBankLocal_Params();
+        parms.bank_level = bank_level;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Close_Params
+    {
+    }
+
     /// <summary>
     /// Function: Close
     /// </summary>
     public unsafe override void Close()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.Close", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.Close", true);
+        var parms = new Close_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+        [FieldOffset(4)] public BmSDK.FString _ExtensionName;
+        [FieldOffset(16)] public BmSDK.FString _ExtensionPath;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(BmSDK.BmGame.RPlayerController _RPC, BmSDK.FString _ExtensionName, BmSDK.FString _ExtensionPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.Init", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionPath, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionChallengeBespoke.Init", true);
+        var parms = new Init_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        parms._ExtensionName = _ExtensionName;
+        parms._ExtensionPath = _ExtensionPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -188,7 +254,7 @@ public partial class RHudExtensionChallengeBespoke : BmSDK.BmGame.RHudExtension,
     /// </summary>
     public unsafe bool SuppressDetectiveModeInfo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 1; else *(int*)(Ptr + 132) &= ~1; }
     }
 }
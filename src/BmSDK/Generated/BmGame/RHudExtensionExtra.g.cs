@@ -78,69 +78,119 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
         where TComponent : class, Framework.IScriptComponent<RHudExtensionExtra>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HideProximityInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HideProximityInfo_Params
+    {
+        [FieldOffset(0)] public int enemy_index;
+    }
+
     /// <summary>
     /// Function: HideProximityInfo
     /// </summary>
     public unsafe virtual void HideProximityInfo(int enemy_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.HideProximityInfo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(enemy_index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideProximityInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.HideProximityInfo", true);
+        var parms = new HideProximityInfo_Params();
+        parms.enemy_index = enemy_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendProximityInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SendProximityInfo_Params
+    {
+        [FieldOffset(0)] public int enemy_index;
+        [FieldOffset(4)] public float Angle;
+        [FieldOffset(8)] public float Proximity;
+    }
+
     /// <summary>
     /// Function: SendProximityInfo
     /// </summary>
     public unsafe virtual void SendProximityInfo(int enemy_index, float Angle, float Proximity)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SendProximityInfo", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(enemy_index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Angle, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proximity, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendProximityInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SendProximityInfo", true);
+        var parms = new SendProximityInfo_Params();
+        parms.enemy_index = enemy_index;
+        parms.Angle = Angle;
+        parms.Proximity = Proximity;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearProximityDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearProximityData_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearProximityData
     /// </summary>
     public unsafe virtual void ClearProximityData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.ClearProximityData", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearProximityDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.ClearProximityData", true);
+        var parms = new ClearProximityData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetNoise_Params
+    {
+        [FieldOffset(0)] public int Percentage;
+        [FieldOffset(4)] public int AmbientPercentage;
+        [FieldOffset(8)] public int bWarning;
+    }
+
     /// <summary>
     /// Function: SetNoise
     /// </summary>
     public unsafe virtual void SetNoise(int Percentage, int AmbientPercentage, bool bWarning)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetNoise", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Percentage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AmbientPercentage, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWarning, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetNoise", true);
+        var parms = new SetNoise_Params();
+        parms.Percentage = Percentage;
+        parms.AmbientPercentage = AmbientPercentage;
+        parms.bWarning = bWarning ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetIceMeterNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetIceMeterNoise_Params
+    {
+        [FieldOffset(0)] public int Percentage;
+        [FieldOffset(4)] public int AmbientPercentage;
+        [FieldOffset(8)] public int bWarning;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SetIceMeterNoise
     /// </summary>
     public unsafe virtual bool SetIceMeterNoise(int Percentage, int AmbientPercentage, bool bWarning)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetIceMeterNoise", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Percentage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AmbientPercentage, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWarning, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_SetIceMeterNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetIceMeterNoise", true);
+        var parms = new SetIceMeterNoise_Params();
+        parms.Percentage = Percentage;
+        parms.AmbientPercentage = AmbientPercentage;
+        parms.bWarning = bWarning ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetInvestigateJammerSourceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetInvestigateJammerSource_Params
+    {
+        [FieldOffset(0)] public int source_visible;
+        [FieldOffset(4)] public float source_x;
+        [FieldOffset(8)] public float source_y;
     }
 
     /// <summary>
@@ -148,305 +198,478 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe virtual void SetInvestigateJammerSource(bool source_visible, float source_x, float source_y)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetInvestigateJammerSource", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(source_visible, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(source_x, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(source_y, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInvestigateJammerSourceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetInvestigateJammerSource", true);
+        var parms = new SetInvestigateJammerSource_Params();
+        parms.source_visible = source_visible ? 1 : 0;
+        parms.source_x = source_x;
+        parms.source_y = source_y;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCompassDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCompassDir_Params
+    {
+        [FieldOffset(0)] public float Direction;
+    }
+
     /// <summary>
     /// Function: SetCompassDir
     /// </summary>
     public unsafe virtual void SetCompassDir(float Direction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetCompassDir", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Direction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCompassDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetCompassDir", true);
+        var parms = new SetCompassDir_Params();
+        parms.Direction = Direction;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRangeFloatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetRangeFloat_Params
+    {
+        [FieldOffset(0)] public float Range;
+        [FieldOffset(4)] public float MaxRange;
+    }
+
     /// <summary>
     /// Function: SetRangeFloat
     /// </summary>
     public unsafe virtual void SetRangeFloat(float Range, float MaxRange)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetRangeFloat", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Range, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxRange, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRangeFloatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetRangeFloat", true);
+        var parms = new SetRangeFloat_Params();
+        parms.Range = Range;
+        parms.MaxRange = MaxRange;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetRange_Params
+    {
+        [FieldOffset(0)] public int Range;
+    }
+
     /// <summary>
     /// Function: SetRange
     /// </summary>
     public unsafe virtual void SetRange(int Range)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Range, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetRange", true);
+        var parms = new SetRange_Params();
+        parms.Range = Range;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayNoSignalFoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisplayNoSignalFound_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisplayNoSignalFound
     /// </summary>
     public unsafe virtual void DisplayNoSignalFound()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.DisplayNoSignalFound", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayNoSignalFoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.DisplayNoSignalFound", true);
+        var parms = new DisplayNoSignalFound_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetJammerTrackingDetailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetJammerTrackingDetails_Params
+    {
+        [FieldOffset(0)] public float distance_metres;
+        [FieldOffset(4)] public float yaw_zero_to_one;
+        [FieldOffset(8)] public float pitch_zero_to_one;
+    }
+
     /// <summary>
     /// Function: SetJammerTrackingDetails
     /// </summary>
     public unsafe virtual void SetJammerTrackingDetails(float distance_metres, float yaw_zero_to_one, float pitch_zero_to_one)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetJammerTrackingDetails", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(distance_metres, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(yaw_zero_to_one, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(pitch_zero_to_one, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetJammerTrackingDetailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetJammerTrackingDetails", true);
+        var parms = new SetJammerTrackingDetails_Params();
+        parms.distance_metres = distance_metres;
+        parms.yaw_zero_to_one = yaw_zero_to_one;
+        parms.pitch_zero_to_one = pitch_zero_to_one;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRadioTrackingDetailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetRadioTrackingDetails_Params
+    {
+        [FieldOffset(0)] public float distance_metres;
+        [FieldOffset(4)] public float distance_log;
+        [FieldOffset(8)] public float yaw_zero_to_one;
+        [FieldOffset(12)] public float pitch_zero_to_one;
+    }
+
     /// <summary>
     /// Function: SetRadioTrackingDetails
     /// </summary>
     public unsafe virtual void SetRadioTrackingDetails(float distance_metres, float distance_log, float yaw_zero_to_one, float pitch_zero_to_one)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetRadioTrackingDetails", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(distance_metres, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(distance_log, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(yaw_zero_to_one, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(pitch_zero_to_one, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRadioTrackingDetailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetRadioTrackingDetails", true);
+        var parms = new SetRadioTrackingDetails_Params();
+        parms.distance_metres = distance_metres;
+        parms.distance_log = distance_log;
+        parms.yaw_zero_to_one = yaw_zero_to_one;
+        parms.pitch_zero_to_one = pitch_zero_to_one;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LostTrackerSignalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LostTrackerSignal_Params
+    {
+    }
+
     /// <summary>
     /// Function: LostTrackerSignal
     /// </summary>
     public unsafe virtual void LostTrackerSignal()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.LostTrackerSignal", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LostTrackerSignalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.LostTrackerSignal", true);
+        var parms = new LostTrackerSignal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNinjaTrackingDepthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetNinjaTrackingDepth_Params
+    {
+        [FieldOffset(0)] public float NewDepth;
+    }
+
     /// <summary>
     /// Function: SetNinjaTrackingDepth
     /// </summary>
     public unsafe virtual void SetNinjaTrackingDepth(float NewDepth)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetNinjaTrackingDepth", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewDepth, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNinjaTrackingDepthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetNinjaTrackingDepth", true);
+        var parms = new SetNinjaTrackingDepth_Params();
+        parms.NewDepth = NewDepth;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_JustShowDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct JustShowDistance_Params
+    {
+        [FieldOffset(0)] public int distance_to_target;
+        [FieldOffset(4)] public int elevation;
+    }
+
     /// <summary>
     /// Function: JustShowDistance
     /// </summary>
     public unsafe virtual void JustShowDistance(int distance_to_target, int elevation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.JustShowDistance", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(distance_to_target, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(elevation, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_JustShowDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.JustShowDistance", true);
+        var parms = new JustShowDistance_Params();
+        parms.distance_to_target = distance_to_target;
+        parms.elevation = elevation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FirePulseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FirePulse_Params
+    {
+        [FieldOffset(0)] public int distance_to_target;
+        [FieldOffset(4)] public int elevation;
+    }
+
     /// <summary>
     /// Function: FirePulse
     /// </summary>
     public unsafe virtual void FirePulse(int distance_to_target, int elevation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.FirePulse", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(distance_to_target, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(elevation, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FirePulseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.FirePulse", true);
+        var parms = new FirePulse_Params();
+        parms.distance_to_target = distance_to_target;
+        parms.elevation = elevation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetReticleScreenLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetReticleScreenLocation_Params
+    {
+        [FieldOffset(0)] public float screen_x;
+        [FieldOffset(4)] public float screen_y;
+    }
+
     /// <summary>
     /// Function: SetReticleScreenLocation
     /// </summary>
     public unsafe virtual void SetReticleScreenLocation(float screen_x, float screen_y)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetReticleScreenLocation", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(screen_x, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(screen_y, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetReticleScreenLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetReticleScreenLocation", true);
+        var parms = new SetReticleScreenLocation_Params();
+        parms.screen_x = screen_x;
+        parms.screen_y = screen_y;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RestoreInvestigateModeAutoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RestoreInvestigateModeAuto_Params
+    {
+    }
+
     /// <summary>
     /// Function: RestoreInvestigateModeAuto
     /// </summary>
     public unsafe virtual void RestoreInvestigateModeAuto()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.RestoreInvestigateModeAuto", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RestoreInvestigateModeAutoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.RestoreInvestigateModeAuto", true);
+        var parms = new RestoreInvestigateModeAuto_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetIsInvestigateModeAutoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetIsInvestigateModeAuto_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetIsInvestigateModeAuto
     /// </summary>
     public unsafe virtual void SetIsInvestigateModeAuto()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetIsInvestigateModeAuto", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetIsInvestigateModeAutoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetIsInvestigateModeAuto", true);
+        var parms = new SetIsInvestigateModeAuto_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CloseScreen_Params
+    {
+    }
+
     /// <summary>
     /// Function: CloseScreen
     /// </summary>
     public unsafe virtual void CloseScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.CloseScreen", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.CloseScreen", true);
+        var parms = new CloseScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HideItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: HideItem
     /// </summary>
     public unsafe virtual void HideItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.HideItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.HideItem", true);
+        var parms = new HideItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShowItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: ShowItem
     /// </summary>
     public unsafe virtual void ShowItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.ShowItem", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.ShowItem", true);
+        var parms = new ShowItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KismetControlsInOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct KismetControlsInOut_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: KismetControlsInOut
     /// </summary>
     public unsafe virtual void KismetControlsInOut(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.KismetControlsInOut", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KismetControlsInOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.KismetControlsInOut", true);
+        var parms = new KismetControlsInOut_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateVisibilityPrivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateVisibilityPrivate_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: UpdateVisibilityPrivate
     /// </summary>
     public unsafe virtual void UpdateVisibilityPrivate(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.UpdateVisibilityPrivate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateVisibilityPrivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.UpdateVisibilityPrivate", true);
+        var parms = new UpdateVisibilityPrivate_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateVisibilityAutoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateVisibilityAuto_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateVisibilityAuto
     /// </summary>
     public unsafe virtual void UpdateVisibilityAuto()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.UpdateVisibilityAuto", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateVisibilityAutoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.UpdateVisibilityAuto", true);
+        var parms = new UpdateVisibilityAuto_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetExtraHudSuppressedByGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetExtraHudSuppressedByGadget_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: SetExtraHudSuppressedByGadget
     /// </summary>
     public unsafe virtual void SetExtraHudSuppressedByGadget(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetExtraHudSuppressedByGadget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetExtraHudSuppressedByGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetExtraHudSuppressedByGadget", true);
+        var parms = new SetExtraHudSuppressedByGadget_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetExtraHudSuppressedByObjectiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetExtraHudSuppressedByObjective_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: SetExtraHudSuppressedByObjective
     /// </summary>
     public unsafe virtual void SetExtraHudSuppressedByObjective(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetExtraHudSuppressedByObjective", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetExtraHudSuppressedByObjectiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetExtraHudSuppressedByObjective", true);
+        var parms = new SetExtraHudSuppressedByObjective_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetExtraHudVisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetExtraHudVisible_Params
+    {
+        [FieldOffset(0)] public int bTrue;
+    }
+
     /// <summary>
     /// Function: SetExtraHudVisible
     /// </summary>
     public unsafe virtual void SetExtraHudVisible(bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetExtraHudVisible", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetExtraHudVisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.SetExtraHudVisible", true);
+        var parms = new SetExtraHudVisible_Params();
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Close_Params
+    {
+    }
+
     /// <summary>
     /// Function: Close
     /// </summary>
     public unsafe override void Close()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.Close", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.Close", true);
+        var parms = new Close_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+        [FieldOffset(4)] public BmSDK.FString _ExtensionName;
+        [FieldOffset(16)] public BmSDK.FString _ExtensionPath;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(BmSDK.BmGame.RPlayerController _RPC, BmSDK.FString _ExtensionName, BmSDK.FString _ExtensionPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.Init", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionPath, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionExtra.Init", true);
+        var parms = new Init_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        parms._ExtensionName = _ExtensionName;
+        parms._ExtensionPath = _ExtensionPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -463,8 +686,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe bool bShowHudOnlyInDetectiveMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }
+        get { return (*(int*)(Ptr + 136) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 136) |= 1; else *(int*)(Ptr + 136) &= ~1; }
     }
 
     /// <summary>
@@ -472,8 +695,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe bool bJammerSourceVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }
+        get { return (*(int*)(Ptr + 136) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 136) |= 2; else *(int*)(Ptr + 136) &= ~2; }
     }
 
     /// <summary>
@@ -481,8 +704,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe bool SuppressedByObjective
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }
+        get { return (*(int*)(Ptr + 136) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 136) |= 4; else *(int*)(Ptr + 136) &= ~4; }
     }
 
     /// <summary>
@@ -490,8 +713,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe bool SuppressedByGadget
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }
+        get { return (*(int*)(Ptr + 136) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 136) |= 8; else *(int*)(Ptr + 136) &= ~8; }
     }
 
     /// <summary>
@@ -499,8 +722,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe bool ExtraHudSetVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }
+        get { return (*(int*)(Ptr + 136) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 136) |= 16; else *(int*)(Ptr + 136) &= ~16; }
     }
 
     /// <summary>
@@ -508,8 +731,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe bool ExtraHudCurrentlyVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }
+        get { return (*(int*)(Ptr + 136) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 136) |= 32; else *(int*)(Ptr + 136) &= ~32; }
     }
 
     /// <summary>
@@ -517,8 +740,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe bool ShowSpecialIntroOnInit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }
+        get { return (*(int*)(Ptr + 136) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 136) |= 64; else *(int*)(Ptr + 136) &= ~64; }
     }
 
     /// <summary>
@@ -652,8 +875,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe float fJammerSourceX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(float*)(Ptr + 308); }
+        set { *(float*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -661,8 +884,8 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe float fJammerSourceY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(float*)(Ptr + 312); }
+        set { *(float*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -670,7 +893,7 @@ public partial class RHudExtensionExtra : BmSDK.BmGame.RHudExtension, BmSDK.IGam
     /// </summary>
     public unsafe float NinjaTrackingDepth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(float*)(Ptr + 316); }
+        set { *(float*)(Ptr + 316) = value; }
     }
 }
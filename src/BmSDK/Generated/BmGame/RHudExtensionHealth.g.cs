@@ -78,280 +78,456 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
         where TComponent : class, Framework.IScriptComponent<RHudExtensionHealth>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetComboTrainingParametersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetComboTrainingParameters_Params
+    {
+        [FieldOffset(0)] public float CriticalDuration;
+        [FieldOffset(4)] public float EarlyDuration;
+    }
+
     /// <summary>
     /// Function: SetComboTrainingParameters
     /// </summary>
     public unsafe virtual void SetComboTrainingParameters(float CriticalDuration, float EarlyDuration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetComboTrainingParameters", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CriticalDuration, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EarlyDuration, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetComboTrainingParametersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetComboTrainingParameters", true);
+        var parms = new SetComboTrainingParameters_Params();
+        parms.CriticalDuration = CriticalDuration;
+        parms.EarlyDuration = EarlyDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_QueueXPMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct QueueXPMessage_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Title;
+        [FieldOffset(12)] public BmSDK.FString Message;
+        [FieldOffset(24)] public float HoldDuration;
+    }
+
     /// <summary>
     /// Function: QueueXPMessage
     /// </summary>
     public unsafe virtual void QueueXPMessage(BmSDK.FString Title, BmSDK.FString Message, float HoldDuration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.QueueXPMessage", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Title, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Message, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HoldDuration, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_QueueXPMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.QueueXPMessage", true);
+        var parms = new QueueXPMessage_Params();
+        parms.Title = Title;
+        parms.Message = Message;
+        parms.HoldDuration = HoldDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowCriticalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowCritical_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowCritical
     /// </summary>
     public unsafe virtual void ShowCritical()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowCritical", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowCriticalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowCritical", true);
+        var parms = new ShowCritical_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetComboChallengeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetComboChallenge_Params
+    {
+        [FieldOffset(0)] public int ColourID;
+        [FieldOffset(4)] public int ComboNumber;
+        [FieldOffset(8)] public int ComboValue;
+        [FieldOffset(12)] public BmSDK.FString movename;
+    }
+
     /// <summary>
     /// Function: SetComboChallenge
     /// </summary>
     public unsafe virtual void SetComboChallenge(int ColourID, int ComboNumber, int ComboValue, BmSDK.FString movename)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetComboChallenge", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ColourID, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboNumber, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboValue, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(movename, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetComboChallengeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetComboChallenge", true);
+        var parms = new SetComboChallenge_Params();
+        parms.ColourID = ColourID;
+        parms.ComboNumber = ComboNumber;
+        parms.ComboValue = ComboValue;
+        parms.movename = movename;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetComboLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetComboLevel_Params
+    {
+        [FieldOffset(0)] public int Value;
+        [FieldOffset(4)] public int iPowerUpLevel;
+    }
+
     /// <summary>
     /// Function: SetComboLevel
     /// </summary>
     public unsafe virtual void SetComboLevel(int Value, int iPowerUpLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetComboLevel", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(iPowerUpLevel, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetComboLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetComboLevel", true);
+        var parms = new SetComboLevel_Params();
+        parms.Value = Value;
+        parms.iPowerUpLevel = iPowerUpLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCombo_Params
+    {
+        [FieldOffset(0)] public int Value;
+        [FieldOffset(4)] public int bPowerUp;
+    }
+
     /// <summary>
     /// Function: SetCombo
     /// </summary>
     public unsafe virtual void SetCombo(int Value, bool bPowerUp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetCombo", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPowerUp, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetCombo", true);
+        var parms = new SetCombo_Params();
+        parms.Value = Value;
+        parms.bPowerUp = bPowerUp ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowWallClimbBonusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ShowWallClimbBonus_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString BonusTitle;
+        [FieldOffset(12)] public BmSDK.FString BonusDetail;
+    }
+
     /// <summary>
     /// Function: ShowWallClimbBonus
     /// </summary>
     public unsafe virtual void ShowWallClimbBonus(BmSDK.FString BonusTitle, BmSDK.FString BonusDetail)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowWallClimbBonus", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BonusTitle, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BonusDetail, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowWallClimbBonusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowWallClimbBonus", true);
+        var parms = new ShowWallClimbBonus_Params();
+        parms.BonusTitle = BonusTitle;
+        parms.BonusDetail = BonusDetail;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowTwoStringBonusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ShowTwoStringBonus_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString BonusTitle;
+        [FieldOffset(12)] public BmSDK.FString BonusDetail;
+    }
+
     /// <summary>
     /// Function: ShowTwoStringBonus
     /// </summary>
     public unsafe virtual void ShowTwoStringBonus(BmSDK.FString BonusTitle, BmSDK.FString BonusDetail)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowTwoStringBonus", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BonusTitle, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BonusDetail, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowTwoStringBonusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowTwoStringBonus", true);
+        var parms = new ShowTwoStringBonus_Params();
+        parms.BonusTitle = BonusTitle;
+        parms.BonusDetail = BonusDetail;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLevelUpDisplaySuppressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetLevelUpDisplaySuppressed_Params
+    {
+        [FieldOffset(0)] public int _bLevelUpSuppressed;
+    }
+
     /// <summary>
     /// Function: SetLevelUpDisplaySuppressed
     /// </summary>
     public unsafe virtual void SetLevelUpDisplaySuppressed(bool _bLevelUpSuppressed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetLevelUpDisplaySuppressed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_bLevelUpSuppressed, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLevelUpDisplaySuppressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetLevelUpDisplaySuppressed", true);
+        var parms = new SetLevelUpDisplaySuppressed_Params();
+        parms._bLevelUpSuppressed = _bLevelUpSuppressed ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowLevelUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowLevelUp_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowLevelUp
     /// </summary>
     public unsafe virtual void ShowLevelUp(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowLevelUp", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowLevelUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowLevelUp", true);
+        var parms = new ShowLevelUp_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowLevelUpTriggerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowLevelUpTrigger_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowLevelUpTrigger
     /// </summary>
     public unsafe virtual void ShowLevelUpTrigger(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowLevelUpTrigger", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowLevelUpTriggerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowLevelUpTrigger", true);
+        var parms = new ShowLevelUpTrigger_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowXPBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowXPBar_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowXPBar
     /// </summary>
     public unsafe virtual void ShowXPBar(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowXPBar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowXPBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowXPBar", true);
+        var parms = new ShowXPBar_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetXPBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetXPBar_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetXPBar
     /// </summary>
     public unsafe virtual void SetXPBar(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetXPBar", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetXPBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetXPBar", true);
+        var parms = new SetXPBar_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowLootBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowLootBar_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowLootBar
     /// </summary>
     public unsafe virtual void ShowLootBar(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowLootBar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowLootBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowLootBar", true);
+        var parms = new ShowLootBar_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLootBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetLootBar_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetLootBar
     /// </summary>
     public unsafe virtual void SetLootBar(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetLootBar", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLootBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetLootBar", true);
+        var parms = new SetLootBar_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetVisibilityPrivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetVisibilityPrivate_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: SetVisibilityPrivate
     /// </summary>
     public unsafe virtual void SetVisibilityPrivate(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetVisibilityPrivate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetVisibilityPrivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetVisibilityPrivate", true);
+        var parms = new SetVisibilityPrivate_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckWhetherShouldBeVisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckWhetherShouldBeVisible_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckWhetherShouldBeVisible
     /// </summary>
     public unsafe virtual void CheckWhetherShouldBeVisible()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.CheckWhetherShouldBeVisible", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckWhetherShouldBeVisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.CheckWhetherShouldBeVisible", true);
+        var parms = new CheckWhetherShouldBeVisible_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowHealthBar_Params
+    {
+        [FieldOffset(0)] public int bShow;
+    }
+
     /// <summary>
     /// Function: ShowHealthBar
     /// </summary>
     public unsafe virtual void ShowHealthBar(bool bShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowHealthBar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowHealthBar", true);
+        var parms = new ShowHealthBar_Params();
+        parms.bShow = bShow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetArmourLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetArmourLevel_Params
+    {
+        [FieldOffset(0)] public int armour_type;
+        [FieldOffset(4)] public int current_armour;
+        [FieldOffset(8)] public int max_armour;
+    }
+
     /// <summary>
     /// Function: SetArmourLevel
     /// </summary>
     public unsafe virtual void SetArmourLevel(int armour_type, int current_armour, int max_armour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetArmourLevel", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(armour_type, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(current_armour, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(max_armour, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetArmourLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetArmourLevel", true);
+        var parms = new SetArmourLevel_Params();
+        parms.armour_type = armour_type;
+        parms.current_armour = current_armour;
+        parms.max_armour = max_armour;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPoisonLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetPoisonLevel_Params
+    {
+        [FieldOffset(0)] public int PoisonLevel;
+    }
+
     /// <summary>
     /// Function: SetPoisonLevel
     /// </summary>
     public unsafe virtual void SetPoisonLevel(int PoisonLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetPoisonLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PoisonLevel, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPoisonLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetPoisonLevel", true);
+        var parms = new SetPoisonLevel_Params();
+        parms.PoisonLevel = PoisonLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPoisonChangePeriodFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetPoisonChangePeriod_Params
+    {
+        [FieldOffset(0)] public float new_period;
+    }
+
     /// <summary>
     /// Function: SetPoisonChangePeriod
     /// </summary>
     public unsafe virtual void SetPoisonChangePeriod(float new_period)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetPoisonChangePeriod", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_period, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPoisonChangePeriodFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetPoisonChangePeriod", true);
+        var parms = new SetPoisonChangePeriod_Params();
+        parms.new_period = new_period;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PoisonedMaxFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PoisonedMax_Params
+    {
+        [FieldOffset(0)] public int MaximumHealth;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PoisonedMax
     /// </summary>
     public unsafe virtual int PoisonedMax(int MaximumHealth)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.PoisonedMax", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaximumHealth, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_PoisonedMaxFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.PoisonedMax", true);
+        var parms = new PoisonedMax_Params();
+        parms.MaximumHealth = MaximumHealth;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_PoisonedHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PoisonedHealth_Params
+    {
+        [FieldOffset(0)] public int CurrentHealth;
+        [FieldOffset(4)] public int MaximumHealth;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -359,12 +535,20 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe virtual int PoisonedHealth(int CurrentHealth, int MaximumHealth)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.PoisonedHealth", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentHealth, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaximumHealth, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_PoisonedHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.PoisonedHealth", true);
+        var parms = new PoisonedHealth_Params();
+        parms.CurrentHealth = CurrentHealth;
+        parms.MaximumHealth = MaximumHealth;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetHealthBarWithPoisonEffectPrivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetHealthBarWithPoisonEffectPrivate_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
     }
 
     /// <summary>
@@ -372,103 +556,166 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe virtual void SetHealthBarWithPoisonEffectPrivate(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarWithPoisonEffectPrivate", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthBarWithPoisonEffectPrivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarWithPoisonEffectPrivate", true);
+        var parms = new SetHealthBarWithPoisonEffectPrivate_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPoisonHealthBarScaledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetPoisonHealthBarScaled_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetPoisonHealthBarScaled
     /// </summary>
     public unsafe virtual void SetPoisonHealthBarScaled(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetPoisonHealthBarScaled", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPoisonHealthBarScaledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetPoisonHealthBarScaled", true);
+        var parms = new SetPoisonHealthBarScaled_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthBarWithPoisonEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetHealthBarWithPoisonEffect_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetHealthBarWithPoisonEffect
     /// </summary>
     public unsafe virtual void SetHealthBarWithPoisonEffect(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarWithPoisonEffect", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthBarWithPoisonEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarWithPoisonEffect", true);
+        var parms = new SetHealthBarWithPoisonEffect_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthBarCurrentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetHealthBarCurrent_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetHealthBarCurrent
     /// </summary>
     public unsafe virtual void SetHealthBarCurrent(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarCurrent", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthBarCurrentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarCurrent", true);
+        var parms = new SetHealthBarCurrent_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthBarPrivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetHealthBarPrivate_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetHealthBarPrivate
     /// </summary>
     public unsafe virtual void SetHealthBarPrivate(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarPrivate", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthBarPrivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarPrivate", true);
+        var parms = new SetHealthBarPrivate_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthBarScaledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetHealthBarScaled_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetHealthBarScaled
     /// </summary>
     public unsafe virtual void SetHealthBarScaled(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarScaled", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthBarScaledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBarScaled", true);
+        var parms = new SetHealthBarScaled_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetHealthBar_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: SetHealthBar
     /// </summary>
     public unsafe virtual void SetHealthBar(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBar", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.SetHealthBar", true);
+        var parms = new SetHealthBar_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetScaledHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetScaledHealth_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetScaledHealth
     /// </summary>
     public unsafe virtual int GetScaledHealth(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.GetScaledHealth", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_GetScaledHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.GetScaledHealth", true);
+        var parms = new GetScaledHealth_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ShowCharacterNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowCharacterName_Params
+    {
     }
 
     /// <summary>
@@ -476,61 +723,93 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe virtual void ShowCharacterName()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowCharacterName", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowCharacterNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.ShowCharacterName", true);
+        var parms = new ShowCharacterName_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitHealthBarPrivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitHealthBarPrivate_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: InitHealthBarPrivate
     /// </summary>
     public unsafe virtual void InitHealthBarPrivate(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.InitHealthBarPrivate", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitHealthBarPrivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.InitHealthBarPrivate", true);
+        var parms = new InitHealthBarPrivate_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitHealthBar_Params
+    {
+        [FieldOffset(0)] public int Current;
+        [FieldOffset(4)] public int Maximum;
+    }
+
     /// <summary>
     /// Function: InitHealthBar
     /// </summary>
     public unsafe virtual void InitHealthBar(int Current, int Maximum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.InitHealthBar", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Current, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Maximum, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.InitHealthBar", true);
+        var parms = new InitHealthBar_Params();
+        parms.Current = Current;
+        parms.Maximum = Maximum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Close_Params
+    {
+    }
+
     /// <summary>
     /// Function: Close
     /// </summary>
     public unsafe override void Close()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.Close", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.Close", true);
+        var parms = new Close_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+        [FieldOffset(4)] public BmSDK.FString _ExtensionName;
+        [FieldOffset(16)] public BmSDK.FString _ExtensionPath;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(BmSDK.BmGame.RPlayerController _RPC, BmSDK.FString _ExtensionName, BmSDK.FString _ExtensionPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.Init", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionPath, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionHealth.Init", true);
+        var parms = new Init_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        parms._ExtensionName = _ExtensionName;
+        parms._ExtensionPath = _ExtensionPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -538,8 +817,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bCurrentlyVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 1; else *(int*)(Ptr + 132) &= ~1; }
     }
 
     /// <summary>
@@ -547,8 +826,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bHealthBarRequested
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 2; else *(int*)(Ptr + 132) &= ~2; }
     }
 
     /// <summary>
@@ -556,8 +835,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bXPBarRequested
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 4; else *(int*)(Ptr + 132) &= ~4; }
     }
 
     /// <summary>
@@ -565,8 +844,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bLootBarRequested
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 8; else *(int*)(Ptr + 132) &= ~8; }
     }
 
     /// <summary>
@@ -574,8 +853,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bXPBarFull
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 16; else *(int*)(Ptr + 132) &= ~16; }
     }
 
     /// <summary>
@@ -583,8 +862,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bSurpressLevelupSound
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 32; else *(int*)(Ptr + 132) &= ~32; }
     }
 
     /// <summary>
@@ -592,8 +871,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bLevelUpVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 64; else *(int*)(Ptr + 132) &= ~64; }
     }
 
     /// <summary>
@@ -601,8 +880,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bLevelUpSuppressed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 128; else *(int*)(Ptr + 132) &= ~128; }
     }
 
     /// <summary>
@@ -610,8 +889,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bLevelUpActuallyDisplayed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 256; else *(int*)(Ptr + 132) &= ~256; }
     }
 
     /// <summary>
@@ -619,8 +898,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool ArmourInitialised
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 512; else *(int*)(Ptr + 132) &= ~512; }
     }
 
     /// <summary>
@@ -628,8 +907,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe bool bReplayPreventsLevelUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 1024; else *(int*)(Ptr + 132) &= ~1024; }
     }
 
     /// <summary>
@@ -646,8 +925,8 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe int PoisonMaxHealth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(int*)(Ptr + 140); }
+        set { *(int*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -709,7 +988,7 @@ public partial class RHudExtensionHealth : BmSDK.BmGame.RHudExtension, BmSDK.IGa
     /// </summary>
     public unsafe float HealthBarScaling
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(float*)(Ptr + 216); }
+        set { *(float*)(Ptr + 216) = value; }
     }
 }
@@ -78,116 +78,184 @@ public partial class RHudExtensionInformants : BmSDK.BmGame.RHudExtension, BmSDK
         where TComponent : class, Framework.IScriptComponent<RHudExtensionInformants>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PickupScanAbortedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PickupScanAborted_Params
+    {
+    }
+
     /// <summary>
     /// Function: PickupScanAborted
     /// </summary>
     public unsafe virtual void PickupScanAborted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.PickupScanAborted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PickupScanAbortedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.PickupScanAborted", true);
+        var parms = new PickupScanAborted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPickupLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetPickupLocation_Params
+    {
+        [FieldOffset(0)] public int is_visible;
+        [FieldOffset(4)] public float reticle_x;
+        [FieldOffset(8)] public float reticle_y;
+    }
+
     /// <summary>
     /// Function: SetPickupLocation
     /// </summary>
     public unsafe virtual void SetPickupLocation(bool is_visible, float reticle_x, float reticle_y)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.SetPickupLocation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_visible, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(reticle_x, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(reticle_y, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPickupLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.SetPickupLocation", true);
+        var parms = new SetPickupLocation_Params();
+        parms.is_visible = is_visible ? 1 : 0;
+        parms.reticle_x = reticle_x;
+        parms.reticle_y = reticle_y;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialisePickupScanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitialisePickupScan_Params
+    {
+        [FieldOffset(0)] public int new_pickup;
+    }
+
     /// <summary>
     /// Function: InitialisePickupScan
     /// </summary>
     public unsafe virtual void InitialisePickupScan(bool new_pickup)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.InitialisePickupScan", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_pickup, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialisePickupScanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.InitialisePickupScan", true);
+        var parms = new InitialisePickupScan_Params();
+        parms.new_pickup = new_pickup ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InformantScanAbortedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InformantScanAborted_Params
+    {
+    }
+
     /// <summary>
     /// Function: InformantScanAborted
     /// </summary>
     public unsafe virtual void InformantScanAborted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.InformantScanAborted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InformantScanAbortedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.InformantScanAborted", true);
+        var parms = new InformantScanAborted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendInformationToFlashFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SendInformationToFlash_Params
+    {
+    }
+
     /// <summary>
     /// Function: SendInformationToFlash
     /// </summary>
     public unsafe virtual void SendInformationToFlash()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.SendInformationToFlash", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendInformationToFlashFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.SendInformationToFlash", true);
+        var parms = new SendInformationToFlash_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInformantDetailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetInformantDetails_Params
+    {
+        [FieldOffset(0)] public int Index;
+        [FieldOffset(4)] public int is_visible;
+        [FieldOffset(8)] public float reticle_x;
+        [FieldOffset(12)] public float reticle_y;
+    }
+
     /// <summary>
     /// Function: SetInformantDetails
     /// </summary>
     public unsafe virtual void SetInformantDetails(int Index, bool is_visible, float reticle_x, float reticle_y)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.SetInformantDetails", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_visible, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(reticle_x, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(reticle_y, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInformantDetailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.SetInformantDetails", true);
+        var parms = new SetInformantDetails_Params();
+        parms.Index = Index;
+        parms.is_visible = is_visible ? 1 : 0;
+        parms.reticle_x = reticle_x;
+        parms.reticle_y = reticle_y;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseInformantsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitialiseInformants_Params
+    {
+        [FieldOffset(0)] public int num_subjects;
+        [FieldOffset(4)] public int informant_index;
+    }
+
     /// <summary>
     /// Function: InitialiseInformants
     /// </summary>
     public unsafe virtual void InitialiseInformants(int num_subjects, int informant_index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.InitialiseInformants", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(num_subjects, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(informant_index, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseInformantsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.InitialiseInformants", true);
+        var parms = new InitialiseInformants_Params();
+        parms.num_subjects = num_subjects;
+        parms.informant_index = informant_index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Close_Params
+    {
+    }
+
     /// <summary>
     /// Function: Close
     /// </summary>
     public unsafe override void Close()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.Close", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.Close", true);
+        var parms = new Close_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+        [FieldOffset(4)] public BmSDK.FString _ExtensionName;
+        [FieldOffset(16)] public BmSDK.FString _ExtensionPath;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(BmSDK.BmGame.RPlayerController _RPC, BmSDK.FString _ExtensionName, BmSDK.FString _ExtensionPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.Init", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionPath, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInformants.Init", true);
+        var parms = new Init_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        parms._ExtensionName = _ExtensionName;
+        parms._ExtensionPath = _ExtensionPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -231,8 +299,8 @@ public partial class RHudExtensionInformants : BmSDK.BmGame.RHudExtension, BmSDK
     /// </summary>
     public unsafe int InformantIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 172); }
+        get { return *(int*)(Ptr + 172); }
+        set { *(int*)(Ptr + 172) = value; }
     }
 
     /// <summary>
@@ -240,8 +308,8 @@ public partial class RHudExtensionInformants : BmSDK.BmGame.RHudExtension, BmSDK
     /// </summary>
     public unsafe int NumSubjects
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(int*)(Ptr + 176); }
+        set { *(int*)(Ptr + 176) = value; }
     }
 
     /// <summary>
@@ -249,8 +317,8 @@ public partial class RHudExtensionInformants : BmSDK.BmGame.RHudExtension, BmSDK
     /// </summary>
     public unsafe bool bHasAbortedScan
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 180); }
+        get { return (*(int*)(Ptr + 180) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 180) |= 1; else *(int*)(Ptr + 180) &= ~1; }
     }
 
     /// <summary>
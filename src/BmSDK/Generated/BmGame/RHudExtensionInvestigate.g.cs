@@ -78,360 +78,577 @@ public partial class RHudExtensionInvestigate : BmSDK.BmGame.RHudExtension, BmSD
         where TComponent : class, Framework.IScriptComponent<RHudExtensionInvestigate>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ScanCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ScanComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: ScanComplete
     /// </summary>
     public unsafe virtual void ScanComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.ScanComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ScanCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.ScanComplete", true);
+        var parms = new ScanComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideGadgetHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HideGadgetHUD_Params
+    {
+        [FieldOffset(0)] public int bHide;
+    }
+
     /// <summary>
     /// Function: HideGadgetHUD
     /// </summary>
     public unsafe virtual void HideGadgetHUD(bool bHide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.HideGadgetHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHide, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideGadgetHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.HideGadgetHUD", true);
+        var parms = new HideGadgetHUD_Params();
+        parms.bHide = bHide ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetPrompt_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RHudExtensionInvestigate.ScannerPrompt ScanID;
+    }
+
     /// <summary>
     /// Function: SetPrompt
     /// </summary>
     public unsafe virtual void SetPrompt(BmSDK.BmGame.RHudExtensionInvestigate.ScannerPrompt ScanID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetPrompt", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScanID, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetPrompt", true);
+        var parms = new SetPrompt_Params();
+        parms.ScanID = ScanID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetEvidenceDetailFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetEvidenceDetail_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString _CurrentEvidenceDetailString;
+    }
+
     /// <summary>
     /// Function: SetEvidenceDetail
     /// </summary>
     public unsafe virtual void SetEvidenceDetail(BmSDK.FString _CurrentEvidenceDetailString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetEvidenceDetail", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_CurrentEvidenceDetailString, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetEvidenceDetailFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetEvidenceDetail", true);
+        var parms = new SetEvidenceDetail_Params();
+        parms._CurrentEvidenceDetailString = _CurrentEvidenceDetailString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetContentsTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetContentsType_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString contents_type;
+    }
+
     /// <summary>
     /// Function: SetContentsType
     /// </summary>
     public unsafe virtual void SetContentsType(BmSDK.FString contents_type)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetContentsType", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(contents_type, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetContentsTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetContentsType", true);
+        var parms = new SetContentsType_Params();
+        parms.contents_type = contents_type;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetContentsVisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetContentsVisible_Params
+    {
+        [FieldOffset(0)] public int bVisible;
+    }
+
     /// <summary>
     /// Function: SetContentsVisible
     /// </summary>
     public unsafe virtual void SetContentsVisible(bool bVisible)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetContentsVisible", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVisible, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetContentsVisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetContentsVisible", true);
+        var parms = new SetContentsVisible_Params();
+        parms.bVisible = bVisible ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MarkGrundyDrumBeatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct MarkGrundyDrumBeat_Params
+    {
+    }
+
     /// <summary>
     /// Function: MarkGrundyDrumBeat
     /// </summary>
     public unsafe virtual void MarkGrundyDrumBeat()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.MarkGrundyDrumBeat", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MarkGrundyDrumBeatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.MarkGrundyDrumBeat", true);
+        var parms = new MarkGrundyDrumBeat_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetScannerVisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetScannerVisible_Params
+    {
+        [FieldOffset(0)] public int bVisible;
+    }
+
     /// <summary>
     /// Function: SetScannerVisible
     /// </summary>
     public unsafe virtual void SetScannerVisible(bool bVisible)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetScannerVisible", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVisible, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetScannerVisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetScannerVisible", true);
+        var parms = new SetScannerVisible_Params();
+        parms.bVisible = bVisible ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopScanningFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopScanning_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopScanning
     /// </summary>
     public unsafe virtual void StopScanning()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.StopScanning", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopScanningFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.StopScanning", true);
+        var parms = new StopScanning_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartScanningFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartScanning_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartScanning
     /// </summary>
     public unsafe virtual void StartScanning()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.StartScanning", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartScanningFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.StartScanning", true);
+        var parms = new StartScanning_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSmokePercentageInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSmokePercentageInternal_Params
+    {
+        [FieldOffset(0)] public int SmokePercentage;
+    }
+
     /// <summary>
     /// Function: SetSmokePercentageInternal
     /// </summary>
     public unsafe virtual void SetSmokePercentageInternal(int SmokePercentage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetSmokePercentageInternal", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SmokePercentage, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSmokePercentageInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetSmokePercentageInternal", true);
+        var parms = new SetSmokePercentageInternal_Params();
+        parms.SmokePercentage = SmokePercentage;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSmokePercentageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSmokePercentage_Params
+    {
+        [FieldOffset(0)] public int SmokePercentage;
+    }
+
     /// <summary>
     /// Function: SetSmokePercentage
     /// </summary>
     public unsafe virtual void SetSmokePercentage(int SmokePercentage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetSmokePercentage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SmokePercentage, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSmokePercentageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetSmokePercentage", true);
+        var parms = new SetSmokePercentage_Params();
+        parms.SmokePercentage = SmokePercentage;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetScannerCursorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct SetScannerCursor_Params
+    {
+        [FieldOffset(0)] public float X;
+        [FieldOffset(4)] public float Y;
+        [FieldOffset(8)] public BmSDK.FString EvidenceName;
+        [FieldOffset(20)] public int bNewItem;
+        [FieldOffset(24)] public int bScanned;
+        [FieldOffset(28)] public int bUnscannable;
+        [FieldOffset(32)] public int NotFullyVisible;
+        [FieldOffset(36)] public BmSDK.FString MessageTitle;
+        [FieldOffset(48)] public BmSDK.FString Message;
+    }
+
     /// <summary>
     /// Function: SetScannerCursor
     /// </summary>
     public unsafe virtual void SetScannerCursor(float X, float Y, BmSDK.FString EvidenceName, bool bNewItem, bool bScanned, bool bUnscannable, int NotFullyVisible, BmSDK.FString MessageTitle, BmSDK.FString Message)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetScannerCursor", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EvidenceName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewItem, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bScanned, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUnscannable, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotFullyVisible, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MessageTitle, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Message, paramsPtr + 48);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetScannerCursorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetScannerCursor", true);
+        var parms = new SetScannerCursor_Params();
+        parms.X = X;
+        parms.Y = Y;
+        parms.EvidenceName = EvidenceName;
+        parms.bNewItem = bNewItem ? 1 : 0;
+        parms.bScanned = bScanned ? 1 : 0;
+        parms.bUnscannable = bUnscannable ? 1 : 0;
+        parms.NotFullyVisible = NotFullyVisible;
+        parms.MessageTitle = MessageTitle;
+        parms.Message = Message;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetScannerCursorNoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetScannerCursorNone_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetScannerCursorNone
     /// </summary>
     public unsafe virtual void SetScannerCursorNone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetScannerCursorNone", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetScannerCursorNoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetScannerCursorNone", true);
+        var parms = new SetScannerCursorNone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNPCCountStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetNPCCountString_Params
+    {
+        [FieldOffset(0)] public int Total;
+        [FieldOffset(4)] public BmSDK.FString Str;
+    }
+
     /// <summary>
     /// Function: SetNPCCountString
     /// </summary>
     public unsafe virtual void SetNPCCountString(int Total, BmSDK.FString Str)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetNPCCountString", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Total, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Str, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNPCCountStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetNPCCountString", true);
+        var parms = new SetNPCCountString_Params();
+        parms.Total = Total;
+        parms.Str = Str;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNPCInfoCursorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct SetNPCInfoCursor_Params
+    {
+        [FieldOffset(0)] public float X;
+        [FieldOffset(4)] public float Y;
+        [FieldOffset(8)] public BmSDK.FString actorName;
+        [FieldOffset(20)] public int NpcType;
+        [FieldOffset(24)] public int HeartBeatType;
+        [FieldOffset(28)] public int WeaponType;
+        [FieldOffset(32)] public int bIsArmoured;
+    }
+
     /// <summary>
     /// Function: SetNPCInfoCursor
     /// </summary>
     public unsafe virtual void SetNPCInfoCursor(float X, float Y, BmSDK.FString actorName, int NpcType, int HeartBeatType, int WeaponType, bool bIsArmoured)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetNPCInfoCursor", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(actorName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NpcType, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HeartBeatType, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WeaponType, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsArmoured, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNPCInfoCursorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetNPCInfoCursor", true);
+        var parms = new SetNPCInfoCursor_Params();
+        parms.X = X;
+        parms.Y = Y;
+        parms.actorName = actorName;
+        parms.NpcType = NpcType;
+        parms.HeartBeatType = HeartBeatType;
+        parms.WeaponType = WeaponType;
+        parms.bIsArmoured = bIsArmoured ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNPCInfoCursorNoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetNPCInfoCursorNone_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetNPCInfoCursorNone
     /// </summary>
     public unsafe virtual void SetNPCInfoCursorNone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetNPCInfoCursorNone", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNPCInfoCursorNoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetNPCInfoCursorNone", true);
+        var parms = new SetNPCInfoCursorNone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInfoCursorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct SetInfoCursor_Params
+    {
+        [FieldOffset(0)] public float X;
+        [FieldOffset(4)] public float Y;
+        [FieldOffset(8)] public BmSDK.FString actorName;
+        [FieldOffset(20)] public BmSDK.FString Title;
+        [FieldOffset(32)] public BmSDK.FString Message;
+        [FieldOffset(44)] public int bWarningColour;
+    }
+
     /// <summary>
     /// Function: SetInfoCursor
     /// </summary>
     public unsafe virtual void SetInfoCursor(float X, float Y, BmSDK.FString actorName, BmSDK.FString Title, BmSDK.FString Message, bool bWarningColour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetInfoCursor", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(actorName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Title, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Message, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWarningColour, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInfoCursorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetInfoCursor", true);
+        var parms = new SetInfoCursor_Params();
+        parms.X = X;
+        parms.Y = Y;
+        parms.actorName = actorName;
+        parms.Title = Title;
+        parms.Message = Message;
+        parms.bWarningColour = bWarningColour ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInfoCursorNoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetInfoCursorNone_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetInfoCursorNone
     /// </summary>
     public unsafe virtual void SetInfoCursorNone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetInfoCursorNone", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInfoCursorNoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetInfoCursorNone", true);
+        var parms = new SetInfoCursorNone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetEvidenceCursorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SetEvidenceCursor_Params
+    {
+        [FieldOffset(0)] public float X;
+        [FieldOffset(4)] public float Y;
+        [FieldOffset(8)] public BmSDK.FString EvidenceName;
+        [FieldOffset(20)] public BmSDK.FString actorName;
+        [FieldOffset(32)] public int bScanned;
+        [FieldOffset(36)] public int bShowLine;
+    }
+
     /// <summary>
     /// Function: SetEvidenceCursor
     /// </summary>
     public unsafe virtual void SetEvidenceCursor(float X, float Y, BmSDK.FString EvidenceName, BmSDK.FString actorName, bool bScanned, bool bShowLine)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetEvidenceCursor", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EvidenceName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(actorName, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bScanned, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShowLine, paramsPtr + 36);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetEvidenceCursorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetEvidenceCursor", true);
+        var parms = new SetEvidenceCursor_Params();
+        parms.X = X;
+        parms.Y = Y;
+        parms.EvidenceName = EvidenceName;
+        parms.actorName = actorName;
+        parms.bScanned = bScanned ? 1 : 0;
+        parms.bShowLine = bShowLine ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetEvidenceCursorNoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetEvidenceCursorNone_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetEvidenceCursorNone
     /// </summary>
     public unsafe virtual void SetEvidenceCursorNone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetEvidenceCursorNone", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetEvidenceCursorNoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetEvidenceCursorNone", true);
+        var parms = new SetEvidenceCursorNone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseCurrentCursorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CloseCurrentCursor_Params
+    {
+    }
+
     /// <summary>
     /// Function: CloseCurrentCursor
     /// </summary>
     public unsafe virtual void CloseCurrentCursor()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.CloseCurrentCursor", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseCurrentCursorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.CloseCurrentCursor", true);
+        var parms = new CloseCurrentCursor_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseCurrentCursorUnlessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct CloseCurrentCursorUnless_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RHudExtensionInvestigate.EvidenceDisplayType type_exception;
+    }
+
     /// <summary>
     /// Function: CloseCurrentCursorUnless
     /// </summary>
     public unsafe virtual void CloseCurrentCursorUnless(BmSDK.BmGame.RHudExtensionInvestigate.EvidenceDisplayType type_exception)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.CloseCurrentCursorUnless", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(type_exception, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseCurrentCursorUnlessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.CloseCurrentCursorUnless", true);
+        var parms = new CloseCurrentCursorUnless_Params();
+        parms.type_exception = type_exception;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwitchToModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SwitchToMode_Params
+    {
+        [FieldOffset(0)] public int Mode;
+        [FieldOffset(4)] public int bInDesiredMode;
+        [FieldOffset(8)] public BmSDK.FString TrailName;
+    }
+
     /// <summary>
     /// Function: SwitchToMode
     /// </summary>
     public unsafe virtual void SwitchToMode(int Mode, bool bInDesiredMode, BmSDK.FString TrailName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SwitchToMode", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Mode, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInDesiredMode, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TrailName, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwitchToModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SwitchToMode", true);
+        var parms = new SwitchToMode_Params();
+        parms.Mode = Mode;
+        parms.bInDesiredMode = bInDesiredMode ? 1 : 0;
+        parms.TrailName = TrailName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateNPCCountsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateNPCCounts_Params
+    {
+        [FieldOffset(0)] public int Armed;
+        [FieldOffset(4)] public int UnArmed;
+    }
+
     /// <summary>
     /// Function: UpdateNPCCounts
     /// </summary>
     public unsafe virtual void UpdateNPCCounts(int Armed, int UnArmed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.UpdateNPCCounts", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Armed, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UnArmed, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateNPCCountsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.UpdateNPCCounts", true);
+        var parms = new UpdateNPCCounts_Params();
+        parms.Armed = Armed;
+        parms.UnArmed = UnArmed;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetScreenDepthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetScreenDepth_Params
+    {
+        [FieldOffset(0)] public float inDepth;
+    }
+
     /// <summary>
     /// Function: SetScreenDepth
     /// </summary>
     public unsafe virtual void SetScreenDepth(float inDepth)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetScreenDepth", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inDepth, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetScreenDepthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.SetScreenDepth", true);
+        var parms = new SetScreenDepth_Params();
+        parms.inDepth = inDepth;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Close_Params
+    {
+    }
+
     /// <summary>
     /// Function: Close
     /// </summary>
     public unsafe override void Close()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.Close", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.Close", true);
+        var parms = new Close_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+        [FieldOffset(4)] public BmSDK.FString _ExtensionName;
+        [FieldOffset(16)] public BmSDK.FString _ExtensionPath;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(BmSDK.BmGame.RPlayerController _RPC, BmSDK.FString _ExtensionName, BmSDK.FString _ExtensionPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.Init", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionPath, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionInvestigate.Init", true);
+        var parms = new Init_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        parms._ExtensionName = _ExtensionName;
+        parms._ExtensionPath = _ExtensionPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -439,8 +656,8 @@ public partial class RHudExtensionInvestigate : BmSDK.BmGame.RHudExtension, BmSD
     /// </summary>
     public unsafe BmSDK.BmGame.RHudExtensionInvestigate.EvidenceDisplayType CurrentDisplayType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RHudExtensionInvestigate.EvidenceDisplayType>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(BmSDK.BmGame.RHudExtensionInvestigate.EvidenceDisplayType*)(Ptr + 132); }
+        set { *(BmSDK.BmGame.RHudExtensionInvestigate.EvidenceDisplayType*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -448,8 +665,8 @@ public partial class RHudExtensionInvestigate : BmSDK.BmGame.RHudExtension, BmSD
     /// </summary>
     public unsafe BmSDK.BmGame.RHudExtensionInvestigate.ScannerPrompt CurrentScannerPromptVal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RHudExtensionInvestigate.ScannerPrompt>(Ptr + 133); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 133); }
+        get { return *(BmSDK.BmGame.RHudExtensionInvestigate.ScannerPrompt*)(Ptr + 133); }
+        set { *(BmSDK.BmGame.RHudExtensionInvestigate.ScannerPrompt*)(Ptr + 133) = value; }
     }
 
     /// <summary>
@@ -475,8 +692,8 @@ public partial class RHudExtensionInvestigate : BmSDK.BmGame.RHudExtension, BmSD
     /// </summary>
     public unsafe int NPC_Armed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(int*)(Ptr + 144); }
+        set { *(int*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -484,8 +701,8 @@ public partial class RHudExtensionInvestigate : BmSDK.BmGame.RHudExtension, BmSD
     /// </summary>
     public unsafe int NPC_UnArmed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(int*)(Ptr + 148); }
+        set { *(int*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -583,8 +800,8 @@ public partial class RHudExtensionInvestigate : BmSDK.BmGame.RHudExtension, BmSD
     /// </summary>
     public unsafe float CurrentRendererDepth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
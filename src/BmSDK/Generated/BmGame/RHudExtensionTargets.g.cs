@@ -78,170 +78,284 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
         where TComponent : class, Framework.IScriptComponent<RHudExtensionTargets>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetTargetJammerLockonProportionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetTargetJammerLockonProportion_Params
+    {
+        [FieldOffset(0)] public int CursorID;
+        [FieldOffset(4)] public float Proportion;
+    }
+
     /// <summary>
     /// Function: SetTargetJammerLockonProportion
     /// </summary>
     public unsafe virtual void SetTargetJammerLockonProportion(int CursorID, float Proportion)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetTargetJammerLockonProportion", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CursorID, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proportion, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTargetJammerLockonProportionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetTargetJammerLockonProportion", true);
+        var parms = new SetTargetJammerLockonProportion_Params();
+        parms.CursorID = CursorID;
+        parms.Proportion = Proportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TargetCursorPrivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct TargetCursorPrivate_Params
+    {
+        [FieldOffset(0)] public int CursorID;
+        [FieldOffset(4)] public BmSDK.FString AnimName;
+        [FieldOffset(16)] public int bVisible;
+        [FieldOffset(20)] public int bSnapToPosition;
+        [FieldOffset(24)] public float X;
+        [FieldOffset(28)] public float Y;
+        [FieldOffset(32)] public float Depth;
+        [FieldOffset(36)] public int Pulsing;
+        [FieldOffset(40)] public int Charges;
+        [FieldOffset(44)] public int MaxCharges;
+    }
+
     /// <summary>
     /// Function: TargetCursorPrivate
     /// </summary>
     public unsafe virtual void TargetCursorPrivate(int CursorID, BmSDK.FString AnimName, bool bVisible, bool bSnapToPosition, float X, float Y, float Depth, bool Pulsing, int Charges, int MaxCharges)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.TargetCursorPrivate", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CursorID, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVisible, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSnapToPosition, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Depth, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pulsing, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Charges, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxCharges, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TargetCursorPrivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.TargetCursorPrivate", true);
+        var parms = new TargetCursorPrivate_Params();
+        parms.CursorID = CursorID;
+        parms.AnimName = AnimName;
+        parms.bVisible = bVisible ? 1 : 0;
+        parms.bSnapToPosition = bSnapToPosition ? 1 : 0;
+        parms.X = X;
+        parms.Y = Y;
+        parms.Depth = Depth;
+        parms.Pulsing = Pulsing ? 1 : 0;
+        parms.Charges = Charges;
+        parms.MaxCharges = MaxCharges;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TargetCursorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct TargetCursor_Params
+    {
+        [FieldOffset(0)] public int CursorID;
+        [FieldOffset(4)] public BmSDK.FString AnimName;
+        [FieldOffset(16)] public int bVisible;
+        [FieldOffset(20)] public int bSnapToPosition;
+        [FieldOffset(24)] public float X;
+        [FieldOffset(28)] public float Y;
+        [FieldOffset(32)] public float Depth;
+        [FieldOffset(36)] public int Pulsing;
+        [FieldOffset(40)] public int Charges;
+        [FieldOffset(44)] public int MaxCharges;
+    }
+
     /// <summary>
     /// Function: TargetCursor
     /// </summary>
     public unsafe virtual void TargetCursor(int CursorID, BmSDK.FString AnimName, bool bVisible, bool bSnapToPosition, float X, float Y, float Depth, bool Pulsing = default, int Charges = default, int MaxCharges = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.TargetCursor", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CursorID, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVisible, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSnapToPosition, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Depth, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pulsing, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Charges, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxCharges, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TargetCursorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.TargetCursor", true);
+        var parms = new TargetCursor_Params();
+        parms.CursorID = CursorID;
+        parms.AnimName = AnimName;
+        parms.bVisible = bVisible ? 1 : 0;
+        parms.bSnapToPosition = bSnapToPosition ? 1 : 0;
+        parms.X = X;
+        parms.Y = Y;
+        parms.Depth = Depth;
+        parms.Pulsing = Pulsing ? 1 : 0;
+        parms.Charges = Charges;
+        parms.MaxCharges = MaxCharges;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearAllCursorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearAllCursors_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearAllCursors
     /// </summary>
     public unsafe virtual void ClearAllCursors()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.ClearAllCursors", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearAllCursorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.ClearAllCursors", true);
+        var parms = new ClearAllCursors_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayMissileLaunchTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct DisplayMissileLaunchText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TextToDisplay;
+        [FieldOffset(12)] public float DisplayDuration;
+    }
+
     /// <summary>
     /// Function: DisplayMissileLaunchText
     /// </summary>
     public unsafe virtual void DisplayMissileLaunchText(BmSDK.FString TextToDisplay, float DisplayDuration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.DisplayMissileLaunchText", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextToDisplay, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DisplayDuration, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayMissileLaunchTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.DisplayMissileLaunchText", true);
+        var parms = new DisplayMissileLaunchText_Params();
+        parms.TextToDisplay = TextToDisplay;
+        parms.DisplayDuration = DisplayDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideGrenadeWarningFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideGrenadeWarning_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideGrenadeWarning
     /// </summary>
     public unsafe virtual void HideGrenadeWarning()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.HideGrenadeWarning", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideGrenadeWarningFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.HideGrenadeWarning", true);
+        var parms = new HideGrenadeWarning_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Private_CachedFunction_SetGrenadeWarningFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Private_CachedFunction_SetGrenadeWarning_Params
+    {
+        [FieldOffset(0)] public float grenade_x;
+        [FieldOffset(4)] public float grenade_y;
+        [FieldOffset(8)] public int is_grenade;
+    }
+
     /// <summary>
     /// Function: Private_CachedFunction_SetGrenadeWarning
     /// </summary>
     public unsafe virtual void Private_CachedFunction_SetGrenadeWarning(float grenade_x, float grenade_y, bool is_grenade)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.Private_CachedFunction_SetGrenadeWarning", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(grenade_x, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(grenade_y, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_grenade, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Private_CachedFunction_SetGrenadeWarningFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.Private_CachedFunction_SetGrenadeWarning", true);
+        var parms = new Private_CachedFunction_SetGrenadeWarning_Params();
+        parms.grenade_x = grenade_x;
+        parms.grenade_y = grenade_y;
+        parms.is_grenade = is_grenade ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetGrenadeWarningFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SetGrenadeWarning_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 GrenadePosition;
+        [FieldOffset(12)] public int IsGrenadeType;
+    }
+
     /// <summary>
     /// Function: SetGrenadeWarning
     /// </summary>
     public unsafe virtual void SetGrenadeWarning(System.Numerics.Vector3 GrenadePosition, bool IsGrenadeType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetGrenadeWarning", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GrenadePosition, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IsGrenadeType, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetGrenadeWarningFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetGrenadeWarning", true);
+        var parms = new SetGrenadeWarning_Params();
+        parms.GrenadePosition = GrenadePosition;
+        parms.IsGrenadeType = IsGrenadeType ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateMissileWarningFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpdateMissileWarning_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateMissileWarning
     /// </summary>
     public unsafe virtual void UpdateMissileWarning()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.UpdateMissileWarning", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateMissileWarningFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.UpdateMissileWarning", true);
+        var parms = new UpdateMissileWarning_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMissileWarningFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetMissileWarning_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 _MissilePosition;
+    }
+
     /// <summary>
     /// Function: SetMissileWarning
     /// </summary>
     public unsafe virtual void SetMissileWarning(System.Numerics.Vector3 _MissilePosition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetMissileWarning", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_MissilePosition, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMissileWarningFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetMissileWarning", true);
+        var parms = new SetMissileWarning_Params();
+        parms._MissilePosition = _MissilePosition;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMarkerAttributesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetMarkerAttributes_Params
+    {
+        [FieldOffset(0)] public int MarkerIndex;
+        [FieldOffset(4)] public int MarkerVisible;
+        [FieldOffset(8)] public float MarkerAngle;
+    }
+
     /// <summary>
     /// Function: SetMarkerAttributes
     /// </summary>
     public unsafe virtual void SetMarkerAttributes(int MarkerIndex, bool MarkerVisible, float MarkerAngle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetMarkerAttributes", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerVisible, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerAngle, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMarkerAttributesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetMarkerAttributes", true);
+        var parms = new SetMarkerAttributes_Params();
+        parms.MarkerIndex = MarkerIndex;
+        parms.MarkerVisible = MarkerVisible ? 1 : 0;
+        parms.MarkerAngle = MarkerAngle;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsMarkerVisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsMarkerVisible_Params
+    {
+        [FieldOffset(0)] public int MarkerIndex;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsMarkerVisible
     /// </summary>
     public unsafe virtual bool IsMarkerVisible(int MarkerIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.IsMarkerVisible", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsMarkerVisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.IsMarkerVisible", true);
+        var parms = new IsMarkerVisible_Params();
+        parms.MarkerIndex = MarkerIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_NotifyMarkerLocationChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NotifyMarkerLocationChanged_Params
+    {
+        [FieldOffset(0)] public int MarkerIndex;
     }
 
     /// <summary>
@@ -249,36 +363,59 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe virtual void NotifyMarkerLocationChanged(int MarkerIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.NotifyMarkerLocationChanged", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyMarkerLocationChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.NotifyMarkerLocationChanged", true);
+        var parms = new NotifyMarkerLocationChanged_Params();
+        parms.MarkerIndex = MarkerIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCustomMarkerFrameStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetCustomMarkerFrameString_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FrameString;
+    }
+
     /// <summary>
     /// Function: SetCustomMarkerFrameString
     /// </summary>
     public unsafe virtual void SetCustomMarkerFrameString(BmSDK.FString FrameString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetCustomMarkerFrameString", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FrameString, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCustomMarkerFrameStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetCustomMarkerFrameString", true);
+        var parms = new SetCustomMarkerFrameString_Params();
+        parms.FrameString = FrameString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckCustomMarkerFrameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CheckCustomMarkerFrame_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TestSubstring;
+        [FieldOffset(12)] public BmSDK.FString FrameToSet;
+        [FieldOffset(24)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckCustomMarkerFrame
     /// </summary>
     public unsafe virtual bool CheckCustomMarkerFrame(BmSDK.FString TestSubstring, BmSDK.FString FrameToSet)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.CheckCustomMarkerFrame", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestSubstring, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FrameToSet, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_CheckCustomMarkerFrameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.CheckCustomMarkerFrame", true);
+        var parms = new CheckCustomMarkerFrame_Params();
+        parms.TestSubstring = TestSubstring;
+        parms.FrameToSet = FrameToSet;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetCustomMarkerIconTypeNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetCustomMarkerIconTypeName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString _CustomMarkerIconName;
     }
 
     /// <summary>
@@ -286,136 +423,203 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe virtual void SetCustomMarkerIconTypeName(BmSDK.FString _CustomMarkerIconName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetCustomMarkerIconTypeName", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_CustomMarkerIconName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCustomMarkerIconTypeNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetCustomMarkerIconTypeName", true);
+        var parms = new SetCustomMarkerIconTypeName_Params();
+        parms._CustomMarkerIconName = _CustomMarkerIconName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideCompassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideCompass_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideCompass
     /// </summary>
     public unsafe virtual void HideCompass()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.HideCompass", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideCompassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.HideCompass", true);
+        var parms = new HideCompass_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCompassAnglePrivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCompassAnglePrivate_Params
+    {
+        [FieldOffset(0)] public float CompassAngle;
+    }
+
     /// <summary>
     /// Function: SetCompassAnglePrivate
     /// </summary>
     public unsafe virtual void SetCompassAnglePrivate(float CompassAngle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetCompassAnglePrivate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CompassAngle, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCompassAnglePrivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetCompassAnglePrivate", true);
+        var parms = new SetCompassAnglePrivate_Params();
+        parms.CompassAngle = CompassAngle;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCompassAngleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetCompassAngle_Params
+    {
+        [FieldOffset(0)] public float CompassAngle;
+    }
+
     /// <summary>
     /// Function: SetCompassAngle
     /// </summary>
     public unsafe virtual void SetCompassAngle(float CompassAngle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetCompassAngle", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CompassAngle, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCompassAngleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetCompassAngle", true);
+        var parms = new SetCompassAngle_Params();
+        parms.CompassAngle = CompassAngle;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetAnytimeAngleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetAnytimeAngle_Params
+    {
+        [FieldOffset(0)] public int bVisible;
+        [FieldOffset(4)] public float anytimeAngle;
+    }
+
     /// <summary>
     /// Function: SetAnytimeAngle
     /// </summary>
     public unsafe virtual void SetAnytimeAngle(bool bVisible, float anytimeAngle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetAnytimeAngle", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVisible, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(anytimeAngle, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAnytimeAngleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.SetAnytimeAngle", true);
+        var parms = new SetAnytimeAngle_Params();
+        parms.bVisible = bVisible ? 1 : 0;
+        parms.anytimeAngle = anytimeAngle;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawGrappleIconAtEndOfHudUpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DrawGrappleIconAtEndOfHudUpdate_Params
+    {
+    }
+
     /// <summary>
     /// Function: DrawGrappleIconAtEndOfHudUpdate
     /// </summary>
     public unsafe virtual void DrawGrappleIconAtEndOfHudUpdate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.DrawGrappleIconAtEndOfHudUpdate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawGrappleIconAtEndOfHudUpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.DrawGrappleIconAtEndOfHudUpdate", true);
+        var parms = new DrawGrappleIconAtEndOfHudUpdate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Private_SendAnytimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct Private_SendAnytime_Params
+    {
+        [FieldOffset(0)] public int bVisible;
+        [FieldOffset(4)] public float X;
+        [FieldOffset(8)] public float Y;
+        [FieldOffset(12)] public BmSDK.FString AnimName;
+        [FieldOffset(24)] public int bRestart;
+        [FieldOffset(28)] public float Depth;
+    }
+
     /// <summary>
     /// Function: Private_SendAnytime
     /// </summary>
     public unsafe virtual void Private_SendAnytime(bool bVisible, float X, float Y, BmSDK.FString AnimName, bool bRestart, float Depth)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.Private_SendAnytime", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVisible, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bRestart, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Depth, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Private_SendAnytimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.Private_SendAnytime", true);
+        var parms = new Private_SendAnytime_Params();
+        parms.bVisible = bVisible ? 1 : 0;
+        parms.X = X;
+        parms.Y = Y;
+        parms.AnimName = AnimName;
+        parms.bRestart = bRestart ? 1 : 0;
+        parms.Depth = Depth;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowGrappleIconFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ShowGrappleIcon_Params
+    {
+        [FieldOffset(0)] public int bVisible;
+        [FieldOffset(4)] public float X;
+        [FieldOffset(8)] public float Y;
+        [FieldOffset(12)] public BmSDK.FString AnimName;
+        [FieldOffset(24)] public int bRestart;
+        [FieldOffset(28)] public float Depth;
+    }
+
     /// <summary>
     /// Function: ShowGrappleIcon
     /// </summary>
     public unsafe virtual void ShowGrappleIcon(bool bVisible, float X, float Y, BmSDK.FString AnimName, bool bRestart, float Depth)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.ShowGrappleIcon", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVisible, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bRestart, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Depth, paramsPtr + 28);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ShowGrappleIconFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.ShowGrappleIcon", true);
+        var parms = new ShowGrappleIcon_Params();
+        parms.bVisible = bVisible ? 1 : 0;
+        parms.X = X;
+        parms.Y = Y;
+        parms.AnimName = AnimName;
+        parms.bRestart = bRestart ? 1 : 0;
+        parms.Depth = Depth;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Close_Params
+    {
+    }
+
     /// <summary>
     /// Function: Close
     /// </summary>
     public unsafe override void Close()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.Close", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.Close", true);
+        var parms = new Close_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+        [FieldOffset(4)] public BmSDK.FString _ExtensionName;
+        [FieldOffset(16)] public BmSDK.FString _ExtensionPath;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override bool Init(BmSDK.BmGame.RPlayerController _RPC, BmSDK.FString _ExtensionName, BmSDK.FString _ExtensionPath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.Init", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ExtensionPath, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RHudExtensionTargets.Init", true);
+        var parms = new Init_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        parms._ExtensionName = _ExtensionName;
+        parms._ExtensionPath = _ExtensionPath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -433,8 +637,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool Anytime_bVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 1; else *(int*)(Ptr + 132) &= ~1; }
     }
 
     /// <summary>
@@ -442,8 +646,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool Anytime_bRestart
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 2; else *(int*)(Ptr + 132) &= ~2; }
     }
 
     /// <summary>
@@ -451,8 +655,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool AnytimeAngleVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 4; else *(int*)(Ptr + 132) &= ~4; }
     }
 
     /// <summary>
@@ -460,8 +664,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool bInSplitscreen
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 8; else *(int*)(Ptr + 132) &= ~8; }
     }
 
     /// <summary>
@@ -469,8 +673,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool bCompassVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 16; else *(int*)(Ptr + 132) &= ~16; }
     }
 
     /// <summary>
@@ -478,8 +682,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool bGrenadeWarningActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 32; else *(int*)(Ptr + 132) &= ~32; }
     }
 
     /// <summary>
@@ -487,8 +691,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool CustomMarkerSuppressesExtraHud
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 64; else *(int*)(Ptr + 132) &= ~64; }
     }
 
     /// <summary>
@@ -496,8 +700,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe bool MissileIsActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 128; else *(int*)(Ptr + 132) &= ~128; }
     }
 
     /// <summary>
@@ -505,8 +709,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe float Anytime_X
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(float*)(Ptr + 136); }
+        set { *(float*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -514,8 +718,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe float Anytime_Y
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(float*)(Ptr + 140); }
+        set { *(float*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -523,8 +727,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe float Anytime_Depth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(float*)(Ptr + 144); }
+        set { *(float*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -541,8 +745,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe float AnytimeAngleValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -595,8 +799,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe int IgnoreCompassCountdown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(int*)(Ptr + 224); }
+        set { *(int*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -604,8 +808,8 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe float LastCompassAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -700,7 +904,7 @@ public partial class RHudExtensionTargets : BmSDK.BmGame.RHudExtension, BmSDK.IG
     /// </summary>
     public unsafe int MaxTargetCursorIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(int*)(Ptr + 352); }
+        set { *(int*)(Ptr + 352) = value; }
     }
 }
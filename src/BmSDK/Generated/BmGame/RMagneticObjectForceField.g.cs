@@ -78,23 +78,24 @@ public partial class RMagneticObjectForceField : BmSDK.Engine.NxRadialForceField
         where TComponent : class, Framework.IScriptComponent<RMagneticObjectForceField>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetFieldPropertiesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetFieldProperties_Params
+    {
+        [FieldOffset(0)] public float Radius;
+        [FieldOffset(4)] public float Strength;
+    }
+
     /// <summary>
     /// Function: SetFieldProperties
     /// </summary>
     public unsafe virtual void SetFieldProperties(float Radius, float Strength)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RMagneticObjectForceField.SetFieldProperties", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Radius, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Strength, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetFieldPropertiesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RMagneticObjectForceField.SetFieldProperties", true);
+        var parms = new SetFieldProperties_Params();
+        parms.Radius = Radius;
+        parms.Strength = Strength;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -103,7 +104,7 @@ public partial class RMagneticObjectForceField : BmSDK.Engine.NxRadialForceField
     /// </summary>
     public unsafe float FieldStrengthMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(float*)(Ptr + 512); }
+        set { *(float*)(Ptr + 512) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RMapPlacementMarker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RMapPlacementMarker.MapMarkerType MarkerType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RMapPlacementMarker.MapMarkerType>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(BmSDK.BmGame.RMapPlacementMarker.MapMarkerType*)(Ptr + 428); }
+        set { *(BmSDK.BmGame.RMapPlacementMarker.MapMarkerType*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RMapPlacementMarker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.ERiddlerLocationName>(Ptr + 429); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 429); }
+        get { return *(BmSDK.BmGame.RPersistentData.ERiddlerLocationName*)(Ptr + 429); }
+        set { *(BmSDK.BmGame.RPersistentData.ERiddlerLocationName*)(Ptr + 429) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RMapPlacementMarker : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int Index
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(int*)(Ptr + 432); }
+        set { *(int*)(Ptr + 432) = value; }
     }
 
     /// <summary>
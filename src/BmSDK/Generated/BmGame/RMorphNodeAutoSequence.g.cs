@@ -92,8 +92,8 @@ public partial class RMorphNodeAutoSequence : BmSDK.Engine.MorphNodeBase, BmSDK.
     /// </summary>
     public unsafe bool SynchronizeToAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 1; else *(int*)(Ptr + 96) &= ~1; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class RMorphNodeAutoSequence : BmSDK.Engine.MorphNodeBase, BmSDK.
     /// </summary>
     public unsafe float NormalizedTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(float*)(Ptr + 112); }
+        set { *(float*)(Ptr + 112) = value; }
     }
 }
@@ -103,7 +103,7 @@ public partial class RNavMeshCollisionSettingsVolume : BmSDK.Engine.Volume, BmSD
     /// </summary>
     public unsafe BmSDK.BmGame.RNavMeshCollisionSettingsVolume.ENavMeshCollisionSettings CollisionSettings
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RNavMeshCollisionSettingsVolume.ENavMeshCollisionSettings>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(BmSDK.BmGame.RNavMeshCollisionSettingsVolume.ENavMeshCollisionSettings*)(Ptr + 484); }
+        set { *(BmSDK.BmGame.RNavMeshCollisionSettingsVolume.ENavMeshCollisionSettings*)(Ptr + 484) = value; }
     }
 }
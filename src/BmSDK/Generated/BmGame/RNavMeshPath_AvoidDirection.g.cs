@@ -89,8 +89,8 @@ public partial class RNavMeshPath_AvoidDirection : BmSDK.Engine.NavMeshPathConst
     /// </summary>
     public unsafe float AvoidStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -98,7 +98,7 @@ public partial class RNavMeshPath_AvoidDirection : BmSDK.Engine.NavMeshPathConst
     /// </summary>
     public unsafe float AvoidDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 }
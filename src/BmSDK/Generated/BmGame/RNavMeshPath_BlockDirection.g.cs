@@ -78,32 +78,57 @@ public partial class RNavMeshPath_BlockDirection : BmSDK.Engine.NavMeshPathConst
         where TComponent : class, Framework.IScriptComponent<RNavMeshPath_BlockDirection>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_RecycleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Recycle_Params
+    {
+    }
+
     /// <summary>
     /// Function: Recycle
     /// </summary>
     public unsafe override void Recycle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RNavMeshPath_BlockDirection.Recycle", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RecycleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RNavMeshPath_BlockDirection.Recycle", true);
+        var parms = new Recycle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BlockDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct BlockDir_Params
+    {
+        [FieldOffset(0)] public nint NewNavHandle;
+        [FieldOffset(4)] public System.Numerics.Vector3 nBlockPosition;
+        [FieldOffset(16)] public System.Numerics.Vector3 nBlockDirection;
+        [FieldOffset(28)] public int nBlockAngleHardYaw;
+        [FieldOffset(32)] public int nBlockAngleSoftYaw;
+        [FieldOffset(36)] public float nBlockDistance;
+        [FieldOffset(40)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: BlockDir
     /// </summary>
     public unsafe static bool BlockDir(BmSDK.BmGame.RNavigationHandle NewNavHandle, System.Numerics.Vector3 nBlockPosition, System.Numerics.Vector3 nBlockDirection, int nBlockAngleHardYaw, int nBlockAngleSoftYaw, float nBlockDistance)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RNavMeshPath_BlockDirection.BlockDir", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewNavHandle, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(nBlockPosition, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(nBlockDirection, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(nBlockAngleHardYaw, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(nBlockAngleSoftYaw, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(nBlockDistance, paramsPtr + 36);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 40);
+        var funcManaged = s_BlockDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RNavMeshPath_BlockDirection.BlockDir", true);
+        var parms = new BlockDir_Params();
+        parms.NewNavHandle = NewNavHandle?.Ptr ?? 0;
+        parms.nBlockPosition = nBlockPosition;
+        parms.nBlockDirection = nBlockDirection;
+        parms.nBlockAngleHardYaw = nBlockAngleHardYaw;
+        parms.nBlockAngleSoftYaw = nBlockAngleSoftYaw;
+        parms.nBlockDistance = nBlockDistance;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RecycleNativeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RecycleNative_Params
+    {
     }
 
     /// <summary>
@@ -111,35 +136,28 @@ public partial class RNavMeshPath_BlockDirection : BmSDK.Engine.NavMeshPathConst
     /// </summary>
     public unsafe virtual void RecycleNative()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RNavMeshPath_BlockDirection.RecycleNative", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RecycleNativeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RNavMeshPath_BlockDirection.RecycleNative", true);
+        var parms = new RecycleNative_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Initialise_Params
+    {
+        [FieldOffset(0)] public nint NewNavHandle;
+    }
+
     /// <summary>
     /// Function: Initialise
     /// </summary>
     public unsafe virtual void Initialise(BmSDK.BmGame.RNavigationHandle NewNavHandle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RNavMeshPath_BlockDirection.Initialise", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewNavHandle, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RNavMeshPath_BlockDirection.Initialise", true);
+        var parms = new Initialise_Params();
+        parms.NewNavHandle = NewNavHandle?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -166,8 +184,8 @@ public partial class RNavMeshPath_BlockDirection : BmSDK.Engine.NavMeshPathConst
     /// </summary>
     public unsafe float BlockAngleHard
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -175,8 +193,8 @@ public partial class RNavMeshPath_BlockDirection : BmSDK.Engine.NavMeshPathConst
     /// </summary>
     public unsafe float BlockAngleSoft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -184,8 +202,8 @@ public partial class RNavMeshPath_BlockDirection : BmSDK.Engine.NavMeshPathConst
     /// </summary>
     public unsafe float BlockDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -78,33 +78,66 @@ public partial class RObjectPool : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RObjectPool>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Initialise_Params
+    {
+        [FieldOffset(0)] public nint Game;
+    }
+
     /// <summary>
     /// Function: Initialise
     /// </summary>
     public unsafe virtual void Initialise(BmSDK.BmGame.RGameRI Game)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RObjectPool.Initialise", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Game, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RObjectPool.Initialise", true);
+        var parms = new Initialise_Params();
+        parms.Game = Game?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnEmitterOnMeshFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct SpawnEmitterOnMesh_Params
+    {
+        [FieldOffset(0)] public nint Template;
+        [FieldOffset(4)] public System.Numerics.Vector3 SpawnLocation;
+        [FieldOffset(16)] public BmSDK.Rotator SpawnRotation;
+        [FieldOffset(28)] public nint Skeleton;
+        [FieldOffset(32)] public BmSDK.FName Bone;
+        [FieldOffset(40)] public int HardAttach;
+        [FieldOffset(44)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: SpawnEmitterOnMesh
     /// </summary>
     public unsafe virtual BmSDK.Engine.Emitter SpawnEmitterOnMesh(BmSDK.Engine.ParticleSystem Template, System.Numerics.Vector3 SpawnLocation, BmSDK.Rotator SpawnRotation, BmSDK.Engine.SkeletalMeshComponent Skeleton = default, BmSDK.FName Bone = default, bool HardAttach = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RObjectPool.SpawnEmitterOnMesh", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Template, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnRotation, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Skeleton, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bone, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HardAttach, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Emitter>(paramsPtr + 44);
+        var funcManaged = s_SpawnEmitterOnMeshFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RObjectPool.SpawnEmitterOnMesh", true);
+        var parms = new SpawnEmitterOnMesh_Params();
+        parms.Template = Template?.Ptr ?? 0;
+        parms.SpawnLocation = SpawnLocation;
+        parms.SpawnRotation = SpawnRotation;
+        parms.Skeleton = Skeleton?.Ptr ?? 0;
+        parms.Bone = Bone;
+        parms.HardAttach = HardAttach ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Emitter)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SpawnEmitterOnPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct SpawnEmitterOnPawn_Params
+    {
+        [FieldOffset(0)] public nint Template;
+        [FieldOffset(4)] public System.Numerics.Vector3 SpawnLocation;
+        [FieldOffset(16)] public BmSDK.Rotator SpawnRotation;
+        [FieldOffset(28)] public nint P;
+        [FieldOffset(32)] public BmSDK.FName Bone;
+        [FieldOffset(40)] public int HardAttach;
+        [FieldOffset(44)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -112,16 +145,28 @@ public partial class RObjectPool : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.Engine.Emitter SpawnEmitterOnPawn(BmSDK.Engine.ParticleSystem Template, System.Numerics.Vector3 SpawnLocation, BmSDK.Rotator SpawnRotation, BmSDK.Engine.Pawn P = default, BmSDK.FName Bone = default, bool HardAttach = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RObjectPool.SpawnEmitterOnPawn", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Template, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnRotation, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(P, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bone, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HardAttach, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Emitter>(paramsPtr + 44);
+        var funcManaged = s_SpawnEmitterOnPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RObjectPool.SpawnEmitterOnPawn", true);
+        var parms = new SpawnEmitterOnPawn_Params();
+        parms.Template = Template?.Ptr ?? 0;
+        parms.SpawnLocation = SpawnLocation;
+        parms.SpawnRotation = SpawnRotation;
+        parms.P = P?.Ptr ?? 0;
+        parms.Bone = Bone;
+        parms.HardAttach = HardAttach ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Emitter)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SpawnEmitterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct SpawnEmitter_Params
+    {
+        [FieldOffset(0)] public nint Template;
+        [FieldOffset(4)] public System.Numerics.Vector3 SpawnLocation;
+        [FieldOffset(16)] public BmSDK.Rotator SpawnRotation;
+        [FieldOffset(28)] public int TranslucencySortPriority;
+        [FieldOffset(32)] public float DrawScale;
+        [FieldOffset(36)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -129,15 +174,15 @@ public partial class RObjectPool : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.Engine.Emitter SpawnEmitter(BmSDK.Engine.ParticleSystem Template, System.Numerics.Vector3 SpawnLocation, BmSDK.Rotator SpawnRotation, int TranslucencySortPriority = default, float DrawScale = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RObjectPool.SpawnEmitter", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Template, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnRotation, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TranslucencySortPriority, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DrawScale, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Emitter>(paramsPtr + 36);
+        var funcManaged = s_SpawnEmitterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RObjectPool.SpawnEmitter", true);
+        var parms = new SpawnEmitter_Params();
+        parms.Template = Template?.Ptr ?? 0;
+        parms.SpawnLocation = SpawnLocation;
+        parms.SpawnRotation = SpawnRotation;
+        parms.TranslucencySortPriority = TranslucencySortPriority;
+        parms.DrawScale = DrawScale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Emitter)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -402,10 +447,6 @@ public partial class RObjectPool : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Index
         /// </summary>
-        public unsafe int Index
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }; }
-        }
+        [FieldOffset(120)] public int Index;
     }
 }
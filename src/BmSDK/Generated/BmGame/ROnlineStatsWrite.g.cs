@@ -78,31 +78,49 @@ public partial class ROnlineStatsWrite : BmSDK.Engine.OnlineStatsWrite, BmSDK.IG
         where TComponent : class, Framework.IScriptComponent<ROnlineStatsWrite>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CopyAndWriteAllStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct CopyAndWriteAllStats_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId UniqId;
+        [FieldOffset(12)] public nint PRI;
+    }
+
     /// <summary>
     /// Function: CopyAndWriteAllStats
     /// </summary>
     public unsafe virtual void CopyAndWriteAllStats(BmSDK.BmGame.RPlayerController PC, BmSDK.Engine.OnlineSubsystem.FUniqueNetId UniqId, BmSDK.Engine.PlayerReplicationInfo PRI, BmSDK.Engine.OnlineStatsInterface StatsInterface)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.ROnlineStatsWrite.CopyAndWriteAllStats", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UniqId, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PRI, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StatsInterface, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CopyAndWriteAllStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.ROnlineStatsWrite.CopyAndWriteAllStats", true);
+        var parms = new CopyAndWriteAllStats_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        parms.UniqId = UniqId;
+        parms.PRI = PRI?.Ptr ?? 0;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(StatsInterface, (byte*)&parms + 16);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CopyAllStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct CopyAllStats_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public nint PRI;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CopyAllStats
     /// </summary>
     public unsafe virtual bool CopyAllStats(BmSDK.BmGame.RPlayerController PC, BmSDK.Engine.PlayerReplicationInfo PRI)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.ROnlineStatsWrite.CopyAllStats", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PRI, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_CopyAllStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.ROnlineStatsWrite.CopyAllStats", true);
+        var parms = new CopyAllStats_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        parms.PRI = PRI?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 }
@@ -78,15 +78,22 @@ public partial class ROutcastWaveController : BmSDK.BmGame.RBMWaveController, Bm
         where TComponent : class, Framework.IScriptComponent<ROutcastWaveController>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.ROutcastWaveController.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.ROutcastWaveController.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -94,8 +101,8 @@ public partial class ROutcastWaveController : BmSDK.BmGame.RBMWaveController, Bm
     /// </summary>
     public unsafe int FleeingOutcasts_Min
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(int*)(Ptr + 252); }
+        set { *(int*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -103,8 +110,8 @@ public partial class ROutcastWaveController : BmSDK.BmGame.RBMWaveController, Bm
     /// </summary>
     public unsafe int FleeingOutcasts_Max
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(int*)(Ptr + 256); }
+        set { *(int*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -112,8 +119,8 @@ public partial class ROutcastWaveController : BmSDK.BmGame.RBMWaveController, Bm
     /// </summary>
     public unsafe bool bSetFleeFlags
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 1; else *(int*)(Ptr + 260) &= ~1; }
     }
 
     /// <summary>
@@ -121,8 +128,8 @@ public partial class ROutcastWaveController : BmSDK.BmGame.RBMWaveController, Bm
     /// </summary>
     public unsafe bool bForceAllToFleePoints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 2; else *(int*)(Ptr + 260) &= ~2; }
     }
 
     /// <summary>
@@ -130,7 +137,7 @@ public partial class ROutcastWaveController : BmSDK.BmGame.RBMWaveController, Bm
     /// </summary>
     public unsafe bool bForceAllToIdlePoints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 4; else *(int*)(Ptr + 260) &= ~4; }
     }
 }
@@ -78,16 +78,24 @@ public partial class RParticleModuleSpawnOnDeath : BmSDK.BmGame.RParticleModuleO
         where TComponent : class, Framework.IScriptComponent<RParticleModuleSpawnOnDeath>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SpawnParticlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SpawnParticles_Params
+    {
+        [FieldOffset(0)] public nint OwningActor;
+        [FieldOffset(4)] public System.Numerics.Vector3 Position;
+    }
+
     /// <summary>
     /// Function: SpawnParticles
     /// </summary>
     public unsafe virtual void SpawnParticles(BmSDK.Engine.Actor OwningActor, System.Numerics.Vector3 Position)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RParticleModuleSpawnOnDeath.SpawnParticles", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OwningActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Position, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnParticlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RParticleModuleSpawnOnDeath.SpawnParticles", true);
+        var parms = new SpawnParticles_Params();
+        parms.OwningActor = OwningActor?.Ptr ?? 0;
+        parms.Position = Position;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -73,15 +73,29 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
         where TComponent : class, Framework.IScriptComponent<RPawnBossClayfaceBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ShouldStopControllableBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldStopControllableBatarang_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldStopControllableBatarang
     /// </summary>
     public unsafe override bool ShouldStopControllableBatarang()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.ShouldStopControllableBatarang", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldStopControllableBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.ShouldStopControllableBatarang", true);
+        var parms = new ShouldStopControllableBatarang_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HitByFreezeClusterGrenadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HitByFreezeClusterGrenade_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -89,10 +103,18 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe virtual bool HitByFreezeClusterGrenade()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.HitByFreezeClusterGrenade", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HitByFreezeClusterGrenadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.HitByFreezeClusterGrenade", true);
+        var parms = new HitByFreezeClusterGrenade_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HitByFreezeGrenadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HitByFreezeGrenade_Params
+    {
+        [FieldOffset(0)] public int bPlayEffect;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -100,11 +122,19 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe virtual bool HitByFreezeGrenade(out int bPlayEffect)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.HitByFreezeGrenade", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        bPlayEffect = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_HitByFreezeGrenadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.HitByFreezeGrenade", true);
+        var parms = new HitByFreezeGrenade_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        bPlayEffect = parms.bPlayEffect;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StopFreezeBlastLegEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StopFreezeBlastLegEffect_Params
+    {
+        [FieldOffset(0)] public int bPlayBreakEffect;
+        [FieldOffset(4)] public int bDeactivatedBehaviour;
     }
 
     /// <summary>
@@ -112,59 +142,99 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe override void StopFreezeBlastLegEffect(bool bPlayBreakEffect = default, bool bDeactivatedBehaviour = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.StopFreezeBlastLegEffect", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayBreakEffect, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDeactivatedBehaviour, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopFreezeBlastLegEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.StopFreezeBlastLegEffect", true);
+        var parms = new StopFreezeBlastLegEffect_Params();
+        parms.bPlayBreakEffect = bPlayBreakEffect ? 1 : 0;
+        parms.bDeactivatedBehaviour = bDeactivatedBehaviour ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopFreezeBlastTorsoEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StopFreezeBlastTorsoEffect_Params
+    {
+        [FieldOffset(0)] public int bPlayBreakEffect;
+        [FieldOffset(4)] public float Delay;
+    }
+
     /// <summary>
     /// Function: StopFreezeBlastTorsoEffect
     /// </summary>
     public unsafe override void StopFreezeBlastTorsoEffect(bool bPlayBreakEffect = default, float Delay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.StopFreezeBlastTorsoEffect", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayBreakEffect, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Delay, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopFreezeBlastTorsoEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.StopFreezeBlastTorsoEffect", true);
+        var parms = new StopFreezeBlastTorsoEffect_Params();
+        parms.bPlayBreakEffect = bPlayBreakEffect ? 1 : 0;
+        parms.Delay = Delay;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartFreezeBlastLegEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartFreezeBlastLegEffect_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartFreezeBlastLegEffect
     /// </summary>
     public unsafe override void StartFreezeBlastLegEffect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.StartFreezeBlastLegEffect", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartFreezeBlastLegEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.StartFreezeBlastLegEffect", true);
+        var parms = new StartFreezeBlastLegEffect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartFreezeBlastTorsoEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartFreezeBlastTorsoEffect_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartFreezeBlastTorsoEffect
     /// </summary>
     public unsafe override void StartFreezeBlastTorsoEffect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.StartFreezeBlastTorsoEffect", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartFreezeBlastTorsoEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.StartFreezeBlastTorsoEffect", true);
+        var parms = new StartFreezeBlastTorsoEffect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AllowCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AllowCamera_Params
+    {
+        [FieldOffset(0)] public nint SpecialMove;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AllowCamera
     /// </summary>
     public unsafe virtual bool AllowCamera(BmSDK.BmGame.RSpecialMoveConfig SpecialMove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.AllowCamera", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpecialMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_AllowCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.AllowCamera", true);
+        var parms = new AllowCamera_Params();
+        parms.SpecialMove = SpecialMove?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpawnPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct SpawnPawn_Params
+    {
+        [FieldOffset(0)] public nint NewPawnClass;
+        [FieldOffset(4)] public nint NewCharacterClass;
+        [FieldOffset(8)] public nint NewWeaponClass;
+        [FieldOffset(12)] public System.Numerics.Vector3 NewSpawnLoc;
+        [FieldOffset(24)] public BmSDK.Rotator NewSpawnRot;
+        [FieldOffset(36)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -172,22 +242,15 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RPawn SpawnPawn(BmSDK.Class NewPawnClass, BmSDK.Class NewCharacterClass, BmSDK.Class NewWeaponClass, System.Numerics.Vector3 NewSpawnLoc, BmSDK.Rotator NewSpawnRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.SpawnPawn", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPawnClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCharacterClass, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewWeaponClass, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSpawnLoc, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSpawnRot, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawn>(paramsPtr + 36);
+        var funcManaged = s_SpawnPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossClayfaceBase.SpawnPawn", true);
+        var parms = new SpawnPawn_Params();
+        parms.NewPawnClass = NewPawnClass?.Ptr ?? 0;
+        parms.NewCharacterClass = NewCharacterClass?.Ptr ?? 0;
+        parms.NewWeaponClass = NewWeaponClass?.Ptr ?? 0;
+        parms.NewSpawnLoc = NewSpawnLoc;
+        parms.NewSpawnRot = NewSpawnRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RPawn)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -204,8 +267,8 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe float BatmanDamageImmunity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3564); }
+        get { return *(float*)(Ptr + 3564); }
+        set { *(float*)(Ptr + 3564) = value; }
     }
 
     /// <summary>
@@ -222,8 +285,8 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe float BMClayVal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3572); }
+        get { return *(float*)(Ptr + 3572); }
+        set { *(float*)(Ptr + 3572) = value; }
     }
 
     /// <summary>
@@ -231,8 +294,8 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe bool DebugOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3576) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3576); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3576); }
+        get { return (*(int*)(Ptr + 3576) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 3576) |= 1; else *(int*)(Ptr + 3576) &= ~1; }
     }
 
     /// <summary>
@@ -240,8 +303,8 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe float DebugDroneTrackingSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3580); }
+        get { return *(float*)(Ptr + 3580); }
+        set { *(float*)(Ptr + 3580) = value; }
     }
 
     /// <summary>
@@ -249,8 +312,8 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe float DebugDroneRunSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3584); }
+        get { return *(float*)(Ptr + 3584); }
+        set { *(float*)(Ptr + 3584) = value; }
     }
 
     /// <summary>
@@ -258,8 +321,8 @@ public partial class RPawnBossClayfaceBase : BmSDK.BmGame.RPawnVillain, BmSDK.IG
     /// </summary>
     public unsafe int DebugAttackingDrones
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3588); }
+        get { return *(int*)(Ptr + 3588); }
+        set { *(int*)(Ptr + 3588) = value; }
     }
 
     /// <summary>
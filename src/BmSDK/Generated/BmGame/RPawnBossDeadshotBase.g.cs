@@ -73,14 +73,20 @@ public partial class RPawnBossDeadshotBase : BmSDK.BmGame.RPawnVillainThug, BmSD
         where TComponent : class, Framework.IScriptComponent<RPawnBossDeadshotBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_JammerGadgetUsedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct JammerGadgetUsed_Params
+    {
+    }
+
     /// <summary>
     /// Function: JammerGadgetUsed
     /// </summary>
     public unsafe virtual void JammerGadgetUsed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossDeadshotBase.JammerGadgetUsed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_JammerGadgetUsedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossDeadshotBase.JammerGadgetUsed", true);
+        var parms = new JammerGadgetUsed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
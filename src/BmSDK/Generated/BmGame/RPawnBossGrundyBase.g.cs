@@ -73,45 +73,67 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         where TComponent : class, Framework.IScriptComponent<RPawnBossGrundyBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HitByFreezeClusterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HitByFreezeCluster_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ClusterLocation;
+    }
+
     /// <summary>
     /// Function: HitByFreezeCluster
     /// </summary>
     public unsafe virtual void HitByFreezeCluster(System.Numerics.Vector3 ClusterLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.HitByFreezeCluster", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClusterLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByFreezeClusterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.HitByFreezeCluster", true);
+        var parms = new HitByFreezeCluster_Params();
+        parms.ClusterLocation = ClusterLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitByFreezeBlastFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HitByFreezeBlast_Params
+    {
+    }
+
     /// <summary>
     /// Function: HitByFreezeBlast
     /// </summary>
     public unsafe virtual void HitByFreezeBlast()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.HitByFreezeBlast", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByFreezeBlastFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.HitByFreezeBlast", true);
+        var parms = new HitByFreezeBlast_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSmashDistToWallFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSmashDistToWall_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSmashDistToWall
     /// </summary>
     public unsafe virtual float GetSmashDistToWall()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetSmashDistToWall", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetSmashDistToWallFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetSmashDistToWall", true);
+        var parms = new GetSmashDistToWall_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetLandingNotifyTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetLandingNotifyTime_Params
+    {
+        [FieldOffset(0)] public nint inAnim;
+        [FieldOffset(4)] public float landingTime;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -119,19 +141,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool GetLandingNotifyTime(BmSDK.Engine.AnimSequence inAnim, out float landingTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetLandingNotifyTime", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAnim, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        landingTime = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_GetLandingNotifyTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetLandingNotifyTime", true);
+        var parms = new GetLandingNotifyTime_Params();
+        parms.inAnim = inAnim?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        landingTime = parms.landingTime;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetChainSmashNotifyTimesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct GetChainSmashNotifyTimes_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil.FNotifyAnim inAnim;
+        [FieldOffset(20)] public float beginExtendTime;
+        [FieldOffset(24)] public float endExtendTime;
+        [FieldOffset(28)] public float beginRetractTime;
+        [FieldOffset(32)] public float endRetractTime;
+        [FieldOffset(36)] public int ReturnValue;
     }
 
     /// <summary>
@@ -139,22 +166,23 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool GetChainSmashNotifyTimes(BmSDK.BmGame.RAnimUtil.FNotifyAnim inAnim, out float beginExtendTime, out float endExtendTime, out float beginRetractTime, out float endRetractTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetChainSmashNotifyTimes", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAnim, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        beginExtendTime = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 20);
-        endExtendTime = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 24);
-        beginRetractTime = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 28);
-        endRetractTime = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 32);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 36);
+        var funcManaged = s_GetChainSmashNotifyTimesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetChainSmashNotifyTimes", true);
+        var parms = new GetChainSmashNotifyTimes_Params();
+        parms.inAnim = inAnim;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        beginExtendTime = parms.beginExtendTime;
+        endExtendTime = parms.endExtendTime;
+        beginRetractTime = parms.beginRetractTime;
+        endRetractTime = parms.endRetractTime;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetWeightToHandDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetWeightToHandDir_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public System.Numerics.Vector3 Dir;
     }
 
     /// <summary>
@@ -162,115 +190,117 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void GetWeightToHandDir(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, out System.Numerics.Vector3 Dir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetWeightToHandDir", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Dir = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_GetWeightToHandDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetWeightToHandDir", true);
+        var parms = new GetWeightToHandDir_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Dir = parms.Dir;
         return;
     }
 
+    static BmSDK.Function s_WeightLookAtHandFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct WeightLookAtHand_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+    }
+
     /// <summary>
     /// Function: WeightLookAtHand
     /// </summary>
     public unsafe virtual void WeightLookAtHand(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightLookAtHand", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_WeightLookAtHandFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightLookAtHand", true);
+        var parms = new WeightLookAtHand_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetGrundyWeightAttachPosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetGrundyWeightAttachPos_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public System.Numerics.Vector3 pos;
+    }
+
     /// <summary>
     /// Function: GetGrundyWeightAttachPos
     /// </summary>
     public unsafe virtual void GetGrundyWeightAttachPos(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, out System.Numerics.Vector3 pos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetGrundyWeightAttachPos", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        pos = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_GetGrundyWeightAttachPosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetGrundyWeightAttachPos", true);
+        var parms = new GetGrundyWeightAttachPos_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        pos = parms.pos;
         return;
     }
 
+    static BmSDK.Function s_DisableWeightPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct DisableWeightPhysics_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+    }
+
     /// <summary>
     /// Function: DisableWeightPhysics
     /// </summary>
     public unsafe virtual void DisableWeightPhysics(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.DisableWeightPhysics", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DisableWeightPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.DisableWeightPhysics", true);
+        var parms = new DisableWeightPhysics_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableWeightPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct EnableWeightPhysics_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+    }
+
     /// <summary>
     /// Function: EnableWeightPhysics
     /// </summary>
     public unsafe virtual void EnableWeightPhysics(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.EnableWeightPhysics", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_EnableWeightPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.EnableWeightPhysics", true);
+        var parms = new EnableWeightPhysics_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetIsWeightPhysicsEnabledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetIsWeightPhysicsEnabled_Params
+    {
+        [FieldOffset(0)] public byte applicationSide;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetIsWeightPhysicsEnabled
     /// </summary>
     public unsafe virtual bool GetIsWeightPhysicsEnabled(byte applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetIsWeightPhysicsEnabled", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_GetIsWeightPhysicsEnabledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetIsWeightPhysicsEnabled", true);
+        var parms = new GetIsWeightPhysicsEnabled_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitPhysics_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -278,17 +308,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool InitPhysics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.InitPhysics", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_InitPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.InitPhysics", true);
+        var parms = new InitPhysics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetDepthBiasValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetDepthBiasValues_Params
+    {
     }
 
     /// <summary>
@@ -296,90 +325,133 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void SetDepthBiasValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.SetDepthBiasValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetDepthBiasValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.SetDepthBiasValues", true);
+        var parms = new SetDepthBiasValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateWeightsBlockingActorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct UpdateWeightsBlockingActors_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+    }
+
     /// <summary>
     /// Function: UpdateWeightsBlockingActors
     /// </summary>
     public unsafe virtual void UpdateWeightsBlockingActors(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeightsBlockingActors", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateWeightsBlockingActorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeightsBlockingActors", true);
+        var parms = new UpdateWeightsBlockingActors_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetWeightsBlockActorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetWeightsBlockActors_Params
+    {
+        [FieldOffset(0)] public int BlockActors;
+    }
+
     /// <summary>
     /// Function: SetWeightsBlockActors
     /// </summary>
     public unsafe virtual void SetWeightsBlockActors(bool BlockActors)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.SetWeightsBlockActors", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlockActors, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetWeightsBlockActorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.SetWeightsBlockActors", true);
+        var parms = new SetWeightsBlockActors_Params();
+        parms.BlockActors = BlockActors ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetWeightToPoseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct SetWeightToPose_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public System.Numerics.Vector3 NewTranslation;
+        [FieldOffset(16)] public BmSDK.Rotator NewRotation;
+    }
+
     /// <summary>
     /// Function: SetWeightToPose
     /// </summary>
     public unsafe virtual void SetWeightToPose(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, System.Numerics.Vector3 NewTranslation, BmSDK.Rotator NewRotation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.SetWeightToPose", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTranslation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewRotation, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetWeightToPoseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.SetWeightToPose", true);
+        var parms = new SetWeightToPose_Params();
+        parms.applicationSide = applicationSide;
+        parms.NewTranslation = NewTranslation;
+        parms.NewRotation = NewRotation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DetachWeightFromParentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct DetachWeightFromParent_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+    }
+
     /// <summary>
     /// Function: DetachWeightFromParent
     /// </summary>
     public unsafe virtual void DetachWeightFromParent(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.DetachWeightFromParent", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DetachWeightFromParentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.DetachWeightFromParent", true);
+        var parms = new DetachWeightFromParent_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AttachWeightToParentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AttachWeightToParent_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+    }
+
     /// <summary>
     /// Function: AttachWeightToParent
     /// </summary>
     public unsafe virtual void AttachWeightToParent(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.AttachWeightToParent", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AttachWeightToParentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.AttachWeightToParent", true);
+        var parms = new AttachWeightToParent_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAreBothWeightsInAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetAreBothWeightsInAnim_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAreBothWeightsInAnim
     /// </summary>
     public unsafe virtual bool GetAreBothWeightsInAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetAreBothWeightsInAnim", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_GetAreBothWeightsInAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetAreBothWeightsInAnim", true);
+        var parms = new GetAreBothWeightsInAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_WeightsSetupTetheredArmsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsSetupTetheredArms_Params
+    {
     }
 
     /// <summary>
@@ -387,130 +459,145 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void WeightsSetupTetheredArms()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsSetupTetheredArms", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsSetupTetheredArmsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsSetupTetheredArms", true);
+        var parms = new WeightsSetupTetheredArms_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TeleportBallForPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct TeleportBallForPhysics_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+    }
+
     /// <summary>
     /// Function: TeleportBallForPhysics
     /// </summary>
     public unsafe virtual void TeleportBallForPhysics(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.TeleportBallForPhysics", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_TeleportBallForPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.TeleportBallForPhysics", true);
+        var parms = new TeleportBallForPhysics_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeAutoLengthLimitsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ChangeAutoLengthLimits_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public float MinLength;
+        [FieldOffset(8)] public float MaxLength;
+    }
+
     /// <summary>
     /// Function: ChangeAutoLengthLimits
     /// </summary>
     public unsafe virtual void ChangeAutoLengthLimits(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, float MinLength, float MaxLength)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ChangeAutoLengthLimits", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MinLength, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxLength, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ChangeAutoLengthLimitsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ChangeAutoLengthLimits", true);
+        var parms = new ChangeAutoLengthLimits_Params();
+        parms.applicationSide = applicationSide;
+        parms.MinLength = MinLength;
+        parms.MaxLength = MaxLength;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePhysToAnimTransitionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdatePhysToAnimTransition_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdatePhysToAnimTransition
     /// </summary>
     public unsafe virtual void UpdatePhysToAnimTransition(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdatePhysToAnimTransition", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdatePhysToAnimTransitionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdatePhysToAnimTransition", true);
+        var parms = new UpdatePhysToAnimTransition_Params();
+        parms.applicationSide = applicationSide;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateWeightPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateWeightPhysics_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateWeightPhysics
     /// </summary>
     public unsafe virtual void UpdateWeightPhysics(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeightPhysics", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateWeightPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeightPhysics", true);
+        var parms = new UpdateWeightPhysics_Params();
+        parms.applicationSide = applicationSide;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeWeightPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ChangeWeightPhysics_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: ChangeWeightPhysics
     /// </summary>
     public unsafe virtual void ChangeWeightPhysics(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ChangeWeightPhysics", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ChangeWeightPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ChangeWeightPhysics", true);
+        var parms = new ChangeWeightPhysics_Params();
+        parms.applicationSide = applicationSide;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateWeightToTargetDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateWeightToTargetData_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public float DeltaTime;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: UpdateWeightToTargetData
     /// </summary>
     public unsafe virtual bool UpdateWeightToTargetData(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeightToTargetData", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_UpdateWeightToTargetDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeightToTargetData", true);
+        var parms = new UpdateWeightToTargetData_Params();
+        parms.applicationSide = applicationSide;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateWeightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateWeight_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public float DeltaTime;
     }
 
     /// <summary>
@@ -518,40 +605,44 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void UpdateWeight(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeight", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateWeightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeight", true);
+        var parms = new UpdateWeight_Params();
+        parms.applicationSide = applicationSide;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MinDistToLineSeg2dFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct MinDistToLineSeg2d_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 LineStart;
+        [FieldOffset(12)] public System.Numerics.Vector3 LineEnd;
+        [FieldOffset(24)] public System.Numerics.Vector3 TestPoint;
+        [FieldOffset(36)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: MinDistToLineSeg2d
     /// </summary>
     public unsafe virtual float MinDistToLineSeg2d(System.Numerics.Vector3 LineStart, System.Numerics.Vector3 LineEnd, System.Numerics.Vector3 TestPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.MinDistToLineSeg2d", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineStart, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineEnd, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPoint, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 36);
+        var funcManaged = s_MinDistToLineSeg2dFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.MinDistToLineSeg2d", true);
+        var parms = new MinDistToLineSeg2d_Params();
+        parms.LineStart = LineStart;
+        parms.LineEnd = LineEnd;
+        parms.TestPoint = TestPoint;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CalculateCurrWeightDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CalculateCurrWeightDistance_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -559,18 +650,20 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual float CalculateCurrWeightDistance(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.CalculateCurrWeightDistance", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_CalculateCurrWeightDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.CalculateCurrWeightDistance", true);
+        var parms = new CalculateCurrWeightDistance_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateWeightTargetPoseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateWeightTargetPose_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public float DeltaTime;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -578,19 +671,20 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool UpdateWeightTargetPose(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeightTargetPose", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_UpdateWeightTargetPoseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UpdateWeightTargetPose", true);
+        var parms = new UpdateWeightTargetPose_Params();
+        parms.applicationSide = applicationSide;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ApplyWeightChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ApplyWeightChange_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnBossGrundyBase.FGrundyWeightControlTargetData NewTargetData;
     }
 
     /// <summary>
@@ -598,201 +692,281 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void ApplyWeightChange(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, BmSDK.BmGame.RPawnBossGrundyBase.FGrundyWeightControlTargetData NewTargetData)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ApplyWeightChange", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTargetData, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ApplyWeightChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ApplyWeightChange", true);
+        var parms = new ApplyWeightChange_Params();
+        parms.applicationSide = applicationSide;
+        parms.NewTargetData = NewTargetData;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MoveBMFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct MoveBM_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Delta;
+    }
+
     /// <summary>
     /// Function: MoveBM
     /// </summary>
     public unsafe virtual void MoveBM(System.Numerics.Vector3 Delta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.MoveBM", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Delta, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_MoveBMFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.MoveBM", true);
+        var parms = new MoveBM_Params();
+        parms.Delta = Delta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetWeightCoMFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetWeightCoM_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide;
+        [FieldOffset(4)] public System.Numerics.Vector3 CoM;
+    }
+
     /// <summary>
     /// Function: GetWeightCoM
     /// </summary>
     public unsafe virtual void GetWeightCoM(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide applicationSide, out System.Numerics.Vector3 CoM)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetWeightCoM", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(applicationSide, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        CoM = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_GetWeightCoMFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetWeightCoM", true);
+        var parms = new GetWeightCoM_Params();
+        parms.applicationSide = applicationSide;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        CoM = parms.CoM;
         return;
     }
 
+    static BmSDK.Function s_WeightsInstantPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsInstantPhysics_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsInstantPhysics
     /// </summary>
     public unsafe virtual void WeightsInstantPhysics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsInstantPhysics", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsInstantPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsInstantPhysics", true);
+        var parms = new WeightsInstantPhysics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsPhysicsHoldingDanglePlusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsPhysicsHoldingDanglePlus_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsPhysicsHoldingDanglePlus
     /// </summary>
     public unsafe virtual void WeightsPhysicsHoldingDanglePlus()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsPhysicsHoldingDanglePlus", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsPhysicsHoldingDanglePlusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsPhysicsHoldingDanglePlus", true);
+        var parms = new WeightsPhysicsHoldingDanglePlus_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsPhysicsHoldingDangleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsPhysicsHoldingDangle_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsPhysicsHoldingDangle
     /// </summary>
     public unsafe virtual void WeightsPhysicsHoldingDangle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsPhysicsHoldingDangle", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsPhysicsHoldingDangleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsPhysicsHoldingDangle", true);
+        var parms = new WeightsPhysicsHoldingDangle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsAnimatedVeryLongRopePlusPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsAnimatedVeryLongRopePlusPhysics_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsAnimatedVeryLongRopePlusPhysics
     /// </summary>
     public unsafe virtual void WeightsAnimatedVeryLongRopePlusPhysics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedVeryLongRopePlusPhysics", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsAnimatedVeryLongRopePlusPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedVeryLongRopePlusPhysics", true);
+        var parms = new WeightsAnimatedVeryLongRopePlusPhysics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsAnimatedLongRopePlusPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsAnimatedLongRopePlusPhysics_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsAnimatedLongRopePlusPhysics
     /// </summary>
     public unsafe virtual void WeightsAnimatedLongRopePlusPhysics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedLongRopePlusPhysics", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsAnimatedLongRopePlusPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedLongRopePlusPhysics", true);
+        var parms = new WeightsAnimatedLongRopePlusPhysics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsAnimatedCustomLengthRopeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsAnimatedCustomLengthRope_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsAnimatedCustomLengthRope
     /// </summary>
     public unsafe virtual void WeightsAnimatedCustomLengthRope()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedCustomLengthRope", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsAnimatedCustomLengthRopeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedCustomLengthRope", true);
+        var parms = new WeightsAnimatedCustomLengthRope_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsAnimatedVeryLongRopeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsAnimatedVeryLongRope_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsAnimatedVeryLongRope
     /// </summary>
     public unsafe virtual void WeightsAnimatedVeryLongRope()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedVeryLongRope", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsAnimatedVeryLongRopeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedVeryLongRope", true);
+        var parms = new WeightsAnimatedVeryLongRope_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsAnimatedLongRopeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsAnimatedLongRope_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsAnimatedLongRope
     /// </summary>
     public unsafe virtual void WeightsAnimatedLongRope()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedLongRope", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsAnimatedLongRopeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedLongRope", true);
+        var parms = new WeightsAnimatedLongRope_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsAnimatedShortRopeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsAnimatedShortRope_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsAnimatedShortRope
     /// </summary>
     public unsafe virtual void WeightsAnimatedShortRope()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedShortRope", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsAnimatedShortRopeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAnimatedShortRope", true);
+        var parms = new WeightsAnimatedShortRope_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_WeightsAttachToGrundyHandsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WeightsAttachToGrundyHands_Params
+    {
+    }
+
     /// <summary>
     /// Function: WeightsAttachToGrundyHands
     /// </summary>
     public unsafe virtual void WeightsAttachToGrundyHands()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAttachToGrundyHands", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_WeightsAttachToGrundyHandsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.WeightsAttachToGrundyHands", true);
+        var parms = new WeightsAttachToGrundyHands_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableForceApplicationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableForceApplication_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableForceApplication
     /// </summary>
     public unsafe virtual void EnableForceApplication()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.EnableForceApplication", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableForceApplicationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.EnableForceApplication", true);
+        var parms = new EnableForceApplication_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableForceApplicationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisableForceApplication_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisableForceApplication
     /// </summary>
     public unsafe virtual void DisableForceApplication()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.DisableForceApplication", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableForceApplicationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.DisableForceApplication", true);
+        var parms = new DisableForceApplication_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetUppercutAnimSetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetUppercutAnimSet_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetUppercutAnimSet
     /// </summary>
     public unsafe virtual BmSDK.Engine.AnimSet GetUppercutAnimSet()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetUppercutAnimSet", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSet>(paramsPtr + 0);
+        var funcManaged = s_GetUppercutAnimSetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetUppercutAnimSet", true);
+        var parms = new GetUppercutAnimSet_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AnimSet)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetUppercutAnimNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetUppercutAnimName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ReturnValue;
     }
 
     /// <summary>
@@ -800,10 +974,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual BmSDK.FName GetUppercutAnimName()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetUppercutAnimName", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
+        var funcManaged = s_GetUppercutAnimNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetUppercutAnimName", true);
+        var parms = new GetUppercutAnimName_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IntroCinematicFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IntroCinematicFinished_Params
+    {
     }
 
     /// <summary>
@@ -811,33 +991,54 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void IntroCinematicFinished()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.IntroCinematicFinished", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IntroCinematicFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.IntroCinematicFinished", true);
+        var parms = new IntroCinematicFinished_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActionPerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct ActionPerformed_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EGameAction Action;
+    }
+
     /// <summary>
     /// Function: ActionPerformed
     /// </summary>
     public unsafe virtual void ActionPerformed(BmSDK.BmGame.RGameInfo.EGameAction Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ActionPerformed", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActionPerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ActionPerformed", true);
+        var parms = new ActionPerformed_Params();
+        parms.Action = Action;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldUseFastSlideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldUseFastSlide_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldUseFastSlide
     /// </summary>
     public unsafe virtual bool ShouldUseFastSlide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ShouldUseFastSlide", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldUseFastSlideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.ShouldUseFastSlide", true);
+        var parms = new ShouldUseFastSlide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanUseInCinematicModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanUseInCinematicMode_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -845,10 +1046,18 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool CanUseInCinematicMode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.CanUseInCinematicMode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseInCinematicModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.CanUseInCinematicMode", true);
+        var parms = new CanUseInCinematicMode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanReachItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanReachItem_Params
+    {
+        [FieldOffset(0)] public nint CheckingPawn;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -856,11 +1065,19 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool CanReachItem(BmSDK.Engine.Pawn CheckingPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.CanReachItem", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckingPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanReachItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.CanReachItem", true);
+        var parms = new CanReachItem_Params();
+        parms.CheckingPawn = CheckingPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OverridesRunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OverridesRun_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -868,11 +1085,19 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual float OverridesRun(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.OverridesRun", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_OverridesRunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.OverridesRun", true);
+        var parms = new OverridesRun_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CheckBossCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CheckBossCounter_Params
+    {
+        [FieldOffset(0)] public nint targ;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -880,11 +1105,18 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe override bool CheckBossCounter(BmSDK.BmGame.RPawnVillain targ)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.CheckBossCounter", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(targ, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CheckBossCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.CheckBossCounter", true);
+        var parms = new CheckBossCounter_Params();
+        parms.targ = targ?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UsesAttackButtonFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UsesAttackButton_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -892,10 +1124,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool UsesAttackButton()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UsesAttackButton", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_UsesAttackButtonFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.UsesAttackButton", true);
+        var parms = new UsesAttackButton_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InteractFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Interact_Params
+    {
+        [FieldOffset(0)] public nint PC;
     }
 
     /// <summary>
@@ -903,22 +1142,36 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void Interact(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.Interact", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InteractFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.Interact", true);
+        var parms = new Interact_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MustBeCrouchedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MustBeCrouched_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: MustBeCrouched
     /// </summary>
     public unsafe virtual bool MustBeCrouched()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.MustBeCrouched", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_MustBeCrouchedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.MustBeCrouched", true);
+        var parms = new MustBeCrouched_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsCounterButtonFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsCounterButton_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -926,10 +1179,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool IsCounterButton()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.IsCounterButton", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsCounterButtonFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.IsCounterButton", true);
+        var parms = new IsCounterButton_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsButtonPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsButtonPrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -937,10 +1197,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool IsButtonPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.IsButtonPrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsButtonPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.IsButtonPrompt", true);
+        var parms = new IsButtonPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_EitherButtonAllowedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EitherButtonAllowed_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -948,10 +1215,18 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool EitherButtonAllowed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.EitherButtonAllowed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_EitherButtonAllowedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.EitherButtonAllowed", true);
+        var parms = new EitherButtonAllowed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsActive_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -959,11 +1234,18 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual bool IsActive(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.IsActive", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.IsActive", true);
+        var parms = new IsActive_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetLocationOffsetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetLocationOffset_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -971,10 +1253,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetLocationOffset()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetLocationOffset", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetLocationOffsetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetLocationOffset", true);
+        var parms = new GetLocationOffset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetPriority_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -982,10 +1271,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual float GetPriority()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetPriority", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetPriority", true);
+        var parms = new GetPriority_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetFOVDegreesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetFOVDegrees_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -993,10 +1289,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual float GetFOVDegrees()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetFOVDegrees", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetFOVDegreesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetFOVDegrees", true);
+        var parms = new GetFOVDegrees_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetUpperPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetUpperPrompt_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -1004,10 +1307,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual BmSDK.FString GetUpperPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetUpperPrompt", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetUpperPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetUpperPrompt", true);
+        var parms = new GetUpperPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetHeightRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetHeightRange_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -1015,10 +1325,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual float GetHeightRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetHeightRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetHeightRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetHeightRange", true);
+        var parms = new GetHeightRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetRange_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -1026,10 +1343,18 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual float GetRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetRange", true);
+        var parms = new GetRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetPrompt_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -1037,11 +1362,17 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual BmSDK.FString GetPrompt(BmSDK.Engine.PlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetPrompt", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_GetPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.GetPrompt", true);
+        var parms = new GetPrompt_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_dbgBlowPadsUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct dbgBlowPadsUp_Params
+    {
     }
 
     /// <summary>
@@ -1049,57 +1380,91 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void dbgBlowPadsUp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.dbgBlowPadsUp", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_dbgBlowPadsUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.dbgBlowPadsUp", true);
+        var parms = new dbgBlowPadsUp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnSingleMaggotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SpawnSingleMaggot_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 SpawnLoc;
+        [FieldOffset(12)] public BmSDK.Rotator SpawnRot;
+    }
+
     /// <summary>
     /// Function: SpawnSingleMaggot
     /// </summary>
     public unsafe virtual void SpawnSingleMaggot(System.Numerics.Vector3 SpawnLoc, BmSDK.Rotator SpawnRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.SpawnSingleMaggot", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnRot, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnSingleMaggotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.SpawnSingleMaggot", true);
+        var parms = new SpawnSingleMaggot_Params();
+        parms.SpawnLoc = SpawnLoc;
+        parms.SpawnRot = SpawnRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KilledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Killed_Params
+    {
+    }
+
     /// <summary>
     /// Function: Killed
     /// </summary>
     public unsafe virtual void Killed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.Killed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KilledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.Killed", true);
+        var parms = new Killed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IgniteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Ignite_Params
+    {
+    }
+
     /// <summary>
     /// Function: Ignite
     /// </summary>
     public unsafe virtual void Ignite()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.Ignite", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IgniteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.Ignite", true);
+        var parms = new Ignite_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AllowCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AllowCamera_Params
+    {
+        [FieldOffset(0)] public nint SpecialMove;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AllowCamera
     /// </summary>
     public unsafe virtual bool AllowCamera(BmSDK.BmGame.RSpecialMoveConfig SpecialMove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.AllowCamera", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpecialMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_AllowCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.AllowCamera", true);
+        var parms = new AllowCamera_Params();
+        parms.SpecialMove = SpecialMove?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StopMeleeCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopMeleeCamera_Params
+    {
     }
 
     /// <summary>
@@ -1107,45 +1472,66 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe virtual void StopMeleeCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.StopMeleeCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopMeleeCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.StopMeleeCamera", true);
+        var parms = new StopMeleeCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopAttackingFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StopAttackingFX_Params
+    {
+        [FieldOffset(0)] public int bSuccessfullyCountered;
+    }
+
     /// <summary>
     /// Function: StopAttackingFX
     /// </summary>
     public unsafe override void StopAttackingFX(bool bSuccessfullyCountered = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.StopAttackingFX", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSuccessfullyCountered, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopAttackingFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.StopAttackingFX", true);
+        var parms = new StopAttackingFX_Params();
+        parms.bSuccessfullyCountered = bSuccessfullyCountered ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartAttackingFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StartAttackingFX_Params
+    {
+        [FieldOffset(0)] public int CTypeInt;
+        [FieldOffset(4)] public nint PC;
+    }
+
     /// <summary>
     /// Function: StartAttackingFX
     /// </summary>
     public unsafe override void StartAttackingFX(int CTypeInt, BmSDK.BmGame.RPlayerController PC = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.StartAttackingFX", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CTypeInt, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartAttackingFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.StartAttackingFX", true);
+        var parms = new StartAttackingFX_Params();
+        parms.CTypeInt = CTypeInt;
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoRumbleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoRumble_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoRumble
     /// </summary>
     public unsafe virtual void DoRumble()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.DoRumble", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoRumbleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossGrundyBase.DoRumble", true);
+        var parms = new DoRumble_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -1160,58 +1546,54 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe int Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// IntProperty: Damage
         /// </summary>
         public unsafe int Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// IntProperty: Damage
         /// </summary>
         public unsafe int Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: TimeLeft
         /// </summary>
-        public unsafe float TimeLeft
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float TimeLeft;
 
         /// <summary>
         /// FloatProperty: Duration
         /// </summary>
         public unsafe float Duration_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Duration
         /// </summary>
         public unsafe float Duration_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Duration
         /// </summary>
         public unsafe float Duration_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 24) = value; }; }
         }
     }
 
@@ -1226,76 +1608,64 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe int Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// IntProperty: Damage
         /// </summary>
         public unsafe int Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// IntProperty: Damage
         /// </summary>
         public unsafe int Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: TimeLeft
         /// </summary>
-        public unsafe float TimeLeft
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float TimeLeft;
 
         /// <summary>
         /// StructProperty: Origin
         /// </summary>
-        public unsafe System.Numerics.Vector3 Origin
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 Origin;
 
         /// <summary>
         /// StructProperty: Direction
         /// </summary>
-        public unsafe System.Numerics.Vector3 Direction
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector3 Direction;
 
         /// <summary>
         /// FloatProperty: Speed
         /// </summary>
         public unsafe float Speed_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 40) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Speed
         /// </summary>
         public unsafe float Speed_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 44); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 44) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Speed
         /// </summary>
         public unsafe float Speed_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 48); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 48) = value; }; }
         }
     }
 
@@ -1305,86 +1675,56 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     [StructLayout(LayoutKind.Explicit, Size = 76)]
     public partial record struct FGrundyWeightControlData
     {
+        [FieldOffset(36)] private int _bitfield36;
+
         /// <summary>
         /// StructProperty: CurrentWeightTarget
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FGrundyWeightControlTargetData CurrentWeightTarget
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FGrundyWeightControlTargetData>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnBossGrundyBase.FGrundyWeightControlTargetData CurrentWeightTarget;
 
         /// <summary>
         /// FloatProperty: CurrentPhysicsFreedomRadius
         /// </summary>
-        public unsafe float CurrentPhysicsFreedomRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float CurrentPhysicsFreedomRadius;
 
         /// <summary>
         /// FloatProperty: CurrentDriveSpringStrength
         /// </summary>
-        public unsafe float CurrentDriveSpringStrength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float CurrentDriveSpringStrength;
 
         /// <summary>
         /// BoolProperty: bCurrentAttachedToParent
         /// </summary>
-        public unsafe bool bCurrentAttachedToParent
+        public bool bCurrentAttachedToParent
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 1) != 0;
+            set { if (value) _bitfield36 |= 1; else _bitfield36 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: CurrentWeightTargetPosition
         /// </summary>
-        public unsafe System.Numerics.Vector3 CurrentWeightTargetPosition
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 CurrentWeightTargetPosition;
 
         /// <summary>
         /// StructProperty: CurrentWeightTargetRotation
         /// </summary>
-        public unsafe BmSDK.Rotator CurrentWeightTargetRotation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public BmSDK.Rotator CurrentWeightTargetRotation;
 
         /// <summary>
         /// FloatProperty: CurrentTautRopeLength
         /// </summary>
-        public unsafe float CurrentTautRopeLength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float CurrentTautRopeLength;
 
         /// <summary>
         /// FloatProperty: CurrentMaxRopeLength
         /// </summary>
-        public unsafe float CurrentMaxRopeLength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float CurrentMaxRopeLength;
 
         /// <summary>
         /// FloatProperty: CurrentAngularFreedomProportion
         /// </summary>
-        public unsafe float CurrentAngularFreedomProportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
-        }
+        [FieldOffset(72)] public float CurrentAngularFreedomProportion;
     }
 
     /// <summary>
@@ -1396,65 +1736,37 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// <summary>
         /// FloatProperty: ChangeDuration
         /// </summary>
-        public unsafe float ChangeDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float ChangeDuration;
 
         /// <summary>
         /// FloatProperty: NewPhysicsFreedomRadius
         /// </summary>
-        public unsafe float NewPhysicsFreedomRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float NewPhysicsFreedomRadius;
 
         /// <summary>
         /// FloatProperty: NewPhysicsDriveSpringStrength
         /// </summary>
-        public unsafe float NewPhysicsDriveSpringStrength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float NewPhysicsDriveSpringStrength;
 
         /// <summary>
         /// ByteProperty: NewIsAttachedToParent
         /// </summary>
-        public unsafe BmSDK.BmGame.RPawnBossGrundyBase.EGrundyToggleType NewIsAttachedToParent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.EGrundyToggleType>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RPawnBossGrundyBase.EGrundyToggleType NewIsAttachedToParent;
 
         /// <summary>
         /// FloatProperty: NewTautRopeLength
         /// </summary>
-        public unsafe float NewTautRopeLength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float NewTautRopeLength;
 
         /// <summary>
         /// FloatProperty: NewMaxRopeLength
         /// </summary>
-        public unsafe float NewMaxRopeLength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float NewMaxRopeLength;
 
         /// <summary>
         /// FloatProperty: NewAngularFreedomProportion
         /// </summary>
-        public unsafe float NewAngularFreedomProportion
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float NewAngularFreedomProportion;
     }
 
     /// <summary>
@@ -1468,24 +1780,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe int Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// IntProperty: Damage
         /// </summary>
         public unsafe int Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// IntProperty: Damage
         /// </summary>
         public unsafe int Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
@@ -1493,52 +1805,40 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float CounterDamageToGrundy_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// FloatProperty: CounterDamageToGrundy
         /// </summary>
         public unsafe float CounterDamageToGrundy_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// FloatProperty: CounterDamageToGrundy
         /// </summary>
         public unsafe float CounterDamageToGrundy_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: InRangeValue
         /// </summary>
-        public unsafe float InRangeValue
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float InRangeValue;
 
         /// <summary>
         /// FloatProperty: SmashWidthAttack
         /// </summary>
-        public unsafe float SmashWidthAttack
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float SmashWidthAttack;
 
         /// <summary>
         /// FloatProperty: GrabRadius
         /// </summary>
-        public unsafe float GrabRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float GrabRadius;
     }
 
     /// <summary>
@@ -1552,24 +1852,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float MeleeCounterDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// FloatProperty: MeleeCounterDamage
         /// </summary>
         public unsafe float MeleeCounterDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: MeleeCounterDamage
         /// </summary>
         public unsafe float MeleeCounterDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
@@ -1577,24 +1877,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float MeleeCounterFinalBlowDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// FloatProperty: MeleeCounterFinalBlowDamage
         /// </summary>
         public unsafe float MeleeCounterFinalBlowDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// FloatProperty: MeleeCounterFinalBlowDamage
         /// </summary>
         public unsafe float MeleeCounterFinalBlowDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
 
         /// <summary>
@@ -1602,24 +1902,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float GelFaceDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 24) = value; }; }
         }
         /// <summary>
         /// FloatProperty: GelFaceDamage
         /// </summary>
         public unsafe float GelFaceDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 28) = value; }; }
         }
         /// <summary>
         /// FloatProperty: GelFaceDamage
         /// </summary>
         public unsafe float GelFaceDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 32); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 32) = value; }; }
         }
 
         /// <summary>
@@ -1627,24 +1927,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float RECDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 36); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 36) = value; }; }
         }
         /// <summary>
         /// FloatProperty: RECDamage
         /// </summary>
         public unsafe float RECDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 40) = value; }; }
         }
         /// <summary>
         /// FloatProperty: RECDamage
         /// </summary>
         public unsafe float RECDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 44); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 44) = value; }; }
         }
     }
 
@@ -1659,24 +1959,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers NumMaggots_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// StructProperty: NumMaggots
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers NumMaggots_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers*)(Ptr + 20) = value; }; }
         }
         /// <summary>
         /// StructProperty: NumMaggots
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers NumMaggots_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers*)(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FMaggotNumbers*)(Ptr + 40) = value; }; }
         }
 
         /// <summary>
@@ -1684,24 +1984,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe int MaxMaggots_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 60); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 60) = value; }; }
         }
         /// <summary>
         /// IntProperty: MaxMaggots
         /// </summary>
         public unsafe int MaxMaggots_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 64); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 64) = value; }; }
         }
         /// <summary>
         /// IntProperty: MaxMaggots
         /// </summary>
         public unsafe int MaxMaggots_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 68); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 68) = value; }; }
         }
 
         /// <summary>
@@ -1709,24 +2009,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 72); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 72) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 76); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 76) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 80); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 80) = value; }; }
         }
 
         /// <summary>
@@ -1759,40 +2059,40 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe int MaggotsByPad_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// IntProperty: MaggotsByPad
         /// </summary>
         public unsafe int MaggotsByPad_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// IntProperty: MaggotsByPad
         /// </summary>
         public unsafe int MaggotsByPad_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 8) = value; }; }
         }
         /// <summary>
         /// IntProperty: MaggotsByPad
         /// </summary>
         public unsafe int MaggotsByPad_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// IntProperty: MaggotsByPad
         /// </summary>
         public unsafe int MaggotsByPad_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 16) = value; }; }
         }
     }
 
@@ -1805,44 +2105,36 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// <summary>
         /// FloatProperty: ProximityForAttackRange
         /// </summary>
-        public unsafe float ProximityForAttackRange
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float ProximityForAttackRange;
 
         /// <summary>
         /// FloatProperty: AttackRange
         /// </summary>
-        public unsafe float AttackRange
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float AttackRange;
 
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
 
         /// <summary>
@@ -1866,24 +2158,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
@@ -1891,24 +2183,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float ProximityDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// FloatProperty: ProximityDamage
         /// </summary>
         public unsafe float ProximityDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// FloatProperty: ProximityDamage
         /// </summary>
         public unsafe float ProximityDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
 
         /// <summary>
@@ -1916,43 +2208,35 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float HoldPoseTime_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 24) = value; }; }
         }
         /// <summary>
         /// FloatProperty: HoldPoseTime
         /// </summary>
         public unsafe float HoldPoseTime_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 28) = value; }; }
         }
         /// <summary>
         /// FloatProperty: HoldPoseTime
         /// </summary>
         public unsafe float HoldPoseTime_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 32); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 32) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: TimeToExtendChain
         /// </summary>
-        public unsafe float TimeToExtendChain
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float TimeToExtendChain;
 
         /// <summary>
         /// FloatProperty: TimeToRetractChain
         /// </summary>
-        public unsafe float TimeToRetractChain
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float TimeToRetractChain;
 
         /// <summary>
         /// ObjectProperty: HitParticleEffect
@@ -1968,113 +2252,85 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float KnockedDownTime_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 48); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 48) = value; }; }
         }
         /// <summary>
         /// FloatProperty: KnockedDownTime
         /// </summary>
         public unsafe float KnockedDownTime_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 52); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 52) = value; }; }
         }
         /// <summary>
         /// FloatProperty: KnockedDownTime
         /// </summary>
         public unsafe float KnockedDownTime_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 56); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 56) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: FailedCrucifixTimeToRetractChain
         /// </summary>
-        public unsafe float FailedCrucifixTimeToRetractChain
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float FailedCrucifixTimeToRetractChain;
 
         /// <summary>
         /// FloatProperty: TimeOutCrucifixTimeToRetractChain
         /// </summary>
-        public unsafe float TimeOutCrucifixTimeToRetractChain
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float TimeOutCrucifixTimeToRetractChain;
 
         /// <summary>
         /// FloatProperty: TimeInCrucifix
         /// </summary>
         public unsafe float TimeInCrucifix_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 68); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 68) = value; }; }
         }
         /// <summary>
         /// FloatProperty: TimeInCrucifix
         /// </summary>
         public unsafe float TimeInCrucifix_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 72); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 72) = value; }; }
         }
         /// <summary>
         /// FloatProperty: TimeInCrucifix
         /// </summary>
         public unsafe float TimeInCrucifix_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 76); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 76) = value; }; }
         }
 
         /// <summary>
         /// IntProperty: numFloorSparks
         /// </summary>
-        public unsafe int numFloorSparks
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
-        }
+        [FieldOffset(80)] public int numFloorSparks;
 
         /// <summary>
         /// FloatProperty: sparkEffectBaseSize
         /// </summary>
-        public unsafe float sparkEffectBaseSize
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
-        }
+        [FieldOffset(84)] public float sparkEffectBaseSize;
 
         /// <summary>
         /// FloatProperty: sparkMinRadius
         /// </summary>
-        public unsafe float sparkMinRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
-        }
+        [FieldOffset(88)] public float sparkMinRadius;
 
         /// <summary>
         /// FloatProperty: sparkAngle_degrees
         /// </summary>
-        public unsafe float sparkAngle_degrees
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }; }
-        }
+        [FieldOffset(92)] public float sparkAngle_degrees;
 
         /// <summary>
         /// FloatProperty: interSparkAngle_degrees
         /// </summary>
-        public unsafe float interSparkAngle_degrees
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public float interSparkAngle_degrees;
     }
 
     /// <summary>
@@ -2088,24 +2344,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
@@ -2113,52 +2369,40 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float HoldPoseTime_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// FloatProperty: HoldPoseTime
         /// </summary>
         public unsafe float HoldPoseTime_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// FloatProperty: HoldPoseTime
         /// </summary>
         public unsafe float HoldPoseTime_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: SmashDamageRadius
         /// </summary>
-        public unsafe float SmashDamageRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float SmashDamageRadius;
 
         /// <summary>
         /// FloatProperty: TimeToExtendChain
         /// </summary>
-        public unsafe float TimeToExtendChain
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float TimeToExtendChain;
 
         /// <summary>
         /// FloatProperty: TimeToRetractChain
         /// </summary>
-        public unsafe float TimeToRetractChain
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float TimeToRetractChain;
 
         /// <summary>
         /// ObjectProperty: HitParticleEffect
@@ -2181,24 +2425,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float Speed_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Speed
         /// </summary>
         public unsafe float Speed_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Speed
         /// </summary>
         public unsafe float Speed_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
@@ -2206,58 +2450,54 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed SpeedIncPerSwing_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// StructProperty: SpeedIncPerSwing
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed SpeedIncPerSwing_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed*)(Ptr + 24) = value; }; }
         }
         /// <summary>
         /// StructProperty: SpeedIncPerSwing
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed SpeedIncPerSwing_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed*)(Ptr + 36); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingSpeed*)(Ptr + 36) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: PercChanceOfHighAttack
         /// </summary>
-        public unsafe float PercChanceOfHighAttack
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public float PercChanceOfHighAttack;
 
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 52); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 52) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 56); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 56) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 60); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 60) = value; }; }
         }
 
         /// <summary>
@@ -2265,97 +2505,65 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers NumSwings_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers*)(Ptr + 64); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers*)(Ptr + 64) = value; }; }
         }
         /// <summary>
         /// StructProperty: NumSwings
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers NumSwings_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers*)(Ptr + 84); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers*)(Ptr + 84) = value; }; }
         }
         /// <summary>
         /// StructProperty: NumSwings
         /// </summary>
         public unsafe BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers NumSwings_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers>(Ptr + 104); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers*)(Ptr + 104); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(BmSDK.BmGame.RPawnBossGrundyBase.FSwingNumbers*)(Ptr + 104) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: ChainGrowthPerSecond
         /// </summary>
-        public unsafe float ChainGrowthPerSecond
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }; }
-        }
+        [FieldOffset(124)] public float ChainGrowthPerSecond;
 
         /// <summary>
         /// FloatProperty: SwingSpeedupPerSecond
         /// </summary>
-        public unsafe float SwingSpeedupPerSecond
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }; }
-        }
+        [FieldOffset(128)] public float SwingSpeedupPerSecond;
 
         /// <summary>
         /// FloatProperty: SwingHeightChangeSpeed
         /// </summary>
-        public unsafe float SwingHeightChangeSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 132); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }; }
-        }
+        [FieldOffset(132)] public float SwingHeightChangeSpeed;
 
         /// <summary>
         /// FloatProperty: TimeToSlowDown
         /// </summary>
-        public unsafe float TimeToSlowDown
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 136); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }; }
-        }
+        [FieldOffset(136)] public float TimeToSlowDown;
 
         /// <summary>
         /// FloatProperty: EndChainLength
         /// </summary>
-        public unsafe float EndChainLength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 140); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }; }
-        }
+        [FieldOffset(140)] public float EndChainLength;
 
         /// <summary>
         /// FloatProperty: StartSpeed
         /// </summary>
-        public unsafe float StartSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }; }
-        }
+        [FieldOffset(144)] public float StartSpeed;
 
         /// <summary>
         /// FloatProperty: EndSpeed
         /// </summary>
-        public unsafe float EndSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 148); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }; }
-        }
+        [FieldOffset(148)] public float EndSpeed;
 
         /// <summary>
         /// FloatProperty: SwingDamageRadius
         /// </summary>
-        public unsafe float SwingDamageRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }; }
-        }
+        [FieldOffset(152)] public float SwingDamageRadius;
     }
 
     /// <summary>
@@ -2369,34 +2577,30 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe float Damage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Damage
         /// </summary>
         public unsafe float Damage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: ChainGrowthPerSecond
         /// </summary>
-        public unsafe float ChainGrowthPerSecond
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float ChainGrowthPerSecond;
     }
 
     /// <summary>
@@ -2426,40 +2630,40 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
         /// </summary>
         public unsafe int SwingsByPad_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// IntProperty: SwingsByPad
         /// </summary>
         public unsafe int SwingsByPad_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// IntProperty: SwingsByPad
         /// </summary>
         public unsafe int SwingsByPad_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 8) = value; }; }
         }
         /// <summary>
         /// IntProperty: SwingsByPad
         /// </summary>
         public unsafe int SwingsByPad_3
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// IntProperty: SwingsByPad
         /// </summary>
         public unsafe int SwingsByPad_4
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(int*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(int*)(Ptr + 16) = value; }; }
         }
     }
 
@@ -2468,8 +2672,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnBossGrundyBase.EGrundyForcedAttack dbgForcedAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.EGrundyForcedAttack>(Ptr + 3560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3560); }
+        get { return *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyForcedAttack*)(Ptr + 3560); }
+        set { *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyForcedAttack*)(Ptr + 3560) = value; }
     }
 
     /// <summary>
@@ -2477,8 +2681,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnBossGrundyBase.EGrundyAttacks LastAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.EGrundyAttacks>(Ptr + 3561); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3561); }
+        get { return *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyAttacks*)(Ptr + 3561); }
+        set { *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyAttacks*)(Ptr + 3561) = value; }
     }
 
     /// <summary>
@@ -2486,8 +2690,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnBossGrundyBase.SolomonGrundyState GrundyStage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.SolomonGrundyState>(Ptr + 3562); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3562); }
+        get { return *(BmSDK.BmGame.RPawnBossGrundyBase.SolomonGrundyState*)(Ptr + 3562); }
+        set { *(BmSDK.BmGame.RPawnBossGrundyBase.SolomonGrundyState*)(Ptr + 3562) = value; }
     }
 
     /// <summary>
@@ -2495,8 +2699,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide SmashWeightToUse
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide>(Ptr + 3563); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3563); }
+        get { return *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide*)(Ptr + 3563); }
+        set { *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide*)(Ptr + 3563) = value; }
     }
 
     /// <summary>
@@ -2504,8 +2708,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide CurrentTetheredArmSide
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide>(Ptr + 3564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3564); }
+        get { return *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide*)(Ptr + 3564); }
+        set { *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyWeightSide*)(Ptr + 3564) = value; }
     }
 
     /// <summary>
@@ -2513,8 +2717,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bDepthBiasTweakMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 1; else *(int*)(Ptr + 3568) &= ~1; }
     }
 
     /// <summary>
@@ -2522,8 +2726,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bScreenBasedDepthBias
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 2; else *(int*)(Ptr + 3568) &= ~2; }
     }
 
     /// <summary>
@@ -2531,8 +2735,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bNoForces
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 4; else *(int*)(Ptr + 3568) &= ~4; }
     }
 
     /// <summary>
@@ -2540,8 +2744,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bBatmanNeedsMagblastHint
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 8; else *(int*)(Ptr + 3568) &= ~8; }
     }
 
     /// <summary>
@@ -2549,8 +2753,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bBatmanNeedsBatclawHint
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 16; else *(int*)(Ptr + 3568) &= ~16; }
     }
 
     /// <summary>
@@ -2558,8 +2762,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bCounterPromptOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 32; else *(int*)(Ptr + 3568) &= ~32; }
     }
 
     /// <summary>
@@ -2567,8 +2771,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bDead
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 64; else *(int*)(Ptr + 3568) &= ~64; }
     }
 
     /// <summary>
@@ -2576,8 +2780,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bHeartRemovalReady
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 128; else *(int*)(Ptr + 3568) &= ~128; }
     }
 
     /// <summary>
@@ -2585,8 +2789,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bHasJustTurned
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 256; else *(int*)(Ptr + 3568) &= ~256; }
     }
 
     /// <summary>
@@ -2594,8 +2798,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bDrawWeightDebugLines
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 512; else *(int*)(Ptr + 3568) &= ~512; }
     }
 
     /// <summary>
@@ -2603,8 +2807,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bWeightsLookAtAttachPoints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 1024; else *(int*)(Ptr + 3568) &= ~1024; }
     }
 
     /// <summary>
@@ -2612,8 +2816,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bSuspendKeepInView
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 2048; else *(int*)(Ptr + 3568) &= ~2048; }
     }
 
     /// <summary>
@@ -2621,8 +2825,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bWantsToMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 4096; else *(int*)(Ptr + 3568) &= ~4096; }
     }
 
     /// <summary>
@@ -2630,8 +2834,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bHasMovedThisIdle
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 8192; else *(int*)(Ptr + 3568) &= ~8192; }
     }
 
     /// <summary>
@@ -2639,8 +2843,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bInHighSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 16384; else *(int*)(Ptr + 3568) &= ~16384; }
     }
 
     /// <summary>
@@ -2648,8 +2852,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bSwinging
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 32768; else *(int*)(Ptr + 3568) &= ~32768; }
     }
 
     /// <summary>
@@ -2657,8 +2861,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bClockWiseTurn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 65536; else *(int*)(Ptr + 3568) &= ~65536; }
     }
 
     /// <summary>
@@ -2666,8 +2870,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bSlowingDown
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 131072; else *(int*)(Ptr + 3568) &= ~131072; }
     }
 
     /// <summary>
@@ -2675,8 +2879,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bStartedTransOut
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 262144; else *(int*)(Ptr + 3568) &= ~262144; }
     }
 
     /// <summary>
@@ -2684,8 +2888,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bHasChangedHeightThisSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 524288; else *(int*)(Ptr + 3568) &= ~524288; }
     }
 
     /// <summary>
@@ -2693,8 +2897,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bHasHitBatmanThisSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 1048576; else *(int*)(Ptr + 3568) &= ~1048576; }
     }
 
     /// <summary>
@@ -2702,8 +2906,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bHitThisSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 2097152; else *(int*)(Ptr + 3568) &= ~2097152; }
     }
 
     /// <summary>
@@ -2711,8 +2915,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bReadyToStop
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 4194304; else *(int*)(Ptr + 3568) &= ~4194304; }
     }
 
     /// <summary>
@@ -2720,8 +2924,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bInSmash
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 8388608; else *(int*)(Ptr + 3568) &= ~8388608; }
     }
 
     /// <summary>
@@ -2729,8 +2933,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bInSmashWait
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 16777216; else *(int*)(Ptr + 3568) &= ~16777216; }
     }
 
     /// <summary>
@@ -2738,8 +2942,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bInSmashExit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 33554432; else *(int*)(Ptr + 3568) &= ~33554432; }
     }
 
     /// <summary>
@@ -2747,8 +2951,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bSmashChainExtended
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 67108864; else *(int*)(Ptr + 3568) &= ~67108864; }
     }
 
     /// <summary>
@@ -2756,8 +2960,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bLastAttackWasMaggots
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 134217728; else *(int*)(Ptr + 3568) &= ~134217728; }
     }
 
     /// <summary>
@@ -2765,8 +2969,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bFailedTwoArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 268435456; else *(int*)(Ptr + 3568) &= ~268435456; }
     }
 
     /// <summary>
@@ -2774,8 +2978,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bOnFire
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 536870912; else *(int*)(Ptr + 3568) &= ~536870912; }
     }
 
     /// <summary>
@@ -2783,8 +2987,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bWalkingToBats
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= 1073741824; else *(int*)(Ptr + 3568) &= ~1073741824; }
     }
 
     /// <summary>
@@ -2792,8 +2996,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bHitThisAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3568); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3568); }
+        get { return (*(int*)(Ptr + 3568) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 3568) |= -2147483648; else *(int*)(Ptr + 3568) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -2801,8 +3005,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bAllowCounter
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3572); }
+        get { return (*(int*)(Ptr + 3572) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 3572) |= 1; else *(int*)(Ptr + 3572) &= ~1; }
     }
 
     /// <summary>
@@ -2810,8 +3014,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bSuccessfulCounter
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3572); }
+        get { return (*(int*)(Ptr + 3572) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 3572) |= 2; else *(int*)(Ptr + 3572) &= ~2; }
     }
 
     /// <summary>
@@ -2819,8 +3023,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bCanBePunched
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3572); }
+        get { return (*(int*)(Ptr + 3572) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 3572) |= 4; else *(int*)(Ptr + 3572) &= ~4; }
     }
 
     /// <summary>
@@ -2828,8 +3032,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bIntroCinematicFinished
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3572); }
+        get { return (*(int*)(Ptr + 3572) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 3572) |= 8; else *(int*)(Ptr + 3572) &= ~8; }
     }
 
     /// <summary>
@@ -2837,8 +3041,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bTempStopWeightsBlocking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3572); }
+        get { return (*(int*)(Ptr + 3572) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 3572) |= 16; else *(int*)(Ptr + 3572) &= ~16; }
     }
 
     /// <summary>
@@ -2846,8 +3050,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bApplyForceToCentreOfBall
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3572); }
+        get { return (*(int*)(Ptr + 3572) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 3572) |= 32; else *(int*)(Ptr + 3572) &= ~32; }
     }
 
     /// <summary>
@@ -2855,8 +3059,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bZeroPhysFreedomRadius
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3572); }
+        get { return (*(int*)(Ptr + 3572) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 3572) |= 64; else *(int*)(Ptr + 3572) &= ~64; }
     }
 
     /// <summary>
@@ -2864,8 +3068,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe bool bDoVelocityLimiting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3572); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3572); }
+        get { return (*(int*)(Ptr + 3572) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 3572) |= 128; else *(int*)(Ptr + 3572) &= ~128; }
     }
 
     /// <summary>
@@ -2873,8 +3077,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float emissiveDepthBias
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3576); }
+        get { return *(float*)(Ptr + 3576); }
+        set { *(float*)(Ptr + 3576) = value; }
     }
 
     /// <summary>
@@ -3053,8 +3257,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float BatmanDamageImmunity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3656); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3656); }
+        get { return *(float*)(Ptr + 3656); }
+        set { *(float*)(Ptr + 3656) = value; }
     }
 
     /// <summary>
@@ -3062,8 +3266,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float BatmanFireDamageImmunity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3660); }
+        get { return *(float*)(Ptr + 3660); }
+        set { *(float*)(Ptr + 3660) = value; }
     }
 
     /// <summary>
@@ -3080,8 +3284,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int DifficultyLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3668); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3668); }
+        get { return *(int*)(Ptr + 3668); }
+        set { *(int*)(Ptr + 3668) = value; }
     }
 
     /// <summary>
@@ -3089,8 +3293,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float IdleStateTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3672); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3672); }
+        get { return *(float*)(Ptr + 3672); }
+        set { *(float*)(Ptr + 3672) = value; }
     }
 
     /// <summary>
@@ -3116,8 +3320,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float GrundyHealth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3684); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3684); }
+        get { return *(float*)(Ptr + 3684); }
+        set { *(float*)(Ptr + 3684) = value; }
     }
 
     /// <summary>
@@ -3125,8 +3329,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float GrundyHealthForHud
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3688); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3688); }
+        get { return *(float*)(Ptr + 3688); }
+        set { *(float*)(Ptr + 3688) = value; }
     }
 
     /// <summary>
@@ -3388,24 +3592,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float TimeBetweenMajorAttacks_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5616); }
+        get { return *(float*)(Ptr + 5616); }
+        set { *(float*)(Ptr + 5616) = value; }
     }
     /// <summary>
     /// FloatProperty: TimeBetweenMajorAttacks
     /// </summary>
     public unsafe float TimeBetweenMajorAttacks_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5620); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5620); }
+        get { return *(float*)(Ptr + 5620); }
+        set { *(float*)(Ptr + 5620) = value; }
     }
     /// <summary>
     /// FloatProperty: TimeBetweenMajorAttacks
     /// </summary>
     public unsafe float TimeBetweenMajorAttacks_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5624); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5624); }
+        get { return *(float*)(Ptr + 5624); }
+        set { *(float*)(Ptr + 5624) = value; }
     }
 
     /// <summary>
@@ -3418,24 +3622,24 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float TimeBetweenMajorAttacksElectrified_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5628); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5628); }
+        get { return *(float*)(Ptr + 5628); }
+        set { *(float*)(Ptr + 5628) = value; }
     }
     /// <summary>
     /// FloatProperty: TimeBetweenMajorAttacksElectrified
     /// </summary>
     public unsafe float TimeBetweenMajorAttacksElectrified_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5632); }
+        get { return *(float*)(Ptr + 5632); }
+        set { *(float*)(Ptr + 5632) = value; }
     }
     /// <summary>
     /// FloatProperty: TimeBetweenMajorAttacksElectrified
     /// </summary>
     public unsafe float TimeBetweenMajorAttacksElectrified_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5636); }
+        get { return *(float*)(Ptr + 5636); }
+        set { *(float*)(Ptr + 5636) = value; }
     }
 
     /// <summary>
@@ -3764,8 +3968,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int NextFloorSpark
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6388); }
+        get { return *(int*)(Ptr + 6388); }
+        set { *(int*)(Ptr + 6388) = value; }
     }
 
     /// <summary>
@@ -3824,8 +4028,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int NextSmashFire
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6488); }
+        get { return *(int*)(Ptr + 6488); }
+        set { *(int*)(Ptr + 6488) = value; }
     }
 
     /// <summary>
@@ -3833,8 +4037,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float TimeForNextAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6492); }
+        get { return *(float*)(Ptr + 6492); }
+        set { *(float*)(Ptr + 6492) = value; }
     }
 
     /// <summary>
@@ -3851,8 +4055,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float ArenaWidth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6500); }
+        get { return *(float*)(Ptr + 6500); }
+        set { *(float*)(Ptr + 6500) = value; }
     }
 
     /// <summary>
@@ -3860,8 +4064,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float MaxStrayDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6504); }
+        get { return *(float*)(Ptr + 6504); }
+        set { *(float*)(Ptr + 6504) = value; }
     }
 
     /// <summary>
@@ -3878,8 +4082,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int LastPadGroupBlownUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6512); }
+        get { return *(int*)(Ptr + 6512); }
+        set { *(int*)(Ptr + 6512) = value; }
     }
 
     /// <summary>
@@ -3968,8 +4172,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float DistanceForMagnetAttract
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6568); }
+        get { return *(float*)(Ptr + 6568); }
+        set { *(float*)(Ptr + 6568) = value; }
     }
 
     /// <summary>
@@ -4035,16 +4239,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe BmSDK.FName ArmWeightAttachDummys_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 6600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6600); }
+        get { return *(BmSDK.FName*)(Ptr + 6600); }
+        set { *(BmSDK.FName*)(Ptr + 6600) = value; }
     }
     /// <summary>
     /// NameProperty: ArmWeightAttachDummys
     /// </summary>
     public unsafe BmSDK.FName ArmWeightAttachDummys_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 6608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6608); }
+        get { return *(BmSDK.FName*)(Ptr + 6608); }
+        set { *(BmSDK.FName*)(Ptr + 6608) = value; }
     }
 
     /// <summary>
@@ -4057,16 +4261,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe BmSDK.FName HandBoneNames_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 6616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6616); }
+        get { return *(BmSDK.FName*)(Ptr + 6616); }
+        set { *(BmSDK.FName*)(Ptr + 6616) = value; }
     }
     /// <summary>
     /// NameProperty: HandBoneNames
     /// </summary>
     public unsafe BmSDK.FName HandBoneNames_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 6624); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6624); }
+        get { return *(BmSDK.FName*)(Ptr + 6624); }
+        set { *(BmSDK.FName*)(Ptr + 6624) = value; }
     }
 
     /// <summary>
@@ -4079,16 +4283,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float CurrentChainLengths_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6632); }
+        get { return *(float*)(Ptr + 6632); }
+        set { *(float*)(Ptr + 6632) = value; }
     }
     /// <summary>
     /// FloatProperty: CurrentChainLengths
     /// </summary>
     public unsafe float CurrentChainLengths_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6636); }
+        get { return *(float*)(Ptr + 6636); }
+        set { *(float*)(Ptr + 6636) = value; }
     }
 
     /// <summary>
@@ -4117,16 +4321,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float ExtendChainTime_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6792); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6792); }
+        get { return *(float*)(Ptr + 6792); }
+        set { *(float*)(Ptr + 6792) = value; }
     }
     /// <summary>
     /// FloatProperty: ExtendChainTime
     /// </summary>
     public unsafe float ExtendChainTime_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6796); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6796); }
+        get { return *(float*)(Ptr + 6796); }
+        set { *(float*)(Ptr + 6796) = value; }
     }
 
     /// <summary>
@@ -4139,16 +4343,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float RetractChainTime_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6800); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6800); }
+        get { return *(float*)(Ptr + 6800); }
+        set { *(float*)(Ptr + 6800) = value; }
     }
     /// <summary>
     /// FloatProperty: RetractChainTime
     /// </summary>
     public unsafe float RetractChainTime_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6804); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6804); }
+        get { return *(float*)(Ptr + 6804); }
+        set { *(float*)(Ptr + 6804) = value; }
     }
 
     /// <summary>
@@ -4156,8 +4360,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float CurrMaxYawOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6808); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6808); }
+        get { return *(float*)(Ptr + 6808); }
+        set { *(float*)(Ptr + 6808) = value; }
     }
 
     /// <summary>
@@ -4180,8 +4384,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float CurrentSwingSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6828); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6828); }
+        get { return *(float*)(Ptr + 6828); }
+        set { *(float*)(Ptr + 6828) = value; }
     }
 
     /// <summary>
@@ -4189,8 +4393,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int NumSwingsSoFar
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6832); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6832); }
+        get { return *(int*)(Ptr + 6832); }
+        set { *(int*)(Ptr + 6832) = value; }
     }
 
     /// <summary>
@@ -4198,8 +4402,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int NumSwingsTotal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6836); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6836); }
+        get { return *(int*)(Ptr + 6836); }
+        set { *(int*)(Ptr + 6836) = value; }
     }
 
     /// <summary>
@@ -4212,16 +4416,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float ChainLengthAtSlowDownChange_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6840); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6840); }
+        get { return *(float*)(Ptr + 6840); }
+        set { *(float*)(Ptr + 6840) = value; }
     }
     /// <summary>
     /// FloatProperty: ChainLengthAtSlowDownChange
     /// </summary>
     public unsafe float ChainLengthAtSlowDownChange_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6844); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6844); }
+        get { return *(float*)(Ptr + 6844); }
+        set { *(float*)(Ptr + 6844) = value; }
     }
 
     /// <summary>
@@ -4229,8 +4433,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float SwingSpeedAtSlowDownChange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6848); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6848); }
+        get { return *(float*)(Ptr + 6848); }
+        set { *(float*)(Ptr + 6848) = value; }
     }
 
     /// <summary>
@@ -4238,8 +4442,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float SlowdownTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6852); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6852); }
+        get { return *(float*)(Ptr + 6852); }
+        set { *(float*)(Ptr + 6852) = value; }
     }
 
     /// <summary>
@@ -4247,8 +4451,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int NumConsectiveClockwise
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6856); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6856); }
+        get { return *(int*)(Ptr + 6856); }
+        set { *(int*)(Ptr + 6856) = value; }
     }
 
     /// <summary>
@@ -4256,8 +4460,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int NumConsectiveAntiClockwise
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6860); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6860); }
+        get { return *(int*)(Ptr + 6860); }
+        set { *(int*)(Ptr + 6860) = value; }
     }
 
     /// <summary>
@@ -4270,16 +4474,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float WeightHeightAtSlow_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6864); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6864); }
+        get { return *(float*)(Ptr + 6864); }
+        set { *(float*)(Ptr + 6864) = value; }
     }
     /// <summary>
     /// FloatProperty: WeightHeightAtSlow
     /// </summary>
     public unsafe float WeightHeightAtSlow_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6868); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6868); }
+        get { return *(float*)(Ptr + 6868); }
+        set { *(float*)(Ptr + 6868) = value; }
     }
 
     /// <summary>
@@ -4292,16 +4496,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float WeightDistAtSlow_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6872); }
+        get { return *(float*)(Ptr + 6872); }
+        set { *(float*)(Ptr + 6872) = value; }
     }
     /// <summary>
     /// FloatProperty: WeightDistAtSlow
     /// </summary>
     public unsafe float WeightDistAtSlow_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6876); }
+        get { return *(float*)(Ptr + 6876); }
+        set { *(float*)(Ptr + 6876) = value; }
     }
 
     /// <summary>
@@ -4309,8 +4513,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float SmashWaitTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6880); }
+        get { return *(float*)(Ptr + 6880); }
+        set { *(float*)(Ptr + 6880) = value; }
     }
 
     /// <summary>
@@ -4324,8 +4528,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int NumRepeatSmashes
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6896); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6896); }
+        get { return *(int*)(Ptr + 6896); }
+        set { *(int*)(Ptr + 6896) = value; }
     }
 
     /// <summary>
@@ -4342,8 +4546,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int CurrentSpawnNo
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6912); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6912); }
+        get { return *(int*)(Ptr + 6912); }
+        set { *(int*)(Ptr + 6912) = value; }
     }
 
     /// <summary>
@@ -4351,8 +4555,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float TotalMagnetTetherTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6916); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6916); }
+        get { return *(float*)(Ptr + 6916); }
+        set { *(float*)(Ptr + 6916) = value; }
     }
 
     /// <summary>
@@ -4369,8 +4573,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int NumAttacksDuringElectrified
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6924); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6924); }
+        get { return *(int*)(Ptr + 6924); }
+        set { *(int*)(Ptr + 6924) = value; }
     }
 
     /// <summary>
@@ -4378,8 +4582,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int AttackNumber
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6928); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6928); }
+        get { return *(int*)(Ptr + 6928); }
+        set { *(int*)(Ptr + 6928) = value; }
     }
 
     /// <summary>
@@ -4387,8 +4591,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float CounterMarkTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6932); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6932); }
+        get { return *(float*)(Ptr + 6932); }
+        set { *(float*)(Ptr + 6932) = value; }
     }
 
     /// <summary>
@@ -4408,8 +4612,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float TimeSinceLastBMPunch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6960); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6960); }
+        get { return *(float*)(Ptr + 6960); }
+        set { *(float*)(Ptr + 6960) = value; }
     }
 
     /// <summary>
@@ -4417,8 +4621,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int BMPunchCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6964); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6964); }
+        get { return *(int*)(Ptr + 6964); }
+        set { *(int*)(Ptr + 6964) = value; }
     }
 
     /// <summary>
@@ -4426,8 +4630,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float HeartBeatValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6968); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6968); }
+        get { return *(float*)(Ptr + 6968); }
+        set { *(float*)(Ptr + 6968) = value; }
     }
 
     /// <summary>
@@ -4435,8 +4639,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float PadGlowValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6972); }
+        get { return *(float*)(Ptr + 6972); }
+        set { *(float*)(Ptr + 6972) = value; }
     }
 
     /// <summary>
@@ -4444,8 +4648,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float GrundyVeinGlowValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6976); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6976); }
+        get { return *(float*)(Ptr + 6976); }
+        set { *(float*)(Ptr + 6976) = value; }
     }
 
     /// <summary>
@@ -4453,8 +4657,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float HeartBeatReductionPerSec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6980); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6980); }
+        get { return *(float*)(Ptr + 6980); }
+        set { *(float*)(Ptr + 6980) = value; }
     }
 
     /// <summary>
@@ -4462,8 +4666,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float TimeBetweenBeats
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6984); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6984); }
+        get { return *(float*)(Ptr + 6984); }
+        set { *(float*)(Ptr + 6984) = value; }
     }
 
     /// <summary>
@@ -4471,8 +4675,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float TimeTillNextBeat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 6988); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6988); }
+        get { return *(float*)(Ptr + 6988); }
+        set { *(float*)(Ptr + 6988) = value; }
     }
 
     /// <summary>
@@ -4486,8 +4690,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float PadBeatAnimThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7008); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7008); }
+        get { return *(float*)(Ptr + 7008); }
+        set { *(float*)(Ptr + 7008) = value; }
     }
 
     /// <summary>
@@ -4555,8 +4759,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float ropeForceStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7036); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7036); }
+        get { return *(float*)(Ptr + 7036); }
+        set { *(float*)(Ptr + 7036) = value; }
     }
 
     /// <summary>
@@ -4564,8 +4768,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float ropeDampingStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7040); }
+        get { return *(float*)(Ptr + 7040); }
+        set { *(float*)(Ptr + 7040) = value; }
     }
 
     /// <summary>
@@ -4585,8 +4789,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float weightsMaxVel2d
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7100); }
+        get { return *(float*)(Ptr + 7100); }
+        set { *(float*)(Ptr + 7100) = value; }
     }
 
     /// <summary>
@@ -4594,8 +4798,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float weightsMaxVelZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7104); }
+        get { return *(float*)(Ptr + 7104); }
+        set { *(float*)(Ptr + 7104) = value; }
     }
 
     /// <summary>
@@ -4608,16 +4812,16 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe int bWeightsWantToBlockActors_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7108); }
+        get { return *(int*)(Ptr + 7108); }
+        set { *(int*)(Ptr + 7108) = value; }
     }
     /// <summary>
     /// IntProperty: bWeightsWantToBlockActors
     /// </summary>
     public unsafe int bWeightsWantToBlockActors_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7112); }
+        get { return *(int*)(Ptr + 7112); }
+        set { *(int*)(Ptr + 7112) = value; }
     }
 
     /// <summary>
@@ -4625,8 +4829,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float weightBlockBMDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7116); }
+        get { return *(float*)(Ptr + 7116); }
+        set { *(float*)(Ptr + 7116) = value; }
     }
 
     /// <summary>
@@ -4634,8 +4838,8 @@ public partial class RPawnBossGrundyBase : BmSDK.BmGame.RPawnVillain, BmSDK.BmGa
     /// </summary>
     public unsafe float weightTeleportLeniency
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7120); }
+        get { return *(float*)(Ptr + 7120); }
+        set { *(float*)(Ptr + 7120) = value; }
     }
 
     /// <summary>
@@ -73,15 +73,29 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
         where TComponent : class, Framework.IScriptComponent<RPawnBossVenomBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_IsInBeatUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsInBeatUp_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsInBeatUp
     /// </summary>
     public unsafe virtual bool IsInBeatUp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsInBeatUp", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsInBeatUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsInBeatUp", true);
+        var parms = new IsInBeatUp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetDeathTipFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetDeathTip_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -89,10 +103,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.FString GetDeathTip()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetDeathTip", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetDeathTipFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetDeathTip", true);
+        var parms = new GetDeathTip_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_HitDisruptableLaserGridFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HitDisruptableLaserGrid_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -100,10 +121,18 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool HitDisruptableLaserGrid()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.HitDisruptableLaserGrid", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HitDisruptableLaserGridFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.HitDisruptableLaserGrid", true);
+        var parms = new HitDisruptableLaserGrid_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetDeadThugPickupPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetDeadThugPickupPoint_Params
+    {
+        [FieldOffset(0)] public nint DeadThug;
+        [FieldOffset(4)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -111,11 +140,19 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetDeadThugPickupPoint(BmSDK.BmGame.RPawnCombat DeadThug)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetDeadThugPickupPoint", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeadThug, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_GetDeadThugPickupPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetDeadThugPickupPoint", true);
+        var parms = new GetDeadThugPickupPoint_Params();
+        parms.DeadThug = DeadThug?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDeadThugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDeadThug_Params
+    {
+        [FieldOffset(0)] public float SearchRange;
+        [FieldOffset(4)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -123,11 +160,21 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RPawnCombat GetDeadThug(float SearchRange)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetDeadThug", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SearchRange, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnCombat>(paramsPtr + 4);
+        var funcManaged = s_GetDeadThugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetDeadThug", true);
+        var parms = new GetDeadThug_Params();
+        parms.SearchRange = SearchRange;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RPawnCombat)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetClampedTargetDirectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct GetClampedTargetDirection_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Heading;
+        [FieldOffset(12)] public System.Numerics.Vector3 TargetPos;
+        [FieldOffset(24)] public float MaxYawDelta;
+        [FieldOffset(28)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -135,13 +182,22 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetClampedTargetDirection(System.Numerics.Vector3 Heading, System.Numerics.Vector3 TargetPos, float MaxYawDelta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetClampedTargetDirection", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Heading, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxYawDelta, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 28);
+        var funcManaged = s_GetClampedTargetDirectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetClampedTargetDirection", true);
+        var parms = new GetClampedTargetDirection_Params();
+        parms.Heading = Heading;
+        parms.TargetPos = TargetPos;
+        parms.MaxYawDelta = MaxYawDelta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRightStrikeHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetRightStrikeHitReaction_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName HitReaction;
+        [FieldOffset(8)] public BmSDK.FName PoseName;
+        [FieldOffset(16)] public nint dmgType;
     }
 
     /// <summary>
@@ -149,349 +205,553 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual void GetRightStrikeHitReaction(out BmSDK.FName HitReaction, out BmSDK.FName PoseName, BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetRightStrikeHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 8);
+        var funcManaged = s_GetRightStrikeHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetRightStrikeHitReaction", true);
+        var parms = new GetRightStrikeHitReaction_Params();
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_GetLeftStrikeHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetLeftStrikeHitReaction_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName HitReaction;
+        [FieldOffset(8)] public BmSDK.FName PoseName;
+        [FieldOffset(16)] public nint dmgType;
+    }
+
     /// <summary>
     /// Function: GetLeftStrikeHitReaction
     /// </summary>
     public unsafe virtual void GetLeftStrikeHitReaction(out BmSDK.FName HitReaction, out BmSDK.FName PoseName, BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetLeftStrikeHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 8);
+        var funcManaged = s_GetLeftStrikeHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetLeftStrikeHitReaction", true);
+        var parms = new GetLeftStrikeHitReaction_Params();
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_GetRearStrikeHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetRearStrikeHitReaction_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName HitReaction;
+        [FieldOffset(8)] public BmSDK.FName PoseName;
+        [FieldOffset(16)] public nint dmgType;
+    }
+
     /// <summary>
     /// Function: GetRearStrikeHitReaction
     /// </summary>
     public unsafe virtual void GetRearStrikeHitReaction(out BmSDK.FName HitReaction, out BmSDK.FName PoseName, BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetRearStrikeHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 8);
+        var funcManaged = s_GetRearStrikeHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetRearStrikeHitReaction", true);
+        var parms = new GetRearStrikeHitReaction_Params();
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_GetFrontStrikeHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetFrontStrikeHitReaction_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName HitReaction;
+        [FieldOffset(8)] public BmSDK.FName PoseName;
+        [FieldOffset(16)] public nint dmgType;
+    }
+
     /// <summary>
     /// Function: GetFrontStrikeHitReaction
     /// </summary>
     public unsafe virtual void GetFrontStrikeHitReaction(out BmSDK.FName HitReaction, out BmSDK.FName PoseName, BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetFrontStrikeHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 8);
+        var funcManaged = s_GetFrontStrikeHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetFrontStrikeHitReaction", true);
+        var parms = new GetFrontStrikeHitReaction_Params();
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_GetRightExplosionHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetRightExplosionHitReaction_Params
+    {
+        [FieldOffset(0)] public int bThresholdReached;
+        [FieldOffset(4)] public BmSDK.FName HitReaction;
+        [FieldOffset(12)] public BmSDK.FName PoseName;
+    }
+
     /// <summary>
     /// Function: GetRightExplosionHitReaction
     /// </summary>
     public unsafe virtual void GetRightExplosionHitReaction(bool bThresholdReached, out BmSDK.FName HitReaction, out BmSDK.FName PoseName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetRightExplosionHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThresholdReached, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 4);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 12);
+        var funcManaged = s_GetRightExplosionHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetRightExplosionHitReaction", true);
+        var parms = new GetRightExplosionHitReaction_Params();
+        parms.bThresholdReached = bThresholdReached ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_GetLeftExplosionHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetLeftExplosionHitReaction_Params
+    {
+        [FieldOffset(0)] public int bThresholdReached;
+        [FieldOffset(4)] public BmSDK.FName HitReaction;
+        [FieldOffset(12)] public BmSDK.FName PoseName;
+    }
+
     /// <summary>
     /// Function: GetLeftExplosionHitReaction
     /// </summary>
     public unsafe virtual void GetLeftExplosionHitReaction(bool bThresholdReached, out BmSDK.FName HitReaction, out BmSDK.FName PoseName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetLeftExplosionHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThresholdReached, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 4);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 12);
+        var funcManaged = s_GetLeftExplosionHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetLeftExplosionHitReaction", true);
+        var parms = new GetLeftExplosionHitReaction_Params();
+        parms.bThresholdReached = bThresholdReached ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_GetRearExplosionHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetRearExplosionHitReaction_Params
+    {
+        [FieldOffset(0)] public int bThresholdReached;
+        [FieldOffset(4)] public BmSDK.FName HitReaction;
+        [FieldOffset(12)] public BmSDK.FName PoseName;
+    }
+
     /// <summary>
     /// Function: GetRearExplosionHitReaction
     /// </summary>
     public unsafe virtual void GetRearExplosionHitReaction(bool bThresholdReached, out BmSDK.FName HitReaction, out BmSDK.FName PoseName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetRearExplosionHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThresholdReached, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 4);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 12);
+        var funcManaged = s_GetRearExplosionHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetRearExplosionHitReaction", true);
+        var parms = new GetRearExplosionHitReaction_Params();
+        parms.bThresholdReached = bThresholdReached ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_GetFrontExplosionHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetFrontExplosionHitReaction_Params
+    {
+        [FieldOffset(0)] public int bThresholdReached;
+        [FieldOffset(4)] public BmSDK.FName HitReaction;
+        [FieldOffset(12)] public BmSDK.FName PoseName;
+    }
+
     /// <summary>
     /// Function: GetFrontExplosionHitReaction
     /// </summary>
     public unsafe virtual void GetFrontExplosionHitReaction(bool bThresholdReached, out BmSDK.FName HitReaction, out BmSDK.FName PoseName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetFrontExplosionHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThresholdReached, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 4);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 12);
+        var funcManaged = s_GetFrontExplosionHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetFrontExplosionHitReaction", true);
+        var parms = new GetFrontExplosionHitReaction_Params();
+        parms.bThresholdReached = bThresholdReached ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_GetWallHitReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetWallHitReaction_Params
+    {
+        [FieldOffset(0)] public int bThresholdReached;
+        [FieldOffset(4)] public BmSDK.FName HitReaction;
+        [FieldOffset(12)] public BmSDK.FName PoseName;
+    }
+
     /// <summary>
     /// Function: GetWallHitReaction
     /// </summary>
     public unsafe virtual void GetWallHitReaction(bool bThresholdReached, out BmSDK.FName HitReaction, out BmSDK.FName PoseName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetWallHitReaction", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bThresholdReached, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        HitReaction = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 4);
-        PoseName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 12);
+        var funcManaged = s_GetWallHitReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetWallHitReaction", true);
+        var parms = new GetWallHitReaction_Params();
+        parms.bThresholdReached = bThresholdReached ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        HitReaction = parms.HitReaction;
+        PoseName = parms.PoseName;
         return;
     }
 
+    static BmSDK.Function s_ShockwaveTriggeredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShockwaveTriggered_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShockwaveTriggered
     /// </summary>
     public unsafe virtual void ShockwaveTriggered()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ShockwaveTriggered", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShockwaveTriggeredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ShockwaveTriggered", true);
+        var parms = new ShockwaveTriggered_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DeactivateCollisionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DeactivateCollision_Params
+    {
+    }
+
     /// <summary>
     /// Function: DeactivateCollision
     /// </summary>
     public unsafe virtual void DeactivateCollision()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.DeactivateCollision", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DeactivateCollisionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.DeactivateCollision", true);
+        var parms = new DeactivateCollision_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChargedIntoDisruptableLaserGridFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ChargedIntoDisruptableLaserGrid_Params
+    {
+        [FieldOffset(0)] public int bQuickBatarang;
+    }
+
     /// <summary>
     /// Function: ChargedIntoDisruptableLaserGrid
     /// </summary>
     public unsafe virtual void ChargedIntoDisruptableLaserGrid(bool bQuickBatarang)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ChargedIntoDisruptableLaserGrid", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bQuickBatarang, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChargedIntoDisruptableLaserGridFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ChargedIntoDisruptableLaserGrid", true);
+        var parms = new ChargedIntoDisruptableLaserGrid_Params();
+        parms.bQuickBatarang = bQuickBatarang ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChargedIntoWallFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ChargedIntoWall_Params
+    {
+        [FieldOffset(0)] public int bQuickBatarang;
+    }
+
     /// <summary>
     /// Function: ChargedIntoWall
     /// </summary>
     public unsafe virtual void ChargedIntoWall(bool bQuickBatarang)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ChargedIntoWall", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bQuickBatarang, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChargedIntoWallFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ChargedIntoWall", true);
+        var parms = new ChargedIntoWall_Params();
+        parms.bQuickBatarang = bQuickBatarang ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateBatmansVenomWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CreateBatmansVenomWeaponConfig_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+    }
+
     /// <summary>
     /// Function: CreateBatmansVenomWeaponConfig
     /// </summary>
     public unsafe virtual void CreateBatmansVenomWeaponConfig(BmSDK.BmGame.RPawnPlayerCombat PlayerPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.CreateBatmansVenomWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CreateBatmansVenomWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.CreateBatmansVenomWeaponConfig", true);
+        var parms = new CreateBatmansVenomWeaponConfig_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EvadeableAttackHitPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EvadeableAttackHitPlayer_Params
+    {
+    }
+
     /// <summary>
     /// Function: EvadeableAttackHitPlayer
     /// </summary>
     public unsafe virtual void EvadeableAttackHitPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.EvadeableAttackHitPlayer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EvadeableAttackHitPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.EvadeableAttackHitPlayer", true);
+        var parms = new EvadeableAttackHitPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AttackCompletedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AttackCompleted_Params
+    {
+    }
+
     /// <summary>
     /// Function: AttackCompleted
     /// </summary>
     public unsafe virtual void AttackCompleted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.AttackCompleted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AttackCompletedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.AttackCompleted", true);
+        var parms = new AttackCompleted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BerserkTimedOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BerserkTimedOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: BerserkTimedOut
     /// </summary>
     public unsafe virtual void BerserkTimedOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.BerserkTimedOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BerserkTimedOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.BerserkTimedOut", true);
+        var parms = new BerserkTimedOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BerserkEndFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BerserkEnd_Params
+    {
+    }
+
     /// <summary>
     /// Function: BerserkEnd
     /// </summary>
     public unsafe virtual void BerserkEnd()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.BerserkEnd", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BerserkEndFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.BerserkEnd", true);
+        var parms = new BerserkEnd_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BerserkBeginFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BerserkBegin_Params
+    {
+    }
+
     /// <summary>
     /// Function: BerserkBegin
     /// </summary>
     public unsafe virtual void BerserkBegin()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.BerserkBegin", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BerserkBeginFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.BerserkBegin", true);
+        var parms = new BerserkBegin_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChargeDodgedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ChargeDodged_Params
+    {
+    }
+
     /// <summary>
     /// Function: ChargeDodged
     /// </summary>
     public unsafe virtual void ChargeDodged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ChargeDodged", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChargeDodgedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ChargeDodged", true);
+        var parms = new ChargeDodged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SuccessfulEvadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SuccessfulEvade_Params
+    {
+    }
+
     /// <summary>
     /// Function: SuccessfulEvade
     /// </summary>
     public unsafe virtual void SuccessfulEvade()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.SuccessfulEvade", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SuccessfulEvadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.SuccessfulEvade", true);
+        var parms = new SuccessfulEvade_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SuccessfulBeatUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SuccessfulBeatUp_Params
+    {
+    }
+
     /// <summary>
     /// Function: SuccessfulBeatUp
     /// </summary>
     public unsafe virtual void SuccessfulBeatUp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.SuccessfulBeatUp", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SuccessfulBeatUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.SuccessfulBeatUp", true);
+        var parms = new SuccessfulBeatUp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SuccessfulBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SuccessfulBatarang_Params
+    {
+    }
+
     /// <summary>
     /// Function: SuccessfulBatarang
     /// </summary>
     public unsafe virtual void SuccessfulBatarang()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.SuccessfulBatarang", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SuccessfulBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.SuccessfulBatarang", true);
+        var parms = new SuccessfulBatarang_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetStunnedPfxFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetStunnedPfx_Params
+    {
+        [FieldOffset(0)] public int bOn;
+    }
+
     /// <summary>
     /// Function: SetStunnedPfx
     /// </summary>
     public unsafe virtual void SetStunnedPfx(bool bOn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.SetStunnedPfx", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetStunnedPfxFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.SetStunnedPfx", true);
+        var parms = new SetStunnedPfx_Params();
+        parms.bOn = bOn ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayAdditiveBatarangReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayAdditiveBatarangReaction_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayAdditiveBatarangReaction
     /// </summary>
     public unsafe virtual void PlayAdditiveBatarangReaction()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.PlayAdditiveBatarangReaction", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayAdditiveBatarangReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.PlayAdditiveBatarangReaction", true);
+        var parms = new PlayAdditiveBatarangReaction_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayBatarangHitFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayBatarangHitFX_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayBatarangHitFX
     /// </summary>
     public unsafe virtual void PlayBatarangHitFX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.PlayBatarangHitFX", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayBatarangHitFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.PlayBatarangHitFX", true);
+        var parms = new PlayBatarangHitFX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopLookAtBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopLookAtBatman_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopLookAtBatman
     /// </summary>
     public unsafe virtual void StopLookAtBatman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.StopLookAtBatman", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopLookAtBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.StopLookAtBatman", true);
+        var parms = new StopLookAtBatman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LookAtBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LookAtBatman_Params
+    {
+    }
+
     /// <summary>
     /// Function: LookAtBatman
     /// </summary>
     public unsafe virtual void LookAtBatman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.LookAtBatman", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LookAtBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.LookAtBatman", true);
+        var parms = new LookAtBatman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetThugThrowHitSoundCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetThugThrowHitSoundCue_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetThugThrowHitSoundCue
     /// </summary>
     public unsafe virtual BmSDK.Engine.AkEvent GetThugThrowHitSoundCue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetThugThrowHitSoundCue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetThugThrowHitSoundCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetThugThrowHitSoundCue", true);
+        var parms = new GetThugThrowHitSoundCue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetPlayerThrowHitSoundCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetPlayerThrowHitSoundCue_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -499,10 +759,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.Engine.AkEvent GetPlayerThrowHitSoundCue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetPlayerThrowHitSoundCue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetPlayerThrowHitSoundCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetPlayerThrowHitSoundCue", true);
+        var parms = new GetPlayerThrowHitSoundCue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetThugChargedSoundCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetThugChargedSoundCue_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -510,10 +777,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.Engine.AkEvent GetThugChargedSoundCue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetThugChargedSoundCue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetThugChargedSoundCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetThugChargedSoundCue", true);
+        var parms = new GetThugChargedSoundCue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetPlayerChargedSoundCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetPlayerChargedSoundCue_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -521,10 +795,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.Engine.AkEvent GetPlayerChargedSoundCue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetPlayerChargedSoundCue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetPlayerChargedSoundCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetPlayerChargedSoundCue", true);
+        var parms = new GetPlayerChargedSoundCue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetThugPunchedSoundCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetThugPunchedSoundCue_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -532,10 +813,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.Engine.AkEvent GetThugPunchedSoundCue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetThugPunchedSoundCue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetThugPunchedSoundCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetThugPunchedSoundCue", true);
+        var parms = new GetThugPunchedSoundCue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetPlayerPunchedSoundCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetPlayerPunchedSoundCue_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -543,10 +831,19 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.Engine.AkEvent GetPlayerPunchedSoundCue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetPlayerPunchedSoundCue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkEvent>(paramsPtr + 0);
+        var funcManaged = s_GetPlayerPunchedSoundCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetPlayerPunchedSoundCue", true);
+        var parms = new GetPlayerPunchedSoundCue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkEvent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetTargetPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetTargetPriority_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+        [FieldOffset(4)] public nint dmgType;
+        [FieldOffset(8)] public float ReturnValue;
     }
 
     /// <summary>
@@ -554,12 +851,22 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe override float GetTargetPriority(BmSDK.BmGame.RPawnCombat Attacker, BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetTargetPriority", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_GetTargetPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetTargetPriority", true);
+        var parms = new GetTargetPriority_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsValidForStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct IsValidForStrike_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public nint TestPawn;
+        [FieldOffset(8)] public nint DamageType;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -567,13 +874,19 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool IsValidForStrike(BmSDK.BmGame.RPawnPlayerCombat PlayerPawn, BmSDK.BmGame.RPawnCombat TestPawn, BmSDK.Class DamageType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsValidForStrike", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPawn, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsValidForStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsValidForStrike", true);
+        var parms = new IsValidForStrike_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        parms.TestPawn = TestPawn?.Ptr ?? 0;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ForceChargeAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ForceChargeAttack_Params
+    {
     }
 
     /// <summary>
@@ -581,21 +894,35 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual void ForceChargeAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ForceChargeAttack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceChargeAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.ForceChargeAttack", true);
+        var parms = new ForceChargeAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetMaxWalkAttackRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetMaxWalkAttackRange_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetMaxWalkAttackRange
     /// </summary>
     public unsafe virtual float GetMaxWalkAttackRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetMaxWalkAttackRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetMaxWalkAttackRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetMaxWalkAttackRange", true);
+        var parms = new GetMaxWalkAttackRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetChargeHomingValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetChargeHomingValue_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -603,10 +930,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual float GetChargeHomingValue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetChargeHomingValue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetChargeHomingValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetChargeHomingValue", true);
+        var parms = new GetChargeHomingValue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsBeingRiddenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsBeingRidden_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -614,10 +948,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool IsBeingRidden()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsBeingRidden", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsBeingRiddenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsBeingRidden", true);
+        var parms = new IsBeingRidden_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsVulnerableToExplosionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsVulnerableToExplosion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -625,10 +966,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool IsVulnerableToExplosion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsVulnerableToExplosion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsVulnerableToExplosionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsVulnerableToExplosion", true);
+        var parms = new IsVulnerableToExplosion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetSmokeBombReactionClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSmokeBombReactionClass_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -636,10 +984,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe override BmSDK.Class GetSmokeBombReactionClass()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetSmokeBombReactionClass", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetSmokeBombReactionClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetSmokeBombReactionClass", true);
+        var parms = new GetSmokeBombReactionClass_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsHenchmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsHenchman_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -647,10 +1002,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool IsHenchman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsHenchman", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsHenchmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsHenchman", true);
+        var parms = new IsHenchman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetLastCombatMoveClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetLastCombatMoveClass_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -658,10 +1020,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.Class GetLastCombatMoveClass()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetLastCombatMoveClass", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetLastCombatMoveClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetLastCombatMoveClass", true);
+        var parms = new GetLastCombatMoveClass_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsVirtuallyDeadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsVirtuallyDead_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -669,10 +1038,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool IsVirtuallyDead()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsVirtuallyDead", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsVirtuallyDeadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsVirtuallyDead", true);
+        var parms = new IsVirtuallyDead_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetHealth_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -680,10 +1056,17 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe override int GetHealth()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetHealth", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetHealth", true);
+        var parms = new GetHealth_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetBehaviour_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -691,10 +1074,22 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RBMBehaviour_Venom GetBehaviour()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMBehaviour_Venom>(paramsPtr + 0);
+        var funcManaged = s_GetBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetBehaviour", true);
+        var parms = new GetBehaviour_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMBehaviour_Venom)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsPathClearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct IsPathClear_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 FromPoint;
+        [FieldOffset(12)] public System.Numerics.Vector3 EndPoint;
+        [FieldOffset(24)] public float Radius;
+        [FieldOffset(28)] public System.Numerics.Vector3 CollidePoint;
+        [FieldOffset(40)] public System.Numerics.Vector3 CollideNormal;
+        [FieldOffset(52)] public int ReturnValue;
     }
 
     /// <summary>
@@ -702,22 +1097,23 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool IsPathClear(System.Numerics.Vector3 FromPoint, System.Numerics.Vector3 EndPoint, float Radius, out System.Numerics.Vector3 CollidePoint, out System.Numerics.Vector3 CollideNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsPathClear", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FromPoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndPoint, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Radius, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        CollidePoint = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 28);
-        CollideNormal = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 40);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 52);
+        var funcManaged = s_IsPathClearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.IsPathClear", true);
+        var parms = new IsPathClear_Params();
+        parms.FromPoint = FromPoint;
+        parms.EndPoint = EndPoint;
+        parms.Radius = Radius;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        CollidePoint = parms.CollidePoint;
+        CollideNormal = parms.CollideNormal;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetCollideFreePositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetCollideFreePosition_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Position;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -725,18 +1121,23 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool GetCollideFreePosition(out System.Numerics.Vector3 Position)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetCollideFreePosition", true);
-        byte* paramsPtr = stackalloc byte[16];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Position = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_GetCollideFreePositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.GetCollideFreePosition", true);
+        var parms = new GetCollideFreePosition_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Position = parms.Position;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_WillCollideWithWallFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct WillCollideWithWall_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Heading;
+        [FieldOffset(12)] public System.Numerics.Vector3 CollidePoint;
+        [FieldOffset(24)] public System.Numerics.Vector3 Normal;
+        [FieldOffset(36)] public nint HitActorL;
+        [FieldOffset(40)] public nint HitActorR;
+        [FieldOffset(44)] public int ReturnValue;
     }
 
     /// <summary>
@@ -744,22 +1145,15 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe virtual bool WillCollideWithWall(System.Numerics.Vector3 Heading, out System.Numerics.Vector3 CollidePoint, out System.Numerics.Vector3 Normal, out BmSDK.Engine.Actor HitActorL, out BmSDK.Engine.Actor HitActorR)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.WillCollideWithWall", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Heading, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        CollidePoint = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        Normal = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 24);
-        HitActorL = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(paramsPtr + 36);
-        HitActorR = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(paramsPtr + 40);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 44);
+        var funcManaged = s_WillCollideWithWallFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnBossVenomBase.WillCollideWithWall", true);
+        var parms = new WillCollideWithWall_Params();
+        parms.Heading = Heading;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        CollidePoint = parms.CollidePoint;
+        Normal = parms.Normal;
+        HitActorL = parms.HitActorL == 0 ? null : (BmSDK.Engine.Actor)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.HitActorL);
+        HitActorR = parms.HitActorR == 0 ? null : (BmSDK.Engine.Actor)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.HitActorR);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -780,20 +1174,12 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
         /// <summary>
         /// IntProperty: NumTimesUsed
         /// </summary>
-        public unsafe int NumTimesUsed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int NumTimesUsed;
 
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Time;
     }
 
     /// <summary>
@@ -801,8 +1187,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe float ShortRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3560); }
+        get { return *(float*)(Ptr + 3560); }
+        set { *(float*)(Ptr + 3560) = value; }
     }
 
     /// <summary>
@@ -810,8 +1196,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe float MediumRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3564); }
+        get { return *(float*)(Ptr + 3564); }
+        set { *(float*)(Ptr + 3564) = value; }
     }
 
     /// <summary>
@@ -819,8 +1205,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe float LongRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3568); }
+        get { return *(float*)(Ptr + 3568); }
+        set { *(float*)(Ptr + 3568) = value; }
     }
 
     /// <summary>
@@ -828,8 +1214,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe float MaxAttackDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3572); }
+        get { return *(float*)(Ptr + 3572); }
+        set { *(float*)(Ptr + 3572) = value; }
     }
 
     /// <summary>
@@ -837,8 +1223,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe int Id
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3576); }
+        get { return *(int*)(Ptr + 3576); }
+        set { *(int*)(Ptr + 3576) = value; }
     }
 
     /// <summary>
@@ -936,8 +1322,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe bool bExhausted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3628); }
+        get { return (*(int*)(Ptr + 3628) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 3628) |= 1; else *(int*)(Ptr + 3628) &= ~1; }
     }
 
     /// <summary>
@@ -945,8 +1331,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe bool bChargeOvershoot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3628); }
+        get { return (*(int*)(Ptr + 3628) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 3628) |= 2; else *(int*)(Ptr + 3628) &= ~2; }
     }
 
     /// <summary>
@@ -954,8 +1340,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe bool bCharging
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3628); }
+        get { return (*(int*)(Ptr + 3628) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 3628) |= 4; else *(int*)(Ptr + 3628) &= ~4; }
     }
 
     /// <summary>
@@ -963,8 +1349,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe bool bForceChargeAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3628); }
+        get { return (*(int*)(Ptr + 3628) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 3628) |= 8; else *(int*)(Ptr + 3628) &= ~8; }
     }
 
     /// <summary>
@@ -972,8 +1358,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe bool bTauntEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3628); }
+        get { return (*(int*)(Ptr + 3628) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 3628) |= 16; else *(int*)(Ptr + 3628) &= ~16; }
     }
 
     /// <summary>
@@ -981,8 +1367,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe bool bNeverBataranged
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3628); }
+        get { return (*(int*)(Ptr + 3628) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 3628) |= 32; else *(int*)(Ptr + 3628) &= ~32; }
     }
 
     /// <summary>
@@ -990,8 +1376,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe bool bNeverUsedAgainstEachOther
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3628); }
+        get { return (*(int*)(Ptr + 3628) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 3628) |= 64; else *(int*)(Ptr + 3628) &= ~64; }
     }
 
     /// <summary>
@@ -999,8 +1385,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe bool SlowRideIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3628); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3628); }
+        get { return (*(int*)(Ptr + 3628) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 3628) |= 128; else *(int*)(Ptr + 3628) &= ~128; }
     }
 
     /// <summary>
@@ -1104,8 +1490,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe int ThresholdIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3824); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3824); }
+        get { return *(int*)(Ptr + 3824); }
+        set { *(int*)(Ptr + 3824) = value; }
     }
 
     /// <summary>
@@ -1122,8 +1508,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe int AttackPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3840); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3840); }
+        get { return *(int*)(Ptr + 3840); }
+        set { *(int*)(Ptr + 3840) = value; }
     }
 
     /// <summary>
@@ -1131,8 +1517,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe float ChargeHomingValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3844); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3844); }
+        get { return *(float*)(Ptr + 3844); }
+        set { *(float*)(Ptr + 3844) = value; }
     }
 
     /// <summary>
@@ -1140,8 +1526,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe float MaxBerserkWindowTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3848); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3848); }
+        get { return *(float*)(Ptr + 3848); }
+        set { *(float*)(Ptr + 3848) = value; }
     }
 
     /// <summary>
@@ -1167,8 +1553,8 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe float BerserkDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3860); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3860); }
+        get { return *(float*)(Ptr + 3860); }
+        set { *(float*)(Ptr + 3860) = value; }
     }
 
     /// <summary>
@@ -1194,7 +1580,7 @@ public partial class RPawnBossVenomBase : BmSDK.BmGame.RPawnVillain, BmSDK.IGame
     /// </summary>
     public unsafe int TotalTimesRidden
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3872); }
+        get { return *(int*)(Ptr + 3872); }
+        set { *(int*)(Ptr + 3872) = value; }
     }
 }
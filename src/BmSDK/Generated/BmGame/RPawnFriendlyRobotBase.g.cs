@@ -78,47 +78,71 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
         where TComponent : class, Framework.IScriptComponent<RPawnFriendlyRobotBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_InitDisabledRobotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InitDisabledRobot_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitDisabledRobot
     /// </summary>
     public unsafe virtual void InitDisabledRobot()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnFriendlyRobotBase.InitDisabledRobot", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitDisabledRobotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnFriendlyRobotBase.InitDisabledRobot", true);
+        var parms = new InitDisabledRobot_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitRobotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InitRobot_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitRobot
     /// </summary>
     public unsafe virtual void InitRobot()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnFriendlyRobotBase.InitRobot", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitRobotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnFriendlyRobotBase.InitRobot", true);
+        var parms = new InitRobot_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ScanningBeginsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ScanningBegins_Params
+    {
+    }
+
     /// <summary>
     /// Function: ScanningBegins
     /// </summary>
     public unsafe virtual void ScanningBegins()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnFriendlyRobotBase.ScanningBegins", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ScanningBeginsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnFriendlyRobotBase.ScanningBegins", true);
+        var parms = new ScanningBegins_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ScanCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ScanComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: ScanComplete
     /// </summary>
     public unsafe virtual void ScanComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnFriendlyRobotBase.ScanComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ScanCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnFriendlyRobotBase.ScanComplete", true);
+        var parms = new ScanComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -136,8 +160,8 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe bool bHasBeenScanned
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2752) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 2752); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 2752); }
+        get { return (*(int*)(Ptr + 2752) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 2752) |= 1; else *(int*)(Ptr + 2752) &= ~1; }
     }
 
     /// <summary>
@@ -145,8 +169,8 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe float AmountOfDataInFirstRobot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2756); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2756); }
+        get { return *(float*)(Ptr + 2756); }
+        set { *(float*)(Ptr + 2756) = value; }
     }
 
     /// <summary>
@@ -154,8 +178,8 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe float AmountOfDataInThisRobot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2760); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2760); }
+        get { return *(float*)(Ptr + 2760); }
+        set { *(float*)(Ptr + 2760) = value; }
     }
 
     /// <summary>
@@ -163,8 +187,8 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe float PrescanDurationFirstRobot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2764); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2764); }
+        get { return *(float*)(Ptr + 2764); }
+        set { *(float*)(Ptr + 2764) = value; }
     }
 
     /// <summary>
@@ -172,8 +196,8 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe float PrescanDurationOtherRobot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2768); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2768); }
+        get { return *(float*)(Ptr + 2768); }
+        set { *(float*)(Ptr + 2768) = value; }
     }
 
     /// <summary>
@@ -181,8 +205,8 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe float ScanAmountPerSecond
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2772); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2772); }
+        get { return *(float*)(Ptr + 2772); }
+        set { *(float*)(Ptr + 2772) = value; }
     }
 
     /// <summary>
@@ -190,8 +214,8 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe float ScanAmountPerSecondForSecondary
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2776); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2776); }
+        get { return *(float*)(Ptr + 2776); }
+        set { *(float*)(Ptr + 2776) = value; }
     }
 
     /// <summary>
@@ -199,8 +223,8 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe float AmountOfDataHeld
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2780); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2780); }
+        get { return *(float*)(Ptr + 2780); }
+        set { *(float*)(Ptr + 2780) = value; }
     }
 
     /// <summary>
@@ -208,7 +232,7 @@ public partial class RPawnFriendlyRobotBase : BmSDK.BmGame.RPawnFriendly, BmSDK.
     /// </summary>
     public unsafe float PrescanDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 2784); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2784); }
+        get { return *(float*)(Ptr + 2784); }
+        set { *(float*)(Ptr + 2784) = value; }
     }
 }
@@ -78,45 +78,58 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
         where TComponent : class, Framework.IScriptComponent<RPawnPlayerNightwingBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_RicochetRayTestFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct RicochetRayTest_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Start;
+        [FieldOffset(12)] public System.Numerics.Vector3 Dir;
+        [FieldOffset(24)] public float Length;
+    }
+
     /// <summary>
     /// Function: RicochetRayTest
     /// </summary>
     public unsafe virtual void RicochetRayTest(System.Numerics.Vector3 Start, System.Numerics.Vector3 Dir, float Length)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnPlayerNightwingBase.RicochetRayTest", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Start, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Dir, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Length, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RicochetRayTestFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnPlayerNightwingBase.RicochetRayTest", true);
+        var parms = new RicochetRayTest_Params();
+        parms.Start = Start;
+        parms.Dir = Dir;
+        parms.Length = Length;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateGetRicochetTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateGetRicochetTarget_Params
+    {
+        [FieldOffset(0)] public int maxIterations;
+        [FieldOffset(4)] public nint Gadget;
+        [FieldOffset(8)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: UpdateGetRicochetTarget
     /// </summary>
     public unsafe virtual BmSDK.Engine.Actor UpdateGetRicochetTarget(int maxIterations, BmSDK.BmGame.RInventoryGadget Gadget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnPlayerNightwingBase.UpdateGetRicochetTarget", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(maxIterations, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Gadget, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(paramsPtr + 8);
+        var funcManaged = s_UpdateGetRicochetTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnPlayerNightwingBase.UpdateGetRicochetTarget", true);
+        var parms = new UpdateGetRicochetTarget_Params();
+        parms.maxIterations = maxIterations;
+        parms.Gadget = Gadget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Actor)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_StartGetRicochetTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct StartGetRicochetTarget_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 CameraLoc;
+        [FieldOffset(12)] public BmSDK.Rotator CameraRot;
+        [FieldOffset(24)] public System.Numerics.Vector3 launchPos;
     }
 
     /// <summary>
@@ -124,19 +137,12 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe virtual void StartGetRicochetTarget(System.Numerics.Vector3 CameraLoc, BmSDK.Rotator CameraRot, System.Numerics.Vector3 launchPos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnPlayerNightwingBase.StartGetRicochetTarget", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CameraLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CameraRot, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(launchPos, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_StartGetRicochetTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnPlayerNightwingBase.StartGetRicochetTarget", true);
+        var parms = new StartGetRicochetTarget_Params();
+        parms.CameraLoc = CameraLoc;
+        parms.CameraRot = CameraRot;
+        parms.launchPos = launchPos;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -145,8 +151,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe BmSDK.FName TargetClass
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 5956); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5956); }
+        get { return *(BmSDK.FName*)(Ptr + 5956); }
+        set { *(BmSDK.FName*)(Ptr + 5956) = value; }
     }
 
     /// <summary>
@@ -154,8 +160,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe bool GettingTarget
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5964) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5964); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 5964); }
+        get { return (*(int*)(Ptr + 5964) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 5964) |= 1; else *(int*)(Ptr + 5964) &= ~1; }
     }
 
     /// <summary>
@@ -163,8 +169,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe int RicochetRay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5968); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5968); }
+        get { return *(int*)(Ptr + 5968); }
+        set { *(int*)(Ptr + 5968) = value; }
     }
 
     /// <summary>
@@ -172,8 +178,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe int RicochetNumRays
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5972); }
+        get { return *(int*)(Ptr + 5972); }
+        set { *(int*)(Ptr + 5972) = value; }
     }
 
     /// <summary>
@@ -181,8 +187,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe float RicochetMaxRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5976); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5976); }
+        get { return *(float*)(Ptr + 5976); }
+        set { *(float*)(Ptr + 5976) = value; }
     }
 
     /// <summary>
@@ -190,8 +196,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe int RicochetMaxBounces
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5980); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5980); }
+        get { return *(int*)(Ptr + 5980); }
+        set { *(int*)(Ptr + 5980) = value; }
     }
 
     /// <summary>
@@ -199,8 +205,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe float RicochetMaxAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5984); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5984); }
+        get { return *(float*)(Ptr + 5984); }
+        set { *(float*)(Ptr + 5984) = value; }
     }
 
     /// <summary>
@@ -208,8 +214,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe int RicochetMaxExtraTargets
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5988); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5988); }
+        get { return *(int*)(Ptr + 5988); }
+        set { *(int*)(Ptr + 5988) = value; }
     }
 
     /// <summary>
@@ -217,8 +223,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe float RicochetExtraTargetMaxDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5992); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5992); }
+        get { return *(float*)(Ptr + 5992); }
+        set { *(float*)(Ptr + 5992) = value; }
     }
 
     /// <summary>
@@ -235,8 +241,8 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
     /// </summary>
     public unsafe int RicochetNumTargets
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 6008); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6008); }
+        get { return *(int*)(Ptr + 6008); }
+        set { *(int*)(Ptr + 6008) = value; }
     }
 
     /// <summary>
@@ -248,20 +254,12 @@ public partial class RPawnPlayerNightwingBase : BmSDK.BmGame.RPawnPlayer, BmSDK.
         /// <summary>
         /// StructProperty: Location
         /// </summary>
-        public unsafe System.Numerics.Vector3 Location
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector3 Location;
 
         /// <summary>
         /// StructProperty: Normal
         /// </summary>
-        public unsafe System.Numerics.Vector3 Normal
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public System.Numerics.Vector3 Normal;
 
         /// <summary>
         /// ObjectProperty: Pawn
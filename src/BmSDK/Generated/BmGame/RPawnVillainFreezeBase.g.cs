@@ -78,15 +78,29 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
         where TComponent : class, Framework.IScriptComponent<RPawnVillainFreezeBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetParameterInterferenceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetParameterInterference_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetParameterInterference
     /// </summary>
     public unsafe override BmSDK.Engine.AkParameterName GetParameterInterference()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.GetParameterInterference", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkParameterName>(paramsPtr + 0);
+        var funcManaged = s_GetParameterInterferenceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.GetParameterInterference", true);
+        var parms = new GetParameterInterference_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkParameterName)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetParameterAngleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetParameterAngle_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -94,10 +108,18 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe override BmSDK.Engine.AkParameterName GetParameterAngle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.GetParameterAngle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkParameterName>(paramsPtr + 0);
+        var funcManaged = s_GetParameterAngleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.GetParameterAngle", true);
+        var parms = new GetParameterAngle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkParameterName)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ShouldAutoClimbAfterGrappleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ShouldAutoClimbAfterGrapple_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ClimbLocation;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -105,11 +127,18 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual bool ShouldAutoClimbAfterGrapple(System.Numerics.Vector3 ClimbLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.ShouldAutoClimbAfterGrapple", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClimbLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_ShouldAutoClimbAfterGrappleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.ShouldAutoClimbAfterGrapple", true);
+        var parms = new ShouldAutoClimbAfterGrapple_Params();
+        parms.ClimbLocation = ClimbLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanOpenBackScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanOpenBackScreen_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -117,10 +146,17 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual bool CanOpenBackScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.CanOpenBackScreen", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanOpenBackScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.CanOpenBackScreen", true);
+        var parms = new CanOpenBackScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HitByFreezeClusterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HitByFreezeCluster_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ClusterLocation;
     }
 
     /// <summary>
@@ -128,44 +164,70 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual void HitByFreezeCluster(System.Numerics.Vector3 ClusterLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.HitByFreezeCluster", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClusterLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByFreezeClusterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.HitByFreezeCluster", true);
+        var parms = new HitByFreezeCluster_Params();
+        parms.ClusterLocation = ClusterLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitByFreezeBlastFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HitByFreezeBlast_Params
+    {
+    }
+
     /// <summary>
     /// Function: HitByFreezeBlast
     /// </summary>
     public unsafe virtual void HitByFreezeBlast()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.HitByFreezeBlast", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByFreezeBlastFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.HitByFreezeBlast", true);
+        var parms = new HitByFreezeBlast_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitByJammerGadgetChargeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HitByJammerGadgetCharge_Params
+    {
+    }
+
     /// <summary>
     /// Function: HitByJammerGadgetCharge
     /// </summary>
     public unsafe virtual void HitByJammerGadgetCharge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.HitByJammerGadgetCharge", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByJammerGadgetChargeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.HitByJammerGadgetCharge", true);
+        var parms = new HitByJammerGadgetCharge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsVulnerableToJammerGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsVulnerableToJammerGadget_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsVulnerableToJammerGadget
     /// </summary>
     public unsafe virtual bool IsVulnerableToJammerGadget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.IsVulnerableToJammerGadget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsVulnerableToJammerGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.IsVulnerableToJammerGadget", true);
+        var parms = new IsVulnerableToJammerGadget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsVulnerableToBossStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsVulnerableToBossStrike_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -173,10 +235,17 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual bool IsVulnerableToBossStrike()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.IsVulnerableToBossStrike", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsVulnerableToBossStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.IsVulnerableToBossStrike", true);
+        var parms = new IsVulnerableToBossStrike_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetMagneticBlastDurationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetMagneticBlastDuration_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -184,10 +253,17 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual float GetMagneticBlastDuration()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.GetMagneticBlastDuration", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetMagneticBlastDurationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.GetMagneticBlastDuration", true);
+        var parms = new GetMagneticBlastDuration_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_TickMagneticBlastFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TickMagneticBlast_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -195,48 +271,78 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual void TickMagneticBlast(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.TickMagneticBlast", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickMagneticBlastFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.TickMagneticBlast", true);
+        var parms = new TickMagneticBlast_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoMagneticBlastAttractFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DoMagneticBlastAttract_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 magnet_source;
+        [FieldOffset(12)] public BmSDK.Rotator wall_normal;
+    }
+
     /// <summary>
     /// Function: DoMagneticBlastAttract
     /// </summary>
     public unsafe virtual void DoMagneticBlastAttract(System.Numerics.Vector3 magnet_source, BmSDK.Rotator wall_normal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.DoMagneticBlastAttract", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(magnet_source, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(wall_normal, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoMagneticBlastAttractFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.DoMagneticBlastAttract", true);
+        var parms = new DoMagneticBlastAttract_Params();
+        parms.magnet_source = magnet_source;
+        parms.wall_normal = wall_normal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RespondToLineLauncherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct RespondToLineLauncher_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 batmans_position;
+        [FieldOffset(12)] public int be_knocked_down;
+    }
+
     /// <summary>
     /// Function: RespondToLineLauncher
     /// </summary>
     public unsafe virtual void RespondToLineLauncher(System.Numerics.Vector3 batmans_position, bool be_knocked_down)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.RespondToLineLauncher", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(batmans_position, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(be_knocked_down, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RespondToLineLauncherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.RespondToLineLauncher", true);
+        var parms = new RespondToLineLauncher_Params();
+        parms.batmans_position = batmans_position;
+        parms.be_knocked_down = be_knocked_down ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AdjustGlideKickZFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AdjustGlideKickZ_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: AdjustGlideKickZ
     /// </summary>
     public unsafe override float AdjustGlideKickZ()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.AdjustGlideKickZ", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_AdjustGlideKickZFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.AdjustGlideKickZ", true);
+        var parms = new AdjustGlideKickZ_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_KickedByBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct KickedByBatman_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 batman_origin;
     }
 
     /// <summary>
@@ -244,37 +350,62 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual void KickedByBatman(System.Numerics.Vector3 batman_origin)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.KickedByBatman", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(batman_origin, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KickedByBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.KickedByBatman", true);
+        var parms = new KickedByBatman_Params();
+        parms.batman_origin = batman_origin;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitWithGooMineEnhancedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct HitWithGooMineEnhanced_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 goo_origin;
+        [FieldOffset(12)] public int is_glass;
+    }
+
     /// <summary>
     /// Function: HitWithGooMineEnhanced
     /// </summary>
     public unsafe virtual void HitWithGooMineEnhanced(System.Numerics.Vector3 goo_origin, bool is_glass)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.HitWithGooMineEnhanced", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(goo_origin, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_glass, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitWithGooMineEnhancedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.HitWithGooMineEnhanced", true);
+        var parms = new HitWithGooMineEnhanced_Params();
+        parms.goo_origin = goo_origin;
+        parms.is_glass = is_glass ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StunPushFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct StunPush_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 goo_origin;
+        [FieldOffset(12)] public float OrientationProportion;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: StunPush
     /// </summary>
     public unsafe virtual bool StunPush(System.Numerics.Vector3 goo_origin, float OrientationProportion = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.StunPush", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(goo_origin, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OrientationProportion, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_StunPushFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.StunPush", true);
+        var parms = new StunPush_Params();
+        parms.goo_origin = goo_origin;
+        parms.OrientationProportion = OrientationProportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StunPullFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct StunPull_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 harpoon_origin;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -282,11 +413,18 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual bool StunPull(System.Numerics.Vector3 harpoon_origin)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.StunPull", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(harpoon_origin, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_StunPullFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.StunPull", true);
+        var parms = new StunPull_Params();
+        parms.harpoon_origin = harpoon_origin;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SuspendBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SuspendBehaviour_Params
+    {
+        [FieldOffset(0)] public int OnlyIfNoVisualContact;
     }
 
     /// <summary>
@@ -294,46 +432,74 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual void SuspendBehaviour(bool OnlyIfNoVisualContact = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.SuspendBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OnlyIfNoVisualContact, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SuspendBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.SuspendBehaviour", true);
+        var parms = new SuspendBehaviour_Params();
+        parms.OnlyIfNoVisualContact = OnlyIfNoVisualContact ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LineLauncherSuspendBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct LineLauncherSuspendBehaviour_Params
+    {
+        [FieldOffset(0)] public int OnlyIfNoVisualContact;
+    }
+
     /// <summary>
     /// Function: LineLauncherSuspendBehaviour
     /// </summary>
     public unsafe virtual void LineLauncherSuspendBehaviour(bool OnlyIfNoVisualContact = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.LineLauncherSuspendBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OnlyIfNoVisualContact, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LineLauncherSuspendBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.LineLauncherSuspendBehaviour", true);
+        var parms = new LineLauncherSuspendBehaviour_Params();
+        parms.OnlyIfNoVisualContact = OnlyIfNoVisualContact ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ElectrifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Electrify_Params
+    {
+    }
+
     /// <summary>
     /// Function: Electrify
     /// </summary>
     public unsafe virtual void Electrify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.Electrify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ElectrifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.Electrify", true);
+        var parms = new Electrify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanBeKnockedDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct CanBeKnockedDown_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString takedown;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanBeKnockedDown
     /// </summary>
     public unsafe virtual bool CanBeKnockedDown(BmSDK.FString takedown = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.CanBeKnockedDown", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(takedown, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_CanBeKnockedDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.CanBeKnockedDown", true);
+        var parms = new CanBeKnockedDown_Params();
+        parms.takedown = takedown;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShouldStopControllableBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldStopControllableBatarang_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -341,10 +507,16 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe override bool ShouldStopControllableBatarang()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.ShouldStopControllableBatarang", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldStopControllableBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.ShouldStopControllableBatarang", true);
+        var parms = new ShouldStopControllableBatarang_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BatmanEntersVentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BatmanEntersVent_Params
+    {
     }
 
     /// <summary>
@@ -352,56 +524,83 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe virtual void BatmanEntersVent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.BatmanEntersVent", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanEntersVentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.BatmanEntersVent", true);
+        var parms = new BatmanEntersVent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AlertToBrokenGlassSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AlertToBrokenGlassSound_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 BreakageLocation;
+    }
+
     /// <summary>
     /// Function: AlertToBrokenGlassSound
     /// </summary>
     public unsafe virtual void AlertToBrokenGlassSound(System.Numerics.Vector3 BreakageLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.AlertToBrokenGlassSound", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BreakageLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AlertToBrokenGlassSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.AlertToBrokenGlassSound", true);
+        var parms = new AlertToBrokenGlassSound_Params();
+        parms.BreakageLocation = BreakageLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerDropFromIcyLedgeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerDropFromIcyLedge_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerDropFromIcyLedge
     /// </summary>
     public unsafe virtual void TriggerDropFromIcyLedge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.TriggerDropFromIcyLedge", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerDropFromIcyLedgeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.TriggerDropFromIcyLedge", true);
+        var parms = new TriggerDropFromIcyLedge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerFailedGlideMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 116)]
+    private struct TriggerFailedGlideMove_Params
+    {
+        [FieldOffset(0)] public nint RPC;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc;
+    }
+
     /// <summary>
     /// Function: TriggerFailedGlideMove
     /// </summary>
     public unsafe virtual void TriggerFailedGlideMove(BmSDK.BmGame.RPlayerController RPC, BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.TriggerFailedGlideMove", true);
-        byte* paramsPtr = stackalloc byte[116];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Loc, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerFailedGlideMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.TriggerFailedGlideMove", true);
+        var parms = new TriggerFailedGlideMove_Params();
+        parms.RPC = RPC?.Ptr ?? 0;
+        parms.Loc = Loc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Initialise_Params
+    {
+    }
+
     /// <summary>
     /// Function: Initialise
     /// </summary>
     public unsafe virtual void Initialise()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.Initialise", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPawnVillainFreezeBase.Initialise", true);
+        var parms = new Initialise_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -410,8 +609,8 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe int iHitsLanded
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3560); }
+        get { return *(int*)(Ptr + 3560); }
+        set { *(int*)(Ptr + 3560) = value; }
     }
 
     /// <summary>
@@ -419,8 +618,8 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe bool bRepelAttackActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3564) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3564); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3564); }
+        get { return (*(int*)(Ptr + 3564) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 3564) |= 1; else *(int*)(Ptr + 3564) &= ~1; }
     }
 
     /// <summary>
@@ -428,8 +627,8 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe bool bRearRepelActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3564) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3564); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3564); }
+        get { return (*(int*)(Ptr + 3564) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 3564) |= 2; else *(int*)(Ptr + 3564) &= ~2; }
     }
 
     /// <summary>
@@ -446,8 +645,8 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe int iInitialHealth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3580); }
+        get { return *(int*)(Ptr + 3580); }
+        set { *(int*)(Ptr + 3580) = value; }
     }
 
     /// <summary>
@@ -455,8 +654,8 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe int StrikesBeforeFinal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3584); }
+        get { return *(int*)(Ptr + 3584); }
+        set { *(int*)(Ptr + 3584) = value; }
     }
 
     /// <summary>
@@ -482,7 +681,7 @@ public partial class RPawnVillainFreezeBase : BmSDK.BmGame.RPawnVillain, BmSDK.I
     /// </summary>
     public unsafe float MagneticSurfaceRecoveryTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3596); }
+        get { return *(float*)(Ptr + 3596); }
+        set { *(float*)(Ptr + 3596) = value; }
     }
 }
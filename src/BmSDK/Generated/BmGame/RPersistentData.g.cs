@@ -78,16 +78,32 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RPersistentData>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetSideStoryCharacterProgressStatusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetSideStoryCharacterProgressStatus_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EProgressCharacter Who;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSideStoryCharacterProgressStatus
     /// </summary>
     public unsafe virtual int GetSideStoryCharacterProgressStatus(BmSDK.BmGame.RPersistentData.EProgressCharacter Who)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GetSideStoryCharacterProgressStatus", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Who, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetSideStoryCharacterProgressStatusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GetSideStoryCharacterProgressStatus", true);
+        var parms = new GetSideStoryCharacterProgressStatus_Params();
+        parms.Who = Who;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetSideStoryCharacterProgressStatusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetSideStoryCharacterProgressStatus_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EProgressCharacter Who;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -95,25 +111,41 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetSideStoryCharacterProgressStatus(BmSDK.BmGame.RPersistentData.EProgressCharacter Who, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetSideStoryCharacterProgressStatus", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Who, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSideStoryCharacterProgressStatusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetSideStoryCharacterProgressStatus", true);
+        var parms = new SetSideStoryCharacterProgressStatus_Params();
+        parms.Who = Who;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncreaseCatwomanJewelleryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IncreaseCatwomanJewellery_Params
+    {
+        [FieldOffset(0)] public nint RPC;
+        [FieldOffset(4)] public int JewelleryValue;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IncreaseCatwomanJewellery
     /// </summary>
     public unsafe virtual bool IncreaseCatwomanJewellery(BmSDK.BmGame.RPlayerController RPC, int JewelleryValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncreaseCatwomanJewellery", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(JewelleryValue, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_IncreaseCatwomanJewelleryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncreaseCatwomanJewellery", true);
+        var parms = new IncreaseCatwomanJewellery_Params();
+        parms.RPC = RPC?.Ptr ?? 0;
+        parms.JewelleryValue = JewelleryValue;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FinishedCatwomanJewelleryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FinishedCatwomanJewellery_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -121,10 +153,17 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool FinishedCatwomanJewellery()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.FinishedCatwomanJewellery", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_FinishedCatwomanJewelleryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.FinishedCatwomanJewellery", true);
+        var parms = new FinishedCatwomanJewellery_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShowRaftCancelTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowRaftCancelTutorial_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -132,10 +171,16 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool ShowRaftCancelTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowRaftCancelTutorial", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShowRaftCancelTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowRaftCancelTutorial", true);
+        var parms = new ShowRaftCancelTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IncrementRaftCancelTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncrementRaftCancelTutorial_Params
+    {
     }
 
     /// <summary>
@@ -143,54 +188,85 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void IncrementRaftCancelTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementRaftCancelTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementRaftCancelTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementRaftCancelTutorial", true);
+        var parms = new IncrementRaftCancelTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartRaftCancelTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartRaftCancelTutorial_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartRaftCancelTutorial
     /// </summary>
     public unsafe virtual void StartRaftCancelTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartRaftCancelTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartRaftCancelTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartRaftCancelTutorial", true);
+        var parms = new StartRaftCancelTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartGrappleBoostTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartGrappleBoostTutorial_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartGrappleBoostTutorial
     /// </summary>
     public unsafe virtual void StartGrappleBoostTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartGrappleBoostTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartGrappleBoostTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartGrappleBoostTutorial", true);
+        var parms = new StartGrappleBoostTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncrementGrappleBoostTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncrementGrappleBoostTutorial_Params
+    {
+    }
+
     /// <summary>
     /// Function: IncrementGrappleBoostTutorial
     /// </summary>
     public unsafe virtual void IncrementGrappleBoostTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGrappleBoostTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementGrappleBoostTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGrappleBoostTutorial", true);
+        var parms = new IncrementGrappleBoostTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowGrappleBoostTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowGrappleBoostTutorial_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShowGrappleBoostTutorial
     /// </summary>
     public unsafe virtual bool ShowGrappleBoostTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowGrappleBoostTutorial", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShowGrappleBoostTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowGrappleBoostTutorial", true);
+        var parms = new ShowGrappleBoostTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StartStealthMoveTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartStealthMoveTutorial_Params
+    {
     }
 
     /// <summary>
@@ -198,33 +274,53 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void StartStealthMoveTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartStealthMoveTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartStealthMoveTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartStealthMoveTutorial", true);
+        var parms = new StartStealthMoveTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncrementStealthMoveTutorialTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IncrementStealthMoveTutorialTimer_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: IncrementStealthMoveTutorialTimer
     /// </summary>
     public unsafe virtual void IncrementStealthMoveTutorialTimer(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementStealthMoveTutorialTimer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementStealthMoveTutorialTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementStealthMoveTutorialTimer", true);
+        var parms = new IncrementStealthMoveTutorialTimer_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowStealthMoveTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowStealthMoveTutorial_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShowStealthMoveTutorial
     /// </summary>
     public unsafe virtual bool ShowStealthMoveTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowStealthMoveTutorial", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShowStealthMoveTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowStealthMoveTutorial", true);
+        var parms = new ShowStealthMoveTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StartGrapplingTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartGrapplingTutorial_Params
+    {
     }
 
     /// <summary>
@@ -232,32 +328,51 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void StartGrapplingTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartGrapplingTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartGrapplingTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartGrapplingTutorial", true);
+        var parms = new StartGrapplingTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncrementGrappleTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncrementGrappleTutorial_Params
+    {
+    }
+
     /// <summary>
     /// Function: IncrementGrappleTutorial
     /// </summary>
     public unsafe virtual void IncrementGrappleTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGrappleTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementGrappleTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGrappleTutorial", true);
+        var parms = new IncrementGrappleTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowGrappleTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowGrappleTutorial_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShowGrappleTutorial
     /// </summary>
     public unsafe virtual bool ShowGrappleTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowGrappleTutorial", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShowGrappleTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowGrappleTutorial", true);
+        var parms = new ShowGrappleTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StartGlideBoostTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartGlideBoostTutorial_Params
+    {
     }
 
     /// <summary>
@@ -265,32 +380,51 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void StartGlideBoostTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartGlideBoostTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartGlideBoostTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartGlideBoostTutorial", true);
+        var parms = new StartGlideBoostTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartGlidingTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartGlidingTutorial_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartGlidingTutorial
     /// </summary>
     public unsafe virtual void StartGlidingTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartGlidingTutorial", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartGlidingTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.StartGlidingTutorial", true);
+        var parms = new StartGlidingTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowAnyGlideTutorialsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowAnyGlideTutorials_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShowAnyGlideTutorials
     /// </summary>
     public unsafe virtual bool ShowAnyGlideTutorials()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowAnyGlideTutorials", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShowAnyGlideTutorialsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowAnyGlideTutorials", true);
+        var parms = new ShowAnyGlideTutorials_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IncrementPullUpFromDivePromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncrementPullUpFromDivePrompt_Params
+    {
     }
 
     /// <summary>
@@ -298,21 +432,34 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void IncrementPullUpFromDivePrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementPullUpFromDivePrompt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementPullUpFromDivePromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementPullUpFromDivePrompt", true);
+        var parms = new IncrementPullUpFromDivePrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowPullUpFromDivePromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowPullUpFromDivePrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShowPullUpFromDivePrompt
     /// </summary>
     public unsafe virtual bool ShowPullUpFromDivePrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowPullUpFromDivePrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShowPullUpFromDivePromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowPullUpFromDivePrompt", true);
+        var parms = new ShowPullUpFromDivePrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IncrementGlideDivePromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncrementGlideDivePrompt_Params
+    {
     }
 
     /// <summary>
@@ -320,32 +467,51 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void IncrementGlideDivePrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGlideDivePrompt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementGlideDivePromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGlideDivePrompt", true);
+        var parms = new IncrementGlideDivePrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncrementGlideSteerPromptUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncrementGlideSteerPromptUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: IncrementGlideSteerPromptUD
     /// </summary>
     public unsafe virtual void IncrementGlideSteerPromptUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGlideSteerPromptUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementGlideSteerPromptUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGlideSteerPromptUD", true);
+        var parms = new IncrementGlideSteerPromptUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowGlideSteerPromptUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowGlideSteerPromptUD_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShowGlideSteerPromptUD
     /// </summary>
     public unsafe virtual bool ShowGlideSteerPromptUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowGlideSteerPromptUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShowGlideSteerPromptUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowGlideSteerPromptUD", true);
+        var parms = new ShowGlideSteerPromptUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IncrementGlideSteerPromptLRFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncrementGlideSteerPromptLR_Params
+    {
     }
 
     /// <summary>
@@ -353,33 +519,53 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void IncrementGlideSteerPromptLR()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGlideSteerPromptLR", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementGlideSteerPromptLRFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGlideSteerPromptLR", true);
+        var parms = new IncrementGlideSteerPromptLR_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncrementGlideTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IncrementGlideTimer_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: IncrementGlideTimer
     /// </summary>
     public unsafe virtual void IncrementGlideTimer(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGlideTimer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementGlideTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncrementGlideTimer", true);
+        var parms = new IncrementGlideTimer_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowGlidePromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShowGlidePrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShowGlidePrompt
     /// </summary>
     public unsafe virtual bool ShowGlidePrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowGlidePrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShowGlidePromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShowGlidePrompt", true);
+        var parms = new ShowGlidePrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClearMapObjectivePanListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearMapObjectivePanList_Params
+    {
     }
 
     /// <summary>
@@ -387,89 +573,146 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ClearMapObjectivePanList()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ClearMapObjectivePanList", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearMapObjectivePanListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ClearMapObjectivePanList", true);
+        var parms = new ClearMapObjectivePanList_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveDynamicMapItemsByChapterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct RemoveDynamicMapItemsByChapter_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ChapterPrefix;
+    }
+
     /// <summary>
     /// Function: RemoveDynamicMapItemsByChapter
     /// </summary>
     public unsafe virtual void RemoveDynamicMapItemsByChapter(BmSDK.FString ChapterPrefix)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.RemoveDynamicMapItemsByChapter", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChapterPrefix, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveDynamicMapItemsByChapterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.RemoveDynamicMapItemsByChapter", true);
+        var parms = new RemoveDynamicMapItemsByChapter_Params();
+        parms.ChapterPrefix = ChapterPrefix;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveDynamicMapItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct RemoveDynamicMapItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: RemoveDynamicMapItem
     /// </summary>
     public unsafe virtual void RemoveDynamicMapItem(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.RemoveDynamicMapItem", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveDynamicMapItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.RemoveDynamicMapItem", true);
+        var parms = new RemoveDynamicMapItem_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddDynamicMapItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct AddDynamicMapItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+        [FieldOffset(12)] public BmSDK.FString ItemType;
+        [FieldOffset(24)] public BmSDK.FString PMap;
+        [FieldOffset(36)] public int X;
+        [FieldOffset(40)] public int Y;
+    }
+
     /// <summary>
     /// Function: AddDynamicMapItem
     /// </summary>
     public unsafe virtual void AddDynamicMapItem(BmSDK.FString ItemName, BmSDK.FString ItemType, BmSDK.FString PMap, int X, int Y)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.AddDynamicMapItem", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemType, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PMap, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddDynamicMapItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.AddDynamicMapItem", true);
+        var parms = new AddDynamicMapItem_Params();
+        parms.ItemName = ItemName;
+        parms.ItemType = ItemType;
+        parms.PMap = PMap;
+        parms.X = X;
+        parms.Y = Y;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveTrailFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct RemoveTrail_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TrailName;
+    }
+
     /// <summary>
     /// Function: RemoveTrail
     /// </summary>
     public unsafe virtual void RemoveTrail(BmSDK.FString TrailName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.RemoveTrail", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TrailName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveTrailFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.RemoveTrail", true);
+        var parms = new RemoveTrail_Params();
+        parms.TrailName = TrailName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddTrailItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct AddTrailItem_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TrailName;
+        [FieldOffset(12)] public BmSDK.FString PMap;
+        [FieldOffset(24)] public int X;
+        [FieldOffset(28)] public int Y;
+    }
+
     /// <summary>
     /// Function: AddTrailItem
     /// </summary>
     public unsafe virtual void AddTrailItem(BmSDK.FString TrailName, BmSDK.FString PMap, int X, int Y)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.AddTrailItem", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TrailName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PMap, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddTrailItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.AddTrailItem", true);
+        var parms = new AddTrailItem_Params();
+        parms.TrailName = TrailName;
+        parms.PMap = PMap;
+        parms.X = X;
+        parms.Y = Y;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemapCharacter_Progress2BioFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemapCharacter_Progress2Bio_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EProgressCharacter inProgress;
+        [FieldOffset(1)] public BmSDK.BmGame.RPersistentData.EBioCharacter ReturnValue;
+    }
+
     /// <summary>
     /// Function: RemapCharacter_Progress2Bio
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RPersistentData.EBioCharacter RemapCharacter_Progress2Bio(BmSDK.BmGame.RPersistentData.EProgressCharacter inProgress)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.RemapCharacter_Progress2Bio", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inProgress, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EBioCharacter>(paramsPtr + 1);
+        var funcManaged = s_RemapCharacter_Progress2BioFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.RemapCharacter_Progress2Bio", true);
+        var parms = new RemapCharacter_Progress2Bio_Params();
+        parms.inProgress = inProgress;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetObjectiveLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetObjectiveLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 the_location;
     }
 
     /// <summary>
@@ -477,22 +720,36 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetObjectiveLocation(System.Numerics.Vector3 the_location)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetObjectiveLocation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(the_location, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetObjectiveLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetObjectiveLocation", true);
+        var parms = new SetObjectiveLocation_Params();
+        parms.the_location = the_location;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsObjectiveTrackingActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsObjectiveTrackingActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsObjectiveTrackingActive
     /// </summary>
     public unsafe virtual bool IsObjectiveTrackingActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IsObjectiveTrackingActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsObjectiveTrackingActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IsObjectiveTrackingActive", true);
+        var parms = new IsObjectiveTrackingActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetObjectiveTrackingActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetObjectiveTrackingActive_Params
+    {
+        [FieldOffset(0)] public int is_active;
     }
 
     /// <summary>
@@ -500,23 +757,40 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetObjectiveTrackingActive(bool is_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetObjectiveTrackingActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetObjectiveTrackingActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetObjectiveTrackingActive", true);
+        var parms = new SetObjectiveTrackingActive_Params();
+        parms.is_active = is_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateRadioStationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CreateRadioStation_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString StationName;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateRadioStation
     /// </summary>
     public unsafe virtual int CreateRadioStation(BmSDK.FString StationName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.CreateRadioStation", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StationName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 12);
+        var funcManaged = s_CreateRadioStationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.CreateRadioStation", true);
+        var parms = new CreateRadioStation_Params();
+        parms.StationName = StationName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetRadioStationFlagFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetRadioStationFlag_Params
+    {
+        [FieldOffset(0)] public int station_index;
+        [FieldOffset(4)] public byte attribute_flag;
+        [FieldOffset(8)] public int value_truefalse;
     }
 
     /// <summary>
@@ -524,26 +798,43 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetRadioStationFlag(int station_index, byte attribute_flag, bool value_truefalse)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetRadioStationFlag", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(station_index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(attribute_flag, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(value_truefalse, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRadioStationFlagFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetRadioStationFlag", true);
+        var parms = new SetRadioStationFlag_Params();
+        parms.station_index = station_index;
+        parms.attribute_flag = attribute_flag;
+        parms.value_truefalse = value_truefalse ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckRadioStationFlagFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CheckRadioStationFlag_Params
+    {
+        [FieldOffset(0)] public int station_index;
+        [FieldOffset(4)] public byte attribute_flag;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckRadioStationFlag
     /// </summary>
     public unsafe virtual bool CheckRadioStationFlag(int station_index, byte attribute_flag)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.CheckRadioStationFlag", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(station_index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(attribute_flag, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_CheckRadioStationFlagFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.CheckRadioStationFlag", true);
+        var parms = new CheckRadioStationFlag_Params();
+        parms.station_index = station_index;
+        parms.attribute_flag = attribute_flag;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetRadioStationIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetRadioStationIndex_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString StationName;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -551,11 +842,19 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetRadioStationIndex(BmSDK.FString StationName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GetRadioStationIndex", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StationName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 12);
+        var funcManaged = s_GetRadioStationIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GetRadioStationIndex", true);
+        var parms = new GetRadioStationIndex_Params();
+        parms.StationName = StationName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateButtonBashDDAFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateButtonBashDDA_Params
+    {
+        [FieldOffset(0)] public float TimeAtMinSpeed;
+        [FieldOffset(4)] public float TimeAtMaxSpeed;
     }
 
     /// <summary>
@@ -563,23 +862,36 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void UpdateButtonBashDDA(out float TimeAtMinSpeed, out float TimeAtMaxSpeed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.UpdateButtonBashDDA", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        TimeAtMinSpeed = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
-        TimeAtMaxSpeed = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_UpdateButtonBashDDAFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.UpdateButtonBashDDA", true);
+        var parms = new UpdateButtonBashDDA_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        TimeAtMinSpeed = parms.TimeAtMinSpeed;
+        TimeAtMaxSpeed = parms.TimeAtMaxSpeed;
         return;
     }
 
+    static BmSDK.Function s_SixaxisTeethPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SixaxisTeethPrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SixaxisTeethPrompt
     /// </summary>
     public unsafe virtual bool SixaxisTeethPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisTeethPrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_SixaxisTeethPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisTeethPrompt", true);
+        var parms = new SixaxisTeethPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SixaxisTeethPerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SixaxisTeethPerformed_Params
+    {
     }
 
     /// <summary>
@@ -587,21 +899,34 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SixaxisTeethPerformed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisTeethPerformed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SixaxisTeethPerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisTeethPerformed", true);
+        var parms = new SixaxisTeethPerformed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SixaxisBatarangPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SixaxisBatarangPrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SixaxisBatarangPrompt
     /// </summary>
     public unsafe virtual bool SixaxisBatarangPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisBatarangPrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_SixaxisBatarangPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisBatarangPrompt", true);
+        var parms = new SixaxisBatarangPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SixaxisBatarangPerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SixaxisBatarangPerformed_Params
+    {
     }
 
     /// <summary>
@@ -609,21 +934,34 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SixaxisBatarangPerformed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisBatarangPerformed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SixaxisBatarangPerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisBatarangPerformed", true);
+        var parms = new SixaxisBatarangPerformed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SixaxisGlidePromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SixaxisGlidePrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SixaxisGlidePrompt
     /// </summary>
     public unsafe virtual bool SixaxisGlidePrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisGlidePrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_SixaxisGlidePromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisGlidePrompt", true);
+        var parms = new SixaxisGlidePrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SixaxisGlidePerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SixaxisGlidePerformed_Params
+    {
     }
 
     /// <summary>
@@ -631,21 +969,34 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SixaxisGlidePerformed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisGlidePerformed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SixaxisGlidePerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SixaxisGlidePerformed", true);
+        var parms = new SixaxisGlidePerformed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HangModeDropPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HangModeDropPrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HangModeDropPrompt
     /// </summary>
     public unsafe virtual bool HangModeDropPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.HangModeDropPrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HangModeDropPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.HangModeDropPrompt", true);
+        var parms = new HangModeDropPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HangModeDropPerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HangModeDropPerformed_Params
+    {
     }
 
     /// <summary>
@@ -653,32 +1004,51 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void HangModeDropPerformed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.HangModeDropPerformed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HangModeDropPerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.HangModeDropPerformed", true);
+        var parms = new HangModeDropPerformed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DropOffGrapplePerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DropOffGrapplePerformed_Params
+    {
+    }
+
     /// <summary>
     /// Function: DropOffGrapplePerformed
     /// </summary>
     public unsafe virtual void DropOffGrapplePerformed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.DropOffGrapplePerformed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DropOffGrapplePerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.DropOffGrapplePerformed", true);
+        var parms = new DropOffGrapplePerformed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GlideOffWallPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GlideOffWallPrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GlideOffWallPrompt
     /// </summary>
     public unsafe virtual bool GlideOffWallPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GlideOffWallPrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_GlideOffWallPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GlideOffWallPrompt", true);
+        var parms = new GlideOffWallPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GlideOffWallPerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GlideOffWallPerformed_Params
+    {
     }
 
     /// <summary>
@@ -686,21 +1056,34 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void GlideOffWallPerformed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GlideOffWallPerformed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GlideOffWallPerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GlideOffWallPerformed", true);
+        var parms = new GlideOffWallPerformed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LineLaunchDropPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct LineLaunchDropPrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: LineLaunchDropPrompt
     /// </summary>
     public unsafe virtual bool LineLaunchDropPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.LineLaunchDropPrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_LineLaunchDropPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.LineLaunchDropPrompt", true);
+        var parms = new LineLaunchDropPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_LineLaunchDropPerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LineLaunchDropPerformed_Params
+    {
     }
 
     /// <summary>
@@ -708,45 +1091,74 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void LineLaunchDropPerformed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.LineLaunchDropPerformed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LineLaunchDropPerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.LineLaunchDropPerformed", true);
+        var parms = new LineLaunchDropPerformed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearAutomaticCombatTutorialsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearAutomaticCombatTutorials_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearAutomaticCombatTutorials
     /// </summary>
     public unsafe virtual void ClearAutomaticCombatTutorials()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ClearAutomaticCombatTutorials", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearAutomaticCombatTutorialsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ClearAutomaticCombatTutorials", true);
+        var parms = new ClearAutomaticCombatTutorials_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TutorialActionAchievedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct TutorialActionAchieved_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+    }
+
     /// <summary>
     /// Function: TutorialActionAchieved
     /// </summary>
     public unsafe virtual void TutorialActionAchieved(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.TutorialActionAchieved", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TutorialActionAchievedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.TutorialActionAchieved", true);
+        var parms = new TutorialActionAchieved_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetNumActivationsForActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetNumActivationsForAction_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetNumActivationsForAction
     /// </summary>
     public unsafe virtual int GetNumActivationsForAction(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GetNumActivationsForAction", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetNumActivationsForActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GetNumActivationsForAction", true);
+        var parms = new GetNumActivationsForAction_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ShouldShowTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShouldShowTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -754,18 +1166,18 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int ShouldShowTutorial(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShouldShowTutorial", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_ShouldShowTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ShouldShowTutorial", true);
+        var parms = new ShouldShowTutorial_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ResetTutorialProgressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct ResetTutorialProgress_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
     }
 
     /// <summary>
@@ -773,71 +1185,114 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ResetTutorialProgress(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ResetTutorialProgress", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetTutorialProgressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ResetTutorialProgress", true);
+        var parms = new ResetTutorialProgress_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DesignDeactivateTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct DesignDeactivateTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+    }
+
     /// <summary>
     /// Function: DesignDeactivateTutorial
     /// </summary>
     public unsafe virtual void DesignDeactivateTutorial(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.DesignDeactivateTutorial", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DesignDeactivateTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.DesignDeactivateTutorial", true);
+        var parms = new DesignDeactivateTutorial_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DesignActivateTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct DesignActivateTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+    }
+
     /// <summary>
     /// Function: DesignActivateTutorial
     /// </summary>
     public unsafe virtual void DesignActivateTutorial(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.DesignActivateTutorial", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DesignActivateTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.DesignActivateTutorial", true);
+        var parms = new DesignActivateTutorial_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayerStopTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct PlayerStopTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+    }
+
     /// <summary>
     /// Function: PlayerStopTutorial
     /// </summary>
     public unsafe virtual void PlayerStopTutorial(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.PlayerStopTutorial", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerStopTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.PlayerStopTutorial", true);
+        var parms = new PlayerStopTutorial_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayerStartTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PlayerStartTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+    }
+
     /// <summary>
     /// Function: PlayerStartTutorial
     /// </summary>
     public unsafe virtual void PlayerStartTutorial(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.PlayerStartTutorial", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerStartTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.PlayerStartTutorial", true);
+        var parms = new PlayerStartTutorial_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsTutorialPlayerActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsTutorialPlayerActive_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsTutorialPlayerActive
     /// </summary>
     public unsafe virtual bool IsTutorialPlayerActive(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IsTutorialPlayerActive", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsTutorialPlayerActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IsTutorialPlayerActive", true);
+        var parms = new IsTutorialPlayerActive_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AutoDeactivateTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct AutoDeactivateTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
     }
 
     /// <summary>
@@ -845,36 +1300,58 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void AutoDeactivateTutorial(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.AutoDeactivateTutorial", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AutoDeactivateTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.AutoDeactivateTutorial", true);
+        var parms = new AutoDeactivateTutorial_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AutoActivateTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct AutoActivateTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType NewTut;
+    }
+
     /// <summary>
     /// Function: AutoActivateTutorial
     /// </summary>
     public unsafe virtual void AutoActivateTutorial(BmSDK.BmGame.RPersistentData.ETutorialType NewTut)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.AutoActivateTutorial", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTut, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AutoActivateTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.AutoActivateTutorial", true);
+        var parms = new AutoActivateTutorial_Params();
+        parms.NewTut = NewTut;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PadStrFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct PadStr_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString InStr;
+        [FieldOffset(12)] public int DesiredLen;
+        [FieldOffset(16)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: PadStr
     /// </summary>
     public unsafe virtual BmSDK.FString PadStr(BmSDK.FString InStr, int DesiredLen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.PadStr", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InStr, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredLen, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 16);
+        var funcManaged = s_PadStrFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.PadStr", true);
+        var parms = new PadStr_Params();
+        parms.InStr = InStr;
+        parms.DesiredLen = DesiredLen;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 17)]
+    private struct Dump_Params
+    {
     }
 
     /// <summary>
@@ -882,22 +1359,36 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void Dump()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.Dump", true);
-        byte* paramsPtr = stackalloc byte[17];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.Dump", true);
+        var parms = new Dump_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToTimeStrFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ToTimeStr_Params
+    {
+        [FieldOffset(0)] public float inTime;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: ToTimeStr
     /// </summary>
     public unsafe virtual BmSDK.FString ToTimeStr(float inTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ToTimeStr", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_ToTimeStrFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ToTimeStr", true);
+        var parms = new ToTimeStr_Params();
+        parms.inTime = inTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ClearActiveMapTrailFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearActiveMapTrail_Params
+    {
     }
 
     /// <summary>
@@ -905,22 +1396,39 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ClearActiveMapTrail()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ClearActiveMapTrail", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearActiveMapTrailFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.ClearActiveMapTrail", true);
+        var parms = new ClearActiveMapTrail_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPersistentLevelIndexByNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetPersistentLevelIndexByName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName MapName;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetPersistentLevelIndexByName
     /// </summary>
     public unsafe virtual int GetPersistentLevelIndexByName(BmSDK.FName MapName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GetPersistentLevelIndexByName", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MapName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_GetPersistentLevelIndexByNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.GetPersistentLevelIndexByName", true);
+        var parms = new GetPersistentLevelIndexByName_Params();
+        parms.MapName = MapName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreaseCharacterTapesCollectedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IncreaseCharacterTapesCollected_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETapeCharacter CharacterName;
+        [FieldOffset(1)] public BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -928,12 +1436,19 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreaseCharacterTapesCollected(BmSDK.BmGame.RPersistentData.ETapeCharacter CharacterName, BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncreaseCharacterTapesCollected", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zone, paramsPtr + 1);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_IncreaseCharacterTapesCollectedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.IncreaseCharacterTapesCollected", true);
+        var parms = new IncreaseCharacterTapesCollected_Params();
+        parms.CharacterName = CharacterName;
+        parms.Zone = Zone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetPlayableCharacterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetPlayableCharacter_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewCharacterName;
     }
 
     /// <summary>
@@ -941,17 +1456,10 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetPlayableCharacter(BmSDK.FName NewCharacterName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetPlayableCharacter", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCharacterName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetPlayableCharacterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentData.SetPlayableCharacter", true);
+        var parms = new SetPlayableCharacter_Params();
+        parms.NewCharacterName = NewCharacterName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -964,56 +1472,32 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: bPlayerActivated
         /// </summary>
-        public unsafe byte bPlayerActivated
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public byte bPlayerActivated;
 
         /// <summary>
         /// ByteProperty: bAutoActivated
         /// </summary>
-        public unsafe byte bAutoActivated
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 1); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1); }; }
-        }
+        [FieldOffset(1)] public byte bAutoActivated;
 
         /// <summary>
         /// ByteProperty: bDesignActivated
         /// </summary>
-        public unsafe byte bDesignActivated
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 2); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2); }; }
-        }
+        [FieldOffset(2)] public byte bDesignActivated;
 
         /// <summary>
         /// IntProperty: ActionsRequired
         /// </summary>
-        public unsafe int ActionsRequired
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int ActionsRequired;
 
         /// <summary>
         /// IntProperty: TotalAchieved
         /// </summary>
-        public unsafe int TotalAchieved
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int TotalAchieved;
 
         /// <summary>
         /// IntProperty: Progress
         /// </summary>
-        public unsafe int Progress
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int Progress;
     }
 
     /// <summary>
@@ -1025,47 +1509,27 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: bPlayerActivated
         /// </summary>
-        public unsafe byte bPlayerActivated
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public byte bPlayerActivated;
 
         /// <summary>
         /// ByteProperty: bAutoActivated
         /// </summary>
-        public unsafe byte bAutoActivated
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 1); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1); }; }
-        }
+        [FieldOffset(1)] public byte bAutoActivated;
 
         /// <summary>
         /// IntProperty: ActionsRequired
         /// </summary>
-        public unsafe int ActionsRequired
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int ActionsRequired;
 
         /// <summary>
         /// IntProperty: TotalAchieved
         /// </summary>
-        public unsafe int TotalAchieved
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int TotalAchieved;
 
         /// <summary>
         /// IntProperty: Progress
         /// </summary>
-        public unsafe int Progress
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int Progress;
     }
 
     /// <summary>
@@ -1107,8 +1571,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Version
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -1116,8 +1580,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int SaveCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(int*)(Ptr + 48); }
+        set { *(int*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -1143,8 +1607,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int LastDoorRotation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(int*)(Ptr + 88); }
+        set { *(int*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -1242,8 +1706,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int StoryDLCImageId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(int*)(Ptr + 212); }
+        set { *(int*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -1251,8 +1715,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int SaveGameChapter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(int*)(Ptr + 216); }
+        set { *(int*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -1260,8 +1724,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int SaveGameIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(int*)(Ptr + 220); }
+        set { *(int*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -1269,8 +1733,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte IsSaveGameStartPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(byte*)(Ptr + 224); }
+        set { *(byte*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -1278,8 +1742,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte StorySynopsisState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 225); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 225); }
+        get { return *(byte*)(Ptr + 225); }
+        set { *(byte*)(Ptr + 225) = value; }
     }
 
     /// <summary>
@@ -1287,8 +1751,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte DetectiveModeJammed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 226); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 226); }
+        get { return *(byte*)(Ptr + 226); }
+        set { *(byte*)(Ptr + 226) = value; }
     }
 
     /// <summary>
@@ -1296,8 +1760,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte ARTraining_RaceWins
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 227); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 227); }
+        get { return *(byte*)(Ptr + 227); }
+        set { *(byte*)(Ptr + 227) = value; }
     }
 
     /// <summary>
@@ -1305,8 +1769,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte BruceWayneLegChainsBroken
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(byte*)(Ptr + 228); }
+        set { *(byte*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -1314,8 +1778,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte HelpPrompt_GlideTutorialStage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 229); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 229); }
+        get { return *(byte*)(Ptr + 229); }
+        set { *(byte*)(Ptr + 229) = value; }
     }
 
     /// <summary>
@@ -1323,8 +1787,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte CurrentChapter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 230); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 230); }
+        get { return *(byte*)(Ptr + 230); }
+        set { *(byte*)(Ptr + 230) = value; }
     }
 
     /// <summary>
@@ -1332,8 +1796,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte CurrentSubChapter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 231); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 231); }
+        get { return *(byte*)(Ptr + 231); }
+        set { *(byte*)(Ptr + 231) = value; }
     }
 
     /// <summary>
@@ -1346,208 +1810,208 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte CurrentSideChapter_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(byte*)(Ptr + 232); }
+        set { *(byte*)(Ptr + 232) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 233); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 233); }
+        get { return *(byte*)(Ptr + 233); }
+        set { *(byte*)(Ptr + 233) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 234); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 234); }
+        get { return *(byte*)(Ptr + 234); }
+        set { *(byte*)(Ptr + 234) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 235); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 235); }
+        get { return *(byte*)(Ptr + 235); }
+        set { *(byte*)(Ptr + 235) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(byte*)(Ptr + 236); }
+        set { *(byte*)(Ptr + 236) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 237); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 237); }
+        get { return *(byte*)(Ptr + 237); }
+        set { *(byte*)(Ptr + 237) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 238); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 238); }
+        get { return *(byte*)(Ptr + 238); }
+        set { *(byte*)(Ptr + 238) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 239); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 239); }
+        get { return *(byte*)(Ptr + 239); }
+        set { *(byte*)(Ptr + 239) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(byte*)(Ptr + 240); }
+        set { *(byte*)(Ptr + 240) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_9
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 241); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 241); }
+        get { return *(byte*)(Ptr + 241); }
+        set { *(byte*)(Ptr + 241) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_10
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 242); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 242); }
+        get { return *(byte*)(Ptr + 242); }
+        set { *(byte*)(Ptr + 242) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_11
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 243); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 243); }
+        get { return *(byte*)(Ptr + 243); }
+        set { *(byte*)(Ptr + 243) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_12
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(byte*)(Ptr + 244); }
+        set { *(byte*)(Ptr + 244) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_13
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 245); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 245); }
+        get { return *(byte*)(Ptr + 245); }
+        set { *(byte*)(Ptr + 245) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_14
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 246); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 246); }
+        get { return *(byte*)(Ptr + 246); }
+        set { *(byte*)(Ptr + 246) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_15
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 247); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 247); }
+        get { return *(byte*)(Ptr + 247); }
+        set { *(byte*)(Ptr + 247) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_16
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(byte*)(Ptr + 248); }
+        set { *(byte*)(Ptr + 248) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_17
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 249); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 249); }
+        get { return *(byte*)(Ptr + 249); }
+        set { *(byte*)(Ptr + 249) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_18
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 250); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 250); }
+        get { return *(byte*)(Ptr + 250); }
+        set { *(byte*)(Ptr + 250) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_19
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 251); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 251); }
+        get { return *(byte*)(Ptr + 251); }
+        set { *(byte*)(Ptr + 251) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_20
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(byte*)(Ptr + 252); }
+        set { *(byte*)(Ptr + 252) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_21
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 253); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 253); }
+        get { return *(byte*)(Ptr + 253); }
+        set { *(byte*)(Ptr + 253) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_22
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 254); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 254); }
+        get { return *(byte*)(Ptr + 254); }
+        set { *(byte*)(Ptr + 254) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_23
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 255); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 255); }
+        get { return *(byte*)(Ptr + 255); }
+        set { *(byte*)(Ptr + 255) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_24
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(byte*)(Ptr + 256); }
+        set { *(byte*)(Ptr + 256) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideChapter
     /// </summary>
     public unsafe byte CurrentSideChapter_25
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 257); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 257); }
+        get { return *(byte*)(Ptr + 257); }
+        set { *(byte*)(Ptr + 257) = value; }
     }
 
     /// <summary>
@@ -1560,208 +2024,208 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte CurrentSideSubChapter_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 258); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 258); }
+        get { return *(byte*)(Ptr + 258); }
+        set { *(byte*)(Ptr + 258) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 259); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 259); }
+        get { return *(byte*)(Ptr + 259); }
+        set { *(byte*)(Ptr + 259) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(byte*)(Ptr + 260); }
+        set { *(byte*)(Ptr + 260) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 261); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 261); }
+        get { return *(byte*)(Ptr + 261); }
+        set { *(byte*)(Ptr + 261) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 262); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 262); }
+        get { return *(byte*)(Ptr + 262); }
+        set { *(byte*)(Ptr + 262) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 263); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 263); }
+        get { return *(byte*)(Ptr + 263); }
+        set { *(byte*)(Ptr + 263) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(byte*)(Ptr + 264); }
+        set { *(byte*)(Ptr + 264) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 265); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 265); }
+        get { return *(byte*)(Ptr + 265); }
+        set { *(byte*)(Ptr + 265) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 266); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 266); }
+        get { return *(byte*)(Ptr + 266); }
+        set { *(byte*)(Ptr + 266) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_9
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 267); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 267); }
+        get { return *(byte*)(Ptr + 267); }
+        set { *(byte*)(Ptr + 267) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_10
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(byte*)(Ptr + 268); }
+        set { *(byte*)(Ptr + 268) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_11
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 269); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 269); }
+        get { return *(byte*)(Ptr + 269); }
+        set { *(byte*)(Ptr + 269) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_12
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 270); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 270); }
+        get { return *(byte*)(Ptr + 270); }
+        set { *(byte*)(Ptr + 270) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_13
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 271); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 271); }
+        get { return *(byte*)(Ptr + 271); }
+        set { *(byte*)(Ptr + 271) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_14
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(byte*)(Ptr + 272); }
+        set { *(byte*)(Ptr + 272) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_15
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 273); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 273); }
+        get { return *(byte*)(Ptr + 273); }
+        set { *(byte*)(Ptr + 273) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_16
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 274); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 274); }
+        get { return *(byte*)(Ptr + 274); }
+        set { *(byte*)(Ptr + 274) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_17
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 275); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 275); }
+        get { return *(byte*)(Ptr + 275); }
+        set { *(byte*)(Ptr + 275) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_18
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(byte*)(Ptr + 276); }
+        set { *(byte*)(Ptr + 276) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_19
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 277); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 277); }
+        get { return *(byte*)(Ptr + 277); }
+        set { *(byte*)(Ptr + 277) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_20
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 278); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 278); }
+        get { return *(byte*)(Ptr + 278); }
+        set { *(byte*)(Ptr + 278) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_21
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 279); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 279); }
+        get { return *(byte*)(Ptr + 279); }
+        set { *(byte*)(Ptr + 279) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_22
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 280); }
+        get { return *(byte*)(Ptr + 280); }
+        set { *(byte*)(Ptr + 280) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_23
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 281); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 281); }
+        get { return *(byte*)(Ptr + 281); }
+        set { *(byte*)(Ptr + 281) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_24
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 282); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 282); }
+        get { return *(byte*)(Ptr + 282); }
+        set { *(byte*)(Ptr + 282) = value; }
     }
     /// <summary>
     /// ByteProperty: CurrentSideSubChapter
     /// </summary>
     public unsafe byte CurrentSideSubChapter_25
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 283); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 283); }
+        get { return *(byte*)(Ptr + 283); }
+        set { *(byte*)(Ptr + 283) = value; }
     }
 
     /// <summary>
@@ -1769,8 +2233,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter ProgressLastStatusUpdated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 284); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 284) = value; }
     }
 
     /// <summary>
@@ -1778,8 +2242,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter Map_CriminalDBIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 285); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 285); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 285); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 285) = value; }
     }
 
     /// <summary>
@@ -1787,8 +2251,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Bio_LocIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 286); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 286); }
+        get { return *(byte*)(Ptr + 286); }
+        set { *(byte*)(Ptr + 286) = value; }
     }
 
     /// <summary>
@@ -1796,8 +2260,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Bio_PageIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 287); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 287); }
+        get { return *(byte*)(Ptr + 287); }
+        set { *(byte*)(Ptr + 287) = value; }
     }
 
     /// <summary>
@@ -1805,8 +2269,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Bio_TapeIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(byte*)(Ptr + 288); }
+        set { *(byte*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -1814,8 +2278,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter Progress_Index
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 289); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 289); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 289); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 289) = value; }
     }
 
     /// <summary>
@@ -1823,8 +2287,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Upgrade_CategoryIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 290); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 290); }
+        get { return *(byte*)(Ptr + 290); }
+        set { *(byte*)(Ptr + 290) = value; }
     }
 
     /// <summary>
@@ -1832,8 +2296,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Upgrade_ItemIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 291); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 291); }
+        get { return *(byte*)(Ptr + 291); }
+        set { *(byte*)(Ptr + 291) = value; }
     }
 
     /// <summary>
@@ -1841,8 +2305,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Riddler_LocIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }
+        get { return *(byte*)(Ptr + 292); }
+        set { *(byte*)(Ptr + 292) = value; }
     }
 
     /// <summary>
@@ -1850,8 +2314,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Riddler_IndexX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 293); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 293); }
+        get { return *(byte*)(Ptr + 293); }
+        set { *(byte*)(Ptr + 293) = value; }
     }
 
     /// <summary>
@@ -1859,8 +2323,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Riddler_IndexY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 294); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 294); }
+        get { return *(byte*)(Ptr + 294); }
+        set { *(byte*)(Ptr + 294) = value; }
     }
 
     /// <summary>
@@ -1868,8 +2332,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Enygma_IndexLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 295); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 295); }
+        get { return *(byte*)(Ptr + 295); }
+        set { *(byte*)(Ptr + 295) = value; }
     }
 
     /// <summary>
@@ -1877,8 +2341,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Enygma_IndexRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(byte*)(Ptr + 296); }
+        set { *(byte*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -1886,8 +2350,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte ChallengeUnlockIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 297); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 297); }
+        get { return *(byte*)(Ptr + 297); }
+        set { *(byte*)(Ptr + 297) = value; }
     }
 
     /// <summary>
@@ -1895,8 +2359,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bObjectiveTrackerActive
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 298); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 298); }
+        get { return *(byte*)(Ptr + 298); }
+        set { *(byte*)(Ptr + 298) = value; }
     }
 
     /// <summary>
@@ -1904,8 +2368,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.ECustomWayPointType CustomWaypoint_Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.ECustomWayPointType>(Ptr + 299); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 299); }
+        get { return *(BmSDK.BmGame.RPersistentData.ECustomWayPointType*)(Ptr + 299); }
+        set { *(BmSDK.BmGame.RPersistentData.ECustomWayPointType*)(Ptr + 299) = value; }
     }
 
     /// <summary>
@@ -1913,8 +2377,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter CustomWaypoint_Character
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 300); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -1922,8 +2386,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte CustomWaypoint_NotReached
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 301); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 301); }
+        get { return *(byte*)(Ptr + 301); }
+        set { *(byte*)(Ptr + 301) = value; }
     }
 
     /// <summary>
@@ -1931,8 +2395,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte PoisonLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 302); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 302); }
+        get { return *(byte*)(Ptr + 302); }
+        set { *(byte*)(Ptr + 302) = value; }
     }
 
     /// <summary>
@@ -1940,8 +2404,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte CheckForRiddlerUnlocks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 303); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 303); }
+        get { return *(byte*)(Ptr + 303); }
+        set { *(byte*)(Ptr + 303) = value; }
     }
 
     /// <summary>
@@ -1949,8 +2413,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Zsasz_DoneRace0Taunt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(byte*)(Ptr + 304); }
+        set { *(byte*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -1958,8 +2422,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Zsasz_NewRingingPhone
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 305); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 305); }
+        get { return *(byte*)(Ptr + 305); }
+        set { *(byte*)(Ptr + 305) = value; }
     }
 
     /// <summary>
@@ -1967,8 +2431,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte Zsasz_DoneRace1Intro
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 306); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 306); }
+        get { return *(byte*)(Ptr + 306); }
+        set { *(byte*)(Ptr + 306) = value; }
     }
 
     /// <summary>
@@ -1976,8 +2440,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte ExplainedBatarangRules
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 307); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 307); }
+        get { return *(byte*)(Ptr + 307); }
+        set { *(byte*)(Ptr + 307) = value; }
     }
 
     /// <summary>
@@ -1985,8 +2449,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bPlayedFreezeBlastHint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(byte*)(Ptr + 308); }
+        set { *(byte*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -1994,8 +2458,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte GrundyQuickGelHappened
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 309); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 309); }
+        get { return *(byte*)(Ptr + 309); }
+        set { *(byte*)(Ptr + 309) = value; }
     }
 
     /// <summary>
@@ -2003,8 +2467,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte GrundyQuickDetonateHappened
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 310); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 310); }
+        get { return *(byte*)(Ptr + 310); }
+        set { *(byte*)(Ptr + 310) = value; }
     }
 
     /// <summary>
@@ -2012,8 +2476,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bFakeZsaszPhoneForMap
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 311); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 311); }
+        get { return *(byte*)(Ptr + 311); }
+        set { *(byte*)(Ptr + 311) = value; }
     }
 
     /// <summary>
@@ -2075,8 +2539,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ShowRiddlerFlag
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }
+        get { return *(int*)(Ptr + 384); }
+        set { *(int*)(Ptr + 384) = value; }
     }
 
     /// <summary>
@@ -2084,8 +2548,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ShowBioFlag
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(int*)(Ptr + 388); }
+        set { *(int*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -2093,8 +2557,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName CurrentGadgetName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(BmSDK.FName*)(Ptr + 392); }
+        set { *(BmSDK.FName*)(Ptr + 392) = value; }
     }
 
     /// <summary>
@@ -2135,8 +2599,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int PlayerHealth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(int*)(Ptr + 448); }
+        set { *(int*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -2144,8 +2608,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int BallisticArmour
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(int*)(Ptr + 452); }
+        set { *(int*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -2153,8 +2617,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int MeleeArmour
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(int*)(Ptr + 456); }
+        set { *(int*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -2162,8 +2626,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CWBallisticArmour
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(int*)(Ptr + 460); }
+        set { *(int*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -2171,8 +2635,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CWMeleeArmour
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(int*)(Ptr + 464); }
+        set { *(int*)(Ptr + 464) = value; }
     }
 
     /// <summary>
@@ -2180,8 +2644,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ButtonBashDDA
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(float*)(Ptr + 468); }
+        set { *(float*)(Ptr + 468) = value; }
     }
 
     /// <summary>
@@ -2189,8 +2653,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_Strike
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(int*)(Ptr + 472); }
+        set { *(int*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -2198,8 +2662,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_Counter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(int*)(Ptr + 476); }
+        set { *(int*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -2207,8 +2671,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_Throw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(int*)(Ptr + 480); }
+        set { *(int*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -2216,8 +2680,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_Takedown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(int*)(Ptr + 484); }
+        set { *(int*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -2225,8 +2689,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_GroundTakedown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(int*)(Ptr + 488); }
+        set { *(int*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -2234,8 +2698,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_LunaticGroundTakedown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(int*)(Ptr + 492); }
+        set { *(int*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -2243,8 +2707,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_PredatorGroundTakedown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(int*)(Ptr + 496); }
+        set { *(int*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -2252,8 +2716,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_ComboBatarang
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(int*)(Ptr + 500); }
+        set { *(int*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -2261,8 +2725,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_LineLauncherDrop
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }
+        get { return *(int*)(Ptr + 504); }
+        set { *(int*)(Ptr + 504) = value; }
     }
 
     /// <summary>
@@ -2270,8 +2734,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_HangModeDrop
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 508); }
+        get { return *(int*)(Ptr + 508); }
+        set { *(int*)(Ptr + 508) = value; }
     }
 
     /// <summary>
@@ -2279,8 +2743,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_DropOffGrapple
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(int*)(Ptr + 512); }
+        set { *(int*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -2288,8 +2752,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_GlideOffWall
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(int*)(Ptr + 516); }
+        set { *(int*)(Ptr + 516) = value; }
     }
 
     /// <summary>
@@ -2297,8 +2761,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_SixaxisGlide
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 520); }
+        get { return *(int*)(Ptr + 520); }
+        set { *(int*)(Ptr + 520) = value; }
     }
 
     /// <summary>
@@ -2306,8 +2770,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_SixaxisBatarang
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(int*)(Ptr + 524); }
+        set { *(int*)(Ptr + 524) = value; }
     }
 
     /// <summary>
@@ -2315,8 +2779,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_SixaxisTeeth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 528); }
+        get { return *(int*)(Ptr + 528); }
+        set { *(int*)(Ptr + 528) = value; }
     }
 
     /// <summary>
@@ -2324,8 +2788,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float HelpPrompt_TimeGliding
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(float*)(Ptr + 532); }
+        set { *(float*)(Ptr + 532) = value; }
     }
 
     /// <summary>
@@ -2333,8 +2797,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_GlideSteerLR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }
+        get { return *(int*)(Ptr + 536); }
+        set { *(int*)(Ptr + 536) = value; }
     }
 
     /// <summary>
@@ -2342,8 +2806,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_GlideSteerUD
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(int*)(Ptr + 540); }
+        set { *(int*)(Ptr + 540) = value; }
     }
 
     /// <summary>
@@ -2351,8 +2815,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_PullUpFromDive
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 544); }
+        get { return *(int*)(Ptr + 544); }
+        set { *(int*)(Ptr + 544) = value; }
     }
 
     /// <summary>
@@ -2360,8 +2824,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_Dive
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(int*)(Ptr + 548); }
+        set { *(int*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -2369,8 +2833,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_GrappleInOW
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(int*)(Ptr + 552); }
+        set { *(int*)(Ptr + 552) = value; }
     }
 
     /// <summary>
@@ -2378,8 +2842,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_SlideUnderBarrier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(int*)(Ptr + 556); }
+        set { *(int*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -2387,8 +2851,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_GrappleBoost
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 560); }
+        get { return *(int*)(Ptr + 560); }
+        set { *(int*)(Ptr + 560) = value; }
     }
 
     /// <summary>
@@ -2396,8 +2860,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int HelpPromptCount_RaftCancel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(int*)(Ptr + 564); }
+        set { *(int*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -2405,8 +2869,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float HelpPromptTimer_SteathMove
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 568); }
+        get { return *(float*)(Ptr + 568); }
+        set { *(float*)(Ptr + 568) = value; }
     }
 
     /// <summary>
@@ -2414,8 +2878,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumTimesEscapeHelpDisplayed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 572); }
+        get { return *(int*)(Ptr + 572); }
+        set { *(int*)(Ptr + 572) = value; }
     }
 
     /// <summary>
@@ -2423,8 +2887,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumTimesGrateHelpDisplayed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 576); }
+        get { return *(int*)(Ptr + 576); }
+        set { *(int*)(Ptr + 576) = value; }
     }
 
     /// <summary>
@@ -2432,8 +2896,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumTimesGroundTakedownHelpDisplayed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 580); }
+        get { return *(int*)(Ptr + 580); }
+        set { *(int*)(Ptr + 580) = value; }
     }
 
     /// <summary>
@@ -2441,8 +2905,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float TotalTimePlayed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 584); }
+        get { return *(float*)(Ptr + 584); }
+        set { *(float*)(Ptr + 584) = value; }
     }
 
     /// <summary>
@@ -2450,8 +2914,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int StoryPercentage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 588); }
+        get { return *(int*)(Ptr + 588); }
+        set { *(int*)(Ptr + 588) = value; }
     }
 
     /// <summary>
@@ -2459,8 +2923,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int UpgradesIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 592); }
+        get { return *(int*)(Ptr + 592); }
+        set { *(int*)(Ptr + 592) = value; }
     }
 
     /// <summary>
@@ -2495,8 +2959,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int RadioStationIndexMostRecentlyFound
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 632); }
+        get { return *(int*)(Ptr + 632); }
+        set { *(int*)(Ptr + 632) = value; }
     }
 
     /// <summary>
@@ -2702,8 +3166,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Enygma_CooldownTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 900); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 900); }
+        get { return *(float*)(Ptr + 900); }
+        set { *(float*)(Ptr + 900) = value; }
     }
 
     /// <summary>
@@ -2780,8 +3244,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float FacePoisonLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1000); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1000); }
+        get { return *(float*)(Ptr + 1000); }
+        set { *(float*)(Ptr + 1000) = value; }
     }
 
     /// <summary>
@@ -2789,8 +3253,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName PlayableCharacter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 1004); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1004); }
+        get { return *(BmSDK.FName*)(Ptr + 1004); }
+        set { *(BmSDK.FName*)(Ptr + 1004) = value; }
     }
 
     /// <summary>
@@ -2798,8 +3262,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Zsasz_RingingPhoneIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1012); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1012); }
+        get { return *(int*)(Ptr + 1012); }
+        set { *(int*)(Ptr + 1012) = value; }
     }
 
     /// <summary>
@@ -2807,8 +3271,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Zsasz_NumRacesUnlocked
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1016); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1016); }
+        get { return *(int*)(Ptr + 1016); }
+        set { *(int*)(Ptr + 1016) = value; }
     }
 
     /// <summary>
@@ -2978,8 +3442,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int RiddlerResonatorAfterCh3Count
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1236); }
+        get { return *(int*)(Ptr + 1236); }
+        set { *(int*)(Ptr + 1236) = value; }
     }
 
     /// <summary>
@@ -2987,8 +3451,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int RiddlerResonatorBeforeCh3Count
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1240); }
+        get { return *(int*)(Ptr + 1240); }
+        set { *(int*)(Ptr + 1240) = value; }
     }
 
     /// <summary>
@@ -2996,8 +3460,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumVanillaGlidesAfterDiveTutorial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1244); }
+        get { return *(int*)(Ptr + 1244); }
+        set { *(int*)(Ptr + 1244) = value; }
     }
 
     /// <summary>
@@ -3005,8 +3469,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int FakeZsaszPhoneForMapIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1248); }
+        get { return *(int*)(Ptr + 1248); }
+        set { *(int*)(Ptr + 1248) = value; }
     }
 
     /// <summary>
@@ -3014,8 +3478,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumJewelleryFound
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1252); }
+        get { return *(int*)(Ptr + 1252); }
+        set { *(int*)(Ptr + 1252) = value; }
     }
 
     /// <summary>
@@ -3050,8 +3514,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumKnockoutSmashInstructions
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1292); }
+        get { return *(int*)(Ptr + 1292); }
+        set { *(int*)(Ptr + 1292) = value; }
     }
 
     /// <summary>
@@ -3059,8 +3523,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumGrappleBoostFailHints
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1296); }
+        get { return *(int*)(Ptr + 1296); }
+        set { *(int*)(Ptr + 1296) = value; }
     }
 
     /// <summary>
@@ -3122,8 +3586,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ForensicsFilterTally
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1372); }
+        get { return *(int*)(Ptr + 1372); }
+        set { *(int*)(Ptr + 1372) = value; }
     }
 
     /// <summary>
@@ -3131,8 +3595,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int lastChapterSeenByInformantManager
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1376); }
+        get { return *(int*)(Ptr + 1376); }
+        set { *(int*)(Ptr + 1376) = value; }
     }
 
     /// <summary>
@@ -3140,8 +3604,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int numMaggotsBataranged
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1380); }
+        get { return *(int*)(Ptr + 1380); }
+        set { *(int*)(Ptr + 1380) = value; }
     }
 
     /// <summary>
@@ -3149,8 +3613,8 @@ public partial class RPersistentData : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CWEpisodeReplayState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1384); }
+        get { return *(int*)(Ptr + 1384); }
+        set { *(int*)(Ptr + 1384) = value; }
     }
 
     /// <summary>
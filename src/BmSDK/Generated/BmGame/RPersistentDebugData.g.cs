@@ -84,634 +84,635 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     [StructLayout(LayoutKind.Explicit, Size = 36)]
     public partial record struct FPerCharacterTypeAnimDebug
     {
+        [FieldOffset(0)] private int _bitfield0;
+        [FieldOffset(4)] private int _bitfield4;
+        [FieldOffset(8)] private int _bitfield8;
+        [FieldOffset(32)] private int _bitfield32;
+
         /// <summary>
         /// BoolProperty: Enabled
         /// </summary>
-        public unsafe bool Enabled
+        public bool Enabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Poses
         /// </summary>
-        public unsafe bool Poses
+        public bool Poses
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: Poses_Detailed
         /// </summary>
-        public unsafe bool Poses_Detailed
+        public bool Poses_Detailed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4) != 0;
+            set { if (value) _bitfield0 |= 4; else _bitfield0 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: Poses_DirectionalWeights
         /// </summary>
-        public unsafe bool Poses_DirectionalWeights
+        public bool Poses_DirectionalWeights
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8) != 0;
+            set { if (value) _bitfield0 |= 8; else _bitfield0 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: Poses_AimAt
         /// </summary>
-        public unsafe bool Poses_AimAt
+        public bool Poses_AimAt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16) != 0;
+            set { if (value) _bitfield0 |= 16; else _bitfield0 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: PoseLog
         /// </summary>
-        public unsafe bool PoseLog
+        public bool PoseLog
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 32) != 0;
+            set { if (value) _bitfield0 |= 32; else _bitfield0 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: PoseLog_Detailed
         /// </summary>
-        public unsafe bool PoseLog_Detailed
+        public bool PoseLog_Detailed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 64) != 0;
+            set { if (value) _bitfield0 |= 64; else _bitfield0 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: ActorLocation
         /// </summary>
-        public unsafe bool ActorLocation
+        public bool ActorLocation
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 128) != 0;
+            set { if (value) _bitfield0 |= 128; else _bitfield0 &= ~128; }
         }
 
         /// <summary>
         /// BoolProperty: TargetLines
         /// </summary>
-        public unsafe bool TargetLines
+        public bool TargetLines
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 256) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 256) != 0;
+            set { if (value) _bitfield0 |= 256; else _bitfield0 &= ~256; }
         }
 
         /// <summary>
         /// BoolProperty: RelativeTransitions
         /// </summary>
-        public unsafe bool RelativeTransitions
+        public bool RelativeTransitions
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 512) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 512) != 0;
+            set { if (value) _bitfield0 |= 512; else _bitfield0 &= ~512; }
         }
 
         /// <summary>
         /// BoolProperty: Notifies
         /// </summary>
-        public unsafe bool Notifies
+        public bool Notifies
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1024) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1024) != 0;
+            set { if (value) _bitfield0 |= 1024; else _bitfield0 &= ~1024; }
         }
 
         /// <summary>
         /// BoolProperty: Notifies_Log
         /// </summary>
-        public unsafe bool Notifies_Log
+        public bool Notifies_Log
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2048) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2048) != 0;
+            set { if (value) _bitfield0 |= 2048; else _bitfield0 &= ~2048; }
         }
 
         /// <summary>
         /// BoolProperty: Notifies_Anim
         /// </summary>
-        public unsafe bool Notifies_Anim
+        public bool Notifies_Anim
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4096) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4096) != 0;
+            set { if (value) _bitfield0 |= 4096; else _bitfield0 &= ~4096; }
         }
 
         /// <summary>
         /// BoolProperty: Notifies_SoundFilter
         /// </summary>
-        public unsafe bool Notifies_SoundFilter
+        public bool Notifies_SoundFilter
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8192) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8192) != 0;
+            set { if (value) _bitfield0 |= 8192; else _bitfield0 &= ~8192; }
         }
 
         /// <summary>
         /// BoolProperty: Collision
         /// </summary>
-        public unsafe bool Collision
+        public bool Collision
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16384) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16384) != 0;
+            set { if (value) _bitfield0 |= 16384; else _bitfield0 &= ~16384; }
         }
 
         /// <summary>
         /// BoolProperty: Ragdoll
         /// </summary>
-        public unsafe bool Ragdoll
+        public bool Ragdoll
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 32768) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 32768) != 0;
+            set { if (value) _bitfield0 |= 32768; else _bitfield0 &= ~32768; }
         }
 
         /// <summary>
         /// BoolProperty: Ragdoll_Details
         /// </summary>
-        public unsafe bool Ragdoll_Details
+        public bool Ragdoll_Details
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 65536) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 65536) != 0;
+            set { if (value) _bitfield0 |= 65536; else _bitfield0 &= ~65536; }
         }
 
         /// <summary>
         /// BoolProperty: Ragdoll_ForceAlwaysActive
         /// </summary>
-        public unsafe bool Ragdoll_ForceAlwaysActive
+        public bool Ragdoll_ForceAlwaysActive
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 131072) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 131072) != 0;
+            set { if (value) _bitfield0 |= 131072; else _bitfield0 &= ~131072; }
         }
 
         /// <summary>
         /// BoolProperty: Ragdoll_PhysDetails
         /// </summary>
-        public unsafe bool Ragdoll_PhysDetails
+        public bool Ragdoll_PhysDetails
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 262144) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 262144) != 0;
+            set { if (value) _bitfield0 |= 262144; else _bitfield0 &= ~262144; }
         }
 
         /// <summary>
         /// BoolProperty: MoveTo
         /// </summary>
-        public unsafe bool MoveTo
+        public bool MoveTo
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 524288) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 524288) != 0;
+            set { if (value) _bitfield0 |= 524288; else _bitfield0 &= ~524288; }
         }
 
         /// <summary>
         /// BoolProperty: MoveTo_Anims
         /// </summary>
-        public unsafe bool MoveTo_Anims
+        public bool MoveTo_Anims
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1048576) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1048576) != 0;
+            set { if (value) _bitfield0 |= 1048576; else _bitfield0 &= ~1048576; }
         }
 
         /// <summary>
         /// BoolProperty: MoveTo_Detailed
         /// </summary>
-        public unsafe bool MoveTo_Detailed
+        public bool MoveTo_Detailed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2097152) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2097152) != 0;
+            set { if (value) _bitfield0 |= 2097152; else _bitfield0 &= ~2097152; }
         }
 
         /// <summary>
         /// BoolProperty: FaceAt
         /// </summary>
-        public unsafe bool FaceAt
+        public bool FaceAt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4194304) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4194304) != 0;
+            set { if (value) _bitfield0 |= 4194304; else _bitfield0 &= ~4194304; }
         }
 
         /// <summary>
         /// BoolProperty: AimAt
         /// </summary>
-        public unsafe bool AimAt
+        public bool AimAt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8388608) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8388608) != 0;
+            set { if (value) _bitfield0 |= 8388608; else _bitfield0 &= ~8388608; }
         }
 
         /// <summary>
         /// BoolProperty: LookAt
         /// </summary>
-        public unsafe bool LookAt
+        public bool LookAt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16777216) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16777216) != 0;
+            set { if (value) _bitfield0 |= 16777216; else _bitfield0 &= ~16777216; }
         }
 
         /// <summary>
         /// BoolProperty: ProceduralAiming
         /// </summary>
-        public unsafe bool ProceduralAiming
+        public bool ProceduralAiming
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 33554432) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 33554432) != 0;
+            set { if (value) _bitfield0 |= 33554432; else _bitfield0 &= ~33554432; }
         }
 
         /// <summary>
         /// BoolProperty: ProceduralAiming_ForceOff
         /// </summary>
-        public unsafe bool ProceduralAiming_ForceOff
+        public bool ProceduralAiming_ForceOff
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 67108864) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 67108864) != 0;
+            set { if (value) _bitfield0 |= 67108864; else _bitfield0 &= ~67108864; }
         }
 
         /// <summary>
         /// BoolProperty: ProceduralAiming_Details
         /// </summary>
-        public unsafe bool ProceduralAiming_Details
+        public bool ProceduralAiming_Details
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 134217728) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 134217728) != 0;
+            set { if (value) _bitfield0 |= 134217728; else _bitfield0 &= ~134217728; }
         }
 
         /// <summary>
         /// BoolProperty: Trails
         /// </summary>
-        public unsafe bool Trails
+        public bool Trails
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 268435456) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 268435456) != 0;
+            set { if (value) _bitfield0 |= 268435456; else _bitfield0 &= ~268435456; }
         }
 
         /// <summary>
         /// BoolProperty: Trails_MovementType
         /// </summary>
-        public unsafe bool Trails_MovementType
+        public bool Trails_MovementType
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 536870912) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 536870912) != 0;
+            set { if (value) _bitfield0 |= 536870912; else _bitfield0 &= ~536870912; }
         }
 
         /// <summary>
         /// BoolProperty: Trails_PhysicsType
         /// </summary>
-        public unsafe bool Trails_PhysicsType
+        public bool Trails_PhysicsType
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1073741824) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1073741824) != 0;
+            set { if (value) _bitfield0 |= 1073741824; else _bitfield0 &= ~1073741824; }
         }
 
         /// <summary>
         /// BoolProperty: Trails_Crumbs
         /// </summary>
-        public unsafe bool Trails_Crumbs
+        public bool Trails_Crumbs
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & -2147483648) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & -2147483648) != 0;
+            set { if (value) _bitfield0 |= -2147483648; else _bitfield0 &= ~-2147483648; }
         }
 
         /// <summary>
         /// BoolProperty: Trails_VelocityRainbow
         /// </summary>
-        public unsafe bool Trails_VelocityRainbow
+        public bool Trails_VelocityRainbow
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1) != 0;
+            set { if (value) _bitfield4 |= 1; else _bitfield4 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: AnimNames
         /// </summary>
-        public unsafe bool AnimNames
+        public bool AnimNames
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 2) != 0;
+            set { if (value) _bitfield4 |= 2; else _bitfield4 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: MeshNames
         /// </summary>
-        public unsafe bool MeshNames
+        public bool MeshNames
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 4) != 0;
+            set { if (value) _bitfield4 |= 4; else _bitfield4 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: MeshLOD
         /// </summary>
-        public unsafe bool MeshLOD
+        public bool MeshLOD
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 8) != 0;
+            set { if (value) _bitfield4 |= 8; else _bitfield4 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: MeshLOD_Detailed
         /// </summary>
-        public unsafe bool MeshLOD_Detailed
+        public bool MeshLOD_Detailed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 16) != 0;
+            set { if (value) _bitfield4 |= 16; else _bitfield4 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: BlendedAnimDetails
         /// </summary>
-        public unsafe bool BlendedAnimDetails
+        public bool BlendedAnimDetails
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 32) != 0;
+            set { if (value) _bitfield4 |= 32; else _bitfield4 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: AdditiveAnimDetails
         /// </summary>
-        public unsafe bool AdditiveAnimDetails
+        public bool AdditiveAnimDetails
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 64) != 0;
+            set { if (value) _bitfield4 |= 64; else _bitfield4 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: FaceFX
         /// </summary>
-        public unsafe bool FaceFX
+        public bool FaceFX
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 128) != 0;
+            set { if (value) _bitfield4 |= 128; else _bitfield4 &= ~128; }
         }
 
         /// <summary>
         /// BoolProperty: FaceFX_Asset
         /// </summary>
-        public unsafe bool FaceFX_Asset
+        public bool FaceFX_Asset
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 256) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 256) != 0;
+            set { if (value) _bitfield4 |= 256; else _bitfield4 &= ~256; }
         }
 
         /// <summary>
         /// BoolProperty: FaceFX_Anims
         /// </summary>
-        public unsafe bool FaceFX_Anims
+        public bool FaceFX_Anims
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 512) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 512) != 0;
+            set { if (value) _bitfield4 |= 512; else _bitfield4 &= ~512; }
         }
 
         /// <summary>
         /// BoolProperty: FaceFX_Registers
         /// </summary>
-        public unsafe bool FaceFX_Registers
+        public bool FaceFX_Registers
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1024) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1024) != 0;
+            set { if (value) _bitfield4 |= 1024; else _bitfield4 &= ~1024; }
         }
 
         /// <summary>
         /// BoolProperty: FaceFX_Lod
         /// </summary>
-        public unsafe bool FaceFX_Lod
+        public bool FaceFX_Lod
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 2048) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 2048) != 0;
+            set { if (value) _bitfield4 |= 2048; else _bitfield4 &= ~2048; }
         }
 
         /// <summary>
         /// BoolProperty: FaceFX_Blinking
         /// </summary>
-        public unsafe bool FaceFX_Blinking
+        public bool FaceFX_Blinking
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 4096) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 4096) != 0;
+            set { if (value) _bitfield4 |= 4096; else _bitfield4 &= ~4096; }
         }
 
         /// <summary>
         /// BoolProperty: Overlays
         /// </summary>
-        public unsafe bool Overlays
+        public bool Overlays
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 8192) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 8192) != 0;
+            set { if (value) _bitfield4 |= 8192; else _bitfield4 &= ~8192; }
         }
 
         /// <summary>
         /// BoolProperty: RandomIdleOverlays
         /// </summary>
-        public unsafe bool RandomIdleOverlays
+        public bool RandomIdleOverlays
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 16384) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 16384) != 0;
+            set { if (value) _bitfield4 |= 16384; else _bitfield4 &= ~16384; }
         }
 
         /// <summary>
         /// BoolProperty: Scale
         /// </summary>
-        public unsafe bool Scale
+        public bool Scale
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 32768) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 32768) != 0;
+            set { if (value) _bitfield4 |= 32768; else _bitfield4 &= ~32768; }
         }
 
         /// <summary>
         /// BoolProperty: Skeletons
         /// </summary>
-        public unsafe bool Skeletons
+        public bool Skeletons
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 65536) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 65536) != 0;
+            set { if (value) _bitfield4 |= 65536; else _bitfield4 &= ~65536; }
         }
 
         /// <summary>
         /// BoolProperty: Skeletons_1_AfterBlend
         /// </summary>
-        public unsafe bool Skeletons_1_AfterBlend
+        public bool Skeletons_1_AfterBlend
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 131072) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 131072) != 0;
+            set { if (value) _bitfield4 |= 131072; else _bitfield4 &= ~131072; }
         }
 
         /// <summary>
         /// BoolProperty: Skeletons_2_AfterAiming
         /// </summary>
-        public unsafe bool Skeletons_2_AfterAiming
+        public bool Skeletons_2_AfterAiming
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 262144) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 262144) != 0;
+            set { if (value) _bitfield4 |= 262144; else _bitfield4 &= ~262144; }
         }
 
         /// <summary>
         /// BoolProperty: Skeletons_3_AfterAdditive
         /// </summary>
-        public unsafe bool Skeletons_3_AfterAdditive
+        public bool Skeletons_3_AfterAdditive
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 524288) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 524288) != 0;
+            set { if (value) _bitfield4 |= 524288; else _bitfield4 &= ~524288; }
         }
 
         /// <summary>
         /// BoolProperty: Skeletons_4_AfterFixup
         /// </summary>
-        public unsafe bool Skeletons_4_AfterFixup
+        public bool Skeletons_4_AfterFixup
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1048576) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1048576) != 0;
+            set { if (value) _bitfield4 |= 1048576; else _bitfield4 &= ~1048576; }
         }
 
         /// <summary>
         /// BoolProperty: Skeletons_UsePersistentLines
         /// </summary>
-        public unsafe bool Skeletons_UsePersistentLines
+        public bool Skeletons_UsePersistentLines
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 2097152) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 2097152) != 0;
+            set { if (value) _bitfield4 |= 2097152; else _bitfield4 &= ~2097152; }
         }
 
         /// <summary>
         /// BoolProperty: Unconscious
         /// </summary>
-        public unsafe bool Unconscious
+        public bool Unconscious
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 4194304) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 4194304) != 0;
+            set { if (value) _bitfield4 |= 4194304; else _bitfield4 &= ~4194304; }
         }
 
         /// <summary>
         /// BoolProperty: HandIK
         /// </summary>
-        public unsafe bool HandIK
+        public bool HandIK
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 8388608) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 8388608) != 0;
+            set { if (value) _bitfield4 |= 8388608; else _bitfield4 &= ~8388608; }
         }
 
         /// <summary>
         /// BoolProperty: HandIK_Details
         /// </summary>
-        public unsafe bool HandIK_Details
+        public bool HandIK_Details
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 16777216) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 16777216) != 0;
+            set { if (value) _bitfield4 |= 16777216; else _bitfield4 &= ~16777216; }
         }
 
         /// <summary>
         /// BoolProperty: HandIK_ForceDisable
         /// </summary>
-        public unsafe bool HandIK_ForceDisable
+        public bool HandIK_ForceDisable
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 33554432) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 33554432) != 0;
+            set { if (value) _bitfield4 |= 33554432; else _bitfield4 &= ~33554432; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection
         /// </summary>
-        public unsafe bool FloorCorrection
+        public bool FloorCorrection
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 67108864) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 67108864) != 0;
+            set { if (value) _bitfield4 |= 67108864; else _bitfield4 &= ~67108864; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection_Details
         /// </summary>
-        public unsafe bool FloorCorrection_Details
+        public bool FloorCorrection_Details
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 134217728) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 134217728) != 0;
+            set { if (value) _bitfield4 |= 134217728; else _bitfield4 &= ~134217728; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection_Render
         /// </summary>
-        public unsafe bool FloorCorrection_Render
+        public bool FloorCorrection_Render
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 268435456) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 268435456) != 0;
+            set { if (value) _bitfield4 |= 268435456; else _bitfield4 &= ~268435456; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection_RenderGrid
         /// </summary>
-        public unsafe bool FloorCorrection_RenderGrid
+        public bool FloorCorrection_RenderGrid
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 536870912) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 536870912) != 0;
+            set { if (value) _bitfield4 |= 536870912; else _bitfield4 &= ~536870912; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection_OverrideConfig
         /// </summary>
-        public unsafe bool FloorCorrection_OverrideConfig
+        public bool FloorCorrection_OverrideConfig
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1073741824) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1073741824) != 0;
+            set { if (value) _bitfield4 |= 1073741824; else _bitfield4 &= ~1073741824; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection_ForceDisableApply
         /// </summary>
-        public unsafe bool FloorCorrection_ForceDisableApply
+        public bool FloorCorrection_ForceDisableApply
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & -2147483648) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & -2147483648) != 0;
+            set { if (value) _bitfield4 |= -2147483648; else _bitfield4 &= ~-2147483648; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection_ForceDisableApplyNormal
         /// </summary>
-        public unsafe bool FloorCorrection_ForceDisableApplyNormal
+        public bool FloorCorrection_ForceDisableApplyNormal
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 1) != 0;
+            set { if (value) _bitfield8 |= 1; else _bitfield8 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection_ForceDisableMaxFootZ
         /// </summary>
-        public unsafe bool FloorCorrection_ForceDisableMaxFootZ
+        public bool FloorCorrection_ForceDisableMaxFootZ
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 2) != 0;
+            set { if (value) _bitfield8 |= 2; else _bitfield8 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: FloorCorrection_ForceDisableOverExtensionClamp
         /// </summary>
-        public unsafe bool FloorCorrection_ForceDisableOverExtensionClamp
+        public bool FloorCorrection_ForceDisableOverExtensionClamp
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 4) != 0;
+            set { if (value) _bitfield8 |= 4; else _bitfield8 &= ~4; }
         }
 
         /// <summary>
         /// StructProperty: FloorCorrection_OverrideConfig_Config
         /// </summary>
-        public unsafe BmSDK.BmGame.RGameInfo.FFloorMovementCorrectionConfig FloorCorrection_OverrideConfig_Config
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.FFloorMovementCorrectionConfig>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RGameInfo.FFloorMovementCorrectionConfig FloorCorrection_OverrideConfig_Config;
 
         /// <summary>
         /// BoolProperty: AutomaticTransitions
         /// </summary>
-        public unsafe bool AutomaticTransitions
+        public bool AutomaticTransitions
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 1) != 0;
+            set { if (value) _bitfield32 |= 1; else _bitfield32 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Dump
         /// </summary>
-        public unsafe bool Dump
+        public bool Dump
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 2) != 0;
+            set { if (value) _bitfield32 |= 2; else _bitfield32 &= ~2; }
         }
     }
 
@@ -720,8 +721,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bDeathCountGodMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1; else *(int*)(Ptr + 48) &= ~1; }
     }
 
     /// <summary>
@@ -729,8 +730,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bDisableDamagePostProcess
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 2; else *(int*)(Ptr + 48) &= ~2; }
     }
 
     /// <summary>
@@ -738,8 +739,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bDebugForceGarbageCollect
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 4; else *(int*)(Ptr + 48) &= ~4; }
     }
 
     /// <summary>
@@ -747,8 +748,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_CharacterAI_ShowThoughts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 8; else *(int*)(Ptr + 48) &= ~8; }
     }
 
     /// <summary>
@@ -756,8 +757,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_FearInfo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 16; else *(int*)(Ptr + 48) &= ~16; }
     }
 
     /// <summary>
@@ -765,8 +766,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_ShowDDA
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 32; else *(int*)(Ptr + 48) &= ~32; }
     }
 
     /// <summary>
@@ -774,8 +775,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_IgnoreDDA
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 64; else *(int*)(Ptr + 48) &= ~64; }
     }
 
     /// <summary>
@@ -783,8 +784,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_ShowStasisLevel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 128; else *(int*)(Ptr + 48) &= ~128; }
     }
 
     /// <summary>
@@ -792,8 +793,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_StuckNavDetection
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 256; else *(int*)(Ptr + 48) &= ~256; }
     }
 
     /// <summary>
@@ -801,8 +802,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_RandomTeleport
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 512; else *(int*)(Ptr + 48) &= ~512; }
     }
 
     /// <summary>
@@ -810,8 +811,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_VertTimeSinceSeen
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1024; else *(int*)(Ptr + 48) &= ~1024; }
     }
 
     /// <summary>
@@ -819,8 +820,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_ShowCanSeeVerts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 2048; else *(int*)(Ptr + 48) &= ~2048; }
     }
 
     /// <summary>
@@ -828,8 +829,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_AI_ShowCantSeeVerts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 4096; else *(int*)(Ptr + 48) &= ~4096; }
     }
 
     /// <summary>
@@ -837,8 +838,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bReactionBehaviours
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 8192; else *(int*)(Ptr + 48) &= ~8192; }
     }
 
     /// <summary>
@@ -846,8 +847,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bReactionBehavioursPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 16384; else *(int*)(Ptr + 48) &= ~16384; }
     }
 
     /// <summary>
@@ -855,8 +856,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowHistory
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 32768; else *(int*)(Ptr + 48) &= ~32768; }
     }
 
     /// <summary>
@@ -864,8 +865,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowHistory_General
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 65536; else *(int*)(Ptr + 48) &= ~65536; }
     }
 
     /// <summary>
@@ -873,8 +874,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowHistory_Behaviour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 131072; else *(int*)(Ptr + 48) &= ~131072; }
     }
 
     /// <summary>
@@ -882,8 +883,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowHistory_BehaviourState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 262144; else *(int*)(Ptr + 48) &= ~262144; }
     }
 
     /// <summary>
@@ -891,8 +892,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowHistory_ActionQueue
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 524288; else *(int*)(Ptr + 48) &= ~524288; }
     }
 
     /// <summary>
@@ -900,8 +901,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowTimestamps
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1048576; else *(int*)(Ptr + 48) &= ~1048576; }
     }
 
     /// <summary>
@@ -909,8 +910,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowFilteringMenu
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 2097152; else *(int*)(Ptr + 48) &= ~2097152; }
     }
 
     /// <summary>
@@ -918,8 +919,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsPawn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 4194304; else *(int*)(Ptr + 48) &= ~4194304; }
     }
 
     /// <summary>
@@ -927,8 +928,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsPawnState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 8388608; else *(int*)(Ptr + 48) &= ~8388608; }
     }
 
     /// <summary>
@@ -936,8 +937,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsPawnStasis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 16777216; else *(int*)(Ptr + 48) &= ~16777216; }
     }
 
     /// <summary>
@@ -945,8 +946,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsPawnStasis_InStasis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 33554432; else *(int*)(Ptr + 48) &= ~33554432; }
     }
 
     /// <summary>
@@ -954,8 +955,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsPawnStasis_NotInStasis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 67108864; else *(int*)(Ptr + 48) &= ~67108864; }
     }
 
     /// <summary>
@@ -963,8 +964,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsCharacterType
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 134217728; else *(int*)(Ptr + 48) &= ~134217728; }
     }
 
     /// <summary>
@@ -972,8 +973,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsCombatReadiness
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 268435456; else *(int*)(Ptr + 48) &= ~268435456; }
     }
 
     /// <summary>
@@ -981,8 +982,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsCombatBarks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 536870912; else *(int*)(Ptr + 48) &= ~536870912; }
     }
 
     /// <summary>
@@ -990,8 +991,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsSpawn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1073741824; else *(int*)(Ptr + 48) &= ~1073741824; }
     }
 
     /// <summary>
@@ -999,8 +1000,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsController
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= -2147483648; else *(int*)(Ptr + 48) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -1008,8 +1009,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsControllerState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1; else *(int*)(Ptr + 52) &= ~1; }
     }
 
     /// <summary>
@@ -1017,8 +1018,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsWeapon
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 2; else *(int*)(Ptr + 52) &= ~2; }
     }
 
     /// <summary>
@@ -1026,8 +1027,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsPawnPhysics
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 4; else *(int*)(Ptr + 52) &= ~4; }
     }
 
     /// <summary>
@@ -1035,8 +1036,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsActionQueue
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 8; else *(int*)(Ptr + 52) &= ~8; }
     }
 
     /// <summary>
@@ -1044,8 +1045,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsReplicator
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 16; else *(int*)(Ptr + 52) &= ~16; }
     }
 
     /// <summary>
@@ -1053,8 +1054,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsBehaviour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 32; else *(int*)(Ptr + 52) &= ~32; }
     }
 
     /// <summary>
@@ -1062,8 +1063,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsBehaviourList
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 64; else *(int*)(Ptr + 52) &= ~64; }
     }
 
     /// <summary>
@@ -1071,8 +1072,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsBehaviourListStanceStack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 128; else *(int*)(Ptr + 52) &= ~128; }
     }
 
     /// <summary>
@@ -1080,8 +1081,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsBehaviourState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 256; else *(int*)(Ptr + 52) &= ~256; }
     }
 
     /// <summary>
@@ -1089,8 +1090,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsEventOwnerVis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 512; else *(int*)(Ptr + 52) &= ~512; }
     }
 
     /// <summary>
@@ -1098,8 +1099,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsHealth
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1024; else *(int*)(Ptr + 52) &= ~1024; }
     }
 
     /// <summary>
@@ -1107,8 +1108,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 2048; else *(int*)(Ptr + 52) &= ~2048; }
     }
 
     /// <summary>
@@ -1116,8 +1117,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter_Priority
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 4096; else *(int*)(Ptr + 52) &= ~4096; }
     }
 
     /// <summary>
@@ -1125,8 +1126,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter_HasPath
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 8192; else *(int*)(Ptr + 52) &= ~8192; }
     }
 
     /// <summary>
@@ -1134,8 +1135,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter_PathLength
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 16384; else *(int*)(Ptr + 52) &= ~16384; }
     }
 
     /// <summary>
@@ -1143,8 +1144,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter_FailReason
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 32768; else *(int*)(Ptr + 52) &= ~32768; }
     }
 
     /// <summary>
@@ -1152,8 +1153,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter_NavActors
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 65536; else *(int*)(Ptr + 52) &= ~65536; }
     }
 
     /// <summary>
@@ -1161,8 +1162,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter_EmptyHandles
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 131072; else *(int*)(Ptr + 52) &= ~131072; }
     }
 
     /// <summary>
@@ -1170,8 +1171,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter_Traversal
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 262144; else *(int*)(Ptr + 52) &= ~262144; }
     }
 
     /// <summary>
@@ -1179,8 +1180,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowThoughtsRouter_ReproInfo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 524288; else *(int*)(Ptr + 52) &= ~524288; }
     }
 
     /// <summary>
@@ -1188,8 +1189,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowFreezeFeatures
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1048576; else *(int*)(Ptr + 52) &= ~1048576; }
     }
 
     /// <summary>
@@ -1197,8 +1198,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bSingleTakedownKill
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 2097152; else *(int*)(Ptr + 52) &= ~2097152; }
     }
 
     /// <summary>
@@ -1206,8 +1207,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bDisableFreezeFootprintCheat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 4194304; else *(int*)(Ptr + 52) &= ~4194304; }
     }
 
     /// <summary>
@@ -1215,8 +1216,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bPauseWhenFreezeChangesNavStrat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 8388608; else *(int*)(Ptr + 52) &= ~8388608; }
     }
 
     /// <summary>
@@ -1224,8 +1225,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bPauseWhenFreezeChangesVisualContact
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 16777216; else *(int*)(Ptr + 52) &= ~16777216; }
     }
 
     /// <summary>
@@ -1233,8 +1234,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bFreezeCanNeutraliseEverything
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 33554432; else *(int*)(Ptr + 52) &= ~33554432; }
     }
 
     /// <summary>
@@ -1242,8 +1243,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bFreezeSoakBehaviour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 67108864; else *(int*)(Ptr + 52) &= ~67108864; }
     }
 
     /// <summary>
@@ -1251,8 +1252,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bAcceleratedRiddlerProgress
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 134217728; else *(int*)(Ptr + 52) &= ~134217728; }
     }
 
     /// <summary>
@@ -1260,8 +1261,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bBehaviourDebugOutput
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 268435456; else *(int*)(Ptr + 52) &= ~268435456; }
     }
 
     /// <summary>
@@ -1269,8 +1270,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bCombatDebugOutput
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 536870912; else *(int*)(Ptr + 52) &= ~536870912; }
     }
 
     /// <summary>
@@ -1278,8 +1279,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bAIInvulnerable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1073741824; else *(int*)(Ptr + 52) &= ~1073741824; }
     }
 
     /// <summary>
@@ -1287,8 +1288,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowAlerts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= -2147483648; else *(int*)(Ptr + 52) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -1296,8 +1297,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowAlertLines
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 
     /// <summary>
@@ -1305,8 +1306,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowPlayerVisibility
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 2; else *(int*)(Ptr + 56) &= ~2; }
     }
 
     /// <summary>
@@ -1314,8 +1315,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowEventInstigatorVisibility
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 4; else *(int*)(Ptr + 56) &= ~4; }
     }
 
     /// <summary>
@@ -1323,8 +1324,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowChaseTrees
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 8; else *(int*)(Ptr + 56) &= ~8; }
     }
 
     /// <summary>
@@ -1332,8 +1333,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowViewCone
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 16; else *(int*)(Ptr + 56) &= ~16; }
     }
 
     /// <summary>
@@ -1341,8 +1342,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bPauseOnChaseFail
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 32; else *(int*)(Ptr + 56) &= ~32; }
     }
 
     /// <summary>
@@ -1350,8 +1351,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bShowAntiBacktrack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 64; else *(int*)(Ptr + 56) &= ~64; }
     }
 
     /// <summary>
@@ -1359,8 +1360,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bGargSmashingActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 128; else *(int*)(Ptr + 56) &= ~128; }
     }
 
     /// <summary>
@@ -1368,8 +1369,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bForceCasualtyKicking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 256; else *(int*)(Ptr + 56) &= ~256; }
     }
 
     /// <summary>
@@ -1377,8 +1378,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bAIVocalDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 512; else *(int*)(Ptr + 56) &= ~512; }
     }
 
     /// <summary>
@@ -1386,8 +1387,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bAIVocalDebugEmotes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1024; else *(int*)(Ptr + 56) &= ~1024; }
     }
 
     /// <summary>
@@ -1395,8 +1396,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bAIVocalDebugBarks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 2048; else *(int*)(Ptr + 56) &= ~2048; }
     }
 
     /// <summary>
@@ -1404,8 +1405,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bAIVocalDebugSpeech
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 4096; else *(int*)(Ptr + 56) &= ~4096; }
     }
 
     /// <summary>
@@ -1413,8 +1414,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_CanAlwaysTakedown
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 8192; else *(int*)(Ptr + 56) &= ~8192; }
     }
 
     /// <summary>
@@ -1422,8 +1423,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_AlwaysSuperComboMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 16384; else *(int*)(Ptr + 56) &= ~16384; }
     }
 
     /// <summary>
@@ -1431,8 +1432,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_AlwaysFinalBlow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 32768; else *(int*)(Ptr + 56) &= ~32768; }
     }
 
     /// <summary>
@@ -1440,8 +1441,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_CanAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 65536; else *(int*)(Ptr + 56) &= ~65536; }
     }
 
     /// <summary>
@@ -1449,8 +1450,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ForceEnvironmentUse
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 131072; else *(int*)(Ptr + 56) &= ~131072; }
     }
 
     /// <summary>
@@ -1458,8 +1459,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_PreventEnvironmentUse
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 262144; else *(int*)(Ptr + 56) &= ~262144; }
     }
 
     /// <summary>
@@ -1467,8 +1468,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ShowDamageCollision
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 524288; else *(int*)(Ptr + 56) &= ~524288; }
     }
 
     /// <summary>
@@ -1476,8 +1477,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_CameraAssist
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1048576; else *(int*)(Ptr + 56) &= ~1048576; }
     }
 
     /// <summary>
@@ -1485,8 +1486,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ShowRagdollImpulse
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 2097152; else *(int*)(Ptr + 56) &= ~2097152; }
     }
 
     /// <summary>
@@ -1494,8 +1495,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_EnableCounterBreak
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 4194304; else *(int*)(Ptr + 56) &= ~4194304; }
     }
 
     /// <summary>
@@ -1503,8 +1504,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_DisableHighlights
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 8388608; else *(int*)(Ptr + 56) &= ~8388608; }
     }
 
     /// <summary>
@@ -1512,8 +1513,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_DisableStunStars
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 16777216; else *(int*)(Ptr + 56) &= ~16777216; }
     }
 
     /// <summary>
@@ -1521,8 +1522,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_DisableImpactVFX
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 33554432; else *(int*)(Ptr + 56) &= ~33554432; }
     }
 
     /// <summary>
@@ -1530,8 +1531,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_DisableStrikeTrails
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 67108864; else *(int*)(Ptr + 56) &= ~67108864; }
     }
 
     /// <summary>
@@ -1539,8 +1540,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_EnableSimultaneousAttacks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 134217728; else *(int*)(Ptr + 56) &= ~134217728; }
     }
 
     /// <summary>
@@ -1548,8 +1549,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_OnlySimultaneousAttacks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 268435456; else *(int*)(Ptr + 56) &= ~268435456; }
     }
 
     /// <summary>
@@ -1557,8 +1558,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_AlwaysSlowdownSimultaneousAttacks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 536870912; else *(int*)(Ptr + 56) &= ~536870912; }
     }
 
     /// <summary>
@@ -1566,8 +1567,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ForceMaxSimultaneousAttackers
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1073741824; else *(int*)(Ptr + 56) &= ~1073741824; }
     }
 
     /// <summary>
@@ -1575,8 +1576,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ShowDesiredPosition
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= -2147483648; else *(int*)(Ptr + 56) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -1584,8 +1585,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_DisableWeakMoves
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1; else *(int*)(Ptr + 60) &= ~1; }
     }
 
     /// <summary>
@@ -1593,8 +1594,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_BatBot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 2; else *(int*)(Ptr + 60) &= ~2; }
     }
 
     /// <summary>
@@ -1602,8 +1603,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_CatBot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 4; else *(int*)(Ptr + 60) &= ~4; }
     }
 
     /// <summary>
@@ -1611,8 +1612,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_RasChargeOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 8; else *(int*)(Ptr + 60) &= ~8; }
     }
 
     /// <summary>
@@ -1620,8 +1621,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_RasRepeatSwordAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 16; else *(int*)(Ptr + 60) &= ~16; }
     }
 
     /// <summary>
@@ -1629,8 +1630,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_RasSwordClusterOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 32; else *(int*)(Ptr + 60) &= ~32; }
     }
 
     /// <summary>
@@ -1638,8 +1639,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_RasShowLookAt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 64; else *(int*)(Ptr + 60) &= ~64; }
     }
 
     /// <summary>
@@ -1647,8 +1648,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_DisableXPBats
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 128; else *(int*)(Ptr + 60) &= ~128; }
     }
 
     /// <summary>
@@ -1656,8 +1657,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_TargettingCone
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 256; else *(int*)(Ptr + 60) &= ~256; }
     }
 
     /// <summary>
@@ -1665,8 +1666,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_Targets
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 512; else *(int*)(Ptr + 60) &= ~512; }
     }
 
     /// <summary>
@@ -1674,8 +1675,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_CameraOrientation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1024; else *(int*)(Ptr + 60) &= ~1024; }
     }
 
     /// <summary>
@@ -1683,8 +1684,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ShowMoveForceLines
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 2048; else *(int*)(Ptr + 60) &= ~2048; }
     }
 
     /// <summary>
@@ -1692,8 +1693,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_LogCombatMoves
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 4096; else *(int*)(Ptr + 60) &= ~4096; }
     }
 
     /// <summary>
@@ -1701,8 +1702,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ShowCombatAreas
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 8192; else *(int*)(Ptr + 60) &= ~8192; }
     }
 
     /// <summary>
@@ -1710,8 +1711,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ShowCylinderCollisionChecks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 16384; else *(int*)(Ptr + 60) &= ~16384; }
     }
 
     /// <summary>
@@ -1719,8 +1720,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ShowGroupStunRadius
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 32768; else *(int*)(Ptr + 60) &= ~32768; }
     }
 
     /// <summary>
@@ -1728,8 +1729,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_OneHitKill
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 65536; else *(int*)(Ptr + 60) &= ~65536; }
     }
 
     /// <summary>
@@ -1737,8 +1738,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Combat_ShowMoveToPlayerDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 131072; else *(int*)(Ptr + 60) &= ~131072; }
     }
 
     /// <summary>
@@ -1746,8 +1747,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Sniper_ShowViewCones
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 262144; else *(int*)(Ptr + 60) &= ~262144; }
     }
 
     /// <summary>
@@ -1755,8 +1756,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Show_VenomDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 524288; else *(int*)(Ptr + 60) &= ~524288; }
     }
 
     /// <summary>
@@ -1764,8 +1765,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Venom_KeepInView
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1048576; else *(int*)(Ptr + 60) &= ~1048576; }
     }
 
     /// <summary>
@@ -1773,8 +1774,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Venom_ShowClampedAim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 2097152; else *(int*)(Ptr + 60) &= ~2097152; }
     }
 
     /// <summary>
@@ -1782,8 +1783,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Venom_ShowAttacking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 4194304; else *(int*)(Ptr + 60) &= ~4194304; }
     }
 
     /// <summary>
@@ -1791,8 +1792,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Player_ShowXP
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 8388608; else *(int*)(Ptr + 60) &= ~8388608; }
     }
 
     /// <summary>
@@ -1800,8 +1801,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Player_ShowXPAttractors
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 16777216; else *(int*)(Ptr + 60) &= ~16777216; }
     }
 
     /// <summary>
@@ -1809,8 +1810,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Player_EnableThoughts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 33554432; else *(int*)(Ptr + 60) &= ~33554432; }
     }
 
     /// <summary>
@@ -1818,8 +1819,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Player_EnableThoughtsInterrogation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 67108864; else *(int*)(Ptr + 60) &= ~67108864; }
     }
 
     /// <summary>
@@ -1827,8 +1828,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Player_ShowCeilingInfo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 134217728; else *(int*)(Ptr + 60) &= ~134217728; }
     }
 
     /// <summary>
@@ -1836,8 +1837,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Navigation_ShowDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 268435456; else *(int*)(Ptr + 60) &= ~268435456; }
     }
 
     /// <summary>
@@ -1845,8 +1846,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Navigation_ShowAIPaths
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 536870912; else *(int*)(Ptr + 60) &= ~536870912; }
     }
 
     /// <summary>
@@ -1854,8 +1855,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Navigation_ShowPathPolys
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1073741824; else *(int*)(Ptr + 60) &= ~1073741824; }
     }
 
     /// <summary>
@@ -1863,8 +1864,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Navigation_ShowInlineHandling
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= -2147483648; else *(int*)(Ptr + 60) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -1872,8 +1873,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Navigation_ShowAllPaths
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 1; else *(int*)(Ptr + 64) &= ~1; }
     }
 
     /// <summary>
@@ -1881,8 +1882,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Navigation_ShowAIAvoidance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 2; else *(int*)(Ptr + 64) &= ~2; }
     }
 
     /// <summary>
@@ -1890,8 +1891,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Navigation_ShowTraversalHistory
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 4; else *(int*)(Ptr + 64) &= ~4; }
     }
 
     /// <summary>
@@ -1899,8 +1900,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Navigation_PauseOnStuck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 8; else *(int*)(Ptr + 64) &= ~8; }
     }
 
     /// <summary>
@@ -1908,8 +1909,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool bVisualiseGrenades
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 16; else *(int*)(Ptr + 64) &= ~16; }
     }
 
     /// <summary>
@@ -1917,8 +1918,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_ShowProgress
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 32; else *(int*)(Ptr + 64) &= ~32; }
     }
 
     /// <summary>
@@ -1926,8 +1927,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_DebugLabels
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 64; else *(int*)(Ptr + 64) &= ~64; }
     }
 
     /// <summary>
@@ -1935,8 +1936,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_bLocalizationWarning
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 128; else *(int*)(Ptr + 64) &= ~128; }
     }
 
     /// <summary>
@@ -1944,8 +1945,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Disable_All_Capes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 256; else *(int*)(Ptr + 64) &= ~256; }
     }
 
     /// <summary>
@@ -1953,8 +1954,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Hide_Cape
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 512; else *(int*)(Ptr + 64) &= ~512; }
     }
 
     /// <summary>
@@ -1962,8 +1963,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Enable_Cape_Thoughts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 1024; else *(int*)(Ptr + 64) &= ~1024; }
     }
 
     /// <summary>
@@ -1971,8 +1972,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Draw_Cape_Debug_Lines
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 2048; else *(int*)(Ptr + 64) &= ~2048; }
     }
 
     /// <summary>
@@ -1980,8 +1981,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Draw_Water_Volume_Debug_Lines
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 4096; else *(int*)(Ptr + 64) &= ~4096; }
     }
 
     /// <summary>
@@ -1989,8 +1990,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Draw_Full_Cape_Debug_Lines
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 8192; else *(int*)(Ptr + 64) &= ~8192; }
     }
 
     /// <summary>
@@ -1998,8 +1999,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Force_Animated_Cape
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 16384; else *(int*)(Ptr + 64) &= ~16384; }
     }
 
     /// <summary>
@@ -2007,8 +2008,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Disable_Cape_Depth_Bias
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 32768; else *(int*)(Ptr + 64) &= ~32768; }
     }
 
     /// <summary>
@@ -2016,8 +2017,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Enable_Actor_Thoughts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 65536; else *(int*)(Ptr + 64) &= ~65536; }
     }
 
     /// <summary>
@@ -2025,8 +2026,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Disable_Grate_Excluders
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 131072; else *(int*)(Ptr + 64) &= ~131072; }
     }
 
     /// <summary>
@@ -2034,8 +2035,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Draw_Rope_Debug_Lines
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 262144; else *(int*)(Ptr + 64) &= ~262144; }
     }
 
     /// <summary>
@@ -2043,8 +2044,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Enable_Rope_Thoughts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 524288; else *(int*)(Ptr + 64) &= ~524288; }
     }
 
     /// <summary>
@@ -2052,8 +2053,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_DisableRiddlerChallenges
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 1048576; else *(int*)(Ptr + 64) &= ~1048576; }
     }
 
     /// <summary>
@@ -2061,8 +2062,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe bool Debug_Enable_Audio_Thoughts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 2097152; else *(int*)(Ptr + 64) &= ~2097152; }
     }
 
     /// <summary>
@@ -2070,8 +2071,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float DebugGCTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -2079,8 +2080,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe int Debug_AI_PathFindsPerFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(int*)(Ptr + 72); }
+        set { *(int*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -2088,8 +2089,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe int Debug_AI_PathShortensPerFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(int*)(Ptr + 76); }
+        set { *(int*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -2097,8 +2098,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe int ChaseTreeSearchDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(int*)(Ptr + 80); }
+        set { *(int*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -2106,8 +2107,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Combat_TargettingArc
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -2115,8 +2116,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Combat_ComboLengthMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -2124,8 +2125,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Combat_AllyDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -2133,8 +2134,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Combat_BMForce
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -2142,8 +2143,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Combat_AllyForce
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -2151,8 +2152,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Combat_MinMoveForce
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -2160,8 +2161,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Combat_StunTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(float*)(Ptr + 108); }
+        set { *(float*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -2169,8 +2170,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Combat_ZapTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(float*)(Ptr + 112); }
+        set { *(float*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -2178,8 +2179,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe int Debug_Combat_OverrideChapter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(int*)(Ptr + 116); }
+        set { *(int*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -2196,8 +2197,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe int Debug_Sniper_ViewConeDisplayRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(int*)(Ptr + 132); }
+        set { *(int*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -2205,8 +2206,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Sniper_ViewConeFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(float*)(Ptr + 136); }
+        set { *(float*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -2214,8 +2215,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float Debug_Sniper_ViewConeVertMulti
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(float*)(Ptr + 140); }
+        set { *(float*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -2223,8 +2224,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe byte Debug_Azrael_SideStoryProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(byte*)(Ptr + 144); }
+        set { *(byte*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -2232,8 +2233,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe byte Debug_Bane_SideStoryProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 145); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 145); }
+        get { return *(byte*)(Ptr + 145); }
+        set { *(byte*)(Ptr + 145) = value; }
     }
 
     /// <summary>
@@ -2241,8 +2242,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe byte Debug_Deadshot_SideStoryProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 146); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 146); }
+        get { return *(byte*)(Ptr + 146); }
+        set { *(byte*)(Ptr + 146) = value; }
     }
 
     /// <summary>
@@ -2250,8 +2251,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe byte Debug_Hush_SideStoryProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 147); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 147); }
+        get { return *(byte*)(Ptr + 147); }
+        set { *(byte*)(Ptr + 147) = value; }
     }
 
     /// <summary>
@@ -2259,8 +2260,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe byte Debug_MadHatter_SideStoryProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(byte*)(Ptr + 148); }
+        set { *(byte*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -2268,8 +2269,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe byte Debug_NoraFries_SideStoryProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 149); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 149); }
+        get { return *(byte*)(Ptr + 149); }
+        set { *(byte*)(Ptr + 149) = value; }
     }
 
     /// <summary>
@@ -2277,8 +2278,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe byte Debug_Riddler_SideStoryProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 150); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 150); }
+        get { return *(byte*)(Ptr + 150); }
+        set { *(byte*)(Ptr + 150) = value; }
     }
 
     /// <summary>
@@ -2286,8 +2287,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe byte Debug_Zsasz_SideStoryProgress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 151); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 151); }
+        get { return *(byte*)(Ptr + 151); }
+        set { *(byte*)(Ptr + 151) = value; }
     }
 
     /// <summary>
@@ -2295,8 +2296,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe BmSDK.BmGame.RGameRI.EPhysWalkingType Debug_AI_PhysWalkingType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameRI.EPhysWalkingType>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(BmSDK.BmGame.RGameRI.EPhysWalkingType*)(Ptr + 152); }
+        set { *(BmSDK.BmGame.RGameRI.EPhysWalkingType*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -2304,8 +2305,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe int Debug_Navigation_ShowShortenHistory
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(int*)(Ptr + 156); }
+        set { *(int*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -2313,8 +2314,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe int Debug_Navigation_ShowEdgeHistory
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(int*)(Ptr + 160); }
+        set { *(int*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -2322,8 +2323,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float MaxGrenadeXYSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 
     /// <summary>
@@ -2331,8 +2332,8 @@ public partial class RPersistentDebugData : BmSDK.Engine.PersistentDebugData, Bm
     /// </summary>
     public unsafe float MaxGrenadeOverallSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }
+        get { return *(float*)(Ptr + 168); }
+        set { *(float*)(Ptr + 168) = value; }
     }
 
     /// <summary>
@@ -78,15 +78,28 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RPersistentOptions>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HaveTheOptionsChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HaveTheOptionsChanged_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HaveTheOptionsChanged
     /// </summary>
     public unsafe virtual bool HaveTheOptionsChanged()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.HaveTheOptionsChanged", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HaveTheOptionsChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.HaveTheOptionsChanged", true);
+        var parms = new HaveTheOptionsChanged_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_MakeCopyOfOptionsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct MakeCopyOfOptions_Params
+    {
     }
 
     /// <summary>
@@ -94,35 +107,59 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void MakeCopyOfOptions()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.MakeCopyOfOptions", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MakeCopyOfOptionsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.MakeCopyOfOptions", true);
+        var parms = new MakeCopyOfOptions_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetControlTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetControlType_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetControlType
     /// </summary>
     public unsafe virtual void SetControlType(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetControlType", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetControlTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetControlType", true);
+        var parms = new SetControlType_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetControlTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetControlType_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetControlType
     /// </summary>
     public unsafe virtual int GetControlType(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetControlType", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetControlTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetControlType", true);
+        var parms = new GetControlType_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultControlTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultControlType_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -130,11 +167,19 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultControlType(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultControlType", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultControlTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultControlType", true);
+        var parms = new GetDefaultControlType_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetSixAxisFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetSixAxis_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -142,24 +187,40 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetSixAxis(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetSixAxis", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSixAxisFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetSixAxis", true);
+        var parms = new SetSixAxis_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSixAxisFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetSixAxis_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSixAxis
     /// </summary>
     public unsafe virtual int GetSixAxis(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetSixAxis", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetSixAxisFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetSixAxis", true);
+        var parms = new GetSixAxis_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultSixAxisFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultSixAxis_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -167,11 +228,19 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultSixAxis(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultSixAxis", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultSixAxisFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultSixAxis", true);
+        var parms = new GetDefaultSixAxis_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetVibrationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetVibration_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -179,24 +248,40 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetVibration(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetVibration", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetVibrationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetVibration", true);
+        var parms = new SetVibration_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetVibrationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetVibration_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetVibration
     /// </summary>
     public unsafe virtual int GetVibration(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetVibration", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetVibrationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetVibration", true);
+        var parms = new GetVibration_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultVibrationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultVibration_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -204,11 +289,19 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultVibration(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultVibration", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultVibrationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultVibration", true);
+        var parms = new GetDefaultVibration_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetCameraAssistFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCameraAssist_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -216,24 +309,40 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetCameraAssist(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetCameraAssist", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCameraAssistFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetCameraAssist", true);
+        var parms = new SetCameraAssist_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCameraAssistFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetCameraAssist_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCameraAssist
     /// </summary>
     public unsafe virtual int GetCameraAssist(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetCameraAssist", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetCameraAssistFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetCameraAssist", true);
+        var parms = new GetCameraAssist_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultCameraAssistFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultCameraAssist_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -241,11 +350,19 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultCameraAssist(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultCameraAssist", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultCameraAssistFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultCameraAssist", true);
+        var parms = new GetDefaultCameraAssist_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetAutoFlowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetAutoFlow_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -253,24 +370,40 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetAutoFlow(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetAutoFlow", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAutoFlowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetAutoFlow", true);
+        var parms = new SetAutoFlow_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetDefaultAutoFlowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultAutoFlow_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetDefaultAutoFlow
     /// </summary>
     public unsafe virtual int GetDefaultAutoFlow(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultAutoFlow", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultAutoFlowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultAutoFlow", true);
+        var parms = new GetDefaultAutoFlow_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetInvertBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetInvertBatarang_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -278,24 +411,40 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetInvertBatarang(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetInvertBatarang", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInvertBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetInvertBatarang", true);
+        var parms = new SetInvertBatarang_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetInvertBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetInvertBatarang_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetInvertBatarang
     /// </summary>
     public unsafe virtual int GetInvertBatarang(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetInvertBatarang", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetInvertBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetInvertBatarang", true);
+        var parms = new GetInvertBatarang_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultInvertBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultInvertBatarang_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -303,11 +452,19 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultInvertBatarang(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultInvertBatarang", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultInvertBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultInvertBatarang", true);
+        var parms = new GetDefaultInvertBatarang_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetInvertGlideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetInvertGlide_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -315,24 +472,40 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetInvertGlide(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetInvertGlide", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInvertGlideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetInvertGlide", true);
+        var parms = new SetInvertGlide_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetInvertGlideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetInvertGlide_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetInvertGlide
     /// </summary>
     public unsafe virtual int GetInvertGlide(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetInvertGlide", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetInvertGlideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetInvertGlide", true);
+        var parms = new GetInvertGlide_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultInvertGlideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultInvertGlide_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -340,11 +513,19 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultInvertGlide(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultInvertGlide", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultInvertGlideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultInvertGlide", true);
+        var parms = new GetDefaultInvertGlide_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetInvertRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetInvertRotation_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -352,24 +533,40 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetInvertRotation(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetInvertRotation", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInvertRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetInvertRotation", true);
+        var parms = new SetInvertRotation_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetInvertRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetInvertRotation_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetInvertRotation
     /// </summary>
     public unsafe virtual int GetInvertRotation(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetInvertRotation", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetInvertRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetInvertRotation", true);
+        var parms = new GetInvertRotation_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultInvertRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultInvertRotation_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -377,11 +574,19 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultInvertRotation(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultInvertRotation", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultInvertRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultInvertRotation", true);
+        var parms = new GetDefaultInvertRotation_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetInvertLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetInvertLook_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int Value;
     }
 
     /// <summary>
@@ -389,24 +594,40 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetInvertLook(bool bPlayer2, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetInvertLook", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInvertLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetInvertLook", true);
+        var parms = new SetInvertLook_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetInvertLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetInvertLook_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetInvertLook
     /// </summary>
     public unsafe virtual int GetInvertLook(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetInvertLook", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetInvertLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetInvertLook", true);
+        var parms = new GetInvertLook_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultInvertLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetDefaultInvertLook_Params
+    {
+        [FieldOffset(0)] public int bPlayer2;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -414,11 +635,18 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultInvertLook(bool bPlayer2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultInvertLook", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlayer2, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetDefaultInvertLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultInvertLook", true);
+        var parms = new GetDefaultInvertLook_Params();
+        parms.bPlayer2 = bPlayer2 ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetHintsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetHints_Params
+    {
+        [FieldOffset(0)] public int Value;
     }
 
     /// <summary>
@@ -426,22 +654,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetHints(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetHints", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHintsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetHints", true);
+        var parms = new SetHints_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetHintsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetHints_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetHints
     /// </summary>
     public unsafe virtual int GetHints()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetHints", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetHintsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetHints", true);
+        var parms = new GetHints_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultHintsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultHints_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -449,10 +691,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultHints()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultHints", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultHintsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultHints", true);
+        var parms = new GetDefaultHints_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetTutorial_Params
+    {
+        [FieldOffset(0)] public int Value;
     }
 
     /// <summary>
@@ -460,22 +709,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetTutorial(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetTutorial", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetTutorial", true);
+        var parms = new SetTutorial_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetTutorial_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetTutorial
     /// </summary>
     public unsafe virtual int GetTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetTutorial", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetTutorial", true);
+        var parms = new GetTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultTutorial_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -483,10 +746,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultTutorial()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultTutorial", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultTutorial", true);
+        var parms = new GetDefaultTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetIntensity3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetIntensity3D_Params
+    {
+        [FieldOffset(0)] public int Value;
     }
 
     /// <summary>
@@ -494,22 +764,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetIntensity3D(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetIntensity3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetIntensity3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetIntensity3D", true);
+        var parms = new SetIntensity3D_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetIntensity3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetIntensity3D_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetIntensity3D
     /// </summary>
     public unsafe virtual int GetIntensity3D()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetIntensity3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetIntensity3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetIntensity3D", true);
+        var parms = new GetIntensity3D_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultIntensity3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultIntensity3D_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -517,10 +801,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultIntensity3D()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultIntensity3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultIntensity3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultIntensity3D", true);
+        var parms = new GetDefaultIntensity3D_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetEyeInversion3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetEyeInversion3D_Params
+    {
+        [FieldOffset(0)] public int Value;
     }
 
     /// <summary>
@@ -528,22 +819,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetEyeInversion3D(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetEyeInversion3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetEyeInversion3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetEyeInversion3D", true);
+        var parms = new SetEyeInversion3D_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetEyeInversion3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetEyeInversion3D_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetEyeInversion3D
     /// </summary>
     public unsafe virtual int GetEyeInversion3D()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetEyeInversion3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetEyeInversion3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetEyeInversion3D", true);
+        var parms = new GetEyeInversion3D_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultEyeInversion3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultEyeInversion3D_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -551,10 +856,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultEyeInversion3D()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultEyeInversion3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultEyeInversion3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultEyeInversion3D", true);
+        var parms = new GetDefaultEyeInversion3D_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetRender3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetRender3D_Params
+    {
+        [FieldOffset(0)] public int Value;
     }
 
     /// <summary>
@@ -562,22 +874,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetRender3D(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetRender3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRender3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetRender3D", true);
+        var parms = new SetRender3D_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRender3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetRender3D_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRender3D
     /// </summary>
     public unsafe virtual int GetRender3D()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetRender3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetRender3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetRender3D", true);
+        var parms = new GetRender3D_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultRender3DFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultRender3D_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -585,10 +911,16 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultRender3D()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultRender3D", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultRender3DFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultRender3D", true);
+        var parms = new GetDefaultRender3D_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_Apply3DSettingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Apply3DSettings_Params
+    {
     }
 
     /// <summary>
@@ -596,54 +928,54 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void Apply3DSettings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.Apply3DSettings", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_Apply3DSettingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.Apply3DSettings", true);
+        var parms = new Apply3DSettings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetVolumeMusicFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetVolumeMusic_Params
+    {
+        [FieldOffset(0)] public float Value;
+    }
+
     /// <summary>
     /// Function: SetVolumeMusic
     /// </summary>
     public unsafe virtual void SetVolumeMusic(float Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetVolumeMusic", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetVolumeMusicFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetVolumeMusic", true);
+        var parms = new SetVolumeMusic_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetVolumeMusicFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetVolumeMusic_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetVolumeMusic
     /// </summary>
     public unsafe virtual int GetVolumeMusic()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetVolumeMusic", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetVolumeMusicFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetVolumeMusic", true);
+        var parms = new GetVolumeMusic_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultVolumeMusicFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultVolumeMusic_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -651,10 +983,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultVolumeMusic()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultVolumeMusic", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultVolumeMusicFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultVolumeMusic", true);
+        var parms = new GetDefaultVolumeMusic_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetVolumeDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetVolumeDialogue_Params
+    {
+        [FieldOffset(0)] public float Value;
     }
 
     /// <summary>
@@ -662,36 +1001,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetVolumeDialogue(float Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetVolumeDialogue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetVolumeDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetVolumeDialogue", true);
+        var parms = new SetVolumeDialogue_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetVolumeDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetVolumeDialogue_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetVolumeDialogue
     /// </summary>
     public unsafe virtual int GetVolumeDialogue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetVolumeDialogue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetVolumeDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetVolumeDialogue", true);
+        var parms = new GetVolumeDialogue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultVolumeDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultVolumeDialogue_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -699,10 +1038,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultVolumeDialogue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultVolumeDialogue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultVolumeDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultVolumeDialogue", true);
+        var parms = new GetDefaultVolumeDialogue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetVolumeSFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetVolumeSFX_Params
+    {
+        [FieldOffset(0)] public float Value;
     }
 
     /// <summary>
@@ -710,36 +1056,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetVolumeSFX(float Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetVolumeSFX", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetVolumeSFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetVolumeSFX", true);
+        var parms = new SetVolumeSFX_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetVolumeSFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetVolumeSFX_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetVolumeSFX
     /// </summary>
     public unsafe virtual int GetVolumeSFX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetVolumeSFX", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetVolumeSFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetVolumeSFX", true);
+        var parms = new GetVolumeSFX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultVolumeSFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultVolumeSFX_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -747,10 +1093,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultVolumeSFX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultVolumeSFX", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultVolumeSFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultVolumeSFX", true);
+        var parms = new GetDefaultVolumeSFX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetGammaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetGamma_Params
+    {
+        [FieldOffset(0)] public float Value;
     }
 
     /// <summary>
@@ -758,36 +1111,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetGamma(float Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetGamma", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetGammaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetGamma", true);
+        var parms = new SetGamma_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetEngineGammaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetEngineGamma_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetEngineGamma
     /// </summary>
     public unsafe virtual float GetEngineGamma()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetEngineGamma", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetEngineGammaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetEngineGamma", true);
+        var parms = new GetEngineGamma_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetGammaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetGamma_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -795,17 +1148,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetGamma()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetGamma", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetGammaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetGamma", true);
+        var parms = new GetGamma_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultGammaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultGamma_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -813,10 +1166,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultGamma()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultGamma", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultGammaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultGamma", true);
+        var parms = new GetDefaultGamma_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetSubtitlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSubtitles_Params
+    {
+        [FieldOffset(0)] public int Value;
     }
 
     /// <summary>
@@ -824,22 +1184,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetSubtitles(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetSubtitles", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSubtitlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetSubtitles", true);
+        var parms = new SetSubtitles_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSubtitlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSubtitles_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSubtitles
     /// </summary>
     public unsafe virtual int GetSubtitles()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetSubtitles", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetSubtitlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetSubtitles", true);
+        var parms = new GetSubtitles_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultSubtitlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultSubtitles_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -847,10 +1221,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultSubtitles()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultSubtitles", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultSubtitlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultSubtitles", true);
+        var parms = new GetDefaultSubtitles_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDifficultyAsStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetDifficultyAsString_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -858,10 +1239,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.FString GetDifficultyAsString()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDifficultyAsString", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetDifficultyAsStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDifficultyAsString", true);
+        var parms = new GetDifficultyAsString_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetDifficultyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetDifficulty_Params
+    {
+        [FieldOffset(0)] public int Value;
     }
 
     /// <summary>
@@ -869,22 +1257,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetDifficulty(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetDifficulty", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDifficultyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetDifficulty", true);
+        var parms = new SetDifficulty_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetDifficultyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDifficulty_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetDifficulty
     /// </summary>
     public unsafe virtual int GetDifficulty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDifficulty", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDifficultyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDifficulty", true);
+        var parms = new GetDifficulty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultDifficultyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultDifficulty_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -892,10 +1294,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultDifficulty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultDifficulty", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultDifficultyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultDifficulty", true);
+        var parms = new GetDefaultDifficulty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetPCControlsPageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetPCControlsPage_Params
+    {
+        [FieldOffset(0)] public int Value;
     }
 
     /// <summary>
@@ -903,22 +1312,36 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetPCControlsPage(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetPCControlsPage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPCControlsPageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetPCControlsPage", true);
+        var parms = new SetPCControlsPage_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPCControlsPageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetPCControlsPage_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetPCControlsPage
     /// </summary>
     public unsafe virtual int GetPCControlsPage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetPCControlsPage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetPCControlsPageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetPCControlsPage", true);
+        var parms = new GetPCControlsPage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetDefaultPCControlsPageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDefaultPCControlsPage_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -926,10 +1349,16 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetDefaultPCControlsPage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultPCControlsPage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetDefaultPCControlsPageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetDefaultPCControlsPage", true);
+        var parms = new GetDefaultPCControlsPage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetAllDefaultsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetAllDefaults_Params
+    {
     }
 
     /// <summary>
@@ -937,59 +1366,98 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetAllDefaults()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetAllDefaults", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAllDefaultsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SetAllDefaults", true);
+        var parms = new SetAllDefaults_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Dump_Params
+    {
+    }
+
     /// <summary>
     /// Function: Dump
     /// </summary>
     public unsafe virtual void Dump()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.Dump", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.Dump", true);
+        var parms = new Dump_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CombatSuccessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CombatSuccess_Params
+    {
+        [FieldOffset(0)] public int NumCombatants;
+        [FieldOffset(4)] public int CombatKOsThisFight;
+        [FieldOffset(8)] public float PlayerHealth;
+    }
+
     /// <summary>
     /// Function: CombatSuccess
     /// </summary>
     public unsafe virtual void CombatSuccess(int NumCombatants, int CombatKOsThisFight, float PlayerHealth)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.CombatSuccess", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NumCombatants, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CombatKOsThisFight, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerHealth, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatSuccessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.CombatSuccess", true);
+        var parms = new CombatSuccess_Params();
+        parms.NumCombatants = NumCombatants;
+        parms.CombatKOsThisFight = CombatKOsThisFight;
+        parms.PlayerHealth = PlayerHealth;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CombatDeathFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CombatDeath_Params
+    {
+        [FieldOffset(0)] public int CurrentChapter;
+    }
+
     /// <summary>
     /// Function: CombatDeath
     /// </summary>
     public unsafe virtual void CombatDeath(int CurrentChapter)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.CombatDeath", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentChapter, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatDeathFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.CombatDeath", true);
+        var parms = new CombatDeath_Params();
+        parms.CurrentChapter = CurrentChapter;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsChallengeUnLockedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsChallengeUnLocked_Params
+    {
+        [FieldOffset(0)] public int ChallengeID;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsChallengeUnLocked
     /// </summary>
     public unsafe virtual bool IsChallengeUnLocked(int ChallengeID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.IsChallengeUnLocked", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeID, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsChallengeUnLockedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.IsChallengeUnLocked", true);
+        var parms = new IsChallengeUnLocked_Params();
+        parms.ChallengeID = ChallengeID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetUnlockedChallengeCharacterDataIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetUnlockedChallengeCharacterDataIndex_Params
+    {
+        [FieldOffset(0)] public int ChallengeIndex;
+        [FieldOffset(4)] public int CharacterId;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -997,12 +1465,20 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetUnlockedChallengeCharacterDataIndex(int ChallengeIndex, int CharacterId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetUnlockedChallengeCharacterDataIndex", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CharacterId, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_GetUnlockedChallengeCharacterDataIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetUnlockedChallengeCharacterDataIndex", true);
+        var parms = new GetUnlockedChallengeCharacterDataIndex_Params();
+        parms.ChallengeIndex = ChallengeIndex;
+        parms.CharacterId = CharacterId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetUnlockedChallengeIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetUnlockedChallengeIndex_Params
+    {
+        [FieldOffset(0)] public int ChallengeID;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1010,11 +1486,19 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetUnlockedChallengeIndex(int ChallengeID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetUnlockedChallengeIndex", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeID, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetUnlockedChallengeIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.GetUnlockedChallengeIndex", true);
+        var parms = new GetUnlockedChallengeIndex_Params();
+        parms.ChallengeID = ChallengeID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UnlockChallengeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct UnlockChallenge_Params
+    {
+        [FieldOffset(0)] public int ChallengeID;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1022,11 +1506,17 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool UnlockChallenge(int ChallengeID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.UnlockChallenge", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeID, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UnlockChallengeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.UnlockChallenge", true);
+        var parms = new UnlockChallenge_Params();
+        parms.ChallengeID = ChallengeID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RestorePS3LeaderboardCacheFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RestorePS3LeaderboardCache_Params
+    {
     }
 
     /// <summary>
@@ -1034,52 +1524,43 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void RestorePS3LeaderboardCache()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.RestorePS3LeaderboardCache", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RestorePS3LeaderboardCacheFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.RestorePS3LeaderboardCache", true);
+        var parms = new RestorePS3LeaderboardCache_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SavePS3LeaderboardCacheFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SavePS3LeaderboardCache_Params
+    {
+    }
+
     /// <summary>
     /// Function: SavePS3LeaderboardCache
     /// </summary>
     public unsafe virtual void SavePS3LeaderboardCache()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SavePS3LeaderboardCache", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SavePS3LeaderboardCacheFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.SavePS3LeaderboardCache", true);
+        var parms = new SavePS3LeaderboardCache_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearPS3LeaderboardCacheFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearPS3LeaderboardCache_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearPS3LeaderboardCache
     /// </summary>
     public unsafe virtual void ClearPS3LeaderboardCache()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.ClearPS3LeaderboardCache", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClearPS3LeaderboardCacheFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentOptions.ClearPS3LeaderboardCache", true);
+        var parms = new ClearPS3LeaderboardCache_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -1092,38 +1573,22 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// ByteProperty: Id
         /// </summary>
-        public unsafe byte Id
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public byte Id;
 
         /// <summary>
         /// ByteProperty: bNew
         /// </summary>
-        public unsafe byte bNew
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 1); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1); }; }
-        }
+        [FieldOffset(1)] public byte bNew;
 
         /// <summary>
         /// ByteProperty: Type
         /// </summary>
-        public unsafe byte Type
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 2); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2); }; }
-        }
+        [FieldOffset(2)] public byte Type;
 
         /// <summary>
         /// ByteProperty: Pad
         /// </summary>
-        public unsafe byte Pad
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 3); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3); }; }
-        }
+        [FieldOffset(3)] public byte Pad;
 
         /// <summary>
         /// ArrayProperty: DataPerCharacter
@@ -1144,65 +1609,37 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: LocalRating
         /// </summary>
-        public unsafe int LocalRating
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int LocalRating;
 
         /// <summary>
         /// IntProperty: Score
         /// </summary>
-        public unsafe int Score
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int Score;
 
         /// <summary>
         /// IntProperty: CustomLocalRating
         /// </summary>
-        public unsafe int CustomLocalRating
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int CustomLocalRating;
 
         /// <summary>
         /// IntProperty: CustomScore
         /// </summary>
-        public unsafe int CustomScore
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int CustomScore;
 
         /// <summary>
         /// ByteProperty: Medals
         /// </summary>
-        public unsafe byte Medals
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public byte Medals;
 
         /// <summary>
         /// ByteProperty: CustomMedals
         /// </summary>
-        public unsafe byte CustomMedals
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 17); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 17); }; }
-        }
+        [FieldOffset(17)] public byte CustomMedals;
 
         /// <summary>
         /// ByteProperty: CharacterId
         /// </summary>
-        public unsafe byte CharacterId
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 18); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 18); }; }
-        }
+        [FieldOffset(18)] public byte CharacterId;
     }
 
     /// <summary>
@@ -1210,8 +1647,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Version
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -1273,8 +1710,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DDA_DeathsInRoom
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(int*)(Ptr + 120); }
+        set { *(int*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -1282,8 +1719,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DDA_QuickSavesInRoom
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(int*)(Ptr + 124); }
+        set { *(int*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -1291,8 +1728,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DLC_JokerMessage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(int*)(Ptr + 128); }
+        set { *(int*)(Ptr + 128) = value; }
     }
 
     /// <summary>
@@ -1300,8 +1737,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DLC_BatmanMessage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(int*)(Ptr + 132); }
+        set { *(int*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -1309,8 +1746,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DLC_ArmouredBatmanMessage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(int*)(Ptr + 136); }
+        set { *(int*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -1318,8 +1755,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte FreezeBackscreenUnlocked
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(byte*)(Ptr + 140); }
+        set { *(byte*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -1327,8 +1764,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte StartedWithoutCW
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 141); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 141); }
+        get { return *(byte*)(Ptr + 141); }
+        set { *(byte*)(Ptr + 141) = value; }
     }
 
     /// <summary>
@@ -1336,8 +1773,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte StatsNew
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 142); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 142); }
+        get { return *(byte*)(Ptr + 142); }
+        set { *(byte*)(Ptr + 142) = value; }
     }
 
     /// <summary>
@@ -1345,8 +1782,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EBioCharacter NewBioUnlocked
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EBioCharacter>(Ptr + 143); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 143); }
+        get { return *(BmSDK.BmGame.RPersistentData.EBioCharacter*)(Ptr + 143); }
+        set { *(BmSDK.BmGame.RPersistentData.EBioCharacter*)(Ptr + 143) = value; }
     }
 
     /// <summary>
@@ -1354,8 +1791,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.ECharacterViewer NewTrophyUnlocked
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.ECharacterViewer>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(BmSDK.BmGame.RPersistentData.ECharacterViewer*)(Ptr + 144); }
+        set { *(BmSDK.BmGame.RPersistentData.ECharacterViewer*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -1363,8 +1800,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentOptions.ChallengeMode CurrentChallengeMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentOptions.ChallengeMode>(Ptr + 145); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 145); }
+        get { return *(BmSDK.BmGame.RPersistentOptions.ChallengeMode*)(Ptr + 145); }
+        set { *(BmSDK.BmGame.RPersistentOptions.ChallengeMode*)(Ptr + 145) = value; }
     }
 
     /// <summary>
@@ -1408,8 +1845,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ArmouredBatmanPlayable
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 196); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 196); }
+        get { return *(int*)(Ptr + 196); }
+        set { *(int*)(Ptr + 196) = value; }
     }
 
     /// <summary>
@@ -1417,8 +1854,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int BeatenJoker
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 200); }
+        get { return *(int*)(Ptr + 200); }
+        set { *(int*)(Ptr + 200) = value; }
     }
 
     /// <summary>
@@ -1426,8 +1863,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NewGamePlusEnabled
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(int*)(Ptr + 204); }
+        set { *(int*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -1435,8 +1872,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NewGamePlusStarted
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(int*)(Ptr + 208); }
+        set { *(int*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -1444,8 +1881,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int SkippedWBIDPrompt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(int*)(Ptr + 212); }
+        set { *(int*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -1453,8 +1890,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Got_WBID_Bonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(int*)(Ptr + 216); }
+        set { *(int*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -1462,8 +1899,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int WBIDPrivacyGUID1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(int*)(Ptr + 220); }
+        set { *(int*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -1471,8 +1908,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int WBIDPrivacyGUID2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(int*)(Ptr + 224); }
+        set { *(int*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -1480,8 +1917,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int WBIDPrivacyGUID3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(int*)(Ptr + 228); }
+        set { *(int*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -1489,8 +1926,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int WBIDPrivacyGUID4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(int*)(Ptr + 232); }
+        set { *(int*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -1498,8 +1935,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Challenge_Character
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(int*)(Ptr + 236); }
+        set { *(int*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -1507,8 +1944,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Challenge_Index
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(int*)(Ptr + 240); }
+        set { *(int*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -1516,8 +1953,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DLCChallenge_Character
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(int*)(Ptr + 244); }
+        set { *(int*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -1525,8 +1962,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DLCChallenge_CombatOrPredator
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(int*)(Ptr + 248); }
+        set { *(int*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -1534,8 +1971,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DLCChallenge_Index
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(int*)(Ptr + 252); }
+        set { *(int*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -1543,8 +1980,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int PercentageCompleted
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(int*)(Ptr + 256); }
+        set { *(int*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -1561,8 +1998,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Day
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(int*)(Ptr + 272); }
+        set { *(int*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -1570,8 +2007,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Month
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(int*)(Ptr + 276); }
+        set { *(int*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -1579,8 +2016,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Year
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 280); }
+        get { return *(int*)(Ptr + 280); }
+        set { *(int*)(Ptr + 280) = value; }
     }
 
     /// <summary>
@@ -1588,8 +2025,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int LocationID
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }
+        get { return *(int*)(Ptr + 284); }
+        set { *(int*)(Ptr + 284) = value; }
     }
 
     /// <summary>
@@ -1597,8 +2034,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int IvyStage2Reached
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(int*)(Ptr + 288); }
+        set { *(int*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -1606,8 +2043,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CombatDDA
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }
+        get { return *(float*)(Ptr + 292); }
+        set { *(float*)(Ptr + 292) = value; }
     }
 
     /// <summary>
@@ -1615,8 +2052,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int AchievementsDisabled
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(int*)(Ptr + 296); }
+        set { *(int*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -1624,8 +2061,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int UsingGamepad
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(int*)(Ptr + 300); }
+        set { *(int*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -1651,8 +2088,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CurrentChallengeMapPageIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(int*)(Ptr + 328); }
+        set { *(int*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -1660,8 +2097,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CurrentChallengeMapPageItemIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(int*)(Ptr + 332); }
+        set { *(int*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -1678,8 +2115,8 @@ public partial class RPersistentOptions : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCharacterSelectCheat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 348) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 348); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 348); }
+        get { return (*(int*)(Ptr + 348) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 348) |= 1; else *(int*)(Ptr + 348) &= ~1; }
     }
 
     /// <summary>
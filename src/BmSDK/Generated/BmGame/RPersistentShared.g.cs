@@ -78,15 +78,30 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RPersistentShared>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_AllCamerasBrokenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AllCamerasBroken_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AllCamerasBroken
     /// </summary>
     public unsafe virtual bool AllCamerasBroken()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.AllCamerasBroken", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AllCamerasBrokenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.AllCamerasBroken", true);
+        var parms = new AllCamerasBroken_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetCameraBrokenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCameraBroken_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -94,11 +109,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int SetCameraBroken(BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.SetCameraBroken", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_SetCameraBrokenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.SetCameraBroken", true);
+        var parms = new SetCameraBroken_Params();
+        parms.Zone = Zone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreasePenguinBrokenCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IncreasePenguinBrokenCount_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -106,11 +129,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreasePenguinBrokenCount(BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreasePenguinBrokenCount", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_IncreasePenguinBrokenCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreasePenguinBrokenCount", true);
+        var parms = new IncreasePenguinBrokenCount_Params();
+        parms.Zone = Zone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreaseJokerBalloonPoppedCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IncreaseJokerBalloonPoppedCount_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -118,11 +149,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreaseJokerBalloonPoppedCount(BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseJokerBalloonPoppedCount", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_IncreaseJokerBalloonPoppedCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseJokerBalloonPoppedCount", true);
+        var parms = new IncreaseJokerBalloonPoppedCount_Params();
+        parms.Zone = Zone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreaseJokerTeethCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IncreaseJokerTeethCount_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -130,11 +169,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreaseJokerTeethCount(BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseJokerTeethCount", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_IncreaseJokerTeethCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseJokerTeethCount", true);
+        var parms = new IncreaseJokerTeethCount_Params();
+        parms.Zone = Zone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreaseRiddleCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IncreaseRiddleCount_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -142,11 +189,18 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreaseRiddleCount(BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseRiddleCount", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_IncreaseRiddleCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseRiddleCount", true);
+        var parms = new IncreaseRiddleCount_Params();
+        parms.Zone = Zone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CWJewelleryTotalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CWJewelleryTotal_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -154,10 +208,17 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int CWJewelleryTotal()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CWJewelleryTotal", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_CWJewelleryTotalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CWJewelleryTotal", true);
+        var parms = new CWJewelleryTotal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CWTotalPossiblePickupsAndChallengesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CWTotalPossiblePickupsAndChallenges_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -165,10 +226,17 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int CWTotalPossiblePickupsAndChallenges()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CWTotalPossiblePickupsAndChallenges", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_CWTotalPossiblePickupsAndChallengesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CWTotalPossiblePickupsAndChallenges", true);
+        var parms = new CWTotalPossiblePickupsAndChallenges_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CWPickupsAndChallengesCompleteCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CWPickupsAndChallengesCompleteCount_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -176,10 +244,17 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int CWPickupsAndChallengesCompleteCount()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CWPickupsAndChallengesCompleteCount", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_CWPickupsAndChallengesCompleteCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CWPickupsAndChallengesCompleteCount", true);
+        var parms = new CWPickupsAndChallengesCompleteCount_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CWPickupsAndChallengesCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CWPickupsAndChallengesComplete_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -187,10 +262,17 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool CWPickupsAndChallengesComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CWPickupsAndChallengesComplete", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CWPickupsAndChallengesCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CWPickupsAndChallengesComplete", true);
+        var parms = new CWPickupsAndChallengesComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetCWPickupsTotalCollectedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetCWPickupsTotalCollected_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -198,10 +280,18 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetCWPickupsTotalCollected()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetCWPickupsTotalCollected", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetCWPickupsTotalCollectedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetCWPickupsTotalCollected", true);
+        var parms = new GetCWPickupsTotalCollected_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreaseCWPickupCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IncreaseCWPickupCount_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -209,11 +299,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreaseCWPickupCount(BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseCWPickupCount", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_IncreaseCWPickupCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseCWPickupCount", true);
+        var parms = new IncreaseCWPickupCount_Params();
+        parms.Zone = Zone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreasePickupCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IncreasePickupCount_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -221,11 +319,18 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreasePickupCount(BmSDK.BmGame.RPersistentData.ERiddlerLocationName Zone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreasePickupCount", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Zone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_IncreasePickupCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreasePickupCount", true);
+        var parms = new IncreasePickupCount_Params();
+        parms.Zone = Zone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreaseBrokenDemonSealCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IncreaseBrokenDemonSealCount_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -233,10 +338,17 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreaseBrokenDemonSealCount()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseBrokenDemonSealCount", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_IncreaseBrokenDemonSealCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseBrokenDemonSealCount", true);
+        var parms = new IncreaseBrokenDemonSealCount_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncreaseBrokenHarleyHeadCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IncreaseBrokenHarleyHeadCount_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -244,10 +356,18 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int IncreaseBrokenHarleyHeadCount()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseBrokenHarleyHeadCount", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_IncreaseBrokenHarleyHeadCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IncreaseBrokenHarleyHeadCount", true);
+        var parms = new IncreaseBrokenHarleyHeadCount_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateBatChallengeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateBatChallenge_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry;
+        [FieldOffset(4)] public float InValue;
     }
 
     /// <summary>
@@ -255,24 +375,39 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void UpdateBatChallenge(BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry, float InValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.UpdateBatChallenge", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Entry, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InValue, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateBatChallengeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.UpdateBatChallenge", true);
+        var parms = new UpdateBatChallenge_Params();
+        parms.Entry = Entry;
+        parms.InValue = InValue;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsBatChallengeAsBeatenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsBatChallengeAsBeaten_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsBatChallengeAsBeaten
     /// </summary>
     public unsafe virtual bool IsBatChallengeAsBeaten(BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsBatChallengeAsBeaten", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Entry, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsBatChallengeAsBeatenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsBatChallengeAsBeaten", true);
+        var parms = new IsBatChallengeAsBeaten_Params();
+        parms.Entry = Entry;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetBatChallengeAsBeatenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetBatChallengeAsBeaten_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry;
     }
 
     /// <summary>
@@ -280,23 +415,39 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetBatChallengeAsBeaten(BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.SetBatChallengeAsBeaten", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Entry, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetBatChallengeAsBeatenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.SetBatChallengeAsBeaten", true);
+        var parms = new SetBatChallengeAsBeaten_Params();
+        parms.Entry = Entry;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetBatChallengeValueNeededFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetBatChallengeValueNeeded_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry;
+        [FieldOffset(4)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetBatChallengeValueNeeded
     /// </summary>
     public unsafe virtual float GetBatChallengeValueNeeded(BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetBatChallengeValueNeeded", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Entry, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetBatChallengeValueNeededFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetBatChallengeValueNeeded", true);
+        var parms = new GetBatChallengeValueNeeded_Params();
+        parms.Entry = Entry;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetBatChallengeValueBestFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetBatChallengeValueBest_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -304,11 +455,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetBatChallengeValueBest(BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetBatChallengeValueBest", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Entry, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetBatChallengeValueBestFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetBatChallengeValueBest", true);
+        var parms = new GetBatChallengeValueBest_Params();
+        parms.Entry = Entry;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetBatChallengeValueCurrentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetBatChallengeValueCurrent_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -316,11 +475,20 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetBatChallengeValueCurrent(BmSDK.BmGame.RPersistentData.EBatmanChallenge Entry)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetBatChallengeValueCurrent", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Entry, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetBatChallengeValueCurrentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetBatChallengeValueCurrent", true);
+        var parms = new GetBatChallengeValueCurrent_Params();
+        parms.Entry = Entry;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRiddlerLocationDataValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetRiddlerLocationDataValue_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+        [FieldOffset(4)] public int Index;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -328,12 +496,21 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetRiddlerLocationDataValue(int LocIndex, int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetRiddlerLocationDataValue", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_GetRiddlerLocationDataValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetRiddlerLocationDataValue", true);
+        var parms = new GetRiddlerLocationDataValue_Params();
+        parms.LocIndex = LocIndex;
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetRiddlerLocationDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetRiddlerLocationData_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+        [FieldOffset(4)] public int Index;
+        [FieldOffset(8)] public int Value;
     }
 
     /// <summary>
@@ -341,25 +518,40 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetRiddlerLocationData(int LocIndex, int Index, int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.SetRiddlerLocationData", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRiddlerLocationDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.SetRiddlerLocationData", true);
+        var parms = new SetRiddlerLocationData_Params();
+        parms.LocIndex = LocIndex;
+        parms.Index = Index;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRiddlerLocationDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetRiddlerLocationData_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+    }
+
     /// <summary>
     /// Function: GetRiddlerLocationData
     /// </summary>
     public unsafe virtual BmSDK.TArray<int> GetRiddlerLocationData(int LocIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetRiddlerLocationData", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 4);
+        var funcManaged = s_GetRiddlerLocationDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetRiddlerLocationData", true);
+        var parms = new GetRiddlerLocationData_Params();
+        parms.LocIndex = LocIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 4);
+    }
+
+    static BmSDK.Function s_IsRiddlerAreaUnlockedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsRiddlerAreaUnlocked_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -367,11 +559,18 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsRiddlerAreaUnlocked(int LocIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsRiddlerAreaUnlocked", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsRiddlerAreaUnlockedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsRiddlerAreaUnlocked", true);
+        var parms = new IsRiddlerAreaUnlocked_Params();
+        parms.LocIndex = LocIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UnlockRiddlerAreaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnlockRiddlerArea_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
     }
 
     /// <summary>
@@ -379,34 +578,57 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void UnlockRiddlerArea(int LocIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.UnlockRiddlerArea", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnlockRiddlerAreaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.UnlockRiddlerArea", true);
+        var parms = new UnlockRiddlerArea_Params();
+        parms.LocIndex = LocIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearRiddlerAreaNewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearRiddlerAreaNew_Params
+    {
+        [FieldOffset(0)] public int LocIndex;
+    }
+
     /// <summary>
     /// Function: ClearRiddlerAreaNew
     /// </summary>
     public unsafe virtual void ClearRiddlerAreaNew(int LocIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.ClearRiddlerAreaNew", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearRiddlerAreaNewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.ClearRiddlerAreaNew", true);
+        var parms = new ClearRiddlerAreaNew_Params();
+        parms.LocIndex = LocIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRiddlerTotalCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetRiddlerTotalCount_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRiddlerTotalCount
     /// </summary>
     public unsafe virtual int GetRiddlerTotalCount()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetRiddlerTotalCount", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetRiddlerTotalCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.GetRiddlerTotalCount", true);
+        var parms = new GetRiddlerTotalCount_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_Set_PercentEntryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Set_PercentEntry_Params
+    {
+        [FieldOffset(0)] public int bPlus;
+        [FieldOffset(4)] public BmSDK.BmGame.RPersistentShared.EPercentData Item;
+        [FieldOffset(8)] public float Value;
     }
 
     /// <summary>
@@ -414,26 +636,42 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void Set_PercentEntry(bool bPlus, BmSDK.BmGame.RPersistentShared.EPercentData Item, float Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.Set_PercentEntry", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlus, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Item, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Set_PercentEntryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.Set_PercentEntry", true);
+        var parms = new Set_PercentEntry_Params();
+        parms.bPlus = bPlus ? 1 : 0;
+        parms.Item = Item;
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Get_PercentEntryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Get_PercentEntry_Params
+    {
+        [FieldOffset(0)] public int bPlus;
+        [FieldOffset(4)] public BmSDK.BmGame.RPersistentShared.EPercentData Item;
+        [FieldOffset(8)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: Get_PercentEntry
     /// </summary>
     public unsafe virtual float Get_PercentEntry(bool bPlus, BmSDK.BmGame.RPersistentShared.EPercentData Item)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.Get_PercentEntry", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlus, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Item, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_Get_PercentEntryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.Get_PercentEntry", true);
+        var parms = new Get_PercentEntry_Params();
+        parms.bPlus = bPlus ? 1 : 0;
+        parms.Item = Item;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ClearStoryNewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearStoryNew_Params
+    {
+        [FieldOffset(0)] public int Uid;
     }
 
     /// <summary>
@@ -441,23 +679,40 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ClearStoryNew(int Uid)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.ClearStoryNew", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Uid, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearStoryNewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.ClearStoryNew", true);
+        var parms = new ClearStoryNew_Params();
+        parms.Uid = Uid;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsStoryNewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsStoryNew_Params
+    {
+        [FieldOffset(0)] public int Uid;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsStoryNew
     /// </summary>
     public unsafe virtual bool IsStoryNew(int Uid)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsStoryNew", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Uid, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsStoryNewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsStoryNew", true);
+        var parms = new IsStoryNew_Params();
+        parms.Uid = Uid;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CountCityStoryNewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CountCityStoryNew_Params
+    {
+        [FieldOffset(0)] public int StartAt;
+        [FieldOffset(4)] public int Count;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -465,12 +720,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int CountCityStoryNew(int StartAt, int Count)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CountCityStoryNew", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartAt, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Count, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
+        var funcManaged = s_CountCityStoryNewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CountCityStoryNew", true);
+        var parms = new CountCityStoryNew_Params();
+        parms.StartAt = StartAt;
+        parms.Count = Count;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_MarkOffCityStoryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MarkOffCityStory_Params
+    {
+        [FieldOffset(0)] public int CityStoryId;
     }
 
     /// <summary>
@@ -478,22 +740,37 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void MarkOffCityStory(int CityStoryId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.MarkOffCityStory", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CityStoryId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MarkOffCityStoryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.MarkOffCityStory", true);
+        var parms = new MarkOffCityStory_Params();
+        parms.CityStoryId = CityStoryId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CountBiosNewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CountBiosNew_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CountBiosNew
     /// </summary>
     public unsafe virtual int CountBiosNew()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CountBiosNew", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_CountBiosNewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.CountBiosNew", true);
+        var parms = new CountBiosNew_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsBioUnlockedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsBioUnlocked_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.EBioCharacter inBio;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -501,11 +778,17 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsBioUnlocked(BmSDK.BmGame.RPersistentData.EBioCharacter inBio)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsBioUnlocked", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inBio, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsBioUnlockedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsBioUnlocked", true);
+        var parms = new IsBioUnlocked_Params();
+        parms.inBio = inBio;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 37)]
+    private struct Dump_Params
+    {
     }
 
     /// <summary>
@@ -513,34 +796,56 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void Dump()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.Dump", true);
-        byte* paramsPtr = stackalloc byte[37];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.Dump", true);
+        var parms = new Dump_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct DumpStats_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpStats
     /// </summary>
     public unsafe virtual void DumpStats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.DumpStats", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.DumpStats", true);
+        var parms = new DumpStats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PadStrFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct PadStr_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString InStr;
+        [FieldOffset(12)] public int DesiredLen;
+        [FieldOffset(16)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: PadStr
     /// </summary>
     public unsafe virtual BmSDK.FString PadStr(BmSDK.FString InStr, int DesiredLen)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.PadStr", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InStr, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredLen, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 16);
+        var funcManaged = s_PadStrFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.PadStr", true);
+        var parms = new PadStr_Params();
+        parms.InStr = InStr;
+        parms.DesiredLen = DesiredLen;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_FloatArrayToStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct FloatArrayToString_Params
+    {
+        [FieldOffset(12)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -548,11 +853,18 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.FString FloatArrayToString(BmSDK.TArray<float> Values)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.FloatArrayToString", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Values, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
+        var funcManaged = s_FloatArrayToStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.FloatArrayToString", true);
+        var parms = new FloatArrayToString_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Values, (byte*)&parms + 0);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IntArrayToStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct IntArrayToString_Params
+    {
+        [FieldOffset(12)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -560,11 +872,18 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.FString IntArrayToString(BmSDK.TArray<int> Values)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IntArrayToString", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Values, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
+        var funcManaged = s_IntArrayToStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IntArrayToString", true);
+        var parms = new IntArrayToString_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Values, (byte*)&parms + 0);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ByteArrayToStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct ByteArrayToString_Params
+    {
+        [FieldOffset(12)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -572,11 +891,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.FString ByteArrayToString(BmSDK.TArray<byte> Values)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.ByteArrayToString", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Values, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
+        var funcManaged = s_ByteArrayToStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.ByteArrayToString", true);
+        var parms = new ByteArrayToString_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Values, (byte*)&parms + 0);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsSharedFlagSetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct IsSharedFlagSet_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FlagName;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -584,18 +911,19 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsSharedFlagSet(BmSDK.FString FlagName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsSharedFlagSet", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FlagName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsSharedFlagSetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.IsSharedFlagSet", true);
+        var parms = new IsSharedFlagSet_Params();
+        parms.FlagName = FlagName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetSharedFlagFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetSharedFlag_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FlagName;
+        [FieldOffset(12)] public int bTrue;
     }
 
     /// <summary>
@@ -603,18 +931,11 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetSharedFlag(BmSDK.FString FlagName, bool bTrue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.SetSharedFlag", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FlagName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTrue, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetSharedFlagFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPersistentShared.SetSharedFlag", true);
+        var parms = new SetSharedFlag_Params();
+        parms.FlagName = FlagName;
+        parms.bTrue = bTrue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -623,8 +944,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int Version
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -659,8 +980,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumUpgrades
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(int*)(Ptr + 84); }
+        set { *(int*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -821,8 +1142,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Player_RangeBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }
+        get { return *(float*)(Ptr + 292); }
+        set { *(float*)(Ptr + 292) = value; }
     }
 
     /// <summary>
@@ -1037,8 +1358,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int BrokenHarleyHeadTally
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 572); }
+        get { return *(int*)(Ptr + 572); }
+        set { *(int*)(Ptr + 572) = value; }
     }
 
     /// <summary>
@@ -1046,8 +1367,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int BrokenDemonSealTally
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 576); }
+        get { return *(int*)(Ptr + 576); }
+        set { *(int*)(Ptr + 576) = value; }
     }
 
     /// <summary>
@@ -1055,8 +1376,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int BrokenGrundyHeadTally
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 580); }
+        get { return *(int*)(Ptr + 580); }
+        set { *(int*)(Ptr + 580) = value; }
     }
 
     /// <summary>
@@ -1064,8 +1385,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int PickupCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 584); }
+        get { return *(int*)(Ptr + 584); }
+        set { *(int*)(Ptr + 584) = value; }
     }
 
     /// <summary>
@@ -1073,8 +1394,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int PickupRevealsLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 588); }
+        get { return *(int*)(Ptr + 588); }
+        set { *(int*)(Ptr + 588) = value; }
     }
 
     /// <summary>
@@ -1082,8 +1403,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int InterrogatesLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 592); }
+        get { return *(int*)(Ptr + 592); }
+        set { *(int*)(Ptr + 592) = value; }
     }
 
     /// <summary>
@@ -1091,8 +1412,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumCamerasBroken
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 596); }
+        get { return *(int*)(Ptr + 596); }
+        set { *(int*)(Ptr + 596) = value; }
     }
 
     /// <summary>
@@ -1100,8 +1421,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int InterrogatesPerformed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 600); }
+        get { return *(int*)(Ptr + 600); }
+        set { *(int*)(Ptr + 600) = value; }
     }
 
     /// <summary>
@@ -1109,8 +1430,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int InterrogatesWithTutorialPerformed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 604); }
+        get { return *(int*)(Ptr + 604); }
+        set { *(int*)(Ptr + 604) = value; }
     }
 
     /// <summary>
@@ -1154,8 +1475,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float XpForPrevUpgrade
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 656); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 656); }
+        get { return *(float*)(Ptr + 656); }
+        set { *(float*)(Ptr + 656) = value; }
     }
 
     /// <summary>
@@ -1163,8 +1484,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float XpForNextUpgrade
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 660); }
+        get { return *(float*)(Ptr + 660); }
+        set { *(float*)(Ptr + 660) = value; }
     }
 
     /// <summary>
@@ -1172,8 +1493,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Xp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 664); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 664); }
+        get { return *(float*)(Ptr + 664); }
+        set { *(float*)(Ptr + 664) = value; }
     }
 
     /// <summary>
@@ -1181,8 +1502,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float XpLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 668); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 668); }
+        get { return *(float*)(Ptr + 668); }
+        set { *(float*)(Ptr + 668) = value; }
     }
 
     /// <summary>
@@ -1190,8 +1511,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float XpOverUpgradeThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 672); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 672); }
+        get { return *(float*)(Ptr + 672); }
+        set { *(float*)(Ptr + 672) = value; }
     }
 
     /// <summary>
@@ -1199,8 +1520,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int UpgradesBought
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 676); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 676); }
+        get { return *(int*)(Ptr + 676); }
+        set { *(int*)(Ptr + 676) = value; }
     }
 
     /// <summary>
@@ -1208,8 +1529,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CW_UpgradesBought
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 680); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 680); }
+        get { return *(int*)(Ptr + 680); }
+        set { *(int*)(Ptr + 680) = value; }
     }
 
     /// <summary>
@@ -1217,8 +1538,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int playerLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 684); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 684); }
+        get { return *(int*)(Ptr + 684); }
+        set { *(int*)(Ptr + 684) = value; }
     }
 
     /// <summary>
@@ -1226,8 +1547,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int UnlockablesToSpend
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 688); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 688); }
+        get { return *(int*)(Ptr + 688); }
+        set { *(int*)(Ptr + 688) = value; }
     }
 
     /// <summary>
@@ -1235,8 +1556,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ShowLevelUpFlag
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 692); }
+        get { return *(int*)(Ptr + 692); }
+        set { *(int*)(Ptr + 692) = value; }
     }
 
     /// <summary>
@@ -1244,8 +1565,8 @@ public partial class RPersistentShared : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int RiddlerGridEnabled
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 696); }
+        get { return *(int*)(Ptr + 696); }
+        set { *(int*)(Ptr + 696) = value; }
     }
 
     /// <summary>
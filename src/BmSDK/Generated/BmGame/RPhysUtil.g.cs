@@ -79,40 +79,30 @@ public partial class RPhysUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 8)]
     public partial record struct FCapeChangeData
     {
+        [FieldOffset(4)] private int _bitfield4;
+
         /// <summary>
         /// ByteProperty: NewCapeHiddenType
         /// </summary>
-        public unsafe BmSDK.BmGame.RPhysUtil.ECapeHiddenType NewCapeHiddenType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPhysUtil.ECapeHiddenType>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RPhysUtil.ECapeHiddenType NewCapeHiddenType;
 
         /// <summary>
         /// ByteProperty: NewCapeEnabledType
         /// </summary>
-        public unsafe BmSDK.BmGame.RPhysUtil.ECapeEnabledType NewCapeEnabledType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPhysUtil.ECapeEnabledType>(Ptr + 1); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1); }; }
-        }
+        [FieldOffset(1)] public BmSDK.BmGame.RPhysUtil.ECapeEnabledType NewCapeEnabledType;
 
         /// <summary>
         /// ByteProperty: NewCapeReducedDepthBiasType
         /// </summary>
-        public unsafe BmSDK.BmGame.RPhysUtil.ECapeEnabledType NewCapeReducedDepthBiasType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPhysUtil.ECapeEnabledType>(Ptr + 2); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 2); }; }
-        }
+        [FieldOffset(2)] public BmSDK.BmGame.RPhysUtil.ECapeEnabledType NewCapeReducedDepthBiasType;
 
         /// <summary>
         /// BoolProperty: Padding
         /// </summary>
-        public unsafe bool Padding
+        public bool Padding
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1) != 0;
+            set { if (value) _bitfield4 |= 1; else _bitfield4 &= ~1; }
         }
     }
 
@@ -122,76 +112,55 @@ public partial class RPhysUtil : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 60)]
     public partial record struct FCapeStateChangeData
     {
+        [FieldOffset(36)] private int _bitfield36;
+        [FieldOffset(56)] private int _bitfield56;
+
         /// <summary>
         /// NameProperty: CapeStateName
         /// </summary>
-        public unsafe BmSDK.FName CapeStateName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName CapeStateName;
 
         /// <summary>
         /// NameProperty: CapeAnimName
         /// </summary>
-        public unsafe BmSDK.FName CapeAnimName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName CapeAnimName;
 
         /// <summary>
         /// FloatProperty: AnimStartTime
         /// </summary>
-        public unsafe float AnimStartTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float AnimStartTime;
 
         /// <summary>
         /// FloatProperty: AnimPlayRate
         /// </summary>
-        public unsafe float AnimPlayRate
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float AnimPlayRate;
 
         /// <summary>
         /// NameProperty: SyncAnimName
         /// </summary>
-        public unsafe BmSDK.FName SyncAnimName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.FName SyncAnimName;
 
         /// <summary>
         /// FloatProperty: SyncAnimOffset
         /// </summary>
-        public unsafe float SyncAnimOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float SyncAnimOffset;
 
         /// <summary>
         /// BoolProperty: bMirrored
         /// </summary>
-        public unsafe bool bMirrored
+        public bool bMirrored
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 1) != 0;
+            set { if (value) _bitfield36 |= 1; else _bitfield36 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bForceRestartAnim
         /// </summary>
-        public unsafe bool bForceRestartAnim
+        public bool bForceRestartAnim
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 2) != 0;
+            set { if (value) _bitfield36 |= 2; else _bitfield36 &= ~2; }
         }
 
         /// <summary>
@@ -206,11 +175,7 @@ public partial class RPhysUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: CinematicAnimName
         /// </summary>
-        public unsafe BmSDK.FName CinematicAnimName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public BmSDK.FName CinematicAnimName;
 
         /// <summary>
         /// ObjectProperty: CinematicStateExtraAnimSet
@@ -224,46 +189,46 @@ public partial class RPhysUtil : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: bTeleportCape
         /// </summary>
-        public unsafe bool bTeleportCape
+        public bool bTeleportCape
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }; }
+            readonly get => (_bitfield56 & 1) != 0;
+            set { if (value) _bitfield56 |= 1; else _bitfield56 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bCapeForceToAnimPoseOnTeleport
         /// </summary>
-        public unsafe bool bCapeForceToAnimPoseOnTeleport
+        public bool bCapeForceToAnimPoseOnTeleport
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }; }
+            readonly get => (_bitfield56 & 2) != 0;
+            set { if (value) _bitfield56 |= 2; else _bitfield56 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bCapeDoubleFrameTeleport
         /// </summary>
-        public unsafe bool bCapeDoubleFrameTeleport
+        public bool bCapeDoubleFrameTeleport
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }; }
+            readonly get => (_bitfield56 & 4) != 0;
+            set { if (value) _bitfield56 |= 4; else _bitfield56 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bClearVelocityOnStateExit
         /// </summary>
-        public unsafe bool bClearVelocityOnStateExit
+        public bool bClearVelocityOnStateExit
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }; }
+            readonly get => (_bitfield56 & 8) != 0;
+            set { if (value) _bitfield56 |= 8; else _bitfield56 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bSetCapeToInitialPose
         /// </summary>
-        public unsafe bool bSetCapeToInitialPose
+        public bool bSetCapeToInitialPose
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }; }
+            readonly get => (_bitfield56 & 16) != 0;
+            set { if (value) _bitfield56 |= 16; else _bitfield56 &= ~16; }
         }
     }
 
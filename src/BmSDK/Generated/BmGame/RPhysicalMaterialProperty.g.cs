@@ -78,45 +78,72 @@ public partial class RPhysicalMaterialProperty : BmSDK.Engine.PhysicalMaterialPr
         where TComponent : class, Framework.IScriptComponent<RPhysicalMaterialProperty>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SpawnActualHitEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 112)]
+    private struct SpawnActualHitEffect_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.Actor.FImpactInfo Impact;
+        [FieldOffset(88)] public BmSDK.BmGame.RPhysicalMaterialProperty.FImpactEffectInfo PhysImpactInfo;
+        [FieldOffset(100)] public int bPlaySound;
+    }
+
     /// <summary>
     /// Function: SpawnActualHitEffect
     /// </summary>
     public unsafe static void SpawnActualHitEffect(BmSDK.Engine.Actor.FImpactInfo Impact, BmSDK.BmGame.RPhysicalMaterialProperty.FImpactEffectInfo PhysImpactInfo, bool bPlaySound = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPhysicalMaterialProperty.SpawnActualHitEffect", true);
-        byte* paramsPtr = stackalloc byte[112];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Impact, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PhysImpactInfo, paramsPtr + 88);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlaySound, paramsPtr + 100);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnActualHitEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPhysicalMaterialProperty.SpawnActualHitEffect", true);
+        var parms = new SpawnActualHitEffect_Params();
+        parms.Impact = Impact;
+        parms.PhysImpactInfo = PhysImpactInfo;
+        parms.bPlaySound = bPlaySound ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnHitEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 100)]
+    private struct SpawnHitEffect_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.Actor.FImpactInfo Impact;
+        [FieldOffset(88)] public BmSDK.FName ImpactType;
+        [FieldOffset(96)] public int bPlaySound;
+    }
+
     /// <summary>
     /// Function: SpawnHitEffect
     /// </summary>
     public unsafe virtual void SpawnHitEffect(BmSDK.Engine.Actor.FImpactInfo Impact, BmSDK.FName ImpactType, bool bPlaySound = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPhysicalMaterialProperty.SpawnHitEffect", true);
-        byte* paramsPtr = stackalloc byte[100];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Impact, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ImpactType, paramsPtr + 88);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlaySound, paramsPtr + 96);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnHitEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPhysicalMaterialProperty.SpawnHitEffect", true);
+        var parms = new SpawnHitEffect_Params();
+        parms.Impact = Impact;
+        parms.ImpactType = ImpactType;
+        parms.bPlaySound = bPlaySound ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnHitDefaultEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 100)]
+    private struct SpawnHitDefaultEffect_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.Actor.FImpactInfo Impact;
+        [FieldOffset(88)] public BmSDK.FName ImpactType;
+        [FieldOffset(96)] public int bPlaySound;
+    }
+
     /// <summary>
     /// Function: SpawnHitDefaultEffect
     /// </summary>
     public unsafe static void SpawnHitDefaultEffect(BmSDK.Engine.Actor.FImpactInfo Impact, BmSDK.FName ImpactType, bool bPlaySound = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPhysicalMaterialProperty.SpawnHitDefaultEffect", true);
-        byte* paramsPtr = stackalloc byte[100];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Impact, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ImpactType, paramsPtr + 88);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPlaySound, paramsPtr + 96);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnHitDefaultEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPhysicalMaterialProperty.SpawnHitDefaultEffect", true);
+        var parms = new SpawnHitDefaultEffect_Params();
+        parms.Impact = Impact;
+        parms.ImpactType = ImpactType;
+        parms.bPlaySound = bPlaySound ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -129,11 +156,7 @@ public partial class RPhysicalMaterialProperty : BmSDK.Engine.PhysicalMaterialPr
         /// <summary>
         /// FloatProperty: AlertAINoise
         /// </summary>
-        public unsafe float AlertAINoise
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float AlertAINoise;
 
         /// <summary>
         /// ObjectProperty: SoundEvent
@@ -183,8 +206,8 @@ public partial class RPhysicalMaterialProperty : BmSDK.Engine.PhysicalMaterialPr
     /// </summary>
     public unsafe bool IsSurfaceWet
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 100); }
+        get { return (*(int*)(Ptr + 100) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 100) |= 1; else *(int*)(Ptr + 100) &= ~1; }
     }
 
     /// <summary>
@@ -211,13 +234,15 @@ public partial class RPhysicalMaterialProperty : BmSDK.Engine.PhysicalMaterialPr
     [StructLayout(LayoutKind.Explicit, Size = 20)]
     public partial record struct FMaterialFootstepInfo
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: bPlayParticleWhenWalking
         /// </summary>
-        public unsafe bool bPlayParticleWhenWalking
+        public bool bPlayParticleWhenWalking
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
@@ -73,14 +73,20 @@ public partial class RPlantPodHomingSmallBase : BmSDK.Engine.SkeletalMeshActor,
         where TComponent : class, Framework.IScriptComponent<RPlantPodHomingSmallBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_KillFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Kill_Params
+    {
+    }
+
     /// <summary>
     /// Function: Kill
     /// </summary>
     public unsafe virtual void Kill()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlantPodHomingSmallBase.Kill", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KillFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlantPodHomingSmallBase.Kill", true);
+        var parms = new Kill_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -78,15 +78,29 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
         where TComponent : class, Framework.IScriptComponent<RPlayerControllerCombat>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ForceDodgeProjectileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForceDodgeProjectile_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ForceDodgeProjectile
     /// </summary>
     public unsafe virtual bool ForceDodgeProjectile()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ForceDodgeProjectile", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ForceDodgeProjectileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ForceDodgeProjectile", true);
+        var parms = new ForceDodgeProjectile_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PCQuickGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PCQuickGadget_Params
+    {
+        [FieldOffset(0)] public int I;
     }
 
     /// <summary>
@@ -94,150 +108,238 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void PCQuickGadget(int I)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.PCQuickGadget", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(I, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PCQuickGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.PCQuickGadget", true);
+        var parms = new PCQuickGadget_Params();
+        parms.I = I;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_QuickGadgetBFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct QuickGadgetB_Params
+    {
+    }
+
     /// <summary>
     /// Function: QuickGadgetB
     /// </summary>
     public unsafe virtual void QuickGadgetB()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QuickGadgetB", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_QuickGadgetBFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QuickGadgetB", true);
+        var parms = new QuickGadgetB_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_QuickGadgetXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct QuickGadgetX_Params
+    {
+    }
+
     /// <summary>
     /// Function: QuickGadgetX
     /// </summary>
     public unsafe virtual void QuickGadgetX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QuickGadgetX", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_QuickGadgetXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QuickGadgetX", true);
+        var parms = new QuickGadgetX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_QuickGadgetYFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct QuickGadgetY_Params
+    {
+    }
+
     /// <summary>
     /// Function: QuickGadgetY
     /// </summary>
     public unsafe virtual void QuickGadgetY()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QuickGadgetY", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_QuickGadgetYFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QuickGadgetY", true);
+        var parms = new QuickGadgetY_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_QuickGadgetAFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct QuickGadgetA_Params
+    {
+    }
+
     /// <summary>
     /// Function: QuickGadgetA
     /// </summary>
     public unsafe virtual void QuickGadgetA()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QuickGadgetA", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_QuickGadgetAFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QuickGadgetA", true);
+        var parms = new QuickGadgetA_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerDamagePawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 248)]
+    private struct ServerDamagePawn_Params
+    {
+        [FieldOffset(0)] public nint Target;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo;
+    }
+
     /// <summary>
     /// Function: ServerDamagePawn
     /// </summary>
     public unsafe virtual void ServerDamagePawn(BmSDK.BmGame.RPawnVillain Target, BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerDamagePawn", true);
-        byte* paramsPtr = stackalloc byte[248];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DmgInfo, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerDamagePawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerDamagePawn", true);
+        var parms = new ServerDamagePawn_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        parms.DmgInfo = DmgInfo;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerDoHitPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ServerDoHitPawn_Params
+    {
+        [FieldOffset(0)] public nint DamageReceiver;
+        [FieldOffset(4)] public float DmgAmount;
+    }
+
     /// <summary>
     /// Function: ServerDoHitPawn
     /// </summary>
     public unsafe virtual void ServerDoHitPawn(BmSDK.BmGame.RPawnCombat DamageReceiver, float DmgAmount)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerDoHitPawn", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageReceiver, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DmgAmount, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerDoHitPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerDoHitPawn", true);
+        var parms = new ServerDoHitPawn_Params();
+        parms.DamageReceiver = DamageReceiver?.Ptr ?? 0;
+        parms.DmgAmount = DmgAmount;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnRegisterComboValueReachedActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UnRegisterComboValueReachedAction_Params
+    {
+        [FieldOffset(0)] public nint OldAction;
+    }
+
     /// <summary>
     /// Function: UnRegisterComboValueReachedAction
     /// </summary>
     public unsafe virtual void UnRegisterComboValueReachedAction(BmSDK.BmGame.RSeqAct_ComboValueReached OldAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UnRegisterComboValueReachedAction", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OldAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnRegisterComboValueReachedActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UnRegisterComboValueReachedAction", true);
+        var parms = new UnRegisterComboValueReachedAction_Params();
+        parms.OldAction = OldAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterComboValueReachedActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RegisterComboValueReachedAction_Params
+    {
+        [FieldOffset(0)] public nint NewAction;
+    }
+
     /// <summary>
     /// Function: RegisterComboValueReachedAction
     /// </summary>
     public unsafe virtual void RegisterComboValueReachedAction(BmSDK.BmGame.RSeqAct_ComboValueReached NewAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.RegisterComboValueReachedAction", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterComboValueReachedActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.RegisterComboValueReachedAction", true);
+        var parms = new RegisterComboValueReachedAction_Params();
+        parms.NewAction = NewAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LunaticBreakoutFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct LunaticBreakoutFinished_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 NewThrowDir;
+    }
+
     /// <summary>
     /// Function: LunaticBreakoutFinished
     /// </summary>
     public unsafe virtual void LunaticBreakoutFinished(System.Numerics.Vector3 NewThrowDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.LunaticBreakoutFinished", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewThrowDir, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LunaticBreakoutFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.LunaticBreakoutFinished", true);
+        var parms = new LunaticBreakoutFinished_Params();
+        parms.NewThrowDir = NewThrowDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableCapeStunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableCapeStun_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableCapeStun
     /// </summary>
     public unsafe virtual void EnableCapeStun()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.EnableCapeStun", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableCapeStunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.EnableCapeStun", true);
+        var parms = new EnableCapeStun_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableCapeStunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisableCapeStun_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisableCapeStun
     /// </summary>
     public unsafe override void DisableCapeStun()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DisableCapeStun", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableCapeStunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DisableCapeStun", true);
+        var parms = new DisableCapeStun_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanStaggerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CanStagger_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanStagger
     /// </summary>
     public unsafe override bool CanStagger()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanStagger", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanStaggerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanStagger", true);
+        var parms = new CanStagger_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_MakeBatmanLookAtEnemyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct MakeBatmanLookAtEnemy_Params
+    {
+        [FieldOffset(0)] public int bReset;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -245,11 +347,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe override bool MakeBatmanLookAtEnemy(bool bReset = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.MakeBatmanLookAtEnemy", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bReset, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_MakeBatmanLookAtEnemyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.MakeBatmanLookAtEnemy", true);
+        var parms = new MakeBatmanLookAtEnemy_Params();
+        parms.bReset = bReset ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ReadyGadgetOrCounterReleasedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReadyGadgetOrCounterReleased_Params
+    {
     }
 
     /// <summary>
@@ -257,170 +365,268 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ReadyGadgetOrCounterReleased()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ReadyGadgetOrCounterReleased", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReadyGadgetOrCounterReleasedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ReadyGadgetOrCounterReleased", true);
+        var parms = new ReadyGadgetOrCounterReleased_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MouseReadyGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct MouseReadyGadget_Params
+    {
+    }
+
     /// <summary>
     /// Function: MouseReadyGadget
     /// </summary>
     public unsafe virtual void MouseReadyGadget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.MouseReadyGadget", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MouseReadyGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.MouseReadyGadget", true);
+        var parms = new MouseReadyGadget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReadyGadgetOrCounterPressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReadyGadgetOrCounterPressed_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReadyGadgetOrCounterPressed
     /// </summary>
     public unsafe override void ReadyGadgetOrCounterPressed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ReadyGadgetOrCounterPressed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReadyGadgetOrCounterPressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ReadyGadgetOrCounterPressed", true);
+        var parms = new ReadyGadgetOrCounterPressed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GadgetOrQuickStrikePressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GadgetOrQuickStrikePressed_Params
+    {
+    }
+
     /// <summary>
     /// Function: GadgetOrQuickStrikePressed
     /// </summary>
     public unsafe virtual void GadgetOrQuickStrikePressed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GadgetOrQuickStrikePressed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GadgetOrQuickStrikePressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GadgetOrQuickStrikePressed", true);
+        var parms = new GadgetOrQuickStrikePressed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GrappleOrStrikeGadgetPressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GrappleOrStrikeGadgetPressed_Params
+    {
+    }
+
     /// <summary>
     /// Function: GrappleOrStrikeGadgetPressed
     /// </summary>
     public unsafe virtual void GrappleOrStrikeGadgetPressed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GrappleOrStrikeGadgetPressed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GrappleOrStrikeGadgetPressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GrappleOrStrikeGadgetPressed", true);
+        var parms = new GrappleOrStrikeGadgetPressed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterGameActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RegisterGameAction_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EGameAction Action;
+        [FieldOffset(4)] public nint XPTarget;
+        [FieldOffset(8)] public int XPAmount;
+    }
+
     /// <summary>
     /// Function: RegisterGameAction
     /// </summary>
     public unsafe override void RegisterGameAction(BmSDK.BmGame.RGameInfo.EGameAction Action, BmSDK.Engine.Actor XPTarget = default, int XPAmount = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.RegisterGameAction", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XPTarget, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XPAmount, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterGameActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.RegisterGameAction", true);
+        var parms = new RegisterGameAction_Params();
+        parms.Action = Action;
+        parms.XPTarget = XPTarget?.Ptr ?? 0;
+        parms.XPAmount = XPAmount;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Destroyed_Params
+    {
+    }
+
     /// <summary>
     /// Function: Destroyed
     /// </summary>
     public unsafe override void Destroyed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Destroyed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Destroyed", true);
+        var parms = new Destroyed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayImpactRumbleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlayImpactRumble_Params
+    {
+        [FieldOffset(0)] public float LeftAmp;
+        [FieldOffset(4)] public float RightAmp;
+        [FieldOffset(8)] public float Duration;
+    }
+
     /// <summary>
     /// Function: PlayImpactRumble
     /// </summary>
     public unsafe virtual void PlayImpactRumble(float LeftAmp = default, float RightAmp = default, float Duration = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.PlayImpactRumble", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LeftAmp, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RightAmp, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayImpactRumbleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.PlayImpactRumble", true);
+        var parms = new PlayImpactRumble_Params();
+        parms.LeftAmp = LeftAmp;
+        parms.RightAmp = RightAmp;
+        parms.Duration = Duration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NavManWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NavManWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: NavManWTF
     /// </summary>
     public unsafe virtual void NavManWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.NavManWTF", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NavManWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.NavManWTF", true);
+        var parms = new NavManWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AIWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AIWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: AIWTF
     /// </summary>
     public unsafe virtual void AIWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AIWTF", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AIWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AIWTF", true);
+        var parms = new AIWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TutorialWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct TutorialWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: TutorialWTF
     /// </summary>
     public unsafe virtual void TutorialWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TutorialWTF", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TutorialWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TutorialWTF", true);
+        var parms = new TutorialWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PairedAnimWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PairedAnimWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: PairedAnimWTF
     /// </summary>
     public unsafe virtual void PairedAnimWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.PairedAnimWTF", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PairedAnimWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.PairedAnimWTF", true);
+        var parms = new PairedAnimWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StrikeWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StrikeWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: StrikeWTF
     /// </summary>
     public unsafe virtual void StrikeWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.StrikeWTF", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StrikeWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.StrikeWTF", true);
+        var parms = new StrikeWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CombatWTFFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CombatWTF_Params
+    {
+    }
+
     /// <summary>
     /// Function: CombatWTF
     /// </summary>
     public unsafe virtual void CombatWTF()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CombatWTF", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatWTFFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CombatWTF", true);
+        var parms = new CombatWTF_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SuppressVenomCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SuppressVenomCamera_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SuppressVenomCamera
     /// </summary>
     public unsafe override bool SuppressVenomCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SuppressVenomCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_SuppressVenomCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SuppressVenomCamera", true);
+        var parms = new SuppressVenomCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SuppressCombatCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SuppressCombatCamera_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -428,10 +634,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe override bool SuppressCombatCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SuppressCombatCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_SuppressCombatCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SuppressCombatCamera", true);
+        var parms = new SuppressCombatCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShouldGoSlowMoOnNextHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShouldGoSlowMoOnNextHit_Params
+    {
+        [FieldOffset(0)] public int ComboInc;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -439,11 +653,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool ShouldGoSlowMoOnNextHit(int ComboInc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ShouldGoSlowMoOnNextHit", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboInc, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_ShouldGoSlowMoOnNextHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ShouldGoSlowMoOnNextHit", true);
+        var parms = new ShouldGoSlowMoOnNextHit_Params();
+        parms.ComboInc = ComboInc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateCombatCameraSuppressionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpdateCombatCameraSuppression_Params
+    {
     }
 
     /// <summary>
@@ -451,198 +671,300 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void UpdateCombatCameraSuppression()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateCombatCameraSuppression", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateCombatCameraSuppressionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateCombatCameraSuppression", true);
+        var parms = new UpdateCombatCameraSuppression_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CombatTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct CombatTick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: CombatTick
     /// </summary>
     public unsafe override void CombatTick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CombatTick", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CombatTick", true);
+        var parms = new CombatTick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnFinishedCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SpawnFinishedCombatMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnFinishedCombatMove
     /// </summary>
     public unsafe override void SpawnFinishedCombatMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnFinishedCombatMove", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnFinishedCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnFinishedCombatMove", true);
+        var parms = new SpawnFinishedCombatMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_QueueFinishedCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct QueueFinishedCombatMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: QueueFinishedCombatMove
     /// </summary>
     public unsafe virtual void QueueFinishedCombatMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QueueFinishedCombatMove", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_QueueFinishedCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.QueueFinishedCombatMove", true);
+        var parms = new QueueFinishedCombatMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetComboOnHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetComboOnHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetComboOnHUD
     /// </summary>
     public unsafe virtual void SetComboOnHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetComboOnHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetComboOnHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetComboOnHUD", true);
+        var parms = new SetComboOnHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateComboOnHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpdateComboOnHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateComboOnHUD
     /// </summary>
     public unsafe virtual void UpdateComboOnHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateComboOnHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateComboOnHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateComboOnHUD", true);
+        var parms = new UpdateComboOnHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActualClearLastStrikeDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActualClearLastStrikeDir_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActualClearLastStrikeDir
     /// </summary>
     public unsafe virtual void ActualClearLastStrikeDir()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ActualClearLastStrikeDir", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActualClearLastStrikeDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ActualClearLastStrikeDir", true);
+        var parms = new ActualClearLastStrikeDir_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearLastStrikeDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearLastStrikeDir_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearLastStrikeDir
     /// </summary>
     public unsafe virtual void ClearLastStrikeDir()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearLastStrikeDir", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearLastStrikeDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearLastStrikeDir", true);
+        var parms = new ClearLastStrikeDir_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLastStrikeDirFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetLastStrikeDir_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StrikeDir;
+    }
+
     /// <summary>
     /// Function: SetLastStrikeDir
     /// </summary>
     public unsafe virtual void SetLastStrikeDir(System.Numerics.Vector3 StrikeDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetLastStrikeDir", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StrikeDir, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLastStrikeDirFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetLastStrikeDir", true);
+        var parms = new SetLastStrikeDir_Params();
+        parms.StrikeDir = StrikeDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UntargettedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Untargetted_Params
+    {
+        [FieldOffset(0)] public nint Targetter;
+    }
+
     /// <summary>
     /// Function: Untargetted
     /// </summary>
     public unsafe virtual void Untargetted(BmSDK.BmGame.RPawnCombat Targetter)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Untargetted", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Targetter, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UntargettedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Untargetted", true);
+        var parms = new Untargetted_Params();
+        parms.Targetter = Targetter?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TargettedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Targetted_Params
+    {
+        [FieldOffset(0)] public nint Targetter;
+    }
+
     /// <summary>
     /// Function: Targetted
     /// </summary>
     public unsafe virtual void Targetted(BmSDK.BmGame.RPawnCombat Targetter)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Targetted", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Targetter, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TargettedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Targetted", true);
+        var parms = new Targetted_Params();
+        parms.Targetter = Targetter?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ZappedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Zapped_Params
+    {
+    }
+
     /// <summary>
     /// Function: Zapped
     /// </summary>
     public unsafe virtual void Zapped()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Zapped", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ZappedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Zapped", true);
+        var parms = new Zapped_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StunnedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Stunned_Params
+    {
+    }
+
     /// <summary>
     /// Function: Stunned
     /// </summary>
     public unsafe virtual void Stunned()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Stunned", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StunnedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.Stunned", true);
+        var parms = new Stunned_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckDodgeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckDodge_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+    }
+
     /// <summary>
     /// Function: CheckDodge
     /// </summary>
     public unsafe virtual void CheckDodge(BmSDK.BmGame.RPawnCombat Attacker)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CheckDodge", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckDodgeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CheckDodge", true);
+        var parms = new CheckDodge_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnRunningStunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnRunningStun_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnRunningStun
     /// </summary>
     public unsafe virtual void SpawnRunningStun()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnRunningStun", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnRunningStunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnRunningStun", true);
+        var parms = new SpawnRunningStun_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnRunningStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnRunningStrike_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnRunningStrike
     /// </summary>
     public unsafe virtual void SpawnRunningStrike()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnRunningStrike", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnRunningStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnRunningStrike", true);
+        var parms = new SpawnRunningStrike_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldShowSpecialPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldShowSpecialPrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldShowSpecialPrompt
     /// </summary>
     public unsafe virtual bool ShouldShowSpecialPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ShouldShowSpecialPrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldShowSpecialPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ShouldShowSpecialPrompt", true);
+        var parms = new ShouldShowSpecialPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpecialUnlockedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SpecialUnlocked_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -650,10 +972,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool SpecialUnlocked()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpecialUnlocked", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_SpecialUnlockedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpecialUnlocked", true);
+        var parms = new SpecialUnlocked_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanDoSecondaryGroupCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanDoSecondaryGroupCombatMove_Params
+    {
+        [FieldOffset(0)] public int bDoComboCountCheck;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -661,11 +991,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoSecondaryGroupCombatMove(bool bDoComboCountCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoSecondaryGroupCombatMove", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDoComboCountCheck, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanDoSecondaryGroupCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoSecondaryGroupCombatMove", true);
+        var parms = new CanDoSecondaryGroupCombatMove_Params();
+        parms.bDoComboCountCheck = bDoComboCountCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanDoPrimaryGroupCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanDoPrimaryGroupCombatMove_Params
+    {
+        [FieldOffset(0)] public int bDoComboCountCheck;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -673,11 +1011,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoPrimaryGroupCombatMove(bool bDoComboCountCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoPrimaryGroupCombatMove", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDoComboCountCheck, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanDoPrimaryGroupCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoPrimaryGroupCombatMove", true);
+        var parms = new CanDoPrimaryGroupCombatMove_Params();
+        parms.bDoComboCountCheck = bDoComboCountCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanDoWeaponDestroyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanDoWeaponDestroy_Params
+    {
+        [FieldOffset(0)] public int bDoComboCountCheck;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -685,11 +1031,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoWeaponDestroy(bool bDoComboCountCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoWeaponDestroy", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDoComboCountCheck, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanDoWeaponDestroyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoWeaponDestroy", true);
+        var parms = new CanDoWeaponDestroy_Params();
+        parms.bDoComboCountCheck = bDoComboCountCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanDoCombatTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanDoCombatTakedown_Params
+    {
+        [FieldOffset(0)] public int bDoComboCountCheck;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -697,11 +1051,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoCombatTakedown(bool bDoComboCountCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoCombatTakedown", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDoComboCountCheck, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanDoCombatTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoCombatTakedown", true);
+        var parms = new CanDoCombatTakedown_Params();
+        parms.bDoComboCountCheck = bDoComboCountCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanDoThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanDoThrow_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -709,10 +1070,22 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoThrow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoThrow", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanDoThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoThrow", true);
+        var parms = new CanDoThrow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ServerSpawnFailMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct ServerSpawnFailMove_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName FailAnim;
+        [FieldOffset(8)] public int bCanBecomeThrow;
+        [FieldOffset(12)] public int bCanBecomeTakedown;
+        [FieldOffset(16)] public int bCanBecomeFloorTakedown;
+        [FieldOffset(20)] public BmSDK.FName FailCapeState;
+        [FieldOffset(28)] public System.Numerics.Vector3 MoveDir;
     }
 
     /// <summary>
@@ -720,28 +1093,44 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ServerSpawnFailMove(BmSDK.FName FailAnim, bool bCanBecomeThrow, bool bCanBecomeTakedown, bool bCanBecomeFloorTakedown, BmSDK.FName FailCapeState, System.Numerics.Vector3 MoveDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerSpawnFailMove", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FailAnim, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanBecomeThrow, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanBecomeTakedown, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanBecomeFloorTakedown, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FailCapeState, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveDir, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerSpawnFailMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerSpawnFailMove", true);
+        var parms = new ServerSpawnFailMove_Params();
+        parms.FailAnim = FailAnim;
+        parms.bCanBecomeThrow = bCanBecomeThrow ? 1 : 0;
+        parms.bCanBecomeTakedown = bCanBecomeTakedown ? 1 : 0;
+        parms.bCanBecomeFloorTakedown = bCanBecomeFloorTakedown ? 1 : 0;
+        parms.FailCapeState = FailCapeState;
+        parms.MoveDir = MoveDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnInterrogationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SpawnInterrogation_Params
+    {
+        [FieldOffset(0)] public nint NewTarget;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SpawnInterrogation
     /// </summary>
     public unsafe virtual bool SpawnInterrogation(BmSDK.BmGame.RPawnVillain NewTarget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnInterrogation", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTarget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_SpawnInterrogationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnInterrogation", true);
+        var parms = new SpawnInterrogation_Params();
+        parms.NewTarget = NewTarget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpawnTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct SpawnTakedown_Params
+    {
+        [FieldOffset(0)] public int bOverrideCurrentMove;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -749,11 +1138,20 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool SpawnTakedown(bool bOverrideCurrentMove = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnTakedown", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOverrideCurrentMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_SpawnTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnTakedown", true);
+        var parms = new SpawnTakedown_Params();
+        parms.bOverrideCurrentMove = bOverrideCurrentMove ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsValidThrowTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct IsValidThrowTarget_Params
+    {
+        [FieldOffset(0)] public nint Target;
+        [FieldOffset(4)] public System.Numerics.Vector3 MoveDir;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -761,12 +1159,21 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool IsValidThrowTarget(BmSDK.BmGame.RPawnVillain Target, System.Numerics.Vector3 MoveDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsValidThrowTarget", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveDir, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_IsValidThrowTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsValidThrowTarget", true);
+        var parms = new IsValidThrowTarget_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        parms.MoveDir = MoveDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpawnWeaponDestroyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SpawnWeaponDestroy_Params
+    {
+        [FieldOffset(0)] public int bOverrideCurrentMove;
+        [FieldOffset(4)] public nint NewTarget;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -774,12 +1181,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool SpawnWeaponDestroy(bool bOverrideCurrentMove = default, BmSDK.BmGame.RPawnVillain NewTarget = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnWeaponDestroy", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOverrideCurrentMove, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTarget, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_SpawnWeaponDestroyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnWeaponDestroy", true);
+        var parms = new SpawnWeaponDestroy_Params();
+        parms.bOverrideCurrentMove = bOverrideCurrentMove ? 1 : 0;
+        parms.NewTarget = NewTarget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ServerCounterPressedSimulatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ServerCounterPressedSimulated_Params
+    {
     }
 
     /// <summary>
@@ -787,87 +1200,151 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ServerCounterPressedSimulated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerCounterPressedSimulated", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerCounterPressedSimulatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerCounterPressedSimulated", true);
+        var parms = new ServerCounterPressedSimulated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerStartSimultaneousCounterSimulatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct ServerStartSimultaneousCounterSimulated_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnCombat.SimultaneousCounterFormation FormationType;
+        [FieldOffset(4)] public int InfoIndex;
+        [FieldOffset(8)] public System.Numerics.Vector3 AnimLocation;
+        [FieldOffset(20)] public BmSDK.Rotator CounterRotation;
+    }
+
     /// <summary>
     /// Function: ServerStartSimultaneousCounterSimulated
     /// </summary>
     public unsafe virtual void ServerStartSimultaneousCounterSimulated(BmSDK.BmGame.RPawnCombat.SimultaneousCounterFormation FormationType, int InfoIndex, System.Numerics.Vector3 AnimLocation, BmSDK.Rotator CounterRotation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerStartSimultaneousCounterSimulated", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FormationType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InfoIndex, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimLocation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CounterRotation, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerStartSimultaneousCounterSimulatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerStartSimultaneousCounterSimulated", true);
+        var parms = new ServerStartSimultaneousCounterSimulated_Params();
+        parms.FormationType = FormationType;
+        parms.InfoIndex = InfoIndex;
+        parms.AnimLocation = AnimLocation;
+        parms.CounterRotation = CounterRotation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerRequestFailedPairedAnimMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct ServerRequestFailedPairedAnimMove_Params
+    {
+        [FieldOffset(0)] public nint Target;
+        [FieldOffset(4)] public BmSDK.FName AnimName;
+        [FieldOffset(12)] public System.Numerics.Vector3 AnimPos;
+        [FieldOffset(24)] public BmSDK.Rotator ThrowDir;
+    }
+
     /// <summary>
     /// Function: ServerRequestFailedPairedAnimMove
     /// </summary>
     public unsafe virtual void ServerRequestFailedPairedAnimMove(BmSDK.BmGame.RPawnVillain Target, BmSDK.FName AnimName, System.Numerics.Vector3 AnimPos, BmSDK.Rotator ThrowDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestFailedPairedAnimMove", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrowDir, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRequestFailedPairedAnimMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestFailedPairedAnimMove", true);
+        var parms = new ServerRequestFailedPairedAnimMove_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        parms.AnimName = AnimName;
+        parms.AnimPos = AnimPos;
+        parms.ThrowDir = ThrowDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerRequestThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct ServerRequestThrow_Params
+    {
+        [FieldOffset(0)] public nint Target;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayerCombat.FThrowInfo ThrowInfo;
+        [FieldOffset(28)] public System.Numerics.Vector3 AnimPos;
+        [FieldOffset(40)] public BmSDK.Rotator ThrowDir;
+        [FieldOffset(52)] public int bSetCapeState;
+        [FieldOffset(56)] public int bDirectThrow;
+    }
+
     /// <summary>
     /// Function: ServerRequestThrow
     /// </summary>
     public unsafe virtual void ServerRequestThrow(BmSDK.BmGame.RPawnVillain Target, BmSDK.BmGame.RPawnPlayerCombat.FThrowInfo ThrowInfo, System.Numerics.Vector3 AnimPos, BmSDK.Rotator ThrowDir, bool bSetCapeState, bool bDirectThrow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestThrow", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrowInfo, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPos, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrowDir, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSetCapeState, paramsPtr + 52);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDirectThrow, paramsPtr + 56);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRequestThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestThrow", true);
+        var parms = new ServerRequestThrow_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        parms.ThrowInfo = ThrowInfo;
+        parms.AnimPos = AnimPos;
+        parms.ThrowDir = ThrowDir;
+        parms.bSetCapeState = bSetCapeState ? 1 : 0;
+        parms.bDirectThrow = bDirectThrow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerRequestIntoThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct ServerRequestIntoThrow_Params
+    {
+        [FieldOffset(0)] public nint Target;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnCombat.TargetStrikeResponse TargetResponse;
+        [FieldOffset(8)] public BmSDK.Rotator MoveDir;
+        [FieldOffset(20)] public float TargetDist;
+        [FieldOffset(24)] public System.Numerics.Vector3 AnimPos;
+        [FieldOffset(36)] public float AnimRot;
+    }
+
     /// <summary>
     /// Function: ServerRequestIntoThrow
     /// </summary>
     public unsafe virtual void ServerRequestIntoThrow(BmSDK.BmGame.RPawnVillain Target, BmSDK.BmGame.RPawnCombat.TargetStrikeResponse TargetResponse, BmSDK.Rotator MoveDir, float TargetDist, System.Numerics.Vector3 AnimPos, float AnimRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestIntoThrow", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetResponse, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveDir, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetDist, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPos, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimRot, paramsPtr + 36);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRequestIntoThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestIntoThrow", true);
+        var parms = new ServerRequestIntoThrow_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        parms.TargetResponse = TargetResponse;
+        parms.MoveDir = MoveDir;
+        parms.TargetDist = TargetDist;
+        parms.AnimPos = AnimPos;
+        parms.AnimRot = AnimRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SpawnThrow_Params
+    {
+        [FieldOffset(0)] public int bOverrideCurrentMove;
+        [FieldOffset(4)] public nint NewTarget;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SpawnThrow
     /// </summary>
     public unsafe virtual bool SpawnThrow(bool bOverrideCurrentMove = default, BmSDK.BmGame.RPawnVillain NewTarget = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnThrow", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOverrideCurrentMove, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTarget, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_SpawnThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnThrow", true);
+        var parms = new SpawnThrow_Params();
+        parms.bOverrideCurrentMove = bOverrideCurrentMove ? 1 : 0;
+        parms.NewTarget = NewTarget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ServerRequestFloorTakedownSimulatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct ServerRequestFloorTakedownSimulated_Params
+    {
+        [FieldOffset(0)] public nint TargetPawn;
+        [FieldOffset(4)] public BmSDK.BmGame.RGameInfo.EGameAction ChallengeActionToTriggerIfSuccessful;
+        [FieldOffset(8)] public float TargetDist;
+        [FieldOffset(12)] public System.Numerics.Vector3 AnimPos;
+        [FieldOffset(24)] public System.Numerics.Vector3 FacingDir;
     }
 
     /// <summary>
@@ -875,27 +1352,42 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ServerRequestFloorTakedownSimulated(BmSDK.BmGame.RPawnVillain TargetPawn, BmSDK.BmGame.RGameInfo.EGameAction ChallengeActionToTriggerIfSuccessful, float TargetDist, System.Numerics.Vector3 AnimPos, System.Numerics.Vector3 FacingDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestFloorTakedownSimulated", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChallengeActionToTriggerIfSuccessful, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetDist, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPos, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FacingDir, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRequestFloorTakedownSimulatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestFloorTakedownSimulated", true);
+        var parms = new ServerRequestFloorTakedownSimulated_Params();
+        parms.TargetPawn = TargetPawn?.Ptr ?? 0;
+        parms.ChallengeActionToTriggerIfSuccessful = ChallengeActionToTriggerIfSuccessful;
+        parms.TargetDist = TargetDist;
+        parms.AnimPos = AnimPos;
+        parms.FacingDir = FacingDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryFloorTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TryFloorTakedown_Params
+    {
+        [FieldOffset(0)] public int bOverrideCurrentMove;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TryFloorTakedown
     /// </summary>
     public unsafe virtual bool TryFloorTakedown(bool bOverrideCurrentMove = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryFloorTakedown", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOverrideCurrentMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TryFloorTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryFloorTakedown", true);
+        var parms = new TryFloorTakedown_Params();
+        parms.bOverrideCurrentMove = bOverrideCurrentMove ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ServerRequestProjectileCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ServerRequestProjectileCounter_Params
+    {
+        [FieldOffset(0)] public nint ThrownObject;
     }
 
     /// <summary>
@@ -903,23 +1395,38 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ServerRequestProjectileCounter(BmSDK.BmGame.RBMCombatThrownObject ThrownObject)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestProjectileCounter", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrownObject, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRequestProjectileCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestProjectileCounter", true);
+        var parms = new ServerRequestProjectileCounter_Params();
+        parms.ThrownObject = ThrownObject?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryBossCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TryBossCounter_Params
+    {
+        [FieldOffset(0)] public nint targ;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TryBossCounter
     /// </summary>
     public unsafe virtual bool TryBossCounter(BmSDK.BmGame.RPawnVillain targ)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryBossCounter", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(targ, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TryBossCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryBossCounter", true);
+        var parms = new TryBossCounter_Params();
+        parms.targ = targ?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryProjectileCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct TryProjectileCounter_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -927,10 +1434,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TryProjectileCounter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryProjectileCounter", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_TryProjectileCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryProjectileCounter", true);
+        var parms = new TryProjectileCounter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct TryCounter_Params
+    {
+        [FieldOffset(0)] public int bCanFail;
+        [FieldOffset(4)] public float TimeInitiatedByPlayer;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -938,12 +1454,20 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TryCounter(bool bCanFail, float TimeInitiatedByPlayer = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryCounter", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanFail, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeInitiatedByPlayer, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_TryCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryCounter", true);
+        var parms = new TryCounter_Params();
+        parms.bCanFail = bCanFail ? 1 : 0;
+        parms.TimeInitiatedByPlayer = TimeInitiatedByPlayer;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryRasBurlyCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TryRasBurlyCounter_Params
+    {
+        [FieldOffset(0)] public int bCanStartMove;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -951,11 +1475,20 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TryRasBurlyCounter(bool bCanStartMove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryRasBurlyCounter", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanStartMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TryRasBurlyCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryRasBurlyCounter", true);
+        var parms = new TryRasBurlyCounter_Params();
+        parms.bCanStartMove = bCanStartMove ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TrySimultaneousCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct TrySimultaneousCounter_Params
+    {
+        [FieldOffset(0)] public int bCanStartMove;
+        [FieldOffset(4)] public float TimeInitiatedByPlayer;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -963,12 +1496,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TrySimultaneousCounter(bool bCanStartMove, float TimeInitiatedByPlayer)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TrySimultaneousCounter", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanStartMove, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeInitiatedByPlayer, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_TrySimultaneousCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TrySimultaneousCounter", true);
+        var parms = new TrySimultaneousCounter_Params();
+        parms.bCanStartMove = bCanStartMove ? 1 : 0;
+        parms.TimeInitiatedByPlayer = TimeInitiatedByPlayer;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryStunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TryStun_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -976,10 +1516,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TryStun()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryStun", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_TryStunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryStun", true);
+        var parms = new TryStun_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetStunMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStunMove_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -987,10 +1534,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.Class GetStunMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetStunMove", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetStunMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetStunMove", true);
+        var parms = new GetStunMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ServerSpawnSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ServerSpawnSpecialMove_Params
+    {
+        [FieldOffset(0)] public nint MoveClass;
+        [FieldOffset(4)] public System.Numerics.Vector3 AnimPos;
+        [FieldOffset(16)] public BmSDK.Rotator AnimRot;
     }
 
     /// <summary>
@@ -998,25 +1554,41 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ServerSpawnSpecialMove(BmSDK.Class MoveClass, System.Numerics.Vector3 AnimPos, BmSDK.Rotator AnimRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerSpawnSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimPos, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimRot, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerSpawnSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerSpawnSpecialMove", true);
+        var parms = new ServerSpawnSpecialMove_Params();
+        parms.MoveClass = MoveClass?.Ptr ?? 0;
+        parms.AnimPos = AnimPos;
+        parms.AnimRot = AnimRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsInBeatdownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsInBeatdown_Params
+    {
+        [FieldOffset(0)] public nint testVillain;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsInBeatdown
     /// </summary>
     public unsafe virtual bool IsInBeatdown(BmSDK.BmGame.RPawnVillain testVillain)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInBeatdown", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(testVillain, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsInBeatdownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInBeatdown", true);
+        var parms = new IsInBeatdown_Params();
+        parms.testVillain = testVillain?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct TryStrike_Params
+    {
+        [FieldOffset(0)] public float TimeInitiatedByPlayer;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1024,11 +1596,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TryStrike(float TimeInitiatedByPlayer = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryStrike", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeInitiatedByPlayer, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TryStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryStrike", true);
+        var parms = new TryStrike_Params();
+        parms.TimeInitiatedByPlayer = TimeInitiatedByPlayer;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetBatclawSlamTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetBatclawSlamTarget_Params
+    {
+        [FieldOffset(0)] public nint dmgType;
+        [FieldOffset(4)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1036,11 +1616,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RPawnVillain GetBatclawSlamTarget(BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetBatclawSlamTarget", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnVillain>(paramsPtr + 4);
+        var funcManaged = s_GetBatclawSlamTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetBatclawSlamTarget", true);
+        var parms = new GetBatclawSlamTarget_Params();
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RPawnVillain)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetQuickStrikeDamageTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetQuickStrikeDamageType_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1048,10 +1635,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.Class GetQuickStrikeDamageType()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetQuickStrikeDamageType", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetQuickStrikeDamageTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetQuickStrikeDamageType", true);
+        var parms = new GetQuickStrikeDamageType_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetQuickStrikeTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetQuickStrikeType_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1059,10 +1653,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.Class GetQuickStrikeType()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetQuickStrikeType", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetQuickStrikeTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetQuickStrikeType", true);
+        var parms = new GetQuickStrikeType_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetHeavyStrikeTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetHeavyStrikeType_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1070,10 +1671,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.Class GetHeavyStrikeType()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetHeavyStrikeType", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetHeavyStrikeTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetHeavyStrikeType", true);
+        var parms = new GetHeavyStrikeType_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetHeavyStrikeDamageTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetHeavyStrikeDamageType_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1081,10 +1689,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.Class GetHeavyStrikeDamageType()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetHeavyStrikeDamageType", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetHeavyStrikeDamageTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetHeavyStrikeDamageType", true);
+        var parms = new GetHeavyStrikeDamageType_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetCriticalStrikeDamageTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetCriticalStrikeDamageType_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1092,10 +1707,16 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.Class GetCriticalStrikeDamageType()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetCriticalStrikeDamageType", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 0);
+        var funcManaged = s_GetCriticalStrikeDamageTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetCriticalStrikeDamageType", true);
+        var parms = new GetCriticalStrikeDamageType_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_VenomFailedCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 248)]
+    private struct VenomFailedCounter_Params
+    {
     }
 
     /// <summary>
@@ -1103,98 +1724,155 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void VenomFailedCounter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomFailedCounter", true);
-        byte* paramsPtr = stackalloc byte[248];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_VenomFailedCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomFailedCounter", true);
+        var parms = new VenomFailedCounter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_VenomDismountOrStunCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct VenomDismountOrStunCounter_Params
+    {
+    }
+
     /// <summary>
     /// Function: VenomDismountOrStunCounter
     /// </summary>
     public unsafe virtual void VenomDismountOrStunCounter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomDismountOrStunCounter", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_VenomDismountOrStunCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomDismountOrStunCounter", true);
+        var parms = new VenomDismountOrStunCounter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_VenomCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct VenomCounter_Params
+    {
+    }
+
     /// <summary>
     /// Function: VenomCounter
     /// </summary>
     public unsafe virtual void VenomCounter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomCounter", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_VenomCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomCounter", true);
+        var parms = new VenomCounter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_VenomAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct VenomAttack_Params
+    {
+    }
+
     /// <summary>
     /// Function: VenomAttack
     /// </summary>
     public unsafe virtual void VenomAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomAttack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_VenomAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomAttack", true);
+        var parms = new VenomAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChargeVenomReleasedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ChargeVenomReleased_Params
+    {
+    }
+
     /// <summary>
     /// Function: ChargeVenomReleased
     /// </summary>
     public unsafe virtual void ChargeVenomReleased()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ChargeVenomReleased", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChargeVenomReleasedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ChargeVenomReleased", true);
+        var parms = new ChargeVenomReleased_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChargeVenomPressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ChargeVenomPressed_Params
+    {
+    }
+
     /// <summary>
     /// Function: ChargeVenomPressed
     /// </summary>
     public unsafe virtual void ChargeVenomPressed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ChargeVenomPressed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChargeVenomPressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ChargeVenomPressed", true);
+        var parms = new ChargeVenomPressed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_VenomShockwaveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct VenomShockwave_Params
+    {
+    }
+
     /// <summary>
     /// Function: VenomShockwave
     /// </summary>
     public unsafe virtual void VenomShockwave()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomShockwave", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_VenomShockwaveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.VenomShockwave", true);
+        var parms = new VenomShockwave_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartRunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartRun_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartRun
     /// </summary>
     public unsafe override void StartRun()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.StartRun", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartRunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.StartRun", true);
+        var parms = new StartRun_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerRideVenomFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TriggerRideVenom_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TriggerRideVenom
     /// </summary>
     public unsafe virtual bool TriggerRideVenom()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerRideVenom", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_TriggerRideVenomFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerRideVenom", true);
+        var parms = new TriggerRideVenom_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TriggerGroundTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TriggerGroundTakedown_Params
+    {
+        [FieldOffset(0)] public int bOverrideCurrentMove;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1202,11 +1880,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe override bool TriggerGroundTakedown(bool bOverrideCurrentMove = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerGroundTakedown", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOverrideCurrentMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TriggerGroundTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerGroundTakedown", true);
+        var parms = new TriggerGroundTakedown_Params();
+        parms.bOverrideCurrentMove = bOverrideCurrentMove ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TriggerCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TriggerCounter_Params
+    {
+        [FieldOffset(0)] public int bCanFail;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1214,11 +1900,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TriggerCounter(bool bCanFail)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerCounter", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanFail, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TriggerCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerCounter", true);
+        var parms = new TriggerCounter_Params();
+        parms.bCanFail = bCanFail ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RejectStealthTakeDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RejectStealthTakeDown_Params
+    {
     }
 
     /// <summary>
@@ -1226,21 +1918,35 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe override void RejectStealthTakeDown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.RejectStealthTakeDown", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RejectStealthTakeDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.RejectStealthTakeDown", true);
+        var parms = new RejectStealthTakeDown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryToStartCombatInterrogationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TryToStartCombatInterrogation_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TryToStartCombatInterrogation
     /// </summary>
     public unsafe virtual bool TryToStartCombatInterrogation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryToStartCombatInterrogation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_TryToStartCombatInterrogationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryToStartCombatInterrogation", true);
+        var parms = new TryToStartCombatInterrogation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryToStartCombatTakeDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TryToStartCombatTakeDown_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1248,10 +1954,16 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe override bool TryToStartCombatTakeDown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryToStartCombatTakeDown", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_TryToStartCombatTakeDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryToStartCombatTakeDown", true);
+        var parms = new TryToStartCombatTakeDown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BankPointsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BankPoints_Params
+    {
     }
 
     /// <summary>
@@ -1259,44 +1971,72 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void BankPoints()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.BankPoints", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BankPointsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.BankPoints", true);
+        var parms = new BankPoints_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BankPointsInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BankPointsInternal_Params
+    {
+    }
+
     /// <summary>
     /// Function: BankPointsInternal
     /// </summary>
     public unsafe virtual void BankPointsInternal()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.BankPointsInternal", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BankPointsInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.BankPointsInternal", true);
+        var parms = new BankPointsInternal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GrabReleasedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GrabReleased_Params
+    {
+    }
+
     /// <summary>
     /// Function: GrabReleased
     /// </summary>
     public unsafe override void GrabReleased()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GrabReleased", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GrabReleasedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GrabReleased", true);
+        var parms = new GrabReleased_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TrySecondaryGroupCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TrySecondaryGroupCombatMove_Params
+    {
+        [FieldOffset(0)] public int bOverrideCurrentMove;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TrySecondaryGroupCombatMove
     /// </summary>
     public unsafe virtual bool TrySecondaryGroupCombatMove(bool bOverrideCurrentMove = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TrySecondaryGroupCombatMove", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOverrideCurrentMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TrySecondaryGroupCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TrySecondaryGroupCombatMove", true);
+        var parms = new TrySecondaryGroupCombatMove_Params();
+        parms.bOverrideCurrentMove = bOverrideCurrentMove ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryPrimaryGroupCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TryPrimaryGroupCombatMove_Params
+    {
+        [FieldOffset(0)] public int bOverrideCurrentMove;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1304,11 +2044,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TryPrimaryGroupCombatMove(bool bOverrideCurrentMove = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryPrimaryGroupCombatMove", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOverrideCurrentMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TryPrimaryGroupCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryPrimaryGroupCombatMove", true);
+        var parms = new TryPrimaryGroupCombatMove_Params();
+        parms.bOverrideCurrentMove = bOverrideCurrentMove ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GrabPressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GrabPressed_Params
+    {
     }
 
     /// <summary>
@@ -1316,246 +2062,390 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe override void GrabPressed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GrabPressed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GrabPressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GrabPressed", true);
+        var parms = new GrabPressed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FloorTakedownModifierPressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FloorTakedownModifierPressed_Params
+    {
+    }
+
     /// <summary>
     /// Function: FloorTakedownModifierPressed
     /// </summary>
     public unsafe virtual void FloorTakedownModifierPressed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.FloorTakedownModifierPressed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FloorTakedownModifierPressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.FloorTakedownModifierPressed", true);
+        var parms = new FloorTakedownModifierPressed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BlockBreakerReleasedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BlockBreakerReleased_Params
+    {
+    }
+
     /// <summary>
     /// Function: BlockBreakerReleased
     /// </summary>
     public unsafe virtual void BlockBreakerReleased()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.BlockBreakerReleased", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BlockBreakerReleasedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.BlockBreakerReleased", true);
+        var parms = new BlockBreakerReleased_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerBlockBreakerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct TriggerBlockBreaker_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerBlockBreaker
     /// </summary>
     public unsafe virtual void TriggerBlockBreaker()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerBlockBreaker", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerBlockBreakerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerBlockBreaker", true);
+        var parms = new TriggerBlockBreaker_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerSecondaryGroupCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerSecondaryGroupCombatMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerSecondaryGroupCombatMove
     /// </summary>
     public unsafe virtual void TriggerSecondaryGroupCombatMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerSecondaryGroupCombatMove", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerSecondaryGroupCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerSecondaryGroupCombatMove", true);
+        var parms = new TriggerSecondaryGroupCombatMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerPrimaryGroupCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerPrimaryGroupCombatMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerPrimaryGroupCombatMove
     /// </summary>
     public unsafe virtual void TriggerPrimaryGroupCombatMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerPrimaryGroupCombatMove", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerPrimaryGroupCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerPrimaryGroupCombatMove", true);
+        var parms = new TriggerPrimaryGroupCombatMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerCombatTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerCombatTakedown_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerCombatTakedown
     /// </summary>
     public unsafe virtual void TriggerCombatTakedown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerCombatTakedown", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerCombatTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerCombatTakedown", true);
+        var parms = new TriggerCombatTakedown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerWeaponDestroyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerWeaponDestroy_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerWeaponDestroy
     /// </summary>
     public unsafe virtual void TriggerWeaponDestroy()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerWeaponDestroy", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerWeaponDestroyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerWeaponDestroy", true);
+        var parms = new TriggerWeaponDestroy_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerThrow_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerThrow
     /// </summary>
     public unsafe virtual void TriggerThrow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerThrow", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerThrow", true);
+        var parms = new TriggerThrow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerQuickStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct TriggerQuickStrike_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerQuickStrike
     /// </summary>
     public unsafe override void TriggerQuickStrike()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerQuickStrike", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerQuickStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TriggerQuickStrike", true);
+        var parms = new TriggerQuickStrike_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NewComboMoveStartedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NewComboMoveStarted_Params
+    {
+    }
+
     /// <summary>
     /// Function: NewComboMoveStarted
     /// </summary>
     public unsafe virtual void NewComboMoveStarted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.NewComboMoveStarted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NewComboMoveStartedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.NewComboMoveStarted", true);
+        var parms = new NewComboMoveStarted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateRunningTimersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateRunningTimers_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateRunningTimers
     /// </summary>
     public unsafe virtual void UpdateRunningTimers(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateRunningTimers", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateRunningTimersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateRunningTimers", true);
+        var parms = new UpdateRunningTimers_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnRoomChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnRoomChange_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnRoomChange
     /// </summary>
     public unsafe override void OnRoomChange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.OnRoomChange", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnRoomChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.OnRoomChange", true);
+        var parms = new OnRoomChange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyTakeDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct NotifyTakeDamage_Params
+    {
+        [FieldOffset(0)] public int Damage;
+        [FieldOffset(4)] public nint InstigatedBy;
+        [FieldOffset(8)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(20)] public System.Numerics.Vector3 Momentum;
+        [FieldOffset(32)] public nint DamageType;
+        [FieldOffset(36)] public BmSDK.Engine.Actor.FTraceHitInfo HitInfo;
+        [FieldOffset(72)] public nint DamageCauser;
+    }
+
     /// <summary>
     /// Function: NotifyTakeDamage
     /// </summary>
     public unsafe override void NotifyTakeDamage(int Damage, BmSDK.Engine.Controller InstigatedBy, System.Numerics.Vector3 HitLocation, System.Numerics.Vector3 Momentum, BmSDK.Class DamageType, BmSDK.Engine.Actor.FTraceHitInfo HitInfo = default, BmSDK.Engine.Actor DamageCauser = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.NotifyTakeDamage", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Damage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InstigatedBy, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Momentum, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitInfo, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageCauser, paramsPtr + 72);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyTakeDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.NotifyTakeDamage", true);
+        var parms = new NotifyTakeDamage_Params();
+        parms.Damage = Damage;
+        parms.InstigatedBy = InstigatedBy?.Ptr ?? 0;
+        parms.HitLocation = HitLocation;
+        parms.Momentum = Momentum;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        parms.HitInfo = HitInfo;
+        parms.DamageCauser = DamageCauser?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateCombatHitVarsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UpdateCombatHitVars_Params
+    {
+        [FieldOffset(0)] public nint InstigatedBy;
+        [FieldOffset(4)] public int Damage;
+        [FieldOffset(8)] public nint DamageType;
+    }
+
     /// <summary>
     /// Function: UpdateCombatHitVars
     /// </summary>
     public unsafe virtual void UpdateCombatHitVars(BmSDK.Engine.Controller InstigatedBy, int Damage, BmSDK.Class DamageType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateCombatHitVars", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InstigatedBy, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Damage, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateCombatHitVarsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateCombatHitVars", true);
+        var parms = new UpdateCombatHitVars_Params();
+        parms.InstigatedBy = InstigatedBy?.Ptr ?? 0;
+        parms.Damage = Damage;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetScoreOnHudFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetScoreOnHud_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetScoreOnHud
     /// </summary>
     public unsafe virtual void SetScoreOnHud()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetScoreOnHud", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetScoreOnHudFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetScoreOnHud", true);
+        var parms = new SetScoreOnHud_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddScore_Params
+    {
+        [FieldOffset(0)] public int Amount;
+    }
+
     /// <summary>
     /// Function: AddScore
     /// </summary>
     public unsafe virtual void AddScore(int Amount)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AddScore", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Amount, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AddScore", true);
+        var parms = new AddScore_Params();
+        parms.Amount = Amount;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddScoreForMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct AddScoreForMove_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EComboMoveType MoveType;
+        [FieldOffset(4)] public int ComboMultiplier;
+        [FieldOffset(8)] public nint Target;
+        [FieldOffset(12)] public int NumTargets;
+    }
+
     /// <summary>
     /// Function: AddScoreForMove
     /// </summary>
     public unsafe virtual void AddScoreForMove(BmSDK.BmGame.RGameInfo.EComboMoveType MoveType, int ComboMultiplier, BmSDK.BmGame.RPawnCombat Target, int NumTargets)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AddScoreForMove", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboMultiplier, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NumTargets, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddScoreForMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AddScoreForMove", true);
+        var parms = new AddScoreForMove_Params();
+        parms.MoveType = MoveType;
+        parms.ComboMultiplier = ComboMultiplier;
+        parms.Target = Target?.Ptr ?? 0;
+        parms.NumTargets = NumTargets;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOffCounterPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TurnOffCounterPrompt_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOffCounterPrompt
     /// </summary>
     public unsafe virtual void TurnOffCounterPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TurnOffCounterPrompt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOffCounterPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TurnOffCounterPrompt", true);
+        var parms = new TurnOffCounterPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOnCounterPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TurnOnCounterPrompt_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOnCounterPrompt
     /// </summary>
     public unsafe virtual void TurnOnCounterPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TurnOnCounterPrompt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOnCounterPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TurnOnCounterPrompt", true);
+        var parms = new TurnOnCounterPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetComboLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetComboLevel_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetComboLevel
     /// </summary>
     public unsafe virtual int GetComboLevel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetComboLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboLevel", true);
+        var parms = new GetComboLevel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanDoSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanDoSpecialMove_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1563,10 +2453,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoSpecialMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanDoSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoSpecialMove", true);
+        var parms = new CanDoSpecialMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpecialMoveTargetInRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SpecialMoveTargetInRange_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1574,10 +2471,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool SpecialMoveTargetInRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpecialMoveTargetInRange", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_SpecialMoveTargetInRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpecialMoveTargetInRange", true);
+        var parms = new SpecialMoveTargetInRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetComboLengthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetComboLength_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1585,10 +2489,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual int GetComboLength()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboLength", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetComboLengthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboLength", true);
+        var parms = new GetComboLength_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNumAwayFromComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetNumAwayFromCombo_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1596,10 +2507,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual int GetNumAwayFromCombo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetNumAwayFromCombo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetNumAwayFromComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetNumAwayFromCombo", true);
+        var parms = new GetNumAwayFromCombo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsInComboForSuperFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsInComboForSuper_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1607,10 +2525,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool IsInComboForSuper()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInComboForSuper", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsInComboForSuperFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInComboForSuper", true);
+        var parms = new IsInComboForSuper_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsInComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsInCombo_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1618,10 +2543,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool IsInCombo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInCombo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsInComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInCombo", true);
+        var parms = new IsInCombo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetComboMinLengthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetComboMinLength_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1629,10 +2561,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual int GetComboMinLength()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboMinLength", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetComboMinLengthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboMinLength", true);
+        var parms = new GetComboMinLength_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanContinueComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanContinueCombo_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1640,10 +2579,16 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanContinueCombo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanContinueCombo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanContinueComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanContinueCombo", true);
+        var parms = new CanContinueCombo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DisableComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisableCombo_Params
+    {
     }
 
     /// <summary>
@@ -1651,67 +2596,106 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void DisableCombo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DisableCombo", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DisableCombo", true);
+        var parms = new DisableCombo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ContinueComboTimerCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ContinueComboTimerComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: ContinueComboTimerComplete
     /// </summary>
     public unsafe virtual void ContinueComboTimerComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ContinueComboTimerComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ContinueComboTimerCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ContinueComboTimerComplete", true);
+        var parms = new ContinueComboTimerComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetContinueComboTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetContinueComboTimer_Params
+    {
+        [FieldOffset(0)] public float ComboWindow;
+    }
+
     /// <summary>
     /// Function: SetContinueComboTimer
     /// </summary>
     public unsafe virtual void SetContinueComboTimer(float ComboWindow = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetContinueComboTimer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboWindow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetContinueComboTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetContinueComboTimer", true);
+        var parms = new SetContinueComboTimer_Params();
+        parms.ComboWindow = ComboWindow;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ClearCombo_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearCombo
     /// </summary>
     public unsafe virtual void ClearCombo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearCombo", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearCombo", true);
+        var parms = new ClearCombo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetServerComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetServerCombo_Params
+    {
+        [FieldOffset(0)] public int NewAmount;
+    }
+
     /// <summary>
     /// Function: SetServerCombo
     /// </summary>
     public unsafe virtual void SetServerCombo(int NewAmount)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetServerCombo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewAmount, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetServerComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetServerCombo", true);
+        var parms = new SetServerCombo_Params();
+        parms.NewAmount = NewAmount;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCombatMoveDurationMultiFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetCombatMoveDurationMulti_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCombatMoveDurationMulti
     /// </summary>
     public unsafe virtual float GetCombatMoveDurationMulti()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetCombatMoveDurationMulti", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetCombatMoveDurationMultiFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetCombatMoveDurationMulti", true);
+        var parms = new GetCombatMoveDurationMulti_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ResetSuperComboModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetSuperComboMode_Params
+    {
     }
 
     /// <summary>
@@ -1719,34 +2703,56 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ResetSuperComboMode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetSuperComboMode", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetSuperComboModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetSuperComboMode", true);
+        var parms = new ResetSuperComboMode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSuperComboModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetSuperComboMode_Params
+    {
+        [FieldOffset(0)] public int NewComboAmount;
+    }
+
     /// <summary>
     /// Function: SetSuperComboMode
     /// </summary>
     public unsafe virtual void SetSuperComboMode(int NewComboAmount)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetSuperComboMode", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewComboAmount, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSuperComboModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetSuperComboMode", true);
+        var parms = new SetSuperComboMode_Params();
+        parms.NewComboAmount = NewComboAmount;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSuperComboModeProportionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetSuperComboModeProportion_Params
+    {
+        [FieldOffset(0)] public int TestComboSize;
+        [FieldOffset(4)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSuperComboModeProportion
     /// </summary>
     public unsafe virtual float GetSuperComboModeProportion(int TestComboSize)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetSuperComboModeProportion", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestComboSize, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetSuperComboModeProportionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetSuperComboModeProportion", true);
+        var parms = new GetSuperComboModeProportion_Params();
+        parms.TestComboSize = TestComboSize;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetSuperComboModePostProcessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSuperComboModePostProcess_Params
+    {
+        [FieldOffset(0)] public float ComboProportion;
     }
 
     /// <summary>
@@ -1754,22 +2760,36 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void SetSuperComboModePostProcess(float ComboProportion)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetSuperComboModePostProcess", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboProportion, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSuperComboModePostProcessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetSuperComboModePostProcess", true);
+        var parms = new SetSuperComboModePostProcess_Params();
+        parms.ComboProportion = ComboProportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCombatFOVModifierFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetCombatFOVModifier_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCombatFOVModifier
     /// </summary>
     public unsafe virtual int GetCombatFOVModifier()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetCombatFOVModifier", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetCombatFOVModifierFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetCombatFOVModifier", true);
+        var parms = new GetCombatFOVModifier_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateSuperComboModeFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UpdateSuperComboModeFX_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -1777,114 +2797,179 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void UpdateSuperComboModeFX(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateSuperComboModeFX", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateSuperComboModeFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.UpdateSuperComboModeFX", true);
+        var parms = new UpdateSuperComboModeFX_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DecComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DecCombo_Params
+    {
+    }
+
     /// <summary>
     /// Function: DecCombo
     /// </summary>
     public unsafe virtual void DecCombo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DecCombo", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DecComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DecCombo", true);
+        var parms = new DecCombo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct IncCombo_Params
+    {
+        [FieldOffset(0)] public nint PawnAttacked;
+        [FieldOffset(4)] public int IncAmount;
+        [FieldOffset(8)] public int IncSpecialMoveCount;
+    }
+
     /// <summary>
     /// Function: IncCombo
     /// </summary>
     public unsafe virtual void IncCombo(BmSDK.BmGame.RPawnCombat PawnAttacked = default, int IncAmount = default, int IncSpecialMoveCount = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IncCombo", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PawnAttacked, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IncAmount, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IncSpecialMoveCount, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IncCombo", true);
+        var parms = new IncCombo_Params();
+        parms.PawnAttacked = PawnAttacked?.Ptr ?? 0;
+        parms.IncAmount = IncAmount;
+        parms.IncSpecialMoveCount = IncSpecialMoveCount;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetComboIncCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetComboIncCue_Params
+    {
+        [FieldOffset(0)] public nint NewCue;
+    }
+
     /// <summary>
     /// Function: SetComboIncCue
     /// </summary>
     public unsafe virtual void SetComboIncCue(BmSDK.Engine.SoundCue NewCue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetComboIncCue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetComboIncCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetComboIncCue", true);
+        var parms = new SetComboIncCue_Params();
+        parms.NewCue = NewCue?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AwardXPBonusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AwardXPBonus_Params
+    {
+    }
+
     /// <summary>
     /// Function: AwardXPBonus
     /// </summary>
     public unsafe virtual void AwardXPBonus()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AwardXPBonus", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AwardXPBonusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AwardXPBonus", true);
+        var parms = new AwardXPBonus_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPredatorXPBonusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AddPredatorXPBonus_Params
+    {
+    }
+
     /// <summary>
     /// Function: AddPredatorXPBonus
     /// </summary>
     public unsafe virtual void AddPredatorXPBonus()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AddPredatorXPBonus", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPredatorXPBonusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AddPredatorXPBonus", true);
+        var parms = new AddPredatorXPBonus_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddCombatXPBonusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AddCombatXPBonus_Params
+    {
+    }
+
     /// <summary>
     /// Function: AddCombatXPBonus
     /// </summary>
     public unsafe virtual void AddCombatXPBonus()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AddCombatXPBonus", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddCombatXPBonusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.AddCombatXPBonus", true);
+        var parms = new AddCombatXPBonus_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetPerFightStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetPerFightStats_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetPerFightStats
     /// </summary>
     public unsafe virtual void ResetPerFightStats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetPerFightStats", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetPerFightStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetPerFightStats", true);
+        var parms = new ResetPerFightStats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetMaxComboSizeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetMaxComboSize_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetMaxComboSize
     /// </summary>
     public unsafe virtual void ResetMaxComboSize()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetMaxComboSize", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetMaxComboSizeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetMaxComboSize", true);
+        var parms = new ResetMaxComboSize_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetMaxComboSizeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetMaxComboSize_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetMaxComboSize
     /// </summary>
     public unsafe virtual int GetMaxComboSize()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetMaxComboSize", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetMaxComboSizeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetMaxComboSize", true);
+        var parms = new GetMaxComboSize_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IncCombosStartedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncCombosStarted_Params
+    {
     }
 
     /// <summary>
@@ -1892,21 +2977,35 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void IncCombosStarted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IncCombosStarted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncCombosStartedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IncCombosStarted", true);
+        var parms = new IncCombosStarted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAverageComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetAverageCombo_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAverageCombo
     /// </summary>
     public unsafe virtual int GetAverageCombo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetAverageCombo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetAverageComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetAverageCombo", true);
+        var parms = new GetAverageCombo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNumCombosStartedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetNumCombosStarted_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1914,10 +3013,16 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual int GetNumCombosStarted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetNumCombosStarted", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetNumCombosStartedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetNumCombosStarted", true);
+        var parms = new GetNumCombosStarted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ResetCombosStartedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetCombosStarted_Params
+    {
     }
 
     /// <summary>
@@ -1925,65 +3030,102 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ResetCombosStarted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetCombosStarted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetCombosStartedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetCombosStarted", true);
+        var parms = new ResetCombosStarted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnterComboFlowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnterComboFlow_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnterComboFlow
     /// </summary>
     public unsafe virtual void EnterComboFlow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.EnterComboFlow", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnterComboFlowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.EnterComboFlow", true);
+        var parms = new EnterComboFlow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OutputComboMovesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OutputComboMoves_Params
+    {
+    }
+
     /// <summary>
     /// Function: OutputComboMoves
     /// </summary>
     public unsafe virtual void OutputComboMoves()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.OutputComboMoves", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OutputComboMovesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.OutputComboMoves", true);
+        var parms = new OutputComboMoves_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearComboMovesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearComboMoves_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearComboMoves
     /// </summary>
     public unsafe virtual void ClearComboMoves()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearComboMoves", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearComboMovesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearComboMoves", true);
+        var parms = new ClearComboMoves_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMaxVariationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetMaxVariation_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetMaxVariation
     /// </summary>
     public unsafe virtual void SetMaxVariation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetMaxVariation", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMaxVariationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SetMaxVariation", true);
+        var parms = new SetMaxVariation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetMaxComboVariationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetMaxComboVariation_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetMaxComboVariation
     /// </summary>
     public unsafe virtual int GetMaxComboVariation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetMaxComboVariation", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetMaxComboVariationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetMaxComboVariation", true);
+        var parms = new GetMaxComboVariation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ResetComboMoveTypesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ResetComboMoveTypes_Params
+    {
     }
 
     /// <summary>
@@ -1991,54 +3133,86 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ResetComboMoveTypes()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetComboMoveTypes", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetComboMoveTypesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetComboMoveTypes", true);
+        var parms = new ResetComboMoveTypes_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetMaxComboVariationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetMaxComboVariation_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetMaxComboVariation
     /// </summary>
     public unsafe virtual void ResetMaxComboVariation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetMaxComboVariation", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetMaxComboVariationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetMaxComboVariation", true);
+        var parms = new ResetMaxComboVariation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SaveComboScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SaveComboScore_Params
+    {
+    }
+
     /// <summary>
     /// Function: SaveComboScore
     /// </summary>
     public unsafe virtual void SaveComboScore()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SaveComboScore", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SaveComboScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SaveComboScore", true);
+        var parms = new SaveComboScore_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetGadgetVariationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ResetGadgetVariation_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetGadgetVariation
     /// </summary>
     public unsafe virtual void ResetGadgetVariation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetGadgetVariation", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetGadgetVariationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ResetGadgetVariation", true);
+        var parms = new ResetGadgetVariation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetComboGadgetVariationScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetComboGadgetVariationScore_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetComboGadgetVariationScore
     /// </summary>
     public unsafe virtual int GetComboGadgetVariationScore()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboGadgetVariationScore", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetComboGadgetVariationScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboGadgetVariationScore", true);
+        var parms = new GetComboGadgetVariationScore_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetComboVariationScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetComboVariationScore_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2046,10 +3220,21 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual int GetComboVariationScore()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboVariationScore", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetComboVariationScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetComboVariationScore", true);
+        var parms = new GetComboVariationScore_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_MovePerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct MovePerformed_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EComboMoveType MoveType;
+        [FieldOffset(4)] public nint Target;
+        [FieldOffset(8)] public int bAddScore;
+        [FieldOffset(12)] public int ComboForScore;
+        [FieldOffset(16)] public int NumOfTargets;
     }
 
     /// <summary>
@@ -2057,51 +3242,79 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void MovePerformed(BmSDK.BmGame.RGameInfo.EComboMoveType MoveType, BmSDK.BmGame.RPawnCombat Target, bool bAddScore = default, int ComboForScore = default, int NumOfTargets = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.MovePerformed", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAddScore, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ComboForScore, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NumOfTargets, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MovePerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.MovePerformed", true);
+        var parms = new MovePerformed_Params();
+        parms.MoveType = MoveType;
+        parms.Target = Target?.Ptr ?? 0;
+        parms.bAddScore = bAddScore ? 1 : 0;
+        parms.ComboForScore = ComboForScore;
+        parms.NumOfTargets = NumOfTargets;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncTutorialProgressForMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IncTutorialProgressForMove_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EComboMoveType MoveType;
+        [FieldOffset(4)] public nint Target;
+    }
+
     /// <summary>
     /// Function: IncTutorialProgressForMove
     /// </summary>
     public unsafe virtual void IncTutorialProgressForMove(BmSDK.BmGame.RGameInfo.EComboMoveType MoveType, BmSDK.BmGame.RPawnCombat Target)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IncTutorialProgressForMove", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncTutorialProgressForMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IncTutorialProgressForMove", true);
+        var parms = new IncTutorialProgressForMove_Params();
+        parms.MoveType = MoveType;
+        parms.Target = Target?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BlockedByFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BlockedBy_Params
+    {
+        [FieldOffset(0)] public nint Villain;
+    }
+
     /// <summary>
     /// Function: BlockedBy
     /// </summary>
     public unsafe virtual void BlockedBy(BmSDK.BmGame.RPawnVillain Villain)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.BlockedBy", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Villain, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BlockedByFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.BlockedBy", true);
+        var parms = new BlockedBy_Params();
+        parms.Villain = Villain?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldShowAutoCombatHintsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldShowAutoCombatHints_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldShowAutoCombatHints
     /// </summary>
     public unsafe virtual bool ShouldShowAutoCombatHints()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ShouldShowAutoCombatHints", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldShowAutoCombatHintsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ShouldShowAutoCombatHints", true);
+        var parms = new ShouldShowAutoCombatHints_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClearHitsSinceCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearHitsSinceCounter_Params
+    {
     }
 
     /// <summary>
@@ -2109,32 +3322,52 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ClearHitsSinceCounter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearHitsSinceCounter", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearHitsSinceCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearHitsSinceCounter", true);
+        var parms = new ClearHitsSinceCounter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncHitsSinceCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncHitsSinceCounter_Params
+    {
+    }
+
     /// <summary>
     /// Function: IncHitsSinceCounter
     /// </summary>
     public unsafe virtual void IncHitsSinceCounter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IncHitsSinceCounter", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncHitsSinceCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IncHitsSinceCounter", true);
+        var parms = new IncHitsSinceCounter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanDoComboProjectileGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanDoComboProjectileGadget_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanDoComboProjectileGadget
     /// </summary>
     public unsafe virtual bool CanDoComboProjectileGadget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoComboProjectileGadget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanDoComboProjectileGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoComboProjectileGadget", true);
+        var parms = new CanDoComboProjectileGadget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanDoComboWhipFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanDoComboWhip_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2142,10 +3375,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoComboWhip()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoComboWhip", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanDoComboWhipFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoComboWhip", true);
+        var parms = new CanDoComboWhip_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanDoComboBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanDoComboBatarang_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2153,10 +3393,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoComboBatarang()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoComboBatarang", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanDoComboBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoComboBatarang", true);
+        var parms = new CanDoComboBatarang_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TryRedirectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct TryRedirect_Params
+    {
+        [FieldOffset(0)] public nint TargetPawn;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2164,11 +3412,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool TryRedirect(BmSDK.BmGame.RPawnVillain TargetPawn = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryRedirect", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TryRedirectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryRedirect", true);
+        var parms = new TryRedirect_Params();
+        parms.TargetPawn = TargetPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ServerLockProjectileThrowTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ServerLockProjectileThrowTarget_Params
+    {
+        [FieldOffset(0)] public nint ThrowTarget;
+        [FieldOffset(4)] public BmSDK.Rotator ThrowDir;
     }
 
     /// <summary>
@@ -2176,69 +3432,99 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void ServerLockProjectileThrowTarget(BmSDK.BmGame.RPawnVillain ThrowTarget, BmSDK.Rotator ThrowDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerLockProjectileThrowTarget", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrowTarget, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ThrowDir, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerLockProjectileThrowTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerLockProjectileThrowTarget", true);
+        var parms = new ServerLockProjectileThrowTarget_Params();
+        parms.ThrowTarget = ThrowTarget?.Ptr ?? 0;
+        parms.ThrowDir = ThrowDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerRequestEvadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ServerRequestEvade_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 EvadeDir;
+        [FieldOffset(12)] public BmSDK.FName EvadeName;
+    }
+
     /// <summary>
     /// Function: ServerRequestEvade
     /// </summary>
     public unsafe virtual void ServerRequestEvade(System.Numerics.Vector3 EvadeDir, BmSDK.FName EvadeName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestEvade", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EvadeDir, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EvadeName, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRequestEvadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ServerRequestEvade", true);
+        var parms = new ServerRequestEvade_Params();
+        parms.EvadeDir = EvadeDir;
+        parms.EvadeName = EvadeName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnEvadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SpawnEvade_Params
+    {
+        [FieldOffset(0)] public int bCanQueue;
+    }
+
     /// <summary>
     /// Function: SpawnEvade
     /// </summary>
     public unsafe override void SpawnEvade(bool bCanQueue = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnEvade", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanQueue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnEvadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.SpawnEvade", true);
+        var parms = new SpawnEvade_Params();
+        parms.bCanQueue = bCanQueue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryToQueueEvadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TryToQueueEvade_Params
+    {
+    }
+
     /// <summary>
     /// Function: TryToQueueEvade
     /// </summary>
     public unsafe virtual void TryToQueueEvade()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryToQueueEvade", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TryToQueueEvadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryToQueueEvade", true);
+        var parms = new TryToQueueEvade_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetWallEvadeInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct GetWallEvadeInfo_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Dir;
+        [FieldOffset(12)] public System.Numerics.Vector3 WallLocation;
+        [FieldOffset(24)] public System.Numerics.Vector3 WallNormal;
+        [FieldOffset(36)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetWallEvadeInfo
     /// </summary>
     public unsafe virtual bool GetWallEvadeInfo(System.Numerics.Vector3 Dir, out System.Numerics.Vector3 WallLocation, out System.Numerics.Vector3 WallNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetWallEvadeInfo", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Dir, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        WallLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        WallNormal = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 24);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 36);
+        var funcManaged = s_GetWallEvadeInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetWallEvadeInfo", true);
+        var parms = new GetWallEvadeInfo_Params();
+        parms.Dir = Dir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        WallLocation = parms.WallLocation;
+        WallNormal = parms.WallNormal;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DialogueModeTimeoutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DialogueModeTimeout_Params
+    {
     }
 
     /// <summary>
@@ -2246,123 +3532,200 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void DialogueModeTimeout()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DialogueModeTimeout", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DialogueModeTimeoutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DialogueModeTimeout", true);
+        var parms = new DialogueModeTimeout_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryingToSetDialogueModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TryingToSetDialogueMode_Params
+    {
+    }
+
     /// <summary>
     /// Function: TryingToSetDialogueMode
     /// </summary>
     public unsafe virtual void TryingToSetDialogueMode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryingToSetDialogueMode", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TryingToSetDialogueModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.TryingToSetDialogueMode", true);
+        var parms = new TryingToSetDialogueMode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoubleTapRunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoubleTapRun_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoubleTapRun
     /// </summary>
     public unsafe override void DoubleTapRun()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DoubleTapRun", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoubleTapRunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.DoubleTapRun", true);
+        var parms = new DoubleTapRun_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearLastTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearLastTarget_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearLastTarget
     /// </summary>
     public unsafe virtual void ClearLastTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearLastTarget", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearLastTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ClearLastTarget", true);
+        var parms = new ClearLastTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CombatMoveFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CombatMoveFinished_Params
+    {
+        [FieldOffset(0)] public nint FinishedMove;
+    }
+
     /// <summary>
     /// Function: CombatMoveFinished
     /// </summary>
     public unsafe virtual void CombatMoveFinished(BmSDK.BmGame.RCombatMove FinishedMove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CombatMoveFinished", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishedMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatMoveFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CombatMoveFinished", true);
+        var parms = new CombatMoveFinished_Params();
+        parms.FinishedMove = FinishedMove?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CombatMoveInitialisedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CombatMoveInitialised_Params
+    {
+    }
+
     /// <summary>
     /// Function: CombatMoveInitialised
     /// </summary>
     public unsafe virtual void CombatMoveInitialised()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CombatMoveInitialised", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CombatMoveInitialisedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CombatMoveInitialised", true);
+        var parms = new CombatMoveInitialised_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetHelpPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetHelpPrompt_Params
+    {
+        [FieldOffset(0)] public nint HelpPrompt;
+        [FieldOffset(4)] public int bKismetHelpOn;
+    }
+
     /// <summary>
     /// Function: GetHelpPrompt
     /// </summary>
     public unsafe override void GetHelpPrompt(BmSDK.BmGame.RHUDPrompt HelpPrompt, bool bKismetHelpOn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetHelpPrompt", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HelpPrompt, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bKismetHelpOn, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GetHelpPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetHelpPrompt", true);
+        var parms = new GetHelpPrompt_Params();
+        parms.HelpPrompt = HelpPrompt?.Ptr ?? 0;
+        parms.bKismetHelpOn = bKismetHelpOn ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ShowTutorial_Params
+    {
+        [FieldOffset(0)] public nint HelpPrompt;
+        [FieldOffset(4)] public BmSDK.BmGame.RPersistentData.ETutorialType TutorialToShow;
+    }
+
     /// <summary>
     /// Function: ShowTutorial
     /// </summary>
     public unsafe virtual void ShowTutorial(BmSDK.BmGame.RHUDPrompt HelpPrompt, BmSDK.BmGame.RPersistentData.ETutorialType TutorialToShow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ShowTutorial", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HelpPrompt, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TutorialToShow, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.ShowTutorial", true);
+        var parms = new ShowTutorial_Params();
+        parms.HelpPrompt = HelpPrompt?.Ptr ?? 0;
+        parms.TutorialToShow = TutorialToShow;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetHighestPriorityTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct GetHighestPriorityTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType BestTutorial;
+        [FieldOffset(4)] public BmSDK.FString BestTutorialPrompt;
+        [FieldOffset(16)] public BmSDK.BmGame.RHUDPrompt.EControlIcon BestControlIcon;
+        [FieldOffset(20)] public int bShowTutorial;
+    }
+
     /// <summary>
     /// Function: GetHighestPriorityTutorial
     /// </summary>
     public unsafe virtual void GetHighestPriorityTutorial(out BmSDK.BmGame.RPersistentData.ETutorialType BestTutorial, out BmSDK.FString BestTutorialPrompt, out BmSDK.BmGame.RHUDPrompt.EControlIcon BestControlIcon, out int bShowTutorial)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetHighestPriorityTutorial", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        BestTutorial = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.ETutorialType>(paramsPtr + 0);
-        BestTutorialPrompt = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
-        BestControlIcon = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RHUDPrompt.EControlIcon>(paramsPtr + 16);
-        bShowTutorial = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 20);
+        var funcManaged = s_GetHighestPriorityTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetHighestPriorityTutorial", true);
+        var parms = new GetHighestPriorityTutorial_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        BestTutorial = parms.BestTutorial;
+        BestTutorialPrompt = parms.BestTutorialPrompt;
+        BestControlIcon = parms.BestControlIcon;
+        bShowTutorial = parms.bShowTutorial;
         return;
     }
 
+    static BmSDK.Function s_CheckTutorialFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct CheckTutorial_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPersistentData.ETutorialType CheckTutorialType;
+        [FieldOffset(4)] public int BestPriority;
+        [FieldOffset(8)] public BmSDK.BmGame.RPersistentData.ETutorialType BestTutorial;
+        [FieldOffset(12)] public BmSDK.FString BestPrompt;
+        [FieldOffset(24)] public int bShowTutorial;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckTutorial
     /// </summary>
     public unsafe virtual bool CheckTutorial(BmSDK.BmGame.RPersistentData.ETutorialType CheckTutorialType, out int BestPriority, out BmSDK.BmGame.RPersistentData.ETutorialType BestTutorial, out BmSDK.FString BestPrompt, out int bShowTutorial)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CheckTutorial", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckTutorialType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        BestPriority = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
-        BestTutorial = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.ETutorialType>(paramsPtr + 8);
-        BestPrompt = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
-        bShowTutorial = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 24);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_CheckTutorialFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CheckTutorial", true);
+        var parms = new CheckTutorial_Params();
+        parms.CheckTutorialType = CheckTutorialType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        BestPriority = parms.BestPriority;
+        BestTutorial = parms.BestTutorial;
+        BestPrompt = parms.BestPrompt;
+        bShowTutorial = parms.bShowTutorial;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanTriggerCombatInterrogationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct CanTriggerCombatInterrogation_Params
+    {
+        [FieldOffset(0)] public int bCheckValidContext;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2370,11 +3733,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanTriggerCombatInterrogation(bool bCheckValidContext = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanTriggerCombatInterrogation", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCheckValidContext, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanTriggerCombatInterrogationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanTriggerCombatInterrogation", true);
+        var parms = new CanTriggerCombatInterrogation_Params();
+        parms.bCheckValidContext = bCheckValidContext ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsInCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsInCombat_Params
+    {
+        [FieldOffset(0)] public int bForceCheck;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2382,11 +3753,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe override bool IsInCombat(bool bForceCheck = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInCombat", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceCheck, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsInCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInCombat", true);
+        var parms = new IsInCombat_Params();
+        parms.bForceCheck = bForceCheck ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetCMFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetCM_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -2394,10 +3772,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe override BmSDK.BmGame.RBMCombatManager GetCM()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetCM", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMCombatManager>(paramsPtr + 0);
+        var funcManaged = s_GetCMFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetCM", true);
+        var parms = new GetCM_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RBMCombatManager)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_FindFloorTakedownTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct FindFloorTakedownTarget_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -2405,10 +3790,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RPawnVillain FindFloorTakedownTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.FindFloorTakedownTarget", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnVillain>(paramsPtr + 0);
+        var funcManaged = s_FindFloorTakedownTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.FindFloorTakedownTarget", true);
+        var parms = new FindFloorTakedownTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RPawnVillain)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_InputHeadingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct InputHeading_Params
+    {
+        [FieldOffset(0)] public int bCanBeZero;
+        [FieldOffset(4)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -2416,11 +3809,18 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 InputHeading(bool bCanBeZero = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.InputHeading", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanBeZero, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_InputHeadingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.InputHeading", true);
+        var parms = new InputHeading_Params();
+        parms.bCanBeZero = bCanBeZero ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_HasMovementInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct HasMovementInput_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2428,10 +3828,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool HasMovementInput()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.HasMovementInput", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasMovementInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.HasMovementInput", true);
+        var parms = new HasMovementInput_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsBatarangPrimedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsBatarangPrimed_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2439,10 +3846,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool IsBatarangPrimed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsBatarangPrimed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsBatarangPrimedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsBatarangPrimed", true);
+        var parms = new IsBatarangPrimed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetZapTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetZapTime_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -2450,10 +3864,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual float GetZapTime()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetZapTime", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetZapTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetZapTime", true);
+        var parms = new GetZapTime_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetStunTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStunTime_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -2461,10 +3882,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual float GetStunTime()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetStunTime", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetStunTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetStunTime", true);
+        var parms = new GetStunTime_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanDoCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CanDoCombat_Params
+    {
+        [FieldOffset(0)] public int CheckForEvade;
+        [FieldOffset(4)] public int bDebugOutput;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2472,12 +3902,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool CanDoCombat(bool CheckForEvade = default, bool bDebugOutput = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoCombat", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckForEvade, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDebugOutput, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_CanDoCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.CanDoCombat", true);
+        var parms = new CanDoCombat_Params();
+        parms.CheckForEvade = CheckForEvade ? 1 : 0;
+        parms.bDebugOutput = bDebugOutput ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsZappedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsZapped_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2485,10 +3922,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool IsZapped()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsZapped", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsZappedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsZapped", true);
+        var parms = new IsZapped_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsStunnedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsStunned_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2496,10 +3940,17 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool IsStunned()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsStunned", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsStunnedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsStunned", true);
+        var parms = new IsStunned_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HasBeenHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasBeenHit_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2507,10 +3958,16 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool HasBeenHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.HasBeenHit", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasBeenHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.HasBeenHit", true);
+        var parms = new HasBeenHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StartBeenHitCheckFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartBeenHitCheck_Params
+    {
     }
 
     /// <summary>
@@ -2518,21 +3975,34 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void StartBeenHitCheck()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.StartBeenHitCheck", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartBeenHitCheckFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.StartBeenHitCheck", true);
+        var parms = new StartBeenHitCheck_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasEverBeenHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasEverBeenHit_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasEverBeenHit
     /// </summary>
     public unsafe virtual bool HasEverBeenHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.HasEverBeenHit", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasEverBeenHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.HasEverBeenHit", true);
+        var parms = new HasEverBeenHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StartEverBeenHitCheckFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartEverBeenHitCheck_Params
+    {
     }
 
     /// <summary>
@@ -2540,28 +4010,38 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual void StartEverBeenHitCheck()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.StartEverBeenHitCheck", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartEverBeenHitCheckFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.StartEverBeenHitCheck", true);
+        var parms = new StartEverBeenHitCheck_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsInCombatForDialogueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsInCombatForDialogue_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsInCombatForDialogue
     /// </summary>
     public unsafe virtual bool IsInCombatForDialogue()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInCombatForDialogue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsInCombatForDialogueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsInCombatForDialogue", true);
+        var parms = new IsInCombatForDialogue_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsValidStrikeTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct IsValidStrikeTarget_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 FacingDir;
+        [FieldOffset(12)] public nint dmgType;
+        [FieldOffset(16)] public nint TestPawn;
+        [FieldOffset(20)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2569,20 +4049,22 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual bool IsValidStrikeTarget(System.Numerics.Vector3 FacingDir, BmSDK.Class dmgType, BmSDK.BmGame.RPawnVillain TestPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsValidStrikeTarget", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FacingDir, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPawn, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 20);
+        var funcManaged = s_IsValidStrikeTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.IsValidStrikeTarget", true);
+        var parms = new IsValidStrikeTarget_Params();
+        parms.FacingDir = FacingDir;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        parms.TestPawn = TestPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FindStrikeTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct FindStrikeTarget_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 FacingDir;
+        [FieldOffset(12)] public nint dmgType;
+        [FieldOffset(16)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -2590,19 +4072,19 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RPawnVillain FindStrikeTarget(System.Numerics.Vector3 FacingDir, BmSDK.Class dmgType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.FindStrikeTarget", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FacingDir, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnVillain>(paramsPtr + 16);
+        var funcManaged = s_FindStrikeTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.FindStrikeTarget", true);
+        var parms = new FindStrikeTarget_Params();
+        parms.FacingDir = FacingDir;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RPawnVillain)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetLookAtEnemyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetLookAtEnemy_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -2610,17 +4092,10 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RPawnCombat GetLookAtEnemy()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetLookAtEnemy", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnCombat>(paramsPtr + 0);
+        var funcManaged = s_GetLookAtEnemyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerControllerCombat.GetLookAtEnemy", true);
+        var parms = new GetLookAtEnemy_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RPawnCombat)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -2632,20 +4107,12 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
         /// <summary>
         /// ByteProperty: MoveType
         /// </summary>
-        public unsafe BmSDK.BmGame.RGameInfo.EComboMoveType MoveType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EComboMoveType>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EComboMoveType MoveType;
 
         /// <summary>
         /// IntProperty: MoveNum
         /// </summary>
-        public unsafe int MoveNum
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int MoveNum;
     }
 
     /// <summary>
@@ -2666,11 +4133,7 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
         /// <summary>
         /// IntProperty: ConsecutiveHits
         /// </summary>
-        public unsafe int ConsecutiveHits
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int ConsecutiveHits;
     }
 
     /// <summary>
@@ -2687,8 +4150,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bStunned
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 1; else *(int*)(Ptr + 4464) &= ~1; }
     }
 
     /// <summary>
@@ -2696,8 +4159,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bZapped
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 2; else *(int*)(Ptr + 4464) &= ~2; }
     }
 
     /// <summary>
@@ -2705,8 +4168,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bSuppressCombatCameraInCorridor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 4; else *(int*)(Ptr + 4464) &= ~4; }
     }
 
     /// <summary>
@@ -2714,8 +4177,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bPlayFinishedCombatMoveWhenAble
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 8; else *(int*)(Ptr + 4464) &= ~8; }
     }
 
     /// <summary>
@@ -2723,8 +4186,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bAllowCombo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 16; else *(int*)(Ptr + 4464) &= ~16; }
     }
 
     /// <summary>
@@ -2732,8 +4195,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bForceSpecialCombo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 32; else *(int*)(Ptr + 4464) &= ~32; }
     }
 
     /// <summary>
@@ -2741,8 +4204,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 64; else *(int*)(Ptr + 4464) &= ~64; }
     }
 
     /// <summary>
@@ -2750,8 +4213,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bEverBeenHit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 128; else *(int*)(Ptr + 4464) &= ~128; }
     }
 
     /// <summary>
@@ -2759,8 +4222,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByStunStick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 256; else *(int*)(Ptr + 4464) &= ~256; }
     }
 
     /// <summary>
@@ -2768,8 +4231,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByKnife
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 512; else *(int*)(Ptr + 4464) &= ~512; }
     }
 
     /// <summary>
@@ -2777,8 +4240,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitBySword
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 1024; else *(int*)(Ptr + 4464) &= ~1024; }
     }
 
     /// <summary>
@@ -2786,8 +4249,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByCombatGun
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 2048; else *(int*)(Ptr + 4464) &= ~2048; }
     }
 
     /// <summary>
@@ -2795,8 +4258,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitBySimultaneousAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 4096; else *(int*)(Ptr + 4464) &= ~4096; }
     }
 
     /// <summary>
@@ -2804,8 +4267,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByArmouredThug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 8192; else *(int*)(Ptr + 4464) &= ~8192; }
     }
 
     /// <summary>
@@ -2813,8 +4276,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByShieldThug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 16384; else *(int*)(Ptr + 4464) &= ~16384; }
     }
 
     /// <summary>
@@ -2822,8 +4285,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByLieutenant
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 32768; else *(int*)(Ptr + 4464) &= ~32768; }
     }
 
     /// <summary>
@@ -2831,8 +4294,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByTitanHenchman
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 65536; else *(int*)(Ptr + 4464) &= ~65536; }
     }
 
     /// <summary>
@@ -2840,8 +4303,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByProjectile
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 131072; else *(int*)(Ptr + 4464) &= ~131072; }
     }
 
     /// <summary>
@@ -2849,8 +4312,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitBySniper
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 262144; else *(int*)(Ptr + 4464) &= ~262144; }
     }
 
     /// <summary>
@@ -2858,8 +4321,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bBeenHitByMine
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 524288; else *(int*)(Ptr + 4464) &= ~524288; }
     }
 
     /// <summary>
@@ -2867,8 +4330,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bSpottedByThermal
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 1048576; else *(int*)(Ptr + 4464) &= ~1048576; }
     }
 
     /// <summary>
@@ -2876,8 +4339,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bTryingToSetDialogueMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 2097152; else *(int*)(Ptr + 4464) &= ~2097152; }
     }
 
     /// <summary>
@@ -2885,8 +4348,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bShowEvadePrompt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 4194304; else *(int*)(Ptr + 4464) &= ~4194304; }
     }
 
     /// <summary>
@@ -2894,8 +4357,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bShowQuickBatarangPrompt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 8388608; else *(int*)(Ptr + 4464) &= ~8388608; }
     }
 
     /// <summary>
@@ -2903,8 +4366,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bCanDoComboBatarang
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 16777216; else *(int*)(Ptr + 4464) &= ~16777216; }
     }
 
     /// <summary>
@@ -2912,8 +4375,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bMirroredFailAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 33554432; else *(int*)(Ptr + 4464) &= ~33554432; }
     }
 
     /// <summary>
@@ -2921,8 +4384,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bUseComboIncCue
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 67108864; else *(int*)(Ptr + 4464) &= ~67108864; }
     }
 
     /// <summary>
@@ -2930,8 +4393,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bLieutenantStrikeHelp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 134217728; else *(int*)(Ptr + 4464) &= ~134217728; }
     }
 
     /// <summary>
@@ -2939,8 +4402,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bDisallowCombat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 268435456; else *(int*)(Ptr + 4464) &= ~268435456; }
     }
 
     /// <summary>
@@ -2948,8 +4411,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bCapeStunDisabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 536870912; else *(int*)(Ptr + 4464) &= ~536870912; }
     }
 
     /// <summary>
@@ -2957,8 +4420,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bInSuperComboMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= 1073741824; else *(int*)(Ptr + 4464) &= ~1073741824; }
     }
 
     /// <summary>
@@ -2966,8 +4429,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bAllowInteractionMidCombat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4464); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4464); }
+        get { return (*(int*)(Ptr + 4464) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 4464) |= -2147483648; else *(int*)(Ptr + 4464) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -2975,8 +4438,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bNextCombatMoveClearsSuperComboMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4468) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4468); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4468); }
+        get { return (*(int*)(Ptr + 4468) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 4468) |= 1; else *(int*)(Ptr + 4468) &= ~1; }
     }
 
     /// <summary>
@@ -2984,8 +4447,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe bool bCouldDoCombatWhenCounterPressed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4468) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4468); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4468); }
+        get { return (*(int*)(Ptr + 4468) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 4468) |= 2; else *(int*)(Ptr + 4468) &= ~2; }
     }
 
     /// <summary>
@@ -2993,8 +4456,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float StunnedTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4472); }
+        get { return *(float*)(Ptr + 4472); }
+        set { *(float*)(Ptr + 4472) = value; }
     }
 
     /// <summary>
@@ -3002,8 +4465,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float ZappedTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4476); }
+        get { return *(float*)(Ptr + 4476); }
+        set { *(float*)(Ptr + 4476) = value; }
     }
 
     /// <summary>
@@ -3029,8 +4492,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int ComboSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4488); }
+        get { return *(int*)(Ptr + 4488); }
+        set { *(int*)(Ptr + 4488) = value; }
     }
 
     /// <summary>
@@ -3038,8 +4501,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int CurrMaxComboSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4492); }
+        get { return *(int*)(Ptr + 4492); }
+        set { *(int*)(Ptr + 4492) = value; }
     }
 
     /// <summary>
@@ -3047,8 +4510,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int TotalMaxComboSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4496); }
+        get { return *(int*)(Ptr + 4496); }
+        set { *(int*)(Ptr + 4496) = value; }
     }
 
     /// <summary>
@@ -3056,8 +4519,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int NumTimesHit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4500); }
+        get { return *(int*)(Ptr + 4500); }
+        set { *(int*)(Ptr + 4500) = value; }
     }
 
     /// <summary>
@@ -3065,8 +4528,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int CombatScore
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4504); }
+        get { return *(int*)(Ptr + 4504); }
+        set { *(int*)(Ptr + 4504) = value; }
     }
 
     /// <summary>
@@ -3089,8 +4552,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float RunningTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4532); }
+        get { return *(float*)(Ptr + 4532); }
+        set { *(float*)(Ptr + 4532) = value; }
     }
 
     /// <summary>
@@ -3098,8 +4561,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float TimeSinceRunPressed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4536); }
+        get { return *(float*)(Ptr + 4536); }
+        set { *(float*)(Ptr + 4536) = value; }
     }
 
     /// <summary>
@@ -3107,8 +4570,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int MovesSinceSpecial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4540); }
+        get { return *(int*)(Ptr + 4540); }
+        set { *(int*)(Ptr + 4540) = value; }
     }
 
     /// <summary>
@@ -3116,8 +4579,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int CombosStarted
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4544); }
+        get { return *(int*)(Ptr + 4544); }
+        set { *(int*)(Ptr + 4544) = value; }
     }
 
     /// <summary>
@@ -3125,8 +4588,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int CombosAchieved
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4548); }
+        get { return *(int*)(Ptr + 4548); }
+        set { *(int*)(Ptr + 4548) = value; }
     }
 
     /// <summary>
@@ -3134,8 +4597,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int CummulativeComboAchieved
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4552); }
+        get { return *(int*)(Ptr + 4552); }
+        set { *(int*)(Ptr + 4552) = value; }
     }
 
     /// <summary>
@@ -3143,8 +4606,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int CounterPrompt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4556); }
+        get { return *(int*)(Ptr + 4556); }
+        set { *(int*)(Ptr + 4556) = value; }
     }
 
     /// <summary>
@@ -3152,8 +4615,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float CounterPromptTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4560); }
+        get { return *(float*)(Ptr + 4560); }
+        set { *(float*)(Ptr + 4560) = value; }
     }
 
     /// <summary>
@@ -3161,8 +4624,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int MaxComboSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4564); }
+        get { return *(int*)(Ptr + 4564); }
+        set { *(int*)(Ptr + 4564) = value; }
     }
 
     /// <summary>
@@ -3170,8 +4633,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int MaxComboVariation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4568); }
+        get { return *(int*)(Ptr + 4568); }
+        set { *(int*)(Ptr + 4568) = value; }
     }
 
     /// <summary>
@@ -3179,8 +4642,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int StoredComboBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4572); }
+        get { return *(int*)(Ptr + 4572); }
+        set { *(int*)(Ptr + 4572) = value; }
     }
 
     /// <summary>
@@ -3188,8 +4651,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int StoredVariationBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4576); }
+        get { return *(int*)(Ptr + 4576); }
+        set { *(int*)(Ptr + 4576) = value; }
     }
 
     /// <summary>
@@ -3197,8 +4660,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int StoredGadgetVariationBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4580); }
+        get { return *(int*)(Ptr + 4580); }
+        set { *(int*)(Ptr + 4580) = value; }
     }
 
     /// <summary>
@@ -3206,8 +4669,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int StoredIntimidationTakedownsPerformed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4584); }
+        get { return *(int*)(Ptr + 4584); }
+        set { *(int*)(Ptr + 4584) = value; }
     }
 
     /// <summary>
@@ -3215,8 +4678,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int StoredPredatorVariationBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4588); }
+        get { return *(int*)(Ptr + 4588); }
+        set { *(int*)(Ptr + 4588) = value; }
     }
 
     /// <summary>
@@ -3233,8 +4696,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int HitsSinceCounter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4596); }
+        get { return *(int*)(Ptr + 4596); }
+        set { *(int*)(Ptr + 4596) = value; }
     }
 
     /// <summary>
@@ -3242,8 +4705,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int SetComboFrames
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4600); }
+        get { return *(int*)(Ptr + 4600); }
+        set { *(int*)(Ptr + 4600) = value; }
     }
 
     /// <summary>
@@ -3251,8 +4714,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int ShowCriticalFrames
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4604); }
+        get { return *(int*)(Ptr + 4604); }
+        set { *(int*)(Ptr + 4604) = value; }
     }
 
     /// <summary>
@@ -3260,8 +4723,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float NotInCombatTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4608); }
+        get { return *(float*)(Ptr + 4608); }
+        set { *(float*)(Ptr + 4608) = value; }
     }
 
     /// <summary>
@@ -3278,8 +4741,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int BlockedByArmouredSinceBeatdown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4616); }
+        get { return *(int*)(Ptr + 4616); }
+        set { *(int*)(Ptr + 4616) = value; }
     }
 
     /// <summary>
@@ -3287,8 +4750,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int BlockedByShieldSinceAerial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4620); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4620); }
+        get { return *(int*)(Ptr + 4620); }
+        set { *(int*)(Ptr + 4620) = value; }
     }
 
     /// <summary>
@@ -3296,8 +4759,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int BlockedByTitanSinceSuperStun
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4624); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4624); }
+        get { return *(int*)(Ptr + 4624); }
+        set { *(int*)(Ptr + 4624) = value; }
     }
 
     /// <summary>
@@ -3305,8 +4768,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int StunStickHits
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4628); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4628); }
+        get { return *(int*)(Ptr + 4628); }
+        set { *(int*)(Ptr + 4628) = value; }
     }
 
     /// <summary>
@@ -3314,8 +4777,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int BladeHits
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4632); }
+        get { return *(int*)(Ptr + 4632); }
+        set { *(int*)(Ptr + 4632) = value; }
     }
 
     /// <summary>
@@ -3341,8 +4804,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int ConsecutiveBatarangsOrRedirects
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4652); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4652); }
+        get { return *(int*)(Ptr + 4652); }
+        set { *(int*)(Ptr + 4652) = value; }
     }
 
     /// <summary>
@@ -3370,448 +4833,448 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int MoveTypeCount_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4676); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4676); }
+        get { return *(int*)(Ptr + 4676); }
+        set { *(int*)(Ptr + 4676) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4680); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4680); }
+        get { return *(int*)(Ptr + 4680); }
+        set { *(int*)(Ptr + 4680) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4684); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4684); }
+        get { return *(int*)(Ptr + 4684); }
+        set { *(int*)(Ptr + 4684) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4688); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4688); }
+        get { return *(int*)(Ptr + 4688); }
+        set { *(int*)(Ptr + 4688) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4692); }
+        get { return *(int*)(Ptr + 4692); }
+        set { *(int*)(Ptr + 4692) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4696); }
+        get { return *(int*)(Ptr + 4696); }
+        set { *(int*)(Ptr + 4696) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4700); }
+        get { return *(int*)(Ptr + 4700); }
+        set { *(int*)(Ptr + 4700) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4704); }
+        get { return *(int*)(Ptr + 4704); }
+        set { *(int*)(Ptr + 4704) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4708); }
+        get { return *(int*)(Ptr + 4708); }
+        set { *(int*)(Ptr + 4708) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_9
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4712); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4712); }
+        get { return *(int*)(Ptr + 4712); }
+        set { *(int*)(Ptr + 4712) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_10
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4716); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4716); }
+        get { return *(int*)(Ptr + 4716); }
+        set { *(int*)(Ptr + 4716) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_11
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4720); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4720); }
+        get { return *(int*)(Ptr + 4720); }
+        set { *(int*)(Ptr + 4720) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_12
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4724); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4724); }
+        get { return *(int*)(Ptr + 4724); }
+        set { *(int*)(Ptr + 4724) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_13
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4728); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4728); }
+        get { return *(int*)(Ptr + 4728); }
+        set { *(int*)(Ptr + 4728) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_14
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4732); }
+        get { return *(int*)(Ptr + 4732); }
+        set { *(int*)(Ptr + 4732) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_15
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4736); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4736); }
+        get { return *(int*)(Ptr + 4736); }
+        set { *(int*)(Ptr + 4736) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_16
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4740); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4740); }
+        get { return *(int*)(Ptr + 4740); }
+        set { *(int*)(Ptr + 4740) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_17
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4744); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4744); }
+        get { return *(int*)(Ptr + 4744); }
+        set { *(int*)(Ptr + 4744) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_18
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4748); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4748); }
+        get { return *(int*)(Ptr + 4748); }
+        set { *(int*)(Ptr + 4748) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_19
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4752); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4752); }
+        get { return *(int*)(Ptr + 4752); }
+        set { *(int*)(Ptr + 4752) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_20
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4756); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4756); }
+        get { return *(int*)(Ptr + 4756); }
+        set { *(int*)(Ptr + 4756) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_21
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4760); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4760); }
+        get { return *(int*)(Ptr + 4760); }
+        set { *(int*)(Ptr + 4760) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_22
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4764); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4764); }
+        get { return *(int*)(Ptr + 4764); }
+        set { *(int*)(Ptr + 4764) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_23
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4768); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4768); }
+        get { return *(int*)(Ptr + 4768); }
+        set { *(int*)(Ptr + 4768) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_24
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4772); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4772); }
+        get { return *(int*)(Ptr + 4772); }
+        set { *(int*)(Ptr + 4772) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_25
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4776); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4776); }
+        get { return *(int*)(Ptr + 4776); }
+        set { *(int*)(Ptr + 4776) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_26
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4780); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4780); }
+        get { return *(int*)(Ptr + 4780); }
+        set { *(int*)(Ptr + 4780) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_27
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4784); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4784); }
+        get { return *(int*)(Ptr + 4784); }
+        set { *(int*)(Ptr + 4784) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_28
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4788); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4788); }
+        get { return *(int*)(Ptr + 4788); }
+        set { *(int*)(Ptr + 4788) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_29
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4792); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4792); }
+        get { return *(int*)(Ptr + 4792); }
+        set { *(int*)(Ptr + 4792) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_30
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4796); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4796); }
+        get { return *(int*)(Ptr + 4796); }
+        set { *(int*)(Ptr + 4796) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_31
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4800); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4800); }
+        get { return *(int*)(Ptr + 4800); }
+        set { *(int*)(Ptr + 4800) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_32
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4804); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4804); }
+        get { return *(int*)(Ptr + 4804); }
+        set { *(int*)(Ptr + 4804) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_33
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4808); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4808); }
+        get { return *(int*)(Ptr + 4808); }
+        set { *(int*)(Ptr + 4808) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_34
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4812); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4812); }
+        get { return *(int*)(Ptr + 4812); }
+        set { *(int*)(Ptr + 4812) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_35
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4816); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4816); }
+        get { return *(int*)(Ptr + 4816); }
+        set { *(int*)(Ptr + 4816) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_36
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4820); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4820); }
+        get { return *(int*)(Ptr + 4820); }
+        set { *(int*)(Ptr + 4820) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_37
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4824); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4824); }
+        get { return *(int*)(Ptr + 4824); }
+        set { *(int*)(Ptr + 4824) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_38
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4828); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4828); }
+        get { return *(int*)(Ptr + 4828); }
+        set { *(int*)(Ptr + 4828) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_39
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4832); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4832); }
+        get { return *(int*)(Ptr + 4832); }
+        set { *(int*)(Ptr + 4832) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_40
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4836); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4836); }
+        get { return *(int*)(Ptr + 4836); }
+        set { *(int*)(Ptr + 4836) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_41
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4840); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4840); }
+        get { return *(int*)(Ptr + 4840); }
+        set { *(int*)(Ptr + 4840) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_42
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4844); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4844); }
+        get { return *(int*)(Ptr + 4844); }
+        set { *(int*)(Ptr + 4844) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_43
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4848); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4848); }
+        get { return *(int*)(Ptr + 4848); }
+        set { *(int*)(Ptr + 4848) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_44
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4852); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4852); }
+        get { return *(int*)(Ptr + 4852); }
+        set { *(int*)(Ptr + 4852) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_45
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4856); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4856); }
+        get { return *(int*)(Ptr + 4856); }
+        set { *(int*)(Ptr + 4856) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_46
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4860); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4860); }
+        get { return *(int*)(Ptr + 4860); }
+        set { *(int*)(Ptr + 4860) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_47
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4864); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4864); }
+        get { return *(int*)(Ptr + 4864); }
+        set { *(int*)(Ptr + 4864) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_48
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4868); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4868); }
+        get { return *(int*)(Ptr + 4868); }
+        set { *(int*)(Ptr + 4868) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_49
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4872); }
+        get { return *(int*)(Ptr + 4872); }
+        set { *(int*)(Ptr + 4872) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_50
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4876); }
+        get { return *(int*)(Ptr + 4876); }
+        set { *(int*)(Ptr + 4876) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_51
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4880); }
+        get { return *(int*)(Ptr + 4880); }
+        set { *(int*)(Ptr + 4880) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_52
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4884); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4884); }
+        get { return *(int*)(Ptr + 4884); }
+        set { *(int*)(Ptr + 4884) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_53
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4888); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4888); }
+        get { return *(int*)(Ptr + 4888); }
+        set { *(int*)(Ptr + 4888) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_54
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4892); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4892); }
+        get { return *(int*)(Ptr + 4892); }
+        set { *(int*)(Ptr + 4892) = value; }
     }
     /// <summary>
     /// IntProperty: MoveTypeCount
     /// </summary>
     public unsafe int MoveTypeCount_55
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4896); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4896); }
+        get { return *(int*)(Ptr + 4896); }
+        set { *(int*)(Ptr + 4896) = value; }
     }
 
     /// <summary>
@@ -3824,448 +5287,448 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int ComboMoveType_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4900); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4900); }
+        get { return *(int*)(Ptr + 4900); }
+        set { *(int*)(Ptr + 4900) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4904); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4904); }
+        get { return *(int*)(Ptr + 4904); }
+        set { *(int*)(Ptr + 4904) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4908); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4908); }
+        get { return *(int*)(Ptr + 4908); }
+        set { *(int*)(Ptr + 4908) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4912); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4912); }
+        get { return *(int*)(Ptr + 4912); }
+        set { *(int*)(Ptr + 4912) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4916); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4916); }
+        get { return *(int*)(Ptr + 4916); }
+        set { *(int*)(Ptr + 4916) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4920); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4920); }
+        get { return *(int*)(Ptr + 4920); }
+        set { *(int*)(Ptr + 4920) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4924); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4924); }
+        get { return *(int*)(Ptr + 4924); }
+        set { *(int*)(Ptr + 4924) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4928); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4928); }
+        get { return *(int*)(Ptr + 4928); }
+        set { *(int*)(Ptr + 4928) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4932); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4932); }
+        get { return *(int*)(Ptr + 4932); }
+        set { *(int*)(Ptr + 4932) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_9
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4936); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4936); }
+        get { return *(int*)(Ptr + 4936); }
+        set { *(int*)(Ptr + 4936) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_10
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4940); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4940); }
+        get { return *(int*)(Ptr + 4940); }
+        set { *(int*)(Ptr + 4940) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_11
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4944); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4944); }
+        get { return *(int*)(Ptr + 4944); }
+        set { *(int*)(Ptr + 4944) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_12
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4948); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4948); }
+        get { return *(int*)(Ptr + 4948); }
+        set { *(int*)(Ptr + 4948) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_13
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4952); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4952); }
+        get { return *(int*)(Ptr + 4952); }
+        set { *(int*)(Ptr + 4952) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_14
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4956); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4956); }
+        get { return *(int*)(Ptr + 4956); }
+        set { *(int*)(Ptr + 4956) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_15
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4960); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4960); }
+        get { return *(int*)(Ptr + 4960); }
+        set { *(int*)(Ptr + 4960) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_16
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4964); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4964); }
+        get { return *(int*)(Ptr + 4964); }
+        set { *(int*)(Ptr + 4964) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_17
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4968); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4968); }
+        get { return *(int*)(Ptr + 4968); }
+        set { *(int*)(Ptr + 4968) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_18
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4972); }
+        get { return *(int*)(Ptr + 4972); }
+        set { *(int*)(Ptr + 4972) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_19
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4976); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4976); }
+        get { return *(int*)(Ptr + 4976); }
+        set { *(int*)(Ptr + 4976) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_20
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4980); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4980); }
+        get { return *(int*)(Ptr + 4980); }
+        set { *(int*)(Ptr + 4980) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_21
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4984); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4984); }
+        get { return *(int*)(Ptr + 4984); }
+        set { *(int*)(Ptr + 4984) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_22
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4988); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4988); }
+        get { return *(int*)(Ptr + 4988); }
+        set { *(int*)(Ptr + 4988) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_23
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4992); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4992); }
+        get { return *(int*)(Ptr + 4992); }
+        set { *(int*)(Ptr + 4992) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_24
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4996); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4996); }
+        get { return *(int*)(Ptr + 4996); }
+        set { *(int*)(Ptr + 4996) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_25
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5000); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5000); }
+        get { return *(int*)(Ptr + 5000); }
+        set { *(int*)(Ptr + 5000) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_26
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5004); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5004); }
+        get { return *(int*)(Ptr + 5004); }
+        set { *(int*)(Ptr + 5004) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_27
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5008); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5008); }
+        get { return *(int*)(Ptr + 5008); }
+        set { *(int*)(Ptr + 5008) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_28
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5012); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5012); }
+        get { return *(int*)(Ptr + 5012); }
+        set { *(int*)(Ptr + 5012) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_29
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5016); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5016); }
+        get { return *(int*)(Ptr + 5016); }
+        set { *(int*)(Ptr + 5016) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_30
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5020); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5020); }
+        get { return *(int*)(Ptr + 5020); }
+        set { *(int*)(Ptr + 5020) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_31
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5024); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5024); }
+        get { return *(int*)(Ptr + 5024); }
+        set { *(int*)(Ptr + 5024) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_32
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5028); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5028); }
+        get { return *(int*)(Ptr + 5028); }
+        set { *(int*)(Ptr + 5028) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_33
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5032); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5032); }
+        get { return *(int*)(Ptr + 5032); }
+        set { *(int*)(Ptr + 5032) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_34
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5036); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5036); }
+        get { return *(int*)(Ptr + 5036); }
+        set { *(int*)(Ptr + 5036) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_35
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5040); }
+        get { return *(int*)(Ptr + 5040); }
+        set { *(int*)(Ptr + 5040) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_36
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5044); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5044); }
+        get { return *(int*)(Ptr + 5044); }
+        set { *(int*)(Ptr + 5044) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_37
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5048); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5048); }
+        get { return *(int*)(Ptr + 5048); }
+        set { *(int*)(Ptr + 5048) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_38
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5052); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5052); }
+        get { return *(int*)(Ptr + 5052); }
+        set { *(int*)(Ptr + 5052) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_39
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5056); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5056); }
+        get { return *(int*)(Ptr + 5056); }
+        set { *(int*)(Ptr + 5056) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_40
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5060); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5060); }
+        get { return *(int*)(Ptr + 5060); }
+        set { *(int*)(Ptr + 5060) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_41
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5064); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5064); }
+        get { return *(int*)(Ptr + 5064); }
+        set { *(int*)(Ptr + 5064) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_42
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5068); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5068); }
+        get { return *(int*)(Ptr + 5068); }
+        set { *(int*)(Ptr + 5068) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_43
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5072); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5072); }
+        get { return *(int*)(Ptr + 5072); }
+        set { *(int*)(Ptr + 5072) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_44
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5076); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5076); }
+        get { return *(int*)(Ptr + 5076); }
+        set { *(int*)(Ptr + 5076) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_45
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5080); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5080); }
+        get { return *(int*)(Ptr + 5080); }
+        set { *(int*)(Ptr + 5080) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_46
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5084); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5084); }
+        get { return *(int*)(Ptr + 5084); }
+        set { *(int*)(Ptr + 5084) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_47
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5088); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5088); }
+        get { return *(int*)(Ptr + 5088); }
+        set { *(int*)(Ptr + 5088) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_48
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5092); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5092); }
+        get { return *(int*)(Ptr + 5092); }
+        set { *(int*)(Ptr + 5092) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_49
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5096); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5096); }
+        get { return *(int*)(Ptr + 5096); }
+        set { *(int*)(Ptr + 5096) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_50
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5100); }
+        get { return *(int*)(Ptr + 5100); }
+        set { *(int*)(Ptr + 5100) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_51
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5104); }
+        get { return *(int*)(Ptr + 5104); }
+        set { *(int*)(Ptr + 5104) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_52
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5108); }
+        get { return *(int*)(Ptr + 5108); }
+        set { *(int*)(Ptr + 5108) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_53
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5112); }
+        get { return *(int*)(Ptr + 5112); }
+        set { *(int*)(Ptr + 5112) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_54
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5116); }
+        get { return *(int*)(Ptr + 5116); }
+        set { *(int*)(Ptr + 5116) = value; }
     }
     /// <summary>
     /// IntProperty: ComboMoveType
     /// </summary>
     public unsafe int ComboMoveType_55
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5120); }
+        get { return *(int*)(Ptr + 5120); }
+        set { *(int*)(Ptr + 5120) = value; }
     }
 
     /// <summary>
@@ -4278,448 +5741,448 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int GadgetMoveType_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5124); }
+        get { return *(int*)(Ptr + 5124); }
+        set { *(int*)(Ptr + 5124) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5128); }
+        get { return *(int*)(Ptr + 5128); }
+        set { *(int*)(Ptr + 5128) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5132); }
+        get { return *(int*)(Ptr + 5132); }
+        set { *(int*)(Ptr + 5132) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5136); }
+        get { return *(int*)(Ptr + 5136); }
+        set { *(int*)(Ptr + 5136) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5140); }
+        get { return *(int*)(Ptr + 5140); }
+        set { *(int*)(Ptr + 5140) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5144); }
+        get { return *(int*)(Ptr + 5144); }
+        set { *(int*)(Ptr + 5144) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5148); }
+        get { return *(int*)(Ptr + 5148); }
+        set { *(int*)(Ptr + 5148) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5152); }
+        get { return *(int*)(Ptr + 5152); }
+        set { *(int*)(Ptr + 5152) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5156); }
+        get { return *(int*)(Ptr + 5156); }
+        set { *(int*)(Ptr + 5156) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_9
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5160); }
+        get { return *(int*)(Ptr + 5160); }
+        set { *(int*)(Ptr + 5160) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_10
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5164); }
+        get { return *(int*)(Ptr + 5164); }
+        set { *(int*)(Ptr + 5164) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_11
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5168); }
+        get { return *(int*)(Ptr + 5168); }
+        set { *(int*)(Ptr + 5168) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_12
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5172); }
+        get { return *(int*)(Ptr + 5172); }
+        set { *(int*)(Ptr + 5172) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_13
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5176); }
+        get { return *(int*)(Ptr + 5176); }
+        set { *(int*)(Ptr + 5176) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_14
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5180); }
+        get { return *(int*)(Ptr + 5180); }
+        set { *(int*)(Ptr + 5180) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_15
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5184); }
+        get { return *(int*)(Ptr + 5184); }
+        set { *(int*)(Ptr + 5184) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_16
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5188); }
+        get { return *(int*)(Ptr + 5188); }
+        set { *(int*)(Ptr + 5188) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_17
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5192); }
+        get { return *(int*)(Ptr + 5192); }
+        set { *(int*)(Ptr + 5192) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_18
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5196); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5196); }
+        get { return *(int*)(Ptr + 5196); }
+        set { *(int*)(Ptr + 5196) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_19
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5200); }
+        get { return *(int*)(Ptr + 5200); }
+        set { *(int*)(Ptr + 5200) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_20
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5204); }
+        get { return *(int*)(Ptr + 5204); }
+        set { *(int*)(Ptr + 5204) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_21
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5208); }
+        get { return *(int*)(Ptr + 5208); }
+        set { *(int*)(Ptr + 5208) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_22
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5212); }
+        get { return *(int*)(Ptr + 5212); }
+        set { *(int*)(Ptr + 5212) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_23
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5216); }
+        get { return *(int*)(Ptr + 5216); }
+        set { *(int*)(Ptr + 5216) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_24
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5220); }
+        get { return *(int*)(Ptr + 5220); }
+        set { *(int*)(Ptr + 5220) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_25
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5224); }
+        get { return *(int*)(Ptr + 5224); }
+        set { *(int*)(Ptr + 5224) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_26
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5228); }
+        get { return *(int*)(Ptr + 5228); }
+        set { *(int*)(Ptr + 5228) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_27
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5232); }
+        get { return *(int*)(Ptr + 5232); }
+        set { *(int*)(Ptr + 5232) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_28
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5236); }
+        get { return *(int*)(Ptr + 5236); }
+        set { *(int*)(Ptr + 5236) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_29
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5240); }
+        get { return *(int*)(Ptr + 5240); }
+        set { *(int*)(Ptr + 5240) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_30
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5244); }
+        get { return *(int*)(Ptr + 5244); }
+        set { *(int*)(Ptr + 5244) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_31
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5248); }
+        get { return *(int*)(Ptr + 5248); }
+        set { *(int*)(Ptr + 5248) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_32
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5252); }
+        get { return *(int*)(Ptr + 5252); }
+        set { *(int*)(Ptr + 5252) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_33
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5256); }
+        get { return *(int*)(Ptr + 5256); }
+        set { *(int*)(Ptr + 5256) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_34
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5260); }
+        get { return *(int*)(Ptr + 5260); }
+        set { *(int*)(Ptr + 5260) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_35
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5264); }
+        get { return *(int*)(Ptr + 5264); }
+        set { *(int*)(Ptr + 5264) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_36
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5268); }
+        get { return *(int*)(Ptr + 5268); }
+        set { *(int*)(Ptr + 5268) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_37
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5272); }
+        get { return *(int*)(Ptr + 5272); }
+        set { *(int*)(Ptr + 5272) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_38
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5276); }
+        get { return *(int*)(Ptr + 5276); }
+        set { *(int*)(Ptr + 5276) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_39
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5280); }
+        get { return *(int*)(Ptr + 5280); }
+        set { *(int*)(Ptr + 5280) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_40
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5284); }
+        get { return *(int*)(Ptr + 5284); }
+        set { *(int*)(Ptr + 5284) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_41
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5288); }
+        get { return *(int*)(Ptr + 5288); }
+        set { *(int*)(Ptr + 5288) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_42
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5292); }
+        get { return *(int*)(Ptr + 5292); }
+        set { *(int*)(Ptr + 5292) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_43
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5296); }
+        get { return *(int*)(Ptr + 5296); }
+        set { *(int*)(Ptr + 5296) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_44
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5300); }
+        get { return *(int*)(Ptr + 5300); }
+        set { *(int*)(Ptr + 5300) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_45
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5304); }
+        get { return *(int*)(Ptr + 5304); }
+        set { *(int*)(Ptr + 5304) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_46
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5308); }
+        get { return *(int*)(Ptr + 5308); }
+        set { *(int*)(Ptr + 5308) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_47
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5312); }
+        get { return *(int*)(Ptr + 5312); }
+        set { *(int*)(Ptr + 5312) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_48
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5316); }
+        get { return *(int*)(Ptr + 5316); }
+        set { *(int*)(Ptr + 5316) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_49
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5320); }
+        get { return *(int*)(Ptr + 5320); }
+        set { *(int*)(Ptr + 5320) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_50
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5324); }
+        get { return *(int*)(Ptr + 5324); }
+        set { *(int*)(Ptr + 5324) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_51
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5328); }
+        get { return *(int*)(Ptr + 5328); }
+        set { *(int*)(Ptr + 5328) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_52
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5332); }
+        get { return *(int*)(Ptr + 5332); }
+        set { *(int*)(Ptr + 5332) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_53
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5336); }
+        get { return *(int*)(Ptr + 5336); }
+        set { *(int*)(Ptr + 5336) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_54
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5340); }
+        get { return *(int*)(Ptr + 5340); }
+        set { *(int*)(Ptr + 5340) = value; }
     }
     /// <summary>
     /// IntProperty: GadgetMoveType
     /// </summary>
     public unsafe int GadgetMoveType_55
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5344); }
+        get { return *(int*)(Ptr + 5344); }
+        set { *(int*)(Ptr + 5344) = value; }
     }
 
     /// <summary>
@@ -4732,448 +6195,448 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int SavedComboMoveType_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5348); }
+        get { return *(int*)(Ptr + 5348); }
+        set { *(int*)(Ptr + 5348) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5352); }
+        get { return *(int*)(Ptr + 5352); }
+        set { *(int*)(Ptr + 5352) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5356); }
+        get { return *(int*)(Ptr + 5356); }
+        set { *(int*)(Ptr + 5356) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5360); }
+        get { return *(int*)(Ptr + 5360); }
+        set { *(int*)(Ptr + 5360) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5364); }
+        get { return *(int*)(Ptr + 5364); }
+        set { *(int*)(Ptr + 5364) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5368); }
+        get { return *(int*)(Ptr + 5368); }
+        set { *(int*)(Ptr + 5368) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5372); }
+        get { return *(int*)(Ptr + 5372); }
+        set { *(int*)(Ptr + 5372) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5376); }
+        get { return *(int*)(Ptr + 5376); }
+        set { *(int*)(Ptr + 5376) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_8
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5380); }
+        get { return *(int*)(Ptr + 5380); }
+        set { *(int*)(Ptr + 5380) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_9
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5384); }
+        get { return *(int*)(Ptr + 5384); }
+        set { *(int*)(Ptr + 5384) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_10
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5388); }
+        get { return *(int*)(Ptr + 5388); }
+        set { *(int*)(Ptr + 5388) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_11
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5392); }
+        get { return *(int*)(Ptr + 5392); }
+        set { *(int*)(Ptr + 5392) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_12
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5396); }
+        get { return *(int*)(Ptr + 5396); }
+        set { *(int*)(Ptr + 5396) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_13
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5400); }
+        get { return *(int*)(Ptr + 5400); }
+        set { *(int*)(Ptr + 5400) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_14
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5404); }
+        get { return *(int*)(Ptr + 5404); }
+        set { *(int*)(Ptr + 5404) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_15
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5408); }
+        get { return *(int*)(Ptr + 5408); }
+        set { *(int*)(Ptr + 5408) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_16
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5412); }
+        get { return *(int*)(Ptr + 5412); }
+        set { *(int*)(Ptr + 5412) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_17
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5416); }
+        get { return *(int*)(Ptr + 5416); }
+        set { *(int*)(Ptr + 5416) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_18
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5420); }
+        get { return *(int*)(Ptr + 5420); }
+        set { *(int*)(Ptr + 5420) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_19
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5424); }
+        get { return *(int*)(Ptr + 5424); }
+        set { *(int*)(Ptr + 5424) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_20
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5428); }
+        get { return *(int*)(Ptr + 5428); }
+        set { *(int*)(Ptr + 5428) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_21
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5432); }
+        get { return *(int*)(Ptr + 5432); }
+        set { *(int*)(Ptr + 5432) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_22
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5436); }
+        get { return *(int*)(Ptr + 5436); }
+        set { *(int*)(Ptr + 5436) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_23
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5440); }
+        get { return *(int*)(Ptr + 5440); }
+        set { *(int*)(Ptr + 5440) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_24
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5444); }
+        get { return *(int*)(Ptr + 5444); }
+        set { *(int*)(Ptr + 5444) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_25
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5448); }
+        get { return *(int*)(Ptr + 5448); }
+        set { *(int*)(Ptr + 5448) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_26
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5452); }
+        get { return *(int*)(Ptr + 5452); }
+        set { *(int*)(Ptr + 5452) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_27
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5456); }
+        get { return *(int*)(Ptr + 5456); }
+        set { *(int*)(Ptr + 5456) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_28
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5460); }
+        get { return *(int*)(Ptr + 5460); }
+        set { *(int*)(Ptr + 5460) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_29
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5464); }
+        get { return *(int*)(Ptr + 5464); }
+        set { *(int*)(Ptr + 5464) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_30
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5468); }
+        get { return *(int*)(Ptr + 5468); }
+        set { *(int*)(Ptr + 5468) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_31
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5472); }
+        get { return *(int*)(Ptr + 5472); }
+        set { *(int*)(Ptr + 5472) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_32
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5476); }
+        get { return *(int*)(Ptr + 5476); }
+        set { *(int*)(Ptr + 5476) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_33
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5480); }
+        get { return *(int*)(Ptr + 5480); }
+        set { *(int*)(Ptr + 5480) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_34
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5484); }
+        get { return *(int*)(Ptr + 5484); }
+        set { *(int*)(Ptr + 5484) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_35
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5488); }
+        get { return *(int*)(Ptr + 5488); }
+        set { *(int*)(Ptr + 5488) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_36
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5492); }
+        get { return *(int*)(Ptr + 5492); }
+        set { *(int*)(Ptr + 5492) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_37
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5496); }
+        get { return *(int*)(Ptr + 5496); }
+        set { *(int*)(Ptr + 5496) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_38
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5500); }
+        get { return *(int*)(Ptr + 5500); }
+        set { *(int*)(Ptr + 5500) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_39
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5504); }
+        get { return *(int*)(Ptr + 5504); }
+        set { *(int*)(Ptr + 5504) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_40
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5508); }
+        get { return *(int*)(Ptr + 5508); }
+        set { *(int*)(Ptr + 5508) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_41
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5512); }
+        get { return *(int*)(Ptr + 5512); }
+        set { *(int*)(Ptr + 5512) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_42
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5516); }
+        get { return *(int*)(Ptr + 5516); }
+        set { *(int*)(Ptr + 5516) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_43
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5520); }
+        get { return *(int*)(Ptr + 5520); }
+        set { *(int*)(Ptr + 5520) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_44
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5524); }
+        get { return *(int*)(Ptr + 5524); }
+        set { *(int*)(Ptr + 5524) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_45
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5528); }
+        get { return *(int*)(Ptr + 5528); }
+        set { *(int*)(Ptr + 5528) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_46
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5532); }
+        get { return *(int*)(Ptr + 5532); }
+        set { *(int*)(Ptr + 5532) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_47
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5536); }
+        get { return *(int*)(Ptr + 5536); }
+        set { *(int*)(Ptr + 5536) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_48
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5540); }
+        get { return *(int*)(Ptr + 5540); }
+        set { *(int*)(Ptr + 5540) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_49
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5544); }
+        get { return *(int*)(Ptr + 5544); }
+        set { *(int*)(Ptr + 5544) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_50
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5548); }
+        get { return *(int*)(Ptr + 5548); }
+        set { *(int*)(Ptr + 5548) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_51
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5552); }
+        get { return *(int*)(Ptr + 5552); }
+        set { *(int*)(Ptr + 5552) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_52
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5556); }
+        get { return *(int*)(Ptr + 5556); }
+        set { *(int*)(Ptr + 5556) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_53
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5560); }
+        get { return *(int*)(Ptr + 5560); }
+        set { *(int*)(Ptr + 5560) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_54
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5564); }
+        get { return *(int*)(Ptr + 5564); }
+        set { *(int*)(Ptr + 5564) = value; }
     }
     /// <summary>
     /// IntProperty: SavedComboMoveType
     /// </summary>
     public unsafe int SavedComboMoveType_55
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5568); }
+        get { return *(int*)(Ptr + 5568); }
+        set { *(int*)(Ptr + 5568) = value; }
     }
 
     /// <summary>
@@ -5181,8 +6644,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int SavedComboSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5572); }
+        get { return *(int*)(Ptr + 5572); }
+        set { *(int*)(Ptr + 5572) = value; }
     }
 
     /// <summary>
@@ -5199,8 +6662,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float CurrentLookAtTargetTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5580); }
+        get { return *(float*)(Ptr + 5580); }
+        set { *(float*)(Ptr + 5580) = value; }
     }
 
     /// <summary>
@@ -5208,8 +6671,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int FrontCounters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5584); }
+        get { return *(int*)(Ptr + 5584); }
+        set { *(int*)(Ptr + 5584) = value; }
     }
 
     /// <summary>
@@ -5217,8 +6680,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int BackCounters
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5588); }
+        get { return *(int*)(Ptr + 5588); }
+        set { *(int*)(Ptr + 5588) = value; }
     }
 
     /// <summary>
@@ -5226,8 +6689,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int SuperComboModeMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5592); }
+        get { return *(int*)(Ptr + 5592); }
+        set { *(int*)(Ptr + 5592) = value; }
     }
 
     /// <summary>
@@ -5235,8 +6698,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe int SuperComboModeMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 5596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5596); }
+        get { return *(int*)(Ptr + 5596); }
+        set { *(int*)(Ptr + 5596) = value; }
     }
 
     /// <summary>
@@ -5244,8 +6707,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float SuperComboModeMinSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5600); }
+        get { return *(float*)(Ptr + 5600); }
+        set { *(float*)(Ptr + 5600) = value; }
     }
 
     /// <summary>
@@ -5253,8 +6716,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float SuperComboModeMinDurationMulti
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5604); }
+        get { return *(float*)(Ptr + 5604); }
+        set { *(float*)(Ptr + 5604) = value; }
     }
 
     /// <summary>
@@ -5262,8 +6725,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float CurrCombatCamDistModifier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5608); }
+        get { return *(float*)(Ptr + 5608); }
+        set { *(float*)(Ptr + 5608) = value; }
     }
 
     /// <summary>
@@ -5271,8 +6734,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float CurrSuperComboPPAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5612); }
+        get { return *(float*)(Ptr + 5612); }
+        set { *(float*)(Ptr + 5612) = value; }
     }
 
     /// <summary>
@@ -5280,8 +6743,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float SuperComboModeVal1Multi
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5616); }
+        get { return *(float*)(Ptr + 5616); }
+        set { *(float*)(Ptr + 5616) = value; }
     }
 
     /// <summary>
@@ -5289,8 +6752,8 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float SuperComboModeVal2Multi
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5620); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5620); }
+        get { return *(float*)(Ptr + 5620); }
+        set { *(float*)(Ptr + 5620) = value; }
     }
 
     /// <summary>
@@ -5307,7 +6770,7 @@ public partial class RPlayerControllerCombat : BmSDK.BmGame.RPlayerController, B
     /// </summary>
     public unsafe float TimeSinceLastStrikeRequest
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5628); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5628); }
+        get { return *(float*)(Ptr + 5628); }
+        set { *(float*)(Ptr + 5628) = value; }
     }
 }
@@ -78,49 +78,83 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RPlayerInput>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetControlTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetControlType_Params
+    {
+        [FieldOffset(0)] public int Value;
+    }
+
     /// <summary>
     /// Function: SetControlType
     /// </summary>
     public unsafe virtual void SetControlType(int Value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.SetControlType", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetControlTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.SetControlType", true);
+        var parms = new SetControlType_Params();
+        parms.Value = Value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpinControllerx10Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpinControllerx10_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpinControllerx10
     /// </summary>
     public unsafe virtual void SpinControllerx10()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.SpinControllerx10", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpinControllerx10Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.SpinControllerx10", true);
+        var parms = new SpinControllerx10_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpinControllerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpinController_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpinController
     /// </summary>
     public unsafe virtual void SpinController()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.SpinController", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpinControllerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.SpinController", true);
+        var parms = new SpinController_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InvertCapeGlideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InvertCapeGlide_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: InvertCapeGlide
     /// </summary>
     public unsafe virtual bool InvertCapeGlide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.InvertCapeGlide", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_InvertCapeGlideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.InvertCapeGlide", true);
+        var parms = new InvertCapeGlide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsMouseButtonPressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsMouseButtonPressed_Params
+    {
+        [FieldOffset(0)] public int CheckRightButton;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -128,18 +162,20 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool IsMouseButtonPressed(bool CheckRightButton = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.IsMouseButtonPressed", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckRightButton, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsMouseButtonPressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.IsMouseButtonPressed", true);
+        var parms = new IsMouseButtonPressed_Params();
+        parms.CheckRightButton = CheckRightButton ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FastPlayerInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct FastPlayerInput_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int bMoveInputIgnored;
+        [FieldOffset(8)] public int bLookInputIgnored;
     }
 
     /// <summary>
@@ -147,31 +183,39 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void FastPlayerInput(float DeltaTime, bool bMoveInputIgnored, bool bLookInputIgnored)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.FastPlayerInput", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bMoveInputIgnored, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLookInputIgnored, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_FastPlayerInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.FastPlayerInput", true);
+        var parms = new FastPlayerInput_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.bMoveInputIgnored = bMoveInputIgnored ? 1 : 0;
+        parms.bLookInputIgnored = bLookInputIgnored ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InvertJoystickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InvertJoystick_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: InvertJoystick
     /// </summary>
     public unsafe virtual bool InvertJoystick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.InvertJoystick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_InvertJoystickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.InvertJoystick", true);
+        var parms = new InvertJoystick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_MouseInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct MouseInput_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public float FOVScale;
     }
 
     /// <summary>
@@ -179,71 +223,106 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void MouseInput(float DeltaTime, float FOVScale)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.MouseInput", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FOVScale, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MouseInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.MouseInput", true);
+        var parms = new MouseInput_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.FOVScale = FOVScale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s__PlayerInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct _PlayerInput_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: PlayerInput
     /// </summary>
     public unsafe override void _PlayerInput(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.PlayerInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s__PlayerInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.PlayerInput", true);
+        var parms = new _PlayerInput_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwapThumbSticksFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SwapThumbSticks_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwapThumbSticks
     /// </summary>
     public unsafe virtual void SwapThumbSticks()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.SwapThumbSticks", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwapThumbSticksFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.SwapThumbSticks", true);
+        var parms = new SwapThumbSticks_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ScaleSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ScaleSpeed_Params
+    {
+    }
+
     /// <summary>
     /// Function: ScaleSpeed
     /// </summary>
     public unsafe virtual void ScaleSpeed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.ScaleSpeed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ScaleSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.ScaleSpeed", true);
+        var parms = new ScaleSpeed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreProcessInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PreProcessInput_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: PreProcessInput
     /// </summary>
     public unsafe override void PreProcessInput(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.PreProcessInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreProcessInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.PreProcessInput", true);
+        var parms = new PreProcessInput_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MaxMagnitudeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct MaxMagnitude_Params
+    {
+        [FieldOffset(0)] public float A;
+        [FieldOffset(4)] public float B;
+        [FieldOffset(8)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: MaxMagnitude
     /// </summary>
     public unsafe virtual float MaxMagnitude(float A, float B)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.MaxMagnitude", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(B, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_MaxMagnitudeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPlayerInput.MaxMagnitude", true);
+        var parms = new MaxMagnitude_Params();
+        parms.A = A;
+        parms.B = B;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -252,50 +331,40 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 16)]
     public partial record struct FControllerSpinContainer
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: inProgress
         /// </summary>
-        public unsafe bool inProgress
+        public bool inProgress
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Triggered
         /// </summary>
-        public unsafe bool Triggered
+        public bool Triggered
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// IntProperty: Direction
         /// </summary>
-        public unsafe int Direction
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int Direction;
 
         /// <summary>
         /// FloatProperty: PrevAngle
         /// </summary>
-        public unsafe float PrevAngle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float PrevAngle;
 
         /// <summary>
         /// FloatProperty: TotalSpin
         /// </summary>
-        public unsafe float TotalSpin
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float TotalSpin;
     }
 
     /// <summary>
@@ -303,8 +372,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInvertJoystick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 1; else *(int*)(Ptr + 356) &= ~1; }
     }
 
     /// <summary>
@@ -312,8 +381,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLeftTrigger
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 2; else *(int*)(Ptr + 356) &= ~2; }
     }
 
     /// <summary>
@@ -321,8 +390,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRightTrigger
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 4; else *(int*)(Ptr + 356) &= ~4; }
     }
 
     /// <summary>
@@ -330,8 +399,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bTakedownButton
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 8; else *(int*)(Ptr + 356) &= ~8; }
     }
 
     /// <summary>
@@ -339,8 +408,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bQuickStrike
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 16; else *(int*)(Ptr + 356) &= ~16; }
     }
 
     /// <summary>
@@ -348,8 +417,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHeavyStrike
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 32; else *(int*)(Ptr + 356) &= ~32; }
     }
 
     /// <summary>
@@ -357,8 +426,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bChargeStrike
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 64; else *(int*)(Ptr + 356) &= ~64; }
     }
 
     /// <summary>
@@ -366,8 +435,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLeftBumper
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 128; else *(int*)(Ptr + 356) &= ~128; }
     }
 
     /// <summary>
@@ -375,8 +444,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRightBumper
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 256; else *(int*)(Ptr + 356) &= ~256; }
     }
 
     /// <summary>
@@ -384,8 +453,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSticksInverted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 512; else *(int*)(Ptr + 356) &= ~512; }
     }
 
     /// <summary>
@@ -393,8 +462,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInvertCapeGlide
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 1024; else *(int*)(Ptr + 356) &= ~1024; }
     }
 
     /// <summary>
@@ -402,8 +471,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInvertBatarang
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 2048; else *(int*)(Ptr + 356) &= ~2048; }
     }
 
     /// <summary>
@@ -411,8 +480,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseEasyControls
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 4096; else *(int*)(Ptr + 356) &= ~4096; }
     }
 
     /// <summary>
@@ -420,8 +489,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseSixaxisControls
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 8192; else *(int*)(Ptr + 356) &= ~8192; }
     }
 
     /// <summary>
@@ -429,8 +498,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseForensicsButton
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 16384; else *(int*)(Ptr + 356) &= ~16384; }
     }
 
     /// <summary>
@@ -438,8 +507,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInvertedCeilingControls
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 356); }
+        get { return (*(int*)(Ptr + 356) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 356) |= 32768; else *(int*)(Ptr + 356) &= ~32768; }
     }
 
     /// <summary>
@@ -447,8 +516,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aRawLHJoyUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(float*)(Ptr + 360); }
+        set { *(float*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -456,8 +525,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aRawLHJoyRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(float*)(Ptr + 364); }
+        set { *(float*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -465,8 +534,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aRawRHJoyUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(float*)(Ptr + 368); }
+        set { *(float*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -474,8 +543,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aRawRHJoyRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(float*)(Ptr + 372); }
+        set { *(float*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -483,8 +552,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aRightTrigger
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(float*)(Ptr + 376); }
+        set { *(float*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -492,8 +561,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aLeftTrigger
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(float*)(Ptr + 380); }
+        set { *(float*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -501,8 +570,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aGlanceUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }
+        get { return *(float*)(Ptr + 384); }
+        set { *(float*)(Ptr + 384) = value; }
     }
 
     /// <summary>
@@ -510,8 +579,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aGlanceRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(float*)(Ptr + 388); }
+        set { *(float*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -519,8 +588,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float GlanceUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(float*)(Ptr + 392); }
+        set { *(float*)(Ptr + 392) = value; }
     }
 
     /// <summary>
@@ -528,8 +597,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float GlanceRightScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(float*)(Ptr + 396); }
+        set { *(float*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -537,8 +606,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte aLeftShoulder
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }
+        get { return *(byte*)(Ptr + 400); }
+        set { *(byte*)(Ptr + 400) = value; }
     }
 
     /// <summary>
@@ -546,8 +615,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte aRightShoulder
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 401); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 401); }
+        get { return *(byte*)(Ptr + 401); }
+        set { *(byte*)(Ptr + 401) = value; }
     }
 
     /// <summary>
@@ -555,8 +624,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte aTakedownButton
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 402); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 402); }
+        get { return *(byte*)(Ptr + 402); }
+        set { *(byte*)(Ptr + 402) = value; }
     }
 
     /// <summary>
@@ -564,8 +633,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte aQuickStrike
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 403); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 403); }
+        get { return *(byte*)(Ptr + 403); }
+        set { *(byte*)(Ptr + 403) = value; }
     }
 
     /// <summary>
@@ -573,8 +642,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte aHeavyStrike
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(byte*)(Ptr + 404); }
+        set { *(byte*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -582,8 +651,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte aChargeStrike
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 405); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 405); }
+        get { return *(byte*)(Ptr + 405); }
+        set { *(byte*)(Ptr + 405) = value; }
     }
 
     /// <summary>
@@ -591,8 +660,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte aGrappleButton
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 406); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 406); }
+        get { return *(byte*)(Ptr + 406); }
+        set { *(byte*)(Ptr + 406) = value; }
     }
 
     /// <summary>
@@ -600,8 +669,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bGadgetSelectUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 407); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 407); }
+        get { return *(byte*)(Ptr + 407); }
+        set { *(byte*)(Ptr + 407) = value; }
     }
 
     /// <summary>
@@ -609,8 +678,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bGadgetSelectDown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(byte*)(Ptr + 408); }
+        set { *(byte*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -618,8 +687,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bGadgetSelectLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 409); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 409); }
+        get { return *(byte*)(Ptr + 409); }
+        set { *(byte*)(Ptr + 409) = value; }
     }
 
     /// <summary>
@@ -627,8 +696,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bGadgetSelectRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 410); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 410); }
+        get { return *(byte*)(Ptr + 410); }
+        set { *(byte*)(Ptr + 410) = value; }
     }
 
     /// <summary>
@@ -636,8 +705,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bRunButton
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 411); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 411); }
+        get { return *(byte*)(Ptr + 411); }
+        set { *(byte*)(Ptr + 411) = value; }
     }
 
     /// <summary>
@@ -645,8 +714,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bCrouchButton
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(byte*)(Ptr + 412); }
+        set { *(byte*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -654,8 +723,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bReadyGadgetButton
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 413); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 413); }
+        get { return *(byte*)(Ptr + 413); }
+        set { *(byte*)(Ptr + 413) = value; }
     }
 
     /// <summary>
@@ -663,8 +732,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bForensicsButton
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 414); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 414); }
+        get { return *(byte*)(Ptr + 414); }
+        set { *(byte*)(Ptr + 414) = value; }
     }
 
     /// <summary>
@@ -672,8 +741,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bEscButton
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 415); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 415); }
+        get { return *(byte*)(Ptr + 415); }
+        set { *(byte*)(Ptr + 415) = value; }
     }
 
     /// <summary>
@@ -681,8 +750,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float RawLeftY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(float*)(Ptr + 416); }
+        set { *(float*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -690,8 +759,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float RawLeftX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(float*)(Ptr + 420); }
+        set { *(float*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -699,8 +768,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float RawRightY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(float*)(Ptr + 424); }
+        set { *(float*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -708,8 +777,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float RawRightX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -717,8 +786,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float MouseX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -726,8 +795,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float MouseY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -735,8 +804,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aAccelX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(float*)(Ptr + 440); }
+        set { *(float*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -744,8 +813,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aAccelY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(float*)(Ptr + 444); }
+        set { *(float*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -753,8 +822,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aAccelZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(float*)(Ptr + 448); }
+        set { *(float*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -762,8 +831,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float aGyro
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(float*)(Ptr + 452); }
+        set { *(float*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -771,8 +840,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float AccelX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(float*)(Ptr + 456); }
+        set { *(float*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -780,8 +849,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float AccelY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(float*)(Ptr + 460); }
+        set { *(float*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -789,8 +858,8 @@ public partial class RPlayerInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObject
     /// </summary>
     public unsafe float AccelZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(float*)(Ptr + 464); }
+        set { *(float*)(Ptr + 464) = value; }
     }
 
     /// <summary>
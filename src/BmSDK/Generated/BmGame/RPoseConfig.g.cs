@@ -78,48 +78,78 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RPoseConfig>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_AddTransitionRelaxedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 168)]
+    private struct AddTransitionRelaxed_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName MovementStanceA;
+        [FieldOffset(8)] public BmSDK.FName MovementStanceB;
+        [FieldOffset(16)] public BmSDK.FName FullBodyAnim;
+        [FieldOffset(24)] public BmSDK.FName TransitionName;
+    }
+
     /// <summary>
     /// Function: AddTransitionRelaxed
     /// </summary>
     public unsafe virtual void AddTransitionRelaxed(BmSDK.FName MovementStanceA, BmSDK.FName MovementStanceB, BmSDK.FName FullBodyAnim, BmSDK.FName TransitionName = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPoseConfig.AddTransitionRelaxed", true);
-        byte* paramsPtr = stackalloc byte[168];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MovementStanceA, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MovementStanceB, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FullBodyAnim, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionName, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddTransitionRelaxedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPoseConfig.AddTransitionRelaxed", true);
+        var parms = new AddTransitionRelaxed_Params();
+        parms.MovementStanceA = MovementStanceA;
+        parms.MovementStanceB = MovementStanceB;
+        parms.FullBodyAnim = FullBodyAnim;
+        parms.TransitionName = TransitionName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPoseRelaxedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 360)]
+    private struct AddPoseRelaxed_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName MovementStance;
+        [FieldOffset(8)] public BmSDK.FName IdleFullBodyAnim;
+        [FieldOffset(16)] public nint IdleAimingConfig;
+    }
+
     /// <summary>
     /// Function: AddPoseRelaxed
     /// </summary>
     public unsafe virtual void AddPoseRelaxed(BmSDK.FName MovementStance, BmSDK.FName IdleFullBodyAnim, BmSDK.BmGame.RAimingConfig IdleAimingConfig = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPoseConfig.AddPoseRelaxed", true);
-        byte* paramsPtr = stackalloc byte[360];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MovementStance, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IdleFullBodyAnim, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IdleAimingConfig, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPoseRelaxedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPoseConfig.AddPoseRelaxed", true);
+        var parms = new AddPoseRelaxed_Params();
+        parms.MovementStance = MovementStance;
+        parms.IdleFullBodyAnim = IdleFullBodyAnim;
+        parms.IdleAimingConfig = IdleAimingConfig?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPoseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 372)]
+    private struct AddPose_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName MovementStance;
+        [FieldOffset(8)] public BmSDK.FName WeaponStance;
+        [FieldOffset(16)] public BmSDK.FName IdleFullBodyAnim;
+        [FieldOffset(24)] public nint IdleAimingConfig;
+        [FieldOffset(28)] public int AllowTurningToAim;
+    }
+
     /// <summary>
     /// Function: AddPose
     /// </summary>
     public unsafe virtual void AddPose(BmSDK.FName MovementStance, BmSDK.FName WeaponStance, BmSDK.FName IdleFullBodyAnim, BmSDK.BmGame.RAimingConfig IdleAimingConfig = default, bool AllowTurningToAim = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPoseConfig.AddPose", true);
-        byte* paramsPtr = stackalloc byte[372];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MovementStance, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WeaponStance, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IdleFullBodyAnim, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IdleAimingConfig, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AllowTurningToAim, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPoseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RPoseConfig.AddPose", true);
+        var parms = new AddPose_Params();
+        parms.MovementStance = MovementStance;
+        parms.WeaponStance = WeaponStance;
+        parms.IdleFullBodyAnim = IdleFullBodyAnim;
+        parms.IdleAimingConfig = IdleAimingConfig?.Ptr ?? 0;
+        parms.AllowTurningToAim = AllowTurningToAim ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -129,121 +159,79 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 136)]
     public partial record struct FTransition
     {
+        [FieldOffset(132)] private int _bitfield132;
+
         /// <summary>
         /// NameProperty: Name
         /// </summary>
-        public unsafe BmSDK.FName Name
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName Name;
 
         /// <summary>
         /// NameProperty: MovementStanceA
         /// </summary>
-        public unsafe BmSDK.FName MovementStanceA
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName MovementStanceA;
 
         /// <summary>
         /// NameProperty: MovementStanceB
         /// </summary>
-        public unsafe BmSDK.FName MovementStanceB
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.FName MovementStanceB;
 
         /// <summary>
         /// NameProperty: WeaponStanceA
         /// </summary>
-        public unsafe BmSDK.FName WeaponStanceA
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.FName WeaponStanceA;
 
         /// <summary>
         /// NameProperty: WeaponStanceB
         /// </summary>
-        public unsafe BmSDK.FName WeaponStanceB
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.FName WeaponStanceB;
 
         /// <summary>
         /// NameProperty: IdleStanceA
         /// </summary>
-        public unsafe BmSDK.FName IdleStanceA
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public BmSDK.FName IdleStanceA;
 
         /// <summary>
         /// NameProperty: IdleStanceB
         /// </summary>
-        public unsafe BmSDK.FName IdleStanceB
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public BmSDK.FName IdleStanceB;
 
         /// <summary>
         /// ByteProperty: MirroredA
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.EMirroredYesNoMaybe MirroredA
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.EMirroredYesNoMaybe>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public BmSDK.BmGame.RPoseConfig.EMirroredYesNoMaybe MirroredA;
 
         /// <summary>
         /// ByteProperty: MirroredB
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.EMirroredYesNoMaybe MirroredB
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.EMirroredYesNoMaybe>(Ptr + 57); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 57); }; }
-        }
+        [FieldOffset(57)] public BmSDK.BmGame.RPoseConfig.EMirroredYesNoMaybe MirroredB;
 
         /// <summary>
         /// StructProperty: A2B
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig A2B
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public BmSDK.BmGame.RAnimConfig.FAnimConfig A2B;
 
         /// <summary>
         /// StructProperty: B2A
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig B2A
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public BmSDK.BmGame.RAnimConfig.FAnimConfig B2A;
 
         /// <summary>
         /// BoolProperty: Additive
         /// </summary>
-        public unsafe bool Additive
+        public bool Additive
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }; }
+            readonly get => (_bitfield132 & 1) != 0;
+            set { if (value) _bitfield132 |= 1; else _bitfield132 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: AllowTurningToAim
         /// </summary>
-        public unsafe bool AllowTurningToAim
+        public bool AllowTurningToAim
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }; }
+            readonly get => (_bitfield132 & 2) != 0;
+            set { if (value) _bitfield132 |= 2; else _bitfield132 &= ~2; }
         }
     }
 
@@ -282,95 +270,74 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 340)]
     public partial record struct FPose
     {
+        [FieldOffset(84)] private int _bitfield84;
+        [FieldOffset(336)] private int _bitfield336;
+
         /// <summary>
         /// NameProperty: MovementStance
         /// </summary>
-        public unsafe BmSDK.FName MovementStance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName MovementStance;
 
         /// <summary>
         /// NameProperty: WeaponStance
         /// </summary>
-        public unsafe BmSDK.FName WeaponStance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName WeaponStance;
 
         /// <summary>
         /// NameProperty: IdleStance
         /// </summary>
-        public unsafe BmSDK.FName IdleStance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.FName IdleStance;
 
         /// <summary>
         /// StructProperty: Idle
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig Idle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.BmGame.RAnimConfig.FAnimConfig Idle;
 
         /// <summary>
         /// StructProperty: AdditiveIdle
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAdditiveAnimConfig AdditiveIdle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAdditiveAnimConfig>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public BmSDK.BmGame.RAnimConfig.FAdditiveAnimConfig AdditiveIdle;
 
         /// <summary>
         /// BoolProperty: AllowTurningToAim
         /// </summary>
-        public unsafe bool AllowTurningToAim
+        public bool AllowTurningToAim
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }; }
+            readonly get => (_bitfield84 & 1) != 0;
+            set { if (value) _bitfield84 |= 1; else _bitfield84 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: AllowIndependentAiming
         /// </summary>
-        public unsafe bool AllowIndependentAiming
+        public bool AllowIndependentAiming
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }; }
+            readonly get => (_bitfield84 & 2) != 0;
+            set { if (value) _bitfield84 |= 2; else _bitfield84 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: AllowCatchUpToAimAtWhileTurning
         /// </summary>
-        public unsafe bool AllowCatchUpToAimAtWhileTurning
+        public bool AllowCatchUpToAimAtWhileTurning
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }; }
+            readonly get => (_bitfield84 & 4) != 0;
+            set { if (value) _bitfield84 |= 4; else _bitfield84 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: UseAlternativeMovementTransitionDurations
         /// </summary>
-        public unsafe bool UseAlternativeMovementTransitionDurations
+        public bool UseAlternativeMovementTransitionDurations
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }; }
+            readonly get => (_bitfield84 & 8) != 0;
+            set { if (value) _bitfield84 |= 8; else _bitfield84 &= ~8; }
         }
 
         /// <summary>
         /// ByteProperty: AllowAutomaticMirroring
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.EYesNoDefault AllowAutomaticMirroring
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.EYesNoDefault>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
-        }
+        [FieldOffset(88)] public BmSDK.BmGame.RAnimConfig.EYesNoDefault AllowAutomaticMirroring;
 
         /// <summary>
         /// ArrayProperty: Overlays
@@ -384,11 +351,7 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Movement
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.FMovement Movement
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.FMovement>(Ptr + 104); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }; }
-        }
+        [FieldOffset(104)] public BmSDK.BmGame.RPoseConfig.FMovement Movement;
 
         /// <summary>
         /// ArrayProperty: AdditiveAnims
@@ -402,100 +365,68 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: RandomIdleOverlays
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.FRandomIdleOverlays RandomIdleOverlays
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.FRandomIdleOverlays>(Ptr + 208); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }; }
-        }
+        [FieldOffset(208)] public BmSDK.BmGame.RPoseConfig.FRandomIdleOverlays RandomIdleOverlays;
 
         /// <summary>
         /// StructProperty: LegYawConfig
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.FChaserConfig LegYawConfig
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.FChaserConfig>(Ptr + 220); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }; }
-        }
+        [FieldOffset(220)] public BmSDK.BmGame.RPoseConfig.FChaserConfig LegYawConfig;
 
         /// <summary>
         /// StructProperty: RunLegYawConfig
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.FChaserConfig RunLegYawConfig
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.FChaserConfig>(Ptr + 232); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }; }
-        }
+        [FieldOffset(232)] public BmSDK.BmGame.RPoseConfig.FChaserConfig RunLegYawConfig;
 
         /// <summary>
         /// StructProperty: LegDirectionConfig
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.FChaserConfig LegDirectionConfig
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.FChaserConfig>(Ptr + 244); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }; }
-        }
+        [FieldOffset(244)] public BmSDK.BmGame.RPoseConfig.FChaserConfig LegDirectionConfig;
 
         /// <summary>
         /// StructProperty: AimAtTiming
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.FAimingTransitionTiming AimAtTiming
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.FAimingTransitionTiming>(Ptr + 256); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }; }
-        }
+        [FieldOffset(256)] public BmSDK.BmGame.RPoseConfig.FAimingTransitionTiming AimAtTiming;
 
         /// <summary>
         /// StructProperty: LookAtTiming
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.FAimingTransitionTiming LookAtTiming
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.FAimingTransitionTiming>(Ptr + 268); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }; }
-        }
+        [FieldOffset(268)] public BmSDK.BmGame.RPoseConfig.FAimingTransitionTiming LookAtTiming;
 
         /// <summary>
         /// StructProperty: RootBoneTranslationOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 RootBoneTranslationOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 280); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 280); }; }
-        }
+        [FieldOffset(280)] public System.Numerics.Vector3 RootBoneTranslationOffset;
 
         /// <summary>
         /// StructProperty: FloorCorrection
         /// </summary>
-        public unsafe BmSDK.BmGame.RGameInfo.FFloorCorrectionConfig FloorCorrection
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.FFloorCorrectionConfig>(Ptr + 292); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }; }
-        }
+        [FieldOffset(292)] public BmSDK.BmGame.RGameInfo.FFloorCorrectionConfig FloorCorrection;
 
         /// <summary>
         /// BoolProperty: IdleMirrordnessMatchesFootStepPhase
         /// </summary>
-        public unsafe bool IdleMirrordnessMatchesFootStepPhase
+        public bool IdleMirrordnessMatchesFootStepPhase
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 336) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 336); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 336); }; }
+            readonly get => (_bitfield336 & 1) != 0;
+            set { if (value) _bitfield336 |= 1; else _bitfield336 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: ForceTurnsAtLowSpeedScale
         /// </summary>
-        public unsafe bool ForceTurnsAtLowSpeedScale
+        public bool ForceTurnsAtLowSpeedScale
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 336) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 336); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 336); }; }
+            readonly get => (_bitfield336 & 2) != 0;
+            set { if (value) _bitfield336 |= 2; else _bitfield336 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: FallAnimDoesntConsumeMotionWeight
         /// </summary>
-        public unsafe bool FallAnimDoesntConsumeMotionWeight
+        public bool FallAnimDoesntConsumeMotionWeight
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 336) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 336); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 336); }; }
+            readonly get => (_bitfield336 & 4) != 0;
+            set { if (value) _bitfield336 |= 4; else _bitfield336 &= ~4; }
         }
     }
 
@@ -508,29 +439,17 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: InDuration
         /// </summary>
-        public unsafe float InDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float InDuration;
 
         /// <summary>
         /// FloatProperty: OutDuration
         /// </summary>
-        public unsafe float OutDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float OutDuration;
 
         /// <summary>
         /// FloatProperty: SpringStrength
         /// </summary>
-        public unsafe float SpringStrength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float SpringStrength;
     }
 
     /// <summary>
@@ -542,29 +461,17 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Strength
         /// </summary>
-        public unsafe float Strength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Strength;
 
         /// <summary>
         /// FloatProperty: MaxVelocity
         /// </summary>
-        public unsafe float MaxVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float MaxVelocity;
 
         /// <summary>
         /// FloatProperty: MaxAccel
         /// </summary>
-        public unsafe float MaxAccel
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float MaxAccel;
     }
 
     /// <summary>
@@ -576,11 +483,7 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: DecelDistance
         /// </summary>
-        public unsafe float DecelDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float DecelDistance;
     }
 
     /// <summary>
@@ -592,65 +495,37 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: AllowedToTurnUnderSpeed
         /// </summary>
-        public unsafe float AllowedToTurnUnderSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float AllowedToTurnUnderSpeed;
 
         /// <summary>
         /// FloatProperty: AllowedToStopOverSpeed
         /// </summary>
-        public unsafe float AllowedToStopOverSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float AllowedToStopOverSpeed;
 
         /// <summary>
         /// FloatProperty: FaceAtTurnThreshold
         /// </summary>
-        public unsafe float FaceAtTurnThreshold
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float FaceAtTurnThreshold;
 
         /// <summary>
         /// FloatProperty: AimAtTurnThreshold
         /// </summary>
-        public unsafe float AimAtTurnThreshold
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float AimAtTurnThreshold;
 
         /// <summary>
         /// FloatProperty: TurnCancelThreshold
         /// </summary>
-        public unsafe float TurnCancelThreshold
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float TurnCancelThreshold;
 
         /// <summary>
         /// FloatProperty: MinAutomaticTurnDuration
         /// </summary>
-        public unsafe float MinAutomaticTurnDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float MinAutomaticTurnDuration;
 
         /// <summary>
         /// FloatProperty: MaxAutomaticTurnDuration
         /// </summary>
-        public unsafe float MaxAutomaticTurnDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float MaxAutomaticTurnDuration;
     }
 
     /// <summary>
@@ -671,20 +546,12 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: MinTime
         /// </summary>
-        public unsafe float MinTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float MinTime;
 
         /// <summary>
         /// FloatProperty: MaxTime
         /// </summary>
-        public unsafe float MaxTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float MaxTime;
     }
 
     /// <summary>
@@ -696,20 +563,12 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: Add
         /// </summary>
-        public unsafe BmSDK.FName Add
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName Add;
 
         /// <summary>
         /// NameProperty: Subtract
         /// </summary>
-        public unsafe BmSDK.FName Subtract
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName Subtract;
     }
 
     /// <summary>
@@ -721,20 +580,12 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: Name
         /// </summary>
-        public unsafe BmSDK.FName Name
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName Name;
 
         /// <summary>
         /// StructProperty: Anims
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig Anims
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.BmGame.RAnimConfig.FAnimConfig Anims;
     }
 
     /// <summary>
@@ -755,29 +606,17 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Fall
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig Fall
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.BmGame.RAnimConfig.FAnimConfig Fall;
 
         /// <summary>
         /// StructProperty: Land
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig Land
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public BmSDK.BmGame.RAnimConfig.FAnimConfig Land;
 
         /// <summary>
         /// ByteProperty: Style
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.EMovementStyle Style
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.EMovementStyle>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
-        }
+        [FieldOffset(84)] public BmSDK.BmGame.RPoseConfig.EMovementStyle Style;
 
         /// <summary>
         /// ObjectProperty: AnimSet
@@ -806,58 +645,40 @@ public partial class RPoseConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 120)]
     public partial record struct FMovementAnim
     {
+        [FieldOffset(116)] private int _bitfield116;
+
         /// <summary>
         /// ByteProperty: Speed
         /// </summary>
-        public unsafe BmSDK.BmGame.RPoseConfig.EMovementSpeed Speed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.EMovementSpeed>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.BmGame.RPoseConfig.EMovementSpeed Speed;
 
         /// <summary>
         /// StructProperty: Anims
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig Anims
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.BmGame.RAnimConfig.FAnimConfig Anims;
 
         /// <summary>
         /// StructProperty: LeftAnims
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig LeftAnims
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public BmSDK.BmGame.RAnimConfig.FAnimConfig LeftAnims;
 
         /// <summary>
         /// StructProperty: RightAnims
         /// </summary>
-        public unsafe BmSDK.BmGame.RAnimConfig.FAnimConfig RightAnims
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimConfig.FAnimConfig>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
-        }
+        [FieldOffset(76)] public BmSDK.BmGame.RAnimConfig.FAnimConfig RightAnims;
 
         /// <summary>
         /// FloatProperty: LeftRightYawAngle
         /// </summary>
-        public unsafe float LeftRightYawAngle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }; }
-        }
+        [FieldOffset(112)] public float LeftRightYawAngle;
 
         /// <summary>
         /// BoolProperty: Optional
         /// </summary>
-        public unsafe bool Optional
+        public bool Optional
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }; }
+            readonly get => (_bitfield116 & 1) != 0;
+            set { if (value) _bitfield116 |= 1; else _bitfield116 &= ~1; }
         }
     }
 
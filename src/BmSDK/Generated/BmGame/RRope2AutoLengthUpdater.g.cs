@@ -83,8 +83,8 @@ public partial class RRope2AutoLengthUpdater : BmSDK.BmGame.RRope2Updater, BmSDK
     /// </summary>
     public unsafe BmSDK.BmGame.RRope2Component.ERope2LengthChangeEndType LengthChangeEndType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RRope2Component.ERope2LengthChangeEndType>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(BmSDK.BmGame.RRope2Component.ERope2LengthChangeEndType*)(Ptr + 52); }
+        set { *(BmSDK.BmGame.RRope2Component.ERope2LengthChangeEndType*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RRope2AutoLengthUpdater : BmSDK.BmGame.RRope2Updater, BmSDK
     /// </summary>
     public unsafe float MinAutoLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RRope2AutoLengthUpdater : BmSDK.BmGame.RRope2Updater, BmSDK
     /// </summary>
     public unsafe float MaxAutoLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RRope2AutoLengthUpdater : BmSDK.BmGame.RRope2Updater, BmSDK
     /// </summary>
     public unsafe float AutoLengthMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -119,7 +119,7 @@ public partial class RRope2AutoLengthUpdater : BmSDK.BmGame.RRope2Updater, BmSDK
     /// </summary>
     public unsafe float MaxLengthChangeSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 }
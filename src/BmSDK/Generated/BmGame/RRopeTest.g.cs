@@ -128,8 +128,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxLength1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(float*)(Ptr + 476); }
+        set { *(float*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float Length1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(float*)(Ptr + 480); }
+        set { *(float*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float ChangeToInstantlyLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(float*)(Ptr + 484); }
+        set { *(float*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float GradualChangeLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(float*)(Ptr + 488); }
+        set { *(float*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float GradualChangeDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(float*)(Ptr + 492); }
+        set { *(float*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -212,8 +212,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float StretchBreakRatio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(float*)(Ptr + 532); }
+        set { *(float*)(Ptr + 532) = value; }
     }
 
     /// <summary>
@@ -230,8 +230,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float StretchRopeLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(float*)(Ptr + 540); }
+        set { *(float*)(Ptr + 540) = value; }
     }
 
     /// <summary>
@@ -239,8 +239,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RRopeComponentBase.ERopeEndType StretchRopeEnd
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RRopeComponentBase.ERopeEndType>(Ptr + 544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 544); }
+        get { return *(BmSDK.BmGame.RRopeComponentBase.ERopeEndType*)(Ptr + 544); }
+        set { *(BmSDK.BmGame.RRopeComponentBase.ERopeEndType*)(Ptr + 544) = value; }
     }
 
     /// <summary>
@@ -248,8 +248,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RRopeTest.ERopeTestState CurrentTestState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RRopeTest.ERopeTestState>(Ptr + 545); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 545); }
+        get { return *(BmSDK.BmGame.RRopeTest.ERopeTestState*)(Ptr + 545); }
+        set { *(BmSDK.BmGame.RRopeTest.ERopeTestState*)(Ptr + 545) = value; }
     }
 
     /// <summary>
@@ -257,8 +257,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RRopeTest.ERopeTestState WaitForwardState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RRopeTest.ERopeTestState>(Ptr + 546); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 546); }
+        get { return *(BmSDK.BmGame.RRopeTest.ERopeTestState*)(Ptr + 546); }
+        set { *(BmSDK.BmGame.RRopeTest.ERopeTestState*)(Ptr + 546) = value; }
     }
 
     /// <summary>
@@ -266,8 +266,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float waitDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(float*)(Ptr + 548); }
+        set { *(float*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -275,8 +275,8 @@ public partial class RRopeTest : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float StateWaitDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(float*)(Ptr + 552); }
+        set { *(float*)(Ptr + 552) = value; }
     }
 
     /// <summary>
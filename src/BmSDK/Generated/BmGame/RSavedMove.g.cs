@@ -78,17 +78,36 @@ public partial class RSavedMove : BmSDK.Engine.SavedMove, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RSavedMove>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetFlagsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetFlags_Params
+    {
+        [FieldOffset(0)] public byte Flags;
+        [FieldOffset(4)] public nint PC;
+        [FieldOffset(8)] public BmSDK.Engine.Actor.EDoubleClickDir ReturnValue;
+    }
+
     /// <summary>
     /// Function: SetFlags
     /// </summary>
     public unsafe static BmSDK.Engine.Actor.EDoubleClickDir SetFlags(byte Flags, BmSDK.Engine.PlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSavedMove.SetFlags", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Flags, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EDoubleClickDir>(paramsPtr + 8);
+        var funcManaged = s_SetFlagsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSavedMove.SetFlags", true);
+        var parms = new SetFlags_Params();
+        parms.Flags = Flags;
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanCombineWithFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CanCombineWith_Params
+    {
+        [FieldOffset(0)] public nint NewMove;
+        [FieldOffset(4)] public nint inPawn;
+        [FieldOffset(8)] public float MaxDelta;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -96,13 +115,13 @@ public partial class RSavedMove : BmSDK.Engine.SavedMove, BmSDK.IGameObject
     /// </summary>
     public unsafe override bool CanCombineWith(BmSDK.Engine.SavedMove NewMove, BmSDK.Engine.Pawn inPawn, float MaxDelta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSavedMove.CanCombineWith", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMove, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inPawn, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxDelta, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_CanCombineWithFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSavedMove.CanCombineWith", true);
+        var parms = new CanCombineWith_Params();
+        parms.NewMove = NewMove?.Ptr ?? 0;
+        parms.inPawn = inPawn?.Ptr ?? 0;
+        parms.MaxDelta = MaxDelta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -122,8 +141,8 @@ public partial class RSavedMove : BmSDK.Engine.SavedMove, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RPoseConfig.EMovementSpeed MovementSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.EMovementSpeed>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(BmSDK.BmGame.RPoseConfig.EMovementSpeed*)(Ptr + 240); }
+        set { *(BmSDK.BmGame.RPoseConfig.EMovementSpeed*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -131,8 +150,8 @@ public partial class RSavedMove : BmSDK.Engine.SavedMove, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bStandingOffEdge
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 244); }
+        get { return (*(int*)(Ptr + 244) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 244) |= 1; else *(int*)(Ptr + 244) &= ~1; }
     }
 
     /// <summary>
@@ -140,8 +159,8 @@ public partial class RSavedMove : BmSDK.Engine.SavedMove, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bStopPlayerFallingOffEdges
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 244); }
+        get { return (*(int*)(Ptr + 244) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 244) |= 2; else *(int*)(Ptr + 244) &= ~2; }
     }
 
     /// <summary>
@@ -149,7 +168,7 @@ public partial class RSavedMove : BmSDK.Engine.SavedMove, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHoldingRun
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 244); }
+        get { return (*(int*)(Ptr + 244) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 244) |= 4; else *(int*)(Ptr + 244) &= ~4; }
     }
 }
@@ -92,8 +92,8 @@ public partial class RScriptConversation : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDeleted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RScriptConversation : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bNoFaceFX
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 2; else *(int*)(Ptr + 56) &= ~2; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RScriptConversation : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUsedAsBroadcastIntercept
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 4; else *(int*)(Ptr + 56) &= ~4; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RScriptConversation : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AkWwise.EDialogueHelperType DialogueConv_Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.EDialogueHelperType>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.Engine.AkWwise.EDialogueHelperType*)(Ptr + 60); }
+        set { *(BmSDK.Engine.AkWwise.EDialogueHelperType*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RScriptConversation : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.RDialogueEvent.EPriority ConversationPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RDialogueEvent.EPriority>(Ptr + 61); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 61); }
+        get { return *(BmSDK.Engine.RDialogueEvent.EPriority*)(Ptr + 61); }
+        set { *(BmSDK.Engine.RDialogueEvent.EPriority*)(Ptr + 61) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RScriptConversation : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ImportRef
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(int*)(Ptr + 64); }
+        set { *(int*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -150,20 +150,12 @@ public partial class RScriptConversation : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: CharacterName
         /// </summary>
-        public unsafe BmSDK.FName CharacterName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName CharacterName;
 
         /// <summary>
         /// NameProperty: AnimationName
         /// </summary>
-        public unsafe BmSDK.FName AnimationName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName AnimationName;
 
         /// <summary>
         /// ObjectProperty: DialogueLine
@@ -78,15 +78,28 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
         where TComponent : class, Framework.IScriptComponent<RSeqAct_CameraLookAt>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_CameraLookAt.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_CameraLookAt.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Activated_Params
+    {
     }
 
     /// <summary>
@@ -94,9 +107,9 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_CameraLookAt.Activated", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_CameraLookAt.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -129,8 +142,8 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.CameraLookAtStrength LookAtType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.CameraLookAtStrength>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(BmSDK.BmGame.RGameInfo.CameraLookAtStrength*)(Ptr + 224); }
+        set { *(BmSDK.BmGame.RGameInfo.CameraLookAtStrength*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -138,8 +151,8 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.CameraLookAtSpeed LookAtSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.CameraLookAtSpeed>(Ptr + 225); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 225); }
+        get { return *(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed*)(Ptr + 225); }
+        set { *(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed*)(Ptr + 225) = value; }
     }
 
     /// <summary>
@@ -147,8 +160,8 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe bool bAffectPitch
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 228); }
+        get { return (*(int*)(Ptr + 228) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 228) |= 1; else *(int*)(Ptr + 228) &= ~1; }
     }
 
     /// <summary>
@@ -156,8 +169,8 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe bool bAffectYaw
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 228); }
+        get { return (*(int*)(Ptr + 228) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 228) |= 2; else *(int*)(Ptr + 228) &= ~2; }
     }
 
     /// <summary>
@@ -165,8 +178,8 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe bool bForceZoom
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 228); }
+        get { return (*(int*)(Ptr + 228) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 228) |= 4; else *(int*)(Ptr + 228) &= ~4; }
     }
 
     /// <summary>
@@ -174,8 +187,8 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe bool bForceCinematicMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 228); }
+        get { return (*(int*)(Ptr + 228) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 228) |= 8; else *(int*)(Ptr + 228) &= ~8; }
     }
 
     /// <summary>
@@ -183,7 +196,7 @@ public partial class RSeqAct_CameraLookAt : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe float Duration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(float*)(Ptr + 232); }
+        set { *(float*)(Ptr + 232) = value; }
     }
 }
@@ -92,7 +92,7 @@ public partial class RSeqAct_ChangeDebugLabelText : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe int Int
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(int*)(Ptr + 216); }
+        set { *(int*)(Ptr + 216) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RSeqAct_DistributeAcrossFrames : BmSDK.Engine.SeqAct_Latent
     /// </summary>
     public unsafe int NextOutputToTrigger
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(int*)(Ptr + 220); }
+        set { *(int*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class RSeqAct_DistributeAcrossFrames : BmSDK.Engine.SeqAct_Latent
     /// </summary>
     public unsafe int LinkCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(int*)(Ptr + 224); }
+        set { *(int*)(Ptr + 224) = value; }
     }
 }
@@ -78,14 +78,20 @@ public partial class RSeqAct_ExplodeFractureWall : BmSDK.Engine.SequenceAction,
         where TComponent : class, Framework.IScriptComponent<RSeqAct_ExplodeFractureWall>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Activated_Params
+    {
+    }
+
     /// <summary>
     /// Function: Activated
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_ExplodeFractureWall.Activated", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_ExplodeFractureWall.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -100,8 +106,8 @@ public partial class RSeqAct_ExplodeFractureWall : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe bool bIncludeSupportChunks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 1; else *(int*)(Ptr + 216) &= ~1; }
     }
 
     /// <summary>
@@ -109,7 +115,7 @@ public partial class RSeqAct_ExplodeFractureWall : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe bool bWantPhysChunksAndParticles
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 2; else *(int*)(Ptr + 216) &= ~2; }
     }
 }
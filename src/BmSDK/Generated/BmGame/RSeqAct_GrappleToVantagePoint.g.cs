@@ -78,14 +78,20 @@ public partial class RSeqAct_GrappleToVantagePoint : BmSDK.Engine.SequenceAction
         where TComponent : class, Framework.IScriptComponent<RSeqAct_GrappleToVantagePoint>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GrappleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Grapple_Params
+    {
+    }
+
     /// <summary>
     /// Function: Grapple
     /// </summary>
     public unsafe virtual void Grapple()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_GrappleToVantagePoint.Grapple", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GrappleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_GrappleToVantagePoint.Grapple", true);
+        var parms = new Grapple_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -112,8 +118,8 @@ public partial class RSeqAct_GrappleToVantagePoint : BmSDK.Engine.SequenceAction
     /// </summary>
     public unsafe bool bGrappleIfAlreadyOnVantagePoint
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 212); }
+        get { return (*(int*)(Ptr + 212) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 212) |= 1; else *(int*)(Ptr + 212) &= ~1; }
     }
 
     /// <summary>
@@ -121,7 +127,7 @@ public partial class RSeqAct_GrappleToVantagePoint : BmSDK.Engine.SequenceAction
     /// </summary>
     public unsafe bool bUseCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 212); }
+        get { return (*(int*)(Ptr + 212) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 212) |= 2; else *(int*)(Ptr + 212) &= ~2; }
     }
 }
@@ -73,14 +73,20 @@ public partial class RSeqAct_HeadToHeadCombatSpawnerBase : BmSDK.BmGame.RSeqAct_
         where TComponent : class, Framework.IScriptComponent<RSeqAct_HeadToHeadCombatSpawnerBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PlayerTakesDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayerTakesDamage_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayerTakesDamage
     /// </summary>
     public unsafe virtual void PlayerTakesDamage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_HeadToHeadCombatSpawnerBase.PlayerTakesDamage", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerTakesDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_HeadToHeadCombatSpawnerBase.PlayerTakesDamage", true);
+        var parms = new PlayerTakesDamage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -89,7 +95,7 @@ public partial class RSeqAct_HeadToHeadCombatSpawnerBase : BmSDK.BmGame.RSeqAct_
     /// </summary>
     public unsafe bool bDisableForensicsModes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 224); }
+        get { return (*(int*)(Ptr + 224) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 224) |= 1; else *(int*)(Ptr + 224) &= ~1; }
     }
 }
@@ -78,14 +78,20 @@ public partial class RSeqAct_HudExtensionBossControl : BmSDK.Engine.SequenceActi
         where TComponent : class, Framework.IScriptComponent<RSeqAct_HudExtensionBossControl>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Activated_Params
+    {
+    }
+
     /// <summary>
     /// Function: Activated
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_HudExtensionBossControl.Activated", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_HudExtensionBossControl.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -94,8 +100,8 @@ public partial class RSeqAct_HudExtensionBossControl : BmSDK.Engine.SequenceActi
     /// </summary>
     public unsafe BmSDK.BmGame.RSeqAct_HudExtensionBossControl.BossHUDControl TheAction
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSeqAct_HudExtensionBossControl.BossHUDControl>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.BmGame.RSeqAct_HudExtensionBossControl.BossHUDControl*)(Ptr + 204); }
+        set { *(BmSDK.BmGame.RSeqAct_HudExtensionBossControl.BossHUDControl*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -78,15 +78,22 @@ public partial class RSeqAct_LockDown : BmSDK.Engine.SequenceAction, BmSDK.IGame
         where TComponent : class, Framework.IScriptComponent<RSeqAct_LockDown>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_LockDown.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_LockDown.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -94,8 +101,8 @@ public partial class RSeqAct_LockDown : BmSDK.Engine.SequenceAction, BmSDK.IGame
     /// </summary>
     public unsafe bool bLockAutomatedLevelStreaming
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 1; else *(int*)(Ptr + 204) &= ~1; }
     }
 
     /// <summary>
@@ -103,8 +110,8 @@ public partial class RSeqAct_LockDown : BmSDK.Engine.SequenceAction, BmSDK.IGame
     /// </summary>
     public unsafe bool bUnlockAutomatedLevelStreaming
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 2; else *(int*)(Ptr + 204) &= ~2; }
     }
 
     /// <summary>
@@ -112,8 +119,8 @@ public partial class RSeqAct_LockDown : BmSDK.Engine.SequenceAction, BmSDK.IGame
     /// </summary>
     public unsafe bool bMakeLevelsVisibleOnLoad
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 4; else *(int*)(Ptr + 204) &= ~4; }
     }
 
     /// <summary>
@@ -121,8 +128,8 @@ public partial class RSeqAct_LockDown : BmSDK.Engine.SequenceAction, BmSDK.IGame
     /// </summary>
     public unsafe bool bForceUnload
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 8; else *(int*)(Ptr + 204) &= ~8; }
     }
 
     /// <summary>
@@ -130,8 +137,8 @@ public partial class RSeqAct_LockDown : BmSDK.Engine.SequenceAction, BmSDK.IGame
     /// </summary>
     public unsafe bool bForceCinematicModeOnTeleport
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 16; else *(int*)(Ptr + 204) &= ~16; }
     }
 
     /// <summary>
@@ -139,7 +146,7 @@ public partial class RSeqAct_LockDown : BmSDK.Engine.SequenceAction, BmSDK.IGame
     /// </summary>
     public unsafe bool bSkipMovingPlayerOnTeleport
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 32; else *(int*)(Ptr + 204) &= ~32; }
     }
 }
@@ -78,15 +78,22 @@ public partial class RSeqAct_ModifyStreaming : BmSDK.Engine.SequenceAction, BmSD
         where TComponent : class, Framework.IScriptComponent<RSeqAct_ModifyStreaming>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_ModifyStreaming.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_ModifyStreaming.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -103,8 +110,8 @@ public partial class RSeqAct_ModifyStreaming : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe BmSDK.FName PersistentLevelTransitionName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(BmSDK.FName*)(Ptr + 216); }
+        set { *(BmSDK.FName*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -130,8 +137,8 @@ public partial class RSeqAct_ModifyStreaming : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.ECombatLockType GlobalDoorLockType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.ECombatLockType>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(BmSDK.BmGame.RGameInfo.ECombatLockType*)(Ptr + 248); }
+        set { *(BmSDK.BmGame.RGameInfo.ECombatLockType*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -139,8 +146,8 @@ public partial class RSeqAct_ModifyStreaming : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe BmSDK.FName GlobalLockRoom
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(BmSDK.FName*)(Ptr + 252); }
+        set { *(BmSDK.FName*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -148,8 +155,8 @@ public partial class RSeqAct_ModifyStreaming : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe bool bUnloadOtherLevelWhenStreamingLocked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 1; else *(int*)(Ptr + 260) &= ~1; }
     }
 
     /// <summary>
@@ -157,7 +164,7 @@ public partial class RSeqAct_ModifyStreaming : BmSDK.Engine.SequenceAction, BmSD
     /// </summary>
     public unsafe bool bUnlockStreamingOnChangeMap
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 2; else *(int*)(Ptr + 260) &= ~2; }
     }
 }
@@ -78,26 +78,39 @@ public partial class RSeqAct_OverrideWalkCamera : BmSDK.Engine.SequenceAction, B
         where TComponent : class, Framework.IScriptComponent<RSeqAct_OverrideWalkCamera>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Activated_Params
+    {
+    }
+
     /// <summary>
     /// Function: Activated
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_OverrideWalkCamera.Activated", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_OverrideWalkCamera.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_OverrideWalkCamera.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_OverrideWalkCamera.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -105,8 +118,8 @@ public partial class RSeqAct_OverrideWalkCamera : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe BmSDK.FName CameraName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.FName*)(Ptr + 204); }
+        set { *(BmSDK.FName*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -114,8 +127,8 @@ public partial class RSeqAct_OverrideWalkCamera : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe bool bForceCinematicMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 212); }
+        get { return (*(int*)(Ptr + 212) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 212) |= 1; else *(int*)(Ptr + 212) &= ~1; }
     }
 
     /// <summary>
@@ -123,8 +136,8 @@ public partial class RSeqAct_OverrideWalkCamera : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe bool bCustomCameraZoomAllowed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 212); }
+        get { return (*(int*)(Ptr + 212) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 212) |= 2; else *(int*)(Ptr + 212) &= ~2; }
     }
 
     /// <summary>
@@ -132,8 +145,8 @@ public partial class RSeqAct_OverrideWalkCamera : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe bool DontSwitchCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 212); }
+        get { return (*(int*)(Ptr + 212) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 212) |= 4; else *(int*)(Ptr + 212) &= ~4; }
     }
 
     /// <summary>
@@ -147,8 +160,8 @@ public partial class RSeqAct_OverrideWalkCamera : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float CustomCameraFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(float*)(Ptr + 340); }
+        set { *(float*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -156,8 +169,8 @@ public partial class RSeqAct_OverrideWalkCamera : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float CustomCameraZoomFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(float*)(Ptr + 344); }
+        set { *(float*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -165,8 +178,8 @@ public partial class RSeqAct_OverrideWalkCamera : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float CustomCameraTransitionTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 
     /// <summary>
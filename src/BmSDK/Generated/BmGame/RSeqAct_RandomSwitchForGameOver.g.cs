@@ -78,25 +78,37 @@ public partial class RSeqAct_RandomSwitchForGameOver : BmSDK.Engine.SeqAct_Switc
         where TComponent : class, Framework.IScriptComponent<RSeqAct_RandomSwitchForGameOver>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CopyOutStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CopyOutState_Params
+    {
+    }
+
     /// <summary>
     /// Function: CopyOutState
     /// </summary>
     public unsafe virtual void CopyOutState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RandomSwitchForGameOver.CopyOutState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CopyOutStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RandomSwitchForGameOver.CopyOutState", true);
+        var parms = new CopyOutState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CopyInStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CopyInState_Params
+    {
+    }
+
     /// <summary>
     /// Function: CopyInState
     /// </summary>
     public unsafe virtual void CopyInState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RandomSwitchForGameOver.CopyInState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CopyInStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RandomSwitchForGameOver.CopyInState", true);
+        var parms = new CopyInState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -105,7 +117,7 @@ public partial class RSeqAct_RandomSwitchForGameOver : BmSDK.Engine.SeqAct_Switc
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentOptions.ERandomSwitchStateType Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentOptions.ERandomSwitchStateType>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(BmSDK.BmGame.RPersistentOptions.ERandomSwitchStateType*)(Ptr + 228); }
+        set { *(BmSDK.BmGame.RPersistentOptions.ERandomSwitchStateType*)(Ptr + 228) = value; }
     }
 }
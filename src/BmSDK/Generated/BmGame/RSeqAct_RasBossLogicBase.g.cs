@@ -73,15 +73,28 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
         where TComponent : class, Framework.IScriptComponent<RSeqAct_RasBossLogicBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ActivateFirstLookupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateFirstLookup_Params
+    {
     }
 
     /// <summary>
@@ -89,282 +102,441 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual void ActivateFirstLookup()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateFirstLookup", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateFirstLookupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateFirstLookup", true);
+        var parms = new ActivateFirstLookup_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideRECHelpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideRECHelp_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideRECHelp
     /// </summary>
     public unsafe virtual void HideRECHelp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.HideRECHelp", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideRECHelpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.HideRECHelp", true);
+        var parms = new HideRECHelp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowRECHelpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowRECHelp_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowRECHelp
     /// </summary>
     public unsafe virtual void ShowRECHelp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ShowRECHelp", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowRECHelpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ShowRECHelp", true);
+        var parms = new ShowRECHelp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeBatmanDamageLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ChangeBatmanDamageLevel_Params
+    {
+    }
+
     /// <summary>
     /// Function: ChangeBatmanDamageLevel
     /// </summary>
     public unsafe virtual void ChangeBatmanDamageLevel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ChangeBatmanDamageLevel", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeBatmanDamageLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ChangeBatmanDamageLevel", true);
+        var parms = new ChangeBatmanDamageLevel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowNewGadgetScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowNewGadgetScreen_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowNewGadgetScreen
     /// </summary>
     public unsafe virtual void ShowNewGadgetScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ShowNewGadgetScreen", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowNewGadgetScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ShowNewGadgetScreen", true);
+        var parms = new ShowNewGadgetScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RasHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RasHit_Params
+    {
+    }
+
     /// <summary>
     /// Function: RasHit
     /// </summary>
     public unsafe virtual void RasHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RasHit", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RasHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RasHit", true);
+        var parms = new RasHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateFirstChargeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateFirstCharge_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateFirstCharge
     /// </summary>
     public unsafe virtual void ActivateFirstCharge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateFirstCharge", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateFirstChargeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateFirstCharge", true);
+        var parms = new ActivateFirstCharge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TeleportOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TeleportOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: TeleportOut
     /// </summary>
     public unsafe virtual void TeleportOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.TeleportOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TeleportOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.TeleportOut", true);
+        var parms = new TeleportOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TeleportInFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TeleportIn_Params
+    {
+    }
+
     /// <summary>
     /// Function: TeleportIn
     /// </summary>
     public unsafe virtual void TeleportIn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.TeleportIn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TeleportInFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.TeleportIn", true);
+        var parms = new TeleportIn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RasZappedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RasZapped_Params
+    {
+    }
+
     /// <summary>
     /// Function: RasZapped
     /// </summary>
     public unsafe virtual void RasZapped()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RasZapped", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RasZappedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RasZapped", true);
+        var parms = new RasZapped_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RasBurstOutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RasBurstOut_Params
+    {
+    }
+
     /// <summary>
     /// Function: RasBurstOut
     /// </summary>
     public unsafe virtual void RasBurstOut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RasBurstOut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RasBurstOutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RasBurstOut", true);
+        var parms = new RasBurstOut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateBurlySlowMoEndFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateBurlySlowMoEnd_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateBurlySlowMoEnd
     /// </summary>
     public unsafe virtual void ActivateBurlySlowMoEnd()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateBurlySlowMoEnd", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateBurlySlowMoEndFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateBurlySlowMoEnd", true);
+        var parms = new ActivateBurlySlowMoEnd_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateBurlySlowMoStartFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateBurlySlowMoStart_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateBurlySlowMoStart
     /// </summary>
     public unsafe virtual void ActivateBurlySlowMoStart()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateBurlySlowMoStart", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateBurlySlowMoStartFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateBurlySlowMoStart", true);
+        var parms = new ActivateBurlySlowMoStart_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateTakeHostageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ActivateTakeHostage_Params
+    {
+        [FieldOffset(0)] public nint NewTalia;
+        [FieldOffset(4)] public nint NewRas;
+    }
+
     /// <summary>
     /// Function: ActivateTakeHostage
     /// </summary>
     public unsafe virtual void ActivateTakeHostage(BmSDK.GameObject NewTalia, BmSDK.GameObject NewRas)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateTakeHostage", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTalia, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewRas, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateTakeHostageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateTakeHostage", true);
+        var parms = new ActivateTakeHostage_Params();
+        parms.NewTalia = NewTalia?.Ptr ?? 0;
+        parms.NewRas = NewRas?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateEOStage3Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateEOStage3_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateEOStage3
     /// </summary>
     public unsafe virtual void ActivateEOStage3()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateEOStage3", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateEOStage3Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateEOStage3", true);
+        var parms = new ActivateEOStage3_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateEOStage2Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateEOStage2_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateEOStage2
     /// </summary>
     public unsafe virtual void ActivateEOStage2()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateEOStage2", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateEOStage2Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateEOStage2", true);
+        var parms = new ActivateEOStage2_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateEOStage1Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateEOStage1_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateEOStage1
     /// </summary>
     public unsafe virtual void ActivateEOStage1()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateEOStage1", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateEOStage1Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateEOStage1", true);
+        var parms = new ActivateEOStage1_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateDefeatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateDefeated_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateDefeated
     /// </summary>
     public unsafe virtual void ActivateDefeated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateDefeated", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateDefeatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateDefeated", true);
+        var parms = new ActivateDefeated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateRasChokedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ActivateRasChoked_Params
+    {
+        [FieldOffset(0)] public nint NewTalia;
+    }
+
     /// <summary>
     /// Function: ActivateRasChoked
     /// </summary>
     public unsafe virtual void ActivateRasChoked(BmSDK.GameObject NewTalia)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateRasChoked", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTalia, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateRasChokedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateRasChoked", true);
+        var parms = new ActivateRasChoked_Params();
+        parms.NewTalia = NewTalia?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateSkyIntenseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateSkyIntense_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateSkyIntense
     /// </summary>
     public unsafe virtual void ActivateSkyIntense()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateSkyIntense", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateSkyIntenseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateSkyIntense", true);
+        var parms = new ActivateSkyIntense_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateSkyMildFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateSkyMild_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateSkyMild
     /// </summary>
     public unsafe virtual void ActivateSkyMild()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateSkyMild", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateSkyMildFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ActivateSkyMild", true);
+        var parms = new ActivateSkyMild_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IntroTauntFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IntroTaunt_Params
+    {
+        [FieldOffset(0)] public nint SpeechActor;
+    }
+
     /// <summary>
     /// Function: IntroTaunt
     /// </summary>
     public unsafe virtual void IntroTaunt(BmSDK.Engine.Actor SpeechActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.IntroTaunt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechActor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IntroTauntFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.IntroTaunt", true);
+        var parms = new IntroTaunt_Params();
+        parms.SpeechActor = SpeechActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GiantAppearTauntFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GiantAppearTaunt_Params
+    {
+        [FieldOffset(0)] public nint SpeechActor;
+    }
+
     /// <summary>
     /// Function: GiantAppearTaunt
     /// </summary>
     public unsafe virtual void GiantAppearTaunt(BmSDK.Engine.Actor SpeechActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GiantAppearTaunt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechActor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GiantAppearTauntFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GiantAppearTaunt", true);
+        var parms = new GiantAppearTaunt_Params();
+        parms.SpeechActor = SpeechActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayRasSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlayRasSpeech_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RSeqAct_RasBossLogicBase.RasSpeech Speech;
+        [FieldOffset(4)] public nint SpeechActor;
+        [FieldOffset(8)] public int bHighPriority;
+    }
+
     /// <summary>
     /// Function: PlayRasSpeech
     /// </summary>
     public unsafe virtual void PlayRasSpeech(BmSDK.BmGame.RSeqAct_RasBossLogicBase.RasSpeech Speech, BmSDK.Engine.Actor SpeechActor, bool bHighPriority = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.PlayRasSpeech", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speech, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpeechActor, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHighPriority, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayRasSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.PlayRasSpeech", true);
+        var parms = new PlayRasSpeech_Params();
+        parms.Speech = Speech;
+        parms.SpeechActor = SpeechActor?.Ptr ?? 0;
+        parms.bHighPriority = bHighPriority ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanTeleportFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanTeleport_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanTeleport
     /// </summary>
     public unsafe virtual bool CanTeleport()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.CanTeleport", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanTeleportFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.CanTeleport", true);
+        var parms = new CanTeleport_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TauntPlayedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TauntPlayed_Params
+    {
     }
 
     /// <summary>
@@ -372,21 +544,34 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual void TauntPlayed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.TauntPlayed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TauntPlayedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.TauntPlayed", true);
+        var parms = new TauntPlayed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanTauntFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanTaunt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanTaunt
     /// </summary>
     public unsafe virtual bool CanTaunt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.CanTaunt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanTauntFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.CanTaunt", true);
+        var parms = new CanTaunt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClearCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearCamera_Params
+    {
     }
 
     /// <summary>
@@ -394,81 +579,130 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual void ClearCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ClearCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ClearCamera", true);
+        var parms = new ClearCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLookSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetLookSpeed_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed;
+    }
+
     /// <summary>
     /// Function: SetLookSpeed
     /// </summary>
     public unsafe virtual void SetLookSpeed(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetLookSpeed", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLookSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetLookSpeed", true);
+        var parms = new SetLookSpeed_Params();
+        parms.Speed = Speed;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLockLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetLockLook_Params
+    {
+        [FieldOffset(0)] public int bLock;
+    }
+
     /// <summary>
     /// Function: SetLockLook
     /// </summary>
     public unsafe virtual void SetLockLook(bool bLock)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetLockLook", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLock, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLockLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetLockLook", true);
+        var parms = new SetLockLook_Params();
+        parms.bLock = bLock ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetConstantCamLookYawFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetConstantCamLookYaw_Params
+    {
+        [FieldOffset(0)] public int bConstant;
+    }
+
     /// <summary>
     /// Function: SetConstantCamLookYaw
     /// </summary>
     public unsafe virtual void SetConstantCamLookYaw(bool bConstant)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetConstantCamLookYaw", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bConstant, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetConstantCamLookYawFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetConstantCamLookYaw", true);
+        var parms = new SetConstantCamLookYaw_Params();
+        parms.bConstant = bConstant ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetConstantCamLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetConstantCamLook_Params
+    {
+        [FieldOffset(0)] public int bConstant;
+    }
+
     /// <summary>
     /// Function: SetConstantCamLook
     /// </summary>
     public unsafe virtual void SetConstantCamLook(bool bConstant)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetConstantCamLook", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bConstant, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetConstantCamLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetConstantCamLook", true);
+        var parms = new SetConstantCamLook_Params();
+        parms.bConstant = bConstant ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLookAtHeadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetLookAtHead_Params
+    {
+        [FieldOffset(0)] public int bLook;
+    }
+
     /// <summary>
     /// Function: SetLookAtHead
     /// </summary>
     public unsafe virtual void SetLookAtHead(bool bLook)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetLookAtHead", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLook, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLookAtHeadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetLookAtHead", true);
+        var parms = new SetLookAtHead_Params();
+        parms.bLook = bLook ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetBossDifficultyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetBossDifficulty_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetBossDifficulty
     /// </summary>
     public unsafe virtual int GetBossDifficulty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GetBossDifficulty", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetBossDifficultyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GetBossDifficulty", true);
+        var parms = new GetBossDifficulty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsOnlyOneSandCloneAliveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsOnlyOneSandCloneAlive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -476,10 +710,16 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual bool IsOnlyOneSandCloneAlive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.IsOnlyOneSandCloneAlive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsOnlyOneSandCloneAliveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.IsOnlyOneSandCloneAlive", true);
+        var parms = new IsOnlyOneSandCloneAlive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InitSandClonesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InitSandClones_Params
+    {
     }
 
     /// <summary>
@@ -487,21 +727,34 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual void InitSandClones()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.InitSandClones", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitSandClonesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.InitSandClones", true);
+        var parms = new InitSandClones_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AreSandClonesInLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AreSandClonesInLine_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AreSandClonesInLine
     /// </summary>
     public unsafe virtual bool AreSandClonesInLine()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.AreSandClonesInLine", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AreSandClonesInLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.AreSandClonesInLine", true);
+        var parms = new AreSandClonesInLine_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnDamageBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnDamageBatman_Params
+    {
     }
 
     /// <summary>
@@ -509,21 +762,35 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual void OnDamageBatman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.OnDamageBatman", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnDamageBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.OnDamageBatman", true);
+        var parms = new OnDamageBatman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanDamageBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanDamageBatman_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanDamageBatman
     /// </summary>
     public unsafe virtual bool CanDamageBatman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.CanDamageBatman", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanDamageBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.CanDamageBatman", true);
+        var parms = new CanDamageBatman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetLandLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetLandLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -531,10 +798,17 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetLandLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GetLandLocation", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetLandLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GetLandLocation", true);
+        var parms = new GetLandLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CreateRealRasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CreateRealRas_Params
+    {
+        [FieldOffset(0)] public nint PawnToBoss;
     }
 
     /// <summary>
@@ -542,149 +816,235 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual void CreateRealRas(BmSDK.BmGame.RPawnBossRasBase PawnToBoss)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.CreateRealRas", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PawnToBoss, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CreateRealRasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.CreateRealRas", true);
+        var parms = new CreateRealRas_Params();
+        parms.PawnToBoss = PawnToBoss?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncStageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IncStage_Params
+    {
+    }
+
     /// <summary>
     /// Function: IncStage
     /// </summary>
     public unsafe virtual void IncStage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.IncStage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncStageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.IncStage", true);
+        var parms = new IncStage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetOrbitViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetOrbitView_Params
+    {
+        [FieldOffset(0)] public int bOrbit;
+    }
+
     /// <summary>
     /// Function: SetOrbitView
     /// </summary>
     public unsafe virtual void SetOrbitView(bool bOrbit)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetOrbitView", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOrbit, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetOrbitViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetOrbitView", true);
+        var parms = new SetOrbitView_Params();
+        parms.bOrbit = bOrbit ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartIntroFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartIntro_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartIntro
     /// </summary>
     public unsafe virtual void StartIntro()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.StartIntro", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartIntroFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.StartIntro", true);
+        var parms = new StartIntro_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroySwordFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DestroySword_Params
+    {
+    }
+
     /// <summary>
     /// Function: DestroySword
     /// </summary>
     public unsafe virtual void DestroySword()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.DestroySword", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroySwordFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.DestroySword", true);
+        var parms = new DestroySword_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearLookAtPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearLookAtPawn_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearLookAtPawn
     /// </summary>
     public unsafe virtual void ClearLookAtPawn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ClearLookAtPawn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearLookAtPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.ClearLookAtPawn", true);
+        var parms = new ClearLookAtPawn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLookAtPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetLookAtPawn_Params
+    {
+        [FieldOffset(0)] public nint PawnToLookAt;
+        [FieldOffset(4)] public float Duration;
+    }
+
     /// <summary>
     /// Function: SetLookAtPawn
     /// </summary>
     public unsafe virtual void SetLookAtPawn(BmSDK.BmGame.RPawnBossRasBase PawnToLookAt, float Duration = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetLookAtPawn", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PawnToLookAt, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLookAtPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetLookAtPawn", true);
+        var parms = new SetLookAtPawn_Params();
+        parms.PawnToLookAt = PawnToLookAt?.Ptr ?? 0;
+        parms.Duration = Duration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateHudFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateHud_Params
+    {
+        [FieldOffset(0)] public float Scalar;
+    }
+
     /// <summary>
     /// Function: UpdateHud
     /// </summary>
     public unsafe virtual void UpdateHud(float Scalar)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.UpdateHud", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Scalar, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateHudFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.UpdateHud", true);
+        var parms = new UpdateHud_Params();
+        parms.Scalar = Scalar;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDefaultSandCloneCamSettingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetDefaultSandCloneCamSettings_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetDefaultSandCloneCamSettings
     /// </summary>
     public unsafe virtual void SetDefaultSandCloneCamSettings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetDefaultSandCloneCamSettings", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDefaultSandCloneCamSettingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetDefaultSandCloneCamSettings", true);
+        var parms = new SetDefaultSandCloneCamSettings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDefaultManoCamSettingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetDefaultManoCamSettings_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetDefaultManoCamSettings
     /// </summary>
     public unsafe virtual void SetDefaultManoCamSettings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetDefaultManoCamSettings", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDefaultManoCamSettingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetDefaultManoCamSettings", true);
+        var parms = new SetDefaultManoCamSettings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTargetFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetTargetFOV_Params
+    {
+        [FieldOffset(0)] public float NewFOV;
+        [FieldOffset(4)] public float TransitionTime;
+    }
+
     /// <summary>
     /// Function: SetTargetFOV
     /// </summary>
     public unsafe virtual void SetTargetFOV(float NewFOV, float TransitionTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetTargetFOV", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewFOV, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionTime, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTargetFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetTargetFOV", true);
+        var parms = new SetTargetFOV_Params();
+        parms.NewFOV = NewFOV;
+        parms.TransitionTime = TransitionTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StaggerBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StaggerBatman_Params
+    {
+    }
+
     /// <summary>
     /// Function: StaggerBatman
     /// </summary>
     public unsafe virtual void StaggerBatman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.StaggerBatman", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StaggerBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.StaggerBatman", true);
+        var parms = new StaggerBatman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasFinishedManoTransitionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasFinishedManoTransition_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasFinishedManoTransition
     /// </summary>
     public unsafe virtual bool HasFinishedManoTransition()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.HasFinishedManoTransition", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasFinishedManoTransitionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.HasFinishedManoTransition", true);
+        var parms = new HasFinishedManoTransition_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetSpectralLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetSpectralLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -692,10 +1052,17 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetSpectralLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GetSpectralLocation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetSpectralLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.GetSpectralLocation", true);
+        var parms = new GetSpectralLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SpectralHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SpectralHit_Params
+    {
+        [FieldOffset(0)] public int bBig;
     }
 
     /// <summary>
@@ -703,116 +1070,154 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe virtual void SpectralHit(bool bBig)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SpectralHit", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bBig, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpectralHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SpectralHit", true);
+        var parms = new SpectralHit_Params();
+        parms.bBig = bBig ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveSpectralFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveSpectral_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveSpectral
     /// </summary>
     public unsafe virtual void RemoveSpectral()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RemoveSpectral", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveSpectralFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RemoveSpectral", true);
+        var parms = new RemoveSpectral_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnSpectralFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnSpectral_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnSpectral
     /// </summary>
     public unsafe virtual void SpawnSpectral()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SpawnSpectral", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnSpectralFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SpawnSpectral", true);
+        var parms = new SpawnSpectral_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnRasDestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnRasDestroyed_Params
+    {
+        [FieldOffset(0)] public nint RasPawn;
+    }
+
     /// <summary>
     /// Function: OnRasDestroyed
     /// </summary>
     public unsafe virtual void OnRasDestroyed(BmSDK.BmGame.RPawnBossRasBase RasPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.OnRasDestroyed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RasPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnRasDestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.OnRasDestroyed", true);
+        var parms = new OnRasDestroyed_Params();
+        parms.RasPawn = RasPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartManoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartMano_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartMano
     /// </summary>
     public unsafe virtual void StartMano()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.StartMano", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartManoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.StartMano", true);
+        var parms = new StartMano_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveThisPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RemoveThisPawn_Params
+    {
+        [FieldOffset(0)] public nint pawnToKill;
+    }
+
     /// <summary>
     /// Function: RemoveThisPawn
     /// </summary>
     public unsafe virtual void RemoveThisPawn(BmSDK.BmGame.RPawnBossRasBase pawnToKill)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RemoveThisPawn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(pawnToKill, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveThisPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.RemoveThisPawn", true);
+        var parms = new RemoveThisPawn_Params();
+        parms.pawnToKill = pawnToKill?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EndStageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EndStage_Params
+    {
+    }
+
     /// <summary>
     /// Function: EndStage
     /// </summary>
     public unsafe virtual void EndStage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.EndStage", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EndStageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.EndStage", true);
+        var parms = new EndStage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetRas_Params
+    {
+        [FieldOffset(0)] public nint NewSpawn;
+    }
+
     /// <summary>
     /// Function: SetRas
     /// </summary>
     public unsafe virtual void SetRas(BmSDK.GameObject NewSpawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetRas", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSpawn, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetRasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetRas", true);
+        var parms = new SetRas_Params();
+        parms.NewSpawn = NewSpawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTaliaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetTalia_Params
+    {
+        [FieldOffset(0)] public nint NewSpawn;
+    }
+
     /// <summary>
     /// Function: SetTalia
     /// </summary>
     public unsafe virtual void SetTalia(BmSDK.GameObject NewSpawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetTalia", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSpawn, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetTaliaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_RasBossLogicBase.SetTalia", true);
+        var parms = new SetTalia_Params();
+        parms.NewSpawn = NewSpawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -870,8 +1275,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe int KeepInViewTolerance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(int*)(Ptr + 224); }
+        set { *(int*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -879,8 +1284,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe int NumTimesDefeated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(int*)(Ptr + 228); }
+        set { *(int*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -888,8 +1293,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe int NumTimesToDefeatRas
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(int*)(Ptr + 232); }
+        set { *(int*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -897,8 +1302,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe BmSDK.BmGame.RSeqAct_RasBossLogicBase.ERasStage RasStage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSeqAct_RasBossLogicBase.ERasStage>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(BmSDK.BmGame.RSeqAct_RasBossLogicBase.ERasStage*)(Ptr + 236); }
+        set { *(BmSDK.BmGame.RSeqAct_RasBossLogicBase.ERasStage*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -942,8 +1347,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe float LastRasAttackTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -951,8 +1356,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe float ManoDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -960,8 +1365,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe float DuplicateDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(float*)(Ptr + 272); }
+        set { *(float*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -978,8 +1383,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe bool bSuspendKeepInView
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 280); }
+        get { return (*(int*)(Ptr + 280) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 280) |= 1; else *(int*)(Ptr + 280) &= ~1; }
     }
 
     /// <summary>
@@ -987,8 +1392,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe bool bStallAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 280); }
+        get { return (*(int*)(Ptr + 280) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 280) |= 2; else *(int*)(Ptr + 280) &= ~2; }
     }
 
     /// <summary>
@@ -996,8 +1401,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe bool bFailedBurly
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 280); }
+        get { return (*(int*)(Ptr + 280) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 280) |= 4; else *(int*)(Ptr + 280) &= ~4; }
     }
 
     /// <summary>
@@ -1005,8 +1410,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe bool bRasZapped
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 280); }
+        get { return (*(int*)(Ptr + 280) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 280) |= 8; else *(int*)(Ptr + 280) &= ~8; }
     }
 
     /// <summary>
@@ -1014,8 +1419,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe bool bStartFromMano
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 280); }
+        get { return (*(int*)(Ptr + 280) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 280) |= 16; else *(int*)(Ptr + 280) &= ~16; }
     }
 
     /// <summary>
@@ -1032,8 +1437,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe float LandOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(float*)(Ptr + 288); }
+        set { *(float*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -1041,8 +1446,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe float LastTauntTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }
+        get { return *(float*)(Ptr + 292); }
+        set { *(float*)(Ptr + 292) = value; }
     }
 
     /// <summary>
@@ -1050,8 +1455,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe float LastBMDamageTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -1059,8 +1464,8 @@ public partial class RSeqAct_RasBossLogicBase : BmSDK.BmGame.RSeqAct_CombatSpawn
     /// </summary>
     public unsafe int MaxNumClones
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(int*)(Ptr + 300); }
+        set { *(int*)(Ptr + 300) = value; }
     }
 
     /// <summary>
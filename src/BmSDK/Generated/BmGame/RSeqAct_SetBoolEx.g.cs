@@ -83,8 +83,8 @@ public partial class RSeqAct_SetBoolEx : BmSDK.Engine.SeqAct_SetSequenceVariable
     /// </summary>
     public unsafe bool bExpandOutputs
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 1; else *(int*)(Ptr + 204) &= ~1; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class RSeqAct_SetBoolEx : BmSDK.Engine.SeqAct_SetSequenceVariable
     /// </summary>
     public unsafe bool bOriginalValue
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 2; else *(int*)(Ptr + 204) &= ~2; }
     }
 }
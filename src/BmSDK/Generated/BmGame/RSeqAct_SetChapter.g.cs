@@ -83,8 +83,8 @@ public partial class RSeqAct_SetChapter : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.BmGame.RSeqAct_SetChapter.ESideStory SideStory
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSeqAct_SetChapter.ESideStory>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.BmGame.RSeqAct_SetChapter.ESideStory*)(Ptr + 204); }
+        set { *(BmSDK.BmGame.RSeqAct_SetChapter.ESideStory*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSeqAct_SetChapter : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.BmGame.RSeqAct_SetChapter.ESubChapter SubChapter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSeqAct_SetChapter.ESubChapter>(Ptr + 205); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 205); }
+        get { return *(BmSDK.BmGame.RSeqAct_SetChapter.ESubChapter*)(Ptr + 205); }
+        set { *(BmSDK.BmGame.RSeqAct_SetChapter.ESubChapter*)(Ptr + 205) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSeqAct_SetChapter : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe int Chapter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(int*)(Ptr + 208); }
+        set { *(int*)(Ptr + 208) = value; }
     }
 
     /// <summary>
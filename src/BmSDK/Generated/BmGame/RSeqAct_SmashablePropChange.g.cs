@@ -78,14 +78,20 @@ public partial class RSeqAct_SmashablePropChange : BmSDK.Engine.SequenceAction,
         where TComponent : class, Framework.IScriptComponent<RSeqAct_SmashablePropChange>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Activated_Params
+    {
+    }
+
     /// <summary>
     /// Function: Activated
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_SmashablePropChange.Activated", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_SmashablePropChange.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -94,8 +100,8 @@ public partial class RSeqAct_SmashablePropChange : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe BmSDK.BmGame.RSeqAct_SmashablePropChange.ESmashablePropChangeType PropChangeType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSeqAct_SmashablePropChange.ESmashablePropChangeType>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.BmGame.RSeqAct_SmashablePropChange.ESmashablePropChangeType*)(Ptr + 204); }
+        set { *(BmSDK.BmGame.RSeqAct_SmashablePropChange.ESmashablePropChangeType*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -103,8 +109,8 @@ public partial class RSeqAct_SmashablePropChange : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe BmSDK.BmGame.RSmashablePropConfig.EBreakableType NewBreakableType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSmashablePropConfig.EBreakableType>(Ptr + 205); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 205); }
+        get { return *(BmSDK.BmGame.RSmashablePropConfig.EBreakableType*)(Ptr + 205); }
+        set { *(BmSDK.BmGame.RSmashablePropConfig.EBreakableType*)(Ptr + 205) = value; }
     }
 
     /// <summary>
@@ -112,8 +118,8 @@ public partial class RSeqAct_SmashablePropChange : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe bool NewBoolValue
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 208); }
+        get { return (*(int*)(Ptr + 208) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 208) |= 1; else *(int*)(Ptr + 208) &= ~1; }
     }
 
     /// <summary>
@@ -121,8 +127,8 @@ public partial class RSeqAct_SmashablePropChange : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe float NewFloatValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(float*)(Ptr + 212); }
+        set { *(float*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -73,51 +73,79 @@ public partial class RSeqAct_StartCombatChallengeBase : BmSDK.Engine.SeqAct_Late
         where TComponent : class, Framework.IScriptComponent<RSeqAct_StartCombatChallengeBase>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PublishStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PublishStats_Params
+    {
+        [FieldOffset(0)] public nint GFXHud;
+    }
+
     /// <summary>
     /// Function: PublishStats
     /// </summary>
     public unsafe virtual void PublishStats(BmSDK.BmGame.RGFxMovieChallengeHUD GFXHud)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_StartCombatChallengeBase.PublishStats", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GFXHud, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PublishStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_StartCombatChallengeBase.PublishStats", true);
+        var parms = new PublishStats_Params();
+        parms.GFXHud = GFXHud?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearChallengeStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearChallengeStats_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearChallengeStats
     /// </summary>
     public unsafe virtual void ClearChallengeStats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_StartCombatChallengeBase.ClearChallengeStats", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearChallengeStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_StartCombatChallengeBase.ClearChallengeStats", true);
+        var parms = new ClearChallengeStats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OutputMoveScoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OutputMoveScores_Params
+    {
+    }
+
     /// <summary>
     /// Function: OutputMoveScores
     /// </summary>
     public unsafe virtual void OutputMoveScores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_StartCombatChallengeBase.OutputMoveScores", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OutputMoveScoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_StartCombatChallengeBase.OutputMoveScores", true);
+        var parms = new OutputMoveScores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AddCombatMove_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EComboMoveType MoveType;
+        [FieldOffset(4)] public int MoveScore;
+        [FieldOffset(8)] public int MoveMultiplier;
+    }
+
     /// <summary>
     /// Function: AddCombatMove
     /// </summary>
     public unsafe virtual void AddCombatMove(BmSDK.BmGame.RGameInfo.EComboMoveType MoveType, int MoveScore, int MoveMultiplier)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_StartCombatChallengeBase.AddCombatMove", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveScore, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveMultiplier, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSeqAct_StartCombatChallengeBase.AddCombatMove", true);
+        var parms = new AddCombatMove_Params();
+        parms.MoveType = MoveType;
+        parms.MoveScore = MoveScore;
+        parms.MoveMultiplier = MoveMultiplier;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
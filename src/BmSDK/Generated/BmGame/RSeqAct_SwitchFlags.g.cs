@@ -117,8 +117,8 @@ public partial class RSeqAct_SwitchFlags : BmSDK.Engine.SequenceAction, BmSDK.IG
     /// </summary>
     public unsafe BmSDK.BmGame.RSeqAct_SwitchFlags.SFModeType Mode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSeqAct_SwitchFlags.SFModeType>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(BmSDK.BmGame.RSeqAct_SwitchFlags.SFModeType*)(Ptr + 228); }
+        set { *(BmSDK.BmGame.RSeqAct_SwitchFlags.SFModeType*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -130,10 +130,6 @@ public partial class RSeqAct_SwitchFlags : BmSDK.Engine.SequenceAction, BmSDK.IG
         /// <summary>
         /// NameProperty: FlagName
         /// </summary>
-        public unsafe BmSDK.FName FlagName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName FlagName;
     }
 }
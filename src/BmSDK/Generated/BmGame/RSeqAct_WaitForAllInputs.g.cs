@@ -83,8 +83,8 @@ public partial class RSeqAct_WaitForAllInputs : BmSDK.Engine.SequenceAction, BmS
     /// </summary>
     public unsafe int InputCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(int*)(Ptr + 204); }
+        set { *(int*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSeqAct_WaitForAllInputs : BmSDK.Engine.SequenceAction, BmS
     /// </summary>
     public unsafe bool bTriggerOutputIfSkipped
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 208); }
+        get { return (*(int*)(Ptr + 208) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 208) |= 1; else *(int*)(Ptr + 208) &= ~1; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSeqAct_WaitForAllInputs : BmSDK.Engine.SequenceAction, BmS
     /// </summary>
     public unsafe bool Skipped
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 208); }
+        get { return (*(int*)(Ptr + 208) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 208) |= 2; else *(int*)(Ptr + 208) &= ~2; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RSeqVar_GlobalFlag : BmSDK.Engine.SeqVar_Bool, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.FName FlagName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(BmSDK.FName*)(Ptr + 132); }
+        set { *(BmSDK.FName*)(Ptr + 132) = value; }
     }
 
     /// <summary>
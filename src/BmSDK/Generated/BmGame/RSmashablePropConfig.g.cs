@@ -103,8 +103,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.BmGame.RSmashablePropConfig.EBreakableType PropBreakableType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSmashablePropConfig.EBreakableType>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.BmGame.RSmashablePropConfig.EBreakableType*)(Ptr + 48); }
+        set { *(BmSDK.BmGame.RSmashablePropConfig.EBreakableType*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -112,8 +112,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.BmGame.RSmashablePropConfig.PropKOType KOType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSmashablePropConfig.PropKOType>(Ptr + 49); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 49); }
+        get { return *(BmSDK.BmGame.RSmashablePropConfig.PropKOType*)(Ptr + 49); }
+        set { *(BmSDK.BmGame.RSmashablePropConfig.PropKOType*)(Ptr + 49) = value; }
     }
 
     /// <summary>
@@ -121,8 +121,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool PropIsStatic
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1; else *(int*)(Ptr + 52) &= ~1; }
     }
 
     /// <summary>
@@ -130,8 +130,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool PropIsXRayable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 2; else *(int*)(Ptr + 52) &= ~2; }
     }
 
     /// <summary>
@@ -139,8 +139,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool PropCollideActors
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 4; else *(int*)(Ptr + 52) &= ~4; }
     }
 
     /// <summary>
@@ -148,8 +148,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool PropBlockActors
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 8; else *(int*)(Ptr + 52) &= ~8; }
     }
 
     /// <summary>
@@ -157,8 +157,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool PropBlockZeroExtent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 16; else *(int*)(Ptr + 52) &= ~16; }
     }
 
     /// <summary>
@@ -166,8 +166,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool PropBlockNonZeroExtent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 32; else *(int*)(Ptr + 52) &= ~32; }
     }
 
     /// <summary>
@@ -175,8 +175,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool PropDoDamage
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 64; else *(int*)(Ptr + 52) &= ~64; }
     }
 
     /// <summary>
@@ -184,8 +184,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool IgnorePawnCollisions
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 128; else *(int*)(Ptr + 52) &= ~128; }
     }
 
     /// <summary>
@@ -193,8 +193,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool PropRememberWhenSmashed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 256; else *(int*)(Ptr + 52) &= ~256; }
     }
 
     /// <summary>
@@ -202,8 +202,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bWorldGeometry
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 512; else *(int*)(Ptr + 52) &= ~512; }
     }
 
     /// <summary>
@@ -211,8 +211,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bAlertVillainsOnSmash
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1024; else *(int*)(Ptr + 52) &= ~1024; }
     }
 
     /// <summary>
@@ -220,8 +220,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe bool bBatarangSmashable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 2048; else *(int*)(Ptr + 52) &= ~2048; }
     }
 
     /// <summary>
@@ -229,8 +229,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe float PropBreakingForce
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -238,8 +238,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe float PropBreakTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -247,8 +247,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe float PropExplosiveImpulse
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -256,8 +256,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe float PropSmashNormalForceImpulseMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -298,8 +298,8 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.FName DefaultDecalName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(BmSDK.FName*)(Ptr + 104); }
+        set { *(BmSDK.FName*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -320,11 +320,7 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
         /// <summary>
         /// NameProperty: DecalTypeName
         /// </summary>
-        public unsafe BmSDK.FName DecalTypeName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName DecalTypeName;
 
         /// <summary>
         /// ObjectProperty: DecalMaterial
@@ -338,20 +334,12 @@ public partial class RSmashablePropConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObj
         /// <summary>
         /// FloatProperty: DecalWidth
         /// </summary>
-        public unsafe float DecalWidth
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float DecalWidth;
 
         /// <summary>
         /// FloatProperty: DecalHeight
         /// </summary>
-        public unsafe float DecalHeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float DecalHeight;
     }
 
     /// <summary>
@@ -73,17 +73,33 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
         where TComponent : class, Framework.IScriptComponent<RSpecialMoveConfig>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetSpecialMoveIdealStartLocFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 128)]
+    private struct GetSpecialMoveIdealStartLoc_Params
+    {
+        [FieldOffset(0)] public nint Controller;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation;
+        [FieldOffset(116)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSpecialMoveIdealStartLoc
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetSpecialMoveIdealStartLoc(BmSDK.BmGame.RPlayerController Controller, BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig.GetSpecialMoveIdealStartLoc", true);
-        byte* paramsPtr = stackalloc byte[128];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Controller, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveLocation, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 116);
+        var funcManaged = s_GetSpecialMoveIdealStartLocFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig.GetSpecialMoveIdealStartLoc", true);
+        var parms = new GetSpecialMoveIdealStartLoc_Params();
+        parms.Controller = Controller?.Ptr ?? 0;
+        parms.MoveLocation = MoveLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetPrompt_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -91,10 +107,19 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe virtual BmSDK.FString GetPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig.GetPrompt", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig.GetPrompt", true);
+        var parms = new GetPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_TriggerSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 120)]
+    private struct TriggerSpecialMove_Params
+    {
+        [FieldOffset(0)] public nint Controller;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation;
+        [FieldOffset(116)] public int ForceReplicateToClient;
     }
 
     /// <summary>
@@ -102,12 +127,12 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe virtual void TriggerSpecialMove(BmSDK.BmGame.RPlayerController Controller, BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation, bool ForceReplicateToClient = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig.TriggerSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[120];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Controller, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceReplicateToClient, paramsPtr + 116);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig.TriggerSpecialMove", true);
+        var parms = new TriggerSpecialMove_Params();
+        parms.Controller = Controller?.Ptr ?? 0;
+        parms.MoveLocation = MoveLocation;
+        parms.ForceReplicateToClient = ForceReplicateToClient ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -144,8 +169,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.FName EndControllerState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -153,8 +178,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.FName MoveControllerState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(BmSDK.FName*)(Ptr + 52); }
+        set { *(BmSDK.FName*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -162,8 +187,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.FName MoveCameraAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -180,8 +205,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe float AnimatedCameraBlendInTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -189,8 +214,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe float AnimatedCameraBlendOutTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -198,8 +223,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe float AnimatedCameraFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -207,8 +232,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bHackForceCameraFOV
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1; else *(int*)(Ptr + 84) &= ~1; }
     }
 
     /// <summary>
@@ -216,8 +241,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowCameraToOverrideExternalCams
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2; else *(int*)(Ptr + 84) &= ~2; }
     }
 
     /// <summary>
@@ -225,8 +250,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDontReturnToGameCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 4; else *(int*)(Ptr + 84) &= ~4; }
     }
 
     /// <summary>
@@ -234,8 +259,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bInstantDefer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 8; else *(int*)(Ptr + 84) &= ~8; }
     }
 
     /// <summary>
@@ -243,8 +268,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bForceFollowFullPelvisZ
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 16; else *(int*)(Ptr + 84) &= ~16; }
     }
 
     /// <summary>
@@ -252,8 +277,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bQuitCameraOnAnimEnd
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 32; else *(int*)(Ptr + 84) &= ~32; }
     }
 
     /// <summary>
@@ -261,8 +286,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDisallowZoom
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 64; else *(int*)(Ptr + 84) &= ~64; }
     }
 
     /// <summary>
@@ -270,8 +295,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDoCameraCollisionFromLocator
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 128; else *(int*)(Ptr + 84) &= ~128; }
     }
 
     /// <summary>
@@ -279,8 +304,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bHidden
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 256; else *(int*)(Ptr + 84) &= ~256; }
     }
 
     /// <summary>
@@ -288,8 +313,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bResetCameraBehindBatman
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 512; else *(int*)(Ptr + 84) &= ~512; }
     }
 
     /// <summary>
@@ -297,8 +322,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAutoTriggerFromRun
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1024; else *(int*)(Ptr + 84) &= ~1024; }
     }
 
     /// <summary>
@@ -306,8 +331,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAutoTriggerFromWalk
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2048; else *(int*)(Ptr + 84) &= ~2048; }
     }
 
     /// <summary>
@@ -315,8 +340,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCombatCameraOverridesMoveCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 4096; else *(int*)(Ptr + 84) &= ~4096; }
     }
 
     /// <summary>
@@ -324,8 +349,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCanUseGrapple
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 8192; else *(int*)(Ptr + 84) &= ~8192; }
     }
 
     /// <summary>
@@ -333,8 +358,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCanAimGrapple
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 16384; else *(int*)(Ptr + 84) &= ~16384; }
     }
 
     /// <summary>
@@ -342,8 +367,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowCameraControl
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 32768; else *(int*)(Ptr + 84) &= ~32768; }
     }
 
     /// <summary>
@@ -351,8 +376,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCanCycleGadgets
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 65536; else *(int*)(Ptr + 84) &= ~65536; }
     }
 
     /// <summary>
@@ -360,8 +385,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAlignCameraDuringAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 131072; else *(int*)(Ptr + 84) &= ~131072; }
     }
 
     /// <summary>
@@ -369,8 +394,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAlignCameraYaw
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 262144; else *(int*)(Ptr + 84) &= ~262144; }
     }
 
     /// <summary>
@@ -378,8 +403,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAlignCameraPitch
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 524288; else *(int*)(Ptr + 84) &= ~524288; }
     }
 
     /// <summary>
@@ -387,8 +412,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowInvestigationMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1048576; else *(int*)(Ptr + 84) &= ~1048576; }
     }
 
     /// <summary>
@@ -396,8 +421,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowInvestigationModeWithCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2097152; else *(int*)(Ptr + 84) &= ~2097152; }
     }
 
     /// <summary>
@@ -405,8 +430,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowInteractItems
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 4194304; else *(int*)(Ptr + 84) &= ~4194304; }
     }
 
     /// <summary>
@@ -414,8 +439,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bInteruptable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 8388608; else *(int*)(Ptr + 84) &= ~8388608; }
     }
 
     /// <summary>
@@ -423,8 +448,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCameraAnchorFollowsPawn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 16777216; else *(int*)(Ptr + 84) &= ~16777216; }
     }
 
     /// <summary>
@@ -432,8 +457,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool FlipReferenceOffset
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 33554432; else *(int*)(Ptr + 84) &= ~33554432; }
     }
 
     /// <summary>
@@ -441,8 +466,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowMoveTo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 67108864; else *(int*)(Ptr + 84) &= ~67108864; }
     }
 
     /// <summary>
@@ -450,8 +475,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bTreatAsJump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 134217728; else *(int*)(Ptr + 84) &= ~134217728; }
     }
 
     /// <summary>
@@ -459,8 +484,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDebounceRun
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 268435456; else *(int*)(Ptr + 84) &= ~268435456; }
     }
 
     /// <summary>
@@ -468,8 +493,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bImmuneToKillVolumes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 536870912; else *(int*)(Ptr + 84) &= ~536870912; }
     }
 
     /// <summary>
@@ -477,8 +502,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDontLeaveHidePoint
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1073741824; else *(int*)(Ptr + 84) &= ~1073741824; }
     }
 
     /// <summary>
@@ -486,8 +511,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool OverrideRequiresRailings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= -2147483648; else *(int*)(Ptr + 84) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -495,8 +520,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool DontAllowStickOverride
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 1; else *(int*)(Ptr + 88) &= ~1; }
     }
 
     /// <summary>
@@ -504,8 +529,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bOverrideIsCeilingMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 2; else *(int*)(Ptr + 88) &= ~2; }
     }
 
     /// <summary>
@@ -513,8 +538,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bOverrideIsCatwalkMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 4; else *(int*)(Ptr + 88) &= ~4; }
     }
 
     /// <summary>
@@ -522,8 +547,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDelayCameraChangeUntilOverride
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 8; else *(int*)(Ptr + 88) &= ~8; }
     }
 
     /// <summary>
@@ -531,8 +556,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bOverrideMoveMatches
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 16; else *(int*)(Ptr + 88) &= ~16; }
     }
 
     /// <summary>
@@ -540,8 +565,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bComboMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 32; else *(int*)(Ptr + 88) &= ~32; }
     }
 
     /// <summary>
@@ -549,8 +574,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCanBeTracked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 64; else *(int*)(Ptr + 88) &= ~64; }
     }
 
     /// <summary>
@@ -558,8 +583,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDeInitAttackMoveWeaponsOnExit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 128; else *(int*)(Ptr + 88) &= ~128; }
     }
 
     /// <summary>
@@ -567,8 +592,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool StepUpDuringFlying
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 256; else *(int*)(Ptr + 88) &= ~256; }
     }
 
     /// <summary>
@@ -576,8 +601,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool CantDieDuringMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 512; else *(int*)(Ptr + 88) &= ~512; }
     }
 
     /// <summary>
@@ -585,8 +610,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.FName MoveCameraState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.FName*)(Ptr + 92); }
+        set { *(BmSDK.FName*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -627,8 +652,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.CameraLookAtSpeed CameraAlignSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.CameraLookAtSpeed>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed*)(Ptr + 132); }
+        set { *(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -636,8 +661,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.CameraLookAtStrength CameraAlignStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.CameraLookAtStrength>(Ptr + 133); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 133); }
+        get { return *(BmSDK.BmGame.RGameInfo.CameraLookAtStrength*)(Ptr + 133); }
+        set { *(BmSDK.BmGame.RGameInfo.CameraLookAtStrength*)(Ptr + 133) = value; }
     }
 
     /// <summary>
@@ -645,8 +670,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.EGameAction TriggeredGameAction
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.EGameAction>(Ptr + 134); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 134); }
+        get { return *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 134); }
+        set { *(BmSDK.BmGame.RGameInfo.EGameAction*)(Ptr + 134) = value; }
     }
 
     /// <summary>
@@ -654,8 +679,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.BmGame.RSpecialMoveConfig.ESpecialMoveAnimSetType SpecialMoveAnimSetType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSpecialMoveConfig.ESpecialMoveAnimSetType>(Ptr + 135); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 135); }
+        get { return *(BmSDK.BmGame.RSpecialMoveConfig.ESpecialMoveAnimSetType*)(Ptr + 135); }
+        set { *(BmSDK.BmGame.RSpecialMoveConfig.ESpecialMoveAnimSetType*)(Ptr + 135) = value; }
     }
 
     /// <summary>
@@ -663,8 +688,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.BmGame.RSpecialMoveConfig.AISpecialMoveCommentType CommentType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSpecialMoveConfig.AISpecialMoveCommentType>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(BmSDK.BmGame.RSpecialMoveConfig.AISpecialMoveCommentType*)(Ptr + 136); }
+        set { *(BmSDK.BmGame.RSpecialMoveConfig.AISpecialMoveCommentType*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -672,8 +697,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe float CameraAlignDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(float*)(Ptr + 140); }
+        set { *(float*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -693,8 +718,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe float ReferenceOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -702,8 +727,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe float ReferenceZOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -726,8 +751,8 @@ public partial class RSpecialMoveConfig : BmSDK.BmGame.RConfig, BmSDK.IGameObjec
     /// </summary>
     public unsafe float OverrideTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(float*)(Ptr + 288); }
+        set { *(float*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -73,18 +73,28 @@ public partial class RSpecialMoveConfig_ActivePoseTransition : BmSDK.BmGame.RSpe
         where TComponent : class, Framework.IScriptComponent<RSpecialMoveConfig_ActivePoseTransition>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetEndPositionAndYawFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 132)]
+    private struct GetEndPositionAndYaw_Params
+    {
+        [FieldOffset(0)] public nint Player;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation;
+        [FieldOffset(116)] public System.Numerics.Vector3 EndPosition;
+        [FieldOffset(128)] public int EndYaw;
+    }
+
     /// <summary>
     /// Function: GetEndPositionAndYaw
     /// </summary>
     public unsafe virtual void GetEndPositionAndYaw(BmSDK.Engine.Pawn Player, BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation, out System.Numerics.Vector3 EndPosition, out int EndYaw)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig_ActivePoseTransition.GetEndPositionAndYaw", true);
-        byte* paramsPtr = stackalloc byte[132];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveLocation, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        EndPosition = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 116);
-        EndYaw = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 128);
+        var funcManaged = s_GetEndPositionAndYawFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig_ActivePoseTransition.GetEndPositionAndYaw", true);
+        var parms = new GetEndPositionAndYaw_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        parms.MoveLocation = MoveLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        EndPosition = parms.EndPosition;
+        EndYaw = parms.EndYaw;
         return;
     }
 
@@ -93,8 +103,8 @@ public partial class RSpecialMoveConfig_ActivePoseTransition : BmSDK.BmGame.RSpe
     /// </summary>
     public unsafe BmSDK.FName EndMovementStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -102,8 +112,8 @@ public partial class RSpecialMoveConfig_ActivePoseTransition : BmSDK.BmGame.RSpe
     /// </summary>
     public unsafe BmSDK.FName TransitionName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -111,8 +121,8 @@ public partial class RSpecialMoveConfig_ActivePoseTransition : BmSDK.BmGame.RSpe
     /// </summary>
     public unsafe BmSDK.FName CustomAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(BmSDK.FName*)(Ptr + 312); }
+        set { *(BmSDK.FName*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -129,8 +139,8 @@ public partial class RSpecialMoveConfig_ActivePoseTransition : BmSDK.BmGame.RSpe
     /// </summary>
     public unsafe bool bFinalPoseMirrored
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 324) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 324); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 324); }
+        get { return (*(int*)(Ptr + 324) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 324) |= 1; else *(int*)(Ptr + 324) &= ~1; }
     }
 
     /// <summary>
@@ -138,7 +148,7 @@ public partial class RSpecialMoveConfig_ActivePoseTransition : BmSDK.BmGame.RSpe
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimUtil.EMirrorChoice TransitionMirrored
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.EMirrorChoice>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(BmSDK.BmGame.RAnimUtil.EMirrorChoice*)(Ptr + 328); }
+        set { *(BmSDK.BmGame.RAnimUtil.EMirrorChoice*)(Ptr + 328) = value; }
     }
 }
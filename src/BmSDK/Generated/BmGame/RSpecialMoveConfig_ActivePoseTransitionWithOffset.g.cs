@@ -78,18 +78,28 @@ public partial class RSpecialMoveConfig_ActivePoseTransitionWithOffset : BmSDK.B
         where TComponent : class, Framework.IScriptComponent<RSpecialMoveConfig_ActivePoseTransitionWithOffset>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetEndPositionAndYawFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 132)]
+    private struct GetEndPositionAndYaw_Params
+    {
+        [FieldOffset(0)] public nint Player;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation;
+        [FieldOffset(116)] public System.Numerics.Vector3 EndPosition;
+        [FieldOffset(128)] public int EndYaw;
+    }
+
     /// <summary>
     /// Function: GetEndPositionAndYaw
     /// </summary>
     public unsafe override void GetEndPositionAndYaw(BmSDK.Engine.Pawn Player, BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation, out System.Numerics.Vector3 EndPosition, out int EndYaw)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig_ActivePoseTransitionWithOffset.GetEndPositionAndYaw", true);
-        byte* paramsPtr = stackalloc byte[132];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveLocation, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        EndPosition = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 116);
-        EndYaw = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 128);
+        var funcManaged = s_GetEndPositionAndYawFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig_ActivePoseTransitionWithOffset.GetEndPositionAndYaw", true);
+        var parms = new GetEndPositionAndYaw_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        parms.MoveLocation = MoveLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        EndPosition = parms.EndPosition;
+        EndYaw = parms.EndYaw;
         return;
     }
 
@@ -104,7 +114,7 @@ public partial class RSpecialMoveConfig_ActivePoseTransitionWithOffset : BmSDK.B
     /// </summary>
     public unsafe int YawOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(int*)(Ptr + 344); }
+        set { *(int*)(Ptr + 344) = value; }
     }
 }
@@ -78,17 +78,26 @@ public partial class RSpecialMoveConfig_AdditiveAnim : BmSDK.BmGame.RSpecialMove
         where TComponent : class, Framework.IScriptComponent<RSpecialMoveConfig_AdditiveAnim>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_TriggerSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 124)]
+    private struct TriggerSpecialMove_Params
+    {
+        [FieldOffset(0)] public nint Controller;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation;
+        [FieldOffset(116)] public int ForceReplicateToClient;
+    }
+
     /// <summary>
     /// Function: TriggerSpecialMove
     /// </summary>
     public unsafe override void TriggerSpecialMove(BmSDK.BmGame.RPlayerController Controller, BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation, bool ForceReplicateToClient = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig_AdditiveAnim.TriggerSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[124];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Controller, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceReplicateToClient, paramsPtr + 116);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig_AdditiveAnim.TriggerSpecialMove", true);
+        var parms = new TriggerSpecialMove_Params();
+        parms.Controller = Controller?.Ptr ?? 0;
+        parms.MoveLocation = MoveLocation;
+        parms.ForceReplicateToClient = ForceReplicateToClient ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -97,7 +106,7 @@ public partial class RSpecialMoveConfig_AdditiveAnim : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName AnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 }
@@ -89,8 +89,8 @@ public partial class RSpecialMoveConfig_AlignedPoseTransition : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe int YawOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(int*)(Ptr + 344); }
+        set { *(int*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -98,7 +98,7 @@ public partial class RSpecialMoveConfig_AlignedPoseTransition : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float CameraLagTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 }
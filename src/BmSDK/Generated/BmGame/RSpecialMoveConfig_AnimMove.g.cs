@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_AnimMove : BmSDK.BmGame.RSpecialMoveConf
     /// </summary>
     public unsafe float MoveBlendOutTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_AnimMove : BmSDK.BmGame.RSpecialMoveConf
     /// </summary>
     public unsafe float MoveBlendInTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(float*)(Ptr + 300); }
+        set { *(float*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_AnimMove : BmSDK.BmGame.RSpecialMoveConf
     /// </summary>
     public unsafe BmSDK.FName AnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_AnimMove : BmSDK.BmGame.RSpecialMoveConf
     /// </summary>
     public unsafe BmSDK.FName Anim2Name
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(BmSDK.FName*)(Ptr + 312); }
+        set { *(BmSDK.FName*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_AnimMove : BmSDK.BmGame.RSpecialMoveConf
     /// </summary>
     public unsafe bool bAlignRoot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 1; else *(int*)(Ptr + 320) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_AnimMove : BmSDK.BmGame.RSpecialMoveConf
     /// </summary>
     public unsafe bool bTurnOffCollision
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 2; else *(int*)(Ptr + 320) &= ~2; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_AnimMove : BmSDK.BmGame.RSpecialMoveConf
     /// </summary>
     public unsafe float StartZOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(float*)(Ptr + 324); }
+        set { *(float*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -146,7 +146,7 @@ public partial class RSpecialMoveConfig_AnimMove : BmSDK.BmGame.RSpecialMoveConf
     /// </summary>
     public unsafe float StartDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(float*)(Ptr + 328); }
+        set { *(float*)(Ptr + 328) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CapeBreakFall : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.FName AnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(BmSDK.FName*)(Ptr + 488); }
+        set { *(BmSDK.FName*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CapeBreakFall : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.FName LandOnRailingPerchAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(BmSDK.FName*)(Ptr + 496); }
+        set { *(BmSDK.FName*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CapeBreakFall : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.FName LandOnRailingStandAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }
+        get { return *(BmSDK.FName*)(Ptr + 504); }
+        set { *(BmSDK.FName*)(Ptr + 504) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_CapeBreakFall : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe float TerminalVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(float*)(Ptr + 512); }
+        set { *(float*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_CapeBreakFall : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe bool bManual
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 520) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 520); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 520); }
+        get { return (*(int*)(Ptr + 520) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 520) |= 1; else *(int*)(Ptr + 520) &= ~1; }
     }
 
     /// <summary>
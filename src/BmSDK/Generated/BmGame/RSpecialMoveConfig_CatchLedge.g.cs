@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CatchLedge : BmSDK.BmGame.RSpecialMoveCo
     /// </summary>
     public unsafe BmSDK.FName PreCatchPose
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CatchLedge : BmSDK.BmGame.RSpecialMoveCo
     /// </summary>
     public unsafe float MaxCorrectionAccel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(float*)(Ptr + 356); }
+        set { *(float*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -119,7 +119,7 @@ public partial class RSpecialMoveConfig_CatchLedge : BmSDK.BmGame.RSpecialMoveCo
     /// </summary>
     public unsafe float LongFallAnimSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(float*)(Ptr + 368); }
+        set { *(float*)(Ptr + 368) = value; }
     }
 }
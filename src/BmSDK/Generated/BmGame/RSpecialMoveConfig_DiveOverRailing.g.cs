@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_DiveOverRailing : BmSDK.BmGame.RSpecialM
     /// </summary>
     public unsafe BmSDK.FName Stage1Anim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_DiveOverRailing : BmSDK.BmGame.RSpecialM
     /// </summary>
     public unsafe BmSDK.FName Stage2Anim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_DiveOverRailing : BmSDK.BmGame.RSpecialM
     /// </summary>
     public unsafe BmSDK.FName EndStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(BmSDK.FName*)(Ptr + 312); }
+        set { *(BmSDK.FName*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class RSpecialMoveConfig_DiveOverRailing : BmSDK.BmGame.RSpecialM
     /// </summary>
     public unsafe float SmashRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(float*)(Ptr + 320); }
+        set { *(float*)(Ptr + 320) = value; }
     }
 }
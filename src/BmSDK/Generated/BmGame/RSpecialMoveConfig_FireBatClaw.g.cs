@@ -88,32 +88,32 @@ public partial class RSpecialMoveConfig_FireBatClaw : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName FireAnim_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
     /// <summary>
     /// NameProperty: FireAnim
     /// </summary>
     public unsafe BmSDK.FName FireAnim_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
     /// <summary>
     /// NameProperty: FireAnim
     /// </summary>
     public unsafe BmSDK.FName FireAnim_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(BmSDK.FName*)(Ptr + 312); }
+        set { *(BmSDK.FName*)(Ptr + 312) = value; }
     }
     /// <summary>
     /// NameProperty: FireAnim
     /// </summary>
     public unsafe BmSDK.FName FireAnim_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(BmSDK.FName*)(Ptr + 320); }
+        set { *(BmSDK.FName*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -126,32 +126,32 @@ public partial class RSpecialMoveConfig_FireBatClaw : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName FireIdle_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(BmSDK.FName*)(Ptr + 328); }
+        set { *(BmSDK.FName*)(Ptr + 328) = value; }
     }
     /// <summary>
     /// NameProperty: FireIdle
     /// </summary>
     public unsafe BmSDK.FName FireIdle_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(BmSDK.FName*)(Ptr + 336); }
+        set { *(BmSDK.FName*)(Ptr + 336) = value; }
     }
     /// <summary>
     /// NameProperty: FireIdle
     /// </summary>
     public unsafe BmSDK.FName FireIdle_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(BmSDK.FName*)(Ptr + 344); }
+        set { *(BmSDK.FName*)(Ptr + 344) = value; }
     }
     /// <summary>
     /// NameProperty: FireIdle
     /// </summary>
     public unsafe BmSDK.FName FireIdle_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(BmSDK.FName*)(Ptr + 352); }
+        set { *(BmSDK.FName*)(Ptr + 352) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName EndPose
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName TransitionName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName GrappleAimPose
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(BmSDK.FName*)(Ptr + 312); }
+        set { *(BmSDK.FName*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe bool bFailedGrapple
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 1; else *(int*)(Ptr + 320) &= ~1; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe bool bAlignCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 2; else *(int*)(Ptr + 320) &= ~2; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe bool WaitForNotifyToFire
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 4; else *(int*)(Ptr + 320) &= ~4; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe bool DontCreateWireControlPoint
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 8; else *(int*)(Ptr + 320) &= ~8; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float GrappleFireTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(float*)(Ptr + 324); }
+        set { *(float*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float TightenTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(float*)(Ptr + 328); }
+        set { *(float*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float FallingGrappleTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(float*)(Ptr + 332); }
+        set { *(float*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float OverrideGravity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(float*)(Ptr + 336); }
+        set { *(float*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float OverrideGrappleAccelTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(float*)(Ptr + 340); }
+        set { *(float*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float OverrideRopeTighteningDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(float*)(Ptr + 344); }
+        set { *(float*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName OverrideGrappleIdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName CustomFireAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(BmSDK.FName*)(Ptr + 356); }
+        set { *(BmSDK.FName*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class RSpecialMoveConfig_FireGrapple : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnPlayerAnim.AimingConfigDesc OverrideAimingConfig
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerAnim.AimingConfigDesc>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(BmSDK.BmGame.RPawnPlayerAnim.AimingConfigDesc*)(Ptr + 364); }
+        set { *(BmSDK.BmGame.RPawnPlayerAnim.AimingConfigDesc*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -78,8 +78,8 @@ public partial class RSpecialMoveConfig_HarpoonDragObject : BmSDK.BmGame.RSpecia
     /// </summary>
     public unsafe BmSDK.FName BraceAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class RSpecialMoveConfig_HarpoonDragObject : BmSDK.BmGame.RSpecia
     /// </summary>
     public unsafe BmSDK.FName BraceIdle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class RSpecialMoveConfig_HarpoonDragObject : BmSDK.BmGame.RSpecia
     /// </summary>
     public unsafe BmSDK.FName PullEndAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(BmSDK.FName*)(Ptr + 324); }
+        set { *(BmSDK.FName*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -114,8 +114,8 @@ public partial class RSpecialMoveConfig_HarpoonDragObject : BmSDK.BmGame.RSpecia
     /// </summary>
     public unsafe float MaxAnimRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(float*)(Ptr + 332); }
+        set { *(float*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class RSpecialMoveConfig_HarpoonDragObject : BmSDK.BmGame.RSpecia
     /// </summary>
     public unsafe float ButtonPressScoreBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(float*)(Ptr + 336); }
+        set { *(float*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -132,8 +132,8 @@ public partial class RSpecialMoveConfig_HarpoonDragObject : BmSDK.BmGame.RSpecia
     /// </summary>
     public unsafe float ScoreDecayRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(float*)(Ptr + 340); }
+        set { *(float*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -159,7 +159,7 @@ public partial class RSpecialMoveConfig_HarpoonDragObject : BmSDK.BmGame.RSpecia
     /// </summary>
     public unsafe float RopePullTensionRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(float*)(Ptr + 352); }
+        set { *(float*)(Ptr + 352) = value; }
     }
 }
@@ -78,18 +78,28 @@ public partial class RSpecialMoveConfig_HoldLedge : BmSDK.BmGame.RSpecialMoveCon
         where TComponent : class, Framework.IScriptComponent<RSpecialMoveConfig_HoldLedge>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetEndPositionAndYawFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 132)]
+    private struct GetEndPositionAndYaw_Params
+    {
+        [FieldOffset(0)] public nint Player;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation;
+        [FieldOffset(116)] public System.Numerics.Vector3 EndPosition;
+        [FieldOffset(128)] public int EndYaw;
+    }
+
     /// <summary>
     /// Function: GetEndPositionAndYaw
     /// </summary>
     public unsafe override void GetEndPositionAndYaw(BmSDK.Engine.Pawn Player, BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation, out System.Numerics.Vector3 EndPosition, out int EndYaw)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig_HoldLedge.GetEndPositionAndYaw", true);
-        byte* paramsPtr = stackalloc byte[132];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveLocation, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        EndPosition = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 116);
-        EndYaw = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 128);
+        var funcManaged = s_GetEndPositionAndYawFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveConfig_HoldLedge.GetEndPositionAndYaw", true);
+        var parms = new GetEndPositionAndYaw_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        parms.MoveLocation = MoveLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        EndPosition = parms.EndPosition;
+        EndYaw = parms.EndYaw;
         return;
     }
 
@@ -98,8 +108,8 @@ public partial class RSpecialMoveConfig_HoldLedge : BmSDK.BmGame.RSpecialMoveCon
     /// </summary>
     public unsafe bool bUseNegativeNormal
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 332); }
+        get { return (*(int*)(Ptr + 332) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 332) |= 1; else *(int*)(Ptr + 332) &= ~1; }
     }
 
     /// <summary>
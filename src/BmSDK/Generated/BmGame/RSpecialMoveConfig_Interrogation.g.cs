@@ -105,8 +105,8 @@ public partial class RSpecialMoveConfig_Interrogation : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.FName inAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(BmSDK.FName*)(Ptr + 300); }
+        set { *(BmSDK.FName*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -114,8 +114,8 @@ public partial class RSpecialMoveConfig_Interrogation : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.FName FloorInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(BmSDK.FName*)(Ptr + 308); }
+        set { *(BmSDK.FName*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class RSpecialMoveConfig_Interrogation : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.FName LoopAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(BmSDK.FName*)(Ptr + 316); }
+        set { *(BmSDK.FName*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -141,8 +141,8 @@ public partial class RSpecialMoveConfig_Interrogation : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.FName ThugReactionYes
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(BmSDK.FName*)(Ptr + 336); }
+        set { *(BmSDK.FName*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -150,8 +150,8 @@ public partial class RSpecialMoveConfig_Interrogation : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.FName ThugReactionNo
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(BmSDK.FName*)(Ptr + 344); }
+        set { *(BmSDK.FName*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -168,8 +168,8 @@ public partial class RSpecialMoveConfig_Interrogation : BmSDK.BmGame.RSpecialMov
     /// </summary>
     public unsafe BmSDK.BmGame.RSpecialMoveConfig_Interrogation.CameraCollisionOption AnimatedCameraCollisionOption
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSpecialMoveConfig_Interrogation.CameraCollisionOption>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(BmSDK.BmGame.RSpecialMoveConfig_Interrogation.CameraCollisionOption*)(Ptr + 364); }
+        set { *(BmSDK.BmGame.RSpecialMoveConfig_Interrogation.CameraCollisionOption*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName FireAnimationName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName CoverFireAnimationName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName ZipLineIdle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(BmSDK.FName*)(Ptr + 312); }
+        set { *(BmSDK.FName*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName KickIdle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(BmSDK.FName*)(Ptr + 320); }
+        set { *(BmSDK.FName*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName KickIn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(BmSDK.FName*)(Ptr + 328); }
+        set { *(BmSDK.FName*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName KickOut
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(BmSDK.FName*)(Ptr + 336); }
+        set { *(BmSDK.FName*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName ForwardKickAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(BmSDK.FName*)(Ptr + 344); }
+        set { *(BmSDK.FName*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName LeftKickAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(BmSDK.FName*)(Ptr + 352); }
+        set { *(BmSDK.FName*)(Ptr + 352) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName RightKickAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(BmSDK.FName*)(Ptr + 360); }
+        set { *(BmSDK.FName*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(BmSDK.FName*)(Ptr + 368); }
+        set { *(BmSDK.FName*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownInRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(BmSDK.FName*)(Ptr + 376); }
+        set { *(BmSDK.FName*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownBackInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }
+        get { return *(BmSDK.FName*)(Ptr + 384); }
+        set { *(BmSDK.FName*)(Ptr + 384) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownLoopAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(BmSDK.FName*)(Ptr + 392); }
+        set { *(BmSDK.FName*)(Ptr + 392) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownLoopRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }
+        get { return *(BmSDK.FName*)(Ptr + 400); }
+        set { *(BmSDK.FName*)(Ptr + 400) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownGunInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(BmSDK.FName*)(Ptr + 408); }
+        set { *(BmSDK.FName*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownGunBackInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(BmSDK.FName*)(Ptr + 416); }
+        set { *(BmSDK.FName*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -227,8 +227,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownGunLoopAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(BmSDK.FName*)(Ptr + 424); }
+        set { *(BmSDK.FName*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -236,8 +236,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownGunLoopRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.FName*)(Ptr + 432); }
+        set { *(BmSDK.FName*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -245,8 +245,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownPipeInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(BmSDK.FName*)(Ptr + 440); }
+        set { *(BmSDK.FName*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -254,8 +254,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownPipeBackInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(BmSDK.FName*)(Ptr + 448); }
+        set { *(BmSDK.FName*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -263,8 +263,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownPipeLoopAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(BmSDK.FName*)(Ptr + 456); }
+        set { *(BmSDK.FName*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -272,8 +272,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName TakedownDropAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(BmSDK.FName*)(Ptr + 464); }
+        set { *(BmSDK.FName*)(Ptr + 464) = value; }
     }
 
     /// <summary>
@@ -281,8 +281,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName RescueInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(BmSDK.FName*)(Ptr + 472); }
+        set { *(BmSDK.FName*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -290,8 +290,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName RescueBackInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(BmSDK.FName*)(Ptr + 480); }
+        set { *(BmSDK.FName*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -299,8 +299,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName RescueLoopAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(BmSDK.FName*)(Ptr + 488); }
+        set { *(BmSDK.FName*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -308,8 +308,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float Acceleration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(float*)(Ptr + 496); }
+        set { *(float*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -317,8 +317,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float MaxSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(float*)(Ptr + 500); }
+        set { *(float*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -326,8 +326,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float HorizontalSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }
+        get { return *(float*)(Ptr + 504); }
+        set { *(float*)(Ptr + 504) = value; }
     }
 
     /// <summary>
@@ -398,8 +398,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float MinLandAnimHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }
+        get { return *(float*)(Ptr + 536); }
+        set { *(float*)(Ptr + 536) = value; }
     }
 
     /// <summary>
@@ -407,8 +407,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float MaxLandAnimHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(float*)(Ptr + 540); }
+        set { *(float*)(Ptr + 540) = value; }
     }
 
     /// <summary>
@@ -461,8 +461,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float KickTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(float*)(Ptr + 564); }
+        set { *(float*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -470,8 +470,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float LeftKickTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 568); }
+        get { return *(float*)(Ptr + 568); }
+        set { *(float*)(Ptr + 568) = value; }
     }
 
     /// <summary>
@@ -479,8 +479,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float RightKickTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 572); }
+        get { return *(float*)(Ptr + 572); }
+        set { *(float*)(Ptr + 572) = value; }
     }
 
     /// <summary>
@@ -488,8 +488,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float FwdKickRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 576); }
+        get { return *(float*)(Ptr + 576); }
+        set { *(float*)(Ptr + 576) = value; }
     }
 
     /// <summary>
@@ -497,8 +497,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float KickForce
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 580); }
+        get { return *(float*)(Ptr + 580); }
+        set { *(float*)(Ptr + 580) = value; }
     }
 
     /// <summary>
@@ -506,8 +506,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float KickRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 584); }
+        get { return *(float*)(Ptr + 584); }
+        set { *(float*)(Ptr + 584) = value; }
     }
 
     /// <summary>
@@ -515,8 +515,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float KickPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 588); }
+        get { return *(float*)(Ptr + 588); }
+        set { *(float*)(Ptr + 588) = value; }
     }
 
     /// <summary>
@@ -524,8 +524,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float ImpactSpeedMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 592); }
+        get { return *(float*)(Ptr + 592); }
+        set { *(float*)(Ptr + 592) = value; }
     }
 
     /// <summary>
@@ -533,8 +533,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float VictimGrabTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 596); }
+        get { return *(float*)(Ptr + 596); }
+        set { *(float*)(Ptr + 596) = value; }
     }
 
     /// <summary>
@@ -542,8 +542,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float HostageGrabTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 600); }
+        get { return *(float*)(Ptr + 600); }
+        set { *(float*)(Ptr + 600) = value; }
     }
 
     /// <summary>
@@ -551,8 +551,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float VictimGrabRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 604); }
+        get { return *(float*)(Ptr + 604); }
+        set { *(float*)(Ptr + 604) = value; }
     }
 
     /// <summary>
@@ -560,8 +560,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float HostageGrabRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 608); }
+        get { return *(float*)(Ptr + 608); }
+        set { *(float*)(Ptr + 608) = value; }
     }
 
     /// <summary>
@@ -596,8 +596,8 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe bool bAlignFireAnimation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 632); }
+        get { return (*(int*)(Ptr + 632) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 632) |= 1; else *(int*)(Ptr + 632) &= ~1; }
     }
 
     /// <summary>
@@ -605,7 +605,7 @@ public partial class RSpecialMoveConfig_LineLauncher : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float TakedownStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 636); }
+        get { return *(float*)(Ptr + 636); }
+        set { *(float*)(Ptr + 636) = value; }
     }
 }
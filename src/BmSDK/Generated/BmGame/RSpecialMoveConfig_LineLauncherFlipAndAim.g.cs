@@ -83,7 +83,7 @@ public partial class RSpecialMoveConfig_LineLauncherFlipAndAim : BmSDK.BmGame.RS
     /// </summary>
     public unsafe BmSDK.FName FlipAndAimAnimationName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_LineLauncherRescueFinish : BmSDK.BmGame.
     /// </summary>
     public unsafe BmSDK.FName HostageAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class RSpecialMoveConfig_PlaceGooMine : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float SprayLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(float*)(Ptr + 396); }
+        set { *(float*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class RSpecialMoveConfig_PlaceGooMine : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe bool bIgnoreExplosionReaction
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 400) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 400); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 400); }
+        get { return (*(int*)(Ptr + 400) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 400) |= 1; else *(int*)(Ptr + 400) &= ~1; }
     }
 
     /// <summary>
@@ -125,7 +125,7 @@ public partial class RSpecialMoveConfig_PlaceGooMine : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName ExtraMoveCameraAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(BmSDK.FName*)(Ptr + 404); }
+        set { *(BmSDK.FName*)(Ptr + 404) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_PoseTransition : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName EndMovementStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_PoseTransition : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName TransitionName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_PoseTransition : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe bool bMirrored
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 312) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 312); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 312); }
+        get { return (*(int*)(Ptr + 312) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 312) |= 1; else *(int*)(Ptr + 312) &= ~1; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_PoseTransition : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe bool bMirroredNessMatchesInPose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 312) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 312); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 312); }
+        get { return (*(int*)(Ptr + 312) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 312) |= 2; else *(int*)(Ptr + 312) &= ~2; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_PoseTransition : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimUtil.EFuzziness EndCheckFuzziness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.EFuzziness>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(BmSDK.BmGame.RAnimUtil.EFuzziness*)(Ptr + 316); }
+        set { *(BmSDK.BmGame.RAnimUtil.EFuzziness*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_PoseTransition : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName CustomAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(BmSDK.FName*)(Ptr + 320); }
+        set { *(BmSDK.FName*)(Ptr + 320) = value; }
     }
 
     /// <summary>
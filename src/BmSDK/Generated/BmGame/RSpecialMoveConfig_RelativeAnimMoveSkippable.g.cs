@@ -83,7 +83,7 @@ public partial class RSpecialMoveConfig_RelativeAnimMoveSkippable : BmSDK.BmGame
     /// </summary>
     public unsafe float UnskippableTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 }
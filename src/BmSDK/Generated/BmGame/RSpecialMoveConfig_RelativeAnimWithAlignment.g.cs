@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_RelativeAnimWithAlignment : BmSDK.BmGame
     /// </summary>
     public unsafe BmSDK.FName StartMovementStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class RSpecialMoveConfig_RelativeAnimWithAlignment : BmSDK.BmGame
     /// </summary>
     public unsafe float AnimationStartRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(float*)(Ptr + 356); }
+        set { *(float*)(Ptr + 356) = value; }
     }
 }
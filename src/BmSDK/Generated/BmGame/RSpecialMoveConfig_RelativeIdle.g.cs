@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName AnimNameIdle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.FName AnimNameTransitionIn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe bool bAlignRotationWithNormal
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 332); }
+        get { return (*(int*)(Ptr + 332) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 332) |= 1; else *(int*)(Ptr + 332) &= ~1; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe bool UseCameraResetDir
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 332); }
+        get { return (*(int*)(Ptr + 332) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 332) |= 2; else *(int*)(Ptr + 332) &= ~2; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe bool bAnyMovementEnds
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 332); }
+        get { return (*(int*)(Ptr + 332) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 332) |= 4; else *(int*)(Ptr + 332) &= ~4; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe bool bAllowCameraMoveDuringIdle
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 332); }
+        get { return (*(int*)(Ptr + 332) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 332) |= 8; else *(int*)(Ptr + 332) &= ~8; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float MeetingTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(float*)(Ptr + 336); }
+        set { *(float*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnPlayerAnim.AimingConfigDesc AimAt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnPlayerAnim.AimingConfigDesc>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(BmSDK.BmGame.RPawnPlayerAnim.AimingConfigDesc*)(Ptr + 340); }
+        set { *(BmSDK.BmGame.RPawnPlayerAnim.AimingConfigDesc*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -188,8 +188,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float TimeBeforeAnyMovementEnds
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(float*)(Ptr + 356); }
+        set { *(float*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -197,8 +197,8 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float MaximumCameraYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(float*)(Ptr + 360); }
+        set { *(float*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -206,7 +206,7 @@ public partial class RSpecialMoveConfig_RelativeIdle : BmSDK.BmGame.RSpecialMove
     /// </summary>
     public unsafe float MaximumCameraPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(float*)(Ptr + 364); }
+        set { *(float*)(Ptr + 364) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ResonatorPose
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName EndPose
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ResonatorOpenAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(BmSDK.FName*)(Ptr + 312); }
+        set { *(BmSDK.FName*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ResonatorCloseAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(BmSDK.FName*)(Ptr + 320); }
+        set { *(BmSDK.FName*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ResonatorExplodeAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(BmSDK.FName*)(Ptr + 328); }
+        set { *(BmSDK.FName*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName CustomInAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(BmSDK.FName*)(Ptr + 336); }
+        set { *(BmSDK.FName*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float CameraYawOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(float*)(Ptr + 344); }
+        set { *(float*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float CameraPitchOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float MinOverlayTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(float*)(Ptr + 352); }
+        set { *(float*)(Ptr + 352) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float MaxOverlayTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(float*)(Ptr + 356); }
+        set { *(float*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float MininumStartDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(float*)(Ptr + 360); }
+        set { *(float*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float MaxThumbSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(float*)(Ptr + 364); }
+        set { *(float*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float ThumbAccel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(float*)(Ptr + 368); }
+        set { *(float*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float ThumbDecel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(float*)(Ptr + 372); }
+        set { *(float*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -209,7 +209,7 @@ public partial class RSpecialMoveConfig_ResonateObject : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe bool bAlignAnimWithLocator
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 376) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 376); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 376); }
+        get { return (*(int*)(Ptr + 376) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 376) |= 1; else *(int*)(Ptr + 376) &= ~1; }
     }
 }
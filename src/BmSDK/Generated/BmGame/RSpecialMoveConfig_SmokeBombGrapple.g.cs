@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_SmokeBombGrapple : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe float SmokeTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(float*)(Ptr + 372); }
+        set { *(float*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_SmokeBombGrapple : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName SmokeBombAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(BmSDK.FName*)(Ptr + 376); }
+        set { *(BmSDK.FName*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class RSpecialMoveConfig_SmokeBombGrapple : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe bool PlayGrapple
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 384) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 384); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 384); }
+        get { return (*(int*)(Ptr + 384) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 384) |= 1; else *(int*)(Ptr + 384) &= ~1; }
     }
 }
@@ -78,27 +78,32 @@ public partial class RSpecialMoveController : BmSDK.GameObject, BmSDK.IGameObjec
         where TComponent : class, Framework.IScriptComponent<RSpecialMoveController>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_FindBestSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 148)]
+    private struct FindBestSpecialMove_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Feature;
+        [FieldOffset(112)] public nint Instigator;
+        [FieldOffset(116)] public float DeltaTime;
+        [FieldOffset(120)] public BmSDK.Rotator CheckDirection;
+        [FieldOffset(132)] public System.Numerics.Vector3 StickDir;
+        [FieldOffset(144)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: FindBestSpecialMove
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RSpecialMoveConfig FindBestSpecialMove(BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Feature, BmSDK.Engine.Pawn Instigator, float DeltaTime, BmSDK.Rotator CheckDirection, System.Numerics.Vector3 StickDir = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveController.FindBestSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[148];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Feature, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Instigator, paramsPtr + 112);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 116);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckDirection, paramsPtr + 120);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StickDir, paramsPtr + 132);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSpecialMoveConfig>(paramsPtr + 144);
+        var funcManaged = s_FindBestSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RSpecialMoveController.FindBestSpecialMove", true);
+        var parms = new FindBestSpecialMove_Params();
+        parms.Feature = Feature;
+        parms.Instigator = Instigator?.Ptr ?? 0;
+        parms.DeltaTime = DeltaTime;
+        parms.CheckDirection = CheckDirection;
+        parms.StickDir = StickDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RSpecialMoveConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -115,7 +120,7 @@ public partial class RSpecialMoveController : BmSDK.GameObject, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bSimpleController
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 }
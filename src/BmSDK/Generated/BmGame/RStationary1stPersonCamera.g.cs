@@ -78,63 +78,98 @@ public partial class RStationary1stPersonCamera : BmSDK.BmGame.RCameraActor, BmS
         where TComponent : class, Framework.IScriptComponent<RStationary1stPersonCamera>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetCameraViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct GetCameraView_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.GameObject.FTPOV OutPOV;
+    }
+
     /// <summary>
     /// Function: GetCameraView
     /// </summary>
     public unsafe override void GetCameraView(float DeltaTime, out BmSDK.GameObject.FTPOV OutPOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.GetCameraView", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        OutPOV = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FTPOV>(paramsPtr + 4);
+        var funcManaged = s_GetCameraViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.GetCameraView", true);
+        var parms = new GetCameraView_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        OutPOV = parms.OutPOV;
         return;
     }
 
+    static BmSDK.Function s_UnHidePlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnHidePlayer_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnHidePlayer
     /// </summary>
     public unsafe virtual void UnHidePlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.UnHidePlayer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnHidePlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.UnHidePlayer", true);
+        var parms = new UnHidePlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HidePlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HidePlayer_Params
+    {
+    }
+
     /// <summary>
     /// Function: HidePlayer
     /// </summary>
     public unsafe virtual void HidePlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.HidePlayer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HidePlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.HidePlayer", true);
+        var parms = new HidePlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DeactivateCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DeactivateCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: DeactivateCamera
     /// </summary>
     public unsafe virtual void DeactivateCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.DeactivateCamera", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DeactivateCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.DeactivateCamera", true);
+        var parms = new DeactivateCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ActivateCamera_Params
+    {
+        [FieldOffset(0)] public nint Player;
+        [FieldOffset(4)] public BmSDK.FName SState;
+        [FieldOffset(12)] public BmSDK.FName EState;
+    }
+
     /// <summary>
     /// Function: ActivateCamera
     /// </summary>
     public unsafe virtual void ActivateCamera(BmSDK.BmGame.RPlayerController Player, BmSDK.FName SState = default, BmSDK.FName EState = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.ActivateCamera", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SState, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EState, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmGame.RStationary1stPersonCamera.ActivateCamera", true);
+        var parms = new ActivateCamera_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        parms.SState = SState;
+        parms.EState = EState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -143,8 +178,8 @@ public partial class RStationary1stPersonCamera : BmSDK.BmGame.RCameraActor, BmS
     /// </summary>
     public unsafe float MaximumCameraYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 864); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 864); }
+        get { return *(float*)(Ptr + 864); }
+        set { *(float*)(Ptr + 864) = value; }
     }
 
     /// <summary>
@@ -152,8 +187,8 @@ public partial class RStationary1stPersonCamera : BmSDK.BmGame.RCameraActor, BmS
     /// </summary>
     public unsafe float MaximumCameraPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 868); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 868); }
+        get { return *(float*)(Ptr + 868); }
+        set { *(float*)(Ptr + 868) = value; }
     }
 
     /// <summary>
@@ -161,8 +196,8 @@ public partial class RStationary1stPersonCamera : BmSDK.BmGame.RCameraActor, BmS
     /// </summary>
     public unsafe float BlendInTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 872); }
+        get { return *(float*)(Ptr + 872); }
+        set { *(float*)(Ptr + 872) = value; }
     }
 
     /// <summary>
@@ -170,8 +205,8 @@ public partial class RStationary1stPersonCamera : BmSDK.BmGame.RCameraActor, BmS
     /// </summary>
     public unsafe float BlendOutTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 876); }
+        get { return *(float*)(Ptr + 876); }
+        set { *(float*)(Ptr + 876) = value; }
     }
 
     /// <summary>
@@ -179,8 +214,8 @@ public partial class RStationary1stPersonCamera : BmSDK.BmGame.RCameraActor, BmS
     /// </summary>
     public unsafe bool bSquareLimit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 880); }
+        get { return (*(int*)(Ptr + 880) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 880) |= 1; else *(int*)(Ptr + 880) &= ~1; }
     }
 
     /// <summary>
@@ -188,8 +223,8 @@ public partial class RStationary1stPersonCamera : BmSDK.BmGame.RCameraActor, BmS
     /// </summary>
     public unsafe BmSDK.FName EndState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 884); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 884); }
+        get { return *(BmSDK.FName*)(Ptr + 884); }
+        set { *(BmSDK.FName*)(Ptr + 884) = value; }
     }
 
     /// <summary>
@@ -96,11 +96,7 @@ public partial class RSubtitleLookup : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: SubtitleHash
         /// </summary>
-        public unsafe int SubtitleHash
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int SubtitleHash;
 
         /// <summary>
         /// ObjectProperty: Subtitle
@@ -83,8 +83,8 @@ public partial class RTunnelFunnel : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.BmGame.RTunnelFunnel.TunnelFunnelType FunnelType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RTunnelFunnel.TunnelFunnelType>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(BmSDK.BmGame.RTunnelFunnel.TunnelFunnelType*)(Ptr + 428); }
+        set { *(BmSDK.BmGame.RTunnelFunnel.TunnelFunnelType*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RTunnelFunnel : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float CatchCosAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 
     /// <summary>
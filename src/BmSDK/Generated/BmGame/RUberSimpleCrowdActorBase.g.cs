@@ -92,7 +92,7 @@ public partial class RUberSimpleCrowdActorBase : BmSDK.Engine.Actor, BmSDK.IGame
     /// </summary>
     public unsafe float AnimStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 }
@@ -78,17 +78,37 @@ public partial class RBMAIController_Clayface : BmSDK.BmGame.RBMAIController, Bm
         where TComponent : class, Framework.IScriptComponent<RBMAIController_Clayface>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HandleFreezeClusterGrenadeHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct HandleFreezeClusterGrenadeHit_Params
+    {
+        [FieldOffset(0)] public nint Player;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitNormal;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HandleFreezeClusterGrenadeHit
     /// </summary>
     public unsafe override bool HandleFreezeClusterGrenadeHit(BmSDK.BmGame.RPawnPlayer Player, System.Numerics.Vector3 HitNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMAIController_Clayface.HandleFreezeClusterGrenadeHit", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_HandleFreezeClusterGrenadeHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMAIController_Clayface.HandleFreezeClusterGrenadeHit", true);
+        var parms = new HandleFreezeClusterGrenadeHit_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        parms.HitNormal = HitNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HandleFreezeBlastHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct HandleFreezeBlastHit_Params
+    {
+        [FieldOffset(0)] public nint Player;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitNormal;
+        [FieldOffset(16)] public nint Proj;
+        [FieldOffset(20)] public int bInstantFreeze;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -96,13 +116,13 @@ public partial class RBMAIController_Clayface : BmSDK.BmGame.RBMAIController, Bm
     /// </summary>
     public unsafe override bool HandleFreezeBlastHit(BmSDK.BmGame.RPawnPlayer Player, System.Numerics.Vector3 HitNormal, BmSDK.BmGame.RFreezeSprayProjectile Proj = default, bool bInstantFreeze = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMAIController_Clayface.HandleFreezeBlastHit", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Player, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proj, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantFreeze, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_HandleFreezeBlastHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMAIController_Clayface.HandleFreezeBlastHit", true);
+        var parms = new HandleFreezeBlastHit_Params();
+        parms.Player = Player?.Ptr ?? 0;
+        parms.HitNormal = HitNormal;
+        parms.Proj = Proj?.Ptr ?? 0;
+        parms.bInstantFreeze = bInstantFreeze ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 }
@@ -78,15 +78,28 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
         where TComponent : class, Framework.IScriptComponent<RBMBehaviour_BlackMaskPred>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_LostSightOfBMFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LostSightOfBM_Params
+    {
     }
 
     /// <summary>
@@ -94,33 +107,56 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe virtual void LostSightOfBM()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.LostSightOfBM", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LostSightOfBMFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.LostSightOfBM", true);
+        var parms = new LostSightOfBM_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpottedBMFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SpottedBM_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpottedBM
     /// </summary>
     public unsafe virtual void SpottedBM()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.SpottedBM", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpottedBMFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.SpottedBM", true);
+        var parms = new SpottedBM_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanBlackMaskCurrentlySeeBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct CanBlackMaskCurrentlySeeBatman_Params
+    {
+        [FieldOffset(0)] public float SeeDist;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanBlackMaskCurrentlySeeBatman
     /// </summary>
     public unsafe virtual bool CanBlackMaskCurrentlySeeBatman(float SeeDist)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.CanBlackMaskCurrentlySeeBatman", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SeeDist, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanBlackMaskCurrentlySeeBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.CanBlackMaskCurrentlySeeBatman", true);
+        var parms = new CanBlackMaskCurrentlySeeBatman_Params();
+        parms.SeeDist = SeeDist;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PickFromRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PickFromRange_Params
+    {
+        [FieldOffset(0)] public float rangeMin;
+        [FieldOffset(4)] public float rangeMax;
+        [FieldOffset(8)] public float ReturnValue;
     }
 
     /// <summary>
@@ -128,12 +164,21 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe virtual float PickFromRange(float rangeMin, float rangeMax)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.PickFromRange", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(rangeMin, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(rangeMax, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_PickFromRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.PickFromRange", true);
+        var parms = new PickFromRange_Params();
+        parms.rangeMin = rangeMin;
+        parms.rangeMax = rangeMax;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_BlackMaskPlayAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct BlackMaskPlayAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName transitionAnimName;
+        [FieldOffset(8)] public BmSDK.FName IdleAnimName;
+        [FieldOffset(16)] public float startProportion;
     }
 
     /// <summary>
@@ -141,46 +186,65 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe virtual void BlackMaskPlayAnim(BmSDK.FName transitionAnimName, BmSDK.FName IdleAnimName, float startProportion = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.BlackMaskPlayAnim", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(transitionAnimName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IdleAnimName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(startProportion, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BlackMaskPlayAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.BlackMaskPlayAnim", true);
+        var parms = new BlackMaskPlayAnim_Params();
+        parms.transitionAnimName = transitionAnimName;
+        parms.IdleAnimName = IdleAnimName;
+        parms.startProportion = startProportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.Tick", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnDeactivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnDeactivate_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnDeactivate
     /// </summary>
     public unsafe override void OnDeactivate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.OnDeactivate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnDeactivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.OnDeactivate", true);
+        var parms = new OnDeactivate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnActivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnActivate_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnActivate
     /// </summary>
     public unsafe override void OnActivate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.OnActivate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnActivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_BlackMaskPred.OnActivate", true);
+        var parms = new OnActivate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -207,8 +271,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float TimeTillIdleStateChange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(float*)(Ptr + 404); }
+        set { *(float*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -216,8 +280,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float TimeTillOverlay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(float*)(Ptr + 408); }
+        set { *(float*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -225,8 +289,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float timeBetweenOverlays_DeskMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(float*)(Ptr + 412); }
+        set { *(float*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -234,8 +298,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float timeBetweenOverlays_DeskMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(float*)(Ptr + 416); }
+        set { *(float*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -243,8 +307,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float idleTime_DeskMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(float*)(Ptr + 420); }
+        set { *(float*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -252,8 +316,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float idleTime_DeskMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(float*)(Ptr + 424); }
+        set { *(float*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -261,8 +325,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float timeBetweenOverlays_WindowMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -270,8 +334,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float timeBetweenOverlays_WindowMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -279,8 +343,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float idleTime_WindowMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -288,8 +352,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float idleTime_WindowMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(float*)(Ptr + 440); }
+        set { *(float*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -297,8 +361,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float sightDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(float*)(Ptr + 444); }
+        set { *(float*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -306,8 +370,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe bool bBatmanLocated
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 448); }
+        get { return (*(int*)(Ptr + 448) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 448) |= 1; else *(int*)(Ptr + 448) &= ~1; }
     }
 
     /// <summary>
@@ -315,8 +379,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe bool bDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 448); }
+        get { return (*(int*)(Ptr + 448) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 448) |= 2; else *(int*)(Ptr + 448) &= ~2; }
     }
 
     /// <summary>
@@ -324,8 +388,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float sightMemoryTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(float*)(Ptr + 452); }
+        set { *(float*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -333,8 +397,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float lastBlackMaskSeenBatmanTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(float*)(Ptr + 456); }
+        set { *(float*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -342,8 +406,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe BmSDK.FName lastTransitionName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(BmSDK.FName*)(Ptr + 460); }
+        set { *(BmSDK.FName*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -351,8 +415,8 @@ public partial class RBMBehaviour_BlackMaskPred : BmSDK.BmGame.RBMBehaviour, BmS
     /// </summary>
     public unsafe float lastTransitionStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(float*)(Ptr + 468); }
+        set { *(float*)(Ptr + 468) = value; }
     }
 
     /// <summary>
@@ -78,30 +78,47 @@ public partial class RBMBehaviour_FreezeBlastHitClayDrone : BmSDK.BmGame.RBMBeha
         where TComponent : class, Framework.IScriptComponent<RBMBehaviour_FreezeBlastHitClayDrone>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ActivateFreezeMatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ActivateFreezeMats_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateFreezeMats
     /// </summary>
     public unsafe virtual void ActivateFreezeMats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_FreezeBlastHitClayDrone.ActivateFreezeMats", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateFreezeMatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_FreezeBlastHitClayDrone.ActivateFreezeMats", true);
+        var parms = new ActivateFreezeMats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Initialise_Params
+    {
+        [FieldOffset(0)] public nint Instigator;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitNorm;
+        [FieldOffset(16)] public int bInstantFreeze;
+        [FieldOffset(20)] public nint Proj;
+        [FieldOffset(24)] public int bShouldAlwaysRagdoll;
+    }
+
     /// <summary>
     /// Function: Initialise
     /// </summary>
     public unsafe override void Initialise(BmSDK.BmGame.RPawnPlayer Instigator, System.Numerics.Vector3 HitNorm, bool bInstantFreeze = default, BmSDK.BmGame.RFreezeSprayProjectile Proj = default, bool bShouldAlwaysRagdoll = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_FreezeBlastHitClayDrone.Initialise", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Instigator, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNorm, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantFreeze, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proj, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShouldAlwaysRagdoll, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_FreezeBlastHitClayDrone.Initialise", true);
+        var parms = new Initialise_Params();
+        parms.Instigator = Instigator?.Ptr ?? 0;
+        parms.HitNorm = HitNorm;
+        parms.bInstantFreeze = bInstantFreeze ? 1 : 0;
+        parms.Proj = Proj?.Ptr ?? 0;
+        parms.bShouldAlwaysRagdoll = bShouldAlwaysRagdoll ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -110,7 +127,7 @@ public partial class RBMBehaviour_FreezeBlastHitClayDrone : BmSDK.BmGame.RBMBeha
     /// </summary>
     public unsafe float TimeTillProjExplode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 }
@@ -78,173 +78,268 @@ public partial class RBMBehaviour_RasTakeTaliaHostage : BmSDK.BmGame.RBMBehaviou
         where TComponent : class, Framework.IScriptComponent<RBMBehaviour_RasTakeTaliaHostage>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_OnDeactivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnDeactivate_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnDeactivate
     /// </summary>
     public unsafe override void OnDeactivate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.OnDeactivate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnDeactivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.OnDeactivate", true);
+        var parms = new OnDeactivate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawBatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DrawBat_Params
+    {
+    }
+
     /// <summary>
     /// Function: DrawBat
     /// </summary>
     public unsafe virtual void DrawBat()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.DrawBat", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawBatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.DrawBat", true);
+        var parms = new DrawBat_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BringInCinematicBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct BringInCinematicBatarang_Params
+    {
+    }
+
     /// <summary>
     /// Function: BringInCinematicBatarang
     /// </summary>
     public unsafe virtual void BringInCinematicBatarang()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.BringInCinematicBatarang", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BringInCinematicBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.BringInCinematicBatarang", true);
+        var parms = new BringInCinematicBatarang_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayCameraAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct PlayCameraAnim_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public System.Numerics.Vector3 CamRootLocation;
+        [FieldOffset(16)] public BmSDK.Rotator CamRootRotation;
+        [FieldOffset(28)] public BmSDK.FName AnimName;
+        [FieldOffset(36)] public nint TheAnimSet;
+    }
+
     /// <summary>
     /// Function: PlayCameraAnim
     /// </summary>
     public unsafe virtual void PlayCameraAnim(BmSDK.BmGame.RPlayerController PC, System.Numerics.Vector3 CamRootLocation, BmSDK.Rotator CamRootRotation, BmSDK.FName AnimName, BmSDK.Engine.AnimSet TheAnimSet)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.PlayCameraAnim", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CamRootLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CamRootRotation, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheAnimSet, paramsPtr + 36);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayCameraAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.PlayCameraAnim", true);
+        var parms = new PlayCameraAnim_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        parms.CamRootLocation = CamRootLocation;
+        parms.CamRootRotation = CamRootRotation;
+        parms.AnimName = AnimName;
+        parms.TheAnimSet = TheAnimSet?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyThrownBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DestroyThrownBatarang_Params
+    {
+    }
+
     /// <summary>
     /// Function: DestroyThrownBatarang
     /// </summary>
     public unsafe virtual void DestroyThrownBatarang()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.DestroyThrownBatarang", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyThrownBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.DestroyThrownBatarang", true);
+        var parms = new DestroyThrownBatarang_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatarangHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct BatarangHit_Params
+    {
+    }
+
     /// <summary>
     /// Function: BatarangHit
     /// </summary>
     public unsafe virtual void BatarangHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.BatarangHit", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatarangHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.BatarangHit", true);
+        var parms = new BatarangHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyCinematicBatarangFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DestroyCinematicBatarang_Params
+    {
+    }
+
     /// <summary>
     /// Function: DestroyCinematicBatarang
     /// </summary>
     public unsafe virtual void DestroyCinematicBatarang()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.DestroyCinematicBatarang", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyCinematicBatarangFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.DestroyCinematicBatarang", true);
+        var parms = new DestroyCinematicBatarang_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyDaggerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DestroyDagger_Params
+    {
+    }
+
     /// <summary>
     /// Function: DestroyDagger
     /// </summary>
     public unsafe virtual void DestroyDagger()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.DestroyDagger", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyDaggerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.DestroyDagger", true);
+        var parms = new DestroyDagger_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InTheFaceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct InTheFace_Params
+    {
+    }
+
     /// <summary>
     /// Function: InTheFace
     /// </summary>
     public unsafe virtual void InTheFace()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.InTheFace", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InTheFaceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.InTheFace", true);
+        var parms = new InTheFace_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinalSlowmoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinalSlowmo_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinalSlowmo
     /// </summary>
     public unsafe virtual void FinalSlowmo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.FinalSlowmo", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinalSlowmoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.FinalSlowmo", true);
+        var parms = new FinalSlowmo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NormalSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NormalSpeed_Params
+    {
+    }
+
     /// <summary>
     /// Function: NormalSpeed
     /// </summary>
     public unsafe virtual void NormalSpeed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.NormalSpeed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NormalSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.NormalSpeed", true);
+        var parms = new NormalSpeed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SlowMoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SlowMo_Params
+    {
+    }
+
     /// <summary>
     /// Function: SlowMo
     /// </summary>
     public unsafe virtual void SlowMo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.SlowMo", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SlowMoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.SlowMo", true);
+        var parms = new SlowMo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnDaggerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnDagger_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnDagger
     /// </summary>
     public unsafe virtual void SpawnDagger()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.SpawnDagger", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnDaggerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.SpawnDagger", true);
+        var parms = new SpawnDagger_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpeechStartFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpeechStart_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpeechStart
     /// </summary>
     public unsafe virtual void SpeechStart()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.SpeechStart", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpeechStartFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.SpeechStart", true);
+        var parms = new SpeechStart_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KilledFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Killed_Params
+    {
+    }
+
     /// <summary>
     /// Function: Killed
     /// </summary>
     public unsafe virtual void Killed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.Killed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KilledFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_RasTakeTaliaHostage.Killed", true);
+        var parms = new Killed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -283,8 +378,8 @@ public partial class RBMBehaviour_RasTakeTaliaHostage : BmSDK.BmGame.RBMBehaviou
     /// </summary>
     public unsafe float YawVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(float*)(Ptr + 420); }
+        set { *(float*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -292,8 +387,8 @@ public partial class RBMBehaviour_RasTakeTaliaHostage : BmSDK.BmGame.RBMBehaviou
     /// </summary>
     public unsafe float DriftSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(float*)(Ptr + 424); }
+        set { *(float*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -301,8 +396,8 @@ public partial class RBMBehaviour_RasTakeTaliaHostage : BmSDK.BmGame.RBMBehaviou
     /// </summary>
     public unsafe float LastFollow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -310,8 +405,8 @@ public partial class RBMBehaviour_RasTakeTaliaHostage : BmSDK.BmGame.RBMBehaviou
     /// </summary>
     public unsafe float DistanceToMaintain
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -319,8 +414,8 @@ public partial class RBMBehaviour_RasTakeTaliaHostage : BmSDK.BmGame.RBMBehaviou
     /// </summary>
     public unsafe float PauseTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -328,8 +423,8 @@ public partial class RBMBehaviour_RasTakeTaliaHostage : BmSDK.BmGame.RBMBehaviou
     /// </summary>
     public unsafe float TimeTillTaunt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(float*)(Ptr + 440); }
+        set { *(float*)(Ptr + 440) = value; }
     }
 
     /// <summary>
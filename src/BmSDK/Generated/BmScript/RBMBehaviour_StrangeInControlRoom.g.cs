@@ -78,15 +78,29 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
         where TComponent : class, Framework.IScriptComponent<RBMBehaviour_StrangeInControlRoom>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanLookAtPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanLookAtPlayer_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -94,10 +108,16 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe override bool CanLookAtPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.CanLookAtPlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanLookAtPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.CanLookAtPlayer", true);
+        var parms = new CanLookAtPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RepathFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Repath_Params
+    {
     }
 
     /// <summary>
@@ -105,57 +125,93 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe override void Repath()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.Repath", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RepathFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.Repath", true);
+        var parms = new Repath_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartNavMeshSearchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartNavMeshSearch_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartNavMeshSearch
     /// </summary>
     public unsafe override void StartNavMeshSearch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.StartNavMeshSearch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartNavMeshSearchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.StartNavMeshSearch", true);
+        var parms = new StartNavMeshSearch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MoveToNearestWindowBaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct MoveToNearestWindowBase_Params
+    {
+        [FieldOffset(0)] public int bForceDoor;
+    }
+
     /// <summary>
     /// Function: MoveToNearestWindowBase
     /// </summary>
     public unsafe virtual void MoveToNearestWindowBase(bool bForceDoor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.MoveToNearestWindowBase", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceDoor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MoveToNearestWindowBaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.MoveToNearestWindowBase", true);
+        var parms = new MoveToNearestWindowBase_Params();
+        parms.bForceDoor = bForceDoor ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MoveToNearestWindowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MoveToNearestWindow_Params
+    {
+        [FieldOffset(0)] public int bForceDoor;
+    }
+
     /// <summary>
     /// Function: MoveToNearestWindow
     /// </summary>
     public unsafe virtual void MoveToNearestWindow(bool bForceDoor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.MoveToNearestWindow", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceDoor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MoveToNearestWindowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.MoveToNearestWindow", true);
+        var parms = new MoveToNearestWindow_Params();
+        parms.bForceDoor = bForceDoor ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Update
     /// </summary>
     public unsafe override bool Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.Update", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanSeeBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CanSeeBatman_Params
+    {
+        [FieldOffset(0)] public float SeeDist;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -163,11 +219,17 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe virtual bool CanSeeBatman(float SeeDist)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.CanSeeBatman", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SeeDist, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanSeeBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.CanSeeBatman", true);
+        var parms = new CanSeeBatman_Params();
+        parms.SeeDist = SeeDist;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetInitialStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetInitialState_Params
+    {
     }
 
     /// <summary>
@@ -175,21 +237,34 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe override void SetInitialState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.SetInitialState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInitialStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.SetInitialState", true);
+        var parms = new SetInitialState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetMoveLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetMoveLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetMoveLocation
     /// </summary>
     public unsafe override System.Numerics.Vector3 GetMoveLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.GetMoveLocation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetMoveLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.GetMoveLocation", true);
+        var parms = new GetMoveLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_OnActivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnActivate_Params
+    {
     }
 
     /// <summary>
@@ -197,9 +272,9 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe override void OnActivate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.OnActivate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnActivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_StrangeInControlRoom.OnActivate", true);
+        var parms = new OnActivate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -230,11 +305,7 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
         /// <summary>
         /// NameProperty: PointAnim
         /// </summary>
-        public unsafe BmSDK.FName PointAnim
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName PointAnim;
     }
 
     /// <summary>
@@ -269,8 +340,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName LookAnimInLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(BmSDK.FName*)(Ptr + 500); }
+        set { *(BmSDK.FName*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -278,8 +349,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName LookAnimInRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 508); }
+        get { return *(BmSDK.FName*)(Ptr + 508); }
+        set { *(BmSDK.FName*)(Ptr + 508) = value; }
     }
 
     /// <summary>
@@ -296,8 +367,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName LookAnimOutLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 528); }
+        get { return *(BmSDK.FName*)(Ptr + 528); }
+        set { *(BmSDK.FName*)(Ptr + 528) = value; }
     }
 
     /// <summary>
@@ -305,8 +376,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName LookAnimOutRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }
+        get { return *(BmSDK.FName*)(Ptr + 536); }
+        set { *(BmSDK.FName*)(Ptr + 536) = value; }
     }
 
     /// <summary>
@@ -314,8 +385,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe float LookTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 544); }
+        get { return *(float*)(Ptr + 544); }
+        set { *(float*)(Ptr + 544) = value; }
     }
 
     /// <summary>
@@ -323,8 +394,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName LookRunAnimInLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(BmSDK.FName*)(Ptr + 548); }
+        set { *(BmSDK.FName*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -332,8 +403,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName LookRunAnimInRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(BmSDK.FName*)(Ptr + 556); }
+        set { *(BmSDK.FName*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -350,8 +421,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName LookRunAnimOutLeft
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 576); }
+        get { return *(BmSDK.FName*)(Ptr + 576); }
+        set { *(BmSDK.FName*)(Ptr + 576) = value; }
     }
 
     /// <summary>
@@ -359,8 +430,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName LookRunAnimOutRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 584); }
+        get { return *(BmSDK.FName*)(Ptr + 584); }
+        set { *(BmSDK.FName*)(Ptr + 584) = value; }
     }
 
     /// <summary>
@@ -386,8 +457,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe int CurrentInterest
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 608); }
+        get { return *(int*)(Ptr + 608); }
+        set { *(int*)(Ptr + 608) = value; }
     }
 
     /// <summary>
@@ -395,8 +466,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe float WalkingLookDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 612); }
+        get { return *(float*)(Ptr + 612); }
+        set { *(float*)(Ptr + 612) = value; }
     }
 
     /// <summary>
@@ -404,8 +475,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe float LookOutWindowLookDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 616); }
+        get { return *(float*)(Ptr + 616); }
+        set { *(float*)(Ptr + 616) = value; }
     }
 
     /// <summary>
@@ -413,8 +484,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe BmSDK.FName PointAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 620); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 620); }
+        get { return *(BmSDK.FName*)(Ptr + 620); }
+        set { *(BmSDK.FName*)(Ptr + 620) = value; }
     }
 
     /// <summary>
@@ -422,8 +493,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe float TimeInState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 628); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 628); }
+        get { return *(float*)(Ptr + 628); }
+        set { *(float*)(Ptr + 628) = value; }
     }
 
     /// <summary>
@@ -431,8 +502,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe bool bReturning
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 632); }
+        get { return (*(int*)(Ptr + 632) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 632) |= 1; else *(int*)(Ptr + 632) &= ~1; }
     }
 
     /// <summary>
@@ -440,8 +511,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe bool bTauntRequested
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 632); }
+        get { return (*(int*)(Ptr + 632) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 632) |= 2; else *(int*)(Ptr + 632) &= ~2; }
     }
 
     /// <summary>
@@ -449,8 +520,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe bool bIgnoreNextWindowIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 632); }
+        get { return (*(int*)(Ptr + 632) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 632) |= 4; else *(int*)(Ptr + 632) &= ~4; }
     }
 
     /// <summary>
@@ -458,8 +529,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe bool bWantsToLook
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 632); }
+        get { return (*(int*)(Ptr + 632) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 632) |= 8; else *(int*)(Ptr + 632) &= ~8; }
     }
 
     /// <summary>
@@ -467,8 +538,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe bool bHugoRunning
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 632); }
+        get { return (*(int*)(Ptr + 632) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 632) |= 16; else *(int*)(Ptr + 632) &= ~16; }
     }
 
     /// <summary>
@@ -476,8 +547,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe bool bQueueRun
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 632); }
+        get { return (*(int*)(Ptr + 632) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 632) |= 32; else *(int*)(Ptr + 632) &= ~32; }
     }
 
     /// <summary>
@@ -485,8 +556,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe bool bQueueExit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 632); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 632); }
+        get { return (*(int*)(Ptr + 632) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 632) |= 64; else *(int*)(Ptr + 632) &= ~64; }
     }
 
     /// <summary>
@@ -494,8 +565,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe int ForcedInterestPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 636); }
+        get { return *(int*)(Ptr + 636); }
+        set { *(int*)(Ptr + 636) = value; }
     }
 
     /// <summary>
@@ -503,8 +574,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe float DistToLook
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 640); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 640); }
+        get { return *(float*)(Ptr + 640); }
+        set { *(float*)(Ptr + 640) = value; }
     }
 
     /// <summary>
@@ -512,8 +583,8 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe float TimeTillSpotted
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 644); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 644); }
+        get { return *(float*)(Ptr + 644); }
+        set { *(float*)(Ptr + 644) = value; }
     }
 
     /// <summary>
@@ -521,7 +592,7 @@ public partial class RBMBehaviour_StrangeInControlRoom : BmSDK.BmGame.RBMBehavio
     /// </summary>
     public unsafe float TimeBetweenSpotAndAlert
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 648); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 648); }
+        get { return *(float*)(Ptr + 648); }
+        set { *(float*)(Ptr + 648) = value; }
     }
 }
@@ -78,15 +78,29 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
         where TComponent : class, Framework.IScriptComponent<RBMBehaviour_TwoFaceShooting>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanLookAtPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanLookAtPlayer_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -94,10 +108,17 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe override bool CanLookAtPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.CanLookAtPlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanLookAtPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.CanLookAtPlayer", true);
+        var parms = new CanLookAtPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShootFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 312)]
+    private struct Shoot_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -105,10 +126,17 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe virtual bool Shoot()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.Shoot", true);
-        byte* paramsPtr = stackalloc byte[312];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShootFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.Shoot", true);
+        var parms = new Shoot_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanShootBmDirectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct CanShootBmDirect_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -116,10 +144,16 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe virtual bool CanShootBmDirect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.CanShootBmDirect", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanShootBmDirectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.CanShootBmDirect", true);
+        var parms = new CanShootBmDirect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DisableTracerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisableTracer_Params
+    {
     }
 
     /// <summary>
@@ -127,33 +161,53 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe virtual void DisableTracer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.DisableTracer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableTracerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.DisableTracer", true);
+        var parms = new DisableTracer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopShootFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopShoot_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopShoot
     /// </summary>
     public unsafe virtual void StopShoot()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.StopShoot", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopShootFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.StopShoot", true);
+        var parms = new StopShoot_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Update
     /// </summary>
     public unsafe override bool Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.Update", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BangHammerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BangHammer_Params
+    {
     }
 
     /// <summary>
@@ -161,20 +215,26 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe virtual void BangHammer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.BangHammer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BangHammerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.BangHammer", true);
+        var parms = new BangHammer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnActivateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnActivate_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnActivate
     /// </summary>
     public unsafe override void OnActivate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.OnActivate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnActivateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMBehaviour_TwoFaceShooting.OnActivate", true);
+        var parms = new OnActivate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -207,8 +267,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bAutoShot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 1; else *(int*)(Ptr + 416) &= ~1; }
     }
 
     /// <summary>
@@ -216,8 +276,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bBangHammer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 2; else *(int*)(Ptr + 416) &= ~2; }
     }
 
     /// <summary>
@@ -225,8 +285,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bHasBangedHammer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 4; else *(int*)(Ptr + 416) &= ~4; }
     }
 
     /// <summary>
@@ -234,8 +294,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bHasChangedHammerState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 8; else *(int*)(Ptr + 416) &= ~8; }
     }
 
     /// <summary>
@@ -243,8 +303,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bHasReturnedHammerState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 16; else *(int*)(Ptr + 416) &= ~16; }
     }
 
     /// <summary>
@@ -252,8 +312,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bFirstHammer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 32; else *(int*)(Ptr + 416) &= ~32; }
     }
 
     /// <summary>
@@ -261,8 +321,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bFinalShot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 64; else *(int*)(Ptr + 416) &= ~64; }
     }
 
     /// <summary>
@@ -270,8 +330,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bFinalShotGo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 128; else *(int*)(Ptr + 416) &= ~128; }
     }
 
     /// <summary>
@@ -279,8 +339,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe bool bAimingAtBats
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 416); }
+        get { return (*(int*)(Ptr + 416) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 416) |= 256; else *(int*)(Ptr + 416) &= ~256; }
     }
 
     /// <summary>
@@ -288,8 +348,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float TimeTillSlowShot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(float*)(Ptr + 420); }
+        set { *(float*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -297,8 +357,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float TimeToQueuedShot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(float*)(Ptr + 424); }
+        set { *(float*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -306,8 +366,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float TimeToStopQueuedShot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -360,8 +420,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float DisableTracerTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(float*)(Ptr + 460); }
+        set { *(float*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -369,8 +429,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float TracerSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(float*)(Ptr + 464); }
+        set { *(float*)(Ptr + 464) = value; }
     }
 
     /// <summary>
@@ -378,8 +438,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe int BatmanDamage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(int*)(Ptr + 468); }
+        set { *(int*)(Ptr + 468) = value; }
     }
 
     /// <summary>
@@ -387,8 +447,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe int ThugDamage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(int*)(Ptr + 472); }
+        set { *(int*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -396,8 +456,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float ThugMomentum
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(float*)(Ptr + 476); }
+        set { *(float*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -405,8 +465,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float AutoShotDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(float*)(Ptr + 480); }
+        set { *(float*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -414,8 +474,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float TimeBetweenDangerShots
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(float*)(Ptr + 484); }
+        set { *(float*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -423,8 +483,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float TimeToQueuedFinalShot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(float*)(Ptr + 488); }
+        set { *(float*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -441,8 +501,8 @@ public partial class RBMBehaviour_TwoFaceShooting : BmSDK.BmGame.RBMBehaviour, B
     /// </summary>
     public unsafe float MissGlassOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(float*)(Ptr + 496); }
+        set { *(float*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -78,51 +78,79 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
         where TComponent : class, Framework.IScriptComponent<RBMCombatThrownObject_HeavyObjectClayLump>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_MoveTowardClayfaceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct MoveTowardClayface_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: MoveTowardClayface
     /// </summary>
     public unsafe virtual void MoveTowardClayface(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMCombatThrownObject_HeavyObjectClayLump.MoveTowardClayface", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MoveTowardClayfaceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMCombatThrownObject_HeavyObjectClayLump.MoveTowardClayface", true);
+        var parms = new MoveTowardClayface_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMCombatThrownObject_HeavyObjectClayLump.Tick", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMCombatThrownObject_HeavyObjectClayLump.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitSomethingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct HitSomething_Params
+    {
+        [FieldOffset(0)] public nint HitPawn;
+        [FieldOffset(4)] public float Speed;
+    }
+
     /// <summary>
     /// Function: HitSomething
     /// </summary>
     public unsafe override void HitSomething(BmSDK.BmGame.RPawnCombat HitPawn, float Speed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMCombatThrownObject_HeavyObjectClayLump.HitSomething", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitSomethingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMCombatThrownObject_HeavyObjectClayLump.HitSomething", true);
+        var parms = new HitSomething_Params();
+        parms.HitPawn = HitPawn?.Ptr ?? 0;
+        parms.Speed = Speed;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMCombatThrownObject_HeavyObjectClayLump.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMCombatThrownObject_HeavyObjectClayLump.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -131,8 +159,8 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
     /// </summary>
     public unsafe bool bBeenThrown
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 728); }
+        get { return (*(int*)(Ptr + 728) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 728) |= 1; else *(int*)(Ptr + 728) &= ~1; }
     }
 
     /// <summary>
@@ -140,8 +168,8 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
     /// </summary>
     public unsafe bool bExploded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 728); }
+        get { return (*(int*)(Ptr + 728) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 728) |= 2; else *(int*)(Ptr + 728) &= ~2; }
     }
 
     /// <summary>
@@ -149,8 +177,8 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
     /// </summary>
     public unsafe bool bIntoFire
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 728); }
+        get { return (*(int*)(Ptr + 728) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 728) |= 4; else *(int*)(Ptr + 728) &= ~4; }
     }
 
     /// <summary>
@@ -158,8 +186,8 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
     /// </summary>
     public unsafe bool bBeenClose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 728); }
+        get { return (*(int*)(Ptr + 728) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 728) |= 8; else *(int*)(Ptr + 728) &= ~8; }
     }
 
     /// <summary>
@@ -167,8 +195,8 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
     /// </summary>
     public unsafe bool bStartPuddle
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 728); }
+        get { return (*(int*)(Ptr + 728) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 728) |= 16; else *(int*)(Ptr + 728) &= ~16; }
     }
 
     /// <summary>
@@ -176,8 +204,8 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
     /// </summary>
     public unsafe float MaxSpeedAfterAccel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 732); }
+        get { return *(float*)(Ptr + 732); }
+        set { *(float*)(Ptr + 732) = value; }
     }
 
     /// <summary>
@@ -185,8 +213,8 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
     /// </summary>
     public unsafe float AccelPerFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 736); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 736); }
+        get { return *(float*)(Ptr + 736); }
+        set { *(float*)(Ptr + 736) = value; }
     }
 
     /// <summary>
@@ -212,7 +240,7 @@ public partial class RBMCombatThrownObject_HeavyObjectClayLump : BmSDK.BmScript.
     /// </summary>
     public unsafe float PuddleWaitTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 748); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 748); }
+        get { return *(float*)(Ptr + 748); }
+        set { *(float*)(Ptr + 748) = value; }
     }
 }
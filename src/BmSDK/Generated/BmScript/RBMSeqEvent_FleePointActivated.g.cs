@@ -78,14 +78,21 @@ public partial class RBMSeqEvent_FleePointActivated : BmSDK.BmGame.RBMSeqEvent_B
         where TComponent : class, Framework.IScriptComponent<RBMSeqEvent_FleePointActivated>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_AttachedToWanderingBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AttachedToWanderingBehaviour_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AttachedToWanderingBehaviour
     /// </summary>
     public unsafe virtual bool AttachedToWanderingBehaviour()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMSeqEvent_FleePointActivated.AttachedToWanderingBehaviour", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AttachedToWanderingBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMSeqEvent_FleePointActivated.AttachedToWanderingBehaviour", true);
+        var parms = new AttachedToWanderingBehaviour_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 }
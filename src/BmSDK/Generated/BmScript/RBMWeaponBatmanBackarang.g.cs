@@ -78,16 +78,32 @@ public partial class RBMWeaponBatmanBackarang : BmSDK.BmGame.RBMWeapon, BmSDK.IG
         where TComponent : class, Framework.IScriptComponent<RBMWeaponBatmanBackarang>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CreateCustomWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 492)]
+    private struct CreateCustomWeaponConfig_Params
+    {
+        [FieldOffset(0)] public nint PlayerOwner;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateCustomWeaponConfig
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RWeaponConfig CreateCustomWeaponConfig(BmSDK.BmGame.RPawnPlayer PlayerOwner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMWeaponBatmanBackarang.CreateCustomWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[492];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerOwner, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWeaponConfig>(paramsPtr + 4);
+        var funcManaged = s_CreateCustomWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMWeaponBatmanBackarang.CreateCustomWeaponConfig", true);
+        var parms = new CreateCustomWeaponConfig_Params();
+        parms.PlayerOwner = PlayerOwner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWeaponConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GivenToFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GivenTo_Params
+    {
+        [FieldOffset(0)] public nint thisPawn;
+        [FieldOffset(4)] public int bDoNotActivate;
     }
 
     /// <summary>
@@ -95,22 +111,28 @@ public partial class RBMWeaponBatmanBackarang : BmSDK.BmGame.RBMWeapon, BmSDK.IG
     /// </summary>
     public unsafe override void GivenTo(BmSDK.Engine.Pawn thisPawn, bool bDoNotActivate = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMWeaponBatmanBackarang.GivenTo", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(thisPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDoNotActivate, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GivenToFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMWeaponBatmanBackarang.GivenTo", true);
+        var parms = new GivenTo_Params();
+        parms.thisPawn = thisPawn?.Ptr ?? 0;
+        parms.bDoNotActivate = bDoNotActivate ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetWeaponConfig_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetWeaponConfig
     /// </summary>
     public unsafe override void SetWeaponConfig()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMWeaponBatmanBackarang.SetWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBMWeaponBatmanBackarang.SetWeaponConfig", true);
+        var parms = new SetWeaponConfig_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -78,14 +78,20 @@ public partial class RBatarangProjectileBm : BmSDK.BmGame.RBatarangProjectile, B
         where TComponent : class, Framework.IScriptComponent<RBatarangProjectileBm>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_StartSpinSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartSpinSound_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartSpinSound
     /// </summary>
     public unsafe override void StartSpinSound()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBatarangProjectileBm.StartSpinSound", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartSpinSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RBatarangProjectileBm.StartSpinSound", true);
+        var parms = new StartSpinSound_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
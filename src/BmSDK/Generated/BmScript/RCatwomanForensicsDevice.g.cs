@@ -78,51 +78,79 @@ public partial class RCatwomanForensicsDevice : BmSDK.BmGame.RForensicsDevice, B
         where TComponent : class, Framework.IScriptComponent<RCatwomanForensicsDevice>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_RestoreMaterialsForXrayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct RestoreMaterialsForXray_Params
+    {
+        [FieldOffset(0)] public int force_swap;
+    }
+
     /// <summary>
     /// Function: RestoreMaterialsForXray
     /// </summary>
     public unsafe override void RestoreMaterialsForXray(bool force_swap = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCatwomanForensicsDevice.RestoreMaterialsForXray", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(force_swap, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RestoreMaterialsForXrayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCatwomanForensicsDevice.RestoreMaterialsForXray", true);
+        var parms = new RestoreMaterialsForXray_Params();
+        parms.force_swap = force_swap ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DrawHUD_Params
+    {
+        [FieldOffset(0)] public nint Canvas;
+    }
+
     /// <summary>
     /// Function: DrawHUD
     /// </summary>
     public unsafe override void DrawHUD(BmSDK.Engine.Canvas Canvas)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCatwomanForensicsDevice.DrawHUD", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Canvas, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCatwomanForensicsDevice.DrawHUD", true);
+        var parms = new DrawHUD_Params();
+        parms.Canvas = Canvas?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwapMaterialsForXrayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SwapMaterialsForXray_Params
+    {
+        [FieldOffset(0)] public int force_swap;
+    }
+
     /// <summary>
     /// Function: SwapMaterialsForXray
     /// </summary>
     public unsafe override void SwapMaterialsForXray(bool force_swap = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCatwomanForensicsDevice.SwapMaterialsForXray", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(force_swap, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwapMaterialsForXrayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCatwomanForensicsDevice.SwapMaterialsForXray", true);
+        var parms = new SwapMaterialsForXray_Params();
+        parms.force_swap = force_swap ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetForensicsRenderTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetForensicsRenderType_Params
+    {
+        [FieldOffset(0)] public int On;
+    }
+
     /// <summary>
     /// Function: SetForensicsRenderType
     /// </summary>
     public unsafe override void SetForensicsRenderType(bool On)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCatwomanForensicsDevice.SetForensicsRenderType", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(On, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetForensicsRenderTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCatwomanForensicsDevice.SetForensicsRenderType", true);
+        var parms = new SetForensicsRenderType_Params();
+        parms.On = On ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -78,15 +78,22 @@ public partial class RCharacter_Joker : BmSDK.BmGame.RCharacter, BmSDK.IGameObje
         where TComponent : class, Framework.IScriptComponent<RCharacter_Joker>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetupCustomPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct SetupCustomPhysics_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+    }
+
     /// <summary>
     /// Function: SetupCustomPhysics
     /// </summary>
     public unsafe static void SetupCustomPhysics(BmSDK.BmGame.RBMPawnAI Pawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCharacter_Joker.SetupCustomPhysics", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetupCustomPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCharacter_Joker.SetupCustomPhysics", true);
+        var parms = new SetupCustomPhysics_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
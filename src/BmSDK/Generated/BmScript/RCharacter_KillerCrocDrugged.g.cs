@@ -78,15 +78,22 @@ public partial class RCharacter_KillerCrocDrugged : BmSDK.BmGame.RCharacter, BmS
         where TComponent : class, Framework.IScriptComponent<RCharacter_KillerCrocDrugged>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetupCustomPhysicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetupCustomPhysics_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+    }
+
     /// <summary>
     /// Function: SetupCustomPhysics
     /// </summary>
     public unsafe static void SetupCustomPhysics(BmSDK.BmGame.RBMPawnAI Pawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCharacter_KillerCrocDrugged.SetupCustomPhysics", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetupCustomPhysicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RCharacter_KillerCrocDrugged.SetupCustomPhysics", true);
+        var parms = new SetupCustomPhysics_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
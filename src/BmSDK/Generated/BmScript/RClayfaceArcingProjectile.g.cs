@@ -78,26 +78,46 @@ public partial class RClayfaceArcingProjectile : BmSDK.BmScript.RClayfaceProject
         where TComponent : class, Framework.IScriptComponent<RClayfaceArcingProjectile>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ExplodeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Explode_Params
+    {
+    }
+
     /// <summary>
     /// Function: Explode
     /// </summary>
     public unsafe override void Explode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.Explode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ExplodeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.Explode", true);
+        var parms = new Explode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HurtBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HurtBatman_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HurtBatman
     /// </summary>
     public unsafe override bool HurtBatman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.HurtBatman", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HurtBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.HurtBatman", true);
+        var parms = new HurtBatman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateMoveTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UpdateMoveTarget_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -105,39 +125,58 @@ public partial class RClayfaceArcingProjectile : BmSDK.BmScript.RClayfaceProject
     /// </summary>
     public unsafe override void UpdateMoveTarget(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.UpdateMoveTarget", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateMoveTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.UpdateMoveTarget", true);
+        var parms = new UpdateMoveTarget_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseArcProjFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct InitialiseArcProj_Params
+    {
+        [FieldOffset(0)] public nint CF;
+        [FieldOffset(4)] public float FlightSpd;
+        [FieldOffset(8)] public float Damage;
+        [FieldOffset(12)] public int bLarge;
+        [FieldOffset(16)] public int bDelaySpawn;
+        [FieldOffset(20)] public float TimeBeforeActivate;
+    }
+
     /// <summary>
     /// Function: InitialiseArcProj
     /// </summary>
     public unsafe virtual void InitialiseArcProj(BmSDK.BmGame.RPawnBossClayfaceBase CF, float FlightSpd, float Damage, bool bLarge, bool bDelaySpawn, float TimeBeforeActivate = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.InitialiseArcProj", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CF, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FlightSpd, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Damage, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLarge, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDelaySpawn, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeBeforeActivate, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseArcProjFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceArcingProjectile.InitialiseArcProj", true);
+        var parms = new InitialiseArcProj_Params();
+        parms.CF = CF?.Ptr ?? 0;
+        parms.FlightSpd = FlightSpd;
+        parms.Damage = Damage;
+        parms.bLarge = bLarge ? 1 : 0;
+        parms.bDelaySpawn = bDelaySpawn ? 1 : 0;
+        parms.TimeBeforeActivate = TimeBeforeActivate;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -152,8 +191,8 @@ public partial class RClayfaceArcingProjectile : BmSDK.BmScript.RClayfaceProject
     /// </summary>
     public unsafe float WaitTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 568); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 568); }
+        get { return *(float*)(Ptr + 568); }
+        set { *(float*)(Ptr + 568) = value; }
     }
 
     /// <summary>
@@ -161,7 +200,7 @@ public partial class RClayfaceArcingProjectile : BmSDK.BmScript.RClayfaceProject
     /// </summary>
     public unsafe float GravityVal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 572); }
+        get { return *(float*)(Ptr + 572); }
+        set { *(float*)(Ptr + 572) = value; }
     }
 }
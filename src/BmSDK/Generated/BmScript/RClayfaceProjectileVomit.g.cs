@@ -78,26 +78,39 @@ public partial class RClayfaceProjectileVomit : BmSDK.BmScript.RClayfaceProjecti
         where TComponent : class, Framework.IScriptComponent<RClayfaceProjectileVomit>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HurtThugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 248)]
+    private struct HurtThug_Params
+    {
+        [FieldOffset(0)] public nint Drone;
+    }
+
     /// <summary>
     /// Function: HurtThug
     /// </summary>
     public unsafe virtual void HurtThug(BmSDK.BmGame.RPawnVillain Drone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceProjectileVomit.HurtThug", true);
-        byte* paramsPtr = stackalloc byte[248];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Drone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HurtThugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceProjectileVomit.HurtThug", true);
+        var parms = new HurtThug_Params();
+        parms.Drone = Drone?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckDistanceToTargetsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CheckDistanceToTargets_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckDistanceToTargets
     /// </summary>
     public unsafe override void CheckDistanceToTargets()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceProjectileVomit.CheckDistanceToTargets", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckDistanceToTargetsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RClayfaceProjectileVomit.CheckDistanceToTargets", true);
+        var parms = new CheckDistanceToTargets_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -106,7 +119,7 @@ public partial class RClayfaceProjectileVomit : BmSDK.BmScript.RClayfaceProjecti
     /// </summary>
     public unsafe bool bHitBm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 556) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 556); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 556); }
+        get { return (*(int*)(Ptr + 556) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 556) |= 1; else *(int*)(Ptr + 556) &= ~1; }
     }
 }
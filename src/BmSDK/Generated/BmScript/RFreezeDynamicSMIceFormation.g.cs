@@ -78,141 +78,219 @@ public partial class RFreezeDynamicSMIceFormation : BmSDK.Engine.DynamicSMActor,
         where TComponent : class, Framework.IScriptComponent<RFreezeDynamicSMIceFormation>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RehideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Rehide_Params
+    {
+    }
+
     /// <summary>
     /// Function: Rehide
     /// </summary>
     public unsafe virtual void Rehide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.Rehide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RehideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.Rehide", true);
+        var parms = new Rehide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickRailFreezeEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TickRailFreezeEffect_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: TickRailFreezeEffect
     /// </summary>
     public unsafe virtual void TickRailFreezeEffect(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.TickRailFreezeEffect", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickRailFreezeEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.TickRailFreezeEffect", true);
+        var parms = new TickRailFreezeEffect_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MakeResponsibleForRailFreezeEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MakeResponsibleForRailFreezeEffect_Params
+    {
+        [FieldOffset(0)] public nint _ParentForCallback;
+    }
+
     /// <summary>
     /// Function: MakeResponsibleForRailFreezeEffect
     /// </summary>
     public unsafe virtual void MakeResponsibleForRailFreezeEffect(BmSDK.BmScript.RFreezeEnvironmentTarget _ParentForCallback)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.MakeResponsibleForRailFreezeEffect", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ParentForCallback, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MakeResponsibleForRailFreezeEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.MakeResponsibleForRailFreezeEffect", true);
+        var parms = new MakeResponsibleForRailFreezeEffect_Params();
+        parms._ParentForCallback = _ParentForCallback?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerGrateEjectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerGrateEjection_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerGrateEjection
     /// </summary>
     public unsafe virtual void TriggerGrateEjection()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.TriggerGrateEjection", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerGrateEjectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.TriggerGrateEjection", true);
+        var parms = new TriggerGrateEjection_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MakeResponsibleForTriggeringGrateEjectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct MakeResponsibleForTriggeringGrateEjection_Params
+    {
+        [FieldOffset(0)] public nint _ParentForCallback;
+        [FieldOffset(4)] public float ejection_delay;
+    }
+
     /// <summary>
     /// Function: MakeResponsibleForTriggeringGrateEjection
     /// </summary>
     public unsafe virtual void MakeResponsibleForTriggeringGrateEjection(BmSDK.BmScript.RFreezeEnvironmentTarget _ParentForCallback, float ejection_delay)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.MakeResponsibleForTriggeringGrateEjection", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_ParentForCallback, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ejection_delay, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MakeResponsibleForTriggeringGrateEjectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.MakeResponsibleForTriggeringGrateEjection", true);
+        var parms = new MakeResponsibleForTriggeringGrateEjection_Params();
+        parms._ParentForCallback = _ParentForCallback?.Ptr ?? 0;
+        parms.ejection_delay = ejection_delay;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FreezeWithDelayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FreezeWithDelay_Params
+    {
+        [FieldOffset(0)] public float the_delay;
+    }
+
     /// <summary>
     /// Function: FreezeWithDelay
     /// </summary>
     public unsafe virtual void FreezeWithDelay(float the_delay)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.FreezeWithDelay", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(the_delay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FreezeWithDelayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.FreezeWithDelay", true);
+        var parms = new FreezeWithDelay_Params();
+        parms.the_delay = the_delay;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostDelayFreezeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostDelayFreeze_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostDelayFreeze
     /// </summary>
     public unsafe virtual void PostDelayFreeze()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.PostDelayFreeze", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostDelayFreezeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.PostDelayFreeze", true);
+        var parms = new PostDelayFreeze_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FreezeNowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FreezeNow_Params
+    {
+    }
+
     /// <summary>
     /// Function: FreezeNow
     /// </summary>
     public unsafe virtual void FreezeNow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.FreezeNow", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FreezeNowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.FreezeNow", true);
+        var parms = new FreezeNow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetUnhiddenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetUnhidden_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetUnhidden
     /// </summary>
     public unsafe virtual void SetUnhidden()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.SetUnhidden", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetUnhiddenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.SetUnhidden", true);
+        var parms = new SetUnhidden_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckDisableTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckDisableTick_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckDisableTick
     /// </summary>
     public unsafe virtual void CheckDisableTick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.CheckDisableTick", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckDisableTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.CheckDisableTick", true);
+        var parms = new CheckDisableTick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreBeginPlay
     /// </summary>
     public unsafe override void PreBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.PreBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeDynamicSMIceFormation.PreBeginPlay", true);
+        var parms = new PreBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -221,8 +299,8 @@ public partial class RFreezeDynamicSMIceFormation : BmSDK.Engine.DynamicSMActor,
     /// </summary>
     public unsafe bool bStartHidden
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 1; else *(int*)(Ptr + 484) &= ~1; }
     }
 
     /// <summary>
@@ -230,8 +308,8 @@ public partial class RFreezeDynamicSMIceFormation : BmSDK.Engine.DynamicSMActor,
     /// </summary>
     public unsafe bool bSolidOnceVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 2; else *(int*)(Ptr + 484) &= ~2; }
     }
 
     /// <summary>
@@ -239,8 +317,8 @@ public partial class RFreezeDynamicSMIceFormation : BmSDK.Engine.DynamicSMActor,
     /// </summary>
     public unsafe bool bHandlingRailFreezeEffect
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 484); }
+        get { return (*(int*)(Ptr + 484) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 484) |= 4; else *(int*)(Ptr + 484) &= ~4; }
     }
 
     /// <summary>
@@ -257,7 +335,7 @@ public partial class RFreezeDynamicSMIceFormation : BmSDK.Engine.DynamicSMActor,
     /// </summary>
     public unsafe int NumTimersKeepingTickActive
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(int*)(Ptr + 492); }
+        set { *(int*)(Ptr + 492) = value; }
     }
 }
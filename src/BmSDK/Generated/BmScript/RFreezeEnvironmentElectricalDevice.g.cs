@@ -83,7 +83,7 @@ public partial class RFreezeEnvironmentElectricalDevice : BmSDK.Engine.Actor, Bm
     /// </summary>
     public unsafe float DistanceFromEmpSource
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 }
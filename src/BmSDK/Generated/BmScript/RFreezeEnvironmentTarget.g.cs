@@ -78,38 +78,64 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
         where TComponent : class, Framework.IScriptComponent<RFreezeEnvironmentTarget>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_FireElectricFloorEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct FireElectricFloorEvent_Params
+    {
+    }
+
     /// <summary>
     /// Function: FireElectricFloorEvent
     /// </summary>
     public unsafe virtual void FireElectricFloorEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.FireElectricFloorEvent", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FireElectricFloorEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.FireElectricFloorEvent", true);
+        var parms = new FireElectricFloorEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitIceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitIce_Params
+    {
+        [FieldOffset(0)] public nint _RPC;
+    }
+
     /// <summary>
     /// Function: InitIce
     /// </summary>
     public unsafe virtual void InitIce(BmSDK.BmGame.RPlayerController _RPC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.InitIce", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_RPC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitIceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.InitIce", true);
+        var parms = new InitIce_Params();
+        parms._RPC = _RPC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasBeenNeutralisedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasBeenNeutralised_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasBeenNeutralised
     /// </summary>
     public unsafe virtual bool HasBeenNeutralised()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.HasBeenNeutralised", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasBeenNeutralisedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.HasBeenNeutralised", true);
+        var parms = new HasBeenNeutralised_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_EjectBatmanFromFloorGratesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EjectBatmanFromFloorGrates_Params
+    {
     }
 
     /// <summary>
@@ -117,100 +143,160 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe virtual void EjectBatmanFromFloorGrates()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.EjectBatmanFromFloorGrates", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EjectBatmanFromFloorGratesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.EjectBatmanFromFloorGrates", true);
+        var parms = new EjectBatmanFromFloorGrates_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckHighBoxKnockBackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CheckHighBoxKnockBack_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckHighBoxKnockBack
     /// </summary>
     public unsafe virtual void CheckHighBoxKnockBack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.CheckHighBoxKnockBack", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckHighBoxKnockBackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.CheckHighBoxKnockBack", true);
+        var parms = new CheckHighBoxKnockBack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableFloorGratesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DisableFloorGrates_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisableFloorGrates
     /// </summary>
     public unsafe virtual void DisableFloorGrates()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.DisableFloorGrates", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableFloorGratesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.DisableFloorGrates", true);
+        var parms = new DisableFloorGrates_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOffMagneticSurfacesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TurnOffMagneticSurfaces_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOffMagneticSurfaces
     /// </summary>
     public unsafe virtual void TurnOffMagneticSurfaces()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.TurnOffMagneticSurfaces", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOffMagneticSurfacesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.TurnOffMagneticSurfaces", true);
+        var parms = new TurnOffMagneticSurfaces_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnOffInteractableItemsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TurnOffInteractableItems_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnOffInteractableItems
     /// </summary>
     public unsafe virtual void TurnOffInteractableItems()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.TurnOffInteractableItems", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnOffInteractableItemsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.TurnOffInteractableItems", true);
+        var parms = new TurnOffInteractableItems_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TurnAffectablesBackOffFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TurnAffectablesBackOff_Params
+    {
+    }
+
     /// <summary>
     /// Function: TurnAffectablesBackOff
     /// </summary>
     public unsafe virtual void TurnAffectablesBackOff()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.TurnAffectablesBackOff", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnAffectablesBackOffFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.TurnAffectablesBackOff", true);
+        var parms = new TurnAffectablesBackOff_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableRailChaserFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisableRailChaser_Params
+    {
+        [FieldOffset(0)] public int RailChaserIndex;
+    }
+
     /// <summary>
     /// Function: DisableRailChaser
     /// </summary>
     public unsafe virtual void DisableRailChaser(int RailChaserIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.DisableRailChaser", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RailChaserIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableRailChaserFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.DisableRailChaser", true);
+        var parms = new DisableRailChaser_Params();
+        parms.RailChaserIndex = RailChaserIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FireRailsTargetEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FireRailsTargetEvent_Params
+    {
+    }
+
     /// <summary>
     /// Function: FireRailsTargetEvent
     /// </summary>
     public unsafe virtual void FireRailsTargetEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.FireRailsTargetEvent", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FireRailsTargetEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.FireRailsTargetEvent", true);
+        var parms = new FireRailsTargetEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickRailFreezeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct TickRailFreeze_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TickRailFreeze
     /// </summary>
     public unsafe virtual bool TickRailFreeze(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.TickRailFreeze", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_TickRailFreezeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.TickRailFreeze", true);
+        var parms = new TickRailFreeze_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetWorldPositionForChainDistanceAndNodeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetWorldPositionForChainDistanceAndNode_Params
+    {
+        [FieldOffset(0)] public int node_index;
+        [FieldOffset(4)] public float chain_distance;
+        [FieldOffset(8)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -218,12 +304,20 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetWorldPositionForChainDistanceAndNode(int node_index, float chain_distance)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.GetWorldPositionForChainDistanceAndNode", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(node_index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(chain_distance, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 8);
+        var funcManaged = s_GetWorldPositionForChainDistanceAndNodeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.GetWorldPositionForChainDistanceAndNode", true);
+        var parms = new GetWorldPositionForChainDistanceAndNode_Params();
+        parms.node_index = node_index;
+        parms.chain_distance = chain_distance;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNodeIndexForChainDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetNodeIndexForChainDistance_Params
+    {
+        [FieldOffset(0)] public float chain_distance;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -231,11 +325,20 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe virtual int GetNodeIndexForChainDistance(float chain_distance)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.GetNodeIndexForChainDistance", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(chain_distance, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetNodeIndexForChainDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.GetNodeIndexForChainDistance", true);
+        var parms = new GetNodeIndexForChainDistance_Params();
+        parms.chain_distance = chain_distance;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SpawnSparklyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SpawnSparkly_Params
+    {
+        [FieldOffset(0)] public int sparkly_index;
+        [FieldOffset(4)] public nint Template;
+        [FieldOffset(8)] public System.Numerics.Vector3 SpawnLocation;
     }
 
     /// <summary>
@@ -243,84 +346,126 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe virtual void SpawnSparkly(int sparkly_index, BmSDK.Engine.ParticleSystem Template, System.Numerics.Vector3 SpawnLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.SpawnSparkly", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(sparkly_index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Template, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnLocation, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnSparklyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.SpawnSparkly", true);
+        var parms = new SpawnSparkly_Params();
+        parms.sparkly_index = sparkly_index;
+        parms.Template = Template?.Ptr ?? 0;
+        parms.SpawnLocation = SpawnLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseRailChasersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct InitialiseRailChasers_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitialiseRailChasers
     /// </summary>
     public unsafe virtual void InitialiseRailChasers()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.InitialiseRailChasers", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseRailChasersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.InitialiseRailChasers", true);
+        var parms = new InitialiseRailChasers_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddActorsMaterialToArrayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct AddActorsMaterialToArray_Params
+    {
+        [FieldOffset(0)] public nint new_actor;
+    }
+
     /// <summary>
     /// Function: AddActorsMaterialToArray
     /// </summary>
     public unsafe virtual void AddActorsMaterialToArray(BmSDK.BmScript.RFreezeDynamicSMIceFormation new_actor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.AddActorsMaterialToArray", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_actor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddActorsMaterialToArrayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.AddActorsMaterialToArray", true);
+        var parms = new AddActorsMaterialToArray_Params();
+        parms.new_actor = new_actor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FreezeRailsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct FreezeRails_Params
+    {
+    }
+
     /// <summary>
     /// Function: FreezeRails
     /// </summary>
     public unsafe virtual void FreezeRails()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.FreezeRails", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FreezeRailsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.FreezeRails", true);
+        var parms = new FreezeRails_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTimersOnAffectablesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct SetTimersOnAffectables_Params
+    {
+        [FieldOffset(0)] public float base_delay;
+        [FieldOffset(4)] public System.Numerics.Vector3 ImpactPoint;
+        [FieldOffset(16)] public float delay_range;
+    }
+
     /// <summary>
     /// Function: SetTimersOnAffectables
     /// </summary>
     public unsafe virtual void SetTimersOnAffectables(float base_delay, System.Numerics.Vector3 ImpactPoint, float delay_range)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.SetTimersOnAffectables", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(base_delay, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ImpactPoint, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(delay_range, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTimersOnAffectablesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.SetTimersOnAffectables", true);
+        var parms = new SetTimersOnAffectables_Params();
+        parms.base_delay = base_delay;
+        parms.ImpactPoint = ImpactPoint;
+        parms.delay_range = delay_range;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CleanUpFractureWallFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CleanUpFractureWall_Params
+    {
+    }
+
     /// <summary>
     /// Function: CleanUpFractureWall
     /// </summary>
     public unsafe virtual void CleanUpFractureWall()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.CleanUpFractureWall", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CleanUpFractureWallFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.CleanUpFractureWall", true);
+        var parms = new CleanUpFractureWall_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NeutraliseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct Neutralise_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ImpactPoint;
+        [FieldOffset(12)] public System.Numerics.Vector3 ImpactVector;
+    }
+
     /// <summary>
     /// Function: Neutralise
     /// </summary>
     public unsafe virtual void Neutralise(System.Numerics.Vector3 ImpactPoint, System.Numerics.Vector3 ImpactVector)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.Neutralise", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ImpactPoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ImpactVector, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NeutraliseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeEnvironmentTarget.Neutralise", true);
+        var parms = new Neutralise_Params();
+        parms.ImpactPoint = ImpactPoint;
+        parms.ImpactVector = ImpactVector;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -346,8 +491,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe bool bHasBeenNeutralised
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 428) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 428); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 428); }
+        get { return (*(int*)(Ptr + 428) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 428) |= 1; else *(int*)(Ptr + 428) &= ~1; }
     }
 
     /// <summary>
@@ -355,8 +500,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.BmScript.RFreezeEnvironmentTarget.FreezeEnvTargetType TargetType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RFreezeEnvironmentTarget.FreezeEnvTargetType>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(BmSDK.BmScript.RFreezeEnvironmentTarget.FreezeEnvTargetType*)(Ptr + 432); }
+        set { *(BmSDK.BmScript.RFreezeEnvironmentTarget.FreezeEnvTargetType*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -382,8 +527,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe int InitialNumWallFragments
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(int*)(Ptr + 444); }
+        set { *(int*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -409,8 +554,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe int show_int
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(int*)(Ptr + 472); }
+        set { *(int*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -418,8 +563,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe float AffectableBaseDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(float*)(Ptr + 476); }
+        set { *(float*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -427,8 +572,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe float AffectableDelayRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(float*)(Ptr + 480); }
+        set { *(float*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -436,8 +581,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe float WallDestructionDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(float*)(Ptr + 484); }
+        set { *(float*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -445,8 +590,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe float GrateEjectionDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(float*)(Ptr + 488); }
+        set { *(float*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -466,8 +611,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe float RailFreezeSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(float*)(Ptr + 516); }
+        set { *(float*)(Ptr + 516) = value; }
     }
 
     /// <summary>
@@ -475,8 +620,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe float RailFreezeDistanceCovered
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 520); }
+        get { return *(float*)(Ptr + 520); }
+        set { *(float*)(Ptr + 520) = value; }
     }
 
     /// <summary>
@@ -484,8 +629,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe float RailFreezeMaxDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(float*)(Ptr + 524); }
+        set { *(float*)(Ptr + 524) = value; }
     }
 
     /// <summary>
@@ -520,8 +665,8 @@ public partial class RFreezeEnvironmentTarget : BmSDK.Engine.Actor, BmSDK.IGameO
     /// </summary>
     public unsafe float RailChaserInitialChainDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(float*)(Ptr + 564); }
+        set { *(float*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -78,68 +78,108 @@ public partial class RFreezeLaserEffect : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RFreezeLaserEffect>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_TickLaserFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct TickLaser_Params
+    {
+        [FieldOffset(0)] public float deltaT;
+        [FieldOffset(4)] public System.Numerics.Vector3 SocketLocation;
+        [FieldOffset(16)] public BmSDK.Rotator SocketRotation;
+    }
+
     /// <summary>
     /// Function: TickLaser
     /// </summary>
     public unsafe virtual void TickLaser(float deltaT, System.Numerics.Vector3 SocketLocation, BmSDK.Rotator SocketRotation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.TickLaser", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(deltaT, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SocketLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SocketRotation, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickLaserFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.TickLaser", true);
+        var parms = new TickLaser_Params();
+        parms.deltaT = deltaT;
+        parms.SocketLocation = SocketLocation;
+        parms.SocketRotation = SocketRotation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckCollisionsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct CheckCollisions_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckCollisions
     /// </summary>
     public unsafe virtual void CheckCollisions()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.CheckCollisions", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckCollisionsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.CheckCollisions", true);
+        var parms = new CheckCollisions_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLaserLengthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetLaserLength_Params
+    {
+        [FieldOffset(0)] public float new_length;
+    }
+
     /// <summary>
     /// Function: SetLaserLength
     /// </summary>
     public unsafe virtual void SetLaserLength(float new_length)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.SetLaserLength", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_length, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLaserLengthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.SetLaserLength", true);
+        var parms = new SetLaserLength_Params();
+        parms.new_length = new_length;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetActive_Params
+    {
+        [FieldOffset(0)] public int is_active;
+    }
+
     /// <summary>
     /// Function: SetActive
     /// </summary>
     public unsafe virtual void SetActive(bool is_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.SetActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.SetActive", true);
+        var parms = new SetActive_Params();
+        parms.is_active = is_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct Initialise_Params
+    {
+        [FieldOffset(0)] public nint mr_freeze;
+        [FieldOffset(4)] public nint parent_mesh;
+        [FieldOffset(8)] public BmSDK.FName parent_socket;
+        [FieldOffset(16)] public float Proportion;
+        [FieldOffset(20)] public nint object_pool;
+    }
+
     /// <summary>
     /// Function: Initialise
     /// </summary>
     public unsafe virtual void Initialise(BmSDK.BmScript.RPawnVillainFreeze mr_freeze, BmSDK.Engine.SkeletalMeshComponent parent_mesh, BmSDK.FName parent_socket, float Proportion, BmSDK.BmGame.RObjectPool object_pool)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.Initialise", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(mr_freeze, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(parent_mesh, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(parent_socket, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Proportion, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(object_pool, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeLaserEffect.Initialise", true);
+        var parms = new Initialise_Params();
+        parms.mr_freeze = mr_freeze?.Ptr ?? 0;
+        parms.parent_mesh = parent_mesh?.Ptr ?? 0;
+        parms.parent_socket = parent_socket;
+        parms.Proportion = Proportion;
+        parms.object_pool = object_pool?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -166,8 +206,8 @@ public partial class RFreezeLaserEffect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1; else *(int*)(Ptr + 52) &= ~1; }
     }
 
     /// <summary>
@@ -193,8 +233,8 @@ public partial class RFreezeLaserEffect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName ParentSocket
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(BmSDK.FName*)(Ptr + 64); }
+        set { *(BmSDK.FName*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -202,8 +242,8 @@ public partial class RFreezeLaserEffect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DownwardsPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -211,8 +251,8 @@ public partial class RFreezeLaserEffect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float SweepTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -244,8 +284,8 @@ public partial class RFreezeLaserEffect : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float current_length
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 
     /// <summary>
@@ -78,62 +78,96 @@ public partial class RFreezePlaceableFootprint : BmSDK.Engine.Actor, BmSDK.IGame
         where TComponent : class, Framework.IScriptComponent<RFreezePlaceableFootprint>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetAlphaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetAlpha_Params
+    {
+        [FieldOffset(0)] public float new_alpha;
+    }
+
     /// <summary>
     /// Function: SetAlpha
     /// </summary>
     public unsafe virtual void SetAlpha(float new_alpha)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.SetAlpha", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_alpha, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAlphaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.SetAlpha", true);
+        var parms = new SetAlpha_Params();
+        parms.new_alpha = new_alpha;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FluoresceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Fluoresce_Params
+    {
+    }
+
     /// <summary>
     /// Function: Fluoresce
     /// </summary>
     public unsafe virtual void Fluoresce()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.Fluoresce", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FluoresceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.Fluoresce", true);
+        var parms = new Fluoresce_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveFromWorldFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveFromWorld_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveFromWorld
     /// </summary>
     public unsafe virtual void RemoveFromWorld()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.RemoveFromWorld", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveFromWorldFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.RemoveFromWorld", true);
+        var parms = new RemoveFromWorld_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFootprintFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct InitFootprint_Params
+    {
+        [FieldOffset(0)] public nint _BehaviourReference;
+        [FieldOffset(4)] public int _FootprintIndex;
+    }
+
     /// <summary>
     /// Function: InitFootprint
     /// </summary>
     public unsafe virtual void InitFootprint(BmSDK.BmScript.RBMBehaviour_Freeze _BehaviourReference, int _FootprintIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.InitFootprint", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_BehaviourReference, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(_FootprintIndex, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFootprintFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezePlaceableFootprint.InitFootprint", true);
+        var parms = new InitFootprint_Params();
+        parms._BehaviourReference = _BehaviourReference?.Ptr ?? 0;
+        parms._FootprintIndex = _FootprintIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -160,8 +194,8 @@ public partial class RFreezePlaceableFootprint : BmSDK.Engine.Actor, BmSDK.IGame
     /// </summary>
     public unsafe float fFluoresceTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -169,8 +203,8 @@ public partial class RFreezePlaceableFootprint : BmSDK.Engine.Actor, BmSDK.IGame
     /// </summary>
     public unsafe float fFluorescePeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(float*)(Ptr + 440); }
+        set { *(float*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -178,8 +212,8 @@ public partial class RFreezePlaceableFootprint : BmSDK.Engine.Actor, BmSDK.IGame
     /// </summary>
     public unsafe float fRefluoresceStun
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(float*)(Ptr + 444); }
+        set { *(float*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -205,8 +239,8 @@ public partial class RFreezePlaceableFootprint : BmSDK.Engine.Actor, BmSDK.IGame
     /// </summary>
     public unsafe int FootprintIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(int*)(Ptr + 456); }
+        set { *(int*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -214,7 +248,7 @@ public partial class RFreezePlaceableFootprint : BmSDK.Engine.Actor, BmSDK.IGame
     /// </summary>
     public unsafe bool HasBeenDestroyed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 460); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 460); }
+        get { return (*(int*)(Ptr + 460) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 460) |= 1; else *(int*)(Ptr + 460) &= ~1; }
     }
 }
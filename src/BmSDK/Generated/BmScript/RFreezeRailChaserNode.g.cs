@@ -83,8 +83,8 @@ public partial class RFreezeRailChaserNode : BmSDK.Engine.Actor, BmSDK.IGameObje
     /// </summary>
     public unsafe float DistanceFromEffectOrigin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class RFreezeRailChaserNode : BmSDK.Engine.Actor, BmSDK.IGameObje
     /// </summary>
     public unsafe float ChainDistanceFromZero
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 }
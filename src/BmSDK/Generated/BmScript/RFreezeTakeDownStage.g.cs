@@ -78,49 +78,87 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
         where TComponent : class, Framework.IScriptComponent<RFreezeTakeDownStage>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetSpeedNormalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetSpeedNormal_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetSpeedNormal
     /// </summary>
     public unsafe virtual void SetSpeedNormal()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.SetSpeedNormal", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSpeedNormalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.SetSpeedNormal", true);
+        var parms = new SetSpeedNormal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSpeedLowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetSpeedLow_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetSpeedLow
     /// </summary>
     public unsafe virtual void SetSpeedLow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.SetSpeedLow", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSpeedLowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.SetSpeedLow", true);
+        var parms = new SetSpeedLow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishAttackAttackerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinishAttackAttacker_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinishAttackAttacker
     /// </summary>
     public unsafe override void FinishAttackAttacker()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.FinishAttackAttacker", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishAttackAttackerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.FinishAttackAttacker", true);
+        var parms = new FinishAttackAttacker_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoesCameraMaintainLosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DoesCameraMaintainLos_Params
+    {
+        [FieldOffset(0)] public nint CinematicCamera;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: DoesCameraMaintainLos
     /// </summary>
     public unsafe virtual bool DoesCameraMaintainLos(BmSDK.BmGame.RInGameCinematicCam CinematicCamera)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.DoesCameraMaintainLos", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CinematicCamera, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_DoesCameraMaintainLosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.DoesCameraMaintainLos", true);
+        var parms = new DoesCameraMaintainLos_Params();
+        parms.CinematicCamera = CinematicCamera?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanCameraSeePointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct CanCameraSeePoint_Params
+    {
+        [FieldOffset(0)] public nint CinematicCamera;
+        [FieldOffset(4)] public float CameraTimeNormalised;
+        [FieldOffset(8)] public System.Numerics.Vector3 CameraCheckTarget;
+        [FieldOffset(20)] public nint IgnoreThisActor;
+        [FieldOffset(24)] public nint IgnoreThisActorToo;
+        [FieldOffset(28)] public int ReturnValue;
     }
 
     /// <summary>
@@ -128,15 +166,23 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe virtual bool CanCameraSeePoint(BmSDK.BmGame.RInGameCinematicCam CinematicCamera, float CameraTimeNormalised, System.Numerics.Vector3 CameraCheckTarget, BmSDK.Engine.Actor IgnoreThisActor, BmSDK.Engine.Actor IgnoreThisActorToo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.CanCameraSeePoint", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CinematicCamera, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CameraTimeNormalised, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CameraCheckTarget, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IgnoreThisActor, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IgnoreThisActorToo, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_CanCameraSeePointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.CanCameraSeePoint", true);
+        var parms = new CanCameraSeePoint_Params();
+        parms.CinematicCamera = CinematicCamera?.Ptr ?? 0;
+        parms.CameraTimeNormalised = CameraTimeNormalised;
+        parms.CameraCheckTarget = CameraCheckTarget;
+        parms.IgnoreThisActor = IgnoreThisActor?.Ptr ?? 0;
+        parms.IgnoreThisActorToo = IgnoreThisActorToo?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetCameraTargetBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetCameraTargetBatman_Params
+    {
+        [FieldOffset(0)] public int CheckEyes;
+        [FieldOffset(4)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -144,11 +190,19 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetCameraTargetBatman(bool CheckEyes)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.GetCameraTargetBatman", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckEyes, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_GetCameraTargetBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.GetCameraTargetBatman", true);
+        var parms = new GetCameraTargetBatman_Params();
+        parms.CheckEyes = CheckEyes ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetCameraTargetFreezeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetCameraTargetFreeze_Params
+    {
+        [FieldOffset(0)] public int CheckEyes;
+        [FieldOffset(4)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -156,11 +210,23 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetCameraTargetFreeze(bool CheckEyes)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.GetCameraTargetFreeze", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckEyes, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_GetCameraTargetFreezeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.GetCameraTargetFreeze", true);
+        var parms = new GetCameraTargetFreeze_Params();
+        parms.CheckEyes = CheckEyes ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_PlayCameraAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct PlayCameraAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName AnimName;
+        [FieldOffset(8)] public nint TheAnimSet;
+        [FieldOffset(12)] public int bCamMirrored;
+        [FieldOffset(16)] public float FOV;
+        [FieldOffset(20)] public int bHardCut;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -168,15 +234,21 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe virtual bool PlayCameraAnim(BmSDK.FName AnimName, BmSDK.Engine.AnimSet TheAnimSet, bool bCamMirrored, float FOV = default, bool bHardCut = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.PlayCameraAnim", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheAnimSet, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCamMirrored, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FOV, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHardCut, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_PlayCameraAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.PlayCameraAnim", true);
+        var parms = new PlayCameraAnim_Params();
+        parms.AnimName = AnimName;
+        parms.TheAnimSet = TheAnimSet?.Ptr ?? 0;
+        parms.bCamMirrored = bCamMirrored ? 1 : 0;
+        parms.FOV = FOV;
+        parms.bHardCut = bHardCut ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BackToPlayerCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BackToPlayerCamera_Params
+    {
     }
 
     /// <summary>
@@ -184,55 +256,94 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe virtual void BackToPlayerCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.BackToPlayerCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BackToPlayerCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.BackToPlayerCamera", true);
+        var parms = new BackToPlayerCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CameraCutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CameraCut_Params
+    {
+    }
+
     /// <summary>
     /// Function: CameraCut
     /// </summary>
     public unsafe virtual void CameraCut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.CameraCut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CameraCutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.CameraCut", true);
+        var parms = new CameraCut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartCamera
     /// </summary>
     public unsafe virtual void StartCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.StartCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.StartCamera", true);
+        var parms = new StartCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayCameraPhaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayCameraPhase_Params
+    {
+        [FieldOffset(0)] public int Index;
+    }
+
     /// <summary>
     /// Function: PlayCameraPhase
     /// </summary>
     public unsafe virtual void PlayCameraPhase(int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.PlayCameraPhase", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayCameraPhaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.PlayCameraPhase", true);
+        var parms = new PlayCameraPhase_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldUseCustomCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldUseCustomCamera_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldUseCustomCamera
     /// </summary>
     public unsafe virtual bool ShouldUseCustomCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.ShouldUseCustomCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldUseCustomCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.ShouldUseCustomCamera", true);
+        var parms = new ShouldUseCustomCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlaySpecialCameraAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct PlaySpecialCameraAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName AnimName;
+        [FieldOffset(8)] public int bCamMirrored;
+        [FieldOffset(12)] public int CameraCollision;
+        [FieldOffset(16)] public float FOV;
+        [FieldOffset(20)] public nint CustomAnimSet;
+        [FieldOffset(24)] public float BlendTime;
+        [FieldOffset(28)] public int ReturnValue;
     }
 
     /// <summary>
@@ -240,16 +351,22 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe override bool PlaySpecialCameraAnim(BmSDK.FName AnimName, bool bCamMirrored, bool CameraCollision = default, float FOV = default, BmSDK.Engine.AnimSet CustomAnimSet = default, float BlendTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.PlaySpecialCameraAnim", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCamMirrored, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CameraCollision, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FOV, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CustomAnimSet, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendTime, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_PlaySpecialCameraAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.PlaySpecialCameraAnim", true);
+        var parms = new PlaySpecialCameraAnim_Params();
+        parms.AnimName = AnimName;
+        parms.bCamMirrored = bCamMirrored ? 1 : 0;
+        parms.CameraCollision = CameraCollision ? 1 : 0;
+        parms.FOV = FOV;
+        parms.CustomAnimSet = CustomAnimSet?.Ptr ?? 0;
+        parms.BlendTime = BlendTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayCameraAutoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayCameraAuto_Params
+    {
     }
 
     /// <summary>
@@ -257,21 +374,34 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe virtual void PlayCameraAuto()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.PlayCameraAuto", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayCameraAutoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.PlayCameraAuto", true);
+        var parms = new PlayCameraAuto_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldForceSafeCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldForceSafeCamera_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldForceSafeCamera
     /// </summary>
     public unsafe virtual bool ShouldForceSafeCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.ShouldForceSafeCamera", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldForceSafeCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.ShouldForceSafeCamera", true);
+        var parms = new ShouldForceSafeCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BeginFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct Begin_Params
+    {
     }
 
     /// <summary>
@@ -279,9 +409,9 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe override void Begin()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.Begin", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BeginFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RFreezeTakeDownStage.Begin", true);
+        var parms = new Begin_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -290,8 +420,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe bool SlaveToVictim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1032); }
+        get { return (*(int*)(Ptr + 1032) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1032) |= 1; else *(int*)(Ptr + 1032) &= ~1; }
     }
 
     /// <summary>
@@ -299,8 +429,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe bool FreezeCanBeTranslated
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1032); }
+        get { return (*(int*)(Ptr + 1032) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1032) |= 2; else *(int*)(Ptr + 1032) &= ~2; }
     }
 
     /// <summary>
@@ -308,8 +438,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe bool RestoredPlayerCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1032); }
+        get { return (*(int*)(Ptr + 1032) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 1032) |= 4; else *(int*)(Ptr + 1032) &= ~4; }
     }
 
     /// <summary>
@@ -317,8 +447,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe bool bCutToFirstCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1032); }
+        get { return (*(int*)(Ptr + 1032) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 1032) |= 8; else *(int*)(Ptr + 1032) &= ~8; }
     }
 
     /// <summary>
@@ -326,8 +456,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe bool bSkipCameraCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1032); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1032); }
+        get { return (*(int*)(Ptr + 1032) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 1032) |= 16; else *(int*)(Ptr + 1032) &= ~16; }
     }
 
     /// <summary>
@@ -335,8 +465,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe float GameSpeedWhenSlowedDown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1036); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1036); }
+        get { return *(float*)(Ptr + 1036); }
+        set { *(float*)(Ptr + 1036) = value; }
     }
 
     /// <summary>
@@ -344,8 +474,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe float TransitionPeriodToSlowMotion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1040); }
+        get { return *(float*)(Ptr + 1040); }
+        set { *(float*)(Ptr + 1040) = value; }
     }
 
     /// <summary>
@@ -353,8 +483,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe float MaxTimeToRemainSlow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1044); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1044); }
+        get { return *(float*)(Ptr + 1044); }
+        set { *(float*)(Ptr + 1044) = value; }
     }
 
     /// <summary>
@@ -362,8 +492,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe float EarlyOutProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1048); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1048); }
+        get { return *(float*)(Ptr + 1048); }
+        set { *(float*)(Ptr + 1048) = value; }
     }
 
     /// <summary>
@@ -371,8 +501,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe float EarlyOutTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1052); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1052); }
+        get { return *(float*)(Ptr + 1052); }
+        set { *(float*)(Ptr + 1052) = value; }
     }
 
     /// <summary>
@@ -407,8 +537,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe int CameraPhase
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1076); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1076); }
+        get { return *(int*)(Ptr + 1076); }
+        set { *(int*)(Ptr + 1076) = value; }
     }
 
     /// <summary>
@@ -416,8 +546,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe BmSDK.FName BackupCameraAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 1080); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1080); }
+        get { return *(BmSDK.FName*)(Ptr + 1080); }
+        set { *(BmSDK.FName*)(Ptr + 1080) = value; }
     }
 
     /// <summary>
@@ -425,8 +555,8 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe float fCheckCameraCollisionFromProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1088); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1088); }
+        get { return *(float*)(Ptr + 1088); }
+        set { *(float*)(Ptr + 1088) = value; }
     }
 
     /// <summary>
@@ -434,7 +564,7 @@ public partial class RFreezeTakeDownStage : BmSDK.BmGame.RStealthTakeDownStage,
     /// </summary>
     public unsafe float fCheckCameraCollisionToProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1092); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1092); }
+        get { return *(float*)(Ptr + 1092); }
+        set { *(float*)(Ptr + 1092) = value; }
     }
 }
@@ -78,25 +78,38 @@ public partial class RGFxMovieCustom_DeathMovie : BmSDK.BmGame.RGFxMovieCustom,
         where TComponent : class, Framework.IScriptComponent<RGFxMovieCustom_DeathMovie>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HideDeathHintFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HideDeathHint_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideDeathHint
     /// </summary>
     public unsafe virtual void HideDeathHint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieCustom_DeathMovie.HideDeathHint", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideDeathHintFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieCustom_DeathMovie.HideDeathHint", true);
+        var parms = new HideDeathHint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetDeathHintFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetDeathHint_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetDeathHint
     /// </summary>
     public unsafe virtual BmSDK.FString GetDeathHint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieCustom_DeathMovie.GetDeathHint", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetDeathHintFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieCustom_DeathMovie.GetDeathHint", true);
+        var parms = new GetDeathHint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 }
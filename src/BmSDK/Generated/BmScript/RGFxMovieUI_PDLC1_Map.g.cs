@@ -78,28 +78,51 @@ public partial class RGFxMovieUI_PDLC1_Map : BmSDK.BmGame.RGFxMovieUI_CustomBack
         where TComponent : class, Framework.IScriptComponent<RGFxMovieUI_PDLC1_Map>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetStickAngMagFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetStickAngMag_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetBasePath;
+    }
+
     /// <summary>
     /// Function: GetStickAngMag
     /// </summary>
     public unsafe virtual void GetStickAngMag(BmSDK.FString TargetBasePath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.GetStickAngMag", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBasePath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GetStickAngMagFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.GetStickAngMag", true);
+        var parms = new GetStickAngMag_Params();
+        parms.TargetBasePath = TargetBasePath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetCameraRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetCameraRotation_Params
+    {
+        [FieldOffset(0)] public int Axis;
+        [FieldOffset(4)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCameraRotation
     /// </summary>
     public unsafe virtual float GetCameraRotation(int Axis)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.GetCameraRotation", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Axis, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetCameraRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.GetCameraRotation", true);
+        var parms = new GetCameraRotation_Params();
+        parms.Axis = Axis;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPlayerRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetPlayerRotation_Params
+    {
+        [FieldOffset(0)] public int Axis;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -107,11 +130,18 @@ public partial class RGFxMovieUI_PDLC1_Map : BmSDK.BmGame.RGFxMovieUI_CustomBack
     /// </summary>
     public unsafe virtual float GetPlayerRotation(int Axis)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.GetPlayerRotation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Axis, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetPlayerRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.GetPlayerRotation", true);
+        var parms = new GetPlayerRotation_Params();
+        parms.Axis = Axis;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPlayerRoomDescriptionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetPlayerRoomDescription_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -119,10 +149,23 @@ public partial class RGFxMovieUI_PDLC1_Map : BmSDK.BmGame.RGFxMovieUI_CustomBack
     /// </summary>
     public unsafe virtual BmSDK.FString GetPlayerRoomDescription()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.GetPlayerRoomDescription", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetPlayerRoomDescriptionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.GetPlayerRoomDescription", true);
+        var parms = new GetPlayerRoomDescription_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetCustomWaypointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct SetCustomWaypoint_Params
+    {
+        [FieldOffset(0)] public int bEnabled;
+        [FieldOffset(4)] public float atX;
+        [FieldOffset(8)] public float atY;
+        [FieldOffset(12)] public float atZ;
+        [FieldOffset(16)] public BmSDK.FString WayPointName;
+        [FieldOffset(28)] public BmSDK.FString WayPointTypeName;
+        [FieldOffset(40)] public BmSDK.FString WayPointSubTypeName;
     }
 
     /// <summary>
@@ -130,100 +173,149 @@ public partial class RGFxMovieUI_PDLC1_Map : BmSDK.BmGame.RGFxMovieUI_CustomBack
     /// </summary>
     public unsafe virtual void SetCustomWaypoint(bool bEnabled, float atX, float atY, float atZ, BmSDK.FString WayPointName, BmSDK.FString WayPointTypeName, BmSDK.FString WayPointSubTypeName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.SetCustomWaypoint", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnabled, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(atX, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(atY, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(atZ, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WayPointName, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WayPointTypeName, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WayPointSubTypeName, paramsPtr + 40);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCustomWaypointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.SetCustomWaypoint", true);
+        var parms = new SetCustomWaypoint_Params();
+        parms.bEnabled = bEnabled ? 1 : 0;
+        parms.atX = atX;
+        parms.atY = atY;
+        parms.atZ = atZ;
+        parms.WayPointName = WayPointName;
+        parms.WayPointTypeName = WayPointTypeName;
+        parms.WayPointSubTypeName = WayPointSubTypeName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveMapObjFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RemoveMapObj_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ItemName;
+    }
+
     /// <summary>
     /// Function: RemoveMapObj
     /// </summary>
     public unsafe virtual void RemoveMapObj(BmSDK.FString ItemName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RemoveMapObj", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ItemName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveMapObjFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RemoveMapObj", true);
+        var parms = new RemoveMapObj_Params();
+        parms.ItemName = ItemName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestPMapIconDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 144)]
+    private struct RequestPMapIconData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString MapName;
+        [FieldOffset(12)] public BmSDK.FString TargetBasePath;
+    }
+
     /// <summary>
     /// Function: RequestPMapIconData
     /// </summary>
     public unsafe virtual void RequestPMapIconData(BmSDK.FString MapName, BmSDK.FString TargetBasePath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RequestPMapIconData", true);
-        byte* paramsPtr = stackalloc byte[144];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MapName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBasePath, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestPMapIconDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RequestPMapIconData", true);
+        var parms = new RequestPMapIconData_Params();
+        parms.MapName = MapName;
+        parms.TargetBasePath = TargetBasePath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestMapFlagDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct RequestMapFlagData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetBasePath;
+    }
+
     /// <summary>
     /// Function: RequestMapFlagData
     /// </summary>
     public unsafe virtual void RequestMapFlagData(BmSDK.FString TargetBasePath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RequestMapFlagData", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBasePath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestMapFlagDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RequestMapFlagData", true);
+        var parms = new RequestMapFlagData_Params();
+        parms.TargetBasePath = TargetBasePath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestMapDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct RequestMapData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetBasePath;
+    }
+
     /// <summary>
     /// Function: RequestMapData
     /// </summary>
     public unsafe virtual void RequestMapData(BmSDK.FString TargetBasePath)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RequestMapData", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetBasePath, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestMapDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RequestMapData", true);
+        var parms = new RequestMapData_Params();
+        parms.TargetBasePath = TargetBasePath;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RequestObjectiveDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct RequestObjectiveData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TargetObjectiveNames;
+    }
+
     /// <summary>
     /// Function: RequestObjectiveData
     /// </summary>
     public unsafe virtual void RequestObjectiveData(BmSDK.FString TargetObjectiveNames)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RequestObjectiveData", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetObjectiveNames, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RequestObjectiveDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.RequestObjectiveData", true);
+        var parms = new RequestObjectiveData_Params();
+        parms.TargetObjectiveNames = TargetObjectiveNames;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_XI_FlashCallsCloseScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct XI_FlashCallsCloseScreen_Params
+    {
+    }
+
     /// <summary>
     /// Function: XI_FlashCallsCloseScreen
     /// </summary>
     public unsafe virtual void XI_FlashCallsCloseScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.XI_FlashCallsCloseScreen", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_XI_FlashCallsCloseScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.XI_FlashCallsCloseScreen", true);
+        var parms = new XI_FlashCallsCloseScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Init_Params
+    {
+        [FieldOffset(0)] public nint LocPlay;
+    }
+
     /// <summary>
     /// Function: Init
     /// </summary>
     public unsafe override void Init(BmSDK.Engine.LocalPlayer LocPlay = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.Init", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RGFxMovieUI_PDLC1_Map.Init", true);
+        var parms = new Init_Params();
+        parms.LocPlay = LocPlay?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -232,8 +324,8 @@ public partial class RGFxMovieUI_PDLC1_Map : BmSDK.BmGame.RGFxMovieUI_CustomBack
     /// </summary>
     public unsafe bool bMovedUserMarker
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 660) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 660); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 660); }
+        get { return (*(int*)(Ptr + 660) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 660) |= 1; else *(int*)(Ptr + 660) &= ~1; }
     }
 
     /// <summary>
@@ -78,15 +78,22 @@ public partial class RHangingAnimatedRope : BmSDK.BmGame.RSkeletalMeshActor, BmS
         where TComponent : class, Framework.IScriptComponent<RHangingAnimatedRope>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PlayAnimationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayAnimation_Params
+    {
+        [FieldOffset(0)] public int AnimationNo;
+    }
+
     /// <summary>
     /// Function: PlayAnimation
     /// </summary>
     public unsafe virtual void PlayAnimation(int AnimationNo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RHangingAnimatedRope.PlayAnimation", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimationNo, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayAnimationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RHangingAnimatedRope.PlayAnimation", true);
+        var parms = new PlayAnimation_Params();
+        parms.AnimationNo = AnimationNo;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -104,7 +111,7 @@ public partial class RHangingAnimatedRope : BmSDK.BmGame.RSkeletalMeshActor, BmS
     /// </summary>
     public unsafe int AnimationPlaying
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(int*)(Ptr + 540); }
+        set { *(int*)(Ptr + 540) = value; }
     }
 }
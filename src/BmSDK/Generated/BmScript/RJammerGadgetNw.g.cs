@@ -78,15 +78,28 @@ public partial class RJammerGadgetNw : BmSDK.BmScript.RJammerGadgetBm, BmSDK.IGa
         where TComponent : class, Framework.IScriptComponent<RJammerGadgetNw>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetGadgetClassNameForHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetGadgetClassNameForHUD_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetGadgetClassNameForHUD
     /// </summary>
     public unsafe override BmSDK.FName GetGadgetClassNameForHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RJammerGadgetNw.GetGadgetClassNameForHUD", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
+        var funcManaged = s_GetGadgetClassNameForHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RJammerGadgetNw.GetGadgetClassNameForHUD", true);
+        var parms = new GetGadgetClassNameForHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CheckUpgradesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckUpgrades_Params
+    {
     }
 
     /// <summary>
@@ -94,9 +107,9 @@ public partial class RJammerGadgetNw : BmSDK.BmScript.RJammerGadgetBm, BmSDK.IGa
     /// </summary>
     public unsafe override void CheckUpgrades()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RJammerGadgetNw.CheckUpgrades", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckUpgradesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RJammerGadgetNw.CheckUpgrades", true);
+        var parms = new CheckUpgrades_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -78,48 +78,81 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
         where TComponent : class, Framework.IScriptComponent<RMagneticDoor>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_DoorClosedNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoorClosedNotify_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoorClosedNotify
     /// </summary>
     public unsafe virtual void DoorClosedNotify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.DoorClosedNotify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoorClosedNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.DoorClosedNotify", true);
+        var parms = new DoorClosedNotify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoorOpenNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoorOpenNotify_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoorOpenNotify
     /// </summary>
     public unsafe virtual void DoorOpenNotify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.DoorOpenNotify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoorOpenNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.DoorOpenNotify", true);
+        var parms = new DoorOpenNotify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MakePlayerJumpOutOfTheWayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 260)]
+    private struct MakePlayerJumpOutOfTheWay_Params
+    {
+    }
+
     /// <summary>
     /// Function: MakePlayerJumpOutOfTheWay
     /// </summary>
     public unsafe virtual void MakePlayerJumpOutOfTheWay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.MakePlayerJumpOutOfTheWay", true);
-        byte* paramsPtr = stackalloc byte[260];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MakePlayerJumpOutOfTheWayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.MakePlayerJumpOutOfTheWay", true);
+        var parms = new MakePlayerJumpOutOfTheWay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanRECAutoTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanRECAutoTarget_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanRECAutoTarget
     /// </summary>
     public unsafe override bool CanRECAutoTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.CanRECAutoTarget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanRECAutoTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.CanRECAutoTarget", true);
+        var parms = new CanRECAutoTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetActorThoughtsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct GetActorThoughts_Params
+    {
+        [FieldOffset(12)] public System.Numerics.Vector3 ThoughtLocationOverride;
+        [FieldOffset(24)] public BmSDK.FString IndentString;
     }
 
     /// <summary>
@@ -127,55 +160,91 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe override void GetActorThoughts(out BmSDK.TArray<BmSDK.Engine.Actor.FThought> ThoughtList, out System.Numerics.Vector3 ThoughtLocationOverride, BmSDK.FString IndentString = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.GetActorThoughts", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IndentString, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>(paramsPtr + 0);
-        ThoughtLocationOverride = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetActorThoughtsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.GetActorThoughts", true);
+        var parms = new GetActorThoughts_Params();
+        parms.IndentString = IndentString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ThoughtList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor.FThought>>((byte*)&parms + 0);
+        ThoughtLocationOverride = parms.ThoughtLocationOverride;
         return;
     }
 
+    static BmSDK.Function s_RECChargeTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RECChargeTimer_Params
+    {
+    }
+
     /// <summary>
     /// Function: RECChargeTimer
     /// </summary>
     public unsafe virtual void RECChargeTimer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.RECChargeTimer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RECChargeTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.RECChargeTimer", true);
+        var parms = new RECChargeTimer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnAnimEndFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OnAnimEnd_Params
+    {
+        [FieldOffset(0)] public nint SeqNode;
+        [FieldOffset(4)] public float PlayedTime;
+        [FieldOffset(8)] public float ExcessTime;
+    }
+
     /// <summary>
     /// Function: OnAnimEnd
     /// </summary>
     public unsafe override void OnAnimEnd(BmSDK.Engine.AnimNodeSequence SeqNode, float PlayedTime, float ExcessTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.OnAnimEnd", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SeqNode, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayedTime, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ExcessTime, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnAnimEndFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.OnAnimEnd", true);
+        var parms = new OnAnimEnd_Params();
+        parms.SeqNode = SeqNode?.Ptr ?? 0;
+        parms.PlayedTime = PlayedTime;
+        parms.ExcessTime = ExcessTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMagnetStrengthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct SetMagnetStrength_Params
+    {
+        [FieldOffset(0)] public nint REC;
+        [FieldOffset(4)] public float MagStr;
+        [FieldOffset(8)] public System.Numerics.Vector3 MagPos;
+        [FieldOffset(20)] public float DeltaTime;
+        [FieldOffset(24)] public int bInitialImpulse;
+        [FieldOffset(28)] public nint Surface;
+        [FieldOffset(32)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: SetMagnetStrength
     /// </summary>
     public unsafe override float SetMagnetStrength(BmSDK.BmGame.RMagneticBlastReceiver REC, float MagStr, System.Numerics.Vector3 MagPos, float DeltaTime, bool bInitialImpulse, BmSDK.BmGame.RMagneticSurfaceSMBase Surface)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.SetMagnetStrength", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(REC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MagStr, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MagPos, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInitialImpulse, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Surface, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 32);
+        var funcManaged = s_SetMagnetStrengthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.SetMagnetStrength", true);
+        var parms = new SetMagnetStrength_Params();
+        parms.REC = REC?.Ptr ?? 0;
+        parms.MagStr = MagStr;
+        parms.MagPos = MagPos;
+        parms.DeltaTime = DeltaTime;
+        parms.bInitialImpulse = bInitialImpulse ? 1 : 0;
+        parms.Surface = Surface?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ReCloseDoorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ReCloseDoor_Params
+    {
+        [FieldOffset(0)] public nint OtherComp;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -183,11 +252,19 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe virtual bool ReCloseDoor(BmSDK.Engine.PrimitiveComponent OtherComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.ReCloseDoor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_ReCloseDoorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.ReCloseDoor", true);
+        var parms = new ReCloseDoor_Params();
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ReOpenDoorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ReOpenDoor_Params
+    {
+        [FieldOffset(0)] public nint OtherComp;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -195,11 +272,19 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe virtual bool ReOpenDoor(BmSDK.Engine.PrimitiveComponent OtherComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.ReOpenDoor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_ReOpenDoorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.ReOpenDoor", true);
+        var parms = new ReOpenDoor_Params();
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OpenDoorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OpenDoor_Params
+    {
+        [FieldOffset(0)] public int bInstantOpen;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -207,11 +292,19 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe virtual bool OpenDoor(bool bInstantOpen = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.OpenDoor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantOpen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_OpenDoorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.OpenDoor", true);
+        var parms = new OpenDoor_Params();
+        parms.bInstantOpen = bInstantOpen ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CloseDoorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CloseDoor_Params
+    {
+        [FieldOffset(0)] public int bInstantOpen;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -219,11 +312,20 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe virtual bool CloseDoor(bool bInstantOpen = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.CloseDoor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantOpen, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CloseDoorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.CloseDoor", true);
+        var parms = new CloseDoor_Params();
+        parms.bInstantOpen = bInstantOpen ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetEffectiveMagStrFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetEffectiveMagStr_Params
+    {
+        [FieldOffset(0)] public float MagStr;
+        [FieldOffset(4)] public System.Numerics.Vector3 SourceLocation;
+        [FieldOffset(16)] public float ReturnValue;
     }
 
     /// <summary>
@@ -231,12 +333,20 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe virtual float GetEffectiveMagStr(float MagStr, System.Numerics.Vector3 SourceLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.GetEffectiveMagStr", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MagStr, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SourceLocation, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 16);
+        var funcManaged = s_GetEffectiveMagStrFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.GetEffectiveMagStr", true);
+        var parms = new GetEffectiveMagStr_Params();
+        parms.MagStr = MagStr;
+        parms.SourceLocation = SourceLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsValidTargetCompFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsValidTargetComp_Params
+    {
+        [FieldOffset(0)] public nint TargetComp;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -244,11 +354,18 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe override bool IsValidTargetComp(BmSDK.Engine.PrimitiveComponent TargetComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.IsValidTargetComp", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetComp, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsValidTargetCompFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.IsValidTargetComp", true);
+        var parms = new IsValidTargetComp_Params();
+        parms.TargetComp = TargetComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -256,33 +373,52 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckBmSideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckBmSide_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckBmSide
     /// </summary>
     public unsafe virtual void CheckBmSide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.CheckBmSide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckBmSideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.CheckBmSide", true);
+        var parms = new CheckBmSide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsPlayingLoopsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsPlayingLoops_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsPlayingLoops
     /// </summary>
     public unsafe virtual bool IsPlayingLoops()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.IsPlayingLoops", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsPlayingLoopsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.IsPlayingLoops", true);
+        var parms = new IsPlayingLoops_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayMotorClosedLoopFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayMotorClosedLoop_Params
+    {
     }
 
     /// <summary>
@@ -290,90 +426,143 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe virtual void PlayMotorClosedLoop()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorClosedLoop", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayMotorClosedLoopFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorClosedLoop", true);
+        var parms = new PlayMotorClosedLoop_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayMotorOpenLoopFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayMotorOpenLoop_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayMotorOpenLoop
     /// </summary>
     public unsafe virtual void PlayMotorOpenLoop()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorOpenLoop", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayMotorOpenLoopFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorOpenLoop", true);
+        var parms = new PlayMotorOpenLoop_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopMotorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopMotor_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopMotor
     /// </summary>
     public unsafe virtual void StopMotor()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.StopMotor", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopMotorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.StopMotor", true);
+        var parms = new StopMotor_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayMotorCloseReactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayMotorCloseReact_Params
+    {
+        [FieldOffset(0)] public nint OtherComp;
+    }
+
     /// <summary>
     /// Function: PlayMotorCloseReact
     /// </summary>
     public unsafe virtual void PlayMotorCloseReact(BmSDK.Engine.PrimitiveComponent OtherComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorCloseReact", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayMotorCloseReactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorCloseReact", true);
+        var parms = new PlayMotorCloseReact_Params();
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayMotorOpenReactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayMotorOpenReact_Params
+    {
+        [FieldOffset(0)] public nint OtherComp;
+    }
+
     /// <summary>
     /// Function: PlayMotorOpenReact
     /// </summary>
     public unsafe virtual void PlayMotorOpenReact(BmSDK.Engine.PrimitiveComponent OtherComp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorOpenReact", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayMotorOpenReactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorOpenReact", true);
+        var parms = new PlayMotorOpenReact_Params();
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayMotorCloseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayMotorClose_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayMotorClose
     /// </summary>
     public unsafe virtual void PlayMotorClose()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorClose", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayMotorCloseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorClose", true);
+        var parms = new PlayMotorClose_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayMotorOpenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayMotorOpen_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayMotorOpen
     /// </summary>
     public unsafe virtual void PlayMotorOpen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorOpen", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayMotorOpenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PlayMotorOpen", true);
+        var parms = new PlayMotorOpen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetAutoTargetLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetAutoTargetLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 PlayerPosition;
+        [FieldOffset(12)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAutoTargetLocation
     /// </summary>
     public unsafe override System.Numerics.Vector3 GetAutoTargetLocation(System.Numerics.Vector3 PlayerPosition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.GetAutoTargetLocation", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPosition, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetAutoTargetLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.GetAutoTargetLocation", true);
+        var parms = new GetAutoTargetLocation_Params();
+        parms.PlayerPosition = PlayerPosition;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateAnimationsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateAnimations_Params
+    {
+        [FieldOffset(0)] public int bUsingGenerator;
     }
 
     /// <summary>
@@ -381,37 +570,54 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe virtual void UpdateAnimations(bool bUsingGenerator)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.UpdateAnimations", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUsingGenerator, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateAnimationsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.UpdateAnimations", true);
+        var parms = new UpdateAnimations_Params();
+        parms.bUsingGenerator = bUsingGenerator ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitByRECFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct HitByREC_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitLoc;
+        [FieldOffset(12)] public nint OtherComp;
+        [FieldOffset(16)] public BmSDK.BmGame.RMagneticBlast.MBImpulseType ImpulseType;
+        [FieldOffset(20)] public nint RECProjectile;
+        [FieldOffset(24)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HitByREC
     /// </summary>
     public unsafe override bool HitByREC(System.Numerics.Vector3 HitLoc, BmSDK.Engine.PrimitiveComponent OtherComp, BmSDK.BmGame.RMagneticBlast.MBImpulseType ImpulseType, BmSDK.BmGame.RMagneticBlastReceiver RECProjectile)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.HitByREC", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ImpulseType, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RECProjectile, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_HitByRECFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RMagneticDoor.HitByREC", true);
+        var parms = new HitByREC_Params();
+        parms.HitLoc = HitLoc;
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        parms.ImpulseType = ImpulseType;
+        parms.RECProjectile = RECProjectile?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -445,8 +651,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenRepelAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(BmSDK.FName*)(Ptr + 532); }
+        set { *(BmSDK.FName*)(Ptr + 532) = value; }
     }
 
     /// <summary>
@@ -454,8 +660,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenAttractAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(BmSDK.FName*)(Ptr + 540); }
+        set { *(BmSDK.FName*)(Ptr + 540) = value; }
     }
 
     /// <summary>
@@ -463,8 +669,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName LockedOpenRepelAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(BmSDK.FName*)(Ptr + 548); }
+        set { *(BmSDK.FName*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -472,8 +678,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName LockedOpenAttractAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(BmSDK.FName*)(Ptr + 556); }
+        set { *(BmSDK.FName*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -481,8 +687,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName ClosedRepelAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(BmSDK.FName*)(Ptr + 564); }
+        set { *(BmSDK.FName*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -490,8 +696,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName ClosedAttractAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 572); }
+        get { return *(BmSDK.FName*)(Ptr + 572); }
+        set { *(BmSDK.FName*)(Ptr + 572) = value; }
     }
 
     /// <summary>
@@ -499,8 +705,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName LockedClosedRepelAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 580); }
+        get { return *(BmSDK.FName*)(Ptr + 580); }
+        set { *(BmSDK.FName*)(Ptr + 580) = value; }
     }
 
     /// <summary>
@@ -508,8 +714,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName LockedClosedAttractAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 588); }
+        get { return *(BmSDK.FName*)(Ptr + 588); }
+        set { *(BmSDK.FName*)(Ptr + 588) = value; }
     }
 
     /// <summary>
@@ -517,8 +723,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenStruggleAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 596); }
+        get { return *(BmSDK.FName*)(Ptr + 596); }
+        set { *(BmSDK.FName*)(Ptr + 596) = value; }
     }
 
     /// <summary>
@@ -526,8 +732,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName ClosedStruggleAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 604); }
+        get { return *(BmSDK.FName*)(Ptr + 604); }
+        set { *(BmSDK.FName*)(Ptr + 604) = value; }
     }
 
     /// <summary>
@@ -535,8 +741,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bLocked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 1; else *(int*)(Ptr + 612) &= ~1; }
     }
 
     /// <summary>
@@ -544,8 +750,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bDisabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 2; else *(int*)(Ptr + 612) &= ~2; }
     }
 
     /// <summary>
@@ -553,8 +759,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bInitiallyOpen
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 4; else *(int*)(Ptr + 612) &= ~4; }
     }
 
     /// <summary>
@@ -562,8 +768,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bOpen
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 8; else *(int*)(Ptr + 612) &= ~8; }
     }
 
     /// <summary>
@@ -571,8 +777,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bAutoClose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 16; else *(int*)(Ptr + 612) &= ~16; }
     }
 
     /// <summary>
@@ -580,8 +786,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bOnlyReactsToGenerator
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 32; else *(int*)(Ptr + 612) &= ~32; }
     }
 
     /// <summary>
@@ -589,8 +795,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bRECSuspendAutoClose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 64; else *(int*)(Ptr + 612) &= ~64; }
     }
 
     /// <summary>
@@ -598,8 +804,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bMotorRunning
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 128; else *(int*)(Ptr + 612) &= ~128; }
     }
 
     /// <summary>
@@ -607,8 +813,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bOnlyOpen128
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 256; else *(int*)(Ptr + 612) &= ~256; }
     }
 
     /// <summary>
@@ -616,8 +822,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bAlwaysOpenCompletely
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 512; else *(int*)(Ptr + 612) &= ~512; }
     }
 
     /// <summary>
@@ -625,8 +831,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bDebugDrawFXLocation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 1024; else *(int*)(Ptr + 612) &= ~1024; }
     }
 
     /// <summary>
@@ -634,8 +840,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe bool bInstantOpenClose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 612); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 612); }
+        get { return (*(int*)(Ptr + 612) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 612) |= 2048; else *(int*)(Ptr + 612) &= ~2048; }
     }
 
     /// <summary>
@@ -643,8 +849,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 616); }
+        get { return *(BmSDK.FName*)(Ptr + 616); }
+        set { *(BmSDK.FName*)(Ptr + 616) = value; }
     }
 
     /// <summary>
@@ -652,8 +858,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName CloseAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 624); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 624); }
+        get { return *(BmSDK.FName*)(Ptr + 624); }
+        set { *(BmSDK.FName*)(Ptr + 624) = value; }
     }
 
     /// <summary>
@@ -661,8 +867,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenedAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 632); }
+        get { return *(BmSDK.FName*)(Ptr + 632); }
+        set { *(BmSDK.FName*)(Ptr + 632) = value; }
     }
 
     /// <summary>
@@ -670,8 +876,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName ClosedAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 640); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 640); }
+        get { return *(BmSDK.FName*)(Ptr + 640); }
+        set { *(BmSDK.FName*)(Ptr + 640) = value; }
     }
 
     /// <summary>
@@ -679,8 +885,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenedLoopAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 648); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 648); }
+        get { return *(BmSDK.FName*)(Ptr + 648); }
+        set { *(BmSDK.FName*)(Ptr + 648) = value; }
     }
 
     /// <summary>
@@ -688,8 +894,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName ClosedReactAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 656); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 656); }
+        get { return *(BmSDK.FName*)(Ptr + 656); }
+        set { *(BmSDK.FName*)(Ptr + 656) = value; }
     }
 
     /// <summary>
@@ -697,8 +903,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe float AutoCloseDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 664); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 664); }
+        get { return *(float*)(Ptr + 664); }
+        set { *(float*)(Ptr + 664) = value; }
     }
 
     /// <summary>
@@ -712,8 +918,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.BmScript.RMagneticDoor.EAttractAxis DoorAttractAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RMagneticDoor.EAttractAxis>(Ptr + 680); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 680); }
+        get { return *(BmSDK.BmScript.RMagneticDoor.EAttractAxis*)(Ptr + 680); }
+        set { *(BmSDK.BmScript.RMagneticDoor.EAttractAxis*)(Ptr + 680) = value; }
     }
 
     /// <summary>
@@ -721,8 +927,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.BmScript.RMagneticDoor.EShutterDoorState DoorState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RMagneticDoor.EShutterDoorState>(Ptr + 681); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 681); }
+        get { return *(BmSDK.BmScript.RMagneticDoor.EShutterDoorState*)(Ptr + 681); }
+        set { *(BmSDK.BmScript.RMagneticDoor.EShutterDoorState*)(Ptr + 681) = value; }
     }
 
     /// <summary>
@@ -748,8 +954,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenFullAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 692); }
+        get { return *(BmSDK.FName*)(Ptr + 692); }
+        set { *(BmSDK.FName*)(Ptr + 692) = value; }
     }
 
     /// <summary>
@@ -757,8 +963,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName Open128Animation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 700); }
+        get { return *(BmSDK.FName*)(Ptr + 700); }
+        set { *(BmSDK.FName*)(Ptr + 700) = value; }
     }
 
     /// <summary>
@@ -766,8 +972,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName CloseFullAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 708); }
+        get { return *(BmSDK.FName*)(Ptr + 708); }
+        set { *(BmSDK.FName*)(Ptr + 708) = value; }
     }
 
     /// <summary>
@@ -775,8 +981,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName Close128Animation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 716); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 716); }
+        get { return *(BmSDK.FName*)(Ptr + 716); }
+        set { *(BmSDK.FName*)(Ptr + 716) = value; }
     }
 
     /// <summary>
@@ -784,8 +990,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenedLoopFullAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 724); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 724); }
+        get { return *(BmSDK.FName*)(Ptr + 724); }
+        set { *(BmSDK.FName*)(Ptr + 724) = value; }
     }
 
     /// <summary>
@@ -793,8 +999,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenedLoop128Animation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 732); }
+        get { return *(BmSDK.FName*)(Ptr + 732); }
+        set { *(BmSDK.FName*)(Ptr + 732) = value; }
     }
 
     /// <summary>
@@ -802,8 +1008,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenedStruggle128Animation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 740); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 740); }
+        get { return *(BmSDK.FName*)(Ptr + 740); }
+        set { *(BmSDK.FName*)(Ptr + 740) = value; }
     }
 
     /// <summary>
@@ -811,8 +1017,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe BmSDK.FName OpenedStruggleFullAnimation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 748); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 748); }
+        get { return *(BmSDK.FName*)(Ptr + 748); }
+        set { *(BmSDK.FName*)(Ptr + 748) = value; }
     }
 
     /// <summary>
@@ -838,8 +1044,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe float MotorOpenAnimDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 764); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 764); }
+        get { return *(float*)(Ptr + 764); }
+        set { *(float*)(Ptr + 764) = value; }
     }
 
     /// <summary>
@@ -847,8 +1053,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe float MotorCloseAnimDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 768); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 768); }
+        get { return *(float*)(Ptr + 768); }
+        set { *(float*)(Ptr + 768) = value; }
     }
 
     /// <summary>
@@ -892,8 +1098,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe float MotorGlow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 796); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 796); }
+        get { return *(float*)(Ptr + 796); }
+        set { *(float*)(Ptr + 796) = value; }
     }
 
     /// <summary>
@@ -901,8 +1107,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe float MotorGlowTarget
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 800); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 800); }
+        get { return *(float*)(Ptr + 800); }
+        set { *(float*)(Ptr + 800) = value; }
     }
 
     /// <summary>
@@ -910,8 +1116,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe float MotorMaterialOpenSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 804); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 804); }
+        get { return *(float*)(Ptr + 804); }
+        set { *(float*)(Ptr + 804) = value; }
     }
 
     /// <summary>
@@ -919,8 +1125,8 @@ public partial class RMagneticDoor : BmSDK.BmGame.RMagneticDynamicObjectSkeletal
     /// </summary>
     public unsafe float MotorMaterialCloseSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 808); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 808); }
+        get { return *(float*)(Ptr + 808); }
+        set { *(float*)(Ptr + 808) = value; }
     }
 
     /// <summary>
@@ -78,16 +78,24 @@ public partial class RNightwingSticksBounceCamera : BmSDK.BmGame.RBatarangCamera
         where TComponent : class, Framework.IScriptComponent<RNightwingSticksBounceCamera>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetTrackingPositionAndRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetTrackingPositionAndRotation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Out_Position;
+        [FieldOffset(12)] public BmSDK.Rotator out_Rotation;
+    }
+
     /// <summary>
     /// Function: GetTrackingPositionAndRotation
     /// </summary>
     public unsafe override void GetTrackingPositionAndRotation(out System.Numerics.Vector3 Out_Position, out BmSDK.Rotator out_Rotation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RNightwingSticksBounceCamera.GetTrackingPositionAndRotation", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Out_Position = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        out_Rotation = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 12);
+        var funcManaged = s_GetTrackingPositionAndRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RNightwingSticksBounceCamera.GetTrackingPositionAndRotation", true);
+        var parms = new GetTrackingPositionAndRotation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Out_Position = parms.Out_Position;
+        out_Rotation = parms.out_Rotation;
         return;
     }
 
@@ -96,8 +104,8 @@ public partial class RNightwingSticksBounceCamera : BmSDK.BmGame.RBatarangCamera
     /// </summary>
     public unsafe int NumUpdates
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1372); }
+        get { return *(int*)(Ptr + 1372); }
+        set { *(int*)(Ptr + 1372) = value; }
     }
 
     /// <summary>
@@ -78,18 +78,33 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         where TComponent : class, Framework.IScriptComponent<RPawnBossClayface>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CreateBasicWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8464)]
+    private struct CreateBasicWeaponConfig_Params
+    {
+        [FieldOffset(0)] public nint NewOwner;
+        [FieldOffset(16)] public nint TurnAnimSet;
+        [FieldOffset(20)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateBasicWeaponConfig
     /// </summary>
     public unsafe override BmSDK.BmGame.RWeaponConfig CreateBasicWeaponConfig(BmSDK.GameObject NewOwner, BmSDK.TArray<BmSDK.Engine.AnimSet> AnimSets, BmSDK.Engine.AnimSet TurnAnimSet = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CreateBasicWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[8464];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewOwner, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimSets, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TurnAnimSet, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWeaponConfig>(paramsPtr + 20);
+        var funcManaged = s_CreateBasicWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CreateBasicWeaponConfig", true);
+        var parms = new CreateBasicWeaponConfig_Params();
+        parms.NewOwner = NewOwner?.Ptr ?? 0;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimSets, (byte*)&parms + 4);
+        parms.TurnAnimSet = TurnAnimSet?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWeaponConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_StartHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartHUD_Params
+    {
     }
 
     /// <summary>
@@ -97,21 +112,35 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void StartHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.StartHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.StartHUD", true);
+        var parms = new StartHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetStabbedFrozenValFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetStabbedFrozenVal_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetStabbedFrozenVal
     /// </summary>
     public unsafe virtual float GetStabbedFrozenVal()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetStabbedFrozenVal", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetStabbedFrozenValFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetStabbedFrozenVal", true);
+        var parms = new GetStabbedFrozenVal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateHudFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateHud_Params
+    {
+        [FieldOffset(0)] public float TimeDelta;
     }
 
     /// <summary>
@@ -119,46 +148,73 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void UpdateHud(float TimeDelta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateHud", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeDelta, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateHudFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateHud", true);
+        var parms = new UpdateHud_Params();
+        parms.TimeDelta = TimeDelta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KeepInViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct KeepInView_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+        [FieldOffset(4)] public float MaxYaw;
+    }
+
     /// <summary>
     /// Function: KeepInView
     /// </summary>
     public unsafe virtual void KeepInView(BmSDK.Engine.Actor Pawn, float MaxYaw = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.KeepInView", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxYaw, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KeepInViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.KeepInView", true);
+        var parms = new KeepInView_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        parms.MaxYaw = MaxYaw;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateKeepInViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct UpdateKeepInViewTarget_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateKeepInViewTarget
     /// </summary>
     public unsafe virtual void UpdateKeepInViewTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateKeepInViewTarget", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateKeepInViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateKeepInViewTarget", true);
+        var parms = new UpdateKeepInViewTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceMaxCameraRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForceMaxCameraRange_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ForceMaxCameraRange
     /// </summary>
     public unsafe virtual bool ForceMaxCameraRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ForceMaxCameraRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ForceMaxCameraRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ForceMaxCameraRange", true);
+        var parms = new ForceMaxCameraRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_EnableKeepInViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableKeepInView_Params
+    {
     }
 
     /// <summary>
@@ -166,21 +222,36 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void EnableKeepInView()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.EnableKeepInView", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableKeepInViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.EnableKeepInView", true);
+        var parms = new EnableKeepInView_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InputRightStickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct InputRightStick_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: InputRightStick
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 InputRightStick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.InputRightStick", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_InputRightStickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.InputRightStick", true);
+        var parms = new InputRightStick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_AllowCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AllowCamera_Params
+    {
+        [FieldOffset(0)] public nint SpecialMove;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -188,11 +259,19 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool AllowCamera(BmSDK.BmGame.RSpecialMoveConfig SpecialMove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.AllowCamera", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpecialMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_AllowCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.AllowCamera", true);
+        var parms = new AllowCamera_Params();
+        parms.SpecialMove = SpecialMove?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetPrompt_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -200,11 +279,19 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual BmSDK.FString GetPrompt(BmSDK.Engine.PlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetPrompt", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_GetPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetPrompt", true);
+        var parms = new GetPrompt_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsActive_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -212,11 +299,18 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool IsActive(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsActive", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsActive", true);
+        var parms = new IsActive_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsCounterButtonFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsCounterButton_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -224,10 +318,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool IsCounterButton()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsCounterButton", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsCounterButtonFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsCounterButton", true);
+        var parms = new IsCounterButton_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsButtonPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsButtonPrompt_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -235,10 +336,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool IsButtonPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsButtonPrompt", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsButtonPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsButtonPrompt", true);
+        var parms = new IsButtonPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_EitherButtonAllowedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EitherButtonAllowed_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -246,10 +354,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool EitherButtonAllowed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.EitherButtonAllowed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_EitherButtonAllowedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.EitherButtonAllowed", true);
+        var parms = new EitherButtonAllowed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InteractFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Interact_Params
+    {
+        [FieldOffset(0)] public nint PC;
     }
 
     /// <summary>
@@ -257,33 +372,53 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void Interact(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.Interact", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InteractFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.Interact", true);
+        var parms = new Interact_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForHitBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckForHitBatman_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckForHitBatman
     /// </summary>
     public unsafe virtual void CheckForHitBatman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckForHitBatman", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckForHitBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckForHitBatman", true);
+        var parms = new CheckForHitBatman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UsesAttackButtonFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UsesAttackButton_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: UsesAttackButton
     /// </summary>
     public unsafe virtual bool UsesAttackButton()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UsesAttackButton", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_UsesAttackButtonFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UsesAttackButton", true);
+        var parms = new UsesAttackButton_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetLocationOffsetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetLocationOffset_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -291,10 +426,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetLocationOffset()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetLocationOffset", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetLocationOffsetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetLocationOffset", true);
+        var parms = new GetLocationOffset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetPriority_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -302,10 +444,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual float GetPriority()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetPriority", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetPriority", true);
+        var parms = new GetPriority_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetFOVDegreesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetFOVDegrees_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -313,10 +462,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual float GetFOVDegrees()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetFOVDegrees", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetFOVDegreesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetFOVDegrees", true);
+        var parms = new GetFOVDegrees_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_MustBeCrouchedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MustBeCrouched_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -324,10 +480,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool MustBeCrouched()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.MustBeCrouched", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_MustBeCrouchedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.MustBeCrouched", true);
+        var parms = new MustBeCrouched_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanUseInCinematicModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanUseInCinematicMode_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -335,10 +498,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool CanUseInCinematicMode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanUseInCinematicMode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUseInCinematicModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanUseInCinematicMode", true);
+        var parms = new CanUseInCinematicMode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetUpperPromptFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetUpperPrompt_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -346,10 +516,18 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual BmSDK.FString GetUpperPrompt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetUpperPrompt", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetUpperPromptFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetUpperPrompt", true);
+        var parms = new GetUpperPrompt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanReachItemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanReachItem_Params
+    {
+        [FieldOffset(0)] public nint CheckingPawn;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -357,11 +535,19 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool CanReachItem(BmSDK.Engine.Pawn CheckingPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanReachItem", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckingPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanReachItemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanReachItem", true);
+        var parms = new CanReachItem_Params();
+        parms.CheckingPawn = CheckingPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OverridesRunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OverridesRun_Params
+    {
+        [FieldOffset(0)] public nint PC;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -369,11 +555,18 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual float OverridesRun(BmSDK.BmGame.RPlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.OverridesRun", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_OverridesRunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.OverridesRun", true);
+        var parms = new OverridesRun_Params();
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetHeightRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetHeightRange_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -381,10 +574,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual float GetHeightRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetHeightRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetHeightRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetHeightRange", true);
+        var parms = new GetHeightRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetRange_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -392,10 +592,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual float GetRange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetRange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetRangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetRange", true);
+        var parms = new GetRange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_AllowAttackerTrackingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AllowAttackerTracking_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -403,10 +610,16 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool AllowAttackerTracking()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.AllowAttackerTracking", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AllowAttackerTrackingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.AllowAttackerTracking", true);
+        var parms = new AllowAttackerTracking_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HitByCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HitByCounter_Params
+    {
     }
 
     /// <summary>
@@ -414,22 +627,37 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void HitByCounter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.HitByCounter", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.HitByCounter", true);
+        var parms = new HitByCounter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DamagedByFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 245)]
+    private struct DamagedBy_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo;
+        [FieldOffset(244)] public BmSDK.BmGame.RPawnCombat.DamageResult ReturnValue;
+    }
+
     /// <summary>
     /// Function: DamagedBy
     /// </summary>
     public unsafe override BmSDK.BmGame.RPawnCombat.DamageResult DamagedBy(BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.DamagedBy", true);
-        byte* paramsPtr = stackalloc byte[245];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DmgInfo, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnCombat.DamageResult>(paramsPtr + 244);
+        var funcManaged = s_DamagedByFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.DamagedBy", true);
+        var parms = new DamagedBy_Params();
+        parms.DmgInfo = DmgInfo;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanRedirectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanRedirect_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -437,10 +665,16 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool CanRedirect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanRedirect", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanRedirectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanRedirect", true);
+        var parms = new CanRedirect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ResetCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetCam_Params
+    {
     }
 
     /// <summary>
@@ -448,32 +682,53 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void ResetCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ResetCam", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ResetCam", true);
+        var parms = new ResetCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActOnIceGrenadeHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActOnIceGrenadeHit_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActOnIceGrenadeHit
     /// </summary>
     public unsafe virtual void ActOnIceGrenadeHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ActOnIceGrenadeHit", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActOnIceGrenadeHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ActOnIceGrenadeHit", true);
+        var parms = new ActOnIceGrenadeHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitByGelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HitByGel_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HitByGel
     /// </summary>
     public unsafe virtual bool HitByGel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.HitByGel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HitByGelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.HitByGel", true);
+        var parms = new HitByGel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HitByFreezeGrenadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HitByFreezeGrenade_Params
+    {
+        [FieldOffset(0)] public int bPlayEffect;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -481,11 +736,19 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool HitByFreezeGrenade(out int bPlayEffect)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.HitByFreezeGrenade", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        bPlayEffect = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_HitByFreezeGrenadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.HitByFreezeGrenade", true);
+        var parms = new HitByFreezeGrenade_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        bPlayEffect = parms.bPlayEffect;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BombExplodeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct BombExplode_Params
+    {
+        [FieldOffset(0)] public nint Bomb;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -493,11 +756,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool BombExplode(BmSDK.BmScript.RClayfaceBomb Bomb)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BombExplode", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bomb, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_BombExplodeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BombExplode", true);
+        var parms = new BombExplode_Params();
+        parms.Bomb = Bomb?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SliceClayfaceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SliceClayface_Params
+    {
     }
 
     /// <summary>
@@ -505,21 +774,37 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void SliceClayface()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.SliceClayface", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SliceClayfaceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.SliceClayface", true);
+        var parms = new SliceClayface_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetFreezeSprayTargetLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetFreezeSprayTargetLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetFreezeSprayTargetLocation
     /// </summary>
     public unsafe override System.Numerics.Vector3 GetFreezeSprayTargetLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetFreezeSprayTargetLocation", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetFreezeSprayTargetLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GetFreezeSprayTargetLocation", true);
+        var parms = new GetFreezeSprayTargetLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsAwareOfPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsAwareOfPlayer_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public nint dmgType;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -527,12 +812,19 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool IsAwareOfPlayer(BmSDK.BmGame.RPawnPlayer PlayerPawn, BmSDK.Class dmgType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsAwareOfPlayer", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_IsAwareOfPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsAwareOfPlayer", true);
+        var parms = new IsAwareOfPlayer_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BossCanTakeGooHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BossCanTakeGooHit_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -540,10 +832,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool BossCanTakeGooHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BossCanTakeGooHit", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_BossCanTakeGooHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BossCanTakeGooHit", true);
+        var parms = new BossCanTakeGooHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanBeGlideKickedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanBeGlideKicked_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -551,10 +850,18 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool CanBeGlideKicked()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanBeGlideKicked", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanBeGlideKickedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanBeGlideKicked", true);
+        var parms = new CanBeGlideKicked_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsVulnerableToTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct IsVulnerableToTakedown_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString takedown;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -562,11 +869,18 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool IsVulnerableToTakedown(BmSDK.FString takedown)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsVulnerableToTakedown", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(takedown, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsVulnerableToTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsVulnerableToTakedown", true);
+        var parms = new IsVulnerableToTakedown_Params();
+        parms.takedown = takedown;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsBossFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsBoss_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -574,10 +888,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool IsBoss()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsBoss", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsBossFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsBoss", true);
+        var parms = new IsBoss_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IgnoreOffscreenCheckForOverrideGadgetTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IgnoreOffscreenCheckForOverrideGadgetTarget_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -585,10 +906,16 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override bool IgnoreOffscreenCheckForOverrideGadgetTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IgnoreOffscreenCheckForOverrideGadgetTarget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IgnoreOffscreenCheckForOverrideGadgetTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IgnoreOffscreenCheckForOverrideGadgetTarget", true);
+        var parms = new IgnoreOffscreenCheckForOverrideGadgetTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RemoveCounterIconFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveCounterIcon_Params
+    {
     }
 
     /// <summary>
@@ -596,102 +923,168 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override void RemoveCounterIcon()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.RemoveCounterIcon", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveCounterIconFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.RemoveCounterIcon", true);
+        var parms = new RemoveCounterIcon_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LaughLongFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LaughLong_Params
+    {
+    }
+
     /// <summary>
     /// Function: LaughLong
     /// </summary>
     public unsafe virtual void LaughLong()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.LaughLong", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LaughLongFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.LaughLong", true);
+        var parms = new LaughLong_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LaughShortFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LaughShort_Params
+    {
+    }
+
     /// <summary>
     /// Function: LaughShort
     /// </summary>
     public unsafe virtual void LaughShort()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.LaughShort", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LaughShortFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.LaughShort", true);
+        var parms = new LaughShort_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopAttackingFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StopAttackingFX_Params
+    {
+        [FieldOffset(0)] public int bSuccessfulCounter;
+    }
+
     /// <summary>
     /// Function: StopAttackingFX
     /// </summary>
     public unsafe override void StopAttackingFX(bool bSuccessfulCounter = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.StopAttackingFX", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSuccessfulCounter, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopAttackingFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.StopAttackingFX", true);
+        var parms = new StopAttackingFX_Params();
+        parms.bSuccessfulCounter = bSuccessfulCounter ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EndOfCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EndOfCounter_Params
+    {
+    }
+
     /// <summary>
     /// Function: EndOfCounter
     /// </summary>
     public unsafe virtual void EndOfCounter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.EndOfCounter", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EndOfCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.EndOfCounter", true);
+        var parms = new EndOfCounter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartAttackingFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StartAttackingFX_Params
+    {
+        [FieldOffset(0)] public int CTypeInt;
+        [FieldOffset(4)] public nint PC;
+    }
+
     /// <summary>
     /// Function: StartAttackingFX
     /// </summary>
     public unsafe override void StartAttackingFX(int CTypeInt, BmSDK.BmGame.RPlayerController PC = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.StartAttackingFX", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CTypeInt, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartAttackingFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.StartAttackingFX", true);
+        var parms = new StartAttackingFX_Params();
+        parms.CTypeInt = CTypeInt;
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetHealth_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetHealth
     /// </summary>
     public unsafe override void SetHealth()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.SetHealth", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.SetHealth", true);
+        var parms = new SetHealth_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckBossCounterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CheckBossCounter_Params
+    {
+        [FieldOffset(0)] public nint targ;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckBossCounter
     /// </summary>
     public unsafe override bool CheckBossCounter(BmSDK.BmGame.RPawnVillain targ)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckBossCounter", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(targ, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CheckBossCounterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckBossCounter", true);
+        var parms = new CheckBossCounter_Params();
+        parms.targ = targ?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlaySound_ImpactAIFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct PlaySound_ImpactAI_Params
+    {
+        [FieldOffset(0)] public int bIsStrike;
+        [FieldOffset(4)] public int bFinishingBlow;
+        [FieldOffset(8)] public int bIsHeadImpact;
+        [FieldOffset(12)] public int bIsPunch;
+        [FieldOffset(16)] public int bIsStrong;
+        [FieldOffset(20)] public int bIsBlocked;
+        [FieldOffset(24)] public int bCanEmote;
     }
 
     /// <summary>
@@ -699,76 +1092,118 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe override void PlaySound_ImpactAI(bool bIsStrike, bool bFinishingBlow, bool bIsHeadImpact, bool bIsPunch, bool bIsStrong, bool bIsBlocked, bool bCanEmote = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.PlaySound_ImpactAI", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsStrike, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFinishingBlow, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsHeadImpact, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsPunch, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsStrong, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsBlocked, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCanEmote, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlaySound_ImpactAIFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.PlaySound_ImpactAI", true);
+        var parms = new PlaySound_ImpactAI_Params();
+        parms.bIsStrike = bIsStrike ? 1 : 0;
+        parms.bFinishingBlow = bFinishingBlow ? 1 : 0;
+        parms.bIsHeadImpact = bIsHeadImpact ? 1 : 0;
+        parms.bIsPunch = bIsPunch ? 1 : 0;
+        parms.bIsStrong = bIsStrong ? 1 : 0;
+        parms.bIsBlocked = bIsBlocked ? 1 : 0;
+        parms.bCanEmote = bCanEmote ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckFallingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckFalling_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: CheckFalling
     /// </summary>
     public unsafe override void CheckFalling(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckFalling", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckFallingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckFalling", true);
+        var parms = new CheckFalling_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateDripsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct UpdateDrips_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateDrips
     /// </summary>
     public unsafe virtual void UpdateDrips(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateDrips", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateDripsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateDrips", true);
+        var parms = new UpdateDrips_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateBoneHistoryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct UpdateBoneHistory_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateBoneHistory
     /// </summary>
     public unsafe virtual void UpdateBoneHistory(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateBoneHistory", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateBoneHistoryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateBoneHistory", true);
+        var parms = new UpdateBoneHistory_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateBMClayValFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateBMClayVal_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateBMClayVal
     /// </summary>
     public unsafe virtual void UpdateBMClayVal(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateBMClayVal", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateBMClayValFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateBMClayVal", true);
+        var parms = new UpdateBMClayVal_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsEvadingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsEvading_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsEvading
     /// </summary>
     public unsafe virtual bool IsEvading()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsEvading", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsEvadingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.IsEvading", true);
+        var parms = new IsEvading_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanDoCloseRangeAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanDoCloseRangeAttack_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -776,10 +1211,16 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual bool CanDoCloseRangeAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanDoCloseRangeAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanDoCloseRangeAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CanDoCloseRangeAttack", true);
+        var parms = new CanDoCloseRangeAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ForceSelectFreezeSprayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ForceSelectFreezeSpray_Params
+    {
     }
 
     /// <summary>
@@ -787,21 +1228,34 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void ForceSelectFreezeSpray()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ForceSelectFreezeSpray", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceSelectFreezeSprayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ForceSelectFreezeSpray", true);
+        var parms = new ForceSelectFreezeSpray_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldShowGadgetHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldShowGadgetHUD_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldShowGadgetHUD
     /// </summary>
     public unsafe override bool ShouldShowGadgetHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ShouldShowGadgetHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldShowGadgetHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ShouldShowGadgetHUD", true);
+        var parms = new ShouldShowGadgetHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckforCloseRangeAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckforCloseRangeAttack_Params
+    {
     }
 
     /// <summary>
@@ -809,34 +1263,58 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void CheckforCloseRangeAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckforCloseRangeAttack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckforCloseRangeAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckforCloseRangeAttack", true);
+        var parms = new CheckforCloseRangeAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInXrayModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetInXrayMode_Params
+    {
+        [FieldOffset(0)] public int show;
+        [FieldOffset(4)] public int bForceOff;
+    }
+
     /// <summary>
     /// Function: SetInXrayMode
     /// </summary>
     public unsafe override void SetInXrayMode(bool show, bool bForceOff)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.SetInXrayMode", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(show, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceOff, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInXrayModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.SetInXrayMode", true);
+        var parms = new SetInXrayMode_Params();
+        parms.show = show ? 1 : 0;
+        parms.bForceOff = bForceOff ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PutXrayIntoForgroundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PutXrayIntoForground_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PutXrayIntoForground
     /// </summary>
     public unsafe override bool PutXrayIntoForground()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.PutXrayIntoForground", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_PutXrayIntoForgroundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.PutXrayIntoForground", true);
+        var parms = new PutXrayIntoForground_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ChangeXrayMatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ChangeXrayMat_Params
+    {
+        [FieldOffset(0)] public nint ChangeMesh;
+        [FieldOffset(4)] public int bXray;
+        [FieldOffset(8)] public nint XrayMatToUse;
     }
 
     /// <summary>
@@ -844,104 +1322,156 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe virtual void ChangeXrayMat(BmSDK.Engine.SkeletalMeshComponent ChangeMesh, bool bXray, BmSDK.Engine.MaterialInterface XrayMatToUse)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ChangeXrayMat", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChangeMesh, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bXray, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XrayMatToUse, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeXrayMatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.ChangeXrayMat", true);
+        var parms = new ChangeXrayMat_Params();
+        parms.ChangeMesh = ChangeMesh?.Ptr ?? 0;
+        parms.bXray = bXray ? 1 : 0;
+        parms.XrayMatToUse = XrayMatToUse?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetAudioPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetAudioPoint_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetAudioPoint
     /// </summary>
     public unsafe virtual void SetAudioPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.SetAudioPoint", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAudioPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.SetAudioPoint", true);
+        var parms = new SetAudioPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BeginBmFall2Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BeginBmFall2_Params
+    {
+    }
+
     /// <summary>
     /// Function: BeginBmFall2
     /// </summary>
     public unsafe virtual void BeginBmFall2()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BeginBmFall2", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BeginBmFall2Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BeginBmFall2", true);
+        var parms = new BeginBmFall2_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BeginBmFallFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BeginBmFall_Params
+    {
+    }
+
     /// <summary>
     /// Function: BeginBmFall
     /// </summary>
     public unsafe virtual void BeginBmFall()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BeginBmFall", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BeginBmFallFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BeginBmFall", true);
+        var parms = new BeginBmFall_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForBallHitMineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CheckForBallHitMine_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckForBallHitMine
     /// </summary>
     public unsafe virtual void CheckForBallHitMine()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckForBallHitMine", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckForBallHitMineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.CheckForBallHitMine", true);
+        var parms = new CheckForBallHitMine_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFrozenPartAudioFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateFrozenPartAudio_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateFrozenPartAudio
     /// </summary>
     public unsafe virtual void UpdateFrozenPartAudio(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateFrozenPartAudio", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateFrozenPartAudioFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.UpdateFrozenPartAudio", true);
+        var parms = new UpdateFrozenPartAudio_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GenericUpdatesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GenericUpdates_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: GenericUpdates
     /// </summary>
     public unsafe virtual void GenericUpdates(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GenericUpdates", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GenericUpdatesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.GenericUpdates", true);
+        var parms = new GenericUpdates_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanBumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BatmanBump_Params
+    {
+        [FieldOffset(0)] public nint BumpActor;
+    }
+
     /// <summary>
     /// Function: BatmanBump
     /// </summary>
     public unsafe virtual void BatmanBump(BmSDK.Engine.Actor BumpActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BatmanBump", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BumpActor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanBumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.BatmanBump", true);
+        var parms = new BatmanBump_Params();
+        parms.BumpActor = BumpActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossClayface.Tick", true);
+        var parms = new Tick_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -950,8 +1480,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int DifficultyLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3596); }
+        get { return *(int*)(Ptr + 3596); }
+        set { *(int*)(Ptr + 3596) = value; }
     }
 
     /// <summary>
@@ -959,8 +1489,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bGrabbedSword
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 1; else *(int*)(Ptr + 3600) &= ~1; }
     }
 
     /// <summary>
@@ -968,8 +1498,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bDontInit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 2; else *(int*)(Ptr + 3600) &= ~2; }
     }
 
     /// <summary>
@@ -977,8 +1507,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHasRaged
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 4; else *(int*)(Ptr + 3600) &= ~4; }
     }
 
     /// <summary>
@@ -986,8 +1516,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bSuspendKeepInView
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 8; else *(int*)(Ptr + 3600) &= ~8; }
     }
 
     /// <summary>
@@ -995,8 +1525,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHasSetFreezeSpray
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 16; else *(int*)(Ptr + 3600) &= ~16; }
     }
 
     /// <summary>
@@ -1004,8 +1534,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHelpedPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 32; else *(int*)(Ptr + 3600) &= ~32; }
     }
 
     /// <summary>
@@ -1013,8 +1543,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bRepeatLastAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 64; else *(int*)(Ptr + 3600) &= ~64; }
     }
 
     /// <summary>
@@ -1022,8 +1552,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bBombTicking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 128; else *(int*)(Ptr + 3600) &= ~128; }
     }
 
     /// <summary>
@@ -1031,8 +1561,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bBombInDoubleTime
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 256; else *(int*)(Ptr + 3600) &= ~256; }
     }
 
     /// <summary>
@@ -1040,8 +1570,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bBombUpdated
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 512; else *(int*)(Ptr + 3600) &= ~512; }
     }
 
     /// <summary>
@@ -1049,8 +1579,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bDripsAllowed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 1024; else *(int*)(Ptr + 3600) &= ~1024; }
     }
 
     /// <summary>
@@ -1058,8 +1588,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bMorphingBalls
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 2048; else *(int*)(Ptr + 3600) &= ~2048; }
     }
 
     /// <summary>
@@ -1067,8 +1597,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHighFirst
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 4096; else *(int*)(Ptr + 3600) &= ~4096; }
     }
 
     /// <summary>
@@ -1076,8 +1606,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHasSwappedSpinFx
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 8192; else *(int*)(Ptr + 3600) &= ~8192; }
     }
 
     /// <summary>
@@ -1085,8 +1615,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHasDoneLongSpin
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 16384; else *(int*)(Ptr + 3600) &= ~16384; }
     }
 
     /// <summary>
@@ -1094,8 +1624,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bIgnoreBeginAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 32768; else *(int*)(Ptr + 3600) &= ~32768; }
     }
 
     /// <summary>
@@ -1103,8 +1633,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bExtendingArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 65536; else *(int*)(Ptr + 3600) &= ~65536; }
     }
 
     /// <summary>
@@ -1112,8 +1642,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bRetractingArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 131072; else *(int*)(Ptr + 3600) &= ~131072; }
     }
 
     /// <summary>
@@ -1121,8 +1651,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bAwaitingRetraction
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 262144; else *(int*)(Ptr + 3600) &= ~262144; }
     }
 
     /// <summary>
@@ -1130,8 +1660,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bMorphingArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 524288; else *(int*)(Ptr + 3600) &= ~524288; }
     }
 
     /// <summary>
@@ -1139,8 +1669,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bUnMorphingArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 1048576; else *(int*)(Ptr + 3600) &= ~1048576; }
     }
 
     /// <summary>
@@ -1148,8 +1678,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHitBatman
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 2097152; else *(int*)(Ptr + 3600) &= ~2097152; }
     }
 
     /// <summary>
@@ -1157,8 +1687,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bCounteredMelee
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 4194304; else *(int*)(Ptr + 3600) &= ~4194304; }
     }
 
     /// <summary>
@@ -1166,8 +1696,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bAllowCounter
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 8388608; else *(int*)(Ptr + 3600) &= ~8388608; }
     }
 
     /// <summary>
@@ -1175,8 +1705,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bCounterPromptOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 16777216; else *(int*)(Ptr + 3600) &= ~16777216; }
     }
 
     /// <summary>
@@ -1184,8 +1714,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bCloseAttackBMLeftRange
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 33554432; else *(int*)(Ptr + 3600) &= ~33554432; }
     }
 
     /// <summary>
@@ -1193,8 +1723,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bInRetract
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 67108864; else *(int*)(Ptr + 3600) &= ~67108864; }
     }
 
     /// <summary>
@@ -1202,8 +1732,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bFirstHit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 134217728; else *(int*)(Ptr + 3600) &= ~134217728; }
     }
 
     /// <summary>
@@ -1211,8 +1741,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bExtendingLeftArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 268435456; else *(int*)(Ptr + 3600) &= ~268435456; }
     }
 
     /// <summary>
@@ -1220,8 +1750,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bRetractingLeftArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 536870912; else *(int*)(Ptr + 3600) &= ~536870912; }
     }
 
     /// <summary>
@@ -1229,8 +1759,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bExtendingRightArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= 1073741824; else *(int*)(Ptr + 3600) &= ~1073741824; }
     }
 
     /// <summary>
@@ -1238,8 +1768,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bRetractingRightArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3600); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3600); }
+        get { return (*(int*)(Ptr + 3600) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 3600) |= -2147483648; else *(int*)(Ptr + 3600) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -1247,8 +1777,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bDoubleAxe
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 1; else *(int*)(Ptr + 3604) &= ~1; }
     }
 
     /// <summary>
@@ -1256,8 +1786,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bAttackUseMirror
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 2; else *(int*)(Ptr + 3604) &= ~2; }
     }
 
     /// <summary>
@@ -1265,8 +1795,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bMorphingLeftArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 4; else *(int*)(Ptr + 3604) &= ~4; }
     }
 
     /// <summary>
@@ -1274,8 +1804,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bMorphingRightArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 8; else *(int*)(Ptr + 3604) &= ~8; }
     }
 
     /// <summary>
@@ -1283,8 +1813,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bUnMorphingLeftArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 16; else *(int*)(Ptr + 3604) &= ~16; }
     }
 
     /// <summary>
@@ -1292,8 +1822,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bUnMorphingRightArm
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 32; else *(int*)(Ptr + 3604) &= ~32; }
     }
 
     /// <summary>
@@ -1301,8 +1831,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bInTransitionOut
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 64; else *(int*)(Ptr + 3604) &= ~64; }
     }
 
     /// <summary>
@@ -1310,8 +1840,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bInTransitionIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 128; else *(int*)(Ptr + 3604) &= ~128; }
     }
 
     /// <summary>
@@ -1319,8 +1849,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bPreTransIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 256; else *(int*)(Ptr + 3604) &= ~256; }
     }
 
     /// <summary>
@@ -1328,8 +1858,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bInitialMorphs
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 512; else *(int*)(Ptr + 3604) &= ~512; }
     }
 
     /// <summary>
@@ -1337,8 +1867,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bCanDamageBats
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 1024; else *(int*)(Ptr + 3604) &= ~1024; }
     }
 
     /// <summary>
@@ -1346,8 +1876,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bAxeGoingClockwise
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 2048; else *(int*)(Ptr + 3604) &= ~2048; }
     }
 
     /// <summary>
@@ -1355,8 +1885,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bInAttack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 4096; else *(int*)(Ptr + 3604) &= ~4096; }
     }
 
     /// <summary>
@@ -1364,8 +1894,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHammerHit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 8192; else *(int*)(Ptr + 3604) &= ~8192; }
     }
 
     /// <summary>
@@ -1373,8 +1903,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bInSecondSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 16384; else *(int*)(Ptr + 3604) &= ~16384; }
     }
 
     /// <summary>
@@ -1382,8 +1912,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bLastRollWasLeap
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 32768; else *(int*)(Ptr + 3604) &= ~32768; }
     }
 
     /// <summary>
@@ -1391,8 +1921,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bMasterStopLeapUpdate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 65536; else *(int*)(Ptr + 3604) &= ~65536; }
     }
 
     /// <summary>
@@ -1400,8 +1930,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bInBounce
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 131072; else *(int*)(Ptr + 3604) &= ~131072; }
     }
 
     /// <summary>
@@ -1409,8 +1939,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bInCrash
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 262144; else *(int*)(Ptr + 3604) &= ~262144; }
     }
 
     /// <summary>
@@ -1418,8 +1948,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bAllowFace
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 524288; else *(int*)(Ptr + 3604) &= ~524288; }
     }
 
     /// <summary>
@@ -1427,8 +1957,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bHoming
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 1048576; else *(int*)(Ptr + 3604) &= ~1048576; }
     }
 
     /// <summary>
@@ -1436,8 +1966,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bDoneCameraForExplosion
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 2097152; else *(int*)(Ptr + 3604) &= ~2097152; }
     }
 
     /// <summary>
@@ -1445,8 +1975,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bStartedRollSfx
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 4194304; else *(int*)(Ptr + 3604) &= ~4194304; }
     }
 
     /// <summary>
@@ -1454,8 +1984,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bDoneEasySpin
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 8388608; else *(int*)(Ptr + 3604) &= ~8388608; }
     }
 
     /// <summary>
@@ -1463,8 +1993,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bDoneEasyAxe
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 16777216; else *(int*)(Ptr + 3604) &= ~16777216; }
     }
 
     /// <summary>
@@ -1472,8 +2002,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bDoneEasyHammer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 33554432; else *(int*)(Ptr + 3604) &= ~33554432; }
     }
 
     /// <summary>
@@ -1481,8 +2011,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe bool bDoneEasyJump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3604); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3604); }
+        get { return (*(int*)(Ptr + 3604) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 3604) |= 67108864; else *(int*)(Ptr + 3604) &= ~67108864; }
     }
 
     /// <summary>
@@ -1670,8 +2200,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float FreezeGrenadeDmg
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3696); }
+        get { return *(float*)(Ptr + 3696); }
+        set { *(float*)(Ptr + 3696) = value; }
     }
 
     /// <summary>
@@ -1679,8 +2209,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float OpenMouthMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3700); }
+        get { return *(float*)(Ptr + 3700); }
+        set { *(float*)(Ptr + 3700) = value; }
     }
 
     /// <summary>
@@ -1688,8 +2218,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float ClayfaceHealth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3704); }
+        get { return *(float*)(Ptr + 3704); }
+        set { *(float*)(Ptr + 3704) = value; }
     }
 
     /// <summary>
@@ -1697,8 +2227,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float ClayfaceHealthForHud
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3708); }
+        get { return *(float*)(Ptr + 3708); }
+        set { *(float*)(Ptr + 3708) = value; }
     }
 
     /// <summary>
@@ -1706,8 +2236,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float ClayfaceStartHealth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3712); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3712); }
+        get { return *(float*)(Ptr + 3712); }
+        set { *(float*)(Ptr + 3712) = value; }
     }
 
     /// <summary>
@@ -1715,8 +2245,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeTillSelectFreeze
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3716); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3716); }
+        get { return *(float*)(Ptr + 3716); }
+        set { *(float*)(Ptr + 3716) = value; }
     }
 
     /// <summary>
@@ -1724,8 +2254,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossClayface.ClayStages ClayfaceStage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossClayface.ClayStages>(Ptr + 3720); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3720); }
+        get { return *(BmSDK.BmScript.RPawnBossClayface.ClayStages*)(Ptr + 3720); }
+        set { *(BmSDK.BmScript.RPawnBossClayface.ClayStages*)(Ptr + 3720) = value; }
     }
 
     /// <summary>
@@ -1733,8 +2263,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossClayface.AttackTypes QueuedAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossClayface.AttackTypes>(Ptr + 3721); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3721); }
+        get { return *(BmSDK.BmScript.RPawnBossClayface.AttackTypes*)(Ptr + 3721); }
+        set { *(BmSDK.BmScript.RPawnBossClayface.AttackTypes*)(Ptr + 3721) = value; }
     }
 
     /// <summary>
@@ -1742,8 +2272,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossClayface.AttackTypes LastAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossClayface.AttackTypes>(Ptr + 3722); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3722); }
+        get { return *(BmSDK.BmScript.RPawnBossClayface.AttackTypes*)(Ptr + 3722); }
+        set { *(BmSDK.BmScript.RPawnBossClayface.AttackTypes*)(Ptr + 3722) = value; }
     }
 
     /// <summary>
@@ -1751,8 +2281,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossClayface.AttackTypes SecondLastAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossClayface.AttackTypes>(Ptr + 3723); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3723); }
+        get { return *(BmSDK.BmScript.RPawnBossClayface.AttackTypes*)(Ptr + 3723); }
+        set { *(BmSDK.BmScript.RPawnBossClayface.AttackTypes*)(Ptr + 3723) = value; }
     }
 
     /// <summary>
@@ -1760,8 +2290,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossClayface.AttackTypes DebugAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossClayface.AttackTypes>(Ptr + 3724); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3724); }
+        get { return *(BmSDK.BmScript.RPawnBossClayface.AttackTypes*)(Ptr + 3724); }
+        set { *(BmSDK.BmScript.RPawnBossClayface.AttackTypes*)(Ptr + 3724) = value; }
     }
 
     /// <summary>
@@ -1769,8 +2299,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe BmSDK.BmGame.RAnimUtil.EMirrorChoice AttackMirrorChoice
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil.EMirrorChoice>(Ptr + 3725); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3725); }
+        get { return *(BmSDK.BmGame.RAnimUtil.EMirrorChoice*)(Ptr + 3725); }
+        set { *(BmSDK.BmGame.RAnimUtil.EMirrorChoice*)(Ptr + 3725) = value; }
     }
 
     /// <summary>
@@ -1778,8 +2308,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int IceProjectileHits
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3728); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3728); }
+        get { return *(int*)(Ptr + 3728); }
+        set { *(int*)(Ptr + 3728) = value; }
     }
 
     /// <summary>
@@ -1787,8 +2317,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int NumAttacksSinceBall
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3732); }
+        get { return *(int*)(Ptr + 3732); }
+        set { *(int*)(Ptr + 3732) = value; }
     }
 
     /// <summary>
@@ -1814,8 +2344,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int NumFrozenHits
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3760); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3760); }
+        get { return *(int*)(Ptr + 3760); }
+        set { *(int*)(Ptr + 3760) = value; }
     }
 
     /// <summary>
@@ -1823,8 +2353,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeBeforeStart
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3764); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3764); }
+        get { return *(float*)(Ptr + 3764); }
+        set { *(float*)(Ptr + 3764) = value; }
     }
 
     /// <summary>
@@ -1832,8 +2362,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeTillNextAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3768); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3768); }
+        get { return *(float*)(Ptr + 3768); }
+        set { *(float*)(Ptr + 3768) = value; }
     }
 
     /// <summary>
@@ -1856,8 +2386,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float CurrMaxYawOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3792); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3792); }
+        get { return *(float*)(Ptr + 3792); }
+        set { *(float*)(Ptr + 3792) = value; }
     }
 
     /// <summary>
@@ -1892,8 +2422,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float MainFrozenValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3816); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3816); }
+        get { return *(float*)(Ptr + 3816); }
+        set { *(float*)(Ptr + 3816) = value; }
     }
 
     /// <summary>
@@ -1901,8 +2431,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int SwordHits
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3820); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3820); }
+        get { return *(int*)(Ptr + 3820); }
+        set { *(int*)(Ptr + 3820) = value; }
     }
 
     /// <summary>
@@ -1910,8 +2440,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float IceGrenHelpTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3824); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3824); }
+        get { return *(float*)(Ptr + 3824); }
+        set { *(float*)(Ptr + 3824) = value; }
     }
 
     /// <summary>
@@ -1973,8 +2503,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float CurrentBombTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3868); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3868); }
+        get { return *(float*)(Ptr + 3868); }
+        set { *(float*)(Ptr + 3868) = value; }
     }
 
     /// <summary>
@@ -1987,24 +2517,24 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int BombDamage_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3872); }
+        get { return *(int*)(Ptr + 3872); }
+        set { *(int*)(Ptr + 3872) = value; }
     }
     /// <summary>
     /// IntProperty: BombDamage
     /// </summary>
     public unsafe int BombDamage_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3876); }
+        get { return *(int*)(Ptr + 3876); }
+        set { *(int*)(Ptr + 3876) = value; }
     }
     /// <summary>
     /// IntProperty: BombDamage
     /// </summary>
     public unsafe int BombDamage_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3880); }
+        get { return *(int*)(Ptr + 3880); }
+        set { *(int*)(Ptr + 3880) = value; }
     }
 
     /// <summary>
@@ -2012,8 +2542,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int BombDamageToClayface
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3884); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3884); }
+        get { return *(int*)(Ptr + 3884); }
+        set { *(int*)(Ptr + 3884) = value; }
     }
 
     /// <summary>
@@ -2021,8 +2551,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int PickedBomb
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3888); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3888); }
+        get { return *(int*)(Ptr + 3888); }
+        set { *(int*)(Ptr + 3888) = value; }
     }
 
     /// <summary>
@@ -2030,8 +2560,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int SavedLandIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3892); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3892); }
+        get { return *(int*)(Ptr + 3892); }
+        set { *(int*)(Ptr + 3892) = value; }
     }
 
     /// <summary>
@@ -2039,8 +2569,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float Ball_Crash_Intensity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3896); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3896); }
+        get { return *(float*)(Ptr + 3896); }
+        set { *(float*)(Ptr + 3896) = value; }
     }
 
     /// <summary>
@@ -2084,8 +2614,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeBetweenDrips
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3948); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3948); }
+        get { return *(float*)(Ptr + 3948); }
+        set { *(float*)(Ptr + 3948) = value; }
     }
 
     /// <summary>
@@ -2093,8 +2623,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeSinceLastDrip
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3952); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3952); }
+        get { return *(float*)(Ptr + 3952); }
+        set { *(float*)(Ptr + 3952) = value; }
     }
 
     /// <summary>
@@ -2120,8 +2650,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float BoneSpeedMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3980); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3980); }
+        get { return *(float*)(Ptr + 3980); }
+        set { *(float*)(Ptr + 3980) = value; }
     }
 
     /// <summary>
@@ -2129,8 +2659,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float MaxBoneSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3984); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3984); }
+        get { return *(float*)(Ptr + 3984); }
+        set { *(float*)(Ptr + 3984) = value; }
     }
 
     /// <summary>
@@ -2237,8 +2767,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeInState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4040); }
+        get { return *(float*)(Ptr + 4040); }
+        set { *(float*)(Ptr + 4040) = value; }
     }
 
     /// <summary>
@@ -2246,8 +2776,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeBetweenAttacks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4044); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4044); }
+        get { return *(float*)(Ptr + 4044); }
+        set { *(float*)(Ptr + 4044) = value; }
     }
 
     /// <summary>
@@ -2297,8 +2827,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float NumSwordHits
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4480); }
+        get { return *(float*)(Ptr + 4480); }
+        set { *(float*)(Ptr + 4480) = value; }
     }
 
     /// <summary>
@@ -2306,8 +2836,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float DistanceForProjectileAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4484); }
+        get { return *(float*)(Ptr + 4484); }
+        set { *(float*)(Ptr + 4484) = value; }
     }
 
     /// <summary>
@@ -2315,8 +2845,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float CurrentSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4488); }
+        get { return *(float*)(Ptr + 4488); }
+        set { *(float*)(Ptr + 4488) = value; }
     }
 
     /// <summary>
@@ -2324,8 +2854,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float LastMiniProjTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4492); }
+        get { return *(float*)(Ptr + 4492); }
+        set { *(float*)(Ptr + 4492) = value; }
     }
 
     /// <summary>
@@ -2333,8 +2863,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float LastBigProjTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4496); }
+        get { return *(float*)(Ptr + 4496); }
+        set { *(float*)(Ptr + 4496) = value; }
     }
 
     /// <summary>
@@ -2342,8 +2872,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int CurrentWave
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4500); }
+        get { return *(int*)(Ptr + 4500); }
+        set { *(int*)(Ptr + 4500) = value; }
     }
 
     /// <summary>
@@ -2369,8 +2899,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe BmSDK.FName PickedMeleeType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4512); }
+        get { return *(BmSDK.FName*)(Ptr + 4512); }
+        set { *(BmSDK.FName*)(Ptr + 4512) = value; }
     }
 
     /// <summary>
@@ -2378,8 +2908,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int NumConsecutiveMeleeAttacks
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4520); }
+        get { return *(int*)(Ptr + 4520); }
+        set { *(int*)(Ptr + 4520) = value; }
     }
 
     /// <summary>
@@ -2387,8 +2917,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeTillRetraction
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4524); }
+        get { return *(float*)(Ptr + 4524); }
+        set { *(float*)(Ptr + 4524) = value; }
     }
 
     /// <summary>
@@ -2396,8 +2926,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float StrechTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4528); }
+        get { return *(float*)(Ptr + 4528); }
+        set { *(float*)(Ptr + 4528) = value; }
     }
 
     /// <summary>
@@ -2405,8 +2935,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float MorphTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4532); }
+        get { return *(float*)(Ptr + 4532); }
+        set { *(float*)(Ptr + 4532) = value; }
     }
 
     /// <summary>
@@ -2438,8 +2968,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float InitialMeleeYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4584); }
+        get { return *(float*)(Ptr + 4584); }
+        set { *(float*)(Ptr + 4584) = value; }
     }
 
     /// <summary>
@@ -2453,8 +2983,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float CounterMarkTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4600); }
+        get { return *(float*)(Ptr + 4600); }
+        set { *(float*)(Ptr + 4600) = value; }
     }
 
     /// <summary>
@@ -2471,8 +3001,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeSinceStrikeHit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4608); }
+        get { return *(float*)(Ptr + 4608); }
+        set { *(float*)(Ptr + 4608) = value; }
     }
 
     /// <summary>
@@ -2480,8 +3010,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int NumRetractFrames
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4612); }
+        get { return *(int*)(Ptr + 4612); }
+        set { *(int*)(Ptr + 4612) = value; }
     }
 
     /// <summary>
@@ -2519,8 +3049,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe BmSDK.FName SavedFrozenAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4676); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4676); }
+        get { return *(BmSDK.FName*)(Ptr + 4676); }
+        set { *(BmSDK.FName*)(Ptr + 4676) = value; }
     }
 
     /// <summary>
@@ -2528,8 +3058,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int CurrentHammerAttackNo
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4684); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4684); }
+        get { return *(int*)(Ptr + 4684); }
+        set { *(int*)(Ptr + 4684) = value; }
     }
 
     /// <summary>
@@ -2537,8 +3067,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float LeftMorphTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4688); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4688); }
+        get { return *(float*)(Ptr + 4688); }
+        set { *(float*)(Ptr + 4688) = value; }
     }
 
     /// <summary>
@@ -2546,8 +3076,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float RightMorphTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4692); }
+        get { return *(float*)(Ptr + 4692); }
+        set { *(float*)(Ptr + 4692) = value; }
     }
 
     /// <summary>
@@ -2555,8 +3085,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float LeftExtendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4696); }
+        get { return *(float*)(Ptr + 4696); }
+        set { *(float*)(Ptr + 4696) = value; }
     }
 
     /// <summary>
@@ -2564,8 +3094,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float RightExtendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4700); }
+        get { return *(float*)(Ptr + 4700); }
+        set { *(float*)(Ptr + 4700) = value; }
     }
 
     /// <summary>
@@ -2573,8 +3103,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float AxeStartYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4704); }
+        get { return *(float*)(Ptr + 4704); }
+        set { *(float*)(Ptr + 4704) = value; }
     }
 
     /// <summary>
@@ -2582,8 +3112,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float UpperArmSavedStr
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4708); }
+        get { return *(float*)(Ptr + 4708); }
+        set { *(float*)(Ptr + 4708) = value; }
     }
 
     /// <summary>
@@ -2591,8 +3121,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeSinceDouble
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4712); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4712); }
+        get { return *(float*)(Ptr + 4712); }
+        set { *(float*)(Ptr + 4712) = value; }
     }
 
     /// <summary>
@@ -2675,8 +3205,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float CrashTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4956); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4956); }
+        get { return *(float*)(Ptr + 4956); }
+        set { *(float*)(Ptr + 4956) = value; }
     }
 
     /// <summary>
@@ -2702,8 +3232,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe int HomingBombIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4976); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4976); }
+        get { return *(int*)(Ptr + 4976); }
+        set { *(int*)(Ptr + 4976) = value; }
     }
 
     /// <summary>
@@ -2777,8 +3307,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float NearDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5028); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5028); }
+        get { return *(float*)(Ptr + 5028); }
+        set { *(float*)(Ptr + 5028) = value; }
     }
 
     /// <summary>
@@ -2786,8 +3316,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float VeryNearDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5032); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5032); }
+        get { return *(float*)(Ptr + 5032); }
+        set { *(float*)(Ptr + 5032) = value; }
     }
 
     /// <summary>
@@ -2795,8 +3325,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float CamDistAtRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5036); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5036); }
+        get { return *(float*)(Ptr + 5036); }
+        set { *(float*)(Ptr + 5036) = value; }
     }
 
     /// <summary>
@@ -2804,8 +3334,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float CamDistAtClose
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5040); }
+        get { return *(float*)(Ptr + 5040); }
+        set { *(float*)(Ptr + 5040) = value; }
     }
 
     /// <summary>
@@ -2813,8 +3343,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float CamDistForMelee
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5044); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5044); }
+        get { return *(float*)(Ptr + 5044); }
+        set { *(float*)(Ptr + 5044) = value; }
     }
 
     /// <summary>
@@ -2900,8 +3430,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeTillExplosion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5648); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5648); }
+        get { return *(float*)(Ptr + 5648); }
+        set { *(float*)(Ptr + 5648) = value; }
     }
 
     /// <summary>
@@ -2909,8 +3439,8 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
     /// </summary>
     public unsafe float TimeTillExplosionCamera
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 5652); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5652); }
+        get { return *(float*)(Ptr + 5652); }
+        set { *(float*)(Ptr + 5652) = value; }
     }
 
     /// <summary>
@@ -2960,34 +3490,30 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// </summary>
         public unsafe float LeapDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 0); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 0) = value; }; }
         }
         /// <summary>
         /// FloatProperty: LeapDamage
         /// </summary>
         public unsafe float LeapDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: LeapDamage
         /// </summary>
         public unsafe float LeapDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: DamageRadius
         /// </summary>
-        public unsafe float DamageRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float DamageRadius;
 
         /// <summary>
         /// ObjectProperty: LeapHitParticleEffect
@@ -3001,38 +3527,22 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: MorphInTime
         /// </summary>
-        public unsafe float MorphInTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float MorphInTime;
 
         /// <summary>
         /// FloatProperty: MorphOutTime
         /// </summary>
-        public unsafe float MorphOutTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float MorphOutTime;
 
         /// <summary>
         /// FloatProperty: LeapHandScale
         /// </summary>
-        public unsafe float LeapHandScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float LeapHandScale;
 
         /// <summary>
         /// FloatProperty: LeapSaftyValue
         /// </summary>
-        public unsafe float LeapSaftyValue
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float LeapSaftyValue;
     }
 
     /// <summary>
@@ -3044,108 +3554,72 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: EndWaitTime
         /// </summary>
-        public unsafe float EndWaitTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float EndWaitTime;
 
         /// <summary>
         /// FloatProperty: AxeExtendDuration
         /// </summary>
-        public unsafe float AxeExtendDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float AxeExtendDuration;
 
         /// <summary>
         /// FloatProperty: AxeRetractDuration
         /// </summary>
-        public unsafe float AxeRetractDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float AxeRetractDuration;
 
         /// <summary>
         /// FloatProperty: AxeDamage
         /// </summary>
         public unsafe float AxeDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// FloatProperty: AxeDamage
         /// </summary>
         public unsafe float AxeDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// FloatProperty: AxeDamage
         /// </summary>
         public unsafe float AxeDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: AnimExtendMaxDistance
         /// </summary>
-        public unsafe float AnimExtendMaxDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float AnimExtendMaxDistance;
 
         /// <summary>
         /// FloatProperty: AnimTranslatePerDist
         /// </summary>
-        public unsafe float AnimTranslatePerDist
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float AnimTranslatePerDist;
 
         /// <summary>
         /// FloatProperty: MorphInTime
         /// </summary>
-        public unsafe float MorphInTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float MorphInTime;
 
         /// <summary>
         /// FloatProperty: MorphAttackScale
         /// </summary>
-        public unsafe float MorphAttackScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float MorphAttackScale;
 
         /// <summary>
         /// FloatProperty: MorphOutTime
         /// </summary>
-        public unsafe float MorphOutTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float MorphOutTime;
 
         /// <summary>
         /// FloatProperty: AxeRadius
         /// </summary>
-        public unsafe float AxeRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float AxeRadius;
 
         /// <summary>
         /// ObjectProperty: AxeHitParticleEffect
@@ -3159,20 +3633,12 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: AxeSlowestSpeed
         /// </summary>
-        public unsafe float AxeSlowestSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public float AxeSlowestSpeed;
 
         /// <summary>
         /// FloatProperty: AxeFastestSpeed
         /// </summary>
-        public unsafe float AxeFastestSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float AxeFastestSpeed;
     }
 
     /// <summary>
@@ -3184,99 +3650,67 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: EndWaitTime
         /// </summary>
-        public unsafe float EndWaitTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float EndWaitTime;
 
         /// <summary>
         /// FloatProperty: HammerAttackDuration
         /// </summary>
-        public unsafe float HammerAttackDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float HammerAttackDuration;
 
         /// <summary>
         /// FloatProperty: HammerRetractDuration
         /// </summary>
-        public unsafe float HammerRetractDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float HammerRetractDuration;
 
         /// <summary>
         /// FloatProperty: HammerDamage
         /// </summary>
         public unsafe float HammerDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
         /// <summary>
         /// FloatProperty: HammerDamage
         /// </summary>
         public unsafe float HammerDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 16); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 16) = value; }; }
         }
         /// <summary>
         /// FloatProperty: HammerDamage
         /// </summary>
         public unsafe float HammerDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: AnimExtendMaxDistance
         /// </summary>
-        public unsafe float AnimExtendMaxDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float AnimExtendMaxDistance;
 
         /// <summary>
         /// FloatProperty: AnimTranslatePerDist
         /// </summary>
-        public unsafe float AnimTranslatePerDist
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float AnimTranslatePerDist;
 
         /// <summary>
         /// FloatProperty: MorphInTime
         /// </summary>
-        public unsafe float MorphInTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float MorphInTime;
 
         /// <summary>
         /// FloatProperty: MorphAttackScale
         /// </summary>
-        public unsafe float MorphAttackScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float MorphAttackScale;
 
         /// <summary>
         /// FloatProperty: MorphOutTime
         /// </summary>
-        public unsafe float MorphOutTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float MorphOutTime;
 
         /// <summary>
         /// ObjectProperty: HammerHitParticleEffect
@@ -3299,29 +3733,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: HammerSlowestSpeed
         /// </summary>
-        public unsafe float HammerSlowestSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float HammerSlowestSpeed;
 
         /// <summary>
         /// FloatProperty: HammerFastestSpeed
         /// </summary>
-        public unsafe float HammerFastestSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float HammerFastestSpeed;
 
         /// <summary>
         /// FloatProperty: HammerRadius
         /// </summary>
-        public unsafe float HammerRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float HammerRadius;
     }
 
     /// <summary>
@@ -3333,108 +3755,72 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: EndWaitTime
         /// </summary>
-        public unsafe float EndWaitTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float EndWaitTime;
 
         /// <summary>
         /// FloatProperty: HoldMeleeTime
         /// </summary>
-        public unsafe float HoldMeleeTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float HoldMeleeTime;
 
         /// <summary>
         /// FloatProperty: MinDistanceForMeleeAttack
         /// </summary>
-        public unsafe float MinDistanceForMeleeAttack
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float MinDistanceForMeleeAttack;
 
         /// <summary>
         /// FloatProperty: MeleeAttackDuration
         /// </summary>
-        public unsafe float MeleeAttackDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float MeleeAttackDuration;
 
         /// <summary>
         /// FloatProperty: MeleeRetractDuration
         /// </summary>
-        public unsafe float MeleeRetractDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float MeleeRetractDuration;
 
         /// <summary>
         /// FloatProperty: MorphTime
         /// </summary>
-        public unsafe float MorphTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float MorphTime;
 
         /// <summary>
         /// FloatProperty: MeleeDamage
         /// </summary>
         public unsafe float MeleeDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 24) = value; }; }
         }
         /// <summary>
         /// FloatProperty: MeleeDamage
         /// </summary>
         public unsafe float MeleeDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 28) = value; }; }
         }
         /// <summary>
         /// FloatProperty: MeleeDamage
         /// </summary>
         public unsafe float MeleeDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 32); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 32) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: AnimExtendMaxDistance
         /// </summary>
-        public unsafe float AnimExtendMaxDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float AnimExtendMaxDistance;
 
         /// <summary>
         /// FloatProperty: AnimTranslatePerDist
         /// </summary>
-        public unsafe float AnimTranslatePerDist
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float AnimTranslatePerDist;
 
         /// <summary>
         /// FloatProperty: HammerRadius
         /// </summary>
-        public unsafe float HammerRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float HammerRadius;
 
         /// <summary>
         /// ObjectProperty: HammerHitParticleEffect
@@ -3448,29 +3834,17 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: CounterEndTime
         /// </summary>
-        public unsafe float CounterEndTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public float CounterEndTime;
 
         /// <summary>
         /// FloatProperty: CounterStartTime
         /// </summary>
-        public unsafe float CounterStartTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float CounterStartTime;
 
         /// <summary>
         /// FloatProperty: CloseAttackHandScale
         /// </summary>
-        public unsafe float CloseAttackHandScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float CloseAttackHandScale;
 
         /// <summary>
         /// ObjectProperty: CloseAttackHitParticleEffect
@@ -3484,45 +3858,37 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: CloseHammerRadius
         /// </summary>
-        public unsafe float CloseHammerRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float CloseHammerRadius;
 
         /// <summary>
         /// FloatProperty: CloseMeleeDamage
         /// </summary>
         public unsafe float CloseMeleeDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 72); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 72) = value; }; }
         }
         /// <summary>
         /// FloatProperty: CloseMeleeDamage
         /// </summary>
         public unsafe float CloseMeleeDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 76); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 76) = value; }; }
         }
         /// <summary>
         /// FloatProperty: CloseMeleeDamage
         /// </summary>
         public unsafe float CloseMeleeDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 80); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 80) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: PunchOffsetDist
         /// </summary>
-        public unsafe float PunchOffsetDist
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
-        }
+        [FieldOffset(84)] public float PunchOffsetDist;
     }
 
     /// <summary>
@@ -3534,133 +3900,97 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: EndWaitTime
         /// </summary>
-        public unsafe float EndWaitTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float EndWaitTime;
 
         /// <summary>
         /// FloatProperty: ProjectileSpeed
         /// </summary>
         public unsafe float ProjectileSpeed_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: ProjectileSpeed
         /// </summary>
         public unsafe float ProjectileSpeed_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
         /// <summary>
         /// FloatProperty: ProjectileSpeed
         /// </summary>
         public unsafe float ProjectileSpeed_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
 
         /// <summary>
         /// IntProperty: NumProjectilesThrownPerWave
         /// </summary>
-        public unsafe int NumProjectilesThrownPerWave
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int NumProjectilesThrownPerWave;
 
         /// <summary>
         /// FloatProperty: ProjectileDamage
         /// </summary>
         public unsafe float ProjectileDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
         /// <summary>
         /// FloatProperty: ProjectileDamage
         /// </summary>
         public unsafe float ProjectileDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 24) = value; }; }
         }
         /// <summary>
         /// FloatProperty: ProjectileDamage
         /// </summary>
         public unsafe float ProjectileDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 28) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: TimeBetweenMiniProjs
         /// </summary>
-        public unsafe float TimeBetweenMiniProjs
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float TimeBetweenMiniProjs;
 
         /// <summary>
         /// FloatProperty: TimeBetweenProjs
         /// </summary>
-        public unsafe float TimeBetweenProjs
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float TimeBetweenProjs;
 
         /// <summary>
         /// FloatProperty: MiniProjMinSpeed
         /// </summary>
-        public unsafe float MiniProjMinSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float MiniProjMinSpeed;
 
         /// <summary>
         /// FloatProperty: MiniProjMaxSpeed
         /// </summary>
-        public unsafe float MiniProjMaxSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float MiniProjMaxSpeed;
 
         /// <summary>
         /// FloatProperty: ProjDamageWidth
         /// </summary>
-        public unsafe float ProjDamageWidth
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public float ProjDamageWidth;
 
         /// <summary>
         /// FloatProperty: WaveDelayTime
         /// </summary>
-        public unsafe float WaveDelayTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public float WaveDelayTime;
 
         /// <summary>
         /// FloatProperty: WaveInitialDelayTime
         /// </summary>
-        public unsafe float WaveInitialDelayTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float WaveInitialDelayTime;
     }
 
     /// <summary>
@@ -3672,248 +4002,172 @@ public partial class RPawnBossClayface : BmSDK.BmGame.RPawnBossClayfaceBase, BmS
         /// <summary>
         /// FloatProperty: BallRotateSpeed
         /// </summary>
-        public unsafe float BallRotateSpeed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float BallRotateSpeed;
 
         /// <summary>
         /// FloatProperty: BallSpeed
         /// </summary>
         public unsafe float BallSpeed_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 4); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 4) = value; }; }
         }
         /// <summary>
         /// FloatProperty: BallSpeed
         /// </summary>
         public unsafe float BallSpeed_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 8); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 8) = value; }; }
         }
         /// <summary>
         /// FloatProperty: BallSpeed
         /// </summary>
         public unsafe float BallSpeed_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 12); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 12) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: BallForwardAcceleration
         /// </summary>
-        public unsafe float BallForwardAcceleration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float BallForwardAcceleration;
 
         /// <summary>
         /// FloatProperty: BallBMAcceleration
         /// </summary>
         public unsafe float BallBMAcceleration_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 20); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 20) = value; }; }
         }
         /// <summary>
         /// FloatProperty: BallBMAcceleration
         /// </summary>
         public unsafe float BallBMAcceleration_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 24) = value; }; }
         }
         /// <summary>
         /// FloatProperty: BallBMAcceleration
         /// </summary>
         public unsafe float BallBMAcceleration_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 28) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: BallBombAcceleration
         /// </summary>
-        public unsafe float BallBombAcceleration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float BallBombAcceleration;
 
         /// <summary>
         /// FloatProperty: BallDamage
         /// </summary>
         public unsafe float BallDamage_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 36); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 36) = value; }; }
         }
         /// <summary>
         /// FloatProperty: BallDamage
         /// </summary>
         public unsafe float BallDamage_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 40) = value; }; }
         }
         /// <summary>
         /// FloatProperty: BallDamage
         /// </summary>
         public unsafe float BallDamage_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 44); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 44) = value; }; }
         }
 
         /// <summary>
         /// FloatProperty: BallRadius
         /// </summary>
-        public unsafe float BallRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public float BallRadius;
 
         /// <summary>
         /// FloatProperty: BallBounceTime
         /// </summary>
-        public unsafe float BallBounceTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public float BallBounceTime;
 
         /// <summary>
         /// FloatProperty: BallExplodeBounceTime
         /// </summary>
-        public unsafe float BallExplodeBounceTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float BallExplodeBounceTime;
 
         /// <summary>
         /// FloatProperty: BallGravity
         /// </summary>
-        public unsafe float BallGravity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float BallGravity;
 
         /// <summary>
         /// FloatProperty: TimeVulnerable
         /// </summary>
-        public unsafe float TimeVulnerable
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float TimeVulnerable;
 
         /// <summary>
         /// IntProperty: BallTime
         /// </summary>
-        public unsafe int BallTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public int BallTime;
 
         /// <summary>
         /// IntProperty: BallTimeStage2
         /// </summary>
-        public unsafe int BallTimeStage2
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
-        }
+        [FieldOffset(72)] public int BallTimeStage2;
 
         /// <summary>
         /// FloatProperty: BallMorphInSpeedMul
         /// </summary>
-        public unsafe float BallMorphInSpeedMul
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
-        }
+        [FieldOffset(76)] public float BallMorphInSpeedMul;
 
         /// <summary>
         /// FloatProperty: BallMorphOutSpeedMul
         /// </summary>
-        public unsafe float BallMorphOutSpeedMul
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
-        }
+        [FieldOffset(80)] public float BallMorphOutSpeedMul;
 
         /// <summary>
         /// FloatProperty: CrashVelVert
         /// </summary>
-        public unsafe float CrashVelVert
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }; }
-        }
+        [FieldOffset(84)] public float CrashVelVert;
 
         /// <summary>
         /// FloatProperty: CrashVelHoriz
         /// </summary>
-        public unsafe float CrashVelHoriz
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
-        }
+        [FieldOffset(88)] public float CrashVelHoriz;
 
         /// <summary>
         /// FloatProperty: BombHomingDist
         /// </summary>
-        public unsafe float BombHomingDist
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }; }
-        }
+        [FieldOffset(92)] public float BombHomingDist;
 
         /// <summary>
         /// FloatProperty: BombExplodeDist
         /// </summary>
-        public unsafe float BombExplodeDist
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public float BombExplodeDist;
 
         /// <summary>
         /// FloatProperty: BombDetonateDist
         /// </summary>
-        public unsafe float BombDetonateDist
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }; }
-        }
+        [FieldOffset(100)] public float BombDetonateDist;
 
         /// <summary>
         /// FloatProperty: BombYawDiff
         /// </summary>
-        public unsafe float BombYawDiff
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }; }
-        }
+        [FieldOffset(104)] public float BombYawDiff;
 
         /// <summary>
         /// FloatProperty: MinHomingDistance
         /// </summary>
-        public unsafe float MinHomingDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 108); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }; }
-        }
+        [FieldOffset(108)] public float MinHomingDistance;
     }
 
     /// <summary>
@@ -78,18 +78,33 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
         where TComponent : class, Framework.IScriptComponent<RPawnBossGrundy>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CreateBasicWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 6900)]
+    private struct CreateBasicWeaponConfig_Params
+    {
+        [FieldOffset(0)] public nint NewOwner;
+        [FieldOffset(16)] public nint TurnAnimSet;
+        [FieldOffset(20)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateBasicWeaponConfig
     /// </summary>
     public unsafe override BmSDK.BmGame.RWeaponConfig CreateBasicWeaponConfig(BmSDK.GameObject NewOwner, BmSDK.TArray<BmSDK.Engine.AnimSet> AnimSets, BmSDK.Engine.AnimSet TurnAnimSet = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CreateBasicWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[6900];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewOwner, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimSets, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TurnAnimSet, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWeaponConfig>(paramsPtr + 20);
+        var funcManaged = s_CreateBasicWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CreateBasicWeaponConfig", true);
+        var parms = new CreateBasicWeaponConfig_Params();
+        parms.NewOwner = NewOwner?.Ptr ?? 0;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimSets, (byte*)&parms + 4);
+        parms.TurnAnimSet = TurnAnimSet?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWeaponConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_dbgBlowPadsUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct dbgBlowPadsUp_Params
+    {
     }
 
     /// <summary>
@@ -97,66 +112,104 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override void dbgBlowPadsUp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.dbgBlowPadsUp", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_dbgBlowPadsUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.dbgBlowPadsUp", true);
+        var parms = new dbgBlowPadsUp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetAllPadsDamageStatesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetAllPadsDamageStates_Params
+    {
+        [FieldOffset(0)] public int State;
+    }
+
     /// <summary>
     /// Function: SetAllPadsDamageStates
     /// </summary>
     public unsafe virtual void SetAllPadsDamageStates(int State)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetAllPadsDamageStates", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(State, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAllPadsDamageStatesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetAllPadsDamageStates", true);
+        var parms = new SetAllPadsDamageStates_Params();
+        parms.State = State;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSmashReturnPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetSmashReturnPoint_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetSmashReturnPoint
     /// </summary>
     public unsafe virtual void SetSmashReturnPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetSmashReturnPoint", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSmashReturnPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetSmashReturnPoint", true);
+        var parms = new SetSmashReturnPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReturnWeightToThisLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReturnWeightToThisLocation_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReturnWeightToThisLocation
     /// </summary>
     public unsafe virtual void ReturnWeightToThisLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ReturnWeightToThisLocation", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReturnWeightToThisLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ReturnWeightToThisLocation", true);
+        var parms = new ReturnWeightToThisLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EndChainRetractionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EndChainRetraction_Params
+    {
+    }
+
     /// <summary>
     /// Function: EndChainRetraction
     /// </summary>
     public unsafe virtual void EndChainRetraction()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EndChainRetraction", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EndChainRetractionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EndChainRetraction", true);
+        var parms = new EndChainRetraction_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsInBeamHitReactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsInBeamHitReact_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsInBeamHitReact
     /// </summary>
     public unsafe virtual bool IsInBeamHitReact()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsInBeamHitReact", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsInBeamHitReactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsInBeamHitReact", true);
+        var parms = new IsInBeamHitReact_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FlashBeamsOnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FlashBeamsOn_Params
+    {
     }
 
     /// <summary>
@@ -164,321 +217,499 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void FlashBeamsOn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FlashBeamsOn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FlashBeamsOnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FlashBeamsOn", true);
+        var parms = new FlashBeamsOn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FlashBeamsOffFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FlashBeamsOff_Params
+    {
+    }
+
     /// <summary>
     /// Function: FlashBeamsOff
     /// </summary>
     public unsafe virtual void FlashBeamsOff()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FlashBeamsOff", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FlashBeamsOffFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FlashBeamsOff", true);
+        var parms = new FlashBeamsOff_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishBeamHitReactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinishBeamHitReact_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinishBeamHitReact
     /// </summary>
     public unsafe virtual void FinishBeamHitReact()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FinishBeamHitReact", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishBeamHitReactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FinishBeamHitReact", true);
+        var parms = new FinishBeamHitReact_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerBeamHitReactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerBeamHitReact_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerBeamHitReact
     /// </summary>
     public unsafe virtual void TriggerBeamHitReact()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerBeamHitReact", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerBeamHitReactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerBeamHitReact", true);
+        var parms = new TriggerBeamHitReact_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerRoomShutdownScreenShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 148)]
+    private struct TriggerRoomShutdownScreenShake_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerRoomShutdownScreenShake
     /// </summary>
     public unsafe virtual void TriggerRoomShutdownScreenShake()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerRoomShutdownScreenShake", true);
-        byte* paramsPtr = stackalloc byte[148];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerRoomShutdownScreenShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerRoomShutdownScreenShake", true);
+        var parms = new TriggerRoomShutdownScreenShake_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverloadExplosion3Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverloadExplosion3_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverloadExplosion3
     /// </summary>
     public unsafe virtual void OverloadExplosion3()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverloadExplosion3", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverloadExplosion3Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverloadExplosion3", true);
+        var parms = new OverloadExplosion3_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverloadExplosion2Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverloadExplosion2_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverloadExplosion2
     /// </summary>
     public unsafe virtual void OverloadExplosion2()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverloadExplosion2", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverloadExplosion2Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverloadExplosion2", true);
+        var parms = new OverloadExplosion2_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverloadExplosion1Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverloadExplosion1_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverloadExplosion1
     /// </summary>
     public unsafe virtual void OverloadExplosion1()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverloadExplosion1", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverloadExplosion1Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverloadExplosion1", true);
+        var parms = new OverloadExplosion1_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GrundyRumbleNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GrundyRumbleNotify_Params
+    {
+    }
+
     /// <summary>
     /// Function: GrundyRumbleNotify
     /// </summary>
     public unsafe virtual void GrundyRumbleNotify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GrundyRumbleNotify", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GrundyRumbleNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GrundyRumbleNotify", true);
+        var parms = new GrundyRumbleNotify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisablePadSmokeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisablePadSmoke_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisablePadSmoke
     /// </summary>
     public unsafe virtual void DisablePadSmoke()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DisablePadSmoke", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisablePadSmokeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DisablePadSmoke", true);
+        var parms = new DisablePadSmoke_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnablePadSmokeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EnablePadSmoke_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnablePadSmoke
     /// </summary>
     public unsafe virtual void EnablePadSmoke()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnablePadSmoke", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnablePadSmokeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnablePadSmoke", true);
+        var parms = new EnablePadSmoke_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopExtraBeamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopExtraBeams_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopExtraBeams
     /// </summary>
     public unsafe virtual void StopExtraBeams()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopExtraBeams", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopExtraBeamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopExtraBeams", true);
+        var parms = new StopExtraBeams_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartExtraBeamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartExtraBeams_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartExtraBeams
     /// </summary>
     public unsafe virtual void StartExtraBeams()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartExtraBeams", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartExtraBeamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartExtraBeams", true);
+        var parms = new StartExtraBeams_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartRoomBitsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartRoomBits_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartRoomBits
     /// </summary>
     public unsafe virtual void StartRoomBits()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartRoomBits", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartRoomBitsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartRoomBits", true);
+        var parms = new StartRoomBits_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopFailBeamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopFailBeams_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopFailBeams
     /// </summary>
     public unsafe virtual void StopFailBeams()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopFailBeams", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopFailBeamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopFailBeams", true);
+        var parms = new StopFailBeams_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartFailBeamsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartFailBeams_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartFailBeams
     /// </summary>
     public unsafe virtual void StartFailBeams()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartFailBeams", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartFailBeamsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartFailBeams", true);
+        var parms = new StartFailBeams_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerFailBeams3Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerFailBeams3_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerFailBeams3
     /// </summary>
     public unsafe virtual void TriggerFailBeams3()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerFailBeams3", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerFailBeams3Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerFailBeams3", true);
+        var parms = new TriggerFailBeams3_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerFailBeams2Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerFailBeams2_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerFailBeams2
     /// </summary>
     public unsafe virtual void TriggerFailBeams2()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerFailBeams2", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerFailBeams2Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerFailBeams2", true);
+        var parms = new TriggerFailBeams2_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerFailBeams1Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerFailBeams1_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerFailBeams1
     /// </summary>
     public unsafe virtual void TriggerFailBeams1()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerFailBeams1", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerFailBeams1Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerFailBeams1", true);
+        var parms = new TriggerFailBeams1_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RewindIgniteAnimsToUncutPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RewindIgniteAnimsToUncutPoint_Params
+    {
+    }
+
     /// <summary>
     /// Function: RewindIgniteAnimsToUncutPoint
     /// </summary>
     public unsafe virtual void RewindIgniteAnimsToUncutPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RewindIgniteAnimsToUncutPoint", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RewindIgniteAnimsToUncutPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RewindIgniteAnimsToUncutPoint", true);
+        var parms = new RewindIgniteAnimsToUncutPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IgniteCameraReturnFromCutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IgniteCameraReturnFromCut_Params
+    {
+    }
+
     /// <summary>
     /// Function: IgniteCameraReturnFromCut
     /// </summary>
     public unsafe virtual void IgniteCameraReturnFromCut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IgniteCameraReturnFromCut", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IgniteCameraReturnFromCutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IgniteCameraReturnFromCut", true);
+        var parms = new IgniteCameraReturnFromCut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IgniteCameraCutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IgniteCameraCut_Params
+    {
+    }
+
     /// <summary>
     /// Function: IgniteCameraCut
     /// </summary>
     public unsafe virtual void IgniteCameraCut()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IgniteCameraCut", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IgniteCameraCutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IgniteCameraCut", true);
+        var parms = new IgniteCameraCut_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PenguinButtonPressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PenguinButtonPressed_Params
+    {
+    }
+
     /// <summary>
     /// Function: PenguinButtonPressed
     /// </summary>
     public unsafe virtual void PenguinButtonPressed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PenguinButtonPressed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PenguinButtonPressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PenguinButtonPressed", true);
+        var parms = new PenguinButtonPressed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableFakeDeathBlockingVolumesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct EnableFakeDeathBlockingVolumes_Params
+    {
+        [FieldOffset(0)] public int bEnabled;
+    }
+
     /// <summary>
     /// Function: EnableFakeDeathBlockingVolumes
     /// </summary>
     public unsafe virtual void EnableFakeDeathBlockingVolumes(bool bEnabled)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableFakeDeathBlockingVolumes", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnabled, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableFakeDeathBlockingVolumesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableFakeDeathBlockingVolumes", true);
+        var parms = new EnableFakeDeathBlockingVolumes_Params();
+        parms.bEnabled = bEnabled ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterCrushButtonPressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RegisterCrushButtonPress_Params
+    {
+    }
+
     /// <summary>
     /// Function: RegisterCrushButtonPress
     /// </summary>
     public unsafe virtual void RegisterCrushButtonPress()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RegisterCrushButtonPress", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterCrushButtonPressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RegisterCrushButtonPress", true);
+        var parms = new RegisterCrushButtonPress_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActionPerformedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct ActionPerformed_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EGameAction Action;
+    }
+
     /// <summary>
     /// Function: ActionPerformed
     /// </summary>
     public unsafe override void ActionPerformed(BmSDK.BmGame.RGameInfo.EGameAction Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ActionPerformed", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActionPerformedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ActionPerformed", true);
+        var parms = new ActionPerformed_Params();
+        parms.Action = Action;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHelpTextStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetHelpTextState_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetHelpTextState
     /// </summary>
     public unsafe virtual void SetHelpTextState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetHelpTextState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHelpTextStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetHelpTextState", true);
+        var parms = new SetHelpTextState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateHelpTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateHelpText_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateHelpText
     /// </summary>
     public unsafe virtual void UpdateHelpText(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateHelpText", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateHelpTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateHelpText", true);
+        var parms = new UpdateHelpText_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GelPlacedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GelPlaced_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GelPlaced
     /// </summary>
     public unsafe virtual bool GelPlaced()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GelPlaced", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_GelPlacedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GelPlaced", true);
+        var parms = new GelPlaced_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RemovePlacedGelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemovePlacedGel_Params
+    {
     }
 
     /// <summary>
@@ -486,137 +717,218 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void RemovePlacedGel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RemovePlacedGel", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemovePlacedGelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RemovePlacedGel", true);
+        var parms = new RemovePlacedGel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateGrundyGlowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct UpdateGrundyGlow_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateGrundyGlow
     /// </summary>
     public unsafe virtual void UpdateGrundyGlow(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateGrundyGlow", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateGrundyGlowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateGrundyGlow", true);
+        var parms = new UpdateGrundyGlow_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePadGlowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdatePadGlow_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdatePadGlow
     /// </summary>
     public unsafe virtual void UpdatePadGlow(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdatePadGlow", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdatePadGlowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdatePadGlow", true);
+        var parms = new UpdatePadGlow_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayHeartBeatAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayHeartBeatAnim_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayHeartBeatAnim
     /// </summary>
     public unsafe virtual void PlayHeartBeatAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayHeartBeatAnim", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayHeartBeatAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayHeartBeatAnim", true);
+        var parms = new PlayHeartBeatAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HeartBeatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HeartBeat_Params
+    {
+    }
+
     /// <summary>
     /// Function: HeartBeat
     /// </summary>
     public unsafe virtual void HeartBeat()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartBeat", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HeartBeatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartBeat", true);
+        var parms = new HeartBeat_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateHeartBeatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateHeartBeat_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateHeartBeat
     /// </summary>
     public unsafe virtual void UpdateHeartBeat(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateHeartBeat", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateHeartBeatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateHeartBeat", true);
+        var parms = new UpdateHeartBeat_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableHeartAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableHeartAnim_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableHeartAnim
     /// </summary>
     public unsafe virtual void EnableHeartAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableHeartAnim", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableHeartAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableHeartAnim", true);
+        var parms = new EnableHeartAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableHeartAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisableHeartAnim_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisableHeartAnim
     /// </summary>
     public unsafe virtual void DisableHeartAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DisableHeartAnim", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableHeartAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DisableHeartAnim", true);
+        var parms = new DisableHeartAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearDrumPadsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearDrumPads_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearDrumPads
     /// </summary>
     public unsafe virtual void ClearDrumPads()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ClearDrumPads", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearDrumPadsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ClearDrumPads", true);
+        var parms = new ClearDrumPads_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartDrumPadsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartDrumPads_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartDrumPads
     /// </summary>
     public unsafe virtual void StartDrumPads()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartDrumPads", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartDrumPadsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartDrumPads", true);
+        var parms = new StartDrumPads_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HeartBeatMarkerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct HeartBeatMarker_Params
+    {
+        [FieldOffset(0)] public int CallbackFlags;
+        [FieldOffset(4)] public int MarkerID;
+    }
+
     /// <summary>
     /// Function: HeartBeatMarker
     /// </summary>
     public unsafe virtual void HeartBeatMarker(int CallbackFlags, int MarkerID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartBeatMarker", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CallbackFlags, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MarkerID, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HeartBeatMarkerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartBeatMarker", true);
+        var parms = new HeartBeatMarker_Params();
+        parms.CallbackFlags = CallbackFlags;
+        parms.MarkerID = MarkerID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPadGroupPosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetPadGroupPos_Params
+    {
+        [FieldOffset(0)] public int padGroup;
+        [FieldOffset(4)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetPadGroupPos
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetPadGroupPos(int padGroup)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetPadGroupPos", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(padGroup, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
+        var funcManaged = s_GetPadGroupPosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetPadGroupPos", true);
+        var parms = new GetPadGroupPos_Params();
+        parms.padGroup = padGroup;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsPadGroupActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsPadGroupActive_Params
+    {
+        [FieldOffset(0)] public int padGroup;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -624,11 +936,17 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual bool IsPadGroupActive(int padGroup)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsPadGroupActive", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(padGroup, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsPadGroupActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsPadGroupActive", true);
+        var parms = new IsPadGroupActive_Params();
+        parms.padGroup = padGroup;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TriggerPadDetonateEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TriggerPadDetonateEvent_Params
+    {
     }
 
     /// <summary>
@@ -636,67 +954,107 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void TriggerPadDetonateEvent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerPadDetonateEvent", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerPadDetonateEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.TriggerPadDetonateEvent", true);
+        var parms = new TriggerPadDetonateEvent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawPadDebugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct DrawPadDebug_Params
+    {
+    }
+
     /// <summary>
     /// Function: DrawPadDebug
     /// </summary>
     public unsafe virtual void DrawPadDebug()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DrawPadDebug", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawPadDebugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DrawPadDebug", true);
+        var parms = new DrawPadDebug_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BlowUpPadGroupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct BlowUpPadGroup_Params
+    {
+        [FieldOffset(0)] public int padGroup;
+    }
+
     /// <summary>
     /// Function: BlowUpPadGroup
     /// </summary>
     public unsafe virtual void BlowUpPadGroup(int padGroup)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.BlowUpPadGroup", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(padGroup, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BlowUpPadGroupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.BlowUpPadGroup", true);
+        var parms = new BlowUpPadGroup_Params();
+        parms.padGroup = padGroup;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrumPadExplodedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct DrumPadExploded_Params
+    {
+        [FieldOffset(0)] public nint HitPad;
+    }
+
     /// <summary>
     /// Function: DrumPadExploded
     /// </summary>
     public unsafe virtual void DrumPadExploded(BmSDK.BmScript.RGrundyDrumPad HitPad)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DrumPadExploded", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitPad, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrumPadExplodedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DrumPadExploded", true);
+        var parms = new DrumPadExploded_Params();
+        parms.HitPad = HitPad?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoMachineDisableRumbleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoMachineDisableRumble_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoMachineDisableRumble
     /// </summary>
     public unsafe virtual void DoMachineDisableRumble()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DoMachineDisableRumble", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoMachineDisableRumbleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DoMachineDisableRumble", true);
+        var parms = new DoMachineDisableRumble_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ElectricPillarsShouldBeOnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ElectricPillarsShouldBeOn_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ElectricPillarsShouldBeOn
     /// </summary>
     public unsafe virtual bool ElectricPillarsShouldBeOn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ElectricPillarsShouldBeOn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ElectricPillarsShouldBeOnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ElectricPillarsShouldBeOn", true);
+        var parms = new ElectricPillarsShouldBeOn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ArePadsVulnerableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ArePadsVulnerable_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -704,10 +1062,18 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual bool ArePadsVulnerable()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ArePadsVulnerable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ArePadsVulnerableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ArePadsVulnerable", true);
+        var parms = new ArePadsVulnerable_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsOnBeatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsOnBeat_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnBossGrundy.eGrundyBeatMatch beatMatchType;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -715,11 +1081,17 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual bool IsOnBeat(BmSDK.BmScript.RPawnBossGrundy.eGrundyBeatMatch beatMatchType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsOnBeat", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(beatMatchType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsOnBeatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsOnBeat", true);
+        var parms = new IsOnBeat_Params();
+        parms.beatMatchType = beatMatchType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StartHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartHUD_Params
+    {
     }
 
     /// <summary>
@@ -727,92 +1099,149 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void StartHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartHUD", true);
+        var parms = new StartHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateHudFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateHud_Params
+    {
+        [FieldOffset(0)] public float TimeDelta;
+    }
+
     /// <summary>
     /// Function: UpdateHud
     /// </summary>
     public unsafe virtual void UpdateHud(float TimeDelta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateHud", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimeDelta, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateHudFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateHud", true);
+        var parms = new UpdateHud_Params();
+        parms.TimeDelta = TimeDelta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopElectricsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopElectrics_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopElectrics
     /// </summary>
     public unsafe virtual void StopElectrics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopElectrics", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopElectricsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopElectrics", true);
+        var parms = new StopElectrics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GeneratorPunchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GeneratorPunch_Params
+    {
+    }
+
     /// <summary>
     /// Function: GeneratorPunch
     /// </summary>
     public unsafe virtual void GeneratorPunch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GeneratorPunch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GeneratorPunchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GeneratorPunch", true);
+        var parms = new GeneratorPunch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartElectricsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartElectrics_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartElectrics
     /// </summary>
     public unsafe virtual void StartElectrics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartElectrics", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartElectricsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartElectrics", true);
+        var parms = new StartElectrics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreStartElectricsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreStartElectrics_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreStartElectrics
     /// </summary>
     public unsafe virtual void PreStartElectrics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PreStartElectrics", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreStartElectricsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PreStartElectrics", true);
+        var parms = new PreStartElectrics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayGrundyImpactSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PlayGrundyImpactSound_Params
+    {
+        [FieldOffset(0)] public int bBigBlow;
+    }
+
     /// <summary>
     /// Function: PlayGrundyImpactSound
     /// </summary>
     public unsafe virtual void PlayGrundyImpactSound(bool bBigBlow)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayGrundyImpactSound", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bBigBlow, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayGrundyImpactSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayGrundyImpactSound", true);
+        var parms = new PlayGrundyImpactSound_Params();
+        parms.bBigBlow = bBigBlow ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DamageGrundyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct DamageGrundy_Params
+    {
+        [FieldOffset(0)] public float DamageAmount;
+        [FieldOffset(4)] public int canTriggerStageTransition;
+        [FieldOffset(8)] public int canTriggerDaze;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: DamageGrundy
     /// </summary>
     public unsafe virtual bool DamageGrundy(float DamageAmount, bool canTriggerStageTransition, bool canTriggerDaze = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DamageGrundy", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageAmount, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(canTriggerStageTransition, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(canTriggerDaze, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_DamageGrundyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DamageGrundy", true);
+        var parms = new DamageGrundy_Params();
+        parms.DamageAmount = DamageAmount;
+        parms.canTriggerStageTransition = canTriggerStageTransition ? 1 : 0;
+        parms.canTriggerDaze = canTriggerDaze ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanRepelAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CanRepelAttack_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+        [FieldOffset(4)] public nint DamageType;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -820,12 +1249,18 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override bool CanRepelAttack(BmSDK.BmGame.RPawnCombat Attacker, BmSDK.Class DamageType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CanRepelAttack", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_CanRepelAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CanRepelAttack", true);
+        var parms = new CanRepelAttack_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Destroyed_Params
+    {
     }
 
     /// <summary>
@@ -833,21 +1268,36 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override void Destroyed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.Destroyed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.Destroyed", true);
+        var parms = new Destroyed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanInRangeForStompFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BatmanInRangeForStomp_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: BatmanInRangeForStomp
     /// </summary>
     public unsafe virtual bool BatmanInRangeForStomp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.BatmanInRangeForStomp", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_BatmanInRangeForStompFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.BatmanInRangeForStomp", true);
+        var parms = new BatmanInRangeForStomp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AllowCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AllowCamera_Params
+    {
+        [FieldOffset(0)] public nint SpecialMove;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -855,11 +1305,17 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override bool AllowCamera(BmSDK.BmGame.RSpecialMoveConfig SpecialMove)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.AllowCamera", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpecialMove, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_AllowCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.AllowCamera", true);
+        var parms = new AllowCamera_Params();
+        parms.SpecialMove = SpecialMove?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PrepareMaterialsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PrepareMaterials_Params
+    {
     }
 
     /// <summary>
@@ -867,43 +1323,69 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void PrepareMaterials()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PrepareMaterials", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PrepareMaterialsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PrepareMaterials", true);
+        var parms = new PrepareMaterials_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnMaggotsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SpawnMaggots_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnMaggots
     /// </summary>
     public unsafe virtual void SpawnMaggots()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnMaggots", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnMaggotsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnMaggots", true);
+        var parms = new SpawnMaggots_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetMaggotDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetMaggotDamage_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetMaggotDamage
     /// </summary>
     public unsafe virtual float GetMaggotDamage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetMaggotDamage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetMaggotDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetMaggotDamage", true);
+        var parms = new GetMaggotDamage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetMaggotSpawnSocketFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetMaggotSpawnSocket_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ReturnValue;
     }
 
     /// <summary>
@@ -911,10 +1393,18 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual BmSDK.FName GetMaggotSpawnSocket()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetMaggotSpawnSocket", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
+        var funcManaged = s_GetMaggotSpawnSocketFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetMaggotSpawnSocket", true);
+        var parms = new GetMaggotSpawnSocket_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_KeepInViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct KeepInView_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+        [FieldOffset(4)] public float MaxYaw;
     }
 
     /// <summary>
@@ -922,46 +1412,72 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void KeepInView(BmSDK.Engine.Actor Pawn, float MaxYaw = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KeepInView", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxYaw, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KeepInViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KeepInView", true);
+        var parms = new KeepInView_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        parms.MaxYaw = MaxYaw;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateKeepInViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateKeepInViewTarget_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateKeepInViewTarget
     /// </summary>
     public unsafe virtual void UpdateKeepInViewTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateKeepInViewTarget", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateKeepInViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateKeepInViewTarget", true);
+        var parms = new UpdateKeepInViewTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateVFXPositionsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct UpdateVFXPositions_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateVFXPositions
     /// </summary>
     public unsafe virtual void UpdateVFXPositions()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateVFXPositions", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateVFXPositionsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateVFXPositions", true);
+        var parms = new UpdateVFXPositions_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DamagedByFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 245)]
+    private struct DamagedBy_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo;
+        [FieldOffset(244)] public BmSDK.BmGame.RPawnCombat.DamageResult ReturnValue;
+    }
+
     /// <summary>
     /// Function: DamagedBy
     /// </summary>
     public unsafe override BmSDK.BmGame.RPawnCombat.DamageResult DamagedBy(BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DamagedBy", true);
-        byte* paramsPtr = stackalloc byte[245];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DmgInfo, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnCombat.DamageResult>(paramsPtr + 244);
+        var funcManaged = s_DamagedByFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DamagedBy", true);
+        var parms = new DamagedBy_Params();
+        parms.DmgInfo = DmgInfo;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DisallowBeatingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisallowBeating_Params
+    {
     }
 
     /// <summary>
@@ -969,32 +1485,52 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void DisallowBeating()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DisallowBeating", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisallowBeatingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DisallowBeating", true);
+        var parms = new DisallowBeating_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AllowBeatingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AllowBeating_Params
+    {
+    }
+
     /// <summary>
     /// Function: AllowBeating
     /// </summary>
     public unsafe virtual void AllowBeating()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.AllowBeating", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AllowBeatingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.AllowBeating", true);
+        var parms = new AllowBeating_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BossCanTakeGooHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BossCanTakeGooHit_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: BossCanTakeGooHit
     /// </summary>
     public unsafe override bool BossCanTakeGooHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.BossCanTakeGooHit", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_BossCanTakeGooHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.BossCanTakeGooHit", true);
+        var parms = new BossCanTakeGooHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanBeGlideKickedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanBeGlideKicked_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1002,10 +1538,17 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override bool CanBeGlideKicked()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CanBeGlideKicked", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanBeGlideKickedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CanBeGlideKicked", true);
+        var parms = new CanBeGlideKicked_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsBossFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsBoss_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1013,10 +1556,16 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override bool IsBoss()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsBoss", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsBossFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsBoss", true);
+        var parms = new IsBoss_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DouseFlamesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DouseFlames_Params
+    {
     }
 
     /// <summary>
@@ -1024,100 +1573,160 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void DouseFlames()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DouseFlames", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DouseFlamesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DouseFlames", true);
+        var parms = new DouseFlames_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRibsDamageStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct SetRibsDamageState_Params
+    {
+        [FieldOffset(0)] public int Index;
+        [FieldOffset(4)] public int doFX;
+    }
+
     /// <summary>
     /// Function: SetRibsDamageState
     /// </summary>
     public unsafe virtual void SetRibsDamageState(int Index, bool doFX = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetRibsDamageState", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(doFX, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRibsDamageStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetRibsDamageState", true);
+        var parms = new SetRibsDamageState_Params();
+        parms.Index = Index;
+        parms.doFX = doFX ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDepthBiasOnEmissiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct SetDepthBiasOnEmissive_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetDepthBiasOnEmissive
     /// </summary>
     public unsafe virtual void SetDepthBiasOnEmissive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetDepthBiasOnEmissive", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDepthBiasOnEmissiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetDepthBiasOnEmissive", true);
+        var parms = new SetDepthBiasOnEmissive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwapToBurntMatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SwapToBurntMats_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwapToBurntMats
     /// </summary>
     public unsafe virtual void SwapToBurntMats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwapToBurntMats", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwapToBurntMatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwapToBurntMats", true);
+        var parms = new SwapToBurntMats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwitchToUnBurntFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SwitchToUnBurnt_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwitchToUnBurnt
     /// </summary>
     public unsafe virtual void SwitchToUnBurnt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwitchToUnBurnt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwitchToUnBurntFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwitchToUnBurnt", true);
+        var parms = new SwitchToUnBurnt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwitchToBurntFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SwitchToBurnt_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwitchToBurnt
     /// </summary>
     public unsafe virtual void SwitchToBurnt()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwitchToBurnt", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwitchToBurntFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwitchToBurnt", true);
+        var parms = new SwitchToBurnt_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Ignite2Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Ignite2_Params
+    {
+    }
+
     /// <summary>
     /// Function: Ignite2
     /// </summary>
     public unsafe virtual void Ignite2()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.Ignite2", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Ignite2Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.Ignite2", true);
+        var parms = new Ignite2_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IgniteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Ignite_Params
+    {
+    }
+
     /// <summary>
     /// Function: Ignite
     /// </summary>
     public unsafe override void Ignite()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.Ignite", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IgniteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.Ignite", true);
+        var parms = new Ignite_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InputRightStickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct InputRightStick_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: InputRightStick
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 InputRightStick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.InputRightStick", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_InputRightStickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.InputRightStick", true);
+        var parms = new InputRightStick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SpawnSpecialAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SpawnSpecialAttack_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public nint dmgType;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1125,12 +1734,19 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override bool SpawnSpecialAttack(BmSDK.BmGame.RPawnPlayerCombat PlayerPawn, BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnSpecialAttack", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_SpawnSpecialAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnSpecialAttack", true);
+        var parms = new SpawnSpecialAttack_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanRedirectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanRedirect_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1138,10 +1754,16 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override bool CanRedirect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CanRedirect", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanRedirectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CanRedirect", true);
+        var parms = new CanRedirect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_EnableKeepInViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableKeepInView_Params
+    {
     }
 
     /// <summary>
@@ -1149,93 +1771,149 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void EnableKeepInView()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableKeepInView", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableKeepInViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableKeepInView", true);
+        var parms = new EnableKeepInView_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MudSplatterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct MudSplatter_Params
+    {
+    }
+
     /// <summary>
     /// Function: MudSplatter
     /// </summary>
     public unsafe virtual void MudSplatter()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.MudSplatter", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MudSplatterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.MudSplatter", true);
+        var parms = new MudSplatter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveCounterIconFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveCounterIcon_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveCounterIcon
     /// </summary>
     public unsafe override void RemoveCounterIcon()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RemoveCounterIcon", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveCounterIconFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RemoveCounterIcon", true);
+        var parms = new RemoveCounterIcon_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopAttackingFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StopAttackingFX_Params
+    {
+        [FieldOffset(0)] public int bSuccess;
+    }
+
     /// <summary>
     /// Function: StopAttackingFX
     /// </summary>
     public unsafe override void StopAttackingFX(bool bSuccess = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopAttackingFX", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSuccess, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopAttackingFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopAttackingFX", true);
+        var parms = new StopAttackingFX_Params();
+        parms.bSuccess = bSuccess ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartAttackingFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct StartAttackingFX_Params
+    {
+        [FieldOffset(0)] public int CTypeInt;
+        [FieldOffset(4)] public nint PC;
+    }
+
     /// <summary>
     /// Function: StartAttackingFX
     /// </summary>
     public unsafe override void StartAttackingFX(int CTypeInt, BmSDK.BmGame.RPlayerController PC = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartAttackingFX", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CTypeInt, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartAttackingFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartAttackingFX", true);
+        var parms = new StartAttackingFX_Params();
+        parms.CTypeInt = CTypeInt;
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayPunchedInHeadAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlayPunchedInHeadAnim_Params
+    {
+        [FieldOffset(0)] public int bLeftPunch;
+    }
+
     /// <summary>
     /// Function: PlayPunchedInHeadAnim
     /// </summary>
     public unsafe virtual void PlayPunchedInHeadAnim(bool bLeftPunch)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayPunchedInHeadAnim", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLeftPunch, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayPunchedInHeadAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayPunchedInHeadAnim", true);
+        var parms = new PlayPunchedInHeadAnim_Params();
+        parms.bLeftPunch = bLeftPunch ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateCinematicCamExtraRotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct UpdateCinematicCamExtraRot_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateCinematicCamExtraRot
     /// </summary>
     public unsafe virtual void UpdateCinematicCamExtraRot(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateCinematicCamExtraRot", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateCinematicCamExtraRotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateCinematicCamExtraRot", true);
+        var parms = new UpdateCinematicCamExtraRot_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoesCameraMaintainLosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct DoesCameraMaintainLos_Params
+    {
+        [FieldOffset(0)] public nint CinematicCamera;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: DoesCameraMaintainLos
     /// </summary>
     public unsafe virtual bool DoesCameraMaintainLos(BmSDK.BmGame.RInGameCinematicCam CinematicCamera)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DoesCameraMaintainLos", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CinematicCamera, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_DoesCameraMaintainLosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DoesCameraMaintainLos", true);
+        var parms = new DoesCameraMaintainLos_Params();
+        parms.CinematicCamera = CinematicCamera?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StopCinematicCameraAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StopCinematicCameraAnim_Params
+    {
+        [FieldOffset(0)] public float BlendTime;
     }
 
     /// <summary>
@@ -1243,40 +1921,66 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void StopCinematicCameraAnim(float BlendTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopCinematicCameraAnim", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopCinematicCameraAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopCinematicCameraAnim", true);
+        var parms = new StopCinematicCameraAnim_Params();
+        parms.BlendTime = BlendTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BlendFromCinematicToGrundyCamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct BlendFromCinematicToGrundyCam_Params
+    {
+    }
+
     /// <summary>
     /// Function: BlendFromCinematicToGrundyCam
     /// </summary>
     public unsafe virtual void BlendFromCinematicToGrundyCam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.BlendFromCinematicToGrundyCam", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BlendFromCinematicToGrundyCamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.BlendFromCinematicToGrundyCam", true);
+        var parms = new BlendFromCinematicToGrundyCam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayCinematicCameraAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct PlayCinematicCameraAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName AnimName;
+        [FieldOffset(8)] public System.Numerics.Vector3 rootLoc;
+        [FieldOffset(20)] public BmSDK.Rotator RootRot;
+        [FieldOffset(32)] public float BlendTime;
+        [FieldOffset(36)] public float StartTime;
+        [FieldOffset(40)] public int bCheckOcclusion;
+        [FieldOffset(44)] public int bBlendBackToGrundy;
+        [FieldOffset(48)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PlayCinematicCameraAnim
     /// </summary>
     public unsafe virtual bool PlayCinematicCameraAnim(BmSDK.FName AnimName, System.Numerics.Vector3 rootLoc, BmSDK.Rotator RootRot, float BlendTime = default, float StartTime = default, bool bCheckOcclusion = default, bool bBlendBackToGrundy = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayCinematicCameraAnim", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(rootLoc, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RootRot, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendTime, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartTime, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCheckOcclusion, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bBlendBackToGrundy, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 48);
+        var funcManaged = s_PlayCinematicCameraAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayCinematicCameraAnim", true);
+        var parms = new PlayCinematicCameraAnim_Params();
+        parms.AnimName = AnimName;
+        parms.rootLoc = rootLoc;
+        parms.RootRot = RootRot;
+        parms.BlendTime = BlendTime;
+        parms.StartTime = StartTime;
+        parms.bCheckOcclusion = bCheckOcclusion ? 1 : 0;
+        parms.bBlendBackToGrundy = bBlendBackToGrundy ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StopMeleeCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopMeleeCamera_Params
+    {
     }
 
     /// <summary>
@@ -1284,57 +1988,94 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override void StopMeleeCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopMeleeCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopMeleeCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopMeleeCamera", true);
+        var parms = new StopMeleeCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KillAllMaggotsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct KillAllMaggots_Params
+    {
+    }
+
     /// <summary>
     /// Function: KillAllMaggots
     /// </summary>
     public unsafe virtual void KillAllMaggots()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KillAllMaggots", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KillAllMaggotsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KillAllMaggots", true);
+        var parms = new KillAllMaggots_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnSingleMaggotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SpawnSingleMaggot_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 SpawnLoc;
+        [FieldOffset(12)] public BmSDK.Rotator SpawnRot;
+    }
+
     /// <summary>
     /// Function: SpawnSingleMaggot
     /// </summary>
     public unsafe override void SpawnSingleMaggot(System.Numerics.Vector3 SpawnLoc, BmSDK.Rotator SpawnRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnSingleMaggot", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SpawnRot, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnSingleMaggotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnSingleMaggot", true);
+        var parms = new SpawnSingleMaggot_Params();
+        parms.SpawnLoc = SpawnLoc;
+        parms.SpawnRot = SpawnRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckMaggotsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckMaggots_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckMaggots
     /// </summary>
     public unsafe virtual void CheckMaggots()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CheckMaggots", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckMaggotsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CheckMaggots", true);
+        var parms = new CheckMaggots_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsVulnerableToTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct IsVulnerableToTakedown_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString takedown;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsVulnerableToTakedown
     /// </summary>
     public unsafe override bool IsVulnerableToTakedown(BmSDK.FString takedown)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsVulnerableToTakedown", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(takedown, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsVulnerableToTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsVulnerableToTakedown", true);
+        var parms = new IsVulnerableToTakedown_Params();
+        parms.takedown = takedown;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsAwareOfPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsAwareOfPlayer_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public nint dmgType;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1342,12 +2083,18 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override bool IsAwareOfPlayer(BmSDK.BmGame.RPawnPlayer PlayerPawn, BmSDK.Class dmgType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsAwareOfPlayer", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_IsAwareOfPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IsAwareOfPlayer", true);
+        var parms = new IsAwareOfPlayer_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HeartGoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HeartGone_Params
+    {
     }
 
     /// <summary>
@@ -1355,157 +2102,248 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void HeartGone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartGone", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HeartGoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartGone", true);
+        var parms = new HeartGone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HeartRemovedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HeartRemoved_Params
+    {
+    }
+
     /// <summary>
     /// Function: HeartRemoved
     /// </summary>
     public unsafe virtual void HeartRemoved()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartRemoved", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HeartRemovedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartRemoved", true);
+        var parms = new HeartRemoved_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HeartPunchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HeartPunch_Params
+    {
+    }
+
     /// <summary>
     /// Function: HeartPunch
     /// </summary>
     public unsafe virtual void HeartPunch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartPunch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HeartPunchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HeartPunch", true);
+        var parms = new HeartPunch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KillAllGroundRingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct KillAllGroundRings_Params
+    {
+    }
+
     /// <summary>
     /// Function: KillAllGroundRings
     /// </summary>
     public unsafe virtual void KillAllGroundRings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KillAllGroundRings", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KillAllGroundRingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KillAllGroundRings", true);
+        var parms = new KillAllGroundRings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFloorRingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 172)]
+    private struct UpdateFloorRings_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateFloorRings
     /// </summary>
     public unsafe virtual void UpdateFloorRings(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateFloorRings", true);
-        byte* paramsPtr = stackalloc byte[172];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateFloorRingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateFloorRings", true);
+        var parms = new UpdateFloorRings_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KillAllFloorSparksFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct KillAllFloorSparks_Params
+    {
+    }
+
     /// <summary>
     /// Function: KillAllFloorSparks
     /// </summary>
     public unsafe virtual void KillAllFloorSparks()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KillAllFloorSparks", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KillAllFloorSparksFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KillAllFloorSparks", true);
+        var parms = new KillAllFloorSparks_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFloorSparksFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 148)]
+    private struct UpdateFloorSparks_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateFloorSparks
     /// </summary>
     public unsafe virtual void UpdateFloorSparks(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateFloorSparks", true);
-        byte* paramsPtr = stackalloc byte[148];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateFloorSparksFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateFloorSparks", true);
+        var parms = new UpdateFloorSparks_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnFloorRingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnFloorRing_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnFloorRing
     /// </summary>
     public unsafe virtual void SpawnFloorRing()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnFloorRing", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnFloorRingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnFloorRing", true);
+        var parms = new SpawnFloorRing_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnFloorRingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SpawnFloorRings_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnFloorRings
     /// </summary>
     public unsafe virtual void SpawnFloorRings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnFloorRings", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnFloorRingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnFloorRings", true);
+        var parms = new SpawnFloorRings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartFloorSparksFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct StartFloorSparks_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartFloorSparks
     /// </summary>
     public unsafe virtual void StartFloorSparks()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartFloorSparks", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartFloorSparksFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartFloorSparks", true);
+        var parms = new StartFloorSparks_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnElectricAttackExtrasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SpawnElectricAttackExtras_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnElectricAttackExtras
     /// </summary>
     public unsafe virtual void SpawnElectricAttackExtras()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnElectricAttackExtras", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnElectricAttackExtrasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnElectricAttackExtras", true);
+        var parms = new SpawnElectricAttackExtras_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReadSmashNotifiesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReadSmashNotifies_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReadSmashNotifies
     /// </summary>
     public unsafe virtual void ReadSmashNotifies()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ReadSmashNotifies", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReadSmashNotifiesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ReadSmashNotifies", true);
+        var parms = new ReadSmashNotifies_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFirePatchsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct UpdateFirePatchs_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateFirePatchs
     /// </summary>
     public unsafe virtual void UpdateFirePatchs(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateFirePatchs", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateFirePatchsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateFirePatchs", true);
+        var parms = new UpdateFirePatchs_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwingStartedCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SwingStartedCallback_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId NextAnim;
+    }
+
     /// <summary>
     /// Function: SwingStartedCallback
     /// </summary>
     public unsafe virtual void SwingStartedCallback(BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId NextAnim)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwingStartedCallback", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NextAnim, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return;
+        var funcManaged = s_SwingStartedCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwingStartedCallback", true);
+        var parms = new SwingStartedCallback_Params();
+        parms.NextAnim = NextAnim;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return;
+    }
+
+    static BmSDK.Function s_ElectrocuteBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 280)]
+    private struct ElectrocuteBatman_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 fromLocation;
+        [FieldOffset(12)] public nint Damager;
+        [FieldOffset(16)] public int canDoDamage;
     }
 
     /// <summary>
@@ -1513,443 +2351,702 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void ElectrocuteBatman(System.Numerics.Vector3 fromLocation, BmSDK.BmGame.RPawnCombat Damager, bool canDoDamage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ElectrocuteBatman", true);
-        byte* paramsPtr = stackalloc byte[280];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(fromLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Damager, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(canDoDamage, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ElectrocuteBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ElectrocuteBatman", true);
+        var parms = new ElectrocuteBatman_Params();
+        parms.fromLocation = fromLocation;
+        parms.Damager = Damager?.Ptr ?? 0;
+        parms.canDoDamage = canDoDamage ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishBMCombatMoveNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinishBMCombatMoveNotify_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinishBMCombatMoveNotify
     /// </summary>
     public unsafe virtual void FinishBMCombatMoveNotify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FinishBMCombatMoveNotify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishBMCombatMoveNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FinishBMCombatMoveNotify", true);
+        var parms = new FinishBMCombatMoveNotify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishBMCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FinishBMCombatMove_Params
+    {
+        [FieldOffset(0)] public int FinishAnim;
+    }
+
     /// <summary>
     /// Function: FinishBMCombatMove
     /// </summary>
     public unsafe virtual void FinishBMCombatMove(bool FinishAnim = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FinishBMCombatMove", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinishAnim, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishBMCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.FinishBMCombatMove", true);
+        var parms = new FinishBMCombatMove_Params();
+        parms.FinishAnim = FinishAnim ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartBMCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartBMCombatMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartBMCombatMove
     /// </summary>
     public unsafe virtual void StartBMCombatMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartBMCombatMove", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartBMCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartBMCombatMove", true);
+        var parms = new StartBMCombatMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwapChainEndsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct SwapChainEnds_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwapChainEnds
     /// </summary>
     public unsafe virtual void SwapChainEnds()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwapChainEnds", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwapChainEndsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SwapChainEnds", true);
+        var parms = new SwapChainEnds_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReleaseChainsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReleaseChains_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReleaseChains
     /// </summary>
     public unsafe virtual void ReleaseChains()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ReleaseChains", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReleaseChainsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ReleaseChains", true);
+        var parms = new ReleaseChains_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HoldChainsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HoldChains_Params
+    {
+    }
+
     /// <summary>
     /// Function: HoldChains
     /// </summary>
     public unsafe virtual void HoldChains()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HoldChains", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HoldChainsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.HoldChains", true);
+        var parms = new HoldChains_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartBMCrushMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 116)]
+    private struct StartBMCrushMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartBMCrushMove
     /// </summary>
     public unsafe virtual void StartBMCrushMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartBMCrushMove", true);
-        byte* paramsPtr = stackalloc byte[116];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartBMCrushMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartBMCrushMove", true);
+        var parms = new StartBMCrushMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeMeshMatsForXrayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ChangeMeshMatsForXray_Params
+    {
+        [FieldOffset(0)] public int meshIndex;
+        [FieldOffset(4)] public nint ChangeMesh;
+        [FieldOffset(8)] public nint DefaultMesh;
+        [FieldOffset(12)] public nint OverrideMaterial;
+        [FieldOffset(16)] public float translucencyPri;
+    }
+
     /// <summary>
     /// Function: ChangeMeshMatsForXray
     /// </summary>
     public unsafe virtual void ChangeMeshMatsForXray(int meshIndex, BmSDK.Engine.SkeletalMeshComponent ChangeMesh, BmSDK.Engine.SkeletalMeshComponent DefaultMesh, BmSDK.Engine.MaterialInterface OverrideMaterial, float translucencyPri)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ChangeMeshMatsForXray", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(meshIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChangeMesh, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DefaultMesh, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OverrideMaterial, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(translucencyPri, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeMeshMatsForXrayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ChangeMeshMatsForXray", true);
+        var parms = new ChangeMeshMatsForXray_Params();
+        parms.meshIndex = meshIndex;
+        parms.ChangeMesh = ChangeMesh?.Ptr ?? 0;
+        parms.DefaultMesh = DefaultMesh?.Ptr ?? 0;
+        parms.OverrideMaterial = OverrideMaterial?.Ptr ?? 0;
+        parms.translucencyPri = translucencyPri;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeRopeMatsForXrayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ChangeRopeMatsForXray_Params
+    {
+        [FieldOffset(0)] public nint ChangeMesh;
+    }
+
     /// <summary>
     /// Function: ChangeRopeMatsForXray
     /// </summary>
     public unsafe virtual void ChangeRopeMatsForXray(BmSDK.BmGame.RGrundyRopeComponent ChangeMesh)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ChangeRopeMatsForXray", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ChangeMesh, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeRopeMatsForXrayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ChangeRopeMatsForXray", true);
+        var parms = new ChangeRopeMatsForXray_Params();
+        parms.ChangeMesh = ChangeMesh?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPropsInXrayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetPropsInXray_Params
+    {
+        [FieldOffset(0)] public int bActivate;
+    }
+
     /// <summary>
     /// Function: SetPropsInXray
     /// </summary>
     public unsafe override void SetPropsInXray(bool bActivate)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetPropsInXray", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bActivate, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPropsInXrayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetPropsInXray", true);
+        var parms = new SetPropsInXray_Params();
+        parms.bActivate = bActivate ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInXrayModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetInXrayMode_Params
+    {
+        [FieldOffset(0)] public int show;
+        [FieldOffset(4)] public int bForceOff;
+    }
+
     /// <summary>
     /// Function: SetInXrayMode
     /// </summary>
     public unsafe override void SetInXrayMode(bool show, bool bForceOff)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetInXrayMode", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(show, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForceOff, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInXrayModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetInXrayMode", true);
+        var parms = new SetInXrayMode_Params();
+        parms.show = show ? 1 : 0;
+        parms.bForceOff = bForceOff ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RechargeHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RechargeHealth_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: RechargeHealth
     /// </summary>
     public unsafe virtual void RechargeHealth(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RechargeHealth", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RechargeHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RechargeHealth", true);
+        var parms = new RechargeHealth_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DegenerateHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DegenerateHealth_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: DegenerateHealth
     /// </summary>
     public unsafe virtual void DegenerateHealth(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DegenerateHealth", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DegenerateHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DegenerateHealth", true);
+        var parms = new DegenerateHealth_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateRotatingConductorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct UpdateRotatingConductors_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateRotatingConductors
     /// </summary>
     public unsafe virtual void UpdateRotatingConductors(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateRotatingConductors", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateRotatingConductorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateRotatingConductors", true);
+        var parms = new UpdateRotatingConductors_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DeactivateElectricityPillarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DeactivateElectricityPillar_Params
+    {
+        [FieldOffset(0)] public int Index;
+    }
+
     /// <summary>
     /// Function: DeactivateElectricityPillar
     /// </summary>
     public unsafe virtual void DeactivateElectricityPillar(int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DeactivateElectricityPillar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DeactivateElectricityPillarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DeactivateElectricityPillar", true);
+        var parms = new DeactivateElectricityPillar_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateElectricityPillarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ActivateElectricityPillar_Params
+    {
+        [FieldOffset(0)] public int I;
+    }
+
     /// <summary>
     /// Function: ActivateElectricityPillar
     /// </summary>
     public unsafe virtual void ActivateElectricityPillar(int I)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ActivateElectricityPillar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(I, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateElectricityPillarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ActivateElectricityPillar", true);
+        var parms = new ActivateElectricityPillar_Params();
+        parms.I = I;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DeactivateAllElectricityPillarsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DeactivateAllElectricityPillars_Params
+    {
+    }
+
     /// <summary>
     /// Function: DeactivateAllElectricityPillars
     /// </summary>
     public unsafe virtual void DeactivateAllElectricityPillars()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DeactivateAllElectricityPillars", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DeactivateAllElectricityPillarsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DeactivateAllElectricityPillars", true);
+        var parms = new DeactivateAllElectricityPillars_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateAllElectricityPillarsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ActivateAllElectricityPillars_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateAllElectricityPillars
     /// </summary>
     public unsafe virtual void ActivateAllElectricityPillars()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ActivateAllElectricityPillars", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateAllElectricityPillarsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.ActivateAllElectricityPillars", true);
+        var parms = new ActivateAllElectricityPillars_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForPillarsHittingMaggotsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct CheckForPillarsHittingMaggots_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckForPillarsHittingMaggots
     /// </summary>
     public unsafe virtual void CheckForPillarsHittingMaggots()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CheckForPillarsHittingMaggots", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckForPillarsHittingMaggotsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CheckForPillarsHittingMaggots", true);
+        var parms = new CheckForPillarsHittingMaggots_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateElectricityPillarsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 120)]
+    private struct UpdateElectricityPillars_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateElectricityPillars
     /// </summary>
     public unsafe virtual void UpdateElectricityPillars()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateElectricityPillars", true);
-        byte* paramsPtr = stackalloc byte[120];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateElectricityPillarsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateElectricityPillars", true);
+        var parms = new UpdateElectricityPillars_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitElectricityPillarsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct InitElectricityPillars_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitElectricityPillars
     /// </summary>
     public unsafe virtual void InitElectricityPillars()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.InitElectricityPillars", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitElectricityPillarsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.InitElectricityPillars", true);
+        var parms = new InitElectricityPillars_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UndoPillarDisablingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UndoPillarDisabling_Params
+    {
+    }
+
     /// <summary>
     /// Function: UndoPillarDisabling
     /// </summary>
     public unsafe virtual void UndoPillarDisabling()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UndoPillarDisabling", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UndoPillarDisablingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UndoPillarDisabling", true);
+        var parms = new UndoPillarDisabling_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisablePillarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisablePillar_Params
+    {
+        [FieldOffset(0)] public int Index;
+    }
+
     /// <summary>
     /// Function: DisablePillar
     /// </summary>
     public unsafe virtual void DisablePillar(int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DisablePillar", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisablePillarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DisablePillar", true);
+        var parms = new DisablePillar_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePillarDisablingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UpdatePillarDisabling_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdatePillarDisabling
     /// </summary>
     public unsafe virtual void UpdatePillarDisabling(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdatePillarDisabling", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdatePillarDisablingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdatePillarDisabling", true);
+        var parms = new UpdatePillarDisabling_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RechargeInCallbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RechargeInCallback_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId NextAnim;
+    }
+
     /// <summary>
     /// Function: RechargeInCallback
     /// </summary>
     public unsafe virtual void RechargeInCallback(BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId NextAnim)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RechargeInCallback", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NextAnim, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RechargeInCallbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.RechargeInCallback", true);
+        var parms = new RechargeInCallback_Params();
+        parms.NextAnim = NextAnim;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PauseCapeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PauseCape_Params
+    {
+    }
+
     /// <summary>
     /// Function: PauseCape
     /// </summary>
     public unsafe virtual void PauseCape()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PauseCape", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PauseCapeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PauseCape", true);
+        var parms = new PauseCape_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSinglePadStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct SetSinglePadState_Params
+    {
+        [FieldOffset(0)] public int padIndex;
+        [FieldOffset(4)] public BmSDK.BmScript.RGrundyDrumPad.eDrumPadLightStates padState;
+    }
+
     /// <summary>
     /// Function: SetSinglePadState
     /// </summary>
     public unsafe virtual void SetSinglePadState(int padIndex, BmSDK.BmScript.RGrundyDrumPad.eDrumPadLightStates padState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetSinglePadState", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(padIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(padState, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSinglePadStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetSinglePadState", true);
+        var parms = new SetSinglePadState_Params();
+        parms.padIndex = padIndex;
+        parms.padState = padState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPadStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetPadState_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RGrundyDrumPad.eDrumPadLightStates padState;
+    }
+
     /// <summary>
     /// Function: SetPadState
     /// </summary>
     public unsafe virtual void SetPadState(BmSDK.BmScript.RGrundyDrumPad.eDrumPadLightStates padState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetPadState", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(padState, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPadStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetPadState", true);
+        var parms = new SetPadState_Params();
+        parms.padState = padState;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetGrundymaticModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetGrundymaticMode_Params
+    {
+        [FieldOffset(0)] public int bEnable;
+    }
+
     /// <summary>
     /// Function: SetGrundymaticMode
     /// </summary>
     public unsafe virtual void SetGrundymaticMode(bool bEnable)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetGrundymaticMode", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnable, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetGrundymaticModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetGrundymaticMode", true);
+        var parms = new SetGrundymaticMode_Params();
+        parms.bEnable = bEnable ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CrushKickNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CrushKickNotify_Params
+    {
+    }
+
     /// <summary>
     /// Function: CrushKickNotify
     /// </summary>
     public unsafe virtual void CrushKickNotify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CrushKickNotify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CrushKickNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.CrushKickNotify", true);
+        var parms = new CrushKickNotify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SurpriseNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SurpriseNotify_Params
+    {
+    }
+
     /// <summary>
     /// Function: SurpriseNotify
     /// </summary>
     public unsafe virtual void SurpriseNotify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SurpriseNotify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SurpriseNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SurpriseNotify", true);
+        var parms = new SurpriseNotify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableRoomCogsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct EnableRoomCogs_Params
+    {
+        [FieldOffset(0)] public int bEnabled;
+        [FieldOffset(4)] public int bInstant;
+    }
+
     /// <summary>
     /// Function: EnableRoomCogs
     /// </summary>
     public unsafe virtual void EnableRoomCogs(bool bEnabled, bool bInstant = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableRoomCogs", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnabled, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstant, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableRoomCogsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableRoomCogs", true);
+        var parms = new EnableRoomCogs_Params();
+        parms.bEnabled = bEnabled ? 1 : 0;
+        parms.bInstant = bInstant ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnablePadCogsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct EnablePadCogs_Params
+    {
+        [FieldOffset(0)] public int padIndex;
+        [FieldOffset(4)] public int bEnabled;
+        [FieldOffset(8)] public int bInstant;
+    }
+
     /// <summary>
     /// Function: EnablePadCogs
     /// </summary>
     public unsafe virtual void EnablePadCogs(int padIndex, bool bEnabled, bool bInstant = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnablePadCogs", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(padIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnabled, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstant, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnablePadCogsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnablePadCogs", true);
+        var parms = new EnablePadCogs_Params();
+        parms.padIndex = padIndex;
+        parms.bEnabled = bEnabled ? 1 : 0;
+        parms.bInstant = bInstant ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateSingleCogMatineeSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateSingleCogMatineeSpeed_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+        [FieldOffset(4)] public nint Matinee;
+        [FieldOffset(8)] public int bEnabled;
+    }
+
     /// <summary>
     /// Function: UpdateSingleCogMatineeSpeed
     /// </summary>
     public unsafe virtual void UpdateSingleCogMatineeSpeed(float UpdateTime, BmSDK.Engine.SeqAct_Interp Matinee, bool bEnabled)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateSingleCogMatineeSpeed", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Matinee, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnabled, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateSingleCogMatineeSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateSingleCogMatineeSpeed", true);
+        var parms = new UpdateSingleCogMatineeSpeed_Params();
+        parms.UpdateTime = UpdateTime;
+        parms.Matinee = Matinee?.Ptr ?? 0;
+        parms.bEnabled = bEnabled ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateCogSpeedsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateCogSpeeds_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateCogSpeeds
     /// </summary>
     public unsafe virtual void UpdateCogSpeeds(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateCogSpeeds", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateCogSpeedsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateCogSpeeds", true);
+        var parms = new UpdateCogSpeeds_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetClosestActivePadLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetClosestActivePadLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TestLoc;
+        [FieldOffset(12)] public System.Numerics.Vector3 ResultLoc;
+        [FieldOffset(24)] public int bIgnoreIdlePads;
+        [FieldOffset(28)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetClosestActivePadLocation
     /// </summary>
     public unsafe virtual bool GetClosestActivePadLocation(System.Numerics.Vector3 TestLoc, out System.Numerics.Vector3 ResultLoc, bool bIgnoreIdlePads = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetClosestActivePadLocation", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnoreIdlePads, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ResultLoc = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_GetClosestActivePadLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetClosestActivePadLocation", true);
+        var parms = new GetClosestActivePadLocation_Params();
+        parms.TestLoc = TestLoc;
+        parms.bIgnoreIdlePads = bIgnoreIdlePads ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ResultLoc = parms.ResultLoc;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetSafeDirectionForKnockBackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 112)]
+    private struct GetSafeDirectionForKnockBack_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 DesiredDir;
+        [FieldOffset(12)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -1957,11 +3054,18 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetSafeDirectionForKnockBack(System.Numerics.Vector3 DesiredDir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetSafeDirectionForKnockBack", true);
-        byte* paramsPtr = stackalloc byte[112];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredDir, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetSafeDirectionForKnockBackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetSafeDirectionForKnockBack", true);
+        var parms = new GetSafeDirectionForKnockBack_Params();
+        parms.DesiredDir = DesiredDir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_AreMaggotsActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct AreMaggotsActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1969,10 +3073,17 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual bool AreMaggotsActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.AreMaggotsActive", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AreMaggotsActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.AreMaggotsActive", true);
+        var parms = new AreMaggotsActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DoOverchargeExplosionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DoOverchargeExplosion_Params
+    {
+        [FieldOffset(0)] public int Index;
     }
 
     /// <summary>
@@ -1980,271 +3091,424 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void DoOverchargeExplosion(int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DoOverchargeExplosion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoOverchargeExplosionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DoOverchargeExplosion", true);
+        var parms = new DoOverchargeExplosion_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion10Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion10_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion10
     /// </summary>
     public unsafe virtual void OverchargeExplosion10()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion10", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion10Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion10", true);
+        var parms = new OverchargeExplosion10_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion9Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion9_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion9
     /// </summary>
     public unsafe virtual void OverchargeExplosion9()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion9", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion9Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion9", true);
+        var parms = new OverchargeExplosion9_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion8Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion8_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion8
     /// </summary>
     public unsafe virtual void OverchargeExplosion8()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion8", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion8Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion8", true);
+        var parms = new OverchargeExplosion8_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion7Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion7_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion7
     /// </summary>
     public unsafe virtual void OverchargeExplosion7()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion7", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion7Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion7", true);
+        var parms = new OverchargeExplosion7_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion6Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion6_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion6
     /// </summary>
     public unsafe virtual void OverchargeExplosion6()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion6", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion6Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion6", true);
+        var parms = new OverchargeExplosion6_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion5Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion5_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion5
     /// </summary>
     public unsafe virtual void OverchargeExplosion5()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion5", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion5Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion5", true);
+        var parms = new OverchargeExplosion5_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion4Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion4_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion4
     /// </summary>
     public unsafe virtual void OverchargeExplosion4()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion4", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion4Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion4", true);
+        var parms = new OverchargeExplosion4_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion3Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion3_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion3
     /// </summary>
     public unsafe virtual void OverchargeExplosion3()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion3", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion3Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion3", true);
+        var parms = new OverchargeExplosion3_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion2Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion2_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion2
     /// </summary>
     public unsafe virtual void OverchargeExplosion2()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion2", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion2Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion2", true);
+        var parms = new OverchargeExplosion2_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverchargeExplosion1Func = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverchargeExplosion1_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverchargeExplosion1
     /// </summary>
     public unsafe virtual void OverchargeExplosion1()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion1", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverchargeExplosion1Func ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverchargeExplosion1", true);
+        var parms = new OverchargeExplosion1_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KickOffRibsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct KickOffRibs_Params
+    {
+    }
+
     /// <summary>
     /// Function: KickOffRibs
     /// </summary>
     public unsafe virtual void KickOffRibs()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KickOffRibs", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KickOffRibsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.KickOffRibs", true);
+        var parms = new KickOffRibs_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopBeamAudioLoopFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopBeamAudioLoop_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopBeamAudioLoop
     /// </summary>
     public unsafe virtual void StopBeamAudioLoop()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopBeamAudioLoop", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopBeamAudioLoopFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StopBeamAudioLoop", true);
+        var parms = new StopBeamAudioLoop_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartBeamAudioLoopFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartBeamAudioLoop_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartBeamAudioLoop
     /// </summary>
     public unsafe virtual void StartBeamAudioLoop()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartBeamAudioLoop", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartBeamAudioLoopFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartBeamAudioLoop", true);
+        var parms = new StartBeamAudioLoop_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StoppedRechargingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StoppedRecharging_Params
+    {
+    }
+
     /// <summary>
     /// Function: StoppedRecharging
     /// </summary>
     public unsafe virtual void StoppedRecharging()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StoppedRecharging", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StoppedRechargingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StoppedRecharging", true);
+        var parms = new StoppedRecharging_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartedRechargingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartedRecharging_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartedRecharging
     /// </summary>
     public unsafe virtual void StartedRecharging()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartedRecharging", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartedRechargingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartedRecharging", true);
+        var parms = new StartedRecharging_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IntroCinematicFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IntroCinematicFinished_Params
+    {
+    }
+
     /// <summary>
     /// Function: IntroCinematicFinished
     /// </summary>
     public unsafe override void IntroCinematicFinished()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IntroCinematicFinished", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IntroCinematicFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.IntroCinematicFinished", true);
+        var parms = new IntroCinematicFinished_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverloadBallCogsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OverloadBallCogs_Params
+    {
+    }
+
     /// <summary>
     /// Function: OverloadBallCogs
     /// </summary>
     public unsafe virtual void OverloadBallCogs()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverloadBallCogs", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OverloadBallCogsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.OverloadBallCogs", true);
+        var parms = new OverloadBallCogs_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateBallCogsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpdateBallCogs_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateBallCogs
     /// </summary>
     public unsafe virtual void UpdateBallCogs()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateBallCogs", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateBallCogsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateBallCogs", true);
+        var parms = new UpdateBallCogs_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayCapeAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct PlayCapeAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName AnimName;
+    }
+
     /// <summary>
     /// Function: PlayCapeAnim
     /// </summary>
     public unsafe virtual void PlayCapeAnim(BmSDK.FName AnimName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayCapeAnim", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayCapeAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.PlayCapeAnim", true);
+        var parms = new PlayCapeAnim_Params();
+        parms.AnimName = AnimName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnFootstepParticlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct SpawnFootstepParticles_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimNotify_Footstep.EFoot Foot;
+        [FieldOffset(1)] public BmSDK.BmGame.RAnimNotify_Footstep.EContactType Contact;
+        [FieldOffset(4)] public System.Numerics.Vector3 FootLocation;
+        [FieldOffset(16)] public nint Property;
+    }
+
     /// <summary>
     /// Function: SpawnFootstepParticles
     /// </summary>
     public unsafe override void SpawnFootstepParticles(BmSDK.BmGame.RAnimNotify_Footstep.EFoot Foot, BmSDK.BmGame.RAnimNotify_Footstep.EContactType Contact, System.Numerics.Vector3 FootLocation, BmSDK.BmGame.RPhysicalMaterialProperty Property)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnFootstepParticles", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Foot, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Contact, paramsPtr + 1);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FootLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Property, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnFootstepParticlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SpawnFootstepParticles", true);
+        var parms = new SpawnFootstepParticles_Params();
+        parms.Foot = Foot;
+        parms.Contact = Contact;
+        parms.FootLocation = FootLocation;
+        parms.Property = Property?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateVeinSecondaryPulseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateVeinSecondaryPulse_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateVeinSecondaryPulse
     /// </summary>
     public unsafe virtual void UpdateVeinSecondaryPulse(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateVeinSecondaryPulse", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateVeinSecondaryPulseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateVeinSecondaryPulse", true);
+        var parms = new UpdateVeinSecondaryPulse_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateVeinColourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UpdateVeinColour_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: UpdateVeinColour
     /// </summary>
     public unsafe virtual void UpdateVeinColour(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateVeinColour", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateVeinColourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateVeinColour", true);
+        var parms = new UpdateVeinColour_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetUppercutAnimSetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetUppercutAnimSet_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetUppercutAnimSet
     /// </summary>
     public unsafe override BmSDK.Engine.AnimSet GetUppercutAnimSet()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetUppercutAnimSet", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSet>(paramsPtr + 0);
+        var funcManaged = s_GetUppercutAnimSetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetUppercutAnimSet", true);
+        var parms = new GetUppercutAnimSet_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AnimSet)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetUppercutAnimNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetUppercutAnimName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ReturnValue;
     }
 
     /// <summary>
@@ -2252,10 +3516,16 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe override BmSDK.FName GetUppercutAnimName()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetUppercutAnimName", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
+        var funcManaged = s_GetUppercutAnimNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.GetUppercutAnimName", true);
+        var parms = new GetUppercutAnimName_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SmashHitNotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SmashHitNotify_Params
+    {
     }
 
     /// <summary>
@@ -2263,89 +3533,134 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe virtual void SmashHitNotify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SmashHitNotify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SmashHitNotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SmashHitNotify", true);
+        var parms = new SmashHitNotify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetOnKneesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetOnKnees_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetOnKnees
     /// </summary>
     public unsafe virtual void SetOnKnees()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetOnKnees", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetOnKneesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetOnKnees", true);
+        var parms = new SetOnKnees_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableVeinsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct EnableVeins_Params
+    {
+        [FieldOffset(0)] public int enableOnBody;
+        [FieldOffset(4)] public int enableOnHeart;
+    }
+
     /// <summary>
     /// Function: EnableVeins
     /// </summary>
     public unsafe virtual void EnableVeins(bool enableOnBody, bool enableOnHeart)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableVeins", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(enableOnBody, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(enableOnHeart, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableVeinsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.EnableVeins", true);
+        var parms = new EnableVeins_Params();
+        parms.enableOnBody = enableOnBody ? 1 : 0;
+        parms.enableOnHeart = enableOnHeart ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateBeamSoundPositionsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UpdateBeamSoundPositions_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateBeamSoundPositions
     /// </summary>
     public unsafe virtual void UpdateBeamSoundPositions()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateBeamSoundPositions", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateBeamSoundPositionsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.UpdateBeamSoundPositions", true);
+        var parms = new UpdateBeamSoundPositions_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartGrowingBlockingCylinderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartGrowingBlockingCylinder_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartGrowingBlockingCylinder
     /// </summary>
     public unsafe virtual void StartGrowingBlockingCylinder()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartGrowingBlockingCylinder", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartGrowingBlockingCylinderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.StartGrowingBlockingCylinder", true);
+        var parms = new StartGrowingBlockingCylinder_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoBiggestRumbleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoBiggestRumble_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoBiggestRumble
     /// </summary>
     public unsafe virtual void DoBiggestRumble()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DoBiggestRumble", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoBiggestRumbleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.DoBiggestRumble", true);
+        var parms = new DoBiggestRumble_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float UpdateTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float UpdateTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.Tick", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UpdateTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.Tick", true);
+        var parms = new Tick_Params();
+        parms.UpdateTime = UpdateTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetHealth_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetHealth
     /// </summary>
     public unsafe override void SetHealth()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetHealth", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossGrundy.SetHealth", true);
+        var parms = new SetHealth_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -2404,11 +3719,7 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
         /// <summary>
         /// ByteProperty: dpg
         /// </summary>
-        public unsafe BmSDK.Engine.Scene.ESceneDepthPriorityGroup dpg
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Scene.ESceneDepthPriorityGroup>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.Engine.Scene.ESceneDepthPriorityGroup dpg;
     }
 
     /// <summary>
@@ -2445,41 +3756,35 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     [StructLayout(LayoutKind.Explicit, Size = 52)]
     public partial record struct FElectricPillarPFX
     {
+        [FieldOffset(12)] private int _bitfield12;
+
         /// <summary>
         /// StructProperty: baseLoc
         /// </summary>
-        public unsafe System.Numerics.Vector3 baseLoc
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector3 baseLoc;
 
         /// <summary>
         /// BoolProperty: bOn
         /// </summary>
-        public unsafe bool bOn
+        public bool bOn
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bForceOff
         /// </summary>
-        public unsafe bool bForceOff
+        public bool bForceOff
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 2) != 0;
+            set { if (value) _bitfield12 |= 2; else _bitfield12 &= ~2; }
         }
 
         /// <summary>
         /// FloatProperty: unForceOffTime
         /// </summary>
-        public unsafe float unForceOffTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float unForceOffTime;
 
         /// <summary>
         /// ComponentProperty: VerticalPillar
@@ -2563,47 +3868,27 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
         /// <summary>
         /// StructProperty: centre
         /// </summary>
-        public unsafe System.Numerics.Vector3 centre
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector3 centre;
 
         /// <summary>
         /// FloatProperty: Radius
         /// </summary>
-        public unsafe float Radius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float Radius;
 
         /// <summary>
         /// FloatProperty: Thickness
         /// </summary>
-        public unsafe float Thickness
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float Thickness;
 
         /// <summary>
         /// FloatProperty: Speed
         /// </summary>
-        public unsafe float Speed
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float Speed;
 
         /// <summary>
         /// IntProperty: PFXIndex
         /// </summary>
-        public unsafe int PFXIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int PFXIndex;
     }
 
     /// <summary>
@@ -2612,22 +3897,24 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     [StructLayout(LayoutKind.Explicit, Size = 4)]
     public partial record struct FElectrifiedAttackData
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: bSpawnSparks
         /// </summary>
-        public unsafe bool bSpawnSparks
+        public bool bSpawnSparks
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bSpawnRings
         /// </summary>
-        public unsafe bool bSpawnRings
+        public bool bSpawnRings
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
     }
 
@@ -2827,8 +4114,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float grundyAttackStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7196); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7196); }
+        get { return *(float*)(Ptr + 7196); }
+        set { *(float*)(Ptr + 7196) = value; }
     }
 
     /// <summary>
@@ -2860,8 +4147,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossGrundy.E_SwingChainState swingChainState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossGrundy.E_SwingChainState>(Ptr + 7232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7232); }
+        get { return *(BmSDK.BmScript.RPawnBossGrundy.E_SwingChainState*)(Ptr + 7232); }
+        set { *(BmSDK.BmScript.RPawnBossGrundy.E_SwingChainState*)(Ptr + 7232) = value; }
     }
 
     /// <summary>
@@ -2869,8 +4156,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmGame.RPawnBossGrundyBase.EGrundyAttacks nextChosenAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnBossGrundyBase.EGrundyAttacks>(Ptr + 7233); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7233); }
+        get { return *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyAttacks*)(Ptr + 7233); }
+        set { *(BmSDK.BmGame.RPawnBossGrundyBase.EGrundyAttacks*)(Ptr + 7233) = value; }
     }
 
     /// <summary>
@@ -2878,8 +4165,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossGrundy.eGrundyHelpTextState currHelpTextState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossGrundy.eGrundyHelpTextState>(Ptr + 7234); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7234); }
+        get { return *(BmSDK.BmScript.RPawnBossGrundy.eGrundyHelpTextState*)(Ptr + 7234); }
+        set { *(BmSDK.BmScript.RPawnBossGrundy.eGrundyHelpTextState*)(Ptr + 7234) = value; }
     }
 
     /// <summary>
@@ -2887,8 +4174,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossGrundy.eGrundyHelpTextState prevHelpTextState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossGrundy.eGrundyHelpTextState>(Ptr + 7235); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7235); }
+        get { return *(BmSDK.BmScript.RPawnBossGrundy.eGrundyHelpTextState*)(Ptr + 7235); }
+        set { *(BmSDK.BmScript.RPawnBossGrundy.eGrundyHelpTextState*)(Ptr + 7235) = value; }
     }
 
     /// <summary>
@@ -2896,8 +4183,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossGrundy.eGrundyVeinColourScheme veinColourScheme
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossGrundy.eGrundyVeinColourScheme>(Ptr + 7236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7236); }
+        get { return *(BmSDK.BmScript.RPawnBossGrundy.eGrundyVeinColourScheme*)(Ptr + 7236); }
+        set { *(BmSDK.BmScript.RPawnBossGrundy.eGrundyVeinColourScheme*)(Ptr + 7236) = value; }
     }
 
     /// <summary>
@@ -2905,8 +4192,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnBossGrundy.eSwingRumbleState swingRumbleState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnBossGrundy.eSwingRumbleState>(Ptr + 7237); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7237); }
+        get { return *(BmSDK.BmScript.RPawnBossGrundy.eSwingRumbleState*)(Ptr + 7237); }
+        set { *(BmSDK.BmScript.RPawnBossGrundy.eSwingRumbleState*)(Ptr + 7237) = value; }
     }
 
     /// <summary>
@@ -2919,16 +4206,16 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float chainExtraLength_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7240); }
+        get { return *(float*)(Ptr + 7240); }
+        set { *(float*)(Ptr + 7240) = value; }
     }
     /// <summary>
     /// FloatProperty: chainExtraLength
     /// </summary>
     public unsafe float chainExtraLength_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7244); }
+        get { return *(float*)(Ptr + 7244); }
+        set { *(float*)(Ptr + 7244) = value; }
     }
 
     /// <summary>
@@ -2954,8 +4241,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int chosenThrowTarget
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7264); }
+        get { return *(int*)(Ptr + 7264); }
+        set { *(int*)(Ptr + 7264) = value; }
     }
 
     /// <summary>
@@ -2963,8 +4250,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bFinishedLeapPt1
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 1; else *(int*)(Ptr + 7268) &= ~1; }
     }
 
     /// <summary>
@@ -2972,8 +4259,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bAdjustingTransitionTarget
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 2; else *(int*)(Ptr + 7268) &= ~2; }
     }
 
     /// <summary>
@@ -2981,8 +4268,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bInControllableCinematicCam
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 4; else *(int*)(Ptr + 7268) &= ~4; }
     }
 
     /// <summary>
@@ -2990,8 +4277,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bPlayingCinematicCamAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 8; else *(int*)(Ptr + 7268) &= ~8; }
     }
 
     /// <summary>
@@ -2999,8 +4286,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool heartRemovalTriggered
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 16; else *(int*)(Ptr + 7268) &= ~16; }
     }
 
     /// <summary>
@@ -3008,8 +4295,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bCrushFinished
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 32; else *(int*)(Ptr + 7268) &= ~32; }
     }
 
     /// <summary>
@@ -3017,8 +4304,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bPlayingCrushIdle
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 64; else *(int*)(Ptr + 7268) &= ~64; }
     }
 
     /// <summary>
@@ -3026,8 +4313,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bHelpTextSupressed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 128; else *(int*)(Ptr + 7268) &= ~128; }
     }
 
     /// <summary>
@@ -3035,8 +4322,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bPadHasEverBeenBlownUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 256; else *(int*)(Ptr + 7268) &= ~256; }
     }
 
     /// <summary>
@@ -3044,8 +4331,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bCanHeadtrackBM
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 512; else *(int*)(Ptr + 7268) &= ~512; }
     }
 
     /// <summary>
@@ -3053,8 +4340,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bInLateCounterWindow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 1024; else *(int*)(Ptr + 7268) &= ~1024; }
     }
 
     /// <summary>
@@ -3062,8 +4349,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bSuccessfulCounter_Early
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 2048; else *(int*)(Ptr + 7268) &= ~2048; }
     }
 
     /// <summary>
@@ -3071,8 +4358,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool playingMeleeCam
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 4096; else *(int*)(Ptr + 7268) &= ~4096; }
     }
 
     /// <summary>
@@ -3080,8 +4367,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bDeferredDaze
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 8192; else *(int*)(Ptr + 7268) &= ~8192; }
     }
 
     /// <summary>
@@ -3089,8 +4376,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bFinishedTransIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 16384; else *(int*)(Ptr + 7268) &= ~16384; }
     }
 
     /// <summary>
@@ -3098,8 +4385,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bElectricsStarted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 32768; else *(int*)(Ptr + 7268) &= ~32768; }
     }
 
     /// <summary>
@@ -3107,8 +4394,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool nextAttackShouldBeMaggots
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 65536; else *(int*)(Ptr + 7268) &= ~65536; }
     }
 
     /// <summary>
@@ -3116,8 +4403,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bDrawPadDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 131072; else *(int*)(Ptr + 7268) &= ~131072; }
     }
 
     /// <summary>
@@ -3125,8 +4412,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bRecharging
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 262144; else *(int*)(Ptr + 7268) &= ~262144; }
     }
 
     /// <summary>
@@ -3134,8 +4421,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bRechargeFinished
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 524288; else *(int*)(Ptr + 7268) &= ~524288; }
     }
 
     /// <summary>
@@ -3143,8 +4430,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bNeedToRestartCape
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 1048576; else *(int*)(Ptr + 7268) &= ~1048576; }
     }
 
     /// <summary>
@@ -3152,8 +4439,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bNeedDeferredPauseCape
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 2097152; else *(int*)(Ptr + 7268) &= ~2097152; }
     }
 
     /// <summary>
@@ -3161,8 +4448,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bStartedCrushMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 4194304; else *(int*)(Ptr + 7268) &= ~4194304; }
     }
 
     /// <summary>
@@ -3170,8 +4457,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bDoneFirstPillarDisable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 8388608; else *(int*)(Ptr + 7268) &= ~8388608; }
     }
 
     /// <summary>
@@ -3179,8 +4466,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bHadRECRecharge
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 16777216; else *(int*)(Ptr + 7268) &= ~16777216; }
     }
 
     /// <summary>
@@ -3188,8 +4475,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bRoomCogsOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 33554432; else *(int*)(Ptr + 7268) &= ~33554432; }
     }
 
     /// <summary>
@@ -3197,8 +4484,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bHeartBeatAnimEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 67108864; else *(int*)(Ptr + 7268) &= ~67108864; }
     }
 
     /// <summary>
@@ -3206,8 +4493,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bDonePhysInit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 134217728; else *(int*)(Ptr + 7268) &= ~134217728; }
     }
 
     /// <summary>
@@ -3215,8 +4502,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bPluggedIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 268435456; else *(int*)(Ptr + 7268) &= ~268435456; }
     }
 
     /// <summary>
@@ -3224,8 +4511,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bFailBeams
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 536870912; else *(int*)(Ptr + 7268) &= ~536870912; }
     }
 
     /// <summary>
@@ -3233,8 +4520,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bExtraBeams
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= 1073741824; else *(int*)(Ptr + 7268) &= ~1073741824; }
     }
 
     /// <summary>
@@ -3242,8 +4529,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bHasSetRoomDamageState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7268); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7268); }
+        get { return (*(int*)(Ptr + 7268) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 7268) |= -2147483648; else *(int*)(Ptr + 7268) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -3251,8 +4538,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bSkippedToFirePostSequence
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 1; else *(int*)(Ptr + 7272) &= ~1; }
     }
 
     /// <summary>
@@ -3260,8 +4547,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bSkippedToElectroPostSequence
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 2; else *(int*)(Ptr + 7272) &= ~2; }
     }
 
     /// <summary>
@@ -3269,8 +4556,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bFinishedIgniteCloseup
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 4; else *(int*)(Ptr + 7272) &= ~4; }
     }
 
     /// <summary>
@@ -3278,8 +4565,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bDoneWindowLengthLog
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 8; else *(int*)(Ptr + 7272) &= ~8; }
     }
 
     /// <summary>
@@ -3287,8 +4574,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bInIgniteCameraCut
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 16; else *(int*)(Ptr + 7272) &= ~16; }
     }
 
     /// <summary>
@@ -3296,8 +4583,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bSmashHasHit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 32; else *(int*)(Ptr + 7272) &= ~32; }
     }
 
     /// <summary>
@@ -3305,8 +4592,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bSwingGotWithinRange
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 64; else *(int*)(Ptr + 7272) &= ~64; }
     }
 
     /// <summary>
@@ -3314,8 +4601,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bAddedExtraHighSwing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 128; else *(int*)(Ptr + 7272) &= ~128; }
     }
 
     /// <summary>
@@ -3323,8 +4610,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool switchToAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 256; else *(int*)(Ptr + 7272) &= ~256; }
     }
 
     /// <summary>
@@ -3332,8 +4619,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool switchToPhys
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 512; else *(int*)(Ptr + 7272) &= ~512; }
     }
 
     /// <summary>
@@ -3341,8 +4628,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool dbgPadDetonated
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 1024; else *(int*)(Ptr + 7272) &= ~1024; }
     }
 
     /// <summary>
@@ -3350,8 +4637,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bWaitingForQueuedIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 2048; else *(int*)(Ptr + 7272) &= ~2048; }
     }
 
     /// <summary>
@@ -3359,8 +4646,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool beamLoopPlaying
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 4096; else *(int*)(Ptr + 7272) &= ~4096; }
     }
 
     /// <summary>
@@ -3368,8 +4655,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bFakeDeathVolumesEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 8192; else *(int*)(Ptr + 7272) &= ~8192; }
     }
 
     /// <summary>
@@ -3377,8 +4664,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bBorrowedBMHealth
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 16384; else *(int*)(Ptr + 7272) &= ~16384; }
     }
 
     /// <summary>
@@ -3386,8 +4673,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bHeartRemoved
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 32768; else *(int*)(Ptr + 7272) &= ~32768; }
     }
 
     /// <summary>
@@ -3395,8 +4682,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bDoneFirstRecharge
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 65536; else *(int*)(Ptr + 7272) &= ~65536; }
     }
 
     /// <summary>
@@ -3404,8 +4691,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bNoIgniteRumble
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 131072; else *(int*)(Ptr + 7272) &= ~131072; }
     }
 
     /// <summary>
@@ -3413,8 +4700,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe bool bGrowingBlockingCylinder
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7272); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 7272); }
+        get { return (*(int*)(Ptr + 7272) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 7272) |= 262144; else *(int*)(Ptr + 7272) &= ~262144; }
     }
 
     /// <summary>
@@ -3608,8 +4895,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float timeSinceLook
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7528); }
+        get { return *(float*)(Ptr + 7528); }
+        set { *(float*)(Ptr + 7528) = value; }
     }
 
     /// <summary>
@@ -3622,16 +4909,16 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName ChainWrapBoneNames_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 7532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7532); }
+        get { return *(BmSDK.FName*)(Ptr + 7532); }
+        set { *(BmSDK.FName*)(Ptr + 7532) = value; }
     }
     /// <summary>
     /// NameProperty: ChainWrapBoneNames
     /// </summary>
     public unsafe BmSDK.FName ChainWrapBoneNames_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 7540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7540); }
+        get { return *(BmSDK.FName*)(Ptr + 7540); }
+        set { *(BmSDK.FName*)(Ptr + 7540) = value; }
     }
 
     /// <summary>
@@ -3639,8 +4926,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int numPadsDetonatedThisStage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7548); }
+        get { return *(int*)(Ptr + 7548); }
+        set { *(int*)(Ptr + 7548) = value; }
     }
 
     /// <summary>
@@ -3653,16 +4940,16 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName GeneratorHitReacts_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 7552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7552); }
+        get { return *(BmSDK.FName*)(Ptr + 7552); }
+        set { *(BmSDK.FName*)(Ptr + 7552) = value; }
     }
     /// <summary>
     /// NameProperty: GeneratorHitReacts
     /// </summary>
     public unsafe BmSDK.FName GeneratorHitReacts_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 7560); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7560); }
+        get { return *(BmSDK.FName*)(Ptr + 7560); }
+        set { *(BmSDK.FName*)(Ptr + 7560) = value; }
     }
 
     /// <summary>
@@ -3679,8 +4966,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int numMaggotsToSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7572); }
+        get { return *(int*)(Ptr + 7572); }
+        set { *(int*)(Ptr + 7572) = value; }
     }
 
     /// <summary>
@@ -3688,8 +4975,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int heartBoneIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7576); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7576); }
+        get { return *(int*)(Ptr + 7576); }
+        set { *(int*)(Ptr + 7576) = value; }
     }
 
     /// <summary>
@@ -3703,8 +4990,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float minElectricSmashDeviance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7584); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7584); }
+        get { return *(float*)(Ptr + 7584); }
+        set { *(float*)(Ptr + 7584) = value; }
     }
 
     /// <summary>
@@ -3712,8 +4999,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float maxElectricSmashDeviance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7588); }
+        get { return *(float*)(Ptr + 7588); }
+        set { *(float*)(Ptr + 7588) = value; }
     }
 
     /// <summary>
@@ -3726,24 +5013,24 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float floorRingSpeed_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7592); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7592); }
+        get { return *(float*)(Ptr + 7592); }
+        set { *(float*)(Ptr + 7592) = value; }
     }
     /// <summary>
     /// FloatProperty: floorRingSpeed
     /// </summary>
     public unsafe float floorRingSpeed_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7596); }
+        get { return *(float*)(Ptr + 7596); }
+        set { *(float*)(Ptr + 7596) = value; }
     }
     /// <summary>
     /// FloatProperty: floorRingSpeed
     /// </summary>
     public unsafe float floorRingSpeed_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7600); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7600); }
+        get { return *(float*)(Ptr + 7600); }
+        set { *(float*)(Ptr + 7600) = value; }
     }
 
     /// <summary>
@@ -3751,8 +5038,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float floorRingMaxRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7604); }
+        get { return *(float*)(Ptr + 7604); }
+        set { *(float*)(Ptr + 7604) = value; }
     }
 
     /// <summary>
@@ -3760,8 +5047,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float floorRingThickness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7608); }
+        get { return *(float*)(Ptr + 7608); }
+        set { *(float*)(Ptr + 7608) = value; }
     }
 
     /// <summary>
@@ -3769,8 +5056,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int minFloorRingsToSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7612); }
+        get { return *(int*)(Ptr + 7612); }
+        set { *(int*)(Ptr + 7612) = value; }
     }
 
     /// <summary>
@@ -3778,8 +5065,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int maxFloorRingsToSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7616); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7616); }
+        get { return *(int*)(Ptr + 7616); }
+        set { *(int*)(Ptr + 7616) = value; }
     }
 
     /// <summary>
@@ -3787,8 +5074,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float gapBetweenFloorRings
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7620); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7620); }
+        get { return *(float*)(Ptr + 7620); }
+        set { *(float*)(Ptr + 7620) = value; }
     }
 
     /// <summary>
@@ -3796,8 +5083,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float ringFXBaseSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7624); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7624); }
+        get { return *(float*)(Ptr + 7624); }
+        set { *(float*)(Ptr + 7624) = value; }
     }
 
     /// <summary>
@@ -3805,8 +5092,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeAmpX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7628); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7628); }
+        get { return *(float*)(Ptr + 7628); }
+        set { *(float*)(Ptr + 7628) = value; }
     }
 
     /// <summary>
@@ -3814,8 +5101,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeAmpY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7632); }
+        get { return *(float*)(Ptr + 7632); }
+        set { *(float*)(Ptr + 7632) = value; }
     }
 
     /// <summary>
@@ -3823,8 +5110,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeAmpZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7636); }
+        get { return *(float*)(Ptr + 7636); }
+        set { *(float*)(Ptr + 7636) = value; }
     }
 
     /// <summary>
@@ -3832,8 +5119,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeLocFreq
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7640); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7640); }
+        get { return *(float*)(Ptr + 7640); }
+        set { *(float*)(Ptr + 7640) = value; }
     }
 
     /// <summary>
@@ -3841,8 +5128,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeRotAmpX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7644); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7644); }
+        get { return *(float*)(Ptr + 7644); }
+        set { *(float*)(Ptr + 7644) = value; }
     }
 
     /// <summary>
@@ -3850,8 +5137,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeRotAmpY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7648); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7648); }
+        get { return *(float*)(Ptr + 7648); }
+        set { *(float*)(Ptr + 7648) = value; }
     }
 
     /// <summary>
@@ -3859,8 +5146,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeRotAmpZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7652); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7652); }
+        get { return *(float*)(Ptr + 7652); }
+        set { *(float*)(Ptr + 7652) = value; }
     }
 
     /// <summary>
@@ -3868,8 +5155,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeRotFreq
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7656); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7656); }
+        get { return *(float*)(Ptr + 7656); }
+        set { *(float*)(Ptr + 7656) = value; }
     }
 
     /// <summary>
@@ -3877,8 +5164,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushFreqDropPower
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7660); }
+        get { return *(float*)(Ptr + 7660); }
+        set { *(float*)(Ptr + 7660) = value; }
     }
 
     /// <summary>
@@ -3886,8 +5173,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushFreqDropFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7664); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7664); }
+        get { return *(float*)(Ptr + 7664); }
+        set { *(float*)(Ptr + 7664) = value; }
     }
 
     /// <summary>
@@ -3895,8 +5182,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushShakeDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7668); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7668); }
+        get { return *(float*)(Ptr + 7668); }
+        set { *(float*)(Ptr + 7668) = value; }
     }
 
     /// <summary>
@@ -3904,8 +5191,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float nextCrushShakeTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7672); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7672); }
+        get { return *(float*)(Ptr + 7672); }
+        set { *(float*)(Ptr + 7672) = value; }
     }
 
     /// <summary>
@@ -3983,8 +5270,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int nextFloorRing
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7708); }
+        get { return *(int*)(Ptr + 7708); }
+        set { *(int*)(Ptr + 7708) = value; }
     }
 
     /// <summary>
@@ -4001,8 +5288,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int numFloorRingsToSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7724); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7724); }
+        get { return *(int*)(Ptr + 7724); }
+        set { *(int*)(Ptr + 7724) = value; }
     }
 
     /// <summary>
@@ -4010,8 +5297,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float nextFloorRingSpawnTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7728); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7728); }
+        get { return *(float*)(Ptr + 7728); }
+        set { *(float*)(Ptr + 7728) = value; }
     }
 
     /// <summary>
@@ -4019,8 +5306,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float floorRingSpawnInterval
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7732); }
+        get { return *(float*)(Ptr + 7732); }
+        set { *(float*)(Ptr + 7732) = value; }
     }
 
     /// <summary>
@@ -4034,8 +5321,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int numConsecutiveElectricSmashes
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7748); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7748); }
+        get { return *(int*)(Ptr + 7748); }
+        set { *(int*)(Ptr + 7748) = value; }
     }
 
     /// <summary>
@@ -4043,8 +5330,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int numConsecutiveElectricMaggots
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7752); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7752); }
+        get { return *(int*)(Ptr + 7752); }
+        set { *(int*)(Ptr + 7752) = value; }
     }
 
     /// <summary>
@@ -4052,8 +5339,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int numConsecutiveElectricStomps
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7756); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7756); }
+        get { return *(int*)(Ptr + 7756); }
+        set { *(int*)(Ptr + 7756) = value; }
     }
 
     /// <summary>
@@ -4066,24 +5353,24 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushDPS_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7760); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7760); }
+        get { return *(float*)(Ptr + 7760); }
+        set { *(float*)(Ptr + 7760) = value; }
     }
     /// <summary>
     /// FloatProperty: crushDPS
     /// </summary>
     public unsafe float crushDPS_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7764); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7764); }
+        get { return *(float*)(Ptr + 7764); }
+        set { *(float*)(Ptr + 7764) = value; }
     }
     /// <summary>
     /// FloatProperty: crushDPS
     /// </summary>
     public unsafe float crushDPS_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7768); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7768); }
+        get { return *(float*)(Ptr + 7768); }
+        set { *(float*)(Ptr + 7768) = value; }
     }
 
     /// <summary>
@@ -4100,8 +5387,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushScoreSpamInterval
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7776); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7776); }
+        get { return *(float*)(Ptr + 7776); }
+        set { *(float*)(Ptr + 7776) = value; }
     }
 
     /// <summary>
@@ -4109,8 +5396,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float lastCrushScoreSpamTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7780); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7780); }
+        get { return *(float*)(Ptr + 7780); }
+        set { *(float*)(Ptr + 7780) = value; }
     }
 
     /// <summary>
@@ -4118,8 +5405,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float nextCrushOverlayTriggerTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7784); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7784); }
+        get { return *(float*)(Ptr + 7784); }
+        set { *(float*)(Ptr + 7784) = value; }
     }
 
     /// <summary>
@@ -4127,8 +5414,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float accumulatedCrushDamage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7788); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7788); }
+        get { return *(float*)(Ptr + 7788); }
+        set { *(float*)(Ptr + 7788) = value; }
     }
 
     /// <summary>
@@ -4136,8 +5423,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float StruggleSpeedDecay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7792); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7792); }
+        get { return *(float*)(Ptr + 7792); }
+        set { *(float*)(Ptr + 7792) = value; }
     }
 
     /// <summary>
@@ -4145,8 +5432,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float MinStruggleSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7796); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7796); }
+        get { return *(float*)(Ptr + 7796); }
+        set { *(float*)(Ptr + 7796) = value; }
     }
 
     /// <summary>
@@ -4154,8 +5441,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float MaxStruggleSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7800); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7800); }
+        get { return *(float*)(Ptr + 7800); }
+        set { *(float*)(Ptr + 7800) = value; }
     }
 
     /// <summary>
@@ -4163,8 +5450,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float StruggleButtonBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7804); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7804); }
+        get { return *(float*)(Ptr + 7804); }
+        set { *(float*)(Ptr + 7804) = value; }
     }
 
     /// <summary>
@@ -4172,8 +5459,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float StruggleScore
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7808); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7808); }
+        get { return *(float*)(Ptr + 7808); }
+        set { *(float*)(Ptr + 7808) = value; }
     }
 
     /// <summary>
@@ -4181,8 +5468,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float StruggleSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7812); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7812); }
+        get { return *(float*)(Ptr + 7812); }
+        set { *(float*)(Ptr + 7812) = value; }
     }
 
     /// <summary>
@@ -4190,8 +5477,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float electricSmashMaxDevAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7816); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7816); }
+        get { return *(float*)(Ptr + 7816); }
+        set { *(float*)(Ptr + 7816) = value; }
     }
 
     /// <summary>
@@ -4199,8 +5486,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float quickGelHelpTextDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7820); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7820); }
+        get { return *(float*)(Ptr + 7820); }
+        set { *(float*)(Ptr + 7820) = value; }
     }
 
     /// <summary>
@@ -4208,8 +5495,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float detectiveHelpTextDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7824); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7824); }
+        get { return *(float*)(Ptr + 7824); }
+        set { *(float*)(Ptr + 7824) = value; }
     }
 
     /// <summary>
@@ -4217,8 +5504,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float spellItOutHelpTextDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7828); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7828); }
+        get { return *(float*)(Ptr + 7828); }
+        set { *(float*)(Ptr + 7828) = value; }
     }
 
     /// <summary>
@@ -4226,8 +5513,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float timeTillGelHelpText
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7832); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7832); }
+        get { return *(float*)(Ptr + 7832); }
+        set { *(float*)(Ptr + 7832) = value; }
     }
 
     /// <summary>
@@ -4235,8 +5522,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float timeTillDetectiveModeHelpText
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7836); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7836); }
+        get { return *(float*)(Ptr + 7836); }
+        set { *(float*)(Ptr + 7836) = value; }
     }
 
     /// <summary>
@@ -4244,8 +5531,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float timeTillSpellItOutHelpText
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7840); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7840); }
+        get { return *(float*)(Ptr + 7840); }
+        set { *(float*)(Ptr + 7840) = value; }
     }
 
     /// <summary>
@@ -4253,8 +5540,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float heartFXScaleModifier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7844); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7844); }
+        get { return *(float*)(Ptr + 7844); }
+        set { *(float*)(Ptr + 7844) = value; }
     }
 
     /// <summary>
@@ -4262,8 +5549,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int smashAngleMax_AcrossBody
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7848); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7848); }
+        get { return *(int*)(Ptr + 7848); }
+        set { *(int*)(Ptr + 7848) = value; }
     }
 
     /// <summary>
@@ -4271,8 +5558,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int smashAngleMax_OutFromBody
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7852); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7852); }
+        get { return *(int*)(Ptr + 7852); }
+        set { *(int*)(Ptr + 7852) = value; }
     }
 
     /// <summary>
@@ -4286,8 +5573,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int smashStartYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 7868); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7868); }
+        get { return *(int*)(Ptr + 7868); }
+        set { *(int*)(Ptr + 7868) = value; }
     }
 
     /// <summary>
@@ -4295,8 +5582,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float smashAnimStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7872); }
+        get { return *(float*)(Ptr + 7872); }
+        set { *(float*)(Ptr + 7872) = value; }
     }
 
     /// <summary>
@@ -4304,8 +5591,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float smashBeginExtendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7876); }
+        get { return *(float*)(Ptr + 7876); }
+        set { *(float*)(Ptr + 7876) = value; }
     }
 
     /// <summary>
@@ -4313,8 +5600,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float smashEndExtendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7880); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7880); }
+        get { return *(float*)(Ptr + 7880); }
+        set { *(float*)(Ptr + 7880) = value; }
     }
 
     /// <summary>
@@ -4322,8 +5609,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float smashExtendDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7884); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7884); }
+        get { return *(float*)(Ptr + 7884); }
+        set { *(float*)(Ptr + 7884) = value; }
     }
 
     /// <summary>
@@ -4331,8 +5618,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float smashBeginRetractTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7888); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7888); }
+        get { return *(float*)(Ptr + 7888); }
+        set { *(float*)(Ptr + 7888) = value; }
     }
 
     /// <summary>
@@ -4340,8 +5627,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float smashEndRetractTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7892); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7892); }
+        get { return *(float*)(Ptr + 7892); }
+        set { *(float*)(Ptr + 7892) = value; }
     }
 
     /// <summary>
@@ -4349,8 +5636,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float smashRetractDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7896); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7896); }
+        get { return *(float*)(Ptr + 7896); }
+        set { *(float*)(Ptr + 7896) = value; }
     }
 
     /// <summary>
@@ -4376,8 +5663,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float lastMusicMarkerTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7916); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7916); }
+        get { return *(float*)(Ptr + 7916); }
+        set { *(float*)(Ptr + 7916) = value; }
     }
 
     /// <summary>
@@ -4385,8 +5672,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float fCheckCameraCollisionFromProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7920); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7920); }
+        get { return *(float*)(Ptr + 7920); }
+        set { *(float*)(Ptr + 7920) = value; }
     }
 
     /// <summary>
@@ -4394,8 +5681,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float fCheckCameraCollisionToProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7924); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7924); }
+        get { return *(float*)(Ptr + 7924); }
+        set { *(float*)(Ptr + 7924) = value; }
     }
 
     /// <summary>
@@ -4403,8 +5690,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingAnimOriginalDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7928); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7928); }
+        get { return *(float*)(Ptr + 7928); }
+        set { *(float*)(Ptr + 7928) = value; }
     }
 
     /// <summary>
@@ -4412,8 +5699,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingDistSpeedModifier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7932); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7932); }
+        get { return *(float*)(Ptr + 7932); }
+        set { *(float*)(Ptr + 7932) = value; }
     }
 
     /// <summary>
@@ -4426,24 +5713,24 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingSpeedPadModifier_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7936); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7936); }
+        get { return *(float*)(Ptr + 7936); }
+        set { *(float*)(Ptr + 7936) = value; }
     }
     /// <summary>
     /// FloatProperty: swingSpeedPadModifier
     /// </summary>
     public unsafe float swingSpeedPadModifier_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7940); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7940); }
+        get { return *(float*)(Ptr + 7940); }
+        set { *(float*)(Ptr + 7940) = value; }
     }
     /// <summary>
     /// FloatProperty: swingSpeedPadModifier
     /// </summary>
     public unsafe float swingSpeedPadModifier_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7944); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7944); }
+        get { return *(float*)(Ptr + 7944); }
+        set { *(float*)(Ptr + 7944) = value; }
     }
 
     /// <summary>
@@ -4451,8 +5738,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingSpeedModifierMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7948); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7948); }
+        get { return *(float*)(Ptr + 7948); }
+        set { *(float*)(Ptr + 7948) = value; }
     }
 
     /// <summary>
@@ -4460,8 +5747,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingSpeedMaxDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7952); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7952); }
+        get { return *(float*)(Ptr + 7952); }
+        set { *(float*)(Ptr + 7952) = value; }
     }
 
     /// <summary>
@@ -4469,8 +5756,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingSpeedMinDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7956); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7956); }
+        get { return *(float*)(Ptr + 7956); }
+        set { *(float*)(Ptr + 7956) = value; }
     }
 
     /// <summary>
@@ -4478,8 +5765,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float healthDegenRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7960); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7960); }
+        get { return *(float*)(Ptr + 7960); }
+        set { *(float*)(Ptr + 7960) = value; }
     }
 
     /// <summary>
@@ -4487,8 +5774,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float healthDegenRateNoPads
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7964); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7964); }
+        get { return *(float*)(Ptr + 7964); }
+        set { *(float*)(Ptr + 7964) = value; }
     }
 
     /// <summary>
@@ -4496,8 +5783,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float healthRechargeRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7968); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7968); }
+        get { return *(float*)(Ptr + 7968); }
+        set { *(float*)(Ptr + 7968) = value; }
     }
 
     /// <summary>
@@ -4505,8 +5792,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float rechargeThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 7972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 7972); }
+        get { return *(float*)(Ptr + 7972); }
+        set { *(float*)(Ptr + 7972) = value; }
     }
 
     /// <summary>
@@ -4535,8 +5822,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float electricPillarHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8132); }
+        get { return *(float*)(Ptr + 8132); }
+        set { *(float*)(Ptr + 8132) = value; }
     }
 
     /// <summary>
@@ -4544,8 +5831,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float verticalPillarFXBaseSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8136); }
+        get { return *(float*)(Ptr + 8136); }
+        set { *(float*)(Ptr + 8136) = value; }
     }
 
     /// <summary>
@@ -4553,8 +5840,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float horizontalPillarFXBaseSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8140); }
+        get { return *(float*)(Ptr + 8140); }
+        set { *(float*)(Ptr + 8140) = value; }
     }
 
     /// <summary>
@@ -4562,8 +5849,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float beamEndFXScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8144); }
+        get { return *(float*)(Ptr + 8144); }
+        set { *(float*)(Ptr + 8144) = value; }
     }
 
     /// <summary>
@@ -4571,8 +5858,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float beamEndFXOffsetToCam
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8148); }
+        get { return *(float*)(Ptr + 8148); }
+        set { *(float*)(Ptr + 8148) = value; }
     }
 
     /// <summary>
@@ -4580,8 +5867,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float highSwingStandardHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8152); }
+        get { return *(float*)(Ptr + 8152); }
+        set { *(float*)(Ptr + 8152) = value; }
     }
 
     /// <summary>
@@ -4589,8 +5876,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float highSwingExtraHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8156); }
+        get { return *(float*)(Ptr + 8156); }
+        set { *(float*)(Ptr + 8156) = value; }
     }
 
     /// <summary>
@@ -4616,8 +5903,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float minDistForMelee
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8168); }
+        get { return *(float*)(Ptr + 8168); }
+        set { *(float*)(Ptr + 8168) = value; }
     }
 
     /// <summary>
@@ -4625,8 +5912,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int currentRibsDamageState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8172); }
+        get { return *(int*)(Ptr + 8172); }
+        set { *(int*)(Ptr + 8172) = value; }
     }
 
     /// <summary>
@@ -4643,8 +5930,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float conductorMaxRotationRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8188); }
+        get { return *(float*)(Ptr + 8188); }
+        set { *(float*)(Ptr + 8188) = value; }
     }
 
     /// <summary>
@@ -4652,8 +5939,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float conductorTimeToReachMaxRotationRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8192); }
+        get { return *(float*)(Ptr + 8192); }
+        set { *(float*)(Ptr + 8192) = value; }
     }
 
     /// <summary>
@@ -4666,24 +5953,24 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float conductorCurrentRotationRate_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8196); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8196); }
+        get { return *(float*)(Ptr + 8196); }
+        set { *(float*)(Ptr + 8196) = value; }
     }
     /// <summary>
     /// FloatProperty: conductorCurrentRotationRate
     /// </summary>
     public unsafe float conductorCurrentRotationRate_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8200); }
+        get { return *(float*)(Ptr + 8200); }
+        set { *(float*)(Ptr + 8200) = value; }
     }
     /// <summary>
     /// FloatProperty: conductorCurrentRotationRate
     /// </summary>
     public unsafe float conductorCurrentRotationRate_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8204); }
+        get { return *(float*)(Ptr + 8204); }
+        set { *(float*)(Ptr + 8204) = value; }
     }
 
     /// <summary>
@@ -4700,8 +5987,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float fireMaggotLifeTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8212); }
+        get { return *(float*)(Ptr + 8212); }
+        set { *(float*)(Ptr + 8212) = value; }
     }
 
     /// <summary>
@@ -4709,8 +5996,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float fireMaggotMaxSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8216); }
+        get { return *(float*)(Ptr + 8216); }
+        set { *(float*)(Ptr + 8216) = value; }
     }
 
     /// <summary>
@@ -4718,8 +6005,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float electricMaggotLifeTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8220); }
+        get { return *(float*)(Ptr + 8220); }
+        set { *(float*)(Ptr + 8220) = value; }
     }
 
     /// <summary>
@@ -4727,8 +6014,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float electricMaggotMaxSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8224); }
+        get { return *(float*)(Ptr + 8224); }
+        set { *(float*)(Ptr + 8224) = value; }
     }
 
     /// <summary>
@@ -4736,8 +6023,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float veinGlowMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8228); }
+        get { return *(float*)(Ptr + 8228); }
+        set { *(float*)(Ptr + 8228) = value; }
     }
 
     /// <summary>
@@ -4745,8 +6032,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float stage3PillarOnTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8232); }
+        get { return *(float*)(Ptr + 8232); }
+        set { *(float*)(Ptr + 8232) = value; }
     }
 
     /// <summary>
@@ -4759,24 +6046,24 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float stage3PillarOffTime_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8236); }
+        get { return *(float*)(Ptr + 8236); }
+        set { *(float*)(Ptr + 8236) = value; }
     }
     /// <summary>
     /// FloatProperty: stage3PillarOffTime
     /// </summary>
     public unsafe float stage3PillarOffTime_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8240); }
+        get { return *(float*)(Ptr + 8240); }
+        set { *(float*)(Ptr + 8240) = value; }
     }
     /// <summary>
     /// FloatProperty: stage3PillarOffTime
     /// </summary>
     public unsafe float stage3PillarOffTime_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8244); }
+        get { return *(float*)(Ptr + 8244); }
+        set { *(float*)(Ptr + 8244) = value; }
     }
 
     /// <summary>
@@ -4784,8 +6071,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float timeTillBeamDisable
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8248); }
+        get { return *(float*)(Ptr + 8248); }
+        set { *(float*)(Ptr + 8248) = value; }
     }
 
     /// <summary>
@@ -4811,8 +6098,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float BeforeBeatErrorMargin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8268); }
+        get { return *(float*)(Ptr + 8268); }
+        set { *(float*)(Ptr + 8268) = value; }
     }
 
     /// <summary>
@@ -4820,8 +6107,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float AfterBeatErrorMargin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8272); }
+        get { return *(float*)(Ptr + 8272); }
+        set { *(float*)(Ptr + 8272) = value; }
     }
 
     /// <summary>
@@ -4829,8 +6116,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int timesRecharged
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8276); }
+        get { return *(int*)(Ptr + 8276); }
+        set { *(int*)(Ptr + 8276) = value; }
     }
 
     /// <summary>
@@ -4843,24 +6130,24 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int bPadCogsOn_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8280); }
+        get { return *(int*)(Ptr + 8280); }
+        set { *(int*)(Ptr + 8280) = value; }
     }
     /// <summary>
     /// IntProperty: bPadCogsOn
     /// </summary>
     public unsafe int bPadCogsOn_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8284); }
+        get { return *(int*)(Ptr + 8284); }
+        set { *(int*)(Ptr + 8284) = value; }
     }
     /// <summary>
     /// IntProperty: bPadCogsOn
     /// </summary>
     public unsafe int bPadCogsOn_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8288); }
+        get { return *(int*)(Ptr + 8288); }
+        set { *(int*)(Ptr + 8288) = value; }
     }
 
     /// <summary>
@@ -4868,8 +6155,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float cogAcceleration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8292); }
+        get { return *(float*)(Ptr + 8292); }
+        set { *(float*)(Ptr + 8292) = value; }
     }
 
     /// <summary>
@@ -4913,8 +6200,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float veinColourTarget
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8312); }
+        get { return *(float*)(Ptr + 8312); }
+        set { *(float*)(Ptr + 8312) = value; }
     }
 
     /// <summary>
@@ -4922,8 +6209,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float veinColourCurrentVal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8316); }
+        get { return *(float*)(Ptr + 8316); }
+        set { *(float*)(Ptr + 8316) = value; }
     }
 
     /// <summary>
@@ -4931,8 +6218,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float veinColourTransitionPeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8320); }
+        get { return *(float*)(Ptr + 8320); }
+        set { *(float*)(Ptr + 8320) = value; }
     }
 
     /// <summary>
@@ -4940,8 +6227,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float veinSecondaryPulseTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8324); }
+        get { return *(float*)(Ptr + 8324); }
+        set { *(float*)(Ptr + 8324) = value; }
     }
 
     /// <summary>
@@ -4949,8 +6236,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float veinSecondaryPulseCurrentVal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8328); }
+        get { return *(float*)(Ptr + 8328); }
+        set { *(float*)(Ptr + 8328) = value; }
     }
 
     /// <summary>
@@ -4958,8 +6245,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float veinSecondaryPulsePeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8332); }
+        get { return *(float*)(Ptr + 8332); }
+        set { *(float*)(Ptr + 8332) = value; }
     }
 
     /// <summary>
@@ -4967,8 +6254,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float veinSecondaryPulseMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8336); }
+        get { return *(float*)(Ptr + 8336); }
+        set { *(float*)(Ptr + 8336) = value; }
     }
 
     /// <summary>
@@ -5024,8 +6311,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float roomShutdownDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8376); }
+        get { return *(float*)(Ptr + 8376); }
+        set { *(float*)(Ptr + 8376) = value; }
     }
 
     /// <summary>
@@ -5033,8 +6320,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float roomHitReactDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8380); }
+        get { return *(float*)(Ptr + 8380); }
+        set { *(float*)(Ptr + 8380) = value; }
     }
 
     /// <summary>
@@ -5042,8 +6329,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float roomHitReactFlashPeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8384); }
+        get { return *(float*)(Ptr + 8384); }
+        set { *(float*)(Ptr + 8384) = value; }
     }
 
     /// <summary>
@@ -5051,8 +6338,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float beamHitReactEndTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8388); }
+        get { return *(float*)(Ptr + 8388); }
+        set { *(float*)(Ptr + 8388) = value; }
     }
 
     /// <summary>
@@ -5069,8 +6356,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float colourThreshLower
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8396); }
+        get { return *(float*)(Ptr + 8396); }
+        set { *(float*)(Ptr + 8396) = value; }
     }
 
     /// <summary>
@@ -5078,8 +6365,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float colourThreshUpper
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8400); }
+        get { return *(float*)(Ptr + 8400); }
+        set { *(float*)(Ptr + 8400) = value; }
     }
 
     /// <summary>
@@ -5087,8 +6374,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float colourValAtLowerThresh
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8404); }
+        get { return *(float*)(Ptr + 8404); }
+        set { *(float*)(Ptr + 8404) = value; }
     }
 
     /// <summary>
@@ -5096,8 +6383,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float colourValAtUpperThresh
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8408); }
+        get { return *(float*)(Ptr + 8408); }
+        set { *(float*)(Ptr + 8408) = value; }
     }
 
     /// <summary>
@@ -5105,8 +6392,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float grundyComboDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8412); }
+        get { return *(float*)(Ptr + 8412); }
+        set { *(float*)(Ptr + 8412) = value; }
     }
 
     /// <summary>
@@ -5123,8 +6410,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float CrucifiedHeartGlowVal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8420); }
+        get { return *(float*)(Ptr + 8420); }
+        set { *(float*)(Ptr + 8420) = value; }
     }
 
     /// <summary>
@@ -5141,8 +6428,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float smashHitZOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8436); }
+        get { return *(float*)(Ptr + 8436); }
+        set { *(float*)(Ptr + 8436) = value; }
     }
 
     /// <summary>
@@ -5150,8 +6437,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float pillarDamageRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8440); }
+        get { return *(float*)(Ptr + 8440); }
+        set { *(float*)(Ptr + 8440) = value; }
     }
 
     /// <summary>
@@ -5159,8 +6446,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float grundySwingSlideRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8444); }
+        get { return *(float*)(Ptr + 8444); }
+        set { *(float*)(Ptr + 8444) = value; }
     }
 
     /// <summary>
@@ -5168,8 +6455,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int dbgNumSwing
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8448); }
+        get { return *(int*)(Ptr + 8448); }
+        set { *(int*)(Ptr + 8448) = value; }
     }
 
     /// <summary>
@@ -5177,8 +6464,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int dbgNumSmash
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8452); }
+        get { return *(int*)(Ptr + 8452); }
+        set { *(int*)(Ptr + 8452) = value; }
     }
 
     /// <summary>
@@ -5186,8 +6473,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int dbgnumMelee
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8456); }
+        get { return *(int*)(Ptr + 8456); }
+        set { *(int*)(Ptr + 8456) = value; }
     }
 
     /// <summary>
@@ -5195,8 +6482,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int dbgnumPickNextAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8460); }
+        get { return *(int*)(Ptr + 8460); }
+        set { *(int*)(Ptr + 8460) = value; }
     }
 
     /// <summary>
@@ -5204,8 +6491,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe int dbgNumTooCloseForMelee
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8464); }
+        get { return *(int*)(Ptr + 8464); }
+        set { *(int*)(Ptr + 8464) = value; }
     }
 
     /// <summary>
@@ -5267,8 +6554,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushRumbleIntervalMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8492); }
+        get { return *(float*)(Ptr + 8492); }
+        set { *(float*)(Ptr + 8492) = value; }
     }
 
     /// <summary>
@@ -5276,8 +6563,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float crushRumbleIntervalMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8496); }
+        get { return *(float*)(Ptr + 8496); }
+        set { *(float*)(Ptr + 8496) = value; }
     }
 
     /// <summary>
@@ -5285,8 +6572,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float nextCrushRumbleTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8500); }
+        get { return *(float*)(Ptr + 8500); }
+        set { *(float*)(Ptr + 8500) = value; }
     }
 
     /// <summary>
@@ -5303,8 +6590,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float grundySafeDistFromPad
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8508); }
+        get { return *(float*)(Ptr + 8508); }
+        set { *(float*)(Ptr + 8508) = value; }
     }
 
     /// <summary>
@@ -5364,8 +6651,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float PadScaleAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8608); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8608); }
+        get { return *(float*)(Ptr + 8608); }
+        set { *(float*)(Ptr + 8608) = value; }
     }
 
     /// <summary>
@@ -5373,8 +6660,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float BMKnockBackDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8612); }
+        get { return *(float*)(Ptr + 8612); }
+        set { *(float*)(Ptr + 8612) = value; }
     }
 
     /// <summary>
@@ -5418,8 +6705,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingWeakRumbleRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8632); }
+        get { return *(float*)(Ptr + 8632); }
+        set { *(float*)(Ptr + 8632) = value; }
     }
 
     /// <summary>
@@ -5427,8 +6714,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingStrongRumbleRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8636); }
+        get { return *(float*)(Ptr + 8636); }
+        set { *(float*)(Ptr + 8636) = value; }
     }
 
     /// <summary>
@@ -5502,8 +6789,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float swingImpactRagdollImpulse
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8688); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8688); }
+        get { return *(float*)(Ptr + 8688); }
+        set { *(float*)(Ptr + 8688) = value; }
     }
 
     /// <summary>
@@ -5511,8 +6798,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float ChainGrowRateModifier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8692); }
+        get { return *(float*)(Ptr + 8692); }
+        set { *(float*)(Ptr + 8692) = value; }
     }
 
     /// <summary>
@@ -5520,8 +6807,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float midDistMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8696); }
+        get { return *(float*)(Ptr + 8696); }
+        set { *(float*)(Ptr + 8696) = value; }
     }
 
     /// <summary>
@@ -5529,8 +6816,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float midDistMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8700); }
+        get { return *(float*)(Ptr + 8700); }
+        set { *(float*)(Ptr + 8700) = value; }
     }
 
     /// <summary>
@@ -5538,8 +6825,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float fakeDeathBlockingCylinderGrowRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8704); }
+        get { return *(float*)(Ptr + 8704); }
+        set { *(float*)(Ptr + 8704) = value; }
     }
 
     /// <summary>
@@ -5563,8 +6850,8 @@ public partial class RPawnBossGrundy : BmSDK.BmGame.RPawnBossGrundyBase, BmSDK.I
     /// </summary>
     public unsafe float firePatchBaseLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8732); }
+        get { return *(float*)(Ptr + 8732); }
+        set { *(float*)(Ptr + 8732) = value; }
     }
 
     /// <summary>
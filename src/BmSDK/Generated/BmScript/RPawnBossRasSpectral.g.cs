@@ -78,15 +78,30 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
         where TComponent : class, Framework.IScriptComponent<RPawnBossRasSpectral>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetCombatAimingConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetCombatAimingConfig_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCombatAimingConfig
     /// </summary>
     public unsafe override BmSDK.BmGame.RAimingConfig GetCombatAimingConfig()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.GetCombatAimingConfig", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAimingConfig>(paramsPtr + 0);
+        var funcManaged = s_GetCombatAimingConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.GetCombatAimingConfig", true);
+        var parms = new GetCombatAimingConfig_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RAimingConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SpawnChopAttackBarrierFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SpawnChopAttackBarrier_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 SwordLoc;
+        [FieldOffset(12)] public BmSDK.Rotator SwordRot;
     }
 
     /// <summary>
@@ -94,68 +109,108 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe override void SpawnChopAttackBarrier(System.Numerics.Vector3 SwordLoc, BmSDK.Rotator SwordRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SpawnChopAttackBarrier", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SwordLoc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SwordRot, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnChopAttackBarrierFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SpawnChopAttackBarrier", true);
+        var parms = new SpawnChopAttackBarrier_Params();
+        parms.SwordLoc = SwordLoc;
+        parms.SwordRot = SwordRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DeactivateWaistBlendFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DeactivateWaistBlendFX_Params
+    {
+    }
+
     /// <summary>
     /// Function: DeactivateWaistBlendFX
     /// </summary>
     public unsafe override void DeactivateWaistBlendFX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.DeactivateWaistBlendFX", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DeactivateWaistBlendFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.DeactivateWaistBlendFX", true);
+        var parms = new DeactivateWaistBlendFX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateWaistBlendFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ActivateWaistBlendFX_Params
+    {
+    }
+
     /// <summary>
     /// Function: ActivateWaistBlendFX
     /// </summary>
     public unsafe override void ActivateWaistBlendFX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ActivateWaistBlendFX", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateWaistBlendFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ActivateWaistBlendFX", true);
+        var parms = new ActivateWaistBlendFX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearShurikansFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearShurikans_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearShurikans
     /// </summary>
     public unsafe virtual void ClearShurikans()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ClearShurikans", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearShurikansFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ClearShurikans", true);
+        var parms = new ClearShurikans_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Destroyed_Params
+    {
+    }
+
     /// <summary>
     /// Function: Destroyed
     /// </summary>
     public unsafe override void Destroyed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.Destroyed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.Destroyed", true);
+        var parms = new Destroyed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateWeaponConfigUnarmedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CreateWeaponConfigUnarmed_Params
+    {
+        [FieldOffset(0)] public nint NewOwner;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateWeaponConfigUnarmed
     /// </summary>
     public unsafe override BmSDK.BmGame.RWeaponConfig CreateWeaponConfigUnarmed(BmSDK.GameObject NewOwner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.CreateWeaponConfigUnarmed", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewOwner, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWeaponConfig>(paramsPtr + 4);
+        var funcManaged = s_CreateWeaponConfigUnarmedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.CreateWeaponConfigUnarmed", true);
+        var parms = new CreateWeaponConfigUnarmed_Params();
+        parms.NewOwner = NewOwner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWeaponConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_CreateSpectralWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 900)]
+    private struct CreateSpectralWeaponConfig_Params
+    {
+        [FieldOffset(0)] public nint NewOwner;
+        [FieldOffset(4)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -163,11 +218,17 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RWeaponConfig CreateSpectralWeaponConfig(BmSDK.GameObject NewOwner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.CreateSpectralWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[900];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewOwner, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWeaponConfig>(paramsPtr + 4);
+        var funcManaged = s_CreateSpectralWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.CreateSpectralWeaponConfig", true);
+        var parms = new CreateSpectralWeaponConfig_Params();
+        parms.NewOwner = NewOwner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWeaponConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_HolsterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Holster_Params
+    {
     }
 
     /// <summary>
@@ -175,223 +236,349 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe virtual void Holster()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.Holster", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HolsterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.Holster", true);
+        var parms = new Holster_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GrabSwordFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GrabSword_Params
+    {
+    }
+
     /// <summary>
     /// Function: GrabSword
     /// </summary>
     public unsafe virtual void GrabSword()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.GrabSword", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GrabSwordFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.GrabSword", true);
+        var parms = new GrabSword_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetVisibilityFxFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetVisibilityFx_Params
+    {
+        [FieldOffset(0)] public float Param;
+    }
+
     /// <summary>
     /// Function: SetVisibilityFx
     /// </summary>
     public unsafe virtual void SetVisibilityFx(float Param)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SetVisibilityFx", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Param, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetVisibilityFxFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SetVisibilityFx", true);
+        var parms = new SetVisibilityFx_Params();
+        parms.Param = Param;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateVisibilityFxFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateVisibilityFx_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateVisibilityFx
     /// </summary>
     public unsafe virtual void UpdateVisibilityFx(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.UpdateVisibilityFx", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateVisibilityFxFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.UpdateVisibilityFx", true);
+        var parms = new UpdateVisibilityFx_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartDisappearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartDisappear_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartDisappear
     /// </summary>
     public unsafe virtual void StartDisappear()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.StartDisappear", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartDisappearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.StartDisappear", true);
+        var parms = new StartDisappear_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFacingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct UpdateFacing_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateFacing
     /// </summary>
     public unsafe virtual void UpdateFacing(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.UpdateFacing", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateFacingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.UpdateFacing", true);
+        var parms = new UpdateFacing_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OpenEyesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OpenEyes_Params
+    {
+    }
+
     /// <summary>
     /// Function: OpenEyes
     /// </summary>
     public unsafe virtual void OpenEyes()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.OpenEyes", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OpenEyesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.OpenEyes", true);
+        var parms = new OpenEyes_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Tick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: Tick
     /// </summary>
     public unsafe override void Tick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.Tick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.Tick", true);
+        var parms = new Tick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryDemonBlastAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TryDemonBlastAttack_Params
+    {
+    }
+
     /// <summary>
     /// Function: TryDemonBlastAttack
     /// </summary>
     public unsafe virtual void TryDemonBlastAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.TryDemonBlastAttack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TryDemonBlastAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.TryDemonBlastAttack", true);
+        var parms = new TryDemonBlastAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryChopAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TryChopAttack_Params
+    {
+    }
+
     /// <summary>
     /// Function: TryChopAttack
     /// </summary>
     public unsafe virtual void TryChopAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.TryChopAttack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TryChopAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.TryChopAttack", true);
+        var parms = new TryChopAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThrowSFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ThrowSFX_Params
+    {
+    }
+
     /// <summary>
     /// Function: ThrowSFX
     /// </summary>
     public unsafe virtual void ThrowSFX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ThrowSFX", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThrowSFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ThrowSFX", true);
+        var parms = new ThrowSFX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChopSFXFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ChopSFX_Params
+    {
+    }
+
     /// <summary>
     /// Function: ChopSFX
     /// </summary>
     public unsafe virtual void ChopSFX()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ChopSFX", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChopSFXFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ChopSFX", true);
+        var parms = new ChopSFX_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwordLiftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SwordLift_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwordLift
     /// </summary>
     public unsafe virtual void SwordLift()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SwordLift", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwordLiftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SwordLift", true);
+        var parms = new SwordLift_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwordContactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SwordContact_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwordContact
     /// </summary>
     public unsafe virtual void SwordContact()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SwordContact", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwordContactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SwordContact", true);
+        var parms = new SwordContact_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReleaseShurikanRightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct ReleaseShurikanRight_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReleaseShurikanRight
     /// </summary>
     public unsafe virtual void ReleaseShurikanRight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ReleaseShurikanRight", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReleaseShurikanRightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ReleaseShurikanRight", true);
+        var parms = new ReleaseShurikanRight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnShurikanRightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SpawnShurikanRight_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnShurikanRight
     /// </summary>
     public unsafe virtual void SpawnShurikanRight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SpawnShurikanRight", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnShurikanRightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SpawnShurikanRight", true);
+        var parms = new SpawnShurikanRight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReleaseShurikanLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 88)]
+    private struct ReleaseShurikanLeft_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReleaseShurikanLeft
     /// </summary>
     public unsafe virtual void ReleaseShurikanLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ReleaseShurikanLeft", true);
-        byte* paramsPtr = stackalloc byte[88];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReleaseShurikanLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.ReleaseShurikanLeft", true);
+        var parms = new ReleaseShurikanLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnShurikanLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SpawnShurikanLeft_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnShurikanLeft
     /// </summary>
     public unsafe virtual void SpawnShurikanLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SpawnShurikanLeft", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnShurikanLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SpawnShurikanLeft", true);
+        var parms = new SpawnShurikanLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryQueueNextThrowFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TryQueueNextThrow_Params
+    {
+    }
+
     /// <summary>
     /// Function: TryQueueNextThrow
     /// </summary>
     public unsafe virtual void TryQueueNextThrow()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.TryQueueNextThrow", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TryQueueNextThrowFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.TryQueueNextThrow", true);
+        var parms = new TryQueueNextThrow_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSwordRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct GetSwordRotation_Params
+    {
+        [FieldOffset(0)] public BmSDK.Rotator ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSwordRotation
     /// </summary>
     public unsafe override BmSDK.Rotator GetSwordRotation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.GetSwordRotation", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 0);
+        var funcManaged = s_GetSwordRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.GetSwordRotation", true);
+        var parms = new GetSwordRotation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetSwordLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetSwordLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
     }
 
     /// <summary>
@@ -399,10 +586,16 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe override System.Numerics.Vector3 GetSwordLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.GetSwordLocation", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetSwordLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.GetSwordLocation", true);
+        var parms = new GetSwordLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CreateSwordFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CreateSword_Params
+    {
     }
 
     /// <summary>
@@ -410,20 +603,26 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe virtual void CreateSword()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.CreateSword", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CreateSwordFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.CreateSword", true);
+        var parms = new CreateSword_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetHealth_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetHealth
     /// </summary>
     public unsafe override void SetHealth()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SetHealth", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnBossRasSpectral.SetHealth", true);
+        var parms = new SetHealth_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -441,8 +640,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe int CurrBlast
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3900); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3900); }
+        get { return *(int*)(Ptr + 3900); }
+        set { *(int*)(Ptr + 3900) = value; }
     }
 
     /// <summary>
@@ -459,8 +658,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float MeshScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3908); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3908); }
+        get { return *(float*)(Ptr + 3908); }
+        set { *(float*)(Ptr + 3908) = value; }
     }
 
     /// <summary>
@@ -468,8 +667,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float MeshOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3912); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3912); }
+        get { return *(float*)(Ptr + 3912); }
+        set { *(float*)(Ptr + 3912) = value; }
     }
 
     /// <summary>
@@ -477,8 +676,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float OffsetToRas
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3916); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3916); }
+        get { return *(float*)(Ptr + 3916); }
+        set { *(float*)(Ptr + 3916) = value; }
     }
 
     /// <summary>
@@ -486,8 +685,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float LeftShSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3920); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3920); }
+        get { return *(float*)(Ptr + 3920); }
+        set { *(float*)(Ptr + 3920) = value; }
     }
 
     /// <summary>
@@ -495,8 +694,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float LeftShTurnSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3924); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3924); }
+        get { return *(float*)(Ptr + 3924); }
+        set { *(float*)(Ptr + 3924) = value; }
     }
 
     /// <summary>
@@ -504,8 +703,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float LeftShThrowDirMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3928); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3928); }
+        get { return *(float*)(Ptr + 3928); }
+        set { *(float*)(Ptr + 3928) = value; }
     }
 
     /// <summary>
@@ -513,8 +712,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float LeftShTargetLocMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3932); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3932); }
+        get { return *(float*)(Ptr + 3932); }
+        set { *(float*)(Ptr + 3932) = value; }
     }
 
     /// <summary>
@@ -522,8 +721,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float RightShSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3936); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3936); }
+        get { return *(float*)(Ptr + 3936); }
+        set { *(float*)(Ptr + 3936) = value; }
     }
 
     /// <summary>
@@ -531,8 +730,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float RightShTurnSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3940); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3940); }
+        get { return *(float*)(Ptr + 3940); }
+        set { *(float*)(Ptr + 3940) = value; }
     }
 
     /// <summary>
@@ -540,8 +739,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float RightShThrowDirMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3944); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3944); }
+        get { return *(float*)(Ptr + 3944); }
+        set { *(float*)(Ptr + 3944) = value; }
     }
 
     /// <summary>
@@ -549,8 +748,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float RightShTargetLocMod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3948); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3948); }
+        get { return *(float*)(Ptr + 3948); }
+        set { *(float*)(Ptr + 3948) = value; }
     }
 
     /// <summary>
@@ -558,8 +757,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float ShLandOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3952); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3952); }
+        get { return *(float*)(Ptr + 3952); }
+        set { *(float*)(Ptr + 3952) = value; }
     }
 
     /// <summary>
@@ -567,8 +766,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float ShGroupTargetDistOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3956); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3956); }
+        get { return *(float*)(Ptr + 3956); }
+        set { *(float*)(Ptr + 3956) = value; }
     }
 
     /// <summary>
@@ -576,8 +775,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float ShGroupTargetLeftOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3960); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3960); }
+        get { return *(float*)(Ptr + 3960); }
+        set { *(float*)(Ptr + 3960) = value; }
     }
 
     /// <summary>
@@ -585,8 +784,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float ShGroupTargetRightOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3964); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3964); }
+        get { return *(float*)(Ptr + 3964); }
+        set { *(float*)(Ptr + 3964) = value; }
     }
 
     /// <summary>
@@ -648,8 +847,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float VisibilityVal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4008); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4008); }
+        get { return *(float*)(Ptr + 4008); }
+        set { *(float*)(Ptr + 4008) = value; }
     }
 
     /// <summary>
@@ -657,8 +856,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float TargetVisibilityVal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4012); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4012); }
+        get { return *(float*)(Ptr + 4012); }
+        set { *(float*)(Ptr + 4012) = value; }
     }
 
     /// <summary>
@@ -711,8 +910,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe bool bCreateMic
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4036) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4036); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4036); }
+        get { return (*(int*)(Ptr + 4036) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 4036) |= 1; else *(int*)(Ptr + 4036) &= ~1; }
     }
 
     /// <summary>
@@ -720,8 +919,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe bool bSwordInHand
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4036) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4036); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4036); }
+        get { return (*(int*)(Ptr + 4036) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 4036) |= 2; else *(int*)(Ptr + 4036) &= ~2; }
     }
 
     /// <summary>
@@ -729,8 +928,8 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe bool bFadeDone
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4036) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4036); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4036); }
+        get { return (*(int*)(Ptr + 4036) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 4036) |= 4; else *(int*)(Ptr + 4036) &= ~4; }
     }
 
     /// <summary>
@@ -738,7 +937,7 @@ public partial class RPawnBossRasSpectral : BmSDK.BmScript.RPawnBossRasScriptBas
     /// </summary>
     public unsafe float LastYawDelta
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4040); }
+        get { return *(float*)(Ptr + 4040); }
+        set { *(float*)(Ptr + 4040) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class RPawnBossVenomHenchmenSlowRide : BmSDK.BmScript.RPawnBossVe
     /// </summary>
     public unsafe int NumTimesToRIde
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3888); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3888); }
+        get { return *(int*)(Ptr + 3888); }
+        set { *(int*)(Ptr + 3888) = value; }
     }
 }
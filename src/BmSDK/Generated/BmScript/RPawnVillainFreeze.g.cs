@@ -78,16 +78,32 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
         where TComponent : class, Framework.IScriptComponent<RPawnVillainFreeze>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_FireRailsTargetSequenceEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct FireRailsTargetSequenceEvent_Params
+    {
+        [FieldOffset(0)] public nint RailsTarget;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FireRailsTargetSequenceEvent
     /// </summary>
     public unsafe virtual bool FireRailsTargetSequenceEvent(BmSDK.BmScript.RFreezeEnvironmentTarget RailsTarget)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FireRailsTargetSequenceEvent", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RailsTarget, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_FireRailsTargetSequenceEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FireRailsTargetSequenceEvent", true);
+        var parms = new FireRailsTargetSequenceEvent_Params();
+        parms.RailsTarget = RailsTarget?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FireIceMeshSequenceEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct FireIceMeshSequenceEvent_Params
+    {
+        [FieldOffset(0)] public nint IceMesh;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -95,11 +111,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool FireIceMeshSequenceEvent(BmSDK.BmScript.RFreezeDynamicSMIceFormation IceMesh)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FireIceMeshSequenceEvent", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IceMesh, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_FireIceMeshSequenceEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FireIceMeshSequenceEvent", true);
+        var parms = new FireIceMeshSequenceEvent_Params();
+        parms.IceMesh = IceMesh?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FireSequenceEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct FireSequenceEvent_Params
+    {
+        [FieldOffset(0)] public nint InEventClass;
     }
 
     /// <summary>
@@ -107,33 +130,53 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void FireSequenceEvent(BmSDK.Class InEventClass)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FireSequenceEvent", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InEventClass, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FireSequenceEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FireSequenceEvent", true);
+        var parms = new FireSequenceEvent_Params();
+        parms.InEventClass = InEventClass?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinishFinalBeatdownSequenceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinishFinalBeatdownSequence_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinishFinalBeatdownSequence
     /// </summary>
     public unsafe virtual void FinishFinalBeatdownSequence()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FinishFinalBeatdownSequence", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishFinalBeatdownSequenceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FinishFinalBeatdownSequence", true);
+        var parms = new FinishFinalBeatdownSequence_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetParameterInterferenceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetParameterInterference_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetParameterInterference
     /// </summary>
     public unsafe override BmSDK.Engine.AkParameterName GetParameterInterference()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetParameterInterference", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkParameterName>(paramsPtr + 0);
+        var funcManaged = s_GetParameterInterferenceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetParameterInterference", true);
+        var parms = new GetParameterInterference_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkParameterName)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetParameterAngleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetParameterAngle_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -141,10 +184,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override BmSDK.Engine.AkParameterName GetParameterAngle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetParameterAngle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkParameterName>(paramsPtr + 0);
+        var funcManaged = s_GetParameterAngleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetParameterAngle", true);
+        var parms = new GetParameterAngle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AkParameterName)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ShouldAutoClimbAfterGrappleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ShouldAutoClimbAfterGrapple_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ClimbLocation;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -152,11 +203,17 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool ShouldAutoClimbAfterGrapple(System.Numerics.Vector3 ClimbLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldAutoClimbAfterGrapple", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClimbLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_ShouldAutoClimbAfterGrappleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldAutoClimbAfterGrapple", true);
+        var parms = new ShouldAutoClimbAfterGrapple_Params();
+        parms.ClimbLocation = ClimbLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FinishBackscreenDownloadTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinishBackscreenDownloadTimer_Params
+    {
     }
 
     /// <summary>
@@ -164,33 +221,53 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void FinishBackscreenDownloadTimer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FinishBackscreenDownloadTimer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinishBackscreenDownloadTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FinishBackscreenDownloadTimer", true);
+        var parms = new FinishBackscreenDownloadTimer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartBackscreenDownloadTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartBackscreenDownloadTimer_Params
+    {
+        [FieldOffset(0)] public float TimerDuration;
+    }
+
     /// <summary>
     /// Function: StartBackscreenDownloadTimer
     /// </summary>
     public unsafe virtual void StartBackscreenDownloadTimer(float TimerDuration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StartBackscreenDownloadTimer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TimerDuration, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartBackscreenDownloadTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StartBackscreenDownloadTimer", true);
+        var parms = new StartBackscreenDownloadTimer_Params();
+        parms.TimerDuration = TimerDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanOpenBackScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanOpenBackScreen_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanOpenBackScreen
     /// </summary>
     public unsafe override bool CanOpenBackScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanOpenBackScreen", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanOpenBackScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanOpenBackScreen", true);
+        var parms = new CanOpenBackScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ReachedRageBeatdownPositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 112)]
+    private struct ReachedRageBeatdownPosition_Params
+    {
     }
 
     /// <summary>
@@ -198,247 +275,386 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void ReachedRageBeatdownPosition()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ReachedRageBeatdownPosition", true);
-        byte* paramsPtr = stackalloc byte[112];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReachedRageBeatdownPositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ReachedRageBeatdownPosition", true);
+        var parms = new ReachedRageBeatdownPosition_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinalStrikeLoseHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinalStrikeLoseHealth_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinalStrikeLoseHealth
     /// </summary>
     public unsafe virtual void FinalStrikeLoseHealth()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FinalStrikeLoseHealth", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinalStrikeLoseHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FinalStrikeLoseHealth", true);
+        var parms = new FinalStrikeLoseHealth_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FinalStrikeShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FinalStrikeShake_Params
+    {
+    }
+
     /// <summary>
     /// Function: FinalStrikeShake
     /// </summary>
     public unsafe virtual void FinalStrikeShake()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FinalStrikeShake", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FinalStrikeShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FinalStrikeShake", true);
+        var parms = new FinalStrikeShake_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GeneralStrikeShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct GeneralStrikeShake_Params
+    {
+    }
+
     /// <summary>
     /// Function: GeneralStrikeShake
     /// </summary>
     public unsafe virtual void GeneralStrikeShake()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GeneralStrikeShake", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GeneralStrikeShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GeneralStrikeShake", true);
+        var parms = new GeneralStrikeShake_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BareFaceStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BareFaceStrike_Params
+    {
+    }
+
     /// <summary>
     /// Function: BareFaceStrike
     /// </summary>
     public unsafe virtual void BareFaceStrike()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BareFaceStrike", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BareFaceStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BareFaceStrike", true);
+        var parms = new BareFaceStrike_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactBatmanBoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ImpactBatmanBone_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName BatmanBone;
+    }
+
     /// <summary>
     /// Function: ImpactBatmanBone
     /// </summary>
     public unsafe virtual void ImpactBatmanBone(BmSDK.FName BatmanBone)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactBatmanBone", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BatmanBone, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactBatmanBoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactBatmanBone", true);
+        var parms = new ImpactBatmanBone_Params();
+        parms.BatmanBone = BatmanBone;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactKneeRightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactKneeRight_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactKneeRight
     /// </summary>
     public unsafe virtual void ImpactKneeRight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactKneeRight", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactKneeRightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactKneeRight", true);
+        var parms = new ImpactKneeRight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactKneeLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactKneeLeft_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactKneeLeft
     /// </summary>
     public unsafe virtual void ImpactKneeLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactKneeLeft", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactKneeLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactKneeLeft", true);
+        var parms = new ImpactKneeLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactElbowRightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactElbowRight_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactElbowRight
     /// </summary>
     public unsafe virtual void ImpactElbowRight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactElbowRight", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactElbowRightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactElbowRight", true);
+        var parms = new ImpactElbowRight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactElbowLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactElbowLeft_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactElbowLeft
     /// </summary>
     public unsafe virtual void ImpactElbowLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactElbowLeft", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactElbowLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactElbowLeft", true);
+        var parms = new ImpactElbowLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactFootRightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactFootRight_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactFootRight
     /// </summary>
     public unsafe virtual void ImpactFootRight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFootRight", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactFootRightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFootRight", true);
+        var parms = new ImpactFootRight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactFootLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactFootLeft_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactFootLeft
     /// </summary>
     public unsafe virtual void ImpactFootLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFootLeft", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactFootLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFootLeft", true);
+        var parms = new ImpactFootLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactFistRightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactFistRight_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactFistRight
     /// </summary>
     public unsafe virtual void ImpactFistRight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFistRight", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactFistRightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFistRight", true);
+        var parms = new ImpactFistRight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactFistLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactFistLeft_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactFistLeft
     /// </summary>
     public unsafe virtual void ImpactFistLeft()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFistLeft", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactFistLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFistLeft", true);
+        var parms = new ImpactFistLeft_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactFaceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ImpactFace_Params
+    {
+    }
+
     /// <summary>
     /// Function: ImpactFace
     /// </summary>
     public unsafe virtual void ImpactFace()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFace", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactFaceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFace", true);
+        var parms = new ImpactFace_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ImpactFaceInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ImpactFaceInternal_Params
+    {
+        [FieldOffset(0)] public int IsFinisher;
+    }
+
     /// <summary>
     /// Function: ImpactFaceInternal
     /// </summary>
     public unsafe virtual void ImpactFaceInternal(bool IsFinisher)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFaceInternal", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IsFinisher, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ImpactFaceInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ImpactFaceInternal", true);
+        var parms = new ImpactFaceInternal_Params();
+        parms.IsFinisher = IsFinisher ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShakeHealthBarFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShakeHealthBar_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShakeHealthBar
     /// </summary>
     public unsafe virtual void ShakeHealthBar()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShakeHealthBar", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShakeHealthBarFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShakeHealthBar", true);
+        var parms = new ShakeHealthBar_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SmashVisorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SmashVisor_Params
+    {
+    }
+
     /// <summary>
     /// Function: SmashVisor
     /// </summary>
     public unsafe virtual void SmashVisor()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SmashVisor", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SmashVisorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SmashVisor", true);
+        var parms = new SmashVisor_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetFootSparksActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetFootSparksActive_Params
+    {
+        [FieldOffset(0)] public int make_active;
+    }
+
     /// <summary>
     /// Function: SetFootSparksActive
     /// </summary>
     public unsafe virtual void SetFootSparksActive(bool make_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetFootSparksActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(make_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetFootSparksActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetFootSparksActive", true);
+        var parms = new SetFootSparksActive_Params();
+        parms.make_active = make_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetIceCrystalsActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetIceCrystalsActive_Params
+    {
+        [FieldOffset(0)] public int make_active;
+    }
+
     /// <summary>
     /// Function: SetIceCrystalsActive
     /// </summary>
     public unsafe virtual void SetIceCrystalsActive(bool make_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetIceCrystalsActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(make_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetIceCrystalsActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetIceCrystalsActive", true);
+        var parms = new SetIceCrystalsActive_Params();
+        parms.make_active = make_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInvulnerableShieldActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetInvulnerableShieldActive_Params
+    {
+        [FieldOffset(0)] public int is_active;
+    }
+
     /// <summary>
     /// Function: SetInvulnerableShieldActive
     /// </summary>
     public unsafe virtual void SetInvulnerableShieldActive(bool is_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetInvulnerableShieldActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInvulnerableShieldActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetInvulnerableShieldActive", true);
+        var parms = new SetInvulnerableShieldActive_Params();
+        parms.is_active = is_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetBossTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetBossTakedown_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnPlayer.EStealthTakeDownStages takedown_stage;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetBossTakedown
     /// </summary>
     public unsafe override BmSDK.Class GetBossTakedown(BmSDK.BmGame.RPawnPlayer.EStealthTakeDownStages takedown_stage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetBossTakedown", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(takedown_stage, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 4);
+        var funcManaged = s_GetBossTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetBossTakedown", true);
+        var parms = new GetBossTakedown_Params();
+        parms.takedown_stage = takedown_stage;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_DrawDebugGraphicsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DrawDebugGraphics_Params
+    {
     }
 
     /// <summary>
@@ -446,39 +662,67 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override void DrawDebugGraphics()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DrawDebugGraphics", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawDebugGraphicsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DrawDebugGraphics", true);
+        var parms = new DrawDebugGraphics_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateBatmansFreezeSpecificWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 284)]
+    private struct CreateBatmansFreezeSpecificWeaponConfig_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+    }
+
     /// <summary>
     /// Function: CreateBatmansFreezeSpecificWeaponConfig
     /// </summary>
     public unsafe virtual void CreateBatmansFreezeSpecificWeaponConfig(BmSDK.BmGame.RPawnPlayerCombat PlayerPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CreateBatmansFreezeSpecificWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[284];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CreateBatmansFreezeSpecificWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CreateBatmansFreezeSpecificWeaponConfig", true);
+        var parms = new CreateBatmansFreezeSpecificWeaponConfig_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateCombatWeaponConfigFreezeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5752)]
+    private struct CreateCombatWeaponConfigFreeze_Params
+    {
+        [FieldOffset(0)] public nint NewOwner;
+        [FieldOffset(4)] public nint Anims1;
+        [FieldOffset(8)] public nint Anims2;
+        [FieldOffset(12)] public nint Anims3;
+        [FieldOffset(16)] public nint Anims4;
+        [FieldOffset(20)] public nint Anims5;
+        [FieldOffset(24)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateCombatWeaponConfigFreeze
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RWeaponConfig CreateCombatWeaponConfigFreeze(BmSDK.GameObject NewOwner, BmSDK.Engine.AnimSet Anims1, BmSDK.Engine.AnimSet Anims2, BmSDK.Engine.AnimSet Anims3, BmSDK.Engine.AnimSet Anims4, BmSDK.Engine.AnimSet Anims5)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CreateCombatWeaponConfigFreeze", true);
-        byte* paramsPtr = stackalloc byte[5752];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewOwner, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Anims1, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Anims2, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Anims3, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Anims4, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Anims5, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWeaponConfig>(paramsPtr + 24);
+        var funcManaged = s_CreateCombatWeaponConfigFreezeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CreateCombatWeaponConfigFreeze", true);
+        var parms = new CreateCombatWeaponConfigFreeze_Params();
+        parms.NewOwner = NewOwner?.Ptr ?? 0;
+        parms.Anims1 = Anims1?.Ptr ?? 0;
+        parms.Anims2 = Anims2?.Ptr ?? 0;
+        parms.Anims3 = Anims3?.Ptr ?? 0;
+        parms.Anims4 = Anims4?.Ptr ?? 0;
+        parms.Anims5 = Anims5?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWeaponConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SetLegYawOnPoseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 680)]
+    private struct SetLegYawOnPose_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPoseConfig.FPose InPose;
+        [FieldOffset(340)] public BmSDK.BmGame.RPoseConfig.FPose ReturnValue;
     }
 
     /// <summary>
@@ -486,11 +730,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RPoseConfig.FPose SetLegYawOnPose(BmSDK.BmGame.RPoseConfig.FPose InPose)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetLegYawOnPose", true);
-        byte* paramsPtr = stackalloc byte[680];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InPose, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPoseConfig.FPose>(paramsPtr + 340);
+        var funcManaged = s_SetLegYawOnPoseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetLegYawOnPose", true);
+        var parms = new SetLegYawOnPose_Params();
+        parms.InPose = InPose;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ShouldFreezeBlastDoDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldFreezeBlastDoDamage_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -498,10 +749,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool ShouldFreezeBlastDoDamage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldFreezeBlastDoDamage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldFreezeBlastDoDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldFreezeBlastDoDamage", true);
+        var parms = new ShouldFreezeBlastDoDamage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_NotifyNoraStatueDestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct NotifyNoraStatueDestroyed_Params
+    {
+        [FieldOffset(0)] public int bDestroyedByFreeze;
+        [FieldOffset(4)] public System.Numerics.Vector3 StatueLocation;
     }
 
     /// <summary>
@@ -509,118 +768,190 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void NotifyNoraStatueDestroyed(bool bDestroyedByFreeze, System.Numerics.Vector3 StatueLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.NotifyNoraStatueDestroyed", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDestroyedByFreeze, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StatueLocation, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyNoraStatueDestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.NotifyNoraStatueDestroyed", true);
+        var parms = new NotifyNoraStatueDestroyed_Params();
+        parms.bDestroyedByFreeze = bDestroyedByFreeze ? 1 : 0;
+        parms.StatueLocation = StatueLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DroneKeepAliveCountdownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DroneKeepAliveCountdown_Params
+    {
+    }
+
     /// <summary>
     /// Function: DroneKeepAliveCountdown
     /// </summary>
     public unsafe virtual void DroneKeepAliveCountdown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DroneKeepAliveCountdown", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DroneKeepAliveCountdownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DroneKeepAliveCountdown", true);
+        var parms = new DroneKeepAliveCountdown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DroneKeepAliveTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DroneKeepAliveTick_Params
+    {
+    }
+
     /// <summary>
     /// Function: DroneKeepAliveTick
     /// </summary>
     public unsafe virtual void DroneKeepAliveTick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DroneKeepAliveTick", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DroneKeepAliveTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DroneKeepAliveTick", true);
+        var parms = new DroneKeepAliveTick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyDroneFoundBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NotifyDroneFoundBatman_Params
+    {
+        [FieldOffset(0)] public int bWasDestroyed;
+    }
+
     /// <summary>
     /// Function: NotifyDroneFoundBatman
     /// </summary>
     public unsafe virtual void NotifyDroneFoundBatman(bool bWasDestroyed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.NotifyDroneFoundBatman", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWasDestroyed, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyDroneFoundBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.NotifyDroneFoundBatman", true);
+        var parms = new NotifyDroneFoundBatman_Params();
+        parms.bWasDestroyed = bWasDestroyed ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyBatmanEntersOrLeavesHighBoxVolumeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NotifyBatmanEntersOrLeavesHighBoxVolume_Params
+    {
+        [FieldOffset(0)] public int is_entering;
+    }
+
     /// <summary>
     /// Function: NotifyBatmanEntersOrLeavesHighBoxVolume
     /// </summary>
     public unsafe virtual void NotifyBatmanEntersOrLeavesHighBoxVolume(bool is_entering)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.NotifyBatmanEntersOrLeavesHighBoxVolume", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_entering, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyBatmanEntersOrLeavesHighBoxVolumeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.NotifyBatmanEntersOrLeavesHighBoxVolume", true);
+        var parms = new NotifyBatmanEntersOrLeavesHighBoxVolume_Params();
+        parms.is_entering = is_entering ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FreezeNoticesTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FreezeNoticesTakedown_Params
+    {
+    }
+
     /// <summary>
     /// Function: FreezeNoticesTakedown
     /// </summary>
     public unsafe virtual void FreezeNoticesTakedown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FreezeNoticesTakedown", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FreezeNoticesTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FreezeNoticesTakedown", true);
+        var parms = new FreezeNoticesTakedown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanBumpedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct BatmanBumped_Params
+    {
+    }
+
     /// <summary>
     /// Function: BatmanBumped
     /// </summary>
     public unsafe virtual void BatmanBumped()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanBumped", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanBumpedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanBumped", true);
+        var parms = new BatmanBumped_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CollisionWithFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CollisionWith_Params
+    {
+        [FieldOffset(0)] public nint OtherPawn;
+    }
+
     /// <summary>
     /// Function: CollisionWith
     /// </summary>
     public unsafe override void CollisionWith(BmSDK.BmGame.RPawnCombat OtherPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CollisionWith", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CollisionWithFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CollisionWith", true);
+        var parms = new CollisionWith_Params();
+        parms.OtherPawn = OtherPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct Bump_Params
+    {
+        [FieldOffset(0)] public nint Other;
+        [FieldOffset(4)] public nint OtherComp;
+        [FieldOffset(8)] public System.Numerics.Vector3 HitNormal;
+    }
+
     /// <summary>
     /// Function: Bump
     /// </summary>
     public unsafe override void Bump(BmSDK.Engine.Actor Other, BmSDK.Engine.PrimitiveComponent OtherComp, System.Numerics.Vector3 HitNormal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.Bump", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Other, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OtherComp, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.Bump", true);
+        var parms = new Bump_Params();
+        parms.Other = Other?.Ptr ?? 0;
+        parms.OtherComp = OtherComp?.Ptr ?? 0;
+        parms.HitNormal = HitNormal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateWeaponConfigUnarmedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CreateWeaponConfigUnarmed_Params
+    {
+        [FieldOffset(0)] public nint NewOwner;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: CreateWeaponConfigUnarmed
     /// </summary>
     public unsafe override BmSDK.BmGame.RWeaponConfig CreateWeaponConfigUnarmed(BmSDK.GameObject NewOwner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CreateWeaponConfigUnarmed", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewOwner, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RWeaponConfig>(paramsPtr + 4);
+        var funcManaged = s_CreateWeaponConfigUnarmedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CreateWeaponConfigUnarmed", true);
+        var parms = new CreateWeaponConfigUnarmed_Params();
+        parms.NewOwner = NewOwner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmGame.RWeaponConfig)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsValidForStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct IsValidForStrike_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public nint TestPawn;
+        [FieldOffset(8)] public nint DamageType;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -628,13 +959,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsValidForStrike(BmSDK.BmGame.RPawnPlayerCombat PlayerPawn, BmSDK.BmGame.RPawnCombat TestPawn, BmSDK.Class DamageType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsValidForStrike", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPawn, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsValidForStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsValidForStrike", true);
+        var parms = new IsValidForStrike_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        parms.TestPawn = TestPawn?.Ptr ?? 0;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetFogProportionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetFogProportion_Params
+    {
+        [FieldOffset(0)] public float proportion_to_set;
     }
 
     /// <summary>
@@ -642,71 +980,114 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void SetFogProportion(float proportion_to_set)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetFogProportion", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(proportion_to_set, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetFogProportionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetFogProportion", true);
+        var parms = new SetFogProportion_Params();
+        parms.proportion_to_set = proportion_to_set;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickFogFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TickFog_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: TickFog
     /// </summary>
     public unsafe virtual void TickFog(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickFog", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickFogFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickFog", true);
+        var parms = new TickFog_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RollInFogFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RollInFog_Params
+    {
+        [FieldOffset(0)] public float TargetLevel;
+        [FieldOffset(4)] public float FogChangeDuration;
+    }
+
     /// <summary>
     /// Function: RollInFog
     /// </summary>
     public unsafe virtual void RollInFog(float TargetLevel, float FogChangeDuration = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.RollInFog", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TargetLevel, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FogChangeDuration, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RollInFogFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.RollInFog", true);
+        var parms = new RollInFog_Params();
+        parms.TargetLevel = TargetLevel;
+        parms.FogChangeDuration = FogChangeDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickRepelAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TickRepelAttack_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: TickRepelAttack
     /// </summary>
     public unsafe virtual void TickRepelAttack(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickRepelAttack", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickRepelAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickRepelAttack", true);
+        var parms = new TickRepelAttack_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RepelBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 144)]
+    private struct RepelBatman_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 RepelOrigin;
+    }
+
     /// <summary>
     /// Function: RepelBatman
     /// </summary>
     public unsafe virtual void RepelBatman(System.Numerics.Vector3 RepelOrigin)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.RepelBatman", true);
-        byte* paramsPtr = stackalloc byte[144];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RepelOrigin, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RepelBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.RepelBatman", true);
+        var parms = new RepelBatman_Params();
+        parms.RepelOrigin = RepelOrigin;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasRepelLineOfSightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct HasRepelLineOfSight_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasRepelLineOfSight
     /// </summary>
     public unsafe virtual bool HasRepelLineOfSight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HasRepelLineOfSight", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasRepelLineOfSightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HasRepelLineOfSight", true);
+        var parms = new HasRepelLineOfSight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpawnEmpEffectAtLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SpawnEmpEffectAtLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 EffectLocation;
     }
 
     /// <summary>
@@ -714,24 +1095,40 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void SpawnEmpEffectAtLocation(System.Numerics.Vector3 EffectLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SpawnEmpEffectAtLocation", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EffectLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnEmpEffectAtLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SpawnEmpEffectAtLocation", true);
+        var parms = new SpawnEmpEffectAtLocation_Params();
+        parms.EffectLocation = EffectLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldSpawnEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShouldSpawnEffect_Params
+    {
+        [FieldOffset(0)] public float previous_radius;
+        [FieldOffset(4)] public float actor_distance;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldSpawnEffect
     /// </summary>
     public unsafe virtual bool ShouldSpawnEffect(float previous_radius, float actor_distance)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldSpawnEffect", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(previous_radius, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(actor_distance, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_ShouldSpawnEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldSpawnEffect", true);
+        var parms = new ShouldSpawnEffect_Params();
+        parms.previous_radius = previous_radius;
+        parms.actor_distance = actor_distance;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TickEmpEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct TickEmpEffect_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -739,68 +1136,110 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void TickEmpEffect(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickEmpEffect", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickEmpEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickEmpEffect", true);
+        var parms = new TickEmpEffect_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SortElecticalActorsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SortElecticalActors_Params
+    {
+    }
+
     /// <summary>
     /// Function: SortElecticalActors
     /// </summary>
     public unsafe virtual void SortElecticalActors()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SortElecticalActors", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SortElecticalActorsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SortElecticalActors", true);
+        var parms = new SortElecticalActors_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseEmpEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct InitialiseEmpEffect_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitialiseEmpEffect
     /// </summary>
     public unsafe virtual void InitialiseEmpEffect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InitialiseEmpEffect", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseEmpEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InitialiseEmpEffect", true);
+        var parms = new InitialiseEmpEffect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseRearFacingRepelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InitialiseRearFacingRepel_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitialiseRearFacingRepel
     /// </summary>
     public unsafe virtual void InitialiseRearFacingRepel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InitialiseRearFacingRepel", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseRearFacingRepelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InitialiseRearFacingRepel", true);
+        var parms = new InitialiseRearFacingRepel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseRepelAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct InitialiseRepelAttack_Params
+    {
+        [FieldOffset(0)] public int large_scale;
+    }
+
     /// <summary>
     /// Function: InitialiseRepelAttack
     /// </summary>
     public unsafe virtual void InitialiseRepelAttack(bool large_scale)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InitialiseRepelAttack", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(large_scale, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseRepelAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InitialiseRepelAttack", true);
+        var parms = new InitialiseRepelAttack_Params();
+        parms.large_scale = large_scale ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsVulnerableToTakedownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct IsVulnerableToTakedown_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString takedown;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsVulnerableToTakedown
     /// </summary>
     public unsafe override bool IsVulnerableToTakedown(BmSDK.FString takedown)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToTakedown", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(takedown, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsVulnerableToTakedownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToTakedown", true);
+        var parms = new IsVulnerableToTakedown_Params();
+        parms.takedown = takedown;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsAwareOfPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsAwareOfPlayer_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public nint dmgType;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -808,12 +1247,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool IsAwareOfPlayer(BmSDK.BmGame.RPawnPlayer PlayerPawn, BmSDK.Class dmgType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsAwareOfPlayer", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_IsAwareOfPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsAwareOfPlayer", true);
+        var parms = new IsAwareOfPlayer_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsVulnerableToPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsVulnerableToPawn_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -821,11 +1268,17 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool IsVulnerableToPawn(BmSDK.BmGame.RPawnCombat Attacker)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToPawn", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsVulnerableToPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToPawn", true);
+        var parms = new IsVulnerableToPawn_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HitByJammerGadgetChargeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HitByJammerGadgetCharge_Params
+    {
     }
 
     /// <summary>
@@ -833,21 +1286,35 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override void HitByJammerGadgetCharge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HitByJammerGadgetCharge", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByJammerGadgetChargeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HitByJammerGadgetCharge", true);
+        var parms = new HitByJammerGadgetCharge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsVulnerableToJammerGadgetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsVulnerableToJammerGadget_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsVulnerableToJammerGadget
     /// </summary>
     public unsafe override bool IsVulnerableToJammerGadget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToJammerGadget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsVulnerableToJammerGadgetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToJammerGadget", true);
+        var parms = new IsVulnerableToJammerGadget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsOutsideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsOutside_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -855,10 +1322,17 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsOutside()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsOutside", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsOutsideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsOutside", true);
+        var parms = new IsOutside_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsVulnerableToBossStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsVulnerableToBossStrike_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -866,10 +1340,17 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool IsVulnerableToBossStrike()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToBossStrike", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsVulnerableToBossStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToBossStrike", true);
+        var parms = new IsVulnerableToBossStrike_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsVulnerableToStunStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsVulnerableToStunStrike_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -877,10 +1358,16 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool IsVulnerableToStunStrike()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToStunStrike", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsVulnerableToStunStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsVulnerableToStunStrike", true);
+        var parms = new IsVulnerableToStunStrike_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InvulnerableWhileSlidingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InvulnerableWhileSliding_Params
+    {
     }
 
     /// <summary>
@@ -888,35 +1375,60 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void InvulnerableWhileSliding()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InvulnerableWhileSliding", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InvulnerableWhileSlidingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InvulnerableWhileSliding", true);
+        var parms = new InvulnerableWhileSliding_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MakeInvulnerableWhileSlidingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MakeInvulnerableWhileSliding_Params
+    {
+        [FieldOffset(0)] public float SlideDuration;
+    }
+
     /// <summary>
     /// Function: MakeInvulnerableWhileSliding
     /// </summary>
     public unsafe virtual void MakeInvulnerableWhileSliding(float SlideDuration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.MakeInvulnerableWhileSliding", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SlideDuration, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MakeInvulnerableWhileSlidingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.MakeInvulnerableWhileSliding", true);
+        var parms = new MakeInvulnerableWhileSliding_Params();
+        parms.SlideDuration = SlideDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanRepelAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CanRepelAttack_Params
+    {
+        [FieldOffset(0)] public nint Attacker;
+        [FieldOffset(4)] public nint DamageType;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanRepelAttack
     /// </summary>
     public unsafe override bool CanRepelAttack(BmSDK.BmGame.RPawnCombat Attacker, BmSDK.Class DamageType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanRepelAttack", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Attacker, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_CanRepelAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanRepelAttack", true);
+        var parms = new CanRepelAttack_Params();
+        parms.Attacker = Attacker?.Ptr ?? 0;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TakeRageStrikeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TakeRageStrike_Params
+    {
+        [FieldOffset(0)] public float RageAnimScale;
+        [FieldOffset(4)] public float ClipFront;
+        [FieldOffset(8)] public float MeetingPoint;
     }
 
     /// <summary>
@@ -924,27 +1436,44 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void TakeRageStrike(float RageAnimScale, float ClipFront, float MeetingPoint = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TakeRageStrike", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RageAnimScale, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClipFront, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MeetingPoint, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TakeRageStrikeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TakeRageStrike", true);
+        var parms = new TakeRageStrike_Params();
+        parms.RageAnimScale = RageAnimScale;
+        parms.ClipFront = ClipFront;
+        parms.MeetingPoint = MeetingPoint;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TakeBossStrikeWhileExhaustedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 96)]
+    private struct TakeBossStrikeWhileExhausted_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 vBMtoFreeze;
+        [FieldOffset(12)] public int final_strike;
+        [FieldOffset(16)] public System.Numerics.Vector3 AttackLocation;
+        [FieldOffset(28)] public BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId ReturnValue;
+    }
+
     /// <summary>
     /// Function: TakeBossStrikeWhileExhausted
     /// </summary>
     public unsafe virtual BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId TakeBossStrikeWhileExhausted(System.Numerics.Vector3 vBMtoFreeze, bool final_strike, out System.Numerics.Vector3 AttackLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TakeBossStrikeWhileExhausted", true);
-        byte* paramsPtr = stackalloc byte[96];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(vBMtoFreeze, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(final_strike, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        AttackLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId>(paramsPtr + 28);
+        var funcManaged = s_TakeBossStrikeWhileExhaustedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TakeBossStrikeWhileExhausted", true);
+        var parms = new TakeBossStrikeWhileExhausted_Params();
+        parms.vBMtoFreeze = vBMtoFreeze;
+        parms.final_strike = final_strike ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        AttackLocation = parms.AttackLocation;
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRandomBeatDownReactionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetRandomBeatDownReaction_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ReturnValue;
     }
 
     /// <summary>
@@ -952,10 +1481,17 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual BmSDK.FName GetRandomBeatDownReaction()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetRandomBeatDownReaction", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 0);
+        var funcManaged = s_GetRandomBeatDownReactionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetRandomBeatDownReaction", true);
+        var parms = new GetRandomBeatDownReaction_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_TickMagneticBlastFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TickMagneticBlast_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -963,94 +1499,149 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override void TickMagneticBlast(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickMagneticBlast", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickMagneticBlastFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickMagneticBlast", true);
+        var parms = new TickMagneticBlast_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TranslateToPositionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct TranslateToPosition_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 target_position;
+    }
+
     /// <summary>
     /// Function: TranslateToPosition
     /// </summary>
     public unsafe virtual void TranslateToPosition(System.Numerics.Vector3 target_position)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TranslateToPosition", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(target_position, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TranslateToPositionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TranslateToPosition", true);
+        var parms = new TranslateToPosition_Params();
+        parms.target_position = target_position;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartHitWallFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartHitWall_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId QueuedAnimID;
+    }
+
     /// <summary>
     /// Function: StartHitWall
     /// </summary>
     public unsafe virtual void StartHitWall(BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId QueuedAnimID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StartHitWall", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(QueuedAnimID, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartHitWallFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StartHitWall", true);
+        var parms = new StartHitWall_Params();
+        parms.QueuedAnimID = QueuedAnimID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartFlyBackwardsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartFlyBackwards_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId QueuedAnimID;
+    }
+
     /// <summary>
     /// Function: StartFlyBackwards
     /// </summary>
     public unsafe virtual void StartFlyBackwards(BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId QueuedAnimID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StartFlyBackwards", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(QueuedAnimID, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartFlyBackwardsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StartFlyBackwards", true);
+        var parms = new StartFlyBackwards_Params();
+        parms.QueuedAnimID = QueuedAnimID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetMagBlastPhaseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetMagBlastPhase_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.MagneticBlastPhase new_phase;
+    }
+
     /// <summary>
     /// Function: SetMagBlastPhase
     /// </summary>
     public unsafe virtual void SetMagBlastPhase(BmSDK.BmScript.RPawnVillainFreeze.MagneticBlastPhase new_phase)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetMagBlastPhase", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_phase, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetMagBlastPhaseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetMagBlastPhase", true);
+        var parms = new SetMagBlastPhase_Params();
+        parms.new_phase = new_phase;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindMagBlastFlightTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct FindMagBlastFlightTime_Params
+    {
+    }
+
     /// <summary>
     /// Function: FindMagBlastFlightTime
     /// </summary>
     public unsafe virtual void FindMagBlastFlightTime()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindMagBlastFlightTime", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FindMagBlastFlightTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindMagBlastFlightTime", true);
+        var parms = new FindMagBlastFlightTime_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoMagneticBlastAttractFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DoMagneticBlastAttract_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 magnet_source;
+        [FieldOffset(12)] public BmSDK.Rotator wall_normal;
+    }
+
     /// <summary>
     /// Function: DoMagneticBlastAttract
     /// </summary>
     public unsafe override void DoMagneticBlastAttract(System.Numerics.Vector3 magnet_source, BmSDK.Rotator wall_normal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoMagneticBlastAttract", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(magnet_source, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(wall_normal, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoMagneticBlastAttractFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoMagneticBlastAttract", true);
+        var parms = new DoMagneticBlastAttract_Params();
+        parms.magnet_source = magnet_source;
+        parms.wall_normal = wall_normal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetMagneticBlastDurationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetMagneticBlastDuration_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetMagneticBlastDuration
     /// </summary>
     public unsafe override float GetMagneticBlastDuration()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetMagneticBlastDuration", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetMagneticBlastDurationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetMagneticBlastDuration", true);
+        var parms = new GetMagneticBlastDuration_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DoRecoilAnimationSeekersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoRecoilAnimationSeekers_Params
+    {
     }
 
     /// <summary>
@@ -1058,106 +1649,171 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void DoRecoilAnimationSeekers()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoRecoilAnimationSeekers", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoRecoilAnimationSeekersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoRecoilAnimationSeekers", true);
+        var parms = new DoRecoilAnimationSeekers_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoRecoilAnimationGrenadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoRecoilAnimationGrenade_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoRecoilAnimationGrenade
     /// </summary>
     public unsafe virtual void DoRecoilAnimationGrenade()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoRecoilAnimationGrenade", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoRecoilAnimationGrenadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoRecoilAnimationGrenade", true);
+        var parms = new DoRecoilAnimationGrenade_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
-    /// <summary>
+    static BmSDK.Function s_DoRecoilAnimationFreezeBeamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoRecoilAnimationFreezeBeam_Params
+    {
+    }
+
+    /// <summary>
     /// Function: DoRecoilAnimationFreezeBeam
     /// </summary>
     public unsafe virtual void DoRecoilAnimationFreezeBeam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoRecoilAnimationFreezeBeam", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoRecoilAnimationFreezeBeamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoRecoilAnimationFreezeBeam", true);
+        var parms = new DoRecoilAnimationFreezeBeam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoLookAroundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DoLookAround_Params
+    {
+    }
+
     /// <summary>
     /// Function: DoLookAround
     /// </summary>
     public unsafe virtual void DoLookAround()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoLookAround", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoLookAroundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoLookAround", true);
+        var parms = new DoLookAround_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoKnockDownInternalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct DoKnockDownInternal_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 offender_origin;
+        [FieldOffset(12)] public int power_takedown;
+        [FieldOffset(16)] public int FromAbove;
+    }
+
     /// <summary>
     /// Function: DoKnockDownInternal
     /// </summary>
     public unsafe virtual void DoKnockDownInternal(System.Numerics.Vector3 offender_origin, bool power_takedown, bool FromAbove = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoKnockDownInternal", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(offender_origin, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(power_takedown, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FromAbove, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoKnockDownInternalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DoKnockDownInternal", true);
+        var parms = new DoKnockDownInternal_Params();
+        parms.offender_origin = offender_origin;
+        parms.power_takedown = power_takedown ? 1 : 0;
+        parms.FromAbove = FromAbove ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RespondToLineLauncherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct RespondToLineLauncher_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 batmans_position;
+        [FieldOffset(12)] public int be_knocked_down;
+    }
+
     /// <summary>
     /// Function: RespondToLineLauncher
     /// </summary>
     public unsafe override void RespondToLineLauncher(System.Numerics.Vector3 batmans_position, bool be_knocked_down)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.RespondToLineLauncher", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(batmans_position, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(be_knocked_down, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RespondToLineLauncherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.RespondToLineLauncher", true);
+        var parms = new RespondToLineLauncher_Params();
+        parms.batmans_position = batmans_position;
+        parms.be_knocked_down = be_knocked_down ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KickedByBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct KickedByBatman_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 batman_origin;
+    }
+
     /// <summary>
     /// Function: KickedByBatman
     /// </summary>
     public unsafe override void KickedByBatman(System.Numerics.Vector3 batman_origin)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.KickedByBatman", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(batman_origin, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KickedByBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.KickedByBatman", true);
+        var parms = new KickedByBatman_Params();
+        parms.batman_origin = batman_origin;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitWithGooMineEnhancedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct HitWithGooMineEnhanced_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 goo_origin;
+        [FieldOffset(12)] public int is_glass;
+    }
+
     /// <summary>
     /// Function: HitWithGooMineEnhanced
     /// </summary>
     public unsafe override void HitWithGooMineEnhanced(System.Numerics.Vector3 goo_origin, bool is_glass)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HitWithGooMineEnhanced", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(goo_origin, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_glass, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitWithGooMineEnhancedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HitWithGooMineEnhanced", true);
+        var parms = new HitWithGooMineEnhanced_Params();
+        parms.goo_origin = goo_origin;
+        parms.is_glass = is_glass ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BossCanTakeGooHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BossCanTakeGooHit_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: BossCanTakeGooHit
     /// </summary>
     public unsafe override bool BossCanTakeGooHit()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BossCanTakeGooHit", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_BossCanTakeGooHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BossCanTakeGooHit", true);
+        var parms = new BossCanTakeGooHit_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DamagedByFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 245)]
+    private struct DamagedBy_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo;
+        [FieldOffset(244)] public BmSDK.BmGame.RPawnCombat.DamageResult ReturnValue;
     }
 
     /// <summary>
@@ -1165,11 +1821,19 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override BmSDK.BmGame.RPawnCombat.DamageResult DamagedBy(BmSDK.BmGame.RPawnCombat.FDamageInfo DmgInfo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DamagedBy", true);
-        byte* paramsPtr = stackalloc byte[245];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DmgInfo, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPawnCombat.DamageResult>(paramsPtr + 244);
+        var funcManaged = s_DamagedByFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.DamagedBy", true);
+        var parms = new DamagedBy_Params();
+        parms.DmgInfo = DmgInfo;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_LightStunFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct LightStun_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 offender_origin;
+        [FieldOffset(12)] public int alert_to_position;
     }
 
     /// <summary>
@@ -1177,47 +1841,77 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void LightStun(System.Numerics.Vector3 offender_origin, bool alert_to_position)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.LightStun", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(offender_origin, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(alert_to_position, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LightStunFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.LightStun", true);
+        var parms = new LightStun_Params();
+        parms.offender_origin = offender_origin;
+        parms.alert_to_position = alert_to_position ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitByFreezeClusterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HitByFreezeCluster_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ClusterLocation;
+    }
+
     /// <summary>
     /// Function: HitByFreezeCluster
     /// </summary>
     public unsafe override void HitByFreezeCluster(System.Numerics.Vector3 ClusterLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HitByFreezeCluster", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClusterLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByFreezeClusterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HitByFreezeCluster", true);
+        var parms = new HitByFreezeCluster_Params();
+        parms.ClusterLocation = ClusterLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HitByFreezeBlastFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HitByFreezeBlast_Params
+    {
+    }
+
     /// <summary>
     /// Function: HitByFreezeBlast
     /// </summary>
     public unsafe override void HitByFreezeBlast()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HitByFreezeBlast", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HitByFreezeBlastFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HitByFreezeBlast", true);
+        var parms = new HitByFreezeBlast_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OverrideHarpoonHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OverrideHarpoonHit_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: OverrideHarpoonHit
     /// </summary>
     public unsafe override bool OverrideHarpoonHit(BmSDK.BmGame.RPawnPlayer PlayerPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.OverrideHarpoonHit", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_OverrideHarpoonHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.OverrideHarpoonHit", true);
+        var parms = new OverrideHarpoonHit_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StunPushFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct StunPush_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 goo_origin;
+        [FieldOffset(12)] public float OrientationProportion;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1225,12 +1919,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool StunPush(System.Numerics.Vector3 goo_origin, float OrientationProportion = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StunPush", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(goo_origin, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OrientationProportion, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_StunPushFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StunPush", true);
+        var parms = new StunPush_Params();
+        parms.goo_origin = goo_origin;
+        parms.OrientationProportion = OrientationProportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StunPullFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct StunPull_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 harpoon_origin;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1238,11 +1940,24 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool StunPull(System.Numerics.Vector3 harpoon_origin)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StunPull", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(harpoon_origin, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_StunPullFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StunPull", true);
+        var parms = new StunPull_Params();
+        parms.harpoon_origin = harpoon_origin;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OrientAndAnimateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 84)]
+    private struct OrientAndAnimate_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 object_position;
+        [FieldOffset(12)] public BmSDK.FName animation_if_object_in_front;
+        [FieldOffset(20)] public BmSDK.FName animation_if_object_behind;
+        [FieldOffset(28)] public BmSDK.FName MovementStance;
+        [FieldOffset(36)] public BmSDK.FName WeaponStance;
+        [FieldOffset(44)] public float TransitionMeetingPoint;
+        [FieldOffset(48)] public float OrientationProportion;
     }
 
     /// <summary>
@@ -1250,29 +1965,45 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void OrientAndAnimate(System.Numerics.Vector3 object_position, BmSDK.FName animation_if_object_in_front, BmSDK.FName animation_if_object_behind, BmSDK.FName MovementStance, BmSDK.FName WeaponStance, float TransitionMeetingPoint, float OrientationProportion = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.OrientAndAnimate", true);
-        byte* paramsPtr = stackalloc byte[84];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(object_position, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(animation_if_object_in_front, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(animation_if_object_behind, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MovementStance, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WeaponStance, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionMeetingPoint, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OrientationProportion, paramsPtr + 48);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OrientAndAnimateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.OrientAndAnimate", true);
+        var parms = new OrientAndAnimate_Params();
+        parms.object_position = object_position;
+        parms.animation_if_object_in_front = animation_if_object_in_front;
+        parms.animation_if_object_behind = animation_if_object_behind;
+        parms.MovementStance = MovementStance;
+        parms.WeaponStance = WeaponStance;
+        parms.TransitionMeetingPoint = TransitionMeetingPoint;
+        parms.OrientationProportion = OrientationProportion;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSourceDirectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct GetSourceDirection_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Source;
+        [FieldOffset(12)] public BmSDK.BmScript.RPawnVillainFreeze.SourceDirection ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSourceDirection
     /// </summary>
     public unsafe virtual BmSDK.BmScript.RPawnVillainFreeze.SourceDirection GetSourceDirection(System.Numerics.Vector3 Source)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetSourceDirection", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Source, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnVillainFreeze.SourceDirection>(paramsPtr + 12);
+        var funcManaged = s_GetSourceDirectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetSourceDirection", true);
+        var parms = new GetSourceDirection_Params();
+        parms.Source = Source;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsToLeftFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct IsToLeft_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Source;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1280,11 +2011,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsToLeft(System.Numerics.Vector3 Source)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsToLeft", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Source, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsToLeftFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsToLeft", true);
+        var parms = new IsToLeft_Params();
+        parms.Source = Source;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsInFrontFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct IsInFront_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Source;
+        [FieldOffset(12)] public float angle_radians;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1292,12 +2032,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsInFront(System.Numerics.Vector3 Source, float angle_radians = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsInFront", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Source, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(angle_radians, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_IsInFrontFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsInFront", true);
+        var parms = new IsInFront_Params();
+        parms.Source = Source;
+        parms.angle_radians = angle_radians;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StunReciprocalPeriodFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StunReciprocalPeriod_Params
+    {
     }
 
     /// <summary>
@@ -1305,32 +2051,53 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void StunReciprocalPeriod()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StunReciprocalPeriod", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StunReciprocalPeriodFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StunReciprocalPeriod", true);
+        var parms = new StunReciprocalPeriod_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartStunReciprocalTimerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartStunReciprocalTimer_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartStunReciprocalTimer
     /// </summary>
     public unsafe virtual void StartStunReciprocalTimer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StartStunReciprocalTimer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartStunReciprocalTimerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StartStunReciprocalTimer", true);
+        var parms = new StartStunReciprocalTimer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsStunReciprocalActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsStunReciprocalActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsStunReciprocalActive
     /// </summary>
     public unsafe virtual bool IsStunReciprocalActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsStunReciprocalActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsStunReciprocalActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsStunReciprocalActive", true);
+        var parms = new IsStunReciprocalActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanBeKnockedDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct CanBeKnockedDown_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString takedown;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1338,11 +2105,17 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool CanBeKnockedDown(BmSDK.FString takedown = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanBeKnockedDown", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(takedown, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_CanBeKnockedDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanBeKnockedDown", true);
+        var parms = new CanBeKnockedDown_Params();
+        parms.takedown = takedown;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_JammerGadgetMuzzleEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct JammerGadgetMuzzleEffect_Params
+    {
     }
 
     /// <summary>
@@ -1350,67 +2123,108 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void JammerGadgetMuzzleEffect()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.JammerGadgetMuzzleEffect", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_JammerGadgetMuzzleEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.JammerGadgetMuzzleEffect", true);
+        var parms = new JammerGadgetMuzzleEffect_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_JammerGadgetKnockDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct JammerGadgetKnockDown_Params
+    {
+    }
+
     /// <summary>
     /// Function: JammerGadgetKnockDown
     /// </summary>
     public unsafe virtual void JammerGadgetKnockDown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.JammerGadgetKnockDown", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_JammerGadgetKnockDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.JammerGadgetKnockDown", true);
+        var parms = new JammerGadgetKnockDown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ElectrifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Electrify_Params
+    {
+    }
+
     /// <summary>
     /// Function: Electrify
     /// </summary>
     public unsafe override void Electrify()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.Electrify", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ElectrifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.Electrify", true);
+        var parms = new Electrify_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceDisarmFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ForceDisarm_Params
+    {
+    }
+
     /// <summary>
     /// Function: ForceDisarm
     /// </summary>
     public unsafe override void ForceDisarm()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ForceDisarm", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceDisarmFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ForceDisarm", true);
+        var parms = new ForceDisarm_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisarmFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Disarm_Params
+    {
+    }
+
     /// <summary>
     /// Function: Disarm
     /// </summary>
     public unsafe override void Disarm()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.Disarm", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisarmFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.Disarm", true);
+        var parms = new Disarm_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnSpecialAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SpawnSpecialAttack_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+        [FieldOffset(4)] public nint dmgType;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SpawnSpecialAttack
     /// </summary>
     public unsafe override bool SpawnSpecialAttack(BmSDK.BmGame.RPawnPlayerCombat PlayerPawn, BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SpawnSpecialAttack", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_SpawnSpecialAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SpawnSpecialAttack", true);
+        var parms = new SpawnSpecialAttack_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanBeHitInCombatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanBeHitInCombat_Params
+    {
+        [FieldOffset(0)] public nint DamageType;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1418,11 +2232,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool CanBeHitInCombat(BmSDK.BmGame.RDamageType DamageType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanBeHitInCombat", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanBeHitInCombatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanBeHitInCombat", true);
+        var parms = new CanBeHitInCombat_Params();
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetBehaviour_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1430,10 +2251,16 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual BmSDK.BmScript.RBMBehaviour_Freeze GetBehaviour()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RBMBehaviour_Freeze>(paramsPtr + 0);
+        var funcManaged = s_GetBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetBehaviour", true);
+        var parms = new GetBehaviour_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmScript.RBMBehaviour_Freeze)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SonicBatarangKillFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SonicBatarangKill_Params
+    {
     }
 
     /// <summary>
@@ -1441,21 +2268,35 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override void SonicBatarangKill()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SonicBatarangKill", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SonicBatarangKillFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SonicBatarangKill", true);
+        var parms = new SonicBatarangKill_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanBatmanGrabFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct CanBatmanGrab_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RBMAIController.BatmanGrabType ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanBatmanGrab
     /// </summary>
     public unsafe override BmSDK.BmGame.RBMAIController.BatmanGrabType CanBatmanGrab()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanBatmanGrab", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RBMAIController.BatmanGrabType>(paramsPtr + 0);
+        var funcManaged = s_CanBatmanGrabFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CanBatmanGrab", true);
+        var parms = new CanBatmanGrab_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsBossFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsBoss_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1463,10 +2304,17 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override bool IsBoss()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsBoss", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsBossFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsBoss", true);
+        var parms = new IsBoss_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_StopFreezeSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct StopFreezeSound_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.FreezeSounds the_sound;
     }
 
     /// <summary>
@@ -1474,95 +2322,152 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void StopFreezeSound(BmSDK.BmScript.RPawnVillainFreeze.FreezeSounds the_sound)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StopFreezeSound", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(the_sound, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopFreezeSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.StopFreezeSound", true);
+        var parms = new StopFreezeSound_Params();
+        parms.the_sound = the_sound;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayFreezeSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct PlayFreezeSound_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.FreezeSounds the_sound;
+    }
+
     /// <summary>
     /// Function: PlayFreezeSound
     /// </summary>
     public unsafe virtual void PlayFreezeSound(BmSDK.BmScript.RPawnVillainFreeze.FreezeSounds the_sound)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayFreezeSound", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(the_sound, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayFreezeSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayFreezeSound", true);
+        var parms = new PlayFreezeSound_Params();
+        parms.the_sound = the_sound;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTelemetryWarningActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetTelemetryWarningActive_Params
+    {
+        [FieldOffset(0)] public int is_active;
+    }
+
     /// <summary>
     /// Function: SetTelemetryWarningActive
     /// </summary>
     public unsafe virtual void SetTelemetryWarningActive(bool is_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetTelemetryWarningActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTelemetryWarningActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetTelemetryWarningActive", true);
+        var parms = new SetTelemetryWarningActive_Params();
+        parms.is_active = is_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRoomFreezeExhaustActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetRoomFreezeExhaustActive_Params
+    {
+        [FieldOffset(0)] public int is_active;
+    }
+
     /// <summary>
     /// Function: SetRoomFreezeExhaustActive
     /// </summary>
     public unsafe virtual void SetRoomFreezeExhaustActive(bool is_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetRoomFreezeExhaustActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRoomFreezeExhaustActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetRoomFreezeExhaustActive", true);
+        var parms = new SetRoomFreezeExhaustActive_Params();
+        parms.is_active = is_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickMovingBitsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TickMovingBits_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: TickMovingBits
     /// </summary>
     public unsafe virtual void TickMovingBits(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickMovingBits", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickMovingBitsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickMovingBits", true);
+        var parms = new TickMovingBits_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TickSuitPulseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TickSuitPulse_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: TickSuitPulse
     /// </summary>
     public unsafe virtual void TickSuitPulse(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickSuitPulse", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickSuitPulseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickSuitPulse", true);
+        var parms = new TickSuitPulse_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSuitPulseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSuitPulse_Params
+    {
+        [FieldOffset(0)] public float Frequency;
+    }
+
     /// <summary>
     /// Function: SetSuitPulse
     /// </summary>
     public unsafe virtual void SetSuitPulse(float Frequency)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetSuitPulse", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Frequency, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSuitPulseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetSuitPulse", true);
+        var parms = new SetSuitPulse_Params();
+        parms.Frequency = Frequency;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsPointNearLaserFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct IsPointNearLaser_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 the_point;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsPointNearLaser
     /// </summary>
     public unsafe virtual bool IsPointNearLaser(System.Numerics.Vector3 the_point)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsPointNearLaser", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(the_point, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsPointNearLaserFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsPointNearLaser", true);
+        var parms = new IsPointNearLaser_Params();
+        parms.the_point = the_point;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TickLasersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct TickLasers_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -1570,86 +2475,139 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void TickLasers(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickLasers", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TickLasersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TickLasers", true);
+        var parms = new TickLasers_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLasersActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetLasersActive_Params
+    {
+        [FieldOffset(0)] public int lasers_active;
+    }
+
     /// <summary>
     /// Function: SetLasersActive
     /// </summary>
     public unsafe virtual void SetLasersActive(bool lasers_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetLasersActive", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(lasers_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLasersActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetLasersActive", true);
+        var parms = new SetLasersActive_Params();
+        parms.lasers_active = lasers_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLampStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetLampState_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.FreezeLampState lamp_state;
+    }
+
     /// <summary>
     /// Function: SetLampState
     /// </summary>
     public unsafe virtual void SetLampState(BmSDK.BmScript.RPawnVillainFreeze.FreezeLampState lamp_state)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetLampState", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(lamp_state, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLampStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetLampState", true);
+        var parms = new SetLampState_Params();
+        parms.lamp_state = lamp_state;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnImpactEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct SpawnImpactEffect_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ImpactLocation;
+        [FieldOffset(12)] public BmSDK.Rotator ImpactRotation;
+        [FieldOffset(24)] public int IsFinisher;
+    }
+
     /// <summary>
     /// Function: SpawnImpactEffect
     /// </summary>
     public unsafe virtual void SpawnImpactEffect(System.Numerics.Vector3 ImpactLocation, BmSDK.Rotator ImpactRotation, bool IsFinisher)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SpawnImpactEffect", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ImpactLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ImpactRotation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IsFinisher, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnImpactEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SpawnImpactEffect", true);
+        var parms = new SpawnImpactEffect_Params();
+        parms.ImpactLocation = ImpactLocation;
+        parms.ImpactRotation = ImpactRotation;
+        parms.IsFinisher = IsFinisher ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetGlassBrokenStageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetGlassBrokenStage_Params
+    {
+        [FieldOffset(0)] public float new_stage;
+    }
+
     /// <summary>
     /// Function: SetGlassBrokenStage
     /// </summary>
     public unsafe virtual void SetGlassBrokenStage(float new_stage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetGlassBrokenStage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_stage, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetGlassBrokenStageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetGlassBrokenStage", true);
+        var parms = new SetGlassBrokenStage_Params();
+        parms.new_stage = new_stage;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLampColourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SetLampColour_Params
+    {
+        [FieldOffset(0)] public float colR;
+        [FieldOffset(4)] public float colG;
+        [FieldOffset(8)] public float colB;
+    }
+
     /// <summary>
     /// Function: SetLampColour
     /// </summary>
     public unsafe virtual void SetLampColour(float colR, float colG, float colB)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetLampColour", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(colR, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(colG, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(colB, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLampColourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetLampColour", true);
+        var parms = new SetLampColour_Params();
+        parms.colR = colR;
+        parms.colG = colG;
+        parms.colB = colB;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetTimeSinceLastVocalFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetTimeSinceLastVocal_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetTimeSinceLastVocal
     /// </summary>
     public unsafe virtual float GetTimeSinceLastVocal()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetTimeSinceLastVocal", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetTimeSinceLastVocalFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetTimeSinceLastVocal", true);
+        var parms = new GetTimeSinceLastVocal_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SuspendBehaviourFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SuspendBehaviour_Params
+    {
+        [FieldOffset(0)] public int OnlyIfNoVisualContact;
     }
 
     /// <summary>
@@ -1657,35 +2615,58 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe override void SuspendBehaviour(bool OnlyIfNoVisualContact = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SuspendBehaviour", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OnlyIfNoVisualContact, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SuspendBehaviourFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SuspendBehaviour", true);
+        var parms = new SuspendBehaviour_Params();
+        parms.OnlyIfNoVisualContact = OnlyIfNoVisualContact ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetDialogueTimeStampFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetDialogueTimeStamp_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetDialogueTimeStamp
     /// </summary>
     public unsafe virtual void ResetDialogueTimeStamp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ResetDialogueTimeStamp", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetDialogueTimeStampFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ResetDialogueTimeStamp", true);
+        var parms = new ResetDialogueTimeStamp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindClearPointNearLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 72)]
+    private struct FindClearPointNearLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TheLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 ClearPoint;
+        [FieldOffset(24)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FindClearPointNearLocation
     /// </summary>
     public unsafe virtual bool FindClearPointNearLocation(System.Numerics.Vector3 TheLocation, out System.Numerics.Vector3 ClearPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindClearPointNearLocation", true);
-        byte* paramsPtr = stackalloc byte[72];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ClearPoint = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_FindClearPointNearLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindClearPointNearLocation", true);
+        var parms = new FindClearPointNearLocation_Params();
+        parms.TheLocation = TheLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ClearPoint = parms.ClearPoint;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsLocationClearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct IsLocationClear_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TestLocation;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1693,11 +2674,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsLocationClear(System.Numerics.Vector3 TestLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsLocationClear", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_IsLocationClearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsLocationClear", true);
+        var parms = new IsLocationClear_Params();
+        parms.TestLocation = TestLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsDirectionClearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct IsDirectionClear_Params
+    {
+        [FieldOffset(0)] public BmSDK.Rotator TestDirection;
+        [FieldOffset(12)] public float DistanceToTest;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1705,12 +2695,19 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsDirectionClear(BmSDK.Rotator TestDirection, float DistanceToTest = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsDirectionClear", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestDirection, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DistanceToTest, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_IsDirectionClearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsDirectionClear", true);
+        var parms = new IsDirectionClear_Params();
+        parms.TestDirection = TestDirection;
+        parms.DistanceToTest = DistanceToTest;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetBestArrayDirectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct GetBestArrayDirection_Params
+    {
+        [FieldOffset(12)] public float ReturnValue;
     }
 
     /// <summary>
@@ -1718,11 +2715,17 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual float GetBestArrayDirection(out BmSDK.TArray<int> DirectionClearArray)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetBestArrayDirection", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        DirectionClearArray = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 12);
+        var funcManaged = s_GetBestArrayDirectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetBestArrayDirection", true);
+        var parms = new GetBestArrayDirection_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        DirectionClearArray = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SampleAreaAndFindSafeDirectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 68)]
+    private struct SampleAreaAndFindSafeDirection_Params
+    {
     }
 
     /// <summary>
@@ -1730,22 +2733,39 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void SampleAreaAndFindSafeDirection()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SampleAreaAndFindSafeDirection", true);
-        byte* paramsPtr = stackalloc byte[68];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SampleAreaAndFindSafeDirectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SampleAreaAndFindSafeDirection", true);
+        var parms = new SampleAreaAndFindSafeDirection_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ArrayDirectionToYawFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ArrayDirectionToYaw_Params
+    {
+        [FieldOffset(0)] public float ArrayDirection;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ArrayDirectionToYaw
     /// </summary>
     public unsafe virtual int ArrayDirectionToYaw(float ArrayDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ArrayDirectionToYaw", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ArrayDirection, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_ArrayDirectionToYawFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ArrayDirectionToYaw", true);
+        var parms = new ArrayDirectionToYaw_Params();
+        parms.ArrayDirection = ArrayDirection;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsArrayRangeClearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct IsArrayRangeClear_Params
+    {
+        [FieldOffset(12)] public int TestDirIndex;
+        [FieldOffset(16)] public BmSDK.Rotator CurrentViewDirection;
+        [FieldOffset(28)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1753,13 +2773,22 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsArrayRangeClear(out BmSDK.TArray<int> DirectionClearArray, int TestDirIndex, BmSDK.Rotator CurrentViewDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsArrayRangeClear", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestDirIndex, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentViewDirection, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        DirectionClearArray = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_IsArrayRangeClearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsArrayRangeClear", true);
+        var parms = new IsArrayRangeClear_Params();
+        parms.TestDirIndex = TestDirIndex;
+        parms.CurrentViewDirection = CurrentViewDirection;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        DirectionClearArray = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TestArrayDirectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct TestArrayDirection_Params
+    {
+        [FieldOffset(12)] public int ArrayDirection;
+        [FieldOffset(16)] public BmSDK.Rotator CurrentViewDirection;
+        [FieldOffset(28)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1767,13 +2796,21 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool TestArrayDirection(out BmSDK.TArray<int> DirectionClearArray, int ArrayDirection, BmSDK.Rotator CurrentViewDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TestArrayDirection", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ArrayDirection, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentViewDirection, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        DirectionClearArray = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 28);
+        var funcManaged = s_TestArrayDirectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TestArrayDirection", true);
+        var parms = new TestArrayDirection_Params();
+        parms.ArrayDirection = ArrayDirection;
+        parms.CurrentViewDirection = CurrentViewDirection;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        DirectionClearArray = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<int>>((byte*)&parms + 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ArrayDirectionToDegreesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ArrayDirectionToDegrees_Params
+    {
+        [FieldOffset(0)] public float ArrayDirection;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1781,11 +2818,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual int ArrayDirectionToDegrees(float ArrayDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ArrayDirectionToDegrees", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ArrayDirection, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_ArrayDirectionToDegreesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ArrayDirectionToDegrees", true);
+        var parms = new ArrayDirectionToDegrees_Params();
+        parms.ArrayDirection = ArrayDirection;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_IsArrayDirectionClearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct IsArrayDirectionClear_Params
+    {
+        [FieldOffset(0)] public int ArrayDirection;
+        [FieldOffset(4)] public BmSDK.Rotator CurrentViewDirection;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1793,12 +2839,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsArrayDirectionClear(int ArrayDirection, BmSDK.Rotator CurrentViewDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsArrayDirectionClear", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ArrayDirection, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CurrentViewDirection, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_IsArrayDirectionClearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsArrayDirectionClear", true);
+        var parms = new IsArrayDirectionClear_Params();
+        parms.ArrayDirection = ArrayDirection;
+        parms.CurrentViewDirection = CurrentViewDirection;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FallTowardsClearAreaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FallTowardsClearArea_Params
+    {
     }
 
     /// <summary>
@@ -1806,61 +2858,102 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void FallTowardsClearArea()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FallTowardsClearArea", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FallTowardsClearAreaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FallTowardsClearArea", true);
+        var parms = new FallTowardsClearArea_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForObstaclesAtEndOfSlideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckForObstaclesAtEndOfSlide_Params
+    {
+    }
+
     /// <summary>
     /// Function: CheckForObstaclesAtEndOfSlide
     /// </summary>
     public unsafe virtual void CheckForObstaclesAtEndOfSlide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CheckForObstaclesAtEndOfSlide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckForObstaclesAtEndOfSlideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CheckForObstaclesAtEndOfSlide", true);
+        var parms = new CheckForObstaclesAtEndOfSlide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FallToEndOfSlopeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 84)]
+    private struct FallToEndOfSlope_Params
+    {
+        [FieldOffset(0)] public nint SlipperySlopeVolume;
+    }
+
     /// <summary>
     /// Function: FallToEndOfSlope
     /// </summary>
     public unsafe virtual void FallToEndOfSlope(BmSDK.BmScript.RFreezeSlipperySlopeVolume SlipperySlopeVolume)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FallToEndOfSlope", true);
-        byte* paramsPtr = stackalloc byte[84];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SlipperySlopeVolume, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FallToEndOfSlopeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FallToEndOfSlope", true);
+        var parms = new FallToEndOfSlope_Params();
+        parms.SlipperySlopeVolume = SlipperySlopeVolume?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckLeftAndRightForObstaclesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CheckLeftAndRightForObstacles_Params
+    {
+        [FieldOffset(0)] public int CheckLeft;
+        [FieldOffset(4)] public int CheckRight;
+        [FieldOffset(8)] public BmSDK.Rotator FinalFacingDirection;
+    }
+
     /// <summary>
     /// Function: CheckLeftAndRightForObstacles
     /// </summary>
     public unsafe virtual void CheckLeftAndRightForObstacles(bool CheckLeft, bool CheckRight, BmSDK.Rotator FinalFacingDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CheckLeftAndRightForObstacles", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckLeft, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CheckRight, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinalFacingDirection, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckLeftAndRightForObstaclesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CheckLeftAndRightForObstacles", true);
+        var parms = new CheckLeftAndRightForObstacles_Params();
+        parms.CheckLeft = CheckLeft ? 1 : 0;
+        parms.CheckRight = CheckRight ? 1 : 0;
+        parms.FinalFacingDirection = FinalFacingDirection;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForObstaclesWithPlusMinusOffsetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct CheckForObstaclesWithPlusMinusOffset_Params
+    {
+        [FieldOffset(0)] public BmSDK.Rotator FinalFacingDirection;
+        [FieldOffset(12)] public int YawOffset;
+        [FieldOffset(16)] public int PlusMinus;
+        [FieldOffset(20)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckForObstaclesWithPlusMinusOffset
     /// </summary>
     public unsafe virtual bool CheckForObstaclesWithPlusMinusOffset(BmSDK.Rotator FinalFacingDirection, int YawOffset, int PlusMinus)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CheckForObstaclesWithPlusMinusOffset", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FinalFacingDirection, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(YawOffset, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlusMinus, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 20);
+        var funcManaged = s_CheckForObstaclesWithPlusMinusOffsetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CheckForObstaclesWithPlusMinusOffset", true);
+        var parms = new CheckForObstaclesWithPlusMinusOffset_Params();
+        parms.FinalFacingDirection = FinalFacingDirection;
+        parms.YawOffset = YawOffset;
+        parms.PlusMinus = PlusMinus;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsDirectionOffsetClearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct IsDirectionOffsetClear_Params
+    {
+        [FieldOffset(0)] public BmSDK.Rotator TestDirection;
+        [FieldOffset(12)] public int YawOffset;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1868,12 +2961,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool IsDirectionOffsetClear(BmSDK.Rotator TestDirection, int YawOffset)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsDirectionOffsetClear", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestDirection, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(YawOffset, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_IsDirectionOffsetClearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsDirectionOffsetClear", true);
+        var parms = new IsDirectionOffsetClear_Params();
+        parms.TestDirection = TestDirection;
+        parms.YawOffset = YawOffset;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_TurnToFaceClearAreaFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct TurnToFaceClearArea_Params
+    {
+        [FieldOffset(0)] public int ClearFacingYaw;
+        [FieldOffset(4)] public float TurnDuration;
     }
 
     /// <summary>
@@ -1881,26 +2982,43 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void TurnToFaceClearArea(int ClearFacingYaw, float TurnDuration = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TurnToFaceClearArea", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClearFacingYaw, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TurnDuration, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TurnToFaceClearAreaFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TurnToFaceClearArea", true);
+        var parms = new TurnToFaceClearArea_Params();
+        parms.ClearFacingYaw = ClearFacingYaw;
+        parms.TurnDuration = TurnDuration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetTurnToFaceMeetingPointEndFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetTurnToFaceMeetingPointEnd_Params
+    {
+        [FieldOffset(0)] public float current_proportion;
+        [FieldOffset(4)] public float total_duration;
+        [FieldOffset(8)] public float requested_turn_duration;
+        [FieldOffset(12)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetTurnToFaceMeetingPointEnd
     /// </summary>
     public unsafe virtual float GetTurnToFaceMeetingPointEnd(float current_proportion, float total_duration, float requested_turn_duration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetTurnToFaceMeetingPointEnd", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(current_proportion, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(total_duration, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(requested_turn_duration, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 12);
+        var funcManaged = s_GetTurnToFaceMeetingPointEndFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetTurnToFaceMeetingPointEnd", true);
+        var parms = new GetTurnToFaceMeetingPointEnd_Params();
+        parms.current_proportion = current_proportion;
+        parms.total_duration = total_duration;
+        parms.requested_turn_duration = requested_turn_duration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetCurrentSlipperySlopeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetCurrentSlipperySlope_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1908,10 +3026,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual BmSDK.BmScript.RFreezeSlipperySlopeVolume GetCurrentSlipperySlope()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetCurrentSlipperySlope", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RFreezeSlipperySlopeVolume>(paramsPtr + 0);
+        var funcManaged = s_GetCurrentSlipperySlopeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetCurrentSlipperySlope", true);
+        var parms = new GetCurrentSlipperySlope_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmScript.RFreezeSlipperySlopeVolume)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ShouldBatmanUseSomersaultWhenAttackingFromFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ShouldBatmanUseSomersaultWhenAttackingFrom_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 BatmanPosition;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1919,11 +3045,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool ShouldBatmanUseSomersaultWhenAttackingFrom(System.Numerics.Vector3 BatmanPosition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldBatmanUseSomersaultWhenAttackingFrom", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BatmanPosition, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_ShouldBatmanUseSomersaultWhenAttackingFromFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldBatmanUseSomersaultWhenAttackingFrom", true);
+        var parms = new ShouldBatmanUseSomersaultWhenAttackingFrom_Params();
+        parms.BatmanPosition = BatmanPosition;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetFrozenCapeLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetFrozenCapeLevel_Params
+    {
+        [FieldOffset(0)] public float FrozenCapeLevel;
     }
 
     /// <summary>
@@ -1931,35 +3064,59 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void SetFrozenCapeLevel(float FrozenCapeLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetFrozenCapeLevel", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FrozenCapeLevel, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetFrozenCapeLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetFrozenCapeLevel", true);
+        var parms = new SetFrozenCapeLevel_Params();
+        parms.FrozenCapeLevel = FrozenCapeLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPropsInXrayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetPropsInXray_Params
+    {
+        [FieldOffset(0)] public int bActivate;
+    }
+
     /// <summary>
     /// Function: SetPropsInXray
     /// </summary>
     public unsafe override void SetPropsInXray(bool bActivate)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetPropsInXray", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bActivate, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetPropsInXrayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetPropsInXray", true);
+        var parms = new SetPropsInXray_Params();
+        parms.bActivate = bActivate ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayBatmanSpeechOnceOrInfrequentlyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PlayBatmanSpeechOnceOrInfrequently_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines LineToPlay;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PlayBatmanSpeechOnceOrInfrequently
     /// </summary>
     public unsafe virtual bool PlayBatmanSpeechOnceOrInfrequently(BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines LineToPlay)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayBatmanSpeechOnceOrInfrequently", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineToPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_PlayBatmanSpeechOnceOrInfrequentlyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayBatmanSpeechOnceOrInfrequently", true);
+        var parms = new PlayBatmanSpeechOnceOrInfrequently_Params();
+        parms.LineToPlay = LineToPlay;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayBatmanSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlayBatmanSpeech_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines LineToPlay;
+        [FieldOffset(4)] public int ForceInterrupt;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1967,12 +3124,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool PlayBatmanSpeech(BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines LineToPlay, bool ForceInterrupt = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayBatmanSpeech", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineToPlay, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceInterrupt, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_PlayBatmanSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayBatmanSpeech", true);
+        var parms = new PlayBatmanSpeech_Params();
+        parms.LineToPlay = LineToPlay;
+        parms.ForceInterrupt = ForceInterrupt ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_HasPlayedLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HasPlayedLine_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.FreezeDialogueLines LineToPlay;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1980,11 +3145,20 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool HasPlayedLine(BmSDK.BmScript.RPawnVillainFreeze.FreezeDialogueLines LineToPlay)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HasPlayedLine", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineToPlay, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_HasPlayedLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.HasPlayedLine", true);
+        var parms = new HasPlayedLine_Params();
+        parms.LineToPlay = LineToPlay;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayFreezeSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlayFreezeSpeech_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.FreezeDialogueLines LineToPlay;
+        [FieldOffset(4)] public int ForceInterrupt;
+        [FieldOffset(8)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1992,12 +3166,18 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual bool PlayFreezeSpeech(BmSDK.BmScript.RPawnVillainFreeze.FreezeDialogueLines LineToPlay, bool ForceInterrupt = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayFreezeSpeech", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineToPlay, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceInterrupt, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_PlayFreezeSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayFreezeSpeech", true);
+        var parms = new PlayFreezeSpeech_Params();
+        parms.LineToPlay = LineToPlay;
+        parms.ForceInterrupt = ForceInterrupt ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CommentObliviouslyOnLineLauncherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CommentObliviouslyOnLineLauncher_Params
+    {
     }
 
     /// <summary>
@@ -2005,110 +3185,172 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void CommentObliviouslyOnLineLauncher()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CommentObliviouslyOnLineLauncher", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CommentObliviouslyOnLineLauncherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.CommentObliviouslyOnLineLauncher", true);
+        var parms = new CommentObliviouslyOnLineLauncher_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShortPauseThenCommentObliviouslyOnLineLauncherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShortPauseThenCommentObliviouslyOnLineLauncher_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShortPauseThenCommentObliviouslyOnLineLauncher
     /// </summary>
     public unsafe virtual void ShortPauseThenCommentObliviouslyOnLineLauncher()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShortPauseThenCommentObliviouslyOnLineLauncher", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShortPauseThenCommentObliviouslyOnLineLauncherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShortPauseThenCommentObliviouslyOnLineLauncher", true);
+        var parms = new ShortPauseThenCommentObliviouslyOnLineLauncher_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AlertToGadgetNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AlertToGadgetNoise_Params
+    {
+    }
+
     /// <summary>
     /// Function: AlertToGadgetNoise
     /// </summary>
     public unsafe virtual void AlertToGadgetNoise()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.AlertToGadgetNoise", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AlertToGadgetNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.AlertToGadgetNoise", true);
+        var parms = new AlertToGadgetNoise_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShortPauseThenAlertToGadgetNoiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShortPauseThenAlertToGadgetNoise_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShortPauseThenAlertToGadgetNoise
     /// </summary>
     public unsafe virtual void ShortPauseThenAlertToGadgetNoise()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShortPauseThenAlertToGadgetNoise", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShortPauseThenAlertToGadgetNoiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShortPauseThenAlertToGadgetNoise", true);
+        var parms = new ShortPauseThenAlertToGadgetNoise_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RefreshLinelauncherAwarenessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RefreshLinelauncherAwareness_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshLinelauncherAwareness
     /// </summary>
     public unsafe virtual void RefreshLinelauncherAwareness()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.RefreshLinelauncherAwareness", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshLinelauncherAwarenessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.RefreshLinelauncherAwareness", true);
+        var parms = new RefreshLinelauncherAwareness_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AlertToLineLauncherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AlertToLineLauncher_Params
+    {
+    }
+
     /// <summary>
     /// Function: AlertToLineLauncher
     /// </summary>
     public unsafe virtual void AlertToLineLauncher()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.AlertToLineLauncher", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AlertToLineLauncherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.AlertToLineLauncher", true);
+        var parms = new AlertToLineLauncher_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShortPauseThenAlertToLineLauncherFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShortPauseThenAlertToLineLauncher_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShortPauseThenAlertToLineLauncher
     /// </summary>
     public unsafe virtual void ShortPauseThenAlertToLineLauncher()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShortPauseThenAlertToLineLauncher", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShortPauseThenAlertToLineLauncherFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShortPauseThenAlertToLineLauncher", true);
+        var parms = new ShortPauseThenAlertToLineLauncher_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanEntersVentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BatmanEntersVent_Params
+    {
+    }
+
     /// <summary>
     /// Function: BatmanEntersVent
     /// </summary>
     public unsafe override void BatmanEntersVent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanEntersVent", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanEntersVentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanEntersVent", true);
+        var parms = new BatmanEntersVent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AlertToBrokenGlassSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AlertToBrokenGlassSound_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 BreakageLocation;
+    }
+
     /// <summary>
     /// Function: AlertToBrokenGlassSound
     /// </summary>
     public unsafe override void AlertToBrokenGlassSound(System.Numerics.Vector3 BreakageLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.AlertToBrokenGlassSound", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BreakageLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AlertToBrokenGlassSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.AlertToBrokenGlassSound", true);
+        var parms = new AlertToBrokenGlassSound_Params();
+        parms.BreakageLocation = BreakageLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShouldSeekersSelfDestructFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ShouldSeekersSelfDestruct_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldSeekersSelfDestruct
     /// </summary>
     public unsafe virtual bool ShouldSeekersSelfDestruct()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldSeekersSelfDestruct", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_ShouldSeekersSelfDestructFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.ShouldSeekersSelfDestruct", true);
+        var parms = new ShouldSeekersSelfDestruct_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BecomeVulnerableAgainFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BecomeVulnerableAgain_Params
+    {
     }
 
     /// <summary>
@@ -2116,21 +3358,34 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void BecomeVulnerableAgain()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BecomeVulnerableAgain", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BecomeVulnerableAgainFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BecomeVulnerableAgain", true);
+        var parms = new BecomeVulnerableAgain_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsInvulnerableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsInvulnerable_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsInvulnerable
     /// </summary>
     public unsafe virtual bool IsInvulnerable()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsInvulnerable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsInvulnerableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.IsInvulnerable", true);
+        var parms = new IsInvulnerable_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PostRecoveryInvulnerablePeriodFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostRecoveryInvulnerablePeriod_Params
+    {
     }
 
     /// <summary>
@@ -2138,191 +3393,300 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void PostRecoveryInvulnerablePeriod()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PostRecoveryInvulnerablePeriod", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostRecoveryInvulnerablePeriodFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PostRecoveryInvulnerablePeriod", true);
+        var parms = new PostRecoveryInvulnerablePeriod_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanTalksAboutFlawedTacticFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BatmanTalksAboutFlawedTactic_Params
+    {
+    }
+
     /// <summary>
     /// Function: BatmanTalksAboutFlawedTactic
     /// </summary>
     public unsafe virtual void BatmanTalksAboutFlawedTactic()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanTalksAboutFlawedTactic", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanTalksAboutFlawedTacticFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanTalksAboutFlawedTactic", true);
+        var parms = new BatmanTalksAboutFlawedTactic_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PauseThenCommentOnFlawedTacticFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PauseThenCommentOnFlawedTactic_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines FlawDialogue;
+    }
+
     /// <summary>
     /// Function: PauseThenCommentOnFlawedTactic
     /// </summary>
     public unsafe virtual void PauseThenCommentOnFlawedTactic(BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines FlawDialogue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PauseThenCommentOnFlawedTactic", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FlawDialogue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PauseThenCommentOnFlawedTacticFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PauseThenCommentOnFlawedTactic", true);
+        var parms = new PauseThenCommentOnFlawedTactic_Params();
+        parms.FlawDialogue = FlawDialogue;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NoteAndMaybeCommentOnTacticalFlawFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct NoteAndMaybeCommentOnTacticalFlaw_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines FlawDialogue;
+    }
+
     /// <summary>
     /// Function: NoteAndMaybeCommentOnTacticalFlaw
     /// </summary>
     public unsafe virtual void NoteAndMaybeCommentOnTacticalFlaw(BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines FlawDialogue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.NoteAndMaybeCommentOnTacticalFlaw", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FlawDialogue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NoteAndMaybeCommentOnTacticalFlawFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.NoteAndMaybeCommentOnTacticalFlaw", true);
+        var parms = new NoteAndMaybeCommentOnTacticalFlaw_Params();
+        parms.FlawDialogue = FlawDialogue;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanTalksAboutIcyLedgeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BatmanTalksAboutIcyLedge_Params
+    {
+    }
+
     /// <summary>
     /// Function: BatmanTalksAboutIcyLedge
     /// </summary>
     public unsafe virtual void BatmanTalksAboutIcyLedge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanTalksAboutIcyLedge", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanTalksAboutIcyLedgeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanTalksAboutIcyLedge", true);
+        var parms = new BatmanTalksAboutIcyLedge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerDropFromIcyLedgeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TriggerDropFromIcyLedge_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerDropFromIcyLedge
     /// </summary>
     public unsafe override void TriggerDropFromIcyLedge()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TriggerDropFromIcyLedge", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerDropFromIcyLedgeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TriggerDropFromIcyLedge", true);
+        var parms = new TriggerDropFromIcyLedge_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BatmanTalksAboutFailedGlideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct BatmanTalksAboutFailedGlide_Params
+    {
+    }
+
     /// <summary>
     /// Function: BatmanTalksAboutFailedGlide
     /// </summary>
     public unsafe virtual void BatmanTalksAboutFailedGlide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanTalksAboutFailedGlide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BatmanTalksAboutFailedGlideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.BatmanTalksAboutFailedGlide", true);
+        var parms = new BatmanTalksAboutFailedGlide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayGlideFailAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayGlideFailAnim_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayGlideFailAnim
     /// </summary>
     public unsafe virtual void PlayGlideFailAnim()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayGlideFailAnim", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayGlideFailAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.PlayGlideFailAnim", true);
+        var parms = new PlayGlideFailAnim_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerFailedGlideMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 116)]
+    private struct TriggerFailedGlideMove_Params
+    {
+        [FieldOffset(0)] public nint RPC;
+        [FieldOffset(4)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc;
+    }
+
     /// <summary>
     /// Function: TriggerFailedGlideMove
     /// </summary>
     public unsafe override void TriggerFailedGlideMove(BmSDK.BmGame.RPlayerController RPC, BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator Loc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TriggerFailedGlideMove", true);
-        byte* paramsPtr = stackalloc byte[116];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RPC, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Loc, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerFailedGlideMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.TriggerFailedGlideMove", true);
+        var parms = new TriggerFailedGlideMove_Params();
+        parms.RPC = RPC?.Ptr ?? 0;
+        parms.Loc = Loc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindNoraStatuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FindNoraStatues_Params
+    {
+    }
+
     /// <summary>
     /// Function: FindNoraStatues
     /// </summary>
     public unsafe virtual void FindNoraStatues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindNoraStatues", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FindNoraStatuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindNoraStatues", true);
+        var parms = new FindNoraStatues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindElecticalDevicesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FindElecticalDevices_Params
+    {
+    }
+
     /// <summary>
     /// Function: FindElecticalDevices
     /// </summary>
     public unsafe virtual void FindElecticalDevices()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindElecticalDevices", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FindElecticalDevicesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindElecticalDevices", true);
+        var parms = new FindElecticalDevices_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindFogVolumesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FindFogVolumes_Params
+    {
+    }
+
     /// <summary>
     /// Function: FindFogVolumes
     /// </summary>
     public unsafe virtual void FindFogVolumes()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindFogVolumes", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FindFogVolumesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.FindFogVolumes", true);
+        var parms = new FindFogVolumes_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableGrateCollisionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EnableGrateCollision_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableGrateCollision
     /// </summary>
     public unsafe virtual void EnableGrateCollision()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.EnableGrateCollision", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableGrateCollisionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.EnableGrateCollision", true);
+        var parms = new EnableGrateCollision_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KeepFreezeHeadInvisibleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct KeepFreezeHeadInvisible_Params
+    {
+    }
+
     /// <summary>
     /// Function: KeepFreezeHeadInvisible
     /// </summary>
     public unsafe virtual void KeepFreezeHeadInvisible()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.KeepFreezeHeadInvisible", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KeepFreezeHeadInvisibleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.KeepFreezeHeadInvisible", true);
+        var parms = new KeepFreezeHeadInvisible_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetJokerHeadActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetJokerHeadActive_Params
+    {
+        [FieldOffset(0)] public int is_active;
+    }
+
     /// <summary>
     /// Function: SetJokerHeadActive
     /// </summary>
     public unsafe virtual void SetJokerHeadActive(bool is_active)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetJokerHeadActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(is_active, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetJokerHeadActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetJokerHeadActive", true);
+        var parms = new SetJokerHeadActive_Params();
+        parms.is_active = is_active ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitJokerHeadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InitJokerHead_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitJokerHead
     /// </summary>
     public unsafe virtual void InitJokerHead()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InitJokerHead", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitJokerHeadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.InitJokerHead", true);
+        var parms = new InitJokerHead_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetBatarangPriorityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetBatarangPriority_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetBatarangPriority
     /// </summary>
     public unsafe override float GetBatarangPriority()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetBatarangPriority", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetBatarangPriorityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.GetBatarangPriority", true);
+        var parms = new GetBatarangPriority_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetVocalsLoadedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetVocalsLoaded_Params
+    {
+        [FieldOffset(0)] public int bLoad;
     }
 
     /// <summary>
@@ -2330,33 +3694,46 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe virtual void SetVocalsLoaded(bool bLoad)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetVocalsLoaded", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLoad, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetVocalsLoadedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetVocalsLoaded", true);
+        var parms = new SetVocalsLoaded_Params();
+        parms.bLoad = bLoad ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetRedEyesParameterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetRedEyesParameter_Params
+    {
+        [FieldOffset(0)] public float RedEyesParameter;
+    }
+
     /// <summary>
     /// Function: SetRedEyesParameter
     /// </summary>
     public unsafe virtual void SetRedEyesParameter(float RedEyesParameter)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetRedEyesParameter", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RedEyesParameter, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetRedEyesParameterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.SetRedEyesParameter", true);
+        var parms = new SetRedEyesParameter_Params();
+        parms.RedEyesParameter = RedEyesParameter;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Initialise_Params
+    {
+    }
+
     /// <summary>
     /// Function: Initialise
     /// </summary>
     public unsafe override void Initialise()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.Initialise", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainFreeze.Initialise", true);
+        var parms = new Initialise_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -2493,8 +3870,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnVillainFreeze.MagneticBlastPhase magnetic_blast_phase
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnVillainFreeze.MagneticBlastPhase>(Ptr + 3640); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3640); }
+        get { return *(BmSDK.BmScript.RPawnVillainFreeze.MagneticBlastPhase*)(Ptr + 3640); }
+        set { *(BmSDK.BmScript.RPawnVillainFreeze.MagneticBlastPhase*)(Ptr + 3640) = value; }
     }
 
     /// <summary>
@@ -2502,8 +3879,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnVillainFreeze.FreezeLampState CurrentLampState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnVillainFreeze.FreezeLampState>(Ptr + 3641); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3641); }
+        get { return *(BmSDK.BmScript.RPawnVillainFreeze.FreezeLampState*)(Ptr + 3641); }
+        set { *(BmSDK.BmScript.RPawnVillainFreeze.FreezeLampState*)(Ptr + 3641) = value; }
     }
 
     /// <summary>
@@ -2511,8 +3888,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnVillainFreeze.FreezeDialogueLines MostRecentDialoguePlayed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnVillainFreeze.FreezeDialogueLines>(Ptr + 3642); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3642); }
+        get { return *(BmSDK.BmScript.RPawnVillainFreeze.FreezeDialogueLines*)(Ptr + 3642); }
+        set { *(BmSDK.BmScript.RPawnVillainFreeze.FreezeDialogueLines*)(Ptr + 3642) = value; }
     }
 
     /// <summary>
@@ -2520,8 +3897,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines FlawedTacticToCommentOn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines>(Ptr + 3643); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3643); }
+        get { return *(BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines*)(Ptr + 3643); }
+        set { *(BmSDK.BmScript.RPawnVillainFreeze.BatmanDialogueLines*)(Ptr + 3643) = value; }
     }
 
     /// <summary>
@@ -2529,8 +3906,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bStartedFacingMagSource
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 1; else *(int*)(Ptr + 3644) &= ~1; }
     }
 
     /// <summary>
@@ -2538,8 +3915,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool MagBlastFlightIsLong
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 2; else *(int*)(Ptr + 3644) &= ~2; }
     }
 
     /// <summary>
@@ -2547,8 +3924,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bBatmanHitByRepel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 4; else *(int*)(Ptr + 3644) &= ~4; }
     }
 
     /// <summary>
@@ -2556,8 +3933,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bRepelSoundPlayed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 8; else *(int*)(Ptr + 3644) &= ~8; }
     }
 
     /// <summary>
@@ -2565,8 +3942,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bRepelIceEffectApplied
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 16; else *(int*)(Ptr + 3644) &= ~16; }
     }
 
     /// <summary>
@@ -2574,8 +3951,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bIsLargeScaleRepel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 32; else *(int*)(Ptr + 3644) &= ~32; }
     }
 
     /// <summary>
@@ -2583,8 +3960,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bRoomFreezeExhaustActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 64; else *(int*)(Ptr + 3644) &= ~64; }
     }
 
     /// <summary>
@@ -2592,8 +3969,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bSuitDamageActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 128; else *(int*)(Ptr + 3644) &= ~128; }
     }
 
     /// <summary>
@@ -2601,8 +3978,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bFootSparksActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 256; else *(int*)(Ptr + 3644) &= ~256; }
     }
 
     /// <summary>
@@ -2610,8 +3987,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bInvulnerableShieldActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 512; else *(int*)(Ptr + 3644) &= ~512; }
     }
 
     /// <summary>
@@ -2619,8 +3996,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bIsClearOnLeft
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 1024; else *(int*)(Ptr + 3644) &= ~1024; }
     }
 
     /// <summary>
@@ -2628,8 +4005,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bIsClearOnRight
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 2048; else *(int*)(Ptr + 3644) &= ~2048; }
     }
 
     /// <summary>
@@ -2637,8 +4014,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bSuitLasersActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 4096; else *(int*)(Ptr + 3644) &= ~4096; }
     }
 
     /// <summary>
@@ -2646,8 +4023,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool TelemetryWarningActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 8192; else *(int*)(Ptr + 3644) &= ~8192; }
     }
 
     /// <summary>
@@ -2655,8 +4032,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bFogIsChanging
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 16384; else *(int*)(Ptr + 3644) &= ~16384; }
     }
 
     /// <summary>
@@ -2664,8 +4041,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bEmpActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 32768; else *(int*)(Ptr + 3644) &= ~32768; }
     }
 
     /// <summary>
@@ -2673,8 +4050,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe bool bJokerHeadActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3644); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 3644); }
+        get { return (*(int*)(Ptr + 3644) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 3644) |= 65536; else *(int*)(Ptr + 3644) &= ~65536; }
     }
 
     /// <summary>
@@ -2688,8 +4065,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float MagBlastFlightSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3660); }
+        get { return *(float*)(Ptr + 3660); }
+        set { *(float*)(Ptr + 3660) = value; }
     }
 
     /// <summary>
@@ -2697,8 +4074,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float MagBlastMinimumFlightTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3664); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3664); }
+        get { return *(float*)(Ptr + 3664); }
+        set { *(float*)(Ptr + 3664) = value; }
     }
 
     /// <summary>
@@ -2706,8 +4083,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float MagBlastFlightDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3668); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3668); }
+        get { return *(float*)(Ptr + 3668); }
+        set { *(float*)(Ptr + 3668) = value; }
     }
 
     /// <summary>
@@ -2721,8 +4098,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fRepelTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3684); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3684); }
+        get { return *(float*)(Ptr + 3684); }
+        set { *(float*)(Ptr + 3684) = value; }
     }
 
     /// <summary>
@@ -2730,8 +4107,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fRepelDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3688); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3688); }
+        get { return *(float*)(Ptr + 3688); }
+        set { *(float*)(Ptr + 3688) = value; }
     }
 
     /// <summary>
@@ -2739,8 +4116,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fRepelTimeToMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3692); }
+        get { return *(float*)(Ptr + 3692); }
+        set { *(float*)(Ptr + 3692) = value; }
     }
 
     /// <summary>
@@ -2748,8 +4125,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fRepelTriggerRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3696); }
+        get { return *(float*)(Ptr + 3696); }
+        set { *(float*)(Ptr + 3696) = value; }
     }
 
     /// <summary>
@@ -2757,8 +4134,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fRepelMaxRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3700); }
+        get { return *(float*)(Ptr + 3700); }
+        set { *(float*)(Ptr + 3700) = value; }
     }
 
     /// <summary>
@@ -2766,8 +4143,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fRoomAttackRepelRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3704); }
+        get { return *(float*)(Ptr + 3704); }
+        set { *(float*)(Ptr + 3704) = value; }
     }
 
     /// <summary>
@@ -2775,8 +4152,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe int iPreviousBeatDownReaction
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3708); }
+        get { return *(int*)(Ptr + 3708); }
+        set { *(int*)(Ptr + 3708) = value; }
     }
 
     /// <summary>
@@ -2997,8 +4374,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fBrokenGlassLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3964); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3964); }
+        get { return *(float*)(Ptr + 3964); }
+        set { *(float*)(Ptr + 3964) = value; }
     }
 
     /// <summary>
@@ -3006,8 +4383,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fCurrentSuitPulseFrequency
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3968); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3968); }
+        get { return *(float*)(Ptr + 3968); }
+        set { *(float*)(Ptr + 3968) = value; }
     }
 
     /// <summary>
@@ -3015,8 +4392,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fSuitPulseTimeCounter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 3972); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3972); }
+        get { return *(float*)(Ptr + 3972); }
+        set { *(float*)(Ptr + 3972) = value; }
     }
 
     /// <summary>
@@ -3024,8 +4401,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe int DroneKeepAliveCounter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 3976); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 3976); }
+        get { return *(int*)(Ptr + 3976); }
+        set { *(int*)(Ptr + 3976) = value; }
     }
 
     /// <summary>
@@ -3087,8 +4464,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float MostRecentDialogueTimeStamp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4036); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4036); }
+        get { return *(float*)(Ptr + 4036); }
+        set { *(float*)(Ptr + 4036) = value; }
     }
 
     /// <summary>
@@ -3123,8 +4500,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe int LaserTraceIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4076); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4076); }
+        get { return *(int*)(Ptr + 4076); }
+        set { *(int*)(Ptr + 4076) = value; }
     }
 
     /// <summary>
@@ -3132,8 +4509,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float FailedGlideInitialZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4080); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4080); }
+        get { return *(float*)(Ptr + 4080); }
+        set { *(float*)(Ptr + 4080) = value; }
     }
 
     /// <summary>
@@ -3150,8 +4527,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fFogTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4096); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4096); }
+        get { return *(float*)(Ptr + 4096); }
+        set { *(float*)(Ptr + 4096) = value; }
     }
 
     /// <summary>
@@ -3159,8 +4536,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fCurrentFogLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4100); }
+        get { return *(float*)(Ptr + 4100); }
+        set { *(float*)(Ptr + 4100) = value; }
     }
 
     /// <summary>
@@ -3168,8 +4545,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fTargetFogLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4104); }
+        get { return *(float*)(Ptr + 4104); }
+        set { *(float*)(Ptr + 4104) = value; }
     }
 
     /// <summary>
@@ -3177,8 +4554,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fFogChangeDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4108); }
+        get { return *(float*)(Ptr + 4108); }
+        set { *(float*)(Ptr + 4108) = value; }
     }
 
     /// <summary>
@@ -3186,8 +4563,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fFogChangeSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4112); }
+        get { return *(float*)(Ptr + 4112); }
+        set { *(float*)(Ptr + 4112) = value; }
     }
 
     /// <summary>
@@ -3213,8 +4590,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fEmpEffectRadiusSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4132); }
+        get { return *(float*)(Ptr + 4132); }
+        set { *(float*)(Ptr + 4132) = value; }
     }
 
     /// <summary>
@@ -3222,8 +4599,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fEmpEffectCurrentRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4136); }
+        get { return *(float*)(Ptr + 4136); }
+        set { *(float*)(Ptr + 4136) = value; }
     }
 
     /// <summary>
@@ -3231,8 +4608,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fBatmanDistanceForEmp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4140); }
+        get { return *(float*)(Ptr + 4140); }
+        set { *(float*)(Ptr + 4140) = value; }
     }
 
     /// <summary>
@@ -3258,8 +4635,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float fJokerHeadScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4152); }
+        get { return *(float*)(Ptr + 4152); }
+        set { *(float*)(Ptr + 4152) = value; }
     }
 
     /// <summary>
@@ -3267,8 +4644,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe int NumberOfDamagingBlastsThisSalvo
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4156); }
+        get { return *(int*)(Ptr + 4156); }
+        set { *(int*)(Ptr + 4156) = value; }
     }
 
     /// <summary>
@@ -3294,8 +4671,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float MovingBitsTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4168); }
+        get { return *(float*)(Ptr + 4168); }
+        set { *(float*)(Ptr + 4168) = value; }
     }
 
     /// <summary>
@@ -3303,8 +4680,8 @@ public partial class RPawnVillainFreeze : BmSDK.BmGame.RPawnVillainFreezeBase, B
     /// </summary>
     public unsafe float MovingBitsPeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4172); }
+        get { return *(float*)(Ptr + 4172); }
+        set { *(float*)(Ptr + 4172) = value; }
     }
 
     /// <summary>
@@ -78,41 +78,64 @@ public partial class RPawnVillainGunJammer : BmSDK.BmScript.RPawnVillainGunJamme
         where TComponent : class, Framework.IScriptComponent<RPawnVillainGunJammer>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UpdateAerialSnapAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct UpdateAerialSnapAnim_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+        [FieldOffset(4)] public BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId Transition;
+        [FieldOffset(8)] public nint OverrideAnimSet;
+    }
+
     /// <summary>
     /// Function: UpdateAerialSnapAnim
     /// </summary>
     public unsafe static void UpdateAerialSnapAnim(BmSDK.BmScript.RPawnVillainGunJammer Pawn, BmSDK.BmGame.RAnimUtil_PosePlayer.FTransitionId Transition, BmSDK.Engine.AnimSet OverrideAnimSet = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainGunJammer.UpdateAerialSnapAnim", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Transition, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OverrideAnimSet, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateAerialSnapAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainGunJammer.UpdateAerialSnapAnim", true);
+        var parms = new UpdateAerialSnapAnim_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        parms.Transition = Transition;
+        parms.OverrideAnimSet = OverrideAnimSet?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetAerialSnapAnimSetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetAerialSnapAnimSet_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+        [FieldOffset(4)] public nint VictimAnimSet;
+    }
+
     /// <summary>
     /// Function: SetAerialSnapAnimSet
     /// </summary>
     public unsafe static void SetAerialSnapAnimSet(BmSDK.BmScript.RPawnVillainGunJammer Pawn, BmSDK.Engine.AnimSet VictimAnimSet)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainGunJammer.SetAerialSnapAnimSet", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VictimAnimSet, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetAerialSnapAnimSetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainGunJammer.SetAerialSnapAnimSet", true);
+        var parms = new SetAerialSnapAnimSet_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        parms.VictimAnimSet = VictimAnimSet?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPawnPropsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 124)]
+    private struct AddPawnProps_Params
+    {
+    }
+
     /// <summary>
     /// Function: AddPawnProps
     /// </summary>
     public unsafe override void AddPawnProps()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainGunJammer.AddPawnProps", true);
-        byte* paramsPtr = stackalloc byte[124];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPawnPropsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainGunJammer.AddPawnProps", true);
+        var parms = new AddPawnProps_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
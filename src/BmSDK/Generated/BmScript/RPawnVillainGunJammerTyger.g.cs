@@ -78,14 +78,20 @@ public partial class RPawnVillainGunJammerTyger : BmSDK.BmScript.RPawnVillainGun
         where TComponent : class, Framework.IScriptComponent<RPawnVillainGunJammerTyger>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_AddPawnPropsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 124)]
+    private struct AddPawnProps_Params
+    {
+    }
+
     /// <summary>
     /// Function: AddPawnProps
     /// </summary>
     public unsafe override void AddPawnProps()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainGunJammerTyger.AddPawnProps", true);
-        byte* paramsPtr = stackalloc byte[124];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPawnPropsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RPawnVillainGunJammerTyger.AddPawnProps", true);
+        var parms = new AddPawnProps_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -78,58 +78,88 @@ public partial class RRECMotor : BmSDK.BmScript.RMagneticSurfaceSM, BmSDK.IGameO
         where TComponent : class, Framework.IScriptComponent<RRECMotor>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_MotorJammedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct MotorJammed_Params
+    {
+    }
+
     /// <summary>
     /// Function: MotorJammed
     /// </summary>
     public unsafe override void MotorJammed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.MotorJammed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MotorJammedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.MotorJammed", true);
+        var parms = new MotorJammed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopMotorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StopMotor_Params
+    {
+    }
+
     /// <summary>
     /// Function: StopMotor
     /// </summary>
     public unsafe override void StopMotor()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.StopMotor", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopMotorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.StopMotor", true);
+        var parms = new StopMotor_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayMotorDownFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayMotorDown_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayMotorDown
     /// </summary>
     public unsafe override void PlayMotorDown()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.PlayMotorDown", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayMotorDownFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.PlayMotorDown", true);
+        var parms = new PlayMotorDown_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayMotorUpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayMotorUp_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayMotorUp
     /// </summary>
     public unsafe override void PlayMotorUp()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.PlayMotorUp", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayMotorUpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.PlayMotorUp", true);
+        var parms = new PlayMotorUp_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RRECMotor.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -147,8 +177,8 @@ public partial class RRECMotor : BmSDK.BmScript.RMagneticSurfaceSM, BmSDK.IGameO
     /// </summary>
     public unsafe float MotorMaterialUpSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 756); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 756); }
+        get { return *(float*)(Ptr + 756); }
+        set { *(float*)(Ptr + 756) = value; }
     }
 
     /// <summary>
@@ -156,8 +186,8 @@ public partial class RRECMotor : BmSDK.BmScript.RMagneticSurfaceSM, BmSDK.IGameO
     /// </summary>
     public unsafe float MotorMaterialDownSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 760); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 760); }
+        get { return *(float*)(Ptr + 760); }
+        set { *(float*)(Ptr + 760) = value; }
     }
 
     /// <summary>
@@ -171,7 +201,7 @@ public partial class RRECMotor : BmSDK.BmScript.RMagneticSurfaceSM, BmSDK.IGameO
     /// </summary>
     public unsafe bool bDebugDrawFXLocation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 776) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 776); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 776); }
+        get { return (*(int*)(Ptr + 776) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 776) |= 1; else *(int*)(Ptr + 776) &= ~1; }
     }
 }
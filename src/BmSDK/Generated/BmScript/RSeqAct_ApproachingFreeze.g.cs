@@ -78,50 +78,77 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
         where TComponent : class, Framework.IScriptComponent<RSeqAct_ApproachingFreeze>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_FindFogVolumesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FindFogVolumes_Params
+    {
+    }
+
     /// <summary>
     /// Function: FindFogVolumes
     /// </summary>
     public unsafe virtual void FindFogVolumes()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_ApproachingFreeze.FindFogVolumes", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FindFogVolumesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_ApproachingFreeze.FindFogVolumes", true);
+        var parms = new FindFogVolumes_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetProportionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetProportion_Params
+    {
+        [FieldOffset(0)] public float proportion_to_set;
+    }
+
     /// <summary>
     /// Function: SetProportion
     /// </summary>
     public unsafe virtual void SetProportion(float proportion_to_set)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_ApproachingFreeze.SetProportion", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(proportion_to_set, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetProportionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_ApproachingFreeze.SetProportion", true);
+        var parms = new SetProportion_Params();
+        parms.proportion_to_set = proportion_to_set;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetProportionByCurrentLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetProportionByCurrentLocation_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetProportionByCurrentLocation
     /// </summary>
     public unsafe virtual void SetProportionByCurrentLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_ApproachingFreeze.SetProportionByCurrentLocation", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetProportionByCurrentLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_ApproachingFreeze.SetProportionByCurrentLocation", true);
+        var parms = new SetProportionByCurrentLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Update
     /// </summary>
     public unsafe override bool Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_ApproachingFreeze.Update", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_ApproachingFreeze.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -129,8 +156,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe bool bInitialised
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 1; else *(int*)(Ptr + 220) &= ~1; }
     }
 
     /// <summary>
@@ -138,8 +165,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe bool bOnlyIncreaseEffect
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 2; else *(int*)(Ptr + 220) &= ~2; }
     }
 
     /// <summary>
@@ -147,8 +174,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe bool bAutoShutdownWhenComplete
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 4; else *(int*)(Ptr + 220) &= ~4; }
     }
 
     /// <summary>
@@ -156,8 +183,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe bool bShutdownNow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 8; else *(int*)(Ptr + 220) &= ~8; }
     }
 
     /// <summary>
@@ -189,8 +216,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float fTotalPathLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(float*)(Ptr + 244); }
+        set { *(float*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -198,8 +225,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float FogBeginProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(float*)(Ptr + 248); }
+        set { *(float*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -207,8 +234,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float FogEndProportion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(float*)(Ptr + 252); }
+        set { *(float*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -225,8 +252,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float fCurrentProportionAlongPath
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -234,8 +261,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float fHighestProportionAlongPath
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(float*)(Ptr + 272); }
+        set { *(float*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -243,8 +270,8 @@ public partial class RSeqAct_ApproachingFreeze : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float fMinProportionForVisualChange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(float*)(Ptr + 276); }
+        set { *(float*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -78,28 +78,43 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
         where TComponent : class, Framework.IScriptComponent<RSeqAct_CameraBlurOverTime>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_InterpBlurValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InterpBlurValues_Params
+    {
+        [FieldOffset(0)] public float Interp;
+    }
+
     /// <summary>
     /// Function: InterpBlurValues
     /// </summary>
     public unsafe virtual void InterpBlurValues(float Interp)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CameraBlurOverTime.InterpBlurValues", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Interp, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InterpBlurValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CameraBlurOverTime.InterpBlurValues", true);
+        var parms = new InterpBlurValues_Params();
+        parms.Interp = Interp;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Update
     /// </summary>
     public unsafe override bool Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CameraBlurOverTime.Update", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CameraBlurOverTime.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -107,8 +122,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float startDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(float*)(Ptr + 220); }
+        set { *(float*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -116,8 +131,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float Duration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(float*)(Ptr + 224); }
+        set { *(float*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -125,8 +140,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float elapsed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -155,8 +170,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float BlurKernelSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(float*)(Ptr + 364); }
+        set { *(float*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -164,8 +179,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float MaxNearBlurAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(float*)(Ptr + 368); }
+        set { *(float*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -173,8 +188,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float MaxFarBlurAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(float*)(Ptr + 372); }
+        set { *(float*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -182,8 +197,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float FalloffExponent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(float*)(Ptr + 376); }
+        set { *(float*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -191,8 +206,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float FocusDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(float*)(Ptr + 380); }
+        set { *(float*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -200,8 +215,8 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe float FocusInnerRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }
+        get { return *(float*)(Ptr + 384); }
+        set { *(float*)(Ptr + 384) = value; }
     }
 
     /// <summary>
@@ -209,7 +224,7 @@ public partial class RSeqAct_CameraBlurOverTime : BmSDK.Engine.SeqAct_Latent, Bm
     /// </summary>
     public unsafe bool bInterpFocus
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 388) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 388); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 388); }
+        get { return (*(int*)(Ptr + 388) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 388) |= 1; else *(int*)(Ptr + 388) &= ~1; }
     }
 }
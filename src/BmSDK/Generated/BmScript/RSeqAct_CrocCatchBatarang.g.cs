@@ -78,15 +78,30 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
         where TComponent : class, Framework.IScriptComponent<RSeqAct_CrocCatchBatarang>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CrocCatchBatarang.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CrocCatchBatarang.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -94,11 +109,17 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe override bool Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CrocCatchBatarang.Update", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CrocCatchBatarang.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Activated_Params
+    {
     }
 
     /// <summary>
@@ -106,9 +127,9 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CrocCatchBatarang.Activated", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_CrocCatchBatarang.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -195,8 +216,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float MaxLeftJumpDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -204,8 +225,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float MaxRightJumpDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -222,8 +243,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe bool bPlayingCatch
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 276); }
+        get { return (*(int*)(Ptr + 276) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 276) |= 1; else *(int*)(Ptr + 276) &= ~1; }
     }
 
     /// <summary>
@@ -231,8 +252,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe bool bSwitchActivated
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 276); }
+        get { return (*(int*)(Ptr + 276) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 276) |= 2; else *(int*)(Ptr + 276) &= ~2; }
     }
 
     /// <summary>
@@ -240,8 +261,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe bool bSpawnedBehaviour
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 276); }
+        get { return (*(int*)(Ptr + 276) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 276) |= 4; else *(int*)(Ptr + 276) &= ~4; }
     }
 
     /// <summary>
@@ -255,8 +276,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float TimeTillCatch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }
+        get { return *(float*)(Ptr + 292); }
+        set { *(float*)(Ptr + 292) = value; }
     }
 
     /// <summary>
@@ -264,8 +285,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float AnimCatchTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -273,8 +294,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe float EarliestAnimCatchTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(float*)(Ptr + 300); }
+        set { *(float*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -291,8 +312,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe BmSDK.FName JumpLeftAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(BmSDK.FName*)(Ptr + 308); }
+        set { *(BmSDK.FName*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -300,8 +321,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe BmSDK.FName JumpRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(BmSDK.FName*)(Ptr + 316); }
+        set { *(BmSDK.FName*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -309,8 +330,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe BmSDK.FName ExitAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(BmSDK.FName*)(Ptr + 324); }
+        set { *(BmSDK.FName*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -318,8 +339,8 @@ public partial class RSeqAct_CrocCatchBatarang : BmSDK.Engine.SeqAct_Latent, BmS
     /// </summary>
     public unsafe BmSDK.FName IdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(BmSDK.FName*)(Ptr + 332); }
+        set { *(BmSDK.FName*)(Ptr + 332) = value; }
     }
 
     /// <summary>
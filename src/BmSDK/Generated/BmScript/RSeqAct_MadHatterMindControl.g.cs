@@ -78,15 +78,28 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
         where TComponent : class, Framework.IScriptComponent<RSeqAct_MadHatterMindControl>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CheckInputsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct CheckInputs_Params
+    {
     }
 
     /// <summary>
@@ -94,260 +107,401 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe virtual void CheckInputs()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.CheckInputs", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckInputsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.CheckInputs", true);
+        var parms = new CheckInputs_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Complete_Params
+    {
+    }
+
     /// <summary>
     /// Function: Complete
     /// </summary>
     public unsafe virtual void Complete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.Complete", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.Complete", true);
+        var parms = new Complete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MindControlFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct MindControlFinished_Params
+    {
+    }
+
     /// <summary>
     /// Function: MindControlFinished
     /// </summary>
     public unsafe virtual void MindControlFinished()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.MindControlFinished", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MindControlFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.MindControlFinished", true);
+        var parms = new MindControlFinished_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartMindControlFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartMindControl_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartMindControl
     /// </summary>
     public unsafe virtual void StartMindControl()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartMindControl", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartMindControlFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartMindControl", true);
+        var parms = new StartMindControl_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PrepareMindControlFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PrepareMindControl_Params
+    {
+    }
+
     /// <summary>
     /// Function: PrepareMindControl
     /// </summary>
     public unsafe virtual void PrepareMindControl()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.PrepareMindControl", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PrepareMindControlFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.PrepareMindControl", true);
+        var parms = new PrepareMindControl_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwapToBMRabbitHeadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SwapToBMRabbitHead_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwapToBMRabbitHead
     /// </summary>
     public unsafe virtual void SwapToBMRabbitHead()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.SwapToBMRabbitHead", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwapToBMRabbitHeadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.SwapToBMRabbitHead", true);
+        var parms = new SwapToBMRabbitHead_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThugsLookAtBMFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ThugsLookAtBM_Params
+    {
+    }
+
     /// <summary>
     /// Function: ThugsLookAtBM
     /// </summary>
     public unsafe virtual void ThugsLookAtBM()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.ThugsLookAtBM", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThugsLookAtBMFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.ThugsLookAtBM", true);
+        var parms = new ThugsLookAtBM_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartPuttingMaskOnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartPuttingMaskOn_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartPuttingMaskOn
     /// </summary>
     public unsafe virtual void StartPuttingMaskOn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartPuttingMaskOn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartPuttingMaskOnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartPuttingMaskOn", true);
+        var parms = new StartPuttingMaskOn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartHatterWalkingAcrossTableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartHatterWalkingAcrossTable_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartHatterWalkingAcrossTable
     /// </summary>
     public unsafe virtual void StartHatterWalkingAcrossTable()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartHatterWalkingAcrossTable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartHatterWalkingAcrossTableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartHatterWalkingAcrossTable", true);
+        var parms = new StartHatterWalkingAcrossTable_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartBMSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 116)]
+    private struct StartBMSpecialMove_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartBMSpecialMove
     /// </summary>
     public unsafe virtual void StartBMSpecialMove()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartBMSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[116];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartBMSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartBMSpecialMove", true);
+        var parms = new StartBMSpecialMove_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartTeaPartyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartTeaParty_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartTeaParty
     /// </summary>
     public unsafe virtual void StartTeaParty()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartTeaParty", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartTeaPartyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartTeaParty", true);
+        var parms = new StartTeaParty_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdatePuttingMaskOnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdatePuttingMaskOn_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdatePuttingMaskOn
     /// </summary>
     public unsafe virtual void UpdatePuttingMaskOn(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdatePuttingMaskOn", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdatePuttingMaskOnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdatePuttingMaskOn", true);
+        var parms = new UpdatePuttingMaskOn_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateMindControlPPFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateMindControlPP_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public float topPanVal;
+        [FieldOffset(8)] public float bottomPanVal;
+    }
+
     /// <summary>
     /// Function: UpdateMindControlPP
     /// </summary>
     public unsafe virtual void UpdateMindControlPP(float DeltaTime, float topPanVal, float bottomPanVal)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdateMindControlPP", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(topPanVal, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bottomPanVal, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateMindControlPPFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdateMindControlPP", true);
+        var parms = new UpdateMindControlPP_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.topPanVal = topPanVal;
+        parms.bottomPanVal = bottomPanVal;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateMindControlCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct UpdateMindControlCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateMindControlCamera
     /// </summary>
     public unsafe virtual void UpdateMindControlCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdateMindControlCamera", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateMindControlCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdateMindControlCamera", true);
+        var parms = new UpdateMindControlCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ButtonPressedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ButtonPressed_Params
+    {
+    }
+
     /// <summary>
     /// Function: ButtonPressed
     /// </summary>
     public unsafe virtual void ButtonPressed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.ButtonPressed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ButtonPressedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.ButtonPressed", true);
+        var parms = new ButtonPressed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PrintDebugTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PrintDebugText_Params
+    {
+    }
+
     /// <summary>
     /// Function: PrintDebugText
     /// </summary>
     public unsafe virtual void PrintDebugText()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.PrintDebugText", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PrintDebugTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.PrintDebugText", true);
+        var parms = new PrintDebugText_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateCinematicCamExtraRotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct UpdateCinematicCamExtraRot_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateCinematicCamExtraRot
     /// </summary>
     public unsafe virtual void UpdateCinematicCamExtraRot(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdateCinematicCamExtraRot", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateCinematicCamExtraRotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdateCinematicCamExtraRot", true);
+        var parms = new UpdateCinematicCamExtraRot_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerRumbleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TriggerRumble_Params
+    {
+    }
+
     /// <summary>
     /// Function: TriggerRumble
     /// </summary>
     public unsafe virtual void TriggerRumble()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.TriggerRumble", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerRumbleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.TriggerRumble", true);
+        var parms = new TriggerRumble_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateMindControlProgressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateMindControlProgress_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateMindControlProgress
     /// </summary>
     public unsafe virtual void UpdateMindControlProgress(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdateMindControlProgress", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateMindControlProgressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.UpdateMindControlProgress", true);
+        var parms = new UpdateMindControlProgress_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MidStruggleChatFinishedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct MidStruggleChatFinished_Params
+    {
+    }
+
     /// <summary>
     /// Function: MidStruggleChatFinished
     /// </summary>
     public unsafe virtual void MidStruggleChatFinished()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.MidStruggleChatFinished", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MidStruggleChatFinishedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.MidStruggleChatFinished", true);
+        var parms = new MidStruggleChatFinished_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartMidStruggleChatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StartMidStruggleChat_Params
+    {
+        [FieldOffset(0)] public int Index;
+    }
+
     /// <summary>
     /// Function: StartMidStruggleChat
     /// </summary>
     public unsafe virtual void StartMidStruggleChat(int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartMidStruggleChat", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartMidStruggleChatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartMidStruggleChat", true);
+        var parms = new StartMidStruggleChat_Params();
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartIdleChatFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartIdleChat_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartIdleChat
     /// </summary>
     public unsafe virtual void StartIdleChat()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartIdleChat", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartIdleChatFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.StartIdleChat", true);
+        var parms = new StartIdleChat_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Update
     /// </summary>
     public unsafe override bool Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.Update", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_MadHatterMindControl.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -355,8 +509,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bDrawDebug
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 1; else *(int*)(Ptr + 220) &= ~1; }
     }
 
     /// <summary>
@@ -364,8 +518,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bPuttingMaskOn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 2; else *(int*)(Ptr + 220) &= ~2; }
     }
 
     /// <summary>
@@ -373,8 +527,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bMindControlInProgress
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 4; else *(int*)(Ptr + 220) &= ~4; }
     }
 
     /// <summary>
@@ -382,8 +536,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bInCompletionDelay
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 8; else *(int*)(Ptr + 220) &= ~8; }
     }
 
     /// <summary>
@@ -391,8 +545,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bInControllableCinematicCam
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 16; else *(int*)(Ptr + 220) &= ~16; }
     }
 
     /// <summary>
@@ -400,8 +554,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool enabledCamControl
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 32; else *(int*)(Ptr + 220) &= ~32; }
     }
 
     /// <summary>
@@ -409,8 +563,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bInConversation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 64; else *(int*)(Ptr + 220) &= ~64; }
     }
 
     /// <summary>
@@ -418,8 +572,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool reachedScoreMin
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 128; else *(int*)(Ptr + 220) &= ~128; }
     }
 
     /// <summary>
@@ -427,8 +581,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bCompleted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 256; else *(int*)(Ptr + 220) &= ~256; }
     }
 
     /// <summary>
@@ -436,8 +590,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bNeedPrompt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 512; else *(int*)(Ptr + 220) &= ~512; }
     }
 
     /// <summary>
@@ -445,8 +599,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe bool bPassedAThreshold
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 220); }
+        get { return (*(int*)(Ptr + 220) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 220) |= 1024; else *(int*)(Ptr + 220) &= ~1024; }
     }
 
     /// <summary>
@@ -454,8 +608,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float timeBetweenDebugSpam
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(float*)(Ptr + 224); }
+        set { *(float*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -463,8 +617,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float lastDebugSpamTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -499,8 +653,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float maskFadeDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(float*)(Ptr + 244); }
+        set { *(float*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -508,8 +662,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float maskFadeStartTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(float*)(Ptr + 248); }
+        set { *(float*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -517,8 +671,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMaskTopPanStart
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(float*)(Ptr + 252); }
+        set { *(float*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -526,8 +680,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMaskTopPanEnd
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(float*)(Ptr + 256); }
+        set { *(float*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -535,8 +689,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMaskBottomPan
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(float*)(Ptr + 260); }
+        set { *(float*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -544,8 +698,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMaskRoundness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -553,8 +707,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ScoreDecayRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -562,8 +716,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float scoreDecayRateDuringConversation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(float*)(Ptr + 272); }
+        set { *(float*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -571,8 +725,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float scoreIncreasePerButtonPress
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(float*)(Ptr + 276); }
+        set { *(float*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -580,8 +734,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float Score
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 280); }
+        get { return *(float*)(Ptr + 280); }
+        set { *(float*)(Ptr + 280) = value; }
     }
 
     /// <summary>
@@ -589,8 +743,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float scoreMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }
+        get { return *(float*)(Ptr + 284); }
+        set { *(float*)(Ptr + 284) = value; }
     }
 
     /// <summary>
@@ -598,8 +752,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float postChatScoreBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(float*)(Ptr + 288); }
+        set { *(float*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -625,8 +779,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMindControlBottomPanInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(float*)(Ptr + 300); }
+        set { *(float*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -634,8 +788,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMindControlBottomPanWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(float*)(Ptr + 304); }
+        set { *(float*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -643,8 +797,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMindControlBottomPanComplete
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(float*)(Ptr + 308); }
+        set { *(float*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -652,8 +806,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMindControlTopPanInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(float*)(Ptr + 312); }
+        set { *(float*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -661,8 +815,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMindControlTopPanWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(float*)(Ptr + 316); }
+        set { *(float*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -670,8 +824,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMindControlTopPanComplete
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(float*)(Ptr + 320); }
+        set { *(float*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -679,8 +833,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float ppMindControlRoundness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(float*)(Ptr + 324); }
+        set { *(float*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -688,8 +842,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float blurKernelInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(float*)(Ptr + 328); }
+        set { *(float*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -697,8 +851,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float blurKernelWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(float*)(Ptr + 332); }
+        set { *(float*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -706,8 +860,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float maxNearBlurAmountInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(float*)(Ptr + 336); }
+        set { *(float*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -715,8 +869,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float maxNearBlurAmountWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(float*)(Ptr + 340); }
+        set { *(float*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -724,8 +878,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float maxFarBlurAmountInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(float*)(Ptr + 344); }
+        set { *(float*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -733,8 +887,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float maxFarBlurAmountWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -742,8 +896,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float blurKernelToAmountTransitionPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(float*)(Ptr + 352); }
+        set { *(float*)(Ptr + 352) = value; }
     }
 
     /// <summary>
@@ -751,8 +905,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float dofInterpDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(float*)(Ptr + 356); }
+        set { *(float*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -760,8 +914,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float dofFalloffExponentInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(float*)(Ptr + 360); }
+        set { *(float*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -769,8 +923,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float dofFalloffExponentWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(float*)(Ptr + 364); }
+        set { *(float*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -778,8 +932,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float dofFocusDistanceInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(float*)(Ptr + 368); }
+        set { *(float*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -787,8 +941,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float dofFocusDistanceWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(float*)(Ptr + 372); }
+        set { *(float*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -796,8 +950,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float dofFocusInnerRadiusInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(float*)(Ptr + 376); }
+        set { *(float*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -805,8 +959,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float dofFocusInnerRadiusWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(float*)(Ptr + 380); }
+        set { *(float*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -814,8 +968,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float bloomScaleInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }
+        get { return *(float*)(Ptr + 384); }
+        set { *(float*)(Ptr + 384) = value; }
     }
 
     /// <summary>
@@ -823,8 +977,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float bloomScaleWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(float*)(Ptr + 388); }
+        set { *(float*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -832,8 +986,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float bloomThresholdInitial
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(float*)(Ptr + 392); }
+        set { *(float*)(Ptr + 392) = value; }
     }
 
     /// <summary>
@@ -841,8 +995,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float bloomThresholdWin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(float*)(Ptr + 396); }
+        set { *(float*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -904,8 +1058,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float timeBetweenHatAndMindControl
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(float*)(Ptr + 424); }
+        set { *(float*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -913,8 +1067,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float mindControlStartDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -928,8 +1082,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float timeSinceLook
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(float*)(Ptr + 444); }
+        set { *(float*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -937,8 +1091,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float postCompletionDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(float*)(Ptr + 448); }
+        set { *(float*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -946,8 +1100,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float completionTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(float*)(Ptr + 452); }
+        set { *(float*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -955,8 +1109,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float regainFocusDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(float*)(Ptr + 456); }
+        set { *(float*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -964,8 +1118,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float regainFocusTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(float*)(Ptr + 460); }
+        set { *(float*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -973,8 +1127,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float camControlCountDown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(float*)(Ptr + 464); }
+        set { *(float*)(Ptr + 464) = value; }
     }
 
     /// <summary>
@@ -987,32 +1141,32 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float scoreThresholds_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(float*)(Ptr + 468); }
+        set { *(float*)(Ptr + 468) = value; }
     }
     /// <summary>
     /// FloatProperty: scoreThresholds
     /// </summary>
     public unsafe float scoreThresholds_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(float*)(Ptr + 472); }
+        set { *(float*)(Ptr + 472) = value; }
     }
     /// <summary>
     /// FloatProperty: scoreThresholds
     /// </summary>
     public unsafe float scoreThresholds_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(float*)(Ptr + 476); }
+        set { *(float*)(Ptr + 476) = value; }
     }
     /// <summary>
     /// FloatProperty: scoreThresholds
     /// </summary>
     public unsafe float scoreThresholds_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(float*)(Ptr + 480); }
+        set { *(float*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -1020,8 +1174,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe int nextThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(int*)(Ptr + 484); }
+        set { *(int*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -1029,8 +1183,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float idleChatMinInterval
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(float*)(Ptr + 488); }
+        set { *(float*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -1038,8 +1192,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float idleChatMaxInterval
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(float*)(Ptr + 492); }
+        set { *(float*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -1047,8 +1201,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float idleChatInterval
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(float*)(Ptr + 496); }
+        set { *(float*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -1056,8 +1210,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float idleChatTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(float*)(Ptr + 500); }
+        set { *(float*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -1065,8 +1219,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe int nextConversation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }
+        get { return *(int*)(Ptr + 504); }
+        set { *(int*)(Ptr + 504) = value; }
     }
 
     /// <summary>
@@ -1074,8 +1228,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float timeTillMindControlHelpPrompt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 508); }
+        get { return *(float*)(Ptr + 508); }
+        set { *(float*)(Ptr + 508) = value; }
     }
 
     /// <summary>
@@ -1083,8 +1237,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float helpPromptTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(float*)(Ptr + 512); }
+        set { *(float*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -1101,8 +1255,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float rumbleInterval
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 520); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 520); }
+        get { return *(float*)(Ptr + 520); }
+        set { *(float*)(Ptr + 520) = value; }
     }
 
     /// <summary>
@@ -1110,8 +1264,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float nextRumbleTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(float*)(Ptr + 524); }
+        set { *(float*)(Ptr + 524) = value; }
     }
 
     /// <summary>
@@ -1119,8 +1273,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float minRumbleDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 528); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 528); }
+        get { return *(float*)(Ptr + 528); }
+        set { *(float*)(Ptr + 528) = value; }
     }
 
     /// <summary>
@@ -1128,8 +1282,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float maxRumbleDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(float*)(Ptr + 532); }
+        set { *(float*)(Ptr + 532) = value; }
     }
 
     /// <summary>
@@ -1137,8 +1291,8 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float minRumbleStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 536); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 536); }
+        get { return *(float*)(Ptr + 536); }
+        set { *(float*)(Ptr + 536) = value; }
     }
 
     /// <summary>
@@ -1146,7 +1300,7 @@ public partial class RSeqAct_MadHatterMindControl : BmSDK.Engine.SeqAct_Latent,
     /// </summary>
     public unsafe float maxRumbleStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(float*)(Ptr + 540); }
+        set { *(float*)(Ptr + 540) = value; }
     }
 }
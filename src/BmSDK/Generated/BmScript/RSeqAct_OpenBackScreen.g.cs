@@ -78,15 +78,28 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
         where TComponent : class, Framework.IScriptComponent<RSeqAct_OpenBackScreen>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_OpenBackScreen.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_OpenBackScreen.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Activated_Params
+    {
     }
 
     /// <summary>
@@ -94,9 +107,9 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_OpenBackScreen.Activated", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_OpenBackScreen.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -105,8 +118,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe BmSDK.BmGame.RGFxMovieBackScreen.BackScreenType _TheScreen
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGFxMovieBackScreen.BackScreenType>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.BmGame.RGFxMovieBackScreen.BackScreenType*)(Ptr + 204); }
+        set { *(BmSDK.BmGame.RGFxMovieBackScreen.BackScreenType*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -114,8 +127,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe BmSDK.BmScript.RSeqAct_OpenBackScreen.EMapParamType Map_ParamType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RSeqAct_OpenBackScreen.EMapParamType>(Ptr + 205); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 205); }
+        get { return *(BmSDK.BmScript.RSeqAct_OpenBackScreen.EMapParamType*)(Ptr + 205); }
+        set { *(BmSDK.BmScript.RSeqAct_OpenBackScreen.EMapParamType*)(Ptr + 205) = value; }
     }
 
     /// <summary>
@@ -123,8 +136,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter Map_FilterCharacter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 206); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 206); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 206); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 206) = value; }
     }
 
     /// <summary>
@@ -132,8 +145,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter Progress_Character
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 207); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 207); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 207); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 207) = value; }
     }
 
     /// <summary>
@@ -141,8 +154,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EBioCharacter Bio_Character
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EBioCharacter>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(BmSDK.BmGame.RPersistentData.EBioCharacter*)(Ptr + 208); }
+        set { *(BmSDK.BmGame.RPersistentData.EBioCharacter*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -150,8 +163,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe BmSDK.BmScript.RSeqAct_OpenBackScreen.EBioPageType Bio_PageId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RSeqAct_OpenBackScreen.EBioPageType>(Ptr + 209); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 209); }
+        get { return *(BmSDK.BmScript.RSeqAct_OpenBackScreen.EBioPageType*)(Ptr + 209); }
+        set { *(BmSDK.BmScript.RSeqAct_OpenBackScreen.EBioPageType*)(Ptr + 209) = value; }
     }
 
     /// <summary>
@@ -177,8 +190,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe int Bio_TapeId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(int*)(Ptr + 236); }
+        set { *(int*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -186,8 +199,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe bool Bio_bAutoPlay
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 240); }
+        get { return (*(int*)(Ptr + 240) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 240) |= 1; else *(int*)(Ptr + 240) &= ~1; }
     }
 
     /// <summary>
@@ -195,8 +208,8 @@ public partial class RSeqAct_OpenBackScreen : BmSDK.Engine.SequenceAction, BmSDK
     /// </summary>
     public unsafe bool ReenablePlayerBackscreenUse
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 240); }
+        get { return (*(int*)(Ptr + 240) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 240) |= 2; else *(int*)(Ptr + 240) &= ~2; }
     }
 
     /// <summary>
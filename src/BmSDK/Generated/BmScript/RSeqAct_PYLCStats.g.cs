@@ -78,135 +78,212 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
         where TComponent : class, Framework.IScriptComponent<RSeqAct_PYLCStats>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PublishStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PublishStats_Params
+    {
+        [FieldOffset(0)] public nint GFXHud;
+    }
+
     /// <summary>
     /// Function: PublishStats
     /// </summary>
     public unsafe override void PublishStats(BmSDK.BmGame.RGFxMovieChallengeHUD GFXHud)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.PublishStats", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GFXHud, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PublishStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.PublishStats", true);
+        var parms = new PublishStats_Params();
+        parms.GFXHud = GFXHud?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnemyDefeatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EnemyDefeated_Params
+    {
+        [FieldOffset(0)] public nint Enemy;
+    }
+
     /// <summary>
     /// Function: EnemyDefeated
     /// </summary>
     public unsafe virtual void EnemyDefeated(BmSDK.BmGame.RPawnVillain Enemy)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.EnemyDefeated", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Enemy, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnemyDefeatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.EnemyDefeated", true);
+        var parms = new EnemyDefeated_Params();
+        parms.Enemy = Enemy?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateComboFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateCombo_Params
+    {
+        [FieldOffset(0)] public int NewCombo;
+    }
+
     /// <summary>
     /// Function: UpdateCombo
     /// </summary>
     public unsafe virtual void UpdateCombo(int NewCombo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.UpdateCombo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCombo, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateComboFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.UpdateCombo", true);
+        var parms = new UpdateCombo_Params();
+        parms.NewCombo = NewCombo;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MaxGaugeBankedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct MaxGaugeBanked_Params
+    {
+        [FieldOffset(0)] public int Points;
+    }
+
     /// <summary>
     /// Function: MaxGaugeBanked
     /// </summary>
     public unsafe virtual void MaxGaugeBanked(int Points)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.MaxGaugeBanked", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Points, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MaxGaugeBankedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.MaxGaugeBanked", true);
+        var parms = new MaxGaugeBanked_Params();
+        parms.Points = Points;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddTime_Params
+    {
+        [FieldOffset(0)] public int Time;
+    }
+
     /// <summary>
     /// Function: AddTime
     /// </summary>
     public unsafe virtual void AddTime(int Time)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.AddTime", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Time, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.AddTime", true);
+        var parms = new AddTime_Params();
+        parms.Time = Time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddPointsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddPoints_Params
+    {
+        [FieldOffset(0)] public int Points;
+    }
+
     /// <summary>
     /// Function: AddPoints
     /// </summary>
     public unsafe virtual void AddPoints(int Points)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.AddPoints", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Points, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddPointsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.AddPoints", true);
+        var parms = new AddPoints_Params();
+        parms.Points = Points;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BankedLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BankedLevel_Params
+    {
+        [FieldOffset(0)] public int NewLevel;
+    }
+
     /// <summary>
     /// Function: BankedLevel
     /// </summary>
     public unsafe virtual void BankedLevel(int NewLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.BankedLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLevel, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BankedLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.BankedLevel", true);
+        var parms = new BankedLevel_Params();
+        parms.NewLevel = NewLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReachedLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ReachedLevel_Params
+    {
+        [FieldOffset(0)] public int NewLevel;
+    }
+
     /// <summary>
     /// Function: ReachedLevel
     /// </summary>
     public unsafe virtual void ReachedLevel(int NewLevel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.ReachedLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLevel, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReachedLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.ReachedLevel", true);
+        var parms = new ReachedLevel_Params();
+        parms.NewLevel = NewLevel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearChallengeStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearChallengeStats_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearChallengeStats
     /// </summary>
     public unsafe override void ClearChallengeStats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.ClearChallengeStats", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearChallengeStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.ClearChallengeStats", true);
+        var parms = new ClearChallengeStats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OutputMoveScoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OutputMoveScores_Params
+    {
+    }
+
     /// <summary>
     /// Function: OutputMoveScores
     /// </summary>
     public unsafe override void OutputMoveScores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.OutputMoveScores", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OutputMoveScoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.OutputMoveScores", true);
+        var parms = new OutputMoveScores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddCombatMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AddCombatMove_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.EComboMoveType MoveType;
+        [FieldOffset(4)] public int MoveScore;
+        [FieldOffset(8)] public int MoveMultiplier;
+    }
+
     /// <summary>
     /// Function: AddCombatMove
     /// </summary>
     public unsafe override void AddCombatMove(BmSDK.BmGame.RGameInfo.EComboMoveType MoveType, int MoveScore, int MoveMultiplier)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.AddCombatMove", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveScore, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveMultiplier, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddCombatMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PYLCStats.AddCombatMove", true);
+        var parms = new AddCombatMove_Params();
+        parms.MoveType = MoveType;
+        parms.MoveScore = MoveScore;
+        parms.MoveMultiplier = MoveMultiplier;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -215,8 +292,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int MaxLevelReached
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(int*)(Ptr + 232); }
+        set { *(int*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -224,8 +301,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int MaxLevelBanked
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(int*)(Ptr + 236); }
+        set { *(int*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -233,8 +310,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int PointsBanked
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(int*)(Ptr + 240); }
+        set { *(int*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -242,8 +319,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int TimeBanked
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(int*)(Ptr + 244); }
+        set { *(int*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -251,8 +328,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int MaxCombo
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(int*)(Ptr + 248); }
+        set { *(int*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -260,8 +337,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int EnemiesDefeated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(int*)(Ptr + 252); }
+        set { *(int*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -269,8 +346,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int ThugsDefeated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(int*)(Ptr + 256); }
+        set { *(int*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -278,8 +355,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int ArmouredThugsDefeated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(int*)(Ptr + 260); }
+        set { *(int*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -287,8 +364,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int NinjasDefeated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(int*)(Ptr + 264); }
+        set { *(int*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -296,8 +373,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int TitansDefeated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(int*)(Ptr + 268); }
+        set { *(int*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -305,8 +382,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int LieutenantsDefeated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(int*)(Ptr + 272); }
+        set { *(int*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -314,8 +391,8 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe int MaxGaugeBonus
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(int*)(Ptr + 276); }
+        set { *(int*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -323,7 +400,7 @@ public partial class RSeqAct_PYLCStats : BmSDK.BmScript.RSeqAct_StartCombatChall
     /// </summary>
     public unsafe bool bDefeatedJoker
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 280); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 280); }
+        get { return (*(int*)(Ptr + 280) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 280) |= 1; else *(int*)(Ptr + 280) &= ~1; }
     }
 }
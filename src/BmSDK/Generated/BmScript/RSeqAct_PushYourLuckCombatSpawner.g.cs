@@ -78,15 +78,28 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
         where TComponent : class, Framework.IScriptComponent<RSeqAct_PushYourLuckCombatSpawner>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_StopFightingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StopFighting_Params
+    {
     }
 
     /// <summary>
@@ -94,56 +107,89 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual void StopFighting()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.StopFighting", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopFightingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.StopFighting", true);
+        var parms = new StopFighting_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FightFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Fight_Params
+    {
+    }
+
     /// <summary>
     /// Function: Fight
     /// </summary>
     public unsafe virtual void Fight()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.Fight", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FightFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.Fight", true);
+        var parms = new Fight_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddBonusScoreFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddBonusScore_Params
+    {
+        [FieldOffset(0)] public int bonus_score;
+    }
+
     /// <summary>
     /// Function: AddBonusScore
     /// </summary>
     public unsafe virtual void AddBonusScore(int bonus_score)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AddBonusScore", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bonus_score, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddBonusScoreFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AddBonusScore", true);
+        var parms = new AddBonusScore_Params();
+        parms.bonus_score = bonus_score;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddBonusTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddBonusTime_Params
+    {
+        [FieldOffset(0)] public float Bonus_Time;
+    }
+
     /// <summary>
     /// Function: AddBonusTime
     /// </summary>
     public unsafe virtual void AddBonusTime(float Bonus_Time)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AddBonusTime", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Bonus_Time, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddBonusTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AddBonusTime", true);
+        var parms = new AddBonusTime_Params();
+        parms.Bonus_Time = Bonus_Time;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AutoSpawnEnemyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct AutoSpawnEnemy_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AutoSpawnEnemy
     /// </summary>
     public unsafe virtual bool AutoSpawnEnemy()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AutoSpawnEnemy", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AutoSpawnEnemyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AutoSpawnEnemy", true);
+        var parms = new AutoSpawnEnemy_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpawnInitialEnemiesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct SpawnInitialEnemies_Params
+    {
     }
 
     /// <summary>
@@ -151,33 +197,56 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual void SpawnInitialEnemies()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SpawnInitialEnemies", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnInitialEnemiesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SpawnInitialEnemies", true);
+        var parms = new SpawnInitialEnemies_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AcquirePlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AcquirePlayer_Params
+    {
+    }
+
     /// <summary>
     /// Function: AcquirePlayer
     /// </summary>
     public unsafe virtual void AcquirePlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AcquirePlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AcquirePlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AcquirePlayer", true);
+        var parms = new AcquirePlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRandomCharacterClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetRandomCharacterClass_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.MySpawnTypes spawn_feature;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRandomCharacterClass
     /// </summary>
     public unsafe virtual BmSDK.Class GetRandomCharacterClass(BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.MySpawnTypes spawn_feature)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetRandomCharacterClass", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(spawn_feature, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Class>(paramsPtr + 4);
+        var funcManaged = s_GetRandomCharacterClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetRandomCharacterClass", true);
+        var parms = new GetRandomCharacterClass_Params();
+        parms.spawn_feature = spawn_feature;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Class)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SpawnEnemyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SpawnEnemy_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.MySpawnTypes spawn_feature;
+        [FieldOffset(1)] public BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.MySpawnTypes optional_weapon;
+        [FieldOffset(4)] public nint EnemySpawnPoint;
     }
 
     /// <summary>
@@ -185,26 +254,42 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual void SpawnEnemy(BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.MySpawnTypes spawn_feature, BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.MySpawnTypes optional_weapon, BmSDK.Engine.Actor EnemySpawnPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SpawnEnemy", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(spawn_feature, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(optional_weapon, paramsPtr + 1);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EnemySpawnPoint, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnEnemyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SpawnEnemy", true);
+        var parms = new SpawnEnemy_Params();
+        parms.spawn_feature = spawn_feature;
+        parms.optional_weapon = optional_weapon;
+        parms.EnemySpawnPoint = EnemySpawnPoint?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetScoreForSpawnPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 52)]
+    private struct GetScoreForSpawnPoint_Params
+    {
+        [FieldOffset(0)] public nint TestPoint;
+        [FieldOffset(4)] public nint Batman;
+        [FieldOffset(8)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetScoreForSpawnPoint
     /// </summary>
     public unsafe virtual float GetScoreForSpawnPoint(BmSDK.Engine.Actor TestPoint, BmSDK.BmGame.RPawnPlayerCombat Batman)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetScoreForSpawnPoint", true);
-        byte* paramsPtr = stackalloc byte[52];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TestPoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Batman, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_GetScoreForSpawnPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetScoreForSpawnPoint", true);
+        var parms = new GetScoreForSpawnPoint_Params();
+        parms.TestPoint = TestPoint?.Ptr ?? 0;
+        parms.Batman = Batman?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRandomSpawnPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetRandomSpawnPoint_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -212,10 +297,18 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual BmSDK.Engine.Actor GetRandomSpawnPoint()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetRandomSpawnPoint", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(paramsPtr + 0);
+        var funcManaged = s_GetRandomSpawnPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetRandomSpawnPoint", true);
+        var parms = new GetRandomSpawnPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Actor)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SpawnFeatureFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 17)]
+    private struct SpawnFeature_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.MySpawnTypes spawn_feature;
+        [FieldOffset(4)] public nint OptionalSpawnPoint;
     }
 
     /// <summary>
@@ -223,24 +316,38 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual void SpawnFeature(BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.MySpawnTypes spawn_feature, BmSDK.Engine.Actor OptionalSpawnPoint)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SpawnFeature", true);
-        byte* paramsPtr = stackalloc byte[17];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(spawn_feature, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalSpawnPoint, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnFeatureFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SpawnFeature", true);
+        var parms = new SpawnFeature_Params();
+        parms.spawn_feature = spawn_feature;
+        parms.OptionalSpawnPoint = OptionalSpawnPoint?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsActiveOrDeadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsActiveOrDead_Params
+    {
+        [FieldOffset(0)] public nint test_pawn;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsActiveOrDead
     /// </summary>
     public unsafe virtual bool IsActiveOrDead(BmSDK.BmGame.RPawn test_pawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.IsActiveOrDead", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(test_pawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsActiveOrDeadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.IsActiveOrDead", true);
+        var parms = new IsActiveOrDead_Params();
+        parms.test_pawn = test_pawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClearDeadPawnsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ClearDeadPawns_Params
+    {
     }
 
     /// <summary>
@@ -248,22 +355,36 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual void ClearDeadPawns()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.ClearDeadPawns", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearDeadPawnsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.ClearDeadPawns", true);
+        var parms = new ClearDeadPawns_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsOffScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsOffScreen_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsOffScreen
     /// </summary>
     public unsafe virtual bool IsOffScreen(BmSDK.BmGame.RPawn Pawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.IsOffScreen", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsOffScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.IsOffScreen", true);
+        var parms = new IsOffScreen_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckForDeadPawnsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckForDeadPawns_Params
+    {
     }
 
     /// <summary>
@@ -271,34 +392,55 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual void CheckForDeadPawns()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.CheckForDeadPawns", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckForDeadPawnsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.CheckForDeadPawns", true);
+        var parms = new CheckForDeadPawns_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddDeadPawnToListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct AddDeadPawnToList_Params
+    {
+        [FieldOffset(0)] public nint NewDeadPawn;
+    }
+
     /// <summary>
     /// Function: AddDeadPawnToList
     /// </summary>
     public unsafe virtual void AddDeadPawnToList(BmSDK.BmGame.RPawn NewDeadPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AddDeadPawnToList", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewDeadPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddDeadPawnToListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.AddDeadPawnToList", true);
+        var parms = new AddDeadPawnToList_Params();
+        parms.NewDeadPawn = NewDeadPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetVillainTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetVillainType_Params
+    {
+        [FieldOffset(0)] public nint the_villain;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetVillainType
     /// </summary>
     public unsafe virtual int GetVillainType(BmSDK.BmGame.RPawn the_villain)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetVillainType", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(the_villain, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_GetVillainTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.GetVillainType", true);
+        var parms = new GetVillainType_Params();
+        parms.the_villain = the_villain?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CheckForExternalSpawnsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct CheckForExternalSpawns_Params
+    {
     }
 
     /// <summary>
@@ -306,114 +448,182 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual void CheckForExternalSpawns()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.CheckForExternalSpawns", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckForExternalSpawnsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.CheckForExternalSpawns", true);
+        var parms = new CheckForExternalSpawns_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayerTakesDamageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayerTakesDamage_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayerTakesDamage
     /// </summary>
     public unsafe override void PlayerTakesDamage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.PlayerTakesDamage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerTakesDamageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.PlayerTakesDamage", true);
+        var parms = new PlayerTakesDamage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RefreshEnemyTotalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct RefreshEnemyTotals_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshEnemyTotals
     /// </summary>
     public unsafe virtual void RefreshEnemyTotals()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.RefreshEnemyTotals", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshEnemyTotalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.RefreshEnemyTotals", true);
+        var parms = new RefreshEnemyTotals_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RefreshWeaponTotalsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct RefreshWeaponTotals_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshWeaponTotals
     /// </summary>
     public unsafe virtual void RefreshWeaponTotals()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.RefreshWeaponTotals", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshWeaponTotalsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.RefreshWeaponTotals", true);
+        var parms = new RefreshWeaponTotals_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BankGaugePointsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct BankGaugePoints_Params
+    {
+        [FieldOffset(0)] public int ScoreBonusPoints;
+    }
+
     /// <summary>
     /// Function: BankGaugePoints
     /// </summary>
     public unsafe virtual void BankGaugePoints(bool ScoreBonusPoints = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.BankGaugePoints", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScoreBonusPoints, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BankGaugePointsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.BankGaugePoints", true);
+        var parms = new BankGaugePoints_Params();
+        parms.ScoreBonusPoints = ScoreBonusPoints ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetGaugeValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetGaugeValue_Params
+    {
+        [FieldOffset(0)] public int new_value;
+    }
+
     /// <summary>
     /// Function: SetGaugeValue
     /// </summary>
     public unsafe virtual void SetGaugeValue(int new_value)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SetGaugeValue", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_value, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetGaugeValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SetGaugeValue", true);
+        var parms = new SetGaugeValue_Params();
+        parms.new_value = new_value;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetGaugeLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetGaugeLevel_Params
+    {
+        [FieldOffset(0)] public int new_level;
+    }
+
     /// <summary>
     /// Function: SetGaugeLevel
     /// </summary>
     public unsafe virtual void SetGaugeLevel(int new_level)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SetGaugeLevel", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(new_level, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetGaugeLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.SetGaugeLevel", true);
+        var parms = new SetGaugeLevel_Params();
+        parms.new_level = new_level;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TauntJokerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct TauntJoker_Params
+    {
+    }
+
     /// <summary>
     /// Function: TauntJoker
     /// </summary>
     public unsafe virtual void TauntJoker()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.TauntJoker", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TauntJokerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.TauntJoker", true);
+        var parms = new TauntJoker_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HideEveryoneFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HideEveryone_Params
+    {
+    }
+
     /// <summary>
     /// Function: HideEveryone
     /// </summary>
     public unsafe virtual void HideEveryone()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.HideEveryone", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HideEveryoneFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.HideEveryone", true);
+        var parms = new HideEveryone_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CompareToTimeStampFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CompareToTimeStamp_Params
+    {
+        [FieldOffset(0)] public float time_stamp;
+        [FieldOffset(4)] public float test_latency;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CompareToTimeStamp
     /// </summary>
     public unsafe virtual bool CompareToTimeStamp(float time_stamp, float test_latency)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.CompareToTimeStamp", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(time_stamp, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(test_latency, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_CompareToTimeStampFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.CompareToTimeStamp", true);
+        var parms = new CompareToTimeStamp_Params();
+        parms.time_stamp = time_stamp;
+        parms.test_latency = test_latency;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -421,11 +631,18 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe override bool Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.Update", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayHudSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct PlayHudSound_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.PYL_HudSounds sound_to_play;
     }
 
     /// <summary>
@@ -433,21 +650,27 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe virtual void PlayHudSound(BmSDK.BmScript.RSeqAct_PushYourLuckCombatSpawner.PYL_HudSounds sound_to_play)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.PlayHudSound", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(sound_to_play, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayHudSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.PlayHudSound", true);
+        var parms = new PlayHudSound_Params();
+        parms.sound_to_play = sound_to_play;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitialiseEverythingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct InitialiseEverything_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitialiseEverything
     /// </summary>
     public unsafe virtual void InitialiseEverything()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.InitialiseEverything", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitialiseEverythingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_PushYourLuckCombatSpawner.InitialiseEverything", true);
+        var parms = new InitialiseEverything_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -457,6 +680,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     [StructLayout(LayoutKind.Explicit, Size = 100)]
     public partial record struct FLevelInfo
     {
+        [FieldOffset(68)] private int _bitfield68;
+
         /// <summary>
         /// StrProperty: LevelTitle
         /// </summary>
@@ -469,145 +694,89 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
         /// <summary>
         /// IntProperty: HitsRequiredForNextLevel
         /// </summary>
-        public unsafe int HitsRequiredForNextLevel
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int HitsRequiredForNextLevel;
 
         /// <summary>
         /// IntProperty: GainPointsWhenBanked
         /// </summary>
-        public unsafe int GainPointsWhenBanked
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int GainPointsWhenBanked;
 
         /// <summary>
         /// FloatProperty: GainTimeWhenBanked
         /// </summary>
-        public unsafe float GainTimeWhenBanked
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float GainTimeWhenBanked;
 
         /// <summary>
         /// IntProperty: ActiveKnives
         /// </summary>
-        public unsafe int ActiveKnives
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int ActiveKnives;
 
         /// <summary>
         /// IntProperty: ActiveGuns
         /// </summary>
-        public unsafe int ActiveGuns
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int ActiveGuns;
 
         /// <summary>
         /// IntProperty: ActiveShields
         /// </summary>
-        public unsafe int ActiveShields
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public int ActiveShields;
 
         /// <summary>
         /// IntProperty: ActiveStunsticks
         /// </summary>
-        public unsafe int ActiveStunsticks
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public int ActiveStunsticks;
 
         /// <summary>
         /// IntProperty: ActivePipes
         /// </summary>
-        public unsafe int ActivePipes
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public int ActivePipes;
 
         /// <summary>
         /// IntProperty: NumNinjas
         /// </summary>
-        public unsafe int NumNinjas
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public int NumNinjas;
 
         /// <summary>
         /// IntProperty: NumLunatics
         /// </summary>
-        public unsafe int NumLunatics
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public int NumLunatics;
 
         /// <summary>
         /// IntProperty: NumEnemiesActiveMin
         /// </summary>
-        public unsafe int NumEnemiesActiveMin
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public int NumEnemiesActiveMin;
 
         /// <summary>
         /// IntProperty: NumEnemiesActiveMax
         /// </summary>
-        public unsafe int NumEnemiesActiveMax
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public int NumEnemiesActiveMax;
 
         /// <summary>
         /// IntProperty: EveryNthThugIsArmoured
         /// </summary>
-        public unsafe int EveryNthThugIsArmoured
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public int EveryNthThugIsArmoured;
 
         /// <summary>
         /// FloatProperty: EnemyDifficultyLevel
         /// </summary>
-        public unsafe float EnemyDifficultyLevel
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float EnemyDifficultyLevel;
 
         /// <summary>
         /// BoolProperty: SpawnTitan
         /// </summary>
-        public unsafe bool SpawnTitan
+        public bool SpawnTitan
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }; }
+            readonly get => (_bitfield68 & 1) != 0;
+            set { if (value) _bitfield68 |= 1; else _bitfield68 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: SpawnLieutenant
         /// </summary>
-        public unsafe bool SpawnLieutenant
+        public bool SpawnLieutenant
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }; }
+            readonly get => (_bitfield68 & 2) != 0;
+            set { if (value) _bitfield68 |= 2; else _bitfield68 &= ~2; }
         }
 
         /// <summary>
@@ -631,11 +800,7 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
         /// <summary>
         /// FloatProperty: TimeBonusDecayWhenBanked
         /// </summary>
-        public unsafe float TimeBonusDecayWhenBanked
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public float TimeBonusDecayWhenBanked;
     }
 
     /// <summary>
@@ -722,8 +887,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int LastSpawnPointUsed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(int*)(Ptr + 252); }
+        set { *(int*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -740,8 +905,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool JokerHasBeenTaunted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 1; else *(int*)(Ptr + 260) &= ~1; }
     }
 
     /// <summary>
@@ -749,8 +914,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool JokerHasBeenSpawned
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 2; else *(int*)(Ptr + 260) &= ~2; }
     }
 
     /// <summary>
@@ -758,8 +923,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool bHasInitialised
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 4; else *(int*)(Ptr + 260) &= ~4; }
     }
 
     /// <summary>
@@ -767,8 +932,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool bHasBegun
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 8; else *(int*)(Ptr + 260) &= ~8; }
     }
 
     /// <summary>
@@ -776,8 +941,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool bIsOver
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 16; else *(int*)(Ptr + 260) &= ~16; }
     }
 
     /// <summary>
@@ -785,8 +950,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool bTitanSpawnedSinceLevelChange
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 32; else *(int*)(Ptr + 260) &= ~32; }
     }
 
     /// <summary>
@@ -794,8 +959,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool bLieutenantSpawnedSinceLevelChange
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 64; else *(int*)(Ptr + 260) &= ~64; }
     }
 
     /// <summary>
@@ -803,8 +968,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool bNinjaSpawnedSinceLevelChange
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 128; else *(int*)(Ptr + 260) &= ~128; }
     }
 
     /// <summary>
@@ -812,8 +977,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool bNoMoreSpawnsUntilDeathOrLevelChange
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 256; else *(int*)(Ptr + 260) &= ~256; }
     }
 
     /// <summary>
@@ -821,8 +986,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe bool SpawnThugsBehindCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 260); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 260); }
+        get { return (*(int*)(Ptr + 260) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 260) |= 512; else *(int*)(Ptr + 260) &= ~512; }
     }
 
     /// <summary>
@@ -857,8 +1022,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int NumExternalSpawnsWeAreWaitingFor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(int*)(Ptr + 300); }
+        set { *(int*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -866,8 +1031,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fTimeStampLastCheckedForExternalSpawns
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(float*)(Ptr + 304); }
+        set { *(float*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -875,8 +1040,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fTimeStampLastCheckedForDeadPawns
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(float*)(Ptr + 308); }
+        set { *(float*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -884,8 +1049,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fTimeStampWhenAllowNextGrandEntrance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(float*)(Ptr + 312); }
+        set { *(float*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -893,8 +1058,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fTimeStampWhenAllowNextThugSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(float*)(Ptr + 316); }
+        set { *(float*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -902,8 +1067,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fTimeStampWhenAllowNextWeaponActivation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(float*)(Ptr + 320); }
+        set { *(float*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -911,8 +1076,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fMinWaitAfterGrandEntranceSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(float*)(Ptr + 324); }
+        set { *(float*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -920,8 +1085,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fMinWaitAfterJokerSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(float*)(Ptr + 328); }
+        set { *(float*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -929,8 +1094,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fMinWaitAfterWeaponActivated
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(float*)(Ptr + 332); }
+        set { *(float*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -938,8 +1103,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float fMinWaitAfterBasicThugSpawn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(float*)(Ptr + 336); }
+        set { *(float*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -947,8 +1112,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int CurrentGaugeValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(int*)(Ptr + 340); }
+        set { *(int*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -956,8 +1121,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int CurrentGaugeLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(int*)(Ptr + 344); }
+        set { *(int*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -965,8 +1130,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float ProportionOfGaugeLostWhenHit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -974,8 +1139,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float PointsAndTimeMultiplierForMaxGauge
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(float*)(Ptr + 352); }
+        set { *(float*)(Ptr + 352) = value; }
     }
 
     /// <summary>
@@ -983,8 +1148,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int MaxPawnsOnScreen
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(int*)(Ptr + 356); }
+        set { *(int*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -992,8 +1157,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int MaxPawnsOnScreenAbsoluteLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(int*)(Ptr + 360); }
+        set { *(int*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -1010,8 +1175,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int iArmouredThugCounter
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(int*)(Ptr + 368); }
+        set { *(int*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -1019,8 +1184,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int PlayerComboLastFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(int*)(Ptr + 372); }
+        set { *(int*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -1028,8 +1193,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe int TimeRemainingOutputLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(int*)(Ptr + 376); }
+        set { *(int*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -1073,8 +1238,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float SpawnRadiusMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -1082,8 +1247,8 @@ public partial class RSeqAct_PushYourLuckCombatSpawner : BmSDK.BmGame.RSeqAct_He
     /// </summary>
     public unsafe float SpawnRadiusPreferred
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 
     /// <summary>
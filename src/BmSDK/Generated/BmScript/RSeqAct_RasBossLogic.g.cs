@@ -78,51 +78,86 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
         where TComponent : class, Framework.IScriptComponent<RSeqAct_RasBossLogic>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetOrbitViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetOrbitView_Params
+    {
+        [FieldOffset(0)] public int bOrbit;
+    }
+
     /// <summary>
     /// Function: SetOrbitView
     /// </summary>
     public unsafe override void SetOrbitView(bool bOrbit)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetOrbitView", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bOrbit, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetOrbitViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetOrbitView", true);
+        var parms = new SetOrbitView_Params();
+        parms.bOrbit = bOrbit ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroySwordFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DestroySword_Params
+    {
+    }
+
     /// <summary>
     /// Function: DestroySword
     /// </summary>
     public unsafe override void DestroySword()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.DestroySword", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroySwordFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.DestroySword", true);
+        var parms = new DestroySword_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateHudFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct UpdateHud_Params
+    {
+        [FieldOffset(0)] public float Scalar;
+    }
+
     /// <summary>
     /// Function: UpdateHud
     /// </summary>
     public unsafe override void UpdateHud(float Scalar)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.UpdateHud", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Scalar, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateHudFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.UpdateHud", true);
+        var parms = new UpdateHud_Params();
+        parms.Scalar = Scalar;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanBeInBurlyAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CanBeInBurlyAttack_Params
+    {
+        [FieldOffset(0)] public nint Ras;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanBeInBurlyAttack
     /// </summary>
     public unsafe virtual bool CanBeInBurlyAttack(BmSDK.BmGame.RPawnBossRasBase Ras)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.CanBeInBurlyAttack", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Ras, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CanBeInBurlyAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.CanBeInBurlyAttack", true);
+        var parms = new CanBeInBurlyAttack_Params();
+        parms.Ras = Ras?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanStartBurlyAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanStartBurlyAttack_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -130,10 +165,17 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe virtual bool CanStartBurlyAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.CanStartBurlyAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanStartBurlyAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.CanStartBurlyAttack", true);
+        var parms = new CanStartBurlyAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsBurlyAttackAllowedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsBurlyAttackAllowed_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -141,10 +183,17 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe virtual bool IsBurlyAttackAllowed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.IsBurlyAttackAllowed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsBurlyAttackAllowedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.IsBurlyAttackAllowed", true);
+        var parms = new IsBurlyAttackAllowed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpawnBurlyBrawlAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SpawnBurlyBrawlAttack_Params
+    {
+        [FieldOffset(0)] public int bFromGround;
     }
 
     /// <summary>
@@ -152,22 +201,36 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe virtual void SpawnBurlyBrawlAttack(bool bFromGround = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpawnBurlyBrawlAttack", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFromGround, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnBurlyBrawlAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpawnBurlyBrawlAttack", true);
+        var parms = new SpawnBurlyBrawlAttack_Params();
+        parms.bFromGround = bFromGround ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TryBurlyAttackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct TryBurlyAttack_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TryBurlyAttack
     /// </summary>
     public unsafe virtual bool TryBurlyAttack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.TryBurlyAttack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_TryBurlyAttackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.TryBurlyAttack", true);
+        var parms = new TryBurlyAttack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnRasDestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 128)]
+    private struct OnRasDestroyed_Params
+    {
+        [FieldOffset(0)] public nint RasPawn;
     }
 
     /// <summary>
@@ -175,116 +238,183 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe override void OnRasDestroyed(BmSDK.BmGame.RPawnBossRasBase RasPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.OnRasDestroyed", true);
-        byte* paramsPtr = stackalloc byte[128];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RasPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnRasDestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.OnRasDestroyed", true);
+        var parms = new OnRasDestroyed_Params();
+        parms.RasPawn = RasPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReplotSpawnPointsOnRasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ReplotSpawnPointsOnRas_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReplotSpawnPointsOnRas
     /// </summary>
     public unsafe virtual void ReplotSpawnPointsOnRas()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ReplotSpawnPointsOnRas", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReplotSpawnPointsOnRasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ReplotSpawnPointsOnRas", true);
+        var parms = new ReplotSpawnPointsOnRas_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearLookAtPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearLookAtPawn_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearLookAtPawn
     /// </summary>
     public unsafe override void ClearLookAtPawn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ClearLookAtPawn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearLookAtPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ClearLookAtPawn", true);
+        var parms = new ClearLookAtPawn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLookAtPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetLookAtPawn_Params
+    {
+        [FieldOffset(0)] public nint PawnToLookAt;
+        [FieldOffset(4)] public float Duration;
+    }
+
     /// <summary>
     /// Function: SetLookAtPawn
     /// </summary>
     public unsafe override void SetLookAtPawn(BmSDK.BmGame.RPawnBossRasBase PawnToLookAt, float Duration = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetLookAtPawn", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PawnToLookAt, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLookAtPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetLookAtPawn", true);
+        var parms = new SetLookAtPawn_Params();
+        parms.PawnToLookAt = PawnToLookAt?.Ptr ?? 0;
+        parms.Duration = Duration;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CycleOrbitViewPitchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CycleOrbitViewPitch_Params
+    {
+    }
+
     /// <summary>
     /// Function: CycleOrbitViewPitch
     /// </summary>
     public unsafe virtual void CycleOrbitViewPitch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.CycleOrbitViewPitch", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CycleOrbitViewPitchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.CycleOrbitViewPitch", true);
+        var parms = new CycleOrbitViewPitch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OrbitViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct OrbitView_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: OrbitView
     /// </summary>
     public unsafe virtual void OrbitView(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.OrbitView", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OrbitViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.OrbitView", true);
+        var parms = new OrbitView_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KeepInViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 57)]
+    private struct KeepInView_Params
+    {
+        [FieldOffset(0)] public nint Pawn;
+        [FieldOffset(4)] public float MaxYaw;
+    }
+
     /// <summary>
     /// Function: KeepInView
     /// </summary>
     public unsafe virtual void KeepInView(BmSDK.Engine.Actor Pawn, float MaxYaw = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.KeepInView", true);
-        byte* paramsPtr = stackalloc byte[57];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxYaw, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KeepInViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.KeepInView", true);
+        var parms = new KeepInView_Params();
+        parms.Pawn = Pawn?.Ptr ?? 0;
+        parms.MaxYaw = MaxYaw;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateKeepInViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UpdateKeepInViewTarget_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateKeepInViewTarget
     /// </summary>
     public unsafe virtual void UpdateKeepInViewTarget(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.UpdateKeepInViewTarget", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateKeepInViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.UpdateKeepInViewTarget", true);
+        var parms = new UpdateKeepInViewTarget_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableKeepInViewFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableKeepInView_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableKeepInView
     /// </summary>
     public unsafe virtual void EnableKeepInView()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.EnableKeepInView", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableKeepInViewFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.EnableKeepInView", true);
+        var parms = new EnableKeepInView_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InputRightStickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct InputRightStick_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: InputRightStick
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 InputRightStick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.InputRightStick", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_InputRightStickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.InputRightStick", true);
+        var parms = new InputRightStick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetDefaultSandCloneCamSettingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetDefaultSandCloneCamSettings_Params
+    {
     }
 
     /// <summary>
@@ -292,183 +422,289 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe override void SetDefaultSandCloneCamSettings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetDefaultSandCloneCamSettings", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDefaultSandCloneCamSettingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetDefaultSandCloneCamSettings", true);
+        var parms = new SetDefaultSandCloneCamSettings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDefaultManoCamSettingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetDefaultManoCamSettings_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetDefaultManoCamSettings
     /// </summary>
     public unsafe override void SetDefaultManoCamSettings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetDefaultManoCamSettings", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetDefaultManoCamSettingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetDefaultManoCamSettings", true);
+        var parms = new SetDefaultManoCamSettings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearCamera
     /// </summary>
     public unsafe override void ClearCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ClearCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ClearCamera", true);
+        var parms = new ClearCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLookSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetLookSpeed_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed;
+    }
+
     /// <summary>
     /// Function: SetLookSpeed
     /// </summary>
     public unsafe override void SetLookSpeed(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed Speed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetLookSpeed", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Speed, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLookSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetLookSpeed", true);
+        var parms = new SetLookSpeed_Params();
+        parms.Speed = Speed;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLockLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetLockLook_Params
+    {
+        [FieldOffset(0)] public int bLock;
+    }
+
     /// <summary>
     /// Function: SetLockLook
     /// </summary>
     public unsafe override void SetLockLook(bool bLock)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetLockLook", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLock, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLockLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetLockLook", true);
+        var parms = new SetLockLook_Params();
+        parms.bLock = bLock ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetConstantCamLookYawFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetConstantCamLookYaw_Params
+    {
+        [FieldOffset(0)] public int bConstant;
+    }
+
     /// <summary>
     /// Function: SetConstantCamLookYaw
     /// </summary>
     public unsafe override void SetConstantCamLookYaw(bool bConstant)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetConstantCamLookYaw", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bConstant, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetConstantCamLookYawFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetConstantCamLookYaw", true);
+        var parms = new SetConstantCamLookYaw_Params();
+        parms.bConstant = bConstant ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetConstantCamLookFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetConstantCamLook_Params
+    {
+        [FieldOffset(0)] public int bConstant;
+    }
+
     /// <summary>
     /// Function: SetConstantCamLook
     /// </summary>
     public unsafe override void SetConstantCamLook(bool bConstant)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetConstantCamLook", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bConstant, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetConstantCamLookFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetConstantCamLook", true);
+        var parms = new SetConstantCamLook_Params();
+        parms.bConstant = bConstant ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetLookAtHeadFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetLookAtHead_Params
+    {
+        [FieldOffset(0)] public int bLook;
+    }
+
     /// <summary>
     /// Function: SetLookAtHead
     /// </summary>
     public unsafe override void SetLookAtHead(bool bLook)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetLookAtHead", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLook, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetLookAtHeadFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetLookAtHead", true);
+        var parms = new SetLookAtHead_Params();
+        parms.bLook = bLook ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GrabbedSwordFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GrabbedSword_Params
+    {
+        [FieldOffset(0)] public nint Sword;
+    }
+
     /// <summary>
     /// Function: GrabbedSword
     /// </summary>
     public unsafe virtual void GrabbedSword(BmSDK.BmScript.RBMCombatThrownObject_RasSword Sword)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.GrabbedSword", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Sword, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GrabbedSwordFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.GrabbedSword", true);
+        var parms = new GrabbedSword_Params();
+        parms.Sword = Sword?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearEnemiesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearEnemies_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearEnemies
     /// </summary>
     public unsafe virtual void ClearEnemies()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ClearEnemies", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearEnemiesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ClearEnemies", true);
+        var parms = new ClearEnemies_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveThisPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveThisPawn_Params
+    {
+        [FieldOffset(0)] public nint pawnToKill;
+    }
+
     /// <summary>
     /// Function: RemoveThisPawn
     /// </summary>
     public unsafe override void RemoveThisPawn(BmSDK.BmGame.RPawnBossRasBase pawnToKill)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.RemoveThisPawn", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(pawnToKill, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveThisPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.RemoveThisPawn", true);
+        var parms = new RemoveThisPawn_Params();
+        parms.pawnToKill = pawnToKill?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EndStageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct EndStage_Params
+    {
+    }
+
     /// <summary>
     /// Function: EndStage
     /// </summary>
     public unsafe override void EndStage()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.EndStage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EndStageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.EndStage", true);
+        var parms = new EndStage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartIntroFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartIntro_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartIntro
     /// </summary>
     public unsafe override void StartIntro()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.StartIntro", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartIntroFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.StartIntro", true);
+        var parms = new StartIntro_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnBurlyEntranceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnBurlyEntrance_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnBurlyEntrance
     /// </summary>
     public unsafe virtual void SpawnBurlyEntrance()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpawnBurlyEntrance", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnBurlyEntranceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpawnBurlyEntrance", true);
+        var parms = new SpawnBurlyEntrance_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetLastBurlyAttackTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetLastBurlyAttackTime_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetLastBurlyAttackTime
     /// </summary>
     public unsafe virtual void ResetLastBurlyAttackTime()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ResetLastBurlyAttackTime", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetLastBurlyAttackTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ResetLastBurlyAttackTime", true);
+        var parms = new ResetLastBurlyAttackTime_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Update_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Update
     /// </summary>
     public unsafe override bool Update(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.Update", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.Update", true);
+        var parms = new Update_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct UpdateFOV_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -476,49 +712,81 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe virtual void UpdateFOV(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.UpdateFOV", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.UpdateFOV", true);
+        var parms = new UpdateFOV_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTargetFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetTargetFOV_Params
+    {
+        [FieldOffset(0)] public float NewFOV;
+        [FieldOffset(4)] public float TransitionTime;
+    }
+
     /// <summary>
     /// Function: SetTargetFOV
     /// </summary>
     public unsafe override void SetTargetFOV(float NewFOV, float TransitionTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetTargetFOV", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewFOV, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionTime, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetTargetFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SetTargetFOV", true);
+        var parms = new SetTargetFOV_Params();
+        parms.NewFOV = NewFOV;
+        parms.TransitionTime = TransitionTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CreateBatmansRasSpecificWeaponConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 556)]
+    private struct CreateBatmansRasSpecificWeaponConfig_Params
+    {
+        [FieldOffset(0)] public nint PlayerPawn;
+    }
+
     /// <summary>
     /// Function: CreateBatmansRasSpecificWeaponConfig
     /// </summary>
     public unsafe virtual void CreateBatmansRasSpecificWeaponConfig(BmSDK.BmGame.RPawnPlayerCombat PlayerPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.CreateBatmansRasSpecificWeaponConfig", true);
-        byte* paramsPtr = stackalloc byte[556];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CreateBatmansRasSpecificWeaponConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.CreateBatmansRasSpecificWeaponConfig", true);
+        var parms = new CreateBatmansRasSpecificWeaponConfig_Params();
+        parms.PlayerPawn = PlayerPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoSpawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct DoSpawn_Params
+    {
+        [FieldOffset(0)] public nint LocationActor;
+        [FieldOffset(4)] public int bUseDefaultSpawnBehaviour;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: DoSpawn
     /// </summary>
     public unsafe virtual bool DoSpawn(BmSDK.Engine.Actor LocationActor, bool bUseDefaultSpawnBehaviour = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.DoSpawn", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocationActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseDefaultSpawnBehaviour, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_DoSpawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.DoSpawn", true);
+        var parms = new DoSpawn_Params();
+        parms.LocationActor = LocationActor?.Ptr ?? 0;
+        parms.bUseDefaultSpawnBehaviour = bUseDefaultSpawnBehaviour ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SpawnEnemyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SpawnEnemy_Params
+    {
+        [FieldOffset(0)] public int bUseDefaultSpawnBehaviour;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -526,11 +794,18 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe virtual bool SpawnEnemy(bool bUseDefaultSpawnBehaviour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpawnEnemy", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseDefaultSpawnBehaviour, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_SpawnEnemyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpawnEnemy", true);
+        var parms = new SpawnEnemy_Params();
+        parms.bUseDefaultSpawnBehaviour = bUseDefaultSpawnBehaviour ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DuplicateRasFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DuplicateRas_Params
+    {
+        [FieldOffset(0)] public int bUseDefaultSpawnBehaviour;
     }
 
     /// <summary>
@@ -538,47 +813,76 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe virtual void DuplicateRas(bool bUseDefaultSpawnBehaviour)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.DuplicateRas", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseDefaultSpawnBehaviour, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DuplicateRasFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.DuplicateRas", true);
+        var parms = new DuplicateRas_Params();
+        parms.bUseDefaultSpawnBehaviour = bUseDefaultSpawnBehaviour ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivateTakeHostageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ActivateTakeHostage_Params
+    {
+        [FieldOffset(0)] public nint NewTalia;
+        [FieldOffset(4)] public nint NewRas;
+    }
+
     /// <summary>
     /// Function: ActivateTakeHostage
     /// </summary>
     public unsafe override void ActivateTakeHostage(BmSDK.GameObject NewTalia, BmSDK.GameObject NewRas)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ActivateTakeHostage", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTalia, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewRas, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivateTakeHostageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.ActivateTakeHostage", true);
+        var parms = new ActivateTakeHostage_Params();
+        parms.NewTalia = NewTalia?.Ptr ?? 0;
+        parms.NewRas = NewRas?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StaggerBatmanFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StaggerBatman_Params
+    {
+    }
+
     /// <summary>
     /// Function: StaggerBatman
     /// </summary>
     public unsafe override void StaggerBatman()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.StaggerBatman", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StaggerBatmanFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.StaggerBatman", true);
+        var parms = new StaggerBatman_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPushBackLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct GetPushBackLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 BatmanLocation;
+        [FieldOffset(12)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetPushBackLocation
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 GetPushBackLocation(System.Numerics.Vector3 BatmanLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.GetPushBackLocation", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BatmanLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_GetPushBackLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.GetPushBackLocation", true);
+        var parms = new GetPushBackLocation_Params();
+        parms.BatmanLocation = BatmanLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_HasFinishedManoTransitionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasFinishedManoTransition_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -586,10 +890,16 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe override bool HasFinishedManoTransition()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.HasFinishedManoTransition", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasFinishedManoTransitionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.HasFinishedManoTransition", true);
+        var parms = new HasFinishedManoTransition_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_RemoveSpectralFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveSpectral_Params
+    {
     }
 
     /// <summary>
@@ -597,33 +907,53 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe override void RemoveSpectral()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.RemoveSpectral", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveSpectralFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.RemoveSpectral", true);
+        var parms = new RemoveSpectral_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpectralHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SpectralHit_Params
+    {
+        [FieldOffset(0)] public int bBig;
+    }
+
     /// <summary>
     /// Function: SpectralHit
     /// </summary>
     public unsafe override void SpectralHit(bool bBig)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpectralHit", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bBig, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpectralHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpectralHit", true);
+        var parms = new SpectralHit_Params();
+        parms.bBig = bBig ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSpectralLocationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetSpectralLocation_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSpectralLocation
     /// </summary>
     public unsafe override System.Numerics.Vector3 GetSpectralLocation()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.GetSpectralLocation", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
+        var funcManaged = s_GetSpectralLocationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.GetSpectralLocation", true);
+        var parms = new GetSpectralLocation_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SpawnSpectralFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnSpectral_Params
+    {
     }
 
     /// <summary>
@@ -631,42 +961,60 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe override void SpawnSpectral()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpawnSpectral", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnSpectralFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.SpawnSpectral", true);
+        var parms = new SpawnSpectral_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartManoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct StartMano_Params
+    {
+    }
+
     /// <summary>
     /// Function: StartMano
     /// </summary>
     public unsafe override void StartMano()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.StartMano", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartManoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.StartMano", true);
+        var parms = new StartMano_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RestoreHealthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RestoreHealth_Params
+    {
+    }
+
     /// <summary>
     /// Function: RestoreHealth
     /// </summary>
     public unsafe virtual void RestoreHealth()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.RestoreHealth", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RestoreHealthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.RestoreHealth", true);
+        var parms = new RestoreHealth_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Activated_Params
+    {
+    }
+
     /// <summary>
     /// Function: Activated
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.Activated", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_RasBossLogic.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -684,8 +1032,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe int Phase
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(int*)(Ptr + 332); }
+        set { *(int*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -693,8 +1041,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe int CurrentEnemies
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(int*)(Ptr + 336); }
+        set { *(int*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -702,8 +1050,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe int EnemiesKilled
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(int*)(Ptr + 340); }
+        set { *(int*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -711,8 +1059,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe int NumberOfEnemiesBeforeRas
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(int*)(Ptr + 344); }
+        set { *(int*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -738,8 +1086,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float EnableKeepInViewTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(float*)(Ptr + 364); }
+        set { *(float*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -747,8 +1095,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float CurrMaxYawOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(float*)(Ptr + 368); }
+        set { *(float*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -756,8 +1104,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe bool bFinishPhaseSpawn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 1; else *(int*)(Ptr + 372) &= ~1; }
     }
 
     /// <summary>
@@ -765,8 +1113,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe bool bOrbitView
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 2; else *(int*)(Ptr + 372) &= ~2; }
     }
 
     /// <summary>
@@ -774,8 +1122,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe bool bLookAtHead
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 4; else *(int*)(Ptr + 372) &= ~4; }
     }
 
     /// <summary>
@@ -783,8 +1131,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe bool bConstantCamLook
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 8; else *(int*)(Ptr + 372) &= ~8; }
     }
 
     /// <summary>
@@ -792,8 +1140,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe bool bConstantCamLookYaw
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 16; else *(int*)(Ptr + 372) &= ~16; }
     }
 
     /// <summary>
@@ -801,8 +1149,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe bool bLockLook
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 32; else *(int*)(Ptr + 372) &= ~32; }
     }
 
     /// <summary>
@@ -810,8 +1158,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe int NumRasPerLine
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(int*)(Ptr + 376); }
+        set { *(int*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -819,8 +1167,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float LastBurlyAttackTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(float*)(Ptr + 380); }
+        set { *(float*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -834,8 +1182,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float StartIntroDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(float*)(Ptr + 388); }
+        set { *(float*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -843,8 +1191,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float BurlyEntranceDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(float*)(Ptr + 392); }
+        set { *(float*)(Ptr + 392) = value; }
     }
 
     /// <summary>
@@ -852,8 +1200,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float TargetFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(float*)(Ptr + 396); }
+        set { *(float*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -861,8 +1209,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float FOVTransitionTimeSec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }
+        get { return *(float*)(Ptr + 400); }
+        set { *(float*)(Ptr + 400) = value; }
     }
 
     /// <summary>
@@ -870,8 +1218,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float TimeTillTaunt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(float*)(Ptr + 404); }
+        set { *(float*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -903,8 +1251,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe BmSDK.BmGame.RGameInfo.CameraLookAtSpeed LookSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGameInfo.CameraLookAtSpeed>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed*)(Ptr + 428); }
+        set { *(BmSDK.BmGame.RGameInfo.CameraLookAtSpeed*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -912,8 +1260,8 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float OrbitViewPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -921,7 +1269,7 @@ public partial class RSeqAct_RasBossLogic : BmSDK.BmGame.RSeqAct_RasBossLogicBas
     /// </summary>
     public unsafe float NextOrbitViewSetTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 }
@@ -78,15 +78,28 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
         where TComponent : class, Framework.IScriptComponent<RSeqAct_SetCharacterProgressUI>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetObjClassVersionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetObjClassVersion_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetObjClassVersion
     /// </summary>
     public unsafe static int GetObjClassVersion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_SetCharacterProgressUI.GetObjClassVersion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetObjClassVersionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_SetCharacterProgressUI.GetObjClassVersion", true);
+        var parms = new GetObjClassVersion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ActivatedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct Activated_Params
+    {
     }
 
     /// <summary>
@@ -94,9 +107,9 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
     /// </summary>
     public unsafe override void Activated()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_SetCharacterProgressUI.Activated", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ActivatedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqAct_SetCharacterProgressUI.Activated", true);
+        var parms = new Activated_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -105,8 +118,8 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
     /// </summary>
     public unsafe BmSDK.BmGame.RPersistentData.EProgressCharacter Character
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RPersistentData.EProgressCharacter>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 204); }
+        set { *(BmSDK.BmGame.RPersistentData.EProgressCharacter*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -114,8 +127,8 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
     /// </summary>
     public unsafe BmSDK.BmScript.RSeqAct_SetCharacterProgressUI.StoryUI UI_Shown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RSeqAct_SetCharacterProgressUI.StoryUI>(Ptr + 205); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 205); }
+        get { return *(BmSDK.BmScript.RSeqAct_SetCharacterProgressUI.StoryUI*)(Ptr + 205); }
+        set { *(BmSDK.BmScript.RSeqAct_SetCharacterProgressUI.StoryUI*)(Ptr + 205) = value; }
     }
 
     /// <summary>
@@ -123,8 +136,8 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
     /// </summary>
     public unsafe BmSDK.BmGame.RGFxMovieHudExtendable.ObjIcon IconType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RGFxMovieHudExtendable.ObjIcon>(Ptr + 206); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 206); }
+        get { return *(BmSDK.BmGame.RGFxMovieHudExtendable.ObjIcon*)(Ptr + 206); }
+        set { *(BmSDK.BmGame.RGFxMovieHudExtendable.ObjIcon*)(Ptr + 206) = value; }
     }
 
     /// <summary>
@@ -132,8 +145,8 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
     /// </summary>
     public unsafe int Percentage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(int*)(Ptr + 208); }
+        set { *(int*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -168,8 +181,8 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
     /// </summary>
     public unsafe float ShowTimeSeconds
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(float*)(Ptr + 248); }
+        set { *(float*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -177,8 +190,8 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
     /// </summary>
     public unsafe bool bMapPrompt
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 1; else *(int*)(Ptr + 252) &= ~1; }
     }
 
     /// <summary>
@@ -186,8 +199,8 @@ public partial class RSeqAct_SetCharacterProgressUI : BmSDK.Engine.SequenceActio
     /// </summary>
     public unsafe bool bClearObjectivePans
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 2; else *(int*)(Ptr + 252) &= ~2; }
     }
 
     /// <summary>
@@ -78,14 +78,21 @@ public partial class RSeqEvent_CustomBackscreenRequested_NoCinematicMode : BmSDK
         where TComponent : class, Framework.IScriptComponent<RSeqEvent_CustomBackscreenRequested_NoCinematicMode>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetAvailabilityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetAvailability_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RSeqEvent_CustomBackscreenRequested.BackscreenAvailability ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAvailability
     /// </summary>
     public unsafe override BmSDK.BmGame.RSeqEvent_CustomBackscreenRequested.BackscreenAvailability GetAvailability()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqEvent_CustomBackscreenRequested_NoCinematicMode.GetAvailability", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmGame.RSeqEvent_CustomBackscreenRequested.BackscreenAvailability>(paramsPtr + 0);
+        var funcManaged = s_GetAvailabilityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSeqEvent_CustomBackscreenRequested_NoCinematicMode.GetAvailability", true);
+        var parms = new GetAvailability_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 }
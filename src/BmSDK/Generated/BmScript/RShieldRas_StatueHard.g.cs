@@ -78,14 +78,20 @@ public partial class RShieldRas_StatueHard : BmSDK.BmScript.RShieldRas_StatueEas
         where TComponent : class, Framework.IScriptComponent<RShieldRas_StatueHard>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetYawOffsetsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SetYawOffsets_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetYawOffsets
     /// </summary>
     public unsafe override void SetYawOffsets()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RShieldRas_StatueHard.SetYawOffsets", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetYawOffsetsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RShieldRas_StatueHard.SetYawOffsets", true);
+        var parms = new SetYawOffsets_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
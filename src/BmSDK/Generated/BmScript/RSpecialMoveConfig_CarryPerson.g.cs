@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float BlendInMeetingPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float MaxTurnRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(float*)(Ptr + 300); }
+        set { *(float*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe bool DropPerson
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 304) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 304); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 304); }
+        get { return (*(int*)(Ptr + 304) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 304) |= 1; else *(int*)(Ptr + 304) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName PickupAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(BmSDK.FName*)(Ptr + 316); }
+        set { *(BmSDK.FName*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName IdleAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(BmSDK.FName*)(Ptr + 324); }
+        set { *(BmSDK.FName*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName IdleToWalkAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(BmSDK.FName*)(Ptr + 332); }
+        set { *(BmSDK.FName*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName WalkAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(BmSDK.FName*)(Ptr + 340); }
+        set { *(BmSDK.FName*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName WalkToIdleAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe BmSDK.FName DropAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(BmSDK.FName*)(Ptr + 356); }
+        set { *(BmSDK.FName*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -182,7 +182,7 @@ public partial class RSpecialMoveConfig_CarryPerson : BmSDK.BmGame.RSpecialMoveC
     /// </summary>
     public unsafe float DropAnimEndTimeSeconds
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(float*)(Ptr + 364); }
+        set { *(float*)(Ptr + 364) = value; }
     }
 }
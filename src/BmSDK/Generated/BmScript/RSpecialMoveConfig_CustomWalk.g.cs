@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CustomWalk : BmSDK.BmGame.RSpecialMoveCo
     /// </summary>
     public unsafe BmSDK.FName IdleAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(BmSDK.FName*)(Ptr + 300); }
+        set { *(BmSDK.FName*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CustomWalk : BmSDK.BmGame.RSpecialMoveCo
     /// </summary>
     public unsafe BmSDK.FName IdleToWalkAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(BmSDK.FName*)(Ptr + 308); }
+        set { *(BmSDK.FName*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_CustomWalk : BmSDK.BmGame.RSpecialMoveCo
     /// </summary>
     public unsafe BmSDK.FName WalkAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(BmSDK.FName*)(Ptr + 316); }
+        set { *(BmSDK.FName*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -119,7 +119,7 @@ public partial class RSpecialMoveConfig_CustomWalk : BmSDK.BmGame.RSpecialMoveCo
     /// </summary>
     public unsafe BmSDK.FName WalkToIdleAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(BmSDK.FName*)(Ptr + 324); }
+        set { *(BmSDK.FName*)(Ptr + 324) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe bool bFarSwingMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 1; else *(int*)(Ptr + 372) &= ~1; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe bool bTargeted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 2; else *(int*)(Ptr + 372) &= ~2; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe bool bEndsInWallStick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 4; else *(int*)(Ptr + 372) &= ~4; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe bool bMoveProcedurally
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 8; else *(int*)(Ptr + 372) &= ~8; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe bool bKeepAnimationTime
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 372); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 372); }
+        get { return (*(int*)(Ptr + 372) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 372) |= 16; else *(int*)(Ptr + 372) &= ~16; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe float NormalSwingDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(float*)(Ptr + 376); }
+        set { *(float*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe float MaxSwingDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(float*)(Ptr + 380); }
+        set { *(float*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe float RateAtMaxSwingDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }
+        get { return *(float*)(Ptr + 384); }
+        set { *(float*)(Ptr + 384) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe float IdealSwingTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(float*)(Ptr + 388); }
+        set { *(float*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -164,7 +164,7 @@ public partial class RSpecialMoveConfig_CwAerialWhipPounce : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe float IdealSwingLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(float*)(Ptr + 392); }
+        set { *(float*)(Ptr + 392) = value; }
     }
 }
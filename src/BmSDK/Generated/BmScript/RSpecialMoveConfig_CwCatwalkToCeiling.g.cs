@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CwCatwalkToCeiling : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe BmSDK.FName StartAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(BmSDK.FName*)(Ptr + 296); }
+        set { *(BmSDK.FName*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CwCatwalkToCeiling : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe BmSDK.FName EndAnimName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(BmSDK.FName*)(Ptr + 304); }
+        set { *(BmSDK.FName*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CwCatwalkToCeiling : BmSDK.BmGame.RSpeci
     /// </summary>
     public unsafe bool bBranchIntoFarMoves
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 312) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 312); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 312); }
+        get { return (*(int*)(Ptr + 312) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 312) |= 1; else *(int*)(Ptr + 312) &= ~1; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName LandAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName LandRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(BmSDK.FName*)(Ptr + 356); }
+        set { *(BmSDK.FName*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName LandRightIdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(BmSDK.FName*)(Ptr + 364); }
+        set { *(BmSDK.FName*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName WallIdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(BmSDK.FName*)(Ptr + 372); }
+        set { *(BmSDK.FName*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ClimbLedgeAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(BmSDK.FName*)(Ptr + 380); }
+        set { *(BmSDK.FName*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ClimbRailingAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(BmSDK.FName*)(Ptr + 388); }
+        set { *(BmSDK.FName*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ClimbLedgeCameraState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(BmSDK.FName*)(Ptr + 396); }
+        set { *(BmSDK.FName*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ClimbRailingCameraState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(BmSDK.FName*)(Ptr + 404); }
+        set { *(BmSDK.FName*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ClimbLedgeEndMovementStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(BmSDK.FName*)(Ptr + 412); }
+        set { *(BmSDK.FName*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ClimbRailingEndMovementStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(BmSDK.FName*)(Ptr + 420); }
+        set { *(BmSDK.FName*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ClimbLedgeEndControllerState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(BmSDK.FName*)(Ptr + 428); }
+        set { *(BmSDK.FName*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -182,7 +182,7 @@ public partial class RSpecialMoveConfig_CwClawClimbEnd : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName ClimbRailingEndControllerState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(BmSDK.FName*)(Ptr + 436); }
+        set { *(BmSDK.FName*)(Ptr + 436) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LandAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LandRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(BmSDK.FName*)(Ptr + 356); }
+        set { *(BmSDK.FName*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LandRight20Anim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(BmSDK.FName*)(Ptr + 364); }
+        set { *(BmSDK.FName*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(BmSDK.FName*)(Ptr + 372); }
+        set { *(BmSDK.FName*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallIdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(BmSDK.FName*)(Ptr + 380); }
+        set { *(BmSDK.FName*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(BmSDK.FName*)(Ptr + 388); }
+        set { *(BmSDK.FName*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandLookR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(BmSDK.FName*)(Ptr + 396); }
+        set { *(BmSDK.FName*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandDangleLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(BmSDK.FName*)(Ptr + 404); }
+        set { *(BmSDK.FName*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandDangleLookR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(BmSDK.FName*)(Ptr + 412); }
+        set { *(BmSDK.FName*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandSwingLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(BmSDK.FName*)(Ptr + 420); }
+        set { *(BmSDK.FName*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandSwingLookR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(BmSDK.FName*)(Ptr + 428); }
+        set { *(BmSDK.FName*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandSwingFromLLookL
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(BmSDK.FName*)(Ptr + 436); }
+        set { *(BmSDK.FName*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandSwingFromLLookR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(BmSDK.FName*)(Ptr + 444); }
+        set { *(BmSDK.FName*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandSwingFromLLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(BmSDK.FName*)(Ptr + 452); }
+        set { *(BmSDK.FName*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandDangleSwingLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(BmSDK.FName*)(Ptr + 460); }
+        set { *(BmSDK.FName*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandDangleSwingLookR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(BmSDK.FName*)(Ptr + 468); }
+        set { *(BmSDK.FName*)(Ptr + 468) = value; }
     }
 
     /// <summary>
@@ -227,8 +227,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandShortSwingLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(BmSDK.FName*)(Ptr + 476); }
+        set { *(BmSDK.FName*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -236,8 +236,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandShortSwingLookL
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(BmSDK.FName*)(Ptr + 484); }
+        set { *(BmSDK.FName*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -245,8 +245,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandShortSwingLookR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(BmSDK.FName*)(Ptr + 492); }
+        set { *(BmSDK.FName*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -254,8 +254,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandDangleShortSwingLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(BmSDK.FName*)(Ptr + 500); }
+        set { *(BmSDK.FName*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -263,8 +263,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandDangleShortSwingLookL
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 508); }
+        get { return *(BmSDK.FName*)(Ptr + 508); }
+        set { *(BmSDK.FName*)(Ptr + 508) = value; }
     }
 
     /// <summary>
@@ -272,8 +272,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName InitialLandDangleShortSwingLookR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(BmSDK.FName*)(Ptr + 516); }
+        set { *(BmSDK.FName*)(Ptr + 516) = value; }
     }
 
     /// <summary>
@@ -281,8 +281,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallStickToLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(BmSDK.FName*)(Ptr + 524); }
+        set { *(BmSDK.FName*)(Ptr + 524) = value; }
     }
 
     /// <summary>
@@ -290,8 +290,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallStickToLookR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(BmSDK.FName*)(Ptr + 532); }
+        set { *(BmSDK.FName*)(Ptr + 532) = value; }
     }
 
     /// <summary>
@@ -299,8 +299,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LandLLookRAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(BmSDK.FName*)(Ptr + 540); }
+        set { *(BmSDK.FName*)(Ptr + 540) = value; }
     }
 
     /// <summary>
@@ -308,8 +308,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LandRLookRAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(BmSDK.FName*)(Ptr + 548); }
+        set { *(BmSDK.FName*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -317,8 +317,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LandRLookUAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(BmSDK.FName*)(Ptr + 556); }
+        set { *(BmSDK.FName*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -326,8 +326,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LandULookRAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(BmSDK.FName*)(Ptr + 564); }
+        set { *(BmSDK.FName*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -335,8 +335,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LandULookUAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 572); }
+        get { return *(BmSDK.FName*)(Ptr + 572); }
+        set { *(BmSDK.FName*)(Ptr + 572) = value; }
     }
 
     /// <summary>
@@ -344,8 +344,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallIdleLookRAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 580); }
+        get { return *(BmSDK.FName*)(Ptr + 580); }
+        set { *(BmSDK.FName*)(Ptr + 580) = value; }
     }
 
     /// <summary>
@@ -353,8 +353,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallIdleLookUAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 588); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 588); }
+        get { return *(BmSDK.FName*)(Ptr + 588); }
+        set { *(BmSDK.FName*)(Ptr + 588) = value; }
     }
 
     /// <summary>
@@ -362,8 +362,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallIdleDangleLookRAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 596); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 596); }
+        get { return *(BmSDK.FName*)(Ptr + 596); }
+        set { *(BmSDK.FName*)(Ptr + 596) = value; }
     }
 
     /// <summary>
@@ -371,8 +371,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallIdleDangleLookUAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 604); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 604); }
+        get { return *(BmSDK.FName*)(Ptr + 604); }
+        set { *(BmSDK.FName*)(Ptr + 604) = value; }
     }
 
     /// <summary>
@@ -380,8 +380,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallPushOffLookRAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 612); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 612); }
+        get { return *(BmSDK.FName*)(Ptr + 612); }
+        set { *(BmSDK.FName*)(Ptr + 612) = value; }
     }
 
     /// <summary>
@@ -389,8 +389,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName WallPushOffLookUAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 620); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 620); }
+        get { return *(BmSDK.FName*)(Ptr + 620); }
+        set { *(BmSDK.FName*)(Ptr + 620) = value; }
     }
 
     /// <summary>
@@ -398,8 +398,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LaunchAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 628); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 628); }
+        get { return *(BmSDK.FName*)(Ptr + 628); }
+        set { *(BmSDK.FName*)(Ptr + 628) = value; }
     }
 
     /// <summary>
@@ -407,8 +407,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LaunchIdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 636); }
+        get { return *(BmSDK.FName*)(Ptr + 636); }
+        set { *(BmSDK.FName*)(Ptr + 636) = value; }
     }
 
     /// <summary>
@@ -416,8 +416,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LaunchRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 644); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 644); }
+        get { return *(BmSDK.FName*)(Ptr + 644); }
+        set { *(BmSDK.FName*)(Ptr + 644) = value; }
     }
 
     /// <summary>
@@ -425,8 +425,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LaunchRightIdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 652); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 652); }
+        get { return *(BmSDK.FName*)(Ptr + 652); }
+        set { *(BmSDK.FName*)(Ptr + 652) = value; }
     }
 
     /// <summary>
@@ -434,8 +434,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LaunchRight20Anim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 660); }
+        get { return *(BmSDK.FName*)(Ptr + 660); }
+        set { *(BmSDK.FName*)(Ptr + 660) = value; }
     }
 
     /// <summary>
@@ -443,8 +443,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName LaunchRight20IdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 668); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 668); }
+        get { return *(BmSDK.FName*)(Ptr + 668); }
+        set { *(BmSDK.FName*)(Ptr + 668) = value; }
     }
 
     /// <summary>
@@ -452,8 +452,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MidAirMinDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 676); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 676); }
+        get { return *(float*)(Ptr + 676); }
+        set { *(float*)(Ptr + 676) = value; }
     }
 
     /// <summary>
@@ -461,8 +461,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MidAirDistanceOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 680); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 680); }
+        get { return *(float*)(Ptr + 680); }
+        set { *(float*)(Ptr + 680) = value; }
     }
 
     /// <summary>
@@ -470,8 +470,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MidAirScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 684); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 684); }
+        get { return *(float*)(Ptr + 684); }
+        set { *(float*)(Ptr + 684) = value; }
     }
 
     /// <summary>
@@ -479,8 +479,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe bool bScaleLR
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 688) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 688); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 688); }
+        get { return (*(int*)(Ptr + 688) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 688) |= 1; else *(int*)(Ptr + 688) &= ~1; }
     }
 
     /// <summary>
@@ -488,8 +488,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe bool bScaleUp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 688) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 688); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 688); }
+        get { return (*(int*)(Ptr + 688) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 688) |= 2; else *(int*)(Ptr + 688) &= ~2; }
     }
 
     /// <summary>
@@ -497,8 +497,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe bool bClipLR
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 688) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 688); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 688); }
+        get { return (*(int*)(Ptr + 688) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 688) |= 4; else *(int*)(Ptr + 688) &= ~4; }
     }
 
     /// <summary>
@@ -506,8 +506,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MinLRDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 692); }
+        get { return *(float*)(Ptr + 692); }
+        set { *(float*)(Ptr + 692) = value; }
     }
 
     /// <summary>
@@ -515,8 +515,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MaxLRDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 696); }
+        get { return *(float*)(Ptr + 696); }
+        set { *(float*)(Ptr + 696) = value; }
     }
 
     /// <summary>
@@ -524,8 +524,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MinLRScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 700); }
+        get { return *(float*)(Ptr + 700); }
+        set { *(float*)(Ptr + 700) = value; }
     }
 
     /// <summary>
@@ -533,8 +533,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MaxLRScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 704); }
+        get { return *(float*)(Ptr + 704); }
+        set { *(float*)(Ptr + 704) = value; }
     }
 
     /// <summary>
@@ -542,8 +542,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MinUpDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 708); }
+        get { return *(float*)(Ptr + 708); }
+        set { *(float*)(Ptr + 708) = value; }
     }
 
     /// <summary>
@@ -551,8 +551,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MaxUpDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 712); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 712); }
+        get { return *(float*)(Ptr + 712); }
+        set { *(float*)(Ptr + 712) = value; }
     }
 
     /// <summary>
@@ -560,8 +560,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MinUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 716); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 716); }
+        get { return *(float*)(Ptr + 716); }
+        set { *(float*)(Ptr + 716) = value; }
     }
 
     /// <summary>
@@ -569,8 +569,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float MaxUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 720); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 720); }
+        get { return *(float*)(Ptr + 720); }
+        set { *(float*)(Ptr + 720) = value; }
     }
 
     /// <summary>
@@ -578,8 +578,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float ClipLRIdealDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 724); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 724); }
+        get { return *(float*)(Ptr + 724); }
+        set { *(float*)(Ptr + 724) = value; }
     }
 
     /// <summary>
@@ -587,8 +587,8 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float ClipLRPer100
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 728); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 728); }
+        get { return *(float*)(Ptr + 728); }
+        set { *(float*)(Ptr + 728) = value; }
     }
 
     /// <summary>
@@ -596,7 +596,7 @@ public partial class RSpecialMoveConfig_CwClawClimbWallLand : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe float ClipLRMaxTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 732); }
+        get { return *(float*)(Ptr + 732); }
+        set { *(float*)(Ptr + 732) = value; }
     }
 }
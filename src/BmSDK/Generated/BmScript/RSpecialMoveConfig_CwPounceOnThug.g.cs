@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CwPounceOnThug : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName LaunchAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CwPounceOnThug : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName MidairAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(BmSDK.FName*)(Ptr + 356); }
+        set { *(BmSDK.FName*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CwPounceOnThug : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName LandAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(BmSDK.FName*)(Ptr + 364); }
+        set { *(BmSDK.FName*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_CwPounceOnThug : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName LandForwardAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(BmSDK.FName*)(Ptr + 372); }
+        set { *(BmSDK.FName*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_CwPounceOnThug : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName VictimLandAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(BmSDK.FName*)(Ptr + 380); }
+        set { *(BmSDK.FName*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_CwPounceOnThug : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName VictimLandFrontAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(BmSDK.FName*)(Ptr + 388); }
+        set { *(BmSDK.FName*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_CwPounceOnThug : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe BmSDK.FName VictimLandBackAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(BmSDK.FName*)(Ptr + 396); }
+        set { *(BmSDK.FName*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_CwPounceOnThug : BmSDK.BmGame.RSpecialMo
     /// </summary>
     public unsafe float SmashRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(float*)(Ptr + 408); }
+        set { *(float*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName StandToLaunchAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName RunToLaunchAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(BmSDK.FName*)(Ptr + 356); }
+        set { *(BmSDK.FName*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName StandToLaunchPounceAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(BmSDK.FName*)(Ptr + 364); }
+        set { *(BmSDK.FName*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName RunToLaunchPounceAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(BmSDK.FName*)(Ptr + 372); }
+        set { *(BmSDK.FName*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName LaunchAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(BmSDK.FName*)(Ptr + 380); }
+        set { *(BmSDK.FName*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName LaunchFromRunAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(BmSDK.FName*)(Ptr + 388); }
+        set { *(BmSDK.FName*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName LandAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(BmSDK.FName*)(Ptr + 396); }
+        set { *(BmSDK.FName*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName LandNoWallAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(BmSDK.FName*)(Ptr + 404); }
+        set { *(BmSDK.FName*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName Land45Anim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(BmSDK.FName*)(Ptr + 412); }
+        set { *(BmSDK.FName*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName LandRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(BmSDK.FName*)(Ptr + 420); }
+        set { *(BmSDK.FName*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName OverLedgeStandAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(BmSDK.FName*)(Ptr + 428); }
+        set { *(BmSDK.FName*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName OverLedgeRunAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(BmSDK.FName*)(Ptr + 436); }
+        set { *(BmSDK.FName*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName OverRailingStandAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(BmSDK.FName*)(Ptr + 444); }
+        set { *(BmSDK.FName*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName OverRailingRunAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(BmSDK.FName*)(Ptr + 452); }
+        set { *(BmSDK.FName*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName OverLedgeStandRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(BmSDK.FName*)(Ptr + 460); }
+        set { *(BmSDK.FName*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName OverLedgeRunRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(BmSDK.FName*)(Ptr + 468); }
+        set { *(BmSDK.FName*)(Ptr + 468) = value; }
     }
 
     /// <summary>
@@ -227,8 +227,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName OverRailingStandRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(BmSDK.FName*)(Ptr + 476); }
+        set { *(BmSDK.FName*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -236,8 +236,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName OverRailingRunRightAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(BmSDK.FName*)(Ptr + 484); }
+        set { *(BmSDK.FName*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -245,8 +245,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName LandIdleAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(BmSDK.FName*)(Ptr + 492); }
+        set { *(BmSDK.FName*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -254,8 +254,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName MidairAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(BmSDK.FName*)(Ptr + 500); }
+        set { *(BmSDK.FName*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -263,8 +263,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName FallAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 508); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 508); }
+        get { return *(BmSDK.FName*)(Ptr + 508); }
+        set { *(BmSDK.FName*)(Ptr + 508) = value; }
     }
 
     /// <summary>
@@ -272,8 +272,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName ClimbLedgeAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(BmSDK.FName*)(Ptr + 516); }
+        set { *(BmSDK.FName*)(Ptr + 516) = value; }
     }
 
     /// <summary>
@@ -281,8 +281,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName ClimbRailingAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 524); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 524); }
+        get { return *(BmSDK.FName*)(Ptr + 524); }
+        set { *(BmSDK.FName*)(Ptr + 524) = value; }
     }
 
     /// <summary>
@@ -290,8 +290,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName ClimbLedgeCameraState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 532); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 532); }
+        get { return *(BmSDK.FName*)(Ptr + 532); }
+        set { *(BmSDK.FName*)(Ptr + 532) = value; }
     }
 
     /// <summary>
@@ -299,8 +299,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName ClimbRailingCameraState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 540); }
+        get { return *(BmSDK.FName*)(Ptr + 540); }
+        set { *(BmSDK.FName*)(Ptr + 540) = value; }
     }
 
     /// <summary>
@@ -308,8 +308,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName ClimbLedgeEndMovementStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(BmSDK.FName*)(Ptr + 548); }
+        set { *(BmSDK.FName*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -317,8 +317,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName ClimbRailingEndMovementStance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 556); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 556); }
+        get { return *(BmSDK.FName*)(Ptr + 556); }
+        set { *(BmSDK.FName*)(Ptr + 556) = value; }
     }
 
     /// <summary>
@@ -326,8 +326,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName ClimbLedgeEndControllerState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 564); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 564); }
+        get { return *(BmSDK.FName*)(Ptr + 564); }
+        set { *(BmSDK.FName*)(Ptr + 564) = value; }
     }
 
     /// <summary>
@@ -335,8 +335,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName ClimbRailingEndControllerState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 572); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 572); }
+        get { return *(BmSDK.FName*)(Ptr + 572); }
+        set { *(BmSDK.FName*)(Ptr + 572) = value; }
     }
 
     /// <summary>
@@ -344,8 +344,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe BmSDK.FName EndCameraState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 580); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 580); }
+        get { return *(BmSDK.FName*)(Ptr + 580); }
+        set { *(BmSDK.FName*)(Ptr + 580) = value; }
     }
 
     /// <summary>
@@ -353,8 +353,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe bool UseVantagePointCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 1; else *(int*)(Ptr + 588) &= ~1; }
     }
 
     /// <summary>
@@ -362,8 +362,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe bool PounceToCeiling
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 2; else *(int*)(Ptr + 588) &= ~2; }
     }
 
     /// <summary>
@@ -371,8 +371,8 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe bool bDetectLandingFeatures
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 4; else *(int*)(Ptr + 588) &= ~4; }
     }
 
     /// <summary>
@@ -380,7 +380,7 @@ public partial class RSpecialMoveConfig_CwPounceToTarget : BmSDK.BmGame.RSpecial
     /// </summary>
     public unsafe bool bLookInLandDirection
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 588); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 588); }
+        get { return (*(int*)(Ptr + 588) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 588) |= 8; else *(int*)(Ptr + 588) &= ~8; }
     }
 }
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_FreezeFinalBeatdown : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName BeatdownIdle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(BmSDK.FName*)(Ptr + 360); }
+        set { *(BmSDK.FName*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_FreezeFinalBeatdown : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName BeatdownPunchAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(BmSDK.FName*)(Ptr + 368); }
+        set { *(BmSDK.FName*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class RSpecialMoveConfig_FreezeFinalBeatdown : BmSDK.BmGame.RSpec
     /// </summary>
     public unsafe BmSDK.FName BeatdownFrightenAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(BmSDK.FName*)(Ptr + 376); }
+        set { *(BmSDK.FName*)(Ptr + 376) = value; }
     }
 }
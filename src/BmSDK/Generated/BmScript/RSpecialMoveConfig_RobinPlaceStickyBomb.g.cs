@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_RobinPlaceStickyBomb : BmSDK.BmGame.RSpe
     /// </summary>
     public unsafe BmSDK.FName CrouchedAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(BmSDK.FName*)(Ptr + 348); }
+        set { *(BmSDK.FName*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RSpecialMoveConfig_RobinPlaceStickyBomb : BmSDK.BmGame.RSpe
     /// </summary>
     public unsafe BmSDK.FName StandingAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(BmSDK.FName*)(Ptr + 356); }
+        set { *(BmSDK.FName*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RSpecialMoveConfig_RobinPlaceStickyBomb : BmSDK.BmGame.RSpe
     /// </summary>
     public unsafe BmSDK.FName VictimAnim
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(BmSDK.FName*)(Ptr + 368); }
+        set { *(BmSDK.FName*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class RSpecialMoveConfig_RobinShieldCharge : BmSDK.BmGame.RSpecia
     /// </summary>
     public unsafe float QuickChargeDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 
     /// <summary>
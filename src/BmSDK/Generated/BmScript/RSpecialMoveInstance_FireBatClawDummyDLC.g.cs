@@ -78,14 +78,20 @@ public partial class RSpecialMoveInstance_FireBatClawDummyDLC : BmSDK.BmGame.RSp
         where TComponent : class, Framework.IScriptComponent<RSpecialMoveInstance_FireBatClawDummyDLC>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_FireBatClawFastProjectileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FireBatClawFastProjectile_Params
+    {
+    }
+
     /// <summary>
     /// Function: FireBatClawFastProjectile
     /// </summary>
     public unsafe virtual void FireBatClawFastProjectile()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FireBatClawDummyDLC.FireBatClawFastProjectile", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FireBatClawFastProjectileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FireBatClawDummyDLC.FireBatClawFastProjectile", true);
+        var parms = new FireBatClawFastProjectile_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
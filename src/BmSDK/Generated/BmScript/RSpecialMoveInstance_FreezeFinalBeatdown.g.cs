@@ -78,38 +78,64 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
         where TComponent : class, Framework.IScriptComponent<RSpecialMoveInstance_FreezeFinalBeatdown>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ReleaseCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReleaseCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReleaseCamera
     /// </summary>
     public unsafe virtual void ReleaseCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.ReleaseCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReleaseCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.ReleaseCamera", true);
+        var parms = new ReleaseCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: SetCamera
     /// </summary>
     public unsafe virtual void SetCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.SetCamera", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.SetCamera", true);
+        var parms = new SetCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UpdateSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct UpdateSpecialMove_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: UpdateSpecialMove
     /// </summary>
     public unsafe override bool UpdateSpecialMove(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.UpdateSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_UpdateSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.UpdateSpecialMove", true);
+        var parms = new UpdateSpecialMove_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DoPunchFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DoPunch_Params
+    {
     }
 
     /// <summary>
@@ -117,21 +143,34 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe virtual void DoPunch()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.DoPunch", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoPunchFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.DoPunch", true);
+        var parms = new DoPunch_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetRageProportionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetRageProportion_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetRageProportion
     /// </summary>
     public unsafe virtual float GetRageProportion()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.GetRageProportion", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetRageProportionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.GetRageProportion", true);
+        var parms = new GetRageProportion_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_PunchContactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PunchContact_Params
+    {
     }
 
     /// <summary>
@@ -139,33 +178,58 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe virtual void PunchContact()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.PunchContact", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PunchContactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.PunchContact", true);
+        var parms = new PunchContact_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct HandleAction_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName ActionName;
+    }
+
     /// <summary>
     /// Function: HandleAction
     /// </summary>
     public unsafe override void HandleAction(BmSDK.FName ActionName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.HandleAction", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ActionName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HandleActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.HandleAction", true);
+        var parms = new HandleAction_Params();
+        parms.ActionName = ActionName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsPunchAllowedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsPunchAllowed_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsPunchAllowed
     /// </summary>
     public unsafe virtual bool IsPunchAllowed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.IsPunchAllowed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsPunchAllowedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.IsPunchAllowed", true);
+        var parms = new IsPunchAllowed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayBatmanAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 72)]
+    private struct PlayBatmanAnim_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName TransitionAnim;
+        [FieldOffset(8)] public BmSDK.BmGame.RPawnCharacter.FCustomIdleConfig IdleConfig;
+        [FieldOffset(48)] public float TransitionScale;
+        [FieldOffset(52)] public float ClipFront;
+        [FieldOffset(56)] public float MeetingTime;
     }
 
     /// <summary>
@@ -173,26 +237,40 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe virtual void PlayBatmanAnim(BmSDK.FName TransitionAnim, BmSDK.BmGame.RPawnCharacter.FCustomIdleConfig IdleConfig = default, float TransitionScale = default, float ClipFront = default, float MeetingTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.PlayBatmanAnim", true);
-        byte* paramsPtr = stackalloc byte[72];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionAnim, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(IdleConfig, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionScale, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClipFront, paramsPtr + 52);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MeetingTime, paramsPtr + 56);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayBatmanAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.PlayBatmanAnim", true);
+        var parms = new PlayBatmanAnim_Params();
+        parms.TransitionAnim = TransitionAnim;
+        parms.IdleConfig = IdleConfig;
+        parms.TransitionScale = TransitionScale;
+        parms.ClipFront = ClipFront;
+        parms.MeetingTime = MeetingTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BeatdownConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BeatdownConfig_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: BeatdownConfig
     /// </summary>
     public unsafe virtual BmSDK.BmScript.RSpecialMoveConfig_FreezeFinalBeatdown BeatdownConfig()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.BeatdownConfig", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.BmScript.RSpecialMoveConfig_FreezeFinalBeatdown>(paramsPtr + 0);
+        var funcManaged = s_BeatdownConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.BeatdownConfig", true);
+        var parms = new BeatdownConfig_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.BmScript.RSpecialMoveConfig_FreezeFinalBeatdown)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_TriggerSpecialMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 112)]
+    private struct TriggerSpecialMove_Params
+    {
+        [FieldOffset(0)] public BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation;
     }
 
     /// <summary>
@@ -200,21 +278,27 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe override void TriggerSpecialMove(BmSDK.BmGame.RPawnPlayer.FEnvironmentSpecialMoveLocator MoveLocation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.TriggerSpecialMove", true);
-        byte* paramsPtr = stackalloc byte[112];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MoveLocation, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TriggerSpecialMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.TriggerSpecialMove", true);
+        var parms = new TriggerSpecialMove_Params();
+        parms.MoveLocation = MoveLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AnimationStartedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AnimationStarted_Params
+    {
+    }
+
     /// <summary>
     /// Function: AnimationStarted
     /// </summary>
     public unsafe override void AnimationStarted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.AnimationStarted", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AnimationStartedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RSpecialMoveInstance_FreezeFinalBeatdown.AnimationStarted", true);
+        var parms = new AnimationStarted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -223,8 +307,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe bool PunchCurrentlyActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 680) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 680); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 680); }
+        get { return (*(int*)(Ptr + 680) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 680) |= 1; else *(int*)(Ptr + 680) &= ~1; }
     }
 
     /// <summary>
@@ -232,8 +316,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe bool NextPunchAllowed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 680) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 680); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 680); }
+        get { return (*(int*)(Ptr + 680) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 680) |= 2; else *(int*)(Ptr + 680) &= ~2; }
     }
 
     /// <summary>
@@ -241,8 +325,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe bool GlassBroken
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 680) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 680); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 680); }
+        get { return (*(int*)(Ptr + 680) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 680) |= 4; else *(int*)(Ptr + 680) &= ~4; }
     }
 
     /// <summary>
@@ -268,8 +352,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float NextPunchCountdownTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 692); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 692); }
+        get { return *(float*)(Ptr + 692); }
+        set { *(float*)(Ptr + 692) = value; }
     }
 
     /// <summary>
@@ -277,8 +361,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float MinInterPunchPeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 696); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 696); }
+        get { return *(float*)(Ptr + 696); }
+        set { *(float*)(Ptr + 696) = value; }
     }
 
     /// <summary>
@@ -286,8 +370,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float MaxInterPunchPeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 700); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 700); }
+        get { return *(float*)(Ptr + 700); }
+        set { *(float*)(Ptr + 700) = value; }
     }
 
     /// <summary>
@@ -295,8 +379,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float MinClipFrontPeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 704); }
+        get { return *(float*)(Ptr + 704); }
+        set { *(float*)(Ptr + 704) = value; }
     }
 
     /// <summary>
@@ -304,8 +388,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float MaxClipFrontPeriod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 708); }
+        get { return *(float*)(Ptr + 708); }
+        set { *(float*)(Ptr + 708) = value; }
     }
 
     /// <summary>
@@ -313,8 +397,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float MinPunchAnimScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 712); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 712); }
+        get { return *(float*)(Ptr + 712); }
+        set { *(float*)(Ptr + 712) = value; }
     }
 
     /// <summary>
@@ -322,8 +406,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float MaxPunchAnimScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 716); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 716); }
+        get { return *(float*)(Ptr + 716); }
+        set { *(float*)(Ptr + 716) = value; }
     }
 
     /// <summary>
@@ -331,8 +415,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float PromptCountdownTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 720); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 720); }
+        get { return *(float*)(Ptr + 720); }
+        set { *(float*)(Ptr + 720) = value; }
     }
 
     /// <summary>
@@ -340,8 +424,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe float fTimeInSpecialMove
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 724); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 724); }
+        get { return *(float*)(Ptr + 724); }
+        set { *(float*)(Ptr + 724) = value; }
     }
 
     /// <summary>
@@ -349,8 +433,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe int PunchCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 728); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 728); }
+        get { return *(int*)(Ptr + 728); }
+        set { *(int*)(Ptr + 728) = value; }
     }
 
     /// <summary>
@@ -358,8 +442,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe int TotalPunchesToThrow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 732); }
+        get { return *(int*)(Ptr + 732); }
+        set { *(int*)(Ptr + 732) = value; }
     }
 
     /// <summary>
@@ -367,8 +451,8 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe int JokerSwitchPunchesLanded
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 736); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 736); }
+        get { return *(int*)(Ptr + 736); }
+        set { *(int*)(Ptr + 736) = value; }
     }
 
     /// <summary>
@@ -376,7 +460,7 @@ public partial class RSpecialMoveInstance_FreezeFinalBeatdown : BmSDK.BmGame.RSp
     /// </summary>
     public unsafe int JokerSwitchPunchesToTake
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 740); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 740); }
+        get { return *(int*)(Ptr + 740); }
+        set { *(int*)(Ptr + 740) = value; }
     }
 }
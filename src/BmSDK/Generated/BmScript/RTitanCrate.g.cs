@@ -78,14 +78,20 @@ public partial class RTitanCrate : BmSDK.BmGame.RTitanCrateBase, BmSDK.IGameObje
         where TComponent : class, Framework.IScriptComponent<RTitanCrate>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SpawnExplosionParticleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnExplosionParticle_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnExplosionParticle
     /// </summary>
     public unsafe override void SpawnExplosionParticle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RTitanCrate.SpawnExplosionParticle", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnExplosionParticleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "BmScript.RTitanCrate.SpawnExplosionParticle", true);
+        var parms = new SpawnExplosionParticle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -83,7 +83,7 @@ public partial class RZipKickTargetVolume : BmSDK.Engine.Volume, BmSDK.IGameObje
     /// </summary>
     public unsafe float OverrideThugTargetRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(float*)(Ptr + 472); }
+        set { *(float*)(Ptr + 472) = value; }
     }
 }
@@ -73,16 +73,24 @@ public partial class Commandlet : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<Commandlet>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_MainFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Main_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Params;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: Main
     /// </summary>
     public unsafe virtual int Main(BmSDK.FString Params)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Core.Commandlet.Main", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Params, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 12);
+        var funcManaged = s_MainFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Core.Commandlet.Main", true);
+        var parms = new Main_Params();
+        parms.Params = Params;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -135,8 +143,8 @@ public partial class Commandlet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsServer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 104); }
+        get { return (*(int*)(Ptr + 104) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 104) |= 1; else *(int*)(Ptr + 104) &= ~1; }
     }
 
     /// <summary>
@@ -144,8 +152,8 @@ public partial class Commandlet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsClient
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 104); }
+        get { return (*(int*)(Ptr + 104) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 104) |= 2; else *(int*)(Ptr + 104) &= ~2; }
     }
 
     /// <summary>
@@ -153,8 +161,8 @@ public partial class Commandlet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsEditor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 104); }
+        get { return (*(int*)(Ptr + 104) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 104) |= 4; else *(int*)(Ptr + 104) &= ~4; }
     }
 
     /// <summary>
@@ -162,8 +170,8 @@ public partial class Commandlet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool LogToConsole
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 104); }
+        get { return (*(int*)(Ptr + 104) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 104) |= 8; else *(int*)(Ptr + 104) &= ~8; }
     }
 
     /// <summary>
@@ -171,7 +179,7 @@ public partial class Commandlet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ShowErrorCount
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 104); }
+        get { return (*(int*)(Ptr + 104) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 104) |= 16; else *(int*)(Ptr + 104) &= ~16; }
     }
 }
@@ -87,7 +87,7 @@ public partial class Component : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName TemplateName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.FName*)(Ptr + 48); }
+        set { *(BmSDK.FName*)(Ptr + 48) = value; }
     }
 }
@@ -114,8 +114,8 @@ public partial class Factory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCreateNew
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 1; else *(int*)(Ptr + 76) &= ~1; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class Factory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEditAfterNew
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 2; else *(int*)(Ptr + 76) &= ~2; }
     }
 
     /// <summary>
@@ -132,8 +132,8 @@ public partial class Factory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEditorImport
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 4; else *(int*)(Ptr + 76) &= ~4; }
     }
 
     /// <summary>
@@ -141,8 +141,8 @@ public partial class Factory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bText
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 8; else *(int*)(Ptr + 76) &= ~8; }
     }
 
     /// <summary>
@@ -150,8 +150,8 @@ public partial class Factory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ExcludeFromAutoImport
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 16; else *(int*)(Ptr + 76) &= ~16; }
     }
 
     /// <summary>
@@ -159,8 +159,8 @@ public partial class Factory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int AutoPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(int*)(Ptr + 80); }
+        set { *(int*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -78,7 +78,7 @@ public partial class Subsystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr VfTable_FExec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(System.IntPtr*)(Ptr + 44); }
+        set { *(System.IntPtr*)(Ptr + 44) = value; }
     }
 }
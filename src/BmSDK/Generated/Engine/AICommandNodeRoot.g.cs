@@ -83,7 +83,7 @@ public partial class AICommandNodeRoot : BmSDK.Engine.AICommandNodeBase, BmSDK.I
     /// </summary>
     public unsafe BmSDK.FName RootName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(BmSDK.FName*)(Ptr + 84); }
+        set { *(BmSDK.FName*)(Ptr + 84) = value; }
     }
 }
@@ -78,24 +78,34 @@ public partial class AITree : BmSDK.Engine.K2GraphBase, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AITree>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_EvaluateTreeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct EvaluateTree_Params
+    {
+        [FieldOffset(0)] public nint InAI;
+        [FieldOffset(4)] public BmSDK.Engine.AITree.FAITreeHandle Handle;
+    }
+
     /// <summary>
     /// Function: EvaluateTree
     /// </summary>
     public unsafe virtual BmSDK.TArray<BmSDK.Class> EvaluateTree(BmSDK.Engine.AIController InAI, out BmSDK.Engine.AITree.FAITreeHandle Handle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AITree.EvaluateTree", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InAI, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Handle = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AITree.FAITreeHandle>(paramsPtr + 4);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Class>>(paramsPtr + 52);
+        var funcManaged = s_EvaluateTreeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AITree.EvaluateTree", true);
+        var parms = new EvaluateTree_Params();
+        parms.InAI = InAI?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Handle = parms.Handle;
+        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Class>>((byte*)&parms + 52);
+    }
+
+    static BmSDK.Function s_SetActiveRootFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct SetActiveRoot_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName InName;
+        [FieldOffset(8)] public BmSDK.Engine.AITree.FAITreeHandle Handle;
+        [FieldOffset(56)] public int ReturnValue;
     }
 
     /// <summary>
@@ -103,19 +113,12 @@ public partial class AITree : BmSDK.Engine.K2GraphBase, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool SetActiveRoot(BmSDK.FName InName, out BmSDK.Engine.AITree.FAITreeHandle Handle)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AITree.SetActiveRoot", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Handle = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AITree.FAITreeHandle>(paramsPtr + 8);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 56);
+        var funcManaged = s_SetActiveRootFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AITree.SetActiveRoot", true);
+        var parms = new SetActiveRoot_Params();
+        parms.InName = InName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Handle = parms.Handle;
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -145,11 +148,7 @@ public partial class AITree : BmSDK.Engine.K2GraphBase, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: ActiveRootName
         /// </summary>
-        public unsafe BmSDK.FName ActiveRootName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName ActiveRootName;
 
         /// <summary>
         /// ObjectProperty: ActiveRoot
@@ -206,10 +205,6 @@ public partial class AITree : BmSDK.Engine.K2GraphBase, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: UtilityRating
         /// </summary>
-        public unsafe float UtilityRating
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float UtilityRating;
     }
 }
@@ -73,97 +73,96 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<ActorComponent>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_DetachFromAnyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DetachFromAny_Params
+    {
+    }
+
     /// <summary>
     /// Function: DetachFromAny
     /// </summary>
     public unsafe virtual void DetachFromAny()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.DetachFromAny", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DetachFromAnyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.DetachFromAny", true);
+        var parms = new DetachFromAny_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_QueueReattachFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct QueueReattach_Params
+    {
+        [FieldOffset(0)] public int bTransformOnly;
+    }
+
     /// <summary>
     /// Function: QueueReattach
     /// </summary>
     public unsafe virtual void QueueReattach(bool bTransformOnly)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.QueueReattach", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTransformOnly, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_QueueReattachFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.QueueReattach", true);
+        var parms = new QueueReattach_Params();
+        parms.bTransformOnly = bTransformOnly ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceUpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForceUpdate_Params
+    {
+        [FieldOffset(0)] public int bTransformOnly;
+    }
+
     /// <summary>
     /// Function: ForceUpdate
     /// </summary>
     public unsafe virtual void ForceUpdate(bool bTransformOnly)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.ForceUpdate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTransformOnly, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ForceUpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.ForceUpdate", true);
+        var parms = new ForceUpdate_Params();
+        parms.bTransformOnly = bTransformOnly ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetComponentRBFixedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetComponentRBFixed_Params
+    {
+        [FieldOffset(0)] public int bFixed;
+    }
+
     /// <summary>
     /// Function: SetComponentRBFixed
     /// </summary>
     public unsafe virtual void SetComponentRBFixed(bool bFixed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.SetComponentRBFixed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFixed, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetComponentRBFixedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.SetComponentRBFixed", true);
+        var parms = new SetComponentRBFixed_Params();
+        parms.bFixed = bFixed ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetTickGroupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetTickGroup_Params
+    {
+        [FieldOffset(0)] public BmSDK.GameObject.ETickingGroup NewTickGroup;
+    }
+
     /// <summary>
     /// Function: SetTickGroup
     /// </summary>
     public unsafe virtual void SetTickGroup(BmSDK.GameObject.ETickingGroup NewTickGroup)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.SetTickGroup", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTickGroup, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetTickGroupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorComponent.SetTickGroup", true);
+        var parms = new SetTickGroup_Params();
+        parms.NewTickGroup = NewTickGroup;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -172,8 +171,8 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr Scene
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(System.IntPtr*)(Ptr + 56); }
+        set { *(System.IntPtr*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -190,8 +189,8 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAttached
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 1; else *(int*)(Ptr + 64) &= ~1; }
     }
 
     /// <summary>
@@ -199,8 +198,8 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bTickInEditor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 2; else *(int*)(Ptr + 64) &= ~2; }
     }
 
     /// <summary>
@@ -208,8 +207,8 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bNeedsReattach
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 4; else *(int*)(Ptr + 64) &= ~4; }
     }
 
     /// <summary>
@@ -217,8 +216,8 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bNeedsUpdateTransform
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 8; else *(int*)(Ptr + 64) &= ~8; }
     }
 
     /// <summary>
@@ -226,8 +225,8 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisableTick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 16; else *(int*)(Ptr + 64) &= ~16; }
     }
 
     /// <summary>
@@ -235,8 +234,8 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLevelHidden
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 32; else *(int*)(Ptr + 64) &= ~32; }
     }
 
     /// <summary>
@@ -244,8 +243,8 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.GameObject.ETickingGroup TickGroup
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.ETickingGroup>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(BmSDK.GameObject.ETickingGroup*)(Ptr + 68); }
+        set { *(BmSDK.GameObject.ETickingGroup*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -253,7 +252,7 @@ public partial class ActorComponent : BmSDK.Component, BmSDK.IGameObject
     /// </summary>
     public unsafe byte ComponentArrayPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 69); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 69); }
+        get { return *(byte*)(Ptr + 69); }
+        set { *(byte*)(Ptr + 69) = value; }
     }
 }
@@ -73,15 +73,22 @@ public partial class ActorFactory : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<ActorFactory>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PostCreateActorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PostCreateActor_Params
+    {
+        [FieldOffset(0)] public nint NewActor;
+    }
+
     /// <summary>
     /// Function: PostCreateActor
     /// </summary>
     public unsafe virtual void PostCreateActor(BmSDK.Engine.Actor NewActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorFactory.PostCreateActor", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewActor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostCreateActorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ActorFactory.PostCreateActor", true);
+        var parms = new PostCreateActor_Params();
+        parms.NewActor = NewActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -99,8 +106,8 @@ public partial class ActorFactory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName GameplayActorClassName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.FName*)(Ptr + 48); }
+        set { *(BmSDK.FName*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -117,8 +124,8 @@ public partial class ActorFactory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int MenuPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(int*)(Ptr + 68); }
+        set { *(int*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -126,8 +133,8 @@ public partial class ActorFactory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int AlternateMenuPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(int*)(Ptr + 72); }
+        set { *(int*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -144,8 +151,8 @@ public partial class ActorFactory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName NewActorClassName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(BmSDK.FName*)(Ptr + 80); }
+        set { *(BmSDK.FName*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -153,8 +160,8 @@ public partial class ActorFactory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bPlaceable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 1; else *(int*)(Ptr + 88) &= ~1; }
     }
 
     /// <summary>
@@ -162,8 +169,8 @@ public partial class ActorFactory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool UseActorSelection
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 2; else *(int*)(Ptr + 88) &= ~2; }
     }
 
     /// <summary>
@@ -171,7 +178,7 @@ public partial class ActorFactory : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShowInEditorQuickMenu
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 4; else *(int*)(Ptr + 88) &= ~4; }
     }
 }
@@ -110,8 +110,8 @@ public partial class ActorFactoryAI : BmSDK.Engine.ActorFactory, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bGiveDefaultInventory
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 112); }
+        get { return (*(int*)(Ptr + 112) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 112) |= 1; else *(int*)(Ptr + 112) &= ~1; }
     }
 
     /// <summary>
@@ -128,7 +128,7 @@ public partial class ActorFactoryAI : BmSDK.Engine.ActorFactory, BmSDK.IGameObje
     /// </summary>
     public unsafe int TeamIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(int*)(Ptr + 128); }
+        set { *(int*)(Ptr + 128) = value; }
     }
 }
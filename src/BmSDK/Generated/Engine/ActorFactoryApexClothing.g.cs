@@ -92,8 +92,8 @@ public partial class ActorFactoryApexClothing : BmSDK.Engine.ActorFactorySkeleta
     /// </summary>
     public unsafe BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel ClothingRBChannel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel*)(Ptr + 120); }
+        set { *(BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class ActorFactoryApexDestructible : BmSDK.Engine.ActorFactory, B
     /// </summary>
     public unsafe bool bStartAwake
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 1; else *(int*)(Ptr + 92) &= ~1; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class ActorFactoryApexDestructible : BmSDK.Engine.ActorFactory, B
     /// </summary>
     public unsafe BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel RBChannel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel*)(Ptr + 96); }
+        set { *(BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class ActorFactoryApexDestructible : BmSDK.Engine.ActorFactory, B
     /// </summary>
     public unsafe byte RBDominanceGroup
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 97); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 97); }
+        get { return *(byte*)(Ptr + 97); }
+        set { *(byte*)(Ptr + 97) = value; }
     }
 
     /// <summary>
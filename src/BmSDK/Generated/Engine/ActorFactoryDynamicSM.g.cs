@@ -93,8 +93,8 @@ public partial class ActorFactoryDynamicSM : BmSDK.Engine.ActorFactory, BmSDK.IG
     /// </summary>
     public unsafe bool bNoEncroachCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 1; else *(int*)(Ptr + 108) &= ~1; }
     }
 
     /// <summary>
@@ -102,8 +102,8 @@ public partial class ActorFactoryDynamicSM : BmSDK.Engine.ActorFactory, BmSDK.IG
     /// </summary>
     public unsafe bool bNotifyRigidBodyCollision
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 2; else *(int*)(Ptr + 108) &= ~2; }
     }
 
     /// <summary>
@@ -111,8 +111,8 @@ public partial class ActorFactoryDynamicSM : BmSDK.Engine.ActorFactory, BmSDK.IG
     /// </summary>
     public unsafe bool bBlockRigidBody
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 4; else *(int*)(Ptr + 108) &= ~4; }
     }
 
     /// <summary>
@@ -120,8 +120,8 @@ public partial class ActorFactoryDynamicSM : BmSDK.Engine.ActorFactory, BmSDK.IG
     /// </summary>
     public unsafe bool bUseCompartment
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 8; else *(int*)(Ptr + 108) &= ~8; }
     }
 
     /// <summary>
@@ -129,8 +129,8 @@ public partial class ActorFactoryDynamicSM : BmSDK.Engine.ActorFactory, BmSDK.IG
     /// </summary>
     public unsafe bool bCastDynamicShadow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 16; else *(int*)(Ptr + 108) &= ~16; }
     }
 
     /// <summary>
@@ -138,7 +138,7 @@ public partial class ActorFactoryDynamicSM : BmSDK.Engine.ActorFactory, BmSDK.IG
     /// </summary>
     public unsafe BmSDK.Engine.Actor.ECollisionType CollisionType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.ECollisionType>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(BmSDK.Engine.Actor.ECollisionType*)(Ptr + 112); }
+        set { *(BmSDK.Engine.Actor.ECollisionType*)(Ptr + 112) = value; }
     }
 }
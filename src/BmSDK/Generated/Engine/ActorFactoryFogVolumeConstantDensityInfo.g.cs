@@ -92,7 +92,7 @@ public partial class ActorFactoryFogVolumeConstantDensityInfo : BmSDK.Engine.Act
     /// </summary>
     public unsafe bool bNothingSelected
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 1; else *(int*)(Ptr + 96) &= ~1; }
     }
 }
@@ -78,8 +78,8 @@ public partial class ActorFactoryRigidBody : BmSDK.Engine.ActorFactoryDynamicSM,
     /// </summary>
     public unsafe bool bStartAwake
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 1; else *(int*)(Ptr + 116) &= ~1; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class ActorFactoryRigidBody : BmSDK.Engine.ActorFactoryDynamicSM,
     /// </summary>
     public unsafe bool bDamageAppliesImpulse
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 2; else *(int*)(Ptr + 116) &= ~2; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class ActorFactoryRigidBody : BmSDK.Engine.ActorFactoryDynamicSM,
     /// </summary>
     public unsafe bool bLocalSpaceInitialVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 4; else *(int*)(Ptr + 116) &= ~4; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class ActorFactoryRigidBody : BmSDK.Engine.ActorFactoryDynamicSM,
     /// </summary>
     public unsafe bool bEnableStayUprightSpring
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 8; else *(int*)(Ptr + 116) &= ~8; }
     }
 
     /// <summary>
@@ -138,8 +138,8 @@ public partial class ActorFactoryRigidBody : BmSDK.Engine.ActorFactoryDynamicSM,
     /// </summary>
     public unsafe BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel RBChannel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel*)(Ptr + 140); }
+        set { *(BmSDK.Engine.PrimitiveComponent.ERBCollisionChannel*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -147,8 +147,8 @@ public partial class ActorFactoryRigidBody : BmSDK.Engine.ActorFactoryDynamicSM,
     /// </summary>
     public unsafe float StayUprightTorqueFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(float*)(Ptr + 144); }
+        set { *(float*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -156,7 +156,7 @@ public partial class ActorFactoryRigidBody : BmSDK.Engine.ActorFactoryDynamicSM,
     /// </summary>
     public unsafe float StayUprightMaxTorque
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(float*)(Ptr + 148); }
+        set { *(float*)(Ptr + 148) = value; }
     }
 }
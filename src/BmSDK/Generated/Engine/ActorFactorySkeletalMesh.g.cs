@@ -101,7 +101,7 @@ public partial class ActorFactorySkeletalMesh : BmSDK.Engine.ActorFactory, BmSDK
     /// </summary>
     public unsafe BmSDK.FName AnimSequenceName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(BmSDK.FName*)(Ptr + 100); }
+        set { *(BmSDK.FName*)(Ptr + 100) = value; }
     }
 }
@@ -78,39 +78,37 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AkAssetPack>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UnloadAssetPackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnloadAssetPack_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnloadAssetPack
     /// </summary>
     public unsafe virtual void UnloadAssetPack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AkAssetPack.UnloadAssetPack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UnloadAssetPackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AkAssetPack.UnloadAssetPack", true);
+        var parms = new UnloadAssetPack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LoadAssetPackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct LoadAssetPack_Params
+    {
+    }
+
     /// <summary>
     /// Function: LoadAssetPack
     /// </summary>
     public unsafe virtual void LoadAssetPack()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AkAssetPack.LoadAssetPack", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_LoadAssetPackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AkAssetPack.LoadAssetPack", true);
+        var parms = new LoadAssetPack_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -128,8 +126,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ImportEvents
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1; else *(int*)(Ptr + 60) &= ~1; }
     }
 
     /// <summary>
@@ -137,8 +135,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ImportParameters
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 2; else *(int*)(Ptr + 60) &= ~2; }
     }
 
     /// <summary>
@@ -146,8 +144,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ImportSwitches
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 4; else *(int*)(Ptr + 60) &= ~4; }
     }
 
     /// <summary>
@@ -155,8 +153,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ImportStates
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 8; else *(int*)(Ptr + 60) &= ~8; }
     }
 
     /// <summary>
@@ -164,8 +162,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ImportTriggers
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 16; else *(int*)(Ptr + 60) &= ~16; }
     }
 
     /// <summary>
@@ -173,8 +171,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ImportEnvironments
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 32; else *(int*)(Ptr + 60) &= ~32; }
     }
 
     /// <summary>
@@ -182,8 +180,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AllEventsPrep
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 64; else *(int*)(Ptr + 60) &= ~64; }
     }
 
     /// <summary>
@@ -191,8 +189,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool IsLoaded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 128; else *(int*)(Ptr + 60) &= ~128; }
     }
 
     /// <summary>
@@ -200,8 +198,8 @@ public partial class AkAssetPack : BmSDK.Engine.AkHash, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ShouldBeLoaded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 256; else *(int*)(Ptr + 60) &= ~256; }
     }
 
     /// <summary>
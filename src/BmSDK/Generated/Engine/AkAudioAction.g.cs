@@ -78,8 +78,8 @@ public partial class AkAudioAction : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Stacked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1; else *(int*)(Ptr + 44) &= ~1; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class AkAudioAction : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool EnableAction
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 2; else *(int*)(Ptr + 44) &= ~2; }
     }
 
     /// <summary>
@@ -96,7 +96,7 @@ public partial class AkAudioAction : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ActivationCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(int*)(Ptr + 48); }
+        set { *(int*)(Ptr + 48) = value; }
     }
 }
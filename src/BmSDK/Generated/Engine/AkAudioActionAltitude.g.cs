@@ -83,8 +83,8 @@ public partial class AkAudioActionAltitude : BmSDK.Engine.AkAudioAction, BmSDK.I
     /// </summary>
     public unsafe BmSDK.Engine.AkWwise.EListenerID AltitudeFollowListener
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.EListenerID>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(BmSDK.Engine.AkWwise.EListenerID*)(Ptr + 52); }
+        set { *(BmSDK.Engine.AkWwise.EListenerID*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AkAudioActionAltitude : BmSDK.Engine.AkAudioAction, BmSDK.I
     /// </summary>
     public unsafe float Highest
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class AkAudioActionAltitude : BmSDK.Engine.AkAudioAction, BmSDK.I
     /// </summary>
     public unsafe float Lowest
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class AkAudioActionAltitude : BmSDK.Engine.AkAudioAction, BmSDK.I
     /// </summary>
     public unsafe float AltitudeParameterCurrent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -128,7 +128,7 @@ public partial class AkAudioActionAltitude : BmSDK.Engine.AkAudioAction, BmSDK.I
     /// </summary>
     public unsafe double AltitudeParameterLastUpdate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<double>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(double*)(Ptr + 72); }
+        set { *(double*)(Ptr + 72) = value; }
     }
 }
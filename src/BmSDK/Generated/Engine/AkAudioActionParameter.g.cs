@@ -101,8 +101,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe float ActivationValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe float ActivationInterpolationTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe bool ActivationIsAbsolute
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe bool DeactivationIsAbsolute
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 2; else *(int*)(Ptr + 68) &= ~2; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe float DeactivationValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe float DeactivationInterpolationTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe float TargetActivationValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe float TargetDeactivationValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe float CurrentParameterValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe float CurrentParameterVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -191,7 +191,7 @@ public partial class AkAudioActionParameter : BmSDK.Engine.AkAudioAction, BmSDK.
     /// </summary>
     public unsafe double LastUpdateTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<double>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(double*)(Ptr + 96); }
+        set { *(double*)(Ptr + 96) = value; }
     }
 }
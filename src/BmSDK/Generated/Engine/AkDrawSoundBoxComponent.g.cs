@@ -83,7 +83,7 @@ public partial class AkDrawSoundBoxComponent : BmSDK.Engine.DrawBoxComponent, Bm
     /// </summary>
     public unsafe float DrawScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 }
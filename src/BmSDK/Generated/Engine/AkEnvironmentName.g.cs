@@ -83,8 +83,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe bool EnableRolloff
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe bool EnableOcclusionSends
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 2; else *(int*)(Ptr + 56) &= ~2; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentRolloffDistanceMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentRolloffDistanceMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentDryMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentDryMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentRolloffSendMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentRolloffSendMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentRolloffSendPlayer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentRolloffSendNoListener
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentRolloffSendOnlyListener
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentRolloffSend2DMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnhancedWetSendMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnhancedWetSendFalloff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float DialogueMeterWetBoost
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(float*)(Ptr + 108); }
+        set { *(float*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float DialogueMeterWetBoostPlayer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(float*)(Ptr + 112); }
+        set { *(float*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -227,8 +227,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentWetSendOccludedMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(float*)(Ptr + 116); }
+        set { *(float*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -236,8 +236,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentWetSendNotOccludedMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -245,8 +245,8 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentDrySendOccludedMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -254,7 +254,7 @@ public partial class AkEnvironmentName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe float EnvironmentDrySendNotOccludedMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class AkParameterName : BmSDK.Engine.AkAsset, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AkWwise.EAkGameSyncType ParameterType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.EAkGameSyncType>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.Engine.AkWwise.EAkGameSyncType*)(Ptr + 56); }
+        set { *(BmSDK.Engine.AkWwise.EAkGameSyncType*)(Ptr + 56) = value; }
     }
 }
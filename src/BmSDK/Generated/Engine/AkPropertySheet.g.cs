@@ -83,8 +83,8 @@ public partial class AkPropertySheet : BmSDK.Engine.ActorComponent, BmSDK.IGameO
     /// </summary>
     public unsafe System.IntPtr VfTable_AkStackable
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(System.IntPtr*)(Ptr + 72); }
+        set { *(System.IntPtr*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AkPropertySheet : BmSDK.Engine.ActorComponent, BmSDK.IGameO
     /// </summary>
     public unsafe bool AutoActivation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 1; else *(int*)(Ptr + 88) &= ~1; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class AkPropertySheet : BmSDK.Engine.ActorComponent, BmSDK.IGameO
     /// </summary>
     public unsafe bool IsActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 2; else *(int*)(Ptr + 88) &= ~2; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class AkPropertySheet : BmSDK.Engine.ActorComponent, BmSDK.IGameO
     /// </summary>
     public unsafe bool Suspended
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 4; else *(int*)(Ptr + 88) &= ~4; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class AkPropertySheet : BmSDK.Engine.ActorComponent, BmSDK.IGameO
     /// </summary>
     public unsafe int ActionStackPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(int*)(Ptr + 96); }
+        set { *(int*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class AkPropertySheet : BmSDK.Engine.ActorComponent, BmSDK.IGameO
     /// </summary>
     public unsafe float CurrentActivationValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -155,7 +155,7 @@ public partial class AkPropertySheet : BmSDK.Engine.ActorComponent, BmSDK.IGameO
     /// </summary>
     public unsafe float LastActivationValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 }
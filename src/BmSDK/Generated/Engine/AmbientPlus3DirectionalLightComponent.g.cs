@@ -83,8 +83,8 @@ public partial class AmbientPlus3DirectionalLightComponent : BmSDK.Engine.LightC
     /// </summary>
     public unsafe bool bRenderBeforeModShadows
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 408) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 408); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 408); }
+        get { return (*(int*)(Ptr + 408) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 408) |= 1; else *(int*)(Ptr + 408) &= ~1; }
     }
 
     /// <summary>
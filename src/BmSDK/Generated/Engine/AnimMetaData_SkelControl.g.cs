@@ -92,8 +92,8 @@ public partial class AnimMetaData_SkelControl : BmSDK.Engine.AnimMetaData, BmSDK
     /// </summary>
     public unsafe bool bFullControlOverController
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class AnimMetaData_SkelControl : BmSDK.Engine.AnimMetaData, BmSDK
     /// </summary>
     public unsafe BmSDK.FName SkelControlName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class AnimNodeBlendByBase : BmSDK.Engine.AnimNodeBlendList, BmSDK
     /// </summary>
     public unsafe BmSDK.Engine.AnimNodeBlendByBase.EBaseBlendType Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimNodeBlendByBase.EBaseBlendType>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(BmSDK.Engine.AnimNodeBlendByBase.EBaseBlendType*)(Ptr + 260); }
+        set { *(BmSDK.Engine.AnimNodeBlendByBase.EBaseBlendType*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class AnimNodeBlendByBase : BmSDK.Engine.AnimNodeBlendList, BmSDK
     /// </summary>
     public unsafe BmSDK.FName ActorTag
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(BmSDK.FName*)(Ptr + 264); }
+        set { *(BmSDK.FName*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class AnimNodeBlendByBase : BmSDK.Engine.AnimNodeBlendList, BmSDK
     /// </summary>
     public unsafe float BlendTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(float*)(Ptr + 276); }
+        set { *(float*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe float Speed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(float*)(Ptr + 260); }
+        set { *(float*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe int LastChannel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(int*)(Ptr + 264); }
+        set { *(int*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe float BlendUpTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe float BlendDownTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(float*)(Ptr + 272); }
+        set { *(float*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe float BlendDownPerc
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(float*)(Ptr + 276); }
+        set { *(float*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe bool bUseAcceleration
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 292) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 292); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 292); }
+        get { return (*(int*)(Ptr + 292) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 292) |= 1; else *(int*)(Ptr + 292) &= ~1; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe float BlendUpDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe float BlendDownDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(float*)(Ptr + 300); }
+        set { *(float*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -164,7 +164,7 @@ public partial class AnimNodeBlendBySpeed : BmSDK.Engine.AnimNodeBlendList, BmSD
     /// </summary>
     public unsafe float BlendDelayRemaining
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(float*)(Ptr + 304); }
+        set { *(float*)(Ptr + 304) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class AnimNodeBlendDirectional : BmSDK.Engine.AnimNodeBlendBase,
     /// </summary>
     public unsafe float DirDegreesPerSecond
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class AnimNodeBlendDirectional : BmSDK.Engine.AnimNodeBlendBase,
     /// </summary>
     public unsafe float DirAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(float*)(Ptr + 232); }
+        set { *(float*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AnimNodeBlendDirectional : BmSDK.Engine.AnimNodeBlendBase,
     /// </summary>
     public unsafe int SingleAnimAtOrAboveLOD
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(int*)(Ptr + 236); }
+        set { *(int*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class AnimNodeBlendDirectional : BmSDK.Engine.AnimNodeBlendBase,
     /// </summary>
     public unsafe bool bDontUpdateBasedOnVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 1; else *(int*)(Ptr + 252) &= ~1; }
     }
 
     /// <summary>
@@ -125,7 +125,7 @@ public partial class AnimNodeBlendDirectional : BmSDK.Engine.AnimNodeBlendBase,
     /// </summary>
     public unsafe bool bUseAcceleration
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 2; else *(int*)(Ptr + 252) &= ~2; }
     }
 }
@@ -83,7 +83,7 @@ public partial class AnimNodeScalePlayRate : BmSDK.Engine.AnimNodeBlendBase, BmS
     /// </summary>
     public unsafe float ScaleByValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 }
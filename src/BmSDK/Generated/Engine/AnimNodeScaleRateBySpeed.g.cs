@@ -83,7 +83,7 @@ public partial class AnimNodeScaleRateBySpeed : BmSDK.Engine.AnimNodeScalePlayRa
     /// </summary>
     public unsafe float BaseSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(float*)(Ptr + 232); }
+        set { *(float*)(Ptr + 232) = value; }
     }
 }
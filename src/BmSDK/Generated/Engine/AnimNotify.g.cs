@@ -92,6 +92,8 @@ public partial class AnimNotify : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 12)]
     public partial record struct FNotifierInfo
     {
+        [FieldOffset(4)] private int _bitfield4;
+
         /// <summary>
         /// ComponentProperty: SkelComponent
         /// </summary>
@@ -104,10 +106,10 @@ public partial class AnimNotify : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: AnimMirrored
         /// </summary>
-        public unsafe bool AnimMirrored
+        public bool AnimMirrored
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1) != 0;
+            set { if (value) _bitfield4 |= 1; else _bitfield4 &= ~1; }
         }
 
         /// <summary>
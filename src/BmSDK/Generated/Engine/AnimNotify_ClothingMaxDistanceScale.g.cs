@@ -83,8 +83,8 @@ public partial class AnimNotify_ClothingMaxDistanceScale : BmSDK.Engine.AnimNoti
     /// </summary>
     public unsafe float StartScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(float*)(Ptr + 44); }
+        set { *(float*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class AnimNotify_ClothingMaxDistanceScale : BmSDK.Engine.AnimNoti
     /// </summary>
     public unsafe float EndScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AnimNotify_ClothingMaxDistanceScale : BmSDK.Engine.AnimNoti
     /// </summary>
     public unsafe BmSDK.Engine.SkeletalMeshComponent.EMaxDistanceScaleMode ScaleMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.SkeletalMeshComponent.EMaxDistanceScaleMode>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(BmSDK.Engine.SkeletalMeshComponent.EMaxDistanceScaleMode*)(Ptr + 52); }
+        set { *(BmSDK.Engine.SkeletalMeshComponent.EMaxDistanceScaleMode*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class AnimNotify_ClothingMaxDistanceScale : BmSDK.Engine.AnimNoti
     /// </summary>
     public unsafe float Duration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class AnimNotify_Footstep : BmSDK.Engine.AnimNotify, BmSDK.IGameO
     /// </summary>
     public unsafe int FootDown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 }
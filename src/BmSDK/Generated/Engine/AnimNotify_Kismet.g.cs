@@ -83,7 +83,7 @@ public partial class AnimNotify_Kismet : BmSDK.Engine.AnimNotify, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.FName NotifyName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 }
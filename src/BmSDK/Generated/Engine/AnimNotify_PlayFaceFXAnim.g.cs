@@ -78,16 +78,24 @@ public partial class AnimNotify_PlayFaceFXAnim : BmSDK.Engine.AnimNotify_Scripte
         where TComponent : class, Framework.IScriptComponent<AnimNotify_PlayFaceFXAnim>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_NotifyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Notify_Params
+    {
+        [FieldOffset(0)] public nint Owner;
+        [FieldOffset(4)] public nint SkelComponent;
+    }
+
     /// <summary>
     /// Function: Notify
     /// </summary>
     public unsafe override void Notify(BmSDK.Engine.Actor Owner, BmSDK.Engine.SkeletalMeshComponent SkelComponent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimNotify_PlayFaceFXAnim.Notify", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Owner, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SkelComponent, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimNotify_PlayFaceFXAnim.Notify", true);
+        var parms = new Notify_Params();
+        parms.Owner = Owner?.Ptr ?? 0;
+        parms.SkelComponent = SkelComponent?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -141,8 +149,8 @@ public partial class AnimNotify_PlayFaceFXAnim : BmSDK.Engine.AnimNotify_Scripte
     /// </summary>
     public unsafe bool bOverridePlayingAnim
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 1; else *(int*)(Ptr + 80) &= ~1; }
     }
 
     /// <summary>
@@ -150,7 +158,7 @@ public partial class AnimNotify_PlayFaceFXAnim : BmSDK.Engine.AnimNotify_Scripte
     /// </summary>
     public unsafe float PlayFrequency
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 }
@@ -78,8 +78,8 @@ public partial class AnimObject : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DrawWidth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class AnimObject : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DrawHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(int*)(Ptr + 48); }
+        set { *(int*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class AnimObject : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NodePosX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(int*)(Ptr + 52); }
+        set { *(int*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class AnimObject : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NodePosY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(int*)(Ptr + 56); }
+        set { *(int*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -114,8 +114,8 @@ public partial class AnimObject : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int OutDrawY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(int*)(Ptr + 60); }
+        set { *(int*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -78,23 +78,31 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AnimSequence>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ToStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ToString_Params
+    {
+        [FieldOffset(0)] public int Verbose;
+        [FieldOffset(4)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: ToString
     /// </summary>
     public unsafe virtual BmSDK.FString ToString(bool Verbose = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.ToString", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Verbose, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 4);
+        var funcManaged = s_ToStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.ToString", true);
+        var parms = new ToString_Params();
+        parms.Verbose = Verbose ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRealTimeLengthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetRealTimeLength_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -102,17 +110,18 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetRealTimeLength()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetRealTimeLength", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetRealTimeLengthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetRealTimeLength", true);
+        var parms = new GetRealTimeLength_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNormalizedTimeFromFrameIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetNormalizedTimeFromFrameIndex_Params
+    {
+        [FieldOffset(0)] public int FrameIndex;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -120,18 +129,19 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetNormalizedTimeFromFrameIndex(int FrameIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetNormalizedTimeFromFrameIndex", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FrameIndex, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetNormalizedTimeFromFrameIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetNormalizedTimeFromFrameIndex", true);
+        var parms = new GetNormalizedTimeFromFrameIndex_Params();
+        parms.FrameIndex = FrameIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAnimTimeFromFrameIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetAnimTimeFromFrameIndex_Params
+    {
+        [FieldOffset(0)] public int FrameIndex;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -139,18 +149,19 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetAnimTimeFromFrameIndex(int FrameIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetAnimTimeFromFrameIndex", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FrameIndex, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetAnimTimeFromFrameIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetAnimTimeFromFrameIndex", true);
+        var parms = new GetAnimTimeFromFrameIndex_Params();
+        parms.FrameIndex = FrameIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNormalizedLengthFromAnimLengthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetNormalizedLengthFromAnimLength_Params
+    {
+        [FieldOffset(0)] public float AnimLength;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -158,18 +169,19 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetNormalizedLengthFromAnimLength(float AnimLength)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetNormalizedLengthFromAnimLength", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimLength, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetNormalizedLengthFromAnimLengthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetNormalizedLengthFromAnimLength", true);
+        var parms = new GetNormalizedLengthFromAnimLength_Params();
+        parms.AnimLength = AnimLength;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNormalizedTimeFromAnimTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetNormalizedTimeFromAnimTime_Params
+    {
+        [FieldOffset(0)] public float AnimTime;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -177,18 +189,19 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetNormalizedTimeFromAnimTime(float AnimTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetNormalizedTimeFromAnimTime", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetNormalizedTimeFromAnimTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetNormalizedTimeFromAnimTime", true);
+        var parms = new GetNormalizedTimeFromAnimTime_Params();
+        parms.AnimTime = AnimTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetRealTimeFromNormalizedTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetRealTimeFromNormalizedTime_Params
+    {
+        [FieldOffset(0)] public float NormalizedTime;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -196,18 +209,19 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetRealTimeFromNormalizedTime(float NormalizedTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetRealTimeFromNormalizedTime", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NormalizedTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetRealTimeFromNormalizedTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetRealTimeFromNormalizedTime", true);
+        var parms = new GetRealTimeFromNormalizedTime_Params();
+        parms.NormalizedTime = NormalizedTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAnimTimeFromNormalizedTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetAnimTimeFromNormalizedTime_Params
+    {
+        [FieldOffset(0)] public float NormalizedTime;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -215,18 +229,23 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetAnimTimeFromNormalizedTime(float NormalizedTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetAnimTimeFromNormalizedTime", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NormalizedTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetAnimTimeFromNormalizedTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetAnimTimeFromNormalizedTime", true);
+        var parms = new GetAnimTimeFromNormalizedTime_Params();
+        parms.NormalizedTime = NormalizedTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetNotifyTimeByClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetNotifyTimeByClass_Params
+    {
+        [FieldOffset(0)] public nint NotifyClass;
+        [FieldOffset(4)] public float PlayRate;
+        [FieldOffset(8)] public float StartPosition;
+        [FieldOffset(12)] public nint out_Notify;
+        [FieldOffset(16)] public float out_Duration;
+        [FieldOffset(20)] public float ReturnValue;
     }
 
     /// <summary>
@@ -234,22 +253,15 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual float GetNotifyTimeByClass(BmSDK.Class NotifyClass, float PlayRate, float StartPosition, out BmSDK.Engine.AnimNotify out_Notify, out float out_Duration)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetNotifyTimeByClass", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NotifyClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayRate, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartPosition, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        out_Notify = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimNotify>(paramsPtr + 12);
-        out_Duration = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 16);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 20);
+        var funcManaged = s_GetNotifyTimeByClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSequence.GetNotifyTimeByClass", true);
+        var parms = new GetNotifyTimeByClass_Params();
+        parms.NotifyClass = NotifyClass?.Ptr ?? 0;
+        parms.PlayRate = PlayRate;
+        parms.StartPosition = StartPosition;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        out_Notify = parms.out_Notify == 0 ? null : (BmSDK.Engine.AnimNotify)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.out_Notify);
+        out_Duration = parms.out_Duration;
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -297,20 +309,12 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Middle
         /// </summary>
-        public unsafe BmSDK.Engine.AnimSequence.FAnimCollisionOptions Middle
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.FAnimCollisionOptions>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.AnimSequence.FAnimCollisionOptions Middle;
 
         /// <summary>
         /// StructProperty: End
         /// </summary>
-        public unsafe BmSDK.Engine.AnimSequence.FAnimCollisionOptions End
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.FAnimCollisionOptions>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.Engine.AnimSequence.FAnimCollisionOptions End;
     }
 
     /// <summary>
@@ -319,77 +323,67 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 7)]
     public partial record struct FAnimCollisionOptions
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: BlockActors
         /// </summary>
-        public unsafe bool BlockActors
+        public bool BlockActors
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: CollideWorld
         /// </summary>
-        public unsafe bool CollideWorld
+        public bool CollideWorld
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: DisableLegIK
         /// </summary>
-        public unsafe bool DisableLegIK
+        public bool DisableLegIK
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4) != 0;
+            set { if (value) _bitfield0 |= 4; else _bitfield0 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: AllowIKWhenNotPHYSWalking
         /// </summary>
-        public unsafe bool AllowIKWhenNotPHYSWalking
+        public bool AllowIKWhenNotPHYSWalking
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8) != 0;
+            set { if (value) _bitfield0 |= 8; else _bitfield0 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: PreviousVelocityOverridesAnimRootMotion
         /// </summary>
-        public unsafe bool PreviousVelocityOverridesAnimRootMotion
+        public bool PreviousVelocityOverridesAnimRootMotion
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16) != 0;
+            set { if (value) _bitfield0 |= 16; else _bitfield0 &= ~16; }
         }
 
         /// <summary>
         /// ByteProperty: Physics
         /// </summary>
-        public unsafe BmSDK.Engine.AnimSequence.EAnimPhysics Physics
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.EAnimPhysics>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.Engine.AnimSequence.EAnimPhysics Physics;
 
         /// <summary>
         /// ByteProperty: RootMotionRotationOption
         /// </summary>
-        public unsafe BmSDK.Engine.AnimSequence.ERootMotionRotationOption RootMotionRotationOption
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.ERootMotionRotationOption>(Ptr + 5); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 5); }; }
-        }
+        [FieldOffset(5)] public BmSDK.Engine.AnimSequence.ERootMotionRotationOption RootMotionRotationOption;
 
         /// <summary>
         /// ByteProperty: RootMotionTranslationOption
         /// </summary>
-        public unsafe BmSDK.Engine.AnimSequence.ERootMotionTranslationOption RootMotionTranslationOption
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.ERootMotionTranslationOption>(Ptr + 6); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 6); }; }
-        }
+        [FieldOffset(6)] public BmSDK.Engine.AnimSequence.ERootMotionTranslationOption RootMotionTranslationOption;
     }
 
     /// <summary>
@@ -433,41 +427,31 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 40)]
     public partial record struct FAnimReferencePeriods
     {
+        [FieldOffset(32)] private int _bitfield32;
+
         /// <summary>
         /// StructProperty: Start
         /// </summary>
-        public unsafe BmSDK.Engine.AnimSequence.FAnimReferenceOptions Start
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.FAnimReferenceOptions>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.AnimSequence.FAnimReferenceOptions Start;
 
         /// <summary>
         /// StructProperty: End
         /// </summary>
-        public unsafe BmSDK.Engine.AnimSequence.FAnimReferenceOptions End
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.FAnimReferenceOptions>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.Engine.AnimSequence.FAnimReferenceOptions End;
 
         /// <summary>
         /// BoolProperty: EnforceMinimumFloorHeight
         /// </summary>
-        public unsafe bool EnforceMinimumFloorHeight
+        public bool EnforceMinimumFloorHeight
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 32); }; }
+            readonly get => (_bitfield32 & 1) != 0;
+            set { if (value) _bitfield32 |= 1; else _bitfield32 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: MinimumFloorHeight
         /// </summary>
-        public unsafe float MinimumFloorHeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float MinimumFloorHeight;
     }
 
     /// <summary>
@@ -476,41 +460,31 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 16)]
     public partial record struct FAnimReferenceOptions
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: AutomaticFloorHeight
         /// </summary>
-        public unsafe bool AutomaticFloorHeight
+        public bool AutomaticFloorHeight
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// ByteProperty: ForwardYawDirection
         /// </summary>
-        public unsafe BmSDK.Engine.AnimSequence.EForwardYawDirection ForwardYawDirection
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.EForwardYawDirection>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.Engine.AnimSequence.EForwardYawDirection ForwardYawDirection;
 
         /// <summary>
         /// FloatProperty: ForwardYaw
         /// </summary>
-        public unsafe float ForwardYaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float ForwardYaw;
 
         /// <summary>
         /// FloatProperty: FloorHeight
         /// </summary>
-        public unsafe float FloorHeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float FloorHeight;
     }
 
     /// <summary>
@@ -552,24 +526,24 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
         /// </summary>
         public unsafe float Mins_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 24); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 24) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Mins
         /// </summary>
         public unsafe float Mins_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 28); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 28) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Mins
         /// </summary>
         public unsafe float Mins_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 32); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 32) = value; }; }
         }
 
         /// <summary>
@@ -577,24 +551,24 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
         /// </summary>
         public unsafe float Ranges_0
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 36); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 36) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Ranges
         /// </summary>
         public unsafe float Ranges_1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 40); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 40) = value; }; }
         }
         /// <summary>
         /// FloatProperty: Ranges
         /// </summary>
         public unsafe float Ranges_2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
+            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return *(float*)(Ptr + 44); }; }
+            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; *(float*)(Ptr + 44) = value; }; }
         }
     }
 
@@ -622,11 +596,7 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: CurveName
         /// </summary>
-        public unsafe BmSDK.FName CurveName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName CurveName;
 
         /// <summary>
         /// ArrayProperty: CurveWeights
@@ -697,11 +667,7 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: SkelControlName
         /// </summary>
-        public unsafe BmSDK.FName SkelControlName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName SkelControlName;
 
         /// <summary>
         /// ArrayProperty: Modifiers
@@ -722,20 +688,12 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Time;
 
         /// <summary>
         /// FloatProperty: TargetStrength
         /// </summary>
-        public unsafe float TargetStrength
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float TargetStrength;
     }
 
     /// <summary>
@@ -743,8 +701,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName SequenceName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -761,8 +719,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AudioComplete
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 1; else *(int*)(Ptr + 64) &= ~1; }
     }
 
     /// <summary>
@@ -770,8 +728,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseSimpleForwardYaw
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 2; else *(int*)(Ptr + 64) &= ~2; }
     }
 
     /// <summary>
@@ -779,8 +737,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseSimpleFloorHeight
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 4; else *(int*)(Ptr + 64) &= ~4; }
     }
 
     /// <summary>
@@ -788,8 +746,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseSimpleRootMotionXY
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 8; else *(int*)(Ptr + 64) &= ~8; }
     }
 
     /// <summary>
@@ -797,8 +755,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInheritRootMotionFromVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 16; else *(int*)(Ptr + 64) &= ~16; }
     }
 
     /// <summary>
@@ -806,8 +764,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool DisableProportionalMotionDuringBlendOut
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 32; else *(int*)(Ptr + 64) &= ~32; }
     }
 
     /// <summary>
@@ -815,8 +773,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AllowCheekyBlendIn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 64; else *(int*)(Ptr + 64) &= ~64; }
     }
 
     /// <summary>
@@ -824,8 +782,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AllowCheekyBlendOut
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 128; else *(int*)(Ptr + 64) &= ~128; }
     }
 
     /// <summary>
@@ -833,8 +791,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool EmbeddedFaceFXAnim_AllowAutomaticBlinks
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 256; else *(int*)(Ptr + 64) &= ~256; }
     }
 
     /// <summary>
@@ -842,8 +800,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool WeaponSwitchPointEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 512; else *(int*)(Ptr + 64) &= ~512; }
     }
 
     /// <summary>
@@ -851,8 +809,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Compression_UseLinearInterpolation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 1024; else *(int*)(Ptr + 64) &= ~1024; }
     }
 
     /// <summary>
@@ -860,8 +818,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Compression_RelativeToReferencePose
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 2048; else *(int*)(Ptr + 64) &= ~2048; }
     }
 
     /// <summary>
@@ -869,8 +827,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Compression_UsingTemporaryCompression
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 4096; else *(int*)(Ptr + 64) &= ~4096; }
     }
 
     /// <summary>
@@ -878,8 +836,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDoNotOverrideCompression
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 8192; else *(int*)(Ptr + 64) &= ~8192; }
     }
 
     /// <summary>
@@ -887,8 +845,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasBeenUsed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 16384; else *(int*)(Ptr + 64) &= ~16384; }
     }
 
     /// <summary>
@@ -896,8 +854,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool MetricWasRecorded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 32768; else *(int*)(Ptr + 64) &= ~32768; }
     }
 
     /// <summary>
@@ -905,8 +863,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float SequenceLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -914,8 +872,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumFrames
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(int*)(Ptr + 72); }
+        set { *(int*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -923,8 +881,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float RateScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -968,8 +926,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AnimSequence.AnimationCompressionFormat TranslationCompressionFormat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.AnimationCompressionFormat>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.Engine.AnimSequence.AnimationCompressionFormat*)(Ptr + 120); }
+        set { *(BmSDK.Engine.AnimSequence.AnimationCompressionFormat*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -977,8 +935,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AnimSequence.AnimationCompressionFormat RotationCompressionFormat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.AnimationCompressionFormat>(Ptr + 121); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 121); }
+        get { return *(BmSDK.Engine.AnimSequence.AnimationCompressionFormat*)(Ptr + 121); }
+        set { *(BmSDK.Engine.AnimSequence.AnimationCompressionFormat*)(Ptr + 121) = value; }
     }
 
     /// <summary>
@@ -986,8 +944,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.RAnimZip_Settings.EAnimZipPreset Compression_Preset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RAnimZip_Settings.EAnimZipPreset>(Ptr + 122); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 122); }
+        get { return *(BmSDK.Engine.RAnimZip_Settings.EAnimZipPreset*)(Ptr + 122); }
+        set { *(BmSDK.Engine.RAnimZip_Settings.EAnimZipPreset*)(Ptr + 122) = value; }
     }
 
     /// <summary>
@@ -995,8 +953,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AnimSequence.AnimationKeyFormat KeyEncodingFormat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.AnimationKeyFormat>(Ptr + 123); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 123); }
+        get { return *(BmSDK.Engine.AnimSequence.AnimationKeyFormat*)(Ptr + 123); }
+        set { *(BmSDK.Engine.AnimSequence.AnimationKeyFormat*)(Ptr + 123) = value; }
     }
 
     /// <summary>
@@ -1046,8 +1004,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ReferencePointYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(float*)(Ptr + 184); }
+        set { *(float*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -1061,8 +1019,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ProportionalMotionDistanceCap
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -1076,8 +1034,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float BlendInDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(float*)(Ptr + 248); }
+        set { *(float*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -1085,8 +1043,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float BlendOutDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(float*)(Ptr + 252); }
+        set { *(float*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -1103,8 +1061,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float BlendInPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(float*)(Ptr + 260); }
+        set { *(float*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -1112,8 +1070,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float BlendOutPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -1121,8 +1079,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ClippedStart
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -1130,8 +1088,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ClippedLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(float*)(Ptr + 272); }
+        set { *(float*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -1139,8 +1097,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CanCancelBeforeHerePoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(float*)(Ptr + 276); }
+        set { *(float*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -1148,8 +1106,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CanCancelAfterHerePoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 280); }
+        get { return *(float*)(Ptr + 280); }
+        set { *(float*)(Ptr + 280) = value; }
     }
 
     /// <summary>
@@ -1157,8 +1115,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CanCorrectAfterHerePoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }
+        get { return *(float*)(Ptr + 284); }
+        set { *(float*)(Ptr + 284) = value; }
     }
 
     /// <summary>
@@ -1166,8 +1124,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ClipRootMotionInPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(float*)(Ptr + 288); }
+        set { *(float*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -1175,8 +1133,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ClipRootMotionOutPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }
+        get { return *(float*)(Ptr + 292); }
+        set { *(float*)(Ptr + 292) = value; }
     }
 
     /// <summary>
@@ -1184,8 +1142,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CollisionOptionsOutPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -1193,8 +1151,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float WeaponSwitchPoint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(float*)(Ptr + 300); }
+        set { *(float*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -1232,8 +1190,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr TranslationCodec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(System.IntPtr*)(Ptr + 344); }
+        set { *(System.IntPtr*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -1241,8 +1199,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr RotationCodec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(System.IntPtr*)(Ptr + 348); }
+        set { *(System.IntPtr*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -1250,8 +1208,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int EncodingPkgVersion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(int*)(Ptr + 352); }
+        set { *(int*)(Ptr + 352) = value; }
     }
 
     /// <summary>
@@ -1259,8 +1217,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CompressCommandletVersion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(int*)(Ptr + 356); }
+        set { *(int*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -1268,8 +1226,8 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float UseScore
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(float*)(Ptr + 360); }
+        set { *(float*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -1324,11 +1282,7 @@ public partial class AnimSequence : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Time;
 
         /// <summary>
         /// ObjectProperty: Notify
@@ -78,23 +78,24 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AnimSet>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_FindAnimSequenceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct FindAnimSequence_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName SequenceName;
+        [FieldOffset(8)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: FindAnimSequence
     /// </summary>
     public unsafe virtual BmSDK.Engine.AnimSequence FindAnimSequence(BmSDK.FName SequenceName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSet.FindAnimSequence", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SequenceName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence>(paramsPtr + 8);
+        var funcManaged = s_FindAnimSequenceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AnimSet.FindAnimSequence", true);
+        var parms = new FindAnimSequence_Params();
+        parms.SequenceName = SequenceName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AnimSequence)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
     }
 
     /// <summary>
@@ -106,29 +107,17 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: SkelMeshName
         /// </summary>
-        public unsafe BmSDK.FName SkelMeshName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName SkelMeshName;
 
         /// <summary>
         /// NameProperty: ExtraSkelMesh1Name
         /// </summary>
-        public unsafe BmSDK.FName ExtraSkelMesh1Name
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.FName ExtraSkelMesh1Name;
 
         /// <summary>
         /// NameProperty: AnimSetName
         /// </summary>
-        public unsafe BmSDK.FName AnimSetName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.FName AnimSetName;
 
         /// <summary>
         /// StrProperty: AnimPostfixName
@@ -145,8 +134,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAnimRotationOnly
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1; else *(int*)(Ptr + 44) &= ~1; }
     }
 
     /// <summary>
@@ -154,8 +143,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bReferenceFullAnimSetInIdleConfigs
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 2; else *(int*)(Ptr + 44) &= ~2; }
     }
 
     /// <summary>
@@ -163,8 +152,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AutoDeleteTracks_Face
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 4; else *(int*)(Ptr + 44) &= ~4; }
     }
 
     /// <summary>
@@ -172,8 +161,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AutoDeleteTracks_Eyes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 8; else *(int*)(Ptr + 44) &= ~8; }
     }
 
     /// <summary>
@@ -181,8 +170,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AutoDeleteTracks_Nubs
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 16; else *(int*)(Ptr + 44) &= ~16; }
     }
 
     /// <summary>
@@ -190,8 +179,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AutoDeleteTracks_Flappy
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 32; else *(int*)(Ptr + 44) &= ~32; }
     }
 
     /// <summary>
@@ -199,8 +188,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Compression_OverrideIndividualAnimSettings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 64; else *(int*)(Ptr + 44) &= ~64; }
     }
 
     /// <summary>
@@ -253,8 +242,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName PreviewSkelMeshName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.FName*)(Ptr + 204); }
+        set { *(BmSDK.FName*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -262,8 +251,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName PreviewExtraSkelMesh1Name
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(BmSDK.FName*)(Ptr + 212); }
+        set { *(BmSDK.FName*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -271,8 +260,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName PreviewExtraSkelMesh2Name
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(BmSDK.FName*)(Ptr + 220); }
+        set { *(BmSDK.FName*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -280,8 +269,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName PreviewExtraSkelMesh3Name
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(BmSDK.FName*)(Ptr + 228); }
+        set { *(BmSDK.FName*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -289,8 +278,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName BestRatioSkelMeshName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(BmSDK.FName*)(Ptr + 236); }
+        set { *(BmSDK.FName*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -316,8 +305,8 @@ public partial class AnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.RAnimZip_Settings.EAnimZipPreset Compression_Preset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RAnimZip_Settings.EAnimZipPreset>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(BmSDK.Engine.RAnimZip_Settings.EAnimZipPreset*)(Ptr + 268); }
+        set { *(BmSDK.Engine.RAnimZip_Settings.EAnimZipPreset*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class AnimationCompressionAlgorithm : BmSDK.GameObject, BmSDK.IGa
     /// </summary>
     public unsafe bool bNeedsSkeleton
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class AnimationCompressionAlgorithm : BmSDK.GameObject, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.Engine.AnimSequence.AnimationCompressionFormat TranslationCompressionFormat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.AnimationCompressionFormat>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.Engine.AnimSequence.AnimationCompressionFormat*)(Ptr + 60); }
+        set { *(BmSDK.Engine.AnimSequence.AnimationCompressionFormat*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -105,7 +105,7 @@ public partial class AnimationCompressionAlgorithm : BmSDK.GameObject, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.Engine.AnimSequence.AnimationCompressionFormat RotationCompressionFormat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AnimSequence.AnimationCompressionFormat>(Ptr + 61); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 61); }
+        get { return *(BmSDK.Engine.AnimSequence.AnimationCompressionFormat*)(Ptr + 61); }
+        set { *(BmSDK.Engine.AnimSequence.AnimationCompressionFormat*)(Ptr + 61) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class AnimationCompressionAlgorithm_Automatic : BmSDK.Engine.Anim
     /// </summary>
     public unsafe float MaxEndEffectorError
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class AnimationCompressionAlgorithm_Automatic : BmSDK.Engine.Anim
     /// </summary>
     public unsafe bool bTryFixedBitwiseCompression
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AnimationCompressionAlgorithm_Automatic : BmSDK.Engine.Anim
     /// </summary>
     public unsafe bool bTryPerTrackBitwiseCompression
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 2; else *(int*)(Ptr + 68) &= ~2; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class AnimationCompressionAlgorithm_Automatic : BmSDK.Engine.Anim
     /// </summary>
     public unsafe bool bTryLinearKeyRemovalCompression
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 4; else *(int*)(Ptr + 68) &= ~4; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class AnimationCompressionAlgorithm_Automatic : BmSDK.Engine.Anim
     /// </summary>
     public unsafe bool bTryIntervalKeyRemoval
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 8; else *(int*)(Ptr + 68) &= ~8; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class AnimationCompressionAlgorithm_Automatic : BmSDK.Engine.Anim
     /// </summary>
     public unsafe bool bRunCurrentDefaultCompressor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 16; else *(int*)(Ptr + 68) &= ~16; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class AnimationCompressionAlgorithm_Automatic : BmSDK.Engine.Anim
     /// </summary>
     public unsafe bool bAutoReplaceIfExistingErrorTooGreat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 32; else *(int*)(Ptr + 68) &= ~32; }
     }
 
     /// <summary>
@@ -146,7 +146,7 @@ public partial class AnimationCompressionAlgorithm_Automatic : BmSDK.Engine.Anim
     /// </summary>
     public unsafe bool bRaiseMaxErrorToExisting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 64; else *(int*)(Ptr + 68) &= ~64; }
     }
 }
@@ -83,8 +83,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float MaxZeroingThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float MaxPosDiffBitwise
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float MaxAngleDiffBitwise
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe bool bResampleAnimation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 1; else *(int*)(Ptr + 128) &= ~1; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe bool bUseAdaptiveError
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 2; else *(int*)(Ptr + 128) &= ~2; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe bool bUseOverrideForEndEffectors
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 4; else *(int*)(Ptr + 128) &= ~4; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe bool bUseAdaptiveError2
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }
+        get { return (*(int*)(Ptr + 128) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 128) |= 8; else *(int*)(Ptr + 128) &= ~8; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float ResampledFramerate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(float*)(Ptr + 132); }
+        set { *(float*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe int MinKeysForResampling
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(int*)(Ptr + 136); }
+        set { *(int*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe int TrackHeightBias
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(int*)(Ptr + 140); }
+        set { *(int*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float ParentingDivisor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(float*)(Ptr + 144); }
+        set { *(float*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float ParentingDivisorExponent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(float*)(Ptr + 148); }
+        set { *(float*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float RotationErrorSourceRatio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(float*)(Ptr + 152); }
+        set { *(float*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float TranslationErrorSourceRatio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(float*)(Ptr + 156); }
+        set { *(float*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -227,8 +227,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float MaxErrorPerTrackRatio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -236,8 +236,8 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe float PerturbationProbeSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 
     /// <summary>
@@ -245,7 +245,7 @@ public partial class AnimationCompressionAlgorithm_PerTrackCompression : BmSDK.E
     /// </summary>
     public unsafe System.IntPtr PerReductionCachedData
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }
+        get { return *(System.IntPtr*)(Ptr + 168); }
+        set { *(System.IntPtr*)(Ptr + 168) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class AnimationCompressionAlgorithm_RemoveEverySecondKey : BmSDK.
     /// </summary>
     public unsafe int MinKeys
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(int*)(Ptr + 64); }
+        set { *(int*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class AnimationCompressionAlgorithm_RemoveEverySecondKey : BmSDK.
     /// </summary>
     public unsafe bool bStartAtSecondKey
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 }
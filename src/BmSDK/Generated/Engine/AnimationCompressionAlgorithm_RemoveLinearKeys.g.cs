@@ -83,8 +83,8 @@ public partial class AnimationCompressionAlgorithm_RemoveLinearKeys : BmSDK.Engi
     /// </summary>
     public unsafe float MaxPosDiff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class AnimationCompressionAlgorithm_RemoveLinearKeys : BmSDK.Engi
     /// </summary>
     public unsafe float MaxAngleDiff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class AnimationCompressionAlgorithm_RemoveLinearKeys : BmSDK.Engi
     /// </summary>
     public unsafe float MaxEffectorDiff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class AnimationCompressionAlgorithm_RemoveLinearKeys : BmSDK.Engi
     /// </summary>
     public unsafe float MinEffectorDiff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class AnimationCompressionAlgorithm_RemoveLinearKeys : BmSDK.Engi
     /// </summary>
     public unsafe float EffectorDiffSocket
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class AnimationCompressionAlgorithm_RemoveLinearKeys : BmSDK.Engi
     /// </summary>
     public unsafe float ParentKeyScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class AnimationCompressionAlgorithm_RemoveLinearKeys : BmSDK.Engi
     /// </summary>
     public unsafe bool bRetarget
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 1; else *(int*)(Ptr + 88) &= ~1; }
     }
 
     /// <summary>
@@ -146,7 +146,7 @@ public partial class AnimationCompressionAlgorithm_RemoveLinearKeys : BmSDK.Engi
     /// </summary>
     public unsafe bool bActuallyFilterLinearKeys
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 2; else *(int*)(Ptr + 88) &= ~2; }
     }
 }
@@ -83,7 +83,7 @@ public partial class ApexDynamicComponent : BmSDK.Engine.ApexComponentBase, BmSD
     /// </summary>
     public unsafe System.IntPtr ComponentDynamicResources
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(System.IntPtr*)(Ptr + 436); }
+        set { *(System.IntPtr*)(Ptr + 436) = value; }
     }
 }
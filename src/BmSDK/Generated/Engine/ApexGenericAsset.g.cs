@@ -83,8 +83,8 @@ public partial class ApexGenericAsset : BmSDK.Engine.ApexAsset, BmSDK.IGameObjec
     /// </summary>
     public unsafe System.IntPtr MApexAsset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(System.IntPtr*)(Ptr + 92); }
+        set { *(System.IntPtr*)(Ptr + 92) = value; }
     }
 
     /// <summary>
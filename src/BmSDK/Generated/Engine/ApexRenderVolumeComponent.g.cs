@@ -83,8 +83,8 @@ public partial class ApexRenderVolumeComponent : BmSDK.Engine.PrimitiveComponent
     /// </summary>
     public unsafe System.IntPtr ApexRenderVolume
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(System.IntPtr*)(Ptr + 404); }
+        set { *(System.IntPtr*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class ApexRenderVolumeComponent : BmSDK.Engine.PrimitiveComponent
     /// </summary>
     public unsafe System.IntPtr ViewRelevance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(System.IntPtr*)(Ptr + 408); }
+        set { *(System.IntPtr*)(Ptr + 408) = value; }
     }
 }
@@ -78,58 +78,63 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<AudioDevice>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ClearScaleformDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearScaleformData_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearScaleformData
     /// </summary>
     public unsafe virtual void ClearScaleformData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.ClearScaleformData", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClearScaleformDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.ClearScaleformData", true);
+        var parms = new ClearScaleformData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceUpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ForceUpdate_Params
+    {
+    }
+
     /// <summary>
     /// Function: ForceUpdate
     /// </summary>
     public unsafe virtual void ForceUpdate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.ForceUpdate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ForceUpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.ForceUpdate", true);
+        var parms = new ForceUpdate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetFadeVolumeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetFadeVolume_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetFadeVolume
     /// </summary>
     public unsafe virtual float GetFadeVolume()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.GetFadeVolume", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetFadeVolumeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.GetFadeVolume", true);
+        var parms = new GetFadeVolume_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetFadeVolumeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetFadeVolume_Params
+    {
+        [FieldOffset(0)] public float Volume;
     }
 
     /// <summary>
@@ -137,37 +142,31 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetFadeVolume(float Volume)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.SetFadeVolume", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Volume, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetFadeVolumeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.SetFadeVolume", true);
+        var parms = new SetFadeVolume_Params();
+        parms.Volume = Volume;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDebugMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SetDebugMessage_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString msg;
+        [FieldOffset(12)] public int V;
+    }
+
     /// <summary>
     /// Function: SetDebugMessage
     /// </summary>
     public unsafe virtual void SetDebugMessage(BmSDK.FString msg, int V)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.SetDebugMessage", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(msg, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetDebugMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.AudioDevice.SetDebugMessage", true);
+        var parms = new SetDebugMessage_Params();
+        parms.msg = msg;
+        parms.V = V;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -176,8 +175,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxChannels
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(int*)(Ptr + 48); }
+        set { *(int*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -185,8 +184,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int CommonAudioPoolSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(int*)(Ptr + 52); }
+        set { *(int*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -194,8 +193,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float LowPassFilterResonance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -203,8 +202,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinCompressedDurationEditor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -212,8 +211,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinCompressedDurationGame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -257,8 +256,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr CommonAudioPool
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(System.IntPtr*)(Ptr + 100); }
+        set { *(System.IntPtr*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -266,8 +265,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int CommonAudioPoolFreeBytes
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(int*)(Ptr + 104); }
+        set { *(int*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -311,8 +310,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bGameWasTicking
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 1; else *(int*)(Ptr + 204) &= ~1; }
     }
 
     /// <summary>
@@ -320,8 +319,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool EnableMIDIMixing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 2; else *(int*)(Ptr + 204) &= ~2; }
     }
 
     /// <summary>
@@ -329,8 +328,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ReverbEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 4; else *(int*)(Ptr + 204) &= ~4; }
     }
 
     /// <summary>
@@ -338,8 +337,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool HRTFEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 8; else *(int*)(Ptr + 204) &= ~8; }
     }
 
     /// <summary>
@@ -347,8 +346,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool DialogueOcclusionEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 16; else *(int*)(Ptr + 204) &= ~16; }
     }
 
     /// <summary>
@@ -356,8 +355,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool SFXOcclusionEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 32; else *(int*)(Ptr + 204) &= ~32; }
     }
 
     /// <summary>
@@ -365,8 +364,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool CompressorEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 64; else *(int*)(Ptr + 204) &= ~64; }
     }
 
     /// <summary>
@@ -383,8 +382,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe ulong CurrentTick
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<ulong>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(ulong*)(Ptr + 220); }
+        set { *(ulong*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -392,8 +391,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MIDIDeviceChannelIn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(int*)(Ptr + 228); }
+        set { *(int*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -401,8 +400,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MIDIDeviceChannelInXT
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(int*)(Ptr + 232); }
+        set { *(int*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -410,8 +409,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MIDIDeviceChannelOut
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(int*)(Ptr + 236); }
+        set { *(int*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -419,8 +418,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MIDIDeviceChannelOutXT
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(int*)(Ptr + 240); }
+        set { *(int*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -473,8 +472,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr Effects
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(System.IntPtr*)(Ptr + 296); }
+        set { *(System.IntPtr*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -491,8 +490,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr TextToSpeech
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(System.IntPtr*)(Ptr + 304); }
+        set { *(System.IntPtr*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -500,8 +499,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AudioDevice.EDebugState DebugState
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AudioDevice.EDebugState>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(BmSDK.Engine.AudioDevice.EDebugState*)(Ptr + 308); }
+        set { *(BmSDK.Engine.AudioDevice.EDebugState*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -509,8 +508,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float TransientMasterVolume
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(float*)(Ptr + 312); }
+        set { *(float*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -518,8 +517,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OverallVolumeFade
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(float*)(Ptr + 316); }
+        set { *(float*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -527,8 +526,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int maxDialogPriority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(int*)(Ptr + 320); }
+        set { *(int*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -536,8 +535,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float SFXVolume
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(float*)(Ptr + 324); }
+        set { *(float*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -545,8 +544,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MusicVolume
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(float*)(Ptr + 328); }
+        set { *(float*)(Ptr + 328) = value; }
     }
 
     /// <summary>
@@ -554,8 +553,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float DialogueVolume
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(float*)(Ptr + 332); }
+        set { *(float*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -563,8 +562,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ReverbMinDryness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(float*)(Ptr + 336); }
+        set { *(float*)(Ptr + 336) = value; }
     }
 
     /// <summary>
@@ -572,8 +571,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ReverbMaxDryness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(float*)(Ptr + 340); }
+        set { *(float*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -581,8 +580,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ReverbMinWetness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(float*)(Ptr + 344); }
+        set { *(float*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -590,8 +589,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ReverbMaxWetness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -599,8 +598,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ReverbMinFalloff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(float*)(Ptr + 352); }
+        set { *(float*)(Ptr + 352) = value; }
     }
 
     /// <summary>
@@ -608,8 +607,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ReverbMaxFalloff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }
+        get { return *(float*)(Ptr + 356); }
+        set { *(float*)(Ptr + 356) = value; }
     }
 
     /// <summary>
@@ -617,8 +616,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float HRTFStartAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 360); }
+        get { return *(float*)(Ptr + 360); }
+        set { *(float*)(Ptr + 360) = value; }
     }
 
     /// <summary>
@@ -626,8 +625,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float HRTFStartValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 364); }
+        get { return *(float*)(Ptr + 364); }
+        set { *(float*)(Ptr + 364) = value; }
     }
 
     /// <summary>
@@ -635,8 +634,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float HRTFMinValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(float*)(Ptr + 368); }
+        set { *(float*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -644,8 +643,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float HRTFMaxValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(float*)(Ptr + 372); }
+        set { *(float*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -653,8 +652,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float HRTFExample
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }
+        get { return *(float*)(Ptr + 376); }
+        set { *(float*)(Ptr + 376) = value; }
     }
 
     /// <summary>
@@ -662,8 +661,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float DialogueOcclusionExample
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 380); }
+        get { return *(float*)(Ptr + 380); }
+        set { *(float*)(Ptr + 380) = value; }
     }
 
     /// <summary>
@@ -671,8 +670,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float DialogueOcclusionReverbExample
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 384); }
+        get { return *(float*)(Ptr + 384); }
+        set { *(float*)(Ptr + 384) = value; }
     }
 
     /// <summary>
@@ -680,8 +679,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float SFXOcclusionExample
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(float*)(Ptr + 388); }
+        set { *(float*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -689,8 +688,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float SFXOcclusionReverbExample
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(float*)(Ptr + 392); }
+        set { *(float*)(Ptr + 392) = value; }
     }
 
     /// <summary>
@@ -698,8 +697,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float CompressorAttack
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(float*)(Ptr + 396); }
+        set { *(float*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -707,8 +706,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float CompressorRelease
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }
+        get { return *(float*)(Ptr + 400); }
+        set { *(float*)(Ptr + 400) = value; }
     }
 
     /// <summary>
@@ -716,8 +715,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float CompressorThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 404); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 404); }
+        get { return *(float*)(Ptr + 404); }
+        set { *(float*)(Ptr + 404) = value; }
     }
 
     /// <summary>
@@ -725,8 +724,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float CompressorGain
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(float*)(Ptr + 408); }
+        set { *(float*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -734,8 +733,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccStartValueM
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(float*)(Ptr + 412); }
+        set { *(float*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -743,8 +742,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccFloor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(float*)(Ptr + 416); }
+        set { *(float*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -752,8 +751,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccDistanceFloor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(float*)(Ptr + 420); }
+        set { *(float*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -761,8 +760,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccLerp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(float*)(Ptr + 424); }
+        set { *(float*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -770,8 +769,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccSlowLerp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -779,8 +778,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccDistanceLerp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -788,8 +787,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccUncontestedFloor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -797,8 +796,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccCloseMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(float*)(Ptr + 440); }
+        set { *(float*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -806,8 +805,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccCloseMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(float*)(Ptr + 444); }
+        set { *(float*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -815,8 +814,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float OccCloseMinPercent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(float*)(Ptr + 448); }
+        set { *(float*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -824,8 +823,8 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastUpdateTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(float*)(Ptr + 452); }
+        set { *(float*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -846,65 +845,37 @@ public partial class AudioDevice : BmSDK.Subsystem, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Location
         /// </summary>
-        public unsafe System.Numerics.Vector3 Location
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 Location;
 
         /// <summary>
         /// StructProperty: Up
         /// </summary>
-        public unsafe System.Numerics.Vector3 Up
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 Up;
 
         /// <summary>
         /// StructProperty: Right
         /// </summary>
-        public unsafe System.Numerics.Vector3 Right
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector3 Right;
 
         /// <summary>
         /// StructProperty: Front
         /// </summary>
-        public unsafe System.Numerics.Vector3 Front
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector3 Front;
 
         /// <summary>
         /// StructProperty: MicLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 MicLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public System.Numerics.Vector3 MicLocation;
 
         /// <summary>
         /// FloatProperty: FOV
         /// </summary>
-        public unsafe float FOV
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float FOV;
 
         /// <summary>
         /// FloatProperty: ZoomMagnification
         /// </summary>
-        public unsafe float ZoomMagnification
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float ZoomMagnification;
     }
 
     /// <summary>
@@ -83,7 +83,7 @@ public partial class BlurEffect : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObj
     /// </summary>
     public unsafe int BlurKernelSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(int*)(Ptr + 84); }
+        set { *(int*)(Ptr + 84) = value; }
     }
 }
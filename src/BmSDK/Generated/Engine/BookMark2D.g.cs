@@ -83,8 +83,8 @@ public partial class BookMark2D : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Zoom2D
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(float*)(Ptr + 44); }
+        set { *(float*)(Ptr + 44) = value; }
     }
 
     /// <summary>
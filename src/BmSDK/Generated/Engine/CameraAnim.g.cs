@@ -92,8 +92,8 @@ public partial class CameraAnim : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -113,8 +113,8 @@ public partial class CameraAnim : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float BasePPSettingsAlpha
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(float*)(Ptr + 480); }
+        set { *(float*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -122,7 +122,7 @@ public partial class CameraAnim : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float BaseFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(float*)(Ptr + 484); }
+        set { *(float*)(Ptr + 484) = value; }
     }
 }
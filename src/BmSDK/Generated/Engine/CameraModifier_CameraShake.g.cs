@@ -78,25 +78,37 @@ public partial class CameraModifier_CameraShake : BmSDK.Engine.CameraModifier, B
         where TComponent : class, Framework.IScriptComponent<CameraModifier_CameraShake>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ModifyCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct ModifyCamera_Params
+    {
+        [FieldOffset(0)] public nint Camera;
+        [FieldOffset(4)] public float DeltaTime;
+        [FieldOffset(8)] public BmSDK.GameObject.FTPOV OutPOV;
+        [FieldOffset(36)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ModifyCamera
     /// </summary>
     public unsafe override bool ModifyCamera(BmSDK.Engine.Camera Camera, float DeltaTime, out BmSDK.GameObject.FTPOV OutPOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.ModifyCamera", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Camera, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        OutPOV = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FTPOV>(paramsPtr + 8);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 36);
+        var funcManaged = s_ModifyCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.ModifyCamera", true);
+        var parms = new ModifyCamera_Params();
+        parms.Camera = Camera?.Ptr ?? 0;
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        OutPOV = parms.OutPOV;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_UpdateCameraShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 188)]
+    private struct UpdateCameraShake_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(16)] public BmSDK.Engine.CameraModifier_CameraShake.FCameraShakeInstance Shake;
+        [FieldOffset(160)] public BmSDK.GameObject.FTPOV OutPOV;
     }
 
     /// <summary>
@@ -104,73 +116,108 @@ public partial class CameraModifier_CameraShake : BmSDK.Engine.CameraModifier, B
     /// </summary>
     public unsafe virtual void UpdateCameraShake(float DeltaTime, out BmSDK.Engine.CameraModifier_CameraShake.FCameraShakeInstance Shake, out BmSDK.GameObject.FTPOV OutPOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.UpdateCameraShake", true);
-        byte* paramsPtr = stackalloc byte[188];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Shake = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraModifier_CameraShake.FCameraShakeInstance>(paramsPtr + 16);
-        OutPOV = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FTPOV>(paramsPtr + 160);
+        var funcManaged = s_UpdateCameraShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.UpdateCameraShake", true);
+        var parms = new UpdateCameraShake_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Shake = parms.Shake;
+        OutPOV = parms.OutPOV;
         return;
     }
 
+    static BmSDK.Function s_RemoveAllCameraShakesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveAllCameraShakes_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveAllCameraShakes
     /// </summary>
     public unsafe virtual void RemoveAllCameraShakes()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.RemoveAllCameraShakes", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveAllCameraShakesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.RemoveAllCameraShakes", true);
+        var parms = new RemoveAllCameraShakes_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveCameraShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RemoveCameraShake_Params
+    {
+        [FieldOffset(0)] public nint Shake;
+    }
+
     /// <summary>
     /// Function: RemoveCameraShake
     /// </summary>
     public unsafe virtual void RemoveCameraShake(BmSDK.Engine.CameraShake Shake)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.RemoveCameraShake", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Shake, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveCameraShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.RemoveCameraShake", true);
+        var parms = new RemoveCameraShake_Params();
+        parms.Shake = Shake?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddCameraShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct AddCameraShake_Params
+    {
+        [FieldOffset(0)] public nint NewShake;
+        [FieldOffset(4)] public float Scale;
+        [FieldOffset(8)] public BmSDK.Engine.Camera.ECameraAnimPlaySpace PlaySpace;
+        [FieldOffset(12)] public BmSDK.Rotator UserPlaySpaceRot;
+    }
+
     /// <summary>
     /// Function: AddCameraShake
     /// </summary>
     public unsafe virtual void AddCameraShake(BmSDK.Engine.CameraShake NewShake, float Scale, BmSDK.Engine.Camera.ECameraAnimPlaySpace PlaySpace = default, BmSDK.Rotator UserPlaySpaceRot = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.AddCameraShake", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewShake, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Scale, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlaySpace, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UserPlaySpaceRot, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddCameraShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.AddCameraShake", true);
+        var parms = new AddCameraShake_Params();
+        parms.NewShake = NewShake?.Ptr ?? 0;
+        parms.Scale = Scale;
+        parms.PlaySpace = PlaySpace;
+        parms.UserPlaySpaceRot = UserPlaySpaceRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitializeShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 332)]
+    private struct InitializeShake_Params
+    {
+        [FieldOffset(0)] public nint NewShake;
+        [FieldOffset(4)] public float Scale;
+        [FieldOffset(8)] public BmSDK.Engine.Camera.ECameraAnimPlaySpace PlaySpace;
+        [FieldOffset(12)] public BmSDK.Rotator UserPlaySpaceRot;
+        [FieldOffset(32)] public BmSDK.Engine.CameraModifier_CameraShake.FCameraShakeInstance ReturnValue;
+    }
+
     /// <summary>
     /// Function: InitializeShake
     /// </summary>
     public unsafe virtual BmSDK.Engine.CameraModifier_CameraShake.FCameraShakeInstance InitializeShake(BmSDK.Engine.CameraShake NewShake, float Scale, BmSDK.Engine.Camera.ECameraAnimPlaySpace PlaySpace, BmSDK.Rotator UserPlaySpaceRot = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.InitializeShake", true);
-        byte* paramsPtr = stackalloc byte[332];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewShake, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Scale, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlaySpace, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UserPlaySpaceRot, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraModifier_CameraShake.FCameraShakeInstance>(paramsPtr + 32);
+        var funcManaged = s_InitializeShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.InitializeShake", true);
+        var parms = new InitializeShake_Params();
+        parms.NewShake = NewShake?.Ptr ?? 0;
+        parms.Scale = Scale;
+        parms.PlaySpace = PlaySpace;
+        parms.UserPlaySpaceRot = UserPlaySpaceRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ReinitShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ReinitShake_Params
+    {
+        [FieldOffset(0)] public int ActiveShakeIdx;
+        [FieldOffset(4)] public float Scale;
     }
 
     /// <summary>
@@ -178,24 +225,32 @@ public partial class CameraModifier_CameraShake : BmSDK.Engine.CameraModifier, B
     /// </summary>
     public unsafe virtual void ReinitShake(int ActiveShakeIdx, float Scale)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.ReinitShake", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ActiveShakeIdx, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Scale, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReinitShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.ReinitShake", true);
+        var parms = new ReinitShake_Params();
+        parms.ActiveShakeIdx = ActiveShakeIdx;
+        parms.Scale = Scale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitializeOffsetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct InitializeOffset_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.CameraShake.FFOscillator Param;
+        [FieldOffset(12)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: InitializeOffset
     /// </summary>
     public unsafe static float InitializeOffset(out BmSDK.Engine.CameraShake.FFOscillator Param)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.InitializeOffset", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        Param = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraShake.FFOscillator>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 12);
+        var funcManaged = s_InitializeOffsetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.CameraModifier_CameraShake.InitializeOffset", true);
+        var parms = new InitializeOffset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        Param = parms.Param;
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -212,8 +267,8 @@ public partial class CameraModifier_CameraShake : BmSDK.Engine.CameraModifier, B
     /// </summary>
     public unsafe float SplitScreenShakeScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -222,6 +277,9 @@ public partial class CameraModifier_CameraShake : BmSDK.Engine.CameraModifier, B
     [StructLayout(LayoutKind.Explicit, Size = 144)]
     public partial record struct FCameraShakeInstance
     {
+        [FieldOffset(16)] private int _bitfield16;
+        [FieldOffset(24)] private int _bitfield24;
+
         /// <summary>
         /// ObjectProperty: SourceShake
         /// </summary>
@@ -234,92 +292,60 @@ public partial class CameraModifier_CameraShake : BmSDK.Engine.CameraModifier, B
         /// <summary>
         /// NameProperty: SourceShakeName
         /// </summary>
-        public unsafe BmSDK.FName SourceShakeName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.FName SourceShakeName;
 
         /// <summary>
         /// FloatProperty: OscillatorTimeRemaining
         /// </summary>
-        public unsafe float OscillatorTimeRemaining
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float OscillatorTimeRemaining;
 
         /// <summary>
         /// BoolProperty: bBlendingIn
         /// </summary>
-        public unsafe bool bBlendingIn
+        public bool bBlendingIn
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 1) != 0;
+            set { if (value) _bitfield16 |= 1; else _bitfield16 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: CurrentBlendInTime
         /// </summary>
-        public unsafe float CurrentBlendInTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float CurrentBlendInTime;
 
         /// <summary>
         /// BoolProperty: bBlendingOut
         /// </summary>
-        public unsafe bool bBlendingOut
+        public bool bBlendingOut
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 1) != 0;
+            set { if (value) _bitfield24 |= 1; else _bitfield24 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: CurrentBlendOutTime
         /// </summary>
-        public unsafe float CurrentBlendOutTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float CurrentBlendOutTime;
 
         /// <summary>
         /// StructProperty: LocSinOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 LocSinOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public System.Numerics.Vector3 LocSinOffset;
 
         /// <summary>
         /// StructProperty: RotSinOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 RotSinOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public System.Numerics.Vector3 RotSinOffset;
 
         /// <summary>
         /// FloatProperty: FOVSinOffset
         /// </summary>
-        public unsafe float FOVSinOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float FOVSinOffset;
 
         /// <summary>
         /// FloatProperty: Scale
         /// </summary>
-        public unsafe float Scale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public float Scale;
 
         /// <summary>
         /// ObjectProperty: AnimInst
@@ -333,19 +359,11 @@ public partial class CameraModifier_CameraShake : BmSDK.Engine.CameraModifier, B
         /// <summary>
         /// ByteProperty: PlaySpace
         /// </summary>
-        public unsafe BmSDK.Engine.Camera.ECameraAnimPlaySpace PlaySpace
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Camera.ECameraAnimPlaySpace>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public BmSDK.Engine.Camera.ECameraAnimPlaySpace PlaySpace;
 
         /// <summary>
         /// StructProperty: UserPlaySpaceMatrix
         /// </summary>
-        public unsafe BmSDK.GameObject.FMatrix UserPlaySpaceMatrix
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMatrix>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
-        }
+        [FieldOffset(80)] public BmSDK.GameObject.FMatrix UserPlaySpaceMatrix;
     }
 }
@@ -87,29 +87,17 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: X
         /// </summary>
-        public unsafe BmSDK.Engine.CameraShake.FFOscillator X
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraShake.FFOscillator>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.CameraShake.FFOscillator X;
 
         /// <summary>
         /// StructProperty: Y
         /// </summary>
-        public unsafe BmSDK.Engine.CameraShake.FFOscillator Y
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraShake.FFOscillator>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.Engine.CameraShake.FFOscillator Y;
 
         /// <summary>
         /// StructProperty: Z
         /// </summary>
-        public unsafe BmSDK.Engine.CameraShake.FFOscillator Z
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraShake.FFOscillator>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.Engine.CameraShake.FFOscillator Z;
     }
 
     /// <summary>
@@ -121,29 +109,17 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Pitch
         /// </summary>
-        public unsafe BmSDK.Engine.CameraShake.FFOscillator Pitch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraShake.FFOscillator>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.CameraShake.FFOscillator Pitch;
 
         /// <summary>
         /// StructProperty: Yaw
         /// </summary>
-        public unsafe BmSDK.Engine.CameraShake.FFOscillator Yaw
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraShake.FFOscillator>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.Engine.CameraShake.FFOscillator Yaw;
 
         /// <summary>
         /// StructProperty: Roll
         /// </summary>
-        public unsafe BmSDK.Engine.CameraShake.FFOscillator Roll
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraShake.FFOscillator>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public BmSDK.Engine.CameraShake.FFOscillator Roll;
     }
 
     /// <summary>
@@ -155,29 +131,17 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Amplitude
         /// </summary>
-        public unsafe float Amplitude
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float Amplitude;
 
         /// <summary>
         /// FloatProperty: Frequency
         /// </summary>
-        public unsafe float Frequency
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Frequency;
 
         /// <summary>
         /// ByteProperty: InitialOffset
         /// </summary>
-        public unsafe BmSDK.Engine.CameraShake.EInitialOscillatorOffset InitialOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.CameraShake.EInitialOscillatorOffset>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.Engine.CameraShake.EInitialOscillatorOffset InitialOffset;
     }
 
     /// <summary>
@@ -195,8 +159,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSingleInstance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1; else *(int*)(Ptr + 44) &= ~1; }
     }
 
     /// <summary>
@@ -204,8 +168,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRandomAnimSegment
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 2; else *(int*)(Ptr + 44) &= ~2; }
     }
 
     /// <summary>
@@ -213,8 +177,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float OscillationDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -222,8 +186,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float OscillationBlendInTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -231,8 +195,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float OscillationBlendOutTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -267,8 +231,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimPlayRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(float*)(Ptr + 148); }
+        set { *(float*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -276,8 +240,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(float*)(Ptr + 152); }
+        set { *(float*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -285,8 +249,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimBlendInTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(float*)(Ptr + 156); }
+        set { *(float*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -294,8 +258,8 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AnimBlendOutTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -303,7 +267,7 @@ public partial class CameraShake : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float RandomAnimSegmentDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 }
@@ -78,247 +78,314 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<Canvas>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_DrawTextureDoubleLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct DrawTextureDoubleLine_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StartPoint;
+        [FieldOffset(12)] public System.Numerics.Vector3 EndPoint;
+        [FieldOffset(24)] public float Perc;
+        [FieldOffset(28)] public float Spacing;
+        [FieldOffset(32)] public float Width;
+        [FieldOffset(36)] public BmSDK.GameObject.FColor LineColor;
+        [FieldOffset(40)] public BmSDK.GameObject.FColor AltLineColor;
+        [FieldOffset(44)] public nint Tex;
+        [FieldOffset(48)] public float U;
+        [FieldOffset(52)] public float V;
+        [FieldOffset(56)] public float UL;
+        [FieldOffset(60)] public float VL;
+    }
+
     /// <summary>
     /// Function: DrawTextureDoubleLine
     /// </summary>
     public unsafe virtual void DrawTextureDoubleLine(System.Numerics.Vector3 StartPoint, System.Numerics.Vector3 EndPoint, float Perc, float Spacing, float Width, BmSDK.GameObject.FColor LineColor, BmSDK.GameObject.FColor AltLineColor, BmSDK.Engine.Texture Tex, float U, float V, float UL, float VL)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTextureDoubleLine", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartPoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndPoint, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Perc, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Spacing, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Width, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineColor, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AltLineColor, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Tex, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(U, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 52);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UL, paramsPtr + 56);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VL, paramsPtr + 60);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawTextureDoubleLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTextureDoubleLine", true);
+        var parms = new DrawTextureDoubleLine_Params();
+        parms.StartPoint = StartPoint;
+        parms.EndPoint = EndPoint;
+        parms.Perc = Perc;
+        parms.Spacing = Spacing;
+        parms.Width = Width;
+        parms.LineColor = LineColor;
+        parms.AltLineColor = AltLineColor;
+        parms.Tex = Tex?.Ptr ?? 0;
+        parms.U = U;
+        parms.V = V;
+        parms.UL = UL;
+        parms.VL = VL;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawTextureLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct DrawTextureLine_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 StartPoint;
+        [FieldOffset(12)] public System.Numerics.Vector3 EndPoint;
+        [FieldOffset(24)] public float Perc;
+        [FieldOffset(28)] public float Width;
+        [FieldOffset(32)] public BmSDK.GameObject.FColor LineColor;
+        [FieldOffset(36)] public nint LineTexture;
+        [FieldOffset(40)] public float U;
+        [FieldOffset(44)] public float V;
+        [FieldOffset(48)] public float UL;
+        [FieldOffset(52)] public float VL;
+    }
+
     /// <summary>
     /// Function: DrawTextureLine
     /// </summary>
     public unsafe virtual void DrawTextureLine(System.Numerics.Vector3 StartPoint, System.Numerics.Vector3 EndPoint, float Perc, float Width, BmSDK.GameObject.FColor LineColor, BmSDK.Engine.Texture LineTexture, float U, float V, float UL, float VL)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTextureLine", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartPoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndPoint, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Perc, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Width, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineColor, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineTexture, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(U, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UL, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VL, paramsPtr + 52);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawTextureLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTextureLine", true);
+        var parms = new DrawTextureLine_Params();
+        parms.StartPoint = StartPoint;
+        parms.EndPoint = EndPoint;
+        parms.Perc = Perc;
+        parms.Width = Width;
+        parms.LineColor = LineColor;
+        parms.LineTexture = LineTexture?.Ptr ?? 0;
+        parms.U = U;
+        parms.V = V;
+        parms.UL = UL;
+        parms.VL = VL;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Draw2DLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct Draw2DLine_Params
+    {
+        [FieldOffset(0)] public float X1;
+        [FieldOffset(4)] public float Y1;
+        [FieldOffset(8)] public float X2;
+        [FieldOffset(12)] public float Y2;
+        [FieldOffset(16)] public BmSDK.GameObject.FColor LineColor;
+    }
+
     /// <summary>
     /// Function: Draw2DLine
     /// </summary>
     public unsafe virtual void Draw2DLine(float X1, float Y1, float X2, float Y2, BmSDK.GameObject.FColor LineColor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.Draw2DLine", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X1, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y1, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X2, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y2, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineColor, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_Draw2DLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.Draw2DLine", true);
+        var parms = new Draw2DLine_Params();
+        parms.X1 = X1;
+        parms.Y1 = Y1;
+        parms.X2 = X2;
+        parms.Y2 = Y2;
+        parms.LineColor = LineColor;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetDrawColorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetDrawColor_Params
+    {
+        [FieldOffset(0)] public byte R;
+        [FieldOffset(1)] public byte G;
+        [FieldOffset(2)] public byte B;
+        [FieldOffset(3)] public byte A;
+    }
+
     /// <summary>
     /// Function: SetDrawColor
     /// </summary>
     public unsafe virtual void SetDrawColor(byte R, byte G, byte B, byte A = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.SetDrawColor", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(R, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(G, paramsPtr + 1);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(B, paramsPtr + 2);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 3);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetDrawColorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.SetDrawColor", true);
+        var parms = new SetDrawColor_Params();
+        parms.R = R;
+        parms.G = G;
+        parms.B = B;
+        parms.A = A;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawBoxFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct DrawBox_Params
+    {
+        [FieldOffset(0)] public float Width;
+        [FieldOffset(4)] public float Height;
+    }
+
     /// <summary>
     /// Function: DrawBox
     /// </summary>
     public unsafe virtual void DrawBox(float Width, float Height)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawBox", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Width, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Height, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawBoxFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawBox", true);
+        var parms = new DrawBox_Params();
+        parms.Width = Width;
+        parms.Height = Height;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawRectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DrawRect_Params
+    {
+        [FieldOffset(0)] public float RectX;
+        [FieldOffset(4)] public float RectY;
+        [FieldOffset(8)] public nint Tex;
+    }
+
     /// <summary>
     /// Function: DrawRect
     /// </summary>
     public unsafe virtual void DrawRect(float RectX, float RectY, BmSDK.Engine.Texture Tex = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawRect", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RectX, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RectY, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Tex, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawRectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawRect", true);
+        var parms = new DrawRect_Params();
+        parms.RectX = RectX;
+        parms.RectY = RectY;
+        parms.Tex = Tex?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetPosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetPos_Params
+    {
+        [FieldOffset(0)] public float PosX;
+        [FieldOffset(4)] public float PosY;
+        [FieldOffset(8)] public float PosZ;
+    }
+
     /// <summary>
     /// Function: SetPos
     /// </summary>
     public unsafe virtual void SetPos(float PosX, float PosY, float PosZ = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.SetPos", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PosX, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PosY, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PosZ, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetPosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.SetPos", true);
+        var parms = new SetPos_Params();
+        parms.PosX = PosX;
+        parms.PosY = PosY;
+        parms.PosZ = PosZ;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Reset_Params
+    {
+        [FieldOffset(0)] public int bKeepOrigin;
+    }
+
     /// <summary>
     /// Function: Reset
     /// </summary>
     public unsafe virtual void Reset(bool bKeepOrigin = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.Reset", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bKeepOrigin, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.Reset", true);
+        var parms = new Reset_Params();
+        parms.bKeepOrigin = bKeepOrigin ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PopTransformFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PopTransform_Params
+    {
+    }
+
     /// <summary>
     /// Function: PopTransform
     /// </summary>
     public unsafe virtual void PopTransform()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.PopTransform", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PopTransformFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.PopTransform", true);
+        var parms = new PopTransform_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PushTranslationMatrixFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PushTranslationMatrix_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TranslationVector;
+    }
+
     /// <summary>
     /// Function: PushTranslationMatrix
     /// </summary>
     public unsafe virtual void PushTranslationMatrix(System.Numerics.Vector3 TranslationVector)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.PushTranslationMatrix", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TranslationVector, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PushTranslationMatrixFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.PushTranslationMatrix", true);
+        var parms = new PushTranslationMatrix_Params();
+        parms.TranslationVector = TranslationVector;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ProjectSphereBoundsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ProjectSphereBounds_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Center;
+        [FieldOffset(12)] public float Radius;
+        [FieldOffset(16)] public System.Numerics.Vector2 Min;
+        [FieldOffset(24)] public System.Numerics.Vector2 Max;
+    }
+
     /// <summary>
     /// Function: ProjectSphereBounds
     /// </summary>
     public unsafe virtual void ProjectSphereBounds(System.Numerics.Vector3 Center, float Radius, out System.Numerics.Vector2 Min, out System.Numerics.Vector2 Max)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.ProjectSphereBounds", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Center, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Radius, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Min = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(paramsPtr + 16);
-        Max = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(paramsPtr + 24);
+        var funcManaged = s_ProjectSphereBoundsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.ProjectSphereBounds", true);
+        var parms = new ProjectSphereBounds_Params();
+        parms.Center = Center;
+        parms.Radius = Radius;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Min = parms.Min;
+        Max = parms.Max;
         return;
     }
 
+    static BmSDK.Function s_ProjectStaticMeshBoundsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ProjectStaticMeshBounds_Params
+    {
+        [FieldOffset(0)] public nint MeshComponent;
+        [FieldOffset(4)] public System.Numerics.Vector2 Min;
+        [FieldOffset(12)] public System.Numerics.Vector2 Max;
+        [FieldOffset(20)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ProjectStaticMeshBounds
     /// </summary>
     public unsafe virtual bool ProjectStaticMeshBounds(BmSDK.Engine.StaticMeshComponent MeshComponent, out System.Numerics.Vector2 Min, out System.Numerics.Vector2 Max)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.ProjectStaticMeshBounds", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MeshComponent, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Min = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(paramsPtr + 4);
-        Max = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 20);
+        var funcManaged = s_ProjectStaticMeshBoundsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.ProjectStaticMeshBounds", true);
+        var parms = new ProjectStaticMeshBounds_Params();
+        parms.MeshComponent = MeshComponent?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Min = parms.Min;
+        Max = parms.Max;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_WorldToPixelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct WorldToPixel_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 InPosition;
+        [FieldOffset(12)] public System.Numerics.Vector3 OutPosition;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -326,19 +393,21 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool WorldToPixel(System.Numerics.Vector3 InPosition, out System.Numerics.Vector3 OutPosition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.WorldToPixel", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InPosition, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        OutPosition = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_WorldToPixelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.WorldToPixel", true);
+        var parms = new WorldToPixel_Params();
+        parms.InPosition = InPosition;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        OutPosition = parms.OutPosition;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_DeProjectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct DeProject_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector2 ScreenPos;
+        [FieldOffset(8)] public System.Numerics.Vector3 WorldOrigin;
+        [FieldOffset(20)] public System.Numerics.Vector3 WorldDirection;
     }
 
     /// <summary>
@@ -346,39 +415,41 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void DeProject(System.Numerics.Vector2 ScreenPos, out System.Numerics.Vector3 WorldOrigin, out System.Numerics.Vector3 WorldDirection)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DeProject", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreenPos, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        WorldOrigin = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 8);
-        WorldDirection = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 20);
+        var funcManaged = s_DeProjectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DeProject", true);
+        var parms = new DeProject_Params();
+        parms.ScreenPos = ScreenPos;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        WorldOrigin = parms.WorldOrigin;
+        WorldDirection = parms.WorldDirection;
         return;
     }
 
+    static BmSDK.Function s_ProjectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct Project_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Location;
+        [FieldOffset(12)] public System.Numerics.Vector3 ReturnValue;
+    }
+
     /// <summary>
     /// Function: Project
     /// </summary>
     public unsafe virtual System.Numerics.Vector3 Project(System.Numerics.Vector3 Location)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.Project", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Location, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 12);
+        var funcManaged = s_ProjectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.Project", true);
+        var parms = new Project_Params();
+        parms.Location = Location;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_DrawTextRAFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DrawTextRA_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+        [FieldOffset(12)] public int CR;
     }
 
     /// <summary>
@@ -386,256 +457,310 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void DrawTextRA(BmSDK.FString Text, bool CR = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTextRA", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CR, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawTextRAFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTextRA", true);
+        var parms = new DrawTextRA_Params();
+        parms.Text = Text;
+        parms.CR = CR ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct DrawText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+        [FieldOffset(12)] public int CR;
+        [FieldOffset(16)] public float XScale;
+        [FieldOffset(20)] public float YScale;
+        [FieldOffset(24)] public BmSDK.Engine.Canvas.FFontRenderInfo RenderInfo;
+    }
+
     /// <summary>
     /// Function: DrawText
     /// </summary>
     public unsafe virtual void DrawText(BmSDK.FString Text, bool CR, float XScale, float YScale, out BmSDK.Engine.Canvas.FFontRenderInfo RenderInfo)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawText", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CR, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XScale, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(YScale, paramsPtr + 20);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        RenderInfo = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Canvas.FFontRenderInfo>(paramsPtr + 24);
+        var funcManaged = s_DrawTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawText", true);
+        var parms = new DrawText_Params();
+        parms.Text = Text;
+        parms.CR = CR ? 1 : 0;
+        parms.XScale = XScale;
+        parms.YScale = YScale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        RenderInfo = parms.RenderInfo;
         return;
     }
 
+    static BmSDK.Function s_TextSizeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct TextSize_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString String;
+        [FieldOffset(12)] public float XL;
+        [FieldOffset(16)] public float YL;
+    }
+
     /// <summary>
     /// Function: TextSize
     /// </summary>
     public unsafe virtual void TextSize(BmSDK.FString String, out float XL, out float YL)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.TextSize", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(String, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        XL = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 12);
-        YL = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 16);
+        var funcManaged = s_TextSizeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.TextSize", true);
+        var parms = new TextSize_Params();
+        parms.String = String;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        XL = parms.XL;
+        YL = parms.YL;
         return;
     }
 
+    static BmSDK.Function s_StrLenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct StrLen_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString String;
+        [FieldOffset(12)] public float XL;
+        [FieldOffset(16)] public float YL;
+    }
+
     /// <summary>
     /// Function: StrLen
     /// </summary>
     public unsafe virtual void StrLen(BmSDK.FString String, out float XL, out float YL)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.StrLen", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(String, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        XL = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 12);
-        YL = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 16);
+        var funcManaged = s_StrLenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.StrLen", true);
+        var parms = new StrLen_Params();
+        parms.String = String;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        XL = parms.XL;
+        YL = parms.YL;
         return;
     }
 
+    static BmSDK.Function s_DrawTrisFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct DrawTris_Params
+    {
+        [FieldOffset(0)] public nint Tex;
+    }
+
     /// <summary>
     /// Function: DrawTris
     /// </summary>
     public unsafe virtual void DrawTris(BmSDK.Engine.Texture Tex, BmSDK.TArray<BmSDK.Engine.Canvas.FCanvasUVTri> Triangles)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTris", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Tex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Triangles, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawTrisFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTris", true);
+        var parms = new DrawTris_Params();
+        parms.Tex = Tex?.Ptr ?? 0;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(Triangles, (byte*)&parms + 4);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawTileStretchedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct DrawTileStretched_Params
+    {
+        [FieldOffset(0)] public nint Tex;
+        [FieldOffset(4)] public float XL;
+        [FieldOffset(8)] public float YL;
+        [FieldOffset(12)] public float U;
+        [FieldOffset(16)] public float V;
+        [FieldOffset(20)] public float UL;
+        [FieldOffset(24)] public float VL;
+        [FieldOffset(28)] public BmSDK.GameObject.FLinearColor LColor;
+        [FieldOffset(44)] public int bStretchHorizontally;
+        [FieldOffset(48)] public int bStretchVertically;
+        [FieldOffset(52)] public float ScalingFactor;
+    }
+
     /// <summary>
     /// Function: DrawTileStretched
     /// </summary>
     public unsafe virtual void DrawTileStretched(BmSDK.Engine.Texture Tex, float XL, float YL, float U, float V, float UL, float VL, BmSDK.GameObject.FLinearColor LColor = default, bool bStretchHorizontally = default, bool bStretchVertically = default, float ScalingFactor = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTileStretched", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Tex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XL, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(YL, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(U, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UL, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VL, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LColor, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bStretchHorizontally, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bStretchVertically, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScalingFactor, paramsPtr + 52);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawTileStretchedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTileStretched", true);
+        var parms = new DrawTileStretched_Params();
+        parms.Tex = Tex?.Ptr ?? 0;
+        parms.XL = XL;
+        parms.YL = YL;
+        parms.U = U;
+        parms.V = V;
+        parms.UL = UL;
+        parms.VL = VL;
+        parms.LColor = LColor;
+        parms.bStretchHorizontally = bStretchHorizontally ? 1 : 0;
+        parms.bStretchVertically = bStretchVertically ? 1 : 0;
+        parms.ScalingFactor = ScalingFactor;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawRotatedMaterialTileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct DrawRotatedMaterialTile_Params
+    {
+        [FieldOffset(0)] public nint Mat;
+        [FieldOffset(4)] public BmSDK.Rotator Rotation;
+        [FieldOffset(16)] public float XL;
+        [FieldOffset(20)] public float YL;
+        [FieldOffset(24)] public float U;
+        [FieldOffset(28)] public float V;
+        [FieldOffset(32)] public float UL;
+        [FieldOffset(36)] public float VL;
+        [FieldOffset(40)] public float AnchorX;
+        [FieldOffset(44)] public float AnchorY;
+    }
+
     /// <summary>
     /// Function: DrawRotatedMaterialTile
     /// </summary>
     public unsafe virtual void DrawRotatedMaterialTile(BmSDK.Engine.MaterialInterface Mat, BmSDK.Rotator Rotation, float XL, float YL, float U = default, float V = default, float UL = default, float VL = default, float AnchorX = default, float AnchorY = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawRotatedMaterialTile", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Mat, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Rotation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XL, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(YL, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(U, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UL, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VL, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnchorX, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnchorY, paramsPtr + 44);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawRotatedMaterialTileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawRotatedMaterialTile", true);
+        var parms = new DrawRotatedMaterialTile_Params();
+        parms.Mat = Mat?.Ptr ?? 0;
+        parms.Rotation = Rotation;
+        parms.XL = XL;
+        parms.YL = YL;
+        parms.U = U;
+        parms.V = V;
+        parms.UL = UL;
+        parms.VL = VL;
+        parms.AnchorX = AnchorX;
+        parms.AnchorY = AnchorY;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawRotatedTileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct DrawRotatedTile_Params
+    {
+        [FieldOffset(0)] public nint Tex;
+        [FieldOffset(4)] public BmSDK.Rotator Rotation;
+        [FieldOffset(16)] public float XL;
+        [FieldOffset(20)] public float YL;
+        [FieldOffset(24)] public float U;
+        [FieldOffset(28)] public float V;
+        [FieldOffset(32)] public float UL;
+        [FieldOffset(36)] public float VL;
+        [FieldOffset(40)] public float AnchorX;
+        [FieldOffset(44)] public float AnchorY;
+    }
+
     /// <summary>
     /// Function: DrawRotatedTile
     /// </summary>
     public unsafe virtual void DrawRotatedTile(BmSDK.Engine.Texture Tex, BmSDK.Rotator Rotation, float XL, float YL, float U, float V, float UL, float VL, float AnchorX = default, float AnchorY = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawRotatedTile", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Tex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Rotation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XL, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(YL, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(U, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UL, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VL, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnchorX, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnchorY, paramsPtr + 44);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawRotatedTileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawRotatedTile", true);
+        var parms = new DrawRotatedTile_Params();
+        parms.Tex = Tex?.Ptr ?? 0;
+        parms.Rotation = Rotation;
+        parms.XL = XL;
+        parms.YL = YL;
+        parms.U = U;
+        parms.V = V;
+        parms.UL = UL;
+        parms.VL = VL;
+        parms.AnchorX = AnchorX;
+        parms.AnchorY = AnchorY;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawMaterialTileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct DrawMaterialTile_Params
+    {
+        [FieldOffset(0)] public nint Mat;
+        [FieldOffset(4)] public float XL;
+        [FieldOffset(8)] public float YL;
+        [FieldOffset(12)] public float U;
+        [FieldOffset(16)] public float V;
+        [FieldOffset(20)] public float UL;
+        [FieldOffset(24)] public float VL;
+        [FieldOffset(28)] public int bClipTile;
+    }
+
     /// <summary>
     /// Function: DrawMaterialTile
     /// </summary>
     public unsafe virtual void DrawMaterialTile(BmSDK.Engine.MaterialInterface Mat, float XL, float YL, float U = default, float V = default, float UL = default, float VL = default, bool bClipTile = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawMaterialTile", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Mat, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XL, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(YL, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(U, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UL, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VL, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bClipTile, paramsPtr + 28);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawMaterialTileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawMaterialTile", true);
+        var parms = new DrawMaterialTile_Params();
+        parms.Mat = Mat?.Ptr ?? 0;
+        parms.XL = XL;
+        parms.YL = YL;
+        parms.U = U;
+        parms.V = V;
+        parms.UL = UL;
+        parms.VL = VL;
+        parms.bClipTile = bClipTile ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreOptimizeDrawTilesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct PreOptimizeDrawTiles_Params
+    {
+        [FieldOffset(0)] public int Num;
+        [FieldOffset(4)] public nint Tex;
+        [FieldOffset(8)] public BmSDK.Engine.EngineTypes.EBlendMode Blend;
+    }
+
     /// <summary>
     /// Function: PreOptimizeDrawTiles
     /// </summary>
     public unsafe virtual void PreOptimizeDrawTiles(int Num, BmSDK.Engine.Texture Tex, BmSDK.Engine.EngineTypes.EBlendMode Blend = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.PreOptimizeDrawTiles", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Num, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Tex, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Blend, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PreOptimizeDrawTilesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.PreOptimizeDrawTiles", true);
+        var parms = new PreOptimizeDrawTiles_Params();
+        parms.Num = Num;
+        parms.Tex = Tex?.Ptr ?? 0;
+        parms.Blend = Blend;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawTileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 49)]
+    private struct DrawTile_Params
+    {
+        [FieldOffset(0)] public nint Tex;
+        [FieldOffset(4)] public float XL;
+        [FieldOffset(8)] public float YL;
+        [FieldOffset(12)] public float U;
+        [FieldOffset(16)] public float V;
+        [FieldOffset(20)] public float UL;
+        [FieldOffset(24)] public float VL;
+        [FieldOffset(28)] public BmSDK.GameObject.FLinearColor LColor;
+        [FieldOffset(44)] public int ClipTile;
+        [FieldOffset(48)] public BmSDK.Engine.EngineTypes.EBlendMode Blend;
+    }
+
     /// <summary>
     /// Function: DrawTile
     /// </summary>
     public unsafe virtual void DrawTile(BmSDK.Engine.Texture Tex, float XL, float YL, float U, float V, float UL, float VL, BmSDK.GameObject.FLinearColor LColor = default, bool ClipTile = default, BmSDK.Engine.EngineTypes.EBlendMode Blend = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTile", true);
-        byte* paramsPtr = stackalloc byte[49];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Tex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(XL, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(YL, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(U, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(V, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UL, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VL, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LColor, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClipTile, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Blend, paramsPtr + 48);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawTileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Canvas.DrawTile", true);
+        var parms = new DrawTile_Params();
+        parms.Tex = Tex?.Ptr ?? 0;
+        parms.XL = XL;
+        parms.YL = YL;
+        parms.U = U;
+        parms.V = V;
+        parms.UL = UL;
+        parms.VL = VL;
+        parms.LColor = LColor;
+        parms.ClipTile = ClipTile ? 1 : 0;
+        parms.Blend = Blend;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -657,11 +782,7 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: LineExtent
         /// </summary>
-        public unsafe System.Numerics.Vector2 LineExtent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public System.Numerics.Vector2 LineExtent;
     }
 
     /// <summary>
@@ -673,47 +794,27 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: DrawX
         /// </summary>
-        public unsafe float DrawX
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float DrawX;
 
         /// <summary>
         /// FloatProperty: DrawY
         /// </summary>
-        public unsafe float DrawY
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float DrawY;
 
         /// <summary>
         /// FloatProperty: DrawXL
         /// </summary>
-        public unsafe float DrawXL
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float DrawXL;
 
         /// <summary>
         /// FloatProperty: DrawYL
         /// </summary>
-        public unsafe float DrawYL
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float DrawYL;
 
         /// <summary>
         /// StructProperty: Scaling
         /// </summary>
-        public unsafe System.Numerics.Vector2 Scaling
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector2 Scaling;
 
         /// <summary>
         /// ObjectProperty: DrawFont
@@ -727,20 +828,12 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: SpacingAdjust
         /// </summary>
-        public unsafe System.Numerics.Vector2 SpacingAdjust
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector2 SpacingAdjust;
 
         /// <summary>
         /// FloatProperty: ViewportHeight
         /// </summary>
-        public unsafe float ViewportHeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float ViewportHeight;
     }
 
     /// <summary>
@@ -757,8 +850,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float OrgX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -766,8 +859,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float OrgY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -775,8 +868,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ClipX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -784,8 +877,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ClipY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -793,8 +886,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -802,8 +895,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -811,8 +904,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -820,8 +913,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurYL
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -835,8 +928,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCenter
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1; else *(int*)(Ptr + 84) &= ~1; }
     }
 
     /// <summary>
@@ -844,8 +937,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bNoSmooth
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2; else *(int*)(Ptr + 84) &= ~2; }
     }
 
     /// <summary>
@@ -853,8 +946,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int SizeX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(int*)(Ptr + 88); }
+        set { *(int*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -862,8 +955,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int SizeY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(int*)(Ptr + 92); }
+        set { *(int*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -871,8 +964,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr _Canvas
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(System.IntPtr*)(Ptr + 96); }
+        set { *(System.IntPtr*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -880,8 +973,8 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr SceneView
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(System.IntPtr*)(Ptr + 100); }
+        set { *(System.IntPtr*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -908,56 +1001,32 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: V0_Pos
         /// </summary>
-        public unsafe System.Numerics.Vector2 V0_Pos
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector2 V0_Pos;
 
         /// <summary>
         /// StructProperty: V0_UV
         /// </summary>
-        public unsafe System.Numerics.Vector2 V0_UV
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public System.Numerics.Vector2 V0_UV;
 
         /// <summary>
         /// StructProperty: V1_Pos
         /// </summary>
-        public unsafe System.Numerics.Vector2 V1_Pos
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector2 V1_Pos;
 
         /// <summary>
         /// StructProperty: V1_UV
         /// </summary>
-        public unsafe System.Numerics.Vector2 V1_UV
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public System.Numerics.Vector2 V1_UV;
 
         /// <summary>
         /// StructProperty: V2_Pos
         /// </summary>
-        public unsafe System.Numerics.Vector2 V2_Pos
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public System.Numerics.Vector2 V2_Pos;
 
         /// <summary>
         /// StructProperty: V2_UV
         /// </summary>
-        public unsafe System.Numerics.Vector2 V2_UV
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public System.Numerics.Vector2 V2_UV;
     }
 
     /// <summary>
@@ -966,32 +1035,30 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 40)]
     public partial record struct FFontRenderInfo
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: bClipText
         /// </summary>
-        public unsafe bool bClipText
+        public bool bClipText
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableShadow
         /// </summary>
-        public unsafe bool bEnableShadow
+        public bool bEnableShadow
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: GlowInfo
         /// </summary>
-        public unsafe BmSDK.Engine.Canvas.FDepthFieldGlowInfo GlowInfo
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Canvas.FDepthFieldGlowInfo>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.Engine.Canvas.FDepthFieldGlowInfo GlowInfo;
     }
 
     /// <summary>
@@ -1000,41 +1067,31 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 36)]
     public partial record struct FDepthFieldGlowInfo
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: bEnableGlow
         /// </summary>
-        public unsafe bool bEnableGlow
+        public bool bEnableGlow
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: GlowColor
         /// </summary>
-        public unsafe BmSDK.GameObject.FLinearColor GlowColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FLinearColor>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.GameObject.FLinearColor GlowColor;
 
         /// <summary>
         /// StructProperty: GlowOuterRadius
         /// </summary>
-        public unsafe System.Numerics.Vector2 GlowOuterRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public System.Numerics.Vector2 GlowOuterRadius;
 
         /// <summary>
         /// StructProperty: GlowInnerRadius
         /// </summary>
-        public unsafe System.Numerics.Vector2 GlowInnerRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector2 GlowInnerRadius;
     }
 
     /// <summary>
@@ -1055,37 +1112,21 @@ public partial class Canvas : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: U
         /// </summary>
-        public unsafe float U
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float U;
 
         /// <summary>
         /// FloatProperty: V
         /// </summary>
-        public unsafe float V
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float V;
 
         /// <summary>
         /// FloatProperty: UL
         /// </summary>
-        public unsafe float UL
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float UL;
 
         /// <summary>
         /// FloatProperty: VL
         /// </summary>
-        public unsafe float VL
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float VL;
     }
 }
@@ -78,7 +78,7 @@ public partial class CodecMovie : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float PlaybackDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(float*)(Ptr + 44); }
+        set { *(float*)(Ptr + 44) = value; }
     }
 }
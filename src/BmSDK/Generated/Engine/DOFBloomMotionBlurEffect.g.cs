@@ -83,8 +83,8 @@ public partial class DOFBloomMotionBlurEffect : BmSDK.Engine.DOFAndBloomEffect,
     /// </summary>
     public unsafe float MaxVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class DOFBloomMotionBlurEffect : BmSDK.Engine.DOFAndBloomEffect,
     /// </summary>
     public unsafe float MotionBlurAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class DOFBloomMotionBlurEffect : BmSDK.Engine.DOFAndBloomEffect,
     /// </summary>
     public unsafe bool FullMotionBlur
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 168) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 168); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 168); }
+        get { return (*(int*)(Ptr + 168) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 168) |= 1; else *(int*)(Ptr + 168) &= ~1; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class DOFBloomMotionBlurEffect : BmSDK.Engine.DOFAndBloomEffect,
     /// </summary>
     public unsafe float CameraRotationThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 172); }
+        get { return *(float*)(Ptr + 172); }
+        set { *(float*)(Ptr + 172) = value; }
     }
 
     /// <summary>
@@ -119,7 +119,7 @@ public partial class DOFBloomMotionBlurEffect : BmSDK.Engine.DOFAndBloomEffect,
     /// </summary>
     public unsafe float CameraTranslationThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(float*)(Ptr + 176); }
+        set { *(float*)(Ptr + 176) = value; }
     }
 }
@@ -78,19 +78,31 @@ public partial class DebugCameraInput : BmSDK.Engine.PlayerInput, BmSDK.IGameObj
         where TComponent : class, Framework.IScriptComponent<DebugCameraInput>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_InputKeyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct InputKey_Params
+    {
+        [FieldOffset(0)] public int ControllerId;
+        [FieldOffset(4)] public BmSDK.FName Key;
+        [FieldOffset(12)] public BmSDK.GameObject.EInputEvent Event;
+        [FieldOffset(16)] public float AmountDepressed;
+        [FieldOffset(20)] public int bGamepad;
+        [FieldOffset(24)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: InputKey
     /// </summary>
     public unsafe virtual bool InputKey(int ControllerId, BmSDK.FName Key, BmSDK.GameObject.EInputEvent Event, float AmountDepressed = default, bool bGamepad = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DebugCameraInput.InputKey", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ControllerId, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Key, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Event, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AmountDepressed, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bGamepad, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_InputKeyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DebugCameraInput.InputKey", true);
+        var parms = new InputKey_Params();
+        parms.ControllerId = ControllerId;
+        parms.Key = Key;
+        parms.Event = Event;
+        parms.AmountDepressed = AmountDepressed;
+        parms.bGamepad = bGamepad ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 }
@@ -78,25 +78,37 @@ public partial class DirectionalLightComponent : BmSDK.Engine.LightComponent, Bm
         where TComponent : class, Framework.IScriptComponent<DirectionalLightComponent>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_OnUpdatePropertyBrightnessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnUpdatePropertyBrightness_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnUpdatePropertyBrightness
     /// </summary>
     public unsafe override void OnUpdatePropertyBrightness()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DirectionalLightComponent.OnUpdatePropertyBrightness", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnUpdatePropertyBrightnessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DirectionalLightComponent.OnUpdatePropertyBrightness", true);
+        var parms = new OnUpdatePropertyBrightness_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnUpdatePropertyLightColorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnUpdatePropertyLightColor_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnUpdatePropertyLightColor
     /// </summary>
     public unsafe override void OnUpdatePropertyLightColor()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DirectionalLightComponent.OnUpdatePropertyLightColor", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnUpdatePropertyLightColorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DirectionalLightComponent.OnUpdatePropertyLightColor", true);
+        var parms = new OnUpdatePropertyLightColor_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -105,8 +117,8 @@ public partial class DirectionalLightComponent : BmSDK.Engine.LightComponent, Bm
     /// </summary>
     public unsafe float TraceDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(float*)(Ptr + 408); }
+        set { *(float*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -114,8 +126,8 @@ public partial class DirectionalLightComponent : BmSDK.Engine.LightComponent, Bm
     /// </summary>
     public unsafe float WholeSceneDynamicShadowRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(float*)(Ptr + 412); }
+        set { *(float*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -123,8 +135,8 @@ public partial class DirectionalLightComponent : BmSDK.Engine.LightComponent, Bm
     /// </summary>
     public unsafe int NumWholeSceneDynamicShadowCascades
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(int*)(Ptr + 416); }
+        set { *(int*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -132,7 +144,7 @@ public partial class DirectionalLightComponent : BmSDK.Engine.LightComponent, Bm
     /// </summary>
     public unsafe float CascadeDistributionExponent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(float*)(Ptr + 420); }
+        set { *(float*)(Ptr + 420) = value; }
     }
 }
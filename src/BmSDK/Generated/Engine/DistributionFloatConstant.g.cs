@@ -83,7 +83,7 @@ public partial class DistributionFloatConstant : BmSDK.DistributionFloat, BmSDK.
     /// </summary>
     public unsafe float Constant
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 }
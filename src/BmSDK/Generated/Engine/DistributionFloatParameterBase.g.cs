@@ -89,8 +89,8 @@ public partial class DistributionFloatParameterBase : BmSDK.Engine.DistributionF
     /// </summary>
     public unsafe BmSDK.FName ParameterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(BmSDK.FName*)(Ptr + 68); }
+        set { *(BmSDK.FName*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class DistributionFloatParameterBase : BmSDK.Engine.DistributionF
     /// </summary>
     public unsafe float MinInput
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class DistributionFloatParameterBase : BmSDK.Engine.DistributionF
     /// </summary>
     public unsafe float MaxInput
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class DistributionFloatParameterBase : BmSDK.Engine.DistributionF
     /// </summary>
     public unsafe float MinOutput
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -125,8 +125,8 @@ public partial class DistributionFloatParameterBase : BmSDK.Engine.DistributionF
     /// </summary>
     public unsafe float MaxOutput
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -134,7 +134,7 @@ public partial class DistributionFloatParameterBase : BmSDK.Engine.DistributionF
     /// </summary>
     public unsafe BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode ParamMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode*)(Ptr + 92); }
+        set { *(BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode*)(Ptr + 92) = value; }
     }
 }
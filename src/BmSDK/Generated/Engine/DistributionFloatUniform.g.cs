@@ -83,8 +83,8 @@ public partial class DistributionFloatUniform : BmSDK.DistributionFloat, BmSDK.I
     /// </summary>
     public unsafe float Min
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(float*)(Ptr + 64); }
+        set { *(float*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class DistributionFloatUniform : BmSDK.DistributionFloat, BmSDK.I
     /// </summary>
     public unsafe float Max
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 }
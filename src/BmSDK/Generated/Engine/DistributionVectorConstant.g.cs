@@ -89,8 +89,8 @@ public partial class DistributionVectorConstant : BmSDK.DistributionVector, BmSD
     /// </summary>
     public unsafe bool bLockAxes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }
+        get { return (*(int*)(Ptr + 76) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 76) |= 1; else *(int*)(Ptr + 76) &= ~1; }
     }
 
     /// <summary>
@@ -98,7 +98,7 @@ public partial class DistributionVectorConstant : BmSDK.DistributionVector, BmSD
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorLockFlags LockedAxes
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorLockFlags>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 80); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 80) = value; }
     }
 }
@@ -89,8 +89,8 @@ public partial class DistributionVectorConstantCurve : BmSDK.DistributionVector,
     /// </summary>
     public unsafe bool bLockAxes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 1; else *(int*)(Ptr + 80) &= ~1; }
     }
 
     /// <summary>
@@ -98,7 +98,7 @@ public partial class DistributionVectorConstantCurve : BmSDK.DistributionVector,
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorLockFlags LockedAxes
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorLockFlags>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 84); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 84) = value; }
     }
 }
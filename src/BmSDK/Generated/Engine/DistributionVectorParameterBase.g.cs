@@ -78,8 +78,8 @@ public partial class DistributionVectorParameterBase : BmSDK.Engine.Distribution
     /// </summary>
     public unsafe BmSDK.FName ParameterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(BmSDK.FName*)(Ptr + 84); }
+        set { *(BmSDK.FName*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -116,23 +116,23 @@ public partial class DistributionVectorParameterBase : BmSDK.Engine.Distribution
     /// </summary>
     public unsafe BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode ParamModes_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode*)(Ptr + 140); }
+        set { *(BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode*)(Ptr + 140) = value; }
     }
     /// <summary>
     /// ByteProperty: ParamModes
     /// </summary>
     public unsafe BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode ParamModes_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode>(Ptr + 141); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 141); }
+        get { return *(BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode*)(Ptr + 141); }
+        set { *(BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode*)(Ptr + 141) = value; }
     }
     /// <summary>
     /// ByteProperty: ParamModes
     /// </summary>
     public unsafe BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode ParamModes_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode>(Ptr + 142); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 142); }
+        get { return *(BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode*)(Ptr + 142); }
+        set { *(BmSDK.Engine.DistributionFloatParameterBase.DistributionParamMode*)(Ptr + 142) = value; }
     }
 }
@@ -95,8 +95,8 @@ public partial class DistributionVectorUniform : BmSDK.DistributionVector, BmSDK
     /// </summary>
     public unsafe bool bLockAxes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 1; else *(int*)(Ptr + 88) &= ~1; }
     }
 
     /// <summary>
@@ -104,8 +104,8 @@ public partial class DistributionVectorUniform : BmSDK.DistributionVector, BmSDK
     /// </summary>
     public unsafe bool bUseExtremes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 88); }
+        get { return (*(int*)(Ptr + 88) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 88) |= 2; else *(int*)(Ptr + 88) &= ~2; }
     }
 
     /// <summary>
@@ -113,8 +113,8 @@ public partial class DistributionVectorUniform : BmSDK.DistributionVector, BmSDK
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorLockFlags LockedAxes
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorLockFlags>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 92); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -127,23 +127,23 @@ public partial class DistributionVectorUniform : BmSDK.DistributionVector, BmSDK
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorMirrorFlags MirrorFlags_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorMirrorFlags>(Ptr + 93); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 93); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 93); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 93) = value; }
     }
     /// <summary>
     /// ByteProperty: MirrorFlags
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorMirrorFlags MirrorFlags_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorMirrorFlags>(Ptr + 94); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 94); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 94); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 94) = value; }
     }
     /// <summary>
     /// ByteProperty: MirrorFlags
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorMirrorFlags MirrorFlags_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorMirrorFlags>(Ptr + 95); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 95); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 95); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 95) = value; }
     }
 }
@@ -89,8 +89,8 @@ public partial class DistributionVectorUniformCurve : BmSDK.DistributionVector,
     /// </summary>
     public unsafe bool bLockAxes1
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 1; else *(int*)(Ptr + 80) &= ~1; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class DistributionVectorUniformCurve : BmSDK.DistributionVector,
     /// </summary>
     public unsafe bool bLockAxes2
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 2; else *(int*)(Ptr + 80) &= ~2; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class DistributionVectorUniformCurve : BmSDK.DistributionVector,
     /// </summary>
     public unsafe bool bUseExtremes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 4; else *(int*)(Ptr + 80) &= ~4; }
     }
 
     /// <summary>
@@ -121,16 +121,16 @@ public partial class DistributionVectorUniformCurve : BmSDK.DistributionVector,
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorLockFlags LockedAxes_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorLockFlags>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 84); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 84) = value; }
     }
     /// <summary>
     /// ByteProperty: LockedAxes
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorLockFlags LockedAxes_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorLockFlags>(Ptr + 85); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 85); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 85); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorLockFlags*)(Ptr + 85) = value; }
     }
 
     /// <summary>
@@ -143,23 +143,23 @@ public partial class DistributionVectorUniformCurve : BmSDK.DistributionVector,
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorMirrorFlags MirrorFlags_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorMirrorFlags>(Ptr + 86); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 86); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 86); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 86) = value; }
     }
     /// <summary>
     /// ByteProperty: MirrorFlags
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorMirrorFlags MirrorFlags_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorMirrorFlags>(Ptr + 87); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 87); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 87); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 87) = value; }
     }
     /// <summary>
     /// ByteProperty: MirrorFlags
     /// </summary>
     public unsafe BmSDK.DistributionVector.EDistributionVectorMirrorFlags MirrorFlags_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.EDistributionVectorMirrorFlags>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 88); }
+        set { *(BmSDK.DistributionVector.EDistributionVectorMirrorFlags*)(Ptr + 88) = value; }
     }
 }
@@ -89,8 +89,8 @@ public partial class DrawFrustumComponent : BmSDK.Engine.PrimitiveComponent, BmS
     /// </summary>
     public unsafe float FrustumAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(float*)(Ptr + 408); }
+        set { *(float*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class DrawFrustumComponent : BmSDK.Engine.PrimitiveComponent, BmS
     /// </summary>
     public unsafe float FrustumAspectRatio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(float*)(Ptr + 412); }
+        set { *(float*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class DrawFrustumComponent : BmSDK.Engine.PrimitiveComponent, BmS
     /// </summary>
     public unsafe float FrustumStartDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(float*)(Ptr + 416); }
+        set { *(float*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class DrawFrustumComponent : BmSDK.Engine.PrimitiveComponent, BmS
     /// </summary>
     public unsafe float FrustumEndDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(float*)(Ptr + 420); }
+        set { *(float*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class DrawSphereComponent : BmSDK.Engine.PrimitiveComponent, BmSD
     /// </summary>
     public unsafe float SphereRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(float*)(Ptr + 412); }
+        set { *(float*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class DrawSphereComponent : BmSDK.Engine.PrimitiveComponent, BmSD
     /// </summary>
     public unsafe int SphereSides
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(int*)(Ptr + 416); }
+        set { *(int*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class DrawSphereComponent : BmSDK.Engine.PrimitiveComponent, BmSD
     /// </summary>
     public unsafe bool bDrawWireSphere
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 420) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 420); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 420); }
+        get { return (*(int*)(Ptr + 420) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 420) |= 1; else *(int*)(Ptr + 420) &= ~1; }
     }
 
     /// <summary>
@@ -125,8 +125,8 @@ public partial class DrawSphereComponent : BmSDK.Engine.PrimitiveComponent, BmSD
     /// </summary>
     public unsafe bool bDrawLitSphere
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 420) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 420); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 420); }
+        get { return (*(int*)(Ptr + 420) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 420) |= 2; else *(int*)(Ptr + 420) &= ~2; }
     }
 
     /// <summary>
@@ -134,7 +134,7 @@ public partial class DrawSphereComponent : BmSDK.Engine.PrimitiveComponent, BmSD
     /// </summary>
     public unsafe bool bDrawOnlyIfSelected
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 420) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 420); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 420); }
+        get { return (*(int*)(Ptr + 420) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 420) |= 4; else *(int*)(Ptr + 420) &= ~4; }
     }
 }
@@ -78,22 +78,28 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
         where TComponent : class, Framework.IScriptComponent<DynamicLightEnvironmentComponent>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetOwnerBoundsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetOwnerBounds_Params
+    {
+        [FieldOffset(0)] public BmSDK.GameObject.FBoxSphereBounds ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetOwnerBounds
     /// </summary>
     public unsafe virtual BmSDK.GameObject.FBoxSphereBounds GetOwnerBounds()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DynamicLightEnvironmentComponent.GetOwnerBounds", true);
-        byte* paramsPtr = stackalloc byte[28];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FBoxSphereBounds>(paramsPtr + 0);
+        var funcManaged = s_GetOwnerBoundsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DynamicLightEnvironmentComponent.GetOwnerBounds", true);
+        var parms = new GetOwnerBounds_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ResetEnvironmentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetEnvironment_Params
+    {
     }
 
     /// <summary>
@@ -101,16 +107,9 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe virtual void ResetEnvironment()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DynamicLightEnvironmentComponent.ResetEnvironment", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ResetEnvironmentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.DynamicLightEnvironmentComponent.ResetEnvironment", true);
+        var parms = new ResetEnvironment_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -130,8 +129,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe System.IntPtr State
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(System.IntPtr*)(Ptr + 96); }
+        set { *(System.IntPtr*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -139,8 +138,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float InvisibleUpdateTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -148,8 +147,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float MinTimeBetweenFullUpdates
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -157,8 +156,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float ShadowInterpolationSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(float*)(Ptr + 108); }
+        set { *(float*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -166,8 +165,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe int NumVolumeVisibilitySamples
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(int*)(Ptr + 112); }
+        set { *(int*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -175,8 +174,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float LightingBoundsScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(float*)(Ptr + 116); }
+        set { *(float*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -202,8 +201,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float LightDesaturation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 
     /// <summary>
@@ -211,8 +210,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float LightDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }
+        get { return *(float*)(Ptr + 168); }
+        set { *(float*)(Ptr + 168) = value; }
     }
 
     /// <summary>
@@ -220,8 +219,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float ShadowDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 172); }
+        get { return *(float*)(Ptr + 172); }
+        set { *(float*)(Ptr + 172) = value; }
     }
 
     /// <summary>
@@ -229,8 +228,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bCastShadows
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 1; else *(int*)(Ptr + 176) &= ~1; }
     }
 
     /// <summary>
@@ -238,8 +237,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bCompositeShadowsFromDynamicLights
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 2; else *(int*)(Ptr + 176) &= ~2; }
     }
 
     /// <summary>
@@ -247,8 +246,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bForceCompositeAllLights
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 4; else *(int*)(Ptr + 176) &= ~4; }
     }
 
     /// <summary>
@@ -256,8 +255,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bAffectedBySmallDynamicLights
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 8; else *(int*)(Ptr + 176) &= ~8; }
     }
 
     /// <summary>
@@ -265,8 +264,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bUseBooleanEnvironmentShadowing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 16; else *(int*)(Ptr + 176) &= ~16; }
     }
 
     /// <summary>
@@ -274,8 +273,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bShadowFromEnvironment
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 32; else *(int*)(Ptr + 176) &= ~32; }
     }
 
     /// <summary>
@@ -283,8 +282,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bDynamic
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 64; else *(int*)(Ptr + 176) &= ~64; }
     }
 
     /// <summary>
@@ -292,8 +291,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bSynthesizeDirectionalLight
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 128; else *(int*)(Ptr + 176) &= ~128; }
     }
 
     /// <summary>
@@ -301,8 +300,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bSynthesizeSHLight
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 256; else *(int*)(Ptr + 176) &= ~256; }
     }
 
     /// <summary>
@@ -310,8 +309,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bForceAllowLightEnvSphericalHarmonicLights
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 512; else *(int*)(Ptr + 176) &= ~512; }
     }
 
     /// <summary>
@@ -319,8 +318,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bRequiresNonLatentUpdates
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 1024; else *(int*)(Ptr + 176) &= ~1024; }
     }
 
     /// <summary>
@@ -328,8 +327,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bTraceFromClosestBoundsPoint
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 2048; else *(int*)(Ptr + 176) &= ~2048; }
     }
 
     /// <summary>
@@ -337,8 +336,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bIsCharacterLightEnvironment
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 4096; else *(int*)(Ptr + 176) &= ~4096; }
     }
 
     /// <summary>
@@ -346,8 +345,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bOverrideOwnerLightingChannels
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 8192; else *(int*)(Ptr + 176) &= ~8192; }
     }
 
     /// <summary>
@@ -355,8 +354,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool RestrictInterpolationWhenSlow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 16384; else *(int*)(Ptr + 176) &= ~16384; }
     }
 
     /// <summary>
@@ -364,8 +363,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bIsPlayerCharacterLightEnvironment
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 32768; else *(int*)(Ptr + 176) &= ~32768; }
     }
 
     /// <summary>
@@ -373,8 +372,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bScaleShadowDistanceWhenAboveCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 65536; else *(int*)(Ptr + 176) &= ~65536; }
     }
 
     /// <summary>
@@ -382,8 +381,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool bRecieveStaticModulatedShadows
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 131072; else *(int*)(Ptr + 176) &= ~131072; }
     }
 
     /// <summary>
@@ -391,8 +390,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe bool WaitingForDeferredReset
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 176); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 176); }
+        get { return (*(int*)(Ptr + 176) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 176) |= 262144; else *(int*)(Ptr + 176) &= ~262144; }
     }
 
     /// <summary>
@@ -400,8 +399,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float ModShadowFadeoutTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(float*)(Ptr + 180); }
+        set { *(float*)(Ptr + 180) = value; }
     }
 
     /// <summary>
@@ -409,8 +408,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float ModShadowFadeoutExponent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(float*)(Ptr + 184); }
+        set { *(float*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -424,8 +423,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float DominantShadowTransitionStartDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(float*)(Ptr + 204); }
+        set { *(float*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -433,8 +432,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float DominantShadowTransitionEndDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(float*)(Ptr + 208); }
+        set { *(float*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -442,8 +441,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe int MinShadowResolution
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(int*)(Ptr + 212); }
+        set { *(int*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -451,8 +450,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe int MaxShadowResolution
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(int*)(Ptr + 216); }
+        set { *(int*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -460,8 +459,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe int ShadowFadeResolution
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(int*)(Ptr + 220); }
+        set { *(int*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -469,8 +468,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe BmSDK.Engine.LightComponent.EShadowFilterQuality ShadowFilterQuality
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.LightComponent.EShadowFilterQuality>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(BmSDK.Engine.LightComponent.EShadowFilterQuality*)(Ptr + 224); }
+        set { *(BmSDK.Engine.LightComponent.EShadowFilterQuality*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -478,8 +477,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe BmSDK.Engine.LightComponent.ELightShadowMode LightShadowMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.LightComponent.ELightShadowMode>(Ptr + 225); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 225); }
+        get { return *(BmSDK.Engine.LightComponent.ELightShadowMode*)(Ptr + 225); }
+        set { *(BmSDK.Engine.LightComponent.ELightShadowMode*)(Ptr + 225) = value; }
     }
 
     /// <summary>
@@ -487,8 +486,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe BmSDK.Engine.DynamicLightEnvironmentComponent.EDynamicLightEnvironmentBoundsMethod BoundsMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.DynamicLightEnvironmentComponent.EDynamicLightEnvironmentBoundsMethod>(Ptr + 226); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 226); }
+        get { return *(BmSDK.Engine.DynamicLightEnvironmentComponent.EDynamicLightEnvironmentBoundsMethod*)(Ptr + 226); }
+        set { *(BmSDK.Engine.DynamicLightEnvironmentComponent.EDynamicLightEnvironmentBoundsMethod*)(Ptr + 226) = value; }
     }
 
     /// <summary>
@@ -496,8 +495,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float ShadowFalloffExponent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -505,8 +504,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float BouncedLightingFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(float*)(Ptr + 232); }
+        set { *(float*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -514,8 +513,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe float MinShadowAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(float*)(Ptr + 236); }
+        set { *(float*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -544,8 +543,8 @@ public partial class DynamicLightEnvironmentComponent : BmSDK.Engine.LightEnviro
     /// </summary>
     public unsafe int StaticLightingTimestamp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }
+        get { return *(int*)(Ptr + 284); }
+        set { *(int*)(Ptr + 284) = value; }
     }
 
     /// <summary>
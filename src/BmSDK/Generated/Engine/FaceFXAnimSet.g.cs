@@ -92,8 +92,8 @@ public partial class FaceFXAnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr InternalFaceFXAnimSet
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(System.IntPtr*)(Ptr + 48); }
+        set { *(System.IntPtr*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -128,7 +128,7 @@ public partial class FaceFXAnimSet : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumLoadErrors
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(int*)(Ptr + 88); }
+        set { *(int*)(Ptr + 88) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe bool bActive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 404) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 404); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 404); }
+        get { return (*(int*)(Ptr + 404) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 404) |= 1; else *(int*)(Ptr + 404) &= ~1; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe bool RaindropFillEntireFluid
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 404) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 404); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 404); }
+        get { return (*(int*)(Ptr + 404) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 404) |= 2; else *(int*)(Ptr + 404) &= ~2; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe bool bIsToggleTriggered
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 404) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 404); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 404); }
+        get { return (*(int*)(Ptr + 404) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 404) |= 4; else *(int*)(Ptr + 404) &= ~4; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe BmSDK.Engine.FluidInfluenceComponent.EInfluenceType InfluenceType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.FluidInfluenceComponent.EInfluenceType>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(BmSDK.Engine.FluidInfluenceComponent.EInfluenceType*)(Ptr + 412); }
+        set { *(BmSDK.Engine.FluidInfluenceComponent.EInfluenceType*)(Ptr + 412) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float MaxDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 416); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 416); }
+        get { return *(float*)(Ptr + 416); }
+        set { *(float*)(Ptr + 416) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float WaveStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 420); }
+        get { return *(float*)(Ptr + 420); }
+        set { *(float*)(Ptr + 420) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float WaveFrequency
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(float*)(Ptr + 424); }
+        set { *(float*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float WavePhase
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float WaveRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(float*)(Ptr + 432); }
+        set { *(float*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float RaindropAreaRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(float*)(Ptr + 436); }
+        set { *(float*)(Ptr + 436) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float RaindropRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 440); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 440); }
+        get { return *(float*)(Ptr + 440); }
+        set { *(float*)(Ptr + 440) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float RaindropStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(float*)(Ptr + 444); }
+        set { *(float*)(Ptr + 444) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float RaindropRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(float*)(Ptr + 448); }
+        set { *(float*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float FlowSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(float*)(Ptr + 452); }
+        set { *(float*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe int FlowNumRipples
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(int*)(Ptr + 456); }
+        set { *(int*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -227,8 +227,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float FlowSideMotionRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(float*)(Ptr + 460); }
+        set { *(float*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -236,8 +236,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float FlowWaveRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 464); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 464); }
+        get { return *(float*)(Ptr + 464); }
+        set { *(float*)(Ptr + 464) = value; }
     }
 
     /// <summary>
@@ -245,8 +245,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float FlowStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(float*)(Ptr + 468); }
+        set { *(float*)(Ptr + 468) = value; }
     }
 
     /// <summary>
@@ -254,8 +254,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float FlowFrequency
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(float*)(Ptr + 472); }
+        set { *(float*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -263,8 +263,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float SphereOuterRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(float*)(Ptr + 476); }
+        set { *(float*)(Ptr + 476) = value; }
     }
 
     /// <summary>
@@ -272,8 +272,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float SphereInnerRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(float*)(Ptr + 480); }
+        set { *(float*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -281,8 +281,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float SphereStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(float*)(Ptr + 484); }
+        set { *(float*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -290,8 +290,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float CurrentAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(float*)(Ptr + 488); }
+        set { *(float*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -299,8 +299,8 @@ public partial class FluidInfluenceComponent : BmSDK.Engine.PrimitiveComponent,
     /// </summary>
     public unsafe float CurrentTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(float*)(Ptr + 492); }
+        set { *(float*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class FogVolumeSphericalDensityComponent : BmSDK.Engine.FogVolume
     /// </summary>
     public unsafe float MaxDensity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(float*)(Ptr + 132); }
+        set { *(float*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class FogVolumeSphericalDensityComponent : BmSDK.Engine.FogVolume
     /// </summary>
     public unsafe bool bTreatAsCheapLight
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }
+        get { return (*(int*)(Ptr + 136) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 136) |= 1; else *(int*)(Ptr + 136) &= ~1; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class FogVolumeSphericalDensityComponent : BmSDK.Engine.FogVolume
     /// </summary>
     public unsafe float SphereRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(float*)(Ptr + 152); }
+        set { *(float*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -90,6 +90,12 @@ public partial class FontImportOptions : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 148)]
     public partial record struct FFontImportOptionsData
     {
+        [FieldOffset(16)] private int _bitfield16;
+        [FieldOffset(72)] private int _bitfield72;
+        [FieldOffset(92)] private int _bitfield92;
+        [FieldOffset(128)] private int _bitfield128;
+        [FieldOffset(136)] private int _bitfield136;
+
         /// <summary>
         /// StrProperty: FontName
         /// </summary>
@@ -102,65 +108,57 @@ public partial class FontImportOptions : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: Height
         /// </summary>
-        public unsafe float Height
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float Height;
 
         /// <summary>
         /// BoolProperty: bEnableAntialiasing
         /// </summary>
-        public unsafe bool bEnableAntialiasing
+        public bool bEnableAntialiasing
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 1) != 0;
+            set { if (value) _bitfield16 |= 1; else _bitfield16 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableBold
         /// </summary>
-        public unsafe bool bEnableBold
+        public bool bEnableBold
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 2) != 0;
+            set { if (value) _bitfield16 |= 2; else _bitfield16 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableItalic
         /// </summary>
-        public unsafe bool bEnableItalic
+        public bool bEnableItalic
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 4) != 0;
+            set { if (value) _bitfield16 |= 4; else _bitfield16 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableUnderline
         /// </summary>
-        public unsafe bool bEnableUnderline
+        public bool bEnableUnderline
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 8) != 0;
+            set { if (value) _bitfield16 |= 8; else _bitfield16 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bAlphaOnly
         /// </summary>
-        public unsafe bool bAlphaOnly
+        public bool bAlphaOnly
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 16); }; }
+            readonly get => (_bitfield16 & 16) != 0;
+            set { if (value) _bitfield16 |= 16; else _bitfield16 &= ~16; }
         }
 
         /// <summary>
         /// ByteProperty: CharacterSet
         /// </summary>
-        public unsafe BmSDK.Engine.FontImportOptions.EFontImportCharacterSet CharacterSet
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.FontImportOptions.EFontImportCharacterSet>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public BmSDK.Engine.FontImportOptions.EFontImportCharacterSet CharacterSet;
 
         /// <summary>
         /// StrProperty: Chars
@@ -201,155 +199,107 @@ public partial class FontImportOptions : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: bCreatePrintableOnly
         /// </summary>
-        public unsafe bool bCreatePrintableOnly
+        public bool bCreatePrintableOnly
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }; }
+            readonly get => (_bitfield72 & 1) != 0;
+            set { if (value) _bitfield72 |= 1; else _bitfield72 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bIncludeASCIIRange
         /// </summary>
-        public unsafe bool bIncludeASCIIRange
+        public bool bIncludeASCIIRange
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }; }
+            readonly get => (_bitfield72 & 2) != 0;
+            set { if (value) _bitfield72 |= 2; else _bitfield72 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: ForegroundColor
         /// </summary>
-        public unsafe BmSDK.GameObject.FLinearColor ForegroundColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FLinearColor>(Ptr + 76); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }; }
-        }
+        [FieldOffset(76)] public BmSDK.GameObject.FLinearColor ForegroundColor;
 
         /// <summary>
         /// BoolProperty: bEnableDropShadow
         /// </summary>
-        public unsafe bool bEnableDropShadow
+        public bool bEnableDropShadow
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }; }
+            readonly get => (_bitfield92 & 1) != 0;
+            set { if (value) _bitfield92 |= 1; else _bitfield92 &= ~1; }
         }
 
         /// <summary>
         /// IntProperty: TexturePageWidth
         /// </summary>
-        public unsafe int TexturePageWidth
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public int TexturePageWidth;
 
         /// <summary>
         /// IntProperty: TexturePageMaxHeight
         /// </summary>
-        public unsafe int TexturePageMaxHeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }; }
-        }
+        [FieldOffset(100)] public int TexturePageMaxHeight;
 
         /// <summary>
         /// IntProperty: XPadding
         /// </summary>
-        public unsafe int XPadding
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }; }
-        }
+        [FieldOffset(104)] public int XPadding;
 
         /// <summary>
         /// IntProperty: YPadding
         /// </summary>
-        public unsafe int YPadding
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }; }
-        }
+        [FieldOffset(108)] public int YPadding;
 
         /// <summary>
         /// IntProperty: ExtendBoxTop
         /// </summary>
-        public unsafe int ExtendBoxTop
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }; }
-        }
+        [FieldOffset(112)] public int ExtendBoxTop;
 
         /// <summary>
         /// IntProperty: ExtendBoxBottom
         /// </summary>
-        public unsafe int ExtendBoxBottom
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }; }
-        }
+        [FieldOffset(116)] public int ExtendBoxBottom;
 
         /// <summary>
         /// IntProperty: ExtendBoxRight
         /// </summary>
-        public unsafe int ExtendBoxRight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }; }
-        }
+        [FieldOffset(120)] public int ExtendBoxRight;
 
         /// <summary>
         /// IntProperty: ExtendBoxLeft
         /// </summary>
-        public unsafe int ExtendBoxLeft
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }; }
-        }
+        [FieldOffset(124)] public int ExtendBoxLeft;
 
         /// <summary>
         /// BoolProperty: bEnableLegacyMode
         /// </summary>
-        public unsafe bool bEnableLegacyMode
+        public bool bEnableLegacyMode
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 128); }; }
+            readonly get => (_bitfield128 & 1) != 0;
+            set { if (value) _bitfield128 |= 1; else _bitfield128 &= ~1; }
         }
 
         /// <summary>
         /// IntProperty: Kerning
         /// </summary>
-        public unsafe int Kerning
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }; }
-        }
+        [FieldOffset(132)] public int Kerning;
 
         /// <summary>
         /// BoolProperty: bUseDistanceFieldAlpha
         /// </summary>
-        public unsafe bool bUseDistanceFieldAlpha
+        public bool bUseDistanceFieldAlpha
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 136); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 136); }; }
+            readonly get => (_bitfield136 & 1) != 0;
+            set { if (value) _bitfield136 |= 1; else _bitfield136 &= ~1; }
         }
 
         /// <summary>
         /// IntProperty: DistanceFieldScaleFactor
         /// </summary>
-        public unsafe int DistanceFieldScaleFactor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }; }
-        }
+        [FieldOffset(140)] public int DistanceFieldScaleFactor;
 
         /// <summary>
         /// FloatProperty: DistanceFieldScanRadiusScale
         /// </summary>
-        public unsafe float DistanceFieldScanRadiusScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }; }
-        }
+        [FieldOffset(144)] public float DistanceFieldScanRadiusScale;
     }
 
     /// <summary>
@@ -73,47 +73,62 @@ public partial class ForceFeedbackManager : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<ForceFeedbackManager>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PlayForceFeedbackWaveformFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PlayForceFeedbackWaveform_Params
+    {
+        [FieldOffset(0)] public nint WaveForm;
+        [FieldOffset(4)] public nint WaveInstigator;
+    }
+
     /// <summary>
     /// Function: PlayForceFeedbackWaveform
     /// </summary>
     public unsafe virtual void PlayForceFeedbackWaveform(BmSDK.Engine.ForceFeedbackWaveform WaveForm, BmSDK.Engine.Actor WaveInstigator)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFeedbackManager.PlayForceFeedbackWaveform", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WaveForm, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WaveInstigator, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PlayForceFeedbackWaveformFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFeedbackManager.PlayForceFeedbackWaveform", true);
+        var parms = new PlayForceFeedbackWaveform_Params();
+        parms.WaveForm = WaveForm?.Ptr ?? 0;
+        parms.WaveInstigator = WaveInstigator?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PauseWaveformFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PauseWaveform_Params
+    {
+        [FieldOffset(0)] public int bPause;
+    }
+
     /// <summary>
     /// Function: PauseWaveform
     /// </summary>
     public unsafe virtual void PauseWaveform(bool bPause = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFeedbackManager.PauseWaveform", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPause, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PauseWaveformFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFeedbackManager.PauseWaveform", true);
+        var parms = new PauseWaveform_Params();
+        parms.bPause = bPause ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopForceFeedbackWaveformFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StopForceFeedbackWaveform_Params
+    {
+        [FieldOffset(0)] public nint WaveForm;
+    }
+
     /// <summary>
     /// Function: StopForceFeedbackWaveform
     /// </summary>
     public unsafe virtual void StopForceFeedbackWaveform(BmSDK.Engine.ForceFeedbackWaveform WaveForm = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFeedbackManager.StopForceFeedbackWaveform", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WaveForm, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopForceFeedbackWaveformFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFeedbackManager.StopForceFeedbackWaveform", true);
+        var parms = new StopForceFeedbackWaveform_Params();
+        parms.WaveForm = WaveForm?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -122,8 +137,8 @@ public partial class ForceFeedbackManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAllowsForceFeedback
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1; else *(int*)(Ptr + 44) &= ~1; }
     }
 
     /// <summary>
@@ -131,8 +146,8 @@ public partial class ForceFeedbackManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsPaused
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 2; else *(int*)(Ptr + 44) &= ~2; }
     }
 
     /// <summary>
@@ -149,8 +164,8 @@ public partial class ForceFeedbackManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int CurrentSample
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(int*)(Ptr + 52); }
+        set { *(int*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -158,8 +173,8 @@ public partial class ForceFeedbackManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ElapsedTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -167,8 +182,8 @@ public partial class ForceFeedbackManager : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ScaleAllWaveformsBy
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -73,15 +73,32 @@ public partial class ForceFieldShape : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<ForceFieldShape>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetDrawComponentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDrawComponent_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetDrawComponent
     /// </summary>
     public unsafe virtual BmSDK.Engine.PrimitiveComponent GetDrawComponent()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.GetDrawComponent", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PrimitiveComponent>(paramsPtr + 0);
+        var funcManaged = s_GetDrawComponentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.GetDrawComponent", true);
+        var parms = new GetDrawComponent_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.PrimitiveComponent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_FillByCylinderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct FillByCylinder_Params
+    {
+        [FieldOffset(0)] public float BottomRadius;
+        [FieldOffset(4)] public float TopRadius;
+        [FieldOffset(8)] public float Height;
+        [FieldOffset(12)] public float HeightOffset;
     }
 
     /// <summary>
@@ -89,50 +106,72 @@ public partial class ForceFieldShape : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void FillByCylinder(float BottomRadius, float TopRadius, float Height, float HeightOffset)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.FillByCylinder", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BottomRadius, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TopRadius, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Height, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HeightOffset, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FillByCylinderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.FillByCylinder", true);
+        var parms = new FillByCylinder_Params();
+        parms.BottomRadius = BottomRadius;
+        parms.TopRadius = TopRadius;
+        parms.Height = Height;
+        parms.HeightOffset = HeightOffset;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FillByCapsuleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FillByCapsule_Params
+    {
+        [FieldOffset(0)] public float Height;
+        [FieldOffset(4)] public float Radius;
+    }
+
     /// <summary>
     /// Function: FillByCapsule
     /// </summary>
     public unsafe virtual void FillByCapsule(float Height, float Radius)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.FillByCapsule", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Height, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Radius, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FillByCapsuleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.FillByCapsule", true);
+        var parms = new FillByCapsule_Params();
+        parms.Height = Height;
+        parms.Radius = Radius;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FillByBoxFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct FillByBox_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Dimension;
+    }
+
     /// <summary>
     /// Function: FillByBox
     /// </summary>
     public unsafe virtual void FillByBox(System.Numerics.Vector3 Dimension)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.FillByBox", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Dimension, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FillByBoxFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.FillByBox", true);
+        var parms = new FillByBox_Params();
+        parms.Dimension = Dimension;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FillBySphereFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FillBySphere_Params
+    {
+        [FieldOffset(0)] public float Radius;
+    }
+
     /// <summary>
     /// Function: FillBySphere
     /// </summary>
     public unsafe virtual void FillBySphere(float Radius)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.FillBySphere", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Radius, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FillBySphereFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ForceFieldShape.FillBySphere", true);
+        var parms = new FillBySphere_Params();
+        parms.Radius = Radius;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 }
@@ -83,8 +83,8 @@ public partial class FracturedSkinnedMeshComponent : BmSDK.Engine.FracturedBaseC
     /// </summary>
     public unsafe System.IntPtr ComponentSkinResources
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(System.IntPtr*)(Ptr + 512); }
+        set { *(System.IntPtr*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class FracturedSkinnedMeshComponent : BmSDK.Engine.FracturedBaseC
     /// </summary>
     public unsafe bool bBecameVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 540); }
+        get { return (*(int*)(Ptr + 540) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 540) |= 1; else *(int*)(Ptr + 540) &= ~1; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class FracturedSkinnedMeshComponent : BmSDK.Engine.FracturedBaseC
     /// </summary>
     public unsafe bool bFragmentTransformsChanged
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 540); }
+        get { return (*(int*)(Ptr + 540) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 540) |= 2; else *(int*)(Ptr + 540) &= ~2; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class FracturedSkinnedMeshComponent : BmSDK.Engine.FracturedBaseC
     /// </summary>
     public unsafe bool XRaySet
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 540); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 540); }
+        get { return (*(int*)(Ptr + 540) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 540) |= 4; else *(int*)(Ptr + 540) &= ~4; }
     }
 
     /// <summary>
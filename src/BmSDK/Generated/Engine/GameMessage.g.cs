@@ -78,20 +78,32 @@ public partial class GameMessage : BmSDK.Engine.LocalMessage, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<GameMessage>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetString_Params
+    {
+        [FieldOffset(0)] public int Switch;
+        [FieldOffset(4)] public int bPRI1HUD;
+        [FieldOffset(8)] public nint RelatedPRI_1;
+        [FieldOffset(12)] public nint RelatedPRI_2;
+        [FieldOffset(16)] public nint OptionalObject;
+        [FieldOffset(20)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetString
     /// </summary>
     public unsafe static BmSDK.FString GetString(int Switch = default, bool bPRI1HUD = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_1 = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_2 = default, BmSDK.GameObject OptionalObject = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.GameMessage.GetString", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPRI1HUD, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_1, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_2, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 20);
+        var funcManaged = s_GetStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.GameMessage.GetString", true);
+        var parms = new GetString_Params();
+        parms.Switch = Switch;
+        parms.bPRI1HUD = bPRI1HUD ? 1 : 0;
+        parms.RelatedPRI_1 = RelatedPRI_1?.Ptr ?? 0;
+        parms.RelatedPRI_2 = RelatedPRI_2?.Ptr ?? 0;
+        parms.OptionalObject = OptionalObject?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
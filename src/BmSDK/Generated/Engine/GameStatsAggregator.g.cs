@@ -78,25 +78,34 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         where TComponent : class, Framework.IScriptComponent<GameStatsAggregator>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetAggregateMappingIDsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetAggregateMappingIDs_Params
+    {
+        [FieldOffset(0)] public int EventID;
+        [FieldOffset(4)] public int AggregateID;
+        [FieldOffset(8)] public int TargetAggregateID;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetAggregateMappingIDs
     /// </summary>
     public unsafe virtual bool GetAggregateMappingIDs(int EventID, out int AggregateID, out int TargetAggregateID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.GameStatsAggregator.GetAggregateMappingIDs", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventID, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        AggregateID = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
-        TargetAggregateID = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 8);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_GetAggregateMappingIDsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.GameStatsAggregator.GetAggregateMappingIDs", true);
+        var parms = new GetAggregateMappingIDs_Params();
+        parms.EventID = EventID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        AggregateID = parms.AggregateID;
+        TargetAggregateID = parms.TargetAggregateID;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PostProcessStreamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostProcessStream_Params
+    {
     }
 
     /// <summary>
@@ -104,34 +113,26 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
     /// </summary>
     public unsafe override void PostProcessStream()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.GameStatsAggregator.PostProcessStream", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PostProcessStreamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.GameStatsAggregator.PostProcessStream", true);
+        var parms = new PostProcessStream_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreProcessStreamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreProcessStream_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreProcessStream
     /// </summary>
     public unsafe override void PreProcessStream()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.GameStatsAggregator.PreProcessStream", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PreProcessStreamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.GameStatsAggregator.PreProcessStream", true);
+        var parms = new PreProcessStream_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -144,29 +145,17 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         /// <summary>
         /// IntProperty: EventID
         /// </summary>
-        public unsafe int EventID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int EventID;
 
         /// <summary>
         /// IntProperty: AggregateID
         /// </summary>
-        public unsafe int AggregateID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int AggregateID;
 
         /// <summary>
         /// IntProperty: TargetAggregateID
         /// </summary>
-        public unsafe int TargetAggregateID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int TargetAggregateID;
     }
 
     /// <summary>
@@ -178,56 +167,32 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         /// <summary>
         /// StructProperty: TotalEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FGameEvents>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents;
 
         /// <summary>
         /// StructProperty: WeaponEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FWeaponEvents WeaponEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FWeaponEvents>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public BmSDK.Engine.GameStatsAggregator.FWeaponEvents WeaponEvents;
 
         /// <summary>
         /// StructProperty: DamageAsPlayerEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FDamageEvents DamageAsPlayerEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FDamageEvents>(Ptr + 132); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }; }
-        }
+        [FieldOffset(132)] public BmSDK.Engine.GameStatsAggregator.FDamageEvents DamageAsPlayerEvents;
 
         /// <summary>
         /// StructProperty: DamageAsTargetEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FDamageEvents DamageAsTargetEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FDamageEvents>(Ptr + 204); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }; }
-        }
+        [FieldOffset(204)] public BmSDK.Engine.GameStatsAggregator.FDamageEvents DamageAsTargetEvents;
 
         /// <summary>
         /// StructProperty: ProjectileEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FProjectileEvents ProjectileEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FProjectileEvents>(Ptr + 276); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }; }
-        }
+        [FieldOffset(276)] public BmSDK.Engine.GameStatsAggregator.FProjectileEvents ProjectileEvents;
 
         /// <summary>
         /// StructProperty: PawnEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FPawnEvents PawnEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FPawnEvents>(Ptr + 348); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }; }
-        }
+        [FieldOffset(348)] public BmSDK.Engine.GameStatsAggregator.FPawnEvents PawnEvents;
     }
 
     /// <summary>
@@ -239,56 +204,32 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         /// <summary>
         /// StructProperty: TotalEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FGameEvents>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents;
 
         /// <summary>
         /// StructProperty: WeaponEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FWeaponEvents WeaponEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FWeaponEvents>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public BmSDK.Engine.GameStatsAggregator.FWeaponEvents WeaponEvents;
 
         /// <summary>
         /// StructProperty: DamageAsPlayerEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FDamageEvents DamageAsPlayerEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FDamageEvents>(Ptr + 132); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }; }
-        }
+        [FieldOffset(132)] public BmSDK.Engine.GameStatsAggregator.FDamageEvents DamageAsPlayerEvents;
 
         /// <summary>
         /// StructProperty: DamageAsTargetEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FDamageEvents DamageAsTargetEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FDamageEvents>(Ptr + 204); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }; }
-        }
+        [FieldOffset(204)] public BmSDK.Engine.GameStatsAggregator.FDamageEvents DamageAsTargetEvents;
 
         /// <summary>
         /// StructProperty: ProjectileEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FProjectileEvents ProjectileEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FProjectileEvents>(Ptr + 276); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }; }
-        }
+        [FieldOffset(276)] public BmSDK.Engine.GameStatsAggregator.FProjectileEvents ProjectileEvents;
 
         /// <summary>
         /// StructProperty: PawnEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FPawnEvents PawnEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FPawnEvents>(Ptr + 348); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }; }
-        }
+        [FieldOffset(348)] public BmSDK.Engine.GameStatsAggregator.FPawnEvents PawnEvents;
     }
 
     /// <summary>
@@ -300,11 +241,7 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         /// <summary>
         /// StructProperty: TotalEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FGameEvents>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents;
 
         /// <summary>
         /// ArrayProperty: EventsByPawnClass
@@ -325,11 +262,7 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         /// <summary>
         /// StructProperty: TotalEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FGameEvents>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents;
 
         /// <summary>
         /// ArrayProperty: EventsByDamageClass
@@ -350,11 +283,7 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         /// <summary>
         /// StructProperty: TotalEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FGameEvents>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents;
 
         /// <summary>
         /// ArrayProperty: EventsByProjectileClass
@@ -375,11 +304,7 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         /// <summary>
         /// StructProperty: TotalEvents
         /// </summary>
-        public unsafe BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.GameStatsAggregator.FGameEvents>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.GameStatsAggregator.FGameEvents TotalEvents;
 
         /// <summary>
         /// ArrayProperty: EventsByWeaponClass
@@ -400,11 +325,7 @@ public partial class GameStatsAggregator : BmSDK.Engine.GameplayEventsHandler, B
         /// <summary>
         /// StructProperty: Events
         /// </summary>
-        public unsafe BmSDK.GameObject.FMap_Mirror Events
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMap_Mirror>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FMap_Mirror Events;
     }
 
     /// <summary>
@@ -78,27 +78,52 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<HUD>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PlayerOwnerDiedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayerOwnerDied_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayerOwnerDied
     /// </summary>
     public unsafe virtual void PlayerOwnerDied()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.PlayerOwnerDied", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerOwnerDiedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.PlayerOwnerDied", true);
+        var parms = new PlayerOwnerDied_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetFontSizeIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetFontSizeIndex_Params
+    {
+        [FieldOffset(0)] public int FontSize;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetFontSizeIndex
     /// </summary>
     public unsafe static BmSDK.Engine.Font GetFontSizeIndex(int FontSize)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.GetFontSizeIndex", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FontSize, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Font>(paramsPtr + 4);
+        var funcManaged = s_GetFontSizeIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.GetFontSizeIndex", true);
+        var parms = new GetFontSizeIndex_Params();
+        parms.FontSize = FontSize;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Font)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_DrawTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 44)]
+    private struct DrawText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+        [FieldOffset(12)] public System.Numerics.Vector2 Position;
+        [FieldOffset(20)] public nint TextFont;
+        [FieldOffset(24)] public System.Numerics.Vector2 FontScale;
+        [FieldOffset(32)] public BmSDK.GameObject.FColor TextColor;
     }
 
     /// <summary>
@@ -106,245 +131,398 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void DrawText(BmSDK.FString Text, System.Numerics.Vector2 Position, BmSDK.Engine.Font TextFont, System.Numerics.Vector2 FontScale, BmSDK.GameObject.FColor TextColor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawText", true);
-        byte* paramsPtr = stackalloc byte[44];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Position, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextFont, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FontScale, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextColor, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawText", true);
+        var parms = new DrawText_Params();
+        parms.Text = Text;
+        parms.Position = Position;
+        parms.TextFont = TextFont?.Ptr ?? 0;
+        parms.FontScale = FontScale;
+        parms.TextColor = TextColor;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayKismetMessagesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DisplayKismetMessages_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisplayKismetMessages
     /// </summary>
     public unsafe virtual void DisplayKismetMessages()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DisplayKismetMessages", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayKismetMessagesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DisplayKismetMessages", true);
+        var parms = new DisplayKismetMessages_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayLocalMessagesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct DisplayLocalMessages_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisplayLocalMessages
     /// </summary>
     public unsafe virtual void DisplayLocalMessages()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DisplayLocalMessages", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayLocalMessagesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DisplayLocalMessages", true);
+        var parms = new DisplayLocalMessages_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawMessageTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 112)]
+    private struct DrawMessageText_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.HUD.FHudLocalizedMessage LocalMessage;
+        [FieldOffset(64)] public float ScreenX;
+        [FieldOffset(68)] public float ScreenY;
+    }
+
     /// <summary>
     /// Function: DrawMessageText
     /// </summary>
     public unsafe virtual void DrawMessageText(BmSDK.Engine.HUD.FHudLocalizedMessage LocalMessage, float ScreenX, float ScreenY)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawMessageText", true);
-        byte* paramsPtr = stackalloc byte[112];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocalMessage, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreenX, paramsPtr + 64);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreenY, paramsPtr + 68);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawMessageTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawMessageText", true);
+        var parms = new DrawMessageText_Params();
+        parms.LocalMessage = LocalMessage;
+        parms.ScreenX = ScreenX;
+        parms.ScreenY = ScreenY;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct DrawMessage_Params
+    {
+        [FieldOffset(0)] public int I;
+        [FieldOffset(4)] public float PosY;
+        [FieldOffset(8)] public float DX;
+        [FieldOffset(12)] public float DY;
+    }
+
     /// <summary>
     /// Function: DrawMessage
     /// </summary>
     public unsafe virtual void DrawMessage(int I, float PosY, out float DX, out float DY)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawMessage", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(I, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PosY, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        DX = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
-        DY = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 12);
+        var funcManaged = s_DrawMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawMessage", true);
+        var parms = new DrawMessage_Params();
+        parms.I = I;
+        parms.PosY = PosY;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        DX = parms.DX;
+        DY = parms.DY;
         return;
     }
 
+    static BmSDK.Function s_GetScreenCoordsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 76)]
+    private struct GetScreenCoords_Params
+    {
+        [FieldOffset(0)] public float PosY;
+        [FieldOffset(4)] public float ScreenX;
+        [FieldOffset(8)] public float ScreenY;
+        [FieldOffset(12)] public BmSDK.Engine.HUD.FHudLocalizedMessage InMessage;
+    }
+
     /// <summary>
     /// Function: GetScreenCoords
     /// </summary>
     public unsafe virtual void GetScreenCoords(float PosY, out float ScreenX, out float ScreenY, out BmSDK.Engine.HUD.FHudLocalizedMessage InMessage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.GetScreenCoords", true);
-        byte* paramsPtr = stackalloc byte[76];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PosY, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ScreenX = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
-        ScreenY = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
-        InMessage = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.HUD.FHudLocalizedMessage>(paramsPtr + 12);
+        var funcManaged = s_GetScreenCoordsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.GetScreenCoords", true);
+        var parms = new GetScreenCoords_Params();
+        parms.PosY = PosY;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ScreenX = parms.ScreenX;
+        ScreenY = parms.ScreenY;
+        InMessage = parms.InMessage;
         return;
     }
 
+    static BmSDK.Function s_AddLocalizedMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct AddLocalizedMessage_Params
+    {
+        [FieldOffset(0)] public int Index;
+        [FieldOffset(4)] public nint InMessageClass;
+        [FieldOffset(8)] public BmSDK.FString CriticalString;
+        [FieldOffset(20)] public int Switch;
+        [FieldOffset(24)] public float Position;
+        [FieldOffset(28)] public float Lifetime;
+        [FieldOffset(32)] public int FontSize;
+        [FieldOffset(36)] public BmSDK.GameObject.FColor DrawColor;
+        [FieldOffset(40)] public int MessageCount;
+        [FieldOffset(44)] public nint OptionalObject;
+    }
+
     /// <summary>
     /// Function: AddLocalizedMessage
     /// </summary>
     public unsafe virtual void AddLocalizedMessage(int Index, BmSDK.Class InMessageClass, BmSDK.FString CriticalString, int Switch, float Position, float Lifetime, int FontSize, BmSDK.GameObject.FColor DrawColor, int MessageCount = default, BmSDK.GameObject OptionalObject = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.AddLocalizedMessage", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InMessageClass, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CriticalString, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Position, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Lifetime, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FontSize, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DrawColor, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MessageCount, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddLocalizedMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.AddLocalizedMessage", true);
+        var parms = new AddLocalizedMessage_Params();
+        parms.Index = Index;
+        parms.InMessageClass = InMessageClass?.Ptr ?? 0;
+        parms.CriticalString = CriticalString;
+        parms.Switch = Switch;
+        parms.Position = Position;
+        parms.Lifetime = Lifetime;
+        parms.FontSize = FontSize;
+        parms.DrawColor = DrawColor;
+        parms.MessageCount = MessageCount;
+        parms.OptionalObject = OptionalObject?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LocalizedMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct LocalizedMessage_Params
+    {
+        [FieldOffset(0)] public nint InMessageClass;
+        [FieldOffset(4)] public nint RelatedPRI_1;
+        [FieldOffset(8)] public nint RelatedPRI_2;
+        [FieldOffset(12)] public BmSDK.FString CriticalString;
+        [FieldOffset(24)] public int Switch;
+        [FieldOffset(28)] public float Position;
+        [FieldOffset(32)] public float Lifetime;
+        [FieldOffset(36)] public int FontSize;
+        [FieldOffset(40)] public BmSDK.GameObject.FColor DrawColor;
+        [FieldOffset(44)] public nint OptionalObject;
+    }
+
     /// <summary>
     /// Function: LocalizedMessage
     /// </summary>
     public unsafe virtual void LocalizedMessage(BmSDK.Class InMessageClass, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_1, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_2, BmSDK.FString CriticalString, int Switch, float Position, float Lifetime, int FontSize, BmSDK.GameObject.FColor DrawColor, BmSDK.GameObject OptionalObject = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.LocalizedMessage", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InMessageClass, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_1, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_2, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CriticalString, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Position, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Lifetime, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FontSize, paramsPtr + 36);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DrawColor, paramsPtr + 40);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject, paramsPtr + 44);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LocalizedMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.LocalizedMessage", true);
+        var parms = new LocalizedMessage_Params();
+        parms.InMessageClass = InMessageClass?.Ptr ?? 0;
+        parms.RelatedPRI_1 = RelatedPRI_1?.Ptr ?? 0;
+        parms.RelatedPRI_2 = RelatedPRI_2?.Ptr ?? 0;
+        parms.CriticalString = CriticalString;
+        parms.Switch = Switch;
+        parms.Position = Position;
+        parms.Lifetime = Lifetime;
+        parms.FontSize = FontSize;
+        parms.DrawColor = DrawColor;
+        parms.OptionalObject = OptionalObject?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddConsoleMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct AddConsoleMessage_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString M;
+        [FieldOffset(12)] public nint InMessageClass;
+        [FieldOffset(16)] public nint PRI;
+        [FieldOffset(20)] public float Lifetime;
+    }
+
     /// <summary>
     /// Function: AddConsoleMessage
     /// </summary>
     public unsafe virtual void AddConsoleMessage(BmSDK.FString M, BmSDK.Class InMessageClass, BmSDK.Engine.PlayerReplicationInfo PRI, float Lifetime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.AddConsoleMessage", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(M, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InMessageClass, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PRI, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Lifetime, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddConsoleMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.AddConsoleMessage", true);
+        var parms = new AddConsoleMessage_Params();
+        parms.M = M;
+        parms.InMessageClass = InMessageClass?.Ptr ?? 0;
+        parms.PRI = PRI?.Ptr ?? 0;
+        parms.Lifetime = Lifetime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayConsoleMessagesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct DisplayConsoleMessages_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisplayConsoleMessages
     /// </summary>
     public unsafe virtual void DisplayConsoleMessages()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DisplayConsoleMessages", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayConsoleMessagesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DisplayConsoleMessages", true);
+        var parms = new DisplayConsoleMessages_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Message_Params
+    {
+        [FieldOffset(0)] public nint PRI;
+        [FieldOffset(4)] public BmSDK.FString msg;
+        [FieldOffset(16)] public BmSDK.FName MsgType;
+        [FieldOffset(24)] public float Lifetime;
+    }
+
     /// <summary>
     /// Function: Message
     /// </summary>
     public unsafe virtual void Message(BmSDK.Engine.PlayerReplicationInfo PRI, BmSDK.FString msg, BmSDK.FName MsgType, float Lifetime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.Message", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PRI, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(msg, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MsgType, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Lifetime, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.Message", true);
+        var parms = new Message_Params();
+        parms.PRI = PRI?.Ptr ?? 0;
+        parms.msg = msg;
+        parms.MsgType = MsgType;
+        parms.Lifetime = Lifetime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct ClearMessage_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.HUD.FHudLocalizedMessage M;
+    }
+
     /// <summary>
     /// Function: ClearMessage
     /// </summary>
     public unsafe virtual void ClearMessage(out BmSDK.Engine.HUD.FHudLocalizedMessage M)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ClearMessage", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        M = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.HUD.FHudLocalizedMessage>(paramsPtr + 0);
+        var funcManaged = s_ClearMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ClearMessage", true);
+        var parms = new ClearMessage_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        M = parms.M;
         return;
     }
 
+    static BmSDK.Function s_DisplayBadConnectionAlertFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisplayBadConnectionAlert_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisplayBadConnectionAlert
     /// </summary>
     public unsafe virtual void DisplayBadConnectionAlert()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DisplayBadConnectionAlert", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisplayBadConnectionAlertFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DisplayBadConnectionAlert", true);
+        var parms = new DisplayBadConnectionAlert_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DrawHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: DrawHUD
     /// </summary>
     public unsafe virtual void DrawHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawHUD", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawHUD", true);
+        var parms = new DrawHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostRenderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PostRender_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostRender
     /// </summary>
     public unsafe virtual void PostRender()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.PostRender", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostRenderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.PostRender", true);
+        var parms = new PostRender_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreCalcValuesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreCalcValues_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreCalcValues
     /// </summary>
     public unsafe virtual void PreCalcValues()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.PreCalcValues", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreCalcValuesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.PreCalcValues", true);
+        var parms = new PreCalcValues_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowDebugInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ShowDebugInfo_Params
+    {
+        [FieldOffset(0)] public float out_YL;
+        [FieldOffset(4)] public float out_YPos;
+    }
+
     /// <summary>
     /// Function: ShowDebugInfo
     /// </summary>
     public unsafe virtual void ShowDebugInfo(out float out_YL, out float out_YPos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShowDebugInfo", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        out_YL = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
-        out_YPos = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_ShowDebugInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShowDebugInfo", true);
+        var parms = new ShowDebugInfo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        out_YL = parms.out_YL;
+        out_YPos = parms.out_YPos;
         return;
     }
 
+    static BmSDK.Function s_ShouldDisplayDebugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ShouldDisplayDebug_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName DebugType;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ShouldDisplayDebug
     /// </summary>
     public unsafe virtual bool ShouldDisplayDebug(BmSDK.FName DebugType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShouldDisplayDebug", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DebugType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_ShouldDisplayDebugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShouldDisplayDebug", true);
+        var parms = new ShouldDisplayDebug_Params();
+        parms.DebugType = DebugType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ShowDebugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ShowDebug_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName DebugType;
     }
 
     /// <summary>
@@ -352,130 +530,168 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ShowDebug(BmSDK.FName DebugType = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShowDebug", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DebugType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowDebugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShowDebug", true);
+        var parms = new ShowDebug_Params();
+        parms.DebugType = DebugType;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetShowScoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetShowScores_Params
+    {
+        [FieldOffset(0)] public int bNewValue;
+    }
+
     /// <summary>
     /// Function: SetShowScores
     /// </summary>
     public unsafe virtual void SetShowScores(bool bNewValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.SetShowScores", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewValue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetShowScoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.SetShowScores", true);
+        var parms = new SetShowScores_Params();
+        parms.bNewValue = bNewValue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowScoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowScores_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowScores
     /// </summary>
     public unsafe virtual void ShowScores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShowScores", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowScoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShowScores", true);
+        var parms = new ShowScores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowHUD
     /// </summary>
     public unsafe virtual void ShowHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShowHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ShowHUD", true);
+        var parms = new ShowHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ToggleHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ToggleHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: ToggleHUD
     /// </summary>
     public unsafe virtual void ToggleHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ToggleHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ToggleHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.ToggleHUD", true);
+        var parms = new ToggleHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawActorOverlaysFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct DrawActorOverlays_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ViewPoint;
+        [FieldOffset(12)] public BmSDK.Rotator ViewRotation;
+    }
+
     /// <summary>
     /// Function: DrawActorOverlays
     /// </summary>
     public unsafe virtual void DrawActorOverlays(System.Numerics.Vector3 ViewPoint, BmSDK.Rotator ViewRotation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawActorOverlays", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ViewPoint, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ViewRotation, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_DrawActorOverlaysFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.DrawActorOverlays", true);
+        var parms = new DrawActorOverlays_Params();
+        parms.ViewPoint = ViewPoint;
+        parms.ViewRotation = ViewRotation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Draw2DLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct Draw2DLine_Params
+    {
+        [FieldOffset(0)] public int X1;
+        [FieldOffset(4)] public int Y1;
+        [FieldOffset(8)] public int X2;
+        [FieldOffset(12)] public int Y2;
+        [FieldOffset(16)] public BmSDK.GameObject.FColor LineColor;
+    }
+
     /// <summary>
     /// Function: Draw2DLine
     /// </summary>
     public unsafe virtual void Draw2DLine(int X1, int Y1, int X2, int Y2, BmSDK.GameObject.FColor LineColor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.Draw2DLine", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X1, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y1, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X2, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y2, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineColor, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_Draw2DLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.Draw2DLine", true);
+        var parms = new Draw2DLine_Params();
+        parms.X1 = X1;
+        parms.Y1 = Y1;
+        parms.X2 = X2;
+        parms.Y2 = Y2;
+        parms.LineColor = LineColor;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Draw3DLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Draw3DLine_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 Start;
+        [FieldOffset(12)] public System.Numerics.Vector3 End;
+        [FieldOffset(24)] public BmSDK.GameObject.FColor LineColor;
+    }
+
     /// <summary>
     /// Function: Draw3DLine
     /// </summary>
     public unsafe virtual void Draw3DLine(System.Numerics.Vector3 Start, System.Numerics.Vector3 End, BmSDK.GameObject.FColor LineColor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.Draw3DLine", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Start, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(End, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LineColor, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_Draw3DLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.HUD.Draw3DLine", true);
+        var parms = new Draw3DLine_Params();
+        parms.Start = Start;
+        parms.End = End;
+        parms.LineColor = LineColor;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -515,38 +731,22 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: MessageFontScale
         /// </summary>
-        public unsafe System.Numerics.Vector2 MessageFontScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public System.Numerics.Vector2 MessageFontScale;
 
         /// <summary>
         /// StructProperty: MessageOffset
         /// </summary>
-        public unsafe System.Numerics.Vector2 MessageOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector2>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public System.Numerics.Vector2 MessageOffset;
 
         /// <summary>
         /// StructProperty: MessageColor
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor MessageColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public BmSDK.GameObject.FColor MessageColor;
 
         /// <summary>
         /// FloatProperty: MessageEndTime
         /// </summary>
-        public unsafe float MessageEndTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public float MessageEndTime;
     }
 
     /// <summary>
@@ -555,6 +755,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 64)]
     public partial record struct FHudLocalizedMessage
     {
+        [FieldOffset(52)] private int _bitfield52;
+
         /// <summary>
         /// ClassProperty: Message
         /// </summary>
@@ -576,56 +778,32 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Switch
         /// </summary>
-        public unsafe int Switch
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int Switch;
 
         /// <summary>
         /// FloatProperty: EndOfLife
         /// </summary>
-        public unsafe float EndOfLife
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public float EndOfLife;
 
         /// <summary>
         /// FloatProperty: Lifetime
         /// </summary>
-        public unsafe float Lifetime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float Lifetime;
 
         /// <summary>
         /// FloatProperty: PosY
         /// </summary>
-        public unsafe float PosY
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float PosY;
 
         /// <summary>
         /// StructProperty: DrawColor
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor DrawColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.GameObject.FColor DrawColor;
 
         /// <summary>
         /// IntProperty: FontSize
         /// </summary>
-        public unsafe int FontSize
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public int FontSize;
 
         /// <summary>
         /// ObjectProperty: StringFont
@@ -639,38 +817,26 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: DX
         /// </summary>
-        public unsafe float DX
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float DX;
 
         /// <summary>
         /// FloatProperty: DY
         /// </summary>
-        public unsafe float DY
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public float DY;
 
         /// <summary>
         /// BoolProperty: Drawn
         /// </summary>
-        public unsafe bool Drawn
+        public bool Drawn
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }; }
+            readonly get => (_bitfield52 & 1) != 0;
+            set { if (value) _bitfield52 |= 1; else _bitfield52 &= ~1; }
         }
 
         /// <summary>
         /// IntProperty: Count
         /// </summary>
-        public unsafe int Count
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public int Count;
 
         /// <summary>
         /// ObjectProperty: OptionalObject
@@ -700,20 +866,12 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: TextColor
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor TextColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.GameObject.FColor TextColor;
 
         /// <summary>
         /// FloatProperty: MessageLife
         /// </summary>
-        public unsafe float MessageLife
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float MessageLife;
 
         /// <summary>
         /// ObjectProperty: PRI
@@ -757,8 +915,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLostFocusPaused
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }
+        get { return (*(int*)(Ptr + 444) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 444) |= 1; else *(int*)(Ptr + 444) &= ~1; }
     }
 
     /// <summary>
@@ -766,8 +924,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShowHUD
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }
+        get { return (*(int*)(Ptr + 444) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 444) |= 2; else *(int*)(Ptr + 444) &= ~2; }
     }
 
     /// <summary>
@@ -775,8 +933,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShowScores
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }
+        get { return (*(int*)(Ptr + 444) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 444) |= 4; else *(int*)(Ptr + 444) &= ~4; }
     }
 
     /// <summary>
@@ -784,8 +942,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShowDebugInfo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }
+        get { return (*(int*)(Ptr + 444) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 444) |= 8; else *(int*)(Ptr + 444) &= ~8; }
     }
 
     /// <summary>
@@ -793,8 +951,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShowBadConnectionAlert
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }
+        get { return (*(int*)(Ptr + 444) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 444) |= 16; else *(int*)(Ptr + 444) &= ~16; }
     }
 
     /// <summary>
@@ -802,8 +960,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bMessageBeep
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }
+        get { return (*(int*)(Ptr + 444) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 444) |= 32; else *(int*)(Ptr + 444) &= ~32; }
     }
 
     /// <summary>
@@ -811,8 +969,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShowOverlays
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 444); }
+        get { return (*(int*)(Ptr + 444) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 444) |= 64; else *(int*)(Ptr + 444) &= ~64; }
     }
 
     /// <summary>
@@ -820,8 +978,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float HudCanvasScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(float*)(Ptr + 448); }
+        set { *(float*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -853,8 +1011,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int ConsoleMessageCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 480); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 480); }
+        get { return *(int*)(Ptr + 480); }
+        set { *(int*)(Ptr + 480) = value; }
     }
 
     /// <summary>
@@ -862,8 +1020,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int ConsoleFontSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(int*)(Ptr + 484); }
+        set { *(int*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -871,8 +1029,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int MessageFontOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(int*)(Ptr + 488); }
+        set { *(int*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -880,8 +1038,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxHUDAreaMessageCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(int*)(Ptr + 492); }
+        set { *(int*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -935,8 +1093,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float ConsoleMessagePosX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1008); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1008); }
+        get { return *(float*)(Ptr + 1008); }
+        set { *(float*)(Ptr + 1008) = value; }
     }
 
     /// <summary>
@@ -944,8 +1102,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float ConsoleMessagePosY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1012); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1012); }
+        get { return *(float*)(Ptr + 1012); }
+        set { *(float*)(Ptr + 1012) = value; }
     }
 
     /// <summary>
@@ -962,8 +1120,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastHUDRenderTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1020); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1020); }
+        get { return *(float*)(Ptr + 1020); }
+        set { *(float*)(Ptr + 1020) = value; }
     }
 
     /// <summary>
@@ -971,8 +1129,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float RenderDelta
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1024); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1024); }
+        get { return *(float*)(Ptr + 1024); }
+        set { *(float*)(Ptr + 1024) = value; }
     }
 
     /// <summary>
@@ -980,8 +1138,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float SizeX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1028); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1028); }
+        get { return *(float*)(Ptr + 1028); }
+        set { *(float*)(Ptr + 1028) = value; }
     }
 
     /// <summary>
@@ -989,8 +1147,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float SizeY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1032); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1032); }
+        get { return *(float*)(Ptr + 1032); }
+        set { *(float*)(Ptr + 1032) = value; }
     }
 
     /// <summary>
@@ -998,8 +1156,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float CenterX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1036); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1036); }
+        get { return *(float*)(Ptr + 1036); }
+        set { *(float*)(Ptr + 1036) = value; }
     }
 
     /// <summary>
@@ -1007,8 +1165,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float CenterY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1040); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1040); }
+        get { return *(float*)(Ptr + 1040); }
+        set { *(float*)(Ptr + 1040) = value; }
     }
 
     /// <summary>
@@ -1016,8 +1174,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float RatioX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1044); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1044); }
+        get { return *(float*)(Ptr + 1044); }
+        set { *(float*)(Ptr + 1044) = value; }
     }
 
     /// <summary>
@@ -1025,8 +1183,8 @@ public partial class HUD : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe float RatioY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1048); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1048); }
+        get { return *(float*)(Ptr + 1048); }
+        set { *(float*)(Ptr + 1048) = value; }
     }
 
     /// <summary>
@@ -82,11 +82,7 @@ public partial class Info : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: ServerID
         /// </summary>
-        public unsafe int ServerID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int ServerID;
 
         /// <summary>
         /// StrProperty: IP
@@ -100,20 +96,12 @@ public partial class Info : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Port
         /// </summary>
-        public unsafe int Port
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int Port;
 
         /// <summary>
         /// IntProperty: QueryPort
         /// </summary>
-        public unsafe int QueryPort
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public int QueryPort;
 
         /// <summary>
         /// StrProperty: ServerName
@@ -145,29 +133,17 @@ public partial class Info : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: CurrentPlayers
         /// </summary>
-        public unsafe int CurrentPlayers
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }; }
-        }
+        [FieldOffset(60)] public int CurrentPlayers;
 
         /// <summary>
         /// IntProperty: MaxPlayers
         /// </summary>
-        public unsafe int MaxPlayers
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public int MaxPlayers;
 
         /// <summary>
         /// IntProperty: Ping
         /// </summary>
-        public unsafe int Ping
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public int Ping;
 
         /// <summary>
         /// ArrayProperty: ServerInfo
@@ -197,20 +173,12 @@ public partial class Info : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: PlayerNum
         /// </summary>
-        public unsafe int PlayerNum
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int PlayerNum;
 
         /// <summary>
         /// IntProperty: PlayerID
         /// </summary>
-        public unsafe int PlayerID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int PlayerID;
 
         /// <summary>
         /// StrProperty: PlayerName
@@ -224,29 +192,17 @@ public partial class Info : BmSDK.Engine.Actor, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Ping
         /// </summary>
-        public unsafe int Ping
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public int Ping;
 
         /// <summary>
         /// IntProperty: Score
         /// </summary>
-        public unsafe int Score
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int Score;
 
         /// <summary>
         /// IntProperty: StatsID
         /// </summary>
-        public unsafe int StatsID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int StatsID;
 
         /// <summary>
         /// ArrayProperty: PlayerInfo
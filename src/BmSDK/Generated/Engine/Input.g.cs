@@ -78,34 +78,41 @@ public partial class Input : BmSDK.Engine.Interaction, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<Input>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetBindFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct SetBind_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName BindName;
+        [FieldOffset(8)] public BmSDK.FString Command;
+    }
+
     /// <summary>
     /// Function: SetBind
     /// </summary>
     public unsafe virtual void SetBind(BmSDK.FName BindName, BmSDK.FString Command)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Input.SetBind", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BindName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Command, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetBindFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Input.SetBind", true);
+        var parms = new SetBind_Params();
+        parms.BindName = BindName;
+        parms.Command = Command;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetInput_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetInput
     /// </summary>
     public unsafe virtual void ResetInput()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Input.ResetInput", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ResetInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Input.ResetInput", true);
+        var parms = new ResetInput_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -132,8 +139,8 @@ public partial class Input : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.GameObject.EInputEvent CurrentEvent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EInputEvent>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.GameObject.EInputEvent*)(Ptr + 120); }
+        set { *(BmSDK.GameObject.EInputEvent*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -141,8 +148,8 @@ public partial class Input : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentDelta
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -150,8 +157,8 @@ public partial class Input : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe float CurrentDeltaTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 
     /// <summary>
@@ -178,14 +185,12 @@ public partial class Input : BmSDK.Engine.Interaction, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 24)]
     public partial record struct FKeyBind
     {
+        [FieldOffset(20)] private int _bitfield20;
+
         /// <summary>
         /// NameProperty: Name
         /// </summary>
-        public unsafe BmSDK.FName Name
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName Name;
 
         /// <summary>
         /// StrProperty: Command
@@ -199,55 +204,55 @@ public partial class Input : BmSDK.Engine.Interaction, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: Control
         /// </summary>
-        public unsafe bool Control
+        public bool Control
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 1) != 0;
+            set { if (value) _bitfield20 |= 1; else _bitfield20 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: Shift
         /// </summary>
-        public unsafe bool Shift
+        public bool Shift
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 2) != 0;
+            set { if (value) _bitfield20 |= 2; else _bitfield20 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: Alt
         /// </summary>
-        public unsafe bool Alt
+        public bool Alt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 4) != 0;
+            set { if (value) _bitfield20 |= 4; else _bitfield20 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bIgnoreCtrl
         /// </summary>
-        public unsafe bool bIgnoreCtrl
+        public bool bIgnoreCtrl
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 8) != 0;
+            set { if (value) _bitfield20 |= 8; else _bitfield20 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bIgnoreShift
         /// </summary>
-        public unsafe bool bIgnoreShift
+        public bool bIgnoreShift
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 16) != 0;
+            set { if (value) _bitfield20 |= 16; else _bitfield20 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: bIgnoreAlt
         /// </summary>
-        public unsafe bool bIgnoreAlt
+        public bool bIgnoreAlt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 32) != 0;
+            set { if (value) _bitfield20 |= 32; else _bitfield20 &= ~32; }
         }
     }
 }
@@ -83,7 +83,7 @@ public partial class InteractiveFoliageComponent : BmSDK.Engine.StaticMeshCompon
     /// </summary>
     public unsafe System.IntPtr FoliageSceneProxy
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 476); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 476); }
+        get { return *(System.IntPtr*)(Ptr + 476); }
+        set { *(System.IntPtr*)(Ptr + 476) = value; }
     }
 }
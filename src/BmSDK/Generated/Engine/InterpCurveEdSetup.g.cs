@@ -92,8 +92,8 @@ public partial class InterpCurveEdSetup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ActiveTab
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(int*)(Ptr + 56); }
+        set { *(int*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -123,38 +123,22 @@ public partial class InterpCurveEdSetup : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: ViewStartInput
         /// </summary>
-        public unsafe float ViewStartInput
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float ViewStartInput;
 
         /// <summary>
         /// FloatProperty: ViewEndInput
         /// </summary>
-        public unsafe float ViewEndInput
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public float ViewEndInput;
 
         /// <summary>
         /// FloatProperty: ViewStartOutput
         /// </summary>
-        public unsafe float ViewStartOutput
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float ViewStartOutput;
 
         /// <summary>
         /// FloatProperty: ViewEndOutput
         /// </summary>
-        public unsafe float ViewEndOutput
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float ViewEndOutput;
     }
 
     /// <summary>
@@ -175,11 +159,7 @@ public partial class InterpCurveEdSetup : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: CurveColor
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor CurveColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.GameObject.FColor CurveColor;
 
         /// <summary>
         /// StrProperty: CurveName
@@ -193,55 +173,31 @@ public partial class InterpCurveEdSetup : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: bHideCurve
         /// </summary>
-        public unsafe int bHideCurve
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public int bHideCurve;
 
         /// <summary>
         /// IntProperty: bColorCurve
         /// </summary>
-        public unsafe int bColorCurve
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int bColorCurve;
 
         /// <summary>
         /// IntProperty: bFloatingPointColorCurve
         /// </summary>
-        public unsafe int bFloatingPointColorCurve
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 28); }; }
-        }
+        [FieldOffset(28)] public int bFloatingPointColorCurve;
 
         /// <summary>
         /// IntProperty: bClamp
         /// </summary>
-        public unsafe int bClamp
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public int bClamp;
 
         /// <summary>
         /// FloatProperty: ClampLow
         /// </summary>
-        public unsafe float ClampLow
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float ClampLow;
 
         /// <summary>
         /// FloatProperty: ClampHigh
         /// </summary>
-        public unsafe float ClampHigh
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float ClampHigh;
     }
 }
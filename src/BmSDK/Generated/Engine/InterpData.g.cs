@@ -84,6 +84,8 @@ public partial class InterpData : BmSDK.Engine.SequenceVariable, BmSDK.IGameObje
     [StructLayout(LayoutKind.Explicit, Size = 16)]
     public partial record struct FAnimSetBakeAndPruneStatus
     {
+        [FieldOffset(12)] private int _bitfield12;
+
         /// <summary>
         /// StrProperty: AnimSetName
         /// </summary>
@@ -96,19 +98,19 @@ public partial class InterpData : BmSDK.Engine.SequenceVariable, BmSDK.IGameObje
         /// <summary>
         /// BoolProperty: bReferencedButUnused
         /// </summary>
-        public unsafe bool bReferencedButUnused
+        public bool bReferencedButUnused
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bSkipBakeAndPrune
         /// </summary>
-        public unsafe bool bSkipBakeAndPrune
+        public bool bSkipBakeAndPrune
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 2) != 0;
+            set { if (value) _bitfield12 |= 2; else _bitfield12 &= ~2; }
         }
     }
 
@@ -117,8 +119,8 @@ public partial class InterpData : BmSDK.Engine.SequenceVariable, BmSDK.IGameObje
     /// </summary>
     public unsafe float InterpLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 
     /// <summary>
@@ -126,8 +128,8 @@ public partial class InterpData : BmSDK.Engine.SequenceVariable, BmSDK.IGameObje
     /// </summary>
     public unsafe float PathBuildTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(float*)(Ptr + 132); }
+        set { *(float*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -180,8 +182,8 @@ public partial class InterpData : BmSDK.Engine.SequenceVariable, BmSDK.IGameObje
     /// </summary>
     public unsafe float EdSectionStart
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(float*)(Ptr + 180); }
+        set { *(float*)(Ptr + 180) = value; }
     }
 
     /// <summary>
@@ -189,8 +191,8 @@ public partial class InterpData : BmSDK.Engine.SequenceVariable, BmSDK.IGameObje
     /// </summary>
     public unsafe float EdSectionEnd
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(float*)(Ptr + 184); }
+        set { *(float*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -198,8 +200,8 @@ public partial class InterpData : BmSDK.Engine.SequenceVariable, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bShouldBakeAndPrune
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 188); }
+        get { return (*(int*)(Ptr + 188) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 188) |= 1; else *(int*)(Ptr + 188) &= ~1; }
     }
 
     /// <summary>
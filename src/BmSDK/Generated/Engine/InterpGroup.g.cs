@@ -105,20 +105,12 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: KeyIndex
         /// </summary>
-        public unsafe int KeyIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int KeyIndex;
 
         /// <summary>
         /// FloatProperty: UnsnappedPosition
         /// </summary>
-        public unsafe float UnsnappedPosition
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float UnsnappedPosition;
     }
 
     /// <summary>
@@ -126,8 +118,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr VfTable_FInterpEdInputInterface
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(System.IntPtr*)(Ptr + 44); }
+        set { *(System.IntPtr*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -144,8 +136,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName GroupName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -168,8 +160,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCollapsed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1; else *(int*)(Ptr + 84) &= ~1; }
     }
 
     /// <summary>
@@ -177,8 +169,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 2; else *(int*)(Ptr + 84) &= ~2; }
     }
 
     /// <summary>
@@ -186,8 +178,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsFolder
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 4; else *(int*)(Ptr + 84) &= ~4; }
     }
 
     /// <summary>
@@ -195,8 +187,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsParented
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 8; else *(int*)(Ptr + 84) &= ~8; }
     }
 
     /// <summary>
@@ -204,8 +196,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsSelected
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 16; else *(int*)(Ptr + 84) &= ~16; }
     }
 
     /// <summary>
@@ -213,8 +205,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool CinematicProxy_DisableChangePoseOnFinish
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 32; else *(int*)(Ptr + 84) &= ~32; }
     }
 
     /// <summary>
@@ -222,8 +214,8 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CinematicProxy_BlendInDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -231,7 +223,7 @@ public partial class InterpGroup : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CinematicProxy_BlendOutDuration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 }
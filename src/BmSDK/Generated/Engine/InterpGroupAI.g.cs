@@ -92,8 +92,8 @@ public partial class InterpGroupAI : BmSDK.Engine.InterpGroup, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName StageMarkGroup
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(BmSDK.FName*)(Ptr + 100); }
+        set { *(BmSDK.FName*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class InterpGroupAI : BmSDK.Engine.InterpGroup, BmSDK.IGameObject
     /// </summary>
     public unsafe bool SnapToRootBoneLocationWhenFinished
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 1; else *(int*)(Ptr + 116) &= ~1; }
     }
 
     /// <summary>
@@ -128,7 +128,7 @@ public partial class InterpGroupAI : BmSDK.Engine.InterpGroup, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bNoEncroachmentCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 2; else *(int*)(Ptr + 116) &= ~2; }
     }
 }
@@ -92,8 +92,8 @@ public partial class InterpGroupInstAI : BmSDK.Engine.InterpGroupInst, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.Engine.Actor.EPhysics SavedPhysics
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EPhysics>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(BmSDK.Engine.Actor.EPhysics*)(Ptr + 68); }
+        set { *(BmSDK.Engine.Actor.EPhysics*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class InterpGroupInstAI : BmSDK.Engine.InterpGroupInst, BmSDK.IGa
     /// </summary>
     public unsafe bool bSavedNoEncroachCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }
+        get { return (*(int*)(Ptr + 72) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 72) |= 1; else *(int*)(Ptr + 72) &= ~1; }
     }
 }
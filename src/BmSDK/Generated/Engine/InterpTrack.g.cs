@@ -90,6 +90,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 28)]
     public partial record struct FSubTrackGroup
     {
+        [FieldOffset(24)] private int _bitfield24;
+
         /// <summary>
         /// StrProperty: GroupName
         /// </summary>
@@ -111,19 +113,19 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: bIsCollapsed
         /// </summary>
-        public unsafe bool bIsCollapsed
+        public bool bIsCollapsed
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 1) != 0;
+            set { if (value) _bitfield24 |= 1; else _bitfield24 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bIsSelected
         /// </summary>
-        public unsafe bool bIsSelected
+        public bool bIsSelected
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 2) != 0;
+            set { if (value) _bitfield24 |= 2; else _bitfield24 &= ~2; }
         }
     }
 
@@ -154,11 +156,7 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: GroupIndex
         /// </summary>
-        public unsafe int GroupIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int GroupIndex;
     }
 
     /// <summary>
@@ -166,8 +164,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr VfTable_FInterpEdInputInterface
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(System.IntPtr*)(Ptr + 44); }
+        set { *(System.IntPtr*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -175,8 +173,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr CurveEdVTable
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(System.IntPtr*)(Ptr + 48); }
+        set { *(System.IntPtr*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -220,8 +218,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.InterpTrack.ETrackActiveCondition ActiveCondition
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.InterpTrack.ETrackActiveCondition>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.Engine.InterpTrack.ETrackActiveCondition*)(Ptr + 92); }
+        set { *(BmSDK.Engine.InterpTrack.ETrackActiveCondition*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -238,8 +236,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOnePerGroup
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 1; else *(int*)(Ptr + 108) &= ~1; }
     }
 
     /// <summary>
@@ -247,8 +245,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDirGroupOnly
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 2; else *(int*)(Ptr + 108) &= ~2; }
     }
 
     /// <summary>
@@ -256,8 +254,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisableTrack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 4; else *(int*)(Ptr + 108) &= ~4; }
     }
 
     /// <summary>
@@ -265,8 +263,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsAnimControlTrack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 8; else *(int*)(Ptr + 108) &= ~8; }
     }
 
     /// <summary>
@@ -274,8 +272,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSubTrackOnly
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 16; else *(int*)(Ptr + 108) &= ~16; }
     }
 
     /// <summary>
@@ -283,8 +281,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 32; else *(int*)(Ptr + 108) &= ~32; }
     }
 
     /// <summary>
@@ -292,8 +290,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsSelected
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 64; else *(int*)(Ptr + 108) &= ~64; }
     }
 
     /// <summary>
@@ -301,8 +299,8 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsRecording
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 128; else *(int*)(Ptr + 108) &= ~128; }
     }
 
     /// <summary>
@@ -310,7 +308,7 @@ public partial class InterpTrack : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsCollapsed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 256; else *(int*)(Ptr + 108) &= ~256; }
     }
 }
@@ -83,8 +83,8 @@ public partial class InterpTrackFade : BmSDK.Engine.InterpTrackFloatBase, BmSDK.
     /// </summary>
     public unsafe bool bPersistFade
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 184); }
+        get { return (*(int*)(Ptr + 184) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 184) |= 1; else *(int*)(Ptr + 184) &= ~1; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class InterpTrackFade : BmSDK.Engine.InterpTrackFloatBase, BmSDK.
     /// </summary>
     public unsafe bool bAlsoFadesAudio
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 184); }
+        get { return (*(int*)(Ptr + 184) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 184) |= 2; else *(int*)(Ptr + 184) &= ~2; }
     }
 }
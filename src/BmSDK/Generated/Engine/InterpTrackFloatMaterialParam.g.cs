@@ -101,8 +101,8 @@ public partial class InterpTrackFloatMaterialParam : BmSDK.Engine.InterpTrackFlo
     /// </summary>
     public unsafe BmSDK.FName ParamName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 200); }
+        get { return *(BmSDK.FName*)(Ptr + 200); }
+        set { *(BmSDK.FName*)(Ptr + 200) = value; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class InterpTrackFloatMaterialParam : BmSDK.Engine.InterpTrackFlo
     /// </summary>
     public unsafe bool bNeedsMaterialRefsUpdate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 208); }
+        get { return (*(int*)(Ptr + 208) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 208) |= 1; else *(int*)(Ptr + 208) &= ~1; }
     }
 }
@@ -83,7 +83,7 @@ public partial class InterpTrackFloatProp : BmSDK.Engine.InterpTrackFloatBase, B
     /// </summary>
     public unsafe BmSDK.FName PropertyName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(BmSDK.FName*)(Ptr + 184); }
+        set { *(BmSDK.FName*)(Ptr + 184) = value; }
     }
 }
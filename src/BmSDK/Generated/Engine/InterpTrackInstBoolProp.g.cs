@@ -83,8 +83,8 @@ public partial class InterpTrackInstBoolProp : BmSDK.Engine.InterpTrackInstPrope
     /// </summary>
     public unsafe System.IntPtr BoolProp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(System.IntPtr*)(Ptr + 52); }
+        set { *(System.IntPtr*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class InterpTrackInstBoolProp : BmSDK.Engine.InterpTrackInstPrope
     /// </summary>
     public unsafe bool ResetBool
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 }
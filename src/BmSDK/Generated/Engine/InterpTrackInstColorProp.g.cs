@@ -83,8 +83,8 @@ public partial class InterpTrackInstColorProp : BmSDK.Engine.InterpTrackInstProp
     /// </summary>
     public unsafe System.IntPtr ColorProp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(System.IntPtr*)(Ptr + 52); }
+        set { *(System.IntPtr*)(Ptr + 52) = value; }
     }
 
     /// <summary>
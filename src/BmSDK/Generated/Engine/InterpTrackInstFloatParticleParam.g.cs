@@ -83,7 +83,7 @@ public partial class InterpTrackInstFloatParticleParam : BmSDK.Engine.InterpTrac
     /// </summary>
     public unsafe float ResetFloat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(float*)(Ptr + 44); }
+        set { *(float*)(Ptr + 44) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class InterpTrackInstFloatProp : BmSDK.Engine.InterpTrackInstProp
     /// </summary>
     public unsafe System.IntPtr FloatProp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(System.IntPtr*)(Ptr + 52); }
+        set { *(System.IntPtr*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class InterpTrackInstFloatProp : BmSDK.Engine.InterpTrackInstProp
     /// </summary>
     public unsafe float ResetFloat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 }
@@ -84,6 +84,8 @@ public partial class InterpTrackInstHeadTracking : BmSDK.Engine.InterpTrackInst,
     [StructLayout(LayoutKind.Explicit, Size = 24)]
     public partial record struct FActorToLookAt
     {
+        [FieldOffset(20)] private int _bitfield20;
+
         /// <summary>
         /// ObjectProperty: Actor
         /// </summary>
@@ -96,46 +98,30 @@ public partial class InterpTrackInstHeadTracking : BmSDK.Engine.InterpTrackInst,
         /// <summary>
         /// FloatProperty: Rating
         /// </summary>
-        public unsafe float Rating
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Rating;
 
         /// <summary>
         /// FloatProperty: EnteredTime
         /// </summary>
-        public unsafe float EnteredTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float EnteredTime;
 
         /// <summary>
         /// FloatProperty: LastKnownDistance
         /// </summary>
-        public unsafe float LastKnownDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float LastKnownDistance;
 
         /// <summary>
         /// FloatProperty: StartTimeBeingLookedAt
         /// </summary>
-        public unsafe float StartTimeBeingLookedAt
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float StartTimeBeingLookedAt;
 
         /// <summary>
         /// BoolProperty: CurrentlyBeingLookedAt
         /// </summary>
-        public unsafe bool CurrentlyBeingLookedAt
+        public bool CurrentlyBeingLookedAt
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 1) != 0;
+            set { if (value) _bitfield20 |= 1; else _bitfield20 &= ~1; }
         }
     }
 
@@ -144,8 +130,8 @@ public partial class InterpTrackInstHeadTracking : BmSDK.Engine.InterpTrackInst,
     /// </summary>
     public unsafe BmSDK.Engine.InterpTrackHeadTracking.EHeadTrackingAction Action
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.InterpTrackHeadTracking.EHeadTrackingAction>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.Engine.InterpTrackHeadTracking.EHeadTrackingAction*)(Ptr + 44); }
+        set { *(BmSDK.Engine.InterpTrackHeadTracking.EHeadTrackingAction*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -180,7 +166,7 @@ public partial class InterpTrackInstHeadTracking : BmSDK.Engine.InterpTrackInst,
     /// </summary>
     public unsafe float LastUpdatePosition
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class InterpTrackInstToggle : BmSDK.Engine.InterpTrackInst, BmSDK
     /// </summary>
     public unsafe BmSDK.Engine.InterpTrackToggle.ETrackToggleAction Action
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.InterpTrackToggle.ETrackToggleAction>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.Engine.InterpTrackToggle.ETrackToggleAction*)(Ptr + 44); }
+        set { *(BmSDK.Engine.InterpTrackToggle.ETrackToggleAction*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class InterpTrackInstToggle : BmSDK.Engine.InterpTrackInst, BmSDK
     /// </summary>
     public unsafe float LastUpdatePosition
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class InterpTrackInstToggle : BmSDK.Engine.InterpTrackInst, BmSDK
     /// </summary>
     public unsafe bool bSavedActiveState
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }
+        get { return (*(int*)(Ptr + 52) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 52) |= 1; else *(int*)(Ptr + 52) &= ~1; }
     }
 }
@@ -83,8 +83,8 @@ public partial class InterpTrackInstVectorProp : BmSDK.Engine.InterpTrackInstPro
     /// </summary>
     public unsafe System.IntPtr VectorProp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(System.IntPtr*)(Ptr + 52); }
+        set { *(System.IntPtr*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -84,7 +84,7 @@ public partial class InterpTrackLinearColorBase : BmSDK.Engine.InterpTrack, BmSD
     /// </summary>
     public unsafe float CurveTension
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class InterpTrackLinearColorProp : BmSDK.Engine.InterpTrackLinear
     /// </summary>
     public unsafe BmSDK.FName PropertyName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(BmSDK.FName*)(Ptr + 132); }
+        set { *(BmSDK.FName*)(Ptr + 132) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class InterpTrackMorphWeight : BmSDK.Engine.InterpTrackFloatBase,
     /// </summary>
     public unsafe BmSDK.FName MorphNodeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(BmSDK.FName*)(Ptr + 184); }
+        set { *(BmSDK.FName*)(Ptr + 184) = value; }
     }
 }
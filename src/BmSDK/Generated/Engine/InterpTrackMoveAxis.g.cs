@@ -83,8 +83,8 @@ public partial class InterpTrackMoveAxis : BmSDK.Engine.InterpTrackFloatBase, Bm
     /// </summary>
     public unsafe BmSDK.Engine.InterpTrackMoveAxis.EInterpMoveAxis MoveAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.InterpTrackMoveAxis.EInterpMoveAxis>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(BmSDK.Engine.InterpTrackMoveAxis.EInterpMoveAxis*)(Ptr + 184); }
+        set { *(BmSDK.Engine.InterpTrackMoveAxis.EInterpMoveAxis*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -83,7 +83,7 @@ public partial class InterpTrackStereoConvergence : BmSDK.Engine.InterpTrackFloa
     /// </summary>
     public unsafe bool ResetConvergence
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 184); }
+        get { return (*(int*)(Ptr + 184) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 184) |= 1; else *(int*)(Ptr + 184) &= ~1; }
     }
 }
@@ -101,8 +101,8 @@ public partial class InterpTrackVectorMaterialParam : BmSDK.Engine.InterpTrackVe
     /// </summary>
     public unsafe BmSDK.FName ParamName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(BmSDK.FName*)(Ptr + 248); }
+        set { *(BmSDK.FName*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class InterpTrackVectorMaterialParam : BmSDK.Engine.InterpTrackVe
     /// </summary>
     public unsafe bool bNeedsMaterialRefsUpdate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 256); }
+        get { return (*(int*)(Ptr + 256) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 256) |= 1; else *(int*)(Ptr + 256) &= ~1; }
     }
 }
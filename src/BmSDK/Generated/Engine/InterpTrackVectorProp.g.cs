@@ -83,7 +83,7 @@ public partial class InterpTrackVectorProp : BmSDK.Engine.InterpTrackVectorBase,
     /// </summary>
     public unsafe BmSDK.FName PropertyName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(BmSDK.FName*)(Ptr + 232); }
+        set { *(BmSDK.FName*)(Ptr + 232) = value; }
     }
 }
@@ -101,8 +101,8 @@ public partial class K2Connector : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.K2Connector.EK2ConnectorType Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.K2Connector.EK2ConnectorType>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.Engine.K2Connector.EK2ConnectorType*)(Ptr + 60); }
+        set { *(BmSDK.Engine.K2Connector.EK2ConnectorType*)(Ptr + 60) = value; }
     }
 
     /// <summary>
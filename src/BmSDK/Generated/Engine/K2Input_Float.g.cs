@@ -83,7 +83,7 @@ public partial class K2Input_Float : BmSDK.Engine.K2Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float DefaultFloat
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(float*)(Ptr + 68); }
+        set { *(float*)(Ptr + 68) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class K2Input_Int : BmSDK.Engine.K2Input, BmSDK.IGameObject
     /// </summary>
     public unsafe int DefaultInt
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(int*)(Ptr + 68); }
+        set { *(int*)(Ptr + 68) = value; }
     }
 }
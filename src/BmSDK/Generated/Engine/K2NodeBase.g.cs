@@ -101,8 +101,8 @@ public partial class K2NodeBase : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NodePosX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(int*)(Ptr + 68); }
+        set { *(int*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class K2NodeBase : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NodePosY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(int*)(Ptr + 72); }
+        set { *(int*)(Ptr + 72) = value; }
     }
 }
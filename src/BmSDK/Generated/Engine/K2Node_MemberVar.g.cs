@@ -83,8 +83,8 @@ public partial class K2Node_MemberVar : BmSDK.Engine.K2Node_Code, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.Engine.K2Connector.EK2ConnectorType VarType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.K2Connector.EK2ConnectorType>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(BmSDK.Engine.K2Connector.EK2ConnectorType*)(Ptr + 76); }
+        set { *(BmSDK.Engine.K2Connector.EK2ConnectorType*)(Ptr + 76) = value; }
     }
 
     /// <summary>
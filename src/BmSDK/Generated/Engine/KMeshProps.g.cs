@@ -96,6 +96,8 @@ public partial class KMeshProps : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 56)]
     public partial record struct FKAggregateGeom
     {
+        [FieldOffset(52)] private int _bitfield52;
+
         /// <summary>
         /// ArrayProperty: SphereElems
         /// </summary>
@@ -135,19 +137,15 @@ public partial class KMeshProps : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: RenderInfo
         /// </summary>
-        public unsafe System.IntPtr RenderInfo
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public System.IntPtr RenderInfo;
 
         /// <summary>
         /// BoolProperty: bSkipCloseAndParallelChecks
         /// </summary>
-        public unsafe bool bSkipCloseAndParallelChecks
+        public bool bSkipCloseAndParallelChecks
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }; }
+            readonly get => (_bitfield52 & 1) != 0;
+            set { if (value) _bitfield52 |= 1; else _bitfield52 &= ~1; }
         }
     }
 
@@ -157,6 +155,8 @@ public partial class KMeshProps : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 104)]
     public partial record struct FKConvexElem
     {
+        [FieldOffset(100)] private int _bitfield100;
+
         /// <summary>
         /// ArrayProperty: VertexData
         /// </summary>
@@ -214,19 +214,15 @@ public partial class KMeshProps : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: ElemBox
         /// </summary>
-        public unsafe BmSDK.GameObject.FBox ElemBox
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FBox>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
-        }
+        [FieldOffset(72)] public BmSDK.GameObject.FBox ElemBox;
 
         /// <summary>
         /// BoolProperty: bNoRBCollision
         /// </summary>
-        public unsafe bool bNoRBCollision
+        public bool bNoRBCollision
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 100); }; }
+            readonly get => (_bitfield100 & 1) != 0;
+            set { if (value) _bitfield100 |= 1; else _bitfield100 &= ~1; }
         }
     }
 
@@ -236,49 +232,39 @@ public partial class KMeshProps : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 76)]
     public partial record struct FKSphylElem
     {
+        [FieldOffset(72)] private int _bitfield72;
+
         /// <summary>
         /// StructProperty: TM
         /// </summary>
-        public unsafe BmSDK.GameObject.FMatrix TM
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMatrix>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FMatrix TM;
 
         /// <summary>
         /// FloatProperty: Radius
         /// </summary>
-        public unsafe float Radius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float Radius;
 
         /// <summary>
         /// FloatProperty: Length
         /// </summary>
-        public unsafe float Length
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float Length;
 
         /// <summary>
         /// BoolProperty: bNoRBCollision
         /// </summary>
-        public unsafe bool bNoRBCollision
+        public bool bNoRBCollision
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }; }
+            readonly get => (_bitfield72 & 1) != 0;
+            set { if (value) _bitfield72 |= 1; else _bitfield72 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bPerPolyShape
         /// </summary>
-        public unsafe bool bPerPolyShape
+        public bool bPerPolyShape
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 72); }; }
+            readonly get => (_bitfield72 & 2) != 0;
+            set { if (value) _bitfield72 |= 2; else _bitfield72 &= ~2; }
         }
     }
 
@@ -288,76 +274,62 @@ public partial class KMeshProps : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 80)]
     public partial record struct FKBoxElem
     {
+        [FieldOffset(76)] private int _bitfield76;
+
         /// <summary>
         /// StructProperty: TM
         /// </summary>
-        public unsafe BmSDK.GameObject.FMatrix TM
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMatrix>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FMatrix TM;
 
         /// <summary>
         /// FloatProperty: X
         /// </summary>
-        public unsafe float X
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float X;
 
         /// <summary>
         /// FloatProperty: Y
         /// </summary>
-        public unsafe float Y
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public float Y;
 
         /// <summary>
         /// FloatProperty: Z
         /// </summary>
-        public unsafe float Z
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
-        }
+        [FieldOffset(72)] public float Z;
 
         /// <summary>
         /// BoolProperty: bIsAxisAligned
         /// </summary>
-        public unsafe bool bIsAxisAligned
+        public bool bIsAxisAligned
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }; }
+            readonly get => (_bitfield76 & 1) != 0;
+            set { if (value) _bitfield76 |= 1; else _bitfield76 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bHasCookedAlignmentData
         /// </summary>
-        public unsafe bool bHasCookedAlignmentData
+        public bool bHasCookedAlignmentData
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }; }
+            readonly get => (_bitfield76 & 2) != 0;
+            set { if (value) _bitfield76 |= 2; else _bitfield76 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bNoRBCollision
         /// </summary>
-        public unsafe bool bNoRBCollision
+        public bool bNoRBCollision
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }; }
+            readonly get => (_bitfield76 & 4) != 0;
+            set { if (value) _bitfield76 |= 4; else _bitfield76 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bPerPolyShape
         /// </summary>
-        public unsafe bool bPerPolyShape
+        public bool bPerPolyShape
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }; }
+            readonly get => (_bitfield76 & 8) != 0;
+            set { if (value) _bitfield76 |= 8; else _bitfield76 &= ~8; }
         }
     }
 
@@ -367,40 +339,34 @@ public partial class KMeshProps : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 72)]
     public partial record struct FKSphereElem
     {
+        [FieldOffset(68)] private int _bitfield68;
+
         /// <summary>
         /// StructProperty: TM
         /// </summary>
-        public unsafe BmSDK.GameObject.FMatrix TM
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FMatrix>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FMatrix TM;
 
         /// <summary>
         /// FloatProperty: Radius
         /// </summary>
-        public unsafe float Radius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float Radius;
 
         /// <summary>
         /// BoolProperty: bNoRBCollision
         /// </summary>
-        public unsafe bool bNoRBCollision
+        public bool bNoRBCollision
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }; }
+            readonly get => (_bitfield68 & 1) != 0;
+            set { if (value) _bitfield68 |= 1; else _bitfield68 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bPerPolyShape
         /// </summary>
-        public unsafe bool bPerPolyShape
+        public bool bPerPolyShape
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }; }
+            readonly get => (_bitfield68 & 2) != 0;
+            set { if (value) _bitfield68 |= 2; else _bitfield68 &= ~2; }
         }
     }
 }
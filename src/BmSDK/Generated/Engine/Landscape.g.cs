@@ -124,31 +124,25 @@ public partial class Landscape : BmSDK.Engine.Info, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 20)]
     public partial record struct FLandscapeLayerInfo
     {
+        [FieldOffset(12)] private int _bitfield12;
+
         /// <summary>
         /// NameProperty: LayerName
         /// </summary>
-        public unsafe BmSDK.FName LayerName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName LayerName;
 
         /// <summary>
         /// FloatProperty: Hardness
         /// </summary>
-        public unsafe float Hardness
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Hardness;
 
         /// <summary>
         /// BoolProperty: bNoWeightBlend
         /// </summary>
-        public unsafe bool bNoWeightBlend
+        public bool bNoWeightBlend
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
 
         /// <summary>
@@ -175,8 +169,8 @@ public partial class Landscape : BmSDK.Engine.Info, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxLODLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(int*)(Ptr + 432); }
+        set { *(int*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -217,8 +211,8 @@ public partial class Landscape : BmSDK.Engine.Info, BmSDK.IGameObject
     /// </summary>
     public unsafe int StaticLightingResolution
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 548); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 548); }
+        get { return *(int*)(Ptr + 548); }
+        set { *(int*)(Ptr + 548) = value; }
     }
 
     /// <summary>
@@ -226,8 +220,8 @@ public partial class Landscape : BmSDK.Engine.Info, BmSDK.IGameObject
     /// </summary>
     public unsafe float StreamingDistanceMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 552); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 552); }
+        get { return *(float*)(Ptr + 552); }
+        set { *(float*)(Ptr + 552) = value; }
     }
 
     /// <summary>
@@ -280,8 +274,8 @@ public partial class Landscape : BmSDK.Engine.Info, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr DataInterface
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 760); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 760); }
+        get { return *(System.IntPtr*)(Ptr + 760); }
+        set { *(System.IntPtr*)(Ptr + 760) = value; }
     }
 
     /// <summary>
@@ -289,8 +283,8 @@ public partial class Landscape : BmSDK.Engine.Info, BmSDK.IGameObject
     /// </summary>
     public unsafe int ComponentSizeQuads
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 764); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 764); }
+        get { return *(int*)(Ptr + 764); }
+        set { *(int*)(Ptr + 764) = value; }
     }
 
     /// <summary>
@@ -298,8 +292,8 @@ public partial class Landscape : BmSDK.Engine.Info, BmSDK.IGameObject
     /// </summary>
     public unsafe int SubsectionSizeQuads
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 768); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 768); }
+        get { return *(int*)(Ptr + 768); }
+        set { *(int*)(Ptr + 768) = value; }
     }
 
     /// <summary>
@@ -307,7 +301,7 @@ public partial class Landscape : BmSDK.Engine.Info, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumSubsections
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 772); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 772); }
+        get { return *(int*)(Ptr + 772); }
+        set { *(int*)(Ptr + 772) = value; }
     }
 }
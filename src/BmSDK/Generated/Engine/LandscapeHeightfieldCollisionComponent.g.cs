@@ -89,8 +89,8 @@ public partial class LandscapeHeightfieldCollisionComponent : BmSDK.Engine.Primi
     /// </summary>
     public unsafe int SectionBaseX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 448); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 448); }
+        get { return *(int*)(Ptr + 448); }
+        set { *(int*)(Ptr + 448) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class LandscapeHeightfieldCollisionComponent : BmSDK.Engine.Primi
     /// </summary>
     public unsafe int SectionBaseY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 452); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 452); }
+        get { return *(int*)(Ptr + 452); }
+        set { *(int*)(Ptr + 452) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class LandscapeHeightfieldCollisionComponent : BmSDK.Engine.Primi
     /// </summary>
     public unsafe int CollisionSizeQuads
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(int*)(Ptr + 456); }
+        set { *(int*)(Ptr + 456) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class LandscapeHeightfieldCollisionComponent : BmSDK.Engine.Primi
     /// </summary>
     public unsafe float CollisionScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 460); }
+        get { return *(float*)(Ptr + 460); }
+        set { *(float*)(Ptr + 460) = value; }
     }
 
     /// <summary>
@@ -143,8 +143,8 @@ public partial class LandscapeHeightfieldCollisionComponent : BmSDK.Engine.Primi
     /// </summary>
     public unsafe System.IntPtr RBHeightfield
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(System.IntPtr*)(Ptr + 488); }
+        set { *(System.IntPtr*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.Scene.ESceneDepthPriorityGroup SourceDPG
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Scene.ESceneDepthPriorityGroup>(Ptr + 372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 372); }
+        get { return *(BmSDK.Engine.Scene.ESceneDepthPriorityGroup*)(Ptr + 372); }
+        set { *(BmSDK.Engine.Scene.ESceneDepthPriorityGroup*)(Ptr + 372) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.Scene.ESceneDepthPriorityGroup ReflectionsDPG
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Scene.ESceneDepthPriorityGroup>(Ptr + 373); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 373); }
+        get { return *(BmSDK.Engine.Scene.ESceneDepthPriorityGroup*)(Ptr + 373); }
+        set { *(BmSDK.Engine.Scene.ESceneDepthPriorityGroup*)(Ptr + 373) = value; }
     }
 
     /// <summary>
@@ -125,8 +125,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float OuterCone
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 388); }
+        get { return *(float*)(Ptr + 388); }
+        set { *(float*)(Ptr + 388) = value; }
     }
 
     /// <summary>
@@ -134,8 +134,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float InnerCone
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 392); }
+        get { return *(float*)(Ptr + 392); }
+        set { *(float*)(Ptr + 392) = value; }
     }
 
     /// <summary>
@@ -143,8 +143,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ConeFudgeFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(float*)(Ptr + 396); }
+        set { *(float*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -152,8 +152,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Radius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 400); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 400); }
+        get { return *(float*)(Ptr + 400); }
+        set { *(float*)(Ptr + 400) = value; }
     }
 
     /// <summary>
@@ -167,8 +167,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseFixedRelativeBoundingBox
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 432); }
+        get { return (*(int*)(Ptr + 432) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 432) |= 1; else *(int*)(Ptr + 432) &= ~1; }
     }
 
     /// <summary>
@@ -176,8 +176,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRenderDebugLines
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 432); }
+        get { return (*(int*)(Ptr + 432) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 432) |= 2; else *(int*)(Ptr + 432) &= ~2; }
     }
 
     /// <summary>
@@ -185,8 +185,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ThumbnailImageOutOfDate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 432); }
+        get { return (*(int*)(Ptr + 432) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 432) |= 4; else *(int*)(Ptr + 432) &= ~4; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ReflectionCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 468); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 468); }
+        get { return *(int*)(Ptr + 468); }
+        set { *(int*)(Ptr + 468) = value; }
     }
 
     /// <summary>
@@ -224,8 +224,8 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ThumbnailDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 484); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 484); }
+        get { return *(float*)(Ptr + 484); }
+        set { *(float*)(Ptr + 484) = value; }
     }
 
     /// <summary>
@@ -243,158 +243,149 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 324)]
     public partial record struct FLensFlareElement
     {
+        [FieldOffset(12)] private int _bitfield12;
+        [FieldOffset(152)] private int _bitfield152;
+
         /// <summary>
         /// NameProperty: ElementName
         /// </summary>
-        public unsafe BmSDK.FName ElementName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName ElementName;
 
         /// <summary>
         /// FloatProperty: RayDistance
         /// </summary>
-        public unsafe float RayDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float RayDistance;
 
         /// <summary>
         /// BoolProperty: bIsEnabled
         /// </summary>
-        public unsafe bool bIsEnabled
+        public bool bIsEnabled
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bOcclusionPercentageInVertAlpha
         /// </summary>
-        public unsafe bool bOcclusionPercentageInVertAlpha
+        public bool bOcclusionPercentageInVertAlpha
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 2) != 0;
+            set { if (value) _bitfield12 |= 2; else _bitfield12 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bIntensityInVertAlpha
         /// </summary>
-        public unsafe bool bIntensityInVertAlpha
+        public bool bIntensityInVertAlpha
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 4) != 0;
+            set { if (value) _bitfield12 |= 4; else _bitfield12 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bSourceDistanceInVertAlpha
         /// </summary>
-        public unsafe bool bSourceDistanceInVertAlpha
+        public bool bSourceDistanceInVertAlpha
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 8) != 0;
+            set { if (value) _bitfield12 |= 8; else _bitfield12 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bRayDistanceInVertAlpha
         /// </summary>
-        public unsafe bool bRayDistanceInVertAlpha
+        public bool bRayDistanceInVertAlpha
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 16) != 0;
+            set { if (value) _bitfield12 |= 16; else _bitfield12 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: bRadialDistanceInVertAlpha
         /// </summary>
-        public unsafe bool bRadialDistanceInVertAlpha
+        public bool bRadialDistanceInVertAlpha
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 32) != 0;
+            set { if (value) _bitfield12 |= 32; else _bitfield12 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: bInvertOcclusionPercentage
         /// </summary>
-        public unsafe bool bInvertOcclusionPercentage
+        public bool bInvertOcclusionPercentage
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 64) != 0;
+            set { if (value) _bitfield12 |= 64; else _bitfield12 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: bInvertIntensity
         /// </summary>
-        public unsafe bool bInvertIntensity
+        public bool bInvertIntensity
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 128) != 0;
+            set { if (value) _bitfield12 |= 128; else _bitfield12 &= ~128; }
         }
 
         /// <summary>
         /// BoolProperty: bInvertSourceDistance
         /// </summary>
-        public unsafe bool bInvertSourceDistance
+        public bool bInvertSourceDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 256) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 256) != 0;
+            set { if (value) _bitfield12 |= 256; else _bitfield12 &= ~256; }
         }
 
         /// <summary>
         /// BoolProperty: bInvertRayDistance
         /// </summary>
-        public unsafe bool bInvertRayDistance
+        public bool bInvertRayDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 512) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 512) != 0;
+            set { if (value) _bitfield12 |= 512; else _bitfield12 &= ~512; }
         }
 
         /// <summary>
         /// BoolProperty: bInvertRadialDistance
         /// </summary>
-        public unsafe bool bInvertRadialDistance
+        public bool bInvertRadialDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1024) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1024) != 0;
+            set { if (value) _bitfield12 |= 1024; else _bitfield12 &= ~1024; }
         }
 
         /// <summary>
         /// BoolProperty: bUseSourceDistance
         /// </summary>
-        public unsafe bool bUseSourceDistance
+        public bool bUseSourceDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 2048) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 2048) != 0;
+            set { if (value) _bitfield12 |= 2048; else _bitfield12 &= ~2048; }
         }
 
         /// <summary>
         /// BoolProperty: bNormalizeRadialDistance
         /// </summary>
-        public unsafe bool bNormalizeRadialDistance
+        public bool bNormalizeRadialDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 4096) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 4096) != 0;
+            set { if (value) _bitfield12 |= 4096; else _bitfield12 &= ~4096; }
         }
 
         /// <summary>
         /// BoolProperty: bModulateColorBySource
         /// </summary>
-        public unsafe bool bModulateColorBySource
+        public bool bModulateColorBySource
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 8192) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 8192) != 0;
+            set { if (value) _bitfield12 |= 8192; else _bitfield12 &= ~8192; }
         }
 
         /// <summary>
         /// StructProperty: Size
         /// </summary>
-        public unsafe System.Numerics.Vector3 Size
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 Size;
 
         /// <summary>
         /// ArrayProperty: LFMaterials
@@ -408,101 +399,61 @@ public partial class LensFlare : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: LFMaterialIndex
         /// </summary>
-        public unsafe BmSDK.DistributionFloat.FRawDistributionFloat LFMaterialIndex
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionFloat.FRawDistributionFloat>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public BmSDK.DistributionFloat.FRawDistributionFloat LFMaterialIndex;
 
         /// <summary>
         /// StructProperty: Scaling
         /// </summary>
-        public unsafe BmSDK.DistributionFloat.FRawDistributionFloat Scaling
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionFloat.FRawDistributionFloat>(Ptr + 68); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }; }
-        }
+        [FieldOffset(68)] public BmSDK.DistributionFloat.FRawDistributionFloat Scaling;
 
         /// <summary>
         /// StructProperty: AxisScaling
         /// </summary>
-        public unsafe BmSDK.DistributionVector.FRawDistributionVector AxisScaling
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.FRawDistributionVector>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public BmSDK.DistributionVector.FRawDistributionVector AxisScaling;
 
         /// <summary>
         /// StructProperty: Rotation
         /// </summary>
-        public unsafe BmSDK.DistributionFloat.FRawDistributionFloat Rotation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionFloat.FRawDistributionFloat>(Ptr + 124); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }; }
-        }
+        [FieldOffset(124)] public BmSDK.DistributionFloat.FRawDistributionFloat Rotation;
 
         /// <summary>
         /// BoolProperty: bOrientTowardsSource
         /// </summary>
-        public unsafe bool bOrientTowardsSource
+        public bool bOrientTowardsSource
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }; }
+            readonly get => (_bitfield152 & 1) != 0;
+            set { if (value) _bitfield152 |= 1; else _bitfield152 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: Color
         /// </summary>
-        public unsafe BmSDK.DistributionVector.FRawDistributionVector Color
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.FRawDistributionVector>(Ptr + 156); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }; }
-        }
+        [FieldOffset(156)] public BmSDK.DistributionVector.FRawDistributionVector Color;
 
         /// <summary>
         /// StructProperty: Alpha
         /// </summary>
-        public unsafe BmSDK.DistributionFloat.FRawDistributionFloat Alpha
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionFloat.FRawDistributionFloat>(Ptr + 184); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }; }
-        }
+        [FieldOffset(184)] public BmSDK.DistributionFloat.FRawDistributionFloat Alpha;
 
         /// <summary>
         /// StructProperty: Offset
         /// </summary>
-        public unsafe BmSDK.DistributionVector.FRawDistributionVector Offset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.FRawDistributionVector>(Ptr + 212); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }; }
-        }
+        [FieldOffset(212)] public BmSDK.DistributionVector.FRawDistributionVector Offset;
 
         /// <summary>
         /// StructProperty: DistMap_Scale
         /// </summary>
-        public unsafe BmSDK.DistributionVector.FRawDistributionVector DistMap_Scale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.FRawDistributionVector>(Ptr + 240); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }; }
-        }
+        [FieldOffset(240)] public BmSDK.DistributionVector.FRawDistributionVector DistMap_Scale;
 
         /// <summary>
         /// StructProperty: DistMap_Color
         /// </summary>
-        public unsafe BmSDK.DistributionVector.FRawDistributionVector DistMap_Color
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionVector.FRawDistributionVector>(Ptr + 268); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }; }
-        }
+        [FieldOffset(268)] public BmSDK.DistributionVector.FRawDistributionVector DistMap_Color;
 
         /// <summary>
         /// StructProperty: DistMap_Alpha
         /// </summary>
-        public unsafe BmSDK.DistributionFloat.FRawDistributionFloat DistMap_Alpha
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.DistributionFloat.FRawDistributionFloat>(Ptr + 296); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }; }
-        }
+        [FieldOffset(296)] public BmSDK.DistributionFloat.FRawDistributionFloat DistMap_Alpha;
     }
 
     /// <summary>
@@ -140,8 +140,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName PackageName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -179,8 +179,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 1; else *(int*)(Ptr + 92) &= ~1; }
     }
 
     /// <summary>
@@ -188,8 +188,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsLevelHidden
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 2; else *(int*)(Ptr + 92) &= ~2; }
     }
 
     /// <summary>
@@ -197,8 +197,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasLoadRequestPending
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 4; else *(int*)(Ptr + 92) &= ~4; }
     }
 
     /// <summary>
@@ -206,8 +206,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasUnloadRequestPending
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 8; else *(int*)(Ptr + 92) &= ~8; }
     }
 
     /// <summary>
@@ -215,8 +215,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShouldBeVisibleInEditor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 16; else *(int*)(Ptr + 92) &= ~16; }
     }
 
     /// <summary>
@@ -224,8 +224,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bBoundingBoxVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 32; else *(int*)(Ptr + 92) &= ~32; }
     }
 
     /// <summary>
@@ -233,8 +233,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLocked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 64; else *(int*)(Ptr + 92) &= ~64; }
     }
 
     /// <summary>
@@ -242,8 +242,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsFullyStatic
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 128; else *(int*)(Ptr + 92) &= ~128; }
     }
 
     /// <summary>
@@ -251,8 +251,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bTransferToNextPersistentMap
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 256; else *(int*)(Ptr + 92) &= ~256; }
     }
 
     /// <summary>
@@ -260,8 +260,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShouldBeLoaded
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 512; else *(int*)(Ptr + 92) &= ~512; }
     }
 
     /// <summary>
@@ -269,8 +269,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShouldBeVisible
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 1024; else *(int*)(Ptr + 92) &= ~1024; }
     }
 
     /// <summary>
@@ -278,8 +278,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShouldBeLevelHidden
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 2048; else *(int*)(Ptr + 92) &= ~2048; }
     }
 
     /// <summary>
@@ -287,8 +287,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShouldBlockOnLoad
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 4096; else *(int*)(Ptr + 92) &= ~4096; }
     }
 
     /// <summary>
@@ -296,8 +296,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShouldBeVisibleInLevelBrowser
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 8192; else *(int*)(Ptr + 92) &= ~8192; }
     }
 
     /// <summary>
@@ -305,8 +305,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bExpandedInLevelBrowser
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 16384; else *(int*)(Ptr + 92) &= ~16384; }
     }
 
     /// <summary>
@@ -314,8 +314,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsParent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 32768; else *(int*)(Ptr + 92) &= ~32768; }
     }
 
     /// <summary>
@@ -323,8 +323,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsChild
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 65536; else *(int*)(Ptr + 92) &= ~65536; }
     }
 
     /// <summary>
@@ -332,8 +332,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDrawOnLevelStatusMap
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 131072; else *(int*)(Ptr + 92) &= ~131072; }
     }
 
     /// <summary>
@@ -341,8 +341,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsRequestingUnloadAndRemoval
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 262144; else *(int*)(Ptr + 92) &= ~262144; }
     }
 
     /// <summary>
@@ -350,8 +350,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bExcludeFromPathBuilding
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 524288; else *(int*)(Ptr + 92) &= ~524288; }
     }
 
     /// <summary>
@@ -359,8 +359,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bExcludeFromPathBuilding_Old_bShouldBeVisibleInEditor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 1048576; else *(int*)(Ptr + 92) &= ~1048576; }
     }
 
     /// <summary>
@@ -368,8 +368,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ForceShadowVolumes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 2097152; else *(int*)(Ptr + 92) &= ~2097152; }
     }
 
     /// <summary>
@@ -377,8 +377,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHighPriorityLoadRequest
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 4194304; else *(int*)(Ptr + 92) &= ~4194304; }
     }
 
     /// <summary>
@@ -386,8 +386,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsChapterLevel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 8388608; else *(int*)(Ptr + 92) &= ~8388608; }
     }
 
     /// <summary>
@@ -410,8 +410,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinTimeBetweenVolumeUnloadRequests
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(float*)(Ptr + 112); }
+        set { *(float*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -419,8 +419,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float LastVolumeUnloadRequestTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(float*)(Ptr + 116); }
+        set { *(float*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -437,8 +437,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.LevelStreaming.ELightingGroup LightingGroup
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.LevelStreaming.ELightingGroup>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(BmSDK.Engine.LevelStreaming.ELightingGroup*)(Ptr + 132); }
+        set { *(BmSDK.Engine.LevelStreaming.ELightingGroup*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -446,8 +446,8 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.LevelStreaming.ENavMeshGroup NavMeshGroup
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.LevelStreaming.ENavMeshGroup>(Ptr + 133); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 133); }
+        get { return *(BmSDK.Engine.LevelStreaming.ENavMeshGroup*)(Ptr + 133); }
+        set { *(BmSDK.Engine.LevelStreaming.ENavMeshGroup*)(Ptr + 133) = value; }
     }
 
     /// <summary>
@@ -478,23 +478,23 @@ public partial class LevelStreaming : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int GridPosition_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(int*)(Ptr + 152); }
+        set { *(int*)(Ptr + 152) = value; }
     }
     /// <summary>
     /// IntProperty: GridPosition
     /// </summary>
     public unsafe int GridPosition_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(int*)(Ptr + 156); }
+        set { *(int*)(Ptr + 156) = value; }
     }
     /// <summary>
     /// IntProperty: GridPosition
     /// </summary>
     public unsafe int GridPosition_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(int*)(Ptr + 160); }
+        set { *(int*)(Ptr + 160) = value; }
     }
 }
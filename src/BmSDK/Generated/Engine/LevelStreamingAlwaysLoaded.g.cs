@@ -83,7 +83,7 @@ public partial class LevelStreamingAlwaysLoaded : BmSDK.Engine.LevelStreaming, B
     /// </summary>
     public unsafe bool bIsProceduralBuildingLODLevel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 164) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 164); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 164); }
+        get { return (*(int*)(Ptr + 164) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 164) |= 1; else *(int*)(Ptr + 164) &= ~1; }
     }
 }
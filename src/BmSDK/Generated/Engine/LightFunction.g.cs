@@ -98,7 +98,7 @@ public partial class LightFunction : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DisabledBrightness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 }
@@ -73,19 +73,38 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<LocalMessage>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PartiallyDuplicatesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct PartiallyDuplicates_Params
+    {
+        [FieldOffset(0)] public int Switch1;
+        [FieldOffset(4)] public int Switch2;
+        [FieldOffset(8)] public nint OptionalObject1;
+        [FieldOffset(12)] public nint OptionalObject2;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PartiallyDuplicates
     /// </summary>
     public unsafe static bool PartiallyDuplicates(int Switch1, int Switch2, BmSDK.GameObject OptionalObject1, BmSDK.GameObject OptionalObject2)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.PartiallyDuplicates", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch1, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch2, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject1, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject2, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_PartiallyDuplicatesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.PartiallyDuplicates", true);
+        var parms = new PartiallyDuplicates_Params();
+        parms.Switch1 = Switch1;
+        parms.Switch2 = Switch2;
+        parms.OptionalObject1 = OptionalObject1?.Ptr ?? 0;
+        parms.OptionalObject2 = OptionalObject2?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsConsoleMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsConsoleMessage_Params
+    {
+        [FieldOffset(0)] public int Switch;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -93,11 +112,19 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static bool IsConsoleMessage(int Switch)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.IsConsoleMessage", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsConsoleMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.IsConsoleMessage", true);
+        var parms = new IsConsoleMessage_Params();
+        parms.Switch = Switch;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetLifeTimeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetLifeTime_Params
+    {
+        [FieldOffset(0)] public int Switch;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -105,11 +132,22 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static float GetLifeTime(int Switch)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetLifeTime", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetLifeTimeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetLifeTime", true);
+        var parms = new GetLifeTime_Params();
+        parms.Switch = Switch;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetFontSizeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetFontSize_Params
+    {
+        [FieldOffset(0)] public int Switch;
+        [FieldOffset(4)] public nint RelatedPRI1;
+        [FieldOffset(8)] public nint RelatedPRI2;
+        [FieldOffset(12)] public nint LocalPlayer;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -117,14 +155,23 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static int GetFontSize(int Switch, BmSDK.Engine.PlayerReplicationInfo RelatedPRI1, BmSDK.Engine.PlayerReplicationInfo RelatedPRI2, BmSDK.Engine.PlayerReplicationInfo LocalPlayer)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetFontSize", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI1, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI2, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocalPlayer, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 16);
+        var funcManaged = s_GetFontSizeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetFontSize", true);
+        var parms = new GetFontSize_Params();
+        parms.Switch = Switch;
+        parms.RelatedPRI1 = RelatedPRI1?.Ptr ?? 0;
+        parms.RelatedPRI2 = RelatedPRI2?.Ptr ?? 0;
+        parms.LocalPlayer = LocalPlayer?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetPos_Params
+    {
+        [FieldOffset(0)] public int Switch;
+        [FieldOffset(4)] public nint myHUD;
+        [FieldOffset(8)] public float ReturnValue;
     }
 
     /// <summary>
@@ -132,12 +179,23 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static float GetPos(int Switch, BmSDK.Engine.HUD myHUD)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetPos", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(myHUD, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_GetPosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetPos", true);
+        var parms = new GetPos_Params();
+        parms.Switch = Switch;
+        parms.myHUD = myHUD?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetColorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetColor_Params
+    {
+        [FieldOffset(0)] public int Switch;
+        [FieldOffset(4)] public nint RelatedPRI_1;
+        [FieldOffset(8)] public nint RelatedPRI_2;
+        [FieldOffset(12)] public nint OptionalObject;
+        [FieldOffset(16)] public BmSDK.GameObject.FColor ReturnValue;
     }
 
     /// <summary>
@@ -145,14 +203,22 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.GameObject.FColor GetColor(int Switch = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_1 = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_2 = default, BmSDK.GameObject OptionalObject = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetColor", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_1, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_2, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(paramsPtr + 16);
+        var funcManaged = s_GetColorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetColor", true);
+        var parms = new GetColor_Params();
+        parms.Switch = Switch;
+        parms.RelatedPRI_1 = RelatedPRI_1?.Ptr ?? 0;
+        parms.RelatedPRI_2 = RelatedPRI_2?.Ptr ?? 0;
+        parms.OptionalObject = OptionalObject?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetConsoleColorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetConsoleColor_Params
+    {
+        [FieldOffset(0)] public nint RelatedPRI_1;
+        [FieldOffset(4)] public BmSDK.GameObject.FColor ReturnValue;
     }
 
     /// <summary>
@@ -160,11 +226,23 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.GameObject.FColor GetConsoleColor(BmSDK.Engine.PlayerReplicationInfo RelatedPRI_1)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetConsoleColor", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_1, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(paramsPtr + 4);
+        var funcManaged = s_GetConsoleColorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetConsoleColor", true);
+        var parms = new GetConsoleColor_Params();
+        parms.RelatedPRI_1 = RelatedPRI_1?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetString_Params
+    {
+        [FieldOffset(0)] public int Switch;
+        [FieldOffset(4)] public int bPRI1HUD;
+        [FieldOffset(8)] public nint RelatedPRI_1;
+        [FieldOffset(12)] public nint RelatedPRI_2;
+        [FieldOffset(16)] public nint OptionalObject;
+        [FieldOffset(20)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -172,15 +250,26 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.FString GetString(int Switch = default, bool bPRI1HUD = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_1 = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_2 = default, BmSDK.GameObject OptionalObject = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetString", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPRI1HUD, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_1, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_2, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 20);
+        var funcManaged = s_GetStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.GetString", true);
+        var parms = new GetString_Params();
+        parms.Switch = Switch;
+        parms.bPRI1HUD = bPRI1HUD ? 1 : 0;
+        parms.RelatedPRI_1 = RelatedPRI_1?.Ptr ?? 0;
+        parms.RelatedPRI_2 = RelatedPRI_2?.Ptr ?? 0;
+        parms.OptionalObject = OptionalObject?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ClientReceiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ClientReceive_Params
+    {
+        [FieldOffset(0)] public nint P;
+        [FieldOffset(4)] public int Switch;
+        [FieldOffset(8)] public nint RelatedPRI_1;
+        [FieldOffset(12)] public nint RelatedPRI_2;
+        [FieldOffset(16)] public nint OptionalObject;
     }
 
     /// <summary>
@@ -188,14 +277,14 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe static void ClientReceive(BmSDK.Engine.PlayerController P, int Switch = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_1 = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_2 = default, BmSDK.GameObject OptionalObject = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.ClientReceive", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(P, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_1, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_2, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientReceiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.LocalMessage.ClientReceive", true);
+        var parms = new ClientReceive_Params();
+        parms.P = P?.Ptr ?? 0;
+        parms.Switch = Switch;
+        parms.RelatedPRI_1 = RelatedPRI_1?.Ptr ?? 0;
+        parms.RelatedPRI_2 = RelatedPRI_2?.Ptr ?? 0;
+        parms.OptionalObject = OptionalObject?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -204,8 +293,8 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsSpecial
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1; else *(int*)(Ptr + 44) &= ~1; }
     }
 
     /// <summary>
@@ -213,8 +302,8 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsUnique
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 2; else *(int*)(Ptr + 44) &= ~2; }
     }
 
     /// <summary>
@@ -222,8 +311,8 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsPartiallyUnique
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 4; else *(int*)(Ptr + 44) &= ~4; }
     }
 
     /// <summary>
@@ -231,8 +320,8 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsConsoleMessage
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 8; else *(int*)(Ptr + 44) &= ~8; }
     }
 
     /// <summary>
@@ -240,8 +329,8 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bBeep
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 16; else *(int*)(Ptr + 44) &= ~16; }
     }
 
     /// <summary>
@@ -249,8 +338,8 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCountInstances
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 32; else *(int*)(Ptr + 44) &= ~32; }
     }
 
     /// <summary>
@@ -258,8 +347,8 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Lifetime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -273,8 +362,8 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float PosY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -282,7 +371,7 @@ public partial class LocalMessage : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int FontSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(int*)(Ptr + 60); }
+        set { *(int*)(Ptr + 60) = value; }
     }
 }
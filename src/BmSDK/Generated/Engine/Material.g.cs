@@ -112,8 +112,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe int PhysMaterialMaskUVChannel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(int*)(Ptr + 100); }
+        set { *(int*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -139,8 +139,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.Engine.Material.EParticleDownsampling NvidiaParticleDownsampling
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Material.EParticleDownsampling>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(BmSDK.Engine.Material.EParticleDownsampling*)(Ptr + 112); }
+        set { *(BmSDK.Engine.Material.EParticleDownsampling*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -148,8 +148,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.Engine.Material.MatLoadedPhysMaterial PhysMaterialOverrideDropDown
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Material.MatLoadedPhysMaterial>(Ptr + 113); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 113); }
+        get { return *(BmSDK.Engine.Material.MatLoadedPhysMaterial*)(Ptr + 113); }
+        set { *(BmSDK.Engine.Material.MatLoadedPhysMaterial*)(Ptr + 113) = value; }
     }
 
     /// <summary>
@@ -157,8 +157,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.Engine.EngineTypes.EBlendMode BlendMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.EngineTypes.EBlendMode>(Ptr + 114); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 114); }
+        get { return *(BmSDK.Engine.EngineTypes.EBlendMode*)(Ptr + 114); }
+        set { *(BmSDK.Engine.EngineTypes.EBlendMode*)(Ptr + 114) = value; }
     }
 
     /// <summary>
@@ -166,8 +166,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe BmSDK.Engine.EngineTypes.EMaterialLightingModel LightingModel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.EngineTypes.EMaterialLightingModel>(Ptr + 115); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 115); }
+        get { return *(BmSDK.Engine.EngineTypes.EMaterialLightingModel*)(Ptr + 115); }
+        set { *(BmSDK.Engine.EngineTypes.EMaterialLightingModel*)(Ptr + 115) = value; }
     }
 
     /// <summary>
@@ -175,8 +175,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool PhysMaterialOverrideDropDownUPDATELIST
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 1; else *(int*)(Ptr + 116) &= ~1; }
     }
 
     /// <summary>
@@ -184,8 +184,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool EnableSubsurfaceScattering
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 2; else *(int*)(Ptr + 116) &= ~2; }
     }
 
     /// <summary>
@@ -193,8 +193,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool TwoSided
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 4; else *(int*)(Ptr + 116) &= ~4; }
     }
 
     /// <summary>
@@ -202,8 +202,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool TwoSidedSeparatePass
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 8; else *(int*)(Ptr + 116) &= ~8; }
     }
 
     /// <summary>
@@ -211,8 +211,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bSpecularBlinnPhong
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 16; else *(int*)(Ptr + 116) &= ~16; }
     }
 
     /// <summary>
@@ -220,8 +220,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bSpecularConserveEnergy
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 32; else *(int*)(Ptr + 116) &= ~32; }
     }
 
     /// <summary>
@@ -229,8 +229,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bSpecularMaskByShading
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 64; else *(int*)(Ptr + 116) &= ~64; }
     }
 
     /// <summary>
@@ -238,8 +238,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool SortWithSceneTextureSampleMaterials
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 128; else *(int*)(Ptr + 116) &= ~128; }
     }
 
     /// <summary>
@@ -247,8 +247,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDisableTwoSidedLighting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 256; else *(int*)(Ptr + 116) &= ~256; }
     }
 
     /// <summary>
@@ -256,8 +256,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bDisableDepthTest
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 512; else *(int*)(Ptr + 116) &= ~512; }
     }
 
     /// <summary>
@@ -265,8 +265,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowFog
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 1024; else *(int*)(Ptr + 116) &= ~1024; }
     }
 
     /// <summary>
@@ -274,8 +274,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bTranslucencyReceiveDominantShadowsFromStatic
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 2048; else *(int*)(Ptr + 116) &= ~2048; }
     }
 
     /// <summary>
@@ -283,8 +283,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bTranslucencyInheritDominantShadowsFromOpaque
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 4096; else *(int*)(Ptr + 116) &= ~4096; }
     }
 
     /// <summary>
@@ -292,8 +292,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowTranslucencyDoF
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 8192; else *(int*)(Ptr + 116) &= ~8192; }
     }
 
     /// <summary>
@@ -301,8 +301,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUseOneLayerDistortion
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 16384; else *(int*)(Ptr + 116) &= ~16384; }
     }
 
     /// <summary>
@@ -310,8 +310,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUseLitTranslucencyDepthPass
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 32768; else *(int*)(Ptr + 116) &= ~32768; }
     }
 
     /// <summary>
@@ -319,8 +319,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUseLitTranslucencyPostRenderDepthPass
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 65536; else *(int*)(Ptr + 116) &= ~65536; }
     }
 
     /// <summary>
@@ -328,8 +328,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bCastLitTranslucencyShadowAsMasked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 131072; else *(int*)(Ptr + 116) &= ~131072; }
     }
 
     /// <summary>
@@ -337,8 +337,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bLockUsageFlags
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 262144; else *(int*)(Ptr + 116) &= ~262144; }
     }
 
     /// <summary>
@@ -346,8 +346,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedAsLightFunction
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 524288; else *(int*)(Ptr + 116) &= ~524288; }
     }
 
     /// <summary>
@@ -355,8 +355,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithFogVolumes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 1048576; else *(int*)(Ptr + 116) &= ~1048576; }
     }
 
     /// <summary>
@@ -364,8 +364,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithVertexLighting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 2097152; else *(int*)(Ptr + 116) &= ~2097152; }
     }
 
     /// <summary>
@@ -373,8 +373,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithStaticModulatedShadows
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 4194304; else *(int*)(Ptr + 116) &= ~4194304; }
     }
 
     /// <summary>
@@ -382,8 +382,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithPerVertexRockAtmosFog
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 8388608; else *(int*)(Ptr + 116) &= ~8388608; }
     }
 
     /// <summary>
@@ -391,8 +391,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithLightEnvironment
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 16777216; else *(int*)(Ptr + 116) &= ~16777216; }
     }
 
     /// <summary>
@@ -400,8 +400,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bRecievesDynamicDirectionalLights
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 33554432; else *(int*)(Ptr + 116) &= ~33554432; }
     }
 
     /// <summary>
@@ -409,8 +409,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bRecievesDynamicSpotLights
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 67108864; else *(int*)(Ptr + 116) &= ~67108864; }
     }
 
     /// <summary>
@@ -418,8 +418,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bRecievesDynamicPointLights
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 134217728; else *(int*)(Ptr + 116) &= ~134217728; }
     }
 
     /// <summary>
@@ -427,8 +427,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithStaticMesh
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 268435456; else *(int*)(Ptr + 116) &= ~268435456; }
     }
 
     /// <summary>
@@ -436,8 +436,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedAsSpecialEngineMaterial
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 536870912; else *(int*)(Ptr + 116) &= ~536870912; }
     }
 
     /// <summary>
@@ -445,8 +445,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithSkeletalMesh
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 1073741824; else *(int*)(Ptr + 116) &= ~1073741824; }
     }
 
     /// <summary>
@@ -454,8 +454,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithTerrain
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= -2147483648; else *(int*)(Ptr + 116) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -463,8 +463,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithLandscape
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 1; else *(int*)(Ptr + 120) &= ~1; }
     }
 
     /// <summary>
@@ -472,8 +472,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithFracturedMeshes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 2; else *(int*)(Ptr + 120) &= ~2; }
     }
 
     /// <summary>
@@ -481,8 +481,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithParticleSystem
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 4; else *(int*)(Ptr + 120) &= ~4; }
     }
 
     /// <summary>
@@ -490,8 +490,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithParticleSprites
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 8; else *(int*)(Ptr + 120) &= ~8; }
     }
 
     /// <summary>
@@ -499,8 +499,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithBeamTrails
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 16; else *(int*)(Ptr + 120) &= ~16; }
     }
 
     /// <summary>
@@ -508,8 +508,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithParticleSubUV
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 32; else *(int*)(Ptr + 120) &= ~32; }
     }
 
     /// <summary>
@@ -517,8 +517,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithSpeedTree
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 64; else *(int*)(Ptr + 120) &= ~64; }
     }
 
     /// <summary>
@@ -526,8 +526,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithStaticLighting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 128; else *(int*)(Ptr + 120) &= ~128; }
     }
 
     /// <summary>
@@ -535,8 +535,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithLensFlare
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 256; else *(int*)(Ptr + 120) &= ~256; }
     }
 
     /// <summary>
@@ -544,8 +544,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithGammaCorrection
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 512; else *(int*)(Ptr + 120) &= ~512; }
     }
 
     /// <summary>
@@ -553,8 +553,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithInstancedMeshParticles
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 1024; else *(int*)(Ptr + 120) &= ~1024; }
     }
 
     /// <summary>
@@ -562,8 +562,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithFluidSurfaces
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 2048; else *(int*)(Ptr + 120) &= ~2048; }
     }
 
     /// <summary>
@@ -571,8 +571,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithMaterialEffect
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 4096; else *(int*)(Ptr + 120) &= ~4096; }
     }
 
     /// <summary>
@@ -580,8 +580,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithMorphTargets
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 8192; else *(int*)(Ptr + 120) &= ~8192; }
     }
 
     /// <summary>
@@ -589,8 +589,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithRadialBlur
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 16384; else *(int*)(Ptr + 120) &= ~16384; }
     }
 
     /// <summary>
@@ -598,8 +598,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithInstancedMeshes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 32768; else *(int*)(Ptr + 120) &= ~32768; }
     }
 
     /// <summary>
@@ -607,8 +607,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithSplineMeshes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 65536; else *(int*)(Ptr + 120) &= ~65536; }
     }
 
     /// <summary>
@@ -616,8 +616,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithAPEXMeshes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 131072; else *(int*)(Ptr + 120) &= ~131072; }
     }
 
     /// <summary>
@@ -625,8 +625,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithApexSprites
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 262144; else *(int*)(Ptr + 120) &= ~262144; }
     }
 
     /// <summary>
@@ -634,8 +634,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithScreenDoorFade
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 524288; else *(int*)(Ptr + 120) &= ~524288; }
     }
 
     /// <summary>
@@ -643,8 +643,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithD3D11Tessellation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 1048576; else *(int*)(Ptr + 120) &= ~1048576; }
     }
 
     /// <summary>
@@ -652,8 +652,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithTessellationFlat
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 2097152; else *(int*)(Ptr + 120) &= ~2097152; }
     }
 
     /// <summary>
@@ -661,8 +661,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithTessellationPN
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 4194304; else *(int*)(Ptr + 120) &= ~4194304; }
     }
 
     /// <summary>
@@ -670,8 +670,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithTessellationPhong
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 8388608; else *(int*)(Ptr + 120) &= ~8388608; }
     }
 
     /// <summary>
@@ -679,8 +679,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithTessellationMeshDicing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 16777216; else *(int*)(Ptr + 120) &= ~16777216; }
     }
 
     /// <summary>
@@ -688,8 +688,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsedWithTessellationWaterTightNormals
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 33554432; else *(int*)(Ptr + 120) &= ~33554432; }
     }
 
     /// <summary>
@@ -697,8 +697,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUseImageBasedReflections
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 67108864; else *(int*)(Ptr + 120) &= ~67108864; }
     }
 
     /// <summary>
@@ -706,8 +706,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool Wireframe
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 134217728; else *(int*)(Ptr + 120) &= ~134217728; }
     }
 
     /// <summary>
@@ -715,8 +715,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bPerPixelCameraVector
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 268435456; else *(int*)(Ptr + 120) &= ~268435456; }
     }
 
     /// <summary>
@@ -724,8 +724,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bAllowLightmapSpecular
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 536870912; else *(int*)(Ptr + 120) &= ~536870912; }
     }
 
     /// <summary>
@@ -733,8 +733,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool CanStripNormalsAndTangents
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 1073741824; else *(int*)(Ptr + 120) &= ~1073741824; }
     }
 
     /// <summary>
@@ -742,8 +742,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool CanStripVertexColours
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= -2147483648; else *(int*)(Ptr + 120) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -751,8 +751,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool UseFastLODRendering
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 1; else *(int*)(Ptr + 124) &= ~1; }
     }
 
     /// <summary>
@@ -760,8 +760,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bIsFallbackMaterial
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 2; else *(int*)(Ptr + 124) &= ~2; }
     }
 
     /// <summary>
@@ -769,8 +769,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bUsesDistortion
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 4; else *(int*)(Ptr + 124) &= ~4; }
     }
 
     /// <summary>
@@ -778,8 +778,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bIsMasked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 8; else *(int*)(Ptr + 124) &= ~8; }
     }
 
     /// <summary>
@@ -787,8 +787,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe bool bIsPreviewMaterial
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 16; else *(int*)(Ptr + 124) &= ~16; }
     }
 
     /// <summary>
@@ -844,8 +844,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe float OpacityMaskClipValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 424); }
+        get { return *(float*)(Ptr + 424); }
+        set { *(float*)(Ptr + 424) = value; }
     }
 
     /// <summary>
@@ -853,8 +853,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe float OpacityMaskClipValuePostDepth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 428); }
+        get { return *(float*)(Ptr + 428); }
+        set { *(float*)(Ptr + 428) = value; }
     }
 
     /// <summary>
@@ -1006,8 +1006,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe int MaxBonesPerBatch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1252); }
+        get { return *(int*)(Ptr + 1252); }
+        set { *(int*)(Ptr + 1252) = value; }
     }
 
     /// <summary>
@@ -1020,16 +1020,16 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe System.IntPtr MaterialResources_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 1256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1256); }
+        get { return *(System.IntPtr*)(Ptr + 1256); }
+        set { *(System.IntPtr*)(Ptr + 1256) = value; }
     }
     /// <summary>
     /// StructProperty: MaterialResources
     /// </summary>
     public unsafe System.IntPtr MaterialResources_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 1260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1260); }
+        get { return *(System.IntPtr*)(Ptr + 1260); }
+        set { *(System.IntPtr*)(Ptr + 1260) = value; }
     }
 
     /// <summary>
@@ -1042,24 +1042,24 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe System.IntPtr DefaultMaterialInstances_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 1264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1264); }
+        get { return *(System.IntPtr*)(Ptr + 1264); }
+        set { *(System.IntPtr*)(Ptr + 1264) = value; }
     }
     /// <summary>
     /// StructProperty: DefaultMaterialInstances
     /// </summary>
     public unsafe System.IntPtr DefaultMaterialInstances_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 1268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1268); }
+        get { return *(System.IntPtr*)(Ptr + 1268); }
+        set { *(System.IntPtr*)(Ptr + 1268) = value; }
     }
     /// <summary>
     /// StructProperty: DefaultMaterialInstances
     /// </summary>
     public unsafe System.IntPtr DefaultMaterialInstances_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 1272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1272); }
+        get { return *(System.IntPtr*)(Ptr + 1272); }
+        set { *(System.IntPtr*)(Ptr + 1272) = value; }
     }
 
     /// <summary>
@@ -1067,8 +1067,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe int EditorX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1276); }
+        get { return *(int*)(Ptr + 1276); }
+        set { *(int*)(Ptr + 1276) = value; }
     }
 
     /// <summary>
@@ -1076,8 +1076,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe int EditorY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1280); }
+        get { return *(int*)(Ptr + 1280); }
+        set { *(int*)(Ptr + 1280) = value; }
     }
 
     /// <summary>
@@ -1085,8 +1085,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe int EditorPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1284); }
+        get { return *(int*)(Ptr + 1284); }
+        set { *(int*)(Ptr + 1284) = value; }
     }
 
     /// <summary>
@@ -1094,8 +1094,8 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     /// </summary>
     public unsafe int EditorYaw
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1288); }
+        get { return *(int*)(Ptr + 1288); }
+        set { *(int*)(Ptr + 1288) = value; }
     }
 
     /// <summary>
@@ -1158,32 +1158,26 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     [StructLayout(LayoutKind.Explicit, Size = 40)]
     public partial record struct FVector2MaterialInput
     {
+        [FieldOffset(28)] private int _bitfield28;
+
         /// <summary>
         /// BoolProperty: UseConstant
         /// </summary>
-        public unsafe bool UseConstant
+        public bool UseConstant
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 28); }; }
+            readonly get => (_bitfield28 & 1) != 0;
+            set { if (value) _bitfield28 |= 1; else _bitfield28 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: ConstantX
         /// </summary>
-        public unsafe float ConstantX
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float ConstantX;
 
         /// <summary>
         /// FloatProperty: ConstantY
         /// </summary>
-        public unsafe float ConstantY
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public float ConstantY;
     }
 
     /// <summary>
@@ -1192,23 +1186,21 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     [StructLayout(LayoutKind.Explicit, Size = 44)]
     public partial record struct FVectorMaterialInput
     {
+        [FieldOffset(28)] private int _bitfield28;
+
         /// <summary>
         /// BoolProperty: UseConstant
         /// </summary>
-        public unsafe bool UseConstant
+        public bool UseConstant
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 28); }; }
+            readonly get => (_bitfield28 & 1) != 0;
+            set { if (value) _bitfield28 |= 1; else _bitfield28 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: Constant
         /// </summary>
-        public unsafe System.Numerics.Vector3 Constant
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public System.Numerics.Vector3 Constant;
     }
 
     /// <summary>
@@ -1217,23 +1209,21 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     [StructLayout(LayoutKind.Explicit, Size = 36)]
     public partial record struct FScalarMaterialInput
     {
+        [FieldOffset(28)] private int _bitfield28;
+
         /// <summary>
         /// BoolProperty: UseConstant
         /// </summary>
-        public unsafe bool UseConstant
+        public bool UseConstant
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 28); }; }
+            readonly get => (_bitfield28 & 1) != 0;
+            set { if (value) _bitfield28 |= 1; else _bitfield28 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: Constant
         /// </summary>
-        public unsafe float Constant
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float Constant;
     }
 
     /// <summary>
@@ -1242,23 +1232,21 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
     [StructLayout(LayoutKind.Explicit, Size = 36)]
     public partial record struct FColorMaterialInput
     {
+        [FieldOffset(28)] private int _bitfield28;
+
         /// <summary>
         /// BoolProperty: UseConstant
         /// </summary>
-        public unsafe bool UseConstant
+        public bool UseConstant
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 28); }; }
+            readonly get => (_bitfield28 & 1) != 0;
+            set { if (value) _bitfield28 |= 1; else _bitfield28 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: Constant
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor Constant
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public BmSDK.GameObject.FColor Constant;
     }
 
     /// <summary>
@@ -1279,55 +1267,31 @@ public partial class Material : BmSDK.Engine.MaterialInterface, BmSDK.IGameObjec
         /// <summary>
         /// IntProperty: Mask
         /// </summary>
-        public unsafe int Mask
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int Mask;
 
         /// <summary>
         /// IntProperty: MaskR
         /// </summary>
-        public unsafe int MaskR
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int MaskR;
 
         /// <summary>
         /// IntProperty: MaskG
         /// </summary>
-        public unsafe int MaskG
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int MaskG;
 
         /// <summary>
         /// IntProperty: MaskB
         /// </summary>
-        public unsafe int MaskB
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int MaskB;
 
         /// <summary>
         /// IntProperty: MaskA
         /// </summary>
-        public unsafe int MaskA
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public int MaskA;
 
         /// <summary>
         /// IntProperty: GCC64_Padding
         /// </summary>
-        public unsafe int GCC64_Padding
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int GCC64_Padding;
     }
 }
@@ -78,8 +78,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int EditorX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int EditorY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(int*)(Ptr + 48); }
+        set { *(int*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -96,8 +96,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaterialExpressionEditorX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(int*)(Ptr + 52); }
+        set { *(int*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaterialExpressionEditorY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(int*)(Ptr + 56); }
+        set { *(int*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -114,8 +114,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRealtimePreview
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 1; else *(int*)(Ptr + 60) &= ~1; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bNeedToUpdatePreview
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 2; else *(int*)(Ptr + 60) &= ~2; }
     }
 
     /// <summary>
@@ -132,8 +132,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsParameterExpression
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 4; else *(int*)(Ptr + 60) &= ~4; }
     }
 
     /// <summary>
@@ -141,8 +141,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCollapsedInEditor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 8; else *(int*)(Ptr + 60) &= ~8; }
     }
 
     /// <summary>
@@ -150,8 +150,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShowOutputNameOnPin
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 16; else *(int*)(Ptr + 60) &= ~16; }
     }
 
     /// <summary>
@@ -159,8 +159,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHidePreviewWindow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 32; else *(int*)(Ptr + 60) &= ~32; }
     }
 
     /// <summary>
@@ -168,8 +168,8 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUsedByStaticParameterSet
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }
+        get { return (*(int*)(Ptr + 60) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 60) |= 64; else *(int*)(Ptr + 60) &= ~64; }
     }
 
     /// <summary>
@@ -217,55 +217,31 @@ public partial class MaterialExpression : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Mask
         /// </summary>
-        public unsafe int Mask
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int Mask;
 
         /// <summary>
         /// IntProperty: MaskR
         /// </summary>
-        public unsafe int MaskR
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int MaskR;
 
         /// <summary>
         /// IntProperty: MaskG
         /// </summary>
-        public unsafe int MaskG
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int MaskG;
 
         /// <summary>
         /// IntProperty: MaskB
         /// </summary>
-        public unsafe int MaskB
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public int MaskB;
 
         /// <summary>
         /// IntProperty: MaskA
         /// </summary>
-        public unsafe int MaskA
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public int MaskA;
 
         /// <summary>
         /// IntProperty: GCC64_Padding
         /// </summary>
-        public unsafe int GCC64_Padding
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public int GCC64_Padding;
     }
 }
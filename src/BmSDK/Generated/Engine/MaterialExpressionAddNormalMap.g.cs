@@ -92,8 +92,8 @@ public partial class MaterialExpressionAddNormalMap : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe float AddU
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class MaterialExpressionAddNormalMap : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe float AddV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class MaterialExpressionAddNormalMap : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe float MultiplyU
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class MaterialExpressionAddNormalMap : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe float MultiplyV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(float*)(Ptr + 108); }
+        set { *(float*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class MaterialExpressionAddNormalMap : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe float TileU
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(float*)(Ptr + 112); }
+        set { *(float*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class MaterialExpressionAddNormalMap : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe float TileV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(float*)(Ptr + 116); }
+        set { *(float*)(Ptr + 116) = value; }
     }
 
     /// <summary>
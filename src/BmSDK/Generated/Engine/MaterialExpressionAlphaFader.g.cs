@@ -95,8 +95,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe bool bNormalize
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 148); }
+        get { return (*(int*)(Ptr + 148) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 148) |= 1; else *(int*)(Ptr + 148) &= ~1; }
     }
 
     /// <summary>
@@ -104,8 +104,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe bool DistanceFade
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 148); }
+        get { return (*(int*)(Ptr + 148) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 148) |= 2; else *(int*)(Ptr + 148) &= ~2; }
     }
 
     /// <summary>
@@ -113,8 +113,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe bool AngularFade
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 148); }
+        get { return (*(int*)(Ptr + 148) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 148) |= 4; else *(int*)(Ptr + 148) &= ~4; }
     }
 
     /// <summary>
@@ -122,8 +122,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe bool AngularFade_Invert
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 148); }
+        get { return (*(int*)(Ptr + 148) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 148) |= 8; else *(int*)(Ptr + 148) &= ~8; }
     }
 
     /// <summary>
@@ -131,8 +131,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe bool DepthCompareFade
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 148); }
+        get { return (*(int*)(Ptr + 148) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 148) |= 16; else *(int*)(Ptr + 148) &= ~16; }
     }
 
     /// <summary>
@@ -140,8 +140,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe bool DepthCompareFade_Invert
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 148); }
+        get { return (*(int*)(Ptr + 148) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 148) |= 32; else *(int*)(Ptr + 148) &= ~32; }
     }
 
     /// <summary>
@@ -149,8 +149,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe float DistanceFade_Start
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(float*)(Ptr + 152); }
+        set { *(float*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -158,8 +158,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe float DistanceFade_End
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(float*)(Ptr + 156); }
+        set { *(float*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -167,8 +167,8 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe float AngularFade_Power
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -176,7 +176,7 @@ public partial class MaterialExpressionAlphaFader : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe float BiasScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 }
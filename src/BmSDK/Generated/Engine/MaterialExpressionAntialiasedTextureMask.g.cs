@@ -95,8 +95,8 @@ public partial class MaterialExpressionAntialiasedTextureMask : BmSDK.Engine.Mat
     /// </summary>
     public unsafe float Threshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(float*)(Ptr + 136); }
+        set { *(float*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -104,7 +104,7 @@ public partial class MaterialExpressionAntialiasedTextureMask : BmSDK.Engine.Mat
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionAntialiasedTextureMask.ETextureColorChannel Channel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionAntialiasedTextureMask.ETextureColorChannel>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(BmSDK.Engine.MaterialExpressionAntialiasedTextureMask.ETextureColorChannel*)(Ptr + 140); }
+        set { *(BmSDK.Engine.MaterialExpressionAntialiasedTextureMask.ETextureColorChannel*)(Ptr + 140) = value; }
     }
 }
@@ -126,8 +126,8 @@ public partial class MaterialExpressionBlendMode : BmSDK.Engine.MaterialExpressi
     /// </summary>
     public unsafe float DefaultPercent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(float*)(Ptr + 176); }
+        set { *(float*)(Ptr + 176) = value; }
     }
 
     /// <summary>
@@ -135,7 +135,7 @@ public partial class MaterialExpressionBlendMode : BmSDK.Engine.MaterialExpressi
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionBlendMode.EBlendModeFilter BlendModeSelect
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionBlendMode.EBlendModeFilter>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(BmSDK.Engine.MaterialExpressionBlendMode.EBlendModeFilter*)(Ptr + 180); }
+        set { *(BmSDK.Engine.MaterialExpressionBlendMode.EBlendModeFilter*)(Ptr + 180) = value; }
     }
 }
@@ -113,8 +113,8 @@ public partial class MaterialExpressionBlurSceneTexture : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionBlurSceneTexture.EBlurSceneTextureType BlurSceneTextureType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionBlurSceneTexture.EBlurSceneTextureType>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(BmSDK.Engine.MaterialExpressionBlurSceneTexture.EBlurSceneTextureType*)(Ptr + 148); }
+        set { *(BmSDK.Engine.MaterialExpressionBlurSceneTexture.EBlurSceneTextureType*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -122,8 +122,8 @@ public partial class MaterialExpressionBlurSceneTexture : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionBlurSceneTexture.ESampleBlurSceneType SampleBlurSceneType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionBlurSceneTexture.ESampleBlurSceneType>(Ptr + 149); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 149); }
+        get { return *(BmSDK.Engine.MaterialExpressionBlurSceneTexture.ESampleBlurSceneType*)(Ptr + 149); }
+        set { *(BmSDK.Engine.MaterialExpressionBlurSceneTexture.ESampleBlurSceneType*)(Ptr + 149) = value; }
     }
 
     /// <summary>
@@ -131,8 +131,8 @@ public partial class MaterialExpressionBlurSceneTexture : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe bool ScreenAlign
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }
+        get { return (*(int*)(Ptr + 152) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 152) |= 1; else *(int*)(Ptr + 152) &= ~1; }
     }
 
     /// <summary>
@@ -140,8 +140,8 @@ public partial class MaterialExpressionBlurSceneTexture : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe int SampleNum
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(int*)(Ptr + 156); }
+        set { *(int*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -149,7 +149,7 @@ public partial class MaterialExpressionBlurSceneTexture : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe float SampleRadiusDefault
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 }
@@ -114,8 +114,8 @@ public partial class MaterialExpressionBlurTextureSample : BmSDK.Engine.Material
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionBlurTextureSample.ESampleBlurType SampleBlurType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionBlurTextureSample.ESampleBlurType>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(BmSDK.Engine.MaterialExpressionBlurTextureSample.ESampleBlurType*)(Ptr + 152); }
+        set { *(BmSDK.Engine.MaterialExpressionBlurTextureSample.ESampleBlurType*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class MaterialExpressionBlurTextureSample : BmSDK.Engine.Material
     /// </summary>
     public unsafe int SampleNum
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(int*)(Ptr + 156); }
+        set { *(int*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -132,7 +132,7 @@ public partial class MaterialExpressionBlurTextureSample : BmSDK.Engine.Material
     /// </summary>
     public unsafe float SampleRadiusDefault
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 }
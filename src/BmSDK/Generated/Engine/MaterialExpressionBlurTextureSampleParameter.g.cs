@@ -83,8 +83,8 @@ public partial class MaterialExpressionBlurTextureSampleParameter : BmSDK.Engine
     /// </summary>
     public unsafe BmSDK.FName ParameterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(BmSDK.FName*)(Ptr + 164); }
+        set { *(BmSDK.FName*)(Ptr + 164) = value; }
     }
 
     /// <summary>
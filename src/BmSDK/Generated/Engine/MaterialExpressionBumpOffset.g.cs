@@ -95,8 +95,8 @@ public partial class MaterialExpressionBumpOffset : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe float HeightRatio
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(float*)(Ptr + 148); }
+        set { *(float*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -104,7 +104,7 @@ public partial class MaterialExpressionBumpOffset : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe float ReferencePlane
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(float*)(Ptr + 152); }
+        set { *(float*)(Ptr + 152) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class MaterialExpressionComment : BmSDK.Engine.MaterialExpression
     /// </summary>
     public unsafe int PosX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(int*)(Ptr + 92); }
+        set { *(int*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class MaterialExpressionComment : BmSDK.Engine.MaterialExpression
     /// </summary>
     public unsafe int PosY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(int*)(Ptr + 96); }
+        set { *(int*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class MaterialExpressionComment : BmSDK.Engine.MaterialExpression
     /// </summary>
     public unsafe int SizeX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(int*)(Ptr + 100); }
+        set { *(int*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class MaterialExpressionComment : BmSDK.Engine.MaterialExpression
     /// </summary>
     public unsafe int SizeY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(int*)(Ptr + 104); }
+        set { *(int*)(Ptr + 104) = value; }
     }
 
     /// <summary>
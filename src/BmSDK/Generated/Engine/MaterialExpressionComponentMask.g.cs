@@ -89,8 +89,8 @@ public partial class MaterialExpressionComponentMask : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe bool R
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 1; else *(int*)(Ptr + 120) &= ~1; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class MaterialExpressionComponentMask : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe bool G
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 2; else *(int*)(Ptr + 120) &= ~2; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class MaterialExpressionComponentMask : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe bool B
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 4; else *(int*)(Ptr + 120) &= ~4; }
     }
 
     /// <summary>
@@ -116,7 +116,7 @@ public partial class MaterialExpressionComponentMask : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe bool A
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 8; else *(int*)(Ptr + 120) &= ~8; }
     }
 }
@@ -89,8 +89,8 @@ public partial class MaterialExpressionConstantBiasScale : BmSDK.Engine.Material
     /// </summary>
     public unsafe float Bias
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -98,7 +98,7 @@ public partial class MaterialExpressionConstantBiasScale : BmSDK.Engine.Material
     /// </summary>
     public unsafe float Scale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 }
@@ -89,8 +89,8 @@ public partial class MaterialExpressionConstantClamp : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe float Min
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -98,7 +98,7 @@ public partial class MaterialExpressionConstantClamp : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe float Max
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 }
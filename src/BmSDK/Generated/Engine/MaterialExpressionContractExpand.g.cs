@@ -99,7 +99,7 @@ public partial class MaterialExpressionContractExpand : BmSDK.Engine.MaterialExp
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionContractExpand.EContractOrExpandInput ContractOrExpandInput
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionContractExpand.EContractOrExpandInput>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.Engine.MaterialExpressionContractExpand.EContractOrExpandInput*)(Ptr + 120); }
+        set { *(BmSDK.Engine.MaterialExpressionContractExpand.EContractOrExpandInput*)(Ptr + 120) = value; }
     }
 }
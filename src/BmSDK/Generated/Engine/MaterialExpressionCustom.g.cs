@@ -92,8 +92,8 @@ public partial class MaterialExpressionCustom : BmSDK.Engine.MaterialExpression,
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionCustom.ECustomMaterialOutputType OutputType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionCustom.ECustomMaterialOutputType>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(BmSDK.Engine.MaterialExpressionCustom.ECustomMaterialOutputType*)(Ptr + 104); }
+        set { *(BmSDK.Engine.MaterialExpressionCustom.ECustomMaterialOutputType*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -132,11 +132,7 @@ public partial class MaterialExpressionCustom : BmSDK.Engine.MaterialExpression,
         /// <summary>
         /// StructProperty: Input
         /// </summary>
-        public unsafe BmSDK.Engine.MaterialExpression.FExpressionInput Input
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpression.FExpressionInput>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.Engine.MaterialExpression.FExpressionInput Input;
     }
 
     /// <summary>
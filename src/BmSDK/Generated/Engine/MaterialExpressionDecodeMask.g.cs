@@ -106,11 +106,7 @@ public partial class MaterialExpressionDecodeMask : BmSDK.Engine.MaterialExpress
         /// <summary>
         /// StructProperty: Input
         /// </summary>
-        public unsafe BmSDK.Engine.MaterialExpression.FExpressionInput Input
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpression.FExpressionInput>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.Engine.MaterialExpression.FExpressionInput Input;
     }
 
     /// <summary>
@@ -118,8 +114,8 @@ public partial class MaterialExpressionDecodeMask : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe int StepSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(int*)(Ptr + 92); }
+        set { *(int*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -154,7 +150,7 @@ public partial class MaterialExpressionDecodeMask : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionDecodeMask.EDecodeBlendType DecodeBlendType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionDecodeMask.EDecodeBlendType>(Ptr + 192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+        get { return *(BmSDK.Engine.MaterialExpressionDecodeMask.EDecodeBlendType*)(Ptr + 192); }
+        set { *(BmSDK.Engine.MaterialExpressionDecodeMask.EDecodeBlendType*)(Ptr + 192) = value; }
     }
 }
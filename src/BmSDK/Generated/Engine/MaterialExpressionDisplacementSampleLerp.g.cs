@@ -83,8 +83,8 @@ public partial class MaterialExpressionDisplacementSampleLerp : BmSDK.Engine.Mat
     /// </summary>
     public unsafe float Min
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class MaterialExpressionDisplacementSampleLerp : BmSDK.Engine.Mat
     /// </summary>
     public unsafe float Max
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 }
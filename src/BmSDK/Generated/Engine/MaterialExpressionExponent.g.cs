@@ -89,7 +89,7 @@ public partial class MaterialExpressionExponent : BmSDK.Engine.MaterialExpressio
     /// </summary>
     public unsafe bool bOffsetVisual
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 120); }
+        get { return (*(int*)(Ptr + 120) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 120) |= 1; else *(int*)(Ptr + 120) &= ~1; }
     }
 }
@@ -92,7 +92,7 @@ public partial class MaterialExpressionFontSample : BmSDK.Engine.MaterialExpress
     /// </summary>
     public unsafe int FontTexturePage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(int*)(Ptr + 96); }
+        set { *(int*)(Ptr + 96) = value; }
     }
 }
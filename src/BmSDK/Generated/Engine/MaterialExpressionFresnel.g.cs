@@ -83,8 +83,8 @@ public partial class MaterialExpressionFresnel : BmSDK.Engine.MaterialExpression
     /// </summary>
     public unsafe float Exponent
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
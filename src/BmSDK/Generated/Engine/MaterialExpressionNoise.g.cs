@@ -89,8 +89,8 @@ public partial class MaterialExpressionNoise : BmSDK.Engine.MaterialExpression,
     /// </summary>
     public unsafe float Seed1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class MaterialExpressionNoise : BmSDK.Engine.MaterialExpression,
     /// </summary>
     public unsafe float Seed2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -107,7 +107,7 @@ public partial class MaterialExpressionNoise : BmSDK.Engine.MaterialExpression,
     /// </summary>
     public unsafe float Seed3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 }
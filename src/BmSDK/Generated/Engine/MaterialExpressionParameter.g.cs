@@ -83,8 +83,8 @@ public partial class MaterialExpressionParameter : BmSDK.Engine.MaterialExpressi
     /// </summary>
     public unsafe BmSDK.FName ParameterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.FName*)(Ptr + 92); }
+        set { *(BmSDK.FName*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class MaterialExpressionPlatformConstant : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe float PC
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class MaterialExpressionPlatformConstant : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe float Ps3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class MaterialExpressionPlatformConstant : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe float XBox
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 }
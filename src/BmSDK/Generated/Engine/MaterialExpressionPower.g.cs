@@ -95,8 +95,8 @@ public partial class MaterialExpressionPower : BmSDK.Engine.MaterialExpression,
     /// </summary>
     public unsafe bool NonNegative
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 148); }
+        get { return (*(int*)(Ptr + 148) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 148) |= 1; else *(int*)(Ptr + 148) &= ~1; }
     }
 
     /// <summary>
@@ -104,7 +104,7 @@ public partial class MaterialExpressionPower : BmSDK.Engine.MaterialExpression,
     /// </summary>
     public unsafe bool NonZero
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 148); }
+        get { return (*(int*)(Ptr + 148) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 148) |= 2; else *(int*)(Ptr + 148) &= ~2; }
     }
 }
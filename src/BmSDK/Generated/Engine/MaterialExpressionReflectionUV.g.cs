@@ -101,8 +101,8 @@ public partial class MaterialExpressionReflectionUV : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe bool bUseMaskTexture
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 100); }
+        get { return (*(int*)(Ptr + 100) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 100) |= 1; else *(int*)(Ptr + 100) &= ~1; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class MaterialExpressionReflectionUV : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe float NormalWeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 }
@@ -101,7 +101,7 @@ public partial class MaterialExpressionRefract : BmSDK.Engine.MaterialExpression
     /// </summary>
     public unsafe float DefaultIOR
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(float*)(Ptr + 176); }
+        set { *(float*)(Ptr + 176) = value; }
     }
 }
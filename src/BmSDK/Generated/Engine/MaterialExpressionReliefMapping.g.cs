@@ -104,8 +104,8 @@ public partial class MaterialExpressionReliefMapping : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe float HeightMultiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(float*)(Ptr + 152); }
+        set { *(float*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -113,8 +113,8 @@ public partial class MaterialExpressionReliefMapping : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe int LSteps
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(int*)(Ptr + 156); }
+        set { *(int*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -122,7 +122,7 @@ public partial class MaterialExpressionReliefMapping : BmSDK.Engine.MaterialExpr
     /// </summary>
     public unsafe bool bOffsetLimiting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 160) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 160); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 160); }
+        get { return (*(int*)(Ptr + 160) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 160) |= 1; else *(int*)(Ptr + 160) &= ~1; }
     }
 }
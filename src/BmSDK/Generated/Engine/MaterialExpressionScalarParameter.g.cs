@@ -83,7 +83,7 @@ public partial class MaterialExpressionScalarParameter : BmSDK.Engine.MaterialEx
     /// </summary>
     public unsafe float DefaultValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 }
@@ -98,8 +98,8 @@ public partial class MaterialExpressionSceneTexture : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionSceneTexture.ESceneTextureType SceneTextureType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionSceneTexture.ESceneTextureType>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.Engine.MaterialExpressionSceneTexture.ESceneTextureType*)(Ptr + 120); }
+        set { *(BmSDK.Engine.MaterialExpressionSceneTexture.ESceneTextureType*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -107,7 +107,7 @@ public partial class MaterialExpressionSceneTexture : BmSDK.Engine.MaterialExpre
     /// </summary>
     public unsafe bool ScreenAlign
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 1; else *(int*)(Ptr + 124) &= ~1; }
     }
 }
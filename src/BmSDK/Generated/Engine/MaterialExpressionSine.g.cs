@@ -89,7 +89,7 @@ public partial class MaterialExpressionSine : BmSDK.Engine.MaterialExpression, B
     /// </summary>
     public unsafe float Period
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 }
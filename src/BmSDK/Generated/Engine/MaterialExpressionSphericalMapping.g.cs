@@ -83,8 +83,8 @@ public partial class MaterialExpressionSphericalMapping : BmSDK.Engine.MaterialE
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionSphericalMapping.ESphericalMappingType SphericalMappingType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionSphericalMapping.ESphericalMappingType>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.Engine.MaterialExpressionSphericalMapping.ESphericalMappingType*)(Ptr + 92); }
+        set { *(BmSDK.Engine.MaterialExpressionSphericalMapping.ESphericalMappingType*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -89,8 +89,8 @@ public partial class MaterialExpressionStaticComponentMaskParameter : BmSDK.Engi
     /// </summary>
     public unsafe bool DefaultR
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 1; else *(int*)(Ptr + 132) &= ~1; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class MaterialExpressionStaticComponentMaskParameter : BmSDK.Engi
     /// </summary>
     public unsafe bool DefaultG
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 2; else *(int*)(Ptr + 132) &= ~2; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class MaterialExpressionStaticComponentMaskParameter : BmSDK.Engi
     /// </summary>
     public unsafe bool DefaultB
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 4; else *(int*)(Ptr + 132) &= ~4; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class MaterialExpressionStaticComponentMaskParameter : BmSDK.Engi
     /// </summary>
     public unsafe bool DefaultA
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }
+        get { return (*(int*)(Ptr + 132) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 132) |= 8; else *(int*)(Ptr + 132) &= ~8; }
     }
 
     /// <summary>
@@ -125,7 +125,7 @@ public partial class MaterialExpressionStaticComponentMaskParameter : BmSDK.Engi
     /// </summary>
     public unsafe System.IntPtr InstanceOverride
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(System.IntPtr*)(Ptr + 136); }
+        set { *(System.IntPtr*)(Ptr + 136) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class MaterialExpressionStaticSwitchParameter : BmSDK.Engine.Mate
     /// </summary>
     public unsafe bool DefaultValue
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 104); }
+        get { return (*(int*)(Ptr + 104) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 104) |= 1; else *(int*)(Ptr + 104) &= ~1; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class MaterialExpressionStaticSwitchParameter : BmSDK.Engine.Mate
     /// </summary>
     public unsafe bool ExtendedCaptionDisplay
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 104); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 104); }
+        get { return (*(int*)(Ptr + 104) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 104) |= 2; else *(int*)(Ptr + 104) &= ~2; }
     }
 
     /// <summary>
@@ -113,7 +113,7 @@ public partial class MaterialExpressionStaticSwitchParameter : BmSDK.Engine.Mate
     /// </summary>
     public unsafe System.IntPtr InstanceOverride
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(System.IntPtr*)(Ptr + 164); }
+        set { *(System.IntPtr*)(Ptr + 164) = value; }
     }
 }
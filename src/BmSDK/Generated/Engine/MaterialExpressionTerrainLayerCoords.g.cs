@@ -83,8 +83,8 @@ public partial class MaterialExpressionTerrainLayerCoords : BmSDK.Engine.Materia
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionTerrainLayerCoords.ETerrainCoordMappingType MappingType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionTerrainLayerCoords.ETerrainCoordMappingType>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.Engine.MaterialExpressionTerrainLayerCoords.ETerrainCoordMappingType*)(Ptr + 92); }
+        set { *(BmSDK.Engine.MaterialExpressionTerrainLayerCoords.ETerrainCoordMappingType*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class MaterialExpressionTerrainLayerCoords : BmSDK.Engine.Materia
     /// </summary>
     public unsafe float MappingScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class MaterialExpressionTerrainLayerCoords : BmSDK.Engine.Materia
     /// </summary>
     public unsafe float MappingRotation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class MaterialExpressionTerrainLayerCoords : BmSDK.Engine.Materia
     /// </summary>
     public unsafe float MappingPanU
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class MaterialExpressionTerrainLayerCoords : BmSDK.Engine.Materia
     /// </summary>
     public unsafe float MappingPanV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(float*)(Ptr + 108); }
+        set { *(float*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class MaterialExpressionTerrainLayerWeight : BmSDK.Engine.Materia
     /// </summary>
     public unsafe System.IntPtr InstanceOverride
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(System.IntPtr*)(Ptr + 92); }
+        set { *(System.IntPtr*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -104,8 +104,8 @@ public partial class MaterialExpressionTerrainLayerWeight : BmSDK.Engine.Materia
     /// </summary>
     public unsafe BmSDK.FName ParameterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(BmSDK.FName*)(Ptr + 152); }
+        set { *(BmSDK.FName*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -113,8 +113,8 @@ public partial class MaterialExpressionTerrainLayerWeight : BmSDK.Engine.Materia
     /// </summary>
     public unsafe float PreviewWeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -78,8 +78,8 @@ public partial class MaterialExpressionTextureSampleParameter : BmSDK.Engine.Mat
     /// </summary>
     public unsafe BmSDK.FName ParameterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(BmSDK.FName*)(Ptr + 124); }
+        set { *(BmSDK.FName*)(Ptr + 124) = value; }
     }
 
     /// <summary>
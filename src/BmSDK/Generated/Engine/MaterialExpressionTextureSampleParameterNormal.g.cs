@@ -83,7 +83,7 @@ public partial class MaterialExpressionTextureSampleParameterNormal : BmSDK.Engi
     /// </summary>
     public unsafe System.IntPtr InstanceOverride
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(System.IntPtr*)(Ptr + 136); }
+        set { *(System.IntPtr*)(Ptr + 136) = value; }
     }
 }
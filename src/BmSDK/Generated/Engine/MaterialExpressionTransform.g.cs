@@ -112,8 +112,8 @@ public partial class MaterialExpressionTransform : BmSDK.Engine.MaterialExpressi
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionTransform.EMaterialVectorCoordTransformSource TransformSourceType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionTransform.EMaterialVectorCoordTransformSource>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.Engine.MaterialExpressionTransform.EMaterialVectorCoordTransformSource*)(Ptr + 120); }
+        set { *(BmSDK.Engine.MaterialExpressionTransform.EMaterialVectorCoordTransformSource*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -121,7 +121,7 @@ public partial class MaterialExpressionTransform : BmSDK.Engine.MaterialExpressi
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionTransform.EMaterialVectorCoordTransform TransformType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionTransform.EMaterialVectorCoordTransform>(Ptr + 121); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 121); }
+        get { return *(BmSDK.Engine.MaterialExpressionTransform.EMaterialVectorCoordTransform*)(Ptr + 121); }
+        set { *(BmSDK.Engine.MaterialExpressionTransform.EMaterialVectorCoordTransform*)(Ptr + 121) = value; }
     }
 }
@@ -98,7 +98,7 @@ public partial class MaterialExpressionTransformPosition : BmSDK.Engine.Material
     /// </summary>
     public unsafe BmSDK.Engine.MaterialExpressionTransformPosition.EMaterialPositionTransform TransformType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.MaterialExpressionTransformPosition.EMaterialPositionTransform>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.Engine.MaterialExpressionTransformPosition.EMaterialPositionTransform*)(Ptr + 120); }
+        set { *(BmSDK.Engine.MaterialExpressionTransformPosition.EMaterialPositionTransform*)(Ptr + 120) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class MetaSurfaceEffect : BmSDK.Engine.PostProcessEffect, BmSDK.I
     /// </summary>
     public unsafe float RadiusSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class MetaSurfaceEffect : BmSDK.Engine.PostProcessEffect, BmSDK.I
     /// </summary>
     public unsafe float TestLow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class MetaSurfaceEffect : BmSDK.Engine.PostProcessEffect, BmSDK.I
     /// </summary>
     public unsafe float TestHigh
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class MetaSurfaceEffect : BmSDK.Engine.PostProcessEffect, BmSDK.I
     /// </summary>
     public unsafe float UpperRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -119,7 +119,7 @@ public partial class MetaSurfaceEffect : BmSDK.Engine.PostProcessEffect, BmSDK.I
     /// </summary>
     public unsafe float Power
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 }
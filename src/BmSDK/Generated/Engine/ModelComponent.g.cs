@@ -92,8 +92,8 @@ public partial class ModelComponent : BmSDK.Engine.PrimitiveComponent, BmSDK.IGa
     /// </summary>
     public unsafe int ZoneIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(int*)(Ptr + 408); }
+        set { *(int*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class ModelComponent : BmSDK.Engine.PrimitiveComponent, BmSDK.IGa
     /// </summary>
     public unsafe int ComponentIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 412); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 412); }
+        get { return *(int*)(Ptr + 412); }
+        set { *(int*)(Ptr + 412) = value; }
     }
 
     /// <summary>
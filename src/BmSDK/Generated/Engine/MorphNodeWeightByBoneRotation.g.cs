@@ -83,8 +83,8 @@ public partial class MorphNodeWeightByBoneRotation : BmSDK.Engine.MorphNodeWeigh
     /// </summary>
     public unsafe float Angle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class MorphNodeWeightByBoneRotation : BmSDK.Engine.MorphNodeWeigh
     /// </summary>
     public unsafe float NodeWeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(float*)(Ptr + 108); }
+        set { *(float*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class MorphNodeWeightByBoneRotation : BmSDK.Engine.MorphNodeWeigh
     /// </summary>
     public unsafe BmSDK.FName BoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(BmSDK.FName*)(Ptr + 112); }
+        set { *(BmSDK.FName*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class MorphNodeWeightByBoneRotation : BmSDK.Engine.MorphNodeWeigh
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis BoneAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 120); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class MorphNodeWeightByBoneRotation : BmSDK.Engine.MorphNodeWeigh
     /// </summary>
     public unsafe bool bInvertBoneAxis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 1; else *(int*)(Ptr + 124) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class MorphNodeWeightByBoneRotation : BmSDK.Engine.MorphNodeWeigh
     /// </summary>
     public unsafe bool bControlMaterialParameter
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }
+        get { return (*(int*)(Ptr + 124) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 124) |= 2; else *(int*)(Ptr + 124) &= ~2; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class MorphNodeWeightByBoneRotation : BmSDK.Engine.MorphNodeWeigh
     /// </summary>
     public unsafe int MaterialSlotId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(int*)(Ptr + 140); }
+        set { *(int*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class MorphNodeWeightByBoneRotation : BmSDK.Engine.MorphNodeWeigh
     /// </summary>
     public unsafe BmSDK.FName ScalarParameterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(BmSDK.FName*)(Ptr + 144); }
+        set { *(BmSDK.FName*)(Ptr + 144) = value; }
     }
 
     /// <summary>
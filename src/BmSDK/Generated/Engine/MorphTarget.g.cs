@@ -92,8 +92,8 @@ public partial class MorphTarget : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaterialSlotId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(int*)(Ptr + 56); }
+        set { *(int*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class MorphTarget : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName ScalarParameterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 
     /// <summary>
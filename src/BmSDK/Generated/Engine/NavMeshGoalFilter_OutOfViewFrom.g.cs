@@ -83,8 +83,8 @@ public partial class NavMeshGoalFilter_OutOfViewFrom : BmSDK.Engine.NavMeshGoal_
     /// </summary>
     public unsafe System.IntPtr GoalPoly
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(System.IntPtr*)(Ptr + 56); }
+        set { *(System.IntPtr*)(Ptr + 56) = value; }
     }
 
     /// <summary>
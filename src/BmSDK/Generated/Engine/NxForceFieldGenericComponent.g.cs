@@ -83,8 +83,8 @@ public partial class NxForceFieldGenericComponent : BmSDK.Engine.NxForceFieldCom
     /// </summary>
     public unsafe float RoughExtentX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(float*)(Ptr + 488); }
+        set { *(float*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class NxForceFieldGenericComponent : BmSDK.Engine.NxForceFieldCom
     /// </summary>
     public unsafe float RoughExtentY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(float*)(Ptr + 492); }
+        set { *(float*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class NxForceFieldGenericComponent : BmSDK.Engine.NxForceFieldCom
     /// </summary>
     public unsafe float RoughExtentZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(float*)(Ptr + 496); }
+        set { *(float*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class NxForceFieldGenericComponent : BmSDK.Engine.NxForceFieldCom
     /// </summary>
     public unsafe BmSDK.Engine.NxForceFieldGeneric.FFG_ForceFieldCoordinates Coordinates
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.NxForceFieldGeneric.FFG_ForceFieldCoordinates>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(BmSDK.Engine.NxForceFieldGeneric.FFG_ForceFieldCoordinates*)(Ptr + 500); }
+        set { *(BmSDK.Engine.NxForceFieldGeneric.FFG_ForceFieldCoordinates*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class NxForceFieldGenericComponent : BmSDK.Engine.NxForceFieldCom
     /// </summary>
     public unsafe float TorusRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 648); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 648); }
+        get { return *(float*)(Ptr + 648); }
+        set { *(float*)(Ptr + 648) = value; }
     }
 
     /// <summary>
@@ -200,7 +200,7 @@ public partial class NxForceFieldGenericComponent : BmSDK.Engine.NxForceFieldCom
     /// </summary>
     public unsafe System.IntPtr Kernel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 652); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 652); }
+        get { return *(System.IntPtr*)(Ptr + 652); }
+        set { *(System.IntPtr*)(Ptr + 652) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class NxForceFieldRadialComponent : BmSDK.Engine.NxForceFieldComp
     /// </summary>
     public unsafe float ForceStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 488); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 488); }
+        get { return *(float*)(Ptr + 488); }
+        set { *(float*)(Ptr + 488) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class NxForceFieldRadialComponent : BmSDK.Engine.NxForceFieldComp
     /// </summary>
     public unsafe float ForceRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 492); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 492); }
+        get { return *(float*)(Ptr + 492); }
+        set { *(float*)(Ptr + 492) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class NxForceFieldRadialComponent : BmSDK.Engine.NxForceFieldComp
     /// </summary>
     public unsafe float SelfRotationStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 496); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 496); }
+        get { return *(float*)(Ptr + 496); }
+        set { *(float*)(Ptr + 496) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class NxForceFieldRadialComponent : BmSDK.Engine.NxForceFieldComp
     /// </summary>
     public unsafe BmSDK.Engine.PrimitiveComponent.ERadialImpulseFalloff ForceFalloff
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PrimitiveComponent.ERadialImpulseFalloff>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(BmSDK.Engine.PrimitiveComponent.ERadialImpulseFalloff*)(Ptr + 500); }
+        set { *(BmSDK.Engine.PrimitiveComponent.ERadialImpulseFalloff*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -119,7 +119,7 @@ public partial class NxForceFieldRadialComponent : BmSDK.Engine.NxForceFieldComp
     /// </summary>
     public unsafe System.IntPtr Kernel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }
+        get { return *(System.IntPtr*)(Ptr + 504); }
+        set { *(System.IntPtr*)(Ptr + 504) = value; }
     }
 }
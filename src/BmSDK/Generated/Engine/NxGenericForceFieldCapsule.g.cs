@@ -92,8 +92,8 @@ public partial class NxGenericForceFieldCapsule : BmSDK.Engine.NxGenericForceFie
     /// </summary>
     public unsafe float CapsuleHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 652); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 652); }
+        get { return *(float*)(Ptr + 652); }
+        set { *(float*)(Ptr + 652) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class NxGenericForceFieldCapsule : BmSDK.Engine.NxGenericForceFie
     /// </summary>
     public unsafe float CapsuleRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 656); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 656); }
+        get { return *(float*)(Ptr + 656); }
+        set { *(float*)(Ptr + 656) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class NxRadialCustomForceField : BmSDK.Engine.NxRadialForceField,
     /// </summary>
     public unsafe float SelfRotationStrength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 512); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 512); }
+        get { return *(float*)(Ptr + 512); }
+        set { *(float*)(Ptr + 512) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class NxRadialCustomForceField : BmSDK.Engine.NxRadialForceField,
     /// </summary>
     public unsafe System.IntPtr Kernel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 516); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 516); }
+        get { return *(System.IntPtr*)(Ptr + 516); }
+        set { *(System.IntPtr*)(Ptr + 516) = value; }
     }
 }
@@ -96,8 +96,8 @@ public partial class PBRuleNodeBase : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int RulePosX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(int*)(Ptr + 68); }
+        set { *(int*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -105,8 +105,8 @@ public partial class PBRuleNodeBase : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int RulePosY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(int*)(Ptr + 72); }
+        set { *(int*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -114,8 +114,8 @@ public partial class PBRuleNodeBase : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int InDrawY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(int*)(Ptr + 76); }
+        set { *(int*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -123,8 +123,8 @@ public partial class PBRuleNodeBase : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DrawWidth
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(int*)(Ptr + 80); }
+        set { *(int*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -132,8 +132,8 @@ public partial class PBRuleNodeBase : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int DrawHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(int*)(Ptr + 84); }
+        set { *(int*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -154,19 +154,11 @@ public partial class PBRuleNodeBase : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: LinkName
         /// </summary>
-        public unsafe BmSDK.FName LinkName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.FName LinkName;
 
         /// <summary>
         /// IntProperty: DrawY
         /// </summary>
-        public unsafe int DrawY
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public int DrawY;
     }
 }
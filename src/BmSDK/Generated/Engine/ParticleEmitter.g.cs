@@ -107,29 +107,17 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Count
         /// </summary>
-        public unsafe int Count
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int Count;
 
         /// <summary>
         /// IntProperty: CountLow
         /// </summary>
-        public unsafe int CountLow
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public int CountLow;
 
         /// <summary>
         /// FloatProperty: Time
         /// </summary>
-        public unsafe float Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Time;
     }
 
     /// <summary>
@@ -147,8 +135,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName EmitterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.FName*)(Ptr + 44); }
+        set { *(BmSDK.FName*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -156,8 +144,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float NearScaleDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -165,8 +153,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int SubUVDataOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(int*)(Ptr + 56); }
+        set { *(int*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -174,8 +162,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.ParticleEmitter.EEmitterRenderMode EmitterRenderMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleEmitter.EEmitterRenderMode>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.Engine.ParticleEmitter.EEmitterRenderMode*)(Ptr + 60); }
+        set { *(BmSDK.Engine.ParticleEmitter.EEmitterRenderMode*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -183,8 +171,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte SharedEmitterInstanceCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 61); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 61); }
+        get { return *(byte*)(Ptr + 61); }
+        set { *(byte*)(Ptr + 61) = value; }
     }
 
     /// <summary>
@@ -207,8 +195,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ConvertedModules
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 1; else *(int*)(Ptr + 80) &= ~1; }
     }
 
     /// <summary>
@@ -216,8 +204,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCollapsed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 2; else *(int*)(Ptr + 80) &= ~2; }
     }
 
     /// <summary>
@@ -225,8 +213,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsSoloing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 4; else *(int*)(Ptr + 80) &= ~4; }
     }
 
     /// <summary>
@@ -234,8 +222,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCookedOut
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 80); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 80); }
+        get { return (*(int*)(Ptr + 80) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 80) |= 8; else *(int*)(Ptr + 80) &= ~8; }
     }
 
     /// <summary>
@@ -243,8 +231,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int PeakActiveParticles
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(int*)(Ptr + 84); }
+        set { *(int*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -252,8 +240,8 @@ public partial class ParticleEmitter : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int InitialAllocationCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(int*)(Ptr + 88); }
+        set { *(int*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -73,19 +73,30 @@ public partial class ParticleEventManager : BmSDK.Engine.Actor, BmSDK.IGameObjec
         where TComponent : class, Framework.IScriptComponent<ParticleEventManager>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_HandleParticleModuleEventSendToGameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct HandleParticleModuleEventSendToGame_Params
+    {
+        [FieldOffset(0)] public nint InEvent;
+        [FieldOffset(4)] public System.Numerics.Vector3 InCollideDirection;
+        [FieldOffset(16)] public System.Numerics.Vector3 InHitLocation;
+        [FieldOffset(28)] public System.Numerics.Vector3 InHitNormal;
+        [FieldOffset(40)] public BmSDK.FName InBoneName;
+    }
+
     /// <summary>
     /// Function: HandleParticleModuleEventSendToGame
     /// </summary>
     public unsafe virtual void HandleParticleModuleEventSendToGame(BmSDK.Engine.ParticleModuleEventSendToGame InEvent, out System.Numerics.Vector3 InCollideDirection, out System.Numerics.Vector3 InHitLocation, out System.Numerics.Vector3 InHitNormal, out BmSDK.FName InBoneName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleEventManager.HandleParticleModuleEventSendToGame", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InEvent, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        InCollideDirection = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 4);
-        InHitLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 16);
-        InHitNormal = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 28);
-        InBoneName = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(paramsPtr + 40);
+        var funcManaged = s_HandleParticleModuleEventSendToGameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleEventManager.HandleParticleModuleEventSendToGame", true);
+        var parms = new HandleParticleModuleEventSendToGame_Params();
+        parms.InEvent = InEvent?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        InCollideDirection = parms.InCollideDirection;
+        InHitLocation = parms.InHitLocation;
+        InHitNormal = parms.InHitNormal;
+        InBoneName = parms.InBoneName;
         return;
     }
 }
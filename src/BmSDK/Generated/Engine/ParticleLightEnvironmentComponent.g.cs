@@ -83,8 +83,8 @@ public partial class ParticleLightEnvironmentComponent : BmSDK.Engine.DynamicLig
     /// </summary>
     public unsafe int ReferenceCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(int*)(Ptr + 288); }
+        set { *(int*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class ParticleLightEnvironmentComponent : BmSDK.Engine.DynamicLig
     /// </summary>
     public unsafe bool bAllowDLESharing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 292) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 292); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 292); }
+        get { return (*(int*)(Ptr + 292) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 292) |= 1; else *(int*)(Ptr + 292) &= ~1; }
     }
 }
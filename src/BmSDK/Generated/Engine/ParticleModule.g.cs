@@ -79,40 +79,38 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 24)]
     public partial record struct FParticleRandomSeedInfo
     {
+        [FieldOffset(8)] private int _bitfield8;
+
         /// <summary>
         /// NameProperty: ParameterName
         /// </summary>
-        public unsafe BmSDK.FName ParameterName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName ParameterName;
 
         /// <summary>
         /// BoolProperty: bGetSeedFromInstance
         /// </summary>
-        public unsafe bool bGetSeedFromInstance
+        public bool bGetSeedFromInstance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 1) != 0;
+            set { if (value) _bitfield8 |= 1; else _bitfield8 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bInstanceSeedIsIndex
         /// </summary>
-        public unsafe bool bInstanceSeedIsIndex
+        public bool bInstanceSeedIsIndex
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 2) != 0;
+            set { if (value) _bitfield8 |= 2; else _bitfield8 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bResetSeedOnEmitterLooping
         /// </summary>
-        public unsafe bool bResetSeedOnEmitterLooping
+        public bool bResetSeedOnEmitterLooping
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 8); }; }
+            readonly get => (_bitfield8 & 4) != 0;
+            set { if (value) _bitfield8 |= 4; else _bitfield8 &= ~4; }
         }
 
         /// <summary>
@@ -180,8 +178,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSpawnModule
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1; else *(int*)(Ptr + 44) &= ~1; }
     }
 
     /// <summary>
@@ -189,8 +187,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUpdateModule
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 2; else *(int*)(Ptr + 44) &= ~2; }
     }
 
     /// <summary>
@@ -198,8 +196,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bFinalUpdateModule
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 4; else *(int*)(Ptr + 44) &= ~4; }
     }
 
     /// <summary>
@@ -207,8 +205,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCurvesAsColor
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 8; else *(int*)(Ptr + 44) &= ~8; }
     }
 
     /// <summary>
@@ -216,8 +214,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool b3DDrawMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 16; else *(int*)(Ptr + 44) &= ~16; }
     }
 
     /// <summary>
@@ -225,8 +223,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSupported3DDrawMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 32; else *(int*)(Ptr + 44) &= ~32; }
     }
 
     /// <summary>
@@ -234,8 +232,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 64; else *(int*)(Ptr + 44) &= ~64; }
     }
 
     /// <summary>
@@ -243,8 +241,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEditable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 128; else *(int*)(Ptr + 44) &= ~128; }
     }
 
     /// <summary>
@@ -252,8 +250,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool LODDuplicate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 256; else *(int*)(Ptr + 44) &= ~256; }
     }
 
     /// <summary>
@@ -261,8 +259,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSupportsRandomSeed
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 512; else *(int*)(Ptr + 44) &= ~512; }
     }
 
     /// <summary>
@@ -270,8 +268,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRequiresLoopingNotification
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }
+        get { return (*(int*)(Ptr + 44) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 44) |= 1024; else *(int*)(Ptr + 44) &= ~1024; }
     }
 
     /// <summary>
@@ -279,8 +277,8 @@ public partial class ParticleModule : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe byte LODValidity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(byte*)(Ptr + 48); }
+        set { *(byte*)(Ptr + 48) = value; }
     }
 
     /// <summary>
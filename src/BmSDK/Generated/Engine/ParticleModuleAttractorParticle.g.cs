@@ -93,8 +93,8 @@ public partial class ParticleModuleAttractorParticle : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe BmSDK.FName EmitterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.FName*)(Ptr + 56); }
+        set { *(BmSDK.FName*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -108,8 +108,8 @@ public partial class ParticleModuleAttractorParticle : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bStrengthByDistance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 1; else *(int*)(Ptr + 92) &= ~1; }
     }
 
     /// <summary>
@@ -117,8 +117,8 @@ public partial class ParticleModuleAttractorParticle : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bAffectBaseVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 2; else *(int*)(Ptr + 92) &= ~2; }
     }
 
     /// <summary>
@@ -126,8 +126,8 @@ public partial class ParticleModuleAttractorParticle : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bRenewSource
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 4; else *(int*)(Ptr + 92) &= ~4; }
     }
 
     /// <summary>
@@ -135,8 +135,8 @@ public partial class ParticleModuleAttractorParticle : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bInheritSourceVel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }
+        get { return (*(int*)(Ptr + 92) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 92) |= 8; else *(int*)(Ptr + 92) &= ~8; }
     }
 
     /// <summary>
@@ -150,8 +150,8 @@ public partial class ParticleModuleAttractorParticle : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleAttractorParticle.EAttractorParticleSelectionMethod SelectionMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleAttractorParticle.EAttractorParticleSelectionMethod>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(BmSDK.Engine.ParticleModuleAttractorParticle.EAttractorParticleSelectionMethod*)(Ptr + 124); }
+        set { *(BmSDK.Engine.ParticleModuleAttractorParticle.EAttractorParticleSelectionMethod*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -159,7 +159,7 @@ public partial class ParticleModuleAttractorParticle : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe int LastSelIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(int*)(Ptr + 128); }
+        set { *(int*)(Ptr + 128) = value; }
     }
 }
@@ -101,8 +101,8 @@ public partial class ParticleModuleAttractorPoint : BmSDK.Engine.ParticleModuleA
     /// </summary>
     public unsafe bool StrengthByDistance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }
+        get { return (*(int*)(Ptr + 140) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 140) |= 1; else *(int*)(Ptr + 140) &= ~1; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class ParticleModuleAttractorPoint : BmSDK.Engine.ParticleModuleA
     /// </summary>
     public unsafe bool bAffectBaseVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }
+        get { return (*(int*)(Ptr + 140) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 140) |= 2; else *(int*)(Ptr + 140) &= ~2; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class ParticleModuleAttractorPoint : BmSDK.Engine.ParticleModuleA
     /// </summary>
     public unsafe bool bOverrideVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }
+        get { return (*(int*)(Ptr + 140) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 140) |= 4; else *(int*)(Ptr + 140) &= ~4; }
     }
 
     /// <summary>
@@ -128,7 +128,7 @@ public partial class ParticleModuleAttractorPoint : BmSDK.Engine.ParticleModuleA
     /// </summary>
     public unsafe bool bUseWorldSpacePosition
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }
+        get { return (*(int*)(Ptr + 140) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 140) |= 8; else *(int*)(Ptr + 140) &= ~8; }
     }
 }
@@ -83,8 +83,8 @@ public partial class ParticleModuleBeamSource : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetMethod SourceMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetMethod>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetMethod*)(Ptr + 56); }
+        set { *(BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetMethod*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class ParticleModuleBeamSource : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetTangentMethod SourceTangentMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetTangentMethod>(Ptr + 57); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 57); }
+        get { return *(BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetTangentMethod*)(Ptr + 57); }
+        set { *(BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetTangentMethod*)(Ptr + 57) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class ParticleModuleBeamSource : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe BmSDK.FName SourceName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class ParticleModuleBeamSource : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe bool bSourceAbsolute
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class ParticleModuleBeamSource : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe bool bLockSource
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 2; else *(int*)(Ptr + 68) &= ~2; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class ParticleModuleBeamSource : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe bool bLockSourceTangent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 4; else *(int*)(Ptr + 68) &= ~4; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class ParticleModuleBeamSource : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe bool bLockSourceStength
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 8; else *(int*)(Ptr + 68) &= ~8; }
     }
 
     /// <summary>
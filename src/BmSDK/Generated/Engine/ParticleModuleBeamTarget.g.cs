@@ -83,8 +83,8 @@ public partial class ParticleModuleBeamTarget : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetMethod TargetMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetMethod>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetMethod*)(Ptr + 56); }
+        set { *(BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetMethod*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class ParticleModuleBeamTarget : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetTangentMethod TargetTangentMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetTangentMethod>(Ptr + 57); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 57); }
+        get { return *(BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetTangentMethod*)(Ptr + 57); }
+        set { *(BmSDK.Engine.ParticleModuleBeamBase.Beam2SourceTargetTangentMethod*)(Ptr + 57) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class ParticleModuleBeamTarget : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe BmSDK.FName TargetName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class ParticleModuleBeamTarget : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe bool bTargetAbsolute
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 1; else *(int*)(Ptr + 96) &= ~1; }
     }
 
     /// <summary>
@@ -125,8 +125,8 @@ public partial class ParticleModuleBeamTarget : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe bool bLockTarget
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 2; else *(int*)(Ptr + 96) &= ~2; }
     }
 
     /// <summary>
@@ -134,8 +134,8 @@ public partial class ParticleModuleBeamTarget : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe bool bLockTargetTangent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 4; else *(int*)(Ptr + 96) &= ~4; }
     }
 
     /// <summary>
@@ -143,8 +143,8 @@ public partial class ParticleModuleBeamTarget : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe bool bLockTargetStength
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 8; else *(int*)(Ptr + 96) &= ~8; }
     }
 
     /// <summary>
@@ -164,7 +164,7 @@ public partial class ParticleModuleBeamTarget : BmSDK.Engine.ParticleModuleBeamB
     /// </summary>
     public unsafe float LockRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(float*)(Ptr + 156); }
+        set { *(float*)(Ptr + 156) = value; }
     }
 }
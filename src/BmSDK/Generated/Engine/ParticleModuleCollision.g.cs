@@ -101,8 +101,8 @@ public partial class ParticleModuleCollision : BmSDK.Engine.ParticleModuleCollis
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleCollisionBase.EParticleCollisionComplete CollisionCompletionOption
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleCollisionBase.EParticleCollisionComplete>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(BmSDK.Engine.ParticleModuleCollisionBase.EParticleCollisionComplete*)(Ptr + 140); }
+        set { *(BmSDK.Engine.ParticleModuleCollisionBase.EParticleCollisionComplete*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class ParticleModuleCollision : BmSDK.Engine.ParticleModuleCollis
     /// </summary>
     public unsafe bool bApplyPhysics
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 144); }
+        get { return (*(int*)(Ptr + 144) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 144) |= 1; else *(int*)(Ptr + 144) &= ~1; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class ParticleModuleCollision : BmSDK.Engine.ParticleModuleCollis
     /// </summary>
     public unsafe bool bForceCollideZeroExtent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 144); }
+        get { return (*(int*)(Ptr + 144) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 144) |= 2; else *(int*)(Ptr + 144) &= ~2; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class ParticleModuleCollision : BmSDK.Engine.ParticleModuleCollis
     /// </summary>
     public unsafe bool bPawnsDoNotDecrementCount
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 144); }
+        get { return (*(int*)(Ptr + 144) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 144) |= 4; else *(int*)(Ptr + 144) &= ~4; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class ParticleModuleCollision : BmSDK.Engine.ParticleModuleCollis
     /// </summary>
     public unsafe bool bOnlyVerticalNormalsDecrementCount
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 144); }
+        get { return (*(int*)(Ptr + 144) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 144) |= 8; else *(int*)(Ptr + 144) &= ~8; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class ParticleModuleCollision : BmSDK.Engine.ParticleModuleCollis
     /// </summary>
     public unsafe bool bDropDetail
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 144); }
+        get { return (*(int*)(Ptr + 144) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 144) |= 16; else *(int*)(Ptr + 144) &= ~16; }
     }
 
     /// <summary>
@@ -170,8 +170,8 @@ public partial class ParticleModuleCollision : BmSDK.Engine.ParticleModuleCollis
     /// </summary>
     public unsafe float DirScalar
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(float*)(Ptr + 180); }
+        set { *(float*)(Ptr + 180) = value; }
     }
 
     /// <summary>
@@ -179,8 +179,8 @@ public partial class ParticleModuleCollision : BmSDK.Engine.ParticleModuleCollis
     /// </summary>
     public unsafe float VerticalFudgeFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(float*)(Ptr + 184); }
+        set { *(float*)(Ptr + 184) = value; }
     }
 
     /// <summary>
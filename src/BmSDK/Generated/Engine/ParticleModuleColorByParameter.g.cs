@@ -83,8 +83,8 @@ public partial class ParticleModuleColorByParameter : BmSDK.Engine.ParticleModul
     /// </summary>
     public unsafe BmSDK.FName ColorParam
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.FName*)(Ptr + 56); }
+        set { *(BmSDK.FName*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -78,8 +78,8 @@ public partial class ParticleModuleEventReceiverBase : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe BmSDK.Engine.ParticleSystemComponent.EParticleEventType EventGeneratorType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleSystemComponent.EParticleEventType>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.Engine.ParticleSystemComponent.EParticleEventType*)(Ptr + 56); }
+        set { *(BmSDK.Engine.ParticleSystemComponent.EParticleEventType*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -87,7 +87,7 @@ public partial class ParticleModuleEventReceiverBase : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe BmSDK.FName EventName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 }
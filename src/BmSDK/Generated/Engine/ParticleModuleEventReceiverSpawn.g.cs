@@ -89,8 +89,8 @@ public partial class ParticleModuleEventReceiverSpawn : BmSDK.Engine.ParticleMod
     /// </summary>
     public unsafe bool bUseParticleTime
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 1; else *(int*)(Ptr + 96) &= ~1; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class ParticleModuleEventReceiverSpawn : BmSDK.Engine.ParticleMod
     /// </summary>
     public unsafe bool bUsePSysLocation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 2; else *(int*)(Ptr + 96) &= ~2; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class ParticleModuleEventReceiverSpawn : BmSDK.Engine.ParticleMod
     /// </summary>
     public unsafe bool bInheritVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 4; else *(int*)(Ptr + 96) &= ~4; }
     }
 
     /// <summary>
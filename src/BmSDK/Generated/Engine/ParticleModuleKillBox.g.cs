@@ -95,8 +95,8 @@ public partial class ParticleModuleKillBox : BmSDK.Engine.ParticleModuleKillBase
     /// </summary>
     public unsafe bool bAbsolute
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 112); }
+        get { return (*(int*)(Ptr + 112) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 112) |= 1; else *(int*)(Ptr + 112) &= ~1; }
     }
 
     /// <summary>
@@ -104,7 +104,7 @@ public partial class ParticleModuleKillBox : BmSDK.Engine.ParticleModuleKillBase
     /// </summary>
     public unsafe bool bKillInside
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 112); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 112); }
+        get { return (*(int*)(Ptr + 112) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 112) |= 2; else *(int*)(Ptr + 112) &= ~2; }
     }
 }
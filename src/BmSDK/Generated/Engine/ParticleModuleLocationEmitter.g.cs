@@ -93,8 +93,8 @@ public partial class ParticleModuleLocationEmitter : BmSDK.Engine.ParticleModule
     /// </summary>
     public unsafe BmSDK.FName EmitterName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.FName*)(Ptr + 56); }
+        set { *(BmSDK.FName*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -102,8 +102,8 @@ public partial class ParticleModuleLocationEmitter : BmSDK.Engine.ParticleModule
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleLocationEmitter.ELocationEmitterSelectionMethod SelectionMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleLocationEmitter.ELocationEmitterSelectionMethod>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(BmSDK.Engine.ParticleModuleLocationEmitter.ELocationEmitterSelectionMethod*)(Ptr + 64); }
+        set { *(BmSDK.Engine.ParticleModuleLocationEmitter.ELocationEmitterSelectionMethod*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -111,8 +111,8 @@ public partial class ParticleModuleLocationEmitter : BmSDK.Engine.ParticleModule
     /// </summary>
     public unsafe bool InheritSourceVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 
     /// <summary>
@@ -120,8 +120,8 @@ public partial class ParticleModuleLocationEmitter : BmSDK.Engine.ParticleModule
     /// </summary>
     public unsafe bool bInheritSourceRotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 2; else *(int*)(Ptr + 68) &= ~2; }
     }
 
     /// <summary>
@@ -129,8 +129,8 @@ public partial class ParticleModuleLocationEmitter : BmSDK.Engine.ParticleModule
     /// </summary>
     public unsafe float InheritSourceVelocityScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -138,7 +138,7 @@ public partial class ParticleModuleLocationEmitter : BmSDK.Engine.ParticleModule
     /// </summary>
     public unsafe float InheritSourceRotationScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 }
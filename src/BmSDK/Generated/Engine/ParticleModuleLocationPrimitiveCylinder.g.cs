@@ -94,8 +94,8 @@ public partial class ParticleModuleLocationPrimitiveCylinder : BmSDK.Engine.Part
     /// </summary>
     public unsafe bool RadialVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }
+        get { return (*(int*)(Ptr + 116) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 116) |= 1; else *(int*)(Ptr + 116) &= ~1; }
     }
 
     /// <summary>
@@ -115,7 +115,7 @@ public partial class ParticleModuleLocationPrimitiveCylinder : BmSDK.Engine.Part
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleLocationPrimitiveCylinder.CylinderHeightAxis HeightAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleLocationPrimitiveCylinder.CylinderHeightAxis>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(BmSDK.Engine.ParticleModuleLocationPrimitiveCylinder.CylinderHeightAxis*)(Ptr + 176); }
+        set { *(BmSDK.Engine.ParticleModuleLocationPrimitiveCylinder.CylinderHeightAxis*)(Ptr + 176) = value; }
     }
 }
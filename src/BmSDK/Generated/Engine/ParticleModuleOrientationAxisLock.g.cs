@@ -83,8 +83,8 @@ public partial class ParticleModuleOrientationAxisLock : BmSDK.Engine.ParticleMo
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleOrientationAxisLock.EParticleAxisLock LockAxisFlags
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleOrientationAxisLock.EParticleAxisLock>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.Engine.ParticleModuleOrientationAxisLock.EParticleAxisLock*)(Ptr + 56); }
+        set { *(BmSDK.Engine.ParticleModuleOrientationAxisLock.EParticleAxisLock*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -95,8 +95,8 @@ public partial class ParticleModuleSpawn : BmSDK.Engine.ParticleModuleSpawnBase,
     /// </summary>
     public unsafe BmSDK.Engine.ParticleEmitter.EParticleBurstMethod ParticleBurstMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleEmitter.EParticleBurstMethod>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(BmSDK.Engine.ParticleEmitter.EParticleBurstMethod*)(Ptr + 116); }
+        set { *(BmSDK.Engine.ParticleEmitter.EParticleBurstMethod*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -131,7 +131,7 @@ public partial class ParticleModuleSpawn : BmSDK.Engine.ParticleModuleSpawnBase,
     /// </summary>
     public unsafe bool SpawnSoundLoops
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }
+        get { return (*(int*)(Ptr + 140) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 140) |= 1; else *(int*)(Ptr + 140) &= ~1; }
     }
 }
@@ -83,8 +83,8 @@ public partial class ParticleModuleSubUVMovie : BmSDK.Engine.ParticleModuleSubUV
     /// </summary>
     public unsafe bool bUseEmitterTime
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }
+        get { return (*(int*)(Ptr + 84) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 84) |= 1; else *(int*)(Ptr + 84) &= ~1; }
     }
 
     /// <summary>
@@ -98,7 +98,7 @@ public partial class ParticleModuleSubUVMovie : BmSDK.Engine.ParticleModuleSubUV
     /// </summary>
     public unsafe int StartingFrame
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(int*)(Ptr + 116); }
+        set { *(int*)(Ptr + 116) = value; }
     }
 }
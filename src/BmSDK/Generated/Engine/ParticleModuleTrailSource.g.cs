@@ -83,8 +83,8 @@ public partial class ParticleModuleTrailSource : BmSDK.Engine.ParticleModuleTrai
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleTrailSource.ETrail2SourceMethod SourceMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleTrailSource.ETrail2SourceMethod>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.Engine.ParticleModuleTrailSource.ETrail2SourceMethod*)(Ptr + 56); }
+        set { *(BmSDK.Engine.ParticleModuleTrailSource.ETrail2SourceMethod*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class ParticleModuleTrailSource : BmSDK.Engine.ParticleModuleTrai
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModule.EParticleSourceSelectionMethod SelectionMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModule.EParticleSourceSelectionMethod>(Ptr + 57); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 57); }
+        get { return *(BmSDK.Engine.ParticleModule.EParticleSourceSelectionMethod*)(Ptr + 57); }
+        set { *(BmSDK.Engine.ParticleModule.EParticleSourceSelectionMethod*)(Ptr + 57) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class ParticleModuleTrailSource : BmSDK.Engine.ParticleModuleTrai
     /// </summary>
     public unsafe BmSDK.FName SourceName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.FName*)(Ptr + 60); }
+        set { *(BmSDK.FName*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class ParticleModuleTrailSource : BmSDK.Engine.ParticleModuleTrai
     /// </summary>
     public unsafe bool bLockSourceStength
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 1; else *(int*)(Ptr + 96) &= ~1; }
     }
 
     /// <summary>
@@ -125,8 +125,8 @@ public partial class ParticleModuleTrailSource : BmSDK.Engine.ParticleModuleTrai
     /// </summary>
     public unsafe bool bInheritRotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 2; else *(int*)(Ptr + 96) &= ~2; }
     }
 
     /// <summary>
@@ -134,8 +134,8 @@ public partial class ParticleModuleTrailSource : BmSDK.Engine.ParticleModuleTrai
     /// </summary>
     public unsafe int SourceOffsetCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(int*)(Ptr + 100); }
+        set { *(int*)(Ptr + 100) = value; }
     }
 
     /// <summary>
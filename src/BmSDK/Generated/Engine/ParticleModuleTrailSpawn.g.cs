@@ -92,8 +92,8 @@ public partial class ParticleModuleTrailSpawn : BmSDK.Engine.ParticleModuleTrail
     /// </summary>
     public unsafe float MinSpawnVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(float*)(Ptr + 60); }
+        set { *(float*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class ParticleModuleTrailTaper : BmSDK.Engine.ParticleModuleTrail
     /// </summary>
     public unsafe BmSDK.Engine.ParticleModuleTrailTaper.ETrailTaperMethod TaperMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleModuleTrailTaper.ETrailTaperMethod>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.Engine.ParticleModuleTrailTaper.ETrailTaperMethod*)(Ptr + 56); }
+        set { *(BmSDK.Engine.ParticleModuleTrailTaper.ETrailTaperMethod*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe BmSDK.FName ControlEdgeName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.FName*)(Ptr + 56); }
+        set { *(BmSDK.FName*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe int SheetsPerTrail
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }
+        get { return *(int*)(Ptr + 64); }
+        set { *(int*)(Ptr + 64) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bDeadTrailsOnDeactivate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 1; else *(int*)(Ptr + 68) &= ~1; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bClipSourceSegement
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 2; else *(int*)(Ptr + 68) &= ~2; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bEnablePreviousTangentRecalculation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 4; else *(int*)(Ptr + 68) &= ~4; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bTangentRecalculationEveryFrame
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 8; else *(int*)(Ptr + 68) &= ~8; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bRenderGeometry
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 16; else *(int*)(Ptr + 68) &= ~16; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bRenderSpawnPoints
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 32; else *(int*)(Ptr + 68) &= ~32; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bRenderTangents
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 64; else *(int*)(Ptr + 68) &= ~64; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe bool bRenderTessellation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }
+        get { return (*(int*)(Ptr + 68) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 68) |= 128; else *(int*)(Ptr + 68) &= ~128; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe float TilingDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe float DistanceTessellationStepSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -191,7 +191,7 @@ public partial class ParticleModuleTypeDataAnimTrail : BmSDK.Engine.ParticleModu
     /// </summary>
     public unsafe float TangentTessellationScalar
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 }
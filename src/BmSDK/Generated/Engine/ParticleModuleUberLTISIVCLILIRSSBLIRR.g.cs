@@ -137,8 +137,8 @@ public partial class ParticleModuleUberLTISIVCLILIRSSBLIRR : BmSDK.Engine.Partic
     /// </summary>
     public unsafe bool SizeMultiplyX
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 1; else *(int*)(Ptr + 320) &= ~1; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class ParticleModuleUberLTISIVCLILIRSSBLIRR : BmSDK.Engine.Partic
     /// </summary>
     public unsafe bool SizeMultiplyY
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 2; else *(int*)(Ptr + 320) &= ~2; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class ParticleModuleUberLTISIVCLILIRSSBLIRR : BmSDK.Engine.Partic
     /// </summary>
     public unsafe bool SizeMultiplyZ
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 320); }
+        get { return (*(int*)(Ptr + 320) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 320) |= 4; else *(int*)(Ptr + 320) &= ~4; }
     }
 
     /// <summary>
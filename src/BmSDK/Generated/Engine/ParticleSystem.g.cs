@@ -78,24 +78,33 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<ParticleSystem>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetLODDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetLODDistance_Params
+    {
+        [FieldOffset(0)] public int LODLevelIndex;
+        [FieldOffset(4)] public float InDistance;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: SetLODDistance
     /// </summary>
     public unsafe virtual bool SetLODDistance(int LODLevelIndex, float InDistance)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.SetLODDistance", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LODLevelIndex, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InDistance, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_SetLODDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.SetLODDistance", true);
+        var parms = new SetLODDistance_Params();
+        parms.LODLevelIndex = LODLevelIndex;
+        parms.InDistance = InDistance;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetCurrentLODMethodFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct SetCurrentLODMethod_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod InMethod;
     }
 
     /// <summary>
@@ -103,37 +112,38 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetCurrentLODMethod(BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod InMethod)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.SetCurrentLODMethod", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InMethod, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetCurrentLODMethodFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.SetCurrentLODMethod", true);
+        var parms = new SetCurrentLODMethod_Params();
+        parms.InMethod = InMethod;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetLODDistanceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetLODDistance_Params
+    {
+        [FieldOffset(0)] public int LODLevelIndex;
+        [FieldOffset(4)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetLODDistance
     /// </summary>
     public unsafe virtual float GetLODDistance(int LODLevelIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.GetLODDistance", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LODLevelIndex, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_GetLODDistanceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.GetLODDistance", true);
+        var parms = new GetLODDistance_Params();
+        parms.LODLevelIndex = LODLevelIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetLODLevelCountFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetLODLevelCount_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -141,17 +151,17 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual int GetLODLevelCount()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.GetLODLevelCount", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetLODLevelCountFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.GetLODLevelCount", true);
+        var parms = new GetLODLevelCount_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetCurrentLODMethodFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct GetCurrentLODMethod_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod ReturnValue;
     }
 
     /// <summary>
@@ -159,17 +169,10 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod GetCurrentLODMethod()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.GetCurrentLODMethod", true);
-        byte* paramsPtr = stackalloc byte[1];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod>(paramsPtr + 0);
+        var funcManaged = s_GetCurrentLODMethodFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.ParticleSystem.GetCurrentLODMethod", true);
+        var parms = new GetCurrentLODMethod_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -205,13 +208,15 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 4)]
     public partial record struct FParticleSystemLOD
     {
+        [FieldOffset(0)] private int _bitfield0;
+
         /// <summary>
         /// BoolProperty: bLit
         /// </summary>
-        public unsafe bool bLit
+        public bool bLit
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
     }
 
@@ -231,8 +236,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.ParticleSystem.EParticleSystemUpdateMode SystemUpdateMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleSystem.EParticleSystemUpdateMode>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(BmSDK.Engine.ParticleSystem.EParticleSystemUpdateMode*)(Ptr + 44); }
+        set { *(BmSDK.Engine.ParticleSystem.EParticleSystemUpdateMode*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -240,8 +245,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod LODMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod>(Ptr + 45); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 45); }
+        get { return *(BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod*)(Ptr + 45); }
+        set { *(BmSDK.Engine.ParticleSystem.ParticleSystemLODMethod*)(Ptr + 45) = value; }
     }
 
     /// <summary>
@@ -249,8 +254,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.ParticleSystem.EParticleSystemOcclusionBoundsMethod OcclusionBoundsMethod
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.ParticleSystem.EParticleSystemOcclusionBoundsMethod>(Ptr + 46); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 46); }
+        get { return *(BmSDK.Engine.ParticleSystem.EParticleSystemOcclusionBoundsMethod*)(Ptr + 46); }
+        set { *(BmSDK.Engine.ParticleSystem.EParticleSystemOcclusionBoundsMethod*)(Ptr + 46) = value; }
     }
 
     /// <summary>
@@ -258,8 +263,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float UpdateTime_FPS
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -267,8 +272,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float UpdateTime_Delta
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -276,8 +281,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float WarmupTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -309,8 +314,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ThumbnailDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -318,8 +323,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ThumbnailWarmup
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -327,8 +332,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLit
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 1; else *(int*)(Ptr + 96) &= ~1; }
     }
 
     /// <summary>
@@ -336,8 +341,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOrientZAxisTowardCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 2; else *(int*)(Ptr + 96) &= ~2; }
     }
 
     /// <summary>
@@ -345,8 +350,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRegenerateLODDuplicate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 4; else *(int*)(Ptr + 96) &= ~4; }
     }
 
     /// <summary>
@@ -354,8 +359,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableParticleDistanceCulling
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 8; else *(int*)(Ptr + 96) &= ~8; }
     }
 
     /// <summary>
@@ -363,8 +368,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseFixedRelativeBoundingBox
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 16; else *(int*)(Ptr + 96) &= ~16; }
     }
 
     /// <summary>
@@ -372,8 +377,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShouldResetPeakCounts
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 32; else *(int*)(Ptr + 96) &= ~32; }
     }
 
     /// <summary>
@@ -381,8 +386,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasPhysics
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 64; else *(int*)(Ptr + 96) &= ~64; }
     }
 
     /// <summary>
@@ -390,8 +395,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseRealtimeThumbnail
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 128; else *(int*)(Ptr + 96) &= ~128; }
     }
 
     /// <summary>
@@ -399,8 +404,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ThumbnailImageOutOfDate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 256; else *(int*)(Ptr + 96) &= ~256; }
     }
 
     /// <summary>
@@ -408,8 +413,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSkipSpawnCountCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 512; else *(int*)(Ptr + 96) &= ~512; }
     }
 
     /// <summary>
@@ -417,8 +422,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseDelayRange
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 1024; else *(int*)(Ptr + 96) &= ~1024; }
     }
 
     /// <summary>
@@ -426,8 +431,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseMobilePointSprites
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 2048; else *(int*)(Ptr + 96) &= ~2048; }
     }
 
     /// <summary>
@@ -435,8 +440,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLoadIfPhysXLevel0
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 4096; else *(int*)(Ptr + 96) &= ~4096; }
     }
 
     /// <summary>
@@ -444,8 +449,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLoadIfPhysXLevel1
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 8192; else *(int*)(Ptr + 96) &= ~8192; }
     }
 
     /// <summary>
@@ -453,8 +458,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLoadIfPhysXLevel2
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 96); }
+        get { return (*(int*)(Ptr + 96) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 96) |= 16384; else *(int*)(Ptr + 96) &= ~16384; }
     }
 
     /// <summary>
@@ -471,8 +476,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float LODDistanceCheckTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -489,8 +494,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int EditorLODSetting
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(int*)(Ptr + 120); }
+        set { *(int*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -513,8 +518,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float SecondsBeforeInactive
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 
     /// <summary>
@@ -543,8 +548,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float FloorScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(float*)(Ptr + 204); }
+        set { *(float*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -573,8 +578,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Delay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -582,8 +587,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DelayLow
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(float*)(Ptr + 232); }
+        set { *(float*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -597,8 +602,8 @@ public partial class ParticleSystem : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MacroUVRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(float*)(Ptr + 248); }
+        set { *(float*)(Ptr + 248) = value; }
     }
 
     /// <summary>
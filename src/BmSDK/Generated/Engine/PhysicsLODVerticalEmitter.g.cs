@@ -83,7 +83,7 @@ public partial class PhysicsLODVerticalEmitter : BmSDK.GameObject, BmSDK.IGameOb
     /// </summary>
     public unsafe int ParticlePercentage
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 }
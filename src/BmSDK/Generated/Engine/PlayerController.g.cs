@@ -78,223 +78,328 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         where TComponent : class, Framework.IScriptComponent<PlayerController>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ReceivedGameClassFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ReceivedGameClass_Params
+    {
+        [FieldOffset(0)] public nint GameClass;
+    }
+
     /// <summary>
     /// Function: ReceivedGameClass
     /// </summary>
     public unsafe virtual void ReceivedGameClass(BmSDK.Class GameClass)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ReceivedGameClass", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GameClass, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReceivedGameClassFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ReceivedGameClass", true);
+        var parms = new ReceivedGameClass_Params();
+        parms.GameClass = GameClass?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LogOutBugItAIGoToLogFileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct LogOutBugItAIGoToLogFile_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString InScreenShotDesc;
+        [FieldOffset(12)] public BmSDK.FString InGoString;
+        [FieldOffset(24)] public BmSDK.FString InLocString;
+    }
+
     /// <summary>
     /// Function: LogOutBugItAIGoToLogFile
     /// </summary>
     public unsafe void LogOutBugItAIGoToLogFile(BmSDK.FString InScreenShotDesc, BmSDK.FString InGoString, BmSDK.FString InLocString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LogOutBugItAIGoToLogFile", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InScreenShotDesc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InGoString, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InLocString, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_LogOutBugItAIGoToLogFileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LogOutBugItAIGoToLogFile", true);
+        var parms = new LogOutBugItAIGoToLogFile_Params();
+        parms.InScreenShotDesc = InScreenShotDesc;
+        parms.InGoString = InGoString;
+        parms.InLocString = InLocString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LogOutBugItGoToLogFileFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct LogOutBugItGoToLogFile_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString InScreenShotDesc;
+        [FieldOffset(12)] public BmSDK.FString InGoString;
+        [FieldOffset(24)] public BmSDK.FString InLocString;
+    }
+
     /// <summary>
     /// Function: LogOutBugItGoToLogFile
     /// </summary>
     public unsafe void LogOutBugItGoToLogFile(BmSDK.FString InScreenShotDesc, BmSDK.FString InGoString, BmSDK.FString InLocString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LogOutBugItGoToLogFile", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InScreenShotDesc, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InGoString, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InLocString, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_LogOutBugItGoToLogFileFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LogOutBugItGoToLogFile", true);
+        var parms = new LogOutBugItGoToLogFile_Params();
+        parms.InScreenShotDesc = InScreenShotDesc;
+        parms.InGoString = InGoString;
+        parms.InLocString = InLocString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisableDebugAIFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DisableDebugAI_Params
+    {
+    }
+
     /// <summary>
     /// Function: DisableDebugAI
     /// </summary>
     public unsafe virtual void DisableDebugAI()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DisableDebugAI", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DisableDebugAIFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DisableDebugAI", true);
+        var parms = new DisableDebugAI_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpPeersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct DumpPeers_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpPeers
     /// </summary>
     public unsafe virtual void DumpPeers()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DumpPeers", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpPeersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DumpPeers", true);
+        var parms = new DumpPeers_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpVoiceMutingStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct DumpVoiceMutingState_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpVoiceMutingState
     /// </summary>
     public unsafe virtual void DumpVoiceMutingState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DumpVoiceMutingState", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpVoiceMutingStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DumpVoiceMutingState", true);
+        var parms = new DumpVoiceMutingState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DumpOnlineSessionStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DumpOnlineSessionState_Params
+    {
+    }
+
     /// <summary>
     /// Function: DumpOnlineSessionState
     /// </summary>
     public unsafe virtual void DumpOnlineSessionState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DumpOnlineSessionState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DumpOnlineSessionStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DumpOnlineSessionState", true);
+        var parms = new DumpOnlineSessionState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugLogPRIsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DebugLogPRIs_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugLogPRIs
     /// </summary>
     public unsafe virtual void DebugLogPRIs()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DebugLogPRIs", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugLogPRIsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DebugLogPRIs", true);
+        var parms = new DebugLogPRIs_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnEngineInitialTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnEngineInitialTick_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnEngineInitialTick
     /// </summary>
     public unsafe virtual void OnEngineInitialTick()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnEngineInitialTick", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnEngineInitialTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnEngineInitialTick", true);
+        var parms = new OnEngineInitialTick_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BugItStringCreatorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct BugItStringCreator_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 ViewLocation;
+        [FieldOffset(12)] public BmSDK.Rotator ViewRotation;
+        [FieldOffset(24)] public BmSDK.FString GoString;
+        [FieldOffset(36)] public BmSDK.FString LocString;
+    }
+
     /// <summary>
     /// Function: BugItStringCreator
     /// </summary>
     public unsafe virtual void BugItStringCreator(out System.Numerics.Vector3 ViewLocation, out BmSDK.Rotator ViewRotation, out BmSDK.FString GoString, out BmSDK.FString LocString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugItStringCreator", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ViewLocation = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        ViewRotation = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 12);
-        GoString = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 24);
-        LocString = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 36);
+        var funcManaged = s_BugItStringCreatorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugItStringCreator", true);
+        var parms = new BugItStringCreator_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ViewLocation = parms.ViewLocation;
+        ViewRotation = parms.ViewRotation;
+        GoString = parms.GoString;
+        LocString = parms.LocString;
         return;
     }
 
+    static BmSDK.Function s_BugItAIFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct BugItAI_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ScreenShotDescription;
+    }
+
     /// <summary>
     /// Function: BugItAI
     /// </summary>
     public unsafe virtual void BugItAI(BmSDK.FString ScreenShotDescription = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugItAI", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreenShotDescription, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BugItAIFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugItAI", true);
+        var parms = new BugItAI_Params();
+        parms.ScreenShotDescription = ScreenShotDescription;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LogLocFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct LogLoc_Params
+    {
+    }
+
     /// <summary>
     /// Function: LogLoc
     /// </summary>
     public unsafe virtual void LogLoc()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LogLoc", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LogLocFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LogLoc", true);
+        var parms = new LogLoc_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BugItFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 60)]
+    private struct BugIt_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ScreenShotDescription;
+    }
+
     /// <summary>
     /// Function: BugIt
     /// </summary>
     public unsafe virtual void BugIt(BmSDK.FString ScreenShotDescription = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugIt", true);
-        byte* paramsPtr = stackalloc byte[60];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScreenShotDescription, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BugItFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugIt", true);
+        var parms = new BugIt_Params();
+        parms.ScreenShotDescription = ScreenShotDescription;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BugItWorkerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct BugItWorker_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 TheLocation;
+        [FieldOffset(12)] public BmSDK.Rotator TheRotation;
+    }
+
     /// <summary>
     /// Function: BugItWorker
     /// </summary>
     public unsafe virtual void BugItWorker(System.Numerics.Vector3 TheLocation, BmSDK.Rotator TheRotation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugItWorker", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheLocation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheRotation, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BugItWorkerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugItWorker", true);
+        var parms = new BugItWorker_Params();
+        parms.TheLocation = TheLocation;
+        parms.TheRotation = TheRotation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BugItGoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct BugItGo_Params
+    {
+        [FieldOffset(0)] public float X;
+        [FieldOffset(4)] public float Y;
+        [FieldOffset(8)] public float Z;
+        [FieldOffset(12)] public int Pitch;
+        [FieldOffset(16)] public int Yaw;
+        [FieldOffset(20)] public int Roll;
+    }
+
     /// <summary>
     /// Function: BugItGo
     /// </summary>
     public unsafe virtual void BugItGo(float X, float Y, float Z, int Pitch, int Yaw, int Roll)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugItGo", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Z, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Pitch, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Yaw, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Roll, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_BugItGoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.BugItGo", true);
+        var parms = new BugItGo_Params();
+        parms.X = X;
+        parms.Y = Y;
+        parms.Z = Z;
+        parms.Pitch = Pitch;
+        parms.Yaw = Yaw;
+        parms.Roll = Roll;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasPeerConnectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct HasPeerConnection_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId PeerNetId;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasPeerConnection
     /// </summary>
     public unsafe virtual bool HasPeerConnection(out BmSDK.Engine.OnlineSubsystem.FUniqueNetId PeerNetId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.HasPeerConnection", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        PeerNetId = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.OnlineSubsystem.FUniqueNetId>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_HasPeerConnectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.HasPeerConnection", true);
+        var parms = new HasPeerConnection_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        PeerNetId = parms.PeerNetId;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClientSpawnCameraLensEffectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientSpawnCameraLensEffect_Params
+    {
+        [FieldOffset(0)] public nint LensEffectEmitterClass;
     }
 
     /// <summary>
@@ -302,172 +407,282 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ClientSpawnCameraLensEffect(BmSDK.Class LensEffectEmitterClass)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSpawnCameraLensEffect", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LensEffectEmitterClass, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSpawnCameraLensEffectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSpawnCameraLensEffect", true);
+        var parms = new ClientSpawnCameraLensEffect_Params();
+        parms.LensEffectEmitterClass = LensEffectEmitterClass?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DebugCameraAnimsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DebugCameraAnims_Params
+    {
+    }
+
     /// <summary>
     /// Function: DebugCameraAnims
     /// </summary>
     public unsafe virtual void DebugCameraAnims()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DebugCameraAnims", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DebugCameraAnimsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DebugCameraAnims", true);
+        var parms = new DebugCameraAnims_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientStopCameraAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientStopCameraAnim_Params
+    {
+        [FieldOffset(0)] public nint AnimToStop;
+    }
+
     /// <summary>
     /// Function: ClientStopCameraAnim
     /// </summary>
     public unsafe virtual void ClientStopCameraAnim(BmSDK.Engine.CameraAnim AnimToStop)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStopCameraAnim", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimToStop, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientStopCameraAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStopCameraAnim", true);
+        var parms = new ClientStopCameraAnim_Params();
+        parms.AnimToStop = AnimToStop?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientPlayCameraAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 48)]
+    private struct ClientPlayCameraAnim_Params
+    {
+        [FieldOffset(0)] public nint AnimToPlay;
+        [FieldOffset(4)] public float Scale;
+        [FieldOffset(8)] public float Rate;
+        [FieldOffset(12)] public float BlendInTime;
+        [FieldOffset(16)] public float BlendOutTime;
+        [FieldOffset(20)] public int bLoop;
+        [FieldOffset(24)] public int bRandomStartTime;
+        [FieldOffset(28)] public BmSDK.Engine.Camera.ECameraAnimPlaySpace Space;
+        [FieldOffset(32)] public BmSDK.Rotator CustomPlaySpace;
+    }
+
     /// <summary>
     /// Function: ClientPlayCameraAnim
     /// </summary>
     public unsafe virtual void ClientPlayCameraAnim(BmSDK.Engine.CameraAnim AnimToPlay, float Scale = default, float Rate = default, float BlendInTime = default, float BlendOutTime = default, bool bLoop = default, bool bRandomStartTime = default, BmSDK.Engine.Camera.ECameraAnimPlaySpace Space = default, BmSDK.Rotator CustomPlaySpace = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPlayCameraAnim", true);
-        byte* paramsPtr = stackalloc byte[48];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimToPlay, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Scale, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Rate, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendInTime, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BlendOutTime, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLoop, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bRandomStartTime, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Space, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CustomPlaySpace, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientPlayCameraAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPlayCameraAnim", true);
+        var parms = new ClientPlayCameraAnim_Params();
+        parms.AnimToPlay = AnimToPlay?.Ptr ?? 0;
+        parms.Scale = Scale;
+        parms.Rate = Rate;
+        parms.BlendInTime = BlendInTime;
+        parms.BlendOutTime = BlendOutTime;
+        parms.bLoop = bLoop ? 1 : 0;
+        parms.bRandomStartTime = bRandomStartTime ? 1 : 0;
+        parms.Space = Space;
+        parms.CustomPlaySpace = CustomPlaySpace;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnCameraShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnCameraShake_Params
+    {
+        [FieldOffset(0)] public nint inAction;
+    }
+
     /// <summary>
     /// Function: OnCameraShake
     /// </summary>
     public unsafe virtual void OnCameraShake(BmSDK.Engine.SeqAct_CameraShake inAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnCameraShake", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnCameraShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnCameraShake", true);
+        var parms = new OnCameraShake_Params();
+        parms.inAction = inAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientStopCameraShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientStopCameraShake_Params
+    {
+        [FieldOffset(0)] public nint Shake;
+    }
+
     /// <summary>
     /// Function: ClientStopCameraShake
     /// </summary>
     public unsafe virtual void ClientStopCameraShake(BmSDK.Engine.CameraShake Shake)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStopCameraShake", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Shake, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientStopCameraShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStopCameraShake", true);
+        var parms = new ClientStopCameraShake_Params();
+        parms.Shake = Shake?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientPlayCameraShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ClientPlayCameraShake_Params
+    {
+        [FieldOffset(0)] public nint Shake;
+        [FieldOffset(4)] public float Scale;
+        [FieldOffset(8)] public int bTryForceFeedback;
+        [FieldOffset(12)] public BmSDK.Engine.Camera.ECameraAnimPlaySpace PlaySpace;
+        [FieldOffset(16)] public BmSDK.Rotator UserPlaySpaceRot;
+    }
+
     /// <summary>
     /// Function: ClientPlayCameraShake
     /// </summary>
     public unsafe virtual void ClientPlayCameraShake(BmSDK.Engine.CameraShake Shake, float Scale = default, bool bTryForceFeedback = default, BmSDK.Engine.Camera.ECameraAnimPlaySpace PlaySpace = default, BmSDK.Rotator UserPlaySpaceRot = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPlayCameraShake", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Shake, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Scale, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bTryForceFeedback, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlaySpace, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(UserPlaySpaceRot, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientPlayCameraShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPlayCameraShake", true);
+        var parms = new ClientPlayCameraShake_Params();
+        parms.Shake = Shake?.Ptr ?? 0;
+        parms.Scale = Scale;
+        parms.bTryForceFeedback = bTryForceFeedback ? 1 : 0;
+        parms.PlaySpace = PlaySpace;
+        parms.UserPlaySpaceRot = UserPlaySpaceRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DoForceFeedbackForScreenShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DoForceFeedbackForScreenShake_Params
+    {
+        [FieldOffset(0)] public nint ShakeData;
+        [FieldOffset(4)] public float ShakeScale;
+    }
+
     /// <summary>
     /// Function: DoForceFeedbackForScreenShake
     /// </summary>
     public unsafe virtual void DoForceFeedbackForScreenShake(BmSDK.Engine.CameraShake ShakeData, float ShakeScale)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DoForceFeedbackForScreenShake", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ShakeData, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ShakeScale, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DoForceFeedbackForScreenShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DoForceFeedbackForScreenShake", true);
+        var parms = new DoForceFeedbackForScreenShake_Params();
+        parms.ShakeData = ShakeData?.Ptr ?? 0;
+        parms.ShakeScale = ShakeScale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InputMatchDelegateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InputMatchDelegate_Params
+    {
+    }
+
     /// <summary>
     /// Function: InputMatchDelegate
     /// </summary>
     public unsafe virtual void InputMatchDelegate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.InputMatchDelegate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InputMatchDelegateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.InputMatchDelegate", true);
+        var parms = new InputMatchDelegate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientPrestreamTexturesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ClientPrestreamTextures_Params
+    {
+        [FieldOffset(0)] public nint ForcedActor;
+        [FieldOffset(4)] public float ForceDuration;
+        [FieldOffset(8)] public int bEnableStreaming;
+        [FieldOffset(12)] public int CinematicTextureGroups;
+    }
+
     /// <summary>
     /// Function: ClientPrestreamTextures
     /// </summary>
     public unsafe virtual void ClientPrestreamTextures(BmSDK.Engine.Actor ForcedActor, float ForceDuration, bool bEnableStreaming, int CinematicTextureGroups = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPrestreamTextures", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForcedActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceDuration, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnableStreaming, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CinematicTextureGroups, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientPrestreamTexturesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPrestreamTextures", true);
+        var parms = new ClientPrestreamTextures_Params();
+        parms.ForcedActor = ForcedActor?.Ptr ?? 0;
+        parms.ForceDuration = ForceDuration;
+        parms.bEnableStreaming = bEnableStreaming ? 1 : 0;
+        parms.CinematicTextureGroups = CinematicTextureGroups;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientSetForceMipLevelsToBeResidentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ClientSetForceMipLevelsToBeResident_Params
+    {
+        [FieldOffset(0)] public nint Material;
+        [FieldOffset(4)] public float ForceDuration;
+        [FieldOffset(8)] public int CinematicTextureGroups;
+    }
+
     /// <summary>
     /// Function: ClientSetForceMipLevelsToBeResident
     /// </summary>
     public unsafe virtual void ClientSetForceMipLevelsToBeResident(BmSDK.Engine.MaterialInterface Material, float ForceDuration, int CinematicTextureGroups = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetForceMipLevelsToBeResident", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Material, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ForceDuration, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CinematicTextureGroups, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetForceMipLevelsToBeResidentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetForceMipLevelsToBeResident", true);
+        var parms = new ClientSetForceMipLevelsToBeResident_Params();
+        parms.Material = Material?.Ptr ?? 0;
+        parms.ForceDuration = ForceDuration;
+        parms.CinematicTextureGroups = CinematicTextureGroups;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientControlMovieTextureFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 5)]
+    private struct ClientControlMovieTexture_Params
+    {
+        [FieldOffset(0)] public nint MovieTexture;
+        [FieldOffset(4)] public BmSDK.Engine.SeqAct_ControlMovieTexture.EMovieControlType Mode;
+    }
+
     /// <summary>
     /// Function: ClientControlMovieTexture
     /// </summary>
     public unsafe virtual void ClientControlMovieTexture(BmSDK.Engine.TextureMovie MovieTexture, BmSDK.Engine.SeqAct_ControlMovieTexture.EMovieControlType Mode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientControlMovieTexture", true);
-        byte* paramsPtr = stackalloc byte[5];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MovieTexture, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Mode, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientControlMovieTextureFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientControlMovieTexture", true);
+        var parms = new ClientControlMovieTexture_Params();
+        parms.MovieTexture = MovieTexture?.Ptr ?? 0;
+        parms.Mode = Mode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSplitscreenPlayerByIndexFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetSplitscreenPlayerByIndex_Params
+    {
+        [FieldOffset(0)] public int PlayerIndex;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetSplitscreenPlayerByIndex
     /// </summary>
     public unsafe virtual BmSDK.Engine.PlayerReplicationInfo GetSplitscreenPlayerByIndex(int PlayerIndex = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetSplitscreenPlayerByIndex", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerIndex, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PlayerReplicationInfo>(paramsPtr + 4);
+        var funcManaged = s_GetSplitscreenPlayerByIndexFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetSplitscreenPlayerByIndex", true);
+        var parms = new GetSplitscreenPlayerByIndex_Params();
+        parms.PlayerIndex = PlayerIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.PlayerReplicationInfo)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsSplitscreenPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct IsSplitscreenPlayer_Params
+    {
+        [FieldOffset(0)] public int out_SplitscreenPlayerIndex;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -475,11 +690,18 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool IsSplitscreenPlayer(out int out_SplitscreenPlayerIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsSplitscreenPlayer", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        out_SplitscreenPlayerIndex = BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_IsSplitscreenPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsSplitscreenPlayer", true);
+        var parms = new IsSplitscreenPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        out_SplitscreenPlayerIndex = parms.out_SplitscreenPlayerIndex;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsPrimaryPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct IsPrimaryPlayer_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -487,10 +709,16 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool IsPrimaryPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsPrimaryPlayer", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsPrimaryPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsPrimaryPlayer", true);
+        var parms = new IsPrimaryPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PathClearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PathClear_Params
+    {
     }
 
     /// <summary>
@@ -498,346 +726,551 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void PathClear()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PathClear", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PathClearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PathClear", true);
+        var parms = new PathClear_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PathChildFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PathChild_Params
+    {
+        [FieldOffset(0)] public int Cnt;
+    }
+
     /// <summary>
     /// Function: PathChild
     /// </summary>
     public unsafe virtual void PathChild(int Cnt = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PathChild", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Cnt, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PathChildFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PathChild", true);
+        var parms = new PathChild_Params();
+        parms.Cnt = Cnt;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PathStepFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PathStep_Params
+    {
+        [FieldOffset(0)] public int Cnt;
+    }
+
     /// <summary>
     /// Function: PathStep
     /// </summary>
     public unsafe virtual void PathStep(int Cnt = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PathStep", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Cnt, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PathStepFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PathStep", true);
+        var parms = new PathStep_Params();
+        parms.Cnt = Cnt;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnPlayerHasBeenMovedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct OnPlayerHasBeenMoved_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnPlayerHasBeenMoved
     /// </summary>
     public unsafe virtual void OnPlayerHasBeenMoved()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnPlayerHasBeenMoved", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnPlayerHasBeenMovedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnPlayerHasBeenMoved", true);
+        var parms = new OnPlayerHasBeenMoved_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SoakPauseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SoakPause_Params
+    {
+        [FieldOffset(0)] public nint P;
+    }
+
     /// <summary>
     /// Function: SoakPause
     /// </summary>
     public unsafe virtual void SoakPause(BmSDK.Engine.Pawn P)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SoakPause", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(P, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SoakPauseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SoakPause", true);
+        var parms = new SoakPause_Params();
+        parms.P = P?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IncrementNumberOfMatchesPlayedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct IncrementNumberOfMatchesPlayed_Params
+    {
+    }
+
     /// <summary>
     /// Function: IncrementNumberOfMatchesPlayed
     /// </summary>
     public unsafe virtual void IncrementNumberOfMatchesPlayed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IncrementNumberOfMatchesPlayed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IncrementNumberOfMatchesPlayedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IncrementNumberOfMatchesPlayed", true);
+        var parms = new IncrementNumberOfMatchesPlayed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientEndOnlineGameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientEndOnlineGame_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientEndOnlineGame
     /// </summary>
     public unsafe virtual void ClientEndOnlineGame()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientEndOnlineGame", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientEndOnlineGameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientEndOnlineGame", true);
+        var parms = new ClientEndOnlineGame_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientStartOnlineGameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientStartOnlineGame_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientStartOnlineGame
     /// </summary>
     public unsafe virtual void ClientStartOnlineGame()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStartOnlineGame", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientStartOnlineGameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStartOnlineGame", true);
+        var parms = new ClientStartOnlineGame_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerRegisterClientStatGuidFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ServerRegisterClientStatGuid_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString StatGuid;
+    }
+
     /// <summary>
     /// Function: ServerRegisterClientStatGuid
     /// </summary>
     public unsafe virtual void ServerRegisterClientStatGuid(BmSDK.FString StatGuid)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerRegisterClientStatGuid", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StatGuid, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRegisterClientStatGuidFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerRegisterClientStatGuid", true);
+        var parms = new ServerRegisterClientStatGuid_Params();
+        parms.StatGuid = StatGuid;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnRegisterHostStatGuidCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct OnRegisterHostStatGuidComplete_Params
+    {
+        [FieldOffset(0)] public int bWasSuccessful;
+    }
+
     /// <summary>
     /// Function: OnRegisterHostStatGuidComplete
     /// </summary>
     public unsafe virtual void OnRegisterHostStatGuidComplete(bool bWasSuccessful)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnRegisterHostStatGuidComplete", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWasSuccessful, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnRegisterHostStatGuidCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnRegisterHostStatGuidComplete", true);
+        var parms = new OnRegisterHostStatGuidComplete_Params();
+        parms.bWasSuccessful = bWasSuccessful ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientRegisterHostStatGuidFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ClientRegisterHostStatGuid_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString StatGuid;
+    }
+
     /// <summary>
     /// Function: ClientRegisterHostStatGuid
     /// </summary>
     public unsafe virtual void ClientRegisterHostStatGuid(BmSDK.FString StatGuid)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientRegisterHostStatGuid", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StatGuid, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientRegisterHostStatGuidFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientRegisterHostStatGuid", true);
+        var parms = new ClientRegisterHostStatGuid_Params();
+        parms.StatGuid = StatGuid;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveAllDebugStringsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveAllDebugStrings_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveAllDebugStrings
     /// </summary>
     public unsafe virtual void RemoveAllDebugStrings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RemoveAllDebugStrings", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveAllDebugStringsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RemoveAllDebugStrings", true);
+        var parms = new RemoveAllDebugStrings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveDebugTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoveDebugText_Params
+    {
+        [FieldOffset(0)] public nint SrcActor;
+    }
+
     /// <summary>
     /// Function: RemoveDebugText
     /// </summary>
     public unsafe virtual void RemoveDebugText(BmSDK.Engine.Actor SrcActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RemoveDebugText", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SrcActor, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoveDebugTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RemoveDebugText", true);
+        var parms = new RemoveDebugText_Params();
+        parms.SrcActor = SrcActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddDebugTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct AddDebugText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString DebugText;
+        [FieldOffset(12)] public nint SrcActor;
+        [FieldOffset(16)] public float Duration;
+        [FieldOffset(20)] public System.Numerics.Vector3 Offset;
+        [FieldOffset(32)] public System.Numerics.Vector3 DesiredOffset;
+        [FieldOffset(44)] public BmSDK.GameObject.FColor TextColor;
+        [FieldOffset(48)] public int bSkipOverwriteCheck;
+        [FieldOffset(52)] public int bAbsoluteLocation;
+        [FieldOffset(56)] public int bKeepAttachedToActor;
+        [FieldOffset(60)] public nint InFont;
+    }
+
     /// <summary>
     /// Function: AddDebugText
     /// </summary>
     public unsafe virtual void AddDebugText(BmSDK.FString DebugText, BmSDK.Engine.Actor SrcActor = default, float Duration = default, System.Numerics.Vector3 Offset = default, System.Numerics.Vector3 DesiredOffset = default, BmSDK.GameObject.FColor TextColor = default, bool bSkipOverwriteCheck = default, bool bAbsoluteLocation = default, bool bKeepAttachedToActor = default, BmSDK.Engine.Font InFont = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AddDebugText", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DebugText, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SrcActor, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Offset, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DesiredOffset, paramsPtr + 32);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TextColor, paramsPtr + 44);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSkipOverwriteCheck, paramsPtr + 48);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAbsoluteLocation, paramsPtr + 52);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bKeepAttachedToActor, paramsPtr + 56);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InFont, paramsPtr + 60);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddDebugTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AddDebugText", true);
+        var parms = new AddDebugText_Params();
+        parms.DebugText = DebugText;
+        parms.SrcActor = SrcActor?.Ptr ?? 0;
+        parms.Duration = Duration;
+        parms.Offset = Offset;
+        parms.DesiredOffset = DesiredOffset;
+        parms.TextColor = TextColor;
+        parms.bSkipOverwriteCheck = bSkipOverwriteCheck ? 1 : 0;
+        parms.bAbsoluteLocation = bAbsoluteLocation ? 1 : 0;
+        parms.bKeepAttachedToActor = bKeepAttachedToActor ? 1 : 0;
+        parms.InFont = InFont?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawDebugTextListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct DrawDebugTextList_Params
+    {
+        [FieldOffset(0)] public nint Canvas;
+        [FieldOffset(4)] public float RenderDelta;
+    }
+
     /// <summary>
     /// Function: DrawDebugTextList
     /// </summary>
     public unsafe virtual void DrawDebugTextList(BmSDK.Engine.Canvas Canvas, float RenderDelta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DrawDebugTextList", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Canvas, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RenderDelta, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawDebugTextListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DrawDebugTextList", true);
+        var parms = new DrawDebugTextList_Params();
+        parms.Canvas = Canvas?.Ptr ?? 0;
+        parms.RenderDelta = RenderDelta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SendToConsoleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SendToConsole_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Command;
+    }
+
     /// <summary>
     /// Function: SendToConsole
     /// </summary>
     public unsafe virtual void SendToConsole(BmSDK.FString Command)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SendToConsole", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Command, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SendToConsoleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SendToConsole", true);
+        var parms = new SendToConsole_Params();
+        parms.Command = Command;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ConsoleKeyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ConsoleKey_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName Key;
+    }
+
     /// <summary>
     /// Function: ConsoleKey
     /// </summary>
     public unsafe virtual void ConsoleKey(BmSDK.FName Key)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ConsoleKey", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Key, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ConsoleKeyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ConsoleKey", true);
+        var parms = new ConsoleKey_Params();
+        parms.Key = Key;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnDestroyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnDestroy_Params
+    {
+        [FieldOffset(0)] public nint Action;
+    }
+
     /// <summary>
     /// Function: OnDestroy
     /// </summary>
     public unsafe override void OnDestroy(BmSDK.Engine.SeqAct_Destroy Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnDestroy", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnDestroyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnDestroy", true);
+        var parms = new OnDestroy_Params();
+        parms.Action = Action?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientStartNetworkedVoiceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientStartNetworkedVoice_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientStartNetworkedVoice
     /// </summary>
     public unsafe virtual void ClientStartNetworkedVoice()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStartNetworkedVoice", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientStartNetworkedVoiceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStartNetworkedVoice", true);
+        var parms = new ClientStartNetworkedVoice_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientStopNetworkedVoiceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientStopNetworkedVoice_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientStopNetworkedVoice
     /// </summary>
     public unsafe virtual void ClientStopNetworkedVoice()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStopNetworkedVoice", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientStopNetworkedVoiceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStopNetworkedVoice", true);
+        var parms = new ClientStopNetworkedVoice_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientSetHostUniqueIdFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ClientSetHostUniqueId_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId InHostId;
+    }
+
     /// <summary>
     /// Function: ClientSetHostUniqueId
     /// </summary>
     public unsafe virtual void ClientSetHostUniqueId(BmSDK.Engine.OnlineSubsystem.FUniqueNetId InHostId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetHostUniqueId", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InHostId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetHostUniqueIdFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetHostUniqueId", true);
+        var parms = new ClientSetHostUniqueId_Params();
+        parms.InHostId = InHostId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientWriteLeaderboardStatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientWriteLeaderboardStats_Params
+    {
+        [FieldOffset(0)] public nint OnlineStatsWriteClass;
+    }
+
     /// <summary>
     /// Function: ClientWriteLeaderboardStats
     /// </summary>
     public unsafe virtual void ClientWriteLeaderboardStats(BmSDK.Class OnlineStatsWriteClass)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientWriteLeaderboardStats", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OnlineStatsWriteClass, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientWriteLeaderboardStatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientWriteLeaderboardStats", true);
+        var parms = new ClientWriteLeaderboardStats_Params();
+        parms.OnlineStatsWriteClass = OnlineStatsWriteClass?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientWriteOnlinePlayerScoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct ClientWriteOnlinePlayerScores_Params
+    {
+        [FieldOffset(0)] public int LeaderboardId;
+    }
+
     /// <summary>
     /// Function: ClientWriteOnlinePlayerScores
     /// </summary>
     public unsafe virtual void ClientWriteOnlinePlayerScores(int LeaderboardId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientWriteOnlinePlayerScores", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LeaderboardId, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientWriteOnlinePlayerScoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientWriteOnlinePlayerScores", true);
+        var parms = new ClientWriteOnlinePlayerScores_Params();
+        parms.LeaderboardId = LeaderboardId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientArbitratedMatchEndedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientArbitratedMatchEnded_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientArbitratedMatchEnded
     /// </summary>
     public unsafe virtual void ClientArbitratedMatchEnded()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientArbitratedMatchEnded", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientArbitratedMatchEndedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientArbitratedMatchEnded", true);
+        var parms = new ClientArbitratedMatchEnded_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyNotEnoughSpaceInInviteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NotifyNotEnoughSpaceInInvite_Params
+    {
+    }
+
     /// <summary>
     /// Function: NotifyNotEnoughSpaceInInvite
     /// </summary>
     public unsafe virtual void NotifyNotEnoughSpaceInInvite()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyNotEnoughSpaceInInvite", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyNotEnoughSpaceInInviteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyNotEnoughSpaceInInvite", true);
+        var parms = new NotifyNotEnoughSpaceInInvite_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyNotAllPlayersCanJoinInviteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NotifyNotAllPlayersCanJoinInvite_Params
+    {
+    }
+
     /// <summary>
     /// Function: NotifyNotAllPlayersCanJoinInvite
     /// </summary>
     public unsafe virtual void NotifyNotAllPlayersCanJoinInvite()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyNotAllPlayersCanJoinInvite", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyNotAllPlayersCanJoinInviteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyNotAllPlayersCanJoinInvite", true);
+        var parms = new NotifyNotAllPlayersCanJoinInvite_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyInviteFailedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NotifyInviteFailed_Params
+    {
+    }
+
     /// <summary>
     /// Function: NotifyInviteFailed
     /// </summary>
     public unsafe virtual void NotifyInviteFailed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyInviteFailed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyInviteFailedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyInviteFailed", true);
+        var parms = new NotifyInviteFailed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnInviteJoinCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct OnInviteJoinComplete_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName SessionName;
+        [FieldOffset(8)] public int bWasSuccessful;
+    }
+
     /// <summary>
     /// Function: OnInviteJoinComplete
     /// </summary>
     public unsafe virtual void OnInviteJoinComplete(BmSDK.FName SessionName, bool bWasSuccessful)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnInviteJoinComplete", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SessionName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWasSuccessful, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnInviteJoinCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnInviteJoinComplete", true);
+        var parms = new OnInviteJoinComplete_Params();
+        parms.SessionName = SessionName;
+        parms.bWasSuccessful = bWasSuccessful ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ModifyClientURLFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ModifyClientURL_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString URL;
+        [FieldOffset(12)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: ModifyClientURL
     /// </summary>
     public unsafe virtual BmSDK.FString ModifyClientURL(BmSDK.FString URL)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ModifyClientURL", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(URL, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
+        var funcManaged = s_ModifyClientURLFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ModifyClientURL", true);
+        var parms = new ModifyClientURL_Params();
+        parms.URL = URL;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_OnDestroyForInviteCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OnDestroyForInviteComplete_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName SessionName;
+        [FieldOffset(8)] public int bWasSuccessful;
     }
 
     /// <summary>
@@ -845,47 +1278,76 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void OnDestroyForInviteComplete(BmSDK.FName SessionName, bool bWasSuccessful)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnDestroyForInviteComplete", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SessionName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWasSuccessful, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnDestroyForInviteCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnDestroyForInviteComplete", true);
+        var parms = new OnDestroyForInviteComplete_Params();
+        parms.SessionName = SessionName;
+        parms.bWasSuccessful = bWasSuccessful ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnEndForInviteCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OnEndForInviteComplete_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName SessionName;
+        [FieldOffset(8)] public int bWasSuccessful;
+    }
+
     /// <summary>
     /// Function: OnEndForInviteComplete
     /// </summary>
     public unsafe virtual void OnEndForInviteComplete(BmSDK.FName SessionName, bool bWasSuccessful)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnEndForInviteComplete", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SessionName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWasSuccessful, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnEndForInviteCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnEndForInviteComplete", true);
+        var parms = new OnEndForInviteComplete_Params();
+        parms.SessionName = SessionName;
+        parms.bWasSuccessful = bWasSuccessful ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearInviteDelegatesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearInviteDelegates_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearInviteDelegates
     /// </summary>
     public unsafe virtual void ClearInviteDelegates()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClearInviteDelegates", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearInviteDelegatesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClearInviteDelegates", true);
+        var parms = new ClearInviteDelegates_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanAllPlayersPlayOnlineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CanAllPlayersPlayOnline_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanAllPlayersPlayOnline
     /// </summary>
     public unsafe virtual bool CanAllPlayersPlayOnline()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanAllPlayersPlayOnline", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanAllPlayersPlayOnlineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanAllPlayersPlayOnline", true);
+        var parms = new CanAllPlayersPlayOnline_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InviteHasEnoughSpaceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct InviteHasEnoughSpace_Params
+    {
+        [FieldOffset(0)] public nint InviteSettings;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -893,11 +1355,18 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool InviteHasEnoughSpace(BmSDK.Engine.OnlineGameSettings InviteSettings)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.InviteHasEnoughSpace", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InviteSettings, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_InviteHasEnoughSpaceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.InviteHasEnoughSpace", true);
+        var parms = new InviteHasEnoughSpace_Params();
+        parms.InviteSettings = InviteSettings?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnGameInviteAcceptedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OnGameInviteAccepted_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.OnlineGameSearch.FOnlineGameSearchResult InviteResult;
     }
 
     /// <summary>
@@ -905,76 +1374,110 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void OnGameInviteAccepted(out BmSDK.Engine.OnlineGameSearch.FOnlineGameSearchResult InviteResult)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnGameInviteAccepted", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        InviteResult = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.OnlineGameSearch.FOnlineGameSearchResult>(paramsPtr + 0);
+        var funcManaged = s_OnGameInviteAcceptedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnGameInviteAccepted", true);
+        var parms = new OnGameInviteAccepted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        InviteResult = parms.InviteResult;
         return;
     }
 
+    static BmSDK.Function s_ServerRegisteredForArbitrationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ServerRegisteredForArbitration_Params
+    {
+        [FieldOffset(0)] public int bWasSuccessful;
+    }
+
     /// <summary>
     /// Function: ServerRegisteredForArbitration
     /// </summary>
     public unsafe virtual void ServerRegisteredForArbitration(bool bWasSuccessful)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerRegisteredForArbitration", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWasSuccessful, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRegisteredForArbitrationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerRegisteredForArbitration", true);
+        var parms = new ServerRegisteredForArbitration_Params();
+        parms.bWasSuccessful = bWasSuccessful ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnArbitrationRegisterCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OnArbitrationRegisterComplete_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName SessionName;
+        [FieldOffset(8)] public int bWasSuccessful;
+    }
+
     /// <summary>
     /// Function: OnArbitrationRegisterComplete
     /// </summary>
     public unsafe virtual void OnArbitrationRegisterComplete(BmSDK.FName SessionName, bool bWasSuccessful)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnArbitrationRegisterComplete", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SessionName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWasSuccessful, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnArbitrationRegisterCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnArbitrationRegisterComplete", true);
+        var parms = new OnArbitrationRegisterComplete_Params();
+        parms.SessionName = SessionName;
+        parms.bWasSuccessful = bWasSuccessful ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientRegisterForArbitrationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientRegisterForArbitration_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientRegisterForArbitration
     /// </summary>
     public unsafe virtual void ClientRegisterForArbitration()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientRegisterForArbitration", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientRegisterForArbitrationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientRegisterForArbitration", true);
+        var parms = new ClientRegisterForArbitration_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientWasKickedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientWasKicked_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientWasKicked
     /// </summary>
     public unsafe virtual void ClientWasKicked()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientWasKicked", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientWasKickedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientWasKicked", true);
+        var parms = new ClientWasKicked_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsShowingSubtitlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsShowingSubtitles_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsShowingSubtitles
     /// </summary>
     public unsafe virtual bool IsShowingSubtitles()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsShowingSubtitles", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsShowingSubtitlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsShowingSubtitles", true);
+        var parms = new IsShowingSubtitles_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetShowSubtitlesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetShowSubtitles_Params
+    {
+        [FieldOffset(0)] public int bValue;
     }
 
     /// <summary>
@@ -982,60 +1485,73 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void SetShowSubtitles(bool bValue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetShowSubtitles", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bValue, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetShowSubtitlesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetShowSubtitles", true);
+        var parms = new SetShowSubtitles_Params();
+        parms.bValue = bValue ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyDirectorControlFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct NotifyDirectorControl_Params
+    {
+        [FieldOffset(0)] public int bNowControlling;
+    }
+
     /// <summary>
     /// Function: NotifyDirectorControl
     /// </summary>
     public unsafe virtual void NotifyDirectorControl(bool bNowControlling)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyDirectorControl", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNowControlling, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyDirectorControlFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyDirectorControl", true);
+        var parms = new NotifyDirectorControl_Params();
+        parms.bNowControlling = bNowControlling ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientVoiceHandshakeCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientVoiceHandshakeComplete_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientVoiceHandshakeComplete
     /// </summary>
     public unsafe virtual void ClientVoiceHandshakeComplete()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientVoiceHandshakeComplete", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientVoiceHandshakeCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientVoiceHandshakeComplete", true);
+        var parms = new ClientVoiceHandshakeComplete_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPlayerControllerFromNetIdFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetPlayerControllerFromNetId_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId PlayerNetId;
+        [FieldOffset(8)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetPlayerControllerFromNetId
     /// </summary>
     public unsafe static BmSDK.Engine.PlayerController GetPlayerControllerFromNetId(BmSDK.Engine.OnlineSubsystem.FUniqueNetId PlayerNetId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetPlayerControllerFromNetId", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerNetId, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PlayerController>(paramsPtr + 8);
+        var funcManaged = s_GetPlayerControllerFromNetIdFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetPlayerControllerFromNetId", true);
+        var parms = new GetPlayerControllerFromNetId_Params();
+        parms.PlayerNetId = PlayerNetId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.PlayerController)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ClientSetOnlineStatusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientSetOnlineStatus_Params
+    {
     }
 
     /// <summary>
@@ -1043,66 +1559,95 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ClientSetOnlineStatus()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetOnlineStatus", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetOnlineStatusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetOnlineStatus", true);
+        var parms = new ClientSetOnlineStatus_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SeamlessTravelFromFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SeamlessTravelFrom_Params
+    {
+        [FieldOffset(0)] public nint OldPC;
+    }
+
     /// <summary>
     /// Function: SeamlessTravelFrom
     /// </summary>
     public unsafe virtual void SeamlessTravelFrom(BmSDK.Engine.PlayerController OldPC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SeamlessTravelFrom", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OldPC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SeamlessTravelFromFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SeamlessTravelFrom", true);
+        var parms = new SeamlessTravelFrom_Params();
+        parms.OldPC = OldPC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SeamlessTravelToFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SeamlessTravelTo_Params
+    {
+        [FieldOffset(0)] public nint NewPC;
+    }
+
     /// <summary>
     /// Function: SeamlessTravelTo
     /// </summary>
     public unsafe virtual void SeamlessTravelTo(BmSDK.Engine.PlayerController NewPC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SeamlessTravelTo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPC, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SeamlessTravelToFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SeamlessTravelTo", true);
+        var parms = new SeamlessTravelTo_Params();
+        parms.NewPC = NewPC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetSeamlessTravelActorListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct GetSeamlessTravelActorList_Params
+    {
+        [FieldOffset(0)] public int bToEntry;
+    }
+
     /// <summary>
     /// Function: GetSeamlessTravelActorList
     /// </summary>
     public unsafe virtual void GetSeamlessTravelActorList(bool bToEntry, out BmSDK.TArray<BmSDK.Engine.Actor> ActorList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetSeamlessTravelActorList", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bToEntry, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        ActorList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor>>(paramsPtr + 4);
+        var funcManaged = s_GetSeamlessTravelActorListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetSeamlessTravelActorList", true);
+        var parms = new GetSeamlessTravelActorList_Params();
+        parms.bToEntry = bToEntry ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        ActorList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Actor>>((byte*)&parms + 4);
         return;
     }
 
+    static BmSDK.Function s_IsPlayerMutedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct IsPlayerMuted_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId Sender;
+        [FieldOffset(8)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsPlayerMuted
     /// </summary>
     public unsafe virtual bool IsPlayerMuted(out BmSDK.Engine.OnlineSubsystem.FUniqueNetId Sender)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsPlayerMuted", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        Sender = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.OnlineSubsystem.FUniqueNetId>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 8);
+        var funcManaged = s_IsPlayerMutedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsPlayerMuted", true);
+        var parms = new IsPlayerMuted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        Sender = parms.Sender;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetUIControllerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetUIController_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -1110,10 +1655,17 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual BmSDK.Engine.UIInteraction GetUIController()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetUIController", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.UIInteraction>(paramsPtr + 0);
+        var funcManaged = s_GetUIControllerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetUIController", true);
+        var parms = new GetUIController_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.UIInteraction)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SaveActorConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SaveActorConfig_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName actorName;
     }
 
     /// <summary>
@@ -1121,201 +1673,287 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void SaveActorConfig(BmSDK.FName actorName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SaveActorConfig", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(actorName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SaveActorConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SaveActorConfig", true);
+        var parms = new SaveActorConfig_Params();
+        parms.actorName = actorName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SaveClassConfigFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct SaveClassConfig_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ClassName;
+    }
+
     /// <summary>
     /// Function: SaveClassConfig
     /// </summary>
     public unsafe virtual void SaveClassConfig(BmSDK.FString ClassName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SaveClassConfig", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ClassName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SaveClassConfigFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SaveClassConfig", true);
+        var parms = new SaveClassConfig_Params();
+        parms.ClassName = ClassName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientSetBlockOnAsyncLoadingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientSetBlockOnAsyncLoading_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientSetBlockOnAsyncLoading
     /// </summary>
     public unsafe virtual void ClientSetBlockOnAsyncLoading()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetBlockOnAsyncLoading", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetBlockOnAsyncLoadingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetBlockOnAsyncLoading", true);
+        var parms = new ClientSetBlockOnAsyncLoading_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientFlushLevelStreamingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientFlushLevelStreaming_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientFlushLevelStreaming
     /// </summary>
     public unsafe virtual void ClientFlushLevelStreaming()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientFlushLevelStreaming", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClientFlushLevelStreamingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientFlushLevelStreaming", true);
+        var parms = new ClientFlushLevelStreaming_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientCancelPendingMapChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientCancelPendingMapChange_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientCancelPendingMapChange
     /// </summary>
     public unsafe virtual void ClientCancelPendingMapChange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientCancelPendingMapChange", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientCancelPendingMapChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientCancelPendingMapChange", true);
+        var parms = new ClientCancelPendingMapChange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientCommitMapChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientCommitMapChange_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientCommitMapChange
     /// </summary>
     public unsafe virtual void ClientCommitMapChange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientCommitMapChange", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientCommitMapChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientCommitMapChange", true);
+        var parms = new ClientCommitMapChange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DelayedPrepareMapChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct DelayedPrepareMapChange_Params
+    {
+    }
+
     /// <summary>
     /// Function: DelayedPrepareMapChange
     /// </summary>
     public unsafe virtual void DelayedPrepareMapChange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DelayedPrepareMapChange", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DelayedPrepareMapChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DelayedPrepareMapChange", true);
+        var parms = new DelayedPrepareMapChange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientPrepareMapChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ClientPrepareMapChange_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName LevelName;
+        [FieldOffset(8)] public int bFirst;
+        [FieldOffset(12)] public int bLast;
+    }
+
     /// <summary>
     /// Function: ClientPrepareMapChange
     /// </summary>
     public unsafe virtual void ClientPrepareMapChange(BmSDK.FName LevelName, bool bFirst, bool bLast)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPrepareMapChange", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LevelName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFirst, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bLast, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientPrepareMapChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPrepareMapChange", true);
+        var parms = new ClientPrepareMapChange_Params();
+        parms.LevelName = LevelName;
+        parms.bFirst = bFirst ? 1 : 0;
+        parms.bLast = bLast ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerUpdateLevelVisibilityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ServerUpdateLevelVisibility_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName PackageName;
+        [FieldOffset(8)] public int bIsVisible;
+    }
+
     /// <summary>
     /// Function: ServerUpdateLevelVisibility
     /// </summary>
     public unsafe virtual void ServerUpdateLevelVisibility(BmSDK.FName PackageName, bool bIsVisible)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerUpdateLevelVisibility", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PackageName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsVisible, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ServerUpdateLevelVisibilityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerUpdateLevelVisibility", true);
+        var parms = new ServerUpdateLevelVisibility_Params();
+        parms.PackageName = PackageName;
+        parms.bIsVisible = bIsVisible ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientUpdateLevelStreamingStatusFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ClientUpdateLevelStreamingStatus_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName PackageName;
+        [FieldOffset(8)] public int bNewShouldBeLoaded;
+        [FieldOffset(12)] public int bNewShouldBeVisible;
+        [FieldOffset(16)] public int bNewShouldBlockOnLoad;
+    }
+
     /// <summary>
     /// Function: ClientUpdateLevelStreamingStatus
     /// </summary>
     public unsafe virtual void ClientUpdateLevelStreamingStatus(BmSDK.FName PackageName, bool bNewShouldBeLoaded, bool bNewShouldBeVisible, bool bNewShouldBlockOnLoad)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientUpdateLevelStreamingStatus", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PackageName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewShouldBeLoaded, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewShouldBeVisible, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewShouldBlockOnLoad, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClientUpdateLevelStreamingStatusFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientUpdateLevelStreamingStatus", true);
+        var parms = new ClientUpdateLevelStreamingStatus_Params();
+        parms.PackageName = PackageName;
+        parms.bNewShouldBeLoaded = bNewShouldBeLoaded ? 1 : 0;
+        parms.bNewShouldBeVisible = bNewShouldBeVisible ? 1 : 0;
+        parms.bNewShouldBlockOnLoad = bNewShouldBlockOnLoad ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LevelStreamingStatusChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct LevelStreamingStatusChanged_Params
+    {
+        [FieldOffset(0)] public nint LevelObject;
+        [FieldOffset(4)] public int bNewShouldBeLoaded;
+        [FieldOffset(8)] public int bNewShouldBeVisible;
+        [FieldOffset(12)] public int bNewShouldBlockOnLoad;
+    }
+
     /// <summary>
     /// Function: LevelStreamingStatusChanged
     /// </summary>
     public unsafe virtual void LevelStreamingStatusChanged(BmSDK.Engine.LevelStreaming LevelObject, bool bNewShouldBeLoaded, bool bNewShouldBeVisible, bool bNewShouldBlockOnLoad)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LevelStreamingStatusChanged", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LevelObject, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewShouldBeLoaded, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewShouldBeVisible, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewShouldBlockOnLoad, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LevelStreamingStatusChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LevelStreamingStatusChanged", true);
+        var parms = new LevelStreamingStatusChanged_Params();
+        parms.LevelObject = LevelObject?.Ptr ?? 0;
+        parms.bNewShouldBeLoaded = bNewShouldBeLoaded ? 1 : 0;
+        parms.bNewShouldBeVisible = bNewShouldBeVisible ? 1 : 0;
+        parms.bNewShouldBlockOnLoad = bNewShouldBlockOnLoad ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientForceGarbageCollectionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientForceGarbageCollection_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientForceGarbageCollection
     /// </summary>
     public unsafe virtual void ClientForceGarbageCollection()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientForceGarbageCollection", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientForceGarbageCollectionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientForceGarbageCollection", true);
+        var parms = new ClientForceGarbageCollection_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnConsoleCommandFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct OnConsoleCommand_Params
+    {
+        [FieldOffset(0)] public nint inAction;
+    }
+
     /// <summary>
     /// Function: OnConsoleCommand
     /// </summary>
     public unsafe virtual void OnConsoleCommand(BmSDK.Engine.SeqAct_ConsoleCommand inAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnConsoleCommand", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnConsoleCommandFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnConsoleCommand", true);
+        var parms = new OnConsoleCommand_Params();
+        parms.inAction = inAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetPlayerMovementInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetPlayerMovementInput_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetPlayerMovementInput
     /// </summary>
     public unsafe virtual void ResetPlayerMovementInput()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ResetPlayerMovementInput", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetPlayerMovementInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ResetPlayerMovementInput", true);
+        var parms = new ResetPlayerMovementInput_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsLookInputIgnoredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsLookInputIgnored_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsLookInputIgnored
     /// </summary>
     public unsafe virtual bool IsLookInputIgnored()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsLookInputIgnored", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsLookInputIgnoredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsLookInputIgnored", true);
+        var parms = new IsLookInputIgnored_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IgnoreLookInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IgnoreLookInput_Params
+    {
+        [FieldOffset(0)] public int bNewLookInput;
     }
 
     /// <summary>
@@ -1323,22 +1961,36 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void IgnoreLookInput(bool bNewLookInput)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IgnoreLookInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewLookInput, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IgnoreLookInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IgnoreLookInput", true);
+        var parms = new IgnoreLookInput_Params();
+        parms.bNewLookInput = bNewLookInput ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsMoveInputIgnoredFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsMoveInputIgnored_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsMoveInputIgnored
     /// </summary>
     public unsafe virtual bool IsMoveInputIgnored()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsMoveInputIgnored", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsMoveInputIgnoredFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsMoveInputIgnored", true);
+        var parms = new IsMoveInputIgnored_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IgnoreMoveInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IgnoreMoveInput_Params
+    {
+        [FieldOffset(0)] public int bNewMoveInput;
     }
 
     /// <summary>
@@ -1346,67 +1998,111 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void IgnoreMoveInput(bool bNewMoveInput)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IgnoreMoveInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bNewMoveInput, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_IgnoreMoveInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IgnoreMoveInput", true);
+        var parms = new IgnoreMoveInput_Params();
+        parms.bNewMoveInput = bNewMoveInput ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientSetCinematicModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ClientSetCinematicMode_Params
+    {
+        [FieldOffset(0)] public int bInCinematicMode;
+        [FieldOffset(4)] public int bAffectsMovement;
+        [FieldOffset(8)] public int bAffectsTurning;
+        [FieldOffset(12)] public int bAffectsHUD;
+    }
+
     /// <summary>
     /// Function: ClientSetCinematicMode
     /// </summary>
     public unsafe virtual void ClientSetCinematicMode(bool bInCinematicMode, bool bAffectsMovement, bool bAffectsTurning, bool bAffectsHUD)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetCinematicMode", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInCinematicMode, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAffectsMovement, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAffectsTurning, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAffectsHUD, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetCinematicModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetCinematicMode", true);
+        var parms = new ClientSetCinematicMode_Params();
+        parms.bInCinematicMode = bInCinematicMode ? 1 : 0;
+        parms.bAffectsMovement = bAffectsMovement ? 1 : 0;
+        parms.bAffectsTurning = bAffectsTurning ? 1 : 0;
+        parms.bAffectsHUD = bAffectsHUD ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCinematicModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct SetCinematicMode_Params
+    {
+        [FieldOffset(0)] public int bInCinematicMode;
+        [FieldOffset(4)] public int bHidePlayer;
+        [FieldOffset(8)] public int bAffectsHUD;
+        [FieldOffset(12)] public int bAffectsMovement;
+        [FieldOffset(16)] public int bAffectsTurning;
+        [FieldOffset(20)] public int bAffectsButtons;
+        [FieldOffset(24)] public int bCheckMovieFinishedForPause;
+    }
+
     /// <summary>
     /// Function: SetCinematicMode
     /// </summary>
     public unsafe virtual void SetCinematicMode(bool bInCinematicMode, bool bHidePlayer, bool bAffectsHUD, bool bAffectsMovement, bool bAffectsTurning, bool bAffectsButtons, bool bCheckMovieFinishedForPause)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetCinematicMode", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInCinematicMode, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bHidePlayer, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAffectsHUD, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAffectsMovement, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAffectsTurning, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAffectsButtons, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bCheckMovieFinishedForPause, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCinematicModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetCinematicMode", true);
+        var parms = new SetCinematicMode_Params();
+        parms.bInCinematicMode = bInCinematicMode ? 1 : 0;
+        parms.bHidePlayer = bHidePlayer ? 1 : 0;
+        parms.bAffectsHUD = bAffectsHUD ? 1 : 0;
+        parms.bAffectsMovement = bAffectsMovement ? 1 : 0;
+        parms.bAffectsTurning = bAffectsTurning ? 1 : 0;
+        parms.bAffectsButtons = bAffectsButtons ? 1 : 0;
+        parms.bCheckMovieFinishedForPause = bCheckMovieFinishedForPause ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnToggleCinematicModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OnToggleCinematicMode_Params
+    {
+        [FieldOffset(0)] public nint Action;
+    }
+
     /// <summary>
     /// Function: OnToggleCinematicMode
     /// </summary>
     public unsafe virtual void OnToggleCinematicMode(BmSDK.Engine.SeqAct_ToggleCinematicMode Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnToggleCinematicMode", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleCinematicModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnToggleCinematicMode", true);
+        var parms = new OnToggleCinematicMode_Params();
+        parms.Action = Action?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsForceFeedbackAllowedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsForceFeedbackAllowed_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsForceFeedbackAllowed
     /// </summary>
     public unsafe virtual bool IsForceFeedbackAllowed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsForceFeedbackAllowed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsForceFeedbackAllowedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsForceFeedbackAllowed", true);
+        var parms = new IsForceFeedbackAllowed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClientStopForceFeedbackWaveformFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientStopForceFeedbackWaveform_Params
+    {
+        [FieldOffset(0)] public nint FFWaveform;
     }
 
     /// <summary>
@@ -1414,290 +2110,462 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ClientStopForceFeedbackWaveform(BmSDK.Engine.ForceFeedbackWaveform FFWaveform = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStopForceFeedbackWaveform", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FFWaveform, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientStopForceFeedbackWaveformFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientStopForceFeedbackWaveform", true);
+        var parms = new ClientStopForceFeedbackWaveform_Params();
+        parms.FFWaveform = FFWaveform?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientPlayForceFeedbackWaveformFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ClientPlayForceFeedbackWaveform_Params
+    {
+        [FieldOffset(0)] public nint FFWaveform;
+        [FieldOffset(4)] public nint FFWaveformInstigator;
+    }
+
     /// <summary>
     /// Function: ClientPlayForceFeedbackWaveform
     /// </summary>
     public unsafe virtual void ClientPlayForceFeedbackWaveform(BmSDK.Engine.ForceFeedbackWaveform FFWaveform, BmSDK.Engine.Actor FFWaveformInstigator = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPlayForceFeedbackWaveform", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FFWaveform, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FFWaveformInstigator, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientPlayForceFeedbackWaveformFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPlayForceFeedbackWaveform", true);
+        var parms = new ClientPlayForceFeedbackWaveform_Params();
+        parms.FFWaveform = FFWaveform?.Ptr ?? 0;
+        parms.FFWaveformInstigator = FFWaveformInstigator?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayRumbleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayRumble_Params
+    {
+        [FieldOffset(0)] public nint TheAnimNotify;
+    }
+
     /// <summary>
     /// Function: PlayRumble
     /// </summary>
     public unsafe virtual void PlayRumble(BmSDK.Engine.AnimNotify_Rumble TheAnimNotify)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayRumble", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TheAnimNotify, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayRumbleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayRumble", true);
+        var parms = new PlayRumble_Params();
+        parms.TheAnimNotify = TheAnimNotify?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnForceFeedbackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnForceFeedback_Params
+    {
+        [FieldOffset(0)] public nint Action;
+    }
+
     /// <summary>
     /// Function: OnForceFeedback
     /// </summary>
     public unsafe virtual void OnForceFeedback(BmSDK.Engine.SeqAct_ForceFeedback Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnForceFeedback", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnForceFeedbackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnForceFeedback", true);
+        var parms = new OnForceFeedback_Params();
+        parms.Action = Action?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyTakeHitFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct NotifyTakeHit_Params
+    {
+        [FieldOffset(0)] public nint InstigatedBy;
+        [FieldOffset(4)] public System.Numerics.Vector3 HitLocation;
+        [FieldOffset(16)] public int Damage;
+        [FieldOffset(20)] public nint DamageType;
+        [FieldOffset(24)] public System.Numerics.Vector3 Momentum;
+    }
+
     /// <summary>
     /// Function: NotifyTakeHit
     /// </summary>
     public unsafe override void NotifyTakeHit(BmSDK.Engine.Controller InstigatedBy, System.Numerics.Vector3 HitLocation, int Damage, BmSDK.Class DamageType, System.Numerics.Vector3 Momentum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyTakeHit", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InstigatedBy, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitLocation, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Damage, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DamageType, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Momentum, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyTakeHitFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyTakeHit", true);
+        var parms = new NotifyTakeHit_Params();
+        parms.InstigatedBy = InstigatedBy?.Ptr ?? 0;
+        parms.HitLocation = HitLocation;
+        parms.Damage = Damage;
+        parms.DamageType = DamageType?.Ptr ?? 0;
+        parms.Momentum = Momentum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowGameStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowGameState_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowGameState
     /// </summary>
     public unsafe virtual void ShowGameState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ShowGameState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowGameStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ShowGameState", true);
+        var parms = new ShowGameState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ShowPlayerStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ShowPlayerState_Params
+    {
+    }
+
     /// <summary>
     /// Function: ShowPlayerState
     /// </summary>
     public unsafe virtual void ShowPlayerState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ShowPlayerState", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ShowPlayerStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ShowPlayerState", true);
+        var parms = new ShowPlayerState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerRemoteEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct ServerRemoteEvent_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName EventName;
+    }
+
     /// <summary>
     /// Function: ServerRemoteEvent
     /// </summary>
     public unsafe virtual void ServerRemoteEvent(BmSDK.FName EventName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerRemoteEvent", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRemoteEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerRemoteEvent", true);
+        var parms = new ServerRemoteEvent_Params();
+        parms.EventName = EventName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_REFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RE_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName EventName;
+    }
+
     /// <summary>
     /// Function: RE
     /// </summary>
     public unsafe virtual void RE(BmSDK.FName EventName = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RE", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_REFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RE", true);
+        var parms = new RE_Params();
+        parms.EventName = EventName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoteEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct RemoteEvent_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName EventName;
+    }
+
     /// <summary>
     /// Function: RemoteEvent
     /// </summary>
     public unsafe virtual void RemoteEvent(BmSDK.FName EventName = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RemoteEvent", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RemoteEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RemoteEvent", true);
+        var parms = new RemoteEvent_Params();
+        parms.EventName = EventName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ListCEFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ListCE_Params
+    {
+    }
+
     /// <summary>
     /// Function: ListCE
     /// </summary>
     public unsafe virtual void ListCE()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ListCE", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ListCEFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ListCE", true);
+        var parms = new ListCE_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ListConsoleEventsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ListConsoleEvents_Params
+    {
+    }
+
     /// <summary>
     /// Function: ListConsoleEvents
     /// </summary>
     public unsafe virtual void ListConsoleEvents()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ListConsoleEvents", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ListConsoleEventsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ListConsoleEvents", true);
+        var parms = new ListConsoleEvents_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerCauseEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct ServerCauseEvent_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName EventName;
+    }
+
     /// <summary>
     /// Function: ServerCauseEvent
     /// </summary>
     public unsafe virtual void ServerCauseEvent(BmSDK.FName EventName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerCauseEvent", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EventName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerCauseEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerCauseEvent", true);
+        var parms = new ServerCauseEvent_Params();
+        parms.EventName = EventName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnToggleHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnToggleHUD_Params
+    {
+        [FieldOffset(0)] public nint inAction;
+    }
+
     /// <summary>
     /// Function: OnToggleHUD
     /// </summary>
     public unsafe virtual void OnToggleHUD(BmSDK.Engine.SeqAct_ToggleHUD inAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnToggleHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnToggleHUD", true);
+        var parms = new OnToggleHUD_Params();
+        parms.inAction = inAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnSetCameraTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OnSetCameraTarget_Params
+    {
+        [FieldOffset(0)] public nint inAction;
+    }
+
     /// <summary>
     /// Function: OnSetCameraTarget
     /// </summary>
     public unsafe virtual void OnSetCameraTarget(BmSDK.Engine.SeqAct_SetCameraTarget inAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnSetCameraTarget", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnSetCameraTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnSetCameraTarget", true);
+        var parms = new OnSetCameraTarget_Params();
+        parms.inAction = inAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientClearKismetTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ClientClearKismetText_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector2 MessageOffset;
+    }
+
     /// <summary>
     /// Function: ClientClearKismetText
     /// </summary>
     public unsafe virtual void ClientClearKismetText(System.Numerics.Vector2 MessageOffset)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientClearKismetText", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MessageOffset, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientClearKismetTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientClearKismetText", true);
+        var parms = new ClientClearKismetText_Params();
+        parms.MessageOffset = MessageOffset;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientDrawKismetTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 56)]
+    private struct ClientDrawKismetText_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.HUD.FKismetDrawTextInfo DrawTextInfo;
+        [FieldOffset(52)] public float DisplayTime;
+    }
+
     /// <summary>
     /// Function: ClientDrawKismetText
     /// </summary>
     public unsafe virtual void ClientDrawKismetText(BmSDK.Engine.HUD.FKismetDrawTextInfo DrawTextInfo, float DisplayTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientDrawKismetText", true);
-        byte* paramsPtr = stackalloc byte[56];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DrawTextInfo, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DisplayTime, paramsPtr + 52);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientDrawKismetTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientDrawKismetText", true);
+        var parms = new ClientDrawKismetText_Params();
+        parms.DrawTextInfo = DrawTextInfo;
+        parms.DisplayTime = DisplayTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnDrawTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnDrawText_Params
+    {
+        [FieldOffset(0)] public nint inAction;
+    }
+
     /// <summary>
     /// Function: OnDrawText
     /// </summary>
     public unsafe virtual void OnDrawText(BmSDK.Engine.SeqAct_DrawText inAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnDrawText", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnDrawTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnDrawText", true);
+        var parms = new OnDrawText_Params();
+        parms.inAction = inAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DisplayDebugFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct DisplayDebug_Params
+    {
+        [FieldOffset(0)] public nint HUD;
+        [FieldOffset(4)] public float out_YL;
+        [FieldOffset(8)] public float out_YPos;
+    }
+
     /// <summary>
     /// Function: DisplayDebug
     /// </summary>
     public unsafe override void DisplayDebug(BmSDK.Engine.HUD HUD, out float out_YL, out float out_YPos)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DisplayDebug", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HUD, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        out_YL = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
-        out_YPos = BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 8);
+        var funcManaged = s_DisplayDebugFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DisplayDebug", true);
+        var parms = new DisplayDebug_Params();
+        parms.HUD = HUD?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        out_YL = parms.out_YL;
+        out_YPos = parms.out_YPos;
         return;
     }
 
+    static BmSDK.Function s_ClientIgnoreLookInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientIgnoreLookInput_Params
+    {
+        [FieldOffset(0)] public int bIgnore;
+    }
+
     /// <summary>
     /// Function: ClientIgnoreLookInput
     /// </summary>
     public unsafe virtual void ClientIgnoreLookInput(bool bIgnore)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientIgnoreLookInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnore, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientIgnoreLookInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientIgnoreLookInput", true);
+        var parms = new ClientIgnoreLookInput_Params();
+        parms.bIgnore = bIgnore ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientIgnoreMoveInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientIgnoreMoveInput_Params
+    {
+        [FieldOffset(0)] public int bIgnore;
+    }
+
     /// <summary>
     /// Function: ClientIgnoreMoveInput
     /// </summary>
     public unsafe virtual void ClientIgnoreMoveInput(bool bIgnore)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientIgnoreMoveInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnore, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientIgnoreMoveInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientIgnoreMoveInput", true);
+        var parms = new ClientIgnoreMoveInput_Params();
+        parms.bIgnore = bIgnore ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnToggleInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct OnToggleInput_Params
+    {
+        [FieldOffset(0)] public nint inAction;
+    }
+
     /// <summary>
     /// Function: OnToggleInput
     /// </summary>
     public unsafe virtual void OnToggleInput(BmSDK.Engine.SeqAct_ToggleInput inAction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnToggleInput", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inAction, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnToggleInput", true);
+        var parms = new OnToggleInput_Params();
+        parms.inAction = inAction?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DrawHUD_Params
+    {
+        [FieldOffset(0)] public nint H;
+    }
+
     /// <summary>
     /// Function: DrawHUD
     /// </summary>
     public unsafe virtual void DrawHUD(BmSDK.Engine.HUD H)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DrawHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(H, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.DrawHUD", true);
+        var parms = new DrawHUD_Params();
+        parms.H = H?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanRestartPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanRestartPlayer_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanRestartPlayer
     /// </summary>
     public unsafe virtual bool CanRestartPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanRestartPlayer", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanRestartPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanRestartPlayer", true);
+        var parms = new CanRestartPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ViewAPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ViewAPlayer_Params
+    {
+        [FieldOffset(0)] public int Dir;
     }
 
     /// <summary>
@@ -1705,44 +2573,69 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ViewAPlayer(int Dir)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ViewAPlayer", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Dir, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ViewAPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ViewAPlayer", true);
+        var parms = new ViewAPlayer_Params();
+        parms.Dir = Dir;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerViewPrevPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerViewPrevPlayer_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerViewPrevPlayer
     /// </summary>
     public unsafe virtual void ServerViewPrevPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerViewPrevPlayer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerViewPrevPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerViewPrevPlayer", true);
+        var parms = new ServerViewPrevPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerViewNextPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerViewNextPlayer_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerViewNextPlayer
     /// </summary>
     public unsafe virtual void ServerViewNextPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerViewNextPlayer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerViewNextPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerViewNextPlayer", true);
+        var parms = new ServerViewNextPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsSpectatingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsSpectating_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsSpectating
     /// </summary>
     public unsafe override bool IsSpectating()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsSpectating", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsSpectatingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsSpectating", true);
+        var parms = new IsSpectating_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CheckJumpOrDuckFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CheckJumpOrDuck_Params
+    {
     }
 
     /// <summary>
@@ -1750,24 +2643,43 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void CheckJumpOrDuck()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CheckJumpOrDuck", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CheckJumpOrDuckFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CheckJumpOrDuck", true);
+        var parms = new CheckJumpOrDuck_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LimitViewRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct LimitViewRotation_Params
+    {
+        [FieldOffset(0)] public BmSDK.Rotator ViewRotation;
+        [FieldOffset(12)] public float ViewPitchMin;
+        [FieldOffset(16)] public float ViewPitchMax;
+        [FieldOffset(20)] public BmSDK.Rotator ReturnValue;
+    }
+
     /// <summary>
     /// Function: LimitViewRotation
     /// </summary>
     public unsafe virtual BmSDK.Rotator LimitViewRotation(BmSDK.Rotator ViewRotation, float ViewPitchMin, float ViewPitchMax)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LimitViewRotation", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ViewRotation, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ViewPitchMin, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ViewPitchMax, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 20);
+        var funcManaged = s_LimitViewRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LimitViewRotation", true);
+        var parms = new LimitViewRotation_Params();
+        parms.ViewRotation = ViewRotation;
+        parms.ViewPitchMin = ViewPitchMin;
+        parms.ViewPitchMax = ViewPitchMax;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ProcessViewRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ProcessViewRotation_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.Rotator out_ViewRotation;
+        [FieldOffset(16)] public BmSDK.Rotator DeltaRot;
     }
 
     /// <summary>
@@ -1775,90 +2687,132 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ProcessViewRotation(float DeltaTime, out BmSDK.Rotator out_ViewRotation, BmSDK.Rotator DeltaRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ProcessViewRotation", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaRot, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        out_ViewRotation = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 4);
+        var funcManaged = s_ProcessViewRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ProcessViewRotation", true);
+        var parms = new ProcessViewRotation_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.DeltaRot = DeltaRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        out_ViewRotation = parms.out_ViewRotation;
         return;
     }
 
+    static BmSDK.Function s_UpdateRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 40)]
+    private struct UpdateRotation_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: UpdateRotation
     /// </summary>
     public unsafe virtual void UpdateRotation(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UpdateRotation", true);
-        byte* paramsPtr = stackalloc byte[40];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UpdateRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UpdateRotation", true);
+        var parms = new UpdateRotation_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ViewShakeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ViewShake_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: ViewShake
     /// </summary>
     public unsafe virtual void ViewShake(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ViewShake", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ViewShakeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ViewShake", true);
+        var parms = new ViewShake_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPlayerViewPointFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct GetPlayerViewPoint_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 out_Location;
+        [FieldOffset(12)] public BmSDK.Rotator out_Rotation;
+    }
+
     /// <summary>
     /// Function: GetPlayerViewPoint
     /// </summary>
     public unsafe override void GetPlayerViewPoint(out System.Numerics.Vector3 out_Location, out BmSDK.Rotator out_Rotation)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetPlayerViewPoint", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        out_Location = BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(paramsPtr + 0);
-        out_Rotation = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 12);
+        var funcManaged = s_GetPlayerViewPointFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetPlayerViewPoint", true);
+        var parms = new GetPlayerViewPoint_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        out_Location = parms.out_Location;
+        out_Rotation = parms.out_Rotation;
         return;
     }
 
+    static BmSDK.Function s_SpawnPlayerCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnPlayerCamera_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnPlayerCamera
     /// </summary>
     public unsafe virtual void SpawnPlayerCamera()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SpawnPlayerCamera", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnPlayerCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SpawnPlayerCamera", true);
+        var parms = new SpawnPlayerCamera_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerVerifyViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ServerVerifyViewTarget_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerVerifyViewTarget
     /// </summary>
     public unsafe virtual void ServerVerifyViewTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerVerifyViewTarget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerVerifyViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerVerifyViewTarget", true);
+        var parms = new ServerVerifyViewTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetViewTarget_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetViewTarget
     /// </summary>
     public unsafe virtual BmSDK.Engine.Actor GetViewTarget()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetViewTarget", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor>(paramsPtr + 0);
+        var funcManaged = s_GetViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetViewTarget", true);
+        var parms = new GetViewTarget_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Actor)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ClientSetViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ClientSetViewTarget_Params
+    {
+        [FieldOffset(0)] public nint A;
+        [FieldOffset(4)] public BmSDK.Engine.Camera.FViewTargetTransitionParams TransitionParams;
     }
 
     /// <summary>
@@ -1866,50 +2820,58 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ClientSetViewTarget(BmSDK.Engine.Actor A, BmSDK.Engine.Camera.FViewTargetTransitionParams TransitionParams = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetViewTarget", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(A, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionParams, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetViewTarget", true);
+        var parms = new ClientSetViewTarget_Params();
+        parms.A = A?.Ptr ?? 0;
+        parms.TransitionParams = TransitionParams;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetViewTargetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct SetViewTarget_Params
+    {
+        [FieldOffset(0)] public nint NewViewTarget;
+        [FieldOffset(4)] public BmSDK.Engine.Camera.FViewTargetTransitionParams TransitionParams;
+    }
+
     /// <summary>
     /// Function: SetViewTarget
     /// </summary>
     public unsafe virtual void SetViewTarget(BmSDK.Engine.Actor NewViewTarget, BmSDK.Engine.Camera.FViewTargetTransitionParams TransitionParams = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetViewTarget", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewViewTarget, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TransitionParams, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetViewTargetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetViewTarget", true);
+        var parms = new SetViewTarget_Params();
+        parms.NewViewTarget = NewViewTarget?.Ptr ?? 0;
+        parms.TransitionParams = TransitionParams;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsLocalPlayerControllerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsLocalPlayerController_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsLocalPlayerController
     /// </summary>
     public unsafe override bool IsLocalPlayerController()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsLocalPlayerController", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsLocalPlayerControllerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsLocalPlayerController", true);
+        var parms = new IsLocalPlayerController_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetFOVAngleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetFOVAngle_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
     }
 
     /// <summary>
@@ -1917,10 +2879,17 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual float GetFOVAngle()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetFOVAngle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetFOVAngleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetFOVAngle", true);
+        var parms = new GetFOVAngle_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_AdjustFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AdjustFOV_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -1928,24 +2897,41 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void AdjustFOV(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AdjustFOV", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AdjustFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AdjustFOV", true);
+        var parms = new AdjustFOV_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyLandedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct NotifyLanded_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 HitNormal;
+        [FieldOffset(12)] public nint FloorActor;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: NotifyLanded
     /// </summary>
     public unsafe override bool NotifyLanded(System.Numerics.Vector3 HitNormal, BmSDK.Engine.Actor FloorActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyLanded", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(HitNormal, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FloorActor, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_NotifyLandedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyLanded", true);
+        var parms = new NotifyLanded_Params();
+        parms.HitNormal = HitNormal;
+        parms.FloorActor = FloorActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AimHelpDotFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AimHelpDot_Params
+    {
+        [FieldOffset(0)] public int bInstantHit;
+        [FieldOffset(4)] public float ReturnValue;
     }
 
     /// <summary>
@@ -1953,11 +2939,20 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual float AimHelpDot(bool bInstantHit)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AimHelpDot", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantHit, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 4);
+        var funcManaged = s_AimHelpDotFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AimHelpDot", true);
+        var parms = new AimHelpDot_Params();
+        parms.bInstantHit = bInstantHit ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAdjustedAimForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 148)]
+    private struct GetAdjustedAimFor_Params
+    {
+        [FieldOffset(0)] public nint W;
+        [FieldOffset(4)] public System.Numerics.Vector3 StartFireLoc;
+        [FieldOffset(16)] public BmSDK.Rotator ReturnValue;
     }
 
     /// <summary>
@@ -1965,12 +2960,20 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe override BmSDK.Rotator GetAdjustedAimFor(BmSDK.Engine.Weapon W, System.Numerics.Vector3 StartFireLoc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetAdjustedAimFor", true);
-        byte* paramsPtr = stackalloc byte[148];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(W, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StartFireLoc, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(paramsPtr + 16);
+        var funcManaged = s_GetAdjustedAimForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetAdjustedAimFor", true);
+        var parms = new GetAdjustedAimFor_Params();
+        parms.W = W?.Ptr ?? 0;
+        parms.StartFireLoc = StartFireLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_AimingHelpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct AimingHelp_Params
+    {
+        [FieldOffset(0)] public int bInstantHit;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -1978,11 +2981,18 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool AimingHelp(bool bInstantHit)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AimingHelp", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bInstantHit, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_AimingHelpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AimingHelp", true);
+        var parms = new AimingHelp_Params();
+        parms.bInstantHit = bInstantHit ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PlayerMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayerMove_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
     }
 
     /// <summary>
@@ -1990,62 +3000,100 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void PlayerMove(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayerMove", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayerMove", true);
+        var parms = new PlayerMove_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayerTickFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayerTick_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: PlayerTick
     /// </summary>
     public unsafe virtual void PlayerTick(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayerTick", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayerTickFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayerTick", true);
+        var parms = new PlayerTick_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NotifyChangedWeaponFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct NotifyChangedWeapon_Params
+    {
+        [FieldOffset(0)] public nint PreviousWeapon;
+        [FieldOffset(4)] public nint NewWeapon;
+    }
+
     /// <summary>
     /// Function: NotifyChangedWeapon
     /// </summary>
     public unsafe override void NotifyChangedWeapon(BmSDK.Engine.Weapon PreviousWeapon, BmSDK.Engine.Weapon NewWeapon)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyChangedWeapon", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PreviousWeapon, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewWeapon, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyChangedWeaponFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyChangedWeapon", true);
+        var parms = new NotifyChangedWeapon_Params();
+        parms.PreviousWeapon = PreviousWeapon?.Ptr ?? 0;
+        parms.NewWeapon = NewWeapon?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientGameEndedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ClientGameEnded_Params
+    {
+        [FieldOffset(0)] public nint EndGameFocus;
+        [FieldOffset(4)] public int bIsWinner;
+    }
+
     /// <summary>
     /// Function: ClientGameEnded
     /// </summary>
     public unsafe virtual void ClientGameEnded(BmSDK.Engine.Actor EndGameFocus, bool bIsWinner)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientGameEnded", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndGameFocus, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsWinner, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientGameEndedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientGameEnded", true);
+        var parms = new ClientGameEnded_Params();
+        parms.EndGameFocus = EndGameFocus?.Ptr ?? 0;
+        parms.bIsWinner = bIsWinner ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GameHasEndedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GameHasEnded_Params
+    {
+        [FieldOffset(0)] public nint EndGameFocus;
+        [FieldOffset(4)] public int bIsWinner;
+    }
+
     /// <summary>
     /// Function: GameHasEnded
     /// </summary>
     public unsafe override void GameHasEnded(BmSDK.Engine.Actor EndGameFocus = default, bool bIsWinner = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GameHasEnded", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(EndGameFocus, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsWinner, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return;
+        var funcManaged = s_GameHasEndedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GameHasEnded", true);
+        var parms = new GameHasEnded_Params();
+        parms.EndGameFocus = EndGameFocus?.Ptr ?? 0;
+        parms.bIsWinner = bIsWinner ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return;
+    }
+
+    static BmSDK.Function s_ClientRestartFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientRestart_Params
+    {
+        [FieldOffset(0)] public nint NewPawn;
     }
 
     /// <summary>
@@ -2053,59 +3101,73 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ClientRestart(BmSDK.Engine.Pawn NewPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientRestart", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientRestartFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientRestart", true);
+        var parms = new ClientRestart_Params();
+        parms.NewPawn = NewPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnterStartStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct EnterStartState_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnterStartState
     /// </summary>
     public unsafe virtual void EnterStartState()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.EnterStartState", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnterStartStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.EnterStartState", true);
+        var parms = new EnterStartState_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceSingleNetUpdateForFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ForceSingleNetUpdateFor_Params
+    {
+        [FieldOffset(0)] public nint Target;
+    }
+
     /// <summary>
     /// Function: ForceSingleNetUpdateFor
     /// </summary>
     public unsafe virtual void ForceSingleNetUpdateFor(BmSDK.Engine.Actor Target)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ForceSingleNetUpdateFor", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Target, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ForceSingleNetUpdateForFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ForceSingleNetUpdateFor", true);
+        var parms = new ForceSingleNetUpdateFor_Params();
+        parms.Target = Target?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HasClientLoadedCurrentWorldFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HasClientLoadedCurrentWorld_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: HasClientLoadedCurrentWorld
     /// </summary>
     public unsafe virtual bool HasClientLoadedCurrentWorld()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.HasClientLoadedCurrentWorld", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_HasClientLoadedCurrentWorldFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.HasClientLoadedCurrentWorld", true);
+        var parms = new HasClientLoadedCurrentWorld_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_NotifyLoadedWorldFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct NotifyLoadedWorld_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName WorldPackageName;
+        [FieldOffset(8)] public int bFinalDest;
     }
 
     /// <summary>
@@ -2113,162 +3175,246 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void NotifyLoadedWorld(BmSDK.FName WorldPackageName, bool bFinalDest)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyLoadedWorld", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WorldPackageName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bFinalDest, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyLoadedWorldFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NotifyLoadedWorld", true);
+        var parms = new NotifyLoadedWorld_Params();
+        parms.WorldPackageName = WorldPackageName;
+        parms.bFinalDest = bFinalDest ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerNotifyLoadedWorldFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ServerNotifyLoadedWorld_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName WorldPackageName;
+    }
+
     /// <summary>
     /// Function: ServerNotifyLoadedWorld
     /// </summary>
     public unsafe virtual void ServerNotifyLoadedWorld(BmSDK.FName WorldPackageName)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerNotifyLoadedWorld", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WorldPackageName, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ServerNotifyLoadedWorldFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerNotifyLoadedWorld", true);
+        var parms = new ServerNotifyLoadedWorld_Params();
+        parms.WorldPackageName = WorldPackageName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RestartFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct Restart_Params
+    {
+        [FieldOffset(0)] public int bVehicleTransition;
+    }
+
     /// <summary>
     /// Function: Restart
     /// </summary>
     public unsafe override void Restart(bool bVehicleTransition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Restart", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVehicleTransition, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RestartFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Restart", true);
+        var parms = new Restart_Params();
+        parms.bVehicleTransition = bVehicleTransition ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientSetProgressMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ClientSetProgressMessage_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.PlayerController.EProgressMessageType MessageType;
+        [FieldOffset(4)] public BmSDK.FString Message;
+        [FieldOffset(16)] public BmSDK.FString Title;
+        [FieldOffset(28)] public int bIgnoreFutureNetworkMessages;
+    }
+
     /// <summary>
     /// Function: ClientSetProgressMessage
     /// </summary>
     public unsafe virtual void ClientSetProgressMessage(BmSDK.Engine.PlayerController.EProgressMessageType MessageType, BmSDK.FString Message, BmSDK.FString Title = default, bool bIgnoreFutureNetworkMessages = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetProgressMessage", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MessageType, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Message, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Title, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIgnoreFutureNetworkMessages, paramsPtr + 28);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetProgressMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetProgressMessage", true);
+        var parms = new ClientSetProgressMessage_Params();
+        parms.MessageType = MessageType;
+        parms.Message = Message;
+        parms.Title = Title;
+        parms.bIgnoreFutureNetworkMessages = bIgnoreFutureNetworkMessages ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwitchLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SwitchLevel_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString URL;
+    }
+
     /// <summary>
     /// Function: SwitchLevel
     /// </summary>
     public unsafe virtual void SwitchLevel(BmSDK.FString URL)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SwitchLevel", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(URL, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwitchLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SwitchLevel", true);
+        var parms = new SwitchLevel_Params();
+        parms.URL = URL;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerChangeTeamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ServerChangeTeam_Params
+    {
+        [FieldOffset(0)] public int N;
+    }
+
     /// <summary>
     /// Function: ServerChangeTeam
     /// </summary>
     public unsafe virtual void ServerChangeTeam(int N)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerChangeTeam", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(N, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerChangeTeamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerChangeTeam", true);
+        var parms = new ServerChangeTeam_Params();
+        parms.N = N;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ChangeTeamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ChangeTeam_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString TeamName;
+    }
+
     /// <summary>
     /// Function: ChangeTeam
     /// </summary>
     public unsafe virtual void ChangeTeam(BmSDK.FString TeamName = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ChangeTeam", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TeamName, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ChangeTeamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ChangeTeam", true);
+        var parms = new ChangeTeam_Params();
+        parms.TeamName = TeamName;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SwitchTeamFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SwitchTeam_Params
+    {
+    }
+
     /// <summary>
     /// Function: SwitchTeam
     /// </summary>
     public unsafe virtual void SwitchTeam()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SwitchTeam", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SwitchTeamFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SwitchTeam", true);
+        var parms = new SwitchTeam_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerChangeNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ServerChangeName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString S;
+    }
+
     /// <summary>
     /// Function: ServerChangeName
     /// </summary>
     public unsafe virtual void ServerChangeName(BmSDK.FString S)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerChangeName", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(S, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerChangeNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerChangeName", true);
+        var parms = new ServerChangeName_Params();
+        parms.S = S;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct SetName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString S;
+    }
+
     /// <summary>
     /// Function: SetName
     /// </summary>
     public unsafe virtual void SetName(BmSDK.FString S)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetName", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(S, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetName", true);
+        var parms = new SetName_Params();
+        parms.S = S;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerSuicideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerSuicide_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerSuicide
     /// </summary>
     public unsafe virtual void ServerSuicide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerSuicide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerSuicideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerSuicide", true);
+        var parms = new ServerSuicide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SuicideFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Suicide_Params
+    {
+    }
+
     /// <summary>
     /// Function: Suicide
     /// </summary>
     public unsafe virtual void Suicide()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Suicide", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SuicideFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Suicide", true);
+        var parms = new Suicide_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TriggerInteractedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 80)]
+    private struct TriggerInteracted_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: TriggerInteracted
     /// </summary>
     public unsafe virtual bool TriggerInteracted()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.TriggerInteracted", true);
-        byte* paramsPtr = stackalloc byte[80];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_TriggerInteractedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.TriggerInteracted", true);
+        var parms = new TriggerInteracted_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PerformedUseActionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PerformedUseAction_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2276,10 +3422,16 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool PerformedUseAction()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PerformedUseAction", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_PerformedUseActionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PerformedUseAction", true);
+        var parms = new PerformedUseAction_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ServerUseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerUse_Params
+    {
     }
 
     /// <summary>
@@ -2287,196 +3439,310 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ServerUse()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerUse", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerUseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerUse", true);
+        var parms = new ServerUse_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Use_Params
+    {
+    }
+
     /// <summary>
     /// Function: Use
     /// </summary>
     public unsafe virtual void Use()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Use", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Use", true);
+        var parms = new Use_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetTriggerUseListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 64)]
+    private struct GetTriggerUseList_Params
+    {
+        [FieldOffset(0)] public float interactDistanceToCheck;
+        [FieldOffset(4)] public float crosshairDist;
+        [FieldOffset(8)] public float minDot;
+        [FieldOffset(12)] public int bUsuableOnly;
+    }
+
     /// <summary>
     /// Function: GetTriggerUseList
     /// </summary>
     public unsafe virtual void GetTriggerUseList(float interactDistanceToCheck, float crosshairDist, float minDot, bool bUsuableOnly, out BmSDK.TArray<BmSDK.Engine.Trigger> out_useList)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetTriggerUseList", true);
-        byte* paramsPtr = stackalloc byte[64];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(interactDistanceToCheck, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(crosshairDist, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(minDot, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUsuableOnly, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        out_useList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Trigger>>(paramsPtr + 16);
+        var funcManaged = s_GetTriggerUseListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetTriggerUseList", true);
+        var parms = new GetTriggerUseList_Params();
+        parms.interactDistanceToCheck = interactDistanceToCheck;
+        parms.crosshairDist = crosshairDist;
+        parms.minDot = minDot;
+        parms.bUsuableOnly = bUsuableOnly ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        out_useList = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.Trigger>>((byte*)&parms + 16);
         return;
     }
 
+    static BmSDK.Function s_StopAltFireFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct StopAltFire_Params
+    {
+        [FieldOffset(0)] public byte FireModeNum;
+    }
+
     /// <summary>
     /// Function: StopAltFire
     /// </summary>
     public unsafe virtual void StopAltFire(byte FireModeNum = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.StopAltFire", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FireModeNum, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopAltFireFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.StopAltFire", true);
+        var parms = new StopAltFire_Params();
+        parms.FireModeNum = FireModeNum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartAltFireFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct StartAltFire_Params
+    {
+        [FieldOffset(0)] public byte FireModeNum;
+    }
+
     /// <summary>
     /// Function: StartAltFire
     /// </summary>
     public unsafe virtual void StartAltFire(byte FireModeNum = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.StartAltFire", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FireModeNum, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartAltFireFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.StartAltFire", true);
+        var parms = new StartAltFire_Params();
+        parms.FireModeNum = FireModeNum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopFireFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct StopFire_Params
+    {
+        [FieldOffset(0)] public byte FireModeNum;
+    }
+
     /// <summary>
     /// Function: StopFire
     /// </summary>
     public unsafe virtual void StopFire(byte FireModeNum = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.StopFire", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FireModeNum, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StopFireFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.StopFire", true);
+        var parms = new StopFire_Params();
+        parms.FireModeNum = FireModeNum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StartFireFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 1)]
+    private struct StartFire_Params
+    {
+        [FieldOffset(0)] public byte FireModeNum;
+    }
+
     /// <summary>
     /// Function: StartFire
     /// </summary>
     public unsafe virtual void StartFire(byte FireModeNum = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.StartFire", true);
-        byte* paramsPtr = stackalloc byte[1];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FireModeNum, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_StartFireFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.StartFire", true);
+        var parms = new StartFire_Params();
+        parms.FireModeNum = FireModeNum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_NextWeaponFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct NextWeapon_Params
+    {
+    }
+
     /// <summary>
     /// Function: NextWeapon
     /// </summary>
     public unsafe virtual void NextWeapon()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NextWeapon", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NextWeaponFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.NextWeapon", true);
+        var parms = new NextWeapon_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PrevWeaponFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PrevWeapon_Params
+    {
+    }
+
     /// <summary>
     /// Function: PrevWeapon
     /// </summary>
     public unsafe virtual void PrevWeapon()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PrevWeapon", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PrevWeaponFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PrevWeapon", true);
+        var parms = new PrevWeapon_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerThrowWeaponFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerThrowWeapon_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerThrowWeapon
     /// </summary>
     public unsafe virtual void ServerThrowWeapon()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerThrowWeapon", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerThrowWeaponFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerThrowWeapon", true);
+        var parms = new ServerThrowWeapon_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ThrowWeaponFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ThrowWeapon_Params
+    {
+    }
+
     /// <summary>
     /// Function: ThrowWeapon
     /// </summary>
     public unsafe virtual void ThrowWeapon()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ThrowWeapon", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ThrowWeaponFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ThrowWeapon", true);
+        var parms = new ThrowWeapon_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UTraceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UTrace_Params
+    {
+    }
+
     /// <summary>
     /// Function: UTrace
     /// </summary>
     public unsafe virtual void UTrace()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UTrace", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UTraceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UTrace", true);
+        var parms = new UTrace_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerUTraceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerUTrace_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerUTrace
     /// </summary>
     public unsafe virtual void ServerUTrace()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerUTrace", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerUTraceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerUTrace", true);
+        var parms = new ServerUTrace_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ConditionalPauseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ConditionalPause_Params
+    {
+        [FieldOffset(0)] public int bDesiredPauseState;
+    }
+
     /// <summary>
     /// Function: ConditionalPause
     /// </summary>
     public unsafe virtual void ConditionalPause(bool bDesiredPauseState)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ConditionalPause", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDesiredPauseState, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ConditionalPauseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ConditionalPause", true);
+        var parms = new ConditionalPause_Params();
+        parms.bDesiredPauseState = bDesiredPauseState ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerPauseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerPause_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerPause
     /// </summary>
     public unsafe virtual void ServerPause()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerPause", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerPauseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerPause", true);
+        var parms = new ServerPause_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PauseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Pause_Params
+    {
+    }
+
     /// <summary>
     /// Function: Pause
     /// </summary>
     public unsafe virtual void Pause()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Pause", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PauseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Pause", true);
+        var parms = new Pause_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsPausedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsPaused_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsPaused
     /// </summary>
     public unsafe virtual bool IsPaused()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsPaused", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsPausedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsPaused", true);
+        var parms = new IsPaused_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetPauseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SetPause_Params
+    {
+        [FieldOffset(0)] public int bPause;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2484,12 +3750,19 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool SetPause(bool bPause, System.IntPtr CanUnpauseDelegate = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetPause", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bPause, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CanUnpauseDelegate, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_SetPauseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetPause", true);
+        var parms = new SetPause_Params();
+        parms.bPause = bPause ? 1 : 0;
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(CanUnpauseDelegate, (byte*)&parms + 4);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_CanUnpauseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanUnpause_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2497,10 +3770,17 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool CanUnpause()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanUnpause", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUnpauseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanUnpause", true);
+        var parms = new CanUnpause_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PauseRumbleForAllPlayersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct PauseRumbleForAllPlayers_Params
+    {
+        [FieldOffset(0)] public int bShouldPauseRumble;
     }
 
     /// <summary>
@@ -2508,419 +3788,672 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void PauseRumbleForAllPlayers(bool bShouldPauseRumble = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PauseRumbleForAllPlayers", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bShouldPauseRumble, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PauseRumbleForAllPlayersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PauseRumbleForAllPlayers", true);
+        var parms = new PauseRumbleForAllPlayers_Params();
+        parms.bShouldPauseRumble = bShouldPauseRumble ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_LocalTravelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct LocalTravel_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString URL;
+    }
+
     /// <summary>
     /// Function: LocalTravel
     /// </summary>
     public unsafe virtual void LocalTravel(BmSDK.FString URL)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LocalTravel", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(URL, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_LocalTravelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.LocalTravel", true);
+        var parms = new LocalTravel_Params();
+        parms.URL = URL;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RestartLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RestartLevel_Params
+    {
+    }
+
     /// <summary>
     /// Function: RestartLevel
     /// </summary>
     public unsafe virtual void RestartLevel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RestartLevel", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RestartLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RestartLevel", true);
+        var parms = new RestartLevel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerSpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ServerSpeech_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName Type;
+        [FieldOffset(8)] public int Index;
+        [FieldOffset(12)] public BmSDK.FString Callsign;
+    }
+
     /// <summary>
     /// Function: ServerSpeech
     /// </summary>
     public unsafe virtual void ServerSpeech(BmSDK.FName Type, int Index, BmSDK.FString Callsign)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerSpeech", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Callsign, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerSpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerSpeech", true);
+        var parms = new ServerSpeech_Params();
+        parms.Type = Type;
+        parms.Index = Index;
+        parms.Callsign = Callsign;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpeechFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct Speech_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName Type;
+        [FieldOffset(8)] public int Index;
+        [FieldOffset(12)] public BmSDK.FString Callsign;
+    }
+
     /// <summary>
     /// Function: Speech
     /// </summary>
     public unsafe virtual void Speech(BmSDK.FName Type, int Index, BmSDK.FString Callsign)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Speech", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Callsign, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpeechFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Speech", true);
+        var parms = new Speech_Params();
+        parms.Type = Type;
+        parms.Index = Index;
+        parms.Callsign = Callsign;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerRestartGameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerRestartGame_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerRestartGame
     /// </summary>
     public unsafe virtual void ServerRestartGame()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerRestartGame", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerRestartGameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerRestartGame", true);
+        var parms = new ServerRestartGame_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandleWalkingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct HandleWalking_Params
+    {
+    }
+
     /// <summary>
     /// Function: HandleWalking
     /// </summary>
     public unsafe virtual void HandleWalking()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.HandleWalking", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HandleWalkingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.HandleWalking", true);
+        var parms = new HandleWalking_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearAckedMovesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearAckedMoves_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearAckedMoves
     /// </summary>
     public unsafe virtual void ClearAckedMoves()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClearAckedMoves", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearAckedMovesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClearAckedMoves", true);
+        var parms = new ClearAckedMoves_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientCapBandwidthFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientCapBandwidth_Params
+    {
+        [FieldOffset(0)] public int Cap;
+    }
+
     /// <summary>
     /// Function: ClientCapBandwidth
     /// </summary>
     public unsafe virtual void ClientCapBandwidth(int Cap)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientCapBandwidth", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Cap, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientCapBandwidthFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientCapBandwidth", true);
+        var parms = new ClientCapBandwidth_Params();
+        parms.Cap = Cap;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MoveAutonomousFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 33)]
+    private struct MoveAutonomous_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public byte CompressedFlags;
+        [FieldOffset(8)] public System.Numerics.Vector3 newAccel;
+        [FieldOffset(20)] public BmSDK.Rotator DeltaRot;
+    }
+
     /// <summary>
     /// Function: MoveAutonomous
     /// </summary>
     public unsafe virtual void MoveAutonomous(float DeltaTime, byte CompressedFlags, System.Numerics.Vector3 newAccel, BmSDK.Rotator DeltaRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.MoveAutonomous", true);
-        byte* paramsPtr = stackalloc byte[33];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CompressedFlags, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(newAccel, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaRot, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MoveAutonomousFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.MoveAutonomous", true);
+        var parms = new MoveAutonomous_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.CompressedFlags = CompressedFlags;
+        parms.newAccel = newAccel;
+        parms.DeltaRot = DeltaRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ProcessMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct ProcessMove_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public System.Numerics.Vector3 newAccel;
+        [FieldOffset(16)] public BmSDK.Engine.Actor.EDoubleClickDir DoubleClickMove;
+        [FieldOffset(20)] public BmSDK.Rotator DeltaRot;
+    }
+
     /// <summary>
     /// Function: ProcessMove
     /// </summary>
     public unsafe virtual void ProcessMove(float DeltaTime, System.Numerics.Vector3 newAccel, BmSDK.Engine.Actor.EDoubleClickDir DoubleClickMove, BmSDK.Rotator DeltaRot)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ProcessMove", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(newAccel, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DoubleClickMove, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaRot, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ProcessMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ProcessMove", true);
+        var parms = new ProcessMove_Params();
+        parms.DeltaTime = DeltaTime;
+        parms.newAccel = newAccel;
+        parms.DoubleClickMove = DoubleClickMove;
+        parms.DeltaRot = DeltaRot;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceDeathUpdateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ForceDeathUpdate_Params
+    {
+    }
+
     /// <summary>
     /// Function: ForceDeathUpdate
     /// </summary>
     public unsafe virtual void ForceDeathUpdate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ForceDeathUpdate", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceDeathUpdateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ForceDeathUpdate", true);
+        var parms = new ForceDeathUpdate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientSetCameraFadeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ClientSetCameraFade_Params
+    {
+        [FieldOffset(0)] public int bEnableFading;
+        [FieldOffset(4)] public BmSDK.GameObject.FColor FadeColor;
+        [FieldOffset(8)] public System.Numerics.Vector2 FadeAlpha;
+        [FieldOffset(16)] public float FadeTime;
+    }
+
     /// <summary>
     /// Function: ClientSetCameraFade
     /// </summary>
     public unsafe virtual void ClientSetCameraFade(bool bEnableFading, BmSDK.GameObject.FColor FadeColor = default, System.Numerics.Vector2 FadeAlpha = default, float FadeTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetCameraFade", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bEnableFading, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeColor, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeAlpha, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeTime, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetCameraFadeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetCameraFade", true);
+        var parms = new ClientSetCameraFade_Params();
+        parms.bEnableFading = bEnableFading ? 1 : 0;
+        parms.FadeColor = FadeColor;
+        parms.FadeAlpha = FadeAlpha;
+        parms.FadeTime = FadeTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetCameraModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetCameraMode_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetCameraMode
     /// </summary>
     public unsafe virtual void ResetCameraMode()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ResetCameraMode", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetCameraModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ResetCameraMode", true);
+        var parms = new ResetCameraMode_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCameraModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetCameraMode_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewCamMode;
+    }
+
     /// <summary>
     /// Function: SetCameraMode
     /// </summary>
     public unsafe virtual void SetCameraMode(BmSDK.FName NewCamMode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetCameraMode", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCamMode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCameraModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetCameraMode", true);
+        var parms = new SetCameraMode_Params();
+        parms.NewCamMode = NewCamMode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientSetCameraModeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ClientSetCameraMode_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewCamMode;
+    }
+
     /// <summary>
     /// Function: ClientSetCameraMode
     /// </summary>
     public unsafe virtual void ClientSetCameraMode(BmSDK.FName NewCamMode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetCameraMode", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewCamMode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetCameraModeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetCameraMode", true);
+        var parms = new ClientSetCameraMode_Params();
+        parms.NewCamMode = NewCamMode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerCameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct ServerCamera_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewMode;
+    }
+
     /// <summary>
     /// Function: ServerCamera
     /// </summary>
     public unsafe virtual void ServerCamera(BmSDK.FName NewMode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerCamera", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerCameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerCamera", true);
+        var parms = new ServerCamera_Params();
+        parms.NewMode = NewMode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CameraFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Camera_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewMode;
+    }
+
     /// <summary>
     /// Function: Camera
     /// </summary>
     public unsafe virtual void Camera(BmSDK.FName NewMode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Camera", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMode, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CameraFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Camera", true);
+        var parms = new Camera_Params();
+        parms.NewMode = NewMode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreClientTravelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct PreClientTravel_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString PendingURL;
+        [FieldOffset(12)] public BmSDK.Engine.Actor.ETravelType TravelType;
+        [FieldOffset(16)] public int bIsSeamlessTravel;
+    }
+
     /// <summary>
     /// Function: PreClientTravel
     /// </summary>
     public unsafe virtual void PreClientTravel(BmSDK.FString PendingURL, BmSDK.Engine.Actor.ETravelType TravelType, bool bIsSeamlessTravel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PreClientTravel", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PendingURL, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TravelType, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsSeamlessTravel, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreClientTravelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PreClientTravel", true);
+        var parms = new PreClientTravel_Params();
+        parms.PendingURL = PendingURL;
+        parms.TravelType = TravelType;
+        parms.bIsSeamlessTravel = bIsSeamlessTravel ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerMutateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ServerMutate_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString MutateString;
+    }
+
     /// <summary>
     /// Function: ServerMutate
     /// </summary>
     public unsafe virtual void ServerMutate(BmSDK.FString MutateString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerMutate", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MutateString, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerMutateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerMutate", true);
+        var parms = new ServerMutate_Params();
+        parms.MutateString = MutateString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_MutateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct Mutate_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString MutateString;
+    }
+
     /// <summary>
     /// Function: Mutate
     /// </summary>
     public unsafe virtual void Mutate(BmSDK.FString MutateString)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Mutate", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MutateString, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_MutateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Mutate", true);
+        var parms = new Mutate_Params();
+        parms.MutateString = MutateString;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FOV_Params
+    {
+        [FieldOffset(0)] public float F;
+    }
+
     /// <summary>
     /// Function: FOV
     /// </summary>
     public unsafe virtual void FOV(float F)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.FOV", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(F, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.FOV", true);
+        var parms = new FOV_Params();
+        parms.F = F;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetFOV_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetFOV
     /// </summary>
     public unsafe virtual void ResetFOV()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ResetFOV", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ResetFOV", true);
+        var parms = new ResetFOV_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetFOV_Params
+    {
+        [FieldOffset(0)] public float NewFOV;
+    }
+
     /// <summary>
     /// Function: SetFOV
     /// </summary>
     public unsafe virtual void SetFOV(float NewFOV)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetFOV", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewFOV, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetFOV", true);
+        var parms = new SetFOV_Params();
+        parms.NewFOV = NewFOV;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FixFOVFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct FixFOV_Params
+    {
+    }
+
     /// <summary>
     /// Function: FixFOV
     /// </summary>
     public unsafe virtual void FixFOV()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.FixFOV", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FixFOVFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.FixFOV", true);
+        var parms = new FixFOV_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DestroyedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Destroyed_Params
+    {
+    }
+
     /// <summary>
     /// Function: Destroyed
     /// </summary>
     public unsafe override void Destroyed()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Destroyed", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DestroyedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Destroyed", true);
+        var parms = new Destroyed_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CleanupPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CleanupPawn_Params
+    {
+    }
+
     /// <summary>
     /// Function: CleanupPawn
     /// </summary>
     public unsafe virtual void CleanupPawn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CleanupPawn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CleanupPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CleanupPawn", true);
+        var parms = new CleanupPawn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearOnlineDelegatesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearOnlineDelegates_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearOnlineDelegates
     /// </summary>
     public unsafe virtual void ClearOnlineDelegates()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClearOnlineDelegates", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearOnlineDelegatesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClearOnlineDelegates", true);
+        var parms = new ClearOnlineDelegates_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnPartyMembersInfoChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct OnPartyMembersInfoChanged_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString PlayerName;
+        [FieldOffset(12)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId PlayerID;
+        [FieldOffset(20)] public int CustomData1;
+        [FieldOffset(24)] public int CustomData2;
+        [FieldOffset(28)] public int CustomData3;
+        [FieldOffset(32)] public int CustomData4;
+    }
+
     /// <summary>
     /// Function: OnPartyMembersInfoChanged
     /// </summary>
     public unsafe virtual void OnPartyMembersInfoChanged(BmSDK.FString PlayerName, BmSDK.Engine.OnlineSubsystem.FUniqueNetId PlayerID, int CustomData1, int CustomData2, int CustomData3, int CustomData4)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnPartyMembersInfoChanged", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerID, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CustomData1, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CustomData2, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CustomData3, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CustomData4, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnPartyMembersInfoChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnPartyMembersInfoChanged", true);
+        var parms = new OnPartyMembersInfoChanged_Params();
+        parms.PlayerName = PlayerName;
+        parms.PlayerID = PlayerID;
+        parms.CustomData1 = CustomData1;
+        parms.CustomData2 = CustomData2;
+        parms.CustomData3 = CustomData3;
+        parms.CustomData4 = CustomData4;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnPartyMemberListChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct OnPartyMemberListChanged_Params
+    {
+        [FieldOffset(0)] public int bJoinedOrLeft;
+        [FieldOffset(4)] public BmSDK.FString PlayerName;
+        [FieldOffset(16)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId PlayerID;
+    }
+
     /// <summary>
     /// Function: OnPartyMemberListChanged
     /// </summary>
     public unsafe virtual void OnPartyMemberListChanged(bool bJoinedOrLeft, BmSDK.FString PlayerName, BmSDK.Engine.OnlineSubsystem.FUniqueNetId PlayerID)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnPartyMemberListChanged", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bJoinedOrLeft, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerID, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnPartyMemberListChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnPartyMemberListChanged", true);
+        var parms = new OnPartyMemberListChanged_Params();
+        parms.bJoinedOrLeft = bJoinedOrLeft ? 1 : 0;
+        parms.PlayerName = PlayerName;
+        parms.PlayerID = PlayerID;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterOnlineDelegatesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct RegisterOnlineDelegates_Params
+    {
+    }
+
     /// <summary>
     /// Function: RegisterOnlineDelegates
     /// </summary>
     public unsafe virtual void RegisterOnlineDelegates()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RegisterOnlineDelegates", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterOnlineDelegatesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RegisterOnlineDelegates", true);
+        var parms = new RegisterOnlineDelegates_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayBeepSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PlayBeepSound_Params
+    {
+    }
+
     /// <summary>
     /// Function: PlayBeepSound
     /// </summary>
     public unsafe virtual void PlayBeepSound()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayBeepSound", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PlayBeepSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayBeepSound", true);
+        var parms = new PlayBeepSound_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TeamMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct TeamMessage_Params
+    {
+        [FieldOffset(0)] public nint PRI;
+        [FieldOffset(4)] public BmSDK.FString S;
+        [FieldOffset(16)] public BmSDK.FName Type;
+        [FieldOffset(24)] public float MsgLifeTime;
+    }
+
     /// <summary>
     /// Function: TeamMessage
     /// </summary>
     public unsafe virtual void TeamMessage(BmSDK.Engine.PlayerReplicationInfo PRI, BmSDK.FString S, BmSDK.FName Type, float MsgLifeTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.TeamMessage", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PRI, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(S, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MsgLifeTime, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_TeamMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.TeamMessage", true);
+        var parms = new TeamMessage_Params();
+        parms.PRI = PRI?.Ptr ?? 0;
+        parms.S = S;
+        parms.Type = Type;
+        parms.MsgLifeTime = MsgLifeTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayUICueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PlayUICue_Params
+    {
+        [FieldOffset(0)] public nint Cue;
+        [FieldOffset(4)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: PlayUICue
     /// </summary>
     public unsafe virtual BmSDK.Engine.AudioComponent PlayUICue(BmSDK.Engine.SoundCue Cue)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayUICue", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Cue, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AudioComponent>(paramsPtr + 4);
+        var funcManaged = s_PlayUICueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayUICue", true);
+        var parms = new PlayUICue_Params();
+        parms.Cue = Cue?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AudioComponent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_CreateTTSSoundCueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct CreateTTSSoundCue_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString StrToSpeak;
+        [FieldOffset(12)] public nint PRI;
+        [FieldOffset(16)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -2928,19 +4461,19 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe BmSDK.Engine.SoundCue CreateTTSSoundCue(BmSDK.FString StrToSpeak, BmSDK.Engine.PlayerReplicationInfo PRI)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CreateTTSSoundCue", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(StrToSpeak, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PRI, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.SoundCue>(paramsPtr + 16);
+        var funcManaged = s_CreateTTSSoundCueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CreateTTSSoundCue", true);
+        var parms = new CreateTTSSoundCue_Params();
+        parms.StrToSpeak = StrToSpeak;
+        parms.PRI = PRI?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.SoundCue)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_CanCommunicateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanCommunicate_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -2948,10 +4481,19 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool CanCommunicate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanCommunicate", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanCommunicateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanCommunicate", true);
+        var parms = new CanCommunicate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClientMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ClientMessage_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString S;
+        [FieldOffset(12)] public BmSDK.FName Type;
+        [FieldOffset(20)] public float MsgLifeTime;
     }
 
     /// <summary>
@@ -2959,97 +4501,154 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ClientMessage(BmSDK.FString S, BmSDK.FName Type = default, float MsgLifeTime = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientMessage", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(S, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Type, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MsgLifeTime, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientMessage", true);
+        var parms = new ClientMessage_Params();
+        parms.S = S;
+        parms.Type = Type;
+        parms.MsgLifeTime = MsgLifeTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientPlayActorFaceFXAnimFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct ClientPlayActorFaceFXAnim_Params
+    {
+        [FieldOffset(0)] public nint SourceActor;
+        [FieldOffset(4)] public nint AnimSet;
+        [FieldOffset(8)] public BmSDK.FString GroupName;
+        [FieldOffset(20)] public BmSDK.FString SeqName;
+        [FieldOffset(32)] public nint DialogueEvent;
+    }
+
     /// <summary>
     /// Function: ClientPlayActorFaceFXAnim
     /// </summary>
     public unsafe virtual void ClientPlayActorFaceFXAnim(BmSDK.Engine.Actor SourceActor, BmSDK.Engine.FaceFXAnimSet AnimSet, BmSDK.FString GroupName, BmSDK.FString SeqName, BmSDK.Engine.RDialogueEvent DialogueEvent)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPlayActorFaceFXAnim", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SourceActor, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AnimSet, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(GroupName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SeqName, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DialogueEvent, paramsPtr + 32);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientPlayActorFaceFXAnimFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientPlayActorFaceFXAnim", true);
+        var parms = new ClientPlayActorFaceFXAnim_Params();
+        parms.SourceActor = SourceActor?.Ptr ?? 0;
+        parms.AnimSet = AnimSet?.Ptr ?? 0;
+        parms.GroupName = GroupName;
+        parms.SeqName = SeqName;
+        parms.DialogueEvent = DialogueEvent?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Kismet_ClientStopSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Kismet_ClientStopSound_Params
+    {
+        [FieldOffset(0)] public nint ASound;
+        [FieldOffset(4)] public nint SourceActor;
+        [FieldOffset(8)] public float FadeOutTime;
+    }
+
     /// <summary>
     /// Function: Kismet_ClientStopSound
     /// </summary>
     public unsafe virtual void Kismet_ClientStopSound(BmSDK.Engine.SoundCue ASound, BmSDK.Engine.Actor SourceActor, float FadeOutTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Kismet_ClientStopSound", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ASound, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SourceActor, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeOutTime, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Kismet_ClientStopSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Kismet_ClientStopSound", true);
+        var parms = new Kismet_ClientStopSound_Params();
+        parms.ASound = ASound?.Ptr ?? 0;
+        parms.SourceActor = SourceActor?.Ptr ?? 0;
+        parms.FadeOutTime = FadeOutTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Kismet_ClientKeyOffSoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct Kismet_ClientKeyOffSound_Params
+    {
+        [FieldOffset(0)] public nint ASound;
+        [FieldOffset(4)] public nint SourceActor;
+    }
+
     /// <summary>
     /// Function: Kismet_ClientKeyOffSound
     /// </summary>
     public unsafe virtual void Kismet_ClientKeyOffSound(BmSDK.Engine.SoundCue ASound, BmSDK.Engine.Actor SourceActor)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Kismet_ClientKeyOffSound", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ASound, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SourceActor, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Kismet_ClientKeyOffSoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Kismet_ClientKeyOffSound", true);
+        var parms = new Kismet_ClientKeyOffSound_Params();
+        parms.ASound = ASound?.Ptr ?? 0;
+        parms.SourceActor = SourceActor?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_Kismet_ClientPlaySoundFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct Kismet_ClientPlaySound_Params
+    {
+        [FieldOffset(0)] public nint ASound;
+        [FieldOffset(4)] public nint SourceActor;
+        [FieldOffset(8)] public float VolumeMultiplier;
+        [FieldOffset(12)] public float PitchMultiplier;
+        [FieldOffset(16)] public float FadeInTime;
+        [FieldOffset(20)] public int bSuppressSubtitles;
+        [FieldOffset(24)] public int bSuppressSpatialization;
+    }
+
     /// <summary>
     /// Function: Kismet_ClientPlaySound
     /// </summary>
     public unsafe virtual void Kismet_ClientPlaySound(BmSDK.Engine.SoundCue ASound, BmSDK.Engine.Actor SourceActor, float VolumeMultiplier, float PitchMultiplier, float FadeInTime, bool bSuppressSubtitles, bool bSuppressSpatialization)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Kismet_ClientPlaySound", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ASound, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SourceActor, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(VolumeMultiplier, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PitchMultiplier, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FadeInTime, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSuppressSubtitles, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSuppressSpatialization, paramsPtr + 24);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_Kismet_ClientPlaySoundFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Kismet_ClientPlaySound", true);
+        var parms = new Kismet_ClientPlaySound_Params();
+        parms.ASound = ASound?.Ptr ?? 0;
+        parms.SourceActor = SourceActor?.Ptr ?? 0;
+        parms.VolumeMultiplier = VolumeMultiplier;
+        parms.PitchMultiplier = PitchMultiplier;
+        parms.FadeInTime = FadeInTime;
+        parms.bSuppressSubtitles = bSuppressSubtitles ? 1 : 0;
+        parms.bSuppressSpatialization = bSuppressSpatialization ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetPooledAudioComponentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct GetPooledAudioComponent_Params
+    {
+        [FieldOffset(0)] public nint ASound;
+        [FieldOffset(4)] public nint SourceActor;
+        [FieldOffset(8)] public int bStopWhenOwnerDestroyed;
+        [FieldOffset(12)] public int bUseLocation;
+        [FieldOffset(16)] public System.Numerics.Vector3 SourceLocation;
+        [FieldOffset(28)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetPooledAudioComponent
     /// </summary>
     public unsafe virtual BmSDK.Engine.AudioComponent GetPooledAudioComponent(BmSDK.Engine.SoundCue ASound, BmSDK.Engine.Actor SourceActor, bool bStopWhenOwnerDestroyed, bool bUseLocation = default, System.Numerics.Vector3 SourceLocation = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetPooledAudioComponent", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ASound, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SourceActor, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bStopWhenOwnerDestroyed, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bUseLocation, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SourceLocation, paramsPtr + 16);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AudioComponent>(paramsPtr + 28);
+        var funcManaged = s_GetPooledAudioComponentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetPooledAudioComponent", true);
+        var parms = new GetPooledAudioComponent_Params();
+        parms.ASound = ASound?.Ptr ?? 0;
+        parms.SourceActor = SourceActor?.Ptr ?? 0;
+        parms.bStopWhenOwnerDestroyed = bStopWhenOwnerDestroyed ? 1 : 0;
+        parms.bUseLocation = bUseLocation ? 1 : 0;
+        parms.SourceLocation = SourceLocation;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AudioComponent)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_ReceiveLocalizedMessageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ReceiveLocalizedMessage_Params
+    {
+        [FieldOffset(0)] public nint Message;
+        [FieldOffset(4)] public int Switch;
+        [FieldOffset(8)] public nint RelatedPRI_1;
+        [FieldOffset(12)] public nint RelatedPRI_2;
+        [FieldOffset(16)] public nint OptionalObject;
     }
 
     /// <summary>
@@ -3057,62 +4656,95 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ReceiveLocalizedMessage(BmSDK.Class Message, int Switch = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_1 = default, BmSDK.Engine.PlayerReplicationInfo RelatedPRI_2 = default, BmSDK.GameObject OptionalObject = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ReceiveLocalizedMessage", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Message, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Switch, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_1, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(RelatedPRI_2, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(OptionalObject, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReceiveLocalizedMessageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ReceiveLocalizedMessage", true);
+        var parms = new ReceiveLocalizedMessage_Params();
+        parms.Message = Message?.Ptr ?? 0;
+        parms.Switch = Switch;
+        parms.RelatedPRI_1 = RelatedPRI_1?.Ptr ?? 0;
+        parms.RelatedPRI_2 = RelatedPRI_2?.Ptr ?? 0;
+        parms.OptionalObject = OptionalObject?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CleanupPRIFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CleanupPRI_Params
+    {
+    }
+
     /// <summary>
     /// Function: CleanupPRI
     /// </summary>
     public unsafe override void CleanupPRI()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CleanupPRI", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CleanupPRIFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CleanupPRI", true);
+        var parms = new CleanupPRI_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_HandlePickupFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct HandlePickup_Params
+    {
+        [FieldOffset(0)] public nint Inv;
+    }
+
     /// <summary>
     /// Function: HandlePickup
     /// </summary>
     public unsafe override void HandlePickup(BmSDK.Engine.Inventory Inv)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.HandlePickup", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Inv, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_HandlePickupFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.HandlePickup", true);
+        var parms = new HandlePickup_Params();
+        parms.Inv = Inv?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientSetHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClientSetHUD_Params
+    {
+        [FieldOffset(0)] public nint newHUDType;
+    }
+
     /// <summary>
     /// Function: ClientSetHUD
     /// </summary>
     public unsafe virtual void ClientSetHUD(BmSDK.Class newHUDType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(newHUDType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientSetHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientSetHUD", true);
+        var parms = new ClientSetHUD_Params();
+        parms.newHUDType = newHUDType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PawnDiedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PawnDied_Params
+    {
+        [FieldOffset(0)] public nint P;
+    }
+
     /// <summary>
     /// Function: PawnDied
     /// </summary>
     public unsafe override void PawnDied(BmSDK.Engine.Pawn P)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PawnDied", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(P, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return;
+        var funcManaged = s_PawnDiedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PawnDied", true);
+        var parms = new PawnDied_Params();
+        parms.P = P?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return;
+    }
+
+    static BmSDK.Function s_UnPossessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UnPossess_Params
+    {
     }
 
     /// <summary>
@@ -3120,101 +4752,151 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe override void UnPossess()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UnPossess", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnPossessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UnPossess", true);
+        var parms = new UnPossess_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerAcknowledgePossessionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ServerAcknowledgePossession_Params
+    {
+        [FieldOffset(0)] public nint P;
+    }
+
     /// <summary>
     /// Function: ServerAcknowledgePossession
     /// </summary>
     public unsafe virtual void ServerAcknowledgePossession(BmSDK.Engine.Pawn P)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerAcknowledgePossession", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(P, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerAcknowledgePossessionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerAcknowledgePossession", true);
+        var parms = new ServerAcknowledgePossession_Params();
+        parms.P = P?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AcknowledgePossessionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AcknowledgePossession_Params
+    {
+        [FieldOffset(0)] public nint P;
+    }
+
     /// <summary>
     /// Function: AcknowledgePossession
     /// </summary>
     public unsafe virtual void AcknowledgePossession(BmSDK.Engine.Pawn P)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AcknowledgePossession", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(P, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AcknowledgePossessionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AcknowledgePossession", true);
+        var parms = new AcknowledgePossession_Params();
+        parms.P = P?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PossessFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct Possess_Params
+    {
+        [FieldOffset(0)] public nint aPawn;
+        [FieldOffset(4)] public int bVehicleTransition;
+    }
+
     /// <summary>
     /// Function: Possess
     /// </summary>
     public unsafe override void Possess(BmSDK.Engine.Pawn aPawn, bool bVehicleTransition)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Possess", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(aPawn, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bVehicleTransition, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PossessFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Possess", true);
+        var parms = new Possess_Params();
+        parms.aPawn = aPawn?.Ptr ?? 0;
+        parms.bVehicleTransition = bVehicleTransition ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GivePawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GivePawn_Params
+    {
+        [FieldOffset(0)] public nint NewPawn;
+    }
+
     /// <summary>
     /// Function: GivePawn
     /// </summary>
     public unsafe virtual void GivePawn(BmSDK.Engine.Pawn NewPawn)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GivePawn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewPawn, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_GivePawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GivePawn", true);
+        var parms = new GivePawn_Params();
+        parms.NewPawn = NewPawn?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AskForPawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct AskForPawn_Params
+    {
+    }
+
     /// <summary>
     /// Function: AskForPawn
     /// </summary>
     public unsafe virtual void AskForPawn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AskForPawn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AskForPawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AskForPawn", true);
+        var parms = new AskForPawn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientGotoStateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ClientGotoState_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName NewState;
+        [FieldOffset(8)] public BmSDK.FName NewLabel;
+    }
+
     /// <summary>
     /// Function: ClientGotoState
     /// </summary>
     public unsafe virtual void ClientGotoState(BmSDK.FName NewState, BmSDK.FName NewLabel = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientGotoState", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewState, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewLabel, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientGotoStateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientGotoState", true);
+        var parms = new ClientGotoState_Params();
+        parms.NewState = NewState;
+        parms.NewLabel = NewLabel;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsMouseAvailableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsMouseAvailable_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsMouseAvailable
     /// </summary>
     public unsafe virtual bool IsMouseAvailable()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsMouseAvailable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsMouseAvailableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsMouseAvailable", true);
+        var parms = new IsMouseAvailable_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsKeyboardAvailableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsKeyboardAvailable_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -3222,17 +4904,17 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool IsKeyboardAvailable()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsKeyboardAvailable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsKeyboardAvailableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsKeyboardAvailable", true);
+        var parms = new IsKeyboardAvailable_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_SetUseTiltForwardAndBackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetUseTiltForwardAndBack_Params
+    {
+        [FieldOffset(0)] public int bActive;
     }
 
     /// <summary>
@@ -3240,93 +4922,92 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void SetUseTiltForwardAndBack(bool bActive)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetUseTiltForwardAndBack", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bActive, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetUseTiltForwardAndBackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetUseTiltForwardAndBack", true);
+        var parms = new SetUseTiltForwardAndBack_Params();
+        parms.bActive = bActive ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetOnlyUseControllerTiltInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetOnlyUseControllerTiltInput_Params
+    {
+        [FieldOffset(0)] public int bActive;
+    }
+
     /// <summary>
     /// Function: SetOnlyUseControllerTiltInput
     /// </summary>
     public unsafe virtual void SetOnlyUseControllerTiltInput(bool bActive)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetOnlyUseControllerTiltInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bActive, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetOnlyUseControllerTiltInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetOnlyUseControllerTiltInput", true);
+        var parms = new SetOnlyUseControllerTiltInput_Params();
+        parms.bActive = bActive ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetControllerTiltActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetControllerTiltActive_Params
+    {
+        [FieldOffset(0)] public int bActive;
+    }
+
     /// <summary>
     /// Function: SetControllerTiltActive
     /// </summary>
     public unsafe virtual void SetControllerTiltActive(bool bActive)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetControllerTiltActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bActive, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetControllerTiltActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetControllerTiltActive", true);
+        var parms = new SetControllerTiltActive_Params();
+        parms.bActive = bActive ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetControllerTiltDesiredIfAvailableFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetControllerTiltDesiredIfAvailable_Params
+    {
+        [FieldOffset(0)] public int bActive;
+    }
+
     /// <summary>
     /// Function: SetControllerTiltDesiredIfAvailable
     /// </summary>
     public unsafe virtual void SetControllerTiltDesiredIfAvailable(bool bActive)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetControllerTiltDesiredIfAvailable", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bActive, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetControllerTiltDesiredIfAvailableFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetControllerTiltDesiredIfAvailable", true);
+        var parms = new SetControllerTiltDesiredIfAvailable_Params();
+        parms.bActive = bActive ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_IsControllerTiltActiveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsControllerTiltActive_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: IsControllerTiltActive
     /// </summary>
     public unsafe virtual bool IsControllerTiltActive()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsControllerTiltActive", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsControllerTiltActiveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.IsControllerTiltActive", true);
+        var parms = new IsControllerTiltActive_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ReloadProfileSettingsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReloadProfileSettings_Params
+    {
     }
 
     /// <summary>
@@ -3334,327 +5015,481 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void ReloadProfileSettings()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ReloadProfileSettings", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReloadProfileSettingsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ReloadProfileSettings", true);
+        var parms = new ReloadProfileSettings_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnregisterStandardPlayerDataStoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct UnregisterStandardPlayerDataStores_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnregisterStandardPlayerDataStores
     /// </summary>
     public unsafe virtual void UnregisterStandardPlayerDataStores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UnregisterStandardPlayerDataStores", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterStandardPlayerDataStoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UnregisterStandardPlayerDataStores", true);
+        var parms = new UnregisterStandardPlayerDataStores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_UnregisterPlayerDataStoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct UnregisterPlayerDataStores_Params
+    {
+    }
+
     /// <summary>
     /// Function: UnregisterPlayerDataStores
     /// </summary>
     public unsafe virtual void UnregisterPlayerDataStores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UnregisterPlayerDataStores", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_UnregisterPlayerDataStoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UnregisterPlayerDataStores", true);
+        var parms = new UnregisterPlayerDataStores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterStandardPlayerDataStoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct RegisterStandardPlayerDataStores_Params
+    {
+    }
+
     /// <summary>
     /// Function: RegisterStandardPlayerDataStores
     /// </summary>
     public unsafe virtual void RegisterStandardPlayerDataStores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RegisterStandardPlayerDataStores", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterStandardPlayerDataStoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RegisterStandardPlayerDataStores", true);
+        var parms = new RegisterStandardPlayerDataStores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterCustomPlayerDataStoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RegisterCustomPlayerDataStores_Params
+    {
+    }
+
     /// <summary>
     /// Function: RegisterCustomPlayerDataStores
     /// </summary>
     public unsafe virtual void RegisterCustomPlayerDataStores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RegisterCustomPlayerDataStores", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterCustomPlayerDataStoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RegisterCustomPlayerDataStores", true);
+        var parms = new RegisterCustomPlayerDataStores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RegisterPlayerDataStoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RegisterPlayerDataStores_Params
+    {
+    }
+
     /// <summary>
     /// Function: RegisterPlayerDataStores
     /// </summary>
     public unsafe virtual void RegisterPlayerDataStores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RegisterPlayerDataStores", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RegisterPlayerDataStoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.RegisterPlayerDataStores", true);
+        var parms = new RegisterPlayerDataStores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientInitializeDataStoresFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientInitializeDataStores_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientInitializeDataStores
     /// </summary>
     public unsafe virtual void ClientInitializeDataStores()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientInitializeDataStores", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientInitializeDataStoresFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientInitializeDataStores", true);
+        var parms = new ClientInitializeDataStores_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitInputSystemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct InitInputSystem_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitInputSystem
     /// </summary>
     public unsafe virtual void InitInputSystem()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.InitInputSystem", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitInputSystemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.InitInputSystem", true);
+        var parms = new InitInputSystem_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostControllerIdChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PostControllerIdChange_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostControllerIdChange
     /// </summary>
     public unsafe virtual void PostControllerIdChange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PostControllerIdChange", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostControllerIdChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PostControllerIdChange", true);
+        var parms = new PostControllerIdChange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreControllerIdChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PreControllerIdChange_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreControllerIdChange
     /// </summary>
     public unsafe virtual void PreControllerIdChange()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PreControllerIdChange", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreControllerIdChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PreControllerIdChange", true);
+        var parms = new PreControllerIdChange_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CleanOutSavedMovesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CleanOutSavedMoves_Params
+    {
+    }
+
     /// <summary>
     /// Function: CleanOutSavedMoves
     /// </summary>
     public unsafe virtual void CleanOutSavedMoves()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CleanOutSavedMoves", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CleanOutSavedMovesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CleanOutSavedMoves", true);
+        var parms = new CleanOutSavedMoves_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientResetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientReset_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientReset
     /// </summary>
     public unsafe virtual void ClientReset()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientReset", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientResetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientReset", true);
+        var parms = new ClientReset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Reset_Params
+    {
+    }
+
     /// <summary>
     /// Function: Reset
     /// </summary>
     public unsafe override void Reset()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Reset", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.Reset", true);
+        var parms = new Reset_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SpawnDefaultHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SpawnDefaultHUD_Params
+    {
+    }
+
     /// <summary>
     /// Function: SpawnDefaultHUD
     /// </summary>
     public unsafe virtual void SpawnDefaultHUD()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SpawnDefaultHUD", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SpawnDefaultHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SpawnDefaultHUD", true);
+        var parms = new SpawnDefaultHUD_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_EnableCheatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct EnableCheats_Params
+    {
+    }
+
     /// <summary>
     /// Function: EnableCheats
     /// </summary>
     public unsafe virtual void EnableCheats()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.EnableCheats", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_EnableCheatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.EnableCheats", true);
+        var parms = new EnableCheats_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddCheatsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AddCheats_Params
+    {
+        [FieldOffset(0)] public int bForce;
+    }
+
     /// <summary>
     /// Function: AddCheats
     /// </summary>
     public unsafe virtual void AddCheats(bool bForce = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AddCheats", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForce, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddCheatsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AddCheats", true);
+        var parms = new AddCheats_Params();
+        parms.bForce = bForce ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_KickWarningFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct KickWarning_Params
+    {
+    }
+
     /// <summary>
     /// Function: KickWarning
     /// </summary>
     public unsafe virtual void KickWarning()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.KickWarning", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_KickWarningFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.KickWarning", true);
+        var parms = new KickWarning_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerGivePawnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerGivePawn_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerGivePawn
     /// </summary>
     public unsafe override void ServerGivePawn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerGivePawn", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerGivePawnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerGivePawn", true);
+        var parms = new ServerGivePawn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ServerShortTimeoutFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ServerShortTimeout_Params
+    {
+    }
+
     /// <summary>
     /// Function: ServerShortTimeout
     /// </summary>
     public unsafe virtual void ServerShortTimeout()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerShortTimeout", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ServerShortTimeoutFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerShortTimeout", true);
+        var parms = new ServerShortTimeout_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ResetTimeMarginFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ResetTimeMargin_Params
+    {
+    }
+
     /// <summary>
     /// Function: ResetTimeMargin
     /// </summary>
     public unsafe virtual void ResetTimeMargin()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ResetTimeMargin", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ResetTimeMarginFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ResetTimeMargin", true);
+        var parms = new ResetTimeMargin_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreRenderFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PreRender_Params
+    {
+        [FieldOffset(0)] public nint Canvas;
+    }
+
     /// <summary>
     /// Function: PreRender
     /// </summary>
     public unsafe virtual void PreRender(BmSDK.Engine.Canvas Canvas)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PreRender", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Canvas, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreRenderFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PreRender", true);
+        var parms = new PreRender_Params();
+        parms.Canvas = Canvas?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TellPeerToTravelToSessionFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 104)]
+    private struct TellPeerToTravelToSession_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId ToPeerNetId;
+        [FieldOffset(8)] public BmSDK.FName SessionName;
+        [FieldOffset(16)] public nint SearchClass;
+        [FieldOffset(20)] public byte PlatformSpecificInfo;
+        [FieldOffset(100)] public int PlatformSpecificInfoSize;
+    }
+
     /// <summary>
     /// Function: TellPeerToTravelToSession
     /// </summary>
     public unsafe virtual void TellPeerToTravelToSession(BmSDK.Engine.OnlineSubsystem.FUniqueNetId ToPeerNetId, BmSDK.FName SessionName, BmSDK.Class SearchClass, byte PlatformSpecificInfo, int PlatformSpecificInfoSize)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.TellPeerToTravelToSession", true);
-        byte* paramsPtr = stackalloc byte[104];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ToPeerNetId, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SessionName, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SearchClass, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlatformSpecificInfo, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlatformSpecificInfoSize, paramsPtr + 100);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_TellPeerToTravelToSessionFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.TellPeerToTravelToSession", true);
+        var parms = new TellPeerToTravelToSession_Params();
+        parms.ToPeerNetId = ToPeerNetId;
+        parms.SessionName = SessionName;
+        parms.SearchClass = SearchClass?.Ptr ?? 0;
+        parms.PlatformSpecificInfo = PlatformSpecificInfo;
+        parms.PlatformSpecificInfoSize = PlatformSpecificInfoSize;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_TellPeerToTravelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct TellPeerToTravel_Params
+    {
+        [FieldOffset(0)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId ToPeerNetId;
+    }
+
     /// <summary>
     /// Function: TellPeerToTravel
     /// </summary>
     public unsafe virtual void TellPeerToTravel(BmSDK.Engine.OnlineSubsystem.FUniqueNetId ToPeerNetId)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.TellPeerToTravel", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ToPeerNetId, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_TellPeerToTravelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.TellPeerToTravel", true);
+        var parms = new TellPeerToTravel_Params();
+        parms.ToPeerNetId = ToPeerNetId;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PeerTravelAsHostFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PeerTravelAsHost_Params
+    {
+        [FieldOffset(0)] public float TravelCountdownTimer;
+        [FieldOffset(4)] public BmSDK.FString URL;
+    }
+
     /// <summary>
     /// Function: PeerTravelAsHost
     /// </summary>
     public unsafe virtual void PeerTravelAsHost(float TravelCountdownTimer, BmSDK.FString URL)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PeerTravelAsHost", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TravelCountdownTimer, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(URL, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PeerTravelAsHostFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PeerTravelAsHost", true);
+        var parms = new PeerTravelAsHost_Params();
+        parms.TravelCountdownTimer = TravelCountdownTimer;
+        parms.URL = URL;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ReceivedPlayerFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ReceivedPlayer_Params
+    {
+    }
+
     /// <summary>
     /// Function: ReceivedPlayer
     /// </summary>
     public unsafe virtual void ReceivedPlayer()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ReceivedPlayer", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ReceivedPlayerFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ReceivedPlayer", true);
+        var parms = new ReceivedPlayer_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PostBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PostBeginPlay
     /// </summary>
     public unsafe override void PostBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PostBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PostBeginPlay", true);
+        var parms = new PostBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForDelayedPauseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CheckForDelayedPause_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckForDelayedPause
     /// </summary>
     public unsafe virtual bool CheckForDelayedPause()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CheckForDelayedPause", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CheckForDelayedPauseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CheckForDelayedPause", true);
+        var parms = new CheckForDelayedPause_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnControllerChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OnControllerChanged_Params
+    {
+        [FieldOffset(0)] public int ControllerId;
+        [FieldOffset(4)] public int bIsConnected;
     }
 
     /// <summary>
@@ -3662,23 +5497,37 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void OnControllerChanged(int ControllerId, bool bIsConnected)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnControllerChanged", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ControllerId, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsConnected, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnControllerChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnControllerChanged", true);
+        var parms = new OnControllerChanged_Params();
+        parms.ControllerId = ControllerId;
+        parms.bIsConnected = bIsConnected ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CanUnpauseExternalUIFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct CanUnpauseExternalUI_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: CanUnpauseExternalUI
     /// </summary>
     public unsafe virtual bool CanUnpauseExternalUI()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanUnpauseExternalUI", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_CanUnpauseExternalUIFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CanUnpauseExternalUI", true);
+        var parms = new CanUnpauseExternalUI_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnExternalUIChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnExternalUIChanged_Params
+    {
+        [FieldOffset(0)] public int bIsOpening;
     }
 
     /// <summary>
@@ -3686,93 +5535,117 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void OnExternalUIChanged(bool bIsOpening)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnExternalUIChanged", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsOpening, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnExternalUIChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.OnExternalUIChanged", true);
+        var parms = new OnExternalUIChanged_Params();
+        parms.bIsOpening = bIsOpening ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayForceFeedbackWaveform_SimpleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct PlayForceFeedbackWaveform_Simple_Params
+    {
+        [FieldOffset(0)] public float Duration;
+        [FieldOffset(4)] public int leftStrength;
+        [FieldOffset(8)] public int rightStrength;
+        [FieldOffset(12)] public int rumbleFunction;
+    }
+
     /// <summary>
     /// Function: PlayForceFeedbackWaveform_Simple
     /// </summary>
     public unsafe virtual void PlayForceFeedbackWaveform_Simple(float Duration, int leftStrength, int rightStrength, int rumbleFunction)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayForceFeedbackWaveform_Simple", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Duration, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(leftStrength, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(rightStrength, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(rumbleFunction, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_PlayForceFeedbackWaveform_SimpleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PlayForceFeedbackWaveform_Simple", true);
+        var parms = new PlayForceFeedbackWaveform_Simple_Params();
+        parms.Duration = Duration;
+        parms.leftStrength = leftStrength;
+        parms.rightStrength = rightStrength;
+        parms.rumbleFunction = rumbleFunction;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ForceClearUnpauseDelegatesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ForceClearUnpauseDelegates_Params
+    {
+    }
+
     /// <summary>
     /// Function: ForceClearUnpauseDelegates
     /// </summary>
     public unsafe virtual void ForceClearUnpauseDelegates()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ForceClearUnpauseDelegates", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ForceClearUnpauseDelegatesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ForceClearUnpauseDelegates", true);
+        var parms = new ForceClearUnpauseDelegates_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FellOutOfWorldFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FellOutOfWorld_Params
+    {
+        [FieldOffset(0)] public nint dmgType;
+    }
+
     /// <summary>
     /// Function: FellOutOfWorld
     /// </summary>
     public unsafe override void FellOutOfWorld(BmSDK.Class dmgType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.FellOutOfWorld", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(dmgType, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FellOutOfWorldFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.FellOutOfWorld", true);
+        var parms = new FellOutOfWorld_Params();
+        parms.dmgType = dmgType?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CleanUpAudioComponentsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CleanUpAudioComponents_Params
+    {
+    }
+
     /// <summary>
     /// Function: CleanUpAudioComponents
     /// </summary>
     public unsafe virtual void CleanUpAudioComponents()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CleanUpAudioComponents", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_CleanUpAudioComponentsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CleanUpAudioComponents", true);
+        var parms = new CleanUpAudioComponents_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_FindStairRotationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct FindStairRotation_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FindStairRotation
     /// </summary>
     public unsafe virtual int FindStairRotation(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.FindStairRotation", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 4);
+        var funcManaged = s_FindStairRotationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.FindStairRotation", true);
+        var parms = new FindStairRotation_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CheckSpeedHackFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct CheckSpeedHack_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public int ReturnValue;
     }
 
     /// <summary>
@@ -3780,18 +5653,19 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual bool CheckSpeedHack(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CheckSpeedHack", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 4);
+        var funcManaged = s_CheckSpeedHackFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CheckSpeedHack", true);
+        var parms = new CheckSpeedHack_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ServerProcessConvolveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ServerProcessConvolve_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString C;
+        [FieldOffset(12)] public int H;
     }
 
     /// <summary>
@@ -3799,76 +5673,77 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe void ServerProcessConvolve(BmSDK.FString C, int H)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerProcessConvolve", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(C, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(H, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ServerProcessConvolveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ServerProcessConvolve", true);
+        var parms = new ServerProcessConvolve_Params();
+        parms.C = C;
+        parms.H = H;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientConvolveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ClientConvolve_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString C;
+        [FieldOffset(12)] public int H;
+    }
+
     /// <summary>
     /// Function: ClientConvolve
     /// </summary>
     public unsafe void ClientConvolve(BmSDK.FString C, int H)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientConvolve", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(C, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(H, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClientConvolveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientConvolve", true);
+        var parms = new ClientConvolve_Params();
+        parms.C = C;
+        parms.H = H;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetAllowMatureLanguageFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetAllowMatureLanguage_Params
+    {
+        [FieldOffset(0)] public int bAllowMatureLanguge;
+    }
+
     /// <summary>
     /// Function: SetAllowMatureLanguage
     /// </summary>
     public unsafe virtual void SetAllowMatureLanguage(bool bAllowMatureLanguge)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetAllowMatureLanguage", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAllowMatureLanguge, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetAllowMatureLanguageFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetAllowMatureLanguage", true);
+        var parms = new SetAllowMatureLanguage_Params();
+        parms.bAllowMatureLanguge = bAllowMatureLanguge ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PasteFromClipboardFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct PasteFromClipboard_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: PasteFromClipboard
     /// </summary>
     public unsafe virtual BmSDK.FString PasteFromClipboard()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PasteFromClipboard", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_PasteFromClipboardFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.PasteFromClipboard", true);
+        var parms = new PasteFromClipboard_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CopyToClipboardFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct CopyToClipboard_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
     }
 
     /// <summary>
@@ -3876,37 +5751,40 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void CopyToClipboard(BmSDK.FString Text)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CopyToClipboard", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_CopyToClipboardFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.CopyToClipboard", true);
+        var parms = new CopyToClipboard_Params();
+        parms.Text = Text;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetDefaultURLFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetDefaultURL_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Option;
+        [FieldOffset(12)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetDefaultURL
     /// </summary>
     public unsafe virtual BmSDK.FString GetDefaultURL(BmSDK.FString Option)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetDefaultURL", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Option, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
+        var funcManaged = s_GetDefaultURLFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetDefaultURL", true);
+        var parms = new GetDefaultURL_Params();
+        parms.Option = Option;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_UpdateURLFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct UpdateURL_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString NewOption;
+        [FieldOffset(12)] public BmSDK.FString NewValue;
+        [FieldOffset(24)] public int bSave1Default;
     }
 
     /// <summary>
@@ -3914,62 +5792,67 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void UpdateURL(BmSDK.FString NewOption, BmSDK.FString NewValue, bool bSave1Default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UpdateURL", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewOption, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewValue, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSave1Default, paramsPtr + 24);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateURLFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.UpdateURL", true);
+        var parms = new UpdateURL_Params();
+        parms.NewOption = NewOption;
+        parms.NewValue = NewValue;
+        parms.bSave1Default = bSave1Default ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientTravelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ClientTravel_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString URL;
+        [FieldOffset(12)] public BmSDK.Engine.Actor.ETravelType TravelType;
+        [FieldOffset(16)] public int bSeamless;
+        [FieldOffset(20)] public BmSDK.GameObject.FGuid MapPackageGuid;
+    }
+
     /// <summary>
     /// Function: ClientTravel
     /// </summary>
     public unsafe virtual void ClientTravel(BmSDK.FString URL, BmSDK.Engine.Actor.ETravelType TravelType, bool bSeamless = default, BmSDK.GameObject.FGuid MapPackageGuid = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientTravel", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(URL, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TravelType, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bSeamless, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MapPackageGuid, paramsPtr + 20);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_ClientTravelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ClientTravel", true);
+        var parms = new ClientTravel_Params();
+        parms.URL = URL;
+        parms.TravelType = TravelType;
+        parms.bSeamless = bSeamless ? 1 : 0;
+        parms.MapPackageGuid = MapPackageGuid;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ConsoleCommandFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct ConsoleCommand_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Command;
+        [FieldOffset(12)] public int bWriteToLog;
+        [FieldOffset(16)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: ConsoleCommand
     /// </summary>
     public unsafe override BmSDK.FString ConsoleCommand(BmSDK.FString Command, bool bWriteToLog = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ConsoleCommand", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Command, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWriteToLog, paramsPtr + 12);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 16);
+        var funcManaged = s_ConsoleCommandFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.ConsoleCommand", true);
+        var parms = new ConsoleCommand_Params();
+        parms.Command = Command;
+        parms.bWriteToLog = bWriteToLog ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetServerNetworkAddressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetServerNetworkAddress_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -3977,17 +5860,17 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual BmSDK.FString GetServerNetworkAddress()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetServerNetworkAddress", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetServerNetworkAddressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetServerNetworkAddress", true);
+        var parms = new GetServerNetworkAddress_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetPlayerNetworkAddressFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetPlayerNetworkAddress_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -3995,17 +5878,17 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual BmSDK.FString GetPlayerNetworkAddress()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetPlayerNetworkAddress", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetPlayerNetworkAddressFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.GetPlayerNetworkAddress", true);
+        var parms = new GetPlayerNetworkAddress_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetNetSpeedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetNetSpeed_Params
+    {
+        [FieldOffset(0)] public int NewSpeed;
     }
 
     /// <summary>
@@ -4013,36 +5896,29 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe virtual void SetNetSpeed(int NewSpeed)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetNetSpeed", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewSpeed, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetNetSpeedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.SetNetSpeed", true);
+        var parms = new SetNetSpeed_Params();
+        parms.NewSpeed = NewSpeed;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AllowConsoleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AllowConsole_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: AllowConsole
     /// </summary>
     public unsafe virtual bool AllowConsole()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AllowConsole", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_AllowConsoleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerController.AllowConsole", true);
+        var parms = new AllowConsole_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -4054,11 +5930,7 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// IntProperty: AmbientSound_ReferenceNumber
         /// </summary>
-        public unsafe int AmbientSound_ReferenceNumber
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int AmbientSound_ReferenceNumber;
 
         /// <summary>
         /// ObjectProperty: AmbientSound_Cue
@@ -4072,20 +5944,12 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// IntProperty: AmbientSound_Priority
         /// </summary>
-        public unsafe int AmbientSound_Priority
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public int AmbientSound_Priority;
 
         /// <summary>
         /// FloatProperty: AmbientSound_Time
         /// </summary>
-        public unsafe float AmbientSound_Time
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float AmbientSound_Time;
     }
 
     /// <summary>
@@ -4110,6 +5974,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     [StructLayout(LayoutKind.Explicit, Size = 72)]
     public partial record struct FDebugTextInfo
     {
+        [FieldOffset(52)] private int _bitfield52;
+
         /// <summary>
         /// ObjectProperty: SrcActor
         /// </summary>
@@ -4122,20 +5988,12 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// StructProperty: SrcActorOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 SrcActorOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.Numerics.Vector3 SrcActorOffset;
 
         /// <summary>
         /// StructProperty: SrcActorDesiredOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 SrcActorDesiredOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public System.Numerics.Vector3 SrcActorDesiredOffset;
 
         /// <summary>
         /// StrProperty: DebugText
@@ -4149,56 +6007,40 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// FloatProperty: TimeRemaining
         /// </summary>
-        public unsafe float TimeRemaining
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float TimeRemaining;
 
         /// <summary>
         /// FloatProperty: Duration
         /// </summary>
-        public unsafe float Duration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public float Duration;
 
         /// <summary>
         /// StructProperty: TextColor
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor TextColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public BmSDK.GameObject.FColor TextColor;
 
         /// <summary>
         /// BoolProperty: bAbsoluteLocation
         /// </summary>
-        public unsafe bool bAbsoluteLocation
+        public bool bAbsoluteLocation
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }; }
+            readonly get => (_bitfield52 & 1) != 0;
+            set { if (value) _bitfield52 |= 1; else _bitfield52 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bKeepAttachedToActor
         /// </summary>
-        public unsafe bool bKeepAttachedToActor
+        public bool bKeepAttachedToActor
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }; }
+            readonly get => (_bitfield52 & 2) != 0;
+            set { if (value) _bitfield52 |= 2; else _bitfield52 &= ~2; }
         }
 
         /// <summary>
         /// StructProperty: OrigActorLocation
         /// </summary>
-        public unsafe System.Numerics.Vector3 OrigActorLocation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public System.Numerics.Vector3 OrigActorLocation;
 
         /// <summary>
         /// ObjectProperty: Font
@@ -4237,11 +6079,7 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// NameProperty: MatchFuncName
         /// </summary>
-        public unsafe BmSDK.FName MatchFuncName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.FName MatchFuncName;
 
         /// <summary>
         /// DelegateProperty: MatchDelegate
@@ -4255,38 +6093,22 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// NameProperty: FailedFuncName
         /// </summary>
-        public unsafe BmSDK.FName FailedFuncName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public BmSDK.FName FailedFuncName;
 
         /// <summary>
         /// NameProperty: RequestName
         /// </summary>
-        public unsafe BmSDK.FName RequestName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public BmSDK.FName RequestName;
 
         /// <summary>
         /// IntProperty: MatchIdx
         /// </summary>
-        public unsafe int MatchIdx
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }; }
-        }
+        [FieldOffset(52)] public int MatchIdx;
 
         /// <summary>
         /// FloatProperty: LastMatchTime
         /// </summary>
-        public unsafe float LastMatchTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float LastMatchTime;
     }
 
     /// <summary>
@@ -4298,38 +6120,22 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// ByteProperty: Type
         /// </summary>
-        public unsafe BmSDK.Engine.PlayerController.EInputTypes Type
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PlayerController.EInputTypes>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.PlayerController.EInputTypes Type;
 
         /// <summary>
         /// FloatProperty: Value
         /// </summary>
-        public unsafe float Value
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public float Value;
 
         /// <summary>
         /// FloatProperty: TimeDelta
         /// </summary>
-        public unsafe float TimeDelta
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float TimeDelta;
 
         /// <summary>
         /// ByteProperty: Action
         /// </summary>
-        public unsafe BmSDK.Engine.PlayerController.EInputMatchAction Action
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PlayerController.EInputMatchAction>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.Engine.PlayerController.EInputMatchAction Action;
     }
 
     /// <summary>
@@ -4358,31 +6164,25 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     [StructLayout(LayoutKind.Explicit, Size = 16)]
     public partial record struct FConnectedPeerInfo
     {
+        [FieldOffset(12)] private int _bitfield12;
+
         /// <summary>
         /// StructProperty: PlayerID
         /// </summary>
-        public unsafe BmSDK.Engine.OnlineSubsystem.FUniqueNetId PlayerID
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.OnlineSubsystem.FUniqueNetId>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.Engine.OnlineSubsystem.FUniqueNetId PlayerID;
 
         /// <summary>
         /// ByteProperty: NatType
         /// </summary>
-        public unsafe BmSDK.Engine.OnlineSubsystem.ENATType NatType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.OnlineSubsystem.ENATType>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.Engine.OnlineSubsystem.ENATType NatType;
 
         /// <summary>
         /// BoolProperty: bLostConnectionToHost
         /// </summary>
-        public unsafe bool bLostConnectionToHost
+        public bool bLostConnectionToHost
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
     }
 
@@ -4395,38 +6195,22 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// FloatProperty: TimeStamp
         /// </summary>
-        public unsafe float TimeStamp
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float TimeStamp;
 
         /// <summary>
         /// ByteProperty: newPhysics
         /// </summary>
-        public unsafe BmSDK.Engine.Actor.EPhysics newPhysics
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EPhysics>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.Engine.Actor.EPhysics newPhysics;
 
         /// <summary>
         /// StructProperty: NewLoc
         /// </summary>
-        public unsafe System.Numerics.Vector3 NewLoc
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public System.Numerics.Vector3 NewLoc;
 
         /// <summary>
         /// StructProperty: NewVel
         /// </summary>
-        public unsafe System.Numerics.Vector3 NewVel
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public System.Numerics.Vector3 NewVel;
 
         /// <summary>
         /// ObjectProperty: NewBase
@@ -4440,20 +6224,12 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
         /// <summary>
         /// StructProperty: NewFloor
         /// </summary>
-        public unsafe System.Numerics.Vector3 NewFloor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 36); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 36); }; }
-        }
+        [FieldOffset(36)] public System.Numerics.Vector3 NewFloor;
 
         /// <summary>
         /// ByteProperty: bAckGoodMove
         /// </summary>
-        public unsafe byte bAckGoodMove
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public byte bAckGoodMove;
     }
 
     /// <summary>
@@ -4497,8 +6273,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bFrozen
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 1; else *(int*)(Ptr + 868) &= ~1; }
     }
 
     /// <summary>
@@ -4506,8 +6282,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bPressedJump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 2; else *(int*)(Ptr + 868) &= ~2; }
     }
 
     /// <summary>
@@ -4515,8 +6291,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bDoubleJump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 4; else *(int*)(Ptr + 868) &= ~4; }
     }
 
     /// <summary>
@@ -4524,8 +6300,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bUpdatePosition
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 8; else *(int*)(Ptr + 868) &= ~8; }
     }
 
     /// <summary>
@@ -4533,8 +6309,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bUpdating
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 16; else *(int*)(Ptr + 868) &= ~16; }
     }
 
     /// <summary>
@@ -4542,8 +6318,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bNeverSwitchOnPickup
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 32; else *(int*)(Ptr + 868) &= ~32; }
     }
 
     /// <summary>
@@ -4551,8 +6327,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bCheatFlying
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 64; else *(int*)(Ptr + 868) &= ~64; }
     }
 
     /// <summary>
@@ -4560,8 +6336,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bCameraPositionLocked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 128; else *(int*)(Ptr + 868) &= ~128; }
     }
 
     /// <summary>
@@ -4569,8 +6345,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bShortConnectTimeOut
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 256; else *(int*)(Ptr + 868) &= ~256; }
     }
 
     /// <summary>
@@ -4578,8 +6354,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bPendingDestroy
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 512; else *(int*)(Ptr + 868) &= ~512; }
     }
 
     /// <summary>
@@ -4587,8 +6363,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bWasSpeedHack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 1024; else *(int*)(Ptr + 868) &= ~1024; }
     }
 
     /// <summary>
@@ -4596,8 +6372,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bWasSaturated
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 2048; else *(int*)(Ptr + 868) &= ~2048; }
     }
 
     /// <summary>
@@ -4605,8 +6381,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bAimingHelp
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 4096; else *(int*)(Ptr + 868) &= ~4096; }
     }
 
     /// <summary>
@@ -4614,8 +6390,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bClientSimulatingViewTarget
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 8192; else *(int*)(Ptr + 868) &= ~8192; }
     }
 
     /// <summary>
@@ -4623,8 +6399,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bHasVoiceHandshakeCompleted
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 16384; else *(int*)(Ptr + 868) &= ~16384; }
     }
 
     /// <summary>
@@ -4632,8 +6408,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bCinematicMode
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 32768; else *(int*)(Ptr + 868) &= ~32768; }
     }
 
     /// <summary>
@@ -4641,8 +6417,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bCinemaDisableInputMove
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 65536; else *(int*)(Ptr + 868) &= ~65536; }
     }
 
     /// <summary>
@@ -4650,8 +6426,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bCinemaDisableInputLook
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 131072; else *(int*)(Ptr + 868) &= ~131072; }
     }
 
     /// <summary>
@@ -4659,8 +6435,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bIgnoreNetworkMessages
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 262144; else *(int*)(Ptr + 868) &= ~262144; }
     }
 
     /// <summary>
@@ -4668,8 +6444,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bReplicateAllPawns
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 524288; else *(int*)(Ptr + 868) &= ~524288; }
     }
 
     /// <summary>
@@ -4677,8 +6453,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bIsUsingStreamingVolumes
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 1048576; else *(int*)(Ptr + 868) &= ~1048576; }
     }
 
     /// <summary>
@@ -4686,8 +6462,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bIsExternalUIOpen
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 2097152; else *(int*)(Ptr + 868) &= ~2097152; }
     }
 
     /// <summary>
@@ -4695,8 +6471,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bIsControllerConnected
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 4194304; else *(int*)(Ptr + 868) &= ~4194304; }
     }
 
     /// <summary>
@@ -4704,8 +6480,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bCheckSoundOcclusion
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 8388608; else *(int*)(Ptr + 868) &= ~8388608; }
     }
 
     /// <summary>
@@ -4713,8 +6489,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bDebugCameraAnims
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 16777216; else *(int*)(Ptr + 868) &= ~16777216; }
     }
 
     /// <summary>
@@ -4722,8 +6498,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bBlockCameraAnimsFromOverridingPostProcess
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 33554432; else *(int*)(Ptr + 868) &= ~33554432; }
     }
 
     /// <summary>
@@ -4731,8 +6507,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bLogHearSoundOverflow
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 67108864; else *(int*)(Ptr + 868) &= ~67108864; }
     }
 
     /// <summary>
@@ -4740,8 +6516,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bCheckRelevancyThroughPortals
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 134217728; else *(int*)(Ptr + 868) &= ~134217728; }
     }
 
     /// <summary>
@@ -4749,8 +6525,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bControllerWasDisconnected
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 268435456; else *(int*)(Ptr + 868) &= ~268435456; }
     }
 
     /// <summary>
@@ -4758,8 +6534,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bDidLoseFocusDeferPause
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 536870912; else *(int*)(Ptr + 868) &= ~536870912; }
     }
 
     /// <summary>
@@ -4767,8 +6543,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe bool bDebugClientAdjustPosition
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 868); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 868); }
+        get { return (*(int*)(Ptr + 868) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 868) |= 1073741824; else *(int*)(Ptr + 868) &= ~1073741824; }
     }
 
     /// <summary>
@@ -4776,8 +6552,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float MaxResponseTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 872); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 872); }
+        get { return *(float*)(Ptr + 872); }
+        set { *(float*)(Ptr + 872) = value; }
     }
 
     /// <summary>
@@ -4785,8 +6561,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float WaitDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 876); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 876); }
+        get { return *(float*)(Ptr + 876); }
+        set { *(float*)(Ptr + 876) = value; }
     }
 
     /// <summary>
@@ -4803,8 +6579,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe BmSDK.Engine.Actor.EDoubleClickDir DoubleClickDir
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EDoubleClickDir>(Ptr + 884); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 884); }
+        get { return *(BmSDK.Engine.Actor.EDoubleClickDir*)(Ptr + 884); }
+        set { *(BmSDK.Engine.Actor.EDoubleClickDir*)(Ptr + 884) = value; }
     }
 
     /// <summary>
@@ -4812,8 +6588,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe byte bIgnoreMoveInput
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 885); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 885); }
+        get { return *(byte*)(Ptr + 885); }
+        set { *(byte*)(Ptr + 885) = value; }
     }
 
     /// <summary>
@@ -4821,8 +6597,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe byte bIgnoreLookInput
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 886); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 886); }
+        get { return *(byte*)(Ptr + 886); }
+        set { *(byte*)(Ptr + 886) = value; }
     }
 
     /// <summary>
@@ -4830,8 +6606,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe byte bRun
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 887); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 887); }
+        get { return *(byte*)(Ptr + 887); }
+        set { *(byte*)(Ptr + 887) = value; }
     }
 
     /// <summary>
@@ -4839,8 +6615,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe byte bDuck
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 888); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 888); }
+        get { return *(byte*)(Ptr + 888); }
+        set { *(byte*)(Ptr + 888) = value; }
     }
 
     /// <summary>
@@ -4848,8 +6624,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe byte NetPlayerIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 889); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 889); }
+        get { return *(byte*)(Ptr + 889); }
+        set { *(byte*)(Ptr + 889) = value; }
     }
 
     /// <summary>
@@ -4884,8 +6660,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float FOVAngle
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 904); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 904); }
+        get { return *(float*)(Ptr + 904); }
+        set { *(float*)(Ptr + 904) = value; }
     }
 
     /// <summary>
@@ -4893,8 +6669,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float DesiredFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 908); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 908); }
+        get { return *(float*)(Ptr + 908); }
+        set { *(float*)(Ptr + 908) = value; }
     }
 
     /// <summary>
@@ -4902,8 +6678,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float DefaultFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 912); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 912); }
+        get { return *(float*)(Ptr + 912); }
+        set { *(float*)(Ptr + 912) = value; }
     }
 
     /// <summary>
@@ -4911,8 +6687,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float LODDistanceFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 916); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 916); }
+        get { return *(float*)(Ptr + 916); }
+        set { *(float*)(Ptr + 916) = value; }
     }
 
     /// <summary>
@@ -4926,8 +6702,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float TargetEyeHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 932); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 932); }
+        get { return *(float*)(Ptr + 932); }
+        set { *(float*)(Ptr + 932) = value; }
     }
 
     /// <summary>
@@ -4992,8 +6768,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float CurrentTimeStamp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 980); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 980); }
+        get { return *(float*)(Ptr + 980); }
+        set { *(float*)(Ptr + 980) = value; }
     }
 
     /// <summary>
@@ -5001,8 +6777,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float LastUpdateTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 984); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 984); }
+        get { return *(float*)(Ptr + 984); }
+        set { *(float*)(Ptr + 984) = value; }
     }
 
     /// <summary>
@@ -5010,8 +6786,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float ServerTimeStamp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 988); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 988); }
+        get { return *(float*)(Ptr + 988); }
+        set { *(float*)(Ptr + 988) = value; }
     }
 
     /// <summary>
@@ -5019,8 +6795,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float TimeMargin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 992); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 992); }
+        get { return *(float*)(Ptr + 992); }
+        set { *(float*)(Ptr + 992) = value; }
     }
 
     /// <summary>
@@ -5028,8 +6804,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float ClientUpdateTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 996); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 996); }
+        get { return *(float*)(Ptr + 996); }
+        set { *(float*)(Ptr + 996) = value; }
     }
 
     /// <summary>
@@ -5037,8 +6813,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float MaxTimeMargin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1000); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1000); }
+        get { return *(float*)(Ptr + 1000); }
+        set { *(float*)(Ptr + 1000) = value; }
     }
 
     /// <summary>
@@ -5046,8 +6822,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float LastActiveTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1004); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1004); }
+        get { return *(float*)(Ptr + 1004); }
+        set { *(float*)(Ptr + 1004) = value; }
     }
 
     /// <summary>
@@ -5055,8 +6831,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe int ClientCap
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1008); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1008); }
+        get { return *(int*)(Ptr + 1008); }
+        set { *(int*)(Ptr + 1008) = value; }
     }
 
     /// <summary>
@@ -5064,8 +6840,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float DynamicPingThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1012); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1012); }
+        get { return *(float*)(Ptr + 1012); }
+        set { *(float*)(Ptr + 1012) = value; }
     }
 
     /// <summary>
@@ -5073,8 +6849,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float LastPingUpdate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1016); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1016); }
+        get { return *(float*)(Ptr + 1016); }
+        set { *(float*)(Ptr + 1016) = value; }
     }
 
     /// <summary>
@@ -5082,8 +6858,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float LastSpeedHackLog
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1020); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1020); }
+        get { return *(float*)(Ptr + 1020); }
+        set { *(float*)(Ptr + 1020) = value; }
     }
 
     /// <summary>
@@ -5097,8 +6873,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe int GroundPitch
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1076); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1076); }
+        get { return *(int*)(Ptr + 1076); }
+        set { *(int*)(Ptr + 1076) = value; }
     }
 
     /// <summary>
@@ -5265,8 +7041,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float InteractDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1220); }
+        get { return *(float*)(Ptr + 1220); }
+        set { *(float*)(Ptr + 1220) = value; }
     }
 
     /// <summary>
@@ -5274,8 +7050,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe BmSDK.FName DelayedJoinSessionName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 1224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1224); }
+        get { return *(BmSDK.FName*)(Ptr + 1224); }
+        set { *(BmSDK.FName*)(Ptr + 1224) = value; }
     }
 
     /// <summary>
@@ -5292,8 +7068,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float LastBroadcastTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1244); }
+        get { return *(float*)(Ptr + 1244); }
+        set { *(float*)(Ptr + 1244) = value; }
     }
 
     /// <summary>
@@ -5357,8 +7133,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float SpectatorCameraSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1320); }
+        get { return *(float*)(Ptr + 1320); }
+        set { *(float*)(Ptr + 1320) = value; }
     }
 
     /// <summary>
@@ -5375,8 +7151,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float MinRespawnDelay
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1328); }
+        get { return *(float*)(Ptr + 1328); }
+        set { *(float*)(Ptr + 1328) = value; }
     }
 
     /// <summary>
@@ -5384,8 +7160,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe int MaxConcurrentHearSounds
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1332); }
+        get { return *(int*)(Ptr + 1332); }
+        set { *(int*)(Ptr + 1332) = value; }
     }
 
     /// <summary>
@@ -5447,8 +7223,8 @@ public partial class PlayerController : BmSDK.Engine.Controller, BmSDK.IGameObje
     /// </summary>
     public unsafe float LastSpectatorStateSynchTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1392); }
+        get { return *(float*)(Ptr + 1392); }
+        set { *(float*)(Ptr + 1392) = value; }
     }
 
     /// <summary>
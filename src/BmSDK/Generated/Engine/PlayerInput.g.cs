@@ -78,55 +78,93 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<PlayerInput>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PreClientTravelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct PreClientTravel_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString PendingURL;
+        [FieldOffset(12)] public BmSDK.Engine.Actor.ETravelType TravelType;
+        [FieldOffset(16)] public int bIsSeamlessTravel;
+    }
+
     /// <summary>
     /// Function: PreClientTravel
     /// </summary>
     public unsafe virtual void PreClientTravel(BmSDK.FString PendingURL, BmSDK.Engine.Actor.ETravelType TravelType, bool bIsSeamlessTravel)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.PreClientTravel", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PendingURL, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(TravelType, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsSeamlessTravel, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreClientTravelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.PreClientTravel", true);
+        var parms = new PreClientTravel_Params();
+        parms.PendingURL = PendingURL;
+        parms.TravelType = TravelType;
+        parms.bIsSeamlessTravel = bIsSeamlessTravel ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClientInitInputSystemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClientInitInputSystem_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClientInitInputSystem
     /// </summary>
     public unsafe virtual void ClientInitInputSystem()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.ClientInitInputSystem", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClientInitInputSystemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.ClientInitInputSystem", true);
+        var parms = new ClientInitInputSystem_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitInputSystemFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct InitInputSystem_Params
+    {
+    }
+
     /// <summary>
     /// Function: InitInputSystem
     /// </summary>
     public unsafe virtual void InitInputSystem()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.InitInputSystem", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitInputSystemFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.InitInputSystem", true);
+        var parms = new InitInputSystem_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SmoothMouseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct SmoothMouse_Params
+    {
+        [FieldOffset(0)] public float aMouse;
+        [FieldOffset(4)] public float DeltaTime;
+        [FieldOffset(8)] public byte SampleCount;
+        [FieldOffset(12)] public int Index;
+        [FieldOffset(16)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: SmoothMouse
     /// </summary>
     public unsafe virtual float SmoothMouse(float aMouse, float DeltaTime, out byte SampleCount, int Index)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.SmoothMouse", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(aMouse, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Index, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        SampleCount = BmSDK.Framework.MarshalUtil.ToManaged<byte>(paramsPtr + 8);
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 16);
+        var funcManaged = s_SmoothMouseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.SmoothMouse", true);
+        var parms = new SmoothMouse_Params();
+        parms.aMouse = aMouse;
+        parms.DeltaTime = DeltaTime;
+        parms.Index = Index;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        SampleCount = parms.SampleCount;
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_ClearSmoothingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct ClearSmoothing_Params
+    {
     }
 
     /// <summary>
@@ -134,56 +172,89 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void ClearSmoothing()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.ClearSmoothing", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearSmoothingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.ClearSmoothing", true);
+        var parms = new ClearSmoothing_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SmartJumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct SmartJump_Params
+    {
+    }
+
     /// <summary>
     /// Function: SmartJump
     /// </summary>
     public unsafe virtual void SmartJump()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.SmartJump", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SmartJumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.SmartJump", true);
+        var parms = new SmartJump_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_JumpFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Jump_Params
+    {
+    }
+
     /// <summary>
     /// Function: Jump
     /// </summary>
     public unsafe virtual void Jump()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.Jump", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_JumpFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.Jump", true);
+        var parms = new Jump_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ProcessInputMatchingFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct ProcessInputMatching_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: ProcessInputMatching
     /// </summary>
     public unsafe virtual void ProcessInputMatching(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.ProcessInputMatching", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ProcessInputMatchingFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.ProcessInputMatching", true);
+        var parms = new ProcessInputMatching_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_CheckForDoubleClickMoveFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 7)]
+    private struct CheckForDoubleClickMove_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+        [FieldOffset(4)] public BmSDK.Engine.Actor.EDoubleClickDir ReturnValue;
+    }
+
     /// <summary>
     /// Function: CheckForDoubleClickMove
     /// </summary>
     public unsafe virtual BmSDK.Engine.Actor.EDoubleClickDir CheckForDoubleClickMove(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.CheckForDoubleClickMove", true);
-        byte* paramsPtr = stackalloc byte[7];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EDoubleClickDir>(paramsPtr + 4);
+        var funcManaged = s_CheckForDoubleClickMoveFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.CheckForDoubleClickMove", true);
+        var parms = new CheckForDoubleClickMove_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CatchDoubleClickInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct CatchDoubleClickInput_Params
+    {
     }
 
     /// <summary>
@@ -191,93 +262,149 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void CatchDoubleClickInput()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.CatchDoubleClickInput", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_CatchDoubleClickInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.CatchDoubleClickInput", true);
+        var parms = new CatchDoubleClickInput_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s__PlayerInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct _PlayerInput_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: PlayerInput
     /// </summary>
     public unsafe virtual void _PlayerInput(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.PlayerInput", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s__PlayerInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.PlayerInput", true);
+        var parms = new _PlayerInput_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AdjustMouseSensitivityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct AdjustMouseSensitivity_Params
+    {
+        [FieldOffset(0)] public float FOVScale;
+    }
+
     /// <summary>
     /// Function: AdjustMouseSensitivity
     /// </summary>
     public unsafe virtual void AdjustMouseSensitivity(float FOVScale)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.AdjustMouseSensitivity", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FOVScale, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AdjustMouseSensitivityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.AdjustMouseSensitivity", true);
+        var parms = new AdjustMouseSensitivity_Params();
+        parms.FOVScale = FOVScale;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PostProcessInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PostProcessInput_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: PostProcessInput
     /// </summary>
     public unsafe virtual void PostProcessInput(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.PostProcessInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostProcessInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.PostProcessInput", true);
+        var parms = new PostProcessInput_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PreProcessInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PreProcessInput_Params
+    {
+        [FieldOffset(0)] public float DeltaTime;
+    }
+
     /// <summary>
     /// Function: PreProcessInput
     /// </summary>
     public unsafe virtual void PreProcessInput(float DeltaTime)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.PreProcessInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeltaTime, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreProcessInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.PreProcessInput", true);
+        var parms = new PreProcessInput_Params();
+        parms.DeltaTime = DeltaTime;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_DrawHUDFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct DrawHUD_Params
+    {
+        [FieldOffset(0)] public nint H;
+    }
+
     /// <summary>
     /// Function: DrawHUD
     /// </summary>
     public unsafe virtual void DrawHUD(BmSDK.Engine.HUD H)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.DrawHUD", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(H, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_DrawHUDFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.DrawHUD", true);
+        var parms = new DrawHUD_Params();
+        parms.H = H?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetSensitivityFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetSensitivity_Params
+    {
+        [FieldOffset(0)] public float F;
+    }
+
     /// <summary>
     /// Function: SetSensitivity
     /// </summary>
     public unsafe virtual void SetSensitivity(float F)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.SetSensitivity", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(F, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetSensitivityFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.SetSensitivity", true);
+        var parms = new SetSensitivity_Params();
+        parms.F = F;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InvertTurnFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InvertTurn_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: InvertTurn
     /// </summary>
     public unsafe virtual bool InvertTurn()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.InvertTurn", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_InvertTurnFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.InvertTurn", true);
+        var parms = new InvertTurn_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InvertMouseFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct InvertMouse_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -285,10 +412,10 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool InvertMouse()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.InvertMouse", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_InvertMouseFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PlayerInput.InvertMouse", true);
+        var parms = new InvertMouse_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -296,8 +423,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUsingGamepad
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 1; else *(int*)(Ptr + 204) &= ~1; }
     }
 
     /// <summary>
@@ -305,8 +432,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInvertMouse
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 2; else *(int*)(Ptr + 204) &= ~2; }
     }
 
     /// <summary>
@@ -314,8 +441,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInvertTurn
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 4; else *(int*)(Ptr + 204) &= ~4; }
     }
 
     /// <summary>
@@ -323,8 +450,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bWasForward
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 8; else *(int*)(Ptr + 204) &= ~8; }
     }
 
     /// <summary>
@@ -332,8 +459,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bWasBack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 16; else *(int*)(Ptr + 204) &= ~16; }
     }
 
     /// <summary>
@@ -341,8 +468,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bWasLeft
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 32; else *(int*)(Ptr + 204) &= ~32; }
     }
 
     /// <summary>
@@ -350,8 +477,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bWasRight
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 64; else *(int*)(Ptr + 204) &= ~64; }
     }
 
     /// <summary>
@@ -359,8 +486,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEdgeForward
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 128; else *(int*)(Ptr + 204) &= ~128; }
     }
 
     /// <summary>
@@ -368,8 +495,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEdgeBack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 256; else *(int*)(Ptr + 204) &= ~256; }
     }
 
     /// <summary>
@@ -377,8 +504,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEdgeLeft
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 512; else *(int*)(Ptr + 204) &= ~512; }
     }
 
     /// <summary>
@@ -386,8 +513,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEdgeRight
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 1024; else *(int*)(Ptr + 204) &= ~1024; }
     }
 
     /// <summary>
@@ -395,8 +522,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableMouseSmoothing
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 2048; else *(int*)(Ptr + 204) &= ~2048; }
     }
 
     /// <summary>
@@ -404,8 +531,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableFOVScaling
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 4096; else *(int*)(Ptr + 204) &= ~4096; }
     }
 
     /// <summary>
@@ -413,8 +540,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bLockTurnUntilRelease
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }
+        get { return (*(int*)(Ptr + 204) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 204) |= 8192; else *(int*)(Ptr + 204) &= ~8192; }
     }
 
     /// <summary>
@@ -422,8 +549,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName LastAxisKeyName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(BmSDK.FName*)(Ptr + 208); }
+        set { *(BmSDK.FName*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -431,8 +558,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float DoubleClickTimer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(float*)(Ptr + 216); }
+        set { *(float*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -440,8 +567,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float DoubleClickTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(float*)(Ptr + 220); }
+        set { *(float*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -449,8 +576,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float MouseSensitivity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(float*)(Ptr + 224); }
+        set { *(float*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -458,8 +585,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aBaseX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -467,8 +594,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aBaseY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(float*)(Ptr + 232); }
+        set { *(float*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -476,8 +603,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aBaseZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(float*)(Ptr + 236); }
+        set { *(float*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -485,8 +612,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aMouseX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(float*)(Ptr + 240); }
+        set { *(float*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -494,8 +621,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aMouseY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(float*)(Ptr + 244); }
+        set { *(float*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -503,8 +630,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aForward
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(float*)(Ptr + 248); }
+        set { *(float*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -512,8 +639,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aTurn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 252); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }
+        get { return *(float*)(Ptr + 252); }
+        set { *(float*)(Ptr + 252) = value; }
     }
 
     /// <summary>
@@ -521,8 +648,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aStrafe
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(float*)(Ptr + 256); }
+        set { *(float*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -530,8 +657,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(float*)(Ptr + 260); }
+        set { *(float*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -539,8 +666,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -548,8 +675,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aRightAnalogTrigger
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 
     /// <summary>
@@ -557,8 +684,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aLeftAnalogTrigger
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(float*)(Ptr + 272); }
+        set { *(float*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -566,8 +693,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aPS3AccelX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(float*)(Ptr + 276); }
+        set { *(float*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -575,8 +702,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aPS3AccelY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 280); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 280); }
+        get { return *(float*)(Ptr + 280); }
+        set { *(float*)(Ptr + 280) = value; }
     }
 
     /// <summary>
@@ -584,8 +711,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aPS3AccelZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 284); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }
+        get { return *(float*)(Ptr + 284); }
+        set { *(float*)(Ptr + 284) = value; }
     }
 
     /// <summary>
@@ -593,8 +720,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float aPS3Gyro
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(float*)(Ptr + 288); }
+        set { *(float*)(Ptr + 288) = value; }
     }
 
     /// <summary>
@@ -602,8 +729,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float RawJoyUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 292); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }
+        get { return *(float*)(Ptr + 292); }
+        set { *(float*)(Ptr + 292) = value; }
     }
 
     /// <summary>
@@ -611,8 +738,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float RawJoyRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 296); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 296); }
+        get { return *(float*)(Ptr + 296); }
+        set { *(float*)(Ptr + 296) = value; }
     }
 
     /// <summary>
@@ -620,8 +747,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float RawJoyLookRight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 300); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }
+        get { return *(float*)(Ptr + 300); }
+        set { *(float*)(Ptr + 300) = value; }
     }
 
     /// <summary>
@@ -629,8 +756,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float RawJoyLookUp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }
+        get { return *(float*)(Ptr + 304); }
+        set { *(float*)(Ptr + 304) = value; }
     }
 
     /// <summary>
@@ -638,8 +765,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float MoveForwardSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(float*)(Ptr + 308); }
+        set { *(float*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -647,8 +774,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float MoveStrafeSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(float*)(Ptr + 312); }
+        set { *(float*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -656,8 +783,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float LookRightScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(float*)(Ptr + 316); }
+        set { *(float*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -665,8 +792,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float LookUpScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(float*)(Ptr + 320); }
+        set { *(float*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -674,8 +801,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bStrafe
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(byte*)(Ptr + 324); }
+        set { *(byte*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -683,8 +810,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bXAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 325); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 325); }
+        get { return *(byte*)(Ptr + 325); }
+        set { *(byte*)(Ptr + 325) = value; }
     }
 
     /// <summary>
@@ -692,8 +819,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe byte bYAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 326); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 326); }
+        get { return *(byte*)(Ptr + 326); }
+        set { *(byte*)(Ptr + 326) = value; }
     }
 
     /// <summary>
@@ -706,16 +833,16 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float ZeroTime_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(float*)(Ptr + 328); }
+        set { *(float*)(Ptr + 328) = value; }
     }
     /// <summary>
     /// FloatProperty: ZeroTime
     /// </summary>
     public unsafe float ZeroTime_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }
+        get { return *(float*)(Ptr + 332); }
+        set { *(float*)(Ptr + 332) = value; }
     }
 
     /// <summary>
@@ -728,16 +855,16 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float SmoothedMouse_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 336); }
+        get { return *(float*)(Ptr + 336); }
+        set { *(float*)(Ptr + 336) = value; }
     }
     /// <summary>
     /// FloatProperty: SmoothedMouse
     /// </summary>
     public unsafe float SmoothedMouse_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 340); }
+        get { return *(float*)(Ptr + 340); }
+        set { *(float*)(Ptr + 340) = value; }
     }
 
     /// <summary>
@@ -745,8 +872,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe int MouseSamples
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }
+        get { return *(int*)(Ptr + 344); }
+        set { *(int*)(Ptr + 344) = value; }
     }
 
     /// <summary>
@@ -754,8 +881,8 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float MouseSamplingTotal
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 348); }
+        get { return *(float*)(Ptr + 348); }
+        set { *(float*)(Ptr + 348) = value; }
     }
 
     /// <summary>
@@ -763,7 +890,7 @@ public partial class PlayerInput : BmSDK.Engine.Input, BmSDK.IGameObject
     /// </summary>
     public unsafe float AutoUnlockTurnTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 352); }
+        get { return *(float*)(Ptr + 352); }
+        set { *(float*)(Ptr + 352) = value; }
     }
 }
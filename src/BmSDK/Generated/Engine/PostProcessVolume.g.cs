@@ -78,15 +78,22 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<PostProcessVolume>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_OnToggleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct OnToggle_Params
+    {
+        [FieldOffset(0)] public nint Action;
+    }
+
     /// <summary>
     /// Function: OnToggle
     /// </summary>
     public unsafe override void OnToggle(BmSDK.Engine.SeqAct_Toggle Action)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PostProcessVolume.OnToggle", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Action, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnToggleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.PostProcessVolume.OnToggle", true);
+        var parms = new OnToggle_Params();
+        parms.Action = Action?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -95,8 +102,8 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe float Priority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(float*)(Ptr + 472); }
+        set { *(float*)(Ptr + 472) = value; }
     }
 
     /// <summary>
@@ -119,8 +126,8 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverrideDOF
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 880); }
+        get { return (*(int*)(Ptr + 880) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 880) |= 1; else *(int*)(Ptr + 880) &= ~1; }
     }
 
     /// <summary>
@@ -128,8 +135,8 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverrideMotionBlur
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 880); }
+        get { return (*(int*)(Ptr + 880) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 880) |= 2; else *(int*)(Ptr + 880) &= ~2; }
     }
 
     /// <summary>
@@ -137,8 +144,8 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverrideBloom
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 880); }
+        get { return (*(int*)(Ptr + 880) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 880) |= 4; else *(int*)(Ptr + 880) &= ~4; }
     }
 
     /// <summary>
@@ -146,8 +153,8 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverrideScene
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 880); }
+        get { return (*(int*)(Ptr + 880) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 880) |= 8; else *(int*)(Ptr + 880) &= ~8; }
     }
 
     /// <summary>
@@ -155,8 +162,8 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOverrideAtmospherics
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 880); }
+        get { return (*(int*)(Ptr + 880) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 880) |= 16; else *(int*)(Ptr + 880) &= ~16; }
     }
 
     /// <summary>
@@ -164,8 +171,8 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 880); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 880); }
+        get { return (*(int*)(Ptr + 880) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 880) |= 32; else *(int*)(Ptr + 880) &= ~32; }
     }
 
     /// <summary>
@@ -174,1184 +181,1002 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 400)]
     public partial record struct FPostProcessSettings
     {
+        [FieldOffset(0)] private int _bitfield0;
+        [FieldOffset(4)] private int _bitfield4;
+        [FieldOffset(12)] private int _bitfield12;
+        [FieldOffset(20)] private int _bitfield20;
+        [FieldOffset(28)] private int _bitfield28;
+        [FieldOffset(36)] private int _bitfield36;
+        [FieldOffset(44)] private int _bitfield44;
+        [FieldOffset(52)] private int _bitfield52;
+        [FieldOffset(60)] private int _bitfield60;
+        [FieldOffset(68)] private int _bitfield68;
+        [FieldOffset(76)] private int _bitfield76;
+        [FieldOffset(84)] private int _bitfield84;
+        [FieldOffset(92)] private int _bitfield92;
+        [FieldOffset(100)] private int _bitfield100;
+        [FieldOffset(108)] private int _bitfield108;
+        [FieldOffset(116)] private int _bitfield116;
+        [FieldOffset(124)] private int _bitfield124;
+        [FieldOffset(132)] private int _bitfield132;
+        [FieldOffset(140)] private int _bitfield140;
+        [FieldOffset(156)] private int _bitfield156;
+        [FieldOffset(172)] private int _bitfield172;
+        [FieldOffset(180)] private int _bitfield180;
+        [FieldOffset(188)] private int _bitfield188;
+        [FieldOffset(204)] private int _bitfield204;
+        [FieldOffset(296)] private int _bitfield296;
+
         /// <summary>
         /// BoolProperty: bOverride_InterpolateOverDistance
         /// </summary>
-        public unsafe bool bOverride_InterpolateOverDistance
+        public bool bOverride_InterpolateOverDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1) != 0;
+            set { if (value) _bitfield0 |= 1; else _bitfield0 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_InterpolateOverDistanceFade
         /// </summary>
-        public unsafe bool bOverride_InterpolateOverDistanceFade
+        public bool bOverride_InterpolateOverDistanceFade
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2) != 0;
+            set { if (value) _bitfield0 |= 2; else _bitfield0 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_bEnableHighQualityDOF
         /// </summary>
-        public unsafe bool bOverride_bEnableHighQualityDOF
+        public bool bOverride_bEnableHighQualityDOF
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4) != 0;
+            set { if (value) _bitfield0 |= 4; else _bitfield0 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableBloom
         /// </summary>
-        public unsafe bool bOverride_EnableBloom
+        public bool bOverride_EnableBloom
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8) != 0;
+            set { if (value) _bitfield0 |= 8; else _bitfield0 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableDOF
         /// </summary>
-        public unsafe bool bOverride_EnableDOF
+        public bool bOverride_EnableDOF
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16) != 0;
+            set { if (value) _bitfield0 |= 16; else _bitfield0 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableMotionBlur
         /// </summary>
-        public unsafe bool bOverride_EnableMotionBlur
+        public bool bOverride_EnableMotionBlur
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 32) != 0;
+            set { if (value) _bitfield0 |= 32; else _bitfield0 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableSceneEffect
         /// </summary>
-        public unsafe bool bOverride_EnableSceneEffect
+        public bool bOverride_EnableSceneEffect
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 64) != 0;
+            set { if (value) _bitfield0 |= 64; else _bitfield0 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_AllowAmbientOcclusion
         /// </summary>
-        public unsafe bool bOverride_AllowAmbientOcclusion
+        public bool bOverride_AllowAmbientOcclusion
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 128) != 0;
+            set { if (value) _bitfield0 |= 128; else _bitfield0 &= ~128; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Bloom_Scale
         /// </summary>
-        public unsafe bool bOverride_Bloom_Scale
+        public bool bOverride_Bloom_Scale
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 256) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 256) != 0;
+            set { if (value) _bitfield0 |= 256; else _bitfield0 &= ~256; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Bloom_Threshold
         /// </summary>
-        public unsafe bool bOverride_Bloom_Threshold
+        public bool bOverride_Bloom_Threshold
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 512) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 512) != 0;
+            set { if (value) _bitfield0 |= 512; else _bitfield0 &= ~512; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Bloom_Tint
         /// </summary>
-        public unsafe bool bOverride_Bloom_Tint
+        public bool bOverride_Bloom_Tint
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1024) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1024) != 0;
+            set { if (value) _bitfield0 |= 1024; else _bitfield0 &= ~1024; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Bloom_ScreenBlendThreshold
         /// </summary>
-        public unsafe bool bOverride_Bloom_ScreenBlendThreshold
+        public bool bOverride_Bloom_ScreenBlendThreshold
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2048) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2048) != 0;
+            set { if (value) _bitfield0 |= 2048; else _bitfield0 &= ~2048; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Bloom_InterpolationDuration
         /// </summary>
-        public unsafe bool bOverride_Bloom_InterpolationDuration
+        public bool bOverride_Bloom_InterpolationDuration
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4096) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4096) != 0;
+            set { if (value) _bitfield0 |= 4096; else _bitfield0 &= ~4096; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_FalloffExponent
         /// </summary>
-        public unsafe bool bOverride_DOF_FalloffExponent
+        public bool bOverride_DOF_FalloffExponent
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8192) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8192) != 0;
+            set { if (value) _bitfield0 |= 8192; else _bitfield0 &= ~8192; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_BlurKernelSize
         /// </summary>
-        public unsafe bool bOverride_DOF_BlurKernelSize
+        public bool bOverride_DOF_BlurKernelSize
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16384) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16384) != 0;
+            set { if (value) _bitfield0 |= 16384; else _bitfield0 &= ~16384; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_BlurBloomKernelSize
         /// </summary>
-        public unsafe bool bOverride_DOF_BlurBloomKernelSize
+        public bool bOverride_DOF_BlurBloomKernelSize
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 32768) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 32768) != 0;
+            set { if (value) _bitfield0 |= 32768; else _bitfield0 &= ~32768; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_MaxNearBlurAmount
         /// </summary>
-        public unsafe bool bOverride_DOF_MaxNearBlurAmount
+        public bool bOverride_DOF_MaxNearBlurAmount
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 65536) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 65536) != 0;
+            set { if (value) _bitfield0 |= 65536; else _bitfield0 &= ~65536; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_MinBlurAmount
         /// </summary>
-        public unsafe bool bOverride_DOF_MinBlurAmount
+        public bool bOverride_DOF_MinBlurAmount
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 131072) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 131072) != 0;
+            set { if (value) _bitfield0 |= 131072; else _bitfield0 &= ~131072; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_MaxFarBlurAmount
         /// </summary>
-        public unsafe bool bOverride_DOF_MaxFarBlurAmount
+        public bool bOverride_DOF_MaxFarBlurAmount
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 262144) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 262144) != 0;
+            set { if (value) _bitfield0 |= 262144; else _bitfield0 &= ~262144; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_ModulateBlurColor
         /// </summary>
-        public unsafe bool bOverride_DOF_ModulateBlurColor
+        public bool bOverride_DOF_ModulateBlurColor
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 524288) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 524288) != 0;
+            set { if (value) _bitfield0 |= 524288; else _bitfield0 &= ~524288; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_FocusType
         /// </summary>
-        public unsafe bool bOverride_DOF_FocusType
+        public bool bOverride_DOF_FocusType
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1048576) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1048576) != 0;
+            set { if (value) _bitfield0 |= 1048576; else _bitfield0 &= ~1048576; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_FocusInnerRadius
         /// </summary>
-        public unsafe bool bOverride_DOF_FocusInnerRadius
+        public bool bOverride_DOF_FocusInnerRadius
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 2097152) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 2097152) != 0;
+            set { if (value) _bitfield0 |= 2097152; else _bitfield0 &= ~2097152; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_FocusDistance
         /// </summary>
-        public unsafe bool bOverride_DOF_FocusDistance
+        public bool bOverride_DOF_FocusDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 4194304) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 4194304) != 0;
+            set { if (value) _bitfield0 |= 4194304; else _bitfield0 &= ~4194304; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_FocusPosition
         /// </summary>
-        public unsafe bool bOverride_DOF_FocusPosition
+        public bool bOverride_DOF_FocusPosition
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 8388608) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 8388608) != 0;
+            set { if (value) _bitfield0 |= 8388608; else _bitfield0 &= ~8388608; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_DOF_InterpolationDuration
         /// </summary>
-        public unsafe bool bOverride_DOF_InterpolationDuration
+        public bool bOverride_DOF_InterpolationDuration
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 16777216) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 16777216) != 0;
+            set { if (value) _bitfield0 |= 16777216; else _bitfield0 &= ~16777216; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_MotionBlur_MaxVelocity
         /// </summary>
-        public unsafe bool bOverride_MotionBlur_MaxVelocity
+        public bool bOverride_MotionBlur_MaxVelocity
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 33554432) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 33554432) != 0;
+            set { if (value) _bitfield0 |= 33554432; else _bitfield0 &= ~33554432; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_MotionBlur_Amount
         /// </summary>
-        public unsafe bool bOverride_MotionBlur_Amount
+        public bool bOverride_MotionBlur_Amount
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 67108864) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 67108864) != 0;
+            set { if (value) _bitfield0 |= 67108864; else _bitfield0 &= ~67108864; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_MotionBlur_FullMotionBlur
         /// </summary>
-        public unsafe bool bOverride_MotionBlur_FullMotionBlur
+        public bool bOverride_MotionBlur_FullMotionBlur
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 134217728) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 134217728) != 0;
+            set { if (value) _bitfield0 |= 134217728; else _bitfield0 &= ~134217728; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_MotionBlur_CameraRotationThreshold
         /// </summary>
-        public unsafe bool bOverride_MotionBlur_CameraRotationThreshold
+        public bool bOverride_MotionBlur_CameraRotationThreshold
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 268435456) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 268435456) != 0;
+            set { if (value) _bitfield0 |= 268435456; else _bitfield0 &= ~268435456; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_MotionBlur_CameraTranslationThreshold
         /// </summary>
-        public unsafe bool bOverride_MotionBlur_CameraTranslationThreshold
+        public bool bOverride_MotionBlur_CameraTranslationThreshold
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 536870912) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 536870912) != 0;
+            set { if (value) _bitfield0 |= 536870912; else _bitfield0 &= ~536870912; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_MotionBlur_InterpolationDuration
         /// </summary>
-        public unsafe bool bOverride_MotionBlur_InterpolationDuration
+        public bool bOverride_MotionBlur_InterpolationDuration
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & 1073741824) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & 1073741824) != 0;
+            set { if (value) _bitfield0 |= 1073741824; else _bitfield0 &= ~1073741824; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Scene_Desaturation
         /// </summary>
-        public unsafe bool bOverride_Scene_Desaturation
+        public bool bOverride_Scene_Desaturation
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0) & -2147483648) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 0); }; }
+            readonly get => (_bitfield0 & -2147483648) != 0;
+            set { if (value) _bitfield0 |= -2147483648; else _bitfield0 &= ~-2147483648; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Scene_Colorize
         /// </summary>
-        public unsafe bool bOverride_Scene_Colorize
+        public bool bOverride_Scene_Colorize
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 1) != 0;
+            set { if (value) _bitfield4 |= 1; else _bitfield4 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Scene_ImageGrainScale
         /// </summary>
-        public unsafe bool bOverride_Scene_ImageGrainScale
+        public bool bOverride_Scene_ImageGrainScale
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 2) != 0;
+            set { if (value) _bitfield4 |= 2; else _bitfield4 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Scene_HighLights
         /// </summary>
-        public unsafe bool bOverride_Scene_HighLights
+        public bool bOverride_Scene_HighLights
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 4) != 0;
+            set { if (value) _bitfield4 |= 4; else _bitfield4 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Scene_MidTones
         /// </summary>
-        public unsafe bool bOverride_Scene_MidTones
+        public bool bOverride_Scene_MidTones
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 8) != 0;
+            set { if (value) _bitfield4 |= 8; else _bitfield4 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Scene_Shadows
         /// </summary>
-        public unsafe bool bOverride_Scene_Shadows
+        public bool bOverride_Scene_Shadows
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 16) != 0;
+            set { if (value) _bitfield4 |= 16; else _bitfield4 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Scene_InterpolationDuration
         /// </summary>
-        public unsafe bool bOverride_Scene_InterpolationDuration
+        public bool bOverride_Scene_InterpolationDuration
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 32) != 0;
+            set { if (value) _bitfield4 |= 32; else _bitfield4 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_Scene_ColorGradingLUT
         /// </summary>
-        public unsafe bool bOverride_Scene_ColorGradingLUT
+        public bool bOverride_Scene_ColorGradingLUT
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 64) != 0;
+            set { if (value) _bitfield4 |= 64; else _bitfield4 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableInterpolateOverDistance
         /// </summary>
-        public unsafe bool bEnableInterpolateOverDistance
+        public bool bEnableInterpolateOverDistance
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 4); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 4); }; }
+            readonly get => (_bitfield4 & 128) != 0;
+            set { if (value) _bitfield4 |= 128; else _bitfield4 &= ~128; }
         }
 
         /// <summary>
         /// FloatProperty: InterpolateOverDistanceFade
         /// </summary>
-        public unsafe float InterpolateOverDistanceFade
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float InterpolateOverDistanceFade;
 
         /// <summary>
         /// BoolProperty: bEnableBloom
         /// </summary>
-        public unsafe bool bEnableBloom
+        public bool bEnableBloom
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 1) != 0;
+            set { if (value) _bitfield12 |= 1; else _bitfield12 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableDOF
         /// </summary>
-        public unsafe bool bEnableDOF
+        public bool bEnableDOF
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 2) != 0;
+            set { if (value) _bitfield12 |= 2; else _bitfield12 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableHighQualityDOF
         /// </summary>
-        public unsafe bool bEnableHighQualityDOF
+        public bool bEnableHighQualityDOF
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 4) != 0;
+            set { if (value) _bitfield12 |= 4; else _bitfield12 &= ~4; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableMotionBlur
         /// </summary>
-        public unsafe bool bEnableMotionBlur
+        public bool bEnableMotionBlur
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 8) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 8) != 0;
+            set { if (value) _bitfield12 |= 8; else _bitfield12 &= ~8; }
         }
 
         /// <summary>
         /// BoolProperty: bEnableSceneEffect
         /// </summary>
-        public unsafe bool bEnableSceneEffect
+        public bool bEnableSceneEffect
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 16) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 16) != 0;
+            set { if (value) _bitfield12 |= 16; else _bitfield12 &= ~16; }
         }
 
         /// <summary>
         /// BoolProperty: bAllowAmbientOcclusion
         /// </summary>
-        public unsafe bool bAllowAmbientOcclusion
+        public bool bAllowAmbientOcclusion
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 32) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 32) != 0;
+            set { if (value) _bitfield12 |= 32; else _bitfield12 &= ~32; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD1
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD1
+        public bool bOverride_EnableAtmosD1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 64) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 64) != 0;
+            set { if (value) _bitfield12 |= 64; else _bitfield12 &= ~64; }
         }
 
         /// <summary>
         /// BoolProperty: bAtmosD1
         /// </summary>
-        public unsafe bool bAtmosD1
+        public bool bAtmosD1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 128) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 128) != 0;
+            set { if (value) _bitfield12 |= 128; else _bitfield12 &= ~128; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD1Col
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD1Col
+        public bool bOverride_EnableAtmosD1Col
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12) & 256) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 12); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 12); }; }
+            readonly get => (_bitfield12 & 256) != 0;
+            set { if (value) _bitfield12 |= 256; else _bitfield12 &= ~256; }
         }
 
         /// <summary>
         /// StructProperty: AtmosD1_Colour
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor AtmosD1_Colour
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public BmSDK.GameObject.FColor AtmosD1_Colour;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD1Den
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD1Den
+        public bool bOverride_EnableAtmosD1Den
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 20); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 20); }; }
+            readonly get => (_bitfield20 & 1) != 0;
+            set { if (value) _bitfield20 |= 1; else _bitfield20 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosD1_Density
         /// </summary>
-        public unsafe float AtmosD1_Density
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float AtmosD1_Density;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD1Start
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD1Start
+        public bool bOverride_EnableAtmosD1Start
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 28); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 28); }; }
+            readonly get => (_bitfield28 & 1) != 0;
+            set { if (value) _bitfield28 |= 1; else _bitfield28 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosD1_DistanceStart
         /// </summary>
-        public unsafe float AtmosD1_DistanceStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 32); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 32); }; }
-        }
+        [FieldOffset(32)] public float AtmosD1_DistanceStart;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD1End
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD1End
+        public bool bOverride_EnableAtmosD1End
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 36); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 36); }; }
+            readonly get => (_bitfield36 & 1) != 0;
+            set { if (value) _bitfield36 |= 1; else _bitfield36 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosD1_DistanceEnd
         /// </summary>
-        public unsafe float AtmosD1_DistanceEnd
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 40); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 40); }; }
-        }
+        [FieldOffset(40)] public float AtmosD1_DistanceEnd;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD2
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD2
+        public bool bOverride_EnableAtmosD2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }; }
+            readonly get => (_bitfield44 & 1) != 0;
+            set { if (value) _bitfield44 |= 1; else _bitfield44 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bAtmosD2
         /// </summary>
-        public unsafe bool bAtmosD2
+        public bool bAtmosD2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }; }
+            readonly get => (_bitfield44 & 2) != 0;
+            set { if (value) _bitfield44 |= 2; else _bitfield44 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD2Col
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD2Col
+        public bool bOverride_EnableAtmosD2Col
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 44); }; }
+            readonly get => (_bitfield44 & 4) != 0;
+            set { if (value) _bitfield44 |= 4; else _bitfield44 &= ~4; }
         }
 
         /// <summary>
         /// StructProperty: AtmosD2_Colour
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor AtmosD2_Colour
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 48); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }; }
-        }
+        [FieldOffset(48)] public BmSDK.GameObject.FColor AtmosD2_Colour;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD2Den
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD2Den
+        public bool bOverride_EnableAtmosD2Den
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 52); }; }
+            readonly get => (_bitfield52 & 1) != 0;
+            set { if (value) _bitfield52 |= 1; else _bitfield52 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosD2_Density
         /// </summary>
-        public unsafe float AtmosD2_Density
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }; }
-        }
+        [FieldOffset(56)] public float AtmosD2_Density;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD2Start
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD2Start
+        public bool bOverride_EnableAtmosD2Start
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 60); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 60); }; }
+            readonly get => (_bitfield60 & 1) != 0;
+            set { if (value) _bitfield60 |= 1; else _bitfield60 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosD2_DistanceStart
         /// </summary>
-        public unsafe float AtmosD2_DistanceStart
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 64); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 64); }; }
-        }
+        [FieldOffset(64)] public float AtmosD2_DistanceStart;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosD2End
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosD2End
+        public bool bOverride_EnableAtmosD2End
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 68); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 68); }; }
+            readonly get => (_bitfield68 & 1) != 0;
+            set { if (value) _bitfield68 |= 1; else _bitfield68 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosD2_DistanceEnd
         /// </summary>
-        public unsafe float AtmosD2_DistanceEnd
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }; }
-        }
+        [FieldOffset(72)] public float AtmosD2_DistanceEnd;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH1
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH1
+        public bool bOverride_EnableAtmosH1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }; }
+            readonly get => (_bitfield76 & 1) != 0;
+            set { if (value) _bitfield76 |= 1; else _bitfield76 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bAtmosH1
         /// </summary>
-        public unsafe bool bAtmosH1
+        public bool bAtmosH1
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }; }
+            readonly get => (_bitfield76 & 2) != 0;
+            set { if (value) _bitfield76 |= 2; else _bitfield76 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH1Col
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH1Col
+        public bool bOverride_EnableAtmosH1Col
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 76); }; }
+            readonly get => (_bitfield76 & 4) != 0;
+            set { if (value) _bitfield76 |= 4; else _bitfield76 &= ~4; }
         }
 
         /// <summary>
         /// StructProperty: AtmosH1_Colour
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor AtmosH1_Colour
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 80); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }; }
-        }
+        [FieldOffset(80)] public BmSDK.GameObject.FColor AtmosH1_Colour;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH1Den
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH1Den
+        public bool bOverride_EnableAtmosH1Den
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 84); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 84); }; }
+            readonly get => (_bitfield84 & 1) != 0;
+            set { if (value) _bitfield84 |= 1; else _bitfield84 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosH1_Density
         /// </summary>
-        public unsafe float AtmosH1_Density
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }; }
-        }
+        [FieldOffset(88)] public float AtmosH1_Density;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH1Size
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH1Size
+        public bool bOverride_EnableAtmosH1Size
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 92); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 92); }; }
+            readonly get => (_bitfield92 & 1) != 0;
+            set { if (value) _bitfield92 |= 1; else _bitfield92 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosH1_GradientSize
         /// </summary>
-        public unsafe float AtmosH1_GradientSize
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }; }
-        }
+        [FieldOffset(96)] public float AtmosH1_GradientSize;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH1Pos
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH1Pos
+        public bool bOverride_EnableAtmosH1Pos
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 100); }; }
+            readonly get => (_bitfield100 & 1) != 0;
+            set { if (value) _bitfield100 |= 1; else _bitfield100 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosH1_GradientPosition
         /// </summary>
-        public unsafe float AtmosH1_GradientPosition
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }; }
-        }
+        [FieldOffset(104)] public float AtmosH1_GradientPosition;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH2
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH2
+        public bool bOverride_EnableAtmosH2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }; }
+            readonly get => (_bitfield108 & 1) != 0;
+            set { if (value) _bitfield108 |= 1; else _bitfield108 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: bAtmosH2
         /// </summary>
-        public unsafe bool bAtmosH2
+        public bool bAtmosH2
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }; }
+            readonly get => (_bitfield108 & 2) != 0;
+            set { if (value) _bitfield108 |= 2; else _bitfield108 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH2Col
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH2Col
+        public bool bOverride_EnableAtmosH2Col
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }; }
+            readonly get => (_bitfield108 & 4) != 0;
+            set { if (value) _bitfield108 |= 4; else _bitfield108 &= ~4; }
         }
 
         /// <summary>
         /// StructProperty: AtmosH2_Colour
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor AtmosH2_Colour
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 112); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }; }
-        }
+        [FieldOffset(112)] public BmSDK.GameObject.FColor AtmosH2_Colour;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH2Den
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH2Den
+        public bool bOverride_EnableAtmosH2Den
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 116); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 116); }; }
+            readonly get => (_bitfield116 & 1) != 0;
+            set { if (value) _bitfield116 |= 1; else _bitfield116 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosH2_Density
         /// </summary>
-        public unsafe float AtmosH2_Density
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }; }
-        }
+        [FieldOffset(120)] public float AtmosH2_Density;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH2Size
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH2Size
+        public bool bOverride_EnableAtmosH2Size
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 124); }; }
+            readonly get => (_bitfield124 & 1) != 0;
+            set { if (value) _bitfield124 |= 1; else _bitfield124 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosH2_GradientSize
         /// </summary>
-        public unsafe float AtmosH2_GradientSize
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }; }
-        }
+        [FieldOffset(128)] public float AtmosH2_GradientSize;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosH2Pos
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosH2Pos
+        public bool bOverride_EnableAtmosH2Pos
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 132); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 132); }; }
+            readonly get => (_bitfield132 & 1) != 0;
+            set { if (value) _bitfield132 |= 1; else _bitfield132 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosH2_GradientPosition
         /// </summary>
-        public unsafe float AtmosH2_GradientPosition
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 136); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }; }
-        }
+        [FieldOffset(136)] public float AtmosH2_GradientPosition;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosNoise
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosNoise
+        public bool bOverride_EnableAtmosNoise
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }; }
+            readonly get => (_bitfield140 & 1) != 0;
+            set { if (value) _bitfield140 |= 1; else _bitfield140 &= ~1; }
         }
 
         /// <summary>
         /// BoolProperty: AtmosNoise
         /// </summary>
-        public unsafe bool AtmosNoise
+        public bool AtmosNoise
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 2) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }; }
+            readonly get => (_bitfield140 & 2) != 0;
+            set { if (value) _bitfield140 |= 2; else _bitfield140 &= ~2; }
         }
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosNoiseWind
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosNoiseWind
+        public bool bOverride_EnableAtmosNoiseWind
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 4) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }; }
+            readonly get => (_bitfield140 & 4) != 0;
+            set { if (value) _bitfield140 |= 4; else _bitfield140 &= ~4; }
         }
 
         /// <summary>
         /// StructProperty: AtmosNoiseWind
         /// </summary>
-        public unsafe System.Numerics.Vector3 AtmosNoiseWind
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 144); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }; }
-        }
+        [FieldOffset(144)] public System.Numerics.Vector3 AtmosNoiseWind;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosNoiseOffset
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosNoiseOffset
+        public bool bOverride_EnableAtmosNoiseOffset
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 156); }; }
+            readonly get => (_bitfield156 & 1) != 0;
+            set { if (value) _bitfield156 |= 1; else _bitfield156 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: AtmosNoiseOffset
         /// </summary>
-        public unsafe System.Numerics.Vector3 AtmosNoiseOffset
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 160); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }; }
-        }
+        [FieldOffset(160)] public System.Numerics.Vector3 AtmosNoiseOffset;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosNoiseFade
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosNoiseFade
+        public bool bOverride_EnableAtmosNoiseFade
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 172); }; }
+            readonly get => (_bitfield172 & 1) != 0;
+            set { if (value) _bitfield172 |= 1; else _bitfield172 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosNoiseFade
         /// </summary>
-        public unsafe float AtmosNoiseFade
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 176); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }; }
-        }
+        [FieldOffset(176)] public float AtmosNoiseFade;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosGlobal_Gradient_Colour
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosGlobal_Gradient_Colour
+        public bool bOverride_EnableAtmosGlobal_Gradient_Colour
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 180); }; }
+            readonly get => (_bitfield180 & 1) != 0;
+            set { if (value) _bitfield180 |= 1; else _bitfield180 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: AtmosGlobal_Gradient_Colour
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor AtmosGlobal_Gradient_Colour
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 184); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }; }
-        }
+        [FieldOffset(184)] public BmSDK.GameObject.FColor AtmosGlobal_Gradient_Colour;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosGlobal_Gradient_Direction
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosGlobal_Gradient_Direction
+        public bool bOverride_EnableAtmosGlobal_Gradient_Direction
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 188); }; }
+            readonly get => (_bitfield188 & 1) != 0;
+            set { if (value) _bitfield188 |= 1; else _bitfield188 &= ~1; }
         }
 
         /// <summary>
         /// StructProperty: AtmosGlobal_Gradient_Direction
         /// </summary>
-        public unsafe System.Numerics.Vector3 AtmosGlobal_Gradient_Direction
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 192); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }; }
-        }
+        [FieldOffset(192)] public System.Numerics.Vector3 AtmosGlobal_Gradient_Direction;
 
         /// <summary>
         /// BoolProperty: bOverride_EnableAtmosGlobal_Gradient_Density
         /// </summary>
-        public unsafe bool bOverride_EnableAtmosGlobal_Gradient_Density
+        public bool bOverride_EnableAtmosGlobal_Gradient_Density
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 204); }; }
+            readonly get => (_bitfield204 & 1) != 0;
+            set { if (value) _bitfield204 |= 1; else _bitfield204 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: AtmosGlobal_Gradient_Density
         /// </summary>
-        public unsafe float AtmosGlobal_Gradient_Density
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }; }
-        }
+        [FieldOffset(208)] public float AtmosGlobal_Gradient_Density;
 
         /// <summary>
         /// FloatProperty: Bloom_Scale
         /// </summary>
-        public unsafe float Bloom_Scale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 212); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }; }
-        }
+        [FieldOffset(212)] public float Bloom_Scale;
 
         /// <summary>
         /// FloatProperty: Bloom_Threshold
         /// </summary>
-        public unsafe float Bloom_Threshold
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 216); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }; }
-        }
+        [FieldOffset(216)] public float Bloom_Threshold;
 
         /// <summary>
         /// StructProperty: Bloom_Tint
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor Bloom_Tint
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 220); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }; }
-        }
+        [FieldOffset(220)] public BmSDK.GameObject.FColor Bloom_Tint;
 
         /// <summary>
         /// FloatProperty: Bloom_ScreenBlendThreshold
         /// </summary>
-        public unsafe float Bloom_ScreenBlendThreshold
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 224); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }; }
-        }
+        [FieldOffset(224)] public float Bloom_ScreenBlendThreshold;
 
         /// <summary>
         /// FloatProperty: Bloom_InterpolationDuration
         /// </summary>
-        public unsafe float Bloom_InterpolationDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }; }
-        }
+        [FieldOffset(228)] public float Bloom_InterpolationDuration;
 
         /// <summary>
         /// FloatProperty: DOF_BlurBloomKernelSize
         /// </summary>
-        public unsafe float DOF_BlurBloomKernelSize
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }; }
-        }
+        [FieldOffset(232)] public float DOF_BlurBloomKernelSize;
 
         /// <summary>
         /// FloatProperty: DOF_FalloffExponent
         /// </summary>
-        public unsafe float DOF_FalloffExponent
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 236); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }; }
-        }
+        [FieldOffset(236)] public float DOF_FalloffExponent;
 
         /// <summary>
         /// FloatProperty: DOF_BlurKernelSize
         /// </summary>
-        public unsafe float DOF_BlurKernelSize
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 240); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }; }
-        }
+        [FieldOffset(240)] public float DOF_BlurKernelSize;
 
         /// <summary>
         /// FloatProperty: DOF_MaxNearBlurAmount
         /// </summary>
-        public unsafe float DOF_MaxNearBlurAmount
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 244); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }; }
-        }
+        [FieldOffset(244)] public float DOF_MaxNearBlurAmount;
 
         /// <summary>
         /// FloatProperty: DOF_MinBlurAmount
         /// </summary>
-        public unsafe float DOF_MinBlurAmount
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 248); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }; }
-        }
+        [FieldOffset(248)] public float DOF_MinBlurAmount;
 
         /// <summary>
         /// FloatProperty: DOF_MaxFarBlurAmount
         /// </summary>
-        public unsafe float DOF_MaxFarBlurAmount
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 252); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 252); }; }
-        }
+        [FieldOffset(252)] public float DOF_MaxFarBlurAmount;
 
         /// <summary>
         /// StructProperty: DOF_ModulateBlurColor
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor DOF_ModulateBlurColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 256); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }; }
-        }
+        [FieldOffset(256)] public BmSDK.GameObject.FColor DOF_ModulateBlurColor;
 
         /// <summary>
         /// ByteProperty: DOF_FocusType
         /// </summary>
-        public unsafe BmSDK.Engine.DOFEffect.EFocusType DOF_FocusType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.DOFEffect.EFocusType>(Ptr + 260); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }; }
-        }
+        [FieldOffset(260)] public BmSDK.Engine.DOFEffect.EFocusType DOF_FocusType;
 
         /// <summary>
         /// FloatProperty: DOF_FocusInnerRadius
         /// </summary>
-        public unsafe float DOF_FocusInnerRadius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }; }
-        }
+        [FieldOffset(264)] public float DOF_FocusInnerRadius;
 
         /// <summary>
         /// FloatProperty: DOF_FocusDistance
         /// </summary>
-        public unsafe float DOF_FocusDistance
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }; }
-        }
+        [FieldOffset(268)] public float DOF_FocusDistance;
 
         /// <summary>
         /// StructProperty: DOF_FocusPosition
         /// </summary>
-        public unsafe System.Numerics.Vector3 DOF_FocusPosition
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 272); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }; }
-        }
+        [FieldOffset(272)] public System.Numerics.Vector3 DOF_FocusPosition;
 
         /// <summary>
         /// FloatProperty: DOF_InterpolationDuration
         /// </summary>
-        public unsafe float DOF_InterpolationDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 284); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 284); }; }
-        }
+        [FieldOffset(284)] public float DOF_InterpolationDuration;
 
         /// <summary>
         /// FloatProperty: MotionBlur_MaxVelocity
         /// </summary>
-        public unsafe float MotionBlur_MaxVelocity
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 288); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }; }
-        }
+        [FieldOffset(288)] public float MotionBlur_MaxVelocity;
 
         /// <summary>
         /// FloatProperty: MotionBlur_Amount
         /// </summary>
-        public unsafe float MotionBlur_Amount
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 292); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 292); }; }
-        }
+        [FieldOffset(292)] public float MotionBlur_Amount;
 
         /// <summary>
         /// BoolProperty: MotionBlur_FullMotionBlur
         /// </summary>
-        public unsafe bool MotionBlur_FullMotionBlur
+        public bool MotionBlur_FullMotionBlur
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 296) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 296); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 296); }; }
+            readonly get => (_bitfield296 & 1) != 0;
+            set { if (value) _bitfield296 |= 1; else _bitfield296 &= ~1; }
         }
 
         /// <summary>
         /// FloatProperty: MotionBlur_CameraRotationThreshold
         /// </summary>
-        public unsafe float MotionBlur_CameraRotationThreshold
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 300); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 300); }; }
-        }
+        [FieldOffset(300)] public float MotionBlur_CameraRotationThreshold;
 
         /// <summary>
         /// FloatProperty: MotionBlur_CameraTranslationThreshold
         /// </summary>
-        public unsafe float MotionBlur_CameraTranslationThreshold
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 304); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 304); }; }
-        }
+        [FieldOffset(304)] public float MotionBlur_CameraTranslationThreshold;
 
         /// <summary>
         /// FloatProperty: MotionBlur_InterpolationDuration
         /// </summary>
-        public unsafe float MotionBlur_InterpolationDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 308); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }; }
-        }
+        [FieldOffset(308)] public float MotionBlur_InterpolationDuration;
 
         /// <summary>
         /// FloatProperty: Scene_Desaturation
         /// </summary>
-        public unsafe float Scene_Desaturation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 312); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }; }
-        }
+        [FieldOffset(312)] public float Scene_Desaturation;
 
         /// <summary>
         /// StructProperty: Scene_Colorize
         /// </summary>
-        public unsafe System.Numerics.Vector3 Scene_Colorize
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 316); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }; }
-        }
+        [FieldOffset(316)] public System.Numerics.Vector3 Scene_Colorize;
 
         /// <summary>
         /// FloatProperty: Scene_ImageGrainScale
         /// </summary>
-        public unsafe float Scene_ImageGrainScale
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 328); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }; }
-        }
+        [FieldOffset(328)] public float Scene_ImageGrainScale;
 
         /// <summary>
         /// StructProperty: Scene_HighLights
         /// </summary>
-        public unsafe System.Numerics.Vector3 Scene_HighLights
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 332); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 332); }; }
-        }
+        [FieldOffset(332)] public System.Numerics.Vector3 Scene_HighLights;
 
         /// <summary>
         /// StructProperty: Scene_MidTones
         /// </summary>
-        public unsafe System.Numerics.Vector3 Scene_MidTones
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 344); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 344); }; }
-        }
+        [FieldOffset(344)] public System.Numerics.Vector3 Scene_MidTones;
 
         /// <summary>
         /// StructProperty: Scene_Shadows
         /// </summary>
-        public unsafe System.Numerics.Vector3 Scene_Shadows
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 356); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 356); }; }
-        }
+        [FieldOffset(356)] public System.Numerics.Vector3 Scene_Shadows;
 
         /// <summary>
         /// FloatProperty: Scene_InterpolationDuration
         /// </summary>
-        public unsafe float Scene_InterpolationDuration
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 368); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }; }
-        }
+        [FieldOffset(368)] public float Scene_InterpolationDuration;
 
         /// <summary>
         /// ObjectProperty: ColorGrading_LookupTable
@@ -1365,11 +1190,7 @@ public partial class PostProcessVolume : BmSDK.Engine.Volume, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: ColorGradingLUT
         /// </summary>
-        public unsafe BmSDK.Engine.PostProcessVolume.FLUTBlender ColorGradingLUT
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PostProcessVolume.FLUTBlender>(Ptr + 376); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 376); }; }
-        }
+        [FieldOffset(376)] public BmSDK.Engine.PostProcessVolume.FLUTBlender ColorGradingLUT;
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class Prefab : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int PrefabVersion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class PrefabInstance : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int TemplateVersion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 432); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 432); }
+        get { return *(int*)(Ptr + 432); }
+        set { *(int*)(Ptr + 432) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class PrefabInstance : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int PI_PackageVersion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 500); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 500); }
+        get { return *(int*)(Ptr + 500); }
+        set { *(int*)(Ptr + 500) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class PrefabInstance : BmSDK.Engine.Actor, BmSDK.IGameObject
     /// </summary>
     public unsafe int PI_LicenseePackageVersion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 504); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 504); }
+        get { return *(int*)(Ptr + 504); }
+        set { *(int*)(Ptr + 504) = value; }
     }
 
     /// <summary>
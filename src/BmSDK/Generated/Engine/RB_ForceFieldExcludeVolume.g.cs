@@ -83,7 +83,7 @@ public partial class RB_ForceFieldExcludeVolume : BmSDK.Engine.Volume, BmSDK.IGa
     /// </summary>
     public unsafe int ForceFieldChannel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 472); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 472); }
+        get { return *(int*)(Ptr + 472); }
+        set { *(int*)(Ptr + 472) = value; }
     }
 }
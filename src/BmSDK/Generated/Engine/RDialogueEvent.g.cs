@@ -78,22 +78,22 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RDialogueEvent>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetCueDurationFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetCueDuration_Params
+    {
+        [FieldOffset(0)] public float ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetCueDuration
     /// </summary>
     public unsafe virtual float GetCueDuration()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.RDialogueEvent.GetCueDuration", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<float>(paramsPtr + 0);
+        var funcManaged = s_GetCueDurationFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.RDialogueEvent.GetCueDuration", true);
+        var parms = new GetCueDuration_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUsesTTS
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 1; else *(int*)(Ptr + 64) &= ~1; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSyncFaceFX
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 2; else *(int*)(Ptr + 64) &= ~2; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool NotInDemo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 4; else *(int*)(Ptr + 64) &= ~4; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool Is2D
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 8; else *(int*)(Ptr + 64) &= ~8; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEffect_IsRadio
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 16; else *(int*)(Ptr + 64) &= ~16; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIgnoreForSurviellance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 64); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 64); }
+        get { return (*(int*)(Ptr + 64) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 64) |= 32; else *(int*)(Ptr + 64) &= ~32; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AkWwise.EDialogueHelperType DialogueEvent_Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.EDialogueHelperType>(Ptr + 68); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 68); }
+        get { return *(BmSDK.Engine.AkWwise.EDialogueHelperType*)(Ptr + 68); }
+        set { *(BmSDK.Engine.AkWwise.EDialogueHelperType*)(Ptr + 68) = value; }
     }
 
     /// <summary>
@@ -191,8 +191,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.RDialogueEvent.EPriority Priority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RDialogueEvent.EPriority>(Ptr + 69); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 69); }
+        get { return *(BmSDK.Engine.RDialogueEvent.EPriority*)(Ptr + 69); }
+        set { *(BmSDK.Engine.RDialogueEvent.EPriority*)(Ptr + 69) = value; }
     }
 
     /// <summary>
@@ -200,8 +200,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.RDialogueEvent.EPlaceHolder PlaceHolder
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RDialogueEvent.EPlaceHolder>(Ptr + 70); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 70); }
+        get { return *(BmSDK.Engine.RDialogueEvent.EPlaceHolder*)(Ptr + 70); }
+        set { *(BmSDK.Engine.RDialogueEvent.EPlaceHolder*)(Ptr + 70) = value; }
     }
 
     /// <summary>
@@ -209,8 +209,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(float*)(Ptr + 72); }
+        set { *(float*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -218,8 +218,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Duration
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -326,8 +326,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ImportRef
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(int*)(Ptr + 204); }
+        set { *(int*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -344,8 +344,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int LocDirect_Hash
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(int*)(Ptr + 220); }
+        set { *(int*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -353,8 +353,8 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ConversationID
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(int*)(Ptr + 224); }
+        set { *(int*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -366,11 +366,7 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: TagName
         /// </summary>
-        public unsafe BmSDK.FName TagName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName TagName;
 
         /// <summary>
         /// ArrayProperty: TagParams
@@ -393,11 +389,7 @@ public partial class RDialogueEvent : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: AtTime
         /// </summary>
-        public unsafe float AtTime
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 24); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 24); }; }
-        }
+        [FieldOffset(24)] public float AtTime;
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEffect_IsRadio
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ValidLine
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 2; else *(int*)(Ptr + 56) &= ~2; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool NotInDemo
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 4; else *(int*)(Ptr + 56) &= ~4; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool NoFaceFX
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 8; else *(int*)(Ptr + 56) &= ~8; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int ImportRef
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(int*)(Ptr + 72); }
+        set { *(int*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -146,8 +146,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int StringVersion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(int*)(Ptr + 76); }
+        set { *(int*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.AkWwise.EDialogueHelperType DialogueLine_Type
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AkWwise.EDialogueHelperType>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(BmSDK.Engine.AkWwise.EDialogueHelperType*)(Ptr + 80); }
+        set { *(BmSDK.Engine.AkWwise.EDialogueHelperType*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.RDialogueEvent.EPriority Priority
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RDialogueEvent.EPriority>(Ptr + 81); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 81); }
+        get { return *(BmSDK.Engine.RDialogueEvent.EPriority*)(Ptr + 81); }
+        set { *(BmSDK.Engine.RDialogueEvent.EPriority*)(Ptr + 81) = value; }
     }
 
     /// <summary>
@@ -182,8 +182,8 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NumRandomUsed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(int*)(Ptr + 96); }
+        set { *(int*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -191,7 +191,7 @@ public partial class RDialogueLine : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int LastRandomUsed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(int*)(Ptr + 100); }
+        set { *(int*)(Ptr + 100) = value; }
     }
 }
@@ -89,8 +89,8 @@ public partial class RFlaps_ConstraintSetupCollision : BmSDK.Engine.RFlaps_Const
     /// </summary>
     public unsafe float Friction
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class RFlaps_ConstraintSetupCollision : BmSDK.Engine.RFlaps_Const
     /// </summary>
     public unsafe float Restitution
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -112,63 +112,63 @@ public partial class RFlaps_ConstraintSetupCollision : BmSDK.Engine.RFlaps_Const
     /// </summary>
     public unsafe BmSDK.FName BoneNames_0
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(BmSDK.FName*)(Ptr + 88); }
+        set { *(BmSDK.FName*)(Ptr + 88) = value; }
     }
     /// <summary>
     /// NameProperty: BoneNames
     /// </summary>
     public unsafe BmSDK.FName BoneNames_1
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(BmSDK.FName*)(Ptr + 96); }
+        set { *(BmSDK.FName*)(Ptr + 96) = value; }
     }
     /// <summary>
     /// NameProperty: BoneNames
     /// </summary>
     public unsafe BmSDK.FName BoneNames_2
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(BmSDK.FName*)(Ptr + 104); }
+        set { *(BmSDK.FName*)(Ptr + 104) = value; }
     }
     /// <summary>
     /// NameProperty: BoneNames
     /// </summary>
     public unsafe BmSDK.FName BoneNames_3
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(BmSDK.FName*)(Ptr + 112); }
+        set { *(BmSDK.FName*)(Ptr + 112) = value; }
     }
     /// <summary>
     /// NameProperty: BoneNames
     /// </summary>
     public unsafe BmSDK.FName BoneNames_4
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.FName*)(Ptr + 120); }
+        set { *(BmSDK.FName*)(Ptr + 120) = value; }
     }
     /// <summary>
     /// NameProperty: BoneNames
     /// </summary>
     public unsafe BmSDK.FName BoneNames_5
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(BmSDK.FName*)(Ptr + 128); }
+        set { *(BmSDK.FName*)(Ptr + 128) = value; }
     }
     /// <summary>
     /// NameProperty: BoneNames
     /// </summary>
     public unsafe BmSDK.FName BoneNames_6
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(BmSDK.FName*)(Ptr + 136); }
+        set { *(BmSDK.FName*)(Ptr + 136) = value; }
     }
     /// <summary>
     /// NameProperty: BoneNames
     /// </summary>
     public unsafe BmSDK.FName BoneNames_7
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(BmSDK.FName*)(Ptr + 144); }
+        set { *(BmSDK.FName*)(Ptr + 144) = value; }
     }
 }
@@ -95,8 +95,8 @@ public partial class RFlaps_ConstraintSetupDistance : BmSDK.Engine.RFlaps_Constr
     /// </summary>
     public unsafe float ConstraintMinDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -104,8 +104,8 @@ public partial class RFlaps_ConstraintSetupDistance : BmSDK.Engine.RFlaps_Constr
     /// </summary>
     public unsafe float ConstraintMaxDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -113,8 +113,8 @@ public partial class RFlaps_ConstraintSetupDistance : BmSDK.Engine.RFlaps_Constr
     /// </summary>
     public unsafe float ParticleMassBias
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -122,8 +122,8 @@ public partial class RFlaps_ConstraintSetupDistance : BmSDK.Engine.RFlaps_Constr
     /// </summary>
     public unsafe bool bIncludeParticleRadiusInDistance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 1; else *(int*)(Ptr + 108) &= ~1; }
     }
 
     /// <summary>
@@ -131,8 +131,8 @@ public partial class RFlaps_ConstraintSetupDistance : BmSDK.Engine.RFlaps_Constr
     /// </summary>
     public unsafe bool bEnableMinDistance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 2; else *(int*)(Ptr + 108) &= ~2; }
     }
 
     /// <summary>
@@ -140,8 +140,8 @@ public partial class RFlaps_ConstraintSetupDistance : BmSDK.Engine.RFlaps_Constr
     /// </summary>
     public unsafe bool bEnableMaxDistance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 4; else *(int*)(Ptr + 108) &= ~4; }
     }
 
     /// <summary>
@@ -149,8 +149,8 @@ public partial class RFlaps_ConstraintSetupDistance : BmSDK.Engine.RFlaps_Constr
     /// </summary>
     public unsafe bool bManualCalculateMinDistance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 8; else *(int*)(Ptr + 108) &= ~8; }
     }
 
     /// <summary>
@@ -158,7 +158,7 @@ public partial class RFlaps_ConstraintSetupDistance : BmSDK.Engine.RFlaps_Constr
     /// </summary>
     public unsafe bool bManualCalculateMaxDistance
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 108); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 108); }
+        get { return (*(int*)(Ptr + 108) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 108) |= 16; else *(int*)(Ptr + 108) &= ~16; }
     }
 }
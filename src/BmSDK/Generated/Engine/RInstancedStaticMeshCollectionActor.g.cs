@@ -92,7 +92,7 @@ public partial class RInstancedStaticMeshCollectionActor : BmSDK.Engine.StaticMe
     /// </summary>
     public unsafe int MaxInstancedStaticMeshComponents
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(int*)(Ptr + 444); }
+        set { *(int*)(Ptr + 444) = value; }
     }
 }
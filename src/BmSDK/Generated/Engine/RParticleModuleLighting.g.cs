@@ -83,7 +83,7 @@ public partial class RParticleModuleLighting : BmSDK.Engine.ParticleModuleColorB
     /// </summary>
     public unsafe float Strength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 }
@@ -78,25 +78,28 @@ public partial class RPhysOnContactHandler : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<RPhysOnContactHandler>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_OnContactFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct OnContact_Params
+    {
+        [FieldOffset(0)] public nint BodyInst0;
+        [FieldOffset(4)] public nint BodyInst1;
+        [FieldOffset(8)] public System.Numerics.Vector3 SumNormalForce;
+        [FieldOffset(20)] public System.Numerics.Vector3 SumFrictionForce;
+    }
+
     /// <summary>
     /// Function: OnContact
     /// </summary>
     public unsafe virtual void OnContact(BmSDK.Engine.RB_BodyInstance BodyInst0, BmSDK.Engine.RB_BodyInstance BodyInst1, System.Numerics.Vector3 SumNormalForce, System.Numerics.Vector3 SumFrictionForce)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.RPhysOnContactHandler.OnContact", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BodyInst0, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(BodyInst1, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SumNormalForce, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SumFrictionForce, paramsPtr + 20);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_OnContactFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.RPhysOnContactHandler.OnContact", true);
+        var parms = new OnContact_Params();
+        parms.BodyInst0 = BodyInst0?.Ptr ?? 0;
+        parms.BodyInst1 = BodyInst1?.Ptr ?? 0;
+        parms.SumNormalForce = SumNormalForce;
+        parms.SumFrictionForce = SumFrictionForce;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -114,7 +117,7 @@ public partial class RPhysOnContactHandler : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableCapeSpam
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 48); }
+        get { return (*(int*)(Ptr + 48) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 48) |= 1; else *(int*)(Ptr + 48) &= ~1; }
     }
 }
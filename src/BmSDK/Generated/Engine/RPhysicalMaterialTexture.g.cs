@@ -92,8 +92,8 @@ public partial class RPhysicalMaterialTexture : BmSDK.GameObject, BmSDK.IGameObj
     /// </summary>
     public unsafe int SizeX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(int*)(Ptr + 48); }
+        set { *(int*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RPhysicalMaterialTexture : BmSDK.GameObject, BmSDK.IGameObj
     /// </summary>
     public unsafe int SizeY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(int*)(Ptr + 52); }
+        set { *(int*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RPhysicalMaterialTexture : BmSDK.GameObject, BmSDK.IGameObj
     /// </summary>
     public unsafe BmSDK.Engine.RPhysicalMaterialTexture.ERPMT_Encoding Encoding
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.RPhysicalMaterialTexture.ERPMT_Encoding>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(BmSDK.Engine.RPhysicalMaterialTexture.ERPMT_Encoding*)(Ptr + 56); }
+        set { *(BmSDK.Engine.RPhysicalMaterialTexture.ERPMT_Encoding*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -141,11 +141,7 @@ public partial class RPhysicalMaterialTexture : BmSDK.GameObject, BmSDK.IGameObj
         /// <summary>
         /// StructProperty: Colour
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor Colour
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FColor Colour;
 
         /// <summary>
         /// ObjectProperty: PhysMaterial
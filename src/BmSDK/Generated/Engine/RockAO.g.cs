@@ -83,8 +83,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float RSContrast
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float RSRadiusMax
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float RSRadiusMin
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(float*)(Ptr + 92); }
+        set { *(float*)(Ptr + 92) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float RSRadiusScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 96); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 96); }
+        get { return *(float*)(Ptr + 96); }
+        set { *(float*)(Ptr + 96) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float RSDepthTestRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 100); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 100); }
+        get { return *(float*)(Ptr + 100); }
+        set { *(float*)(Ptr + 100) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float RSEdgeThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 104); }
+        get { return *(float*)(Ptr + 104); }
+        set { *(float*)(Ptr + 104) = value; }
     }
 
     /// <summary>
@@ -143,8 +143,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionPower
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -152,8 +152,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 
     /// <summary>
@@ -161,8 +161,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionBias
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(float*)(Ptr + 132); }
+        set { *(float*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -170,8 +170,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinOcclusion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 136); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 136); }
+        get { return *(float*)(Ptr + 136); }
+        set { *(float*)(Ptr + 136) = value; }
     }
 
     /// <summary>
@@ -179,8 +179,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionRadius
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(float*)(Ptr + 140); }
+        set { *(float*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -188,8 +188,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionAttenuation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(float*)(Ptr + 144); }
+        set { *(float*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -197,8 +197,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionFadeoutMinDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(float*)(Ptr + 148); }
+        set { *(float*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -206,8 +206,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float OcclusionFadeoutMaxDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(float*)(Ptr + 152); }
+        set { *(float*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -215,8 +215,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float HaloDistanceThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(float*)(Ptr + 156); }
+        set { *(float*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -224,8 +224,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float HaloDistanceScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 160); }
+        get { return *(float*)(Ptr + 160); }
+        set { *(float*)(Ptr + 160) = value; }
     }
 
     /// <summary>
@@ -233,8 +233,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float HaloOcclusion
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 164); }
+        get { return *(float*)(Ptr + 164); }
+        set { *(float*)(Ptr + 164) = value; }
     }
 
     /// <summary>
@@ -242,8 +242,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float EdgeDistanceThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 168); }
+        get { return *(float*)(Ptr + 168); }
+        set { *(float*)(Ptr + 168) = value; }
     }
 
     /// <summary>
@@ -251,8 +251,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float EdgeDistanceScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 172); }
+        get { return *(float*)(Ptr + 172); }
+        set { *(float*)(Ptr + 172) = value; }
     }
 
     /// <summary>
@@ -260,8 +260,8 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe float FilterDistanceScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(float*)(Ptr + 176); }
+        set { *(float*)(Ptr + 176) = value; }
     }
 
     /// <summary>
@@ -269,7 +269,7 @@ public partial class RockAO : BmSDK.Engine.PostProcessEffect, BmSDK.IGameObject
     /// </summary>
     public unsafe int FilterSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(int*)(Ptr + 180); }
+        set { *(int*)(Ptr + 180) = value; }
     }
 }
@@ -89,8 +89,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosD1_Density_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(float*)(Ptr + 184); }
+        set { *(float*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosD1_DistanceStart_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 188); }
+        get { return *(float*)(Ptr + 188); }
+        set { *(float*)(Ptr + 188) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosD1_DistanceEnd_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+        get { return *(float*)(Ptr + 192); }
+        set { *(float*)(Ptr + 192) = value; }
     }
 
     /// <summary>
@@ -122,8 +122,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosD2_Density_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 200); }
+        get { return *(float*)(Ptr + 200); }
+        set { *(float*)(Ptr + 200) = value; }
     }
 
     /// <summary>
@@ -131,8 +131,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosD2_DistanceStart_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(float*)(Ptr + 204); }
+        set { *(float*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -140,8 +140,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosD2_DistanceEnd_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(float*)(Ptr + 208); }
+        set { *(float*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -155,8 +155,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosH1_Density_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(float*)(Ptr + 216); }
+        set { *(float*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -164,8 +164,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosH1_GradientSize_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(float*)(Ptr + 220); }
+        set { *(float*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -173,8 +173,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosH1_GradientPosition_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(float*)(Ptr + 224); }
+        set { *(float*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -188,8 +188,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosH2_Density_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(float*)(Ptr + 232); }
+        set { *(float*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -197,8 +197,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosH2_GradientSize_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(float*)(Ptr + 236); }
+        set { *(float*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -206,8 +206,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosH2_GradientPosition_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(float*)(Ptr + 240); }
+        set { *(float*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -233,8 +233,8 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosGlobal_Gradient_Density_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(float*)(Ptr + 272); }
+        set { *(float*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -248,7 +248,7 @@ public partial class RockAtmos : BmSDK.Engine.DOFBloomMotionBlurEffect, BmSDK.IG
     /// </summary>
     public unsafe float AtmosNoiseFade_PP
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 288); }
+        get { return *(float*)(Ptr + 288); }
+        set { *(float*)(Ptr + 288) = value; }
     }
 }
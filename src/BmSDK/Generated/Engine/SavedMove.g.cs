@@ -78,17 +78,36 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<SavedMove>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetFlagsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct SetFlags_Params
+    {
+        [FieldOffset(0)] public byte Flags;
+        [FieldOffset(4)] public nint PC;
+        [FieldOffset(8)] public BmSDK.Engine.Actor.EDoubleClickDir ReturnValue;
+    }
+
     /// <summary>
     /// Function: SetFlags
     /// </summary>
     public unsafe static BmSDK.Engine.Actor.EDoubleClickDir SetFlags(byte Flags, BmSDK.Engine.PlayerController PC)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.SavedMove.SetFlags", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Flags, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PC, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EDoubleClickDir>(paramsPtr + 8);
+        var funcManaged = s_SetFlagsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.SavedMove.SetFlags", true);
+        var parms = new SetFlags_Params();
+        parms.Flags = Flags;
+        parms.PC = PC?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_CanCombineWithFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct CanCombineWith_Params
+    {
+        [FieldOffset(0)] public nint NewMove;
+        [FieldOffset(4)] public nint inPawn;
+        [FieldOffset(8)] public float MaxDelta;
+        [FieldOffset(12)] public int ReturnValue;
     }
 
     /// <summary>
@@ -96,13 +115,19 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool CanCombineWith(BmSDK.Engine.SavedMove NewMove, BmSDK.Engine.Pawn inPawn, float MaxDelta)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.SavedMove.CanCombineWith", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewMove, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(inPawn, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(MaxDelta, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_CanCombineWithFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.SavedMove.CanCombineWith", true);
+        var parms = new CanCombineWith_Params();
+        parms.NewMove = NewMove?.Ptr ?? 0;
+        parms.inPawn = inPawn?.Ptr ?? 0;
+        parms.MaxDelta = MaxDelta;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ClearFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Clear_Params
+    {
     }
 
     /// <summary>
@@ -110,9 +135,9 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void Clear()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.SavedMove.Clear", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.SavedMove.Clear", true);
+        var parms = new Clear_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -130,8 +155,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float TimeStamp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(float*)(Ptr + 48); }
+        set { *(float*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -139,8 +164,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float Delta
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 52); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 52); }
+        get { return *(float*)(Ptr + 52); }
+        set { *(float*)(Ptr + 52) = value; }
     }
 
     /// <summary>
@@ -148,8 +173,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRun
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 1; else *(int*)(Ptr + 56) &= ~1; }
     }
 
     /// <summary>
@@ -157,8 +182,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDuck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 2; else *(int*)(Ptr + 56) &= ~2; }
     }
 
     /// <summary>
@@ -166,8 +191,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bPressedJump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 4; else *(int*)(Ptr + 56) &= ~4; }
     }
 
     /// <summary>
@@ -175,8 +200,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDoubleJump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 8; else *(int*)(Ptr + 56) &= ~8; }
     }
 
     /// <summary>
@@ -184,8 +209,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bPreciseDestination
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 16; else *(int*)(Ptr + 56) &= ~16; }
     }
 
     /// <summary>
@@ -193,8 +218,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceRMVelocity
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 32; else *(int*)(Ptr + 56) &= ~32; }
     }
 
     /// <summary>
@@ -202,8 +227,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceMaxAccel
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 64; else *(int*)(Ptr + 56) &= ~64; }
     }
 
     /// <summary>
@@ -211,8 +236,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRootMotionFromInterpCurve
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 56); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 56); }
+        get { return (*(int*)(Ptr + 56) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 56) |= 128; else *(int*)(Ptr + 56) &= ~128; }
     }
 
     /// <summary>
@@ -220,8 +245,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.Actor.EDoubleClickDir DoubleClickMove
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EDoubleClickDir>(Ptr + 60); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 60); }
+        get { return *(BmSDK.Engine.Actor.EDoubleClickDir*)(Ptr + 60); }
+        set { *(BmSDK.Engine.Actor.EDoubleClickDir*)(Ptr + 60) = value; }
     }
 
     /// <summary>
@@ -229,8 +254,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.Actor.EPhysics SavedPhysics
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EPhysics>(Ptr + 61); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 61); }
+        get { return *(BmSDK.Engine.Actor.EPhysics*)(Ptr + 61); }
+        set { *(BmSDK.Engine.Actor.EPhysics*)(Ptr + 61) = value; }
     }
 
     /// <summary>
@@ -238,8 +263,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.SkeletalMeshComponent.ERootMotionMode RootMotionMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.SkeletalMeshComponent.ERootMotionMode>(Ptr + 62); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 62); }
+        get { return *(BmSDK.Engine.SkeletalMeshComponent.ERootMotionMode*)(Ptr + 62); }
+        set { *(BmSDK.Engine.SkeletalMeshComponent.ERootMotionMode*)(Ptr + 62) = value; }
     }
 
     /// <summary>
@@ -325,8 +350,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float CustomTimeDilation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+        get { return *(float*)(Ptr + 192); }
+        set { *(float*)(Ptr + 192) = value; }
     }
 
     /// <summary>
@@ -334,8 +359,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float AccelDotThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 196); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 196); }
+        get { return *(float*)(Ptr + 196); }
+        set { *(float*)(Ptr + 196) = value; }
     }
 
     /// <summary>
@@ -343,8 +368,8 @@ public partial class SavedMove : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float RootMotionInterpCurrentTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 200); }
+        get { return *(float*)(Ptr + 200); }
+        set { *(float*)(Ptr + 200) = value; }
     }
 
     /// <summary>
@@ -78,24 +78,26 @@ public partial class SceneCapturePortalComponent : BmSDK.Engine.SceneCaptureComp
         where TComponent : class, Framework.IScriptComponent<SceneCapturePortalComponent>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_SetCaptureParametersFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetCaptureParameters_Params
+    {
+        [FieldOffset(0)] public nint NewTextureTarget;
+        [FieldOffset(4)] public float NewScaleFOV;
+        [FieldOffset(8)] public nint NewViewDest;
+    }
+
     /// <summary>
     /// Function: SetCaptureParameters
     /// </summary>
     public unsafe virtual void SetCaptureParameters(BmSDK.Engine.TextureRenderTarget2D NewTextureTarget = default, float NewScaleFOV = default, BmSDK.Engine.Actor NewViewDest = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.SceneCapturePortalComponent.SetCaptureParameters", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewTextureTarget, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewScaleFOV, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(NewViewDest, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetCaptureParametersFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.SceneCapturePortalComponent.SetCaptureParameters", true);
+        var parms = new SetCaptureParameters_Params();
+        parms.NewTextureTarget = NewTextureTarget?.Ptr ?? 0;
+        parms.NewScaleFOV = NewScaleFOV;
+        parms.NewViewDest = NewViewDest?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -113,8 +115,8 @@ public partial class SceneCapturePortalComponent : BmSDK.Engine.SceneCaptureComp
     /// </summary>
     public unsafe float ScaleFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(float*)(Ptr + 144); }
+        set { *(float*)(Ptr + 144) = value; }
     }
 
     /// <summary>
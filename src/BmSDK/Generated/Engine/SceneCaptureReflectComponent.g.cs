@@ -92,8 +92,8 @@ public partial class SceneCaptureReflectComponent : BmSDK.Engine.SceneCaptureCom
     /// </summary>
     public unsafe float ScaleFOV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(float*)(Ptr + 144); }
+        set { *(float*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SceneCaptureReflectComponent : BmSDK.Engine.SceneCaptureCom
     /// </summary>
     public unsafe float FarClip
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(float*)(Ptr + 148); }
+        set { *(float*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class SceneCaptureReflectComponent : BmSDK.Engine.SceneCaptureCom
     /// </summary>
     public unsafe bool bOnlyShowReflectionObjects
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }
+        get { return (*(int*)(Ptr + 152) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 152) |= 1; else *(int*)(Ptr + 152) &= ~1; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class SceneCaptureReflectComponent : BmSDK.Engine.SceneCaptureCom
     /// </summary>
     public unsafe bool bIsViewReflect
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }
+        get { return (*(int*)(Ptr + 152) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 152) |= 2; else *(int*)(Ptr + 152) &= ~2; }
     }
 
     /// <summary>
@@ -128,7 +128,7 @@ public partial class SceneCaptureReflectComponent : BmSDK.Engine.SceneCaptureCom
     /// </summary>
     public unsafe bool bEnableCapeDepthBiasHack
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 152); }
+        get { return (*(int*)(Ptr + 152) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 152) |= 4; else *(int*)(Ptr + 152) &= ~4; }
     }
 }
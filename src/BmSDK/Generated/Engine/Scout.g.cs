@@ -78,14 +78,20 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<Scout>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_PreBeginPlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct PreBeginPlay_Params
+    {
+    }
+
     /// <summary>
     /// Function: PreBeginPlay
     /// </summary>
     public unsafe override void PreBeginPlay()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Scout.PreBeginPlay", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PreBeginPlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Scout.PreBeginPlay", true);
+        var parms = new PreBeginPlay_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -103,8 +109,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float TestJumpZ
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1104); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1104); }
+        get { return *(float*)(Ptr + 1104); }
+        set { *(float*)(Ptr + 1104) = value; }
     }
 
     /// <summary>
@@ -112,8 +118,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float TestGroundSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1108); }
+        get { return *(float*)(Ptr + 1108); }
+        set { *(float*)(Ptr + 1108) = value; }
     }
 
     /// <summary>
@@ -121,8 +127,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float TestMaxFallSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1112); }
+        get { return *(float*)(Ptr + 1112); }
+        set { *(float*)(Ptr + 1112) = value; }
     }
 
     /// <summary>
@@ -130,8 +136,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float TestFallSpeed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1116); }
+        get { return *(float*)(Ptr + 1116); }
+        set { *(float*)(Ptr + 1116) = value; }
     }
 
     /// <summary>
@@ -139,8 +145,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxLandingVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1120); }
+        get { return *(float*)(Ptr + 1120); }
+        set { *(float*)(Ptr + 1120) = value; }
     }
 
     /// <summary>
@@ -148,8 +154,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe int MinNumPlayerStarts
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1124); }
+        get { return *(int*)(Ptr + 1124); }
+        set { *(int*)(Ptr + 1124) = value; }
     }
 
     /// <summary>
@@ -175,8 +181,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_StepSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1144); }
+        get { return *(float*)(Ptr + 1144); }
+        set { *(float*)(Ptr + 1144) = value; }
     }
 
     /// <summary>
@@ -184,8 +190,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_EntityHalfHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1148); }
+        get { return *(float*)(Ptr + 1148); }
+        set { *(float*)(Ptr + 1148) = value; }
     }
 
     /// <summary>
@@ -193,8 +199,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_StartingHeightOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1152); }
+        get { return *(float*)(Ptr + 1152); }
+        set { *(float*)(Ptr + 1152) = value; }
     }
 
     /// <summary>
@@ -202,8 +208,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MaxDropHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1156); }
+        get { return *(float*)(Ptr + 1156); }
+        set { *(float*)(Ptr + 1156) = value; }
     }
 
     /// <summary>
@@ -211,8 +217,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MaxStepHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1160); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1160); }
+        get { return *(float*)(Ptr + 1160); }
+        set { *(float*)(Ptr + 1160) = value; }
     }
 
     /// <summary>
@@ -220,8 +226,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_VertZDeltaSnapThresh
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1164); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1164); }
+        get { return *(float*)(Ptr + 1164); }
+        set { *(float*)(Ptr + 1164) = value; }
     }
 
     /// <summary>
@@ -229,8 +235,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MinPolyArea
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1168); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1168); }
+        get { return *(float*)(Ptr + 1168); }
+        set { *(float*)(Ptr + 1168) = value; }
     }
 
     /// <summary>
@@ -238,8 +244,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_BorderBackfill_CheckDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1172); }
+        get { return *(float*)(Ptr + 1172); }
+        set { *(float*)(Ptr + 1172) = value; }
     }
 
     /// <summary>
@@ -247,8 +253,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MinMergeDotAreaThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1176); }
+        get { return *(float*)(Ptr + 1176); }
+        set { *(float*)(Ptr + 1176) = value; }
     }
 
     /// <summary>
@@ -256,8 +262,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MinMergeDotSmallArea
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1180); }
+        get { return *(float*)(Ptr + 1180); }
+        set { *(float*)(Ptr + 1180) = value; }
     }
 
     /// <summary>
@@ -265,8 +271,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MinMergeDotLargeArea
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1184); }
+        get { return *(float*)(Ptr + 1184); }
+        set { *(float*)(Ptr + 1184) = value; }
     }
 
     /// <summary>
@@ -274,8 +280,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MaxPolyHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1188); }
+        get { return *(float*)(Ptr + 1188); }
+        set { *(float*)(Ptr + 1188) = value; }
     }
 
     /// <summary>
@@ -283,8 +289,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MaxPolyBuildHeight
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1192); }
+        get { return *(float*)(Ptr + 1192); }
+        set { *(float*)(Ptr + 1192) = value; }
     }
 
     /// <summary>
@@ -292,8 +298,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_HeightMergeThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1196); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1196); }
+        get { return *(float*)(Ptr + 1196); }
+        set { *(float*)(Ptr + 1196) = value; }
     }
 
     /// <summary>
@@ -301,8 +307,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_EdgeMaxDelta
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1200); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1200); }
+        get { return *(float*)(Ptr + 1200); }
+        set { *(float*)(Ptr + 1200) = value; }
     }
 
     /// <summary>
@@ -310,8 +316,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MaxGroundCheckSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1204); }
+        get { return *(float*)(Ptr + 1204); }
+        set { *(float*)(Ptr + 1204) = value; }
     }
 
     /// <summary>
@@ -319,8 +325,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float NavMeshGen_MinEdgeLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1208); }
+        get { return *(float*)(Ptr + 1208); }
+        set { *(float*)(Ptr + 1208) = value; }
     }
 
     /// <summary>
@@ -328,8 +334,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe bool NavMeshGen_ExpansionDoObstacleMeshSimplification
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1212) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1212); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1212); }
+        get { return (*(int*)(Ptr + 1212) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 1212) |= 1; else *(int*)(Ptr + 1212) &= ~1; }
     }
 
     /// <summary>
@@ -337,8 +343,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHightlightOneWayReachSpecs
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1212) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1212); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 1212); }
+        get { return (*(int*)(Ptr + 1212) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 1212) |= 2; else *(int*)(Ptr + 1212) &= ~2; }
     }
 
     /// <summary>
@@ -346,8 +352,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinMantleFallDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1216); }
+        get { return *(float*)(Ptr + 1216); }
+        set { *(float*)(Ptr + 1216) = value; }
     }
 
     /// <summary>
@@ -355,8 +361,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxMantleFallDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1220); }
+        get { return *(float*)(Ptr + 1220); }
+        set { *(float*)(Ptr + 1220) = value; }
     }
 
     /// <summary>
@@ -364,8 +370,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinMantleLateralDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1224); }
+        get { return *(float*)(Ptr + 1224); }
+        set { *(float*)(Ptr + 1224) = value; }
     }
 
     /// <summary>
@@ -373,8 +379,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxMantleLateralDist
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1228); }
+        get { return *(float*)(Ptr + 1228); }
+        set { *(float*)(Ptr + 1228) = value; }
     }
 
     /// <summary>
@@ -382,8 +388,8 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxMantleFallTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1232); }
+        get { return *(float*)(Ptr + 1232); }
+        set { *(float*)(Ptr + 1232) = value; }
     }
 
     /// <summary>
@@ -395,46 +401,26 @@ public partial class Scout : BmSDK.Engine.Pawn, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: Desc
         /// </summary>
-        public unsafe BmSDK.FName Desc
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName Desc;
 
         /// <summary>
         /// FloatProperty: Radius
         /// </summary>
-        public unsafe float Radius
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public float Radius;
 
         /// <summary>
         /// FloatProperty: Height
         /// </summary>
-        public unsafe float Height
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public float Height;
 
         /// <summary>
         /// FloatProperty: CrouchHeight
         /// </summary>
-        public unsafe float CrouchHeight
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 16); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 16); }; }
-        }
+        [FieldOffset(16)] public float CrouchHeight;
 
         /// <summary>
         /// ByteProperty: PathColor
         /// </summary>
-        public unsafe byte PathColor
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<byte>(Ptr + 20); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 20); }; }
-        }
+        [FieldOffset(20)] public byte PathColor;
     }
 }
@@ -92,7 +92,7 @@ public partial class SeqAct_AccessObjectList : BmSDK.Engine.SeqAct_SetSequenceVa
     /// </summary>
     public unsafe int ObjectIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(int*)(Ptr + 208); }
+        set { *(int*)(Ptr + 208) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class SeqAct_AddFloat : BmSDK.Engine.SeqAct_SetSequenceVariable,
     /// </summary>
     public unsafe float ValueA
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(float*)(Ptr + 204); }
+        set { *(float*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class SeqAct_AddFloat : BmSDK.Engine.SeqAct_SetSequenceVariable,
     /// </summary>
     public unsafe float ValueB
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(float*)(Ptr + 208); }
+        set { *(float*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SeqAct_AddFloat : BmSDK.Engine.SeqAct_SetSequenceVariable,
     /// </summary>
     public unsafe float FloatResult
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(float*)(Ptr + 212); }
+        set { *(float*)(Ptr + 212) = value; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class SeqAct_AddFloat : BmSDK.Engine.SeqAct_SetSequenceVariable,
     /// </summary>
     public unsafe int IntResult
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(int*)(Ptr + 216); }
+        set { *(int*)(Ptr + 216) = value; }
     }
 }
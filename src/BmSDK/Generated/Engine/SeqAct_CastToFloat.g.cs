@@ -83,8 +83,8 @@ public partial class SeqAct_CastToFloat : BmSDK.Engine.SeqAct_SetSequenceVariabl
     /// </summary>
     public unsafe int Value
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(int*)(Ptr + 204); }
+        set { *(int*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class SeqAct_CastToFloat : BmSDK.Engine.SeqAct_SetSequenceVariabl
     /// </summary>
     public unsafe float FloatResult
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(float*)(Ptr + 208); }
+        set { *(float*)(Ptr + 208) = value; }
     }
 }
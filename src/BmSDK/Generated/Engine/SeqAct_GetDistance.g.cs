@@ -83,7 +83,7 @@ public partial class SeqAct_GetDistance : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe float Distance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(float*)(Ptr + 204); }
+        set { *(float*)(Ptr + 204) = value; }
     }
 }
@@ -83,7 +83,7 @@ public partial class SeqAct_GetProperty : BmSDK.Engine.SequenceAction, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.FName PropertyName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.FName*)(Ptr + 204); }
+        set { *(BmSDK.FName*)(Ptr + 204) = value; }
     }
 }
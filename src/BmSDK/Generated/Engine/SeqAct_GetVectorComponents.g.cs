@@ -89,8 +89,8 @@ public partial class SeqAct_GetVectorComponents : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float X
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 216); }
+        get { return *(float*)(Ptr + 216); }
+        set { *(float*)(Ptr + 216) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class SeqAct_GetVectorComponents : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float Y
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(float*)(Ptr + 220); }
+        set { *(float*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -107,7 +107,7 @@ public partial class SeqAct_GetVectorComponents : BmSDK.Engine.SequenceAction, B
     /// </summary>
     public unsafe float Z
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(float*)(Ptr + 224); }
+        set { *(float*)(Ptr + 224) = value; }
     }
 }
@@ -92,8 +92,8 @@ public partial class SeqAct_GiveInventory : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe bool bClearExisting
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 1; else *(int*)(Ptr + 216) &= ~1; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SeqAct_GiveInventory : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe bool bAutoEquip
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 2; else *(int*)(Ptr + 216) &= ~2; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class SeqAct_GiveInventory : BmSDK.Engine.SequenceAction, BmSDK.I
     /// </summary>
     public unsafe bool bForceReplace
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 4; else *(int*)(Ptr + 216) &= ~4; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class SeqAct_LevelStreaming : BmSDK.Engine.SeqAct_LevelStreamingB
     /// </summary>
     public unsafe BmSDK.FName LevelName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(BmSDK.FName*)(Ptr + 228); }
+        set { *(BmSDK.FName*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -110,7 +110,7 @@ public partial class SeqAct_LevelStreaming : BmSDK.Engine.SeqAct_LevelStreamingB
     /// </summary>
     public unsafe bool bStatusIsOk
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 248) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 248); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 248); }
+        get { return (*(int*)(Ptr + 248) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 248) |= 1; else *(int*)(Ptr + 248) &= ~1; }
     }
 }
@@ -83,7 +83,7 @@ public partial class SeqAct_ModifyObjectList : BmSDK.Engine.SeqAct_SetSequenceVa
     /// </summary>
     public unsafe int ListEntriesCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(int*)(Ptr + 204); }
+        set { *(int*)(Ptr + 204) = value; }
     }
 }
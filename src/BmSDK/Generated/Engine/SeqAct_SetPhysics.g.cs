@@ -83,8 +83,8 @@ public partial class SeqAct_SetPhysics : BmSDK.Engine.SequenceAction, BmSDK.IGam
     /// </summary>
     public unsafe BmSDK.Engine.Actor.EPhysics newPhysics
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Actor.EPhysics>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.Engine.Actor.EPhysics*)(Ptr + 204); }
+        set { *(BmSDK.Engine.Actor.EPhysics*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class SeqAct_SetPhysics : BmSDK.Engine.SequenceAction, BmSDK.IGam
     /// </summary>
     public unsafe bool bWakePhysics
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 208); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 208); }
+        get { return (*(int*)(Ptr + 208) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 208) |= 1; else *(int*)(Ptr + 208) &= ~1; }
     }
 }
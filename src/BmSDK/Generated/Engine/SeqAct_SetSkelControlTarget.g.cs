@@ -83,8 +83,8 @@ public partial class SeqAct_SetSkelControlTarget : BmSDK.Engine.SequenceAction,
     /// </summary>
     public unsafe BmSDK.FName SkelControlName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 204); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 204); }
+        get { return *(BmSDK.FName*)(Ptr + 204); }
+        set { *(BmSDK.FName*)(Ptr + 204) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class SeqCond_CompareInt : BmSDK.Engine.SequenceCondition, BmSDK.
     /// </summary>
     public unsafe int ValueA
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(int*)(Ptr + 180); }
+        set { *(int*)(Ptr + 180) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class SeqCond_CompareInt : BmSDK.Engine.SequenceCondition, BmSDK.
     /// </summary>
     public unsafe int ValueB
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(int*)(Ptr + 184); }
+        set { *(int*)(Ptr + 184) = value; }
     }
 }
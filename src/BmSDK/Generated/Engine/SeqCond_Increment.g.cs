@@ -83,8 +83,8 @@ public partial class SeqCond_Increment : BmSDK.Engine.SequenceCondition, BmSDK.I
     /// </summary>
     public unsafe int IncrementAmount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(int*)(Ptr + 180); }
+        set { *(int*)(Ptr + 180) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class SeqCond_Increment : BmSDK.Engine.SequenceCondition, BmSDK.I
     /// </summary>
     public unsafe int ValueA
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(int*)(Ptr + 184); }
+        set { *(int*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class SeqCond_Increment : BmSDK.Engine.SequenceCondition, BmSDK.I
     /// </summary>
     public unsafe int ValueB
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 188); }
+        get { return *(int*)(Ptr + 188); }
+        set { *(int*)(Ptr + 188) = value; }
     }
 }
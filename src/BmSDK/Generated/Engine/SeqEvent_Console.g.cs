@@ -83,8 +83,8 @@ public partial class SeqEvent_Console : BmSDK.Engine.SequenceEvent, BmSDK.IGameO
     /// </summary>
     public unsafe BmSDK.FName ConsoleEventName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(BmSDK.FName*)(Ptr + 228); }
+        set { *(BmSDK.FName*)(Ptr + 228) = value; }
     }
 
     /// <summary>
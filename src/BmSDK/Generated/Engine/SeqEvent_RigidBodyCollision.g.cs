@@ -83,7 +83,7 @@ public partial class SeqEvent_RigidBodyCollision : BmSDK.Engine.SequenceEvent, B
     /// </summary>
     public unsafe float MinCollisionVelocity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 }
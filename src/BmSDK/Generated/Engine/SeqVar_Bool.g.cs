@@ -83,7 +83,7 @@ public partial class SeqVar_Bool : BmSDK.Engine.SequenceVariable, BmSDK.IGameObj
     /// </summary>
     public unsafe int bValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(int*)(Ptr + 128); }
+        set { *(int*)(Ptr + 128) = value; }
     }
 }
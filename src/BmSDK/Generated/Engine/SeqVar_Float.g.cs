@@ -83,7 +83,7 @@ public partial class SeqVar_Float : BmSDK.Engine.SequenceVariable, BmSDK.IGameOb
     /// </summary>
     public unsafe float FloatValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 }
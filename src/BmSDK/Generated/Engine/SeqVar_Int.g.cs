@@ -83,7 +83,7 @@ public partial class SeqVar_Int : BmSDK.Engine.SequenceVariable, BmSDK.IGameObje
     /// </summary>
     public unsafe int IntValue
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(int*)(Ptr + 128); }
+        set { *(int*)(Ptr + 128) = value; }
     }
 }
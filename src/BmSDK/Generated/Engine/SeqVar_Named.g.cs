@@ -92,8 +92,8 @@ public partial class SeqVar_Named : BmSDK.Engine.SequenceVariable, BmSDK.IGameOb
     /// </summary>
     public unsafe BmSDK.FName FindVarName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 132); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 132); }
+        get { return *(BmSDK.FName*)(Ptr + 132); }
+        set { *(BmSDK.FName*)(Ptr + 132) = value; }
     }
 
     /// <summary>
@@ -101,7 +101,7 @@ public partial class SeqVar_Named : BmSDK.Engine.SequenceVariable, BmSDK.IGameOb
     /// </summary>
     public unsafe bool bStatusIsOk
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 140); }
+        get { return (*(int*)(Ptr + 140) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 140) |= 1; else *(int*)(Ptr + 140) &= ~1; }
     }
 }
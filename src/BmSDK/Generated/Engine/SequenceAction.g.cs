@@ -78,8 +78,8 @@ public partial class SequenceAction : BmSDK.Engine.SequenceOp, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName HandlerName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(BmSDK.FName*)(Ptr + 180); }
+        set { *(BmSDK.FName*)(Ptr + 180) = value; }
     }
 
     /// <summary>
@@ -87,8 +87,8 @@ public partial class SequenceAction : BmSDK.Engine.SequenceOp, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCallHandler
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 188); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 188); }
+        get { return (*(int*)(Ptr + 188) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 188) |= 1; else *(int*)(Ptr + 188) &= ~1; }
     }
 
     /// <summary>
@@ -78,7 +78,7 @@ public partial class SequenceVariable : BmSDK.Engine.SequenceObject, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName VarName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(BmSDK.FName*)(Ptr + 120); }
+        set { *(BmSDK.FName*)(Ptr + 120) = value; }
     }
 }
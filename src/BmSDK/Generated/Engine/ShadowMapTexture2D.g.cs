@@ -83,7 +83,7 @@ public partial class ShadowMapTexture2D : BmSDK.Engine.Texture2D, BmSDK.IGameObj
     /// </summary>
     public unsafe int ShadowmapFlags
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 328); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 328); }
+        get { return *(int*)(Ptr + 328); }
+        set { *(int*)(Ptr + 328) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class SkelControlFootPlacement : BmSDK.Engine.SkelControlLimb, Bm
     /// </summary>
     public unsafe float FootOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(float*)(Ptr + 236); }
+        set { *(float*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class SkelControlFootPlacement : BmSDK.Engine.SkelControlLimb, Bm
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis FootUpAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 240); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class SkelControlFootPlacement : BmSDK.Engine.SkelControlLimb, Bm
     /// </summary>
     public unsafe bool bInvertFootUpAxis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 256); }
+        get { return (*(int*)(Ptr + 256) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 256) |= 1; else *(int*)(Ptr + 256) &= ~1; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class SkelControlFootPlacement : BmSDK.Engine.SkelControlLimb, Bm
     /// </summary>
     public unsafe bool bOrientFootToGround
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 256); }
+        get { return (*(int*)(Ptr + 256) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 256) |= 2; else *(int*)(Ptr + 256) &= ~2; }
     }
 
     /// <summary>
@@ -125,8 +125,8 @@ public partial class SkelControlFootPlacement : BmSDK.Engine.SkelControlLimb, Bm
     /// </summary>
     public unsafe bool bOnlyEnableForUpAdjustment
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 256); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 256); }
+        get { return (*(int*)(Ptr + 256) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 256) |= 4; else *(int*)(Ptr + 256) &= ~4; }
     }
 
     /// <summary>
@@ -134,8 +134,8 @@ public partial class SkelControlFootPlacement : BmSDK.Engine.SkelControlLimb, Bm
     /// </summary>
     public unsafe float MaxUpAdjustment
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(float*)(Ptr + 260); }
+        set { *(float*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -143,8 +143,8 @@ public partial class SkelControlFootPlacement : BmSDK.Engine.SkelControlLimb, Bm
     /// </summary>
     public unsafe float MaxDownAdjustment
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 264); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 264); }
+        get { return *(float*)(Ptr + 264); }
+        set { *(float*)(Ptr + 264) = value; }
     }
 
     /// <summary>
@@ -152,7 +152,7 @@ public partial class SkelControlFootPlacement : BmSDK.Engine.SkelControlLimb, Bm
     /// </summary>
     public unsafe float MaxFootOrientAdjust
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 268); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 268); }
+        get { return *(float*)(Ptr + 268); }
+        set { *(float*)(Ptr + 268) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class SkelControlHandlebars : BmSDK.Engine.SkelControlSingleBone,
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis WheelRollAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 220); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class SkelControlHandlebars : BmSDK.Engine.SkelControlSingleBone,
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis HandlebarRotateAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 221); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 221); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 221); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 221) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SkelControlHandlebars : BmSDK.Engine.SkelControlSingleBone,
     /// </summary>
     public unsafe BmSDK.FName WheelBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(BmSDK.FName*)(Ptr + 224); }
+        set { *(BmSDK.FName*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class SkelControlHandlebars : BmSDK.Engine.SkelControlSingleBone,
     /// </summary>
     public unsafe bool bInvertRotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 232) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 232); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 232); }
+        get { return (*(int*)(Ptr + 232) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 232) |= 1; else *(int*)(Ptr + 232) &= ~1; }
     }
 
     /// <summary>
@@ -119,7 +119,7 @@ public partial class SkelControlHandlebars : BmSDK.Engine.SkelControlSingleBone,
     /// </summary>
     public unsafe int SteerWheelBoneIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(int*)(Ptr + 236); }
+        set { *(int*)(Ptr + 236) = value; }
     }
 }
@@ -89,8 +89,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.Engine.SkelControlBase.EBoneControlSpace EffectorLocationSpace
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.SkelControlBase.EBoneControlSpace>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(BmSDK.Engine.SkelControlBase.EBoneControlSpace*)(Ptr + 184); }
+        set { *(BmSDK.Engine.SkelControlBase.EBoneControlSpace*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -98,8 +98,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.Engine.SkelControlBase.EBoneControlSpace JointTargetLocationSpace
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.SkelControlBase.EBoneControlSpace>(Ptr + 185); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 185); }
+        get { return *(BmSDK.Engine.SkelControlBase.EBoneControlSpace*)(Ptr + 185); }
+        set { *(BmSDK.Engine.SkelControlBase.EBoneControlSpace*)(Ptr + 185) = value; }
     }
 
     /// <summary>
@@ -107,8 +107,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis BoneAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 186); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 186); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 186); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 186) = value; }
     }
 
     /// <summary>
@@ -116,8 +116,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis JointAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 187); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 187); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 187); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 187) = value; }
     }
 
     /// <summary>
@@ -125,8 +125,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName EffectorSpaceBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 188); }
+        get { return *(BmSDK.FName*)(Ptr + 188); }
+        set { *(BmSDK.FName*)(Ptr + 188) = value; }
     }
 
     /// <summary>
@@ -140,8 +140,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName JointTargetSpaceBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 208); }
+        get { return *(BmSDK.FName*)(Ptr + 208); }
+        set { *(BmSDK.FName*)(Ptr + 208) = value; }
     }
 
     /// <summary>
@@ -149,8 +149,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe bool bInvertBoneAxis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 1; else *(int*)(Ptr + 216) &= ~1; }
     }
 
     /// <summary>
@@ -158,8 +158,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe bool bInvertJointAxis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 2; else *(int*)(Ptr + 216) &= ~2; }
     }
 
     /// <summary>
@@ -167,8 +167,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe bool bRotateJoint
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 4; else *(int*)(Ptr + 216) &= ~4; }
     }
 
     /// <summary>
@@ -176,8 +176,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe bool bMaintainEffectorRelRot
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 8; else *(int*)(Ptr + 216) &= ~8; }
     }
 
     /// <summary>
@@ -185,8 +185,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe bool bTakeRotationFromEffectorSpace
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 16; else *(int*)(Ptr + 216) &= ~16; }
     }
 
     /// <summary>
@@ -194,8 +194,8 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe bool bAllowStretching
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 216); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 216); }
+        get { return (*(int*)(Ptr + 216) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 216) |= 32; else *(int*)(Ptr + 216) &= ~32; }
     }
 
     /// <summary>
@@ -209,7 +209,7 @@ public partial class SkelControlLimb : BmSDK.Engine.SkelControlBase, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName StretchRollBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(BmSDK.FName*)(Ptr + 228); }
+        set { *(BmSDK.FName*)(Ptr + 228) = value; }
     }
 }
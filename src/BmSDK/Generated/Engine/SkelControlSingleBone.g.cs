@@ -83,8 +83,8 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe bool bApplyTranslation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 172); }
+        get { return (*(int*)(Ptr + 172) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 172) |= 1; else *(int*)(Ptr + 172) &= ~1; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe bool bApplyRotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 172); }
+        get { return (*(int*)(Ptr + 172) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 172) |= 2; else *(int*)(Ptr + 172) &= ~2; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe bool bAddTranslation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 172); }
+        get { return (*(int*)(Ptr + 172) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 172) |= 4; else *(int*)(Ptr + 172) &= ~4; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe bool bAddRotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 172); }
+        get { return (*(int*)(Ptr + 172) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 172) |= 8; else *(int*)(Ptr + 172) &= ~8; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe bool bRemoveMeshRotation
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 172); }
+        get { return (*(int*)(Ptr + 172) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 172) |= 16; else *(int*)(Ptr + 172) &= ~16; }
     }
 
     /// <summary>
@@ -134,8 +134,8 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe BmSDK.Engine.SkelControlBase.EBoneControlSpace BoneTranslationSpace
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.SkelControlBase.EBoneControlSpace>(Ptr + 188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 188); }
+        get { return *(BmSDK.Engine.SkelControlBase.EBoneControlSpace*)(Ptr + 188); }
+        set { *(BmSDK.Engine.SkelControlBase.EBoneControlSpace*)(Ptr + 188) = value; }
     }
 
     /// <summary>
@@ -143,8 +143,8 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe BmSDK.Engine.SkelControlBase.EBoneControlSpace BoneRotationSpace
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.SkelControlBase.EBoneControlSpace>(Ptr + 189); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 189); }
+        get { return *(BmSDK.Engine.SkelControlBase.EBoneControlSpace*)(Ptr + 189); }
+        set { *(BmSDK.Engine.SkelControlBase.EBoneControlSpace*)(Ptr + 189) = value; }
     }
 
     /// <summary>
@@ -152,8 +152,8 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe BmSDK.FName TranslationSpaceBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 192); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 192); }
+        get { return *(BmSDK.FName*)(Ptr + 192); }
+        set { *(BmSDK.FName*)(Ptr + 192) = value; }
     }
 
     /// <summary>
@@ -167,7 +167,7 @@ public partial class SkelControlSingleBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe BmSDK.FName RotationSpaceBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 212); }
+        get { return *(BmSDK.FName*)(Ptr + 212); }
+        set { *(BmSDK.FName*)(Ptr + 212) = value; }
     }
 }
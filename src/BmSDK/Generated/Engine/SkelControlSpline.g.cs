@@ -94,8 +94,8 @@ public partial class SkelControlSpline : BmSDK.Engine.SkelControlBase, BmSDK.IGa
     /// </summary>
     public unsafe int SplineLength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 172); }
+        get { return *(int*)(Ptr + 172); }
+        set { *(int*)(Ptr + 172) = value; }
     }
 
     /// <summary>
@@ -103,8 +103,8 @@ public partial class SkelControlSpline : BmSDK.Engine.SkelControlBase, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis SplineBoneAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 176); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 176) = value; }
     }
 
     /// <summary>
@@ -112,8 +112,8 @@ public partial class SkelControlSpline : BmSDK.Engine.SkelControlBase, BmSDK.IGa
     /// </summary>
     public unsafe BmSDK.Engine.SkelControlSpline.ESplineControlRotMode BoneRotMode
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.SkelControlSpline.ESplineControlRotMode>(Ptr + 177); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 177); }
+        get { return *(BmSDK.Engine.SkelControlSpline.ESplineControlRotMode*)(Ptr + 177); }
+        set { *(BmSDK.Engine.SkelControlSpline.ESplineControlRotMode*)(Ptr + 177) = value; }
     }
 
     /// <summary>
@@ -121,8 +121,8 @@ public partial class SkelControlSpline : BmSDK.Engine.SkelControlBase, BmSDK.IGa
     /// </summary>
     public unsafe bool bInvertSplineBoneAxis
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 180); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 180); }
+        get { return (*(int*)(Ptr + 180) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 180) |= 1; else *(int*)(Ptr + 180) &= ~1; }
     }
 
     /// <summary>
@@ -130,8 +130,8 @@ public partial class SkelControlSpline : BmSDK.Engine.SkelControlBase, BmSDK.IGa
     /// </summary>
     public unsafe float EndSplineTension
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 184); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 184); }
+        get { return *(float*)(Ptr + 184); }
+        set { *(float*)(Ptr + 184) = value; }
     }
 
     /// <summary>
@@ -139,7 +139,7 @@ public partial class SkelControlSpline : BmSDK.Engine.SkelControlBase, BmSDK.IGa
     /// </summary>
     public unsafe float StartSplineTension
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 188); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 188); }
+        get { return *(float*)(Ptr + 188); }
+        set { *(float*)(Ptr + 188) = value; }
     }
 }
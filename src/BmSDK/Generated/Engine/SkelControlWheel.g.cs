@@ -83,8 +83,8 @@ public partial class SkelControlWheel : BmSDK.Engine.SkelControlSingleBone, BmSD
     /// </summary>
     public unsafe float WheelDisplacement
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(float*)(Ptr + 220); }
+        set { *(float*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class SkelControlWheel : BmSDK.Engine.SkelControlSingleBone, BmSD
     /// </summary>
     public unsafe float WheelMaxRenderDisplacement
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(float*)(Ptr + 224); }
+        set { *(float*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class SkelControlWheel : BmSDK.Engine.SkelControlSingleBone, BmSD
     /// </summary>
     public unsafe float WheelRoll
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(float*)(Ptr + 228); }
+        set { *(float*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class SkelControlWheel : BmSDK.Engine.SkelControlSingleBone, BmSD
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis WheelRollAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 232); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class SkelControlWheel : BmSDK.Engine.SkelControlSingleBone, BmSD
     /// </summary>
     public unsafe BmSDK.GameObject.EAxis WheelSteeringAxis
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.EAxis>(Ptr + 233); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 233); }
+        get { return *(BmSDK.GameObject.EAxis*)(Ptr + 233); }
+        set { *(BmSDK.GameObject.EAxis*)(Ptr + 233) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class SkelControlWheel : BmSDK.Engine.SkelControlSingleBone, BmSD
     /// </summary>
     public unsafe float WheelSteering
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(float*)(Ptr + 236); }
+        set { *(float*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class SkelControlWheel : BmSDK.Engine.SkelControlSingleBone, BmSD
     /// </summary>
     public unsafe bool bInvertWheelRoll
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 240); }
+        get { return (*(int*)(Ptr + 240) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 240) |= 1; else *(int*)(Ptr + 240) &= ~1; }
     }
 
     /// <summary>
@@ -146,7 +146,7 @@ public partial class SkelControlWheel : BmSDK.Engine.SkelControlSingleBone, BmSD
     /// </summary>
     public unsafe bool bInvertWheelSteering
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 240); }
+        get { return (*(int*)(Ptr + 240) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 240) |= 2; else *(int*)(Ptr + 240) &= ~2; }
     }
 }
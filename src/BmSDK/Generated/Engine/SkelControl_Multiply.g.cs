@@ -83,7 +83,7 @@ public partial class SkelControl_Multiply : BmSDK.Engine.SkelControlBase, BmSDK.
     /// </summary>
     public unsafe float Multiplier
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 172); }
+        get { return *(float*)(Ptr + 172); }
+        set { *(float*)(Ptr + 172) = value; }
     }
 }
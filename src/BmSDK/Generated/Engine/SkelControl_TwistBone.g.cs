@@ -83,8 +83,8 @@ public partial class SkelControl_TwistBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe BmSDK.FName SourceBoneName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 172); }
+        get { return *(BmSDK.FName*)(Ptr + 172); }
+        set { *(BmSDK.FName*)(Ptr + 172) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class SkelControl_TwistBone : BmSDK.Engine.SkelControlBase, BmSDK
     /// </summary>
     public unsafe float TwistAngleScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 180); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 180); }
+        get { return *(float*)(Ptr + 180); }
+        set { *(float*)(Ptr + 180) = value; }
     }
 }
@@ -83,8 +83,8 @@ public partial class SkyLightComponent : BmSDK.Engine.LightComponent, BmSDK.IGam
     /// </summary>
     public unsafe float LowerBrightness
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 408); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 408); }
+        get { return *(float*)(Ptr + 408); }
+        set { *(float*)(Ptr + 408) = value; }
     }
 
     /// <summary>
@@ -78,8 +78,8 @@ public partial class SoundNode : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe int NodeUpdateHint
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class SpeechRecognition : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float ConfidenceThreshhold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 56); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 56); }
+        get { return *(float*)(Ptr + 56); }
+        set { *(float*)(Ptr + 56) = value; }
     }
 
     /// <summary>
@@ -163,8 +163,8 @@ public partial class SpeechRecognition : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDirty
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 172); }
+        get { return (*(int*)(Ptr + 172) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 172) |= 1; else *(int*)(Ptr + 172) &= ~1; }
     }
 
     /// <summary>
@@ -172,8 +172,8 @@ public partial class SpeechRecognition : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bInitialised
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 172); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 172); }
+        get { return (*(int*)(Ptr + 172) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 172) |= 2; else *(int*)(Ptr + 172) &= ~2; }
     }
 
     /// <summary>
@@ -181,8 +181,8 @@ public partial class SpeechRecognition : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr FnxVoiceData
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 176); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 176); }
+        get { return *(System.IntPtr*)(Ptr + 176); }
+        set { *(System.IntPtr*)(Ptr + 176) = value; }
     }
 
     /// <summary>
@@ -194,11 +194,7 @@ public partial class SpeechRecognition : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: ActiveVocabularies
         /// </summary>
-        public unsafe int ActiveVocabularies
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int ActiveVocabularies;
 
         /// <summary>
         /// ArrayProperty: UserData
@@ -280,11 +276,7 @@ public partial class SpeechRecognition : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: Id
         /// </summary>
-        public unsafe int Id
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int Id;
 
         /// <summary>
         /// StrProperty: ReferenceWord
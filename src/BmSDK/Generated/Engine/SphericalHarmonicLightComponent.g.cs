@@ -89,7 +89,7 @@ public partial class SphericalHarmonicLightComponent : BmSDK.Engine.LightCompone
     /// </summary>
     public unsafe bool bRenderBeforeModShadows
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 560); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 560); }
+        get { return (*(int*)(Ptr + 560) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 560) |= 1; else *(int*)(Ptr + 560) &= ~1; }
     }
 }
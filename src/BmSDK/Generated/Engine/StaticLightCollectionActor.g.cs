@@ -92,7 +92,7 @@ public partial class StaticLightCollectionActor : BmSDK.Engine.Light, BmSDK.IGam
     /// </summary>
     public unsafe int MaxLightComponents
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 456); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 456); }
+        get { return *(int*)(Ptr + 456); }
+        set { *(int*)(Ptr + 456) = value; }
     }
 }
@@ -92,7 +92,7 @@ public partial class StaticMeshCollectionActor : BmSDK.Engine.StaticMeshActorBas
     /// </summary>
     public unsafe int MaxStaticMeshComponents
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 444); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 444); }
+        get { return *(int*)(Ptr + 444); }
+        set { *(int*)(Ptr + 444) = value; }
     }
 }
@@ -92,7 +92,7 @@ public partial class TargetPoint : BmSDK.Engine.Keypoint, BmSDK.IGameObject
     /// </summary>
     public unsafe int SpawnRefCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 436); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 436); }
+        get { return *(int*)(Ptr + 436); }
+        set { *(int*)(Ptr + 436) = value; }
     }
 }
@@ -101,8 +101,8 @@ public partial class TerrainMaterial : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.TerrainMaterial.ETerrainMappingType MappingType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.TerrainMaterial.ETerrainMappingType>(Ptr + 112); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 112); }
+        get { return *(BmSDK.Engine.TerrainMaterial.ETerrainMappingType*)(Ptr + 112); }
+        set { *(BmSDK.Engine.TerrainMaterial.ETerrainMappingType*)(Ptr + 112) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class TerrainMaterial : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MappingScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(float*)(Ptr + 116); }
+        set { *(float*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class TerrainMaterial : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MappingRotation
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 120); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 120); }
+        get { return *(float*)(Ptr + 120); }
+        set { *(float*)(Ptr + 120) = value; }
     }
 
     /// <summary>
@@ -128,8 +128,8 @@ public partial class TerrainMaterial : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MappingPanU
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(float*)(Ptr + 124); }
+        set { *(float*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -137,8 +137,8 @@ public partial class TerrainMaterial : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float MappingPanV
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 128); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 128); }
+        get { return *(float*)(Ptr + 128); }
+        set { *(float*)(Ptr + 128) = value; }
     }
 
     /// <summary>
@@ -164,7 +164,7 @@ public partial class TerrainMaterial : BmSDK.GameObject, BmSDK.IGameObject
     /// </summary>
     public unsafe float DisplacementScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(float*)(Ptr + 140); }
+        set { *(float*)(Ptr + 140) = value; }
     }
 }
@@ -78,25 +78,36 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<Texture2D>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_CreateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct Create_Params
+    {
+        [FieldOffset(0)] public int InSizeX;
+        [FieldOffset(4)] public int InSizeY;
+        [FieldOffset(8)] public BmSDK.Engine.Texture.EPixelFormat InFormat;
+        [FieldOffset(12)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: Create
     /// </summary>
     public unsafe static BmSDK.Engine.Texture2D Create(int InSizeX, int InSizeY, BmSDK.Engine.Texture.EPixelFormat InFormat = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Texture2D.Create", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InSizeX, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InSizeY, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InFormat, paramsPtr + 8);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Texture2D>(paramsPtr + 12);
+        var funcManaged = s_CreateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Texture2D.Create", true);
+        var parms = new Create_Params();
+        parms.InSizeX = InSizeX;
+        parms.InSizeY = InSizeY;
+        parms.InFormat = InFormat;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Texture2D)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_SetForceMipLevelsToBeResidentFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct SetForceMipLevelsToBeResident_Params
+    {
+        [FieldOffset(0)] public float Seconds;
+        [FieldOffset(4)] public int CinematicTextureGroups;
     }
 
     /// <summary>
@@ -104,18 +115,11 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void SetForceMipLevelsToBeResident(float Seconds, int CinematicTextureGroups = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Texture2D.SetForceMipLevelsToBeResident", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Seconds, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(CinematicTextureGroups, paramsPtr + 4);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_SetForceMipLevelsToBeResidentFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Texture2D.SetForceMipLevelsToBeResident", true);
+        var parms = new SetForceMipLevelsToBeResident_Params();
+        parms.Seconds = Seconds;
+        parms.CinematicTextureGroups = CinematicTextureGroups;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
@@ -128,29 +132,17 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Element
         /// </summary>
-        public unsafe System.IntPtr Element
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.IntPtr Element;
 
         /// <summary>
         /// StructProperty: Next
         /// </summary>
-        public unsafe System.IntPtr Next
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public System.IntPtr Next;
 
         /// <summary>
         /// StructProperty: PrevLink
         /// </summary>
-        public unsafe System.IntPtr PrevLink
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public System.IntPtr PrevLink;
     }
 
     /// <summary>
@@ -164,8 +156,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int SizeX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 224); }
+        get { return *(int*)(Ptr + 224); }
+        set { *(int*)(Ptr + 224) = value; }
     }
 
     /// <summary>
@@ -173,8 +165,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int SizeY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 228); }
+        get { return *(int*)(Ptr + 228); }
+        set { *(int*)(Ptr + 228) = value; }
     }
 
     /// <summary>
@@ -182,8 +174,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int OriginalSizeX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 232); }
+        get { return *(int*)(Ptr + 232); }
+        set { *(int*)(Ptr + 232) = value; }
     }
 
     /// <summary>
@@ -191,8 +183,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int OriginalSizeY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 236); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 236); }
+        get { return *(int*)(Ptr + 236); }
+        set { *(int*)(Ptr + 236) = value; }
     }
 
     /// <summary>
@@ -200,8 +192,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int AutoLODSizeX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(int*)(Ptr + 240); }
+        set { *(int*)(Ptr + 240) = value; }
     }
 
     /// <summary>
@@ -209,8 +201,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int AutoLODSizeY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 244); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 244); }
+        get { return *(int*)(Ptr + 244); }
+        set { *(int*)(Ptr + 244) = value; }
     }
 
     /// <summary>
@@ -218,8 +210,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.Texture.EPixelFormat Format
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Texture.EPixelFormat>(Ptr + 248); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 248); }
+        get { return *(BmSDK.Engine.Texture.EPixelFormat*)(Ptr + 248); }
+        set { *(BmSDK.Engine.Texture.EPixelFormat*)(Ptr + 248) = value; }
     }
 
     /// <summary>
@@ -227,8 +219,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.Texture.TextureAddress AddressX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Texture.TextureAddress>(Ptr + 249); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 249); }
+        get { return *(BmSDK.Engine.Texture.TextureAddress*)(Ptr + 249); }
+        set { *(BmSDK.Engine.Texture.TextureAddress*)(Ptr + 249) = value; }
     }
 
     /// <summary>
@@ -236,8 +228,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.Texture.TextureAddress AddressY
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Texture.TextureAddress>(Ptr + 250); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 250); }
+        get { return *(BmSDK.Engine.Texture.TextureAddress*)(Ptr + 250); }
+        set { *(BmSDK.Engine.Texture.TextureAddress*)(Ptr + 250) = value; }
     }
 
     /// <summary>
@@ -245,8 +237,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe bool XboxForcePWLCorrection
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 1; else *(int*)(Ptr + 252) &= ~1; }
     }
 
     /// <summary>
@@ -254,8 +246,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsStreamable
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 2; else *(int*)(Ptr + 252) &= ~2; }
     }
 
     /// <summary>
@@ -263,8 +255,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasCancelationPending
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 4; else *(int*)(Ptr + 252) &= ~4; }
     }
 
     /// <summary>
@@ -272,8 +264,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasBeenLoadedFromPersistentArchive
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 8; else *(int*)(Ptr + 252) &= ~8; }
     }
 
     /// <summary>
@@ -281,8 +273,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceMiplevelsToBeResident
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 16; else *(int*)(Ptr + 252) &= ~16; }
     }
 
     /// <summary>
@@ -290,8 +282,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bGlobalForceMipLevelsToBeResident
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 252); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 252); }
+        get { return (*(int*)(Ptr + 252) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 252) |= 32; else *(int*)(Ptr + 252) &= ~32; }
     }
 
     /// <summary>
@@ -299,8 +291,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe float ForceMipLevelsToBeResidentTimestamp
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 256); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 256); }
+        get { return *(float*)(Ptr + 256); }
+        set { *(float*)(Ptr + 256) = value; }
     }
 
     /// <summary>
@@ -308,8 +300,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName TextureFileCacheName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 260); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 260); }
+        get { return *(BmSDK.FName*)(Ptr + 260); }
+        set { *(BmSDK.FName*)(Ptr + 260) = value; }
     }
 
     /// <summary>
@@ -323,8 +315,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int RequestedMips
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 272); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 272); }
+        get { return *(int*)(Ptr + 272); }
+        set { *(int*)(Ptr + 272) = value; }
     }
 
     /// <summary>
@@ -332,8 +324,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int ResidentMips
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 276); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 276); }
+        get { return *(int*)(Ptr + 276); }
+        set { *(int*)(Ptr + 276) = value; }
     }
 
     /// <summary>
@@ -362,8 +354,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int StreamingIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 308); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 308); }
+        get { return *(int*)(Ptr + 308); }
+        set { *(int*)(Ptr + 308) = value; }
     }
 
     /// <summary>
@@ -371,8 +363,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int MipTailBaseIdx
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 312); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 312); }
+        get { return *(int*)(Ptr + 312); }
+        set { *(int*)(Ptr + 312) = value; }
     }
 
     /// <summary>
@@ -380,8 +372,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr ResourceMem
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 316); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 316); }
+        get { return *(System.IntPtr*)(Ptr + 316); }
+        set { *(System.IntPtr*)(Ptr + 316) = value; }
     }
 
     /// <summary>
@@ -389,8 +381,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe int FirstResourceMemMip
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 320); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 320); }
+        get { return *(int*)(Ptr + 320); }
+        set { *(int*)(Ptr + 320) = value; }
     }
 
     /// <summary>
@@ -398,8 +390,8 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
     /// </summary>
     public unsafe float Timer
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 324); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 324); }
+        get { return *(float*)(Ptr + 324); }
+        set { *(float*)(Ptr + 324) = value; }
     }
 
     /// <summary>
@@ -411,19 +403,11 @@ public partial class Texture2D : BmSDK.Engine.Texture, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Data
         /// </summary>
-        public unsafe BmSDK.GameObject.FUntypedBulkData_Mirror Data
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FUntypedBulkData_Mirror>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.GameObject.FUntypedBulkData_Mirror Data;
 
         /// <summary>
         /// IntProperty: Size
         /// </summary>
-        public unsafe int Size
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }; }
-        }
+        [FieldOffset(44)] public int Size;
     }
 }
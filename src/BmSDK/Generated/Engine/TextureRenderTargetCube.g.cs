@@ -83,8 +83,8 @@ public partial class TextureRenderTargetCube : BmSDK.Engine.TextureRenderTarget,
     /// </summary>
     public unsafe int SizeX
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 220); }
+        get { return *(int*)(Ptr + 220); }
+        set { *(int*)(Ptr + 220) = value; }
     }
 
     /// <summary>
@@ -98,7 +98,7 @@ public partial class TextureRenderTargetCube : BmSDK.Engine.TextureRenderTarget,
     /// </summary>
     public unsafe BmSDK.Engine.Texture.EPixelFormat Format
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Texture.EPixelFormat>(Ptr + 240); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 240); }
+        get { return *(BmSDK.Engine.Texture.EPixelFormat*)(Ptr + 240); }
+        set { *(BmSDK.Engine.Texture.EPixelFormat*)(Ptr + 240) = value; }
     }
 }
@@ -73,16 +73,31 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<UIDataProvider>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_RemovePropertyNotificationChangeRequestFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct RemovePropertyNotificationChangeRequest_Params
+    {
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: RemovePropertyNotificationChangeRequest
     /// </summary>
     public unsafe virtual bool RemovePropertyNotificationChangeRequest(System.IntPtr InDelegate)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.RemovePropertyNotificationChangeRequest", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InDelegate, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_RemovePropertyNotificationChangeRequestFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.RemovePropertyNotificationChangeRequest", true);
+        var parms = new RemovePropertyNotificationChangeRequest_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(InDelegate, (byte*)&parms + 0);
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AddPropertyNotificationChangeRequestFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct AddPropertyNotificationChangeRequest_Params
+    {
+        [FieldOffset(12)] public int bAllowDuplicates;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -90,12 +105,19 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool AddPropertyNotificationChangeRequest(System.IntPtr InDelegate, bool bAllowDuplicates = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.AddPropertyNotificationChangeRequest", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InDelegate, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bAllowDuplicates, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_AddPropertyNotificationChangeRequestFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.AddPropertyNotificationChangeRequest", true);
+        var parms = new AddPropertyNotificationChangeRequest_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(InDelegate, (byte*)&parms + 0);
+        parms.bAllowDuplicates = bAllowDuplicates ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_NotifyPropertyChangedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct NotifyPropertyChanged_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName PropTag;
     }
 
     /// <summary>
@@ -103,23 +125,39 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void NotifyPropertyChanged(BmSDK.FName PropTag = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.NotifyPropertyChanged", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PropTag, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_NotifyPropertyChangedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.NotifyPropertyChanged", true);
+        var parms = new NotifyPropertyChanged_Params();
+        parms.PropTag = PropTag;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GenerateFillerDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GenerateFillerData_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString DataTag;
+        [FieldOffset(12)] public BmSDK.FString ReturnValue;
+    }
+
     /// <summary>
     /// Function: GenerateFillerData
     /// </summary>
     public unsafe virtual BmSDK.FString GenerateFillerData(BmSDK.FString DataTag)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GenerateFillerData", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DataTag, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 12);
+        var funcManaged = s_GenerateFillerDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GenerateFillerData", true);
+        var parms = new GenerateFillerData_Params();
+        parms.DataTag = DataTag;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GenerateScriptMarkupStringFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GenerateScriptMarkupString_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName DataTag;
+        [FieldOffset(8)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -127,11 +165,21 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual BmSDK.FString GenerateScriptMarkupString(BmSDK.FName DataTag)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GenerateScriptMarkupString", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DataTag, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 8);
+        var funcManaged = s_GenerateScriptMarkupStringFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GenerateScriptMarkupString", true);
+        var parms = new GenerateScriptMarkupString_Params();
+        parms.DataTag = DataTag;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_SetFieldValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 104)]
+    private struct SetFieldValue_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FieldName;
+        [FieldOffset(12)] public BmSDK.Engine.UIRoot.FUIProviderScriptFieldValue FieldValue;
+        [FieldOffset(96)] public int ArrayIndex;
+        [FieldOffset(100)] public int ReturnValue;
     }
 
     /// <summary>
@@ -139,13 +187,23 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool SetFieldValue(BmSDK.FString FieldName, out BmSDK.Engine.UIRoot.FUIProviderScriptFieldValue FieldValue, int ArrayIndex = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.SetFieldValue", true);
-        byte* paramsPtr = stackalloc byte[104];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FieldName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ArrayIndex, paramsPtr + 96);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        FieldValue = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.UIRoot.FUIProviderScriptFieldValue>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 100);
+        var funcManaged = s_SetFieldValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.SetFieldValue", true);
+        var parms = new SetFieldValue_Params();
+        parms.FieldName = FieldName;
+        parms.ArrayIndex = ArrayIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        FieldValue = parms.FieldValue;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetFieldValueFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 104)]
+    private struct GetFieldValue_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FieldName;
+        [FieldOffset(12)] public BmSDK.Engine.UIRoot.FUIProviderScriptFieldValue FieldValue;
+        [FieldOffset(96)] public int ArrayIndex;
+        [FieldOffset(100)] public int ReturnValue;
     }
 
     /// <summary>
@@ -153,13 +211,22 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool GetFieldValue(BmSDK.FString FieldName, out BmSDK.Engine.UIRoot.FUIProviderScriptFieldValue FieldValue, int ArrayIndex = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GetFieldValue", true);
-        byte* paramsPtr = stackalloc byte[104];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FieldName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ArrayIndex, paramsPtr + 96);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        FieldValue = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.UIRoot.FUIProviderScriptFieldValue>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 100);
+        var funcManaged = s_GetFieldValueFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GetFieldValue", true);
+        var parms = new GetFieldValue_Params();
+        parms.FieldName = FieldName;
+        parms.ArrayIndex = ArrayIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        FieldValue = parms.FieldValue;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AllowPublishingToFieldFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct AllowPublishingToField_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString FieldName;
+        [FieldOffset(12)] public int ArrayIndex;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -167,12 +234,18 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool AllowPublishingToField(BmSDK.FString FieldName, int ArrayIndex = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.AllowPublishingToField", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(FieldName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ArrayIndex, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_AllowPublishingToFieldFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.AllowPublishingToField", true);
+        var parms = new AllowPublishingToField_Params();
+        parms.FieldName = FieldName;
+        parms.ArrayIndex = ArrayIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetSupportedScriptFieldsFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetSupportedScriptFields_Params
+    {
     }
 
     /// <summary>
@@ -180,30 +253,40 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void GetSupportedScriptFields(out BmSDK.TArray<BmSDK.Engine.UIDataProvider.FUIDataProviderField> out_Fields)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GetSupportedScriptFields", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        out_Fields = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.UIDataProvider.FUIDataProviderField>>(paramsPtr + 0);
+        var funcManaged = s_GetSupportedScriptFieldsFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GetSupportedScriptFields", true);
+        var parms = new GetSupportedScriptFields_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        out_Fields = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.TArray<BmSDK.Engine.UIDataProvider.FUIDataProviderField>>((byte*)&parms + 0);
         return;
     }
 
+    static BmSDK.Function s_ParseArrayDelimiterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ParseArrayDelimiter_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString DataTag;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ParseArrayDelimiter
     /// </summary>
     public unsafe virtual int ParseArrayDelimiter(out BmSDK.FString DataTag)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.ParseArrayDelimiter", true);
-        byte* paramsPtr = stackalloc byte[16];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        DataTag = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 12);
+        var funcManaged = s_ParseArrayDelimiterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.ParseArrayDelimiter", true);
+        var parms = new ParseArrayDelimiter_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        DataTag = parms.DataTag;
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetProviderFieldTypeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct GetProviderFieldType_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString DataTag;
+        [FieldOffset(12)] public BmSDK.Engine.UIRoot.EUIDataProviderFieldType out_ProviderFieldType;
+        [FieldOffset(16)] public int ReturnValue;
     }
 
     /// <summary>
@@ -211,19 +294,20 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool GetProviderFieldType(BmSDK.FString DataTag, out BmSDK.Engine.UIRoot.EUIDataProviderFieldType out_ProviderFieldType)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GetProviderFieldType", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DataTag, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        out_ProviderFieldType = BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.UIRoot.EUIDataProviderFieldType>(paramsPtr + 12);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_GetProviderFieldTypeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.GetProviderFieldType", true);
+        var parms = new GetProviderFieldType_Params();
+        parms.DataTag = DataTag;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        out_ProviderFieldType = parms.out_ProviderFieldType;
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_OnDataProviderPropertyChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OnDataProviderPropertyChange_Params
+    {
+        [FieldOffset(0)] public nint SourceProvider;
+        [FieldOffset(4)] public BmSDK.FName PropTag;
     }
 
     /// <summary>
@@ -231,11 +315,11 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void OnDataProviderPropertyChange(BmSDK.Engine.UIDataProvider SourceProvider, BmSDK.FName PropTag = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.OnDataProviderPropertyChange", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SourceProvider, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PropTag, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnDataProviderPropertyChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider.OnDataProviderPropertyChange", true);
+        var parms = new OnDataProviderPropertyChange_Params();
+        parms.SourceProvider = SourceProvider?.Ptr ?? 0;
+        parms.PropTag = PropTag;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -244,8 +328,8 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine.UIDataProvider.EProviderAccessType WriteAccessType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.UIDataProvider.EProviderAccessType>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.Engine.UIDataProvider.EProviderAccessType*)(Ptr + 48); }
+        set { *(BmSDK.Engine.UIDataProvider.EProviderAccessType*)(Ptr + 48) = value; }
     }
 
     /// <summary>
@@ -286,20 +370,12 @@ public partial class UIDataProvider : BmSDK.Engine.UIRoot, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: FieldTag
         /// </summary>
-        public unsafe BmSDK.FName FieldTag
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName FieldTag;
 
         /// <summary>
         /// ByteProperty: FieldType
         /// </summary>
-        public unsafe BmSDK.Engine.UIRoot.EUIDataProviderFieldType FieldType
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.UIRoot.EUIDataProviderFieldType>(Ptr + 8); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 8); }; }
-        }
+        [FieldOffset(8)] public BmSDK.Engine.UIRoot.EUIDataProviderFieldType FieldType;
 
         /// <summary>
         /// ArrayProperty: FieldProviders
@@ -78,50 +78,77 @@ public partial class UIDataProvider_OnlineFriends : BmSDK.Engine.UIDataProvider_
         where TComponent : class, Framework.IScriptComponent<UIDataProvider_OnlineFriends>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_OnLoginChangeFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct OnLoginChange_Params
+    {
+        [FieldOffset(0)] public byte LocalUserNum;
+    }
+
     /// <summary>
     /// Function: OnLoginChange
     /// </summary>
     public unsafe virtual void OnLoginChange(byte LocalUserNum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineFriends.OnLoginChange", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocalUserNum, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnLoginChangeFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineFriends.OnLoginChange", true);
+        var parms = new OnLoginChange_Params();
+        parms.LocalUserNum = LocalUserNum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnFriendsReadCompleteFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct OnFriendsReadComplete_Params
+    {
+        [FieldOffset(0)] public int bWasSuccessful;
+    }
+
     /// <summary>
     /// Function: OnFriendsReadComplete
     /// </summary>
     public unsafe virtual void OnFriendsReadComplete(bool bWasSuccessful)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineFriends.OnFriendsReadComplete", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bWasSuccessful, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnFriendsReadCompleteFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineFriends.OnFriendsReadComplete", true);
+        var parms = new OnFriendsReadComplete_Params();
+        parms.bWasSuccessful = bWasSuccessful ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnUnregisterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OnUnregister_Params
+    {
+    }
+
     /// <summary>
     /// Function: OnUnregister
     /// </summary>
     public unsafe override void OnUnregister()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineFriends.OnUnregister", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnUnregisterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineFriends.OnUnregister", true);
+        var parms = new OnUnregister_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OnRegisterFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct OnRegister_Params
+    {
+        [FieldOffset(0)] public nint InPlayer;
+    }
+
     /// <summary>
     /// Function: OnRegister
     /// </summary>
     public unsafe override void OnRegister(BmSDK.Engine.LocalPlayer InPlayer)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineFriends.OnRegister", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InPlayer, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OnRegisterFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineFriends.OnRegister", true);
+        var parms = new OnRegister_Params();
+        parms.InPlayer = InPlayer?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -130,8 +157,8 @@ public partial class UIDataProvider_OnlineFriends : BmSDK.Engine.UIDataProvider_
     /// </summary>
     public unsafe System.IntPtr VfTable_IUIListElementCellProvider
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(System.IntPtr*)(Ptr + 80); }
+        set { *(System.IntPtr*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -83,8 +83,8 @@ public partial class UIDataProvider_OnlinePlayerStorageArray : BmSDK.Engine.UIDa
     /// </summary>
     public unsafe System.IntPtr VfTable_IUIListElementProvider
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(System.IntPtr*)(Ptr + 76); }
+        set { *(System.IntPtr*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class UIDataProvider_OnlinePlayerStorageArray : BmSDK.Engine.UIDa
     /// </summary>
     public unsafe System.IntPtr VfTable_IUIListElementCellProvider
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(System.IntPtr*)(Ptr + 80); }
+        set { *(System.IntPtr*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class UIDataProvider_OnlinePlayerStorageArray : BmSDK.Engine.UIDa
     /// </summary>
     public unsafe int PlayerStorageId
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(int*)(Ptr + 88); }
+        set { *(int*)(Ptr + 88) = value; }
     }
 
     /// <summary>
@@ -119,8 +119,8 @@ public partial class UIDataProvider_OnlinePlayerStorageArray : BmSDK.Engine.UIDa
     /// </summary>
     public unsafe BmSDK.FName PlayerStorageName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 92); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 92); }
+        get { return *(BmSDK.FName*)(Ptr + 92); }
+        set { *(BmSDK.FName*)(Ptr + 92) = value; }
     }
 
     /// <summary>
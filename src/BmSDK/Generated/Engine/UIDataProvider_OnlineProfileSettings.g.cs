@@ -78,55 +78,94 @@ public partial class UIDataProvider_OnlineProfileSettings : BmSDK.Engine.UIDataP
         where TComponent : class, Framework.IScriptComponent<UIDataProvider_OnlineProfileSettings>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_RefreshStorageDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct RefreshStorageData_Params
+    {
+    }
+
     /// <summary>
     /// Function: RefreshStorageData
     /// </summary>
     public unsafe override void RefreshStorageData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.RefreshStorageData", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_RefreshStorageDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.RefreshStorageData", true);
+        var parms = new RefreshStorageData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearReadCompleteDelegateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct ClearReadCompleteDelegate_Params
+    {
+        [FieldOffset(8)] public byte LocalUserNum;
+    }
+
     /// <summary>
     /// Function: ClearReadCompleteDelegate
     /// </summary>
     public unsafe override void ClearReadCompleteDelegate(BmSDK.Engine.OnlinePlayerInterface PlayerInterface, byte LocalUserNum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.ClearReadCompleteDelegate", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInterface, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocalUserNum, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearReadCompleteDelegateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.ClearReadCompleteDelegate", true);
+        var parms = new ClearReadCompleteDelegate_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInterface, (byte*)&parms + 0);
+        parms.LocalUserNum = LocalUserNum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddReadCompleteDelegateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 9)]
+    private struct AddReadCompleteDelegate_Params
+    {
+        [FieldOffset(8)] public byte LocalUserNum;
+    }
+
     /// <summary>
     /// Function: AddReadCompleteDelegate
     /// </summary>
     public unsafe override void AddReadCompleteDelegate(BmSDK.Engine.OnlinePlayerInterface PlayerInterface, byte LocalUserNum)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.AddReadCompleteDelegate", true);
-        byte* paramsPtr = stackalloc byte[9];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInterface, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocalUserNum, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AddReadCompleteDelegateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.AddReadCompleteDelegate", true);
+        var parms = new AddReadCompleteDelegate_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInterface, (byte*)&parms + 0);
+        parms.LocalUserNum = LocalUserNum;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct GetData_Params
+    {
+        [FieldOffset(8)] public byte LocalUserNum;
+        [FieldOffset(12)] public nint PlayerStorage;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetData
     /// </summary>
     public unsafe override bool GetData(BmSDK.Engine.OnlinePlayerInterface PlayerInterface, byte LocalUserNum, BmSDK.Engine.OnlinePlayerStorage PlayerStorage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.GetData", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInterface, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocalUserNum, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerStorage, paramsPtr + 12);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_GetDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.GetData", true);
+        var parms = new GetData_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInterface, (byte*)&parms + 0);
+        parms.LocalUserNum = LocalUserNum;
+        parms.PlayerStorage = PlayerStorage?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_ReadDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct ReadData_Params
+    {
+        [FieldOffset(8)] public byte LocalUserNum;
+        [FieldOffset(12)] public int DeviceID;
+        [FieldOffset(16)] public nint PlayerStorage;
+        [FieldOffset(20)] public int ReturnValue;
     }
 
     /// <summary>
@@ -134,13 +173,13 @@ public partial class UIDataProvider_OnlineProfileSettings : BmSDK.Engine.UIDataP
     /// </summary>
     public unsafe override bool ReadData(BmSDK.Engine.OnlinePlayerInterface PlayerInterface, byte LocalUserNum, int DeviceID, BmSDK.Engine.OnlinePlayerStorage PlayerStorage)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.ReadData", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInterface, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(LocalUserNum, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(DeviceID, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerStorage, paramsPtr + 16);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 20);
+        var funcManaged = s_ReadDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UIDataProvider_OnlineProfileSettings.ReadData", true);
+        var parms = new ReadData_Params();
+        BmSDK.Framework.MarshalUtil.ToUnmanaged(PlayerInterface, (byte*)&parms + 0);
+        parms.LocalUserNum = LocalUserNum;
+        parms.DeviceID = DeviceID;
+        parms.PlayerStorage = PlayerStorage?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 }
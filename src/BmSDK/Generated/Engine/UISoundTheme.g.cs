@@ -78,16 +78,24 @@ public partial class UISoundTheme : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<UISoundTheme>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_ProcessSoundEventFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ProcessSoundEvent_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName SoundEventName;
+        [FieldOffset(8)] public nint SoundOwner;
+    }
+
     /// <summary>
     /// Function: ProcessSoundEvent
     /// </summary>
     public unsafe virtual void ProcessSoundEvent(BmSDK.FName SoundEventName, BmSDK.Engine.PlayerController SoundOwner = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UISoundTheme.ProcessSoundEvent", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundEventName, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(SoundOwner, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ProcessSoundEventFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.UISoundTheme.ProcessSoundEvent", true);
+        var parms = new ProcessSoundEvent_Params();
+        parms.SoundEventName = SoundEventName;
+        parms.SoundOwner = SoundOwner?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -109,11 +117,7 @@ public partial class UISoundTheme : BmSDK.GameObject, BmSDK.IGameObject
         /// <summary>
         /// NameProperty: SoundEventName
         /// </summary>
-        public unsafe BmSDK.FName SoundEventName
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public BmSDK.FName SoundEventName;
 
         /// <summary>
         /// ObjectProperty: SoundToPlay
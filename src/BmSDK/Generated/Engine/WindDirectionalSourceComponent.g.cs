@@ -83,8 +83,8 @@ public partial class WindDirectionalSourceComponent : BmSDK.Engine.ActorComponen
     /// </summary>
     public unsafe System.IntPtr SceneProxy
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 72); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 72); }
+        get { return *(System.IntPtr*)(Ptr + 72); }
+        set { *(System.IntPtr*)(Ptr + 72) = value; }
     }
 
     /// <summary>
@@ -92,8 +92,8 @@ public partial class WindDirectionalSourceComponent : BmSDK.Engine.ActorComponen
     /// </summary>
     public unsafe float Strength
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 76); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 76); }
+        get { return *(float*)(Ptr + 76); }
+        set { *(float*)(Ptr + 76) = value; }
     }
 
     /// <summary>
@@ -101,8 +101,8 @@ public partial class WindDirectionalSourceComponent : BmSDK.Engine.ActorComponen
     /// </summary>
     public unsafe float Phase
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 80); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 80); }
+        get { return *(float*)(Ptr + 80); }
+        set { *(float*)(Ptr + 80) = value; }
     }
 
     /// <summary>
@@ -110,8 +110,8 @@ public partial class WindDirectionalSourceComponent : BmSDK.Engine.ActorComponen
     /// </summary>
     public unsafe float Frequency
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 84); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 84); }
+        get { return *(float*)(Ptr + 84); }
+        set { *(float*)(Ptr + 84) = value; }
     }
 
     /// <summary>
@@ -119,7 +119,7 @@ public partial class WindDirectionalSourceComponent : BmSDK.Engine.ActorComponen
     /// </summary>
     public unsafe float Speed
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 88); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 88); }
+        get { return *(float*)(Ptr + 88); }
+        set { *(float*)(Ptr + 88) = value; }
     }
 }
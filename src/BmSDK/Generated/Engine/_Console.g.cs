@@ -78,66 +78,87 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<_Console>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_UpdateCompleteIndicesFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct UpdateCompleteIndices_Params
+    {
+    }
+
     /// <summary>
     /// Function: UpdateCompleteIndices
     /// </summary>
     public unsafe virtual void UpdateCompleteIndices()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.UpdateCompleteIndices", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_UpdateCompleteIndicesFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.UpdateCompleteIndices", true);
+        var parms = new UpdateCompleteIndices_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_BuildRuntimeAutoCompleteListFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct BuildRuntimeAutoCompleteList_Params
+    {
+        [FieldOffset(0)] public int bForce;
+    }
+
     /// <summary>
     /// Function: BuildRuntimeAutoCompleteList
     /// </summary>
     public unsafe virtual void BuildRuntimeAutoCompleteList(bool bForce = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.BuildRuntimeAutoCompleteList", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bForce, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_BuildRuntimeAutoCompleteListFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.BuildRuntimeAutoCompleteList", true);
+        var parms = new BuildRuntimeAutoCompleteList_Params();
+        parms.bForce = bForce ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AppendInputTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct AppendInputText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+    }
+
     /// <summary>
     /// Function: AppendInputText
     /// </summary>
     public unsafe virtual void AppendInputText(BmSDK.FString Text)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.AppendInputText", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_AppendInputTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.AppendInputText", true);
+        var parms = new AppendInputText_Params();
+        parms.Text = Text;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ProcessControlKeyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 16)]
+    private struct ProcessControlKey_Params
+    {
+        [FieldOffset(0)] public BmSDK.FName Key;
+        [FieldOffset(8)] public BmSDK.GameObject.EInputEvent Event;
+        [FieldOffset(12)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: ProcessControlKey
     /// </summary>
     public unsafe virtual bool ProcessControlKey(BmSDK.FName Key, BmSDK.GameObject.EInputEvent Event)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.ProcessControlKey", true);
-        byte* paramsPtr = stackalloc byte[16];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Key, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Event, paramsPtr + 8);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 12);
+        var funcManaged = s_ProcessControlKeyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.ProcessControlKey", true);
+        var parms = new ProcessControlKey_Params();
+        parms.Key = Key;
+        parms.Event = Event;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_FlushPlayerInputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct FlushPlayerInput_Params
+    {
     }
 
     /// <summary>
@@ -145,23 +166,44 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void FlushPlayerInput()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.FlushPlayerInput", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_FlushPlayerInputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.FlushPlayerInput", true);
+        var parms = new FlushPlayerInput_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InputCharFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 20)]
+    private struct InputChar_Params
+    {
+        [FieldOffset(0)] public int ControllerId;
+        [FieldOffset(4)] public BmSDK.FString Unicode;
+        [FieldOffset(16)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: InputChar
     /// </summary>
     public unsafe virtual bool InputChar(int ControllerId, BmSDK.FString Unicode)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.InputChar", true);
-        byte* paramsPtr = stackalloc byte[20];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ControllerId, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Unicode, paramsPtr + 4);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 16);
+        var funcManaged = s_InputCharFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.InputChar", true);
+        var parms = new InputChar_Params();
+        parms.ControllerId = ControllerId;
+        parms.Unicode = Unicode;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_InputKeyFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct InputKey_Params
+    {
+        [FieldOffset(0)] public int ControllerId;
+        [FieldOffset(4)] public BmSDK.FName Key;
+        [FieldOffset(12)] public BmSDK.GameObject.EInputEvent Event;
+        [FieldOffset(16)] public float AmountDepressed;
+        [FieldOffset(20)] public int bGamepad;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -169,15 +211,22 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual bool InputKey(int ControllerId, BmSDK.FName Key, BmSDK.GameObject.EInputEvent Event, float AmountDepressed = default, bool bGamepad = default)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.InputKey", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ControllerId, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Key, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Event, paramsPtr + 12);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AmountDepressed, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bGamepad, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_InputKeyFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.InputKey", true);
+        var parms = new InputKey_Params();
+        parms.ControllerId = ControllerId;
+        parms.Key = Key;
+        parms.Event = Event;
+        parms.AmountDepressed = AmountDepressed;
+        parms.bGamepad = bGamepad ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_PostRender_ConsoleFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PostRender_Console_Params
+    {
+        [FieldOffset(0)] public nint Canvas;
     }
 
     /// <summary>
@@ -185,104 +234,158 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void PostRender_Console(BmSDK.Engine.Canvas Canvas)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.PostRender_Console", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Canvas, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PostRender_ConsoleFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.PostRender_Console", true);
+        var parms = new PostRender_Console_Params();
+        parms.Canvas = Canvas?.Ptr ?? 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OutputTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 32)]
+    private struct OutputText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+    }
+
     /// <summary>
     /// Function: OutputText
     /// </summary>
     public unsafe virtual void OutputText(BmSDK.FString Text)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.OutputText", true);
-        byte* paramsPtr = stackalloc byte[32];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OutputTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.OutputText", true);
+        var parms = new OutputText_Params();
+        parms.Text = Text;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_OutputTextLineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct OutputTextLine_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+    }
+
     /// <summary>
     /// Function: OutputTextLine
     /// </summary>
     public unsafe virtual void OutputTextLine(BmSDK.FString Text)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.OutputTextLine", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_OutputTextLineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.OutputTextLine", true);
+        var parms = new OutputTextLine_Params();
+        parms.Text = Text;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ClearOutputFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct ClearOutput_Params
+    {
+    }
+
     /// <summary>
     /// Function: ClearOutput
     /// </summary>
     public unsafe virtual void ClearOutput()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.ClearOutput", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ClearOutputFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.ClearOutput", true);
+        var parms = new ClearOutput_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_ConsoleCommandFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct ConsoleCommand_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Command;
+    }
+
     /// <summary>
     /// Function: ConsoleCommand
     /// </summary>
     public unsafe virtual void ConsoleCommand(BmSDK.FString Command)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.ConsoleCommand", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Command, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_ConsoleCommandFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.ConsoleCommand", true);
+        var parms = new ConsoleCommand_Params();
+        parms.Command = Command;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PurgeCommandFromHistoryFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 24)]
+    private struct PurgeCommandFromHistory_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Command;
+    }
+
     /// <summary>
     /// Function: PurgeCommandFromHistory
     /// </summary>
     public unsafe virtual void PurgeCommandFromHistory(BmSDK.FString Command)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.PurgeCommandFromHistory", true);
-        byte* paramsPtr = stackalloc byte[24];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Command, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_PurgeCommandFromHistoryFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.PurgeCommandFromHistory", true);
+        var parms = new PurgeCommandFromHistory_Params();
+        parms.Command = Command;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetCursorPosFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct SetCursorPos_Params
+    {
+        [FieldOffset(0)] public int Position;
+    }
+
     /// <summary>
     /// Function: SetCursorPos
     /// </summary>
     public unsafe virtual void SetCursorPos(int Position)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.SetCursorPos", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Position, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetCursorPosFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.SetCursorPos", true);
+        var parms = new SetCursorPos_Params();
+        parms.Position = Position;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_SetInputTextFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct SetInputText_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString Text;
+    }
+
     /// <summary>
     /// Function: SetInputText
     /// </summary>
     public unsafe virtual void SetInputText(BmSDK.FString Text)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.SetInputText", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 0);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_SetInputTextFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.SetInputText", true);
+        var parms = new SetInputText_Params();
+        parms.Text = Text;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_InitializedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct Initialized_Params
+    {
+    }
+
     /// <summary>
     /// Function: Initialized
     /// </summary>
     public unsafe override void Initialized()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.Initialized", true);
-        byte* paramsPtr = stackalloc byte[0];
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
+        var funcManaged = s_InitializedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Console.Initialized", true);
+        var parms = new Initialized_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
         return;
     }
 
@@ -295,11 +398,7 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
         /// <summary>
         /// IntProperty: IndexChar
         /// </summary>
-        public unsafe int IndexChar
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public int IndexChar;
 
         /// <summary>
         /// ArrayProperty: AutoCompleteListIndices
@@ -377,8 +476,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName ConsoleKey
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 108); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 108); }
+        get { return *(BmSDK.FName*)(Ptr + 108); }
+        set { *(BmSDK.FName*)(Ptr + 108) = value; }
     }
 
     /// <summary>
@@ -386,8 +485,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.FName TypeKey
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 116); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 116); }
+        get { return *(BmSDK.FName*)(Ptr + 116); }
+        set { *(BmSDK.FName*)(Ptr + 116) = value; }
     }
 
     /// <summary>
@@ -395,8 +494,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxScrollbackSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 124); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 124); }
+        get { return *(int*)(Ptr + 124); }
+        set { *(int*)(Ptr + 124) = value; }
     }
 
     /// <summary>
@@ -413,8 +512,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe int SBHead
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 140); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 140); }
+        get { return *(int*)(Ptr + 140); }
+        set { *(int*)(Ptr + 140) = value; }
     }
 
     /// <summary>
@@ -422,8 +521,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe int SBPos
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 144); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 144); }
+        get { return *(int*)(Ptr + 144); }
+        set { *(int*)(Ptr + 144) = value; }
     }
 
     /// <summary>
@@ -431,8 +530,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe int HistoryTop
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 148); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 148); }
+        get { return *(int*)(Ptr + 148); }
+        set { *(int*)(Ptr + 148) = value; }
     }
 
     /// <summary>
@@ -440,8 +539,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe int HistoryBot
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 152); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 152); }
+        get { return *(int*)(Ptr + 152); }
+        set { *(int*)(Ptr + 152) = value; }
     }
 
     /// <summary>
@@ -449,8 +548,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe int HistoryCur
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 156); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 156); }
+        get { return *(int*)(Ptr + 156); }
+        set { *(int*)(Ptr + 156) = value; }
     }
 
     /// <summary>
@@ -592,8 +691,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bNavigatingHistory
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 352); }
+        get { return (*(int*)(Ptr + 352) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 352) |= 1; else *(int*)(Ptr + 352) &= ~1; }
     }
 
     /// <summary>
@@ -601,8 +700,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCaptureKeyInput
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 352); }
+        get { return (*(int*)(Ptr + 352) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 352) |= 2; else *(int*)(Ptr + 352) &= ~2; }
     }
 
     /// <summary>
@@ -610,8 +709,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCtrl
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 352); }
+        get { return (*(int*)(Ptr + 352) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 352) |= 4; else *(int*)(Ptr + 352) &= ~4; }
     }
 
     /// <summary>
@@ -619,8 +718,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableUI
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 352); }
+        get { return (*(int*)(Ptr + 352) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 352) |= 8; else *(int*)(Ptr + 352) &= ~8; }
     }
 
     /// <summary>
@@ -628,8 +727,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAutoCompleteLocked
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 352); }
+        get { return (*(int*)(Ptr + 352) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 352) |= 16; else *(int*)(Ptr + 352) &= ~16; }
     }
 
     /// <summary>
@@ -637,8 +736,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRequireCtrlToNavigateAutoComplete
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 352); }
+        get { return (*(int*)(Ptr + 352) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 352) |= 32; else *(int*)(Ptr + 352) &= ~32; }
     }
 
     /// <summary>
@@ -646,8 +745,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bIsRuntimeAutoCompleteUpToDate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 352); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 352); }
+        get { return (*(int*)(Ptr + 352) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 352) |= 64; else *(int*)(Ptr + 352) &= ~64; }
     }
 
     /// <summary>
@@ -664,8 +763,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe int TypedStrPos
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 368); }
+        get { return *(int*)(Ptr + 368); }
+        set { *(int*)(Ptr + 368) = value; }
     }
 
     /// <summary>
@@ -691,8 +790,8 @@ public partial class _Console : BmSDK.Engine.Interaction, BmSDK.IGameObject
     /// </summary>
     public unsafe int AutoCompleteIndex
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 396); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 396); }
+        get { return *(int*)(Ptr + 396); }
+        set { *(int*)(Ptr + 396) = value; }
     }
 
     /// <summary>
@@ -73,22 +73,33 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<_Engine>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_GetPhysXLevelFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetPhysXLevel_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetPhysXLevel
     /// </summary>
     public unsafe static int GetPhysXLevel()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetPhysXLevel", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<int>(paramsPtr + 0);
+        var funcManaged = s_GetPhysXLevelFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetPhysXLevel", true);
+        var parms = new GetPhysXLevel_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_BasicLoadObjectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct BasicLoadObject_Params
+    {
+        [FieldOffset(0)] public nint Obj;
+        [FieldOffset(4)] public BmSDK.FString PathName;
+        [FieldOffset(16)] public int bIsSaveGame;
+        [FieldOffset(20)] public int Version;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -96,21 +107,25 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static bool BasicLoadObject(BmSDK.GameObject Obj, BmSDK.FString PathName, bool bIsSaveGame, int Version)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.BasicLoadObject", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Obj, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PathName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsSaveGame, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Version, paramsPtr + 20);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_BasicLoadObjectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.BasicLoadObject", true);
+        var parms = new BasicLoadObject_Params();
+        parms.Obj = Obj?.Ptr ?? 0;
+        parms.PathName = PathName;
+        parms.bIsSaveGame = bIsSaveGame ? 1 : 0;
+        parms.Version = Version;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_BasicSaveObjectFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 28)]
+    private struct BasicSaveObject_Params
+    {
+        [FieldOffset(0)] public nint Obj;
+        [FieldOffset(4)] public BmSDK.FString PathName;
+        [FieldOffset(16)] public int bIsSaveGame;
+        [FieldOffset(20)] public int Version;
+        [FieldOffset(24)] public int ReturnValue;
     }
 
     /// <summary>
@@ -118,21 +133,21 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static bool BasicSaveObject(BmSDK.GameObject Obj, BmSDK.FString PathName, bool bIsSaveGame, int Version)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.BasicSaveObject", true);
-        byte* paramsPtr = stackalloc byte[28];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Obj, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(PathName, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsSaveGame, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Version, paramsPtr + 20);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 24);
+        var funcManaged = s_BasicSaveObjectFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.BasicSaveObject", true);
+        var parms = new BasicSaveObject_Params();
+        parms.Obj = Obj?.Ptr ?? 0;
+        parms.PathName = PathName;
+        parms.bIsSaveGame = bIsSaveGame ? 1 : 0;
+        parms.Version = Version;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_AddTextureStreamingSlaveLocFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct AddTextureStreamingSlaveLoc_Params
+    {
+        [FieldOffset(0)] public System.Numerics.Vector3 InLoc;
     }
 
     /// <summary>
@@ -140,36 +155,36 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe virtual void AddTextureStreamingSlaveLoc(System.Numerics.Vector3 InLoc)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.AddTextureStreamingSlaveLoc", true);
-        byte* paramsPtr = stackalloc byte[12];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(InLoc, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_AddTextureStreamingSlaveLocFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.AddTextureStreamingSlaveLoc", true);
+        var parms = new AddTextureStreamingSlaveLoc_Params();
+        parms.InLoc = InLoc;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_GetWorldPostProcessChainFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetWorldPostProcessChain_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
+    }
+
     /// <summary>
     /// Function: GetWorldPostProcessChain
     /// </summary>
     public unsafe static BmSDK.Engine.PostProcessChain GetWorldPostProcessChain()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetWorldPostProcessChain", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PostProcessChain>(paramsPtr + 0);
+        var funcManaged = s_GetWorldPostProcessChainFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetWorldPostProcessChain", true);
+        var parms = new GetWorldPostProcessChain_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.PostProcessChain)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetEngineFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetEngine_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -177,17 +192,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine._Engine GetEngine()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetEngine", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine._Engine>(paramsPtr + 0);
+        var funcManaged = s_GetEngineFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetEngine", true);
+        var parms = new GetEngine_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine._Engine)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetDebugDataFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetDebugData_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -195,17 +210,23 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.PersistentDebugData GetDebugData()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetDebugData", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.PersistentDebugData>(paramsPtr + 0);
+        var funcManaged = s_GetDebugDataFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetDebugData", true);
+        var parms = new GetDebugData_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.PersistentDebugData)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_AddOverlayWrappedFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct AddOverlayWrapped_Params
+    {
+        [FieldOffset(0)] public nint Font;
+        [FieldOffset(4)] public BmSDK.FString Text;
+        [FieldOffset(16)] public float X;
+        [FieldOffset(20)] public float Y;
+        [FieldOffset(24)] public float ScaleX;
+        [FieldOffset(28)] public float ScaleY;
+        [FieldOffset(32)] public float WrapWidth;
     }
 
     /// <summary>
@@ -213,104 +234,109 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static void AddOverlayWrapped(BmSDK.Engine.Font Font, BmSDK.FString Text, float X, float Y, float ScaleX, float ScaleY, float WrapWidth)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.AddOverlayWrapped", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Font, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScaleX, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScaleY, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(WrapWidth, paramsPtr + 32);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_AddOverlayWrappedFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.AddOverlayWrapped", true);
+        var parms = new AddOverlayWrapped_Params();
+        parms.Font = Font?.Ptr ?? 0;
+        parms.Text = Text;
+        parms.X = X;
+        parms.Y = Y;
+        parms.ScaleX = ScaleX;
+        parms.ScaleY = ScaleY;
+        parms.WrapWidth = WrapWidth;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_AddOverlayFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct AddOverlay_Params
+    {
+        [FieldOffset(0)] public nint Font;
+        [FieldOffset(4)] public BmSDK.FString Text;
+        [FieldOffset(16)] public float X;
+        [FieldOffset(20)] public float Y;
+        [FieldOffset(24)] public float ScaleX;
+        [FieldOffset(28)] public float ScaleY;
+        [FieldOffset(32)] public int bIsCentered;
+    }
+
     /// <summary>
     /// Function: AddOverlay
     /// </summary>
     public unsafe static void AddOverlay(BmSDK.Engine.Font Font, BmSDK.FString Text, float X, float Y, float ScaleX, float ScaleY, bool bIsCentered)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.AddOverlay", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Font, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Text, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(X, paramsPtr + 16);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Y, paramsPtr + 20);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScaleX, paramsPtr + 24);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(ScaleY, paramsPtr + 28);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bIsCentered, paramsPtr + 32);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_AddOverlayFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.AddOverlay", true);
+        var parms = new AddOverlay_Params();
+        parms.Font = Font?.Ptr ?? 0;
+        parms.Text = Text;
+        parms.X = X;
+        parms.Y = Y;
+        parms.ScaleX = ScaleX;
+        parms.ScaleY = ScaleY;
+        parms.bIsCentered = bIsCentered ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_RemoveAllOverlaysFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 0)]
+    private struct RemoveAllOverlays_Params
+    {
+    }
+
     /// <summary>
     /// Function: RemoveAllOverlays
     /// </summary>
     public unsafe static void RemoveAllOverlays()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.RemoveAllOverlays", true);
-        byte* paramsPtr = stackalloc byte[0];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_RemoveAllOverlaysFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.RemoveAllOverlays", true);
+        var parms = new RemoveAllOverlays_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_StopMovieFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct StopMovie_Params
+    {
+        [FieldOffset(0)] public int bDelayStopUntilGameHasRendered;
+    }
+
     /// <summary>
     /// Function: StopMovie
     /// </summary>
     public unsafe static void StopMovie(bool bDelayStopUntilGameHasRendered)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.StopMovie", true);
-        byte* paramsPtr = stackalloc byte[4];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(bDelayStopUntilGameHasRendered, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
+        var funcManaged = s_StopMovieFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.StopMovie", true);
+        var parms = new StopMovie_Params();
+        parms.bDelayStopUntilGameHasRendered = bDelayStopUntilGameHasRendered ? 1 : 0;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
         return;
     }
 
+    static BmSDK.Function s_PlayLoadMapMovieFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct PlayLoadMapMovie_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: PlayLoadMapMovie
     /// </summary>
     public unsafe static bool PlayLoadMapMovie()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.PlayLoadMapMovie", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_PlayLoadMapMovieFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.PlayLoadMapMovie", true);
+        var parms = new PlayLoadMapMovie_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetLastMovieNameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetLastMovieName_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -318,17 +344,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.FString GetLastMovieName()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetLastMovieName", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetLastMovieNameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetLastMovieName", true);
+        var parms = new GetLastMovieName_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetAudioDeviceFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetAudioDevice_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -336,17 +362,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.AudioDevice GetAudioDevice()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetAudioDevice", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.AudioDevice>(paramsPtr + 0);
+        var funcManaged = s_GetAudioDeviceFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetAudioDevice", true);
+        var parms = new GetAudioDevice_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.AudioDevice)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsSplitScreenFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsSplitScreen_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -354,17 +380,18 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static bool IsSplitScreen()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.IsSplitScreen", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsSplitScreenFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.IsSplitScreen", true);
+        var parms = new IsSplitScreen_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_GetAdditionalFontFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 8)]
+    private struct GetAdditionalFont_Params
+    {
+        [FieldOffset(0)] public int AdditionalFontIndex;
+        [FieldOffset(4)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -372,18 +399,18 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.Font GetAdditionalFont(int AdditionalFontIndex)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetAdditionalFont", true);
-        byte* paramsPtr = stackalloc byte[8];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(AdditionalFontIndex, paramsPtr + 0);
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Font>(paramsPtr + 4);
+        var funcManaged = s_GetAdditionalFontFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetAdditionalFont", true);
+        var parms = new GetAdditionalFont_Params();
+        parms.AdditionalFontIndex = AdditionalFontIndex;
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Font)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetSubtitleFontFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSubtitleFont_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -391,17 +418,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.Font GetSubtitleFont()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetSubtitleFont", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Font>(paramsPtr + 0);
+        var funcManaged = s_GetSubtitleFontFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetSubtitleFont", true);
+        var parms = new GetSubtitleFont_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Font)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetLargeFontFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetLargeFont_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -409,17 +436,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.Font GetLargeFont()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetLargeFont", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Font>(paramsPtr + 0);
+        var funcManaged = s_GetLargeFontFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetLargeFont", true);
+        var parms = new GetLargeFont_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Font)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetMediumFontFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetMediumFont_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -427,17 +454,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.Font GetMediumFont()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetMediumFont", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Font>(paramsPtr + 0);
+        var funcManaged = s_GetMediumFontFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetMediumFont", true);
+        var parms = new GetMediumFont_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Font)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetSmallFontFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetSmallFont_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -445,17 +472,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.Font GetSmallFont()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetSmallFont", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Font>(paramsPtr + 0);
+        var funcManaged = s_GetSmallFontFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetSmallFont", true);
+        var parms = new GetSmallFont_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Font)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetTinyFontFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetTinyFont_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -463,17 +490,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.Font GetTinyFont()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetTinyFont", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.Font>(paramsPtr + 0);
+        var funcManaged = s_GetTinyFontFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetTinyFont", true);
+        var parms = new GetTinyFont_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.Font)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_GetBuildDateFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 12)]
+    private struct GetBuildDate_Params
+    {
+        [FieldOffset(0)] public BmSDK.FString ReturnValue;
     }
 
     /// <summary>
@@ -481,17 +508,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.FString GetBuildDate()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetBuildDate", true);
-        byte* paramsPtr = stackalloc byte[12];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FString>(paramsPtr + 0);
+        var funcManaged = s_GetBuildDateFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetBuildDate", true);
+        var parms = new GetBuildDate_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue;
+    }
+
+    static BmSDK.Function s_GetCurrentWorldInfoFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct GetCurrentWorldInfo_Params
+    {
+        [FieldOffset(0)] public nint ReturnValue;
     }
 
     /// <summary>
@@ -499,17 +526,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static BmSDK.Engine.WorldInfo GetCurrentWorldInfo()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetCurrentWorldInfo", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine.WorldInfo>(paramsPtr + 0);
+        var funcManaged = s_GetCurrentWorldInfoFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.GetCurrentWorldInfo", true);
+        var parms = new GetCurrentWorldInfo_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue == 0 ? null : (BmSDK.Engine.WorldInfo)BmSDK.Framework.MarshalUtil.GetOrCreateWrapper(parms.ReturnValue);
+    }
+
+    static BmSDK.Function s_IsGameFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsGame_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -517,17 +544,17 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static bool IsGame()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.IsGame", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsGameFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.IsGame", true);
+        var parms = new IsGame_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
+    }
+
+    static BmSDK.Function s_IsEditorFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 4)]
+    private struct IsEditor_Params
+    {
+        [FieldOffset(0)] public int ReturnValue;
     }
 
     /// <summary>
@@ -535,17 +562,10 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe static bool IsEditor()
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.IsEditor", true);
-        byte* paramsPtr = stackalloc byte[4];
-        var oldFlags = funcManaged.FunctionFlags;
-        var oldNative = funcManaged.iNative;
-        funcManaged.FunctionFlags &= ~BmSDK.Function.EFunctionFlags.FUNC_Native;
-        funcManaged.FunctionFlags |= BmSDK.Function.EFunctionFlags.FUNC_Defined;
-        funcManaged.iNative = 0;
-        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        funcManaged.iNative = oldNative;
-        funcManaged.FunctionFlags = oldFlags;
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 0);
+        var funcManaged = s_IsEditorFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "Engine.Engine.IsEditor", true);
+        var parms = new IsEditor_Params();
+        BmSDK.Framework.GameFunctions.ProcessEvent(StaticClass().DefaultObject.Ptr, funcManaged.ScriptCallablePtr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 
     /// <summary>
@@ -557,20 +577,12 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
         /// <summary>
         /// StructProperty: Location
         /// </summary>
-        public unsafe System.Numerics.Vector3 Location
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<System.Numerics.Vector3>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public System.Numerics.Vector3 Location;
 
         /// <summary>
         /// StructProperty: Rotation
         /// </summary>
-        public unsafe BmSDK.Rotator Rotation
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Rotator>(Ptr + 12); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 12); }; }
-        }
+        [FieldOffset(12)] public BmSDK.Rotator Rotation;
 
         /// <summary>
         /// StrProperty: Comment
@@ -602,6 +614,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     [StructLayout(LayoutKind.Explicit, Size = 28)]
     public partial record struct FStatColorMapping
     {
+        [FieldOffset(24)] private int _bitfield24;
+
         /// <summary>
         /// StrProperty: StatName
         /// </summary>
@@ -623,10 +637,10 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
         /// <summary>
         /// BoolProperty: DisableBlend
         /// </summary>
-        public unsafe bool DisableBlend
+        public bool DisableBlend
         {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24) & 1) != 0; }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 24); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 24); }; }
+            readonly get => (_bitfield24 & 1) != 0;
+            set { if (value) _bitfield24 |= 1; else _bitfield24 &= ~1; }
         }
     }
 
@@ -639,20 +653,12 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
         /// <summary>
         /// FloatProperty: In
         /// </summary>
-        public unsafe float In
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 0); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 0); }; }
-        }
+        [FieldOffset(0)] public float In;
 
         /// <summary>
         /// StructProperty: Out
         /// </summary>
-        public unsafe BmSDK.GameObject.FColor Out
-        {
-            get { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.GameObject.FColor>(Ptr + 4); }; }
-            set { fixed (void* thisPtr = &this) { IntPtr Ptr = (IntPtr)thisPtr; BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 4); }; }
-        }
+        [FieldOffset(4)] public BmSDK.GameObject.FColor Out;
     }
 
     /// <summary>
@@ -1308,8 +1314,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ProcBuildingLODColorTexelsPerWorldUnit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 632); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 632); }
+        get { return *(float*)(Ptr + 632); }
+        set { *(float*)(Ptr + 632) = value; }
     }
 
     /// <summary>
@@ -1317,8 +1323,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ProcBuildingLODLightingTexelsPerWorldUnit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 636); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 636); }
+        get { return *(float*)(Ptr + 636); }
+        set { *(float*)(Ptr + 636) = value; }
     }
 
     /// <summary>
@@ -1326,8 +1332,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxProcBuildingLODColorTextureSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 640); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 640); }
+        get { return *(int*)(Ptr + 640); }
+        set { *(int*)(Ptr + 640) = value; }
     }
 
     /// <summary>
@@ -1335,8 +1341,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxProcBuildingLODLightingTextureSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 644); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 644); }
+        get { return *(int*)(Ptr + 644); }
+        set { *(int*)(Ptr + 644) = value; }
     }
 
     /// <summary>
@@ -1344,8 +1350,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool UseProcBuildingLODTextureCropping
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 1; else *(int*)(Ptr + 648) &= ~1; }
     }
 
     /// <summary>
@@ -1353,8 +1359,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool ForcePowerOfTwoProcBuildingLODTextures
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 2; else *(int*)(Ptr + 648) &= ~2; }
     }
 
     /// <summary>
@@ -1362,8 +1368,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCombineSimilarMappings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 4; else *(int*)(Ptr + 648) &= ~4; }
     }
 
     /// <summary>
@@ -1371,8 +1377,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRenderLightMapDensityGrayscale
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 8; else *(int*)(Ptr + 648) &= ~8; }
     }
 
     /// <summary>
@@ -1380,8 +1386,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseSound
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 16; else *(int*)(Ptr + 648) &= ~16; }
     }
 
     /// <summary>
@@ -1389,8 +1395,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseBackgroundLevelStreaming
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 32; else *(int*)(Ptr + 648) &= ~32; }
     }
 
     /// <summary>
@@ -1398,8 +1404,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSubtitlesEnabled
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 64; else *(int*)(Ptr + 648) &= ~64; }
     }
 
     /// <summary>
@@ -1407,8 +1413,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSubtitlesForcedOff
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 128; else *(int*)(Ptr + 648) &= ~128; }
     }
 
     /// <summary>
@@ -1416,8 +1422,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSmoothFrameRate
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 256; else *(int*)(Ptr + 648) &= ~256; }
     }
 
     /// <summary>
@@ -1425,8 +1431,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool OASecondsToToggleDebugCamera
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 512) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 512) : (currentMask & ~512); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 512) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 512; else *(int*)(Ptr + 648) &= ~512; }
     }
 
     /// <summary>
@@ -1434,8 +1440,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool HACK_UseTickFrequency
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 1024) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 1024) : (currentMask & ~1024); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 1024) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 1024; else *(int*)(Ptr + 648) &= ~1024; }
     }
 
     /// <summary>
@@ -1443,8 +1449,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool HACK_EnableDMC
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 2048) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 2048) : (currentMask & ~2048); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 2048) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 2048; else *(int*)(Ptr + 648) &= ~2048; }
     }
 
     /// <summary>
@@ -1452,8 +1458,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bShouldGenerateSimpleLightmaps
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 4096) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 4096) : (currentMask & ~4096); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 4096) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 4096; else *(int*)(Ptr + 648) &= ~4096; }
     }
 
     /// <summary>
@@ -1461,8 +1467,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceStaticTerrain
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 8192) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 8192) : (currentMask & ~8192); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 8192) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 8192; else *(int*)(Ptr + 648) &= ~8192; }
     }
 
     /// <summary>
@@ -1470,8 +1476,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUseInvertedLeftStick
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 16384) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 16384) : (currentMask & ~16384); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 16384) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 16384; else *(int*)(Ptr + 648) &= ~16384; }
     }
 
     /// <summary>
@@ -1479,8 +1485,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool HackJoystickIdsForMultiPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 32768) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 32768) : (currentMask & ~32768); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 32768) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 32768; else *(int*)(Ptr + 648) &= ~32768; }
     }
 
     /// <summary>
@@ -1488,8 +1494,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool AllowControllerInputWithoutFocus
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 65536) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 65536) : (currentMask & ~65536); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 65536) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 65536; else *(int*)(Ptr + 648) &= ~65536; }
     }
 
     /// <summary>
@@ -1497,8 +1503,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bForceCPUSkinning
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 131072) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 131072) : (currentMask & ~131072); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 131072) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 131072; else *(int*)(Ptr + 648) &= ~131072; }
     }
 
     /// <summary>
@@ -1506,8 +1512,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUsePostProcessEffects
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 262144) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 262144) : (currentMask & ~262144); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 262144) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 262144; else *(int*)(Ptr + 648) &= ~262144; }
     }
 
     /// <summary>
@@ -1515,8 +1521,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bOnScreenKismetWarnings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 524288) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 524288) : (currentMask & ~524288); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 524288) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 524288; else *(int*)(Ptr + 648) &= ~524288; }
     }
 
     /// <summary>
@@ -1524,8 +1530,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableKismetLogging
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 1048576) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 1048576) : (currentMask & ~1048576); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 1048576) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 1048576; else *(int*)(Ptr + 648) &= ~1048576; }
     }
 
     /// <summary>
@@ -1533,8 +1539,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAllowMatureLanguage
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 2097152) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 2097152) : (currentMask & ~2097152); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 2097152) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 2097152; else *(int*)(Ptr + 648) &= ~2097152; }
     }
 
     /// <summary>
@@ -1542,8 +1548,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bRenderTerrainCollisionAsOverlay
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 4194304) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 4194304) : (currentMask & ~4194304); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 4194304) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 4194304; else *(int*)(Ptr + 648) &= ~4194304; }
     }
 
     /// <summary>
@@ -1551,8 +1557,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bPauseOnLossOfFocus
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 8388608) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 8388608) : (currentMask & ~8388608); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 8388608) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 8388608; else *(int*)(Ptr + 648) &= ~8388608; }
     }
 
     /// <summary>
@@ -1560,8 +1566,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCheckParticleRenderSize
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 16777216) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 16777216) : (currentMask & ~16777216); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 16777216) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 16777216; else *(int*)(Ptr + 648) &= ~16777216; }
     }
 
     /// <summary>
@@ -1569,8 +1575,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisplayDebugAudio
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 33554432) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 33554432) : (currentMask & ~33554432); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 33554432) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 33554432; else *(int*)(Ptr + 648) &= ~33554432; }
     }
 
     /// <summary>
@@ -1578,8 +1584,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisplayDebugAI
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 67108864) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 67108864) : (currentMask & ~67108864); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 67108864) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 67108864; else *(int*)(Ptr + 648) &= ~67108864; }
     }
 
     /// <summary>
@@ -1587,8 +1593,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisplayDebugPlayer
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 134217728) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 134217728) : (currentMask & ~134217728); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 134217728) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 134217728; else *(int*)(Ptr + 648) &= ~134217728; }
     }
 
     /// <summary>
@@ -1596,8 +1602,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisplayDebugBoss
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 268435456) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 268435456) : (currentMask & ~268435456); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 268435456) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 268435456; else *(int*)(Ptr + 648) &= ~268435456; }
     }
 
     /// <summary>
@@ -1605,8 +1611,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnablePerfMemDump
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 536870912) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 536870912) : (currentMask & ~536870912); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 536870912) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 536870912; else *(int*)(Ptr + 648) &= ~536870912; }
     }
 
     /// <summary>
@@ -1614,8 +1620,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableColorClear
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & 1073741824) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | 1073741824) : (currentMask & ~1073741824); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & 1073741824) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= 1073741824; else *(int*)(Ptr + 648) &= ~1073741824; }
     }
 
     /// <summary>
@@ -1623,8 +1629,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bAreConstraintsDirty
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648) & -2147483648) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 648); var newMask = value ? (currentMask | -2147483648) : (currentMask & ~-2147483648); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 648); }
+        get { return (*(int*)(Ptr + 648) & -2147483648) != 0; }
+        set { if (value) *(int*)(Ptr + 648) |= -2147483648; else *(int*)(Ptr + 648) &= ~-2147483648; }
     }
 
     /// <summary>
@@ -1632,8 +1638,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bHasPendingGlobalReattach
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 1) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 1) : (currentMask & ~1); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 1) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 1; else *(int*)(Ptr + 652) &= ~1; }
     }
 
     /// <summary>
@@ -1641,8 +1647,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEmulateMobileRendering
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 2) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 2) : (currentMask & ~2); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 2) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 2; else *(int*)(Ptr + 652) &= ~2; }
     }
 
     /// <summary>
@@ -1650,8 +1656,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bUnboundActiveController
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 4) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 4) : (currentMask & ~4); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 4) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 4; else *(int*)(Ptr + 652) &= ~4; }
     }
 
     /// <summary>
@@ -1659,8 +1665,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bPausedCheck
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 8) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 8) : (currentMask & ~8); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 8) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 8; else *(int*)(Ptr + 652) &= ~8; }
     }
 
     /// <summary>
@@ -1668,8 +1674,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableOnScreenDebugMessages
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 16) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 16) : (currentMask & ~16); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 16) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 16; else *(int*)(Ptr + 652) &= ~16; }
     }
 
     /// <summary>
@@ -1677,8 +1683,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bEnableOnScreenDebugMessagesDisplay
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 32) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 32) : (currentMask & ~32); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 32) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 32; else *(int*)(Ptr + 652) &= ~32; }
     }
 
     /// <summary>
@@ -1686,8 +1692,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bSuppressMapWarnings
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 64) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 64) : (currentMask & ~64); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 64) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 64; else *(int*)(Ptr + 652) &= ~64; }
     }
 
     /// <summary>
@@ -1695,8 +1701,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bCookSeparateSharedMPGameContent
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 128) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 128) : (currentMask & ~128); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 128) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 128; else *(int*)(Ptr + 652) &= ~128; }
     }
 
     /// <summary>
@@ -1704,8 +1710,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe bool bDisableAILogging
     {
-        get { return (BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652) & 256) != 0; }
-        set { var currentMask = BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 652); var newMask = value ? (currentMask | 256) : (currentMask & ~256); BmSDK.Framework.MarshalUtil.ToUnmanaged<int>(newMask, Ptr + 652); }
+        get { return (*(int*)(Ptr + 652) & 256) != 0; }
+        set { if (value) *(int*)(Ptr + 652) |= 256; else *(int*)(Ptr + 652) &= ~256; }
     }
 
     /// <summary>
@@ -1713,8 +1719,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxRMSDForCombiningMappings
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 656); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 656); }
+        get { return *(float*)(Ptr + 656); }
+        set { *(float*)(Ptr + 656) = value; }
     }
 
     /// <summary>
@@ -1722,8 +1728,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int ImageReflectionTextureSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 660); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 660); }
+        get { return *(int*)(Ptr + 660); }
+        set { *(int*)(Ptr + 660) = value; }
     }
 
     /// <summary>
@@ -1755,8 +1761,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxPixelShaderAdditiveComplexityCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 704); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 704); }
+        get { return *(float*)(Ptr + 704); }
+        set { *(float*)(Ptr + 704) = value; }
     }
 
     /// <summary>
@@ -1764,8 +1770,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinTextureDensity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 708); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 708); }
+        get { return *(float*)(Ptr + 708); }
+        set { *(float*)(Ptr + 708) = value; }
     }
 
     /// <summary>
@@ -1773,8 +1779,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float IdealTextureDensity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 712); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 712); }
+        get { return *(float*)(Ptr + 712); }
+        set { *(float*)(Ptr + 712) = value; }
     }
 
     /// <summary>
@@ -1782,8 +1788,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxTextureDensity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 716); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 716); }
+        get { return *(float*)(Ptr + 716); }
+        set { *(float*)(Ptr + 716) = value; }
     }
 
     /// <summary>
@@ -1791,8 +1797,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinLightMapDensity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 720); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 720); }
+        get { return *(float*)(Ptr + 720); }
+        set { *(float*)(Ptr + 720) = value; }
     }
 
     /// <summary>
@@ -1800,8 +1806,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float IdealLightMapDensity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 724); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 724); }
+        get { return *(float*)(Ptr + 724); }
+        set { *(float*)(Ptr + 724) = value; }
     }
 
     /// <summary>
@@ -1809,8 +1815,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxLightMapDensity
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 728); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 728); }
+        get { return *(float*)(Ptr + 728); }
+        set { *(float*)(Ptr + 728) = value; }
     }
 
     /// <summary>
@@ -1818,8 +1824,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float RenderLightMapDensityGrayscaleScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 732); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 732); }
+        get { return *(float*)(Ptr + 732); }
+        set { *(float*)(Ptr + 732) = value; }
     }
 
     /// <summary>
@@ -1827,8 +1833,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float RenderLightMapDensityColorScale
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 736); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 736); }
+        get { return *(float*)(Ptr + 736); }
+        set { *(float*)(Ptr + 736) = value; }
     }
 
     /// <summary>
@@ -1911,8 +1917,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int ApexDestructibleCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 832); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 832); }
+        get { return *(int*)(Ptr + 832); }
+        set { *(int*)(Ptr + 832) = value; }
     }
 
     /// <summary>
@@ -1938,8 +1944,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int TerrainMaterialMaxTextureCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 852); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 852); }
+        get { return *(int*)(Ptr + 852); }
+        set { *(int*)(Ptr + 852) = value; }
     }
 
     /// <summary>
@@ -1947,8 +1953,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int TerrainTessellationCheckCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 856); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 856); }
+        get { return *(int*)(Ptr + 856); }
+        set { *(int*)(Ptr + 856) = value; }
     }
 
     /// <summary>
@@ -1956,8 +1962,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float TerrainTessellationCheckDistance
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 860); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 860); }
+        get { return *(float*)(Ptr + 860); }
+        set { *(float*)(Ptr + 860) = value; }
     }
 
     /// <summary>
@@ -2316,8 +2322,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float TimeBetweenPurgingPendingKillObjects
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1172); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1172); }
+        get { return *(float*)(Ptr + 1172); }
+        set { *(float*)(Ptr + 1172) = value; }
     }
 
     /// <summary>
@@ -2361,8 +2367,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int TickCycles
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1208); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1208); }
+        get { return *(int*)(Ptr + 1208); }
+        set { *(int*)(Ptr + 1208) = value; }
     }
 
     /// <summary>
@@ -2370,8 +2376,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int GameCycles
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1212); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1212); }
+        get { return *(int*)(Ptr + 1212); }
+        set { *(int*)(Ptr + 1212) = value; }
     }
 
     /// <summary>
@@ -2379,8 +2385,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int ClientCycles
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1216); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1216); }
+        get { return *(int*)(Ptr + 1216); }
+        set { *(int*)(Ptr + 1216) = value; }
     }
 
     /// <summary>
@@ -2388,8 +2394,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxSmoothedFrameRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1220); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1220); }
+        get { return *(float*)(Ptr + 1220); }
+        set { *(float*)(Ptr + 1220) = value; }
     }
 
     /// <summary>
@@ -2397,8 +2403,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MinSmoothedFrameRate
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1224); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1224); }
+        get { return *(float*)(Ptr + 1224); }
+        set { *(float*)(Ptr + 1224) = value; }
     }
 
     /// <summary>
@@ -2406,8 +2412,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr RemoteControlExec
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 1228); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1228); }
+        get { return *(System.IntPtr*)(Ptr + 1228); }
+        set { *(System.IntPtr*)(Ptr + 1228) = value; }
     }
 
     /// <summary>
@@ -2415,8 +2421,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr MobileMaterialEmulator
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 1232); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1232); }
+        get { return *(System.IntPtr*)(Ptr + 1232); }
+        set { *(System.IntPtr*)(Ptr + 1232) = value; }
     }
 
     /// <summary>
@@ -2502,8 +2508,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float StreamingDistanceFactor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1288); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1288); }
+        get { return *(float*)(Ptr + 1288); }
+        set { *(float*)(Ptr + 1288) = value; }
     }
 
     /// <summary>
@@ -2520,8 +2526,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe BmSDK.Engine._Engine.ETransitionType TransitionType
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.Engine._Engine.ETransitionType>(Ptr + 1304); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1304); }
+        get { return *(BmSDK.Engine._Engine.ETransitionType*)(Ptr + 1304); }
+        set { *(BmSDK.Engine._Engine.ETransitionType*)(Ptr + 1304) = value; }
     }
 
     /// <summary>
@@ -2547,8 +2553,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MeshLODRange
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1332); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1332); }
+        get { return *(float*)(Ptr + 1332); }
+        set { *(float*)(Ptr + 1332) = value; }
     }
 
     /// <summary>
@@ -2556,8 +2562,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float CameraRotationThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1336); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1336); }
+        get { return *(float*)(Ptr + 1336); }
+        set { *(float*)(Ptr + 1336) = value; }
     }
 
     /// <summary>
@@ -2565,8 +2571,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float CameraTranslationThreshold
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1340); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1340); }
+        get { return *(float*)(Ptr + 1340); }
+        set { *(float*)(Ptr + 1340) = value; }
     }
 
     /// <summary>
@@ -2574,8 +2580,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float PrimitiveProbablyVisibleTime
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1344); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1344); }
+        get { return *(float*)(Ptr + 1344); }
+        set { *(float*)(Ptr + 1344) = value; }
     }
 
     /// <summary>
@@ -2583,8 +2589,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float PercentUnoccludedRequeries
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1348); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1348); }
+        get { return *(float*)(Ptr + 1348); }
+        set { *(float*)(Ptr + 1348) = value; }
     }
 
     /// <summary>
@@ -2592,8 +2598,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxOcclusionPixelsFraction
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1352); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1352); }
+        get { return *(float*)(Ptr + 1352); }
+        set { *(float*)(Ptr + 1352) = value; }
     }
 
     /// <summary>
@@ -2601,8 +2607,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int PhysXLevel
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1356); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1356); }
+        get { return *(int*)(Ptr + 1356); }
+        set { *(int*)(Ptr + 1356) = value; }
     }
 
     /// <summary>
@@ -2610,8 +2616,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float ClothingOffset
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1360); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1360); }
+        get { return *(float*)(Ptr + 1360); }
+        set { *(float*)(Ptr + 1360) = value; }
     }
 
     /// <summary>
@@ -2619,8 +2625,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxFluidNumVerts
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1364); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1364); }
+        get { return *(int*)(Ptr + 1364); }
+        set { *(int*)(Ptr + 1364) = value; }
     }
 
     /// <summary>
@@ -2628,8 +2634,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float FluidSimulationTimeLimit
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1368); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1368); }
+        get { return *(float*)(Ptr + 1368); }
+        set { *(float*)(Ptr + 1368) = value; }
     }
 
     /// <summary>
@@ -2637,8 +2643,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxParticleResize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1372); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1372); }
+        get { return *(int*)(Ptr + 1372); }
+        set { *(int*)(Ptr + 1372) = value; }
     }
 
     /// <summary>
@@ -2646,8 +2652,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxParticleResizeWarn
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1376); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1376); }
+        get { return *(int*)(Ptr + 1376); }
+        set { *(int*)(Ptr + 1376) = value; }
     }
 
     /// <summary>
@@ -2655,8 +2661,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxParticleVertexMemory
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1380); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1380); }
+        get { return *(int*)(Ptr + 1380); }
+        set { *(int*)(Ptr + 1380) = value; }
     }
 
     /// <summary>
@@ -2664,8 +2670,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxParticleSpriteCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1384); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1384); }
+        get { return *(int*)(Ptr + 1384); }
+        set { *(int*)(Ptr + 1384) = value; }
     }
 
     /// <summary>
@@ -2673,8 +2679,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int MaxParticleSubUVCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1388); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1388); }
+        get { return *(int*)(Ptr + 1388); }
+        set { *(int*)(Ptr + 1388) = value; }
     }
 
     /// <summary>
@@ -2682,8 +2688,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int BeginUPTryCount
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1392); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1392); }
+        get { return *(int*)(Ptr + 1392); }
+        set { *(int*)(Ptr + 1392) = value; }
     }
 
     /// <summary>
@@ -2709,8 +2715,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float NetClientTicksPerSecond
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1420); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1420); }
+        get { return *(float*)(Ptr + 1420); }
+        set { *(float*)(Ptr + 1420) = value; }
     }
 
     /// <summary>
@@ -2718,8 +2724,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float MaxTrackedOcclusionIncrement
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1424); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1424); }
+        get { return *(float*)(Ptr + 1424); }
+        set { *(float*)(Ptr + 1424) = value; }
     }
 
     /// <summary>
@@ -2727,8 +2733,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe float TrackedOcclusionStepSize
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<float>(Ptr + 1428); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1428); }
+        get { return *(float*)(Ptr + 1428); }
+        set { *(float*)(Ptr + 1428) = value; }
     }
 
     /// <summary>
@@ -2781,8 +2787,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int FrameRateLimitingSetting
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1460); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1460); }
+        get { return *(int*)(Ptr + 1460); }
+        set { *(int*)(Ptr + 1460) = value; }
     }
 
     /// <summary>
@@ -2823,8 +2829,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe int ScreenSaverInhibitorSemaphore
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 1540); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1540); }
+        get { return *(int*)(Ptr + 1540); }
+        set { *(int*)(Ptr + 1540) = value; }
     }
 
     /// <summary>
@@ -2832,8 +2838,8 @@ public partial class _Engine : BmSDK.Subsystem, BmSDK.IGameObject
     /// </summary>
     public unsafe System.IntPtr ScreenSaverInhibitor
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<System.IntPtr>(Ptr + 1544); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 1544); }
+        get { return *(System.IntPtr*)(Ptr + 1544); }
+        set { *(System.IntPtr*)(Ptr + 1544) = value; }
     }
 
     /// <summary>
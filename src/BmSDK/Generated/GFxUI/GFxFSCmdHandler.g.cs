@@ -73,18 +73,29 @@ public partial class GFxFSCmdHandler : BmSDK.GameObject, BmSDK.IGameObject
         where TComponent : class, Framework.IScriptComponent<GFxFSCmdHandler>
         => ((GameObject)this).DetachScriptComponents(typeof(TComponent));
 
+    static BmSDK.Function s_FSCommandFunc = null;
+    [StructLayout(LayoutKind.Explicit, Size = 36)]
+    private struct FSCommand_Params
+    {
+        [FieldOffset(0)] public nint Movie;
+        [FieldOffset(4)] public nint Event;
+        [FieldOffset(8)] public BmSDK.FString Cmd;
+        [FieldOffset(20)] public BmSDK.FString Arg;
+        [FieldOffset(32)] public int ReturnValue;
+    }
+
     /// <summary>
     /// Function: FSCommand
     /// </summary>
     public unsafe virtual bool FSCommand(BmSDK.GFxUI.GFxMoviePlayer Movie, BmSDK.GFxUI.GFxEvent_FSCommand Event, BmSDK.FString Cmd, BmSDK.FString Arg)
     {
-        var funcManaged = BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "GFxUI.GFxFSCmdHandler.FSCommand", true);
-        byte* paramsPtr = stackalloc byte[36];
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Movie, paramsPtr + 0);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Event, paramsPtr + 4);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Cmd, paramsPtr + 8);
-        BmSDK.Framework.MarshalUtil.ToUnmanaged(Arg, paramsPtr + 20);
-        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)paramsPtr, 0);
-        return BmSDK.Framework.MarshalUtil.ToManaged<bool>(paramsPtr + 32);
+        var funcManaged = s_FSCommandFunc ??= BmSDK.GameObject.StaticFindObjectChecked<BmSDK.Function>(BmSDK.Function.StaticClass(), null, "GFxUI.GFxFSCmdHandler.FSCommand", true);
+        var parms = new FSCommand_Params();
+        parms.Movie = Movie?.Ptr ?? 0;
+        parms.Event = Event?.Ptr ?? 0;
+        parms.Cmd = Cmd;
+        parms.Arg = Arg;
+        BmSDK.Framework.GameFunctions.ProcessEvent(Ptr, funcManaged.Ptr, (nint)(&parms), 0);
+        return parms.ReturnValue != 0;
     }
 }
@@ -83,8 +83,8 @@ public partial class ClientBeaconAddressResolver : BmSDK.GameObject, BmSDK.IGame
     /// </summary>
     public unsafe int BeaconPort
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<int>(Ptr + 44); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 44); }
+        get { return *(int*)(Ptr + 44); }
+        set { *(int*)(Ptr + 44) = value; }
     }
 
     /// <summary>
@@ -92,7 +92,7 @@ public partial class ClientBeaconAddressResolver : BmSDK.GameObject, BmSDK.IGame
     /// </summary>
     public unsafe BmSDK.FName BeaconName
     {
-        get { return BmSDK.Framework.MarshalUtil.ToManaged<BmSDK.FName>(Ptr + 48); }
-        set { BmSDK.Framework.MarshalUtil.ToUnmanaged(value, Ptr + 48); }
+        get { return *(BmSDK.FName*)(Ptr + 48); }
+        set { *(BmSDK.FName*)(Ptr + 48) = value; }
     }
 }
@@ -23,14 +23,21 @@ internal static class Loader
     private static GameFunctions.ConditionalDestroyDelegate? _ConditionalDestroyDetourBase = null;
 
     /// <summary>
-    /// Main .NET entry point, called from BmSDK.Host.
+    /// Main .NET entry point, called from BmSDK.Host with its table of engine functions.
     /// This is done when FEngineLoop::PreInit() is executed.
     /// </summary>
     [UnmanagedCallersOnly]
-    public static void GuardedDllMain() => Debug.RunWithSender("Loader", () => RunGuarded(DllMain));
+    public static unsafe void GuardedDllMain(NativeApi* api)
+    {
+        var apiPtr = (IntPtr)api;
+        Debug.RunWithSender("Loader", () => RunGuarded(() => DllMain((NativeApi*)apiPtr)));
+    }
 
-    private static void DllMain()
+    private static unsafe void DllMain(NativeApi* api)
     {
+        // Everything below may call into the engine
+        NativeApi.Init(api);
+
         EngineSynchronizationContext.InitOnThread();
 
         // Environment.CurrentDirectory gets unreliable once we start
@@ -46,43 +53,67 @@ internal static class Loader
         // Register BmSDK's internal redirectors.
         RedirectManager.Global.RegisterRedirectors(typeof(Loader).Assembly);
 
-        // Create function detours
-        _EngineTickDetourBase = DetourUtil.NewDetour<GameFunctions.EngineTickDelegate>(
-            GameInfo.FuncOffsets.EngineTick,
-            EngineTickDetour
-        );
-
-        _ProcessInternalDetourBase = DetourUtil.NewDetour<GameFunctions.ProcessInternalDelegate>(
-            GameInfo.FuncOffsets.ProcessInternal,
-            ProcessInternalDetour
-        );
-
-        _ProcessDeferredMessageDetourBase =
-            DetourUtil.NewDetour<GameFunctions.ProcessDeferredMessageDelegate>(
-                GameInfo.FuncOffsets.ProcessDeferredMessage,
-                ProcessDeferredMessageDetour
+        // Create function detours. They're installed in one transaction, so the game's
+        // threads are only suspended once.
+        DetourUtil.BeginBatch();
+        try
+        {
+            var engineTickDetour = DetourUtil.QueueDetourAt<GameFunctions.EngineTickDelegate>(
+                api->EngineTick,
+                EngineTickDetour
             );
 
-        _AddObjectDelegateDetourBase = DetourUtil.NewDetour<GameFunctions.AddObjectDelegate>(
-            GameInfo.FuncOffsets.AddObject,
-            AddObjectDetour
-        );
+            // Installed natively, so calls nothing listens to don't have to enter .NET
+            ProcessInternalFilter.AddHook(InitFuncName);
+            ProcessInternalFilter.AddHook(EnterMenuFuncName);
+            ProcessInternalFilter.AddHook(EnterGameFuncName);
+            ProcessInternalFilter.AddHook(TickFuncName);
+            var processInternalDetour = ProcessInternalFilter.RegisterDetour(ProcessInternalDetour);
+
+            var processDeferredMessageDetour =
+                DetourUtil.QueueDetourAt<GameFunctions.ProcessDeferredMessageDelegate>(
+                    api->ProcessDeferredMessage,
+                    ProcessDeferredMessageDetour
+                );
 
-        _ConditionalPostLoadDetourBase =
-            DetourUtil.NewDetour<GameFunctions.ConditionalPostLoadDelegate>(
-                GameInfo.FuncOffsets.ConditionalPostLoad,
-                ConditionalPostLoadDetour
+            var addObjectDetour = DetourUtil.QueueDetourAt<GameFunctions.AddObjectDelegate>(
+                api->AddObject,
+                AddObjectDetour
             );
 
-        _ConditionalDestroyDetourBase =
-            DetourUtil.NewDetour<GameFunctions.ConditionalDestroyDelegate>(
-                GameInfo.FuncOffsets.ConditionalDestroy,
-                ConditionalDestroyDetour
-            );
+            var conditionalPostLoadDetour =
+                DetourUtil.QueueDetourAt<GameFunctions.ConditionalPostLoadDelegate>(
+                    api->ConditionalPostLoad,
+                    ConditionalPostLoadDetour
+                );
+
+            var conditionalDestroyDetour =
+                DetourUtil.QueueDetourAt<GameFunctions.ConditionalDestroyDelegate>(
+                    api->ConditionalDestroy,
+                    ConditionalDestroyDetour
+                );
+
+            DetourUtil.CommitBatch();
+
+            _EngineTickDetourBase = engineTickDetour.Original;
+            _ProcessInternalDetourBase = processInternalDetour.Original;
+            _ProcessDeferredMessageDetourBase = processDeferredMessageDetour.Original;
+            _AddObjectDelegateDetourBase = addObjectDetour.Original;
+            _ConditionalPostLoadDetourBase = conditionalPostLoadDetour.Original;
+            _ConditionalDestroyDetourBase = conditionalDestroyDetour.Original;
+        }
+        finally
+        {
+            // A failed queue throws before the commit, so don't leave its transaction open
+            DetourUtil.AbortBatch();
+        }
     }
 
     private static IntPtr EngineTickDetour(IntPtr self)
     {
+        // No script is on the stack between ticks, so copies of destroyed functions can go
+        Function.FreeReleasedScriptCallablePtrs();
+
         // Run the scheduled callbacks
         EngineSynchronizationContext.Instance.ExecutePending();
         return _EngineTickDetourBase!.Invoke(self);
@@ -99,7 +130,7 @@ internal static class Loader
             IntPtr selfPtr = self;
             FFrame* stackPtr = (FFrame*)Stack.ToPointer();
             var selfObj = MarshalUtil.ToManaged<GameObject>(&selfPtr);
-            var funcObj = MarshalUtil.ToManaged<Function>(&stackPtr->Node);
+            var funcObj = stackPtr->GetFunction();
             var funcName = funcObj.GetPathName();
 
             // Notify scripts of game init
@@ -218,7 +249,9 @@ internal static class Loader
             var obj = MarshalUtil.GetOrCreateWrapper(self);
             if (obj is Function func)
             {
-                RedirectManager.TryConfigureFunction(func);
+                var funcPath = func.GetPathName();
+                RedirectManager.TryConfigureFunction(func, funcPath);
+                ProcessInternalFilter.OnFunctionLoaded(func, funcPath);
             }
 
             // Auto-attach script components to serialized objs
@@ -237,6 +270,9 @@ internal static class Loader
 
         // Call base impl
         _ConditionalDestroyDetourBase!.Invoke(self);
+
+        // Release the callable copy if it's a function, now that the original is fully destroyed
+        RunGuarded(() => Function.ReleaseScriptCallablePtr(self));
     }
 
     private static void RunGuarded(Action action)